@@ -118,6 +118,35 @@ class FDerivedDataCache : public FDerivedDataCacheInterface
 		TArray<uint8>					Data;
 	};
 
+	/** 
+	 * Async worker that gets an item for Prefetch. The hierarchical backend backfills the faster levels on a hit, the data is thrown away
+	**/
+	friend class FPrefetchAsyncWorker;
+	class FPrefetchAsyncWorker : public FNonAbandonableTask
+	{
+	public:
+		FPrefetchAsyncWorker(const FString& InCacheKey)
+		: CacheKey(InCacheKey)
+		{
+		}
+
+		void DoWork()
+		{
+			TArray<uint8> Data;
+			INC_DWORD_STAT(STAT_DDC_NumGets);
+			FDerivedDataBackend::Get().GetRoot().GetCachedData(*CacheKey, Data);
+			FDerivedDataBackend::Get().AddToAsyncCompletionCounter(-1);
+		}
+
+		static const TCHAR *Name()
+		{
+			return TEXT("FPrefetchAsyncWorker");
+		}
+
+		/** Cache key to prefetch **/
+		FString							CacheKey;
+	};
+
 public:
 
 	/** Constructor, called once to cereate a singleton **/
@@ -255,6 +284,27 @@ public:
 		return Handle;
 	}
 
+	virtual void GetAsynchronous(const TArray<FString>& CacheKeys, TArray<uint32>& OutHandles) override
+	{
+		// Each key is its own task, the thread pool runs them side by side
+		OutHandles.Empty(CacheKeys.Num());
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); KeyIndex++)
+		{
+			OutHandles.Add(GetAsynchronous(*CacheKeys[KeyIndex]));
+		}
+	}
+
+	virtual void Prefetch(const TArray<FString>& CacheKeys) override
+	{
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); KeyIndex++)
+		{
+			UE_LOG(LogDerivedDataCache, Verbose, TEXT("Prefetch %s"), *CacheKeys[KeyIndex]);
+			// Counted so WaitForQuiescence doesn't shut down the backends under the prefetch
+			AddToAsyncCompletionCounter(1);
+			(new FAutoDeleteAsyncTask<FPrefetchAsyncWorker>(CacheKeys[KeyIndex]))->StartBackgroundTask();
+		}
+	}
+
 	/** 
 	 * Starts the async process of checking the cache and if the item is present, retrieving the cached results (version for internal use by rollups)
 	 * @param	CacheKey	Key to identify the data
@@ -3,9 +3,11 @@
 #pragma once
 
 #include "Compression.h"
+#include "SecureHash.h"
 
 /** 
  * A simple thread safe, pak file based backend. 
+ * Items with the same payload (e.g. the same shader map built for several keys) share their data in the pak, only the index entry is duplicated.
 **/
 class FPakFileDerivedDataBackend : public FDerivedDataBackendInterface
 {
@@ -65,6 +67,7 @@ public:
 			}
 			FileHandle.Reset();
 			CacheItems.Empty();
+			PayloadItems.Empty();
 			bClosed = true;
 		}
 	}
@@ -163,6 +166,18 @@ public:
 				check(InData.Num());
 				check(Key.Len());
 				uint32 Crc = FCrc::MemCrc_DEPRECATED(InData.GetData(), InData.Num());
+
+				FSHAHash PayloadHash;
+				FSHA1::HashBuffer(InData.GetData(), InData.Num(), PayloadHash.Hash);
+				const FString PayloadKey = PayloadHash.ToString();
+				if (const FCacheValue* Payload = PayloadItems.Find(PayloadKey))
+				{
+					check(Payload->Size == InData.Num() && Payload->Crc == Crc);
+					UE_LOG(LogDerivedDataCache, Verbose, TEXT("FPakFileDerivedDataBackend: Put %s, same data as a previous put"), CacheKey);
+					CacheItems.Add(Key, *Payload);
+					return;
+				}
+
 				check(FileHandle);
 				check(FileHandle->IsSaving());
 				int64 Offset = FileHandle->Tell();
@@ -177,6 +192,7 @@ public:
 					FileHandle->Serialize(InData.GetData(), int64(InData.Num()));
 					UE_LOG(LogDerivedDataCache, Verbose, TEXT("FPakFileDerivedDataBackend: Put %s"), CacheKey);
 					CacheItems.Add(Key,FCacheValue(Offset, InData.Num(), Crc));
+					PayloadItems.Add(PayloadKey,FCacheValue(Offset, InData.Num(), Crc));
 				}
 			}
 		}
@@ -245,6 +261,7 @@ public:
 		Saver << IndexOffset;
 		FileHandle->Serialize(Buffer.GetData(), Buffer.Num());
 		CacheItems.Empty();
+		PayloadItems.Empty();
 		FileHandle.Reset();
 		bClosed = true;
 		return true;
@@ -430,6 +447,8 @@ private:
 	FCriticalSection	SynchronizationObject;
 	/** Set of files that are being written to disk asynchronously. */
 	TMap<FString, FCacheValue> CacheItems;
+	/** Data written so far, by the SHA1 of the payload. Only used when writing */
+	TMap<FString, FCacheValue> PayloadItems;
 	/** File handle of pak. */
 	TAutoPtr<FArchive> FileHandle;
 	/** File name of pak. */
@@ -449,6 +468,7 @@ public:
 	{
 	}
 
+	/** Each item is its uncompressed size followed by the compressed data, or by the data itself when it doesn't get smaller (already compressed textures, etc) */
 	virtual void PutCachedData(const TCHAR* CacheKey, TArray<uint8>& InData, bool bPutEvenIfExists) override
 	{
 		int32 UncompressedSize = InData.Num();
@@ -458,8 +478,17 @@ public:
 		CompressedData.AddUninitialized(CompressedSize + sizeof(UncompressedSize));
 
 		FMemory::Memcpy(&CompressedData[0], &UncompressedSize, sizeof(UncompressedSize));
-		verify(FCompression::CompressMemory(CompressionFlags, CompressedData.GetData() + sizeof(UncompressedSize), CompressedSize, InData.GetData(), InData.Num()));
-		CompressedData.SetNum(CompressedSize + sizeof(UncompressedSize), false);
+		if (FCompression::CompressMemory(CompressionFlags, CompressedData.GetData() + sizeof(UncompressedSize), CompressedSize, InData.GetData(), InData.Num()) &&
+			CompressedSize < UncompressedSize)
+		{
+			CompressedData.SetNum(CompressedSize + sizeof(UncompressedSize), false);
+		}
+		else
+		{
+			// Stored, a payload as big as the uncompressed size is read back as is
+			FMemory::Memcpy(CompressedData.GetData() + sizeof(UncompressedSize), InData.GetData(), UncompressedSize);
+			CompressedData.SetNum(UncompressedSize + sizeof(UncompressedSize), false);
+		}
 
 		FPakFileDerivedDataBackend::PutCachedData(CacheKey, CompressedData, bPutEvenIfExists);
 	}
@@ -472,10 +501,29 @@ public:
 			return false;
 		}
 
-		int32 UncompressedSize;
-		FMemory::Memcpy(&UncompressedSize, &CompressedData[0], sizeof(UncompressedSize));
+		int32 UncompressedSize = 0;
+		const int32 PayloadSize = CompressedData.Num() - sizeof(UncompressedSize);
+		if (PayloadSize > 0)
+		{
+			FMemory::Memcpy(&UncompressedSize, &CompressedData[0], sizeof(UncompressedSize));
+		}
+		if (UncompressedSize <= 0)
+		{
+			UE_LOG(LogDerivedDataCache, Warning, TEXT("Compressed pak file, bad item size on %s."), CacheKey);
+			return false;
+		}
+
 		OutData.SetNum(UncompressedSize);
-		verify(FCompression::UncompressMemory(CompressionFlags, OutData.GetData(), UncompressedSize, CompressedData.GetData() + sizeof(UncompressedSize), CompressedData.Num() - sizeof(UncompressedSize)));
+		if (PayloadSize == UncompressedSize)
+		{
+			FMemory::Memcpy(OutData.GetData(), CompressedData.GetData() + sizeof(UncompressedSize), UncompressedSize);
+		}
+		else if (!FCompression::UncompressMemory(CompressionFlags, OutData.GetData(), UncompressedSize, CompressedData.GetData() + sizeof(UncompressedSize), PayloadSize))
+		{
+			UE_LOG(LogDerivedDataCache, Warning, TEXT("Compressed pak file, could not decompress %s."), CacheKey);
+			OutData.Empty();
+			return false;
+		}
 
 		return true;
 	}
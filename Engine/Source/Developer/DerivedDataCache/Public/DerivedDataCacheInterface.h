@@ -156,6 +156,21 @@ public:
 	**/
 	virtual uint32 GetAsynchronous(const TCHAR* CacheKey, IDerivedDataRollup* Rollup = NULL) = 0;
 
+	/** 
+	 * Starts the async gets of several keys at once. The gets run in parallel, so a batch of misses on the local cache
+	 * waits on the shared cache once instead of once per key
+	 * @param	CacheKeys	Keys to identify the data
+	 * @param	OutHandles	Receives a handle per key, in the same order, for PollAsynchronousCompletion, WaitAsynchronousCompletion and GetAsynchronousResults
+	**/
+	virtual void GetAsynchronous(const TArray<FString>& CacheKeys, TArray<uint32>& OutHandles) = 0;
+
+	/** 
+	 * Hint that the keys will be asked for soon. Fire-and-forget, the data found in the slower (shared) levels of the cache
+	 * is copied to the faster (local) ones in the background, the results are not kept
+	 * @param	CacheKeys	Keys to identify the data
+	**/
+	virtual void Prefetch(const TArray<FString>& CacheKeys) = 0;
+
 	/** 
 	 * Puts data into the cache. This is fire-and-forget and typically asynchronous.
 	 * @param	CacheKey	Key to identify the data
@@ -5,6 +5,7 @@
 #include "MeshUtilities.h"
 
 #include "MeshSimplify.h"
+#include "ParallelFor.h"
 
 class FQuadricSimplifierMeshReductionModule : public IMeshReductionModule
 {
@@ -50,11 +51,22 @@ public:
 
 	bool		operator==(	const VertType& a ) const
 	{
-		return	Position == a.Position &&
-				Normal == a.Normal &&
-				Tangents[0] == a.Tangents[0] &&
-				Tangents[1] == a.Tangents[1] &&
-				TexCoords == a.TexCoords;
+		if( Position != a.Position ||
+			Normal != a.Normal ||
+			Tangents[0] != a.Tangents[0] ||
+			Tangents[1] != a.Tangents[1] )
+		{
+			return false;
+		}
+
+		for( uint32 i = 0; i < NumTexCoords; i++ )
+		{
+			if( TexCoords[i] != a.TexCoords[i] )
+			{
+				return false;
+			}
+		}
+		return true;
 	}
 
 	VertType	operator+( const VertType& a ) const
@@ -109,6 +121,139 @@ public:
 	}
 };
 
+/** Texture coordinates kept by the simplifier, enough for the UVs and the lightmap UVs of most meshes. */
+static const uint32 NumSimpTexCoords = 2;
+
+typedef TVertSimp< NumSimpTexCoords > FVertSimp;
+
+static const uint32 NumSimpAttributes = ( sizeof( FVertSimp ) - sizeof( FVector ) ) / sizeof(float);
+
+typedef TMeshSimplifier< FVertSimp, NumSimpAttributes > FMeshSimp;
+
+/** Faces per cluster the mesh is split into, the interior of the clusters are simplified in parallel. */
+static const int32 GQuadricSimplifierClusterFaces = 8192;
+
+/** Cost above which edges are not collapsed. */
+static const float GQuadricSimplifierMaxError = 200000.0f;
+
+static const float GQuadricSimplifierAttributeWeights[] =
+{
+	16.0f, 16.0f, 16.0f,	// Normal
+	0.1f, 0.1f, 0.1f,		// Tangent[0]
+	0.1f, 0.1f, 0.1f,		// Tangent[1]
+	0.5f, 0.5f,				// TexCoord[0]
+	0.5f, 0.5f				// TexCoord[1]
+};
+static_assert( ARRAY_COUNT( GQuadricSimplifierAttributeWeights ) == NumSimpAttributes, "One weight is needed per vert attribute" );
+
+/** Welded triangles of a part of the mesh being simplified. */
+struct FSimpMesh
+{
+	TArray< FVertSimp >	Verts;
+	TArray< uint32 >	Indexes;
+
+	/** Verts by position, to weld the triangles as they are added. */
+	FHashTable			VertHash;
+
+	FSimpMesh()
+		: VertHash( 4096 )
+	{}
+
+	void Reserve( int32 NumTris )
+	{
+		Verts.Reserve( NumTris );
+		Indexes.Reserve( NumTris * 3 );
+	}
+
+	void Empty()
+	{
+		Verts.Empty();
+		Indexes.Empty();
+		VertHash.Free();
+	}
+
+	void AddTri( const FVertSimp Corners[3] )
+	{
+		// Degenerate triangles are dropped, the simplifier expects 3 different verts
+		if( Corners[0].Position == Corners[1].Position ||
+			Corners[1].Position == Corners[2].Position ||
+			Corners[2].Position == Corners[0].Position )
+		{
+			return;
+		}
+
+		for( int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++ )
+		{
+			Indexes.Add( AddVert( Corners[ CornerIndex ] ) );
+		}
+	}
+
+	void Append( const FSimpMesh& Other )
+	{
+		Reserve( Indexes.Num() / 3 + Other.Indexes.Num() / 3 );
+
+		for( int32 i = 0; i < Other.Indexes.Num(); i += 3 )
+		{
+			const FVertSimp Corners[3] = { Other.Verts[ Other.Indexes[i] ], Other.Verts[ Other.Indexes[i + 1] ], Other.Verts[ Other.Indexes[i + 2] ] };
+			AddTri( Corners );
+		}
+	}
+
+	/** Collapses edges until MinTris are left, boundary verts are locked. */
+	void Simplify( int32 MinTris )
+	{
+		if( Indexes.Num() / 3 <= MinTris )
+		{
+			return;
+		}
+
+		FMeshSimp* MeshSimp = new FMeshSimp( Verts.GetData(), Verts.Num(), Indexes.GetData(), Indexes.Num() );
+
+		MeshSimp->SetAttributeWeights( GQuadricSimplifierAttributeWeights );
+		MeshSimp->SetBoundaryLocked();
+		MeshSimp->InitCosts();
+
+		MeshSimp->SimplifyMesh( GQuadricSimplifierMaxError, MinTris );
+
+		// The output is never larger than the input
+		MeshSimp->OutputMesh( Verts.GetData(), Indexes.GetData() );
+		Verts.SetNum( MeshSimp->GetNumVerts() );
+		Indexes.SetNum( MeshSimp->GetNumTris() * 3 );
+
+		delete MeshSimp;
+
+		// The indexes changed, nothing should be welded to the simplified mesh
+		VertHash.Free();
+	}
+
+private:
+
+	uint32 AddVert( const FVertSimp& Vert )
+	{
+		const uint32 Hash = HashPoint( Vert.Position );
+		for( uint32 i = VertHash.First( Hash ); VertHash.IsValid( i ); i = VertHash.Next( i ) )
+		{
+			if( Verts[i] == Vert )
+			{
+				return i;
+			}
+		}
+
+		const uint32 Index = Verts.Add( Vert );
+		VertHash.Add( Hash, Index );
+		return Index;
+	}
+
+	static uint32 HashPoint( const FVector& p )
+	{
+		uint32 hash;
+		hash  = FMath::MortonCode3( (uint32)p[0] );
+		hash |= FMath::MortonCode3( (uint32)p[1] ) << 1;
+		hash |= FMath::MortonCode3( (uint32)p[2] ) << 2;
+		return hash;
+	}
+};
+
 class FQuadricSimplifierMeshReduction : public IMeshReduction
 {
 public:
@@ -125,221 +270,186 @@ public:
 		const FMeshReductionSettings& InSettings
 		)
 	{
-#if 0
-		TMap<int32,int32> FinalVerts;
-		TArray<int32> DupVerts;
-		int32 NumFaces = InMesh.WedgeIndices.Num() / 3;
+		const int32 NumFaces = InMesh.WedgeIndices.Num() / 3;
+
+		OutReducedMesh.Empty();
+		// The simplifier doesn't track the distance to the source surface
+		OutMaxDeviation = 0.0f;
 
-		// Process each face, build vertex buffer and per-section index buffers.
-		for(int32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++)
+		if( NumFaces == 0 )
 		{
-			int32 VertexIndices[3];
-			FVector CornerPositions[3];
+			return;
+		}
 
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+		// Split the faces in clusters of one material and one cell of a grid over the mesh bounds.
+		// Cluster and material borders are boundaries of the cluster mesh, so they are locked and clusters can be simplified independently.
+		const FBox Bounds( InMesh.VertexPositions.GetData(), InMesh.VertexPositions.Num() );
+		const int32 GridSize = FMath::Clamp( FMath::CeilToInt( FMath::Pow( (float)NumFaces / GQuadricSimplifierClusterFaces, 1.0f / 3.0f ) ), 1, 16 );
+		const FVector BoundsSize = Bounds.GetSize();
+		const FVector CellScale(
+			GridSize / FMath::Max( BoundsSize.X, KINDA_SMALL_NUMBER ),
+			GridSize / FMath::Max( BoundsSize.Y, KINDA_SMALL_NUMBER ),
+			GridSize / FMath::Max( BoundsSize.Z, KINDA_SMALL_NUMBER ) );
+
+		TMap< FIntPoint, int32 > ClusterMap;
+		TArray< TArray< int32 > > ClusterFaces;
+		TArray< int32 > ClusterMaterialSlots;
+		TMap< int32, int32 > MaterialSlotMap;
+		TArray< int32 > MaterialIndices;
+		TArray< uint32 > MaterialSmoothingMasks;
+		TArray< int32 > MaterialNumFaces;
+
+		for( int32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++ )
+		{
+			const int32 MaterialIndex = InMesh.FaceMaterialIndices[ FaceIndex ];
+			int32* MaterialSlot = MaterialSlotMap.Find( MaterialIndex );
+			if( !MaterialSlot )
 			{
-				CornerPositions[CornerIndex] = InMesh.VertexPositions[ InMesh.WedgeIndices[ FaceIndex * 3 + CornerIndex ] ];
+				MaterialSlot = &MaterialSlotMap.Add( MaterialIndex, MaterialIndices.Add( MaterialIndex ) );
+				MaterialSmoothingMasks.Add( 0 );
+				MaterialNumFaces.Add( 0 );
 			}
+			MaterialSmoothingMasks[ *MaterialSlot ] |= InMesh.FaceSmoothingMasks[ FaceIndex ];
+			MaterialNumFaces[ *MaterialSlot ]++;
 
-			// Don't process degenerate triangles.
-			if( PointsEqual(CornerPositions[0],CornerPositions[1], ComparisonThreshold) ||
-				PointsEqual(CornerPositions[1],CornerPositions[2], ComparisonThreshold) ||
-				PointsEqual(CornerPositions[2],CornerPositions[0], ComparisonThreshold) )
+			FVector Center = FVector::ZeroVector;
+			for( int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++ )
 			{
-				continue;
+				Center += InMesh.VertexPositions[ InMesh.WedgeIndices[ FaceIndex * 3 + CornerIndex ] ];
 			}
-
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			const FVector Cell = ( Center / 3.0f - Bounds.Min ) * CellScale;
+			const int32 CellX = FMath::Clamp( FMath::FloorToInt( Cell.X ), 0, GridSize - 1 );
+			const int32 CellY = FMath::Clamp( FMath::FloorToInt( Cell.Y ), 0, GridSize - 1 );
+			const int32 CellZ = FMath::Clamp( FMath::FloorToInt( Cell.Z ), 0, GridSize - 1 );
+
+			const FIntPoint ClusterKey( *MaterialSlot, CellX + GridSize * ( CellY + GridSize * CellZ ) );
+			int32* ClusterIndex = ClusterMap.Find( ClusterKey );
+			if( !ClusterIndex )
 			{
-				int32 WedgeIndex = FaceIndex * 3 + CornerIndex;
-				FStaticMeshBuildVertex ThisVertex = BuildStaticMeshVertex(InMesh, WedgeIndex);
+				ClusterIndex = &ClusterMap.Add( ClusterKey, ClusterFaces.Num() );
+				new( ClusterFaces ) TArray< int32 >();
+				ClusterMaterialSlots.Add( *MaterialSlot );
+			}
+			ClusterFaces[ *ClusterIndex ].Add( FaceIndex );
+		}
+
+		const int32 NumClusters = ClusterFaces.Num();
+		const int32 NumMaterials = MaterialIndices.Num();
+		const bool bSimplifyClusters = NumClusters > NumMaterials;
 
-				int32 Index = INDEX_NONE;
-				for (int32 k = 0; k < DupVerts.Num(); k++)
+		uint32 NumTexCoords = 0;
+		while( NumTexCoords < NumSimpTexCoords && InMesh.WedgeTexCoords[ NumTexCoords ].Num() == InMesh.WedgeIndices.Num() )
+		{
+			NumTexCoords++;
+		}
+		const bool bHasNormals = InMesh.WedgeTangentZ.Num() == InMesh.WedgeIndices.Num();
+		const bool bHasTangents = bHasNormals && InMesh.WedgeTangentX.Num() == InMesh.WedgeIndices.Num() && InMesh.WedgeTangentY.Num() == InMesh.WedgeIndices.Num();
+
+		// Simplify the interior of each cluster concurrently, its borders stay where they are
+		TArray< FSimpMesh > ClusterMeshes;
+		ClusterMeshes.SetNum( NumClusters );
+		ParallelFor( NumClusters, [&]( int32 ClusterIndex )
+		{
+			const TArray< int32 >& Faces = ClusterFaces[ ClusterIndex ];
+			FSimpMesh& Mesh = ClusterMeshes[ ClusterIndex ];
+			Mesh.Reserve( Faces.Num() );
+
+			for( int32 i = 0; i < Faces.Num(); i++ )
+			{
+				FVertSimp Corners[3];
+				for( int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++ )
 				{
-					if (DupVerts[k] >= WedgeIndex)
+					const int32 WedgeIndex = Faces[i] * 3 + CornerIndex;
+					FVertSimp& Vert = Corners[ CornerIndex ];
+					FMemory::Memzero( &Vert, sizeof( Vert ) );
+
+					Vert.Position = InMesh.VertexPositions[ InMesh.WedgeIndices[ WedgeIndex ] ];
+					if( bHasNormals )
 					{
-						// the verts beyond me haven't been placed yet, so these duplicates are not relevant
-						break;
+						Vert.Normal = InMesh.WedgeTangentZ[ WedgeIndex ];
 					}
-
-					int32 *Location = FinalVerts.Find(DupVerts[k]);
-					if (Location != NULL
-						&& AreVerticesEqual(ThisVertex, OutVertices[*Location], ComparisonThreshold))
+					if( bHasTangents )
 					{
-						Index = *Location;
-						break;
+						Vert.Tangents[0] = InMesh.WedgeTangentX[ WedgeIndex ];
+						Vert.Tangents[1] = InMesh.WedgeTangentY[ WedgeIndex ];
+					}
+					for( uint32 TexCoordIndex = 0; TexCoordIndex < NumTexCoords; TexCoordIndex++ )
+					{
+						Vert.TexCoords[ TexCoordIndex ] = InMesh.WedgeTexCoords[ TexCoordIndex ][ WedgeIndex ];
 					}
 				}
-				if (Index == INDEX_NONE)
-				{
-					Index = OutVertices.Add(ThisVertex);
-					FinalVerts.Add(WedgeIndex,Index);
-				}
-				VertexIndices[CornerIndex] = Index;
-			}
-
-			// Reject degenerate triangles.
-			if( VertexIndices[0] == VertexIndices[1] ||
-				VertexIndices[1] == VertexIndices[2] ||
-				VertexIndices[2] == VertexIndices[0] )
-			{
-				continue;
+				Mesh.AddTri( Corners );
 			}
 
-			// Put the indices in the material index buffer.
-			int32 SectionIndex = FMath::Clamp(RawMesh.FaceMaterialIndices[FaceIndex], 0, OutPerSectionIndices.Num());
-			TArray<uint32>& SectionIndices = OutPerSectionIndices[SectionIndex];
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			if( bSimplifyClusters )
 			{
-				SectionIndices.Add(VertexIndices[CornerIndex]);
+				Mesh.Simplify( FMath::CeilToInt( Faces.Num() * InSettings.PercentTriangles ) );
 			}
-		}
-#endif
-
-
-
-
-		uint32 NumVerts = 0;
-		uint32 NumIndexes = 0;
-
-		TVertSimp<1>* Verts = new TVertSimp<1>[ NumVerts ];
+		});
 
-
-#if 0
-		int32 NumVertices = InMesh.VertexPositions.Num();
-		int32 NumWedges = InMesh.WedgeIndices.Num();
-		int32 NumTris = NumWedges / 3;
-
-		if (NumWedges == 0)
+		// Stitch the clusters of each material back together and simplify across the former cluster borders to reach the target
+		TArray< FSimpMesh > MaterialMeshes;
+		MaterialMeshes.SetNum( NumMaterials );
+		ParallelFor( NumMaterials, [&]( int32 MaterialSlot )
 		{
-			return NULL;
-		}
-
-		for(int32 TexCoordIndex = 0; TexCoordIndex < MAX_MESH_TEXTURE_COORDS; ++TexCoordIndex)
-		{
-			if (RawMesh.WedgeTexCoords[TexCoordIndex].Num() == NumWedges)
+			FSimpMesh& Mesh = MaterialMeshes[ MaterialSlot ];
+			for( int32 ClusterIndex = 0; ClusterIndex < NumClusters; ClusterIndex++ )
 			{
-				GeometryData->AddTexCoords(TexCoordIndex);
-				SimplygonSDK::spRealArray TexCoords = GeometryData->GetTexCoords(TexCoordIndex);
-				check(TexCoords->GetTupleSize() == 2);
-				for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; ++WedgeIndex)
+				if( ClusterMaterialSlots[ ClusterIndex ] == MaterialSlot )
 				{
-					TexCoords->SetTuple(WedgeIndex, (float*)&RawMesh.WedgeTexCoords[TexCoordIndex][WedgeIndex]);
+					Mesh.Append( ClusterMeshes[ ClusterIndex ] );
+					ClusterMeshes[ ClusterIndex ].Empty();
 				}
 			}
-		}
+			Mesh.Simplify( FMath::CeilToInt( MaterialNumFaces[ MaterialSlot ] * InSettings.PercentTriangles ) );
+		});
 
-		if (RawMesh.WedgeColors.Num() == NumWedges)
+		// Build the raw mesh, the verts of the materials share positions on material borders
+		TMap< FVector, int32 > PositionMap;
+		for( int32 MaterialSlot = 0; MaterialSlot < NumMaterials; MaterialSlot++ )
 		{
-			GeometryData->AddColors(0);
-			SimplygonSDK::spRealArray LinearColors = GeometryData->GetColors(0);
-			check(LinearColors);
-			check(LinearColors->GetTupleSize() == 4);
-			for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; ++WedgeIndex)
-			{
-				FLinearColor LinearColor(RawMesh.WedgeColors[WedgeIndex]);
-				LinearColors->SetTuple(WedgeIndex, (float*)&LinearColor);
-			}
-		}
+			const FSimpMesh& Mesh = MaterialMeshes[ MaterialSlot ];
+			const int32 NumTris = Mesh.Indexes.Num() / 3;
 
-		if (InMesh.WedgeTangentZ.Num() == NumWedges)
-		{
-			if (InMesh.WedgeTangentX.Num() == NumWedges && InMesh.WedgeTangentY.Num() == NumWedges)
+			for( int32 i = 0; i < Mesh.Indexes.Num(); i++ )
 			{
-				GeometryData->AddTangents(0);
-				SimplygonSDK::spRealArray Tangents = GeometryData->GetTangents(0);
-				for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; ++WedgeIndex)
+				const FVertSimp& Vert = Mesh.Verts[ Mesh.Indexes[i] ];
+
+				int32* PositionIndex = PositionMap.Find( Vert.Position );
+				if( !PositionIndex )
 				{
-					Tangents->SetTuple(WedgeIndex, (float*)&RawMesh.WedgeTangentX[WedgeIndex]);
+					PositionIndex = &PositionMap.Add( Vert.Position, OutReducedMesh.VertexPositions.Add( Vert.Position ) );
 				}
+				OutReducedMesh.WedgeIndices.Add( *PositionIndex );
 
-				GeometryData->AddBitangents(0);
-				SimplygonSDK::spRealArray Bitangents = GeometryData->GetBitangents(0);
-				for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; ++WedgeIndex)
+				if( bHasNormals )
 				{
-					Bitangents->SetTuple(WedgeIndex, (float*)&RawMesh.WedgeTangentY[WedgeIndex]);
+					OutReducedMesh.WedgeTangentZ.Add( Vert.Normal );
+				}
+				if( bHasTangents )
+				{
+					OutReducedMesh.WedgeTangentX.Add( Vert.Tangents[0] );
+					OutReducedMesh.WedgeTangentY.Add( Vert.Tangents[1] );
+				}
+				for( uint32 TexCoordIndex = 0; TexCoordIndex < NumTexCoords; TexCoordIndex++ )
+				{
+					OutReducedMesh.WedgeTexCoords[ TexCoordIndex ].Add( Vert.TexCoords[ TexCoordIndex ] );
 				}
 			}
-			GeometryData->AddNormals();
-			SimplygonSDK::spRealArray Normals = GeometryData->GetNormals();
-			for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; ++WedgeIndex)
+
+			for( int32 i = 0; i < NumTris; i++ )
 			{
-				Normals->SetTuple(WedgeIndex, (float*)&RawMesh.WedgeTangentZ[WedgeIndex]);
+				// Faces of the same material are simplified together, their smoothing groups are merged
+				OutReducedMesh.FaceMaterialIndices.Add( MaterialIndices[ MaterialSlot ] );
+				OutReducedMesh.FaceSmoothingMasks.Add( MaterialSmoothingMasks[ MaterialSlot ] );
 			}
 		}
 
-		// Per-triangle data.
-		/*for (int32 TriIndex = 0; TriIndex < NumTris; ++TriIndex)
-		{
-			MaterialIndices->SetItem(TriIndex, RawMesh.FaceMaterialIndices[TriIndex]);
-			GroupIds->SetItem(TriIndex, RawMesh.FaceSmoothingMasks[TriIndex]);
-		}*/
-
-		for( uint32 i = 0; i < NumVerts; i++ )
-		{
-			Verts[i].Position		= InMesh.VertexPositions[i];
-			Verts[i].TexCoords[0]	= tri->verts[i].st;
-			Verts[i].Normal			= tri->verts[i].normal;
-			Verts[i].Tangents[0]	= tri->verts[i].tangents[0];
-			Verts[i].Tangents[1]	= tri->verts[i].tangents[1];
-		}
-
-		for( uint32 i = 0; i < NumVerts; i++ )
+		if( NumTexCoords == 0 )
 		{
-			Verts[i].Position.x = 0.0625f * FMath::RoundToFloat( 16.0f * Verts[i].Position.X );
-			Verts[i].Position.y = 0.0625f * FMath::RoundToFloat( 16.0f * Verts[i].Position.Y );
-			Verts[i].Position.z = 0.0625f * FMath::RoundToFloat( 16.0f * Verts[i].Position.Z );
+			// All meshes must have a valid texture coordinate
+			OutReducedMesh.WedgeTexCoords[0].AddZeroed( OutReducedMesh.WedgeIndices.Num() );
 		}
-
-		for( uint32 i = 0; i < NumVerts; i++ )
-		{
-			Verts[i].Normal			= InMesh.WedgeTangentZ[i];
-			Verts[i].Tangents[0]	= tri->verts[i].tangents[0];
-			Verts[i].Tangents[1]	= tri->verts[i].tangents[1];
-		}
-#endif
-
-		uint32* Indexes = new uint32[ NumIndexes ];
-
-		for( uint32 i = 0; i < NumIndexes; i++ )
-		{
-			 Indexes[i] = InMesh.WedgeIndices[i];
-		}
-
-		const uint32 NumAttributes = ( sizeof( TVertSimp<1> ) - sizeof( FVector ) ) / sizeof(float);
-		TMeshSimplifier< TVertSimp<1>, NumAttributes >* MeshSimp = new TMeshSimplifier< TVertSimp<1>, NumAttributes >( Verts, NumVerts, Indexes, NumIndexes );
-
-		const float AttributeWeights[] =
-		{
-			16.0f, 16.0f, 16.0f,	// Normal
-			0.1f, 0.1f, 0.1f,		// Tangent[0]
-			0.1f, 0.1f, 0.1f,		// Tangent[1]
-			0.5f, 0.5f,				// TexCoord[0]
-			0.5f, 0.5f,				// TexCoord[1]
-			0.5f, 0.5f,				// TexCoord[2]
-			0.5f, 0.5f				// TexCoord[3]
-		};
-
-		MeshSimp->SetAttributeWeights( AttributeWeights );
-		MeshSimp->SetBoundaryLocked();
-		MeshSimp->InitCosts();
-
-		int32 NumTris = NumIndexes / 3;
-
-		MeshSimp->SimplifyMesh( 200000.0f, NumTris * InSettings.PercentTriangles );
-
-		NumVerts = MeshSimp->GetNumVerts();
-		NumIndexes = MeshSimp->GetNumTris() * 3;
-
-		MeshSimp->OutputMesh( Verts, Indexes );
-		delete MeshSimp;
-
-		delete[] Verts;
-		delete[] Indexes;
-
-	//	CreateRawMeshFromGeometry(OutReducedMesh, GeometryData, WINDING_Keep);
-	//	OutMaxDeviation = ReductionProcessor->GetMaxDeviation();
 	}
 
 	virtual bool ReduceSkeletalMesh(
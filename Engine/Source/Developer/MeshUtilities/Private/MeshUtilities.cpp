@@ -23,6 +23,7 @@
 //@todo - implement required vector intrinsics for other implementations
 #if PLATFORM_ENABLE_VECTORINTRINSICS
 #include "kDOP.h"
+#include "ParallelFor.h"
 #endif
 
 /*------------------------------------------------------------------------------
@@ -1237,6 +1238,24 @@ struct FCompareIndexAndZ
 	FORCEINLINE bool operator()(FIndexAndZ const& A, FIndexAndZ const& B) const { return A.Z < B.Z; }
 };
 
+/** Number of wedges or faces processed by each parallel task of the mesh build, big enough to amortize the per task scratch data. */
+static const int32 GMeshBuildParallelChunkSize = 1024;
+
+/**
+ * Calls Body(ChunkIndex, First, Last) for consecutive chunks of GMeshBuildParallelChunkSize elements covering [0, Num), in parallel.
+ * @return the number of chunks.
+ */
+static int32 ParallelForChunks(int32 Num, TFunctionRef<void(int32,int32,int32)> Body)
+{
+	const int32 NumChunks = FMath::DivideAndRoundUp(Num, GMeshBuildParallelChunkSize);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 First = ChunkIndex * GMeshBuildParallelChunkSize;
+		Body(ChunkIndex, First, FMath::Min(First + GMeshBuildParallelChunkSize, Num));
+	});
+	return NumChunks;
+}
+
 static int32 ComputeNumTexCoords(FRawMesh const& RawMesh, int32 MaxSupportedTexCoords)
 {
 	int32 NumWedges = RawMesh.WedgeIndices.Num();
@@ -1552,24 +1571,47 @@ static void FindOverlappingCorners(
 	// Sort the vertices by z value
 	VertIndexAndZ.Sort(FCompareIndexAndZ());
 
-	// Search for duplicates, quickly!
-	for (int32 i = 0; i < VertIndexAndZ.Num(); i++)
+	// Search for duplicates, quickly! The sorted list is searched in parallel chunks, the pairs found
+	// by each chunk are added in chunk order so the map is the same as with a serial search.
+	TArray<TArray<FIntPoint> > ChunkPairs;
+	ChunkPairs.SetNum(FMath::DivideAndRoundUp(NumWedges, GMeshBuildParallelChunkSize));
+	ParallelForChunks(NumWedges, [&](int32 ChunkIndex, int32 First, int32 Last)
 	{
-		// only need to search forward, since we add pairs both ways
-		for (int32 j = i + 1; j < VertIndexAndZ.Num(); j++)
+		TArray<FIntPoint>& Pairs = ChunkPairs[ChunkIndex];
+		for (int32 i = First; i < Last; i++)
 		{
-			if (FMath::Abs(VertIndexAndZ[j].Z - VertIndexAndZ[i].Z) > ComparisonThreshold)
-				break; // can't be any more dups
+			// only need to search forward, since we add pairs both ways
+			for (int32 j = i + 1; j < VertIndexAndZ.Num(); j++)
+			{
+				if (FMath::Abs(VertIndexAndZ[j].Z - VertIndexAndZ[i].Z) > ComparisonThreshold)
+					break; // can't be any more dups
 
-			FVector PositionA = GetPositionForWedge(RawMesh, VertIndexAndZ[i].Index);
-			FVector PositionB = GetPositionForWedge(RawMesh, VertIndexAndZ[j].Index);
+				FVector PositionA = GetPositionForWedge(RawMesh, VertIndexAndZ[i].Index);
+				FVector PositionB = GetPositionForWedge(RawMesh, VertIndexAndZ[j].Index);
 
-			if (PointsEqual(PositionA, PositionB, ComparisonThreshold))					
-			{
-				OutOverlappingCorners.Add(VertIndexAndZ[i].Index,VertIndexAndZ[j].Index);
-				OutOverlappingCorners.Add(VertIndexAndZ[j].Index,VertIndexAndZ[i].Index);
+				if (PointsEqual(PositionA, PositionB, ComparisonThreshold))
+				{
+					Pairs.Add(FIntPoint(VertIndexAndZ[i].Index, VertIndexAndZ[j].Index));
+				}
 			}
 		}
+	});
+
+	int32 NumPairs = 0;
+	for (int32 ChunkIndex = 0; ChunkIndex < ChunkPairs.Num(); ChunkIndex++)
+	{
+		NumPairs += ChunkPairs[ChunkIndex].Num();
+	}
+	OutOverlappingCorners.Reserve(OutOverlappingCorners.Num() + 2 * NumPairs);
+
+	for (int32 ChunkIndex = 0; ChunkIndex < ChunkPairs.Num(); ChunkIndex++)
+	{
+		const TArray<FIntPoint>& Pairs = ChunkPairs[ChunkIndex];
+		for (int32 PairIndex = 0; PairIndex < Pairs.Num(); PairIndex++)
+		{
+			OutOverlappingCorners.Add(Pairs[PairIndex].X, Pairs[PairIndex].Y);
+			OutOverlappingCorners.Add(Pairs[PairIndex].Y, Pairs[PairIndex].X);
+		}
 	}
 }
 
@@ -1618,11 +1660,6 @@ static void ComputeTangents(
 		bIgnoreDegenerateTriangles ? SMALL_NUMBER : 0.0f
 		);
 
-	// Declare these out here to avoid reallocations.
-	TArray<FFanFace> RelevantFacesForCorner[3];
-	TArray<int32> AdjacentFaces;
-	TArray<int32> DupVerts;
-
 	int32 NumWedges = RawMesh.WedgeIndices.Num();
 	int32 NumFaces = NumWedges / 3;
 
@@ -1643,268 +1680,277 @@ static void ComputeTangents(
 		RawMesh.WedgeTangentZ.AddZeroed(NumWedges);
 	}
 
-	for (int32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++)
+	// Faces only write the tangents of their own corners, so they are processed in parallel.
+	ParallelForChunks(NumFaces, [&](int32 ChunkIndex, int32 FirstFaceIndex, int32 LastFaceIndex)
 	{
-		int32 WedgeOffset = FaceIndex * 3;
-		FVector CornerPositions[3];
-		FVector CornerTangentX[3];
-		FVector CornerTangentY[3];
-		FVector CornerTangentZ[3];
+		// Declare these out here to avoid reallocations.
+		TArray<FFanFace> RelevantFacesForCorner[3];
+		TArray<int32> AdjacentFaces;
+		TArray<int32> DupVerts;
 
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+		for (int32 FaceIndex = FirstFaceIndex; FaceIndex < LastFaceIndex; FaceIndex++)
 		{
-			CornerTangentX[CornerIndex] = FVector::ZeroVector;
-			CornerTangentY[CornerIndex] = FVector::ZeroVector;
-			CornerTangentZ[CornerIndex] = FVector::ZeroVector;
-			CornerPositions[CornerIndex] = GetPositionForWedge(RawMesh, WedgeOffset + CornerIndex);
-			RelevantFacesForCorner[CornerIndex].Reset();
-		}
-
-		// Don't process degenerate triangles.
-		if (PointsEqual(CornerPositions[0],CornerPositions[1], ComparisonThreshold)
-			|| PointsEqual(CornerPositions[0],CornerPositions[2], ComparisonThreshold)
-			|| PointsEqual(CornerPositions[1],CornerPositions[2], ComparisonThreshold))
-		{
-			continue;
-		}
-
-		// No need to process triangles if tangents already exist.
-		bool bCornerHasTangents[3] = {0};
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			bCornerHasTangents[CornerIndex] = !RawMesh.WedgeTangentX[WedgeOffset + CornerIndex].IsZero()
-				&& !RawMesh.WedgeTangentY[WedgeOffset + CornerIndex].IsZero()
-				&& !RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero();
-		}
-		if (bCornerHasTangents[0] && bCornerHasTangents[1] && bCornerHasTangents[2])
-		{
-			continue;
-		}
-
-		// Calculate smooth vertex normals.
-		float Determinant = FVector::Triple(
-			TriangleTangentX[FaceIndex],
-			TriangleTangentY[FaceIndex],
-			TriangleTangentZ[FaceIndex]
-			);
+			int32 WedgeOffset = FaceIndex * 3;
+			FVector CornerPositions[3];
+			FVector CornerTangentX[3];
+			FVector CornerTangentY[3];
+			FVector CornerTangentZ[3];
 
-		// Start building a list of faces adjacent to this face.
-		AdjacentFaces.Reset();
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			int32 ThisCornerIndex = WedgeOffset + CornerIndex;
-			DupVerts.Reset();
-			OverlappingCorners.MultiFind(ThisCornerIndex,DupVerts);
-			DupVerts.Add(ThisCornerIndex); // I am a "dup" of myself
-			for (int32 k = 0; k < DupVerts.Num(); k++)
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 			{
-				AdjacentFaces.AddUnique(DupVerts[k] / 3);
+				CornerTangentX[CornerIndex] = FVector::ZeroVector;
+				CornerTangentY[CornerIndex] = FVector::ZeroVector;
+				CornerTangentZ[CornerIndex] = FVector::ZeroVector;
+				CornerPositions[CornerIndex] = GetPositionForWedge(RawMesh, WedgeOffset + CornerIndex);
+				RelevantFacesForCorner[CornerIndex].Reset();
 			}
-		}
 
-		// We need to sort these here because the criteria for point equality is
-		// exact, so we must ensure the exact same order for all dups.
-		AdjacentFaces.Sort();
+			// Don't process degenerate triangles.
+			if (PointsEqual(CornerPositions[0],CornerPositions[1], ComparisonThreshold)
+				|| PointsEqual(CornerPositions[0],CornerPositions[2], ComparisonThreshold)
+				|| PointsEqual(CornerPositions[1],CornerPositions[2], ComparisonThreshold))
+			{
+				continue;
+			}
 
-		// Process adjacent faces
-		for (int32 AdjacentFaceIndex = 0; AdjacentFaceIndex < AdjacentFaces.Num(); AdjacentFaceIndex++)
-		{
-			int32 OtherFaceIndex = AdjacentFaces[AdjacentFaceIndex];
-			for (int32 OurCornerIndex = 0; OurCornerIndex < 3; OurCornerIndex++)
+			// No need to process triangles if tangents already exist.
+			bool bCornerHasTangents[3] = {0};
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 			{
-				if (bCornerHasTangents[OurCornerIndex])
-					continue;
+				bCornerHasTangents[CornerIndex] = !RawMesh.WedgeTangentX[WedgeOffset + CornerIndex].IsZero()
+					&& !RawMesh.WedgeTangentY[WedgeOffset + CornerIndex].IsZero()
+					&& !RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero();
+			}
+			if (bCornerHasTangents[0] && bCornerHasTangents[1] && bCornerHasTangents[2])
+			{
+				continue;
+			}
 
-				FFanFace NewFanFace;
-				int32 CommonIndexCount = 0;
+			// Calculate smooth vertex normals.
+			float Determinant = FVector::Triple(
+				TriangleTangentX[FaceIndex],
+				TriangleTangentY[FaceIndex],
+				TriangleTangentZ[FaceIndex]
+				);
 
-				// Check for vertices in common.
-				if (FaceIndex == OtherFaceIndex)
+			// Start building a list of faces adjacent to this face.
+			AdjacentFaces.Reset();
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			{
+				int32 ThisCornerIndex = WedgeOffset + CornerIndex;
+				DupVerts.Reset();
+				OverlappingCorners.MultiFind(ThisCornerIndex,DupVerts);
+				DupVerts.Add(ThisCornerIndex); // I am a "dup" of myself
+				for (int32 k = 0; k < DupVerts.Num(); k++)
 				{
-					CommonIndexCount = 3;		
-					NewFanFace.LinkedVertexIndex = OurCornerIndex;
+					AdjacentFaces.AddUnique(DupVerts[k] / 3);
 				}
-				else
+			}
+
+			// We need to sort these here because the criteria for point equality is
+			// exact, so we must ensure the exact same order for all dups.
+			AdjacentFaces.Sort();
+
+			// Process adjacent faces
+			for (int32 AdjacentFaceIndex = 0; AdjacentFaceIndex < AdjacentFaces.Num(); AdjacentFaceIndex++)
+			{
+				int32 OtherFaceIndex = AdjacentFaces[AdjacentFaceIndex];
+				for (int32 OurCornerIndex = 0; OurCornerIndex < 3; OurCornerIndex++)
 				{
-					// Check matching vertices against main vertex .
-					for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
+					if (bCornerHasTangents[OurCornerIndex])
+						continue;
+
+					FFanFace NewFanFace;
+					int32 CommonIndexCount = 0;
+
+					// Check for vertices in common.
+					if (FaceIndex == OtherFaceIndex)
 					{
-						if (PointsEqual(
-								CornerPositions[OurCornerIndex],
-								GetPositionForWedge(RawMesh, OtherFaceIndex * 3 + OtherCornerIndex),
-								ComparisonThreshold
-								))
+						CommonIndexCount = 3;		
+						NewFanFace.LinkedVertexIndex = OurCornerIndex;
+					}
+					else
+					{
+						// Check matching vertices against main vertex .
+						for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
 						{
-							CommonIndexCount++;
-							NewFanFace.LinkedVertexIndex = OtherCornerIndex;
+							if (PointsEqual(
+									CornerPositions[OurCornerIndex],
+									GetPositionForWedge(RawMesh, OtherFaceIndex * 3 + OtherCornerIndex),
+									ComparisonThreshold
+									))
+							{
+								CommonIndexCount++;
+								NewFanFace.LinkedVertexIndex = OtherCornerIndex;
+							}
 						}
 					}
-				}
 
-				// Add if connected by at least one point. Smoothing matches are considered later.
-				if (CommonIndexCount > 0)
-				{ 					
-					NewFanFace.FaceIndex = OtherFaceIndex;
-					NewFanFace.bFilled = (OtherFaceIndex == FaceIndex); // Starter face for smoothing floodfill.
-					NewFanFace.bBlendTangents = NewFanFace.bFilled;
-					NewFanFace.bBlendNormals = NewFanFace.bFilled;
-					RelevantFacesForCorner[OurCornerIndex].Add(NewFanFace);
+					// Add if connected by at least one point. Smoothing matches are considered later.
+					if (CommonIndexCount > 0)
+					{ 					
+						NewFanFace.FaceIndex = OtherFaceIndex;
+						NewFanFace.bFilled = (OtherFaceIndex == FaceIndex); // Starter face for smoothing floodfill.
+						NewFanFace.bBlendTangents = NewFanFace.bFilled;
+						NewFanFace.bBlendNormals = NewFanFace.bFilled;
+						RelevantFacesForCorner[OurCornerIndex].Add(NewFanFace);
+					}
 				}
 			}
-		}
-
-		// Find true relevance of faces for a vertex normal by traversing
-		// smoothing-group-compatible connected triangle fans around common vertices.
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			if (bCornerHasTangents[CornerIndex])
-				continue;
 
-			int32 NewConnections;
-			do
+			// Find true relevance of faces for a vertex normal by traversing
+			// smoothing-group-compatible connected triangle fans around common vertices.
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 			{
-				NewConnections = 0;
-				for (int32 OtherFaceIdx=0; OtherFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); OtherFaceIdx++)
+				if (bCornerHasTangents[CornerIndex])
+					continue;
+
+				int32 NewConnections;
+				do
 				{
-					FFanFace& OtherFace = RelevantFacesForCorner[CornerIndex][OtherFaceIdx];
-					// The vertex' own face is initially the only face with bFilled == true.
-					if (OtherFace.bFilled)
-					{				
-						for (int32 NextFaceIndex = 0; NextFaceIndex < RelevantFacesForCorner[CornerIndex].Num(); NextFaceIndex++)
-						{
-							FFanFace& NextFace = RelevantFacesForCorner[CornerIndex][NextFaceIndex];
-							if (!NextFace.bFilled) // && !NextFace.bBlendTangents)
+					NewConnections = 0;
+					for (int32 OtherFaceIdx=0; OtherFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); OtherFaceIdx++)
+					{
+						FFanFace& OtherFace = RelevantFacesForCorner[CornerIndex][OtherFaceIdx];
+						// The vertex' own face is initially the only face with bFilled == true.
+						if (OtherFace.bFilled)
+						{				
+							for (int32 NextFaceIndex = 0; NextFaceIndex < RelevantFacesForCorner[CornerIndex].Num(); NextFaceIndex++)
 							{
-								if ((NextFaceIndex != OtherFaceIdx)
-									&& (RawMesh.FaceSmoothingMasks[NextFace.FaceIndex] & RawMesh.FaceSmoothingMasks[OtherFace.FaceIndex]))
-								{				
-									int32 CommonVertices = 0;
-									int32 CommonTangentVertices = 0;
-									int32 CommonNormalVertices = 0;
-									for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
-									{											
-										for (int32 NextCornerIndex = 0; NextCornerIndex < 3; NextCornerIndex++)
-										{
-											int32 NextVertexIndex = RawMesh.WedgeIndices[NextFace.FaceIndex * 3 + NextCornerIndex];
-											int32 OtherVertexIndex = RawMesh.WedgeIndices[OtherFace.FaceIndex * 3 + OtherCornerIndex];
-											if (PointsEqual(
-													RawMesh.VertexPositions[NextVertexIndex],
-													RawMesh.VertexPositions[OtherVertexIndex],
-													ComparisonThreshold))
+								FFanFace& NextFace = RelevantFacesForCorner[CornerIndex][NextFaceIndex];
+								if (!NextFace.bFilled) // && !NextFace.bBlendTangents)
+								{
+									if ((NextFaceIndex != OtherFaceIdx)
+										&& (RawMesh.FaceSmoothingMasks[NextFace.FaceIndex] & RawMesh.FaceSmoothingMasks[OtherFace.FaceIndex]))
+									{				
+										int32 CommonVertices = 0;
+										int32 CommonTangentVertices = 0;
+										int32 CommonNormalVertices = 0;
+										for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
+										{											
+											for (int32 NextCornerIndex = 0; NextCornerIndex < 3; NextCornerIndex++)
 											{
-												CommonVertices++;
-												if (UVsEqual(
-														RawMesh.WedgeTexCoords[0][NextFace.FaceIndex * 3 + NextCornerIndex],
-														RawMesh.WedgeTexCoords[0][OtherFace.FaceIndex * 3 + OtherCornerIndex]))
+												int32 NextVertexIndex = RawMesh.WedgeIndices[NextFace.FaceIndex * 3 + NextCornerIndex];
+												int32 OtherVertexIndex = RawMesh.WedgeIndices[OtherFace.FaceIndex * 3 + OtherCornerIndex];
+												if (PointsEqual(
+														RawMesh.VertexPositions[NextVertexIndex],
+														RawMesh.VertexPositions[OtherVertexIndex],
+														ComparisonThreshold))
 												{
-													CommonTangentVertices++;
+													CommonVertices++;
+													if (UVsEqual(
+															RawMesh.WedgeTexCoords[0][NextFace.FaceIndex * 3 + NextCornerIndex],
+															RawMesh.WedgeTexCoords[0][OtherFace.FaceIndex * 3 + OtherCornerIndex]))
+													{
+														CommonTangentVertices++;
+													}
+													if (bBlendOverlappingNormals
+														|| NextVertexIndex == OtherVertexIndex)
+													{
+														CommonNormalVertices++;
+													}
 												}
-												if (bBlendOverlappingNormals
-													|| NextVertexIndex == OtherVertexIndex)
+											}										
+										}
+										// Flood fill faces with more than one common vertices which must be touching edges.
+										if (CommonVertices > 1)
+										{
+											NextFace.bFilled = true;
+											NextFace.bBlendNormals = (CommonNormalVertices > 1);
+											NewConnections++;
+
+											// Only blend tangents if there is no UV seam along the edge with this face.
+											if (OtherFace.bBlendTangents && CommonTangentVertices > 1)
+											{
+												float OtherDeterminant = FVector::Triple(
+													TriangleTangentX[NextFace.FaceIndex],
+													TriangleTangentY[NextFace.FaceIndex],
+													TriangleTangentZ[NextFace.FaceIndex]
+													);
+												if ((Determinant * OtherDeterminant) > 0.0f)
 												{
-													CommonNormalVertices++;
+													NextFace.bBlendTangents = true;
 												}
 											}
-										}										
+										}								
 									}
-									// Flood fill faces with more than one common vertices which must be touching edges.
-									if (CommonVertices > 1)
-									{
-										NextFace.bFilled = true;
-										NextFace.bBlendNormals = (CommonNormalVertices > 1);
-										NewConnections++;
-
-										// Only blend tangents if there is no UV seam along the edge with this face.
-										if (OtherFace.bBlendTangents && CommonTangentVertices > 1)
-										{
-											float OtherDeterminant = FVector::Triple(
-												TriangleTangentX[NextFace.FaceIndex],
-												TriangleTangentY[NextFace.FaceIndex],
-												TriangleTangentZ[NextFace.FaceIndex]
-												);
-											if ((Determinant * OtherDeterminant) > 0.0f)
-											{
-												NextFace.bBlendTangents = true;
-											}
-										}
-									}								
 								}
 							}
 						}
 					}
 				}
+				while (NewConnections > 0);
 			}
-			while (NewConnections > 0);
-		}
 
-		// Vertex normal construction.
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			if (bCornerHasTangents[CornerIndex])
-			{
-				CornerTangentX[CornerIndex] = RawMesh.WedgeTangentX[WedgeOffset + CornerIndex];
-				CornerTangentY[CornerIndex] = RawMesh.WedgeTangentY[WedgeOffset + CornerIndex];
-				CornerTangentZ[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
-			}
-			else
+			// Vertex normal construction.
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 			{
-				for (int32 RelevantFaceIdx = 0; RelevantFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); RelevantFaceIdx++)
-				{
-					FFanFace const& RelevantFace = RelevantFacesForCorner[CornerIndex][RelevantFaceIdx];
-					if (RelevantFace.bFilled)
-					{
-						int32 OtherFaceIndex = RelevantFace.FaceIndex;
-						if (RelevantFace.bBlendTangents)
-						{
-							CornerTangentX[CornerIndex] += TriangleTangentX[OtherFaceIndex];
-							CornerTangentY[CornerIndex] += TriangleTangentY[OtherFaceIndex];
-						}
-						if (RelevantFace.bBlendNormals)
-						{
-							CornerTangentZ[CornerIndex] += TriangleTangentZ[OtherFaceIndex];
-						}
-					}
-				}
-				if (!RawMesh.WedgeTangentX[WedgeOffset + CornerIndex].IsZero())
+				if (bCornerHasTangents[CornerIndex])
 				{
 					CornerTangentX[CornerIndex] = RawMesh.WedgeTangentX[WedgeOffset + CornerIndex];
-				}
-				if (!RawMesh.WedgeTangentY[WedgeOffset + CornerIndex].IsZero())
-				{
 					CornerTangentY[CornerIndex] = RawMesh.WedgeTangentY[WedgeOffset + CornerIndex];
+					CornerTangentZ[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
 				}
-				if (!RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero())
+				else
 				{
-					CornerTangentZ[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
+					for (int32 RelevantFaceIdx = 0; RelevantFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); RelevantFaceIdx++)
+					{
+						FFanFace const& RelevantFace = RelevantFacesForCorner[CornerIndex][RelevantFaceIdx];
+						if (RelevantFace.bFilled)
+						{
+							int32 OtherFaceIndex = RelevantFace.FaceIndex;
+							if (RelevantFace.bBlendTangents)
+							{
+								CornerTangentX[CornerIndex] += TriangleTangentX[OtherFaceIndex];
+								CornerTangentY[CornerIndex] += TriangleTangentY[OtherFaceIndex];
+							}
+							if (RelevantFace.bBlendNormals)
+							{
+								CornerTangentZ[CornerIndex] += TriangleTangentZ[OtherFaceIndex];
+							}
+						}
+					}
+					if (!RawMesh.WedgeTangentX[WedgeOffset + CornerIndex].IsZero())
+					{
+						CornerTangentX[CornerIndex] = RawMesh.WedgeTangentX[WedgeOffset + CornerIndex];
+					}
+					if (!RawMesh.WedgeTangentY[WedgeOffset + CornerIndex].IsZero())
+					{
+						CornerTangentY[CornerIndex] = RawMesh.WedgeTangentY[WedgeOffset + CornerIndex];
+					}
+					if (!RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero())
+					{
+						CornerTangentZ[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
+					}
 				}
 			}
-		}
 
-		// Normalization.
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			CornerTangentX[CornerIndex].Normalize();
-			CornerTangentY[CornerIndex].Normalize();
-			CornerTangentZ[CornerIndex].Normalize();
-
-			// Gram-Schmidt orthogonalization
-			CornerTangentY[CornerIndex] -= CornerTangentX[CornerIndex] * (CornerTangentX[CornerIndex] | CornerTangentY[CornerIndex]);
-			CornerTangentY[CornerIndex].Normalize();
-
-			CornerTangentX[CornerIndex] -= CornerTangentZ[CornerIndex] * (CornerTangentZ[CornerIndex] | CornerTangentX[CornerIndex]);
-			CornerTangentX[CornerIndex].Normalize();
-			CornerTangentY[CornerIndex] -= CornerTangentZ[CornerIndex] * (CornerTangentZ[CornerIndex] | CornerTangentY[CornerIndex]);
-			CornerTangentY[CornerIndex].Normalize();
-		}
+			// Normalization.
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			{
+				CornerTangentX[CornerIndex].Normalize();
+				CornerTangentY[CornerIndex].Normalize();
+				CornerTangentZ[CornerIndex].Normalize();
+
+				// Gram-Schmidt orthogonalization
+				CornerTangentY[CornerIndex] -= CornerTangentX[CornerIndex] * (CornerTangentX[CornerIndex] | CornerTangentY[CornerIndex]);
+				CornerTangentY[CornerIndex].Normalize();
+
+				CornerTangentX[CornerIndex] -= CornerTangentZ[CornerIndex] * (CornerTangentZ[CornerIndex] | CornerTangentX[CornerIndex]);
+				CornerTangentX[CornerIndex].Normalize();
+				CornerTangentY[CornerIndex] -= CornerTangentZ[CornerIndex] * (CornerTangentZ[CornerIndex] | CornerTangentY[CornerIndex]);
+				CornerTangentY[CornerIndex].Normalize();
+			}
 
-		// Copy back to the mesh.
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			RawMesh.WedgeTangentX[WedgeOffset + CornerIndex] = CornerTangentX[CornerIndex];
-			RawMesh.WedgeTangentY[WedgeOffset + CornerIndex] = CornerTangentY[CornerIndex];
-			RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex] = CornerTangentZ[CornerIndex];
+			// Copy back to the mesh.
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			{
+				RawMesh.WedgeTangentX[WedgeOffset + CornerIndex] = CornerTangentX[CornerIndex];
+				RawMesh.WedgeTangentY[WedgeOffset + CornerIndex] = CornerTangentY[CornerIndex];
+				RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex] = CornerTangentZ[CornerIndex];
+			}
 		}
-	}
+	});
 
 	check(RawMesh.WedgeTangentX.Num() == NumWedges);
 	check(RawMesh.WedgeTangentY.Num() == NumWedges);
@@ -2103,11 +2149,6 @@ static void ComputeTangents_MikkTSpace(
 		bIgnoreDegenerateTriangles ? SMALL_NUMBER : 0.0f
 		);
 
-	// Declare these out here to avoid reallocations.
-	TArray<FFanFace> RelevantFacesForCorner[3];
-	TArray<int32> AdjacentFaces;
-	TArray<int32> DupVerts;
-
 	int32 NumWedges = RawMesh.WedgeIndices.Num();
 	int32 NumFaces = NumWedges / 3;
 
@@ -2136,207 +2177,216 @@ static void ComputeTangents_MikkTSpace(
 		RawMesh.WedgeTangentZ.AddZeroed(NumWedges);
 		// we need to calculate normals for MikkTSpace
 
-		for (int32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++)
+		// Faces only write the normals of their own corners, so they are processed in parallel.
+		ParallelForChunks(NumFaces, [&](int32 ChunkIndex, int32 FirstFaceIndex, int32 LastFaceIndex)
 		{
-			int32 WedgeOffset = FaceIndex * 3;
-			FVector CornerPositions[3];
-			FVector CornerNormal[3];
+			// Declare these out here to avoid reallocations.
+			TArray<FFanFace> RelevantFacesForCorner[3];
+			TArray<int32> AdjacentFaces;
+			TArray<int32> DupVerts;
 
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				CornerNormal[CornerIndex] = FVector::ZeroVector;
-				CornerPositions[CornerIndex] = GetPositionForWedge(RawMesh, WedgeOffset + CornerIndex);
-				RelevantFacesForCorner[CornerIndex].Reset();
-			}
-
-			// Don't process degenerate triangles.
-			if (PointsEqual(CornerPositions[0], CornerPositions[1], ComparisonThreshold)
-				|| PointsEqual(CornerPositions[0], CornerPositions[2], ComparisonThreshold)
-				|| PointsEqual(CornerPositions[1], CornerPositions[2], ComparisonThreshold))
-			{
-				continue;
-			}
-
-			// No need to process triangles if tangents already exist.
-			bool bCornerHasNormal[3] = { 0 };
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			for (int32 FaceIndex = FirstFaceIndex; FaceIndex < LastFaceIndex; FaceIndex++)
 			{
-				bCornerHasNormal[CornerIndex] = !RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero();
-			}
-			if (bCornerHasNormal[0] && bCornerHasNormal[1] && bCornerHasNormal[2])
-			{
-				continue;
-			}
+				int32 WedgeOffset = FaceIndex * 3;
+				FVector CornerPositions[3];
+				FVector CornerNormal[3];
 
-			// Start building a list of faces adjacent to this face.
-			AdjacentFaces.Reset();
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				int32 ThisCornerIndex = WedgeOffset + CornerIndex;
-				DupVerts.Reset();
-				OverlappingCorners.MultiFind(ThisCornerIndex,DupVerts);
-				DupVerts.Add(ThisCornerIndex); // I am a "dup" of myself
-				for (int32 k = 0; k < DupVerts.Num(); k++)
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 				{
-					AdjacentFaces.AddUnique(DupVerts[k] / 3);
+					CornerNormal[CornerIndex] = FVector::ZeroVector;
+					CornerPositions[CornerIndex] = GetPositionForWedge(RawMesh, WedgeOffset + CornerIndex);
+					RelevantFacesForCorner[CornerIndex].Reset();
 				}
-			}
-
-			// We need to sort these here because the criteria for point equality is
-			// exact, so we must ensure the exact same order for all dups.
-			AdjacentFaces.Sort();
 
-			// Process adjacent faces
-			for (int32 AdjacentFaceIndex = 0; AdjacentFaceIndex < AdjacentFaces.Num(); AdjacentFaceIndex++)
-			{
-				int32 OtherFaceIndex = AdjacentFaces[AdjacentFaceIndex];
-				for (int32 OurCornerIndex = 0; OurCornerIndex < 3; OurCornerIndex++)
+				// Don't process degenerate triangles.
+				if (PointsEqual(CornerPositions[0], CornerPositions[1], ComparisonThreshold)
+					|| PointsEqual(CornerPositions[0], CornerPositions[2], ComparisonThreshold)
+					|| PointsEqual(CornerPositions[1], CornerPositions[2], ComparisonThreshold))
 				{
-					if (bCornerHasNormal[OurCornerIndex])
-						continue;
+					continue;
+				}
 
-					FFanFace NewFanFace;
-					int32 CommonIndexCount = 0;
+				// No need to process triangles if tangents already exist.
+				bool bCornerHasNormal[3] = { 0 };
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+				{
+					bCornerHasNormal[CornerIndex] = !RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero();
+				}
+				if (bCornerHasNormal[0] && bCornerHasNormal[1] && bCornerHasNormal[2])
+				{
+					continue;
+				}
 
-					// Check for vertices in common.
-					if (FaceIndex == OtherFaceIndex)
+				// Start building a list of faces adjacent to this face.
+				AdjacentFaces.Reset();
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+				{
+					int32 ThisCornerIndex = WedgeOffset + CornerIndex;
+					DupVerts.Reset();
+					OverlappingCorners.MultiFind(ThisCornerIndex,DupVerts);
+					DupVerts.Add(ThisCornerIndex); // I am a "dup" of myself
+					for (int32 k = 0; k < DupVerts.Num(); k++)
 					{
-						CommonIndexCount = 3;
-						NewFanFace.LinkedVertexIndex = OurCornerIndex;
+						AdjacentFaces.AddUnique(DupVerts[k] / 3);
 					}
-					else
+				}
+
+				// We need to sort these here because the criteria for point equality is
+				// exact, so we must ensure the exact same order for all dups.
+				AdjacentFaces.Sort();
+
+				// Process adjacent faces
+				for (int32 AdjacentFaceIndex = 0; AdjacentFaceIndex < AdjacentFaces.Num(); AdjacentFaceIndex++)
+				{
+					int32 OtherFaceIndex = AdjacentFaces[AdjacentFaceIndex];
+					for (int32 OurCornerIndex = 0; OurCornerIndex < 3; OurCornerIndex++)
 					{
-						// Check matching vertices against main vertex .
-						for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
+						if (bCornerHasNormal[OurCornerIndex])
+							continue;
+
+						FFanFace NewFanFace;
+						int32 CommonIndexCount = 0;
+
+						// Check for vertices in common.
+						if (FaceIndex == OtherFaceIndex)
 						{
-							if (PointsEqual(
-								CornerPositions[OurCornerIndex],
-								GetPositionForWedge(RawMesh, OtherFaceIndex * 3 + OtherCornerIndex),
-								ComparisonThreshold
-								))
+							CommonIndexCount = 3;
+							NewFanFace.LinkedVertexIndex = OurCornerIndex;
+						}
+						else
+						{
+							// Check matching vertices against main vertex .
+							for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
 							{
-								CommonIndexCount++;
-								NewFanFace.LinkedVertexIndex = OtherCornerIndex;
+								if (PointsEqual(
+									CornerPositions[OurCornerIndex],
+									GetPositionForWedge(RawMesh, OtherFaceIndex * 3 + OtherCornerIndex),
+									ComparisonThreshold
+									))
+								{
+									CommonIndexCount++;
+									NewFanFace.LinkedVertexIndex = OtherCornerIndex;
+								}
 							}
 						}
-					}
 
-					// Add if connected by at least one point. Smoothing matches are considered later.
-					if (CommonIndexCount > 0)
-					{
-						NewFanFace.FaceIndex = OtherFaceIndex;
-						NewFanFace.bFilled = (OtherFaceIndex == FaceIndex); // Starter face for smoothing floodfill.
-						NewFanFace.bBlendTangents = NewFanFace.bFilled;
-						NewFanFace.bBlendNormals = NewFanFace.bFilled;
-						RelevantFacesForCorner[OurCornerIndex].Add(NewFanFace);
+						// Add if connected by at least one point. Smoothing matches are considered later.
+						if (CommonIndexCount > 0)
+						{
+							NewFanFace.FaceIndex = OtherFaceIndex;
+							NewFanFace.bFilled = (OtherFaceIndex == FaceIndex); // Starter face for smoothing floodfill.
+							NewFanFace.bBlendTangents = NewFanFace.bFilled;
+							NewFanFace.bBlendNormals = NewFanFace.bFilled;
+							RelevantFacesForCorner[OurCornerIndex].Add(NewFanFace);
+						}
 					}
 				}
-			}
-
-			// Find true relevance of faces for a vertex normal by traversing
-			// smoothing-group-compatible connected triangle fans around common vertices.
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				if (bCornerHasNormal[CornerIndex])
-					continue;
 
-				int32 NewConnections;
-				do
+				// Find true relevance of faces for a vertex normal by traversing
+				// smoothing-group-compatible connected triangle fans around common vertices.
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 				{
-					NewConnections = 0;
-					for (int32 OtherFaceIdx = 0; OtherFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); OtherFaceIdx++)
+					if (bCornerHasNormal[CornerIndex])
+						continue;
+
+					int32 NewConnections;
+					do
 					{
-						FFanFace& OtherFace = RelevantFacesForCorner[CornerIndex][OtherFaceIdx];
-						// The vertex' own face is initially the only face with bFilled == true.
-						if (OtherFace.bFilled)
+						NewConnections = 0;
+						for (int32 OtherFaceIdx = 0; OtherFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); OtherFaceIdx++)
 						{
-							for (int32 NextFaceIndex = 0; NextFaceIndex < RelevantFacesForCorner[CornerIndex].Num(); NextFaceIndex++)
+							FFanFace& OtherFace = RelevantFacesForCorner[CornerIndex][OtherFaceIdx];
+							// The vertex' own face is initially the only face with bFilled == true.
+							if (OtherFace.bFilled)
 							{
-								FFanFace& NextFace = RelevantFacesForCorner[CornerIndex][NextFaceIndex];
-								if (!NextFace.bFilled) // && !NextFace.bBlendTangents)
+								for (int32 NextFaceIndex = 0; NextFaceIndex < RelevantFacesForCorner[CornerIndex].Num(); NextFaceIndex++)
 								{
-									if ((NextFaceIndex != OtherFaceIdx)
-										&& (RawMesh.FaceSmoothingMasks[NextFace.FaceIndex] & RawMesh.FaceSmoothingMasks[OtherFace.FaceIndex]))
+									FFanFace& NextFace = RelevantFacesForCorner[CornerIndex][NextFaceIndex];
+									if (!NextFace.bFilled) // && !NextFace.bBlendTangents)
 									{
-										int32 CommonVertices = 0;
-										int32 CommonNormalVertices = 0;
-										for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
+										if ((NextFaceIndex != OtherFaceIdx)
+											&& (RawMesh.FaceSmoothingMasks[NextFace.FaceIndex] & RawMesh.FaceSmoothingMasks[OtherFace.FaceIndex]))
 										{
-											for (int32 NextCornerIndex = 0; NextCornerIndex < 3; NextCornerIndex++)
+											int32 CommonVertices = 0;
+											int32 CommonNormalVertices = 0;
+											for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
 											{
-												int32 NextVertexIndex = RawMesh.WedgeIndices[NextFace.FaceIndex * 3 + NextCornerIndex];
-												int32 OtherVertexIndex = RawMesh.WedgeIndices[OtherFace.FaceIndex * 3 + OtherCornerIndex];
-												if (PointsEqual(
-													RawMesh.VertexPositions[NextVertexIndex],
-													RawMesh.VertexPositions[OtherVertexIndex],
-													ComparisonThreshold))
+												for (int32 NextCornerIndex = 0; NextCornerIndex < 3; NextCornerIndex++)
 												{
-													CommonVertices++;
-													if (bBlendOverlappingNormals
-														|| NextVertexIndex == OtherVertexIndex)
+													int32 NextVertexIndex = RawMesh.WedgeIndices[NextFace.FaceIndex * 3 + NextCornerIndex];
+													int32 OtherVertexIndex = RawMesh.WedgeIndices[OtherFace.FaceIndex * 3 + OtherCornerIndex];
+													if (PointsEqual(
+														RawMesh.VertexPositions[NextVertexIndex],
+														RawMesh.VertexPositions[OtherVertexIndex],
+														ComparisonThreshold))
 													{
-														CommonNormalVertices++;
+														CommonVertices++;
+														if (bBlendOverlappingNormals
+															|| NextVertexIndex == OtherVertexIndex)
+														{
+															CommonNormalVertices++;
+														}
 													}
 												}
 											}
-										}
-										// Flood fill faces with more than one common vertices which must be touching edges.
-										if (CommonVertices > 1)
-										{
-											NextFace.bFilled = true;
-											NextFace.bBlendNormals = (CommonNormalVertices > 1);
-											NewConnections++;
+											// Flood fill faces with more than one common vertices which must be touching edges.
+											if (CommonVertices > 1)
+											{
+												NextFace.bFilled = true;
+												NextFace.bBlendNormals = (CommonNormalVertices > 1);
+												NewConnections++;
+											}
 										}
 									}
 								}
 							}
 						}
 					}
+					while (NewConnections > 0);
 				}
-				while (NewConnections > 0);
-			}
 
 
-			// Vertex normal construction.
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				if (bCornerHasNormal[CornerIndex])
-				{
-					CornerNormal[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
-				}
-				else
+				// Vertex normal construction.
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 				{
-					for (int32 RelevantFaceIdx = 0; RelevantFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); RelevantFaceIdx++)
+					if (bCornerHasNormal[CornerIndex])
 					{
-						FFanFace const& RelevantFace = RelevantFacesForCorner[CornerIndex][RelevantFaceIdx];
-						if (RelevantFace.bFilled)
+						CornerNormal[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
+					}
+					else
+					{
+						for (int32 RelevantFaceIdx = 0; RelevantFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); RelevantFaceIdx++)
 						{
-							int32 OtherFaceIndex = RelevantFace.FaceIndex;
-							if (RelevantFace.bBlendNormals)
+							FFanFace const& RelevantFace = RelevantFacesForCorner[CornerIndex][RelevantFaceIdx];
+							if (RelevantFace.bFilled)
 							{
-								CornerNormal[CornerIndex] += TriangleTangentZ[OtherFaceIndex];
+								int32 OtherFaceIndex = RelevantFace.FaceIndex;
+								if (RelevantFace.bBlendNormals)
+								{
+									CornerNormal[CornerIndex] += TriangleTangentZ[OtherFaceIndex];
+								}
 							}
 						}
-					}
-					if (!RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero())
-					{
-						CornerNormal[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
+						if (!RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero())
+						{
+							CornerNormal[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
+						}
 					}
 				}
-			}
 
-			// Normalization.
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				CornerNormal[CornerIndex].Normalize();
-			}
+				// Normalization.
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+				{
+					CornerNormal[CornerIndex].Normalize();
+				}
 
-			// Copy back to the mesh.
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex] = CornerNormal[CornerIndex];
+				// Copy back to the mesh.
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+				{
+					RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex] = CornerNormal[CornerIndex];
+				}
 			}
-		}
+		});
 	}
 
 	if (RawMesh.WedgeTangentX.Num() != NumWedges)
@@ -2679,18 +2729,24 @@ void FMeshUtilities::CacheOptimizeVertexAndIndexBuffer(
 	FMemory::Memset(IndexCache.GetData(), INDEX_NONE, IndexCache.Num() * IndexCache.GetTypeSize());
 	int32 NextAvailableIndex = 0;
 
+	// Optimize the index buffers for the post transform cache (minimizes the number of vertices transformed).
+	// Sections are independent so they are optimized in parallel.
+	ParallelFor(PerSectionIndices.Num(), [&](int32 SectionIndex)
+	{
+		if (PerSectionIndices[SectionIndex].Num())
+		{
+			CacheOptimizeIndexBuffer(PerSectionIndices[SectionIndex]);
+		}
+	});
+
 	// Iterate through the section index buffers, 
-	// Optimizing index order for the post transform cache (minimizes the number of vertices transformed), 
-	// And vertex order for the pre transform cache (minimizes the amount of vertex data fetched by the GPU).
+	// Optimizing vertex order for the pre transform cache (minimizes the amount of vertex data fetched by the GPU).
 	for (int32 SectionIndex = 0; SectionIndex < PerSectionIndices.Num(); SectionIndex++)
 	{
 		TArray<uint32>& Indices = PerSectionIndices[SectionIndex];
 
 		if (Indices.Num())
 		{
-			// Optimize the index buffer for the post transform cache with.
-			CacheOptimizeIndexBuffer(Indices);
-
 			// Copy the index buffer since we will be reordering it
 			TArray<uint32> OriginalIndices = Indices;
 
@@ -2902,9 +2958,9 @@ bool FMeshUtilities::BuildStaticMesh(
 		return false;
 	}
 
-	// Generate per-LOD rendering data.
+	// Generate per-LOD rendering data. LODs only read their own raw mesh and write their own resources, so they are built in parallel.
 	OutRenderData.AllocateLODResources(NumValidLODs);
-	for (int32 LODIndex = 0; LODIndex < NumValidLODs; ++LODIndex)
+	ParallelFor(NumValidLODs, [&](int32 LODIndex)
 	{
 		FStaticMeshLODResources& LODModel = OutRenderData.LODResources[LODIndex];
 		FRawMesh& RawMesh = LODMeshes[LODIndex];
@@ -3036,7 +3092,7 @@ bool FMeshUtilities::BuildStaticMesh(
 				);
 			LODModel.AdjacencyIndexBuffer.SetIndices(AdjacencyIndices, bNeeds32BitIndices ? EIndexBufferStride::Force32Bit : EIndexBufferStride::Force16Bit);
 		}
-	}
+	});
 
 	// Copy the original material indices to fixup meshes before compacting of materials was done.
 	if (NumValidLODs > 0)
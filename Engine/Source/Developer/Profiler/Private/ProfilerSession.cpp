@@ -614,21 +614,26 @@ void FRawProfilerSession::PrepareLoading()
 			for( int32 FrameIndex = 0; FrameIndex < Stream.FramesInfo.Num(); ++FrameIndex )
 			{
 				const FStatsFrameInfo& StatsFrameInfo = Stream.FramesInfo[FrameIndex];
-				FileReader->Seek( StatsFrameInfo.FrameFileOffset );
 
-				if( bHasCompressedData )
+				// Newer files have the frame numbers in the frame table, older ones need the frame to be read
+				int64 TargetFrame = StatsFrameInfo.TargetFrame;
+				if( TargetFrame == INDEX_NONE )
 				{
-					// Read the compressed data.
-					FCompressedStatsData UncompressedData( SrcArray, DestArray );
-					*FileReader << UncompressedData;
-				}
+					FileReader->Seek( StatsFrameInfo.FrameFileOffset );
 
-				// Select the proper archive.
-				FMemoryReader MemoryReader( DestArray, true );
-				FArchive& Archive = bHasCompressedData ? MemoryReader : *FileReader;
+					if( bHasCompressedData )
+					{
+						// Read the compressed data.
+						FCompressedStatsData UncompressedData( SrcArray, DestArray );
+						*FileReader << UncompressedData;
+					}
 
-				int64 TargetFrame;
-				Archive << TargetFrame;
+					// Select the proper archive.
+					FMemoryReader MemoryReader( DestArray, true );
+					FArchive& Archive = bHasCompressedData ? MemoryReader : *FileReader;
+
+					Archive << TargetFrame;
+				}
 
 				const double GameThreadTimeMS = GetMetaData()->ConvertCyclesToMS( (uint32)StatsFrameInfo.ThreadCycles.FindChecked( GameThreadID ) );
 
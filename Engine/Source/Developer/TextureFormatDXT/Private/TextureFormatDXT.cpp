@@ -272,19 +272,23 @@ namespace CompressionSettings
 
 /**
  * Compresses an image using NVTT.
+ * Large slices are split in batches of rows, and the batches of all slices are compressed in parallel.
+ * Each batch writes its own range of the output so the result doesn't depend on the scheduling.
  * @param SourceData			Source texture data to DXT compress, in BGRA 8bit per channel unsigned format.
  * @param PixelFormat			Texture format
  * @param SizeX					Number of texels along the X-axis
  * @param SizeY					Number of texels along the Y-axis
+ * @param NumSlices				Number of slices (e.g. cubemap faces) stored one after the other in SourceData
  * @param bSRGB					Whether the texture is in SRGB space
  * @param bIsNormalMap			Whether the texture is a normal map
- * @param OutCompressedData		Compressed image data output by nvtt.
+ * @param OutCompressedData		Compressed image data output by nvtt, for all slices.
  */
 static bool CompressImageUsingNVTT(
 	const void* SourceData,
 	EPixelFormat PixelFormat,
 	int32 SizeX,
 	int32 SizeY,
+	int32 NumSlices,
 	bool bSRGB,
 	bool bIsNormalMap,
 	TArray<uint8>& OutCompressedData
@@ -299,57 +303,44 @@ static bool CompressImageUsingNVTT(
 	const int32 ImageBlocksX = FMath::Max(SizeX / BlockSizeX, 1);
 	const int32 ImageBlocksY = FMath::Max(SizeY / BlockSizeY, 1);
 	const int32 BlocksPerBatch = FMath::Max<int32>(ImageBlocksX, FMath::RoundUpToPowerOfTwo(CompressionSettings::BlocksPerBatch));
-	const int32 RowsPerBatch = BlocksPerBatch / ImageBlocksX;
-	const int32 NumBatches = ImageBlocksY / RowsPerBatch;
-
-	// Allocate space to store compressed data.
-	OutCompressedData.Empty(ImageBlocksX * ImageBlocksY * BlockBytes);
-	OutCompressedData.AddUninitialized(ImageBlocksX * ImageBlocksY * BlockBytes);
+	int32 RowsPerBatch = BlocksPerBatch / ImageBlocksX;
+	int32 NumBatches = ImageBlocksY / RowsPerBatch;
+	int32 BatchSizeY = RowsPerBatch * BlockSizeY;
 
 	if (ImageBlocksX * ImageBlocksY <= BlocksPerBatch ||
 		BlocksPerBatch % ImageBlocksX != 0 ||
 		RowsPerBatch * NumBatches != ImageBlocksY)
 	{
-		FNVTTCompressor* Compressor = NULL;
-		{
-			FScopeLock ScopeLock(&GNVCompressionCriticalSection);
-			Compressor = new FNVTTCompressor(
-				SourceData,
-				PixelFormat,
-				SizeX,
-				SizeY,
-				bSRGB,
-				bIsNormalMap,
-				OutCompressedData.GetData(),
-				OutCompressedData.Num()
-				);
-		}
-		bool bSuccess = Compressor->Compress();
-		{
-			FScopeLock ScopeLock(&GNVCompressionCriticalSection);
-			delete Compressor;
-			Compressor = NULL;
-		}
-		return bSuccess;
+		// The slices can't be split, each of them is a single batch
+		RowsPerBatch = ImageBlocksY;
+		NumBatches = 1;
+		BatchSizeY = SizeY;
 	}
 
-	int32 UncompressedStride = RowsPerBatch * BlockSizeY * SizeX * sizeof(FColor);
-	int32 CompressedStride = RowsPerBatch * ImageBlocksX * BlockBytes;
+	// Allocate space to store compressed data.
+	const int32 CompressedSliceSize = ImageBlocksX * ImageBlocksY * BlockBytes;
+	OutCompressedData.Empty(CompressedSliceSize * NumSlices);
+	OutCompressedData.AddUninitialized(CompressedSliceSize * NumSlices);
+
+	// The batches cover whole slices, so walking them in order walks the slices too
+	const int32 UncompressedStride = BatchSizeY * SizeX * sizeof(FColor);
+	const int32 CompressedStride = RowsPerBatch * ImageBlocksX * BlockBytes;
+	const int32 TotalBatches = NumBatches * NumSlices;
 
 	// Create compressors for each batch.
 	TIndirectArray<FNVTTCompressor> Compressors;
-	Compressors.Empty(NumBatches);
+	Compressors.Empty(TotalBatches);
 	{
 		FScopeLock ScopeLock(&GNVCompressionCriticalSection);
 		const uint8* Src = (const uint8*)SourceData;
 		uint8* Dest = OutCompressedData.GetData();
-		for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
+		for (int32 BatchIndex = 0; BatchIndex < TotalBatches; ++BatchIndex)
 		{
 			new(Compressors) FNVTTCompressor(
 				Src,
 				PixelFormat,
 				SizeX,
-				RowsPerBatch * BlockSizeY,
+				BatchSizeY,
 				bSRGB,
 				bIsNormalMap,
 				Dest,
@@ -360,16 +351,18 @@ static bool CompressImageUsingNVTT(
 		}
 	}
 
-	// Asynchronously compress each batch.
+	// Asynchronously compress each batch, the last one is compressed on this thread instead of waiting.
 	bool bSuccess = true;
 	{
 		TIndirectArray<FAsyncNVTTTask> AsyncTasks;
-		for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
+		const int32 NumAsyncBatches = TotalBatches - 1;
+		for (int32 BatchIndex = 0; BatchIndex < NumAsyncBatches; ++BatchIndex)
 		{
 			FAsyncNVTTTask* AsyncTask = new(AsyncTasks) FAsyncNVTTTask(&Compressors[BatchIndex]);
 			AsyncTask->StartBackgroundTask();
 		}
-		for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
+		bSuccess = Compressors[NumAsyncBatches].Compress();
+		for (int32 BatchIndex = 0; BatchIndex < NumAsyncBatches; ++BatchIndex)
 		{
 			FAsyncNVTTTask& AsyncTask = AsyncTasks[BatchIndex];
 			AsyncTask.EnsureCompletion();
@@ -457,22 +450,17 @@ class FTextureFormatDXT : public ITextureFormat
 			CompressedPixelFormat = PF_BC4;
 		}
 
-		bool bCompressionSucceeded = true;
-		int32 SliceSize = Image.SizeX * Image.SizeY;
-		for (int32 SliceIndex = 0; SliceIndex < Image.NumSlices && bCompressionSucceeded; ++SliceIndex)
-		{
-			TArray<uint8> CompressedSliceData;
-			bCompressionSucceeded = CompressImageUsingNVTT(
-				Image.AsBGRA8() + SliceIndex * SliceSize,
-				CompressedPixelFormat,
-				Image.SizeX,
-				Image.SizeY,
-				Image.bSRGB,
-				bIsNormalMap,
-				CompressedSliceData
-				);
-			OutCompressedImage.RawData.Append(CompressedSliceData);
-		}
+		// All slices are compressed at once so the faces of a cubemap are spread across the workers too
+		const bool bCompressionSucceeded = CompressImageUsingNVTT(
+			Image.AsBGRA8(),
+			CompressedPixelFormat,
+			Image.SizeX,
+			Image.SizeY,
+			Image.NumSlices,
+			Image.bSRGB,
+			bIsNormalMap,
+			OutCompressedImage.RawData
+			);
 
 		if (bCompressionSucceeded)
 		{
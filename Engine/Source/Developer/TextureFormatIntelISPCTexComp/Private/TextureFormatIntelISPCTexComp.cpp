@@ -9,6 +9,7 @@
 #include "PixelFormat.h"
 #include "IConsoleManager.h"
 #include "TaskGraphInterfaces.h"
+#include "ParallelFor.h"
 
 #include "ispc_texcomp.h"
 
@@ -37,16 +38,18 @@ static FName GSupportedTextureFormatNames[] =
 /**
  * BC6H Compression function
  */
-static void IntelBC6HCompressScans(bc6h_enc_settings* pEncSettings, FImage* pInImage, FCompressedImage2D* pOutImage, int yStart, int yEnd)
+static void IntelBC6HCompressScans(bc6h_enc_settings* pEncSettings, FImage* pInImage, FCompressedImage2D* pOutImage, int iSlice, int yStart, int yEnd)
 {
 	check(pInImage->Format == ERawImageFormat::RGBA16F);
 	check((yStart % 4) == 0);
 	check((yStart >= 0) && (yStart <= pInImage->SizeY));
 	check((yEnd   >= 0) && (yEnd   <= pInImage->SizeY));
+	check((iSlice >= 0) && (iSlice < pInImage->NumSlices));
 
-	uint8* pInTexels = reinterpret_cast<uint8*>(&pInImage->RawData[0]);
 	const int iInStride = pInImage->SizeX * 8;
-	uint8* pOutTexels = reinterpret_cast<uint8*>(&pOutImage->RawData[0]);
+	const int iOutSliceSize = ((pInImage->SizeX + 3) / 4) * ((pInImage->SizeY + 3) / 4) * 16;
+	uint8* pInTexels = reinterpret_cast<uint8*>(&pInImage->RawData[0]) + iSlice * pInImage->SizeY * iInStride;
+	uint8* pOutTexels = reinterpret_cast<uint8*>(&pOutImage->RawData[0]) + iSlice * iOutSliceSize;
 
 	rgba_surface insurface;
 	insurface.ptr		= pInTexels + (yStart * iInStride);
@@ -61,16 +64,18 @@ static void IntelBC6HCompressScans(bc6h_enc_settings* pEncSettings, FImage* pInI
 /**
  * BC7 Compression function
  */
-static void IntelBC7CompressScans(bc7_enc_settings* pEncSettings, FImage* pInImage, FCompressedImage2D* pOutImage, int yStart, int yEnd)
+static void IntelBC7CompressScans(bc7_enc_settings* pEncSettings, FImage* pInImage, FCompressedImage2D* pOutImage, int iSlice, int yStart, int yEnd)
 {
 	check(pInImage->Format == ERawImageFormat::BGRA8);
 	check((yStart % 4) == 0);
 	check((yStart >= 0) && (yStart <= pInImage->SizeY));
 	check((yEnd   >= 0) && (yEnd   <= pInImage->SizeY));
+	check((iSlice >= 0) && (iSlice < pInImage->NumSlices));
 
-	uint8* pInTexels = reinterpret_cast<uint8*>(&pInImage->RawData[0]);
 	const int iInStride = pInImage->SizeX * 4;
-	uint8* pOutTexels = reinterpret_cast<uint8*>(&pOutImage->RawData[0]);
+	const int iOutSliceSize = ((pInImage->SizeX + 3) / 4) * ((pInImage->SizeY + 3) / 4) * 16;
+	uint8* pInTexels = reinterpret_cast<uint8*>(&pInImage->RawData[0]) + iSlice * pInImage->SizeY * iInStride;
+	uint8* pOutTexels = reinterpret_cast<uint8*>(&pOutImage->RawData[0]) + iSlice * iOutSliceSize;
 
 	// Switch byte order for compressors input
 	for ( int y=yStart; y < yEnd; ++y )
@@ -135,13 +140,15 @@ class FTextureFormatIntelISPCTexComp : public ITextureFormat
 
 		const int iWidthInBlocks	= ((InImage.SizeX + 3) & ~ 3) / 4;
 		const int iHeightInBlocks	= ((InImage.SizeY + 3) & ~ 3) / 4;
-		const int iOutputBytes		= iWidthInBlocks * iHeightInBlocks * 16;
+		const int iOutputBytes		= iWidthInBlocks * iHeightInBlocks * 16 * InImage.NumSlices;
 		OutCompressedImage.RawData.AddUninitialized(iOutputBytes);
 
-		// When we allow async tasks to execute we do so with 4 lines of the image per task
-		// This isn't optimal for long thin textures, but works well with how ISPC works
+		// The image is split in tasks of 4 lines, for every slice, which are spread across the task graph workers.
+		// This isn't optimal for long thin textures, but works well with how ISPC works.
+		// Each task writes its own blocks so the result doesn't depend on the scheduling.
 		const int iScansPerTask = 4;
-		const int iNumTasks = FMath::Max((InImage.SizeY / iScansPerTask) - 1, 0);
+		const int iTasksPerSlice = (InImage.SizeY + iScansPerTask - 1) / iScansPerTask;
+		const int iNumTasks = iTasksPerSlice * InImage.NumSlices;
 		const bool bUseTasks = true;
 
 		EPixelFormat CompressedPixelFormat = PF_Unknown;
@@ -153,59 +160,11 @@ class FTextureFormatIntelISPCTexComp : public ITextureFormat
 			bc6h_enc_settings settings;
 			GetProfile_bc6h_basic(&settings);
 
-			if ( bUseTasks )
+			ParallelFor(iNumTasks, [&](int32 iTask)
 			{
-				class FIntelCompressWorker : public FNonAbandonableTask
-				{
-				public:
-					FIntelCompressWorker(bc6h_enc_settings* pEncSettings, FImage* pInImage, FCompressedImage2D* pOutImage, int yStart, int yEnd)
-						: mpEncSettings(pEncSettings)
-						, mpInImage(pInImage)
-						, mpOutImage(pOutImage)
-						, mYStart(yStart)
-						, mYEnd(yEnd)
-					{
-					}
-
-					void DoWork()
-					{
-						IntelBC6HCompressScans(mpEncSettings, mpInImage, mpOutImage, mYStart, mYEnd);
-					}
-
-					static const TCHAR* Name()
-					{
-						return TEXT("FIntelCompressWorker");
-					}
-
-					bc6h_enc_settings*	mpEncSettings;
-					FImage*				mpInImage;
-					FCompressedImage2D*	mpOutImage;
-					int					mYStart;
-					int					mYEnd;
-				};
-				typedef FAsyncTask<FIntelCompressWorker> FIntelCompressTask;
-
-				// One less task because we'll do the final + non multiple of 4 inside this task
-				TIndirectArray<FIntelCompressTask> CompressionTasks;
-				CompressionTasks.Reserve(iNumTasks);
-				for ( int iTask=0; iTask < iNumTasks; ++iTask )
-				{
-					auto* AsyncTask = new(CompressionTasks) FIntelCompressTask(&settings, &Image, &OutCompressedImage, iTask * iScansPerTask, (iTask + 1) * iScansPerTask);
-					AsyncTask->StartBackgroundTask();
-				}
-
-				IntelBC6HCompressScans(&settings, &Image, &OutCompressedImage, iScansPerTask * iNumTasks, InImage.SizeY);
-
-				// Wait completion
-				for (int32 TaskIndex = 0; TaskIndex < CompressionTasks.Num(); ++TaskIndex)
-				{
-					CompressionTasks[TaskIndex].EnsureCompletion();
-				}
-			}
-			else
-			{
-				IntelBC6HCompressScans(&settings, &Image, &OutCompressedImage, 0, InImage.SizeY);
-			}
+				const int yStart = (iTask % iTasksPerSlice) * iScansPerTask;
+				IntelBC6HCompressScans(&settings, &Image, &OutCompressedImage, iTask / iTasksPerSlice, yStart, FMath::Min(yStart + iScansPerTask, Image.SizeY));
+			}, !bUseTasks);
 
 			CompressedPixelFormat = PF_BC6H;
 			bCompressionSucceeded = true;
@@ -225,59 +184,11 @@ class FTextureFormatIntelISPCTexComp : public ITextureFormat
 				GetProfile_basic(&settings);
 			}
 
-			if ( bUseTasks )
+			ParallelFor(iNumTasks, [&](int32 iTask)
 			{
-				class FIntelCompressWorker : public FNonAbandonableTask
-				{
-				public:
-					FIntelCompressWorker(bc7_enc_settings* pEncSettings, FImage* pInImage, FCompressedImage2D* pOutImage, int yStart, int yEnd)
-						: mpEncSettings(pEncSettings)
-						, mpInImage(pInImage)
-						, mpOutImage(pOutImage)
-						, mYStart(yStart)
-						, mYEnd(yEnd)
-					{
-					}
-
-					void DoWork()
-					{
-						IntelBC7CompressScans(mpEncSettings, mpInImage, mpOutImage, mYStart, mYEnd);
-					}
-
-					static const TCHAR* Name()
-					{
-						return TEXT("FIntelCompressWorker");
-					}
-
-					bc7_enc_settings*	mpEncSettings;
-					FImage*				mpInImage;
-					FCompressedImage2D*	mpOutImage;
-					int					mYStart;
-					int					mYEnd;
-				};
-				typedef FAsyncTask<FIntelCompressWorker> FIntelCompressTask;
-
-				// One less task because we'll do the final + non multiple of 4 inside this task
-				TIndirectArray<FIntelCompressTask> CompressionTasks;
-				CompressionTasks.Reserve(iNumTasks);
-				for ( int iTask=0; iTask < iNumTasks; ++iTask )
-				{
-					auto* AsyncTask = new(CompressionTasks) FIntelCompressTask(&settings, &Image, &OutCompressedImage, iTask * iScansPerTask, (iTask + 1) * iScansPerTask);
-					AsyncTask->StartBackgroundTask();
-				}
-
-				IntelBC7CompressScans(&settings, &Image, &OutCompressedImage, iScansPerTask * iNumTasks, InImage.SizeY);
-
-				// Wait completion
-				for (int32 TaskIndex = 0; TaskIndex < CompressionTasks.Num(); ++TaskIndex)
-				{
-					CompressionTasks[TaskIndex].EnsureCompletion();
-				}
-			}
-			else
-			{
-				IntelBC7CompressScans(&settings, &Image, &OutCompressedImage, 0, InImage.SizeY);
-			}
+				const int yStart = (iTask % iTasksPerSlice) * iScansPerTask;
+				IntelBC7CompressScans(&settings, &Image, &OutCompressedImage, iTask / iTasksPerSlice, yStart, FMath::Min(yStart + iScansPerTask, Image.SizeY));
+			}, !bUseTasks);
 
 			CompressedPixelFormat = PF_BC7;
 			bCompressionSucceeded = true;
@@ -503,6 +503,7 @@ void FLevelEditorActionCallbacks::ConfigureLightingBuildOptions( const FLighting
 	GConfig->SetBool( TEXT("LightingBuildOptions"), TEXT("OnlyBuildCurrentLevel"),	Options.bOnlyBuildCurrentLevel,		GEditorUserSettingsIni );
 	GConfig->SetBool( TEXT("LightingBuildOptions"), TEXT("OnlyBuildSelectedLevels"),Options.bOnlyBuildSelectedLevels,	GEditorUserSettingsIni );
 	GConfig->SetBool( TEXT("LightingBuildOptions"), TEXT("OnlyBuildVisibility"),	Options.bOnlyBuildVisibility,		GEditorUserSettingsIni );
+	GConfig->SetBool( TEXT("LightingBuildOptions"), TEXT("OnlyBuildChanged"),		Options.bOnlyBuildChanged,			GEditorUserSettingsIni );
 }
 
 
@@ -237,6 +237,8 @@ void FNiagaraCompiler_VectorVM::CompileScript(UNiagaraScript* InScript)
 	// Terminate with the 'done' opcode.
 	Script->ByteCode.Add((int8)VectorVM::EOp::done);
 
+	VectorVM::OptimizeByteCode(Script->ByteCode);
+
 	Script->ConstantData = ConstantData;
 	Script->Attributes = Attributes;
 	//To do - scalar and matrix attributes.
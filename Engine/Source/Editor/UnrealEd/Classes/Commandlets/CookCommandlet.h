@@ -34,6 +34,10 @@ class UCookCommandlet
 	bool bUnversioned;
 	/** Generate manifests for building streaming install packages */
 	bool bGenerateStreamingInstallManifests;
+	/** Launched by a multiprocess cook to cook a subset, the launching process does the rest */
+	bool bCookWorker;
+	/** When cook workers were launched, the packages they saved after that aren't saved again */
+	FDateTime CookWorkersStartTime;
 	/** All commandline tokens */
 	TArray<FString> Tokens;
 	/** All commandline switches */
@@ -137,6 +141,13 @@ private:
 	/** Cooks all files */
 	bool Cook(const TArray<ITargetPlatform*>& Platforms, TArray<FString>& FilesInPath);
 
+	/**
+	 * Launches a worker process per subset of the files, and waits for them to cook and save their packages
+	 *
+	 * @param NumProcesses	Number of worker processes
+	 */
+	void CookSubsetsInWorkers(int32 NumProcesses);
+
 	/** Cooks all files newly (in a new way) */
 	bool NewCook(const TArray<ITargetPlatform*>& Platforms, TArray<FString>& FilesInPath);
 
@@ -0,0 +1,24 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+#include "Commandlets/Commandlet.h"
+#include "GenerateBlueprintCodeCommandlet.generated.h"
+
+/**
+ * Converts the selected blueprints to C++ with the kismet C++ backend so they can be compiled into the game module,
+ * and writes the class redirects that make the cooked game load the native classes instead of the blueprint ones.
+ *
+ * The blueprints come from -Blueprints=/Game/A+/Game/B, or from NativizedBlueprints in [BlueprintNativeCodeGeneration]
+ * of the editor ini. -HeaderDir= and -SourceDir= override where the code is written, the game's Classes and Private
+ * source directories by default.
+ */
+UCLASS()
+class UGenerateBlueprintCodeCommandlet : public UCommandlet
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+	// Begin UCommandlet Interface
+	virtual int32 Main(FString const& Params) override;
+	// End UCommandlet Interface
+};
@@ -242,6 +242,19 @@ void FChunkManifestGenerator::AddPackageToChunkManifest(UPackage* Package, const
 
 	NotifyPackageWasCooked(SandboxFilename, PackageFName);
 
+	// Remember the packages it imports for the package dependency graph
+	if (ULinkerLoad* Linker = ULinkerLoad::FindExistingLinkerForPackage(Package))
+	{
+		TArray<FName>& Imports = PackageImports.FindOrAdd(PackageFName);
+		for (const FObjectImport& Import : Linker->ImportMap)
+		{
+			if (Import.ClassName == NAME_Package && Import.OuterIndex.IsNull() && Import.ObjectName != PackageFName)
+			{
+				Imports.AddUnique(Import.ObjectName);
+			}
+		}
+	}
+
 	bool bAssignedToChunk = false;
 	// if the delegate requested a specific chunk assignment, add them package to it now.
 	for (const auto& PackageChunk : TargetChunks)
@@ -358,6 +371,40 @@ bool FChunkManifestGenerator::SaveAssetRegistry(const FString& SandboxPath)
 	return true;
 }
 
+bool FChunkManifestGenerator::SavePackageDependencyGraph(const FString& SandboxPath)
+{
+	UE_LOG(LogChunkManifestGenerator, Display, TEXT("Saving package dependency graph."));
+
+	FPackageDependencyGraph DependencyGraph;
+	for (const auto& Package : PackageImports)
+	{
+		// Only keep cooked packages, script packages are compiled in and editor only imports don't make it to the cooked package
+		TArray<FName> CookedDependencies;
+		for (FName Import : Package.Value)
+		{
+			if (AllCookedPackages.Contains(Import))
+			{
+				CookedDependencies.Add(Import);
+			}
+		}
+		DependencyGraph.SetDependencies(Package.Key, CookedDependencies);
+	}
+
+	bool bSuccess = true;
+	for (auto Platform : Platforms)
+	{
+		FString PlatformSandboxPath = SandboxPath.Replace(TEXT("[Platform]"), *Platform->PlatformName());
+		if (!DependencyGraph.Save(*PlatformSandboxPath))
+		{
+			UE_LOG(LogChunkManifestGenerator, Error, TEXT("Unable to save package dependency graph to %s."), *PlatformSandboxPath);
+			bSuccess = false;
+		}
+	}
+
+	UE_LOG(LogChunkManifestGenerator, Display, TEXT("Done saving package dependency graph of %d packages."), DependencyGraph.Num());
+	return bSuccess;
+}
+
 typedef TSharedRef< TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR> > > JsonWriter;
 typedef TSharedRef< TJsonReader<TCHAR> > JsonReader;
 
@@ -33,6 +33,8 @@ class FChunkManifestGenerator
 	TArray<FChunkPackageSet*>		FinalChunkManifests;
 	/** Lookup table of used package names used when searching references. */
 	TSet<FName>						InspectedNames;
+	/** Packages imported by each cooked package, used to generate the package dependency graph */
+	TMap<FName, TArray<FName> >		PackageImports;
 
 	struct FReferencePair
 	{
@@ -260,6 +262,11 @@ public:
 	*/
 	bool SaveAssetRegistry(const FString& SandboxPath);
 
+	/**
+	* Saves the dependency graph of the cooked packages for each platform, used by the async loader to queue all the dependencies of a package at once.
+	*/
+	bool SavePackageDependencyGraph(const FString& SandboxPath);
+
 
 	/**
 	 * Saves cooked package and asset information about all the cooked packages and assets contained within for stats purposes
@@ -50,6 +50,13 @@ static FString GetPackageFilename( UPackage* Package )
 	return Filename;
 }
 
+/** Returns true if the package is part of the subset cooked by this process, see -SubsetMod and -SubsetTarget */
+static bool IsPackageInSubset( const FString& Filename, uint32 SubsetMod, uint32 SubsetTarget )
+{
+	const FString& PackageName = FPackageName::PackageFromPath(*Filename);
+	return FCrc::StrCrc_DEPRECATED(*PackageName.ToUpper()) % SubsetMod == SubsetTarget;
+}
+
 
 /* UCookCommandlet structors
  *****************************************************************************/
@@ -394,6 +401,12 @@ bool UCookCommandlet::SaveCookedPackage( UPackage* Package, uint32 SaveFlags, bo
 				bCookPackage = (CookedTimeStamp == FDateTime::MinValue()) || (CookedTimespanSeconds < 0);
 			}
 
+			// Already saved by a cook worker
+			if (bCookPackage && CookWorkersStartTime > FDateTime::MinValue())
+			{
+				bCookPackage = IFileManager::Get().GetTimeStamp(*PlatFilename) < CookWorkersStartTime;
+			}
+
 			// don't save Editor resources from the Engine if the target doesn't have editoronly data
 			if (bSkipEditorContent && Name.StartsWith(TEXT("/Engine/Editor")) && !Target->HasEditorOnlyData())
 			{
@@ -509,6 +522,8 @@ int32 UCookCommandlet::Main(const FString& CmdLineParams)
 	bCompressed = Switches.Contains(TEXT("COMPRESSED"));
 	bIterativeCooking = Switches.Contains(TEXT("ITERATE"));
 	bSkipEditorContent = Switches.Contains(TEXT("SKIPEDITORCONTENT")); // This won't save out any packages in Engine/COntent/Editor*
+	bCookWorker = Switches.Contains(TEXT("COOKWORKER")); // Launched by a multiprocess cook (-CookProcesses=N)
+	CookWorkersStartTime = FDateTime::MinValue();
 
 	if (bLeakTest)
 	{
@@ -559,7 +574,11 @@ int32 UCookCommandlet::Main(const FString& CmdLineParams)
 		// Use SandboxFile to do path conversion to properly handle sandbox paths (outside of standard paths in particular).
 		SandboxFile->Initialize(&FPlatformFileManager::Get().GetPlatformFile(), *FString::Printf(TEXT("-sandbox=\"%s\""), *OutputDirectory));
 
-		CleanSandbox(Platforms);
+		// The process that launched the worker already cleaned it, and other workers are writing to it
+		if (!bCookWorker)
+		{
+			CleanSandbox(Platforms);
+		}
 
 		// allow the game to fill out the asset registry, as well as get a list of objects to always cook
 		TArray<FString> FilesInPath;
@@ -1270,9 +1289,16 @@ bool UCookCommandlet::Cook(const TArray<ITargetPlatform*>& Platforms, TArray<FSt
 	FParse::Value(*Params, TEXT("SubsetTarget="), SubsetTarget);
 	bool bDoSubset = SubsetMod > 0 && SubsetTarget < SubsetMod;
 
+	// Multiprocess cook, each worker cooks a subset
+	int32 NumCookProcesses = 1;
+	FParse::Value(*Params, TEXT("CookProcesses="), NumCookProcesses);
+
 	FCoreUObjectDelegates::PackageCreatedForLoad.AddUObject(this, &UCookCommandlet::MaybeMarkPackageAsAlreadyLoaded);
 	
-	SaveGlobalShaderMapFiles(Platforms);
+	if (!bCookWorker)
+	{
+		SaveGlobalShaderMapFiles(Platforms);
+	}
 
 	CollectFilesToCook(FilesInPath);
 	if (FilesInPath.Num() == 0)
@@ -1282,6 +1308,13 @@ bool UCookCommandlet::Cook(const TArray<ITargetPlatform*>& Platforms, TArray<FSt
 
 	GenerateLongPackageNames(FilesInPath);
 
+	// The workers do the saving, which is most of the cook. This process then goes through every package to build the
+	// manifests and the asset registry, and only saves the ones no worker did (dependencies outside of the files to cook)
+	if (NumCookProcesses > 1 && !bDoSubset && !bCookWorker && FilesInPath.Num() > 0)
+	{
+		CookSubsetsInWorkers(NumCookProcesses);
+	}
+
 	TSet<UClass*> ClassesToForceFullGC;
 	for ( const FString& ClassName : FullGCAssetClassNames )
 	{
@@ -1339,6 +1372,12 @@ bool UCookCommandlet::Cook(const TArray<ITargetPlatform*>& Platforms, TArray<FSt
 				{
 					CookedPackages.Add(Filename);
 
+					// Dependencies from other subsets are saved by their own worker, never by two processes at once
+					if (bCookWorker && bDoSubset && !Filename.IsEmpty() && !IsPackageInSubset(Filename, SubsetMod, SubsetTarget))
+					{
+						continue;
+					}
+
 					bool bWasUpToDate = false;
 
 					SaveCookedPackage(Pkg, SAVE_KeepGUID | SAVE_Async | (bUnversioned ? SAVE_Unversioned : 0), bWasUpToDate);
@@ -1396,13 +1435,9 @@ bool UCookCommandlet::Cook(const TArray<ITargetPlatform*>& Platforms, TArray<FSt
 		UE_LOG(LogCookCommandlet, Display, TEXT("Processing package %s"), *Filename);
 		Filename = FPaths::ConvertRelativePathToFull(Filename);
 
-		if (bDoSubset)
+		if (bDoSubset && !IsPackageInSubset(Filename, SubsetMod, SubsetTarget))
 		{
-			const FString& PackageName = FPackageName::PackageFromPath(*Filename);
-			if (FCrc::StrCrc_DEPRECATED(*PackageName.ToUpper()) % SubsetMod != SubsetTarget)
-			{
-				continue;
-			}
+			continue;
 		}
 
 		if (CookedPackages.Contains(Filename))
@@ -1481,6 +1516,8 @@ bool UCookCommandlet::Cook(const TArray<ITargetPlatform*>& Platforms, TArray<FSt
 
 	GetDerivedDataCacheRef().WaitForQuiescence(true);
 
+	// The launching process saves them for every package
+	if (!bCookWorker)
 	{
 		// Always try to save the manifests, this is required to make the asset registry work, but doesn't necessarily write a file
 		ManifestGenerator.SaveManifests(SandboxFile.GetOwnedPointer());
@@ -1499,4 +1536,42 @@ bool UCookCommandlet::Cook(const TArray<ITargetPlatform*>& Platforms, TArray<FSt
 	return true;
 }
 
+void UCookCommandlet::CookSubsetsInWorkers(int32 NumProcesses)
+{
+	const FString WorkerPath = FString(FPlatformProcess::BaseDir()) / FPlatformProcess::ExecutableName(false);
+
+	CookWorkersStartTime = FDateTime::UtcNow();
+
+	TArray<FProcHandle> Workers;
+	for (int32 WorkerIndex = 0; WorkerIndex < NumProcesses; WorkerIndex++)
+	{
+		// Same command line, the workers skip the parts done once by this process
+		const FString WorkerParams = FString::Printf(TEXT("%s -SubsetMod=%d -SubsetTarget=%d -CookWorker"), FCommandLine::Get(), NumProcesses, WorkerIndex);
+
+		FProcHandle Worker = FPlatformProcess::CreateProc(*WorkerPath, *WorkerParams, false, true, true, NULL, -1, NULL, NULL);
+		if (!Worker.IsValid())
+		{
+			UE_LOG(LogCookCommandlet, Warning, TEXT("Couldn't launch cook worker %d, its packages will be cooked by this process."), WorkerIndex);
+			continue;
+		}
+		UE_LOG(LogCookCommandlet, Display, TEXT("Launched cook worker %d of %d."), WorkerIndex + 1, NumProcesses);
+		Workers.Add(Worker);
+	}
+
+	for (int32 WorkerIndex = 0; WorkerIndex < Workers.Num(); WorkerIndex++)
+	{
+		FPlatformProcess::WaitForProc(Workers[WorkerIndex]);
+
+		int32 ReturnCode = 0;
+		if (FPlatformProcess::GetProcReturnCode(Workers[WorkerIndex], &ReturnCode) && ReturnCode != 0)
+		{
+			// Whatever it didn't save is saved by this process
+			UE_LOG(LogCookCommandlet, Warning, TEXT("Cook worker exited with code %d."), ReturnCode);
+		}
+		FPlatformProcess::CloseProc(Workers[WorkerIndex]);
+	}
+
+	UE_LOG(LogCookCommandlet, Display, TEXT("Cook workers done, in %.1f seconds."), (FDateTime::UtcNow() - CookWorkersStartTime).GetTotalSeconds());
+}
+
 
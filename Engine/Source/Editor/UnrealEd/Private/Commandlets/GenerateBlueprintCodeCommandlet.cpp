@@ -0,0 +1,95 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "UnrealEd.h"
+#include "KismetEditorUtilities.h"
+#include "Engine/BlueprintGeneratedClass.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGenerateBlueprintCode, Log, All);
+
+/*******************************************************************************
+ * UGenerateBlueprintCodeCommandlet
+*******************************************************************************/
+
+//------------------------------------------------------------------------------
+UGenerateBlueprintCodeCommandlet::UGenerateBlueprintCodeCommandlet(FObjectInitializer const& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+//------------------------------------------------------------------------------
+int32 UGenerateBlueprintCodeCommandlet::Main(FString const& Params)
+{
+	TArray<FString> BlueprintPaths;
+	FString BlueprintsParam;
+	if (FParse::Value(*Params, TEXT("Blueprints="), BlueprintsParam, false))
+	{
+		BlueprintsParam.ParseIntoArray(&BlueprintPaths, TEXT("+"), true);
+	}
+	else
+	{
+		GConfig->GetArray(TEXT("BlueprintNativeCodeGeneration"), TEXT("NativizedBlueprints"), BlueprintPaths, GEditorIni);
+	}
+
+	if (BlueprintPaths.Num() == 0)
+	{
+		UE_LOG(LogGenerateBlueprintCode, Warning, TEXT("No blueprints to convert, pass -Blueprints= or set NativizedBlueprints in [BlueprintNativeCodeGeneration]."));
+		return 0;
+	}
+
+	const FString GameSourceDir = FPaths::Combine(*FPaths::ConvertRelativePathToFull(FPaths::GameSourceDir()), FApp::GetGameName());
+	FString HeaderDir = FPaths::Combine(*GameSourceDir, TEXT("Classes"));
+	FString SourceDir = FPaths::Combine(*GameSourceDir, TEXT("Private"));
+	FParse::Value(*Params, TEXT("HeaderDir="), HeaderDir);
+	FParse::Value(*Params, TEXT("SourceDir="), SourceDir);
+
+	FString Redirects = TEXT("[/Script/Engine.Engine]\r\n");
+	int32 NumErrors = 0;
+
+	for (FString BlueprintPath : BlueprintPaths)
+	{
+		// Accept package names as well as object paths
+		if (!BlueprintPath.Contains(TEXT(".")))
+		{
+			BlueprintPath += TEXT(".") + FPackageName::GetLongPackageAssetName(BlueprintPath);
+		}
+
+		UBlueprint* Blueprint = LoadObject<UBlueprint>(NULL, *BlueprintPath);
+		if (Blueprint == NULL || Blueprint->GeneratedClass == NULL)
+		{
+			UE_LOG(LogGenerateBlueprintCode, Error, TEXT("Couldn't load blueprint '%s'."), *BlueprintPath);
+			++NumErrors;
+			continue;
+		}
+
+		TSharedPtr<FString> HeaderSource(new FString());
+		TSharedPtr<FString> CppSource(new FString());
+		FKismetEditorUtilities::GenerateCppCode(Blueprint, HeaderSource, CppSource);
+
+		const FString ClassName = Blueprint->GeneratedClass->GetName();
+		const FString HeaderPath = FPaths::Combine(*HeaderDir, *(ClassName + TEXT(".h")));
+		const FString CppPath = FPaths::Combine(*SourceDir, *(ClassName + TEXT(".cpp")));
+		if (!FFileHelper::SaveStringToFile(*HeaderSource, *HeaderPath) || !FFileHelper::SaveStringToFile(*CppSource, *CppPath))
+		{
+			UE_LOG(LogGenerateBlueprintCode, Error, TEXT("Couldn't save the code generated for '%s' to '%s' and '%s'."), *BlueprintPath, *HeaderPath, *CppPath);
+			++NumErrors;
+			continue;
+		}
+		UE_LOG(LogGenerateBlueprintCode, Display, TEXT("Generated '%s' and '%s' from '%s'."), *HeaderPath, *CppPath, *BlueprintPath);
+
+		// The generated class keeps the name of the blueprint class, it only moves to the game's script package
+		Redirects += FString::Printf(TEXT("+ActiveClassRedirects=(OldClassName=\"%s\",NewClassName=\"/Script/%s.%s\")\r\n"), *ClassName, FApp::GetGameName(), *ClassName);
+	}
+
+	const FString RedirectsPath = FPaths::GameSavedDir() / TEXT("Commandlets") / TEXT("NativizedBlueprintRedirects.ini");
+	if (FFileHelper::SaveStringToFile(Redirects, *RedirectsPath))
+	{
+		UE_LOG(LogGenerateBlueprintCode, Display, TEXT("Once the game module is rebuilt, add the redirects in '%s' to the game's engine ini to load the native classes."), *RedirectsPath);
+	}
+	else
+	{
+		UE_LOG(LogGenerateBlueprintCode, Error, TEXT("Couldn't save the class redirects to '%s'."), *RedirectsPath);
+		++NumErrors;
+	}
+
+	return NumErrors;
+}
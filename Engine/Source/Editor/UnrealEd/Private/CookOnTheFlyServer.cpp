@@ -2594,11 +2594,15 @@ void UCookOnTheFlyServer::CookByTheBookFinished()
 		const FString CookedAssetRegistry = FPaths::GameDir() / TEXT("CookedAssetRegistry.json");
 		const FString SandboxCookedAssetRegistryFilename = ConvertToFullSandboxPath(*CookedAssetRegistry, true);
 
+		const FString DependencyGraphFilename = FPaths::GameDir() / FPackageDependencyGraph::GetFilename();
+		const FString SandboxDependencyGraphFilename = ConvertToFullSandboxPath(*DependencyGraphFilename, true);
+
 		for ( auto& Manifest : CookByTheBookOptions->ManifestGenerators )
 		{
 			// Always try to save the manifests, this is required to make the asset registry work, but doesn't necessarily write a file
 			Manifest.Value->SaveManifests(SandboxFile.GetOwnedPointer());
 			Manifest.Value->SaveAssetRegistry(SandboxRegistryFilename);
+			Manifest.Value->SavePackageDependencyGraph(SandboxDependencyGraphFilename);
 
 			Manifest.Value->SaveCookedPackageAssetRegistry(SandboxCookedAssetRegistryFilename, true);
 
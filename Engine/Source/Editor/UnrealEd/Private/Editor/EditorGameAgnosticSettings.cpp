@@ -50,6 +50,7 @@ void UEditorGameAgnosticSettings::LoadScalabilityBenchmark()
 		GConfig->GetInt(Section, TEXT("PostProcessQuality"),		Temporary.PostProcessQuality,	GEditorGameAgnosticIni);
 		GConfig->GetInt(Section, TEXT("TextureQuality"),			Temporary.TextureQuality,		GEditorGameAgnosticIni);
 		GConfig->GetInt(Section, TEXT("EffectsQuality"),			Temporary.EffectsQuality,		GEditorGameAgnosticIni);
+		GConfig->GetInt(Section, TEXT("AHRQuality"),				Temporary.AHRQuality,			GEditorGameAgnosticIni);
 		EngineBenchmarkResult = Temporary;
 	}
 }
@@ -72,6 +73,7 @@ void UEditorGameAgnosticSettings::AutoApplyScalabilityBenchmark()
 	GConfig->SetInt(Section, TEXT("PostProcessQuality"), Temporary.PostProcessQuality, GEditorGameAgnosticIni);
 	GConfig->SetInt(Section, TEXT("TextureQuality"), Temporary.TextureQuality, GEditorGameAgnosticIni);
 	GConfig->SetInt(Section, TEXT("EffectsQuality"), Temporary.EffectsQuality, GEditorGameAgnosticIni);
+	GConfig->SetInt(Section, TEXT("AHRQuality"), Temporary.AHRQuality, GEditorGameAgnosticIni);
 
 	Scalability::SetQualityLevels(Temporary);
 	Scalability::SaveState(GEditorGameAgnosticIni);
@@ -16,6 +16,7 @@ ECheckBoxState SScalabilitySettings::IsGroupQualityLevelSelected(const TCHAR* In
 	else if (FCString::Strcmp(InGroupName, TEXT("ShadowQuality")) == 0) QualityLevel = CachedQualityLevels.ShadowQuality;
 	else if (FCString::Strcmp(InGroupName, TEXT("TextureQuality")) == 0) QualityLevel = CachedQualityLevels.TextureQuality;
 	else if (FCString::Strcmp(InGroupName, TEXT("EffectsQuality")) == 0) QualityLevel = CachedQualityLevels.EffectsQuality;
+	else if (FCString::Strcmp(InGroupName, TEXT("AHRQuality")) == 0) QualityLevel = CachedQualityLevels.AHRQuality;
 
 	return (QualityLevel == InQualityLevel) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 }
@@ -29,6 +30,7 @@ void SScalabilitySettings::OnGroupQualityLevelChanged(ECheckBoxState NewState, c
 	else if (FCString::Strcmp(InGroupName, TEXT("ShadowQuality")) == 0) CachedQualityLevels.ShadowQuality = InQualityLevel;
 	else if (FCString::Strcmp(InGroupName, TEXT("TextureQuality")) == 0) CachedQualityLevels.TextureQuality = InQualityLevel;
 	else if (FCString::Strcmp(InGroupName, TEXT("EffectsQuality")) == 0) CachedQualityLevels.EffectsQuality = InQualityLevel;
+	else if (FCString::Strcmp(InGroupName, TEXT("AHRQuality")) == 0) CachedQualityLevels.AHRQuality = InQualityLevel;
 
 	Scalability::SetQualityLevels(CachedQualityLevels);
 	Scalability::SaveState(GEditorGameAgnosticIni);
@@ -217,6 +219,12 @@ void SScalabilitySettings::Construct( const FArguments& InArgs )
 				+MakeGridSlot(2,7) [ MakeButtonWidget(NamesMedium, TEXT("EffectsQuality"), 1, LOCTEXT("EffectsQualityMed", "Set effects quality to medium")) ]
 				+MakeGridSlot(3,7) [ MakeButtonWidget(NamesHigh, TEXT("EffectsQuality"), 2, LOCTEXT("EffectsQualityHigh", "Set effects quality to high")) ]
 				+MakeGridSlot(4,7) [ MakeButtonWidget(NamesEpic, TEXT("EffectsQuality"), 3, LOCTEXT("EffectsQualityEpic", "Set effects quality to epic")) ]
+
+				+MakeGridSlot(0,8) [ SNew(STextBlock).Text(LOCTEXT("AHRQualityLabel1", "Global Illumination")).Font(GroupFont) ]
+				+MakeGridSlot(1,8) [ MakeButtonWidget(NamesLow, TEXT("AHRQuality"), 0, LOCTEXT("AHRQualityLow", "Set global illumination quality to low")) ]
+				+MakeGridSlot(2,8) [ MakeButtonWidget(NamesMedium, TEXT("AHRQuality"), 1, LOCTEXT("AHRQualityMed", "Set global illumination quality to medium")) ]
+				+MakeGridSlot(3,8) [ MakeButtonWidget(NamesHigh, TEXT("AHRQuality"), 2, LOCTEXT("AHRQualityHigh", "Set global illumination quality to high")) ]
+				+MakeGridSlot(4,8) [ MakeButtonWidget(NamesEpic, TEXT("AHRQuality"), 3, LOCTEXT("AHRQualityEpic", "Set global illumination quality to epic")) ]
 			]
 
 			+ SVerticalBox::Slot()
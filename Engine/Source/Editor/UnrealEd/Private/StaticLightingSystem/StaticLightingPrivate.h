@@ -297,6 +297,19 @@ private:
 	 */
 	void ReportStatistics( );
 
+	/**
+	 * Finds the actors and the BSP affected by lights or geometry changed since the last build, for Options.bOnlyBuildChanged.
+	 * A primitive is changed if it has no cached static lighting, it is then rebuilt along with everything in IncrementalBuildInfluenceRadius around it.
+	 * Everything a changed light affects is rebuilt.
+	 */
+	void GatherChangedStaticLighting();
+
+	/** @return true if the lighting of the actor should be built, given the current set of lighting build options. */
+	bool ShouldBuildActorLighting(AActor* Actor) const;
+
+	/** @return true if the lighting of the BSP of the level should be built, given the current set of lighting build options. */
+	bool ShouldBuildBSPLighting(ULevel* Level) const;
+
 	/** Collects all static lighting info for processing */
 	void GatherStaticLightingInfo(bool bRebuildDirtyGeometryForLighting, bool bForceNoPrecomputedLighting);
 	
@@ -342,6 +355,11 @@ private:
 	/** The options the system is building lighting with. */
 	const FLightingBuildOptions Options;
 
+	/** True once GatherChangedStaticLighting found what to rebuild, only the actors and the levels whose BSP are affected by the changes are then built. */
+	bool bOnlyBuildChanged;
+	TSet<TWeakObjectPtr<AActor> > ActorsToRebuild;
+	TSet<TWeakObjectPtr<ULevel> > LevelsToRebuildBSP;
+
 	/** true if the static lighting build has been canceled.  Written by the main thread, read by all static lighting threads. */
 	bool bBuildCanceled;
 
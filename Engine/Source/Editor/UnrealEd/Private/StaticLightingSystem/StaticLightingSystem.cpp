@@ -299,6 +299,7 @@ bool FStaticLightingManager::IsLightingBuildCurrentlyExporting() const
 
 FStaticLightingSystem::FStaticLightingSystem(const FLightingBuildOptions& InOptions, UWorld* InWorld )
 	: Options(InOptions)
+	, bOnlyBuildChanged(false)
 	, bBuildCanceled(false)
 	, DeterministicIndex(0)
 	, NextVisibilityId(0)
@@ -502,6 +503,11 @@ bool FStaticLightingSystem::BeginLightmassProcess()
 			GCurrentSelectedLightmapSample.Lightmap = NULL;
 			GDebugStaticLightingInfo = FDebugLightingOutput();
 #endif
+
+			if (Options.bOnlyBuildChanged && !Options.bOnlyBuildVisibility && !bForceNoPrecomputedLighting)
+			{
+				GatherChangedStaticLighting();
+			}
 			
 			GatherStaticLightingInfo(bRebuildDirtyGeometryForLighting, bForceNoPrecomputedLighting);
 		}
@@ -644,7 +650,7 @@ void FStaticLightingSystem::InvalidateStaticLighting()
 		TArray<UModelComponent*> SelectedModelComponents;
 		if (bBuildBSPLighting && !Options.bOnlyBuildVisibility)
 		{
-			if (!Options.bOnlyBuildSelected)
+			if (!Options.bOnlyBuildSelected && ShouldBuildBSPLighting(Level))
 			{
 				// Invalidate it all
 				for (int32 i = 0; i < Level->ModelComponents.Num(); i++)
@@ -662,7 +668,7 @@ void FStaticLightingSystem::InvalidateStaticLighting()
 			{
 				const bool bBuildActorLighting =
 					bBuildLightingForLevel &&
-					(!Options.bOnlyBuildSelected || Actor->IsSelected());
+					ShouldBuildActorLighting(Actor);
 
 				if (bBuildActorLighting)
 				{
@@ -724,7 +730,7 @@ void FStaticLightingSystem::PostInvalidateStaticLighting()
 			{
 				const bool bBuildActorLighting =
 					bBuildLightingForLevel &&
-					(!Options.bOnlyBuildSelected || Actor->IsSelected());
+					ShouldBuildActorLighting(Actor);
 
 				if (bBuildActorLighting)
 				{
@@ -913,8 +919,10 @@ void FStaticLightingSystem::GatherStaticLightingInfo(bool bRebuildDirtyGeometryF
 		{
 			if (!Options.bOnlyBuildSelected || Options.bOnlyBuildVisibility)
 			{
-				// generate BSP mappings across the whole level
-				AddBSPStaticLightingInfo(Level, bBuildBSPLighting);
+				// generate BSP mappings across the whole level, unchanged BSP only casts shadows
+				const bool bBuildChangedBSPLighting = ShouldBuildBSPLighting(Level);
+				bObjectsToBuildLightingForFound |= bBuildChangedBSPLighting;
+				AddBSPStaticLightingInfo(Level, bBuildChangedBSPLighting);
 			}
 			else
 			{
@@ -934,7 +942,7 @@ void FStaticLightingSystem::GatherStaticLightingInfo(bool bRebuildDirtyGeometryF
 			{
 				const bool bBuildActorLighting =
 					bBuildLightingForLevel &&
-					(!Options.bOnlyBuildSelected || Actor->IsSelected());
+					ShouldBuildActorLighting(Actor);
 
 				TInlineComponentArray<UPrimitiveComponent*> Components;
 				Actor->GetComponents(Components);
@@ -1014,6 +1022,174 @@ void FStaticLightingSystem::GatherStaticLightingInfo(bool bRebuildDirtyGeometryF
 			FMessageLog("LightingResults").Error(LOCTEXT("LightmassError_BuildSelectedNothingSelected", "Building selected actors and BSP only, but no actors or BSP selected!"));
 		}
 	}
+	else if (bOnlyBuildChanged)
+	{
+		FMessageLog("LightingResults").Warning(LOCTEXT("LightmassError_BuildChanged", "Building changed actors only, lightmap memory and quality will be sub-optimal until the next full rebuild."));
+
+		if (!bObjectsToBuildLightingForFound)
+		{
+			FMessageLog("LightingResults").Info(LOCTEXT("LightmassError_BuildChangedNothingChanged", "Building changed actors and BSP only, but no lights or geometry changed since the last build."));
+		}
+	}
+}
+
+void FStaticLightingSystem::GatherChangedStaticLighting()
+{
+	ActorsToRebuild.Empty();
+	LevelsToRebuildBSP.Empty();
+
+	// How far around changed geometry the lighting is rebuilt, to pick up the shadows and bounces it casts
+	float InfluenceRadius = 1000.0f;
+	GConfig->GetFloat(TEXT("DevOptions.StaticLighting"), TEXT("IncrementalBuildInfluenceRadius"), InfluenceRadius, GLightmassIni);
+
+	TArray<ULightComponent*> ChangedLights;
+	bool bSkyLightChanged = false;
+	for (int32 LightIndex = 0; LightIndex < Lights.Num(); LightIndex++)
+	{
+		ULightComponentBase* LightBase = Lights[LightIndex];
+		if (!LightBase->bPrecomputedLightingIsValid)
+		{
+			ULightComponent* Light = Cast<ULightComponent>(LightBase);
+			if (Light)
+			{
+				ChangedLights.Add(Light);
+			}
+			else
+			{
+				// Sky lights have no influence bounds, they affect everything
+				bSkyLightChanged = true;
+			}
+		}
+	}
+
+	// Only static meshes and BSP keep track of whether their cached lighting is still valid,
+	// other primitives are rebuilt when they are affected by a changed light or close to changed geometry.
+	auto IsPrimitiveChanged = [bSkyLightChanged](UPrimitiveComponent* Primitive)
+	{
+		return bSkyLightChanged
+			|| ((Primitive->IsA(UStaticMeshComponent::StaticClass()) || Primitive->IsA(UModelComponent::StaticClass())) && !Primitive->bHasCachedStaticLighting);
+	};
+
+	// Pass 1: geometry which changed itself
+	TArray<FBox> ChangedBounds;
+	for (int32 LevelIndex = 0; LevelIndex < World->GetNumLevels(); LevelIndex++)
+	{
+		ULevel* Level = World->GetLevel(LevelIndex);
+		if (!Options.ShouldBuildLightingForLevel(Level))
+		{
+			continue;
+		}
+
+		for (int32 ComponentIndex = 0; ComponentIndex < Level->ModelComponents.Num(); ComponentIndex++)
+		{
+			UModelComponent* ModelComponent = Level->ModelComponents[ComponentIndex];
+			if (ModelComponent && ModelComponent->IsRegistered() && IsPrimitiveChanged(ModelComponent))
+			{
+				LevelsToRebuildBSP.Add(Level);
+				ChangedBounds.Add(ModelComponent->Bounds.GetBox().ExpandBy(InfluenceRadius));
+			}
+		}
+
+		for (int32 ActorIndex = 0; ActorIndex < Level->Actors.Num(); ActorIndex++)
+		{
+			AActor* Actor = Level->Actors[ActorIndex];
+			if (Actor)
+			{
+				TInlineComponentArray<UPrimitiveComponent*> Components;
+				Actor->GetComponents(Components);
+
+				for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+				{
+					UPrimitiveComponent* Primitive = Components[ComponentIndex];
+					if (Primitive->IsRegistered() && Primitive->HasStaticLighting() && IsPrimitiveChanged(Primitive))
+					{
+						ActorsToRebuild.Add(Actor);
+						ChangedBounds.Add(Primitive->Bounds.GetBox().ExpandBy(InfluenceRadius));
+					}
+				}
+			}
+		}
+	}
+
+	// Pass 2: geometry affected by changed lights, or close to changed geometry
+	auto IsPrimitiveAffected = [&ChangedLights, &ChangedBounds](UPrimitiveComponent* Primitive)
+	{
+		for (int32 LightIndex = 0; LightIndex < ChangedLights.Num(); LightIndex++)
+		{
+			if (ChangedLights[LightIndex]->AffectsPrimitive(Primitive))
+			{
+				return true;
+			}
+		}
+
+		const FBox PrimitiveBox = Primitive->Bounds.GetBox();
+		for (int32 BoundsIndex = 0; BoundsIndex < ChangedBounds.Num(); BoundsIndex++)
+		{
+			if (ChangedBounds[BoundsIndex].Intersect(PrimitiveBox))
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	for (int32 LevelIndex = 0; LevelIndex < World->GetNumLevels(); LevelIndex++)
+	{
+		ULevel* Level = World->GetLevel(LevelIndex);
+		if (!Options.ShouldBuildLightingForLevel(Level))
+		{
+			continue;
+		}
+
+		if (!LevelsToRebuildBSP.Contains(Level))
+		{
+			for (int32 ComponentIndex = 0; ComponentIndex < Level->ModelComponents.Num(); ComponentIndex++)
+			{
+				UModelComponent* ModelComponent = Level->ModelComponents[ComponentIndex];
+				if (ModelComponent && ModelComponent->IsRegistered() && IsPrimitiveAffected(ModelComponent))
+				{
+					LevelsToRebuildBSP.Add(Level);
+					break;
+				}
+			}
+		}
+
+		for (int32 ActorIndex = 0; ActorIndex < Level->Actors.Num(); ActorIndex++)
+		{
+			AActor* Actor = Level->Actors[ActorIndex];
+			if (Actor && !ActorsToRebuild.Contains(Actor))
+			{
+				TInlineComponentArray<UPrimitiveComponent*> Components;
+				Actor->GetComponents(Components);
+
+				for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+				{
+					UPrimitiveComponent* Primitive = Components[ComponentIndex];
+					if (Primitive->IsRegistered() && Primitive->HasStaticLighting() && IsPrimitiveAffected(Primitive))
+					{
+						ActorsToRebuild.Add(Actor);
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	bOnlyBuildChanged = true;
+
+	UE_LOG(LogStaticLightingSystem, Log, TEXT("Building changed lighting only: %d changed lights, %d changed primitives, %d actors and %d levels of BSP to rebuild."),
+		ChangedLights.Num(), ChangedBounds.Num(), ActorsToRebuild.Num(), LevelsToRebuildBSP.Num());
+}
+
+bool FStaticLightingSystem::ShouldBuildActorLighting(AActor* Actor) const
+{
+	return (!Options.bOnlyBuildSelected || Actor->IsSelected())
+		&& (!bOnlyBuildChanged || ActorsToRebuild.Contains(Actor));
+}
+
+bool FStaticLightingSystem::ShouldBuildBSPLighting(ULevel* Level) const
+{
+	return !bOnlyBuildChanged || LevelsToRebuildBSP.Contains(Level);
 }
 
 void FStaticLightingSystem::EncodeTextures(bool bLightingSuccessful)
@@ -10,10 +10,12 @@
 #include "ExceptionHandling.h"
 #include "IShaderFormat.h"
 #include "IShaderFormatModule.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
 
 #define DEBUG_USING_CONSOLE	0
 
-const int32 ShaderCompileWorkerInputVersion = 2;
+const int32 ShaderCompileWorkerInputVersion = 3;
 const int32 ShaderCompileWorkerOutputVersion = 1;
 
 double LastCompileTime = 0.0;
@@ -107,6 +109,8 @@ public:
 		ThroughFile,
 		ThroughNamedPipeOnce,
 		ThroughNamedPipe,
+		// Agent for editors on other machines, InputFilename is the port to listen on
+		ThroughSocket,
 	};
 	FWorkLoop(const TCHAR* ParentProcessIdText,const TCHAR* InWorkingDirectory,const TCHAR* InInputFilename,const TCHAR* InOutputFilename, ECommunicationMode InCommunicationMode)
 	:	ParentProcessId(FCString::Atoi(ParentProcessIdText))
@@ -116,6 +120,10 @@ public:
 	,	CommunicationMode(InCommunicationMode)
 	,	InputFilePath(InCommunicationMode == ThroughFile ? (FString(InWorkingDirectory) + InInputFilename) : InInputFilename)
 	,	OutputFilePath(InCommunicationMode == ThroughFile ? (FString(InWorkingDirectory) + InOutputFilename) : InOutputFilename)
+	,	LastShaderFileCacheGeneration(0)
+	,	bHasShaderFileCacheGeneration(false)
+	,	ListenSocket(nullptr)
+	,	ConnectionSocket(nullptr)
 	{
 #if PLATFORM_SUPPORTS_NAMED_PIPES
 		LastConnectionTime = FPlatformTime::Seconds();
@@ -156,8 +164,11 @@ public:
 			delete OutputFilePtr;
 
 #if PLATFORM_MAC || PLATFORM_LINUX
-			// Change the output file name to requested one
-			IFileManager::Get().Move(*OutputFilePath, *TempFilePath);
+			if (CommunicationMode == ThroughFile)
+			{
+				// Change the output file name to requested one
+				IFileManager::Get().Move(*OutputFilePath, *TempFilePath);
+			}
 #endif
 
 #if PLATFORM_SUPPORTS_NAMED_PIPES
@@ -178,8 +189,22 @@ public:
 				LastConnectionTime = FPlatformTime::Seconds();
 			}
 #endif	// PLATFORM_SUPPORTS_NAMED_PIPES
+
+			if (CommunicationMode == ThroughSocket)
+			{
+				int32 TransferSize = TransferBufferOut.Num();
+				if (!SendBytes((const uint8*)&TransferSize, sizeof(TransferSize)) || !SendBytes(TransferBufferOut.GetData(), TransferSize))
+				{
+					UE_LOG(LogShaders, Warning, TEXT("Connection lost before the results were sent"));
+				}
+
+				// The editor connects again for its next batch
+				CloseSocket(ConnectionSocket);
+			}
 		}
 
+		CloseSocket(ListenSocket);
+
 		UE_LOG(LogShaders, Log, TEXT("Exiting job loop"));
 	}
 
@@ -198,17 +223,26 @@ private:
 
 	const FString InputFilePath;
 	const FString OutputFilePath;
+
+	/** Shader file cache generation of the editor the cached shader files were loaded for */
+	uint32 LastShaderFileCacheGeneration;
+	bool bHasShaderFileCacheGeneration;
 #if PLATFORM_MAC || PLATFORM_LINUX
 	FString TempFilePath;
 #endif
 
-#if PLATFORM_SUPPORTS_NAMED_PIPES
-	FPlatformNamedPipe Pipe;
 	TArray<uint8> TransferBufferIn;
 	TArray<uint8> TransferBufferOut;
+
+#if PLATFORM_SUPPORTS_NAMED_PIPES
+	FPlatformNamedPipe Pipe;
 	double LastConnectionTime;
 #endif	// PLATFORM_SUPPORTS_NAMED_PIPES
 
+	/** Used when running as an agent for other machines */
+	FSocket* ListenSocket;
+	FSocket* ConnectionSocket;
+
 	bool IsUsingNamedPipes() const
 	{
 		return (CommunicationMode == ThroughNamedPipeOnce || CommunicationMode == ThroughNamedPipe);
@@ -226,6 +260,10 @@ private:
 			{
 				InputFile = IFileManager::Get().CreateFileReader(*InputFilePath,FILEREAD_Silent);
 			}
+			else if (CommunicationMode == ThroughSocket)
+			{
+				InputFile = ReceiveFromSocket();
+			}
 			else
 			{
 #if PLATFORM_SUPPORTS_NAMED_PIPES
@@ -266,6 +304,95 @@ private:
 		return InputFile;
 	}
 
+	/** Accepts a pending connection from an editor and reads the batch it sends. Returns nullptr if there is none. */
+	FArchive* ReceiveFromSocket()
+	{
+		ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		if (!ListenSocket)
+		{
+			const int32 Port = FCString::Atoi(*InputFilename);
+			ListenSocket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("ShaderCompileWorker listen"), false);
+			if (!ListenSocket || !ListenSocket->SetReuseAddr() || !ListenSocket->Bind(*SocketSubsystem->CreateInternetAddr(0, Port)) || !ListenSocket->Listen(8))
+			{
+				UE_LOG(LogShaders, Fatal, TEXT("Couldn't listen for jobs on port %d"), Port);
+			}
+			UE_LOG(LogShaders, Display, TEXT("Listening for jobs on port %d"), Port);
+		}
+
+		bool bHasPendingConnection = false;
+		if (!ListenSocket->HasPendingConnection(bHasPendingConnection) || !bHasPendingConnection)
+		{
+			return nullptr;
+		}
+
+		ConnectionSocket = ListenSocket->Accept(TEXT("ShaderCompileWorker connection"));
+		if (!ConnectionSocket)
+		{
+			return nullptr;
+		}
+
+		// The whole batch is read and the whole results are written before serving the next connection
+		ConnectionSocket->SetNonBlocking(false);
+
+		int32 TransferSize = 0;
+		if (!ReceiveBytes((uint8*)&TransferSize, sizeof(TransferSize)) || TransferSize < 0)
+		{
+			CloseSocket(ConnectionSocket);
+			return nullptr;
+		}
+
+		TransferBufferIn.Empty(TransferSize);
+		TransferBufferIn.AddUninitialized(TransferSize);
+		if (!ReceiveBytes(TransferBufferIn.GetData(), TransferSize))
+		{
+			UE_LOG(LogShaders, Warning, TEXT("Connection lost while receiving jobs"));
+			CloseSocket(ConnectionSocket);
+			return nullptr;
+		}
+
+		return new FMemoryReader(TransferBufferIn);
+	}
+
+	bool ReceiveBytes(uint8* Data, int32 Size)
+	{
+		while (Size > 0)
+		{
+			int32 BytesRead = 0;
+			if (!ConnectionSocket->Recv(Data, Size, BytesRead) || BytesRead == 0)
+			{
+				return false;
+			}
+			Data += BytesRead;
+			Size -= BytesRead;
+		}
+		return true;
+	}
+
+	bool SendBytes(const uint8* Data, int32 Size)
+	{
+		while (Size > 0)
+		{
+			int32 BytesSent = 0;
+			if (!ConnectionSocket->Send(Data, Size, BytesSent) || BytesSent == 0)
+			{
+				return false;
+			}
+			Data += BytesSent;
+			Size -= BytesSent;
+		}
+		return true;
+	}
+
+	void CloseSocket(FSocket*& Socket)
+	{
+		if (Socket)
+		{
+			Socket->Close();
+			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+			Socket = nullptr;
+		}
+	}
+
 	void ProcessInputFromArchive(FArchive* InputFilePtr, TArray<FJobResult>& OutJobResults)
 	{
 		int32 NumBatches = 0;
@@ -275,11 +402,20 @@ private:
 		InputFile << InputVersion;
 		check(ShaderCompileWorkerInputVersion == InputVersion);
 
+		uint32 ShaderFileCacheGeneration = 0;
+		InputFile << ShaderFileCacheGeneration;
+
 		InputFile << NumBatches;
 
-		// Flush cache, to make sure we load the latest version of the input file.
+		// Flush cache when the editor flushed its own, to make sure we load the latest version of the shader files.
 		// (Otherwise quick changes to a shader file can result in the wrong output.)
-		FlushShaderFileCache();
+		// Between flushes the parsed shader files are kept, the worker stays alive across many batches.
+		if (!bHasShaderFileCacheGeneration || ShaderFileCacheGeneration != LastShaderFileCacheGeneration)
+		{
+			FlushShaderFileCache();
+			LastShaderFileCacheGeneration = ShaderFileCacheGeneration;
+			bHasShaderFileCacheGeneration = true;
+		}
 
 		for (int32 BatchIndex = 0; BatchIndex < NumBatches; BatchIndex++)
 		{
@@ -353,13 +489,11 @@ private:
 		}
 		else
 		{
-#if PLATFORM_SUPPORTS_NAMED_PIPES
-			check(IsUsingNamedPipes());
+			check(IsUsingNamedPipes() || CommunicationMode == ThroughSocket);
 
 			// Output Transfer Buffer...
 			TransferBufferOut.Empty(0);
 			OutputFilePtr = new FMemoryWriter(TransferBufferOut);
-#endif
 		}
 
 		return OutputFilePtr;
@@ -392,6 +526,12 @@ private:
 	/** Called in the idle loop, checks for conditions under which the helper should exit */
 	void CheckExitConditions()
 	{
+		if (CommunicationMode == ThroughSocket)
+		{
+			// Agents serve whichever editor connects, they run until they are closed
+			return;
+		}
+
 #if PLATFORM_SUPPORTS_NAMED_PIPES
 		if (CommunicationMode == ThroughNamedPipeOnce)
 		{
@@ -517,18 +657,19 @@ int32 GuardedMain(int32 argc, TCHAR* argv[])
 	LastCompileTime = FPlatformTime::Seconds();
 
 	FString InCommunicating = argv[6];
+	const bool bThroughSocket = (InCommunicating == FString(TEXT("-communicatethroughsocket")));
 #if PLATFORM_SUPPORTS_NAMED_PIPES
 	const bool bThroughFile = (InCommunicating == FString(TEXT("-communicatethroughfile")));
 	const bool bThroughNamedPipe = (InCommunicating == FString(TEXT("-communicatethroughnamedpipe")));
 	const bool bThroughNamedPipeOnce = (InCommunicating == FString(TEXT("-communicatethroughnamedpipeonce")));
 #else
-	const bool bThroughFile = true;
+	const bool bThroughFile = !bThroughSocket;
 	const bool bThroughNamedPipe = false;
 	const bool bThroughNamedPipeOnce = false;
 #endif
-	check((int32)bThroughFile + (int32)bThroughNamedPipe + (int32)bThroughNamedPipeOnce == 1);
+	check((int32)bThroughFile + (int32)bThroughNamedPipe + (int32)bThroughNamedPipeOnce + (int32)bThroughSocket == 1);
 
-	FWorkLoop::ECommunicationMode Mode = bThroughFile ? FWorkLoop::ThroughFile : (bThroughNamedPipeOnce ? FWorkLoop::ThroughNamedPipeOnce : FWorkLoop::ThroughNamedPipe);
+	FWorkLoop::ECommunicationMode Mode = bThroughSocket ? FWorkLoop::ThroughSocket : (bThroughFile ? FWorkLoop::ThroughFile : (bThroughNamedPipeOnce ? FWorkLoop::ThroughNamedPipeOnce : FWorkLoop::ThroughNamedPipe));
 	FWorkLoop WorkLoop(argv[2], argv[1], argv[4], argv[5], Mode);
 
 	WorkLoop.Loop();
@@ -13,6 +13,7 @@ public class ShaderCompileWorker : ModuleRules
 				"Projects",
 				"ShaderCore",
 				"SandboxFile",
+				"Sockets",
 				"TargetPlatform",
 			}
 			);
@@ -70,10 +70,10 @@ void FStatsConvertCommand::InternalRun()
 		return;
 	}
 
-	// This is not supported yet.
-	if (Stream.Header.bRawStatsFile)
+	// Raw files only have the cycle scopes of each thread, they can only be converted to a timeline.
+	if (Stream.Header.bRawStatsFile && !Stream.Header.IsFinalized())
 	{
-		UE_LOG( LogStats, Error, TEXT( "Could not open input file, not supported type (raw): %s" ), *TargetFile );
+		UE_LOG( LogStats, Error, TEXT( "Could not open input file, raw stats file has to be finalized: %s" ), *TargetFile );
 		return;
 	}
 
@@ -95,7 +95,14 @@ void FStatsConvertCommand::InternalRun()
 		UE_CLOG( !bIsFinalized, LogStats, Fatal, TEXT( "Compressed stats file has to be finalized" ) );
 	}
 
-	ReadAndConvertStatMessages( *FileReader, *FileWriter );
+	if( Stream.Header.bRawStatsFile )
+	{
+		ReadAndConvertRawStatsToTimeline( *FileReader, *FileWriter );
+	}
+	else
+	{
+		ReadAndConvertStatMessages( *FileReader, *FileWriter );
+	}
 
 #endif // STATS
 }
@@ -237,3 +244,130 @@ void FStatsConvertCommand::CollectAndWriteStatsValues( FArchive& Writer )
 		}
 	}
 }
+
+
+void FStatsConvertCommand::ReadAndConvertRawStatsToTimeline( FArchive& Reader, FArchive& Writer )
+{
+	FirstCycles = 0;
+	LastCycles = 0;
+	SecondsPerCycle = 0.0;
+	bFirstTimelineEvent = true;
+
+	// Buffer used to store the compressed and decompressed data.
+	TArray<uint8> SrcData;
+	TArray<uint8> DestData;
+
+	const bool bHasCompressedData = Stream.Header.HasCompressedData();
+	const bool bIsFinalized = Stream.Header.IsFinalized();
+
+	WriteString( Writer, "{\"traceEvents\":[\r\n" );
+
+	// Name the threads, the task graph workers included.
+	for( auto It = ThreadState.Threads.CreateConstIterator(); It; ++It )
+	{
+		WriteString( Writer, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"%S\"}},\r\n", It.Key(), *It.Value().ToString().ReplaceCharWithEscapedChar() );
+	}
+
+	for( int32 FrameIndex = 0; FrameIndex < Stream.FramesInfo.Num(); ++FrameIndex )
+	{
+		Reader.Seek( Stream.FramesInfo[FrameIndex].FrameFileOffset );
+
+		if( bHasCompressedData )
+		{
+			// Read the compressed data.
+			FCompressedStatsData UncompressedData( SrcData, DestData );
+			Reader << UncompressedData;
+		}
+
+		// Select the proper archive.
+		FMemoryReader MemoryReader( DestData, true );
+		FArchive& Archive = bHasCompressedData ? MemoryReader : Reader;
+
+		int64 TargetFrame;
+		Archive << TargetFrame;
+
+		int32 NumPackets;
+		Archive << NumPackets;
+
+		FStatPacketArray Frame;
+		for( int32 PacketIndex = 0; PacketIndex < NumPackets; PacketIndex++ )
+		{
+			FStatPacket* ToRead = new FStatPacket();
+			Stream.ReadStatPacket( Archive, *ToRead, bIsFinalized );
+			Frame.Packets.Add( ToRead );
+		}
+
+		// Cycles are converted with the rate of the machine the file was captured on, it is sent as a stat.
+		if( SecondsPerCycle == 0.0 )
+		{
+			for( int32 PacketIndex = 0; PacketIndex < Frame.Packets.Num() && SecondsPerCycle == 0.0; PacketIndex++ )
+			{
+				const FStatMessagesArray& Data = Frame.Packets[PacketIndex]->StatMessages;
+				for( int32 Index = 0; Index < Data.Num(); Index++ )
+				{
+					if( Data[Index].NameAndInfo.GetShortName() == TEXT( "STAT_SecondsPerCycle" ) )
+					{
+						SecondsPerCycle = Data[Index].GetValue_double();
+						break;
+					}
+				}
+			}
+
+			if( SecondsPerCycle == 0.0 )
+			{
+				UE_LOG( LogStats, Warning, TEXT( "STAT_SecondsPerCycle not found, using the cycle rate of this machine" ) );
+				SecondsPerCycle = FPlatformTime::GetSecondsPerCycle();
+			}
+		}
+
+		for( int32 PacketIndex = 0; PacketIndex < Frame.Packets.Num(); PacketIndex++ )
+		{
+			const FStatPacket& StatPacket = *Frame.Packets[PacketIndex];
+			const FStatMessagesArray& Data = StatPacket.StatMessages;
+
+			for( int32 Index = 0; Index < Data.Num(); Index++ )
+			{
+				const FStatMessage& Item = Data[Index];
+				const EStatOperation::Type Op = Item.NameAndInfo.GetField<EStatOperation>();
+				if( Op == EStatOperation::CycleScopeStart || Op == EStatOperation::CycleScopeEnd )
+				{
+					WriteTimelineEvent( Writer, Item, StatPacket.ThreadId );
+				}
+			}
+		}
+
+		UE_CLOG( FrameIndex % 32 == 0, LogStats, Log, TEXT( "StatsConvertCommand progress: %4i/%4i frames" ), FrameIndex, Stream.FramesInfo.Num() );
+	}
+
+	// The JSON array can't end with a comma, close it with an event of the first thread.
+	WriteString( Writer, "{\"name\":\"End of capture\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":0,\"ts\":%.3f}\r\n]}\r\n", ( LastCycles - FirstCycles ) * SecondsPerCycle * 1000000.0 );
+}
+
+
+void FStatsConvertCommand::WriteTimelineEvent( FArchive& Writer, const FStatMessage& Item, uint32 ThreadId )
+{
+	// The cycle counter is 32 bit and wraps, events are close enough in time for the difference to the previous one to be right.
+	const uint32 Cycles = uint32( Item.GetValue_int64() );
+	if( bFirstTimelineEvent )
+	{
+		FirstCycles = LastCycles = Cycles;
+		bFirstTimelineEvent = false;
+	}
+	LastCycles += int32( Cycles - uint32( LastCycles ) );
+
+	const FName LongName = Item.NameAndInfo.GetRawName();
+	const FString* EventName = TimelineEventNames.Find( LongName );
+	if( !EventName )
+	{
+		FString Description = Item.NameAndInfo.GetDescription();
+		if( Description.IsEmpty() )
+		{
+			Description = Item.NameAndInfo.GetShortName().ToString();
+		}
+		EventName = &TimelineEventNames.Add( LongName, Description.ReplaceCharWithEscapedChar() );
+	}
+
+	const bool bBegin = Item.NameAndInfo.GetField<EStatOperation>() == EStatOperation::CycleScopeStart;
+	const double TimeUS = ( LastCycles - FirstCycles ) * SecondsPerCycle * 1000000.0;
+	WriteString( Writer, "{\"name\":\"%S\",\"ph\":\"%s\",\"pid\":0,\"tid\":%u,\"ts\":%.3f},\r\n", **EventName, bBegin ? "B" : "E", ThreadId, TimeUS );
+}
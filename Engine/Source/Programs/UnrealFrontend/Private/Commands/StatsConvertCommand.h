@@ -24,9 +24,24 @@ protected:
 	void CollectAndWriteStatsValues( FArchive& Writer );
 	void ReadAndConvertStatMessages( FArchive& Reader, FArchive& Writer );
 
+	/** Converts a raw stats file to a chrome://tracing timeline of the cycle scopes of every thread. */
+	void ReadAndConvertRawStatsToTimeline( FArchive& Reader, FArchive& Writer );
+
+	/** Writes the begin or end of a cycle scope to the timeline. */
+	void WriteTimelineEvent( FArchive& Writer, const FStatMessage& Item, uint32 ThreadId );
+
 private:
 
 	FStatsReadStream Stream;
 	FStatsThreadState ThreadState;
 	TArray<FName> StatList;
+
+	/** Timeline state, cycle counter of the first event and of the last one, unwrapped to 64 bits. */
+	int64 FirstCycles;
+	int64 LastCycles;
+	double SecondsPerCycle;
+	bool bFirstTimelineEvent;
+
+	/** Display names of the cycle stats, by long name. */
+	TMap<FName, FString> TimelineEventNames;
 };
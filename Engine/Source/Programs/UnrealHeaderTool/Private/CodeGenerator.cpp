@@ -12,6 +12,7 @@
 #include "Manifest.h"
 #include "StringUtils.h"
 #include "IPluginManager.h"
+#include "ParallelFor.h"
 
 /////////////////////////////////////////////////////
 // Globals
@@ -25,7 +26,35 @@ static bool bVerifyContents = false;
 static const bool bMultiLineUFUNCTION = true;
 static const bool bMultiLineUPROPERTY = true;
 
-static UClass* GenerateCodeForHeader(UObject* InParent, const TCHAR* Name, EObjectFlags Flags, const TCHAR* Buffer, int32& OutClassDeclLine);
+/** Results of the preliminary parse of a UObject header, which only depends on the text of the header. */
+struct FPreparsedHeader
+{
+	/** Filename of the header, as listed in the manifest. */
+	FString Filename;
+	/** Full path of the header. */
+	FString FullModulePath;
+	/** Text of the header, only kept if the preliminary parse failed. */
+	FString HeaderFile;
+	/** False if the header could not be loaded or failed to parse, the work is redone serially to report the error. */
+	bool bParsed;
+
+	bool bClassIsAnInterface;
+	TArray<FName> DependentOn;
+	FString ClassName;
+	FString BaseClassName;
+	int32 ClassDeclLine;
+	FStringOutputDevice ClassHeaderTextStrippedOfCppText;
+
+	FPreparsedHeader()
+		: bParsed(false)
+		, bClassIsAnInterface(false)
+		, ClassDeclLine(-1)
+	{
+	}
+};
+
+static void PreparseHeader(FPreparsedHeader& Header);
+static UClass* GenerateCodeForHeader(UObject* InParent, const TCHAR* Name, EObjectFlags Flags, FPreparsedHeader& Header);
 
 FCompilerMetadataManager GScriptHelper;
 
@@ -5001,6 +5030,39 @@ ECompilationResult::Type UnrealHeaderTool_Main(const FString& ModuleInfoFilename
 		FolderType_Count
 	};
 
+	// We'll make an ordered list of all UObject headers we care about.
+	// @todo uht: Ideally 'dependson' would not be allowed from public -> private, or NOT at all for new style headers
+	auto GetUObjectHeaders = [](const FManifestModule& Module, EHeaderFolderTypes CurrentlyProcessing) -> const TArray<FString>&
+	{
+		return
+			(CurrentlyProcessing == PublicClassesHeaders) ? Module.PublicUObjectClassesHeaders :
+			(CurrentlyProcessing == PublicHeaders       ) ? Module.PublicUObjectHeaders        :
+			                                                Module.PrivateUObjectHeaders;
+	};
+
+	// Load and pre-parse every header up front. This only reads the text of each header, so it runs in parallel;
+	// the classes are still imported serially below, in the order the dependencies between them rely on
+	TArray<FPreparsedHeader> PreparsedHeaders;
+	for (const auto& Module : GManifest.Modules)
+	{
+		for (int32 PassIndex = 0; PassIndex < FolderType_Count; ++PassIndex)
+		{
+			for (const FString& Filename : GetUObjectHeaders(Module, (EHeaderFolderTypes)PassIndex))
+			{
+				FPreparsedHeader& Header = PreparsedHeaders[PreparsedHeaders.AddDefaulted()];
+				Header.Filename       = Filename;
+				Header.FullModulePath = FPaths::ConvertRelativePathToFull(ModuleInfoPath, Filename);
+			}
+		}
+	}
+
+	ParallelFor(PreparsedHeaders.Num(), [&PreparsedHeaders](int32 Index)
+	{
+		PreparseHeader(PreparsedHeaders[Index]);
+	});
+
+	int32 PreparsedHeaderIndex = 0;
+
 	for (const auto& Module : GManifest.Modules)
 	{
 		if (Result != ECompilationResult::Succeeded)
@@ -5026,35 +5088,27 @@ ECompilationResult::Type UnrealHeaderTool_Main(const FString& ModuleInfoFilename
 		{
 			EHeaderFolderTypes CurrentlyProcessing = (EHeaderFolderTypes)PassIndex;
 
-			// We'll make an ordered list of all UObject headers we care about.
-			// @todo uht: Ideally 'dependson' would not be allowed from public -> private, or NOT at all for new style headers
-			const TArray<FString>& UObjectHeaders =
-				(CurrentlyProcessing == PublicClassesHeaders) ? Module.PublicUObjectClassesHeaders :
-				(CurrentlyProcessing == PublicHeaders       ) ? Module.PublicUObjectHeaders        :
-				                                                Module.PrivateUObjectHeaders;
+			const TArray<FString>& UObjectHeaders = GetUObjectHeaders(Module, CurrentlyProcessing);
 			if (!UObjectHeaders.Num())
 				continue;
 
 			for (const FString& Filename : UObjectHeaders)
 			{
+				FPreparsedHeader& Preparsed = PreparsedHeaders[PreparsedHeaderIndex++];
+				check(Preparsed.Filename == Filename);
+
 				// Best faith effort at a useful line number for errors occurring during this initial pre-parsing
-				int32 ClassDeclLine = -1;
+				int32& ClassDeclLine = Preparsed.ClassDeclLine;
 
 			#if !PLATFORM_EXCEPTIONS_DISABLED
 				try
 			#endif
 				{
 					// Import class.
-					const FString ClassName      = FPaths::GetBaseFilename(Filename);
-					const FString FullModulePath = FPaths::ConvertRelativePathToFull(ModuleInfoPath, Filename);
+					const FString  ClassName      = FPaths::GetBaseFilename(Filename);
+					const FString& FullModulePath = Preparsed.FullModulePath;
 
-					FString HeaderFile;
-					if (!FFileHelper::LoadFileToString(HeaderFile, *FullModulePath))
-					{
-						FError::Throwf(TEXT( "UnrealHeaderTool was unable to load source file '%s'"), *FullModulePath);
-					}
-
-					UClass* ResultClass = GenerateCodeForHeader(Package, *ClassName, RF_Public|RF_Standalone, *HeaderFile, ClassDeclLine);
+					UClass* ResultClass = GenerateCodeForHeader(Package, *ClassName, RF_Public|RF_Standalone, Preparsed);
 					GClassSourceFileMap.Add(ResultClass, Filename);
 					GClassDeclarationLineNumber.Add(ResultClass, ClassDeclLine);
 					GClassGeneratedFileMap.Add(ResultClass, FClassHeaderInfo(IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*Filename)));
@@ -5242,30 +5296,73 @@ ECompilationResult::Type UnrealHeaderTool_Main(const FString& ModuleInfoFilename
 	return Result;
 }
 
+/**
+ * Loads the header and runs the preliminary parse on it. Can be called from any thread, as long as no error occurs:
+ * errors are thrown through a shared buffer, they are ignored here and reported by GenerateCodeForHeader instead.
+ */
+void PreparseHeader(FPreparsedHeader& Header)
+{
+	if (!FFileHelper::LoadFileToString(Header.HeaderFile, *Header.FullModulePath))
+	{
+		return;
+	}
+
+#if !PLATFORM_EXCEPTIONS_DISABLED
+	try
+#endif
+	{
+		FHeaderParser::SimplifiedClassParse(*Header.HeaderFile, /*out*/ Header.bClassIsAnInterface, /*out*/ Header.DependentOn, /*out*/ Header.ClassName, /*out*/ Header.BaseClassName, /*out*/ Header.ClassDeclLine, Header.ClassHeaderTextStrippedOfCppText);
+		Header.bParsed = true;
+	}
+#if !PLATFORM_EXCEPTIONS_DISABLED
+	catch( ... )
+	{
+	}
+#endif
+
+	if (Header.bParsed)
+	{
+		Header.HeaderFile.Empty();
+	}
+}
+
 UClass* GenerateCodeForHeader
 (
-	UObject*     InParent,
-	const TCHAR* Name,
-	EObjectFlags Flags,
-	const TCHAR* Buffer,
-	int32&       OutClassDeclLine
+	UObject*          InParent,
+	const TCHAR*      Name,
+	EObjectFlags      Flags,
+	FPreparsedHeader& Header
 )
 {
 	// Support for headers without UClasses.
 	bool bNonClassHeader = false;
-	const TCHAR* InBuffer = Buffer;
+
+	// Redo the work of a failed preliminary parse on this thread, to throw its error
+	if (!Header.bParsed)
+	{
+		if (Header.HeaderFile.IsEmpty() && !FFileHelper::LoadFileToString(Header.HeaderFile, *Header.FullModulePath))
+		{
+			FError::Throwf(TEXT( "UnrealHeaderTool was unable to load source file '%s'"), *Header.FullModulePath);
+		}
+
+		Header.bClassIsAnInterface = false;
+		Header.DependentOn.Reset();
+		Header.ClassName.Empty();
+		Header.BaseClassName.Empty();
+		Header.ClassHeaderTextStrippedOfCppText.Empty();
+		FHeaderParser::SimplifiedClassParse(*Header.HeaderFile, /*out*/ Header.bClassIsAnInterface, /*out*/ Header.DependentOn, /*out*/ Header.ClassName, /*out*/ Header.BaseClassName, /*out*/ Header.ClassDeclLine, Header.ClassHeaderTextStrippedOfCppText);
+	}
 
 	// Import the script text.
-	TArray<FName> DependentOn;
+	TArray<FName>& DependentOn = Header.DependentOn;
 
 	// is the parsed class name an interface?
-	bool bClassIsAnInterface = false;
+	const bool bClassIsAnInterface = Header.bClassIsAnInterface;
 
-	// Parse the header to extract the information needed
-	FStringOutputDevice ClassHeaderTextStrippedOfCppText;
-	FString ClassName;
-	FString BaseClassName;
-	FHeaderParser::SimplifiedClassParse(Buffer, /*out*/ bClassIsAnInterface, /*out*/ DependentOn, /*out*/ ClassName, /*out*/ BaseClassName, /*out*/ OutClassDeclLine, ClassHeaderTextStrippedOfCppText);
+	// The information extracted from the header
+	FStringOutputDevice& ClassHeaderTextStrippedOfCppText = Header.ClassHeaderTextStrippedOfCppText;
+	FString& ClassName = Header.ClassName;
+	FString& BaseClassName = Header.BaseClassName;
 
 	// In case no UClass is defined, generate the default temporary UClass.
 	if (ClassName.IsEmpty())
@@ -269,6 +269,80 @@ private:
 };
 
 
+/** Sets up the intersection of a light ray with the triangle hit by its kDOP line check. */
+void FStaticLightingAggregateMesh::GetIntersection(
+	const FLightRay& LightRay,
+	bool bFindClosestIntersection,
+	const FHitResult& Result,
+	const TkDOPLineCollisionCheck<const FStaticLightingAggregateMeshDataProvider,uint32>& kDOPCheck,
+	FLightRayIntersection& Intersection) const
+{
+	const FStaticLightingAggregateMeshDataProvider& kDOPDataProvider = kDOPCheck.CollDataProvider;
+	// Setup a vertex to represent the intersection.
+	FStaticLightingVertex IntersectionVertex;
+	IntersectionVertex.WorldPosition = LightRay.Start + LightRay.Direction * LightRay.Length * Result.Time;
+	IntersectionVertex.WorldTangentZ = kDOPCheck.LocalHitNormal;
+	const FTriangleSOAPayload& Payload = TrianglePayloads[ Result.Item ];
+	const FVector4& v1 = kDOPDataProvider.GetVertex(Payload.VertexIndex[0]);
+	const FVector4& v2 = kDOPDataProvider.GetVertex(Payload.VertexIndex[1]);
+	const FVector4& v3 = kDOPDataProvider.GetVertex(Payload.VertexIndex[2]);
+	const FVector4 LocalHitPosition = kDOPCheck.LocalStart + kDOPCheck.LocalDir * Result.Time;
+	FVector4 BaryCentricWeights;
+	//@todo - why is such a huge tolerance needed?  Reuse the barycentric coords calculated by the ray-triangle intersection instead of deriving them from the hit position.
+	//@todo - why does this sometimes fail if there was an intersection?
+	if (bFindClosestIntersection && GetBarycentricWeights(v1, v2, v3, LocalHitPosition, KINDA_SMALL_NUMBER * 100.0f, BaryCentricWeights))
+	{
+		const FVector2D& UV1 = kDOPDataProvider.GetUV(Payload.VertexIndex[0]);
+		const FVector2D& UV2 = kDOPDataProvider.GetUV(Payload.VertexIndex[1]);
+		const FVector2D& UV3 = kDOPDataProvider.GetUV(Payload.VertexIndex[2]);
+		// Interpolate the material texture coordinates to the intersection point
+		//@todo - only lookup and interpolate UV's if needed
+		IntersectionVertex.TextureCoordinates[0] = UV1 * BaryCentricWeights.X + UV2 * BaryCentricWeights.Y + UV3 * BaryCentricWeights.Z;
+		const FVector2D& LightmapUV1 = kDOPDataProvider.GetLightmapUV(Payload.VertexIndex[0]);
+		const FVector2D& LightmapUV2 = kDOPDataProvider.GetLightmapUV(Payload.VertexIndex[1]);
+		const FVector2D& LightmapUV3 = kDOPDataProvider.GetLightmapUV(Payload.VertexIndex[2]);
+		// Interpolate the lightmap texture coordinates to the intersection point
+		IntersectionVertex.TextureCoordinates[1] = LightmapUV1 * BaryCentricWeights.X + LightmapUV2 * BaryCentricWeights.Y + LightmapUV3 * BaryCentricWeights.Z;
+	}
+	else
+	{
+		IntersectionVertex.TextureCoordinates[0] = FVector2D(0,0);
+		IntersectionVertex.TextureCoordinates[1] = FVector2D(0,0);
+	}
+	// Return the index of the vertex closest to the hit point
+	int32 AbsoluteVertexIndex = Payload.VertexIndex[0];
+	if (BaryCentricWeights.Y > BaryCentricWeights.X)
+	{
+		if (BaryCentricWeights.Z > BaryCentricWeights.Y)
+		{
+			AbsoluteVertexIndex = Payload.VertexIndex[2];
+		}
+		else
+		{
+			AbsoluteVertexIndex = Payload.VertexIndex[1];
+		}
+	}
+	else if (BaryCentricWeights.Z > BaryCentricWeights.X)
+	{
+		AbsoluteVertexIndex = Payload.VertexIndex[2];
+	}
+	// Convert the index into the kDOP tree's vertices into an index into the hit mesh's vertices
+	const int32 RelativeVertexIndex = AbsoluteVertexIndex - Payload.MeshInfo->BaseIndex;
+	checkSlow(RelativeVertexIndex >= 0 && RelativeVertexIndex < Payload.MeshInfo->Mesh->NumVertices);
+	Intersection = FLightRayIntersection(true, IntersectionVertex, Payload.MeshInfo->Mesh, Payload.Mapping, RelativeVertexIndex, Payload.ElementIndex);
+}
+
+/** Whether the closest intersection of a light ray can't be its final intersection, and the ray must be traced again from there. */
+static FORCEINLINE bool IntersectionRequiresRestart(const FLightRay& LightRay, const FLightRayIntersection& Intersection, bool bDirectShadowingRay)
+{
+	return Intersection.Mesh->IsTranslucent(Intersection.ElementIndex) ||
+		Intersection.Mesh->IsMasked(Intersection.ElementIndex) ||
+		(Intersection.Mesh == LightRay.Mesh && ((Intersection.Mesh->LightingFlags & GI_INSTANCE_SELFSHADOWDISABLE) || (LightRay.TraceFlags & LIGHTRAY_SELFSHADOWDISABLE))) ||
+		// Continue tracing if we are only allowed to self shadow and intersected a different mesh
+		(Intersection.Mesh != LightRay.Mesh && (Intersection.Mesh->LightingFlags & GI_INSTANCE_SELFSHADOWONLY)) ||
+		(bDirectShadowingRay && Intersection.Mesh->IsIndirectlyShadowedOnly(Intersection.ElementIndex));
+}
+
 /**
  * Checks a light ray for intersection with the shadow mesh.
  * @param LightRay - The line segment to check for intersection.
@@ -370,58 +444,7 @@ bool FStaticLightingAggregateMesh::IntersectLightRay(
 
 		if (bHit)
 		{
-			// Setup a vertex to represent the intersection.
-			FStaticLightingVertex IntersectionVertex;
-			IntersectionVertex.WorldPosition = ClippedLightRay.Start + ClippedLightRay.Direction * ClippedLightRay.Length * Result.Time;
-			IntersectionVertex.WorldTangentZ = kDOPCheck.LocalHitNormal;
-			const FTriangleSOAPayload& Payload = TrianglePayloads[ Result.Item ];
-			const FVector4& v1 = kDOPDataProvider.GetVertex(Payload.VertexIndex[0]);
-			const FVector4& v2 = kDOPDataProvider.GetVertex(Payload.VertexIndex[1]);
-			const FVector4& v3 = kDOPDataProvider.GetVertex(Payload.VertexIndex[2]);
-			const FVector4 LocalHitPosition = kDOPCheck.LocalStart + kDOPCheck.LocalDir * Result.Time;
-			FVector4 BaryCentricWeights;
-			//@todo - why is such a huge tolerance needed?  Reuse the barycentric coords calculated by the ray-triangle intersection instead of deriving them from the hit position.
-			//@todo - why does this sometimes fail if there was an intersection?
-			if (bFindClosestIntersection && GetBarycentricWeights(v1, v2, v3, LocalHitPosition, KINDA_SMALL_NUMBER * 100.0f, BaryCentricWeights))
-			{
-				const FVector2D& UV1 = kDOPDataProvider.GetUV(Payload.VertexIndex[0]);
-				const FVector2D& UV2 = kDOPDataProvider.GetUV(Payload.VertexIndex[1]);
-				const FVector2D& UV3 = kDOPDataProvider.GetUV(Payload.VertexIndex[2]);
-				// Interpolate the material texture coordinates to the intersection point
-				//@todo - only lookup and interpolate UV's if needed
-				IntersectionVertex.TextureCoordinates[0] = UV1 * BaryCentricWeights.X + UV2 * BaryCentricWeights.Y + UV3 * BaryCentricWeights.Z;
-				const FVector2D& LightmapUV1 = kDOPDataProvider.GetLightmapUV(Payload.VertexIndex[0]);
-				const FVector2D& LightmapUV2 = kDOPDataProvider.GetLightmapUV(Payload.VertexIndex[1]);
-				const FVector2D& LightmapUV3 = kDOPDataProvider.GetLightmapUV(Payload.VertexIndex[2]);
-				// Interpolate the lightmap texture coordinates to the intersection point
-				IntersectionVertex.TextureCoordinates[1] = LightmapUV1 * BaryCentricWeights.X + LightmapUV2 * BaryCentricWeights.Y + LightmapUV3 * BaryCentricWeights.Z;
-			}
-			else
-			{
-				IntersectionVertex.TextureCoordinates[0] = FVector2D(0,0);
-				IntersectionVertex.TextureCoordinates[1] = FVector2D(0,0);
-			}
-			// Return the index of the vertex closest to the hit point
-			int32 AbsoluteVertexIndex = Payload.VertexIndex[0];
-			if (BaryCentricWeights.Y > BaryCentricWeights.X)
-			{
-				if (BaryCentricWeights.Z > BaryCentricWeights.Y)
-				{
-					AbsoluteVertexIndex = Payload.VertexIndex[2];
-				}
-				else
-				{
-					AbsoluteVertexIndex = Payload.VertexIndex[1];
-				}
-			}
-			else if (BaryCentricWeights.Z > BaryCentricWeights.X)
-			{
-				AbsoluteVertexIndex = Payload.VertexIndex[2];
-			}
-			// Convert the index into the kDOP tree's vertices into an index into the hit mesh's vertices
-			const int32 RelativeVertexIndex = AbsoluteVertexIndex - Payload.MeshInfo->BaseIndex;
-			checkSlow(RelativeVertexIndex >= 0 && RelativeVertexIndex < Payload.MeshInfo->Mesh->NumVertices);
-			ClosestIntersection = FLightRayIntersection(true, IntersectionVertex, Payload.MeshInfo->Mesh, Payload.Mapping, RelativeVertexIndex, Payload.ElementIndex);
+			GetIntersection(ClippedLightRay, bFindClosestIntersection, Result, kDOPCheck, ClosestIntersection);
 			if (bFindClosestIntersection)
 			{
 				ClippedLightRay.ClipAgainstIntersectionFromStart(ClosestIntersection.IntersectionVertex.WorldPosition);
@@ -437,12 +460,7 @@ bool FStaticLightingAggregateMesh::IntersectLightRay(
 	} 
 	// Continue tracing as long as we are intersecting meshes that might need to restart the ray
 	while (ClosestIntersection.bIntersects 
-		&& (ClosestIntersection.Mesh->IsTranslucent(ClosestIntersection.ElementIndex) ||
-			ClosestIntersection.Mesh->IsMasked(ClosestIntersection.ElementIndex) ||
-			(ClosestIntersection.Mesh == LightRay.Mesh && ((ClosestIntersection.Mesh->LightingFlags & GI_INSTANCE_SELFSHADOWDISABLE) || (LightRay.TraceFlags & LIGHTRAY_SELFSHADOWDISABLE))) ||
-			// Continue tracing if we are only allowed to self shadow and intersected a different mesh
-			(ClosestIntersection.Mesh != LightRay.Mesh && (ClosestIntersection.Mesh->LightingFlags & GI_INSTANCE_SELFSHADOWONLY)) ||
-			(bDirectShadowingRay && ClosestIntersection.Mesh->IsIndirectlyShadowedOnly(ClosestIntersection.ElementIndex)))
+		&& IntersectionRequiresRestart(LightRay, ClosestIntersection, bDirectShadowingRay)
 		&& NumIterativeIntersections < MaxNumIterativeIntersections);
 
 	if (NumIterativeIntersections >= MaxNumIterativeIntersections)
@@ -457,5 +475,86 @@ bool FStaticLightingAggregateMesh::IntersectLightRay(
 	return ClosestIntersection.bIntersects;
 }
 
+/**
+ * Checks a packet of coherent light rays for their closest intersection with the shadow mesh, tracing them through the kDOP together.
+ * Gives the same intersections as IntersectLightRay with bFindClosestIntersection and without transmission for each of the rays.
+ * @param LightRays - The line segments to check for intersection, up to KDOP_PACKET_SIZE of them.
+ * @param NumRays - The number of rays in LightRays.
+ * @param bDirectShadowingRay - Whether the rays are being used to calculate direct shadowing.
+ * @param CoherentRayCache - The calling thread's collision cache.
+ * @param [out] Intersections - The closest intersection of each of the light rays with the mesh.
+ */
+void FStaticLightingAggregateMesh::IntersectLightRayPacket(
+	const FLightRay* LightRays,
+	int32 NumRays,
+	bool bDirectShadowingRay,
+	FCoherentRayCache& CoherentRayCache,
+	FLightRayIntersection* Intersections) const
+{
+	typedef TkDOPLineCollisionCheck<const FStaticLightingAggregateMeshDataProvider,uint32> FLineCheck;
+	checkSlow(NumRays > 0 && NumRays <= KDOP_PACKET_SIZE);
+
+	// The rays that hit masked, translucent or ignored geometry first, they need the iterative trace of IntersectLightRay
+	int32 RestartRayMask = 0;
+	{
+		LIGHTINGSTAT(FScopedRDTSCTimer RayTraceTimer(CoherentRayCache.FirstHitRayTraceTime);)
+		CoherentRayCache.NumFirstHitRaysTraced += NumRays;
+
+		// The data provider doesn't use its ray
+		FStaticLightingAggregateMeshDataProvider kDOPDataProvider(this, LightRays[0]);
+		FVector4 Ends[KDOP_PACKET_SIZE];
+		FHitResult Results[KDOP_PACKET_SIZE];
+		TTypeCompatibleBytes<FLineCheck> kDOPCheckStorage[KDOP_PACKET_SIZE];
+		FLineCheck* kDOPChecks[KDOP_PACKET_SIZE];
+
+		for (int32 RayIndex = 0; RayIndex < NumRays; RayIndex++)
+		{
+			const FLightRay& LightRay = LightRays[RayIndex];
+			Ends[RayIndex] = LightRay.Start + LightRay.Direction * LightRay.Length;
+			kDOPChecks[RayIndex] = new(&kDOPCheckStorage[RayIndex]) FLineCheck(
+				LightRay.Start,
+				Ends[RayIndex],
+				true,
+				(LightRay.TraceFlags & LIGHTRAY_STATIC_AND_OPAQUEONLY) != 0,
+				!bDirectShadowingRay,
+				(LightRay.TraceFlags & LIGHTRAY_FLIP_SIDEDNESS) != 0,
+				kDOPDataProvider,
+				LightRay.Mapping ? LightRay.Mapping->Mesh->MeshIndex : INDEX_NONE,
+				LightRay.Mapping ? LightRay.Mapping->Mesh->GetLODIndex() : INDEX_NONE,
+				&Results[RayIndex]);
+		}
+
+		TkDOPPacketLineCollisionCheck<const FStaticLightingAggregateMeshDataProvider,uint32> PacketCheck(kDOPChecks, NumRays);
+		const int32 HitMask = kDopTree.LineCheckPacket(PacketCheck);
+
+		for (int32 RayIndex = 0; RayIndex < NumRays; RayIndex++)
+		{
+			FLightRayIntersection& Intersection = Intersections[RayIndex];
+			Intersection.bIntersects = false;
+			Intersection.Transmission = FLinearColor::White;
+
+			if (HitMask & (1 << RayIndex))
+			{
+				GetIntersection(LightRays[RayIndex], true, Results[RayIndex], *kDOPChecks[RayIndex], Intersection);
+
+				if (IntersectionRequiresRestart(LightRays[RayIndex], Intersection, bDirectShadowingRay))
+				{
+					RestartRayMask |= 1 << RayIndex;
+				}
+			}
+		}
+	}
+
+	for (int32 RayIndex = 0; RayIndex < NumRays; RayIndex++)
+	{
+		if (RestartRayMask & (1 << RayIndex))
+		{
+			// IntersectLightRay counts the ray again
+			CoherentRayCache.NumFirstHitRaysTraced--;
+			IntersectLightRay(LightRays[RayIndex], true, false, bDirectShadowingRay, CoherentRayCache, Intersections[RayIndex]);
+		}
+	}
+}
+
 
 } //namespace Lightmass
@@ -167,8 +167,32 @@ public:
 		class FCoherentRayCache& CoherentRayCache,
 		FLightRayIntersection& Intersection) const;
 
+	/**
+	 * Checks a packet of coherent light rays for their closest intersection with the shadow mesh, tracing them through the kDOP together.
+	 * Gives the same intersections as IntersectLightRay with bFindClosestIntersection and without transmission for each of the rays.
+	 * @param LightRays - The line segments to check for intersection, up to KDOP_PACKET_SIZE of them.
+	 * @param NumRays - The number of rays in LightRays.
+	 * @param bDirectShadowingRay - Whether the rays are being used to calculate direct shadowing.
+	 * @param CoherentRayCache - The calling thread's collision cache.
+	 * @param [out] Intersections - The closest intersection of each of the light rays with the mesh.
+	 */
+	void IntersectLightRayPacket(
+		const FLightRay* LightRays,
+		int32 NumRays,
+		bool bDirectShadowingRay,
+		class FCoherentRayCache& CoherentRayCache,
+		FLightRayIntersection* Intersections) const;
+
 private:
 
+	/** Sets up the intersection of a light ray with the triangle hit by its kDOP line check. */
+	void GetIntersection(
+		const FLightRay& LightRay,
+		bool bFindClosestIntersection,
+		const FHitResult& Result,
+		const TkDOPLineCollisionCheck<const FStaticLightingAggregateMeshDataProvider,uint32>& kDOPCheck,
+		FLightRayIntersection& Intersection) const;
+
 	const FScene& Scene;
 
 	friend class FStaticLightingAggregateMeshDataProvider;
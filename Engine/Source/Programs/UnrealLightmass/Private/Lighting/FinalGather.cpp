@@ -1217,50 +1217,72 @@ SampleType FStaticLightingSystem::IncomingRadianceUniform(
 	float NumSamplesOccluded = 0;
 	FVector CombinedSkyUnoccludedDirection(0);
 
+	// The samples are stratified, consecutive samples have neighboring directions so their rays are traced together as a packet
+	FLightRay PathRays[KDOP_PACKET_SIZE];
+	FVector4 WorldPathDirections[KDOP_PACKET_SIZE];
+	FVector4 TangentPathDirections[KDOP_PACKET_SIZE];
+	FLightRayIntersection RayIntersections[KDOP_PACKET_SIZE];
+
 	// Estimate the indirect part of the light transport equation using uniform sampled monte carlo integration
 	//@todo - use cosine sampling if possible to match the indirect integrand, the irradiance caching algorithm assumes uniform sampling
 	for (int32 SampleIndex = 0; SampleIndex < UniformHemisphereSamples.Num(); SampleIndex++)
 	{
-		const FVector4 TriangleTangentPathDirection = UniformHemisphereSamples[SampleIndex];
-		checkSlow(TriangleTangentPathDirection.Z >= 0.0f);
-		checkSlow(TriangleTangentPathDirection.IsUnit3());
+		const int32 PacketRayIndex = SampleIndex % KDOP_PACKET_SIZE;
 
-		// Generate the uniform hemisphere samples from a hemisphere based around the triangle normal, not the smoothed vertex normal
-		// This is important for cases where the smoothed vertex normal is very different from the triangle normal, in which case
-		// Using the smoothed vertex normal would cause self-intersection even on a plane
-		const FVector4 WorldPathDirection = Vertex.TransformTriangleTangentVectorToWorld(TriangleTangentPathDirection);
-		checkSlow(WorldPathDirection.IsUnit3());
+		if (PacketRayIndex == 0)
+		{
+			const int32 NumPacketRays = FMath::Min<int32>(KDOP_PACKET_SIZE, UniformHemisphereSamples.Num() - SampleIndex);
 
-		const FVector4 TangentPathDirection = Vertex.TransformWorldVectorToTangent(WorldPathDirection);
-		checkSlow(TangentPathDirection.IsUnit3());
+			for (int32 RayIndex = 0; RayIndex < NumPacketRays; RayIndex++)
+			{
+				const FVector4 TriangleTangentPathDirection = UniformHemisphereSamples[SampleIndex + RayIndex];
+				checkSlow(TriangleTangentPathDirection.Z >= 0.0f);
+				checkSlow(TriangleTangentPathDirection.IsUnit3());
 
-		FVector4 SampleOffset(0,0,0);
-		if (GeneralSettings.bAccountForTexelSize)
-		{
-			// Offset the sample's starting point in the tangent XY plane based on the sample's area of influence. 
-			// This is particularly effective for large texels with high variance in the incoming radiance over the area of the texel.
-			SampleOffset = Vertex.WorldTangentX * TangentPathDirection.X * SampleRadius * SceneConstants.VisibilityTangentOffsetSampleRadiusScale
-				+ Vertex.WorldTangentY * TangentPathDirection.Y * SampleRadius * SceneConstants.VisibilityTangentOffsetSampleRadiusScale;
+				// Generate the uniform hemisphere samples from a hemisphere based around the triangle normal, not the smoothed vertex normal
+				// This is important for cases where the smoothed vertex normal is very different from the triangle normal, in which case
+				// Using the smoothed vertex normal would cause self-intersection even on a plane
+				const FVector4 WorldPathDirection = Vertex.TransformTriangleTangentVectorToWorld(TriangleTangentPathDirection);
+				checkSlow(WorldPathDirection.IsUnit3());
+
+				const FVector4 TangentPathDirection = Vertex.TransformWorldVectorToTangent(WorldPathDirection);
+				checkSlow(TangentPathDirection.IsUnit3());
+
+				FVector4 SampleOffset(0,0,0);
+				if (GeneralSettings.bAccountForTexelSize)
+				{
+					// Offset the sample's starting point in the tangent XY plane based on the sample's area of influence. 
+					// This is particularly effective for large texels with high variance in the incoming radiance over the area of the texel.
+					SampleOffset = Vertex.WorldTangentX * TangentPathDirection.X * SampleRadius * SceneConstants.VisibilityTangentOffsetSampleRadiusScale
+						+ Vertex.WorldTangentY * TangentPathDirection.Y * SampleRadius * SceneConstants.VisibilityTangentOffsetSampleRadiusScale;
+				}
+
+				PathRays[RayIndex] = FLightRay(
+					// Apply various offsets to the start of the ray.
+					// The offset along the ray direction is to avoid incorrect self-intersection due to floating point precision.
+					// The offset along the normal is to push self-intersection patterns (like triangle shape) on highly curved surfaces onto the backfaces.
+					Vertex.WorldPosition 
+						+ WorldPathDirection * SceneConstants.VisibilityRayOffsetDistance 
+						+ Vertex.WorldTangentZ * SampleRadius * SceneConstants.VisibilityNormalOffsetSampleRadiusScale 
+						+ SampleOffset,
+					Vertex.WorldPosition + WorldPathDirection * MaxRayDistance,
+					Mapping,
+					NULL
+					);
+				WorldPathDirections[RayIndex] = WorldPathDirection;
+				TangentPathDirections[RayIndex] = TangentPathDirection;
+			}
+
+			MappingContext.Stats.NumFirstBounceRaysTraced += NumPacketRays;
+			const float LastRayTraceTime = MappingContext.RayCache.FirstHitRayTraceTime;
+			AggregateMesh.IntersectLightRayPacket(PathRays, NumPacketRays, false, MappingContext.RayCache, RayIntersections);
+			MappingContext.Stats.FirstBounceRayTraceTime += MappingContext.RayCache.FirstHitRayTraceTime - LastRayTraceTime;
 		}
 
-		const FLightRay PathRay(
-			// Apply various offsets to the start of the ray.
-			// The offset along the ray direction is to avoid incorrect self-intersection due to floating point precision.
-			// The offset along the normal is to push self-intersection patterns (like triangle shape) on highly curved surfaces onto the backfaces.
-			Vertex.WorldPosition 
-				+ WorldPathDirection * SceneConstants.VisibilityRayOffsetDistance 
-				+ Vertex.WorldTangentZ * SampleRadius * SceneConstants.VisibilityNormalOffsetSampleRadiusScale 
-				+ SampleOffset,
-			Vertex.WorldPosition + WorldPathDirection * MaxRayDistance,
-			Mapping,
-			NULL
-			);
-
-		MappingContext.Stats.NumFirstBounceRaysTraced++;
-		const float LastRayTraceTime = MappingContext.RayCache.FirstHitRayTraceTime;
-		FLightRayIntersection RayIntersection;
-		AggregateMesh.IntersectLightRay(PathRay, true, false, false, MappingContext.RayCache, RayIntersection);
-		MappingContext.Stats.FirstBounceRayTraceTime += MappingContext.RayCache.FirstHitRayTraceTime - LastRayTraceTime;
+		const FVector4& WorldPathDirection = WorldPathDirections[PacketRayIndex];
+		const FVector4& TangentPathDirection = TangentPathDirections[PacketRayIndex];
+		const FLightRay& PathRay = PathRays[PacketRayIndex];
+		const FLightRayIntersection& RayIntersection = RayIntersections[PacketRayIndex];
 
 		float PhotonImportanceSampledPDF = 0.0f;
 		{
@@ -13,6 +13,8 @@ namespace Lightmass
 #define SLOW_KDOP_STATS(...) 
 // Whether to cache Centroid, LocalNormal and such for build triangles. Peak memory vs. minor build time trade-off.
 #define CACHE_BUILD_TEMPORARIES 0
+// Maximum number of rays traced together by a packet line check, one per vector register channel.
+#define KDOP_PACKET_SIZE 4
 
 /** Number of triangles in the aggregate mesh kDOP. */
 extern int32 GKDOPTriangles;
@@ -440,6 +442,7 @@ public:
 template <typename COLL_DATA_PROVIDER,typename KDOP_IDX_TYPE> struct TkDOPNode;
 template <typename COLL_DATA_PROVIDER,typename KDOP_IDX_TYPE> struct TkDOPTree;
 template <typename COLL_DATA_PROVIDER,typename KDOP_IDX_TYPE> struct TkDOPLineCollisionCheck;
+template <typename COLL_DATA_PROVIDER,typename KDOP_IDX_TYPE> struct TkDOPPacketLineCollisionCheck;
 
 /**
  * Holds the min/max planes that make up a set of 4 bounding volumes.
@@ -637,6 +640,54 @@ struct TkDOPNode
 #endif
 	}
 
+	/**
+	 * Tests the bounds of one of the children of this node against all the rays of a packet at once,
+	 * with the same slab test as LineCheckBounds but with a ray in each channel instead of a box.
+	 *
+	 * @param	Check		Information about the rays to trace
+	 * @param	BoxIndex	0 for the left child, 1 for the right child
+	 * @param	HitTime	[out]	Time of hit of each ray
+	 * @return	Mask of the rays that hit the bounds closer than their current hit, one bit per ray
+	 */
+	FORCEINLINE int32 LineCheckBoundsPacket(const TkDOPPacketLineCollisionCheck<COLL_DATA_PROVIDER,KDOP_IDX_TYPE>& Check, int32 BoxIndex, VectorRegister& HitTime) const
+	{
+		// 0: load everything into registers
+		const VectorRegister BoxMinX		= VectorSetFloat1( BoundingVolumes.Min[0][BoxIndex] );
+		const VectorRegister BoxMinY		= VectorSetFloat1( BoundingVolumes.Min[1][BoxIndex] );
+		const VectorRegister BoxMinZ		= VectorSetFloat1( BoundingVolumes.Min[2][BoxIndex] );
+		const VectorRegister BoxMaxX		= VectorSetFloat1( BoundingVolumes.Max[0][BoxIndex] );
+		const VectorRegister BoxMaxY		= VectorSetFloat1( BoundingVolumes.Max[1][BoxIndex] );
+		const VectorRegister BoxMaxZ		= VectorSetFloat1( BoundingVolumes.Max[2][BoxIndex] );
+
+		// 1: Calculate slabs.
+		const VectorRegister BoxMinSlabX	= VectorMultiply( VectorSubtract( BoxMinX, Check.LocalStarts.X ), Check.LocalOneOverDirs.X );
+		const VectorRegister BoxMinSlabY	= VectorMultiply( VectorSubtract( BoxMinY, Check.LocalStarts.Y ), Check.LocalOneOverDirs.Y );
+		const VectorRegister BoxMinSlabZ	= VectorMultiply( VectorSubtract( BoxMinZ, Check.LocalStarts.Z ), Check.LocalOneOverDirs.Z );
+		const VectorRegister BoxMaxSlabX	= VectorMultiply( VectorSubtract( BoxMaxX, Check.LocalStarts.X ), Check.LocalOneOverDirs.X );
+		const VectorRegister BoxMaxSlabY	= VectorMultiply( VectorSubtract( BoxMaxY, Check.LocalStarts.Y ), Check.LocalOneOverDirs.Y );
+		const VectorRegister BoxMaxSlabZ	= VectorMultiply( VectorSubtract( BoxMaxZ, Check.LocalStarts.Z ), Check.LocalOneOverDirs.Z );
+
+		// 2: Figure out per component min/ max
+		const VectorRegister SlabMinX		= VectorMin( BoxMinSlabX, BoxMaxSlabX );
+		const VectorRegister SlabMinY		= VectorMin( BoxMinSlabY, BoxMaxSlabY );
+		const VectorRegister SlabMinZ		= VectorMin( BoxMinSlabZ, BoxMaxSlabZ );
+		const VectorRegister SlabMaxX		= VectorMax( BoxMinSlabX, BoxMaxSlabX );
+		const VectorRegister SlabMaxY		= VectorMax( BoxMinSlabY, BoxMaxSlabY );
+		const VectorRegister SlabMaxZ		= VectorMax( BoxMinSlabZ, BoxMaxSlabZ );
+
+		// 3: Figure out global min/ max
+		const VectorRegister SlabMinXY		= VectorMax( SlabMinX , SlabMinY );
+		const VectorRegister MinTime		= VectorMax( SlabMinXY, SlabMinZ );
+		const VectorRegister SlabMaxXY		= VectorMin( SlabMaxX , SlabMaxY );
+		const VectorRegister MaxTime		= VectorMin( SlabMaxXY, SlabMaxZ );
+
+		// 4: Calculate hit time and determine whether there was a hit.
+		HitTime = MinTime;
+		const VectorRegister OutNodeHit		= VectorBitwiseAND( VectorCompareGE( MaxTime, VectorZero() ), VectorCompareGE( MaxTime, MinTime ) );
+		const VectorRegister CloserNodeHit	= VectorBitwiseAND( OutNodeHit, VectorCompareGT( Check.GetHitTimes(), MinTime ) );
+		return VectorMaskBits( CloserNodeHit ) & Check.GetRayMask();
+	}
+
 	/** 
 	 * Determines the line in the FkDOPLineCollisionCheck intersects this node. It
 	 * also will check the child nodes if it is not a leaf, otherwise it will check
@@ -796,6 +847,62 @@ struct TkDOPNode
 		return bHit;
 	}
 
+	/**
+	 * Determines which of the rays of a packet intersect this node. The children of
+	 * the node are visited at most once for the whole packet, with only the rays that
+	 * hit their bounds, and the triangles of a leaf are checked against each of those.
+	 *
+	 * @param Check -- The aggregated packet line check data
+	 * @param RayMask -- The rays of the packet that hit the bounds of this node, one bit per ray
+	 * @return Mask of the rays that intersected a triangle
+	 */
+	int32 LineCheckPacket(TkDOPPacketLineCollisionCheck<COLL_DATA_PROVIDER,KDOP_IDX_TYPE>& Check, int32 RayMask, TTraversalHistory<KDOP_IDX_TYPE> History) const
+	{
+		int32 HitMask = 0;
+		if (bIsLeaf == 0)
+		{
+			SLOW_KDOP_STATS(FPlatformAtomics::InterlockedIncrement((SSIZE_T*)&GKDOPParentNodesTraversed));
+			VectorRegister LeftHitTime;
+			VectorRegister RightHitTime;
+			const int32 LeftRayMask = LineCheckBoundsPacket( Check, 0, LeftHitTime ) & RayMask;
+			const int32 RightRayMask = LineCheckBoundsPacket( Check, 1, RightHitTime ) & RayMask;
+
+			// Visit first the child that the packet enters first
+			const bool bLeftFirst = LeftRayMask != 0 
+				&& (RightRayMask == 0 || Check.GetClosestHitTime(LeftHitTime, LeftRayMask) <= Check.GetClosestHitTime(RightHitTime, RightRayMask));
+			const KDOP_IDX_TYPE FirstNode = bLeftFirst ? n.LeftNode : n.RightNode;
+			const KDOP_IDX_TYPE SecondNode = bLeftFirst ? n.RightNode : n.LeftNode;
+			const int32 FirstRayMask = bLeftFirst ? LeftRayMask : RightRayMask;
+			int32 SecondRayMask = bLeftFirst ? RightRayMask : LeftRayMask;
+			const VectorRegister& SecondHitTime = bLeftFirst ? RightHitTime : LeftHitTime;
+
+			if (FirstRayMask)
+			{
+				HitMask = Check.Nodes[FirstNode].LineCheckPacket(Check, FirstRayMask, History.AddNode(FirstNode));
+				// Only check the second node with the rays that could still have a closer hit in it
+				SecondRayMask &= Check.GetCloserRayMask(SecondHitTime);
+			}
+
+			if (SecondRayMask)
+			{
+				HitMask |= Check.Nodes[SecondNode].LineCheckPacket(Check, SecondRayMask, History.AddNode(SecondNode));
+			}
+		}
+		else
+		{
+			SLOW_KDOP_STATS(FPlatformAtomics::InterlockedIncrement((SSIZE_T*)&GKDOPLeafNodesTraversed));
+			// This is a leaf, check the triangles for a hit with each ray, 4 triangles at a time
+			for (int32 RayIndex = 0; RayIndex < Check.NumRays; RayIndex++)
+			{
+				if ((RayMask & (1 << RayIndex)) && LineCheckTriangles(*Check.Checks[RayIndex], History))
+				{
+					HitMask |= 1 << RayIndex;
+				}
+			}
+		}
+		return HitMask;
+	}
+
 	/**
 	 * Works through the list of triangles in this node checking each one for a
 	 * collision.
@@ -1106,6 +1213,19 @@ struct TkDOPTree
 		return bHit;
 	}
 
+	/**
+	 * Checks all the rays of a packet for the closest hit at once, traversing the
+	 * tree a single time for the whole packet.
+	 *
+	 * @param Check -- The aggregated packet line check data
+	 * @return Mask of the rays that hit a triangle, one bit per ray
+	 */
+	int32 LineCheckPacket(TkDOPPacketLineCollisionCheck<COLL_DATA_PROVIDER,KDOP_IDX_TYPE>& Check) const
+	{
+		TTraversalHistory<KDOP_IDX_TYPE> History;
+		return Nodes[0].LineCheckPacket(Check, Check.GetRayMask(), History.AddNode(0));
+	}
+
 	/**
 	 * Dumps the kDOPTree 
 	 */
@@ -1295,4 +1415,103 @@ template <typename COLL_DATA_PROVIDER, typename KDOP_IDX_TYPE> struct TkDOPLineC
 	}
 };
 
+/**
+ * This struct holds the information used to check a packet of up to KDOP_PACKET_SIZE
+ * coherent lines against the kDOP tree together. Each line keeps its own line check,
+ * which is used to check the triangles and holds the results, the packet adds the
+ * lines transposed so that a node can be checked against all of them at once.
+ * Only closest intersection checks are supported.
+ */
+template <typename COLL_DATA_PROVIDER, typename KDOP_IDX_TYPE> struct TkDOPPacketLineCollisionCheck
+{
+	/** Exposes the line check type to clients. */
+	typedef TkDOPLineCollisionCheck<COLL_DATA_PROVIDER,KDOP_IDX_TYPE> LineCheckType;
+
+	/** The line checks of the packet */
+	LineCheckType* const* Checks;
+	/** Number of lines in the packet */
+	const int32 NumRays;
+	/**
+	 * The array of the nodes for the kDOP tree
+	 */
+	const kDOPArray<typename LineCheckType::NodeType, FRangeChecklessHeapAllocator>& Nodes;
+
+	/** Start of each line, in the channel of the line. */
+	FVector3SOA LocalStarts;
+	/** One over the direction of each line, in the channel of the line. */
+	FVector3SOA LocalOneOverDirs;
+
+	/**
+	 * Sets up the packet from the line checks of its lines, which must all be against the same kDOP tree.
+	 *
+	 * @param InChecks -- The line checks of the lines
+	 * @param InNumRays -- Number of lines, up to KDOP_PACKET_SIZE
+	 */
+	TkDOPPacketLineCollisionCheck(LineCheckType* const* InChecks, int32 InNumRays) :
+		Checks(InChecks),
+		NumRays(InNumRays),
+		Nodes(InChecks[0]->Nodes)
+	{
+		checkSlow(NumRays > 0 && NumRays <= KDOP_PACKET_SIZE);
+
+		MS_ALIGN(16) float Transposed[6][KDOP_PACKET_SIZE] GCC_ALIGN(16);
+		for (int32 RayIndex = 0; RayIndex < KDOP_PACKET_SIZE; RayIndex++)
+		{
+			// Unused channels repeat the last line, they are masked out of the results
+			const LineCheckType& Check = *Checks[FMath::Min(RayIndex, NumRays - 1)];
+			checkSlow(Check.bFindClosestIntersection && &Check.Nodes == &Nodes);
+			Transposed[0][RayIndex] = Check.LocalStart.X;
+			Transposed[1][RayIndex] = Check.LocalStart.Y;
+			Transposed[2][RayIndex] = Check.LocalStart.Z;
+			Transposed[3][RayIndex] = Check.LocalOneOverDir.X;
+			Transposed[4][RayIndex] = Check.LocalOneOverDir.Y;
+			Transposed[5][RayIndex] = Check.LocalOneOverDir.Z;
+		}
+
+		LocalStarts.X = VectorLoadAligned( Transposed[0] );
+		LocalStarts.Y = VectorLoadAligned( Transposed[1] );
+		LocalStarts.Z = VectorLoadAligned( Transposed[2] );
+		LocalOneOverDirs.X = VectorLoadAligned( Transposed[3] );
+		LocalOneOverDirs.Y = VectorLoadAligned( Transposed[4] );
+		LocalOneOverDirs.Z = VectorLoadAligned( Transposed[5] );
+	}
+
+	/** Mask of all the lines of the packet, one bit per line. */
+	FORCEINLINE int32 GetRayMask() const
+	{
+		return (1 << NumRays) - 1;
+	}
+
+	/** Current hit time of each line, in the channel of the line. */
+	FORCEINLINE VectorRegister GetHitTimes() const
+	{
+		MS_ALIGN(16) float HitTimes[KDOP_PACKET_SIZE] GCC_ALIGN(16);
+		for (int32 RayIndex = 0; RayIndex < KDOP_PACKET_SIZE; RayIndex++)
+		{
+			HitTimes[RayIndex] = Checks[FMath::Min(RayIndex, NumRays - 1)]->Result->Time;
+		}
+		return VectorLoadAligned( HitTimes );
+	}
+
+	/** Mask of the lines whose current hit is further than the passed in times. */
+	FORCEINLINE int32 GetCloserRayMask(const VectorRegister& HitTimes) const
+	{
+		return VectorMaskBits( VectorCompareGT( GetHitTimes(), HitTimes ) ) & GetRayMask();
+	}
+
+	/** Smallest of the passed in times of the lines in RayMask. */
+	FORCEINLINE float GetClosestHitTime(const VectorRegister& HitTimes, int32 RayMask) const
+	{
+		float ClosestHitTime = MAX_FLT;
+		for (int32 RayIndex = 0; RayIndex < NumRays; RayIndex++)
+		{
+			if (RayMask & (1 << RayIndex))
+			{
+				ClosestHitTime = FMath::Min(ClosestHitTime, VectorGetComponent(HitTimes, RayIndex));
+			}
+		}
+		return ClosestHitTime;
+	}
+};
+
 } // namespace
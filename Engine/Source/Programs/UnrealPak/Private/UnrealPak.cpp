@@ -9,6 +9,7 @@
 #include "KeyGenerator.h"
 #include "AES.h"
 #include "UniquePtr.h"
+#include "ParallelFor.h"
 
 IMPLEMENT_APPLICATION(UnrealPak, "UnrealPak");
 
@@ -17,10 +18,13 @@ struct FPakCommandLineParameters
 	FPakCommandLineParameters()
 		: CompressionBlockSize(64*1024)
 		, FileSystemBlockSize(0)
+		, CompressionFormat(COMPRESS_Default)
 	{}
 
 	int32  CompressionBlockSize;
 	int64  FileSystemBlockSize;
+	/** Format of the files that need compression, e.g. LZ4 for the paks that have to load fast */
+	ECompressionFlags CompressionFormat;
 };
 
 struct FPakEntryPair
@@ -29,6 +33,17 @@ struct FPakEntryPair
 	FPakEntry Info;
 };
 
+struct FPakPathHashPair
+{
+	uint64 Hash;
+	int32 EntryIndex;
+
+	FORCEINLINE bool operator<(const FPakPathHashPair& Other) const
+	{
+		return Hash < Other.Hash;
+	}
+};
+
 struct FPakInputPair
 {
 	FString Source;
@@ -185,31 +200,44 @@ bool FCompressedFileBuffer::CompressFileToWorkingBuffer(const FPakInputPair& InF
 	// Load to buffer
 	FileHandle->Serialize(InOutPersistentBuffer,FileSize);
 
-	// Build buffers for working
-	int64 UncompressedSize = FileSize;
+	// Build buffers for working, each block gets its own slot so that they can be compressed in parallel
+	const int32 NumBlocks = CompressedBlocks.Num();
 	int32 CompressionBufferSize = Align(FCompression::CompressMemoryBound(CompressionMethod,CompressionBlockSize),FAES::AESBlockSize);
-	EnsureBufferSpace(Align(FCompression::CompressMemoryBound(CompressionMethod,FileSize),FAES::AESBlockSize));
-
+	EnsureBufferSpace((int64)CompressionBufferSize * NumBlocks);
 
-	TotalCompressedSize = 0;
-	int64 UncompressedBytes = 0;
-	int32 CurrentBlock = 0;
-	while(UncompressedSize)
+	TArray<int32> CompressedBlockSizes;
+	CompressedBlockSizes.AddZeroed(NumBlocks);
+	FThreadSafeCounter NumFailedBlocks;
+	uint8* UncompressedBuffer = InOutPersistentBuffer;
+	ParallelFor(NumBlocks, [&](int32 BlockIndex)
 	{
-		int32 BlockSize = (int32)FMath::Min<int64>(UncompressedSize,CompressionBlockSize);
+		const int64 UncompressedBytes = (int64)BlockIndex * CompressionBlockSize;
+		const int32 BlockSize = (int32)FMath::Min<int64>(FileSize - UncompressedBytes, CompressionBlockSize);
 		int32 CompressedBlockSize = CompressionBufferSize;
-		FileCompressionBlockSize = FMath::Max<uint32>(BlockSize, FileCompressionBlockSize);
-		EnsureBufferSpace(TotalCompressedSize+CompressedBlockSize);
-		if(!FCompression::CompressMemory(CompressionMethod,CompressedBuffer.Get()+TotalCompressedSize,CompressedBlockSize,InOutPersistentBuffer+UncompressedBytes,BlockSize))
+		if (FCompression::CompressMemory(CompressionMethod, CompressedBuffer.Get() + (int64)BlockIndex * CompressionBufferSize, CompressedBlockSize, UncompressedBuffer + UncompressedBytes, BlockSize))
 		{
-			return false;
+			CompressedBlockSizes[BlockIndex] = CompressedBlockSize;
+		}
+		else
+		{
+			NumFailedBlocks.Increment();
 		}
-		UncompressedSize -= BlockSize;
-		UncompressedBytes += BlockSize;
+	});
+	if (NumFailedBlocks.GetValue() > 0)
+	{
+		return false;
+	}
+
+	// Pack the blocks in order. Blocks only ever move towards the start of the buffer, so the output doesn't depend on the threads
+	TotalCompressedSize = 0;
+	FileCompressionBlockSize = (int32)FMath::Min<int64>(FileSize, CompressionBlockSize);
+	for (int32 CurrentBlock = 0; CurrentBlock < NumBlocks; ++CurrentBlock)
+	{
+		const int32 CompressedBlockSize = CompressedBlockSizes[CurrentBlock];
+		FMemory::Memmove(CompressedBuffer.Get()+TotalCompressedSize, CompressedBuffer.Get()+(int64)CurrentBlock*CompressionBufferSize, CompressedBlockSize);
 
 		CompressedBlocks[CurrentBlock].CompressedStart = TotalCompressedSize;
 		CompressedBlocks[CurrentBlock].CompressedEnd = TotalCompressedSize+CompressedBlockSize;
-		++CurrentBlock;
 
 		TotalCompressedSize += CompressedBlockSize;
 
@@ -406,6 +434,31 @@ void ProcessCommandLine(int32 ArgC, TCHAR* ArgV[], TArray<FPakInputPair>& Entrie
 		CmdLineParameters.FileSystemBlockSize = 0;
 	}
 
+	FString CompressBlockSizeString;
+	int32 CompressBlockSize = 0;
+	if (FParse::Value(FCommandLine::Get(), TEXT("-compressionblocksize="), CompressBlockSizeString) &&
+		FParse::Value(FCommandLine::Get(), TEXT("-compressionblocksize="), CompressBlockSize))
+	{
+		if (CompressBlockSizeString.EndsWith(TEXT("MB")))
+		{
+			CompressBlockSize *= 1024*1024;
+		}
+		else if (CompressBlockSizeString.EndsWith(TEXT("KB")))
+		{
+			CompressBlockSize *= 1024;
+		}
+		if (CompressBlockSize > 0)
+		{
+			CmdLineParameters.CompressionBlockSize = CompressBlockSize;
+		}
+	}
+
+	FString CompressionFormatString;
+	if (FParse::Value(FCommandLine::Get(), TEXT("-compressionformat="), CompressionFormatString))
+	{
+		CmdLineParameters.CompressionFormat = FCompression::GetCompressionFlagsFromName(CompressionFormatString, COMPRESS_Default);
+	}
+
 	if (FParse::Value(FCommandLine::Get(), TEXT("-create="), ResponseFile))
 	{
 		bool bCompress = false;
@@ -761,7 +814,7 @@ bool CreatePakFile(const TCHAR* Filename, TArray<FPakInputPair>& FilesToAdd, con
 		//check if this file requested to be compression
 		int64 OriginalFileSize = IFileManager::Get().FileSize(*FilesToAdd[FileIndex].Source);
 		int64 RealFileSize = OriginalFileSize + NewEntry.Info.GetSerializedSize(FPakInfo::PakFile_Version_Latest);
-		CompressionMethod = (FilesToAdd[FileIndex].bNeedsCompression && OriginalFileSize > 0) ? COMPRESS_Default : COMPRESS_None;
+		CompressionMethod = (FilesToAdd[FileIndex].bNeedsCompression && OriginalFileSize > 0) ? CmdLineParameters.CompressionFormat : COMPRESS_None;
 
 		if (CompressionMethod != COMPRESS_None)
 		{
@@ -821,6 +874,26 @@ bool CreatePakFile(const TCHAR* Filename, TArray<FPakInputPair>& FilesToAdd, con
 	// Remember IndexOffset
 	Info.IndexOffset = PakFileHandle->Tell();
 
+	// Hash all paths so that files can be looked up at runtime without building the directory index
+	TArray<FPakPathHashPair> PathHashes;
+	PathHashes.AddUninitialized(Index.Num());
+	for (int32 EntryIndex = 0; EntryIndex < Index.Num(); EntryIndex++)
+	{
+		PathHashes[EntryIndex].Hash = FPakFile::HashPath(*Index[EntryIndex].Filename);
+		PathHashes[EntryIndex].EntryIndex = EntryIndex;
+	}
+	PathHashes.Sort();
+	for (int32 HashIndex = 1; HashIndex < PathHashes.Num(); HashIndex++)
+	{
+		if (PathHashes[HashIndex].Hash == PathHashes[HashIndex - 1].Hash)
+		{
+			UE_LOG(LogPakFile, Warning, TEXT("Path hash collision between \"%s\" and \"%s\", saving the index without path hashes."), 
+				*Index[PathHashes[HashIndex - 1].EntryIndex].Filename, *Index[PathHashes[HashIndex].EntryIndex].Filename);
+			Info.Version = FPakInfo::PakFile_Version_CompressionEncryption;
+			break;
+		}
+	}
+
 	// Serialize Pak Index at the end of Pak File
 	TArray<uint8> IndexData;
 	FMemoryWriter IndexWriter(IndexData);
@@ -828,11 +901,31 @@ bool CreatePakFile(const TCHAR* Filename, TArray<FPakInputPair>& FilesToAdd, con
 	int32 NumEntries = Index.Num();
 	IndexWriter << MountPoint;
 	IndexWriter << NumEntries;
-	for (int32 EntryIndex = 0; EntryIndex < Index.Num(); EntryIndex++)
+	if (Info.Version >= FPakInfo::PakFile_Version_PathHashIndex)
+	{
+		// Sorted hashes, packed entries and then the filenames, which are only loaded for directory iteration
+		for (int32 HashIndex = 0; HashIndex < PathHashes.Num(); HashIndex++)
+		{
+			IndexWriter << PathHashes[HashIndex].Hash;
+			IndexWriter << PathHashes[HashIndex].EntryIndex;
+		}
+		for (int32 EntryIndex = 0; EntryIndex < Index.Num(); EntryIndex++)
+		{
+			Index[EntryIndex].Info.Serialize(IndexWriter, Info.Version);
+		}
+		for (int32 EntryIndex = 0; EntryIndex < Index.Num(); EntryIndex++)
+		{
+			IndexWriter << Index[EntryIndex].Filename;
+		}
+	}
+	else
 	{
-		FPakEntryPair& Entry = Index[EntryIndex];
-		IndexWriter << Entry.Filename;
-		Entry.Info.Serialize(IndexWriter, Info.Version);
+		for (int32 EntryIndex = 0; EntryIndex < Index.Num(); EntryIndex++)
+		{
+			FPakEntryPair& Entry = Index[EntryIndex];
+			IndexWriter << Entry.Filename;
+			Entry.Info.Serialize(IndexWriter, Info.Version);
+		}
 	}
 	PakFileHandle->Serialize(IndexData.GetData(), IndexData.Num());
 
@@ -283,6 +283,35 @@ struct FBehaviorTreeInstance
 	FBehaviorTreeInstance(int32 MemorySize) { InstanceMemory.AddZeroed(MemorySize); IncMemoryStats(); }
 	~FBehaviorTreeInstance() { DecMemoryStats(); }
 
+	FBehaviorTreeInstance& operator=(const FBehaviorTreeInstance& Other)
+	{
+		RootNode = Other.RootNode;
+		ActiveNode = Other.ActiveNode;
+		ActiveAuxNodes = Other.ActiveAuxNodes;
+		ParallelTasks = Other.ParallelTasks;
+		InstanceMemory = Other.InstanceMemory;
+		InstanceIdIndex = Other.InstanceIdIndex;
+		ActiveNodeType = Other.ActiveNodeType;
+		return *this;
+	}
+
+#if PLATFORM_COMPILER_HAS_RVALUE_REFERENCES
+	/** takes over arrays of other instance, pushing new subtree on instance stack doesn't need to copy its memory block */
+	FBehaviorTreeInstance(FBehaviorTreeInstance&& Other)
+	{
+		Other.DecMemoryStats();
+		RootNode = Other.RootNode;
+		ActiveNode = Other.ActiveNode;
+		ActiveAuxNodes = MoveTemp(Other.ActiveAuxNodes);
+		ParallelTasks = MoveTemp(Other.ParallelTasks);
+		InstanceMemory = MoveTemp(Other.InstanceMemory);
+		InstanceIdIndex = Other.InstanceIdIndex;
+		ActiveNodeType = Other.ActiveNodeType;
+		Other.IncMemoryStats();
+		IncMemoryStats();
+	}
+#endif
+
 #if STATS
 	FORCEINLINE void IncMemoryStats() { INC_MEMORY_STAT_BY(STAT_AI_BehaviorTree_InstanceMemory, GetAllocatedSize()); }
 	FORCEINLINE void DecMemoryStats() { DEC_MEMORY_STAT_BY(STAT_AI_BehaviorTree_InstanceMemory, GetAllocatedSize()); }
@@ -33,6 +33,44 @@ namespace EBlackboardDescription
 	};
 }
 
+/** 
+ *  Key of known type, resolved once against blackboard asset. Values accessed with it skip
+ *  key name lookup and key type check, e.g.:
+ *
+ *  TBlackboardKey<UBlackboardKeyType_Vector> TargetLocationKey;
+ *  TargetLocationKey.Resolve(*BlackboardComp->GetBlackboardAsset(), TEXT("TargetLocation"));
+ *  const FVector TargetLocation = BlackboardComp->GetValue(TargetLocationKey);
+ *
+ *  Handle is valid for all blackboard components using the asset it was resolved with.
+ */
+template<class TDataClass>
+struct TBlackboardKey
+{
+	TBlackboardKey() : KeyID(FBlackboard::InvalidKey) {}
+
+	/** find key by name, handle will be invalid if it doesn't exist or holds different type */
+	void Resolve(const UBlackboardData& BlackboardAsset, const FName& KeyName)
+	{
+		KeyID = BlackboardAsset.GetKeyID(KeyName);
+		if (BlackboardAsset.GetKeyType(KeyID) != TDataClass::StaticClass())
+		{
+			KeyID = FBlackboard::InvalidKey;
+		}
+	}
+
+	/** use key of selector, it has to be cached for the same asset already */
+	void Resolve(const FBlackboardKeySelector& KeySelector)
+	{
+		KeyID = (KeySelector.SelectedKeyType == TDataClass::StaticClass()) ? KeySelector.GetSelectedKeyID() : FBlackboard::InvalidKey;
+	}
+
+	FORCEINLINE bool IsValid() const { return KeyID != FBlackboard::InvalidKey; }
+	FORCEINLINE FBlackboard::FKey GetKeyID() const { return KeyID; }
+
+private:
+	FBlackboard::FKey KeyID;
+};
+
 UCLASS()
 class AIMODULE_API UBlackboardComponent : public UActorComponent
 {
@@ -83,6 +121,9 @@ public:
 	/** resume change notifies and process queued list */
 	void ResumeUpdates();
 
+	/** @return true if change notifies are paused */
+	FORCEINLINE bool AreUpdatesPaused() const { return !!bPausedNotifies; }
+
 	/** @return associated behavior tree component */
 	UBrainComponent* GetBrainComponent() const;
 
@@ -189,6 +230,13 @@ public:
 	template<class TDataClass>
 	typename TDataClass::FDataType GetValue(FBlackboard::FKey KeyID) const;
 
+	/** typed key access, see TBlackboardKey */
+	template<class TDataClass>
+	bool SetValue(const TBlackboardKey<TDataClass>& Key, typename TDataClass::FDataType Value);
+
+	template<class TDataClass>
+	FORCEINLINE typename TDataClass::FDataType GetValue(const TBlackboardKey<TDataClass>& Key) const { return GetValue<TDataClass>(Key.GetKeyID()); }
+
 	/** get pointer to raw data for given key */
 	FORCEINLINE uint8* GetKeyRawData(const FName& KeyName) { return GetKeyRawData(GetKeyID(KeyName)); }
 	FORCEINLINE uint8* GetKeyRawData(FBlackboard::FKey KeyID) { return ValueMemory.Num() && ValueOffsets.IsValidIndex(KeyID) ? (ValueMemory.GetData() + ValueOffsets[KeyID]) : NULL; }
@@ -303,6 +351,10 @@ protected:
 	void PopulateSynchronizedKeys();
 
 	bool ShouldSyncWithBlackboard(UBlackboardComponent& OtherBlackboardComponent) const;
+
+	/** sets value of key already known to be of TDataClass type */
+	template<class TDataClass>
+	bool SetValueInternal(FBlackboard::FKey KeyID, typename TDataClass::FDataType Value);
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -328,6 +380,18 @@ bool UBlackboardComponent::SetValue(FBlackboard::FKey KeyID, typename TDataClass
 		return false;
 	}
 
+	return SetValueInternal<TDataClass>(KeyID, Value);
+}
+
+template<class TDataClass>
+bool UBlackboardComponent::SetValue(const TBlackboardKey<TDataClass>& Key, typename TDataClass::FDataType Value)
+{
+	return Key.IsValid() && SetValueInternal<TDataClass>(Key.GetKeyID(), Value);
+}
+
+template<class TDataClass>
+bool UBlackboardComponent::SetValueInternal(FBlackboard::FKey KeyID, typename TDataClass::FDataType Value)
+{
 	uint8* RawData = GetKeyRawData(KeyID);
 	if (RawData)
 	{
@@ -158,6 +158,10 @@ public:
 		return GetItemActor(QueryInstance, *Iterator);
 	}
 
+	/** helper: get next valid items iterator will visit, starting with current one. Tests doing thread safe work 
+	 *  for each item (traces, path finding) can compute it for whole batch in parallel, and then score items on iterator */
+	void GetItemBatch(FEnvQueryInstance& QueryInstance, const FEnvQueryInstance::ItemIterator& Iterator, TArray<int32>& OutItemIndices) const;
+
 	/** normalize scores in range */
 	void NormalizeItemScores(FEnvQueryInstance& QueryInstance);
 
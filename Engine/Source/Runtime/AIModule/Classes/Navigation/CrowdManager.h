@@ -267,6 +267,10 @@ protected:
 	UPROPERTY(config, EditAnywhere, Category = Config)
 	float PathOptimizationInterval;
 
+	/** min number of agents in each batch when steering and avoidance are split across task graph workers, 0 keeps them on game thread */
+	UPROPERTY(config, EditAnywhere, Category = Config, meta=(ClampMin = "0"))
+	int32 ParallelStepMinAgents;
+
 	uint32 bPruneStartedOffmeshConnections : 1;
 	uint32 bSingleAreaVisibilityOptimization : 1;
 
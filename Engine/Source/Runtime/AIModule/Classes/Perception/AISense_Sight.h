@@ -69,20 +69,23 @@ struct FAISightQuery
 	FPerceptionListenerID ObserverId;
 	FAISightTarget::FTargetId TargetId;
 
-	float Age;
+	/** sense update the query was last processed on (or created on). Queries gain one point of score for every update they wait */
+	int32 LastProcessedUpdate;
 	float Score;
 	float Importance;
 
 	uint32 bLastResult : 1;
 
 	FAISightQuery(FPerceptionListenerID ListenerId = FPerceptionListenerID::InvalidID(), FAISightTarget::FTargetId Target = FAISightTarget::InvalidTargetId)
-		: ObserverId(ListenerId), TargetId(Target), Age(0), Score(0), Importance(0), bLastResult(false)
+		: ObserverId(ListenerId), TargetId(Target), LastProcessedUpdate(0), Score(0), Importance(0), bLastResult(false)
 	{
 	}
 
+	/** score is Importance + number of updates since last processed, minus current update which is the same for all queries.
+	 *	This way score of a waiting query doesn't change and the queue stays sorted between updates */
 	void RecalcScore()
 	{
-		Score = Age + Importance;
+		Score = Importance - LastProcessedUpdate;
 	}
 
 	class FSortPredicate
@@ -126,6 +129,11 @@ protected:
 	UPROPERTY(config)
 	int32 MaxTracesPerTick;
 
+	/** queries that don't need a trace (target out of sight range or cone) are cheap, but not free. 
+	 *	This caps the queries processed each update (0 means no limit), the rest waits for its turn */
+	UPROPERTY(config)
+	int32 MaxQueriesPerTick;
+
 	UPROPERTY(config)
 	float HighImportanceQueryDistanceThreshold;
 
@@ -137,6 +145,16 @@ protected:
 	UPROPERTY(config)
 	float SightLimitQueryImportance;
 
+	/** importance added to queries of targets the listener currently sees, so they get updated (and lost) first */
+	UPROPERTY(config)
+	float SeenTargetQueryImportanceBonus;
+
+	/** number of the current update, see FAISightQuery::LastProcessedUpdate */
+	int32 QueryUpdateCounter;
+
+	/** helper for Update, reused to avoid allocations */
+	TArray<FAISightQuery> ProcessedQueries;
+
 public:
 
 	virtual void PostInitProperties() override;
@@ -167,6 +185,9 @@ protected:
 
 	FORCEINLINE void SortQueries() { SightQueryQueue.Sort(FAISightQuery::FSortPredicate()); }
 
+	/** puts queries processed by Update back in the queue, in order, and removes invalid ones. Rest of the queue is still sorted so they only need to be merged in */
+	void MergeProcessedQueries(int32 NumProcessedQueries, const TArray<int32>& InvalidQueries);
+
 	float CalcQueryImportance(const FPerceptionListener& Listener, const FVector& TargetLocation, const float SightRadiusSq) const;
 
 public:
@@ -822,6 +822,14 @@ void UBehaviorTreeComponent::TickComponent(float DeltaTime, enum ELevelTick Tick
 		return;
 	}
 
+	// batch blackboard change notifies: observers are called once per changed key, after all nodes ticked.
+	// Execution requests made by them are processed on next tick anyway
+	const bool bBatchBlackboardNotifies = BlackboardComp && !BlackboardComp->AreUpdatesPaused();
+	if (bBatchBlackboardNotifies)
+	{
+		BlackboardComp->PauseUpdates();
+	}
+
 	// tick active auxiliary nodes and parallel tasks (in execution order, before task)
 	for (int32 InstanceIndex = 0; InstanceIndex < InstanceStack.Num(); InstanceIndex++)
 	{
@@ -850,6 +858,12 @@ void UBehaviorTreeComponent::TickComponent(float DeltaTime, enum ELevelTick Tick
 		uint8* NodeMemory = ActiveTask->GetNodeMemory<uint8>(ActiveInstance);
 		ActiveTask->WrappedTickTask(*this, NodeMemory, DeltaTime);
 	}
+
+	// don't resume if logic got paused while ticking, notifies are waiting for ResumeLogic then
+	if (bBatchBlackboardNotifies && !bIsPaused && BlackboardComp->AreUpdatesPaused())
+	{
+		BlackboardComp->ResumeUpdates();
+	}
 }
 
 void UBehaviorTreeComponent::ProcessExecutionRequest()
@@ -1393,7 +1407,7 @@ bool UBehaviorTreeComponent::PushInstance(UBehaviorTree& TreeAsset)
 		NewInstance.InjectNodes(*this, *RootNode, NodeInstanceIndex);
 
 		INC_DWORD_STAT(STAT_AI_BehaviorTree_NumInstances);
-		InstanceStack.Push(NewInstance);
+		InstanceStack.Push(MoveTemp(NewInstance));
 		ActiveInstanceIdx = InstanceStack.Num() - 1;
 
 		// start root level services now (they won't be removed on looping tree anyway)
@@ -335,7 +335,8 @@ void UBlackboardComponent::ResumeUpdates()
 		NotifyObservers(QueuedUpdates[UpdateIndex]);
 	}
 
-	QueuedUpdates.Empty();
+	// keep allocation, behavior tree pauses updates every tick
+	QueuedUpdates.Reset();
 }
 
 void UBlackboardComponent::NotifyObservers(FBlackboard::FKey KeyID) const
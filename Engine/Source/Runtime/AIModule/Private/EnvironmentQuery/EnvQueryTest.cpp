@@ -182,6 +182,24 @@ AActor* UEnvQueryTest::GetItemActor(FEnvQueryInstance& QueryInstance, int32 Item
 		NULL;
 }
 
+void UEnvQueryTest::GetItemBatch(FEnvQueryInstance& QueryInstance, const FEnvQueryInstance::ItemIterator& Iterator, TArray<int32>& OutItemIndices) const
+{
+	OutItemIndices.Reset();
+
+	// single item searches stop on first item passing the test, don't waste time on the rest.
+	// Otherwise take a few items per worker, time limit is checked only between batches
+	const int32 NumWorkers = FTaskGraphInterface::IsRunning() ? FTaskGraphInterface::Get().GetNumWorkerThreads() : 0;
+	const int32 BatchSize = QueryInstance.CanBatchTest() ? (NumWorkers + 1) * 4 : 1;
+
+	for (int32 ItemIndex = *Iterator; ItemIndex < QueryInstance.Items.Num() && OutItemIndices.Num() < BatchSize; ItemIndex++)
+	{
+		if (QueryInstance.Items[ItemIndex].IsValid())
+		{
+			OutItemIndices.Add(ItemIndex);
+		}
+	}
+}
+
 FString UEnvQueryTest::GetDescriptionTitle() const
 {
 	return UEnvQueryTypes::GetShortTypeName(this).ToString();
@@ -1,6 +1,7 @@
 // Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
 
 #include "AIModulePrivate.h"
+#include "ParallelFor.h"
 #include "AI/Navigation/NavigationSystem.h"
 #include "AI/Navigation/NavAgentInterface.h"
 #include "EnvironmentQuery/Contexts/EnvQueryContext_Querier.h"
@@ -61,6 +62,13 @@ void UEnvQueryTest_Pathfinding::RunTest(FEnvQueryInstance& QueryInstance) const
 
 	EPathFindingMode::Type PFMode(bHierarchical ? EPathFindingMode::Hierarchical : EPathFindingMode::Regular);
 
+	// path finding queries are thread safe, items are processed in batches with paths of each batch found in parallel
+	const UObject* PathOwner = QueryInstance.Owner.Get();
+	const int32 NumContexts = ContextLocations.Num();
+	TArray<int32> BatchItems;
+	TArray<FVector> BatchItemLocations;
+
+	NavData->BeginBatchQuery();
 	if (GetWorkOnFloatValues())
 	{
 		FFindPathSignature FindPathFunc;
@@ -68,52 +76,69 @@ void UEnvQueryTest_Pathfinding::RunTest(FEnvQueryInstance& QueryInstance) const
 			(bPathToItem ? &UEnvQueryTest_Pathfinding::FindPathLengthTo : &UEnvQueryTest_Pathfinding::FindPathLengthFrom) :
 			(bPathToItem ? &UEnvQueryTest_Pathfinding::FindPathCostTo : &UEnvQueryTest_Pathfinding::FindPathCostFrom) );
 
-		NavData->BeginBatchQuery();
-		for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
+		TArray<float> BatchPathValues;
+		for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It;)
 		{
-			const FVector ItemLocation = GetItemLocation(QueryInstance, *It);
-			for (int32 ContextIndex = 0; ContextIndex < ContextLocations.Num(); ContextIndex++)
+			GetItemBatch(QueryInstance, It, BatchItems);
+			BatchItemLocations.Reset(BatchItems.Num());
+			for (int32 BatchIndex = 0; BatchIndex < BatchItems.Num(); BatchIndex++)
+			{
+				BatchItemLocations.Add(GetItemLocation(QueryInstance, BatchItems[BatchIndex]));
+			}
+
+			BatchPathValues.SetNumUninitialized(BatchItems.Num() * NumContexts);
+			ParallelFor(BatchPathValues.Num(), [&](int32 Index)
 			{
-				const float PathValue = FindPathFunc.Execute(ItemLocation, ContextLocations[ContextIndex], PFMode, NavData, NavSys, QueryInstance.Owner.Get());
-				It.SetScore(TestPurpose, FilterType, PathValue, MinThresholdValue, MaxThresholdValue);
+				BatchPathValues[Index] = FindPathFunc.Execute(BatchItemLocations[Index / NumContexts], ContextLocations[Index % NumContexts], PFMode, NavData, NavSys, PathOwner);
+			});
 
-				if (bDiscardFailed && PathValue >= BIG_NUMBER)
+			for (int32 BatchIndex = 0; BatchIndex < BatchItems.Num() && It; BatchIndex++, ++It)
+			{
+				for (int32 ContextIndex = 0; ContextIndex < NumContexts; ContextIndex++)
 				{
-					It.DiscardItem();
+					const float PathValue = BatchPathValues[BatchIndex * NumContexts + ContextIndex];
+					It.SetScore(TestPurpose, FilterType, PathValue, MinThresholdValue, MaxThresholdValue);
+
+					if (bDiscardFailed && PathValue >= BIG_NUMBER)
+					{
+						It.DiscardItem();
+					}
 				}
 			}
 		}
-		NavData->FinishBatchQuery();
 	}
 	else
 	{
-		NavData->BeginBatchQuery();
-		if (bPathToItem)
+		TArray<bool> BatchPathExists;
+		for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It;)
 		{
-			for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
+			GetItemBatch(QueryInstance, It, BatchItems);
+			BatchItemLocations.Reset(BatchItems.Num());
+			for (int32 BatchIndex = 0; BatchIndex < BatchItems.Num(); BatchIndex++)
 			{
-				const FVector ItemLocation = GetItemLocation(QueryInstance, *It);
-				for (int32 ContextIndex = 0; ContextIndex < ContextLocations.Num(); ContextIndex++)
-				{
-					const bool bFoundPath = TestPathTo(ItemLocation, ContextLocations[ContextIndex], PFMode, NavData, NavSys, QueryInstance.Owner.Get());
-					It.SetScore(TestPurpose, FilterType, bFoundPath, bWantsPath);
-				}
+				BatchItemLocations.Add(GetItemLocation(QueryInstance, BatchItems[BatchIndex]));
 			}
-		}
-		else
-		{
-			for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
+
+			BatchPathExists.SetNumUninitialized(BatchItems.Num() * NumContexts);
+			ParallelFor(BatchPathExists.Num(), [&](int32 Index)
+			{
+				const FVector& ItemLocation = BatchItemLocations[Index / NumContexts];
+				const FVector& ContextLocation = ContextLocations[Index % NumContexts];
+				BatchPathExists[Index] = bPathToItem ?
+					TestPathTo(ItemLocation, ContextLocation, PFMode, NavData, NavSys, PathOwner) :
+					TestPathFrom(ItemLocation, ContextLocation, PFMode, NavData, NavSys, PathOwner);
+			});
+
+			for (int32 BatchIndex = 0; BatchIndex < BatchItems.Num() && It; BatchIndex++, ++It)
 			{
-				const FVector ItemLocation = GetItemLocation(QueryInstance, *It);
-				for (int32 ContextIndex = 0; ContextIndex < ContextLocations.Num(); ContextIndex++)
+				for (int32 ContextIndex = 0; ContextIndex < NumContexts; ContextIndex++)
 				{
-					const bool bFoundPath = TestPathFrom(ItemLocation, ContextLocations[ContextIndex], PFMode, NavData, NavSys, QueryInstance.Owner.Get());
-					It.SetScore(TestPurpose, FilterType, bFoundPath, bWantsPath);
+					It.SetScore(TestPurpose, FilterType, BatchPathExists[BatchIndex * NumContexts + ContextIndex], bWantsPath);
 				}
 			}
 		}
-		NavData->FinishBatchQuery();
 	}
+	NavData->FinishBatchQuery();
 }
 
 FString UEnvQueryTest_Pathfinding::GetDescriptionTitle() const
@@ -1,6 +1,7 @@
 // Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
 
 #include "AIModulePrivate.h"
+#include "ParallelFor.h"
 #include "EnvironmentQuery/Contexts/EnvQueryContext_Querier.h"
 #include "EnvironmentQuery/Items/EnvQueryItemType_VectorBase.h"
 #include "EnvironmentQuery/Tests/EnvQueryTest_Trace.h"
@@ -75,15 +76,37 @@ void UEnvQueryTest_Trace::RunTest(FEnvQueryInstance& QueryInstance) const
 		ContextLocations[ContextIndex].Z += ContextZ;
 	}
 
-	for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
+	// scene queries are thread safe, items are processed in batches with traces of each batch run in parallel
+	const int32 NumContexts = ContextLocations.Num();
+	TArray<int32> BatchItems;
+	TArray<FVector> BatchItemLocations;
+	TArray<AActor*> BatchItemActors;
+	TArray<bool> BatchHits;
+
+	for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It;)
 	{
-		const FVector ItemLocation = GetItemLocation(QueryInstance, *It) + FVector(0,0,ItemZ);
-		AActor* ItemActor = GetItemActor(QueryInstance, *It);
+		GetItemBatch(QueryInstance, It, BatchItems);
+		BatchItemLocations.Reset(BatchItems.Num());
+		BatchItemActors.Reset(BatchItems.Num());
+		for (int32 BatchIndex = 0; BatchIndex < BatchItems.Num(); BatchIndex++)
+		{
+			BatchItemLocations.Add(GetItemLocation(QueryInstance, BatchItems[BatchIndex]) + FVector(0,0,ItemZ));
+			BatchItemActors.Add(GetItemActor(QueryInstance, BatchItems[BatchIndex]));
+		}
+
+		BatchHits.SetNumUninitialized(BatchItems.Num() * NumContexts);
+		ParallelFor(BatchHits.Num(), [&](int32 Index)
+		{
+			const int32 BatchIndex = Index / NumContexts;
+			BatchHits[Index] = TraceFunc.Execute(BatchItemLocations[BatchIndex], ContextLocations[Index % NumContexts], BatchItemActors[BatchIndex], QueryInstance.World, TraceCollisionChannel, TraceParams, TraceExtent);
+		});
 
-		for (int32 ContextIndex = 0; ContextIndex < ContextLocations.Num(); ContextIndex++)
+		for (int32 BatchIndex = 0; BatchIndex < BatchItems.Num() && It; BatchIndex++, ++It)
 		{
-			const bool bHit = TraceFunc.Execute(ItemLocation, ContextLocations[ContextIndex], ItemActor, QueryInstance.World, TraceCollisionChannel, TraceParams, TraceExtent);
-			It.SetScore(TestPurpose, FilterType, bHit, bWantsHit);
+			for (int32 ContextIndex = 0; ContextIndex < NumContexts; ContextIndex++)
+			{
+				It.SetScore(TestPurpose, FilterType, BatchHits[BatchIndex * NumContexts + ContextIndex], bWantsHit);
+			}
 		}
 	}
 }
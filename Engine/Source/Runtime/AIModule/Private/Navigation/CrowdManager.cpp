@@ -14,6 +14,7 @@
 #include "Navigation/CrowdAgentInterface.h"
 
 #include "DrawDebugHelpers.h"
+#include "ParallelFor.h"
 
 DECLARE_STATS_GROUP(TEXT("Crowd"), STATGROUP_AICrowd, STATCAT_Advanced);
 
@@ -134,6 +135,7 @@ UCrowdManager::UCrowdManager(const FObjectInitializer& ObjectInitializer) : Supe
 	MaxAvoidedWalls = 8;
 	NavmeshCheckInterval = 1.0f;
 	PathOptimizationInterval = 0.5f;
+	ParallelStepMinAgents = 32;
 	bSingleAreaVisibilityOptimization = true;
 	bPruneStartedOffmeshConnections = false;
 	
@@ -226,13 +228,40 @@ void UCrowdManager::Tick(float DeltaTime)
 				SCOPE_CYCLE_COUNTER(STAT_AI_Crowd_StepNextPointTime);
 				DetourCrowd->updateStepNextMovePoint(DeltaTime, DetourAgentDebug);
 			}
+
+			// steering and avoidance of each agent only depend on neighbor data gathered above,
+			// split them into batches of agents, each batch avoiding with the query of its own worker
+			const int32 NumBatches = (ParallelStepMinAgents > 0) ? FMath::Clamp(NumActive / ParallelStepMinAgents, 1, DetourCrowd->getAvoidanceWorkerCount()) : 1;
+			const int32 BatchSize = FMath::DivideAndRoundUp(NumActive, NumBatches);
 			{
 				SCOPE_CYCLE_COUNTER(STAT_AI_Crowd_StepSteeringTime);
-				DetourCrowd->updateStepSteering(DeltaTime, DetourAgentDebug);
+				if (NumBatches > 1)
+				{
+					ParallelFor(NumBatches, [&](int32 BatchIdx)
+					{
+						const int32 AgentBegin = BatchIdx * BatchSize;
+						DetourCrowd->updateStepSteeringRange(DeltaTime, AgentBegin, FMath::Min(AgentBegin + BatchSize, NumActive));
+					});
+				}
+				else
+				{
+					DetourCrowd->updateStepSteering(DeltaTime, DetourAgentDebug);
+				}
 			}
 			{
 				SCOPE_CYCLE_COUNTER(STAT_AI_Crowd_StepAvoidanceTime);
-				DetourCrowd->updateStepAvoidance(DeltaTime, DetourAgentDebug);
+				if (NumBatches > 1)
+				{
+					ParallelFor(NumBatches, [&](int32 BatchIdx)
+					{
+						const int32 AgentBegin = BatchIdx * BatchSize;
+						DetourCrowd->updateStepAvoidanceRange(DeltaTime, AgentBegin, FMath::Min(AgentBegin + BatchSize, NumActive), BatchIdx, DetourAgentDebug);
+					});
+				}
+				else
+				{
+					DetourCrowd->updateStepAvoidance(DeltaTime, DetourAgentDebug);
+				}
 			}
 			{
 				SCOPE_CYCLE_COUNTER(STAT_AI_Crowd_StepComponentsTime);
@@ -842,7 +871,9 @@ void UCrowdManager::CreateCrowdManager()
 		DetourCrowd->setSingleAreaVisibilityOptimization(bSingleAreaVisibilityOptimization);
 		DetourCrowd->setPruneStartedOffmeshConnections(bPruneStartedOffmeshConnections);
 
-		DetourCrowd->initAvoidance(MaxAvoidedAgents, MaxAvoidedWalls, FMath::Max(SamplingPatterns.Num(), 1));
+		// one avoidance query for each thread that can run a batch of UCrowdManager::Tick's parallel steps
+		const int32 NumAvoidanceWorkers = (ParallelStepMinAgents > 0) ? FTaskGraphInterface::Get().GetNumWorkerThreads() + 1 : 1;
+		DetourCrowd->initAvoidance(MaxAvoidedAgents, MaxAvoidedWalls, FMath::Max(SamplingPatterns.Num(), 1), NumAvoidanceWorkers);
 
 		for (int32 Idx = 0; Idx < SamplingPatterns.Num(); Idx++)
 		{
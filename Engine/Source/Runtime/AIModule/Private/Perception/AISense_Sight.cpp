@@ -9,6 +9,9 @@ DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight"),STAT_AI_Sense_Sight,STATGROUP
 DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Listener Update"), STAT_AI_Sense_Sight_ListenerUpdate, STATGROUP_AI);
 
 static const int32 DefaultMaxTracesPerTick = 6;
+static const int32 DefaultMaxQueriesPerTick = 256;
+// QueryUpdateCounter is rebased before float scores lose precision
+static const int32 MaxQueryUpdateCounter = 1 << 20;
 
 //----------------------------------------------------------------------//
 // helpers
@@ -63,9 +66,12 @@ UAISense_Sight::FDigestedSightProperties::FDigestedSightProperties()
 UAISense_Sight::UAISense_Sight(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, MaxTracesPerTick(DefaultMaxTracesPerTick)
+	, MaxQueriesPerTick(DefaultMaxQueriesPerTick)
 	, HighImportanceQueryDistanceThreshold(300.f)
 	, MaxQueryImportance(60.f)
 	, SightLimitQueryImportance(10.f)
+	, SeenTargetQueryImportanceBonus(10.f)
+	, QueryUpdateCounter(0)
 {
 	if (HasAnyFlags(RF_ClassDefaultObject) == false)
 	{
@@ -113,136 +119,187 @@ float UAISense_Sight::Update()
 
 	AIPerception::FListenerMap& ListenersMap = *GetListeners();
 
+	// queue is sorted by score, so only its front needs processing. Waiting queries
+	// get older implicitly, see FAISightQuery::RecalcScore
+	++QueryUpdateCounter;
+	const int32 MaxQueries = MaxQueriesPerTick > 0 ? FMath::Min(MaxQueriesPerTick, SightQueryQueue.Num()) : SightQueryQueue.Num();
+
+	int32 QueryIndex = 0;
 	FAISightQuery* SightQuery = SightQueryQueue.GetData();
-	for (int32 QueryIndex = 0; QueryIndex < SightQueryQueue.Num(); ++QueryIndex, ++SightQuery)
+	for (; QueryIndex < MaxQueries && TracesCount < MaxTracesPerTick; ++QueryIndex, ++SightQuery)
 	{
-		if (TracesCount < MaxTracesPerTick)
+		FPerceptionListener& Listener = ListenersMap[SightQuery->ObserverId];
+		ensure(Listener.Listener.IsValid());
+		FAISightTarget& Target = ObservedTargets[SightQuery->TargetId];
+				
+		const bool bTargetValid = Target.Target.IsValid();
+		const bool bListenerValid = Listener.Listener.IsValid();
+
+		// @todo figure out what should we do if not valid
+		if (bTargetValid && bListenerValid)
 		{
-			FPerceptionListener& Listener = ListenersMap[SightQuery->ObserverId];
-			ensure(Listener.Listener.IsValid());
-			FAISightTarget& Target = ObservedTargets[SightQuery->TargetId];
-					
-			const bool bTargetValid = Target.Target.IsValid();
-			const bool bListenerValid = Listener.Listener.IsValid();
-
-			// @todo figure out what should we do if not valid
-			if (bTargetValid && bListenerValid)
-			{
-				AActor* TargetActor = Target.Target.Get();
-				const FVector TargetLocation = TargetActor->GetActorLocation();
-				const FDigestedSightProperties& PropDigest = DigestedProperties[SightQuery->ObserverId];
-				const float SightRadiusSq = SightQuery->bLastResult ? PropDigest.LoseSightRadiusSq : PropDigest.SightRadiusSq;
+			AActor* TargetActor = Target.Target.Get();
+			const FVector TargetLocation = TargetActor->GetActorLocation();
+			const FDigestedSightProperties& PropDigest = DigestedProperties[SightQuery->ObserverId];
+			const float SightRadiusSq = SightQuery->bLastResult ? PropDigest.LoseSightRadiusSq : PropDigest.SightRadiusSq;
 
-				if (CheckIsTargetInSightPie(Listener, PropDigest, TargetLocation, SightRadiusSq))
-				{
+			if (CheckIsTargetInSightPie(Listener, PropDigest, TargetLocation, SightRadiusSq))
+			{
 //					UE_VLOG_SEGMENT(Listener.Listener.Get()->GetOwner(), Listener.CachedLocation, TargetLocation, FColor::Green, TEXT("%s"), *(Target.TargetId.ToString()));
 
-					FVector OutSeenLocation(0.f);
-					// do line checks
-					if (Target.SightTargetInterface != NULL)
+				FVector OutSeenLocation(0.f);
+				// do line checks
+				if (Target.SightTargetInterface != NULL)
+				{
+					int32 NumberOfLoSChecksPerformed = 0;
+					if (Target.SightTargetInterface->CanBeSeenFrom(Listener.CachedLocation, OutSeenLocation, NumberOfLoSChecksPerformed, Listener.Listener->GetBodyActor()) == true)
 					{
-						int32 NumberOfLoSChecksPerformed = 0;
-						if (Target.SightTargetInterface->CanBeSeenFrom(Listener.CachedLocation, OutSeenLocation, NumberOfLoSChecksPerformed, Listener.Listener->GetBodyActor()) == true)
-						{
-							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 1.f, OutSeenLocation, Listener.CachedLocation));
-							SightQuery->bLastResult = true;
-						}
-						else
-						{
-//							UE_VLOG_LOCATION(Listener.Listener.Get()->GetOwner(), TargetLocation, 25.f, FColor::Red, TEXT(""));
-							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
-							SightQuery->bLastResult = false;
-						}
-
-						TracesCount += NumberOfLoSChecksPerformed;
+						Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 1.f, OutSeenLocation, Listener.CachedLocation));
+						SightQuery->bLastResult = true;
 					}
 					else
 					{
-						// we need to do tests ourselves
-						/*const bool bHit = World->LineTraceTest(Listener.CachedLocation, TargetLocation
-							, FCollisionQueryParams(NAME_AILineOfSight, true, Listener.Listener->GetBodyActor())
-							, FCollisionObjectQueryParams(ECC_WorldStatic));*/
-						FHitResult HitResult;
-						const bool bHit = World->LineTraceSingle(HitResult, Listener.CachedLocation, TargetLocation
-							, FCollisionQueryParams(NAME_AILineOfSight, true, Listener.Listener->GetBodyActor())
-							, FCollisionObjectQueryParams(ECC_WorldStatic));
-
-						++TracesCount;
-
-						if (bHit == false || (HitResult.Actor.IsValid() && HitResult.Actor->IsOwnedBy(TargetActor)))
-						{
-							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 1.f, TargetLocation, Listener.CachedLocation));
-							SightQuery->bLastResult = true;
-						}
-						else
-						{
 //							UE_VLOG_LOCATION(Listener.Listener.Get()->GetOwner(), TargetLocation, 25.f, FColor::Red, TEXT(""));
-							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
-							SightQuery->bLastResult = false;
-						}
+						Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
+						SightQuery->bLastResult = false;
 					}
+
+					TracesCount += NumberOfLoSChecksPerformed;
 				}
 				else
 				{
-//					UE_VLOG_SEGMENT(Listener.Listener.Get()->GetOwner(), Listener.CachedLocation, TargetLocation, FColor::Red, TEXT("%s"), *(Target.TargetId.ToString()));
-					Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
-					SightQuery->bLastResult = false;
+					// we need to do tests ourselves
+					/*const bool bHit = World->LineTraceTest(Listener.CachedLocation, TargetLocation
+						, FCollisionQueryParams(NAME_AILineOfSight, true, Listener.Listener->GetBodyActor())
+						, FCollisionObjectQueryParams(ECC_WorldStatic));*/
+					FHitResult HitResult;
+					const bool bHit = World->LineTraceSingle(HitResult, Listener.CachedLocation, TargetLocation
+						, FCollisionQueryParams(NAME_AILineOfSight, true, Listener.Listener->GetBodyActor())
+						, FCollisionObjectQueryParams(ECC_WorldStatic));
+
+					++TracesCount;
+
+					if (bHit == false || (HitResult.Actor.IsValid() && HitResult.Actor->IsOwnedBy(TargetActor)))
+					{
+						Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 1.f, TargetLocation, Listener.CachedLocation));
+						SightQuery->bLastResult = true;
+					}
+					else
+					{
+//							UE_VLOG_LOCATION(Listener.Listener.Get()->GetOwner(), TargetLocation, 25.f, FColor::Red, TEXT(""));
+						Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
+						SightQuery->bLastResult = false;
+					}
 				}
-
-				SightQuery->Importance = CalcQueryImportance(Listener, TargetLocation, SightRadiusSq);
-
-				// restart query
-				SightQuery->Age = 0.f;
 			}
 			else
 			{
-				// put this index to "to be removed" array
-				InvalidQueries.Add(QueryIndex);
-				if (bTargetValid == false)
-				{
-					InvalidTargets.AddUnique(SightQuery->TargetId);
-				}
+//					UE_VLOG_SEGMENT(Listener.Listener.Get()->GetOwner(), Listener.CachedLocation, TargetLocation, FColor::Red, TEXT("%s"), *(Target.TargetId.ToString()));
+				Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
+				SightQuery->bLastResult = false;
+			}
+
+			SightQuery->Importance = CalcQueryImportance(Listener, TargetLocation, SightRadiusSq);
+			if (SightQuery->bLastResult)
+			{
+				SightQuery->Importance += SeenTargetQueryImportanceBonus;
 			}
+
+			// restart query
+			SightQuery->LastProcessedUpdate = QueryUpdateCounter;
 		}
 		else
 		{
-			// age unprocessed queries so that they can advance in the queue during next sort
-			SightQuery->Age += 1.f;
+			// put this index to "to be removed" array
+			InvalidQueries.Add(QueryIndex);
+			if (bTargetValid == false)
+			{
+				InvalidTargets.AddUnique(SightQuery->TargetId);
+			}
 		}
 
 		SightQuery->RecalcScore();
 	}
 
-	if (InvalidQueries.Num() > 0)
+	// put processed queries back in order, invalid queries are removed while doing it
+	MergeProcessedQueries(QueryIndex, InvalidQueries);
+
+	if (InvalidTargets.Num() > 0)
 	{
-		for (int32 Index = InvalidQueries.Num() - 1; Index >= 0; --Index)
+		for (const auto& TargetId : InvalidTargets)
 		{
-			// removing with swapping here, since queue is going to be sorted anyway
-			SightQueryQueue.RemoveAtSwap(InvalidQueries[Index], 1, /*bAllowShrinking*/false);
+			// remove affected queries
+			RemoveAllQueriesToTarget(TargetId, DontSort);
+			// remove target itself
+			ObservedTargets.Remove(TargetId);
 		}
 
-		if (InvalidTargets.Num() > 0)
-		{
-			for (const auto& TargetId : InvalidTargets)
-			{
-				// remove affected queries
-				RemoveAllQueriesToTarget(TargetId, DontSort);
-				// remove target itself
-				ObservedTargets.Remove(TargetId);
-			}
+		// remove holes
+		ObservedTargets.Compact();
+	}
 
-			// remove holes
-			ObservedTargets.Compact();
+	if (QueryUpdateCounter >= MaxQueryUpdateCounter)
+	{
+		// same offset for all queries, their order doesn't change
+		for (FAISightQuery& Query : SightQueryQueue)
+		{
+			Query.LastProcessedUpdate -= QueryUpdateCounter;
+			Query.RecalcScore();
 		}
+		QueryUpdateCounter = 0;
 	}
 
-	// sort Sight Queries
-	SortQueries();
-
 	//return SightQueryQueue.Num() > 0 ? 1.f/6 : FLT_MAX;
 	return 0.f;
 }
 
+void UAISense_Sight::MergeProcessedQueries(int32 NumProcessedQueries, const TArray<int32>& InvalidQueries)
+{
+	if (NumProcessedQueries == 0)
+	{
+		return;
+	}
+
+	// InvalidQueries are in increasing order
+	ProcessedQueries.Reset(NumProcessedQueries);
+	for (int32 QueryIndex = 0, InvalidIndex = 0; QueryIndex < NumProcessedQueries; ++QueryIndex)
+	{
+		if (InvalidIndex < InvalidQueries.Num() && InvalidQueries[InvalidIndex] == QueryIndex)
+		{
+			++InvalidIndex;
+			continue;
+		}
+		ProcessedQueries.Add(SightQueryQueue[QueryIndex]);
+	}
+	ProcessedQueries.Sort(FAISightQuery::FSortPredicate());
+
+	// merge from the front of the queue, writing never gets past the waiting query being read
+	const FAISightQuery::FSortPredicate Predicate;
+	int32 WriteIndex = 0;
+	int32 WaitingIndex = NumProcessedQueries;
+	for (int32 ProcessedIndex = 0; ProcessedIndex < ProcessedQueries.Num(); )
+	{
+		if (WaitingIndex < SightQueryQueue.Num() && Predicate(SightQueryQueue[WaitingIndex], ProcessedQueries[ProcessedIndex]))
+		{
+			SightQueryQueue[WriteIndex++] = SightQueryQueue[WaitingIndex++];
+		}
+		else
+		{
+			SightQueryQueue[WriteIndex++] = ProcessedQueries[ProcessedIndex++];
+		}
+	}
+
+	// remaining waiting queries are already in place, unless invalid queries left a gap
+	if (WriteIndex < WaitingIndex)
+	{
+		while (WaitingIndex < SightQueryQueue.Num())
+		{
+			SightQueryQueue[WriteIndex++] = SightQueryQueue[WaitingIndex++];
+		}
+		SightQueryQueue.SetNum(WriteIndex, /*bAllowShrinking=*/false);
+	}
+}
+
 void UAISense_Sight::RegisterEvent(const FAISightEvent& Event)
 {
 
@@ -287,6 +344,8 @@ bool UAISense_Sight::RegisterTarget(AActor& TargetActor, FQueriesOperationPostPr
 			FAISightQuery SightQuery(ItListener->Key, SightTarget->TargetId);
 			const FDigestedSightProperties& PropDigest = DigestedProperties[Listener.GetListenerID()];
 			SightQuery.Importance = CalcQueryImportance(ItListener->Value, TargetLocation, PropDigest.SightRadiusSq);
+			SightQuery.LastProcessedUpdate = QueryUpdateCounter;
+			SightQuery.RecalcScore();
 
 			SightQueryQueue.Add(SightQuery);
 			bNewQueriesAdded = true;
@@ -334,6 +393,8 @@ void UAISense_Sight::GenerateQueriesForListener(const FPerceptionListener& Liste
 			// create a sight query		
 			FAISightQuery SightQuery(Listener.GetListenerID(), ItTarget->Key);
 			SightQuery.Importance = CalcQueryImportance(Listener, ItTarget->Value.GetLocationSimple(), PropertyDigest.SightRadiusSq);
+			SightQuery.LastProcessedUpdate = QueryUpdateCounter;
+			SightQuery.RecalcScore();
 
 			SightQueryQueue.Add(SightQuery);
 			bNewQueriesAdded = true;
@@ -2,9 +2,26 @@
 
 #include "AssetRegistryPCH.h"
 
+#include "ParallelFor.h"
+
 #define MAX_FILES_TO_PROCESS_BEFORE_FLUSH 250
 #define CACHE_SERIALIZATION_VERSION 2
 
+/** A package read by the gatherer, see FAssetDataGatherer::ReadAssetFiles */
+struct FAssetFileReadResult
+{
+	FString AssetFilename;
+	FName PackageName;
+	FDateTime Timestamp;
+	TArray<FBackgroundAssetData*> AssetDataList;
+	FPackageDependencyData DependencyData;
+	bool bSuccess;
+
+	FAssetFileReadResult()
+		: bSuccess(false)
+	{}
+};
+
 FAssetDataGatherer::FAssetDataGatherer(const TArray<FString>& InPaths, bool bInIsSynchronous, bool bInLoadAndSaveCache)
 	: StopTaskCounter( 0 )
 	, bIsSynchronous( bInIsSynchronous )
@@ -25,6 +42,8 @@ FAssetDataGatherer::FAssetDataGatherer(const TArray<FString>& InPaths, bool bInI
 
 	bGatherDependsData = GIsEditor && !FParse::Param( FCommandLine::Get(), TEXT("NoDependsGathering") );
 
+	bParallelRead = !FParse::Param( FCommandLine::Get(), TEXT("NoParallelAssetGathering") );
+
 	CacheFilename = FPaths::GameIntermediateDir() / TEXT("CachedAssetRegistry.bin");
 
 	if ( bIsSynchronous )
@@ -139,6 +158,9 @@ uint32 FAssetDataGatherer::Run()
 
 		if ( LocalFilesToSearch.Num() )
 		{
+			TArray<FAssetFileReadResult> FilesToRead;
+			FilesToRead.Reserve(LocalFilesToSearch.Num());
+
 			for (int32 FileIdx = 0; FileIdx < LocalFilesToSearch.Num(); ++FileIdx)
 			{
 				const FString& AssetFile = LocalFilesToSearch[FileIdx];
@@ -149,11 +171,12 @@ uint32 FAssetDataGatherer::Run()
 					break;
 				}
 
-				bool bLoadedFromCache = false;
+				FName PackageName;
+				FDateTime FileTimestamp;
 				if ( bLoadAndSaveCache )
 				{
-					const FName PackageName = FName(*FPackageName::FilenameToLongPackageName(AssetFile));
-					const FDateTime& FileTimestamp = IFileManager::Get().GetTimeStamp(*AssetFile);
+					PackageName = FName(*FPackageName::FilenameToLongPackageName(AssetFile));
+					FileTimestamp = IFileManager::Get().GetTimeStamp(*AssetFile);
 					FDiskCachedAssetData** DiskCachedAssetDataPtr = DiskCachedAssetDataMap.Find(PackageName);
 					FDiskCachedAssetData* DiskCachedAssetData = NULL;
 					if ( DiskCachedAssetDataPtr && *DiskCachedAssetDataPtr )
@@ -175,33 +198,45 @@ uint32 FAssetDataGatherer::Run()
 						LocalDependencyResults.Add(DiskCachedAssetData->DependencyData);
 
 						NewCachedAssetDataMap.Add(PackageName, DiskCachedAssetData);
-						bLoadedFromCache = true;
+						continue;
 					}
 				}
 
-				if ( !bLoadedFromCache )
+				FAssetFileReadResult& FileToRead = *new(FilesToRead) FAssetFileReadResult();
+				FileToRead.AssetFilename = AssetFile;
+				FileToRead.PackageName = PackageName;
+				FileToRead.Timestamp = FileTimestamp;
+			}
+
+			ReadAssetFiles(FilesToRead);
+
+			for (int32 ReadIdx = 0; ReadIdx < FilesToRead.Num(); ++ReadIdx)
+			{
+				FAssetFileReadResult& ReadResult = FilesToRead[ReadIdx];
+				if ( ReadResult.bSuccess )
 				{
-					TArray<FBackgroundAssetData*> AssetDataFromFile;
-					FPackageDependencyData DependencyData;
-					if ( ReadAssetFile(AssetFile, AssetDataFromFile, DependencyData) )
-					{
-						LocalAssetResults.Append(AssetDataFromFile);
-						LocalDependencyResults.Add(DependencyData);
+					LocalAssetResults.Append(ReadResult.AssetDataList);
+					LocalDependencyResults.Add(ReadResult.DependencyData);
 
-						if ( bLoadAndSaveCache )
+					if ( bLoadAndSaveCache )
+					{
+						// Update the cache
+						FDiskCachedAssetData* NewData = new FDiskCachedAssetData(ReadResult.PackageName, ReadResult.Timestamp);
+						for ( auto AssetIt = ReadResult.AssetDataList.CreateConstIterator(); AssetIt; ++AssetIt )
 						{
-							// Update the cache
-							const FName PackageName = FName(*FPackageName::FilenameToLongPackageName(AssetFile));
-							const FDateTime& FileTimestamp = IFileManager::Get().GetTimeStamp(*AssetFile);
-							FDiskCachedAssetData* NewData = new FDiskCachedAssetData(PackageName, FileTimestamp);
-							for ( auto AssetIt = AssetDataFromFile.CreateConstIterator(); AssetIt; ++AssetIt )
-							{
-								NewData->AssetDataList.Add((*AssetIt)->ToAssetData());
-							}
-							NewData->DependencyData = DependencyData;
-							NewCachedAssetData.Add(NewData);
-							NewCachedAssetDataMap.Add(PackageName, NewData);
+							NewData->AssetDataList.Add((*AssetIt)->ToAssetData());
 						}
+						NewData->DependencyData = ReadResult.DependencyData;
+						NewCachedAssetData.Add(NewData);
+						NewCachedAssetDataMap.Add(ReadResult.PackageName, NewData);
+					}
+				}
+				else
+				{
+					// A failed read may still have found some assets before giving up on the dependencies, they are not reported
+					for ( auto AssetIt = ReadResult.AssetDataList.CreateConstIterator(); AssetIt; ++AssetIt )
+					{
+						delete *AssetIt;
 					}
 				}
 			}
@@ -444,6 +479,20 @@ bool FAssetDataGatherer::ReadAssetFile(const FString& AssetFilename, TArray<FBac
 	return true;
 }
 
+void FAssetDataGatherer::ReadAssetFiles(TArray<FAssetFileReadResult>& FilesToRead) const
+{
+	// Reading a package is mostly waiting on the file system and parsing its summary, so the packages that were not
+	// found in the cache are read in parallel. Results are kept in their original order so the search stays deterministic
+	ParallelFor(FilesToRead.Num(), [&](int32 ReadIdx)
+	{
+		if ( StopTaskCounter.GetValue() == 0 )
+		{
+			FAssetFileReadResult& FileToRead = FilesToRead[ReadIdx];
+			FileToRead.bSuccess = ReadAssetFile(FileToRead.AssetFilename, FileToRead.AssetDataList, FileToRead.DependencyData);
+		}
+	}, !bParallelRead);
+}
+
 void FAssetDataGatherer::SerializeCache(FArchive& Ar)
 {
 	double SerializeStartTime = FPlatformTime::Seconds();
@@ -2,6 +2,8 @@
 
 #pragma once
 
+struct FAssetFileReadResult;
+
 /**
  * Async task for gathering asset data from from the file list in FAssetRegistry
  */
@@ -52,6 +54,9 @@ private:
 	 */
 	bool ReadAssetFile(const FString& AssetFilename, TArray<FBackgroundAssetData*>& AssetDataList, FPackageDependencyData& DependencyData) const;
 
+	/** Reads every file of FilesToRead with ReadAssetFile, in parallel unless bParallelRead is false */
+	void ReadAssetFiles(TArray<FAssetFileReadResult>& FilesToRead) const;
+
 	/** Serializes the timestamped cache of discovered assets. Used for quick loading of data for assets that have not changed on disk */
 	void SerializeCache(FArchive& Ar);
 
@@ -94,6 +99,9 @@ private:
 	/** True if dependency data should be gathered */
 	bool bGatherDependsData;
 
+	/** True if the files that are not in the cache should be read on the task graph workers. Disabled with -NoParallelAssetGathering */
+	bool bParallelRead;
+
 	/** Set of characters that are invalid in packages, thus files containing them can not be loaded. */
 	TSet<TCHAR> InvalidAssetFileCharacters;
 
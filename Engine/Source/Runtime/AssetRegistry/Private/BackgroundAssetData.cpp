@@ -3,6 +3,7 @@
 #include "AssetRegistryPCH.h"
 
 FBackgroundAssetData::FBackgroundAssetData(const FString& InPackageName, const FString& InPackagePath, const FString& InGroupNames, const FString& InAssetName, const FString& InAssetClass, const TMultiMap<FString, FString>& InTags, const TArray<int32>& InChunkIDs)
+	: bFromCachedAssetData(false)
 {
 	PackageName = InPackageName;
 	PackagePath = InPackagePath;
@@ -24,6 +25,8 @@ FBackgroundAssetData::FBackgroundAssetData(const FString& InPackageName, const F
 }
 
 FBackgroundAssetData::FBackgroundAssetData(const FAssetData& InAssetData)
+	: CachedAssetData(InAssetData)
+	, bFromCachedAssetData(true)
 {
 	PackageName = InAssetData.PackageName.ToString();
 	PackagePath = InAssetData.PackagePath.ToString();
@@ -31,10 +34,7 @@ FBackgroundAssetData::FBackgroundAssetData(const FAssetData& InAssetData)
 	AssetName = InAssetData.AssetName.ToString();
 	AssetClass = InAssetData.AssetClass.ToString();
 
-	for ( auto TagIt = InAssetData.TagsAndValues.CreateConstIterator(); TagIt; ++TagIt )
-	{
-		TagsAndValues.Add(TagIt.Key().ToString(), TagIt.Value());
-	}
+	// The tags are not converted, most assets come from the cache on a warm start and would be turned back into names right away
 
 	ObjectPath = InAssetData.ObjectPath.ToString();
 
@@ -43,6 +43,11 @@ FBackgroundAssetData::FBackgroundAssetData(const FAssetData& InAssetData)
 
 FAssetData FBackgroundAssetData::ToAssetData() const
 {
+	if (bFromCachedAssetData)
+	{
+		return CachedAssetData;
+	}
+
 	TMap<FName, FString> CopiedTagsAndValues;
 
 	// Copy over tags and values, retaining unique entries in the map for duplicate names
@@ -29,4 +29,9 @@ public:
 	TMultiMap<FString, FString> TagsAndValues;
 	/** The IDs of the chunks this asset is located in for streaming install.  Empty if not assigned to a chunk */
 	TArray<int32> ChunkIDs;
+
+private:
+	/** When created from the disk cache, the asset data it was created from. ToAssetData returns it as is, and TagsAndValues is left empty */
+	FAssetData CachedAssetData;
+	bool bFromCachedAssetData;
 };
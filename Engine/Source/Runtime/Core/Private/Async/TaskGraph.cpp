@@ -209,6 +209,117 @@ private:
 
 };
 
+/**
+ *	FWorkStealingTaskQueue
+ *	Fixed size, lock free deque for the any thread tasks spawned from a worker thread (Chase-Lev).
+ *	The owner pushes and pops at the bottom (LIFO, so the data the last task produced is still hot), other workers steal from the top (FIFO).
+ *	Indices wrap around, so they are only compared through their difference.
+**/
+class FWorkStealingTaskQueue
+{
+public:
+	/** Constructor, sets the queue to the empty state. **/
+	FWorkStealingTaskQueue()
+		: Top(0)
+		, Bottom(0)
+	{
+		FMemory::Memzero(Tasks, sizeof(Tasks));
+	}
+	/**
+	 *	Adds a task to the bottom of the queue. Only the owner thread can call this.
+	 *	@param Task; the task to add to the queue
+	 *	@return false if the queue is full, the task must go somewhere else
+	**/
+	bool Push(FBaseGraphTask* Task)
+	{
+		const int32 LocalBottom = Bottom;
+		if (Distance(Top, LocalBottom) >= CAPACITY)
+		{
+			return false;
+		}
+		Tasks[uint32(LocalBottom) & INDEX_MASK] = Task;
+		FPlatformMisc::MemoryBarrier(); // the task must be visible before the thieves see the new bottom
+		Bottom = Next(LocalBottom);
+		return true;
+	}
+	/**
+	 *	Pops the newest task. Only the owner thread can call this.
+	 *	@return The newest task in the queue or NULL if the queue is empty
+	**/
+	FBaseGraphTask* Pop()
+	{
+		const int32 LocalBottom = int32(uint32(Bottom) - 1);
+		FPlatformAtomics::InterlockedExchange(&Bottom, LocalBottom); // full barrier, the new bottom must be visible before reading top
+		const int32 LocalTop = Top;
+		const int32 Size = Distance(LocalTop, LocalBottom) + 1;
+		if (Size <= 0)
+		{
+			Bottom = LocalTop;
+			return NULL;
+		}
+		FBaseGraphTask* Task = Tasks[uint32(LocalBottom) & INDEX_MASK];
+		if (Size > 1)
+		{
+			return Task;
+		}
+		// last task, a thief might be taking it right now
+		if (FPlatformAtomics::InterlockedCompareExchange(&Top, Next(LocalTop), LocalTop) != LocalTop)
+		{
+			Task = NULL;
+		}
+		Bottom = Next(LocalTop);
+		return Task;
+	}
+	/**
+	 *	Steals the oldest task. Can be called from any thread.
+	 *	@return The oldest task in the queue or NULL if the queue is empty or another thread won the race for it
+	**/
+	FBaseGraphTask* Steal()
+	{
+		const int32 LocalTop = Top;
+		FPlatformMisc::MemoryBarrier();
+		const int32 LocalBottom = Bottom;
+		if (Distance(LocalTop, LocalBottom) <= 0)
+		{
+			return NULL;
+		}
+		FBaseGraphTask* Task = Tasks[uint32(LocalTop) & INDEX_MASK];
+		if (FPlatformAtomics::InterlockedCompareExchange(&Top, Next(LocalTop), LocalTop) != LocalTop)
+		{
+			return NULL;
+		}
+		return Task;
+	}
+	/** Returns true if the queue is probably empty. CAUTION the status can easily change before this routine returns. **/
+	bool IsProbablyEmpty() const
+	{
+		return Distance(Top, Bottom) <= 0;
+	}
+private:
+	enum
+	{
+		/** Number of tasks a thread can keep locally, the rest go to the shared queue. Must be a power of two **/
+		CAPACITY=1024,
+		INDEX_MASK=CAPACITY - 1
+	};
+
+	static FORCEINLINE int32 Distance(int32 From, int32 To)
+	{
+		return int32(uint32(To) - uint32(From));
+	}
+	static FORCEINLINE int32 Next(int32 Index)
+	{
+		return int32(uint32(Index) + 1);
+	}
+
+	/** Ring of tasks, only the [Top,Bottom) range is valid. **/
+	FBaseGraphTask* Tasks[CAPACITY];
+	/** Index of the oldest task, advanced by the thieves and by the owner when it takes the last task. **/
+	volatile int32 Top;
+	/** Index after the newest task, only written by the owner. **/
+	volatile int32 Bottom;
+};
+
 // this is used to signify a task that is just a call to wake up
 // It is generally bad to reuse pointers for non-pointer data, but efficiency is important here
 static FBaseGraphTask* WakeUpBaseGraphTask = (FBaseGraphTask*)0x3;
@@ -325,6 +436,15 @@ public:
 		{
 			FBaseGraphTask* Task = NULL;
 			Task = Queue(QueueIndex).PrivateQueue.Dequeue();
+			if (!Task && bAllowsStealsFromMe)
+			{
+				// frame critical work first, then the newest task spawned by this thread, it is likely to use what the last task left on the cache
+				Task = FindHighPriorityWork();
+				if (!Task)
+				{
+					Task = LocalQueue.Pop();
+				}
+			}
 			if (!Task)
 			{
 				if (!bAllowsStealsFromMe)
@@ -526,6 +646,38 @@ public:
 		return Queue(0).IncomingQueue.PopIfNotClosed();
 	}
 
+	/**
+	 *	Queue an any thread task on the local queue of this worker. Must be called from this thread.
+	 *	@param Task; Task to queue.
+	 *	@return false if the local queue is full.
+	 **/
+	bool EnqueueLocal(FBaseGraphTask* Task)
+	{
+		checkThreadGraph(bAllowsStealsFromMe);
+		checkThreadGraph((FTaskThread*)FPlatformTLS::GetTlsValue(PerThreadIDTLSSlot) == this); // verify that we are the thread they say we are
+		return LocalQueue.Push(Task);
+	}
+
+	/**
+	 *	Take back the newest task of the local queue. Must be called from this thread.
+	 *	@return Task; the task, or NULL if the local queue is empty.
+	 **/
+	FBaseGraphTask* DequeueLocal()
+	{
+		checkThreadGraph(bAllowsStealsFromMe);
+		return LocalQueue.Pop();
+	}
+
+	/**
+	 *	Attempt to take the oldest task of the local queue of this worker for another thread.
+	 *	@return Task; Stolen task, if one was found, otherwise NULL.
+	 **/
+	FBaseGraphTask* StealLocal()
+	{
+		checkThreadGraph(bAllowsStealsFromMe);
+		return LocalQueue.IsProbablyEmpty() ? NULL : LocalQueue.Steal();
+	}
+
 	/** 
 	 *Return true if this thread is processing tasks. This is only a "guess" if you ask for a thread other than yourself because that can change before the function returns.
 	 *@param QueueIndex, Queue to request quit from
@@ -673,6 +825,12 @@ private:
 	 */
 	FBaseGraphTask* FindWork();
 
+	/**
+	 *	Internal function to look for a high priority task. Called from this thread.
+	 *	@return New task to process.
+	 */
+	FBaseGraphTask* FindHighPriorityWork();
+
 	/**
 	 *	Internal function to notify the that system that I am stalling. This is a hint to give me a job asap.
 	 */
@@ -691,6 +849,8 @@ private:
 
 	/** Array of queues, only the first one is used for unnamed threads. **/
 	FThreadTaskQueue Queues[ENamedThreads::NumQueues];
+	/** For unnamed threads, the any thread tasks spawned from this thread. Other unnamed threads steal from it. **/
+	FWorkStealingTaskQueue LocalQueue;
 
 	/** Id / Index of this thread. **/
 	ENamedThreads::Type									ThreadId;
@@ -774,14 +934,20 @@ public:
 		NumThreads = FMath::Max<int32>(FMath::Min<int32>(InNumThreads + NumNamedThreads,MAX_THREADS),NumNamedThreads + 1);
 		// Cap number of extra threads to the platform worker thread count
 		NumThreads = FMath::Min(NumThreads, NumNamedThreads + FPlatformMisc::NumberOfWorkerThreadsToSpawn());
-		UE_LOG(LogTaskGraph, Log, TEXT("Started task graph with %d named threads and %d total threads."), NumNamedThreads, NumThreads);
+		// An extra worker only runs the high priority tasks, so a burst of background tasks can't push them back. It is idle most of the time
+		FirstHiPriThread = NumThreads;
+		if (FPlatformProcess::SupportsMultithreading() && FPlatformMisc::NumberOfCores() > 2 && NumThreads < MAX_THREADS)
+		{
+			NumThreads++;
+		}
+		UE_LOG(LogTaskGraph, Log, TEXT("Started task graph with %d named threads, %d total threads and %d high priority threads."), NumNamedThreads, NumThreads, NumThreads - FirstHiPriThread);
 		check(NumThreads - NumNamedThreads >= 1);  // need at least one pure worker thread
 		check(NumThreads <= MAX_THREADS);
 		check(!NextStealFromThread.GetValue()); // reentrant?
 		NextStealFromThread.Increment(); // just checking for reentrancy
 		PerThreadIDTLSSlot = FPlatformTLS::AllocTlsSlot();
 
-		NextUnnamedThreadMod = NumThreads - NumNamedThreads;
+		NextUnnamedThreadMod = FirstHiPriThread - NumNamedThreads;
 
 		for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ThreadIndex++)
 		{
@@ -795,9 +961,10 @@ public:
 
 		for (int32 ThreadIndex = LastExternalThread + 1; ThreadIndex < NumThreads; ThreadIndex++)
 		{
-			FString Name = FString::Printf(TEXT("TaskGraphThread %d"), ThreadIndex - (LastExternalThread + 1));
+			const bool bHighPriorityOnly = ThreadIndex >= FirstHiPriThread;
+			FString Name = bHighPriorityOnly ? FString::Printf(TEXT("TaskGraphThreadHP %d"), ThreadIndex - FirstHiPriThread) : FString::Printf(TEXT("TaskGraphThread %d"), ThreadIndex - (LastExternalThread + 1));
 			uint32 StackSize = 256 * 1024;
-			WorkerThreads[ThreadIndex].RunnableThread = FRunnableThread::Create(&Thread(ThreadIndex), *Name, StackSize, TPri_Normal, FPlatformAffinity::GetTaskGraphThreadMask()); // these are below normal threads? so that they sleep when the named threads are active
+			WorkerThreads[ThreadIndex].RunnableThread = FRunnableThread::Create(&Thread(ThreadIndex), *Name, StackSize, bHighPriorityOnly ? TPri_AboveNormal : TPri_Normal, FPlatformAffinity::GetTaskGraphThreadMask()); // these are below normal threads? so that they sleep when the named threads are active
 			WorkerThreads[ThreadIndex].bAttached = true;
 		}
 	}
@@ -825,6 +992,7 @@ public:
 		NextUnnamedThreadMod = 0;
 		TArray<FTaskThread*> NotProperlyUnstalled;
 		StalledUnnamedThreads.PopAll(NotProperlyUnstalled);
+		StalledHiPriThreads.PopAll(NotProperlyUnstalled);
 		FPlatformTLS::FreeTlsSlot(PerThreadIDTLSSlot);
 	}
 
@@ -850,25 +1018,26 @@ public:
 			CurrentThreadIfKnown = ENamedThreads::GetThreadIndex(CurrentThreadIfKnown);
 			checkThreadGraph(CurrentThreadIfKnown == GetCurrentThread());
 		}
-		if (ThreadToExecuteOn == ENamedThreads::AnyThread)
+		if (ENamedThreads::IsAnyUnnamedThread(ThreadToExecuteOn))
 		{
 			if (FPlatformProcess::SupportsMultithreading())
 			{
-				IncomingAnyThreadTasks.Push(Task);
-				FTaskThread* TempTarget = StalledUnnamedThreads.Pop(); //@todo it is possible that a thread is in the process of stalling and we just missed it, non-fatal, but we could lose a whole task of potential parallelism.
-				if (TempTarget)
-				{
-					ThreadToExecuteOn = TempTarget->GetThreadId();
-				}
-				else
+				if (ThreadToExecuteOn == ENamedThreads::AnyHiPriThread)
 				{
-					ThreadToExecuteOn = ENamedThreads::Type((uint32(NextUnnamedThreadForTaskFromUnknownThread.Increment()) % uint32(NextUnnamedThreadMod)) + NumNamedThreads);
+					QueueHiPriAnyThreadTask(Task, CurrentThreadIfKnown);
+					return;
 				}
-				FTaskThread* Target = &Thread(ThreadToExecuteOn);
-				if (ThreadToExecuteOn != CurrentThreadIfKnown)
+				// Tasks spawned from a worker stay on that worker, unless someone idle steals them
+				if (CurrentThreadIfKnown >= NumNamedThreads && CurrentThreadIfKnown < FirstHiPriThread && Thread(CurrentThreadIfKnown).EnqueueLocal(Task))
 				{
-					Target->EnqueueFromOtherThread(0, WakeUpBaseGraphTask);
+					FTaskThread* TempTarget = StalledUnnamedThreads.Pop();
+					if (TempTarget)
+					{
+						TempTarget->EnqueueFromOtherThread(0, WakeUpBaseGraphTask);
+					}
+					return;
 				}
+				QueueAnyThreadTask(Task, CurrentThreadIfKnown);
 				return;
 			}
 			else
@@ -894,7 +1063,8 @@ public:
 
 	virtual	int32 GetNumWorkerThreads() override
 	{
-		return NumThreads - NumNamedThreads;
+		// the high priority threads don't run normal tasks
+		return FirstHiPriThread - NumNamedThreads;
 	}
 
 	virtual ENamedThreads::Type GetCurrentThreadIfKnown() override
@@ -983,6 +1153,14 @@ public:
 		}
 		else
 		{
+			// The tasks on the local queue of a worker that is going to block could be the ones it waits for, give them away
+			if (CurrentThreadIfKnown >= NumNamedThreads)
+			{
+				while (FBaseGraphTask* LocalTask = Thread(CurrentThreadIfKnown).DequeueLocal())
+				{
+					QueueAnyThreadTask(LocalTask, CurrentThreadIfKnown);
+				}
+			}
 			// We will just stall this thread on an event while we wait
 			FScopedEvent Event;
 			TriggerEventWhenTasksComplete(Event.Get(), Tasks, CurrentThreadIfKnown);
@@ -1020,6 +1198,13 @@ public:
 	FBaseGraphTask* FindWork(ENamedThreads::Type ThreadInNeed)
 	{
 		TestRandomizedThreads();
+		{
+			FBaseGraphTask* Task = FindHighPriorityWork();
+			if (Task || ThreadInNeed >= FirstHiPriThread)
+			{
+				return Task;
+			}
+		}
 		{
 			FBaseGraphTask* Task = SortedAnyThreadTasks.Pop();
 			if (Task)
@@ -1056,6 +1241,21 @@ public:
 				}
 			}
 		} while (!IncomingAnyThreadTasks.IsEmpty() || !SortedAnyThreadTasks.IsEmpty());
+		// steal from the local queues of the other workers, each thread starts on a different victim to spread the contention
+		const int32 NumUnnamedThreads = FirstHiPriThread - NumNamedThreads;
+		const int32 FirstVictim = uint32(NextStealFromThread.Increment()) % uint32(NumUnnamedThreads);
+		for (int32 Offset = 0; Offset < NumUnnamedThreads; Offset++)
+		{
+			const int32 Victim = NumNamedThreads + (FirstVictim + Offset) % NumUnnamedThreads;
+			if (Victim != ThreadInNeed)
+			{
+				FBaseGraphTask* Task = Thread(Victim).StealLocal();
+				if (Task)
+				{
+					return Task;
+				}
+			}
+		}
 		// this can be called before my constructor is finished
 		for (int32 Pass = 0; Pass < 2; Pass++)
 		{
@@ -1070,7 +1270,7 @@ public:
 					}
 				}
 			}
-			for (int32 Test = NumThreads - 1; Test > ThreadInNeed; Test--)
+			for (int32 Test = FirstHiPriThread - 1; Test > ThreadInNeed; Test--)
 			{
 				if (Pass || !Thread(Test).IsProbablyStalled())
 				{
@@ -1091,16 +1291,82 @@ public:
 	**/
 	void NotifyStalling(ENamedThreads::Type StallingThread)
 	{
-		if (StallingThread >= NumNamedThreads)
+		if (StallingThread >= FirstHiPriThread)
+		{
+			StalledHiPriThreads.Push(&Thread(StallingThread));
+		}
+		else if (StallingThread >= NumNamedThreads)
 		{
 			StalledUnnamedThreads.Push(&Thread(StallingThread));
 		}
 	}
 
+	/** 
+	 *	Attempt to take a high priority task, any unnamed thread can run them.
+	 *	@return Task that was found if any.
+	**/
+	FBaseGraphTask* FindHighPriorityWork()
+	{
+		return IncomingHiPriAnyThreadTasks.Pop();
+	}
+
 private:
 
 	// Internals
 
+	/**
+	 *	Queue a task on the shared any thread queue and wake up a worker to run it.
+	 *	@param	Task; the task to queue
+	 *	@param	CurrentThreadIfKnown; Id of the current thread, or ENamedThreads::AnyThread if the current thread is not known
+	**/
+	void QueueAnyThreadTask(FBaseGraphTask* Task, ENamedThreads::Type CurrentThreadIfKnown)
+	{
+		IncomingAnyThreadTasks.Push(Task);
+		WakeUpUnnamedThread(CurrentThreadIfKnown);
+	}
+
+	/** 
+	 *	Queue a task on the high priority queue and wake up a high priority worker to run it, or a normal one if they are all busy.
+	 *	@param	Task; the task to queue
+	 *	@param	CurrentThreadIfKnown; Id of the current thread, or ENamedThreads::AnyThread if the current thread is not known
+	**/
+	void QueueHiPriAnyThreadTask(FBaseGraphTask* Task, ENamedThreads::Type CurrentThreadIfKnown)
+	{
+		IncomingHiPriAnyThreadTasks.Push(Task);
+		FTaskThread* TempTarget = StalledHiPriThreads.Pop();
+		if (TempTarget)
+		{
+			TempTarget->EnqueueFromOtherThread(0, WakeUpBaseGraphTask);
+		}
+		else
+		{
+			WakeUpUnnamedThread(CurrentThreadIfKnown);
+		}
+	}
+
+	/** 
+	 *	Wake up a normal worker, preferably a stalled one, to look for the task that was just queued.
+	 *	@param	CurrentThreadIfKnown; Id of the current thread, or ENamedThreads::AnyThread if the current thread is not known
+	**/
+	void WakeUpUnnamedThread(ENamedThreads::Type CurrentThreadIfKnown)
+	{
+		ENamedThreads::Type ThreadToExecuteOn;
+		FTaskThread* TempTarget = StalledUnnamedThreads.Pop(); //@todo it is possible that a thread is in the process of stalling and we just missed it, non-fatal, but we could lose a whole task of potential parallelism.
+		if (TempTarget)
+		{
+			ThreadToExecuteOn = TempTarget->GetThreadId();
+		}
+		else
+		{
+			ThreadToExecuteOn = ENamedThreads::Type((uint32(NextUnnamedThreadForTaskFromUnknownThread.Increment()) % uint32(NextUnnamedThreadMod)) + NumNamedThreads);
+		}
+		FTaskThread* Target = &Thread(ThreadToExecuteOn);
+		if (ThreadToExecuteOn != CurrentThreadIfKnown)
+		{
+			Target->EnqueueFromOtherThread(0, WakeUpBaseGraphTask);
+		}
+	}
+
 	/** 
 	 *	Internal function to verify an index and return the corresponding FTaskThread
 	 *	@param	Index; Id of the thread to retrieve.
@@ -1135,7 +1401,7 @@ private:
 	enum
 	{
 		/** Compile time maximum number of threads. @todo Didn't really need to be a compile time constant. **/
-		MAX_THREADS=8
+		MAX_THREADS=26
 	};
 
 	/** Per thread data. **/
@@ -1160,8 +1426,13 @@ private:
 	uint32				PerThreadIDTLSSlot;
 	/** Thread safe list of stalled thread "Hints". **/
 	TLockFreePointerList<FTaskThread>		StalledUnnamedThreads; 
+	/** Thread safe list of stalled high priority thread "Hints". **/
+	TLockFreePointerList<FTaskThread>		StalledHiPriThreads; 
+	/** Index of the first high priority only thread, they are the last ones. Equal to NumThreads if there are none. **/
+	int32					FirstHiPriThread;
 
 	TLockFreePointerList<FBaseGraphTask>		IncomingAnyThreadTasks;
+	TLockFreePointerList<FBaseGraphTask>		IncomingHiPriAnyThreadTasks;
 	TLockFreePointerList<FBaseGraphTask>		SortedAnyThreadTasks;
 	FCriticalSection CriticalSectionForSortingIncomingAnyThreadTasks;
 };
@@ -1174,6 +1445,11 @@ FBaseGraphTask* FTaskThread::FindWork()
 	return FTaskGraphImplementation::Get().FindWork(ThreadId);
 }
 
+FBaseGraphTask* FTaskThread::FindHighPriorityWork()
+{
+	return FTaskGraphImplementation::Get().FindHighPriorityWork();
+}
+
 void FTaskThread::NotifyStalling()
 {
 	return FTaskGraphImplementation::Get().NotifyStalling(ThreadId);
@@ -1201,6 +1477,11 @@ FTaskGraphInterface& FTaskGraphInterface::Get()
 	return *TaskGraphImplementationSingleton;
 }
 
+bool FTaskGraphInterface::IsRunning()
+{
+	return TaskGraphImplementationSingleton != NULL;
+}
+
 
 // Statics and some implementations from FBaseGraphTask and FGraphEvent
 
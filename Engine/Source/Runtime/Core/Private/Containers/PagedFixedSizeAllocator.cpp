@@ -0,0 +1,102 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "Containers/PagedFixedSizeAllocator.h"
+
+/** Alignment of the elements, as FMemory::Malloc gives by default for allocations of 16 bytes or more. */
+static const uint32 PagedFixedSizeAllocatorAlignment = 16;
+
+FPagedFixedSizeAllocator::FPagedFixedSizeAllocator(uint32 InElementSize, uint32 InElementsPerPage)
+	: ElementSize(Align(FMath::Max<uint32>(InElementSize, sizeof(FFreeElement)), PagedFixedSizeAllocatorAlignment))
+	, PageSize(0)
+	, FreeList(NULL)
+	, PageTail(NULL)
+	, PageEnd(NULL)
+	, NumLive(0)
+{
+	check(InElementsPerPage > 0);
+	PageSize = ElementSize * InElementsPerPage;
+}
+
+FPagedFixedSizeAllocator::~FPagedFixedSizeAllocator()
+{
+	// by now all elements better have been returned
+	check(GIsCriticalError || NumLive == 0);
+	// The pages are stranded, these allocators are meant to be global and never deleted.
+}
+
+void* FPagedFixedSizeAllocator::Allocate()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	void* Result;
+	if (FreeList)
+	{
+		Result = FreeList;
+		FreeList = FreeList->Next;
+	}
+	else
+	{
+		if (PageTail == PageEnd)
+		{
+			AddPage();
+		}
+		Result = PageTail;
+		PageTail += ElementSize;
+	}
+	++NumLive;
+	return Result;
+}
+
+void FPagedFixedSizeAllocator::Free(void* Element)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	checkSlow(NumLive > 0);
+	checkSlow(ContainsNoLock(Element));
+	--NumLive;
+	FFreeElement* NewFreeElement = (FFreeElement*)Element;
+	NewFreeElement->Next = FreeList;
+	FreeList = NewFreeElement;
+}
+
+bool FPagedFixedSizeAllocator::Contains(const void* Memory) const
+{
+	FScopeLock Lock(&CriticalSection);
+	return ContainsNoLock(Memory);
+}
+
+bool FPagedFixedSizeAllocator::ContainsNoLock(const void* Memory) const
+{
+	// find the last page starting at or before the memory
+	int32 Min = 0;
+	int32 Max = Pages.Num();
+	while (Min < Max)
+	{
+		const int32 Mid = (Min + Max) / 2;
+		if (Pages[Mid] <= (const uint8*)Memory)
+		{
+			Min = Mid + 1;
+		}
+		else
+		{
+			Max = Mid;
+		}
+	}
+	return Min > 0 && (const uint8*)Memory < Pages[Min - 1] + PageSize;
+}
+
+void FPagedFixedSizeAllocator::AddPage()
+{
+	uint8* Page = (uint8*)FMemory::Malloc(PageSize, PagedFixedSizeAllocatorAlignment);
+
+	int32 InsertIndex = Pages.Num();
+	while (InsertIndex > 0 && Pages[InsertIndex - 1] > Page)
+	{
+		--InsertIndex;
+	}
+	Pages.Insert(Page, InsertIndex);
+
+	PageTail = Page;
+	PageEnd = Page + PageSize;
+}
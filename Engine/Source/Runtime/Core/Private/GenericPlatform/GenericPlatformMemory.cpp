@@ -182,3 +182,15 @@ bool FGenericPlatformMemory::UnmapNamedSharedMemoryRegion(FSharedMemoryRegion *
 	UE_LOG(LogHAL, Error, TEXT("FGenericPlatformMemory::UnmapNamedSharedMemoryRegion not implemented on this platform"));
 	return false;
 }
+
+FGenericPlatformMemory::FMappedFile* FGenericPlatformMemory::MapFile(const TCHAR* Filename)
+{
+	// Callers are expected to fall back to regular reads
+	return NULL;
+}
+
+bool FGenericPlatformMemory::UnmapFile(FMappedFile* MappedFile)
+{
+	delete MappedFile;
+	return false;
+}
@@ -19,6 +19,8 @@ DEFINE_STAT(STAT_Binned_UsedPeak);
 DEFINE_STAT(STAT_Binned_CurrentAllocs);
 DEFINE_STAT(STAT_Binned_TotalAllocs);
 DEFINE_STAT(STAT_Binned_SlackCurrent);
+DEFINE_STAT(STAT_Binned_ThreadCachedCurrent);
+DEFINE_STAT(STAT_Binned_ThreadCacheHitRate);
 
 void FMallocBinned::GetAllocatorStats( FGenericMemoryStats& out_Stats )
 {
@@ -34,6 +36,7 @@ void FMallocBinned::GetAllocatorStats( FGenericMemoryStats& out_Stats )
 	SIZE_T	LocalCurrentAllocs = 0;
 	SIZE_T	LocalTotalAllocs = 0;
 	SIZE_T	LocalSlackCurrent = 0;
+	SIZE_T	LocalThreadCachedCurrent = 0;
 
 	{
 #ifdef USE_INTERNAL_LOCKS
@@ -52,6 +55,9 @@ void FMallocBinned::GetAllocatorStats( FGenericMemoryStats& out_Stats )
 		LocalCurrentAllocs = CurrentAllocs;
 		LocalTotalAllocs = TotalAllocs;
 		LocalSlackCurrent = SlackCurrent;
+#ifdef USE_THREAD_CACHE
+		LocalThreadCachedCurrent = ThreadCachedBytes;
+#endif
 	}
 
 	// Malloc binned stats.
@@ -64,6 +70,7 @@ void FMallocBinned::GetAllocatorStats( FGenericMemoryStats& out_Stats )
 	out_Stats.Add( GET_STATDESCRIPTION( STAT_Binned_CurrentAllocs ), LocalCurrentAllocs );
 	out_Stats.Add( GET_STATDESCRIPTION( STAT_Binned_TotalAllocs ), LocalTotalAllocs );
 	out_Stats.Add( GET_STATDESCRIPTION( STAT_Binned_SlackCurrent ), LocalSlackCurrent );
+	out_Stats.Add( GET_STATDESCRIPTION( STAT_Binned_ThreadCachedCurrent ), LocalThreadCachedCurrent );
 #endif // STATS
 }
 
@@ -82,4 +89,6 @@ void FMallocBinned::InitializeStatsMetadata()
 	GET_STATFNAME(STAT_Binned_CurrentAllocs);
 	GET_STATFNAME(STAT_Binned_TotalAllocs);
 	GET_STATFNAME(STAT_Binned_SlackCurrent);
+	GET_STATFNAME(STAT_Binned_ThreadCachedCurrent);
+	GET_STATFNAME(STAT_Binned_ThreadCacheHitRate);
 }
@@ -0,0 +1,149 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "MallocTagProxy.h"
+
+const TCHAR* FMemoryTags::GetTagName( EMemoryTag::Type Tag )
+{
+	switch( Tag )
+	{
+		case EMemoryTag::Untagged:		return TEXT( "Untagged" );
+		case EMemoryTag::Rendering:		return TEXT( "Rendering" );
+		case EMemoryTag::AHRVoxels:		return TEXT( "AHRVoxels" );
+		case EMemoryTag::Animation:		return TEXT( "Animation" );
+		case EMemoryTag::Navigation:	return TEXT( "Navigation" );
+		case EMemoryTag::Audio:			return TEXT( "Audio" );
+		default:						return TEXT( "Unknown" );
+	}
+}
+
+#if USE_MALLOC_TAGS
+
+DECLARE_MEMORY_STAT(TEXT("Untagged"),	STAT_MemoryTag_Untagged,	STATGROUP_MemoryTags);
+DECLARE_MEMORY_STAT(TEXT("Rendering"),	STAT_MemoryTag_Rendering,	STATGROUP_MemoryTags);
+DECLARE_MEMORY_STAT(TEXT("AHR Voxels"),	STAT_MemoryTag_AHRVoxels,	STATGROUP_MemoryTags);
+DECLARE_MEMORY_STAT(TEXT("Animation"),	STAT_MemoryTag_Animation,	STATGROUP_MemoryTags);
+DECLARE_MEMORY_STAT(TEXT("Navigation"),	STAT_MemoryTag_Navigation,	STATGROUP_MemoryTags);
+DECLARE_MEMORY_STAT(TEXT("Audio"),		STAT_MemoryTag_Audio,		STATGROUP_MemoryTags);
+
+uint32 FMemoryTags::TlsSlot = 0;
+
+FMallocTagProxy::FMallocTagProxy( FMalloc* InMalloc )
+	: UsedMalloc( InMalloc )
+	, bBudgetsRead( false )
+{
+	FMemory::Memzero( (void*)CurrentBytes, sizeof(CurrentBytes) );
+	FMemory::Memzero( PeakBytes, sizeof(PeakBytes) );
+	FMemory::Memzero( BudgetBytes, sizeof(BudgetBytes) );
+	FMemory::Memzero( bOverBudget, sizeof(bOverBudget) );
+
+	FMemoryTags::TlsSlot = FPlatformTLS::AllocTlsSlot();
+}
+
+void* FMallocTagProxy::Malloc( SIZE_T Size, uint32 Alignment )
+{
+	const uint32 HeaderSize = GetHeaderSize( Alignment );
+	return TrackAlloc( UsedMalloc->Malloc( Size + HeaderSize, HeaderSize ), Size, HeaderSize );
+}
+
+void* FMallocTagProxy::Realloc( void* Ptr, SIZE_T NewSize, uint32 Alignment )
+{
+	if( !Ptr )
+	{
+		return Malloc( NewSize, Alignment );
+	}
+
+	FAllocationHeader* Header = GetHeader( Ptr );
+	TrackFree( Header );
+
+	void* BasePtr = (uint8*)Ptr - Header->Offset;
+	if( NewSize == 0 )
+	{
+		UsedMalloc->Free( BasePtr );
+		return nullptr;
+	}
+
+	// The memory stays with the tag of the thread that reallocates it.
+	const uint32 HeaderSize = GetHeaderSize( Alignment );
+	if( HeaderSize == Header->Offset )
+	{
+		return TrackAlloc( UsedMalloc->Realloc( BasePtr, NewSize + HeaderSize, HeaderSize ), NewSize, HeaderSize );
+	}
+
+	// The alignment changed, the data has to move to a different offset.
+	const SIZE_T OldSize = (SIZE_T)Header->Size;
+	void* NewPtr = TrackAlloc( UsedMalloc->Malloc( NewSize + HeaderSize, HeaderSize ), NewSize, HeaderSize );
+	if( NewPtr )
+	{
+		FMemory::Memcpy( NewPtr, Ptr, FMath::Min( OldSize, NewSize ) );
+	}
+	UsedMalloc->Free( BasePtr );
+	return NewPtr;
+}
+
+void FMallocTagProxy::Free( void* Ptr )
+{
+	if( Ptr )
+	{
+		FAllocationHeader* Header = GetHeader( Ptr );
+		TrackFree( Header );
+		UsedMalloc->Free( (uint8*)Ptr - Header->Offset );
+	}
+}
+
+void FMallocTagProxy::ReadBudgets()
+{
+	for( int32 Tag = 0; Tag < EMemoryTag::Num; ++Tag )
+	{
+		int32 BudgetMB = 0;
+		GConfig->GetInt( TEXT( "MemoryTags" ), *FString::Printf( TEXT( "%sBudgetMB" ), FMemoryTags::GetTagName( (EMemoryTag::Type)Tag ) ), BudgetMB, GEngineIni );
+		BudgetBytes[Tag] = (int64)BudgetMB * 1024 * 1024;
+	}
+	bBudgetsRead = true;
+}
+
+void FMallocTagProxy::UpdateStats()
+{
+	UsedMalloc->UpdateStats();
+
+	if( !bBudgetsRead && GConfig && GConfig->IsReadyForUse() )
+	{
+		ReadBudgets();
+	}
+
+	for( int32 Tag = 0; Tag < EMemoryTag::Num; ++Tag )
+	{
+		const int64 Bytes = CurrentBytes[Tag];
+		PeakBytes[Tag] = FMath::Max( PeakBytes[Tag], Bytes );
+
+		const bool bOver = BudgetBytes[Tag] > 0 && Bytes > BudgetBytes[Tag];
+		UE_CLOG( bOver && !bOverBudget[Tag], LogMemory, Warning, TEXT( "Memory tag %s is over budget: %.2f MB allocated, %.2f MB budget" ),
+			FMemoryTags::GetTagName( (EMemoryTag::Type)Tag ), Bytes / 1024.0 / 1024.0, BudgetBytes[Tag] / 1024.0 / 1024.0 );
+		bOverBudget[Tag] = bOver;
+	}
+
+	SET_MEMORY_STAT( STAT_MemoryTag_Untagged, CurrentBytes[EMemoryTag::Untagged] );
+	SET_MEMORY_STAT( STAT_MemoryTag_Rendering, CurrentBytes[EMemoryTag::Rendering] );
+	SET_MEMORY_STAT( STAT_MemoryTag_AHRVoxels, CurrentBytes[EMemoryTag::AHRVoxels] );
+	SET_MEMORY_STAT( STAT_MemoryTag_Animation, CurrentBytes[EMemoryTag::Animation] );
+	SET_MEMORY_STAT( STAT_MemoryTag_Navigation, CurrentBytes[EMemoryTag::Navigation] );
+	SET_MEMORY_STAT( STAT_MemoryTag_Audio, CurrentBytes[EMemoryTag::Audio] );
+}
+
+bool FMallocTagProxy::Exec( UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar )
+{
+	if( FParse::Command( &Cmd, TEXT( "MEMTAGS" ) ) )
+	{
+		Ar.Logf( TEXT( "%-16s %12s %12s %12s" ), TEXT( "Tag" ), TEXT( "Current MB" ), TEXT( "Peak MB" ), TEXT( "Budget MB" ) );
+		for( int32 Tag = 0; Tag < EMemoryTag::Num; ++Tag )
+		{
+			Ar.Logf( TEXT( "%-16s %12.2f %12.2f %12.2f" ), FMemoryTags::GetTagName( (EMemoryTag::Type)Tag ),
+				CurrentBytes[Tag] / 1024.0 / 1024.0, PeakBytes[Tag] / 1024.0 / 1024.0, BudgetBytes[Tag] / 1024.0 / 1024.0 );
+		}
+		return true;
+	}
+
+	return UsedMalloc->Exec( InWorld, Cmd, Ar );
+}
+
+#endif // USE_MALLOC_TAGS
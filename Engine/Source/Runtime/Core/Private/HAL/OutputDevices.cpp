@@ -892,6 +892,124 @@ void FOutputDeviceRedirector::TearDown()
 	FOutputDevice subclasses.
 -----------------------------------------------------------------------------*/
 
+/**
+ * Writes the lines of a log file from a background thread, so that the threads that log don't wait on the disk.
+ * Lines are queued preformatted by any thread and written in batches, the archive is flushed after each batch.
+ * The queue has a single consumer and the archive isn't thread safe, so both are only touched under ArchiveCritical,
+ * either by the writer thread or by the callers of FlushSynchronously.
+ */
+class FAsyncLogWriter : public FRunnable
+{
+public:
+	FAsyncLogWriter( FArchive& InAr )
+	:	Ar( InAr )
+	,	bStopping( 0 )
+	,	bUnflushedData( false )
+	,	WorkEvent( FPlatformProcess::CreateSynchEvent() )
+	,	Thread( nullptr )
+	{
+		Thread = FRunnableThread::Create( this, TEXT("LogFileWriter"), 0, TPri_BelowNormal );
+	}
+
+	virtual ~FAsyncLogWriter()
+	{
+		if( Thread )
+		{
+			FPlatformAtomics::InterlockedExchange( &bStopping, 1 );
+			WorkEvent->Trigger();
+			Thread->WaitForCompletion();
+			delete Thread;
+			Thread = nullptr;
+		}
+		// Lines may have been queued after the writer thread last woke up.
+		FlushSynchronously();
+		delete WorkEvent;
+	}
+
+	/** @return false if the writer thread couldn't be created, in which case the lines have to be written synchronously. */
+	bool IsRunning() const
+	{
+		return Thread != nullptr;
+	}
+
+	/** Queues a line for the writer thread, takes ownership of it. */
+	void Enqueue( TArray<ANSICHAR>* Line )
+	{
+		// The line belongs to the writer thread once queued.
+		const int32 LineBytes = Line->Num();
+		const int32 OldQueuedBytes = QueuedBytes.Add( LineBytes );
+		const int32 NewQueuedBytes = OldQueuedBytes + LineBytes;
+		Lines.Enqueue( Line );
+
+		if( NewQueuedBytes >= MaxQueuedBytes )
+		{
+			// The writer thread can't keep up, write on this thread rather than growing the queue without bounds.
+			FlushSynchronously();
+		}
+		else if( NewQueuedBytes >= WakeUpQueuedBytes && OldQueuedBytes < WakeUpQueuedBytes )
+		{
+			WorkEvent->Trigger();
+		}
+	}
+
+	/** Writes all the queued lines and flushes the archive, on the calling thread. */
+	void FlushSynchronously()
+	{
+		FScopeLock ScopeLock( &ArchiveCritical );
+		WriteQueuedLines();
+		Ar.Flush();
+		bUnflushedData = false;
+	}
+
+	// FRunnable interface.
+	virtual uint32 Run() override
+	{
+		while( !bStopping )
+		{
+			WorkEvent->Wait( WriteIntervalMs );
+
+			FScopeLock ScopeLock( &ArchiveCritical );
+			WriteQueuedLines();
+			if( bUnflushedData )
+			{
+				Ar.Flush();
+				bUnflushedData = false;
+			}
+		}
+		return 0;
+	}
+
+private:
+	/** Writes the queued lines to the archive. Assumes the caller holds ArchiveCritical. */
+	void WriteQueuedLines()
+	{
+		TArray<ANSICHAR>* Line = nullptr;
+		while( Lines.Dequeue( Line ) )
+		{
+			Ar.Serialize( Line->GetData(), Line->Num() );
+			QueuedBytes.Subtract( Line->Num() );
+			delete Line;
+			bUnflushedData = true;
+		}
+	}
+
+	/** Time the writer thread waits between two batches, unless woken up by the amount of queued data. */
+	static const uint32 WriteIntervalMs = 100;
+	/** Amount of queued data that wakes up the writer thread before the end of its interval. */
+	static const int32 WakeUpQueuedBytes = 64 * 1024;
+	/** Amount of queued data past which the lines are written by the thread that logs. */
+	static const int32 MaxQueuedBytes = 16 * 1024 * 1024;
+
+	FArchive& Ar;
+	FCriticalSection ArchiveCritical;
+	TQueue<TArray<ANSICHAR>*, EQueueMode::Mpsc> Lines;
+	FThreadSafeCounter QueuedBytes;
+	volatile int32 bStopping;
+	bool bUnflushedData;
+	FEvent* WorkEvent;
+	FRunnableThread* Thread;
+};
+
 /** 
  * Constructor, initializing member variables.
  *
@@ -900,6 +1018,7 @@ void FOutputDeviceRedirector::TearDown()
  */
 FOutputDeviceFile::FOutputDeviceFile( const TCHAR* InFilename, bool bInDisableBackup  )
 :	LogAr( NULL ),
+	AsyncWriter( nullptr ),
 	Opened( 0 ),
 	Dead( 0 ),
 	bDisableBackup(bInDisableBackup)
@@ -935,6 +1054,9 @@ void FOutputDeviceFile::TearDown()
 		{
 			Logf( TEXT("Log file closed, %s"), FPlatformTime::StrTimestamp() );
 		}
+		// Writes the lines still queued before the archive goes away.
+		delete AsyncWriter;
+		AsyncWriter = nullptr;
 		delete LogAr;
 		LogAr = NULL;
 	}
@@ -946,7 +1068,11 @@ void FOutputDeviceFile::TearDown()
  */
 void FOutputDeviceFile::Flush()
 {
-	if( LogAr )
+	if( AsyncWriter )
+	{
+		AsyncWriter->FlushSynchronously();
+	}
+	else if( LogAr )
 	{
 		LogAr->Flush();
 	}
@@ -1012,32 +1138,45 @@ FArchive* FOutputDeviceFile::CreateArchive(uint32 MaxAttempts)
 	return Result;
 }
 
-void FOutputDeviceFile::CastAndSerializeData(const TCHAR* Data)
+void FOutputDeviceFile::CastAndAppendData(TArray<ANSICHAR>& Line, const TCHAR* Data)
 {
 	auto ConvertedData = FTCHARToUTF8(Data);
-	LogAr->Serialize((ANSICHAR*)(ConvertedData.Get()), ConvertedData.Length());
+	Line.Append((ANSICHAR*)(ConvertedData.Get()), ConvertedData.Length());
 }
 
 void FOutputDeviceFile::WriteDataToArchive(const TCHAR* Data, ELogVerbosity::Type Verbosity, const class FName& Category)
 {
+	// The line is formatted on the calling thread, so that the writer only has bytes to copy to the archive.
+	TArray<ANSICHAR>* Line = new TArray<ANSICHAR>();
+
 	if (!bSuppressEventTag)
 	{
 		FString Prefix = FOutputDevice::FormatLogLine(Verbosity, Category, NULL, GPrintLogTimes);
-		CastAndSerializeData(*Prefix);
+		CastAndAppendData(*Line, *Prefix);
 	}
 
-	CastAndSerializeData(Data);
+	CastAndAppendData(*Line, Data);
 
 	if (bAutoEmitLineTerminator)
 	{
 #if PLATFORM_LINUX
 		// on Linux, we still want to have logs with Windows line endings so they can be opened with Windows tools like infamous notepad.exe
-		ANSICHAR WindowsTerminator[] = { '\r', '\n' };
-		LogAr->Serialize(WindowsTerminator, sizeof(WindowsTerminator));
+		Line->Add('\r');
+		Line->Add('\n');
 #else
-		CastAndSerializeData(LINE_TERMINATOR);
+		CastAndAppendData(*Line, LINE_TERMINATOR);
 #endif // PLATFORM_LINUX
 	}
+
+	if (AsyncWriter)
+	{
+		AsyncWriter->Enqueue(Line);
+	}
+	else
+	{
+		LogAr->Serialize(Line->GetData(), Line->Num());
+		delete Line;
+	}
 }
 
 /**
@@ -1050,6 +1189,15 @@ void FOutputDeviceFile::Serialize( const TCHAR* Data, ELogVerbosity::Type Verbos
 {
 #if ALLOW_LOG_FILE && !NO_LOGGING
 	static bool Entry=false;
+	static bool GForceLogFlush = false;
+	static bool GTestedCmdLine = false;
+	if (!GTestedCmdLine)
+	{
+		GTestedCmdLine = true;
+		// Force a log flush after each line
+		GForceLogFlush = FParse::Param( FCommandLine::Get(), TEXT("FORCELOGFLUSH") );
+	}
+
 	if( !GIsCriticalError || Entry )
 	{
 		if( !LogAr && !Dead )
@@ -1075,6 +1223,20 @@ void FOutputDeviceFile::Serialize( const TCHAR* Data, ELogVerbosity::Type Verbos
 
 				WriteByteOrderMarkToArchive(EByteOrderMark::UTF8);
 
+				// Lines are written from a background thread unless every line has to be flushed anyway, or -NOLOGTHREAD is passed.
+				if (!GForceLogFlush && FPlatformProcess::SupportsMultithreading() && !FParse::Param(FCommandLine::Get(), TEXT("NOLOGTHREAD")))
+				{
+					FAsyncLogWriter* Writer = new FAsyncLogWriter(*LogAr);
+					if (Writer->IsRunning())
+					{
+						AsyncWriter = Writer;
+					}
+					else
+					{
+						delete Writer;
+					}
+				}
+
 				if (!bSuppressEventTag)
 				{
 					Logf( TEXT("Log file open, %s"), FPlatformTime::StrTimestamp() );
@@ -1090,17 +1252,10 @@ void FOutputDeviceFile::Serialize( const TCHAR* Data, ELogVerbosity::Type Verbos
 		{
 			WriteDataToArchive(Data, Verbosity, Category);
 
-			static bool GForceLogFlush = false;
-			static bool GTestedCmdLine = false;
-			if (!GTestedCmdLine)
-			{
-				GTestedCmdLine = true;
-				// Force a log flush after each line
-				GForceLogFlush = FParse::Param( FCommandLine::Get(), TEXT("FORCELOGFLUSH") );
-			}
-			if( GForceLogFlush )
+			// Fatal errors and crashes may not leave the writer thread the time to write the line, so they reach the disk before returning.
+			if( GForceLogFlush || Verbosity == ELogVerbosity::Fatal || GIsCriticalError )
 			{
-				LogAr->Flush();
+				Flush();
 			}
 		}
 	}
@@ -22,6 +22,8 @@ uint32 FRunnableThreadPThread::Run()
 		ExitCode = Runnable->Run();
 		// Allow any allocated resources to be cleaned up
 		Runnable->Exit();
+		// Give back the memory the allocator cached for this thread
+		FMemory::FlushCurrentThreadCache();
 	}
 	else
 	{
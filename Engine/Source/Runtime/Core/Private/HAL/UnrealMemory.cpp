@@ -14,6 +14,7 @@
 #include "MallocProfiler.h"
 #include "MallocThreadSafeProxy.h"
 #include "MallocCrash.h"
+#include "MallocTagProxy.h"
 #include "StatsMallocProfilerProxy.h"
 
 
@@ -41,6 +42,11 @@ void GCreateMalloc()
 		GMalloc = new FMallocThreadSafeProxy( GMalloc );
 	}
 
+#if USE_MALLOC_TAGS
+	// Wraps the thread safe allocator, the tag counters are updated atomically.
+	GMalloc = new FMallocTagProxy( GMalloc );
+#endif
+
 
 
 #if	STATS
@@ -91,6 +97,22 @@ SIZE_T FMemory::GetAllocSize( void* Original )
 	return GMalloc->GetAllocationSize( Original, Size ) ? Size : 0;
 }
 
+void FMemory::FlushCurrentThreadCache()
+{
+	if( GMalloc )
+	{
+		GMalloc->FlushCurrentThreadCache();
+	}
+}
+
+void FMemory::Trim()
+{
+	if( GMalloc )
+	{
+		GMalloc->Trim();
+	}
+}
+
 void FMemory::TestMemory()
 {
 #if !UE_BUILD_SHIPPING
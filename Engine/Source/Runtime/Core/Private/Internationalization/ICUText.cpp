@@ -218,6 +218,86 @@ bool FText::FSortPredicate::operator()(const FText& A, const FText& B) const
 	return Implementation->Compare(A, B);
 }
 
+/**
+ * Compiled format patterns, by pattern string, so that a pattern is only parsed by ICU the first time it is formatted.
+ * The formatters are created for the current culture, so they are all dropped when the culture changes.
+ * ICU formatters aren't guaranteed to be thread safe, so a formatter is only used under the lock of the cache.
+ */
+class FICUMessageFormatCache
+{
+public:
+	static FICUMessageFormatCache& Get()
+	{
+		// Never destroyed, texts may still be formatted while static objects go away
+		static FICUMessageFormatCache* Singleton = new FICUMessageFormatCache();
+		return *Singleton;
+	}
+
+	/** Formats the arguments with the cached formatter of the pattern, compiling it if it's not cached yet. */
+	void Format(const FString& PatternString, const icu::UnicodeString* ArgumentNames, const icu::Formattable* ArgumentValues, const int32 ArgumentCount, icu::UnicodeString& OutResult, UErrorCode& OutStatus)
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+
+		const TSharedRef<icu::MessageFormat>* CachedFormatter = Formatters.Find(PatternString);
+		if (CachedFormatter == nullptr)
+		{
+			icu::UnicodeString ICUPatternString;
+			ICUUtilities::ConvertString(PatternString, ICUPatternString);
+
+			UParseError ICUParseError;
+			TSharedRef<icu::MessageFormat> NewFormatter = MakeShareable(new icu::MessageFormat(ICUPatternString, icu::Locale::getDefault(), ICUParseError, OutStatus));
+			if (U_FAILURE(OutStatus))
+			{
+				// Invalid patterns aren't cached, they are expected to be fixed rather than formatted often
+				return;
+			}
+
+			if (Formatters.Num() >= MaxCachedFormatters)
+			{
+				// Patterns built at runtime could otherwise grow the cache without bounds
+				Formatters.Empty();
+			}
+			CachedFormatter = &Formatters.Add(PatternString, NewFormatter);
+		}
+
+		(*CachedFormatter)->format(ArgumentNames, ArgumentValues, ArgumentCount, OutResult, OutStatus);
+	}
+
+private:
+	FICUMessageFormatCache()
+	{
+		FInternationalization::Get().OnCultureChanged().AddRaw(this, &FICUMessageFormatCache::HandleCultureChanged);
+	}
+
+	void HandleCultureChanged()
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		Formatters.Empty();
+	}
+
+	static const int32 MaxCachedFormatters = 4096;
+
+	/** Patterns that only differ by case format differently, so they can't share a formatter */
+	struct FPatternKeyFuncs : BaseKeyFuncs<TSharedRef<icu::MessageFormat>, FString, false>
+	{
+		static FORCEINLINE const FString& GetSetKey(const TPair<FString, TSharedRef<icu::MessageFormat>>& Element)
+		{
+			return Element.Key;
+		}
+		static FORCEINLINE bool Matches(const FString& A, const FString& B)
+		{
+			return A.Equals(B, ESearchCase::CaseSensitive);
+		}
+		static FORCEINLINE uint32 GetKeyHash(const FString& Key)
+		{
+			return FCrc::StrCrc32<TCHAR>(*Key);
+		}
+	};
+
+	FCriticalSection CriticalSection;
+	TMap<FString, TSharedRef<icu::MessageFormat>, FDefaultSetAllocator, FPatternKeyFuncs> Formatters;
+};
+
 void FText::GetFormatPatternParameters(const FText& Pattern, TArray<FString>& ParameterNames)
 {
 	UErrorCode ICUStatus = U_ZERO_ERROR;
@@ -324,19 +404,10 @@ FText FText::FormatInternal(const FText& Pattern, const FFormatNamedArguments& A
 	}
 
 	const FString& NativePatternString = bInRebuildAsSource? Pattern.BuildSourceString() : Pattern.ToString();
-	icu::UnicodeString ICUPatternString;
-	ICUUtilities::ConvertString(NativePatternString, ICUPatternString);
 
 	UErrorCode ICUStatus = U_ZERO_ERROR;
-	UParseError ICUParseError;
-	icu::MessageFormat ICUMessageFormatter(ICUPatternString, icu::Locale::getDefault(), ICUParseError, ICUStatus);
-	if(U_FAILURE(ICUStatus))
-	{
-		return bEnableErrorResults ? FText::FromString(u_errorName(ICUStatus)) : FText();
-	}
-
 	icu::UnicodeString ICUResultString;
-	ICUMessageFormatter.format(ArgumentNames.GetData(), ArgumentValues.GetData(), Arguments.Num(), ICUResultString, ICUStatus);
+	FICUMessageFormatCache::Get().Format(NativePatternString, ArgumentNames.GetData(), ArgumentValues.GetData(), Arguments.Num(), ICUResultString, ICUStatus);
 	if(U_FAILURE(ICUStatus))
 	{
 		return bEnableErrorResults ? FText::FromString(u_errorName(ICUStatus)) : FText();
@@ -345,7 +416,7 @@ FText FText::FormatInternal(const FText& Pattern, const FFormatNamedArguments& A
 	FString NativeResultString;
 	ICUUtilities::ConvertString(ICUResultString, NativeResultString);
 
-	FText ResultText(NativeResultString);
+	FText ResultText(MoveTemp(NativeResultString));
 	ResultText.History = MakeShareable(new FTextHistory_NamedFormat(Pattern, Arguments));
 
 	return ResultText;
@@ -405,19 +476,10 @@ FText FText::FormatInternal(const FText& Pattern, const FFormatOrderedArguments&
 	}
 
 	const FString& NativePatternString = bInRebuildAsSource? Pattern.BuildSourceString() : Pattern.ToString();
-	icu::UnicodeString ICUPatternString;
-	ICUUtilities::ConvertString(NativePatternString, ICUPatternString);
 
 	UErrorCode ICUStatus = U_ZERO_ERROR;
-	UParseError ICUParseError;
-	icu::MessageFormat ICUMessageFormatter(ICUPatternString, icu::Locale::getDefault(), ICUParseError, ICUStatus);
-	if(U_FAILURE(ICUStatus))
-	{
-		return bEnableErrorResults ? FText::FromString(u_errorName(ICUStatus)) : FText();
-	}
-
 	icu::UnicodeString ICUResultString;
-	ICUMessageFormatter.format(NULL, ArgumentValues.GetData(), Arguments.Num(), ICUResultString, ICUStatus);
+	FICUMessageFormatCache::Get().Format(NativePatternString, NULL, ArgumentValues.GetData(), Arguments.Num(), ICUResultString, ICUStatus);
 	if(U_FAILURE(ICUStatus))
 	{
 		return bEnableErrorResults ? FText::FromString(u_errorName(ICUStatus)) : FText();
@@ -426,7 +488,7 @@ FText FText::FormatInternal(const FText& Pattern, const FFormatOrderedArguments&
 	FString NativeResultString;
 	ICUUtilities::ConvertString(ICUResultString, NativeResultString);
 
-	FText ResultText = FText(NativeResultString);
+	FText ResultText = FText(MoveTemp(NativeResultString));
 
 	if (!GIsEditor)
 	{
@@ -499,19 +561,10 @@ FText FText::FormatInternal(const FText& Pattern, const TArray< FFormatArgumentD
 	}
 
 	const FString& PatternString = bInRebuildAsSource? Pattern.BuildSourceString() : Pattern.ToString();
-	icu::UnicodeString ICUPatternString;
-	ICUUtilities::ConvertString(PatternString, ICUPatternString, false);
 
 	UErrorCode ICUStatus = U_ZERO_ERROR;
-	UParseError ICUParseError;
-	icu::MessageFormat ICUMessageFormatter(ICUPatternString, icu::Locale::getDefault(), ICUParseError, ICUStatus);
-	if(U_FAILURE(ICUStatus))
-	{
-		return bEnableErrorResults ? FText::FromString(u_errorName(ICUStatus)) : FText();
-	}
-
 	icu::UnicodeString Result;
-	ICUMessageFormatter.format(ArgumentNames.GetData(), ArgumentValues.GetData(), InArguments.Num(), Result, ICUStatus);
+	FICUMessageFormatCache::Get().Format(PatternString, ArgumentNames.GetData(), ArgumentValues.GetData(), InArguments.Num(), Result, ICUStatus);
 	if(U_FAILURE(ICUStatus))
 	{
 		return bEnableErrorResults ? FText::FromString(u_errorName(ICUStatus)) : FText();
@@ -520,7 +573,7 @@ FText FText::FormatInternal(const FText& Pattern, const TArray< FFormatArgumentD
 	FString NativeResultString;
 	ICUUtilities::ConvertString(Result, NativeResultString);
 
-	FText ResultText = FText(NativeResultString);
+	FText ResultText = FText(MoveTemp(NativeResultString));
 
 	if (!GIsEditor)
 	{
@@ -22,10 +22,12 @@ FText FText::AsNumberTemplate(T1 Val, const FNumberFormattingOptions* const Opti
 	icu::UnicodeString FormattedString;
 	ICUDecimalFormat->format(FormattableVal, FormattedString, ICUStatus);
 
+	// Formatted numbers usually fit in the inline buffer of icu::UnicodeString, so the display string, moved into the text,
+	// is the only allocation
 	FString NativeString;
 	ICUUtilities::ConvertString(FormattedString, NativeString);
 
-	FText ReturnText = FText::CreateNumericalText(NativeString);
+	FText ReturnText = FText::CreateNumericalText(MoveTemp(NativeString));
 	ReturnText.History = MakeShareable(new FTextHistory_AsNumber(Val, Options, TargetCulture));
 	return ReturnText;
 }
@@ -45,7 +47,7 @@ FText FText::AsCurrencyTemplate(T1 Val, const FString& CurrencyCode, const FNumb
 	FString NativeString;
 	ICUUtilities::ConvertString(FormattedString, NativeString);
 
-	FText ReturnText = FText::CreateNumericalText(NativeString);
+	FText ReturnText = FText::CreateNumericalText(MoveTemp(NativeString));
 	ReturnText.History = MakeShareable(new FTextHistory_AsCurrency(Val, CurrencyCode, Options, TargetCulture));
 	return ReturnText;
 }
@@ -65,7 +67,7 @@ FText FText::AsPercentTemplate(T1 Val, const FNumberFormattingOptions* const Opt
 	FString NativeString;
 	ICUUtilities::ConvertString(FormattedString, NativeString);
 
-	FText ReturnText = FText::CreateNumericalText(NativeString);
+	FText ReturnText = FText::CreateNumericalText(MoveTemp(NativeString));
 	ReturnText.History = MakeShareable(new FTextHistory_AsPercent(Val, Options, TargetCulture));
 	return ReturnText;
 }
\ No newline at end of file
@@ -4,42 +4,41 @@
 
 #if UE_ENABLE_ICU
 #include "ICUUtilities.h"
-#include <unicode/ucnv.h>
+#include <unicode/ustring.h>
 
 namespace ICUUtilities
 {
+	/** Substitute for the code units that can't be converted, the same as the one used by the converters */
+	static const UChar32 ReplacementChar = 0xFFFD;
+
 	void ConvertString(const FString& Source, icu::UnicodeString& Destination, const bool ShouldNullTerminate)
 	{
+		// TCHAR is either UTF-16 or UTF-32, both can be converted without opening a converter, which is expensive
+		// compared to the conversion of the short strings texts are usually made of
 		if( Source.Len() )
 		{
-			const char* const SourceEncoding = FPlatformString::GetEncodingName();
-	
+#if PLATFORM_TCHAR_IS_4_BYTES
+			const int32_t DestinationCapacityUChars = Source.Len() * 2;
+			UChar* InternalStringBuffer = Destination.getBuffer(DestinationCapacityUChars + 1);
+
 			UErrorCode ICUStatus = U_ZERO_ERROR;
-		
-			UConverter* ICUConverter = ucnv_open(SourceEncoding, &ICUStatus);
-			if( U_SUCCESS(ICUStatus) ) 
+			int32_t DestinationLength = 0;
+			u_strFromUTF32WithSub(InternalStringBuffer, DestinationCapacityUChars, &DestinationLength, reinterpret_cast<const UChar32*>(*Source), Source.Len(), ReplacementChar, nullptr, &ICUStatus);
+			check( U_SUCCESS(ICUStatus) );
+#else
+			const int32_t DestinationLength = Source.Len();
+			UChar* InternalStringBuffer = Destination.getBuffer(DestinationLength + 1);
+			FMemory::Memcpy(InternalStringBuffer, *Source, DestinationLength * sizeof(UChar));
+#endif
+
+			// Optionally null terminate the string
+			if( ShouldNullTerminate )
 			{
-				// Get the internal buffer of the string, we're going to use it as scratch space
-				const int32_t DestinationCapacityUChars = Source.Len() * 2;
-				UChar* InternalStringBuffer = Destination.getBuffer(DestinationCapacityUChars);
-
-				// Perform the conversion into the string buffer
-				const int32_t SourceSizeBytes = Source.Len() * sizeof(TCHAR);
-				const int32_t DestinationLength = ucnv_toUChars(ICUConverter, InternalStringBuffer, DestinationCapacityUChars, reinterpret_cast<const char*>(*Source), SourceSizeBytes, &ICUStatus);
-
-				// Optionally null terminate the string
-				if( ShouldNullTerminate )
-				{
-					InternalStringBuffer[DestinationLength] = 0;
-				}
-
-				// Size it back down to the correct size and release our lock on the string buffer
-				Destination.releaseBuffer(DestinationLength);
-
-				ucnv_close(ICUConverter);
+				InternalStringBuffer[DestinationLength] = 0;
 			}
 
-			check( U_SUCCESS(ICUStatus) );
+			// Size it back down to the correct size and release our lock on the string buffer
+			Destination.releaseBuffer(DestinationLength);
 		}
 		else
 		{
@@ -58,31 +57,26 @@ namespace ICUUtilities
 	{
 		if( Source.length() )
 		{
-			const char* const DestinationEncoding = FPlatformString::GetEncodingName();
+			// Sized for the converted string only, so that the FString doesn't keep any slack
+			TArray<TCHAR>& InternalStringBuffer = Destination.GetCharArray();
+#if PLATFORM_TCHAR_IS_4_BYTES
+			// A UTF-32 string never has more code points than its UTF-16 version has code units
+			const int32 DestinationCapacityTCHARs = Source.length();
+			InternalStringBuffer.Empty(DestinationCapacityTCHARs + 1);
+			InternalStringBuffer.SetNumUninitialized(DestinationCapacityTCHARs + 1);
 
 			UErrorCode ICUStatus = U_ZERO_ERROR;
-
-			UConverter* ICUConverter = ucnv_open(DestinationEncoding, &ICUStatus);
-			if( U_SUCCESS(ICUStatus) ) 
-			{
-				// Get the internal buffer of the string, we're going to use it as scratch space
-				TArray<TCHAR>& InternalStringBuffer = Destination.GetCharArray();
-				
-				// Work out the maximum size required and resize the buffer so it can hold enough data
-				const int32_t DestinationCapacityBytes = UCNV_GET_MAX_BYTES_FOR_STRING(Source.length(), ucnv_getMaxCharSize(ICUConverter));
-				const int32 DestinationCapacityTCHARs = DestinationCapacityBytes / sizeof(TCHAR);
-				InternalStringBuffer.SetNumUninitialized(DestinationCapacityTCHARs);
-
-				// Perform the conversion into the string buffer, and then null terminate the FString and size it back down to the correct size
-				const int32_t DestinationSizeBytes = ucnv_fromUChars(ICUConverter, reinterpret_cast<char*>(InternalStringBuffer.GetData()), DestinationCapacityBytes, Source.getBuffer(), Source.length(), &ICUStatus);
-				const int32 DestinationSizeTCHARs = DestinationSizeBytes / sizeof(TCHAR);
-				InternalStringBuffer[DestinationSizeTCHARs] = 0;
-				InternalStringBuffer.SetNumUninitialized(DestinationSizeTCHARs + 1); // the array size includes null
-
-				ucnv_close(ICUConverter);
-			}
-
+			int32_t DestinationSizeTCHARs = 0;
+			u_strToUTF32WithSub(reinterpret_cast<UChar32*>(InternalStringBuffer.GetData()), DestinationCapacityTCHARs, &DestinationSizeTCHARs, Source.getBuffer(), Source.length(), ReplacementChar, nullptr, &ICUStatus);
 			check( U_SUCCESS(ICUStatus) );
+#else
+			const int32 DestinationSizeTCHARs = Source.length();
+			InternalStringBuffer.Empty(DestinationSizeTCHARs + 1);
+			InternalStringBuffer.SetNumUninitialized(DestinationSizeTCHARs + 1);
+			FMemory::Memcpy(InternalStringBuffer.GetData(), Source.getBuffer(), DestinationSizeTCHARs * sizeof(TCHAR));
+#endif
+			InternalStringBuffer[DestinationSizeTCHARs] = 0;
+			InternalStringBuffer.RemoveAt(DestinationSizeTCHARs + 1, InternalStringBuffer.Num() - (DestinationSizeTCHARs + 1), false); // the array size includes null
 		}
 		else
 		{
@@ -11,6 +11,8 @@
 #include <sys/sysinfo.h>
 #include <sys/file.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
 #include <unistd.h>		// sysconf
 
 void FLinuxPlatformMemory::Init()
@@ -265,3 +267,59 @@ bool FLinuxPlatformMemory::UnmapNamedSharedMemoryRegion(FSharedMemoryRegion * Me
 
 	return bAllSucceeded;
 }
+
+FPlatformMemory::FMappedFile* FLinuxPlatformMemory::MapFile(const TCHAR* Filename)
+{
+	const FString FullFilename = FPaths::ConvertRelativePathToFull(Filename);
+	FTCHARToUTF8 FilenameUTF8(*FullFilename);
+	int Fd = open(FilenameUTF8.Get(), O_RDONLY);
+	if (Fd == -1)
+	{
+		int ErrNo = errno;
+		UE_LOG(LogHAL, Warning, TEXT("open(file='%s', O_RDONLY) failed with errno = %d (%s)"), *FullFilename, ErrNo, 
+			StringCast< TCHAR >(strerror(ErrNo)).Get());
+		return NULL;
+	}
+
+	struct stat FileInfo;
+	if (fstat(Fd, &FileInfo) == -1 || FileInfo.st_size == 0)
+	{
+		close(Fd);
+		return NULL;
+	}
+
+	// MAP_SHARED so that processes mapping the same file share the page cache pages
+	void* Ptr = mmap(NULL, FileInfo.st_size, PROT_READ, MAP_SHARED, Fd, 0);
+	close(Fd);
+	if (Ptr == MAP_FAILED)
+	{
+		int ErrNo = errno;
+		UE_LOG(LogHAL, Warning, TEXT("mmap(file='%s', length=%lld, prot=PROT_READ, flags=MAP_SHARED) failed with errno = %d (%s)"), *FullFilename, (int64)FileInfo.st_size, ErrNo, 
+			StringCast< TCHAR >(strerror(ErrNo)).Get());
+		return NULL;
+	}
+
+	// The descriptor is not needed anymore, the mapping keeps the file alive
+	return new FMappedFile((const uint8*)Ptr, FileInfo.st_size);
+}
+
+bool FLinuxPlatformMemory::UnmapFile(FMappedFile* MappedFile)
+{
+	bool bAllSucceeded = true;
+
+	if (MappedFile)
+	{
+		if (munmap(const_cast< uint8* >(MappedFile->GetData()), MappedFile->GetSize()) == -1)
+		{
+			bAllSucceeded = false;
+
+			int ErrNo = errno;
+			UE_LOG(LogHAL, Warning, TEXT("munmap(addr=%p, len=%lld) failed with errno = %d (%s)"), MappedFile->GetData(), MappedFile->GetSize(), ErrNo, 
+				StringCast< TCHAR >(strerror(ErrNo)).Get());
+		}
+
+		delete MappedFile;
+	}
+
+	return bAllSucceeded;
+}
@@ -61,6 +61,375 @@ bool appUncompressMemoryZLIB( void* UncompressedBuffer, int32 UncompressedSize,
 	return bOperationSucceeded;
 }
 
+/*-----------------------------------------------------------------------------
+	LZ4.
+-----------------------------------------------------------------------------*/
+
+/**
+ * LZ4 block format: sequences of a token, literals and a match. The high nibble of the token is the number
+ * of literals and the low nibble the match length minus LZ4_MIN_MATCH, 15 meaning more length bytes follow,
+ * each adding up to 255. The match is a 16 bit little endian offset back into the output. The last sequence
+ * only has literals.
+ */
+#define LZ4_MIN_MATCH		4
+/** The last bytes are always literals, so the decoder can copy them without checking for an end of match. */
+#define LZ4_LAST_LITERALS	5
+/** No match starts in the last bytes of the input. */
+#define LZ4_MATCH_LIMIT		12
+#define LZ4_MAX_OFFSET		65535
+#define LZ4_HASH_LOG		12
+
+static FORCEINLINE uint32 LZ4Read32( const uint8* Ptr )
+{
+	uint32 Value;
+	FMemory::Memcpy( &Value, Ptr, sizeof(Value) );
+	return Value;
+}
+
+static FORCEINLINE uint32 LZ4Hash( uint32 Sequence )
+{
+	return ( Sequence * 2654435761U ) >> ( 32 - LZ4_HASH_LOG );
+}
+
+/** Writes a length that doesn't fit in its nibble of the token, in bytes of up to 255. */
+static FORCEINLINE uint8* LZ4WriteLength( uint8* Op, int32 Length )
+{
+	for( ; Length >= 255; Length -= 255 )
+	{
+		*Op++ = 255;
+	}
+	*Op++ = (uint8)Length;
+	return Op;
+}
+
+/** Writes the literals from Anchor to Ip, followed by a match of MatchLength bytes at Offset if MatchLength isn't 0. */
+static FORCEINLINE uint8* LZ4WriteSequence( uint8* Op, const uint8* Anchor, const uint8* Ip, int32 Offset, int32 MatchLength )
+{
+	uint8* Token = Op++;
+	const int32 NumLiterals = Ip - Anchor;
+	if( NumLiterals >= 15 )
+	{
+		*Token = 15 << 4;
+		Op = LZ4WriteLength( Op, NumLiterals - 15 );
+	}
+	else
+	{
+		*Token = (uint8)( NumLiterals << 4 );
+	}
+	FMemory::Memcpy( Op, Anchor, NumLiterals );
+	Op += NumLiterals;
+
+	if( MatchLength > 0 )
+	{
+		*Op++ = (uint8)Offset;
+		*Op++ = (uint8)( Offset >> 8 );
+
+		const int32 MatchCode = MatchLength - LZ4_MIN_MATCH;
+		if( MatchCode >= 15 )
+		{
+			*Token |= 15;
+			Op = LZ4WriteLength( Op, MatchCode - 15 );
+		}
+		else
+		{
+			*Token |= (uint8)MatchCode;
+		}
+	}
+	return Op;
+}
+
+/** @return the bytes needed by a sequence in the worst case */
+static FORCEINLINE int32 LZ4SequenceBound( int32 NumLiterals, int32 MatchLength )
+{
+	return 1 + NumLiterals + NumLiterals / 255 + 1 + 2 + MatchLength / 255 + 1;
+}
+
+static int32 appCompressMemoryBoundLZ4( int32 UncompressedSize )
+{
+	return UncompressedSize + UncompressedSize / 255 + 16;
+}
+
+DECLARE_CYCLE_STAT(TEXT("Compress Memory LZ4"),Stat_appCompressMemoryLZ4,STATGROUP_Engine);
+
+/** Greedy compressor finding matches with a hash table of the last position of each 4 byte sequence. */
+static bool appCompressMemoryLZ4( void* CompressedBuffer, int32& CompressedSize, const void* UncompressedBuffer, int32 UncompressedSize )
+{
+	SCOPE_CYCLE_COUNTER( Stat_appCompressMemoryLZ4 );
+
+	const uint8* const Src = (const uint8*)UncompressedBuffer;
+	const uint8* const SrcEnd = Src + UncompressedSize;
+	const uint8* const MatchStartLimit = SrcEnd - LZ4_MATCH_LIMIT;
+	const uint8* const MatchEndLimit = SrcEnd - LZ4_LAST_LITERALS;
+	uint8* Op = (uint8*)CompressedBuffer;
+	uint8* const OpEnd = Op + CompressedSize;
+
+	const uint8* Ip = Src;
+	const uint8* Anchor = Src;
+
+	if( UncompressedSize > LZ4_MATCH_LIMIT )
+	{
+		// Positions relative to Src, the ones never set point at Src which is always before Ip.
+		uint32 HashTable[1 << LZ4_HASH_LOG];
+		FMemory::Memzero( HashTable, sizeof(HashTable) );
+
+		while( Ip <= MatchStartLimit )
+		{
+			const uint32 Sequence = LZ4Read32( Ip );
+			const uint32 Hash = LZ4Hash( Sequence );
+			const uint8* Match = Src + HashTable[Hash];
+			HashTable[Hash] = Ip - Src;
+
+			if( Match >= Ip || Ip - Match > LZ4_MAX_OFFSET || LZ4Read32( Match ) != Sequence )
+			{
+				// Skip faster through data that doesn't compress.
+				Ip += 1 + ( ( Ip - Anchor ) >> 6 );
+				continue;
+			}
+
+			// Extend the match backwards over the pending literals, then forwards.
+			while( Ip > Anchor && Match > Src && Ip[-1] == Match[-1] )
+			{
+				--Ip;
+				--Match;
+			}
+			int32 MatchLength = LZ4_MIN_MATCH;
+			while( Ip + MatchLength < MatchEndLimit && Ip[MatchLength] == Match[MatchLength] )
+			{
+				++MatchLength;
+			}
+
+			if( Op + LZ4SequenceBound( Ip - Anchor, MatchLength ) > OpEnd )
+			{
+				return false;
+			}
+			Op = LZ4WriteSequence( Op, Anchor, Ip, Ip - Match, MatchLength );
+
+			Ip += MatchLength;
+			Anchor = Ip;
+
+			// Remember a position inside the match too, repetitive data finds its next match there.
+			if( Ip <= MatchStartLimit )
+			{
+				HashTable[LZ4Hash( LZ4Read32( Ip - 2 ) )] = Ip - 2 - Src;
+			}
+		}
+	}
+
+	// Last literals.
+	if( Op + LZ4SequenceBound( SrcEnd - Anchor, 0 ) > OpEnd )
+	{
+		return false;
+	}
+	Op = LZ4WriteSequence( Op, Anchor, SrcEnd, 0, 0 );
+
+	CompressedSize = Op - (uint8*)CompressedBuffer;
+	return true;
+}
+
+DECLARE_CYCLE_STAT(TEXT("Uncompress Memory LZ4"),Stat_appUncompressMemoryLZ4,STATGROUP_Engine);
+
+/** Reads a length that didn't fit in its nibble of the token, @return false if it goes past the end of the input */
+static FORCEINLINE bool LZ4ReadLength( const uint8*& Ip, const uint8* IpEnd, int32& Length )
+{
+	uint8 Byte;
+	do
+	{
+		if( Ip >= IpEnd )
+		{
+			return false;
+		}
+		Byte = *Ip++;
+		Length += Byte;
+	}
+	while( Byte == 255 );
+	return true;
+}
+
+/** Checks every length and offset, corrupted data makes it fail instead of writing out of the buffer. */
+static bool appUncompressMemoryLZ4( void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize )
+{
+	SCOPE_CYCLE_COUNTER( Stat_appUncompressMemoryLZ4 );
+
+	const uint8* Ip = (const uint8*)CompressedBuffer;
+	const uint8* const IpEnd = Ip + CompressedSize;
+	uint8* const Dest = (uint8*)UncompressedBuffer;
+	uint8* Op = Dest;
+	uint8* const OpEnd = Op + UncompressedSize;
+
+	for( ;; )
+	{
+		if( Ip >= IpEnd )
+		{
+			return false;
+		}
+		const uint8 Token = *Ip++;
+
+		int32 NumLiterals = Token >> 4;
+		if( NumLiterals == 15 && !LZ4ReadLength( Ip, IpEnd, NumLiterals ) )
+		{
+			return false;
+		}
+		if( NumLiterals > IpEnd - Ip || NumLiterals > OpEnd - Op )
+		{
+			return false;
+		}
+		FMemory::Memcpy( Op, Ip, NumLiterals );
+		Op += NumLiterals;
+		Ip += NumLiterals;
+
+		// The last sequence has no match.
+		if( Ip == IpEnd )
+		{
+			break;
+		}
+
+		if( IpEnd - Ip < 2 )
+		{
+			return false;
+		}
+		const int32 Offset = Ip[0] | ( Ip[1] << 8 );
+		Ip += 2;
+
+		int32 MatchLength = Token & 15;
+		if( MatchLength == 15 && !LZ4ReadLength( Ip, IpEnd, MatchLength ) )
+		{
+			return false;
+		}
+		MatchLength += LZ4_MIN_MATCH;
+
+		if( Offset == 0 || Offset > Op - Dest || MatchLength > OpEnd - Op )
+		{
+			return false;
+		}
+
+		const uint8* Match = Op - Offset;
+		if( Offset >= MatchLength )
+		{
+			FMemory::Memcpy( Op, Match, MatchLength );
+			Op += MatchLength;
+		}
+		else
+		{
+			// The match overlaps what it writes, e.g. a run of the same byte.
+			for( uint8* MatchEnd = Op + MatchLength; Op < MatchEnd; )
+			{
+				*Op++ = *Match++;
+			}
+		}
+	}
+
+	return Op == OpEnd;
+}
+
+/*-----------------------------------------------------------------------------
+	Codecs.
+-----------------------------------------------------------------------------*/
+
+class FZLIBCompressionCodec : public ICompressionCodec
+{
+public:
+	virtual const TCHAR* GetName() const override
+	{
+		return TEXT( "ZLIB" );
+	}
+
+	virtual int32 CompressMemoryBound( int32 UncompressedSize ) const override
+	{
+		return compressBound( UncompressedSize );
+	}
+
+	virtual bool CompressMemory( ECompressionFlags Flags, void* CompressedBuffer, int32& CompressedSize, const void* UncompressedBuffer, int32 UncompressedSize ) const override
+	{
+		return appCompressMemoryZLIB( CompressedBuffer, CompressedSize, UncompressedBuffer, UncompressedSize );
+	}
+
+	virtual bool UncompressMemory( void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize ) const override
+	{
+		return appUncompressMemoryZLIB( UncompressedBuffer, UncompressedSize, CompressedBuffer, CompressedSize );
+	}
+};
+
+class FLZ4CompressionCodec : public ICompressionCodec
+{
+public:
+	virtual const TCHAR* GetName() const override
+	{
+		return TEXT( "LZ4" );
+	}
+
+	virtual int32 CompressMemoryBound( int32 UncompressedSize ) const override
+	{
+		return appCompressMemoryBoundLZ4( UncompressedSize );
+	}
+
+	virtual bool CompressMemory( ECompressionFlags Flags, void* CompressedBuffer, int32& CompressedSize, const void* UncompressedBuffer, int32 UncompressedSize ) const override
+	{
+		return appCompressMemoryLZ4( CompressedBuffer, CompressedSize, UncompressedBuffer, UncompressedSize );
+	}
+
+	virtual bool UncompressMemory( void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize ) const override
+	{
+		return appUncompressMemoryLZ4( UncompressedBuffer, UncompressedSize, CompressedBuffer, CompressedSize );
+	}
+};
+
+/** @return the codecs by type flag, with the built in ones already registered */
+static ICompressionCodec** GetCompressionCodecs()
+{
+	static FZLIBCompressionCodec ZLIBCodec;
+	static FLZ4CompressionCodec LZ4Codec;
+	static ICompressionCodec* Codecs[COMPRESSION_FLAGS_TYPE_MASK + 1] = { nullptr, &ZLIBCodec, &LZ4Codec };
+	return Codecs;
+}
+
+void FCompression::RegisterCodec( ECompressionFlags Type, ICompressionCodec* Codec )
+{
+	check( Type > COMPRESS_None && Type <= COMPRESSION_FLAGS_TYPE_MASK );
+	checkf( GetCompressionCodecs()[Type] == nullptr, TEXT( "Compression type %d is already used by %s" ), (int32)Type, GetCompressionCodecs()[Type]->GetName() );
+	GetCompressionCodecs()[Type] = Codec;
+}
+
+void FCompression::UnregisterCodec( ECompressionFlags Type )
+{
+	check( Type > COMPRESS_None && Type <= COMPRESSION_FLAGS_TYPE_MASK );
+	GetCompressionCodecs()[Type] = nullptr;
+}
+
+ICompressionCodec* FCompression::FindCodec( ECompressionFlags Flags )
+{
+	return GetCompressionCodecs()[Flags & COMPRESSION_FLAGS_TYPE_MASK];
+}
+
+ECompressionFlags FCompression::GetCompressionFlagsFromName( const FString& Name, ECompressionFlags Default )
+{
+	if( Name == TEXT( "None" ) )
+	{
+		return COMPRESS_None;
+	}
+
+	ICompressionCodec** Codecs = GetCompressionCodecs();
+	for( int32 Type = 1; Type <= COMPRESSION_FLAGS_TYPE_MASK; Type++ )
+	{
+		if( Codecs[Type] && Name == Codecs[Type]->GetName() )
+		{
+			return (ECompressionFlags)Type;
+		}
+	}
+
+	UE_LOG( LogCompression, Warning, TEXT( "Unknown compression format %s" ), *Name );
+	return Default;
+}
+
+ECompressionFlags FCompression::GetConfiguredCompressionFlags( const TCHAR* Key, ECompressionFlags Default )
+{
+	FString Name;
+	if( GConfig && GConfig->GetString( TEXT( "Core.Compression" ), Key, Name, GEngineIni ) )
+	{
+		return GetCompressionFlagsFromName( Name, Default );
+	}
+	return Default;
+}
+
 /** Time spent compressing data in seconds. */
 double FCompression::CompressorTime		= 0;
 /** Number of bytes before compression.		*/
@@ -103,22 +472,11 @@ static ECompressionFlags CheckGlobalCompressionFlags(ECompressionFlags Flags)
 */
 int32 FCompression::CompressMemoryBound( ECompressionFlags Flags, int32 UncompressedSize ) 
 {
-	int32 CompressionBound = UncompressedSize;
 	// make sure a valid compression scheme was provided
-	check(Flags & COMPRESS_ZLIB);
+	ICompressionCodec* Codec = FindCodec(Flags);
+	check(Codec);
 
-	Flags = CheckGlobalCompressionFlags(Flags);
-
-	switch(Flags & COMPRESSION_FLAGS_TYPE_MASK)
-	{
-	case COMPRESS_ZLIB:
-		CompressionBound = compressBound(UncompressedSize);
-		break;
-	default:
-		break;
-	}
-
-	return CompressionBound;
+	return Codec->CompressMemoryBound(UncompressedSize);
 }
 
 /**
@@ -137,21 +495,12 @@ bool FCompression::CompressMemory( ECompressionFlags Flags, void* CompressedBuff
 	double CompressorStartTime = FPlatformTime::Seconds();
 
 	// make sure a valid compression scheme was provided
-	check(Flags & COMPRESS_ZLIB);
-
-	bool bCompressSucceeded = false;
+	ICompressionCodec* Codec = FindCodec(Flags);
+	check(Codec);
 
 	Flags = CheckGlobalCompressionFlags(Flags);
 
-	switch(Flags & COMPRESSION_FLAGS_TYPE_MASK)
-	{
-		case COMPRESS_ZLIB:
-			bCompressSucceeded = appCompressMemoryZLIB(CompressedBuffer, CompressedSize, UncompressedBuffer, UncompressedSize);
-			break;
-		default:
-			UE_LOG(LogCompression, Warning, TEXT("appCompressMemory - This compression type not supported"));
-			bCompressSucceeded =  false;
-	}
+	const bool bCompressSucceeded = Codec->CompressMemory((ECompressionFlags)(Flags & COMPRESSION_FLAGS_OPTIONS_MASK), CompressedBuffer, CompressedSize, UncompressedBuffer, UncompressedSize);
 
 	// Keep track of compression time and stats.
 	CompressorTime += FPlatformTime::Seconds() - CompressorStartTime;
@@ -183,19 +532,16 @@ bool FCompression::UncompressMemory( ECompressionFlags Flags, void* Uncompressed
 	// Keep track of time spent uncompressing memory.
 	STAT(double UncompressorStartTime = FPlatformTime::Seconds();)
 	
-	// make sure a valid compression scheme was provided
-	check(Flags & COMPRESS_ZLIB);
-
 	bool bUncompressSucceeded = false;
 
-	switch(Flags & COMPRESSION_FLAGS_TYPE_MASK)
+	ICompressionCodec* Codec = FindCodec(Flags);
+	if (Codec)
 	{
-		case COMPRESS_ZLIB:
-			bUncompressSucceeded = appUncompressMemoryZLIB(UncompressedBuffer, UncompressedSize, CompressedBuffer, CompressedSize);
-			break;
-		default:
-			UE_LOG(LogCompression, Warning, TEXT("FCompression::UncompressMemory - This compression type not supported"));
-			bUncompressSucceeded = false;
+		bUncompressSucceeded = Codec->UncompressMemory(UncompressedBuffer, UncompressedSize, CompressedBuffer, CompressedSize);
+	}
+	else
+	{
+		UE_LOG(LogCompression, Warning, TEXT("FCompression::UncompressMemory - This compression type not supported"));
 	}
 	STAT(if (FThreadStats::IsThreadingReady()) { INC_FLOAT_STAT_BY(STAT_UncompressorTime,(float)(FPlatformTime::Seconds()-UncompressorStartTime))} );
 	
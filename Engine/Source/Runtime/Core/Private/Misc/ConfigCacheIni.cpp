@@ -415,23 +415,31 @@ void FConfigFile::CombineFromBuffer(const FString& Buffer)
  */
 void FConfigFile::ProcessInputFileContents(const FString& Contents)
 {
+	// Replace the variables in place, the text is only copied again when one of them is found
+	FString Text = Contents;
+
 	// Replace %GAME% with game name.
-	FString Text = Contents.Replace(TEXT("%GAME%"), FApp::GetGameName(), ESearchCase::CaseSensitive);
+	Text.ReplaceInline(TEXT("%GAME%"), FApp::GetGameName(), ESearchCase::CaseSensitive);
 
 	// Replace %GAMEDIR% with the game directory.
-	Text = Text.Replace( TEXT("%GAMEDIR%"), *FPaths::GameDir(), ESearchCase::CaseSensitive );
+	Text.ReplaceInline( TEXT("%GAMEDIR%"), *FPaths::GameDir(), ESearchCase::CaseSensitive );
 
 	// Replace %ENGINEUSERDIR% with the user's engine directory.
-	Text = Text.Replace(TEXT("%ENGINEUSERDIR%"), *FPaths::EngineUserDir(), ESearchCase::CaseSensitive);
+	Text.ReplaceInline(TEXT("%ENGINEUSERDIR%"), *FPaths::EngineUserDir(), ESearchCase::CaseSensitive);
 
 	// Replace %APPSETTINGSDIR% with the game directory.
 	FString AppSettingsDir = FPlatformProcess::ApplicationSettingsDir();
 	FPaths::NormalizeFilename(AppSettingsDir);
-	Text = Text.Replace( TEXT("%APPSETTINGSDIR%"), *AppSettingsDir, ESearchCase::CaseSensitive );
+	Text.ReplaceInline( TEXT("%APPSETTINGSDIR%"), *AppSettingsDir, ESearchCase::CaseSensitive );
 
 	const TCHAR* Ptr = Text.Len() > 0 ? *Text : NULL;
 	FConfigSection* CurrentSection = NULL;
 	bool Done = false;
+
+	// Reused for every line so parsing doesn't allocate a string per line
+	FString TheLine;
+	FString ProcessedValue;
+
 	while( !Done && Ptr != NULL )
 	{
 		// Advance past new line characters
@@ -440,7 +448,6 @@ void FConfigFile::ProcessInputFileContents(const FString& Contents)
 			Ptr++;
 		}			
 		// read the next line
-		FString TheLine;
 		int32 LinesConsumed = 0;
 		FParse::LineExtended(&Ptr, TheLine, LinesConsumed, false);
 		if (Ptr == NULL || *Ptr == 0)
@@ -450,17 +457,18 @@ void FConfigFile::ProcessInputFileContents(const FString& Contents)
 		TCHAR* Start = const_cast<TCHAR*>(*TheLine);
 
 		// Strip trailing spaces from the current line
-		while( *Start && FChar::IsWhitespace(Start[FCString::Strlen(Start)-1]) )
+		int32 LineLength = TheLine.Len();
+		while( LineLength > 0 && FChar::IsWhitespace(Start[LineLength-1]) )
 		{
-			Start[FCString::Strlen(Start)-1] = 0;
+			Start[--LineLength] = 0;
 		}
 
 		// If the first character in the line is [ and last char is ], this line indicates a section name
-		if( *Start=='[' && Start[FCString::Strlen(Start)-1]==']' )
+		if( LineLength > 0 && *Start=='[' && Start[LineLength-1]==']' )
 		{
 			// Remove the brackets
 			Start++;
-			Start[FCString::Strlen(Start)-1] = 0;
+			Start[LineLength-2] = 0;
 
 			// If we don't have an existing section by this name, add one
 			CurrentSection = Find( Start );
@@ -509,7 +517,7 @@ void FConfigFile::ProcessInputFileContents(const FString& Contents)
 					FString PreprocessedValue = FString(Value).TrimQuotes().ReplaceQuotesWithEscapedQuotes();
 					const TCHAR* NewValue = *PreprocessedValue;
 
-					FString ProcessedValue;
+					ProcessedValue.Reset(PreprocessedValue.Len());
 					//epic moelfke: fixed handling of escaped characters in quoted string
 					while (*NewValue && *NewValue != '\"')
 					{
@@ -2853,6 +2861,129 @@ void FConfigCacheIni::InitializeConfigSystem()
 	GConfig->bIsReadyForUse = true;
 }
 
+/** Version of the binary config files, bump it when what they contain changes */
+static const int32 GBinaryConfigVersion = 1;
+
+/**
+ * Cooked builds keep each global ini, as generated from its whole hierarchy, in a binary file next to the generated .ini.
+ * Loading it is a single read without any parsing, it is used as long as none of the files it was made from changed.
+ * -NOBINARYCONFIG always uses the .ini files.
+ *
+ * @param FinalIniFilename	The generated .ini the binary file is for
+ * @return whether the binary file can be used for this ini
+ */
+static bool ShouldUseBinaryConfig(const FString& FinalIniFilename)
+{
+	if (!FPlatformProperties::RequiresCookedData() || FParse::Param(FCommandLine::Get(), TEXT("NOBINARYCONFIG")) || FParse::Param(FCommandLine::Get(), TEXT("REGENERATEINIS")))
+	{
+		return false;
+	}
+
+#if !UE_BUILD_SHIPPING
+	// Commandline overrides are only applied when generating from the hierarchy
+	if (FCString::Stristr(FCommandLine::Get(), *CommandlineOverrideSpecifiers::IniSwitchIdentifier) != NULL)
+	{
+		return false;
+	}
+#endif
+
+	// Remote files are merged when generating from the hierarchy too
+	return FRemoteConfig::Get()->FindConfig(*FinalIniFilename) == NULL;
+}
+
+static FString GetBinaryConfigFilename(const FString& FinalIniFilename)
+{
+	return FPaths::ChangeExtension(FinalIniFilename, TEXT("bin"));
+}
+
+/** Gets the files a binary config depends on and their timestamps, the hierarchy and the generated .ini */
+static void GetBinaryConfigSources(const FConfigFile& ConfigFile, const FString& FinalIniFilename, TArray<FString>& OutFilenames, TArray<FDateTime>& OutTimeStamps)
+{
+	for (int32 IniIndex = 0; IniIndex < ConfigFile.SourceIniHierarchy.Num(); IniIndex++)
+	{
+		OutFilenames.Add(ConfigFile.SourceIniHierarchy[IniIndex].Filename);
+	}
+	OutFilenames.Add(FinalIniFilename);
+
+	for (int32 FileIndex = 0; FileIndex < OutFilenames.Num(); FileIndex++)
+	{
+		OutTimeStamps.Add(IFileManager::Get().GetTimeStamp(*OutFilenames[FileIndex]));
+	}
+}
+
+/**
+ * Fills ConfigFile and its SourceConfigFile from the binary config of FinalIniFilename.
+ *
+ * @return false if there is no binary config, or if it is out of date
+ */
+static bool LoadBinaryConfigFile(FConfigFile& ConfigFile, const FString& FinalIniFilename)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *GetBinaryConfigFilename(FinalIniFilename), FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader MemoryReader(Data);
+	FNameAsStringProxyArchive Ar(MemoryReader);
+
+	int32 Version = 0;
+	Ar << Version;
+	if (Version != GBinaryConfigVersion)
+	{
+		return false;
+	}
+
+	TArray<FString> SavedFilenames;
+	TArray<FDateTime> SavedTimeStamps;
+	Ar << SavedFilenames;
+	Ar << SavedTimeStamps;
+
+	TArray<FString> Filenames;
+	TArray<FDateTime> TimeStamps;
+	GetBinaryConfigSources(ConfigFile, FinalIniFilename, Filenames, TimeStamps);
+	if (MemoryReader.IsError() || SavedFilenames != Filenames || SavedTimeStamps != TimeStamps)
+	{
+		return false;
+	}
+
+	Ar << static_cast<TMap<FString,FConfigSection>&>(ConfigFile);
+	Ar << static_cast<TMap<FString,FConfigSection>&>(*ConfigFile.SourceConfigFile);
+	if (MemoryReader.IsError())
+	{
+		ConfigFile.Empty();
+		ConfigFile.SourceConfigFile->Empty();
+		return false;
+	}
+
+	return true;
+}
+
+/** Writes the binary config of FinalIniFilename, once ConfigFile was generated and saved */
+static void SaveBinaryConfigFile(FConfigFile& ConfigFile, const FString& FinalIniFilename)
+{
+	TArray<uint8> Data;
+	FMemoryWriter MemoryWriter(Data);
+	FNameAsStringProxyArchive Ar(MemoryWriter);
+
+	int32 Version = GBinaryConfigVersion;
+	Ar << Version;
+
+	TArray<FString> Filenames;
+	TArray<FDateTime> TimeStamps;
+	GetBinaryConfigSources(ConfigFile, FinalIniFilename, Filenames, TimeStamps);
+	Ar << Filenames;
+	Ar << TimeStamps;
+
+	Ar << static_cast<TMap<FString,FConfigSection>&>(ConfigFile);
+	Ar << static_cast<TMap<FString,FConfigSection>&>(*ConfigFile.SourceConfigFile);
+
+	if (!FFileHelper::SaveArrayToFile(Data, *GetBinaryConfigFilename(FinalIniFilename)))
+	{
+		UE_LOG(LogConfig, Log, TEXT("Couldn't write the binary config for %s"), *FinalIniFilename);
+	}
+}
+
 bool FConfigCacheIni::LoadGlobalIniFile(FString& FinalIniFilename, const TCHAR* BaseIniName, const TCHAR* Platform, const TCHAR* GameName, bool bForceReload, bool bRequireDefaultIni, bool bAllowGeneratedIniWhenCooked, const TCHAR* GeneratedConfigDir)
 {
 	// figure out where the end ini file is
@@ -2894,6 +3025,14 @@ bool FConfigCacheIni::LoadGlobalIniFile(FString& FinalIniFilename, const TCHAR*
 	// Keep a record of the original settings
 	NewConfigFile.SourceConfigFile = new FConfigFile();
 
+	const bool bUseBinaryConfig = ShouldUseBinaryConfig(FinalIniFilename);
+	if (bUseBinaryConfig && LoadBinaryConfigFile(NewConfigFile, FinalIniFilename))
+	{
+		// Nothing changed since it was generated and saved, there's nothing to write either
+		NewConfigFile.Name = BaseIniName;
+		return true;
+	}
+
 	// now generate and make sure it's up to date
 	bool bResult = GenerateDestIniFile(NewConfigFile, FinalIniFilename, NewConfigFile.SourceIniHierarchy, bAllowGeneratedIniWhenCooked, true);
 	NewConfigFile.Name = BaseIniName;
@@ -2911,6 +3050,12 @@ bool FConfigCacheIni::LoadGlobalIniFile(FString& FinalIniFilename, const TCHAR*
 		}
 	}
 
+	// Saved after the .ini so the binary config records its final timestamp
+	if (bResult && bUseBinaryConfig)
+	{
+		SaveBinaryConfigFile(NewConfigFile, FinalIniFilename);
+	}
+
 	return bResult;
 }
 
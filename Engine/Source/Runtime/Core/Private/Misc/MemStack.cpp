@@ -8,10 +8,14 @@ DECLARE_THREAD_SINGLETON( FMemStack );
 DECLARE_MEMORY_STAT(TEXT("MemStack Large Block"), STAT_MemStackLargeBLock,STATGROUP_Memory);
 DECLARE_MEMORY_STAT(TEXT("PageAllocator Free"), STAT_PageAllocatorFree, STATGROUP_Memory);
 DECLARE_MEMORY_STAT(TEXT("PageAllocator Used"), STAT_PageAllocatorUsed, STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("Frame MemStack"), STAT_FrameMemStack, STATGROUP_Memory);
 
 TLockFreeFixedSizeAllocator<FPageAllocator::PageSize, FThreadSafeCounter> FPageAllocator::TheAllocator;
 TLockFreeFixedSizeAllocator<FPageAllocator::SmallPageSize, FThreadSafeCounter> FPageAllocator::TheSmallAllocator;
 
+/** Defined after the page allocators, so it's destroyed before them */
+static FFrameMemStack GFrameMemStack;
+
 #if STATS
 void FPageAllocator::UpdateStats()
 {
@@ -116,3 +120,87 @@ bool FMemStackBase::ContainsPointer(const void* Pointer) const
 
 	return false;
 }
+
+/*-----------------------------------------------------------------------------
+	FFrameMemStack implementation.
+-----------------------------------------------------------------------------*/
+
+FFrameMemStack& FFrameMemStack::Get()
+{
+	return GFrameMemStack;
+}
+
+void FFrameMemStack::AllocateNewChunk(FFrame& Frame, FChunk* FullChunk, int32 MinSize)
+{
+	FScopeLock Lock(&Frame.ChunkCritical);
+
+	// Another thread already replaced the full chunk, let the caller try again
+	if( Frame.TopChunk != FullChunk )
+	{
+		return;
+	}
+
+	FChunk* Chunk;
+	int32 AllocSize = AlignArbitrary<int32>(MinSize + (int32)sizeof(FChunk), FPageAllocator::PageSize);
+	if (AllocSize == FPageAllocator::PageSize)
+	{
+		Chunk = (FChunk*)FPageAllocator::Alloc();
+	}
+	else
+	{
+		Chunk = (FChunk*)FMemory::Malloc(AllocSize);
+		INC_MEMORY_STAT_BY(STAT_MemStackLargeBLock, AllocSize);
+	}
+	Chunk->Next      = FullChunk;
+	Chunk->Top       = Chunk->Data();
+	Chunk->End       = ((uint8*)Chunk) + AllocSize;
+	Chunk->AllocSize = AllocSize;
+
+	// The chunk has to be complete before other threads can see it
+	FPlatformMisc::MemoryBarrier();
+	Frame.TopChunk = Chunk;
+}
+
+void FFrameMemStack::FreeChunks(FFrame& Frame)
+{
+	while( Frame.TopChunk )
+	{
+		FChunk* RemoveChunk = Frame.TopChunk;
+		Frame.TopChunk      = RemoveChunk->Next;
+		if (RemoveChunk->AllocSize == FPageAllocator::PageSize)
+		{
+			FPageAllocator::Free(RemoveChunk);
+		}
+		else
+		{
+			DEC_MEMORY_STAT_BY(STAT_MemStackLargeBLock, RemoveChunk->AllocSize);
+			FMemory::Free(RemoveChunk);
+		}
+	}
+}
+
+void FFrameMemStack::EndFrame()
+{
+	SET_MEMORY_STAT(STAT_FrameMemStack, GetByteCount());
+
+	// Nothing allocates from the next frame until it becomes the current one, and the frame that used
+	// it before is done with it
+	const int32 NextFrame = CurrentFrame ^ 1;
+	FreeChunks(Frames[NextFrame]);
+
+	FPlatformMisc::MemoryBarrier();
+	CurrentFrame = NextFrame;
+}
+
+int32 FFrameMemStack::GetByteCount() const
+{
+	int32 Count = 0;
+	for( int32 FrameIndex = 0; FrameIndex < 2; FrameIndex++ )
+	{
+		for( const FChunk* Chunk = Frames[FrameIndex].TopChunk; Chunk; Chunk = Chunk->Next )
+		{
+			Count += Chunk->Top - Chunk->Data();
+		}
+	}
+	return Count;
+}
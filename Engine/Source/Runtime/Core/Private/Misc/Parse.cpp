@@ -875,7 +875,7 @@ bool FParse::Line
 	bool IsQuoted=0;
 	bool Ignore=0;
 
-	Result = TEXT("");
+	Result.Reset();
 
 	while( **Stream!=0 && **Stream!=10 && **Stream!=13 )
 	{
@@ -926,7 +926,7 @@ bool FParse::LineExtended(const TCHAR** Stream, FString& Result, int32& LinesCon
 	bool Ignore=0;
 	int32 BracketDepth = 0;
 
-	Result = TEXT("");
+	Result.Reset();
 	LinesConsumed = 0;
 
 	while (**Stream != 0 && ((**Stream != 10 && **Stream != 13) || BracketDepth > 0))
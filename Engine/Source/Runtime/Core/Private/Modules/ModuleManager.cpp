@@ -248,7 +248,29 @@ TSharedPtr<IModuleInterface> FModuleManager::LoadModuleChecked( const FName InMo
 }
 
 
-TSharedPtr<IModuleInterface> FModuleManager::LoadModuleWithFailureReason( const FName InModuleName, EModuleLoadResult& OutFailureReason, bool bWasReloaded /*=false*/ )
+void FModuleManager::StartupLoadedModule( const FName InModuleName, FModuleInfo& ModuleInfo, bool bDeferStartup )
+{
+	// -NoLazyModuleStartup starts up every module when it is loaded, to tell whether a problem comes from a deferred startup
+	static const bool bLazyStartupDisabled = FParse::Param( FCommandLine::Get(), TEXT( "NoLazyModuleStartup" ) );
+
+	if( bDeferStartup && !bLazyStartupDisabled && ModuleInfo.Module->SupportsLazyStartup() )
+	{
+		UE_LOG(LogModuleManager, Verbose, TEXT( "ModuleManager: Deferring startup of module '%s' until it is accessed" ), *InModuleName.ToString() );
+		ModuleInfo.bStartupPending = true;
+		return;
+	}
+
+	ModuleInfo.bStartupPending = false;
+
+	// Startup the module
+	ModuleInfo.Module->StartupModule();
+
+	// Module was started successfully!  Fire callbacks.
+	ModulesChangedEvent.Broadcast( InModuleName, EModuleChangeReason::ModuleLoaded );
+}
+
+
+TSharedPtr<IModuleInterface> FModuleManager::LoadModuleWithFailureReason( const FName InModuleName, EModuleLoadResult& OutFailureReason, bool bWasReloaded /*=false*/, bool bAllowLazyStartup /*=false*/ )
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Module Load"), STAT_ModuleLoad, STATGROUP_LoadTime);
 
@@ -263,6 +285,12 @@ TSharedPtr<IModuleInterface> FModuleManager::LoadModuleWithFailureReason( const
 
 	if( ModuleInfo->Module.IsValid() )
 	{
+		// A module whose startup was deferred is started when it is loaded again by a caller that wants to use it
+		if( ModuleInfo->bStartupPending && !bAllowLazyStartup )
+		{
+			StartupLoadedModule( InModuleName, *ModuleInfo, false );
+		}
+
 		// Assign the already loaded module into the return value, otherwise the return value gives the impression the module failed load!
 		LoadedModule = ModuleInfo->Module;
 	}
@@ -287,11 +315,7 @@ TSharedPtr<IModuleInterface> FModuleManager::LoadModuleWithFailureReason( const
 
 			if( ModuleInfo->Module.IsValid() )
 			{
-				// Startup the module
-				ModuleInfo->Module->StartupModule();
-
-				// Module was started successfully!  Fire callbacks.
-				ModulesChangedEvent.Broadcast( InModuleName, EModuleChangeReason::ModuleLoaded );
+				StartupLoadedModule( InModuleName, *ModuleInfo, bAllowLazyStartup );
 
 				// Set the return parameter
 				LoadedModule = ModuleInfo->Module;
@@ -364,11 +388,7 @@ TSharedPtr<IModuleInterface> FModuleManager::LoadModuleWithFailureReason( const
 
 							if( ModuleInfo->Module.IsValid() )
 							{
-								// Startup the module
-								ModuleInfo->Module->StartupModule();
-
-								// Module was started successfully!  Fire callbacks.
-								ModulesChangedEvent.Broadcast( InModuleName, EModuleChangeReason::ModuleLoaded );
+								StartupLoadedModule( InModuleName, *ModuleInfo, bAllowLazyStartup );
 
 								// Set the return parameter
 								LoadedModule = ModuleInfo->Module;
@@ -427,8 +447,12 @@ bool FModuleManager::UnloadModule( const FName InModuleName, bool bIsShutdown )
 		// Only if already loaded
 		if( ModuleInfo->Module.IsValid() )
 		{
-			// Shutdown the module
-			ModuleInfo->Module->ShutdownModule();
+			// Shutdown the module, unless it was never started up
+			if( !ModuleInfo->bStartupPending )
+			{
+				ModuleInfo->Module->ShutdownModule();
+			}
+			ModuleInfo->bStartupPending = false;
 
 			// Verify that we have the only outstanding reference to this module.  No one should still be 
 			// referencing a module that is about to be destroyed!
@@ -494,6 +518,7 @@ void FModuleManager::AbandonModule( const FName InModuleName )
 			// a problem because script modules don't implement any functionality here.  Possible, we should keep these references
 			// alive off to the side somewhere (intentionally leak)
 			ModuleInfo->Module.Reset();
+			ModuleInfo->bStartupPending = false;
 
 			// A module was successfully unloaded.  Fire callbacks.
 			ModulesChangedEvent.Broadcast( InModuleName, EModuleChangeReason::ModuleUnloaded );
@@ -556,6 +581,12 @@ TSharedPtr<IModuleInterface> FModuleManager::GetModule( const FName InModuleName
 		return nullptr;
 	}
 
+	// First access to a module whose startup was deferred
+	if ((*ModuleInfo)->bStartupPending)
+	{
+		StartupLoadedModule(InModuleName, **ModuleInfo, false);
+	}
+
 	return (*ModuleInfo)->Module;
 }
 
@@ -814,47 +845,98 @@ void FModuleManager::GetModuleFilenameFormat(bool bGameModule, FString& OutPrefi
 }
 
 
-void FModuleManager::FindModulePaths(const TCHAR* NamePattern, TMap<FName, FString> &OutModulePaths) const
+void FModuleManager::ResetModulePathsCache()
 {
-	// Search through the engine directory
-	FindModulePathsInDirectory(FPlatformProcess::GetModulesDirectory(), false, NamePattern, OutModulePaths);
+	ModulePathsCache.Empty();
+}
+
 
-	// Search any engine directories
-	for (int Idx = 0; Idx < EngineBinariesDirectories.Num(); Idx++)
+void FModuleManager::FindModulePaths(const TCHAR* NamePattern, TMap<FName, FString> &OutModulePaths) const
+{
+	auto FindModulePathsInAllDirectories = [&]()
 	{
-		FindModulePathsInDirectory(EngineBinariesDirectories[Idx], false, NamePattern, OutModulePaths);
-	}
+		// Search through the engine directory
+		FindModulePathsInDirectory(FPlatformProcess::GetModulesDirectory(), false, NamePattern, OutModulePaths);
 
-	// Search any game directories
-	for (int Idx = 0; Idx < GameBinariesDirectories.Num(); Idx++)
+		// Search any engine directories
+		for (int Idx = 0; Idx < EngineBinariesDirectories.Num(); Idx++)
+		{
+			FindModulePathsInDirectory(EngineBinariesDirectories[Idx], false, NamePattern, OutModulePaths);
+		}
+
+		// Search any game directories
+		for (int Idx = 0; Idx < GameBinariesDirectories.Num(); Idx++)
+		{
+			FindModulePathsInDirectory(GameBinariesDirectories[Idx], true, NamePattern, OutModulePaths);
+		}
+	};
+
+	// A module file may have been compiled since the directories were scanned, so a single module name that isn't found
+	// scans them again. Wildcard searches are served from the cache until ResetModulePathsCache is called.
+	const bool bCanRescan = ModulePathsCache.Num() > 0 && !FCString::Strchr(NamePattern, TEXT('*')) && !FCString::Strchr(NamePattern, TEXT('?'));
+
+	FindModulePathsInAllDirectories();
+
+	if (OutModulePaths.Num() == 0 && bCanRescan)
 	{
-		FindModulePathsInDirectory(GameBinariesDirectories[Idx], true, NamePattern, OutModulePaths);
+		ModulePathsCache.Empty();
+		FindModulePathsInAllDirectories();
 	}
 }
 
 
 void FModuleManager::FindModulePathsInDirectory(const FString& InDirectoryName, bool bIsGameDirectory, const TCHAR* NamePattern, TMap<FName, FString> &OutModulePaths) const
 {
-	// Get the prefix and suffix for module filenames
-	FString ModulePrefix, ModuleSuffix;
-	GetModuleFilenameFormat(bIsGameDirectory, ModulePrefix, ModuleSuffix);
+	// Every module file of the directory is found by a single recursive scan, the first time it is searched. A directory
+	// is either an engine or a game binaries directory, so the cache doesn't need to know which one it is.
+	TMap<FName, FString>* DirectoryModulePaths = ModulePathsCache.Find(InDirectoryName);
+	if (DirectoryModulePaths == nullptr)
+	{
+		DirectoryModulePaths = &ModulePathsCache.Add(InDirectoryName, TMap<FName, FString>());
 
-	// Find all the files
-	TArray<FString> FullFileNames;
-	IFileManager::Get().FindFilesRecursive(FullFileNames, *InDirectoryName, *(ModulePrefix + NamePattern + ModuleSuffix), true, false);
+		// Get the prefix and suffix for module filenames
+		FString ModulePrefix, ModuleSuffix;
+		GetModuleFilenameFormat(bIsGameDirectory, ModulePrefix, ModuleSuffix);
 
-	// Parse all the matching module names
-	for (int32 Idx = 0; Idx < FullFileNames.Num(); Idx++)
-	{
-		const FString &FullFileName = FullFileNames[Idx];
+		// Find all the files
+		TArray<FString> FullFileNames;
+		IFileManager::Get().FindFilesRecursive(FullFileNames, *InDirectoryName, *(ModulePrefix + TEXT("*") + ModuleSuffix), true, false);
+
+		// Parse all the module names
+		for (int32 Idx = 0; Idx < FullFileNames.Num(); Idx++)
+		{
+			const FString &FullFileName = FullFileNames[Idx];
 
-		FString FileName = FPaths::GetCleanFilename(FullFileName);
-		if (FileName.StartsWith(ModulePrefix) && FileName.EndsWith(ModuleSuffix))
+			FString FileName = FPaths::GetCleanFilename(FullFileName);
+			if (FileName.StartsWith(ModulePrefix) && FileName.EndsWith(ModuleSuffix))
+			{
+				FString ModuleName = FileName.Mid(ModulePrefix.Len(), FileName.Len() - ModulePrefix.Len() - ModuleSuffix.Len());
+				if (!ModuleName.EndsWith("-Debug") && !ModuleName.EndsWith("-Shipping") && !ModuleName.EndsWith("-Test") && !ModuleName.EndsWith("-DebugGame"))
+				{
+					DirectoryModulePaths->Add(FName(*ModuleName), FullFileName);
+				}
+			}
+		}
+	}
+
+	// Exact names are a lookup, wildcards are matched against every module name of the directory
+	const FString Pattern(NamePattern);
+	if (!Pattern.Contains(TEXT("*")) && !Pattern.Contains(TEXT("?")))
+	{
+		const FName ModuleName(NamePattern, FNAME_Find);
+		const FString* FullFileName = ModuleName != NAME_None ? DirectoryModulePaths->Find(ModuleName) : nullptr;
+		if (FullFileName != nullptr)
+		{
+			OutModulePaths.Add(ModuleName, *FullFileName);
+		}
+	}
+	else
+	{
+		for (TMap<FName, FString>::TConstIterator Iter(*DirectoryModulePaths); Iter; ++Iter)
 		{
-			FString ModuleName = FileName.Mid(ModulePrefix.Len(), FileName.Len() - ModulePrefix.Len() - ModuleSuffix.Len());
-			if (!ModuleName.EndsWith("-Debug") && !ModuleName.EndsWith("-Shipping") && !ModuleName.EndsWith("-Test") && !ModuleName.EndsWith("-DebugGame"))
+			if (Iter.Key().ToString().MatchesWildcard(Pattern))
 			{
-				OutModulePaths.Add(FName(*ModuleName), FullFileName);
+				OutModulePaths.Add(Iter.Key(), Iter.Value());
 			}
 		}
 	}
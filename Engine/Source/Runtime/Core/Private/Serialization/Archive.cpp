@@ -376,26 +376,24 @@ void FArchive::SerializeCompressed( void* V, int64 Length, ECompressionFlags Fla
 			MaxCompressedSize = FMath::Max( CompressionChunks[ChunkIndex].CompressedSize, MaxCompressedSize );
 		}
 
-		int64 Padding = 0;
-
-		// Set up destination pointer and allocate memory for compressed chunk[s] (one at a time).
+		// Set up destination pointer, the chunks are uncompressed on the thread pool while the next ones are read.
 		uint8*	Dest				= (uint8*) V;
-		void*	CompressedBuffer	= FMemory::Malloc( MaxCompressedSize + Padding );
+		FAsyncUncompressChunks Uncompressor( Flags, MaxCompressedSize, TotalChunkCount );
 
 		// Iterate over all chunks, serialize them into memory and decompress them directly into the destination pointer
 		for( int64 ChunkIndex=0; ChunkIndex<TotalChunkCount; ChunkIndex++ )
 		{
 			const FCompressedChunkInfo& Chunk = CompressionChunks[ChunkIndex];
 			// Read compressed data.
-			Serialize( CompressedBuffer, Chunk.CompressedSize );
+			Serialize( Uncompressor.GetCompressedBuffer(), Chunk.CompressedSize );
 			// Decompress into dest pointer directly.
-			verify( FCompression::UncompressMemory( Flags, Dest, Chunk.UncompressedSize, CompressedBuffer, Chunk.CompressedSize, (Padding > 0) ? true : false ) );
+			Uncompressor.Uncompress( Dest, Chunk.UncompressedSize, Chunk.CompressedSize );
 			// And advance it by read amount.
 			Dest += Chunk.UncompressedSize;
 		}
+		Uncompressor.WaitForAll();
 
 		// Free up allocated memory.
-		FMemory::Free( CompressedBuffer );
 		delete [] CompressionChunks;
 	}
 	else if( IsSaving() )
@@ -175,11 +175,6 @@ int64 FAsyncIOSystemBase::PlatformMinimumReadSize()
 	return 32*1024;
 }
 
-
-
-// If enabled allows tracking down crashes in decompression as it avoids using the async work queue.
-#define BLOCK_ON_DECOMPRESSION 0
-
 void FAsyncIOSystemBase::FulfillCompressedRead( const FAsyncIORequest& IORequest, IFileHandle* FileHandle )
 {
 	if (GbLogAsyncLoading == true)
@@ -188,12 +183,7 @@ void FAsyncIOSystemBase::FulfillCompressedRead( const FAsyncIORequest& IORequest
 	}
 
 	// Initialize variables.
-	FAsyncUncompress*		Uncompressor			= NULL;
 	uint8*					UncompressedBuffer		= (uint8*) IORequest.Dest;
-	// First compression chunk contains information about total size so we skip that one.
-	int32						CurrentChunkIndex		= 1;
-	int32						CurrentBufferIndex		= 0;
-	bool					bHasProcessedAllData	= false;
 
 	// read the first two ints, which will contain the magic bytes (to detect byteswapping)
 	// and the original size the chunks were compressed from
@@ -240,7 +230,6 @@ void FAsyncIOSystemBase::FulfillCompressedRead( const FAsyncIORequest& IORequest
 	// allocate chunk info data based on number of chunks
 	FCompressedChunkInfo*	CompressionChunks		= (FCompressedChunkInfo*)FMemory::Malloc(sizeof(FCompressedChunkInfo) * TotalChunkCount);
 	int32						ChunkInfoSize			= (TotalChunkCount) * sizeof(FCompressedChunkInfo);
-	void*					CompressedBuffer[2]		= { 0, 0 };
 	
 	// Read table of compression chunks after seeking to offset (after the initial header data)
 	InternalRead( FileHandle, IORequest.Offset + HeaderSize, ChunkInfoSize, CompressionChunks );
@@ -316,67 +305,30 @@ void FAsyncIOSystemBase::FulfillCompressedRead( const FAsyncIORequest& IORequest
 		check( CompressionChunks[ChunkIndex].UncompressedSize <= CompressionChunkSize );
 	}
 
-	int32 Padding = 0;
-
-	// Allocate memory for compressed data.
-	CompressedBuffer[0]	= FMemory::Malloc( MaxCompressedSize + Padding );
-	CompressedBuffer[1] = FMemory::Malloc( MaxCompressedSize + Padding );
-
-	// Initial read request.
-	InternalRead( FileHandle, FileHandle->Tell(), CompressionChunks[CurrentChunkIndex].CompressedSize, CompressedBuffer[CurrentBufferIndex] );
-	RETURN_IF_EXIT_REQUESTED;
+	// The chunks are uncompressed on the thread pool while the next ones are read. First compression chunk
+	// contains information about total size so we skip that one.
+	FAsyncUncompressChunks Uncompressor( IORequest.CompressionFlags, MaxCompressedSize, TotalChunkCount - 1 );
+	for( int32 ChunkIndex = 1; ChunkIndex < TotalChunkCount; ChunkIndex++ )
+	{
+		void* CompressedBuffer = Uncompressor.GetCompressedBuffer();
+		InternalRead( FileHandle, FileHandle->Tell(), CompressionChunks[ChunkIndex].CompressedSize, CompressedBuffer );
+		RETURN_IF_EXIT_REQUESTED;
 
-	// Loop till we're done decompressing all data.
-	while( !bHasProcessedAllData )
-	{
-		FAsyncTask<FAsyncUncompress> UncompressTask(
-			IORequest.CompressionFlags,
-			UncompressedBuffer,
-			CompressionChunks[CurrentChunkIndex].UncompressedSize,
-			CompressedBuffer[CurrentBufferIndex],
-			CompressionChunks[CurrentChunkIndex].CompressedSize,
-			(Padding > 0)
-			);
-
-#if BLOCK_ON_DECOMPRESSION
-		UncompressTask.StartSynchronousTask();
-#else
-		UncompressTask.StartBackgroundTask();
-#endif
+		Uncompressor.Uncompress( UncompressedBuffer, CompressionChunks[ChunkIndex].UncompressedSize, CompressionChunks[ChunkIndex].CompressedSize );
 
 		// Advance destination pointer.
-		UncompressedBuffer += CompressionChunks[CurrentChunkIndex].UncompressedSize;
-	
-		// Check whether we are already done reading.
-		if( CurrentChunkIndex < TotalChunkCount-1 )
-		{
-			// Can't postincrement in if statement as we need it to remain at valid value for one more loop iteration to finish
-		// the decompression.
-			CurrentChunkIndex++;
-			// Swap compression buffers to read into.
-			CurrentBufferIndex = 1 - CurrentBufferIndex;
-			// Read more data.
-			InternalRead( FileHandle, FileHandle->Tell(), CompressionChunks[CurrentChunkIndex].CompressedSize, CompressedBuffer[CurrentBufferIndex] );
-			RETURN_IF_EXIT_REQUESTED;
-		}
-		// We were already done reading the last time around so we are done processing now.
-		else
-		{
-			bHasProcessedAllData = true;
-		}
-		
-		//@todo async loading: should use event for this
-		STAT(double UncompressorWaitTime = 0);
-		{
-			SCOPE_SECONDS_COUNTER(UncompressorWaitTime);
-			UncompressTask.EnsureCompletion(); // just decompress on this thread if it isn't started yet
-		}
-		INC_FLOAT_STAT_BY(STAT_AsyncIO_UncompressorWaitTime,(float)UncompressorWaitTime);
+		UncompressedBuffer += CompressionChunks[ChunkIndex].UncompressedSize;
+	}
+
+	//@todo async loading: should use event for this
+	STAT(double UncompressorWaitTime = 0);
+	{
+		SCOPE_SECONDS_COUNTER(UncompressorWaitTime);
+		Uncompressor.WaitForAll(); // just decompress on this thread if it isn't started yet
 	}
+	INC_FLOAT_STAT_BY(STAT_AsyncIO_UncompressorWaitTime,(float)UncompressorWaitTime);
 
 	FMemory::Free(CompressionChunks);
-	FMemory::Free(CompressedBuffer[0]);
-	FMemory::Free(CompressedBuffer[1] );
 }
 
 IFileHandle* FAsyncIOSystemBase::GetCachedFileHandle( const FString& FileName )
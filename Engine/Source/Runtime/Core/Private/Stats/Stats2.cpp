@@ -792,6 +792,43 @@ void FThreadStatsPool::ReturnToPool( FThreadStats* Instance )
 	Pool.Push(Instance);
 }
 
+/*-----------------------------------------------------------------------------
+	FStatPacketPool
+-----------------------------------------------------------------------------*/
+
+FStatPacket* FStatPacketPool::GetFromPool(const FStatPacket& Template)
+{
+	FStatPacket* Result = Pool.Pop();
+	if (!Result)
+	{
+		return new FStatPacket(Template);
+	}
+	NumPackets.Decrement();
+
+	check(!Result->StatMessages.Num());
+	Result->Frame = Template.Frame;
+	Result->ThreadId = Template.ThreadId;
+	Result->ThreadType = Template.ThreadType;
+	Result->bBrokenCallstacks = false;
+	Result->StatMessagesPresize = Template.StatMessagesPresize;
+	return Result;
+}
+
+void FStatPacketPool::ReturnToPool(FStatPacket* Packet)
+{
+	check(Packet);
+	if (NumPackets.GetValue() >= MAX_PACKETS_IN_POOL)
+	{
+		delete Packet;
+		return;
+	}
+
+	// Stat messages don't need to be destructed
+	Packet->StatMessages.Reset();
+	NumPackets.Increment();
+	Pool.Push(Packet);
+}
+
 /*-----------------------------------------------------------------------------
 	FThreadStats
 -----------------------------------------------------------------------------*/
@@ -885,7 +922,8 @@ void FThreadStats::Flush(bool bHasBrokenCallstacks)
 		{
 			UE_LOG( LogStats, Verbose, TEXT( "StatMessage Packet has more than %i messages.  Ignoring for the presize history." ), (int32)PRESIZE_MAX_SIZE );
 		}
-		FStatPacket* ToSend = new FStatPacket(Packet);
+		// The recycled packet gives its chunks to the messages of the next frame
+		FStatPacket* ToSend = FStatPacketPool::Get().GetFromPool(Packet);
 		Exchange(ToSend->StatMessages, Packet.StatMessages);
 		ToSend->bBrokenCallstacks = bHasBrokenCallstacks;
 
@@ -900,7 +938,7 @@ void FThreadStats::Flush(bool bHasBrokenCallstacks)
 					MaxPresize = Packet.StatMessagesPresize[Index];
 				}
 			}
-			Packet.StatMessages.Empty(MaxPresize);
+			Packet.StatMessages.Reserve(MaxPresize);
 		}
 
 		TGraphTask<FStatMessagesTask>::CreateTask().ConstructAndDispatchWhenReady(ToSend);
@@ -947,6 +985,7 @@ void FThreadStats::StartThread()
 	CheckEnable();
 	// Preallocate a bunch of FThreadStats to avoid dynamic memory allocation.
 	FThreadStatsPool::Get();
+	FStatPacketPool::Get();
 
 	{
 		FString CmdLine(FCommandLine::Get());
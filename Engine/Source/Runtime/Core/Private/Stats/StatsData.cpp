@@ -461,7 +461,7 @@ void FStatPacketArray::Empty()
 	{
 		const uint32 PacketMemory = Packets[Index]->StatMessages.GetAllocatedSize();
 		DEC_MEMORY_STAT_BY(STAT_StatMessagesMemory, PacketMemory);
-		delete Packets[Index];
+		FStatPacketPool::Get().ReturnToPool(Packets[Index]);
 	}
 	Packets.Empty();
 }
@@ -39,10 +39,14 @@ public:
 	/** Thread cycles for the last frame. Moved via Exchange. */
 	TMap<uint32, int64> ThreadCycles;
 
+	/** Frame number of the data. */
+	int64 TargetFrame;
+
 
 	/** Constructor. */
 	FAsyncWriteWorker( FStatsWriteFile* InStatsWriteFile )
 		: Outer( InStatsWriteFile )
+		, TargetFrame( InStatsWriteFile->OutDataFrame )
 	{
 		Exchange( Data, InStatsWriteFile->OutData );
 		Exchange( ThreadCycles, InStatsWriteFile->ThreadCycles );
@@ -61,7 +65,7 @@ public:
 		FCompressedStatsData CompressedData( Data, Outer->CompressedData );
 		Ar << CompressedData;
 
-		Outer->FramesInfo.Add( FStatsFrameInfo( FrameFileOffset, ThreadCycles ) );
+		Outer->FramesInfo.Add( FStatsFrameInfo( FrameFileOffset, ThreadCycles, TargetFrame ) );
 	}
 
 	/**
@@ -274,7 +278,8 @@ void FStatsThreadState::ProcessMetaDataForLoad(TArray<FStatMessage>& Data)
 -----------------------------------------------------------------------------*/
 
 FStatsWriteFile::FStatsWriteFile()
-	: File( nullptr )
+	: OutDataFrame( INDEX_NONE )
+	, File( nullptr )
 	, AsyncTask( nullptr )
 {
 	// Reserve 1MB.
@@ -335,7 +340,7 @@ void FStatsWriteFile::WriteHeader( bool bIsRawStatsFile )
 	Ar << Magic;
 
 	// Serialize dummy header, overwritten in Finalize.
-	Header.Version = EStatMagicWithHeader::VERSION_4;
+	Header.Version = EStatMagicWithHeader::VERSION_5;
 	Header.PlatformName = FPlatformProperties::PlatformName();
 	Header.bRawStatsFile = bIsRawStatsFile;
 	Ar << Header;
@@ -386,6 +391,15 @@ void FStatsWriteFile::Finalize()
 	Header.FrameTableOffset = Ar.Tell();
 	Ar << FramesInfo;
 
+	// Frame numbers go after, FStatsFrameInfo's serialization is shared with the older versions.
+	TArray<int64> TargetFrames;
+	TargetFrames.Reserve( FramesInfo.Num() );
+	for( const FStatsFrameInfo& FrameInfo : FramesInfo )
+	{
+		TargetFrames.Add( FrameInfo.TargetFrame );
+	}
+	Ar << TargetFrames;
+
 	const FStatsThreadState& Stats = FStatsThreadState::GetLocalState();
 
 	// Add FNames from the stats metadata.
@@ -459,6 +473,7 @@ void FStatsWriteFile::NewFrame( int64 TargetFrame )
 	}*/
 
 	WriteFrame( TargetFrame );
+	OutDataFrame = TargetFrame;
 	SendTask();
 }
 
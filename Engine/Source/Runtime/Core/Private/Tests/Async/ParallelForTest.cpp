@@ -0,0 +1,48 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "AutomationTest.h"
+#include "ParallelFor.h"
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParallelForTest, "Core.Async.ParallelFor", EAutomationTestFlags::ATF_SmokeTest)
+
+bool FParallelForTest::RunTest( const FString& Parameters )
+{
+	// every index must be visited exactly once
+	const int32 Sizes[] = { 0, 1, 2, 7, 100, 4097 };
+	for(int32 SizeIndex = 0; SizeIndex < ARRAY_COUNT(Sizes); SizeIndex++)
+	{
+		const int32 Num = Sizes[SizeIndex];
+		for(int32 Pass = 0; Pass < 2; Pass++)
+		{
+			TArray<FThreadSafeCounter> Visits;
+			Visits.AddZeroed(Num);
+
+			ParallelFor(Num, [&](int32 Index)
+			{
+				Visits[Index].Increment();
+			}, Pass == 1);
+
+			int32 NumWrong = 0;
+			for(int32 Index = 0; Index < Num; Index++)
+			{
+				NumWrong += Visits[Index].GetValue() != 1;
+			}
+			TestEqual(*FString::Printf(TEXT("ParallelFor over %d indices (single thread: %d) must visit each index once"), Num, Pass), NumWrong, 0);
+		}
+	}
+
+	// nested loops must not deadlock and must cover the whole range
+	FThreadSafeCounter NestedSum;
+	ParallelFor(16, [&](int32 Outer)
+	{
+		ParallelFor(64, [&](int32 Inner)
+		{
+			NestedSum.Add(1);
+		});
+	});
+	TestEqual(TEXT("Nested ParallelFor must visit every index"), NestedSum.GetValue(), 16 * 64);
+
+	return true;
+}
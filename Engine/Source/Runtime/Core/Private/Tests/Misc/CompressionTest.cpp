@@ -0,0 +1,58 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "AutomationTest.h"
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCompressionTest, "Core.Misc.Compression", EAutomationTestFlags::ATF_SmokeTest)
+
+bool FCompressionTest::RunTest( const FString& Parameters )
+{
+	// repetitive data with random runs, so both the matches and the literals are tested
+	TArray<uint8> Uncompressed;
+	FRandomStream Random(1234);
+	while (Uncompressed.Num() < 100000)
+	{
+		const int32 RunLength = Random.RandRange(1, 300);
+		const uint8 Value = (uint8)Random.RandRange(0, 3);
+		for (int32 Index = 0; Index < RunLength; ++Index)
+		{
+			Uncompressed.Add(Random.RandRange(0, 7) == 0 ? (uint8)Random.RandRange(0, 255) : Value);
+		}
+	}
+
+	const ECompressionFlags Formats[] = { COMPRESS_ZLIB, COMPRESS_LZ4 };
+	for (ECompressionFlags Format : Formats)
+	{
+		const TCHAR* Name = FCompression::FindCodec(Format)->GetName();
+		TestEqual(FString::Printf(TEXT("%s must be found by its name"), Name), (int32)FCompression::GetCompressionFlagsFromName(Name, COMPRESS_None), (int32)Format);
+
+		const int32 Sizes[] = { 0, 1, 12, 13, 1000, Uncompressed.Num() };
+		for (int32 Size : Sizes)
+		{
+			TArray<uint8> Compressed;
+			int32 CompressedSize = FCompression::CompressMemoryBound(Format, Size);
+			Compressed.AddUninitialized(CompressedSize);
+
+			const bool bCompressed = FCompression::CompressMemory(Format, Compressed.GetData(), CompressedSize, Uncompressed.GetData(), Size);
+			TestTrue(FString::Printf(TEXT("%s must compress %i bytes"), Name, Size), bCompressed);
+
+			TArray<uint8> Decompressed;
+			Decompressed.AddZeroed(Size);
+			const bool bUncompressed = bCompressed && FCompression::UncompressMemory(Format, Decompressed.GetData(), Size, Compressed.GetData(), CompressedSize);
+			TestTrue(FString::Printf(TEXT("%s must uncompress %i bytes"), Name, Size), bUncompressed);
+			TestTrue(FString::Printf(TEXT("%s must give back the %i bytes"), Name, Size), bUncompressed && FMemory::Memcmp(Decompressed.GetData(), Uncompressed.GetData(), Size) == 0);
+		}
+	}
+
+	// LZ4 checks its input, the data of a smaller size can't uncompress
+	int32 CompressedSize = FCompression::CompressMemoryBound(COMPRESS_LZ4, Uncompressed.Num());
+	TArray<uint8> Compressed;
+	Compressed.AddUninitialized(CompressedSize);
+	FCompression::CompressMemory(COMPRESS_LZ4, Compressed.GetData(), CompressedSize, Uncompressed.GetData(), Uncompressed.Num());
+	TArray<uint8> Decompressed;
+	Decompressed.AddUninitialized(Uncompressed.Num() / 2);
+	TestFalse(TEXT("LZ4 must fail to uncompress to a smaller buffer"), FCompression::UncompressMemory(COMPRESS_LZ4, Decompressed.GetData(), Decompressed.Num(), Compressed.GetData(), CompressedSize));
+
+	return true;
+}
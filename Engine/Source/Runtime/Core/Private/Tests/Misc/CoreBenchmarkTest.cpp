@@ -0,0 +1,398 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "AutomationTest.h"
+#include "LockFreeList.h"
+
+
+/**
+ * Microbenchmarks of the core containers, allocator, lock free list, FName table, task graph and compression.
+ * Not smoke tests as they take a few seconds each. Each one logs the nanoseconds per operation, and writes them
+ * as json to Saved/Automation/Benchmarks so the results of several machines or changelists can be compared.
+ */
+namespace CoreBenchmark
+{
+	/** Keeps the results of the benchmarked loops alive, so the compiler can't remove them. */
+	static volatile int64 Sink = 0;
+
+	struct FResult
+	{
+		FString Name;
+		int32 NumThreads;
+		int64 NumOps;
+		double Seconds;
+
+		double GetNsPerOp() const
+		{
+			return NumOps > 0 ? Seconds * 1e9 / (double)NumOps : 0.0;
+		}
+	};
+
+	/** Thread counts the contended benchmarks are run with, powers of two up to the number of cores. */
+	static TArray<int32> GetThreadCounts()
+	{
+		TArray<int32> ThreadCounts;
+		const int32 NumCores = FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads(), 1, 32);
+		for (int32 NumThreads = 1; NumThreads < NumCores; NumThreads *= 2)
+		{
+			ThreadCounts.Add(NumThreads);
+		}
+		ThreadCounts.Add(NumCores);
+		return ThreadCounts;
+	}
+
+	/** Runs the work on its own thread once all the threads of the benchmark are started. */
+	class FWorker : public FRunnable
+	{
+	public:
+		FWorker(TFunction<void (int32)> InWork, int32 InThreadIndex, FThreadSafeCounter& InNumReady, volatile int32& InGo)
+			: Work(InWork)
+			, ThreadIndex(InThreadIndex)
+			, NumReady(InNumReady)
+			, Go(InGo)
+		{
+		}
+
+		virtual uint32 Run() override
+		{
+			NumReady.Increment();
+			while (Go == 0)
+			{
+				FPlatformProcess::Sleep(0.0f);
+			}
+			Work(ThreadIndex);
+			return 0;
+		}
+
+	private:
+		TFunction<void (int32)> Work;
+		int32 ThreadIndex;
+		FThreadSafeCounter& NumReady;
+		volatile int32& Go;
+	};
+
+	/** Runs the work on NumThreads threads at once, and returns the seconds from their start to the end of the last one. */
+	static double RunOnThreads(int32 NumThreads, TFunction<void (int32)> Work)
+	{
+		FThreadSafeCounter NumReady;
+		volatile int32 Go = 0;
+
+		TArray<FWorker*> Workers;
+		TArray<FRunnableThread*> Threads;
+		for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+		{
+			Workers.Add(new FWorker(Work, ThreadIndex, NumReady, Go));
+			Threads.Add(FRunnableThread::Create(Workers.Last(), *FString::Printf(TEXT("CoreBenchmark%d"), ThreadIndex)));
+		}
+
+		while (NumReady.GetValue() < NumThreads)
+		{
+			FPlatformProcess::Sleep(0.0f);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		FPlatformAtomics::InterlockedExchange(&Go, 1);
+		for (FRunnableThread* Thread : Threads)
+		{
+			Thread->WaitForCompletion();
+		}
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+		for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+		{
+			delete Threads[ThreadIndex];
+			delete Workers[ThreadIndex];
+		}
+		return Seconds;
+	}
+
+	/** Times a loop on the current thread. */
+	template <typename FunctorType>
+	static FResult Time(const FString& Name, int64 NumOps, FunctorType Functor)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		Functor();
+		FResult Result = { Name, 1, NumOps, FPlatformTime::Seconds() - StartTime };
+		return Result;
+	}
+
+	static void BenchmarkContainers(TArray<FResult>& Results)
+	{
+		const int32 NumElements = 200000;
+		TArray<int32> Keys;
+		FRandomStream Random(1234);
+		for (int32 Index = 0; Index < NumElements; ++Index)
+		{
+			Keys.Add((int32)Random.GetUnsignedInt());
+		}
+
+		{
+			TArray<int32> Array;
+			Results.Add(Time(TEXT("TArray.Add"), NumElements, [&]() { for (int32 Key : Keys) { Array.Add(Key); } }));
+			Results.Add(Time(TEXT("TArray.Iterate"), NumElements, [&]() { int64 Sum = 0; for (int32 Value : Array) { Sum += Value; } Sink += Sum; }));
+
+			// linear, so only on a small array
+			TArray<int32> SmallArray;
+			SmallArray.Append(Keys.GetData(), 1000);
+			Results.Add(Time(TEXT("TArray.Find (1000 elements)"), 10000, [&]() { int64 Sum = 0; for (int32 Index = 0; Index < 10000; ++Index) { Sum += SmallArray.Find(Keys[Index * 7 % 1000 + 500]); } Sink += Sum; }));
+			Results.Add(Time(TEXT("TArray.RemoveAtSwap"), NumElements, [&]() { while (Array.Num()) { Array.RemoveAtSwap(Array.Num() / 2, 1, false); } }));
+		}
+
+		{
+			TMap<int32, int32> Map;
+			Results.Add(Time(TEXT("TMap.Add"), NumElements, [&]() { for (int32 Key : Keys) { Map.Add(Key, Key); } }));
+			Results.Add(Time(TEXT("TMap.Find"), NumElements, [&]() { int64 Sum = 0; for (int32 Key : Keys) { Sum += *Map.Find(Key); } Sink += Sum; }));
+			Results.Add(Time(TEXT("TMap.Iterate"), Map.Num(), [&]() { int64 Sum = 0; for (const auto& Pair : Map) { Sum += Pair.Value; } Sink += Sum; }));
+			Results.Add(Time(TEXT("TMap.Remove"), NumElements, [&]() { for (int32 Key : Keys) { Map.Remove(Key); } }));
+		}
+
+		{
+			TSet<int32> Set;
+			Results.Add(Time(TEXT("TSet.Add"), NumElements, [&]() { for (int32 Key : Keys) { Set.Add(Key); } }));
+			Results.Add(Time(TEXT("TSet.Contains"), NumElements, [&]() { int64 Sum = 0; for (int32 Key : Keys) { Sum += Set.Contains(Key) ? 1 : 0; } Sink += Sum; }));
+			Results.Add(Time(TEXT("TSet.Iterate"), Set.Num(), [&]() { int64 Sum = 0; for (int32 Value : Set) { Sum += Value; } Sink += Sum; }));
+			Results.Add(Time(TEXT("TSet.Remove"), NumElements, [&]() { for (int32 Key : Keys) { Set.Remove(Key); } }));
+		}
+	}
+
+	static void BenchmarkMalloc(TArray<FResult>& Results)
+	{
+		// every thread keeps a window of live allocations of mixed small sizes, freeing the oldest one for each new one
+		const int32 NumAllocsPerThread = 200000;
+		const int32 WindowSize = 64;
+		const FString AllocatorName = GMalloc->GetDescriptiveName();
+
+		for (int32 NumThreads : GetThreadCounts())
+		{
+			const double Seconds = RunOnThreads(NumThreads, [=](int32 ThreadIndex)
+			{
+				void* Window[WindowSize] = { nullptr };
+				FRandomStream Random(ThreadIndex);
+				for (int32 Index = 0; Index < NumAllocsPerThread; ++Index)
+				{
+					void*& Slot = Window[Index % WindowSize];
+					FMemory::Free(Slot);
+					Slot = FMemory::Malloc(16 << Random.RandRange(0, 6));
+				}
+				for (void* Ptr : Window)
+				{
+					FMemory::Free(Ptr);
+				}
+			});
+			FResult Result = { FString::Printf(TEXT("%s Malloc+Free"), *AllocatorName), NumThreads, (int64)NumAllocsPerThread * NumThreads, Seconds };
+			Results.Add(Result);
+		}
+	}
+
+	static void BenchmarkLockFreeList(TArray<FResult>& Results)
+	{
+		// every thread pushes a batch of items to the shared list and pops as many, which may be the ones of other threads
+		const int32 NumBatches = 2000;
+		const int32 BatchSize = 64;
+
+		for (int32 NumThreads : GetThreadCounts())
+		{
+			TLockFreePointerList<int32> List;
+			TArray<int32> Items;
+			Items.AddZeroed(NumThreads * BatchSize);
+
+			const double Seconds = RunOnThreads(NumThreads, [&](int32 ThreadIndex)
+			{
+				int64 Sum = 0;
+				for (int32 Batch = 0; Batch < NumBatches; ++Batch)
+				{
+					for (int32 Index = 0; Index < BatchSize; ++Index)
+					{
+						List.Push(&Items[ThreadIndex * BatchSize + Index]);
+					}
+					for (int32 Index = 0; Index < BatchSize; ++Index)
+					{
+						Sum += List.Pop() != nullptr ? 1 : 0;
+					}
+				}
+				Sink += Sum;
+			});
+			FResult Result = { TEXT("TLockFreePointerList Push+Pop"), NumThreads, (int64)NumBatches * BatchSize * 2 * NumThreads, Seconds };
+			Results.Add(Result);
+		}
+	}
+
+	static void BenchmarkFName(TArray<FResult>& Results)
+	{
+		// names are never removed from the table, so keep the count small and make them unique per run
+		static int32 RunIndex = 0;
+		++RunIndex;
+
+		const int32 NumNames = 20000;
+		TArray<FString> Strings;
+		for (int32 Index = 0; Index < NumNames; ++Index)
+		{
+			Strings.Add(FString::Printf(TEXT("CoreBenchmark_%d_%d_Name"), RunIndex, Index));
+		}
+
+		Results.Add(Time(TEXT("FName Add (new)"), NumNames, [&]() { int64 Sum = 0; for (const FString& String : Strings) { Sum += FName(*String).GetComparisonIndex(); } Sink += Sum; }));
+		Results.Add(Time(TEXT("FName Add (existing)"), NumNames, [&]() { int64 Sum = 0; for (const FString& String : Strings) { Sum += FName(*String).GetComparisonIndex(); } Sink += Sum; }));
+		Results.Add(Time(TEXT("FName Find"), NumNames, [&]() { int64 Sum = 0; for (const FString& String : Strings) { Sum += FName(*String, FNAME_Find).GetComparisonIndex(); } Sink += Sum; }));
+		Results.Add(Time(TEXT("FName ToString"), NumNames, [&]() { int64 Sum = 0; for (const FString& String : Strings) { Sum += FName(*String, FNAME_Find).ToString().Len(); } Sink += Sum; }));
+	}
+
+	static void BenchmarkTaskGraph(TArray<FResult>& Results)
+	{
+		const int32 NumThreads = FTaskGraphInterface::Get().GetNumWorkerThreads();
+
+		const int32 NumRoundTrips = 5000;
+		FResult RoundTrip = Time(TEXT("TaskGraph dispatch and wait"), NumRoundTrips, [&]()
+		{
+			for (int32 Index = 0; Index < NumRoundTrips; ++Index)
+			{
+				FGraphEventRef Event = TGraphTask<FNullGraphTask>::CreateTask().ConstructAndDispatchWhenReady(TStatId(), ENamedThreads::AnyThread);
+				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Event);
+			}
+		});
+		RoundTrip.NumThreads = NumThreads;
+		Results.Add(RoundTrip);
+
+		const int32 NumTasks = 50000;
+		FResult Burst = Time(TEXT("TaskGraph dispatch burst, wait all"), NumTasks, [&]()
+		{
+			FGraphEventArray Events;
+			Events.Reserve(NumTasks);
+			for (int32 Index = 0; Index < NumTasks; ++Index)
+			{
+				Events.Add(TGraphTask<FNullGraphTask>::CreateTask().ConstructAndDispatchWhenReady(TStatId(), ENamedThreads::AnyThread));
+			}
+			FTaskGraphInterface::Get().WaitUntilTasksComplete(Events);
+		});
+		Burst.NumThreads = NumThreads;
+		Results.Add(Burst);
+	}
+
+	static void BenchmarkCompression(TArray<FResult>& Results)
+	{
+		// same kind of data as the compression test, runs with noise
+		TArray<uint8> Uncompressed;
+		FRandomStream Random(1234);
+		while (Uncompressed.Num() < 1024 * 1024)
+		{
+			const int32 RunLength = Random.RandRange(1, 300);
+			const uint8 Value = (uint8)Random.RandRange(0, 3);
+			for (int32 Index = 0; Index < RunLength; ++Index)
+			{
+				Uncompressed.Add(Random.RandRange(0, 7) == 0 ? (uint8)Random.RandRange(0, 255) : Value);
+			}
+		}
+
+		// an operation is a whole buffer, the throughput is in the logs
+		const int32 NumPasses = 10;
+		const ECompressionFlags Formats[] = { COMPRESS_ZLIB, COMPRESS_LZ4 };
+		for (ECompressionFlags Format : Formats)
+		{
+			const TCHAR* Name = FCompression::FindCodec(Format)->GetName();
+			TArray<uint8> Compressed;
+			Compressed.AddUninitialized(FCompression::CompressMemoryBound(Format, Uncompressed.Num()));
+			int32 CompressedSize = 0;
+			Results.Add(Time(FString::Printf(TEXT("%s compress 1MB"), Name), NumPasses, [&]()
+			{
+				for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+				{
+					CompressedSize = Compressed.Num();
+					FCompression::CompressMemory(Format, Compressed.GetData(), CompressedSize, Uncompressed.GetData(), Uncompressed.Num());
+				}
+			}));
+
+			TArray<uint8> Decompressed;
+			Decompressed.AddUninitialized(Uncompressed.Num());
+			Results.Add(Time(FString::Printf(TEXT("%s uncompress 1MB"), Name), NumPasses, [&]()
+			{
+				for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+				{
+					FCompression::UncompressMemory(Format, Decompressed.GetData(), Decompressed.Num(), Compressed.GetData(), CompressedSize);
+				}
+			}));
+		}
+	}
+
+	static FString EscapeJson(const FString& String)
+	{
+		return String.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\""));
+	}
+
+	/** Writes the results by hand, Core can't use the Json module. */
+	static void SaveResults(const FString& BenchmarkName, const TArray<FResult>& Results)
+	{
+		FString Json = TEXT("{\n");
+		Json += FString::Printf(TEXT("\t\"Benchmark\": \"%s\",\n"), *EscapeJson(BenchmarkName));
+		Json += FString::Printf(TEXT("\t\"Date\": \"%s\",\n"), *FDateTime::UtcNow().ToIso8601());
+		Json += FString::Printf(TEXT("\t\"EngineVersion\": \"%s\",\n"), *EscapeJson(GEngineVersion.ToString()));
+		Json += FString::Printf(TEXT("\t\"Platform\": \"%s\",\n"), ANSI_TO_TCHAR(FPlatformProperties::PlatformName()));
+		Json += FString::Printf(TEXT("\t\"Configuration\": \"%s\",\n"), EBuildConfigurations::ToString(FApp::GetBuildConfiguration()));
+		Json += FString::Printf(TEXT("\t\"NumCores\": %d,\n"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+		Json += TEXT("\t\"Results\": [\n");
+		for (int32 Index = 0; Index < Results.Num(); ++Index)
+		{
+			const FResult& Result = Results[Index];
+			Json += FString::Printf(TEXT("\t\t{ \"Name\": \"%s\", \"Threads\": %d, \"Ops\": %lld, \"Seconds\": %f, \"NsPerOp\": %f }%s\n"),
+				*EscapeJson(Result.Name), Result.NumThreads, Result.NumOps, Result.Seconds, Result.GetNsPerOp(), Index + 1 < Results.Num() ? TEXT(",") : TEXT(""));
+		}
+		Json += TEXT("\t]\n}\n");
+
+		const FString Filename = FPaths::AutomationDir() / TEXT("Benchmarks") / FString::Printf(TEXT("Core.%s-%s.json"), *BenchmarkName, *FDateTime::Now().ToString());
+		FFileHelper::SaveStringToFile(Json, *Filename);
+	}
+}
+
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FCoreBenchmarkTest, "Core.Benchmark", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Game | EAutomationTestFlags::ATF_Commandlet)
+
+void FCoreBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray <FString>& OutTestCommands) const
+{
+	const TCHAR* Benchmarks[] = { TEXT("Containers"), TEXT("Malloc"), TEXT("LockFreeList"), TEXT("FName"), TEXT("TaskGraph"), TEXT("Compression") };
+	for (const TCHAR* Benchmark : Benchmarks)
+	{
+		OutBeautifiedNames.Add(Benchmark);
+		OutTestCommands.Add(Benchmark);
+	}
+}
+
+bool FCoreBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace CoreBenchmark;
+
+	TArray<FResult> Results;
+	if (Parameters == TEXT("Containers"))
+	{
+		BenchmarkContainers(Results);
+	}
+	else if (Parameters == TEXT("Malloc"))
+	{
+		BenchmarkMalloc(Results);
+	}
+	else if (Parameters == TEXT("LockFreeList"))
+	{
+		BenchmarkLockFreeList(Results);
+	}
+	else if (Parameters == TEXT("FName"))
+	{
+		BenchmarkFName(Results);
+	}
+	else if (Parameters == TEXT("TaskGraph"))
+	{
+		BenchmarkTaskGraph(Results);
+	}
+	else if (Parameters == TEXT("Compression"))
+	{
+		BenchmarkCompression(Results);
+	}
+	else
+	{
+		AddError(FString::Printf(TEXT("Unknown benchmark %s"), *Parameters));
+		return false;
+	}
+
+	for (const FResult& Result : Results)
+	{
+		AddLogItem(FString::Printf(TEXT("%s, %d thread(s): %.1f ns/op (%lld ops in %.3f s)"), *Result.Name, Result.NumThreads, Result.GetNsPerOp(), Result.NumOps, Result.Seconds));
+	}
+	SaveResults(Parameters, Results);
+	return true;
+}
@@ -0,0 +1,75 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "AutomationTest.h"
+#include "Containers/RobinHoodMap.h"
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRobinHoodMapTest, "Core.Misc.RobinHoodMap", EAutomationTestFlags::ATF_SmokeTest)
+
+bool FRobinHoodMapTest::RunTest( const FString& Parameters )
+{
+	// random adds and removes, checked against a TMap
+	TRobinHoodMap<int32, FString> Map;
+	TMap<int32, FString> Reference;
+	FRandomStream Random(1234);
+
+	for (int32 Iteration = 0; Iteration < 20000; ++Iteration)
+	{
+		const int32 Key = Random.RandRange(0, 2000);
+		if (Random.RandRange(0, 2) == 0)
+		{
+			TestEqual(TEXT("Remove must return the number of removed pairs"), Map.Remove(Key), Reference.Remove(Key));
+		}
+		else
+		{
+			const FString Value = FString::FromInt(Iteration);
+			Map.Add(Key, Value);
+			Reference.Add(Key, Value);
+		}
+	}
+
+	TestEqual(TEXT("The map must have as many pairs as the reference"), Map.Num(), Reference.Num());
+	for (int32 Key = 0; Key <= 2000; ++Key)
+	{
+		const FString* Value = Map.Find(Key);
+		const FString* ReferenceValue = Reference.Find(Key);
+		TestEqual(TEXT("A key must be found if it is in the reference"), Value != nullptr, ReferenceValue != nullptr);
+		if (Value && ReferenceValue)
+		{
+			TestEqual(TEXT("The value of a key must be the last one added"), *Value, *ReferenceValue);
+		}
+	}
+
+	// iteration visits every pair once, even when removing some of them
+	TSet<int32> Visited;
+	for (TRobinHoodMap<int32, FString>::TIterator It = Map.CreateIterator(); It; ++It)
+	{
+		const int32 Key = It.Key();
+		TestFalse(TEXT("Iteration must not visit a pair twice"), Visited.Contains(Key));
+		TestEqual(TEXT("Iterated pairs must be in the reference"), It.Value(), Reference.FindRef(Key));
+		Visited.Add(Key);
+		if (Key % 2 == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+	TestEqual(TEXT("Iteration must visit every pair"), Visited.Num(), Reference.Num());
+
+	int32 NumOdd = 0;
+	for (auto& Pair : Map)
+	{
+		TestTrue(TEXT("RemoveCurrent must have removed the even keys"), Pair.Key % 2 != 0);
+		++NumOdd;
+	}
+	TestEqual(TEXT("The map must only have the odd keys left"), Map.Num(), NumOdd);
+
+	Map.Reset();
+	TestEqual(TEXT("Reset must remove every pair"), Map.Num(), 0);
+	TestFalse(TEXT("Reset must remove every pair"), Map.Contains(1));
+
+	Map.FindOrAdd(7) = TEXT("Seven");
+	TestEqual(TEXT("FindOrAdd must add missing keys"), Map.FindRef(7), FString(TEXT("Seven")));
+
+	return true;
+}
@@ -9,7 +9,7 @@ DEFINE_LOG_CATEGORY_STATIC(LogUnrealNames, Log, All);
 	FName helpers.
 -----------------------------------------------------------------------------*/
 
-FNameEntry* AllocateNameEntry( const void* Name, NAME_INDEX Index, FNameEntry* HashNext, bool bIsPureAnsi );
+FNameEntry* AllocateNameEntry( const void* Name, NAME_INDEX Index, uint32 Hash, FNameEntry* HashNext, bool bIsPureAnsi );
 
 /**
 * Helper function that can be used inside the debuggers watch window. E.g. "DebugFName(Class->Name.Index)". 
@@ -215,6 +215,17 @@ FCriticalSection* FName::GetCriticalSection()
 	return CriticalSection;
 }
 
+FCriticalSection* FName::GetHashShardCriticalSection(int32 HashIndex)
+{
+	static FCriticalSection*	ShardCriticalSections = NULL;
+	if( ShardCriticalSections == NULL )
+	{
+		check(IsInGameThread());
+		ShardCriticalSections = new FCriticalSection[FNameDefs::NameHashShardCount];
+	}
+	return &ShardCriticalSections[HashIndex & (FNameDefs::NameHashShardCount - 1)];
+}
+
 FString FName::NameToDisplayString( const FString& InDisplayName, const bool bIsBool )
 {
 	// Copy the characters out so that we can modify the string in place
@@ -610,7 +621,8 @@ template <typename TCharType>
 bool FName::InitInternal_FindOrAddNameEntry(const TCharType* InName, const EFindName FindType, const ENameCase ComparisonMode, int32& OutIndex)
 {
 	// Hash value of string
-	const int32 iHash = ( (ComparisonMode == ENameCase::IgnoreCase) ? FCrc::Strihash_DEPRECATED( InName ) : FCrc::StrCrc32( InName ) ) & (ARRAY_COUNT(NameHash)-1);
+	const uint32 FullHash = (ComparisonMode == ENameCase::IgnoreCase) ? FCrc::Strihash_DEPRECATED( InName ) : FCrc::StrCrc32( InName );
+	const int32 iHash = FullHash & (ARRAY_COUNT(NameHash)-1);
 
 	if (OutIndex < 0)
 	{
@@ -619,7 +631,7 @@ bool FName::InitInternal_FindOrAddNameEntry(const TCharType* InName, const EFind
 		{
 			FPlatformMisc::Prefetch( Hash->HashNext );
 			// Compare the passed in string
-			if( Hash->IsEqual( InName, ComparisonMode ) )
+			if( Hash->GetHash() == FullHash && Hash->IsEqual( InName, ComparisonMode ) )
 			{
 				// Found it in the hash.
 				OutIndex = Hash->GetIndex();
@@ -650,15 +662,15 @@ bool FName::InitInternal_FindOrAddNameEntry(const TCharType* InName, const EFind
 			return false;
 		}
 	}
-	// acquire the lock
-	FScopeLock ScopeLock(GetCriticalSection());
+	// acquire the lock of the shard, nobody else can add to this hash bin while we hold it
+	FScopeLock ShardLock(GetHashShardCriticalSection(iHash));
 	if (OutIndex < 0)
 	{
 		// Try to find the name in the hash. AGAIN...we might have been adding from a different thread and we just missed it
 		for( FNameEntry* Hash=NameHash[iHash]; Hash; Hash=Hash->HashNext )
 		{
 			// Compare the passed in string
-			if( Hash->IsEqual( InName, ComparisonMode ) )
+			if( Hash->GetHash() == FullHash && Hash->IsEqual( InName, ComparisonMode ) )
 			{
 				// Found it in the hash.
 				OutIndex = Hash->GetIndex();
@@ -669,18 +681,23 @@ bool FName::InitInternal_FindOrAddNameEntry(const TCharType* InName, const EFind
 	}
 	FNameEntry* OldHash=NameHash[iHash];
 	TNameEntryArray& Names = GetNames();
-	if (OutIndex < 0)
-	{
-		OutIndex = Names.AddZeroed(1);
-	}
-	else
+	FNameEntry* NewEntry;
 	{
-		check(OutIndex < Names.Num());
-	}
-	FNameEntry* NewEntry = AllocateNameEntry( InName, OutIndex, OldHash, FNameInitHelper<TCharType>::IsAnsi );
-	if (FPlatformAtomics::InterlockedCompareExchangePointer((void**)&Names[OutIndex], NewEntry, NULL) != NULL) // we use an atomic operation to check for unexpected concurrency, verify alignment, etc
-	{
-		UE_LOG(LogUnrealNames, Fatal, TEXT("Hardcoded name '%s' at index %i was duplicated (or unexpected concurrency). Existing entry is '%s'."), *NewEntry->GetPlainNameString(), NewEntry->GetIndex(), *Names[OutIndex]->GetPlainNameString() );
+		// The names array and the entry pool are shared by all the shards, only hold the global lock while growing them
+		FScopeLock ScopeLock(GetCriticalSection());
+		if (OutIndex < 0)
+		{
+			OutIndex = Names.AddZeroed(1);
+		}
+		else
+		{
+			check(OutIndex < Names.Num());
+		}
+		NewEntry = AllocateNameEntry( InName, OutIndex, FullHash, OldHash, FNameInitHelper<TCharType>::IsAnsi );
+		if (FPlatformAtomics::InterlockedCompareExchangePointer((void**)&Names[OutIndex], NewEntry, NULL) != NULL) // we use an atomic operation to check for unexpected concurrency, verify alignment, etc
+		{
+			UE_LOG(LogUnrealNames, Fatal, TEXT("Hardcoded name '%s' at index %i was duplicated (or unexpected concurrency). Existing entry is '%s'."), *NewEntry->GetPlainNameString(), NewEntry->GetIndex(), *Names[OutIndex]->GetPlainNameString() );
+		}
 	}
 	if (FPlatformAtomics::InterlockedCompareExchangePointer((void**)&NameHash[iHash], NewEntry, OldHash) != OldHash) // we use an atomic operation to check for unexpected concurrency, verify alignment, etc
 	{
@@ -1086,13 +1103,14 @@ private:
 /** Global allocator for name entries. */
 FNameEntryPoolAllocator GNameEntryPoolAllocator;
 
-FNameEntry* AllocateNameEntry( const void* Name, NAME_INDEX Index, FNameEntry* HashNext, bool bIsPureAnsi )
+FNameEntry* AllocateNameEntry( const void* Name, NAME_INDEX Index, uint32 Hash, FNameEntry* HashNext, bool bIsPureAnsi )
 {
 	const SIZE_T NameLen  = bIsPureAnsi ? FCStringAnsi::Strlen((ANSICHAR*)Name) : FCString::Strlen((TCHAR*)Name);
 	int32 NameEntrySize	  = FNameEntry::GetSize( NameLen, bIsPureAnsi );
 	FNameEntry* NameEntry = GNameEntryPoolAllocator.Allocate( NameEntrySize );
 	FName::NameEntryMemorySize += NameEntrySize;
 	NameEntry->Index      = (Index << NAME_INDEX_SHIFT) | (bIsPureAnsi ? 0 : 1);
+	NameEntry->Hash       = Hash;
 	NameEntry->HashNext   = HashNext;
 	// Can't rely on the template override for static arrays since the safe crt version of strcpy will fill in
 	// the remainder of the array of NAME_SIZE with 0xfd.  So, we have to pass in the length of the dynamically allocated array instead.
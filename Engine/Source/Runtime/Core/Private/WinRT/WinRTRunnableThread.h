@@ -114,6 +114,8 @@ class FRunnableThreadWinRT : public FRunnableThread
 			ExitCode = Runnable->Run();
 			// Allow any allocated resources to be cleaned up
 			Runnable->Exit();
+			// Give back the memory the allocator cached for this thread
+			FMemory::FlushCurrentThreadCache();
 		}
 		else
 		{
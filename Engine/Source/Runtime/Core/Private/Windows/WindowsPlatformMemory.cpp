@@ -290,4 +290,74 @@ bool FWindowsPlatformMemory::UnmapNamedSharedMemoryRegion(FSharedMemoryRegion *
 
 	return bAllSucceeded;
 }
+
+FPlatformMemory::FMappedFile* FWindowsPlatformMemory::MapFile(const TCHAR* Filename)
+{
+	const FString FullFilename = FPaths::ConvertRelativePathToFull(Filename);
+	HANDLE File = CreateFileW(*FullFilename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (File == INVALID_HANDLE_VALUE)
+	{
+		DWORD ErrNo = GetLastError();
+		UE_LOG(LogHAL, Warning, TEXT("CreateFile(file='%s') failed with GetLastError() = %d"), *FullFilename, ErrNo);
+		return NULL;
+	}
+
+	LARGE_INTEGER FileSize;
+	if (!GetFileSizeEx(File, &FileSize) || FileSize.QuadPart == 0)
+	{
+		CloseHandle(File);
+		return NULL;
+	}
+
+	// The mapping keeps its own reference to the file
+	HANDLE Mapping = CreateFileMapping(File, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(File);
+	if (Mapping == NULL)
+	{
+		DWORD ErrNo = GetLastError();
+		UE_LOG(LogHAL, Warning, TEXT("CreateFileMapping(file='%s', protect=PAGE_READONLY) failed with GetLastError() = %d"), *FullFilename, ErrNo);
+		return NULL;
+	}
+
+	void* Ptr = MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+	if (Ptr == NULL)
+	{
+		DWORD ErrNo = GetLastError();
+		UE_LOG(LogHAL, Warning, TEXT("MapViewOfFile(file='%s', access=FILE_MAP_READ) failed with GetLastError() = %d"), *FullFilename, ErrNo);
+		CloseHandle(Mapping);
+		return NULL;
+	}
+
+	return new FWindowsMappedFile((const uint8*)Ptr, FileSize.QuadPart, Mapping);
+}
+
+bool FWindowsPlatformMemory::UnmapFile(FMappedFile* MappedFile)
+{
+	bool bAllSucceeded = true;
+
+	if (MappedFile)
+	{
+		FWindowsMappedFile* WindowsMappedFile = static_cast< FWindowsMappedFile* >( MappedFile );
+
+		if (!UnmapViewOfFile(WindowsMappedFile->GetData()))
+		{
+			bAllSucceeded = false;
+
+			int ErrNo = GetLastError();
+			UE_LOG(LogHAL, Warning, TEXT("UnmapViewOfFile(address=%p) failed with GetLastError() = %d"), WindowsMappedFile->GetData(), ErrNo);
+		}
+
+		if (!CloseHandle(WindowsMappedFile->GetMapping()))
+		{
+			bAllSucceeded = false;
+
+			int ErrNo = GetLastError();
+			UE_LOG(LogHAL, Warning, TEXT("CloseHandle(handle=0x%x) failed with GetLastError() = %d"), WindowsMappedFile->GetMapping(), ErrNo);
+		}
+
+		delete WindowsMappedFile;
+	}
+
+	return bAllSucceeded;
+}
 #include "HideWindowsPlatformTypes.h"
@@ -71,6 +71,8 @@ uint32 FRunnableThreadWin::Run()
 		ExitCode = Runnable->Run();
 		// Allow any allocated resources to be cleaned up
 		Runnable->Exit();
+		// Give back the memory the allocator cached for this thread
+		FMemory::FlushCurrentThreadCache();
 	}
 	else
 	{
@@ -627,3 +627,125 @@ public:
 };
 
 
+
+/**
+ * Uncompresses the chunks of one compressed payload on the thread pool, several at a time, while the caller
+ * reads the next ones. The chunks of SerializeCompressed are compressed independently of each other, so this
+ * gets the payload in memory at the speed of the I/O instead of the speed of a single core.
+ *
+ * For each chunk in order, the caller reads the compressed data into GetCompressedBuffer and calls Uncompress.
+ */
+class FAsyncUncompressChunks
+{
+	/** Uncompresses one chunk. */
+	class FChunk : public FNonAbandonableTask
+	{
+	public:
+		void* UncompressedBuffer;
+		int32 UncompressedSize;
+		void* CompressedBuffer;
+		int32 CompressedSize;
+		ECompressionFlags Flags;
+
+		FChunk()
+			: UncompressedBuffer( nullptr )
+			, UncompressedSize( 0 )
+			, CompressedBuffer( nullptr )
+			, CompressedSize( 0 )
+			, Flags( COMPRESS_None )
+		{
+		}
+
+		void DoWork()
+		{
+			verify( FCompression::UncompressMemory( Flags, UncompressedBuffer, UncompressedSize, CompressedBuffer, CompressedSize ) );
+		}
+
+		static const TCHAR* Name()
+		{
+			return TEXT( "FAsyncUncompressChunks" );
+		}
+	};
+
+public:
+	/** Don't have more chunks in flight than this, each has its compressed buffer. */
+	enum { MaxJobs = 8 };
+
+	/**
+	 * @param	InFlags					Flags to control what method to use for decompression
+	 * @param	InMaxCompressedSize		Size of the largest compressed chunk
+	 * @param	NumChunks				Number of chunks of the payload, no more jobs than chunks are used
+	 */
+	FAsyncUncompressChunks( ECompressionFlags InFlags, int64 InMaxCompressedSize, int64 NumChunks )
+		: Flags( InFlags )
+		, MaxCompressedSize( InMaxCompressedSize )
+		, NumJobs( 1 )
+		, NextJob( 0 )
+	{
+		// Leave a core to the thread reading the chunks.
+		if( GThreadPool && FPlatformProcess::SupportsMultithreading() )
+		{
+			NumJobs = (int32)FMath::Clamp<int64>( FMath::Min<int64>( FPlatformMisc::NumberOfCores() - 1, NumChunks ), 1, MaxJobs );
+		}
+		FMemory::Memzero( CompressedBuffers, sizeof(CompressedBuffers) );
+	}
+
+	~FAsyncUncompressChunks()
+	{
+		WaitForAll();
+		for( int32 JobIndex = 0; JobIndex < NumJobs; JobIndex++ )
+		{
+			FMemory::Free( CompressedBuffers[JobIndex] );
+		}
+	}
+
+	/** @return the buffer to read the next compressed chunk into, waits for the chunk that used it to be uncompressed */
+	void* GetCompressedBuffer()
+	{
+		Jobs[NextJob].EnsureCompletion();
+		if( !CompressedBuffers[NextJob] )
+		{
+			CompressedBuffers[NextJob] = FMemory::Malloc( MaxCompressedSize );
+		}
+		return CompressedBuffers[NextJob];
+	}
+
+	/** Starts uncompressing the chunk read into GetCompressedBuffer to Dest. */
+	void Uncompress( void* Dest, int32 UncompressedSize, int32 CompressedSize )
+	{
+		FChunk& Chunk = Jobs[NextJob].GetTask();
+		Chunk.UncompressedBuffer = Dest;
+		Chunk.UncompressedSize = UncompressedSize;
+		Chunk.CompressedBuffer = CompressedBuffers[NextJob];
+		Chunk.CompressedSize = CompressedSize;
+		Chunk.Flags = Flags;
+
+		// With a single job the chunk is uncompressed right away, there is no core for it to run in parallel.
+		if( NumJobs > 1 )
+		{
+			Jobs[NextJob].StartBackgroundTask();
+		}
+		else
+		{
+			Jobs[NextJob].StartSynchronousTask();
+		}
+		NextJob = ( NextJob + 1 ) % NumJobs;
+	}
+
+	/** Waits for all the chunks to be uncompressed. */
+	void WaitForAll()
+	{
+		for( int32 JobIndex = 0; JobIndex < NumJobs; JobIndex++ )
+		{
+			Jobs[JobIndex].EnsureCompletion();
+		}
+	}
+
+private:
+	ECompressionFlags Flags;
+	int64 MaxCompressedSize;
+	int32 NumJobs;
+	int32 NextJob;
+	FAsyncTask<FChunk> Jobs[MaxJobs];
+	void* CompressedBuffers[MaxJobs];
+};
@@ -0,0 +1,166 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	ParallelFor.h: Data parallel loop on top of the task graph
+=============================================================================*/
+
+#pragma once
+
+#include "TaskGraphInterfaces.h"
+
+/**
+	ParallelFor - runs Body(Index) for every Index in [0, Num) on the task graph worker threads.
+
+	The range is split into blocks that are claimed from a shared counter, so a worker that finishes early keeps
+	taking the blocks left by the slower ones. The calling thread works on the blocks too and only blocks once
+	there is nothing left to claim, waiting for the blocks that are still in flight.
+
+	Sample code:
+
+	TArray<FVector> Positions;
+	ParallelFor(Positions.Num(), [&](int32 Index)
+	{
+		Positions[Index] = Positions[Index].GetSafeNormal();
+	});
+
+	The body can be called from any thread and on any order, and it can use ParallelFor itself.
+**/
+
+namespace ParallelForImpl
+{
+	/** Number of blocks given to each thread, more blocks balance better but cost more atomics */
+	enum { BlocksPerThread = 4 };
+
+	/** State shared by the caller and the tasks of a single ParallelFor */
+	struct FParallelForData
+	{
+		FParallelForData(int32 InNum, int32 InNumThreads, TFunctionRef<void(int32)> InBody)
+			: Body(InBody)
+			, Num(InNum)
+			, Event(FPlatformProcess::CreateSynchEvent(true))
+		{
+			// Adapt the block size to the amount of work, small loops get single index blocks
+			BlockSize = FMath::Max(1, Num / (InNumThreads * BlocksPerThread));
+			NumBlocks = (Num + BlockSize - 1) / BlockSize;
+		}
+
+		~FParallelForData()
+		{
+			delete Event;
+		}
+
+		/** Claims and runs blocks until there are none left. Returns true if this call completed the last block */
+		bool Process()
+		{
+			bool bCompletedLast = false;
+			for(;;)
+			{
+				const int32 BlockIndex = NextBlock.Increment() - 1;
+				if(BlockIndex >= NumBlocks)
+				{
+					break;
+				}
+
+				const int32 Start = BlockIndex * BlockSize;
+				const int32 End = FMath::Min(Start + BlockSize, Num);
+				for(int32 Index = Start; Index < End; Index++)
+				{
+					Body(Index);
+				}
+
+				if(NumCompleted.Increment() == NumBlocks)
+				{
+					bCompletedLast = true;
+				}
+			}
+			return bCompletedLast;
+		}
+
+		/** The body is only called while the caller is waiting, so a reference is enough */
+		TFunctionRef<void(int32)> Body;
+		int32 Num;
+		int32 BlockSize;
+		int32 NumBlocks;
+		FThreadSafeCounter NextBlock;
+		FThreadSafeCounter NumCompleted;
+		/** Triggered by the thread that completes the last block */
+		FEvent* Event;
+	};
+
+	typedef TSharedRef<FParallelForData, ESPMode::ThreadSafe> FParallelForDataRef;
+
+	/** Worker side of a ParallelFor. Each task dispatches the next one before working, so the fan-out doesn't serialize on the caller */
+	class FParallelForTask
+	{
+	public:
+		FParallelForTask(const FParallelForDataRef& InData, int32 InNumTasksToSpawn)
+			: Data(InData)
+			, NumTasksToSpawn(InNumTasksToSpawn)
+		{
+		}
+
+		FORCEINLINE TStatId GetStatId() const
+		{
+			RETURN_QUICK_DECLARE_CYCLE_STAT(FParallelForTask, STATGROUP_TaskGraphTasks);
+		}
+
+		static ENamedThreads::Type GetDesiredThread()
+		{
+			return ENamedThreads::AnyThread;
+		}
+
+		static ESubsequentsMode::Type GetSubsequentsMode()
+		{
+			return ESubsequentsMode::FireAndForget;
+		}
+
+		void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+		{
+			// No need to spawn more workers if the work is already claimed
+			if(NumTasksToSpawn > 0 && Data->NextBlock.GetValue() < Data->NumBlocks)
+			{
+				TGraphTask<FParallelForTask>::CreateTask().ConstructAndDispatchWhenReady(Data, NumTasksToSpawn - 1);
+			}
+
+			if(Data->Process())
+			{
+				Data->Event->Trigger();
+			}
+		}
+
+	private:
+		FParallelForDataRef Data;
+		int32 NumTasksToSpawn;
+	};
+}
+
+/**
+ *	Runs Body(Index) for every Index in [0, Num), in parallel when possible. Returns once all of them are done.
+ *	@param Num; number of iterations
+ *	@param Body; function to call for each index
+ *	@param bForceSingleThread; run the whole loop on the calling thread, useful for debugging
+**/
+inline void ParallelFor(int32 Num, TFunctionRef<void(int32)> Body, bool bForceSingleThread = false)
+{
+	const int32 NumWorkers = FTaskGraphInterface::IsRunning() ? FTaskGraphInterface::Get().GetNumWorkerThreads() : 0;
+	if(Num <= 1 || bForceSingleThread || NumWorkers == 0 || !FApp::ShouldUseThreadingForPerformance())
+	{
+		for(int32 Index = 0; Index < Num; Index++)
+		{
+			Body(Index);
+		}
+		return;
+	}
+
+	// The caller counts as a thread too
+	const int32 NumThreads = FMath::Min(NumWorkers + 1, Num);
+	ParallelForImpl::FParallelForDataRef Data(new ParallelForImpl::FParallelForData(Num, NumThreads, Body));
+
+	TGraphTask<ParallelForImpl::FParallelForTask>::CreateTask().ConstructAndDispatchWhenReady(Data, NumThreads - 2);
+
+	// Help instead of waiting. The event is only needed if a worker still has a block in flight
+	if(!Data->Process())
+	{
+		Data->Event->Wait();
+	}
+}
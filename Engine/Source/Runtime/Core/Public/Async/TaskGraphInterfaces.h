@@ -30,6 +30,8 @@ namespace ENamedThreads
 	{
 		/** not actually a thread index. Means "Unknown Thread" or "Any Unnamed Thread" **/
 		AnyThread = -1, 
+		/** not actually a thread index. Means "Any Unnamed Thread", ahead of the AnyThread tasks. Use it for the work a named thread is going to wait on this frame **/
+		AnyHiPriThread = -2,
 
 		/** The always-present, named threads are listed next **/
 #if STATS
@@ -69,6 +71,11 @@ namespace ENamedThreads
 		return (ThreadAndIndex == AnyThread) ? AnyThread : Type(ThreadAndIndex & ThreadIndexMask);
 	}
 
+	FORCEINLINE bool IsAnyUnnamedThread(Type ThreadAndIndex)
+	{
+		return ThreadAndIndex == AnyThread || ThreadAndIndex == AnyHiPriThread;
+	}
+
 	FORCEINLINE int32 GetQueueIndex(Type ThreadAndIndex)
 	{
 		return (ThreadAndIndex & ~ThreadIndexMask) >> QueueIndexShift;
@@ -99,7 +106,7 @@ class FTaskGraphInterface
 	/** 
 	 *	Internal function to queue a task
 	 *	@param	Task; the task to queue
-	 *	@param	ThreadToExecuteOn; Either a named thread for a threadlocked task or ENamedThreads::AnyThread for a task that is to run on a worker thread
+	 *	@param	ThreadToExecuteOn; Either a named thread for a threadlocked task or ENamedThreads::AnyThread / ENamedThreads::AnyHiPriThread for a task that is to run on a worker thread
 	 *	@param	CurrentThreadIfKnown; This should be the current thread if it is known, or otherwise use ENamedThreads::AnyThread and the current thread will be determined.
 	**/
 	virtual void QueueTask(class FBaseGraphTask* Task, ENamedThreads::Type ThreadToExecuteOn, ENamedThreads::Type CurrentThreadIfKnown = ENamedThreads::AnyThread) = 0;
@@ -126,6 +133,11 @@ public:
 	 *	@return a reference to the task graph system
 	**/
 	static CORE_API FTaskGraphInterface& Get();
+	/** 
+	 *	Check if the system is started, before that there are no worker threads to dispatch to
+	 *	@return true if Startup was called and Shutdown was not
+	**/
+	static CORE_API bool IsRunning();
 
 	/** Return the current thread type, if known. **/
 	virtual ENamedThreads::Type GetCurrentThreadIfKnown() = 0;
@@ -493,7 +505,7 @@ public:
 
 	[static] ENamedThreads::Type GetDesiredThread()
 	{
-		return ENamedThreads::[named thread or AnyThread];
+		return ENamedThreads::[named thread, AnyThread or AnyHiPriThread];
 	}
 	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 	{
@@ -160,7 +160,8 @@ public:
 		const int32 OldNum = NumElements;
 		for (int32 i = 0; i < Count; i++)
 		{
-			if (NumElements % NumElementsPerChunk == 0)
+			// Chunks kept by Reset are used again before allocating new ones
+			if (NumElements == Chunks.Num() * NumElementsPerChunk)
 			{
 				new(Chunks) FChunk;
 			}
@@ -177,6 +178,15 @@ public:
 		NumElements = 0;
 	}
 
+	/**
+	 * Empties the array but keeps its chunks, adding elements again doesn't allocate until the array grows past them.
+	 * The elements are not destructed, only use it for types that don't need their destructor called.
+	 */
+	void Reset()
+	{
+		NumElements = 0;
+	}
+
 	/**
 	 * Reserves memory such that the array can contain at least Number elements.
 	 *
@@ -0,0 +1,83 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+ * Thread safe fixed-size allocator that carves its elements out of large pages.
+ *
+ * Objects of one type allocated from the same allocator end up next to each other in memory, instead of being
+ * scattered over the heap, so systems that walk all of them touch fewer cache lines and pages. Addresses are stable:
+ * elements never move, freed ones are reused before a new page is started.
+ *
+ * Like TAllocatorFixedSizeFreeList, pages are never returned, so these are meant to be global.
+ */
+class CORE_API FPagedFixedSizeAllocator
+{
+public:
+	/**
+	 * Constructor, does not allocate anything.
+	 *
+	 * @param	InElementSize		Size of each allocation, rounded up to keep every element 16 bytes aligned
+	 * @param	InElementsPerPage	Number of elements in each page
+	 */
+	FPagedFixedSizeAllocator(uint32 InElementSize, uint32 InElementsPerPage);
+
+	/** Destructor. Can't free memory, so only checks that allocations have been returned. */
+	~FPagedFixedSizeAllocator();
+
+	/** Allocates one element. Return it by calling Free. */
+	void* Allocate();
+
+	/** Returns one element, must have been acquired previously by Allocate. */
+	void Free(void* Element);
+
+	/** @return true if the memory belongs to one of the pages of this allocator */
+	bool Contains(const void* Memory) const;
+
+	/** @return the size of the elements, at least the size given to the constructor */
+	uint32 GetElementSize() const
+	{
+		return ElementSize;
+	}
+
+	/** @return the number of elements that are allocated and not freed */
+	uint32 GetNumLive() const
+	{
+		return NumLive;
+	}
+
+	/** @return total memory allocated by the pages */
+	uint32 GetAllocatedSize() const
+	{
+		return Pages.Num() * PageSize;
+	}
+
+private:
+	struct FFreeElement
+	{
+		FFreeElement* Next;
+	};
+
+	/** Contains, with the lock already held. */
+	bool ContainsNoLock(const void* Memory) const;
+
+	/** Allocates a new page and makes it the one elements are carved from. */
+	void AddPage();
+
+	/** Size of each element. */
+	uint32 ElementSize;
+	/** Size of each page. */
+	uint32 PageSize;
+	/** Pages, sorted by address. */
+	TArray<uint8*> Pages;
+	/** Linked list of freed elements. */
+	FFreeElement* FreeList;
+	/** First element of the newest page that was never allocated. */
+	uint8* PageTail;
+	/** End of the newest page. */
+	uint8* PageEnd;
+	/** The number of elements that are allocated and not freed. */
+	uint32 NumLive;
+	/** Guards everything above, elements are often allocated and freed on different threads. */
+	mutable FCriticalSection CriticalSection;
+};
@@ -0,0 +1,527 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Map.h"
+
+/**
+ * A map from keys to values stored in a single open addressing table with Robin Hood probing, for maps that are
+ * mostly looked up.
+ *
+ * A TMap lookup reads the hash bucket, then follows the HashNextId chain through the sparse array of pairs, touching
+ * two or three cache lines. Here the hashes of the pairs are stored in an array parallel to the pairs, so a lookup
+ * scans a few consecutive hashes and only reads the pair whose hash matches. Robin Hood probing keeps every pair
+ * close to the slot its hash maps to, and removal shifts the following pairs back instead of leaving tombstones.
+ *
+ * The differences with TMap are:
+ * - Pairs are moved around when other pairs are added or removed, so pointers to values are only valid until the
+ *   map is modified.
+ * - Iteration order is the order of the table, not the order of addition.
+ * - Only RemoveCurrent may remove pairs while iterating.
+ * - Duplicate keys aren't supported.
+ *
+ * Keys are hashed and compared with the same KeyFuncs as TMap. Like the other containers, keys and values have to be
+ * relocatable with a memcpy.
+ */
+template<typename KeyType, typename ValueType, typename KeyFuncs = TDefaultMapKeyFuncs<KeyType, ValueType, false> >
+class TRobinHoodMap
+{
+public:
+	typedef TPair<KeyType, ValueType> ElementType;
+	typedef typename KeyFuncs::KeyInitType KeyInitType;
+
+	TRobinHoodMap()
+		: NumElements(0)
+	{
+	}
+
+	TRobinHoodMap(const TRobinHoodMap& Other)
+		: NumElements(0)
+	{
+		*this = Other;
+	}
+
+	TRobinHoodMap(TRobinHoodMap&& Other)
+		: Hashes(MoveTemp(Other.Hashes))
+		, Elements(MoveTemp(Other.Elements))
+		, NumElements(Other.NumElements)
+	{
+		Other.NumElements = 0;
+	}
+
+	~TRobinHoodMap()
+	{
+		DestructElements();
+	}
+
+	TRobinHoodMap& operator=(const TRobinHoodMap& Other)
+	{
+		if (this != &Other)
+		{
+			Empty(Other.Num());
+			for (TConstIterator It(Other); It; ++It)
+			{
+				Add(It.Key(), It.Value());
+			}
+		}
+		return *this;
+	}
+
+	TRobinHoodMap& operator=(TRobinHoodMap&& Other)
+	{
+		if (this != &Other)
+		{
+			DestructElements();
+			Hashes = MoveTemp(Other.Hashes);
+			Elements = MoveTemp(Other.Elements);
+			NumElements = Other.NumElements;
+			Other.NumElements = 0;
+		}
+		return *this;
+	}
+
+	/** @return the number of pairs in the map */
+	FORCEINLINE int32 Num() const
+	{
+		return NumElements;
+	}
+
+	/**
+	 * Removes all the pairs from the map.
+	 *
+	 * @param ExpectedNumElements	The number of pairs about to be added, to size the table for
+	 */
+	void Empty(int32 ExpectedNumElements = 0)
+	{
+		DestructElements();
+		Hashes.Empty();
+		Elements.Empty();
+		NumElements = 0;
+		Reserve(ExpectedNumElements);
+	}
+
+	/** Removes all the pairs from the map, keeping the table allocated */
+	void Reset()
+	{
+		DestructElements();
+		if (Hashes.Num())
+		{
+			FMemory::Memzero(Hashes.GetData(), Hashes.Num() * sizeof(uint32));
+		}
+		NumElements = 0;
+	}
+
+	/** Sizes the table so that NumElements pairs can be added without growing it */
+	void Reserve(int32 InNumElements)
+	{
+		const int32 MinNumSlots = GetNumSlotsFor(InNumElements);
+		if (MinNumSlots > Hashes.Num())
+		{
+			Rehash(MinNumSlots);
+		}
+	}
+
+	/**
+	 * Sets the value associated with a key, adding the key if it isn't in the map.
+	 *
+	 * @return a reference to the value in the map
+	 */
+	ValueType& Add(KeyInitType Key, const ValueType& Value)
+	{
+		const uint32 Hash = HashKey(Key);
+		const int32 Slot = FindSlot(Key, Hash);
+		if (Slot != INDEX_NONE)
+		{
+			ValueType& ExistingValue = GetElement(Slot).Value;
+			ExistingValue = Value;
+			return ExistingValue;
+		}
+
+		TTypeCompatibleBytes<ElementType> NewElement;
+		new(&NewElement) ElementType(TPairInitializer<KeyInitType, const ValueType&>(Key, Value));
+		return GetElement(AddUnique(Hash, NewElement)).Value;
+	}
+
+	/** @return a reference to the value associated with a key, adding a default constructed value if it isn't in the map */
+	ValueType& FindOrAdd(KeyInitType Key)
+	{
+		const uint32 Hash = HashKey(Key);
+		const int32 Slot = FindSlot(Key, Hash);
+		if (Slot != INDEX_NONE)
+		{
+			return GetElement(Slot).Value;
+		}
+
+		TTypeCompatibleBytes<ElementType> NewElement;
+		new(&NewElement) ElementType(TKeyInitializer<KeyInitType>(Key));
+		return GetElement(AddUnique(Hash, NewElement)).Value;
+	}
+
+	/**
+	 * Removes the pair with a key.
+	 *
+	 * @return the number of pairs removed, 0 or 1
+	 */
+	int32 Remove(KeyInitType Key)
+	{
+		const int32 Slot = FindSlot(Key, HashKey(Key));
+		if (Slot == INDEX_NONE)
+		{
+			return 0;
+		}
+		RemoveSlot(Slot);
+		return 1;
+	}
+
+	/** @return a pointer to the value associated with a key, or nullptr if it isn't in the map */
+	FORCEINLINE ValueType* Find(KeyInitType Key)
+	{
+		const int32 Slot = FindSlot(Key, HashKey(Key));
+		return Slot != INDEX_NONE ? &GetElement(Slot).Value : nullptr;
+	}
+
+	FORCEINLINE const ValueType* Find(KeyInitType Key) const
+	{
+		return const_cast<TRobinHoodMap*>(this)->Find(Key);
+	}
+
+	/** @return a reference to the value associated with a key, which must be in the map */
+	FORCEINLINE ValueType& FindChecked(KeyInitType Key)
+	{
+		ValueType* Value = Find(Key);
+		check(Value != nullptr);
+		return *Value;
+	}
+
+	FORCEINLINE const ValueType& FindChecked(KeyInitType Key) const
+	{
+		const ValueType* Value = Find(Key);
+		check(Value != nullptr);
+		return *Value;
+	}
+
+	/** @return a copy of the value associated with a key, or a default constructed value if it isn't in the map */
+	FORCEINLINE ValueType FindRef(KeyInitType Key) const
+	{
+		const ValueType* Value = Find(Key);
+		return Value ? *Value : ValueType();
+	}
+
+	/** @return whether a key is in the map */
+	FORCEINLINE bool Contains(KeyInitType Key) const
+	{
+		return FindSlot(Key, HashKey(Key)) != INDEX_NONE;
+	}
+
+	/** @return the number of bytes allocated by the map */
+	uint32 GetAllocatedSize() const
+	{
+		return Hashes.GetAllocatedSize() + Elements.GetAllocatedSize();
+	}
+
+	/** Tracks the container's memory use through an archive. */
+	void CountBytes(FArchive& Ar)
+	{
+		Hashes.CountBytes(Ar);
+		Elements.CountBytes(Ar);
+	}
+
+private:
+	/** Base of the iterators, goes through the slots starting after an empty one so pairs shifted back by RemoveCurrent are still visited */
+	template<bool bConst>
+	class TBaseIterator
+	{
+	public:
+		typedef typename TChooseClass<bConst, const TRobinHoodMap, TRobinHoodMap>::Result MapType;
+		typedef typename TChooseClass<bConst, const ElementType, ElementType>::Result ItElementType;
+		typedef typename TChooseClass<bConst, const ValueType, ValueType>::Result ItValueType;
+
+		FORCEINLINE TBaseIterator(MapType& InMap, bool bAtEnd = false)
+			: Map(InMap)
+			, StartSlot(0)
+			, Step(0)
+			, NumSteps(0)
+		{
+			if (!bAtEnd && Map.NumElements > 0)
+			{
+				// The load factor leaves empty slots, and no pair is shifted back past one
+				while (Map.Hashes[StartSlot] != 0)
+				{
+					++StartSlot;
+				}
+				NumSteps = Map.Hashes.Num();
+				Advance();
+			}
+		}
+
+		FORCEINLINE TBaseIterator& operator++()
+		{
+			Advance();
+			return *this;
+		}
+
+		/** conversion to "bool" returning true if the iterator is valid. */
+		FORCEINLINE_EXPLICIT_OPERATOR_BOOL() const
+		{
+			return Step <= NumSteps && NumSteps > 0;
+		}
+		/** inverse of the "bool" operator */
+		FORCEINLINE bool operator !() const
+		{
+			return !(bool)*this;
+		}
+
+		FORCEINLINE const KeyType& Key() const
+		{
+			return GetCurrent().Key;
+		}
+		FORCEINLINE ItValueType& Value() const
+		{
+			return GetCurrent().Value;
+		}
+		FORCEINLINE ItElementType& operator*() const
+		{
+			return GetCurrent();
+		}
+		FORCEINLINE ItElementType* operator->() const
+		{
+			return &GetCurrent();
+		}
+
+		FORCEINLINE friend bool operator==(const TBaseIterator& Lhs, const TBaseIterator& Rhs) { return &Lhs.Map == &Rhs.Map && (bool)Lhs == (bool)Rhs && (!Lhs || Lhs.Step == Rhs.Step); }
+		FORCEINLINE friend bool operator!=(const TBaseIterator& Lhs, const TBaseIterator& Rhs) { return !(Lhs == Rhs); }
+
+	protected:
+		FORCEINLINE int32 GetSlot() const
+		{
+			return (StartSlot + Step) & (Map.Hashes.Num() - 1);
+		}
+
+		FORCEINLINE ItElementType& GetCurrent() const
+		{
+			return Map.GetElement(GetSlot());
+		}
+
+		/** Moves to the next slot holding a pair */
+		void Advance()
+		{
+			do
+			{
+				++Step;
+			}
+			while (Step <= NumSteps && Map.Hashes[GetSlot()] == 0);
+		}
+
+		MapType& Map;
+		int32 StartSlot;
+		int32 Step;
+		int32 NumSteps;
+	};
+
+public:
+	/** Iterator over the pairs of the map */
+	class TIterator : public TBaseIterator<false>
+	{
+	public:
+		FORCEINLINE TIterator(TRobinHoodMap& InMap, bool bAtEnd = false)
+			: TBaseIterator<false>(InMap, bAtEnd)
+		{
+		}
+
+		/** Removes the current pair, the iterator moves to the next one when incremented like for the other pairs */
+		void RemoveCurrent()
+		{
+			this->Map.RemoveSlot(this->GetSlot());
+
+			// The next pair may have been shifted back to the current slot
+			--this->Step;
+		}
+	};
+
+	/** Const iterator over the pairs of the map */
+	class TConstIterator : public TBaseIterator<true>
+	{
+	public:
+		FORCEINLINE TConstIterator(const TRobinHoodMap& InMap, bool bAtEnd = false)
+			: TBaseIterator<true>(InMap, bAtEnd)
+		{
+		}
+	};
+
+	FORCEINLINE TIterator CreateIterator()
+	{
+		return TIterator(*this);
+	}
+
+	FORCEINLINE TConstIterator CreateConstIterator() const
+	{
+		return TConstIterator(*this);
+	}
+
+private:
+	/**
+	 * DO NOT USE DIRECTLY
+	 * STL-like iterators to enable range-based for loop support.
+	 */
+	FORCEINLINE friend TIterator      begin(      TRobinHoodMap& Map) { return TIterator     (Map); }
+	FORCEINLINE friend TConstIterator begin(const TRobinHoodMap& Map) { return TConstIterator(Map); }
+	FORCEINLINE friend TIterator      end  (      TRobinHoodMap& Map) { return TIterator     (Map, true); }
+	FORCEINLINE friend TConstIterator end  (const TRobinHoodMap& Map) { return TConstIterator(Map, true); }
+
+	/** @return the hash stored for a key, 0 is kept for empty slots and the top bit is above any slot index */
+	static FORCEINLINE uint32 HashKey(KeyInitType Key)
+	{
+		return KeyFuncs::GetKeyHash(Key) | 0x80000000u;
+	}
+
+	/** @return how far a slot is from the one its hash maps to */
+	FORCEINLINE uint32 GetProbeDistance(uint32 Hash, int32 Slot) const
+	{
+		return (Slot - Hash) & (Hashes.Num() - 1);
+	}
+
+	/** @return the number of slots needed for a number of pairs, keeping the load factor below 7/8 */
+	static int32 GetNumSlotsFor(int32 InNumElements)
+	{
+		return InNumElements > 0 ? FMath::Max<int32>(8, FMath::RoundUpToPowerOfTwo(InNumElements + InNumElements / 7 + 1)) : 0;
+	}
+
+	FORCEINLINE ElementType& GetElement(int32 Slot)
+	{
+		return *(ElementType*)&Elements.GetData()[Slot];
+	}
+
+	FORCEINLINE const ElementType& GetElement(int32 Slot) const
+	{
+		return *(const ElementType*)&Elements.GetData()[Slot];
+	}
+
+	/** @return the slot of the pair with a key, INDEX_NONE if it isn't in the map */
+	int32 FindSlot(KeyInitType Key, uint32 Hash) const
+	{
+		if (NumElements == 0)
+		{
+			return INDEX_NONE;
+		}
+
+		const uint32* HashData = Hashes.GetData();
+		const int32 SlotMask = Hashes.Num() - 1;
+		for (uint32 Distance = 0, Slot = Hash & SlotMask; ; ++Distance, Slot = (Slot + 1) & SlotMask)
+		{
+			const uint32 SlotHash = HashData[Slot];
+
+			// A pair with the key would have displaced any pair closer to its own slot
+			if (SlotHash == 0 || GetProbeDistance(SlotHash, Slot) < Distance)
+			{
+				return INDEX_NONE;
+			}
+			if (SlotHash == Hash && KeyFuncs::Matches(KeyFuncs::GetSetKey(GetElement(Slot)), Key))
+			{
+				return Slot;
+			}
+		}
+	}
+
+	/** Relocates a pair whose key isn't in the map yet into the table, growing it if needed, and returns its slot */
+	int32 AddUnique(uint32 Hash, TTypeCompatibleBytes<ElementType>& NewElement)
+	{
+		if (GetNumSlotsFor(NumElements + 1) > Hashes.Num())
+		{
+			Rehash(FMath::Max(8, Hashes.Num() * 2));
+		}
+		++NumElements;
+		return Insert(Hash, NewElement);
+	}
+
+	/** Relocates a pair into the table, displacing pairs closer to their slot than it is, and returns its slot */
+	int32 Insert(uint32 Hash, TTypeCompatibleBytes<ElementType>& NewElement)
+	{
+		uint32* HashData = Hashes.GetData();
+		const int32 SlotMask = Hashes.Num() - 1;
+		int32 ResultSlot = INDEX_NONE;
+		for (uint32 Distance = 0, Slot = Hash & SlotMask; ; ++Distance, Slot = (Slot + 1) & SlotMask)
+		{
+			if (HashData[Slot] == 0)
+			{
+				HashData[Slot] = Hash;
+				FMemory::Memcpy(&Elements.GetData()[Slot], &NewElement, sizeof(ElementType));
+				return ResultSlot != INDEX_NONE ? ResultSlot : Slot;
+			}
+
+			const uint32 SlotDistance = GetProbeDistance(HashData[Slot], Slot);
+			if (SlotDistance < Distance)
+			{
+				// Take the slot and carry on with the pair that was in it
+				Exchange(HashData[Slot], Hash);
+				FMemory::Memswap(&Elements.GetData()[Slot], &NewElement, sizeof(ElementType));
+				if (ResultSlot == INDEX_NONE)
+				{
+					ResultSlot = Slot;
+				}
+				Distance = SlotDistance;
+			}
+		}
+	}
+
+	/** Destroys the pair in a slot, and shifts the pairs following it back until one is in its own slot */
+	void RemoveSlot(int32 Slot)
+	{
+		DestructItems(&GetElement(Slot), 1);
+
+		uint32* HashData = Hashes.GetData();
+		const int32 SlotMask = Hashes.Num() - 1;
+		for (int32 NextSlot = (Slot + 1) & SlotMask; HashData[NextSlot] != 0 && GetProbeDistance(HashData[NextSlot], NextSlot) != 0; NextSlot = (NextSlot + 1) & SlotMask)
+		{
+			HashData[Slot] = HashData[NextSlot];
+			FMemory::Memcpy(&Elements.GetData()[Slot], &Elements.GetData()[NextSlot], sizeof(ElementType));
+			Slot = NextSlot;
+		}
+		HashData[Slot] = 0;
+		--NumElements;
+	}
+
+	/** Reallocates the table with a number of slots, a power of two, and relocates the pairs into it */
+	void Rehash(int32 NumSlots)
+	{
+		checkSlow(FMath::IsPowerOfTwo(NumSlots));
+
+		TArray<uint32> OldHashes(MoveTemp(Hashes));
+		TArray<TTypeCompatibleBytes<ElementType> > OldElements(MoveTemp(Elements));
+
+		Hashes.Empty(NumSlots);
+		Hashes.AddZeroed(NumSlots);
+		Elements.Empty(NumSlots);
+		Elements.AddUninitialized(NumSlots);
+
+		for (int32 Slot = 0; Slot < OldHashes.Num(); ++Slot)
+		{
+			if (OldHashes[Slot] != 0)
+			{
+				Insert(OldHashes[Slot], OldElements[Slot]);
+			}
+		}
+	}
+
+	void DestructElements()
+	{
+		if (TTypeTraits<ElementType>::NeedsDestructor)
+		{
+			for (int32 Slot = 0; Slot < Hashes.Num(); ++Slot)
+			{
+				if (Hashes[Slot] != 0)
+				{
+					DestructItems(&GetElement(Slot), 1);
+				}
+			}
+		}
+	}
+
+	/** Stored hash of the pair in each slot, 0 for empty slots */
+	TArray<uint32> Hashes;
+
+	/** Storage of the pair in each slot */
+	TArray<TTypeCompatibleBytes<ElementType> > Elements;
+
+	/** Number of pairs in the table */
+	int32 NumElements;
+};
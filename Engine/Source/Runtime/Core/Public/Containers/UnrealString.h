@@ -270,6 +270,18 @@ public:
 		Data.Empty(Slack);
 	}
 
+	/**
+	 * Empties the string, but doesn't change memory allocations unless the new size is larger than the current string.
+	 * Use it instead of assigning an empty string to a string that is filled again, e.g. in a parsing loop.
+	 *
+	 * @param NewReservedSize The expected usage size (in characters, not including the terminator) after calling this function.
+	 */
+	FORCEINLINE void Reset( int32 NewReservedSize=0 )
+	{
+		const int32 NewSizeIncludingTerminator = (NewReservedSize > 0) ? (NewReservedSize + 1) : 0;
+		Data.Reset(NewSizeIncludingTerminator);
+	}
+
 	/**
 	 * Test whether this string is empty
 	 *
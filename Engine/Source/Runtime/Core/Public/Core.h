@@ -42,6 +42,7 @@
 #include "ScopedDebugInfo.h"			// Scoped debug info.
 #include "ExternalProfiler.h"			// External profiler integration.
 #include "MemoryBase.h"					// Base memory allocation
+#include "MemoryTags.h"					// Memory tag scopes.
 #include "ByteSwap.h"					// ByteSwapping utility code.
 #include "ITransaction.h"				// Transaction handling
 #include "Compression.h"				// Low level compression routines
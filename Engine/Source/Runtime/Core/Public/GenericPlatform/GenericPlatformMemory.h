@@ -169,6 +169,31 @@ struct CORE_API FGenericPlatformMemory
 		SIZE_T			Size;
 	};
 
+	/**
+	 * Generic representation of a read only mapping of a whole file
+	 */
+	struct FMappedFile
+	{
+		/** Returns the beginning of the file in process address space */
+		const uint8 *	GetData() const			{ return Data; }
+
+		/** Returns size of the file in bytes */
+		int64			GetSize() const			{ return Size; }
+
+		FMappedFile(const uint8* InData, int64 InSize)
+			:	Data(InData)
+			,	Size(InSize)
+		{}
+
+	protected:
+
+		/** The mapped file */
+		const uint8 *	Data;
+
+		/** Size of the file */
+		int64			Size;
+	};
+
 	/** Initializes platform memory specific constants. */
 	static void Init();
 	
@@ -293,4 +318,22 @@ struct CORE_API FGenericPlatformMemory
 	 * @return true if successful
 	 */
 	static bool UnmapNamedSharedMemoryRegion(FSharedMemoryRegion * MemoryRegion);
+
+	/**
+	 * Maps a whole file read only into process address space. Pages are loaded on demand and shared with other processes mapping the same file.
+	 *
+	 * @param Filename file to map, relative paths are converted to full paths.
+	 *
+	 * @return pointer to FMappedFile (or its descendants) if successful, NULL if not supported or failed.
+	 */
+	static FMappedFile* MapFile(const TCHAR* Filename);
+
+	/**
+	 * Unmaps a file mapped by MapFile
+	 *
+	 * @param MappedFile an object that encapsulates the mapping (will be destroyed even if function fails!)
+	 *
+	 * @return true if successful
+	 */
+	static bool UnmapFile(FMappedFile* MappedFile);
 };
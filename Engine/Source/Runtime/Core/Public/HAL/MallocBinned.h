@@ -27,6 +27,21 @@
 #	define USE_FINE_GRAIN_LOCKS
 #endif
 
+// Each thread keeps a few free blocks of every small size, so most allocs and frees don't take the table locks
+#if defined USE_FINE_GRAIN_LOCKS
+#	define USE_THREAD_CACHE
+#	define THREAD_CACHE_MAX_BLOCKS_PER_BIN (64)
+#	define THREAD_CACHE_BIN_BYTE_LIMIT (32*1024)
+#	define THREAD_CACHE_BYTE_LIMIT (256*1024)
+#	define THREAD_CACHE_STATS_INTERVAL (1024)
+#endif
+
+// Allocations between the small pools and MAX_MEDIUM_POOLED_ALLOCATION_SIZE share pools of a few MB instead of
+// getting an OS allocation each. Only worth the address space on 64 bit
+#if PLATFORM_64BITS
+#	define USE_MEDIUM_POOLS
+#endif
+
 #include "LockFreeList.h"
 #include "Array.h"
 
@@ -40,6 +55,8 @@ DECLARE_MEMORY_STAT_EXTERN(TEXT("Binned Used Peak"),		STAT_Binned_UsedPeak,STATG
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Binned Current Allocs"),	STAT_Binned_CurrentAllocs,STATGROUP_MemoryAllocator, CORE_API);
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Binned Total Allocs"),		STAT_Binned_TotalAllocs,STATGROUP_MemoryAllocator, CORE_API);
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Binned Slack Current"),	STAT_Binned_SlackCurrent,STATGROUP_MemoryAllocator, CORE_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Binned Thread Cached"),	STAT_Binned_ThreadCachedCurrent,STATGROUP_MemoryAllocator, CORE_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Binned Thread Cache Hit %"),	STAT_Binned_ThreadCacheHitRate,STATGROUP_MemoryAllocator, CORE_API);
 
 
 //
@@ -54,6 +71,13 @@ private:
 
 	/** Maximum allocation for the pooled allocator */
 	enum { EXTENED_PAGE_POOL_ALLOCATION_COUNT = 2 };
+	/** Mid-size pools, four size classes for each power of two from 32K to 1MB */
+	enum { MEDIUM_POOL_COUNT = 20 };
+	enum { MEDIUM_POOL_GRANULARITY = 8192 };
+	enum { MAX_MEDIUM_POOLED_ALLOCATION_SIZE = 1024*1024 };
+	/** Minimum size of a mid-size pool, and minimum number of blocks each of them holds */
+	enum { MEDIUM_POOL_SIZE = 2*1024*1024 };
+	enum { MEDIUM_POOL_MIN_BLOCKS = 4 };
 	enum { MAX_POOLED_ALLOCATION_SIZE   = 32768+1 };
 	enum { PAGE_SIZE_LIMIT = 65536 };
 	// BINNED_ALLOC_POOL_SIZE can be increased beyond 64k to cause binned malloc to allocate
@@ -193,11 +217,22 @@ private:
 
 		/** Total waste from all allocs in this table */
 		uint64				TotalWaste;
+#endif
+#ifdef USE_THREAD_CACHE
+		/** Max number of free blocks of this table a thread keeps, 0 if the table isn't cached */
+		uint32				ThreadCacheMaxBlocks;
+
+		/** Number of blocks moved at once between a thread cache and this table */
+		uint32				ThreadCacheBatch;
 #endif
 		FPoolTable()
 			: FirstPool(nullptr)
 			, ExhaustedPool(nullptr)
 			, BlockSize(0)
+#ifdef USE_THREAD_CACHE
+			, ThreadCacheMaxBlocks(0)
+			, ThreadCacheBatch(0)
+#endif
 #if STATS
 			, NumActivePools(0)
 			, MaxActivePools(0)
@@ -213,6 +248,33 @@ private:
 		}
 	};
 
+#ifdef USE_THREAD_CACHE
+	/** Free blocks kept by a single thread, one list per pool table. Only touched by its own thread */
+	struct FThreadCache
+	{
+		struct FBin
+		{
+			FFreeMem*	Head;
+			uint32		Count;
+		};
+
+		FBin		Bins[POOL_COUNT];
+		/** Bytes sitting in the bins */
+		uint32		CachedBytes;
+#if STATS
+		/** Part of CachedBytes already added to ThreadCachedBytes */
+		uint32		ReportedBytes;
+		uint32		Hits;
+		uint32		Misses;
+#endif
+
+		FThreadCache()
+		{
+			FMemory::Memzero(this, sizeof(*this));
+		}
+	};
+#endif
+
 	/** Hash table struct for retrieving allocation book keeping information */
 	struct PoolHashBucket
 	{
@@ -282,12 +344,17 @@ private:
 	uint64 PoolMask;
 	uint64 BinnedSizeLimit;
 	uint64 BinnedOSTableIndex;
+	/** MemSizeToPoolTable index of the first mid-size table */
+	uint64 BinnedMediumTableIndex;
 
 	// Variables.
 	FPoolTable  PoolTable[POOL_COUNT];
 	FPoolTable	OsTable;
 	FPoolTable	PagePoolTable[EXTENED_PAGE_POOL_ALLOCATION_COUNT];
-	FPoolTable* MemSizeToPoolTable[MAX_POOLED_ALLOCATION_SIZE+EXTENED_PAGE_POOL_ALLOCATION_COUNT];
+	FPoolTable	MediumPoolTable[MEDIUM_POOL_COUNT];
+	FPoolTable* MemSizeToPoolTable[MAX_POOLED_ALLOCATION_SIZE+EXTENED_PAGE_POOL_ALLOCATION_COUNT+MEDIUM_POOL_COUNT];
+	/** Index in MediumPoolTable for each MEDIUM_POOL_GRANULARITY step of size */
+	uint8		MediumSizeToIndex[MAX_MEDIUM_POOLED_ALLOCATION_SIZE/MEDIUM_POOL_GRANULARITY];
 
 	PoolHashBucket* HashBuckets;
 	PoolHashBucket* HashBucketFreeList;
@@ -300,6 +367,18 @@ private:
 	uint32			CachedTotal;
 #endif
 
+#ifdef USE_THREAD_CACHE
+	/** TLS slot holding the FThreadCache of each thread */
+	uint32			ThreadCacheSlot;
+#if STATS
+	volatile int32	ThreadCachedBytes;
+	/** Hits and misses since the last UpdateStats */
+	volatile int32	ThreadCacheHits;
+	volatile int32	ThreadCacheMisses;
+	float			ThreadCacheHitRate;
+#endif
+#endif
+
 #if STATS
 	SIZE_T		OsCurrent;
 	SIZE_T		OsPeak;
@@ -489,6 +568,12 @@ private:
 		return Free;
 	}
 
+	/** Size of the OS allocations of a mid-size table */
+	static FORCEINLINE uint32 GetMediumPoolSize(uint32 BlockSize)
+	{
+		return FMath::Max<uint32>(MEDIUM_POOL_SIZE, MEDIUM_POOL_MIN_BLOCKS * BlockSize);
+	}
+
 	FPoolInfo* AllocatePoolMemory(FPoolTable* Table, uint32 PoolSize, uint16 TableIndex)
 	{
 		// Must create a new pool.
@@ -593,38 +678,7 @@ private:
 #ifdef USE_FINE_GRAIN_LOCKS
 			FScopeLock TableLock(&Table->CriticalSection);
 #endif
-#if STATS
-			Table->ActiveRequests--;
-#endif
-			// If this pool was exhausted, move to available list.
-			if( !Pool->FirstMem )
-			{
-				Pool->Unlink();
-				Pool->Link( Table->FirstPool );
-			}
-
-			// Free a pooled allocation.
-			FFreeMem* Free		= (FFreeMem*)Ptr;
-			Free->NumFreeBlocks	= 1;
-			Free->Next			= Pool->FirstMem;
-			Pool->FirstMem		= Free;
-			STAT(UsedCurrent -= Table->BlockSize);
-
-			// Free this pool.
-			checkSlow(Pool->Taken >= 1);
-			if( --Pool->Taken == 0 )
-			{
-#if STATS
-				Table->NumActivePools--;
-#endif
-				// Free the OS memory.
-				SIZE_T OsBytes = Pool->GetOsBytes(PageSize, BinnedOSTableIndex);
-				STAT(OsCurrent -= OsBytes);
-				STAT(WasteCurrent -= OsBytes - Pool->GetBytes());
-				Pool->Unlink();
-				Pool->SetAllocationSizes(0, 0, 0, BinnedOSTableIndex);
-				OSFree((void*)BasePtr, OsBytes);
-			}
+			FreePooledBlock(Table, Pool, Ptr, BasePtr);
 		}
 		else
 		{
@@ -640,6 +694,204 @@ private:
 		MEM_TIME(MemTime += FPlatformTime::Seconds());
 	}
 
+	/**
+	* Gives a pooled block back to its pool, and the pool back to the OS once it's empty. The caller
+	* must hold the table lock.
+	*/
+	FORCEINLINE void FreePooledBlock( FPoolTable* Table, FPoolInfo* Pool, void* Ptr, UPTRINT BasePtr )
+	{
+#if STATS
+		Table->ActiveRequests--;
+#endif
+		// If this pool was exhausted, move to available list.
+		if( !Pool->FirstMem )
+		{
+			Pool->Unlink();
+			Pool->Link( Table->FirstPool );
+		}
+
+		// Free a pooled allocation.
+		FFreeMem* Free		= (FFreeMem*)Ptr;
+		Free->NumFreeBlocks	= 1;
+		Free->Next			= Pool->FirstMem;
+		Pool->FirstMem		= Free;
+		STAT(UsedCurrent -= Table->BlockSize);
+
+		// Free this pool.
+		checkSlow(Pool->Taken >= 1);
+		if( --Pool->Taken == 0 )
+		{
+#if STATS
+			Table->NumActivePools--;
+#endif
+			// Free the OS memory.
+			SIZE_T OsBytes = Pool->GetOsBytes(PageSize, BinnedOSTableIndex);
+			STAT(OsCurrent -= OsBytes);
+			STAT(WasteCurrent -= OsBytes - Pool->GetBytes());
+			Pool->Unlink();
+			Pool->SetAllocationSizes(0, 0, 0, BinnedOSTableIndex);
+			OSFree((void*)BasePtr, OsBytes);
+		}
+	}
+
+#ifdef USE_THREAD_CACHE
+	/** TLS value of the threads that don't cache, because they flushed their cache or are creating it */
+	static FORCEINLINE FThreadCache* ThreadCacheDisabled()
+	{
+		return (FThreadCache*)1;
+	}
+
+	/** Returns the cache of the calling thread, creating it on first use. nullptr if the thread doesn't cache */
+	FORCEINLINE FThreadCache* GetThreadCache()
+	{
+		FThreadCache* Cache = (FThreadCache*)FPlatformTLS::GetTlsValue(ThreadCacheSlot);
+		if( Cache == ThreadCacheDisabled() )
+		{
+			return nullptr;
+		}
+		if( !Cache )
+		{
+			// The cache comes from the pools too, so don't cache while allocating it
+			FPlatformTLS::SetTlsValue(ThreadCacheSlot, ThreadCacheDisabled());
+			Cache = new(Malloc(sizeof(FThreadCache), DEFAULT_ALIGNMENT)) FThreadCache();
+			FPlatformTLS::SetTlsValue(ThreadCacheSlot, Cache);
+		}
+		return Cache;
+	}
+
+	/** Takes a block from the thread cache, refilling the bin from the table if it's empty */
+	FORCEINLINE FFreeMem* AllocateFromThreadCache( FThreadCache* Cache, FPoolTable* Table )
+	{
+		FThreadCache::FBin& Bin = Cache->Bins[Table - PoolTable];
+		if( !Bin.Head )
+		{
+			RefillThreadCache(Cache, Bin, Table);
+		}
+#if STATS
+		else if( ++Cache->Hits == THREAD_CACHE_STATS_INTERVAL )
+		{
+			FlushThreadCacheStats(Cache);
+		}
+#endif
+		FFreeMem* Free = Bin.Head;
+		Bin.Head = Free->Next;
+		Bin.Count--;
+		Cache->CachedBytes -= Table->BlockSize;
+		return Free;
+	}
+
+	/** Moves a batch of blocks from the table to an empty bin, with a single lock */
+	void RefillThreadCache( FThreadCache* Cache, FThreadCache::FBin& Bin, FPoolTable* Table )
+	{
+		{
+			FScopeLock TableLock(&Table->CriticalSection);
+			for( uint32 i = 0; i < Table->ThreadCacheBatch; i++ )
+			{
+				// The table sees the cached blocks as allocated, until they are returned
+				TrackStats(Table, Table->BlockSize);
+
+				FPoolInfo* Pool = Table->FirstPool;
+				if( !Pool )
+				{
+					Pool = AllocatePoolMemory(Table, BINNED_ALLOC_POOL_SIZE, Table->BlockSize);
+				}
+
+				FFreeMem* Free = AllocateBlockFromPool(Table, Pool);
+				Free->Next = Bin.Head;
+				Bin.Head = Free;
+			}
+		}
+		Bin.Count += Table->ThreadCacheBatch;
+		Cache->CachedBytes += Table->ThreadCacheBatch * Table->BlockSize;
+#if STATS
+		Cache->Misses++;
+		FlushThreadCacheStats(Cache);
+#endif
+	}
+
+	/** Moves up to Count blocks from a bin back to the table, with a single lock */
+	void ReturnThreadCacheBlocks( FThreadCache* Cache, FThreadCache::FBin& Bin, FPoolTable* Table, uint32 Count )
+	{
+		{
+			FScopeLock TableLock(&Table->CriticalSection);
+			for( ; Count && Bin.Head; Count-- )
+			{
+				FFreeMem* Free = Bin.Head;
+				Bin.Head = Free->Next;
+				Bin.Count--;
+				Cache->CachedBytes -= Table->BlockSize;
+
+				UPTRINT BasePtr;
+				FPoolInfo* Pool = FindPoolInfo((UPTRINT)Free, BasePtr);
+				FreePooledBlock(Table, Pool, Free, BasePtr);
+			}
+		}
+		STAT(FlushThreadCacheStats(Cache));
+	}
+
+	/** Empties all the bins of a thread cache */
+	void ReturnAllThreadCacheBlocks( FThreadCache* Cache )
+	{
+		for( uint32 i = 0; i < POOL_COUNT; i++ )
+		{
+			if( Cache->Bins[i].Head )
+			{
+				ReturnThreadCacheBlocks(Cache, Cache->Bins[i], &PoolTable[i], Cache->Bins[i].Count);
+			}
+		}
+	}
+
+	/** Keeps a freed block in the calling thread cache. Returns false if the block has to go back to its table */
+	FORCEINLINE bool FreeToThreadCache( void* Ptr )
+	{
+		UPTRINT BasePtr;
+		FPoolInfo* Pool = FindPoolInfo((UPTRINT)Ptr, BasePtr);
+		if( !Pool || Pool->TableIndex >= BinnedSizeLimit )
+		{
+			return false;
+		}
+
+		FPoolTable* Table = MemSizeToPoolTable[Pool->TableIndex];
+		FThreadCache* Cache = Table->ThreadCacheMaxBlocks ? GetThreadCache() : nullptr;
+		if( !Cache )
+		{
+			return false;
+		}
+
+		// A thread that frees what others allocate would grow its cache forever, give a batch back once the bin is full
+		FThreadCache::FBin& Bin = Cache->Bins[Table - PoolTable];
+		if( Bin.Count >= Table->ThreadCacheMaxBlocks || Cache->CachedBytes + Table->BlockSize > THREAD_CACHE_BYTE_LIMIT )
+		{
+			ReturnThreadCacheBlocks(Cache, Bin, Table, Table->ThreadCacheBatch);
+			if( Cache->CachedBytes + Table->BlockSize > THREAD_CACHE_BYTE_LIMIT )
+			{
+				return false;
+			}
+		}
+
+		STAT(CurrentAllocs--);
+		FFreeMem* Free = (FFreeMem*)Ptr;
+		Free->Next = Bin.Head;
+		Bin.Head = Free;
+		Bin.Count++;
+		Cache->CachedBytes += Table->BlockSize;
+		return true;
+	}
+
+#if STATS
+	/** Adds the bytes, hits and misses of a thread cache to the allocator totals */
+	void FlushThreadCacheStats( FThreadCache* Cache )
+	{
+		FPlatformAtomics::InterlockedAdd(&ThreadCachedBytes, (int32)Cache->CachedBytes - (int32)Cache->ReportedBytes);
+		FPlatformAtomics::InterlockedAdd(&ThreadCacheHits, (int32)Cache->Hits);
+		FPlatformAtomics::InterlockedAdd(&ThreadCacheMisses, (int32)Cache->Misses);
+		Cache->ReportedBytes = Cache->CachedBytes;
+		Cache->Hits = 0;
+		Cache->Misses = 0;
+	}
+#endif
+#endif
+
 	void PushFreeLockless(void* Ptr)
 	{
 #ifdef USE_LOCKFREE_DELETE
@@ -785,6 +1037,15 @@ public:
 		,	FreedPageBlocksNum(0)
 		,	CachedTotal(0)
 #endif
+#ifdef USE_THREAD_CACHE
+		,	ThreadCacheSlot(FPlatformTLS::AllocTlsSlot())
+#if STATS
+		,	ThreadCachedBytes(0)
+		,	ThreadCacheHits(0)
+		,	ThreadCacheMisses(0)
+		,	ThreadCacheHitRate(0.0f)
+#endif
+#endif
 #if STATS
 		,	OsCurrent		( 0 )
 		,	OsPeak			( 0 )
@@ -819,7 +1080,8 @@ public:
 		/** Used to mask off the bits that have been used to lookup the indirect table */
 		PoolMask =  ( ( 1 << ( HashKeyShift - PoolBitShift ) ) - 1 );
 		BinnedSizeLimit = PAGE_SIZE_LIMIT/2;
-		BinnedOSTableIndex = BinnedSizeLimit+EXTENED_PAGE_POOL_ALLOCATION_COUNT;
+		BinnedMediumTableIndex = BinnedSizeLimit+EXTENED_PAGE_POOL_ALLOCATION_COUNT;
+		BinnedOSTableIndex = BinnedMediumTableIndex+MEDIUM_POOL_COUNT;
 
 		checkf((BinnedSizeLimit & (BinnedSizeLimit-1)) == 0);
 
@@ -857,6 +1119,12 @@ public:
 			PoolTable[i].BlockSize = BlockSizes[i];
 #if STATS
 			PoolTable[i].MinRequest = PoolTable[i].BlockSize;
+#endif
+#ifdef USE_THREAD_CACHE
+			// A couple of big blocks would fill the cache, those always go to the table
+			const uint32 MaxCachedBlocks = FMath::Min<uint32>(THREAD_CACHE_MAX_BLOCKS_PER_BIN, THREAD_CACHE_BIN_BYTE_LIMIT / BlockSizes[i]);
+			PoolTable[i].ThreadCacheMaxBlocks = MaxCachedBlocks >= 2 ? MaxCachedBlocks : 0;
+			PoolTable[i].ThreadCacheBatch = FMath::Max<uint32>(MaxCachedBlocks / 2, 1);
 #endif
 		}
 
@@ -874,6 +1142,29 @@ public:
 		MemSizeToPoolTable[BinnedSizeLimit] = &PagePoolTable[0];
 		MemSizeToPoolTable[BinnedSizeLimit+1] = &PagePoolTable[1];
 
+		// Mid-size tables, the ones left with a zero block size are never used
+		for( uint32 i = 0; i < MEDIUM_POOL_COUNT; i++ )
+		{
+#ifdef USE_MEDIUM_POOLS
+			// 40K, 48K, 56K, 64K, 80K, 96K... up to 1MB
+			const uint32 PowerOfTwo = 32768 << (i / 4);
+			MediumPoolTable[i].BlockSize = PowerOfTwo + (i % 4 + 1) * (PowerOfTwo / 4);
+#if STATS
+			MediumPoolTable[i].MinRequest = MediumPoolTable[i].BlockSize;
+#endif
+#endif
+			MemSizeToPoolTable[BinnedMediumTableIndex+i] = &MediumPoolTable[i];
+		}
+
+		for( uint32 i = 0, Index = 0; i < MAX_MEDIUM_POOLED_ALLOCATION_SIZE/MEDIUM_POOL_GRANULARITY; i++ )
+		{
+			while( Index < MEDIUM_POOL_COUNT - 1 && MediumPoolTable[Index].BlockSize < (i + 1) * MEDIUM_POOL_GRANULARITY )
+			{
+				++Index;
+			}
+			MediumSizeToIndex[i] = (uint8)Index;
+		}
+
 		check(MAX_POOLED_ALLOCATION_SIZE - 1 == PoolTable[POOL_COUNT - 1].BlockSize);
 	}
 	
@@ -922,20 +1213,29 @@ public:
 		{
 			// Allocate from pool.
 			FPoolTable* Table = MemSizeToPoolTable[Size];
+			checkSlow(Size <= Table->BlockSize);
+#ifdef USE_THREAD_CACHE
+			FThreadCache* Cache = Table->ThreadCacheMaxBlocks ? GetThreadCache() : nullptr;
+			if( Cache )
+			{
+				Free = AllocateFromThreadCache(Cache, Table);
+			}
+			else
+#endif
+			{
 #ifdef USE_FINE_GRAIN_LOCKS
-			FScopeLock TableLock(&Table->CriticalSection);
+				FScopeLock TableLock(&Table->CriticalSection);
 #endif
-			checkSlow(Size <= Table->BlockSize);
+				TrackStats(Table, Size);
 
-			TrackStats(Table, Size);
+				FPoolInfo* Pool = Table->FirstPool;
+				if( !Pool )
+				{
+					Pool = AllocatePoolMemory(Table, BINNED_ALLOC_POOL_SIZE/*PageSize*/, Size);
+				}
 
-			FPoolInfo* Pool = Table->FirstPool;
-			if( !Pool )
-			{
-				Pool = AllocatePoolMemory(Table, BINNED_ALLOC_POOL_SIZE/*PageSize*/, Size);
+				Free = AllocateBlockFromPool(Table, Pool);
 			}
-
-			Free = AllocateBlockFromPool(Table, Pool);
 		}
 		else if ( ((Size >= BinnedSizeLimit && Size <= PagePoolTable[0].BlockSize) ||
 				  (Size > PageSize && Size <= PagePoolTable[1].BlockSize))
@@ -960,6 +1260,28 @@ public:
 
 			Free = AllocateBlockFromPool(Table, Pool);
 		}
+#ifdef USE_MEDIUM_POOLS
+		else if ( Size <= MAX_MEDIUM_POOLED_ALLOCATION_SIZE && Alignment == DEFAULT_BINNED_ALLOCATOR_ALIGNMENT )
+		{
+			// Bucket in a mid-size pool, so these don't merge and split the OS address space on each alloc
+			uint32 MediumIndex = MediumSizeToIndex[(Size - 1) / MEDIUM_POOL_GRANULARITY];
+			FPoolTable* Table = &MediumPoolTable[MediumIndex];
+#ifdef USE_FINE_GRAIN_LOCKS
+			FScopeLock TableLock(&Table->CriticalSection);
+#endif
+			checkSlow(Size <= Table->BlockSize);
+
+			TrackStats(Table, Size);
+
+			FPoolInfo* Pool = Table->FirstPool;
+			if( !Pool )
+			{
+				Pool = AllocatePoolMemory(Table, GetMediumPoolSize(Table->BlockSize), BinnedMediumTableIndex+MediumIndex);
+			}
+
+			Free = AllocateBlockFromPool(Table, Pool);
+		}
+#endif
 		else
 		{
 			// Use OS for large allocations.
@@ -1070,9 +1392,51 @@ public:
 			return;
 		}
 
+#ifdef USE_THREAD_CACHE
+		if( FreeToThreadCache(Ptr) )
+		{
+			return;
+		}
+#endif
 		PushFreeLockless(Ptr);
 	}
 
+	/**
+	 * Gives the blocks cached by the calling thread back to the tables. The thread doesn't cache anymore after this.
+	 */
+	virtual void FlushCurrentThreadCache() override
+	{
+#ifdef USE_THREAD_CACHE
+		FThreadCache* Cache = (FThreadCache*)FPlatformTLS::GetTlsValue(ThreadCacheSlot);
+		FPlatformTLS::SetTlsValue(ThreadCacheSlot, ThreadCacheDisabled());
+		if( Cache && Cache != ThreadCacheDisabled() )
+		{
+			ReturnAllThreadCacheBlocks(Cache);
+			Free(Cache);
+		}
+#endif
+	}
+
+	/**
+	 * Gives the memory kept for reuse back to the OS: the blocks cached by the calling thread, and the
+	 * freed OS allocations. Pools still in use can't be moved, so this doesn't compact them.
+	 */
+	virtual void Trim() override
+	{
+#ifdef USE_THREAD_CACHE
+		// Other threads caches are only touched by their own thread, they are bounded anyway
+		FThreadCache* Cache = (FThreadCache*)FPlatformTLS::GetTlsValue(ThreadCacheSlot);
+		if( Cache && Cache != ThreadCacheDisabled() )
+		{
+			ReturnAllThreadCacheBlocks(Cache);
+		}
+#endif
+#ifdef CACHE_FREED_OS_ALLOCS
+		// Empty pools went to the OS cache when their last block was freed
+		FlushAllocCache();
+#endif
+	}
+
 	/**
 	 * If possible determine the size of the memory allocated at the given address
 	 *
@@ -1088,7 +1452,7 @@ public:
 		}
 		UPTRINT BasePtr;
 		FPoolInfo* Pool = FindPoolInfo((UPTRINT)Original, BasePtr);
-		SizeOut = Pool->TableIndex < BinnedSizeLimit ? MemSizeToPoolTable[Pool->TableIndex]->BlockSize : Pool->GetBytes();
+		SizeOut = Pool->TableIndex < BinnedOSTableIndex ? MemSizeToPoolTable[Pool->TableIndex]->BlockSize : Pool->GetBytes();
 		return true;
 	}
 
@@ -1169,6 +1533,17 @@ public:
 		SET_MEMORY_STAT( STAT_Binned_CurrentAllocs, LocalCurrentAllocs );
 		SET_MEMORY_STAT( STAT_Binned_TotalAllocs, LocalTotalAllocs );
 		SET_MEMORY_STAT( STAT_Binned_SlackCurrent, LocalSlackCurrent );
+
+#ifdef USE_THREAD_CACHE
+		const int32 Hits = FPlatformAtomics::InterlockedExchange(&ThreadCacheHits, 0);
+		const int32 Misses = FPlatformAtomics::InterlockedExchange(&ThreadCacheMisses, 0);
+		if( Hits + Misses > 0 )
+		{
+			ThreadCacheHitRate = 100.0f * Hits / (Hits + Misses);
+		}
+		SET_MEMORY_STAT( STAT_Binned_ThreadCachedCurrent, ThreadCachedBytes );
+		SET_FLOAT_STAT( STAT_Binned_ThreadCacheHitRate, ThreadCacheHitRate );
+#endif
 #endif
 	}
 
@@ -1203,6 +1578,9 @@ public:
 			BufferedOutput.CategorizedLogf( LogMemory.GetCategoryName(), ELogVerbosity::Log, TEXT( "Current Slack %.2f MB" ), SlackCurrent / (1024.0f * 1024.0f) );
 
 			BufferedOutput.CategorizedLogf( LogMemory.GetCategoryName(), ELogVerbosity::Log, TEXT( "Allocs      % 6i Current / % 6i Total" ), CurrentAllocs, TotalAllocs );
+#ifdef USE_THREAD_CACHE
+			BufferedOutput.CategorizedLogf( LogMemory.GetCategoryName(), ELogVerbosity::Log, TEXT( "Thread caches %.2f MB, hit rate %.2f%%" ), ThreadCachedBytes / (1024.0f * 1024.0f), ThreadCacheHitRate );
+#endif
 			MEM_TIME( BufferedOutput.CategorizedLogf( LogMemory.GetCategoryName(), ELogVerbosity::Log, TEXT( "Seconds     % 5.3f" ), MemTime ) );
 			MEM_TIME( BufferedOutput.CategorizedLogf( LogMemory.GetCategoryName(), ELogVerbosity::Log, TEXT( "MSec/Allc   % 5.5f" ), 1000.0 * MemTime / MemAllocs ) );
 
@@ -1219,7 +1597,7 @@ public:
 			uint32 TotalSlack = 0;
 
 			FPoolTable* Table = nullptr;
-			for( int32 i = 0; i < BinnedSizeLimit + EXTENED_PAGE_POOL_ALLOCATION_COUNT; i++ )
+			for( int32 i = 0; i < BinnedOSTableIndex; i++ )
 			{
 				if( Table == MemSizeToPoolTable[i] || MemSizeToPoolTable[i]->BlockSize == 0 )
 					continue;
@@ -1230,7 +1608,8 @@ public:
 				FScopeLock TableLock(&Table->CriticalSection);
 #endif
 
-				uint32 TableAllocSize = (Table->BlockSize > BinnedSizeLimit ? (((3 * (i - BinnedSizeLimit)) + 3)*BINNED_ALLOC_POOL_SIZE) : BINNED_ALLOC_POOL_SIZE);
+				uint32 TableAllocSize = i >= BinnedMediumTableIndex ? GetMediumPoolSize(Table->BlockSize) :
+					(Table->BlockSize > BinnedSizeLimit ? (((3 * (i - BinnedSizeLimit)) + 3)*BINNED_ALLOC_POOL_SIZE) : BINNED_ALLOC_POOL_SIZE);
 				// The amount of memory allocated from the OS
 				uint32 MemAllocated = (Table->NumActivePools * TableAllocSize) / 1024;
 				// Amount of memory actually in use by allocations
@@ -0,0 +1,153 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "MemoryTags.h"
+
+#if USE_MALLOC_TAGS
+
+/**
+ * Malloc proxy that accounts every allocation to the current memory tag of the allocating thread.
+ * The tag and the size are kept in a header in front of the allocation, so a free is accounted
+ * to the tag the memory was allocated with, whichever thread frees it.
+ *
+ * The totals are shown in the Memory Tags stat group. Budgets in megabytes can be set per tag
+ * in the [MemoryTags] section of the engine ini, e.g. RenderingBudgetMB=512, a warning is logged
+ * when a tag goes over its budget.
+ */
+class FMallocTagProxy : public FMalloc
+{
+private:
+	/** In front of every allocation. */
+	struct FAllocationHeader
+	{
+		/** Bytes between the allocation of the used malloc and the one we gave out. */
+		uint32 Offset;
+		/** EMemoryTag::Type the allocation is accounted to. */
+		uint32 Tag;
+		/** Size asked for. */
+		uint64 Size;
+	};
+
+	/** Malloc we're based on. */
+	FMalloc* UsedMalloc;
+
+	/** Bytes currently allocated and peak per tag. */
+	volatile int64 CurrentBytes[EMemoryTag::Num];
+	int64 PeakBytes[EMemoryTag::Num];
+
+	/** Budget per tag in bytes, 0 when the tag has none. */
+	int64 BudgetBytes[EMemoryTag::Num];
+
+	/** Whether the tag was over its budget at the last update, so we only warn when it goes over. */
+	bool bOverBudget[EMemoryTag::Num];
+
+	/** Whether the budgets were read from the config, it isn't loaded yet when the proxy is created. */
+	bool bBudgetsRead;
+
+	/** @return the bytes the header takes in front of an allocation of this alignment */
+	static FORCEINLINE uint32 GetHeaderSize( uint32 Alignment )
+	{
+		return FMath::Max<uint32>( Alignment, sizeof(FAllocationHeader) );
+	}
+
+	static FORCEINLINE FAllocationHeader* GetHeader( void* Ptr )
+	{
+		return (FAllocationHeader*)Ptr - 1;
+	}
+
+	/** Writes the header in front of an allocation of the used malloc and accounts it to the current tag. */
+	FORCEINLINE void* TrackAlloc( void* BasePtr, SIZE_T Size, uint32 HeaderSize )
+	{
+		if( !BasePtr )
+		{
+			return nullptr;
+		}
+
+		void* Ptr = (uint8*)BasePtr + HeaderSize;
+		FAllocationHeader* Header = GetHeader( Ptr );
+		Header->Offset = HeaderSize;
+		Header->Tag = FMemoryTags::GetCurrentTag();
+		Header->Size = Size;
+		FPlatformAtomics::InterlockedAdd( &CurrentBytes[Header->Tag], (int64)Size );
+		return Ptr;
+	}
+
+	FORCEINLINE void TrackFree( FAllocationHeader* Header )
+	{
+		FPlatformAtomics::InterlockedAdd( &CurrentBytes[Header->Tag], -(int64)Header->Size );
+	}
+
+	/** Reads the budgets from the engine ini. */
+	void ReadBudgets();
+
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param	InMalloc - FMalloc that is going to be used for actual allocations
+	 */
+	FMallocTagProxy( FMalloc* InMalloc );
+
+	virtual void* Malloc( SIZE_T Size, uint32 Alignment ) override;
+	virtual void* Realloc( void* Ptr, SIZE_T NewSize, uint32 Alignment ) override;
+	virtual void Free( void* Ptr ) override;
+
+	virtual bool GetAllocationSize( void *Original, SIZE_T &SizeOut ) override
+	{
+		if( !Original )
+		{
+			return false;
+		}
+		SizeOut = (SIZE_T)GetHeader( Original )->Size;
+		return true;
+	}
+
+	/** Called once per frame, sets the tag stats and checks the budgets. */
+	virtual void UpdateStats() override;
+
+	/** Handles MEMTAGS, which lists the bytes allocated per tag. */
+	virtual bool Exec( UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar ) override;
+
+	virtual void InitializeStatsMetadata() override
+	{
+		UsedMalloc->InitializeStatsMetadata();
+	}
+
+	virtual bool IsInternallyThreadSafe() const override
+	{
+		return UsedMalloc->IsInternallyThreadSafe();
+	}
+
+	virtual void GetAllocatorStats( FGenericMemoryStats& out_Stats ) override
+	{
+		UsedMalloc->GetAllocatorStats( out_Stats );
+	}
+
+	virtual void DumpAllocatorStats( class FOutputDevice& Ar ) override
+	{
+		UsedMalloc->DumpAllocatorStats( Ar );
+	}
+
+	virtual bool ValidateHeap() override
+	{
+		return UsedMalloc->ValidateHeap();
+	}
+
+	virtual void FlushCurrentThreadCache() override
+	{
+		UsedMalloc->FlushCurrentThreadCache();
+	}
+
+	virtual void Trim() override
+	{
+		UsedMalloc->Trim();
+	}
+
+	virtual const TCHAR* GetDescriptiveName() override
+	{
+		return UsedMalloc->GetDescriptiveName();
+	}
+};
+
+#endif // USE_MALLOC_TAGS
@@ -93,6 +93,18 @@ public:
 		return( UsedMalloc->ValidateHeap() );
 	}
 
+	virtual void FlushCurrentThreadCache() override
+	{
+		FScopeLock Lock( &SynchronizationObject );
+		UsedMalloc->FlushCurrentThreadCache();
+	}
+
+	virtual void Trim() override
+	{
+		FScopeLock Lock( &SynchronizationObject );
+		UsedMalloc->Trim();
+	}
+
 	virtual bool Exec( UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar ) override
 	{
 		FScopeLock ScopeLock( &SynchronizationObject );
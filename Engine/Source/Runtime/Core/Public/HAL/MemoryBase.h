@@ -133,6 +133,21 @@ public:
 		return( true );
 	}
 
+	/**
+	 * Gives back whatever the allocator keeps cached for the calling thread, and stops caching for it.
+	 * Called by the threads right before they exit.
+	 */
+	virtual void FlushCurrentThreadCache()
+	{
+	}
+
+	/**
+	 * Gives the memory the allocator keeps for reuse back to the OS. Slow, meant for loading screens and the like.
+	 */
+	virtual void Trim()
+	{
+	}
+
 	/**
 	* If possible determine the size of the memory allocated at the given address
 	*
@@ -0,0 +1,84 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ProfilingDebugging/UMemoryDefines.h"
+
+/** Systems the allocations are accounted to, see FMemoryTagScope. */
+namespace EMemoryTag
+{
+	enum Type
+	{
+		/** Allocations made outside of any tag scope. */
+		Untagged,
+		Rendering,
+		AHRVoxels,
+		Animation,
+		Navigation,
+		Audio,
+
+		Num
+	};
+}
+
+/**
+ * Per tag allocation counters kept by FMallocTagProxy, only tracked with USE_MALLOC_TAGS.
+ * Each thread has a current tag that its allocations are accounted to, set by FMemoryTagScope.
+ */
+struct CORE_API FMemoryTags
+{
+	/** @return the name of the tag, as shown in the stats and by the MEMTAGS command */
+	static const TCHAR* GetTagName( EMemoryTag::Type Tag );
+
+#if USE_MALLOC_TAGS
+	/** @return the tag of the allocations made by the calling thread */
+	static FORCEINLINE EMemoryTag::Type GetCurrentTag()
+	{
+		return TlsSlot ? (EMemoryTag::Type)(UPTRINT)FPlatformTLS::GetTlsValue( TlsSlot ) : EMemoryTag::Untagged;
+	}
+
+	/** Sets the tag of the allocations made by the calling thread. */
+	static FORCEINLINE void SetCurrentTag( EMemoryTag::Type Tag )
+	{
+		if( TlsSlot )
+		{
+			FPlatformTLS::SetTlsValue( TlsSlot, (void*)(UPTRINT)Tag );
+		}
+	}
+
+	/** TLS slot of the current tag, allocated when the proxy is created. */
+	static uint32 TlsSlot;
+#endif // USE_MALLOC_TAGS
+};
+
+#if USE_MALLOC_TAGS
+
+/**
+ * Accounts the allocations made by the thread to a tag until the end of the scope.
+ * Scopes nest, the tag of the outer scope is restored when this one ends.
+ */
+class FMemoryTagScope
+{
+public:
+	FORCEINLINE explicit FMemoryTagScope( EMemoryTag::Type Tag )
+		: PreviousTag( FMemoryTags::GetCurrentTag() )
+	{
+		FMemoryTags::SetCurrentTag( Tag );
+	}
+
+	FORCEINLINE ~FMemoryTagScope()
+	{
+		FMemoryTags::SetCurrentTag( PreviousTag );
+	}
+
+private:
+	EMemoryTag::Type PreviousTag;
+};
+
+#define MEMORY_TAG_SCOPE(Tag) FMemoryTagScope PREPROCESSOR_JOIN(MemoryTagScope,__LINE__)( EMemoryTag::Tag );
+
+#else
+
+#define MEMORY_TAG_SCOPE(Tag)
+
+#endif // USE_MALLOC_TAGS
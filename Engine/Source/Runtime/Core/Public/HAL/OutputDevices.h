@@ -417,6 +417,8 @@ public:
 
 private:
 	FArchive*	LogAr;
+	/** Writes the lines to LogAr from a background thread, null if the lines are written by the threads that log. */
+	class FAsyncLogWriter* AsyncWriter;
 	TCHAR		Filename[1024];
 	bool		Opened;
 	bool		Dead;
@@ -430,7 +432,7 @@ private:
 
 	void WriteByteOrderMarkToArchive(EByteOrderMark ByteOrderMark);
 
-	void CastAndSerializeData(const TCHAR* Data);
+	void CastAndAppendData(TArray<ANSICHAR>& Line, const TCHAR* Data);
 
 	void WriteDataToArchive(const TCHAR* Data, ELogVerbosity::Type Verbosity, const class FName& Category);
 };
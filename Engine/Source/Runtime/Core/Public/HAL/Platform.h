@@ -222,6 +222,9 @@
 #ifndef PLATFORM_HAS_BSD_SOCKET_FEATURE_GETHOSTNAME
 	#define PLATFORM_HAS_BSD_SOCKET_FEATURE_GETHOSTNAME	1
 #endif
+#ifndef PLATFORM_HAS_BSD_SOCKET_FEATURE_MMSG
+	#define PLATFORM_HAS_BSD_SOCKET_FEATURE_MMSG	0
+#endif
 #ifndef PLATFORM_HAS_NO_EPROCLIM
 	#define PLATFORM_HAS_NO_EPROCLIM			0
 #endif
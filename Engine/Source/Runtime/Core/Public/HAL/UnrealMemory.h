@@ -106,6 +106,12 @@ struct CORE_API FMemory
 
 	static SIZE_T GetAllocSize( void* Original );
 
+	/** Gives back the memory the allocator keeps cached for the calling thread. Call it before a thread exits. */
+	static void FlushCurrentThreadCache();
+
+	/** Gives the memory the allocator keeps for reuse back to the OS. Slow, call it on loading screens and the like. */
+	static void Trim();
+
 	/**
 	 * A helper function that will perform a series of random heap allocations to test
 	 * the internal validity of the heap. Note, this function will "leak" memory, but another call
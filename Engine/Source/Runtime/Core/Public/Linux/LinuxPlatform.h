@@ -41,6 +41,7 @@ typedef FLinuxPlatformTypes FPlatformTypes;
 #define PLATFORM_MAX_FILEPATH_LENGTH				MAX_PATH /* @todo linux: avoid using PATH_MAX as it is known to be broken */
 #define PLATFORM_HAS_NO_EPROCLIM					1
 #define PLATFORM_HAS_BSD_SOCKET_FEATURE_IOCTL		1
+#define PLATFORM_HAS_BSD_SOCKET_FEATURE_MMSG		1
 #define PLATFORM_HAS_BSD_IPV6_SOCKETS				1
 
 #define PLATFORM_USES_DYNAMIC_RHI					1
@@ -0,0 +1,72 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+ * Operations on arrays of transforms, such as the bone poses of a skeletal mesh.
+ *
+ * They go over the array once, with the outer loop on the transforms and the inner loop on the poses. Each result is
+ * kept in registers until it is final instead of being read and written back once per pose and once more to be
+ * normalized. The transforms to process are given by an index list in increasing order, like the required bones.
+ */
+struct FTransformBatch
+{
+	/**
+	 * Blends poses together by weight, see FAnimationRuntime::BlendPosesTogether.
+	 *
+	 * @param OutTransforms		Transforms receiving the blend, only the ones in Indices are written
+	 * @param Poses				NumPoses arrays of transforms to blend
+	 * @param Weights			NumPoses blend weights
+	 * @param Indices			NumIndices indices of the transforms to blend
+	 */
+	template<typename IndexType>
+	static void BlendPoses(FTransform* OutTransforms, const FTransform* const* Poses, const float* Weights, int32 NumPoses, const IndexType* Indices, int32 NumIndices)
+	{
+		check(NumPoses > 0);
+
+		const ScalarRegister FirstWeight(Weights[0]);
+		for (int32 Index = 0; Index < NumIndices; ++Index)
+		{
+			const int32 TransformIndex = Indices[Index];
+
+			FTransform Result = Poses[0][TransformIndex] * FirstWeight;
+			for (int32 PoseIndex = 1; PoseIndex < NumPoses; ++PoseIndex)
+			{
+				Result.AccumulateWithShortestRotation(Poses[PoseIndex][TransformIndex], ScalarRegister(Weights[PoseIndex]));
+			}
+
+			if (NumPoses > 1)
+			{
+				Result.NormalizeRotation();
+			}
+			OutTransforms[TransformIndex] = Result;
+		}
+	}
+
+	/**
+	 * Accumulates additive poses by weight into transforms, see FTransform::BlendFromIdentityAndAccumulate.
+	 * The rotations are not normalized.
+	 *
+	 * @param InOutTransforms	Transforms to accumulate into, only the ones in Indices are modified
+	 * @param AdditivePoses		NumPoses arrays of additive transforms
+	 * @param Weights			NumPoses blend weights
+	 * @param Indices			NumIndices indices of the transforms to accumulate into
+	 */
+	template<typename IndexType>
+	static void AccumulateAdditivePoses(FTransform* InOutTransforms, const FTransform* const* AdditivePoses, const float* Weights, int32 NumPoses, const IndexType* Indices, int32 NumIndices)
+	{
+		for (int32 Index = 0; Index < NumIndices; ++Index)
+		{
+			const int32 TransformIndex = Indices[Index];
+
+			FTransform Result = InOutTransforms[TransformIndex];
+			for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+			{
+				// BlendFromIdentityAndAccumulate modifies the transform it accumulates
+				FTransform Additive = AdditivePoses[PoseIndex][TransformIndex];
+				FTransform::BlendFromIdentityAndAccumulate(Result, Additive, ScalarRegister(Weights[PoseIndex]));
+			}
+			InOutTransforms[TransformIndex] = Result;
+		}
+	}
+};
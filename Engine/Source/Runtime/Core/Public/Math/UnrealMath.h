@@ -47,6 +47,7 @@
 #include "Vector2DHalf.h"
 #include "AlphaBlendType.h"
 #include "ScalarRegister.h"
+#include "TransformBatch.h"
 #include "ConvexHull2d.h"
 
 
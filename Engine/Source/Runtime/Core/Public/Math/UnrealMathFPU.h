@@ -912,6 +912,18 @@ FORCEINLINE uint32 VectorAnyGreaterThan(const VectorRegister& Vec1, const Vector
 	return (Vec1.V[0] > Vec2.V[0]) | (Vec1.V[1] > Vec2.V[1]) | (Vec1.V[2] > Vec2.V[2]) | (Vec1.V[3] > Vec2.V[3]);
 }
 
+/**
+ * Returns an integer bit-mask (0x00 - 0x0f) based on the sign-bit for each component in a vector.
+ *
+ * @param VecMask		Vector
+ * @return				Bit 0 = sign(VecMask.x), Bit 1 = sign(VecMask.y), Bit 2 = sign(VecMask.z), Bit 3 = sign(VecMask.w)
+ */
+FORCEINLINE uint32 VectorMaskBits(const VectorRegister& VecMask)
+{
+	const uint32* Bits = (const uint32*)VecMask.V;
+	return (Bits[0] >> 31) | ((Bits[1] >> 31) << 1) | ((Bits[2] >> 31) << 2) | ((Bits[3] >> 31) << 3);
+}
+
 /**
  * Resets the floating point registers so that they can be used again.
  * Some intrinsics use these for MMX purposes (e.g. VectorLoadByte4 and VectorStoreByte4).
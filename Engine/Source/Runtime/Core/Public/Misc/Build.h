@@ -243,3 +243,8 @@
 
 #define USE_CIRCULAR_DEPENDENCY_LOAD_DEFERRING 1
 #define USE_DEFERRED_DEPENDENCY_CHECK_VERIFICATION_TESTS (USE_CIRCULAR_DEPENDENCY_LOAD_DEFERRING && 0)
+
+/** Serialize the package headers of async loads on a dedicated thread. The editor keeps them on the game thread as they report load progress. */
+#ifndef USE_ASYNC_LOADING_THREAD
+	#define USE_ASYNC_LOADING_THREAD (!WITH_EDITOR)
+#endif
@@ -4,6 +4,8 @@
 
 #include "HAL/Platform.h"
 
+class FString;
+
 /**
  * Flags controlling [de]compression
  */
@@ -13,6 +15,8 @@ enum ECompressionFlags
 	COMPRESS_None					= 0x00,
 	/** Compress with ZLIB															*/
 	COMPRESS_ZLIB 					= 0x01,
+	/** Compress with LZ4, a lower ratio than ZLIB but several times faster to uncompress	*/
+	COMPRESS_LZ4 					= 0x02,
 	/** Prefer compression that compresses smaller (ONLY VALID FOR COMPRESSION)		*/
 	COMPRESS_BiasMemory 			= 0x10,
 	/** Prefer compression that compresses faster (ONLY VALID FOR COMPRESSION)		*/
@@ -31,6 +35,29 @@ enum ECompressionFlags
 #define COMPRESSION_FLAGS_OPTIONS_MASK	0xF0
 
 
+/**
+ * A compression format FCompression can use. ZLIB and LZ4 are built in, other formats registered
+ * with FCompression::RegisterCodec use the free type values of COMPRESSION_FLAGS_TYPE_MASK.
+ * Codecs are called from any thread, they must be thread safe.
+ */
+class ICompressionCodec
+{
+public:
+	virtual ~ICompressionCodec() {}
+
+	/** @return the name of the format, as used in the config files and on the command line */
+	virtual const TCHAR* GetName() const = 0;
+
+	/** @return the maximum possible bytes needed to compress UncompressedSize bytes */
+	virtual int32 CompressMemoryBound( int32 UncompressedSize ) const = 0;
+
+	/** See FCompression::CompressMemory, Flags only has the options left. */
+	virtual bool CompressMemory( ECompressionFlags Flags, void* CompressedBuffer, int32& CompressedSize, const void* UncompressedBuffer, int32 UncompressedSize ) const = 0;
+
+	/** See FCompression::UncompressMemory. */
+	virtual bool UncompressMemory( void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize ) const = 0;
+};
+
 /**
  * Chunk size serialization code splits data into. The loading value CANNOT be changed without resaving all
  * compressed data which is why they are split into two separate defines.
@@ -86,6 +113,38 @@ struct FCompression
 	 * @return true if compression succeeds, false if it fails because CompressedBuffer was too small or other reasons
 	 */
 	CORE_API static bool UncompressMemory( ECompressionFlags Flags, void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize, bool bIsSourcePadded = false );
+
+	/**
+	 * Makes a compression format usable with the type flag Type. Has to be called before any data
+	 * of that type is loaded, typically when the module of the codec starts up.
+	 *
+	 * @param	Type						Type flag of the format, within COMPRESSION_FLAGS_TYPE_MASK and not used by another codec
+	 * @param	Codec						Codec of the format, has to stay alive until it is unregistered
+	 */
+	CORE_API static void RegisterCodec( ECompressionFlags Type, ICompressionCodec* Codec );
+
+	/** Forgets about the codec of the type flag Type. */
+	CORE_API static void UnregisterCodec( ECompressionFlags Type );
+
+	/** @return the codec of the type in Flags, nullptr if there is none */
+	CORE_API static ICompressionCodec* FindCodec( ECompressionFlags Flags );
+
+	/**
+	 * Finds the type flag of a format from its name, e.g. "ZLIB", "LZ4" or "None".
+	 *
+	 * @param	Name						Name of the format, see ICompressionCodec::GetName
+	 * @param	Default						Returned when there is no codec with this name
+	 */
+	CORE_API static ECompressionFlags GetCompressionFlagsFromName( const FString& Name, ECompressionFlags Default );
+
+	/**
+	 * Reads the format to compress some content with from the [Core.Compression] section of the engine ini,
+	 * e.g. PackageFormat=LZ4 or BulkDataFormat_SoundWave=LZ4.
+	 *
+	 * @param	Key							Key of the format in the section
+	 * @param	Default						Returned when the key isn't set or names an unknown format
+	 */
+	CORE_API static ECompressionFlags GetConfiguredCompressionFlags( const TCHAR* Key, ECompressionFlags Default );
 };
 
 
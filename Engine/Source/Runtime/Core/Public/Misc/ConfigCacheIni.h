@@ -18,6 +18,11 @@ public:
 	bool HasQuotes( const FString& Test ) const;
 	bool operator==( const FConfigSection& Other ) const;
 	bool operator!=( const FConfigSection& Other ) const;
+
+	friend FArchive& operator<<( FArchive& Ar, FConfigSection& Section )
+	{
+		return Ar << static_cast<FConfigSectionMap&>(Section);
+	}
 };
 
 /**
@@ -326,6 +326,163 @@ public:
 };
 
 
+/**
+ * Linear allocator for the transient data of a rendering frame, usable from any thread without a mark.
+ * The memory allocated during a frame stays valid until the end of the next one, so the game thread can build
+ * the data of frame N+1 while the render thread still reads frame N. Nothing gets destructed by the stack.
+ **/
+class CORE_API FFrameMemStack
+{
+public:
+
+	FFrameMemStack()
+		: CurrentFrame(0)
+	{
+		Frames[0].TopChunk = nullptr;
+		Frames[1].TopChunk = nullptr;
+	}
+
+	~FFrameMemStack()
+	{
+		FreeChunks(Frames[0]);
+		FreeChunks(Frames[1]);
+	}
+
+	static FFrameMemStack& Get();
+
+	FORCEINLINE void* Alloc(int32 AllocSize, int32 Alignment)
+	{
+		checkSlow(AllocSize>=0);
+		checkSlow((Alignment&(Alignment-1))==0);
+
+		FFrame& Frame = Frames[CurrentFrame];
+		for(;;)
+		{
+			// Bump the top of the current chunk, other threads may be racing for it
+			FChunk* Chunk = Frame.TopChunk;
+			if( Chunk )
+			{
+				uint8* Top = Chunk->Top;
+				uint8* Result = Align( Top, Alignment );
+				uint8* NewTop = Result + AllocSize;
+				if( NewTop <= Chunk->End )
+				{
+					if( FPlatformAtomics::InterlockedCompareExchangePointer((void**)&Chunk->Top, NewTop, Top) == Top )
+					{
+						return Result;
+					}
+					continue;
+				}
+			}
+			AllocateNewChunk( Frame, Chunk, AllocSize + Alignment );
+		}
+	}
+
+	/**
+	 * Moves to the next frame, giving back the memory of the frame before the one that ends.
+	 * Called by the rendering thread once per frame, at the end of it.
+	 */
+	void EndFrame();
+
+	/** @return the number of bytes allocated by the two frames. */
+	int32 GetByteCount() const;
+
+private:
+
+	struct FChunk
+	{
+		FChunk* Next;
+		uint8* volatile Top;
+		uint8* End;
+		int32 AllocSize;
+
+		uint8 *Data() const
+		{
+			return ((uint8*)this) + sizeof(FChunk);
+		}
+	};
+
+	struct FFrame
+	{
+		FChunk* volatile TopChunk;
+		/** Taken when the top chunk is full */
+		FCriticalSection ChunkCritical;
+	};
+
+	/** Pushes a chunk of at least MinSize bytes if FullChunk is still the top one. */
+	void AllocateNewChunk( FFrame& Frame, FChunk* FullChunk, int32 MinSize );
+
+	/** Gives back all the chunks of a frame. */
+	void FreeChunks( FFrame& Frame );
+
+	FFrame Frames[2];
+	volatile int32 CurrentFrame;
+};
+
+
+/** A container allocator that allocates from the frame mem-stack. The memory lasts until the end of the next frame. */
+template<uint32 Alignment = DEFAULT_ALIGNMENT>
+class TFrameMemStackAllocator
+{
+public:
+
+	enum { NeedsElementType = true };
+	enum { RequireRangeCheck = true };
+
+	template<typename ElementType>
+	class ForElementType
+	{
+	public:
+
+		/** Default constructor. */
+		ForElementType():
+			Data(nullptr)
+		{}
+
+		// FContainerAllocatorInterface
+		FORCEINLINE ElementType* GetAllocation() const
+		{
+			return Data;
+		}
+		void ResizeAllocation(int32 PreviousNumElements,int32 NumElements,int32 NumBytesPerElement)
+		{
+			void* OldData = Data;
+			if( NumElements )
+			{
+				// Allocate memory from the frame stack.
+				Data = (ElementType*)FFrameMemStack::Get().Alloc(
+					NumElements * NumBytesPerElement,
+					FMath::Max(Alignment,(uint32)ALIGNOF(ElementType))
+					);
+
+				// If the container previously held elements, copy them into the new allocation.
+				if(OldData && PreviousNumElements)
+				{
+					const int32 NumCopiedElements = FMath::Min(NumElements,PreviousNumElements);
+					FMemory::Memcpy(Data,OldData,NumCopiedElements * NumBytesPerElement);
+				}
+			}
+		}
+		int32 CalculateSlack(int32 NumElements,int32 NumAllocatedElements,int32 NumBytesPerElement) const
+		{
+			return DefaultCalculateSlack(NumElements,NumAllocatedElements,NumBytesPerElement);
+		}
+
+		int32 GetAllocatedSize(int32 NumAllocatedElements, int32 NumBytesPerElement) const
+		{
+			return NumAllocatedElements * NumBytesPerElement;
+		}
+			
+	private:
+
+		/** A pointer to the container's elements. */
+		ElementType* Data;
+	};
+	
+	typedef ForElementType<FScriptContainerElement> ForAnyElementType;
+};
+
+
 /**
  * FMemMark marks a top-of-stack position in the memory stack.
  * When the marker is constructed or initialized with a particular memory 
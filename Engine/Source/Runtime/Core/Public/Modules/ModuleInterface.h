@@ -79,6 +79,17 @@ public:
 	{
 		return false;
 	}
+
+	/**
+	 * Override this to let the module manager defer StartupModule until the module is first accessed with GetModule,
+	 * when the module is loaded by its loading phase. Loading it with LoadModule always starts it up.
+	 *
+	 * @return Whether StartupModule can be deferred
+	 */
+	virtual bool SupportsLazyStartup() const
+	{
+		return false;
+	}
 };
 
 
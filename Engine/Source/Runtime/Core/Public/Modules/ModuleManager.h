@@ -176,10 +176,11 @@ public:
 	 * @param InModuleName The base name of the module file.  Should not include path, extension or platform/configuration info.  This is just the "module name" part of the module file name.  Names should be globally unique.
 	 * @param OutFailureReason Will contain the result.
 	 * @param bWasReloaded Indicates that the module has been reloaded (default = false).
+	 * @param bAllowLazyStartup If the module supports lazy startup, defer StartupModule until it is first accessed with GetModule (default = false).
 	 * @return The loaded module (null if the load operation failed).
 	 * @see AbandonModule, IsModuleLoaded, LoadModule, LoadModuleChecked, LoadModulePtr, UnloadModule
 	 */
-	TSharedPtr<IModuleInterface> LoadModuleWithFailureReason( const FName InModuleName, EModuleLoadResult& OutFailureReason, const bool bWasReloaded = false );
+	TSharedPtr<IModuleInterface> LoadModuleWithFailureReason( const FName InModuleName, EModuleLoadResult& OutFailureReason, const bool bWasReloaded = false, const bool bAllowLazyStartup = false );
 
 	/**
 	 * Queries information about a specific module name.
@@ -311,6 +312,12 @@ public:
 	 */
 	void FindModules( const TCHAR* WildcardWithoutExtension, TArray<FName>& OutModules );
 
+	/**
+	 * Forgets the module files found in the binaries directories, so that the next search scans them again.
+	 * Needs to be called after module files were added or removed, except for searches of a single module name, which rescan them on a miss.
+	 */
+	void ResetModulePathsCache();
+
 	/**
 	 * Gets the number of loaded modules.
 	 *
@@ -477,6 +484,9 @@ protected:
 		/** True if this module was unloaded at shutdown time, and we never want it to be loaded again */
 		bool bWasUnloadedAtShutdown;
 
+		/** True if the module object was created but StartupModule was deferred until the module is first accessed */
+		bool bStartupPending;
+
 		/** Arbitrary number that encodes the load order of this module, so we can shut them down in reverse order. */
 		int32 LoadOrder;
 
@@ -489,6 +499,7 @@ protected:
 		FModuleInfo()
 			: Handle( nullptr ),
 			  bWasUnloadedAtShutdown( false ),
+			  bStartupPending( false ),
 			  LoadOrder(CurrentLoadOrder++)
 		{ }
 	};
@@ -515,6 +526,9 @@ private:
 	/** Finds modules matching a given name wildcard within a given directory. */
 	void FindModulePathsInDirectory(const FString &DirectoryName, bool bIsGameDirectory, const TCHAR *NamePattern, TMap<FName, FString> &OutModulePaths) const;
 
+	/** Starts up a module whose object was just created, or whose startup was deferred, unless its startup is deferred now. */
+	void StartupLoadedModule( const FName InModuleName, FModuleInfo& ModuleInfo, bool bDeferStartup );
+
 private:
 
 	/** Map of all modules.  Maps the case-insensitive module name to information about that module, loaded or not. */
@@ -543,6 +557,9 @@ private:
 
 	/** Array of game binaries directories. */
 	TArray<FString> GameBinariesDirectories;
+
+	/** Module files found in each binaries directory, by module name, so that each directory is only scanned once. */
+	mutable TMap<FString, TMap<FName, FString>> ModulePathsCache;
 };
 
 /**
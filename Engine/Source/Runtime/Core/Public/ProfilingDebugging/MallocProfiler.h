@@ -481,6 +481,18 @@ public:
 		return( UsedMalloc->ValidateHeap() );
 	}
 
+	virtual void FlushCurrentThreadCache() override
+	{
+		FScopeLock Lock( &CriticalSection );
+		UsedMalloc->FlushCurrentThreadCache();
+	}
+
+	virtual void Trim() override
+	{
+		FScopeLock Lock( &CriticalSection );
+		UsedMalloc->Trim();
+	}
+
 	/**
 	* If possible determine the size of the memory allocated at the given address
 	*
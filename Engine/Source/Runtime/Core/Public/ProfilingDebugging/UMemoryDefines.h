@@ -35,4 +35,12 @@
 #define MALLOC_PROFILER(...)
 #endif
 
+/**
+ * USE_MALLOC_TAGS - Define this to account the allocations to the memory tags, see FMemoryTagScope.
+ * Every allocation gets a header of 16 bytes (or of its alignment) through FMallocTagProxy.
+ */
+#ifndef USE_MALLOC_TAGS
+#define USE_MALLOC_TAGS					0
+#endif
+
 
@@ -1063,6 +1063,39 @@ struct FStatPacket
 	}
 };
 
+/**
+ * Recycles the stat packets, along with the chunks of their messages, once the stats thread is done with them.
+ * Busy threads flush a packet every frame, this is what keeps them from allocating one every time.
+ */
+struct CORE_API FStatPacketPool
+{
+	enum
+	{
+		/** Packets kept at most, the others are deleted when returned. */
+		MAX_PACKETS_IN_POOL = 256,
+	};
+
+	/** Singleton accessor. */
+	static FStatPacketPool& Get()
+	{
+		static FStatPacketPool Singleton;
+		return Singleton;
+	}
+
+	/** Gets a packet from the pool, or a new one, with the frame, thread and presize history of Template and no messages. */
+	FStatPacket* GetFromPool(const FStatPacket& Template);
+
+	/** Returns a packet to the pool, its messages are discarded but their memory is kept. */
+	void ReturnToPool(FStatPacket* Packet);
+
+private:
+	/** Lock free pool of FStatPacket instances. */
+	TLockFreePointerList<FStatPacket> Pool;
+
+	/** Number of packets in the pool. */
+	FThreadSafeCounter NumPackets;
+};
+
 /** Helper struct used to monitor the scope of the message. */
 struct FStatMessageLock
 {
@@ -1829,6 +1862,7 @@ DECLARE_STATS_GROUP(TEXT("Load Time"), STATGROUP_LoadTime, STATCAT_Advanced);
 DECLARE_STATS_GROUP(TEXT("Memory Allocator"),STATGROUP_MemoryAllocator, STATCAT_Advanced);
 DECLARE_STATS_GROUP(TEXT("Memory Platform"),STATGROUP_MemoryPlatform, STATCAT_Advanced);
 DECLARE_STATS_GROUP(TEXT("Memory StaticMesh"),STATGROUP_MemoryStaticMesh, STATCAT_Advanced);
+DECLARE_STATS_GROUP(TEXT("Memory Tags"),STATGROUP_MemoryTags, STATCAT_Advanced);
 DECLARE_STATS_GROUP(TEXT("Memory"),STATGROUP_Memory, STATCAT_Advanced);
 DECLARE_STATS_GROUP(TEXT("Mesh Particles"),STATGROUP_MeshParticles, STATCAT_Advanced);
 DECLARE_STATS_GROUP(TEXT("Metal"),STATGROUP_MetalRHI, STATCAT_Advanced);
@@ -38,7 +38,14 @@ namespace EStatMagicWithHeader
 		 *	Added support for compressing the stats data, now each frame is compressed.
 		 */
 		VERSION_4 = 4,
-		HAS_COMPRESSED_DATA_VER = VERSION_4
+		HAS_COMPRESSED_DATA_VER = VERSION_4,
+
+		/**
+		 *	Frames too large to be compressed at once are compressed in blocks instead of being stored uncompressed,
+		 *	and the frame table has the frame number of each frame, so frames can be found without reading them.
+		 */
+		VERSION_5 = 5,
+		HAS_FRAME_NUMBERS_IN_TABLE_VER = VERSION_5,
 	};
 }
 
@@ -60,6 +67,9 @@ struct EStatsFileConstants
 
 		/** Indicates that the compression is disabled for the data. */
 		NO_COMPRESSION = 0,
+
+		/** Indicates that the data is split in blocks compressed separately, each with its own sizes. */
+		COMPRESSED_IN_BLOCKS = 0xB10C4ED0,
 	};
 };
 
@@ -115,25 +125,37 @@ protected:
 	/** Compress the data and writes to the archive. */
 	void WriteCompressed( FArchive& Writer )
 	{
+		const int32 MaxBlockSize = EStatsFileConstants::MAX_COMPRESSED_SIZE - EStatsFileConstants::DUMMY_HEADER_SIZE;
 		int32 UncompressedSize = SrcData.Num();
-		if( UncompressedSize > EStatsFileConstants::MAX_COMPRESSED_SIZE - EStatsFileConstants::DUMMY_HEADER_SIZE )
+		if( UncompressedSize > MaxBlockSize )
 		{
-			int32 DisabledCompressionSize = EStatsFileConstants::NO_COMPRESSION;
-			Writer << DisabledCompressionSize << UncompressedSize;
-			Writer.Serialize( SrcData.GetData(), UncompressedSize );
+			// Raw frames of busy games are often larger than what fits in the compression buffer.
+			int32 BlocksMarker = EStatsFileConstants::COMPRESSED_IN_BLOCKS;
+			Writer << BlocksMarker << UncompressedSize;
+
+			for( int32 BlockOffset = 0; BlockOffset < UncompressedSize; BlockOffset += MaxBlockSize )
+			{
+				WriteCompressedBlock( Writer, SrcData.GetData() + BlockOffset, FMath::Min( MaxBlockSize, UncompressedSize - BlockOffset ) );
+			}
 		}
 		else
 		{
-			DestData.Reserve( EStatsFileConstants::MAX_COMPRESSED_SIZE );
-			int32 CompressedSize = DestData.GetAllocatedSize();
-
-			const bool bResult = FCompression::CompressMemory( COMPRESS_ZLIB, DestData.GetData(), CompressedSize, SrcData.GetData(), UncompressedSize );
-			check( bResult );
-			Writer << CompressedSize << UncompressedSize;
-			Writer.Serialize( DestData.GetData(), CompressedSize );
+			WriteCompressedBlock( Writer, SrcData.GetData(), UncompressedSize );
 		}
 	}
 
+	/** Compresses one block of at most MAX_COMPRESSED_SIZE - DUMMY_HEADER_SIZE bytes and writes it with its sizes. */
+	void WriteCompressedBlock( FArchive& Writer, const uint8* BlockData, int32 UncompressedSize )
+	{
+		DestData.Reserve( EStatsFileConstants::MAX_COMPRESSED_SIZE );
+		int32 CompressedSize = DestData.GetAllocatedSize();
+
+		const bool bResult = FCompression::CompressMemory( COMPRESS_ZLIB, DestData.GetData(), CompressedSize, BlockData, UncompressedSize );
+		check( bResult );
+		Writer << CompressedSize << UncompressedSize;
+		Writer.Serialize( DestData.GetData(), CompressedSize );
+	}
+
 	/** Reads the data and decompresses it. */
 	void ReadCompressed( FArchive& Reader )
 	{
@@ -145,6 +167,10 @@ protected:
 		{
 			bEndOfCompressedData = true;
 		}
+		else if( CompressedSize == EStatsFileConstants::COMPRESSED_IN_BLOCKS )
+		{
+			ReadCompressedBlocks( Reader, UncompressedSize );
+		}
 		// This chunk is not compressed.
 		else if( CompressedSize == 0 )
 		{
@@ -165,6 +191,31 @@ protected:
 		}
 	}
 
+	/** Reads the blocks written by WriteCompressed for data too large to be compressed at once. */
+	void ReadCompressedBlocks( FArchive& Reader, int32 UncompressedSize )
+	{
+		DestData.Reset( UncompressedSize );
+		DestData.AddUninitialized( UncompressedSize );
+
+		int32 BlockOffset = 0;
+		while( BlockOffset < UncompressedSize )
+		{
+			int32 BlockCompressedSize = 0;
+			int32 BlockUncompressedSize = 0;
+			Reader << BlockCompressedSize << BlockUncompressedSize;
+			check( BlockUncompressedSize > 0 && BlockOffset + BlockUncompressedSize <= UncompressedSize );
+
+			SrcData.Reset( BlockCompressedSize );
+			SrcData.AddUninitialized( BlockCompressedSize );
+
+			Reader.Serialize( SrcData.GetData(), BlockCompressedSize );
+			const bool bResult = FCompression::UncompressMemory( COMPRESS_ZLIB, DestData.GetData() + BlockOffset, BlockUncompressedSize, SrcData.GetData(), BlockCompressedSize );
+			check( bResult );
+
+			BlockOffset += BlockUncompressedSize;
+		}
+	}
+
 public:
 	/**
 	 * @return true if we reached the end of the compressed data.
@@ -279,12 +330,14 @@ struct FStatsFrameInfo
 	/** Empty constructor. */
 	FStatsFrameInfo()
 		: FrameFileOffset(0)
+		, TargetFrame(INDEX_NONE)
 	{}
 
 	/** Initialization constructor. */
-	FStatsFrameInfo( int64 InFrameFileOffset, TMap<uint32, int64>& InThreadCycles )
+	FStatsFrameInfo( int64 InFrameFileOffset, TMap<uint32, int64>& InThreadCycles, int64 InTargetFrame = INDEX_NONE )
 		: FrameFileOffset(InFrameFileOffset)
 		, ThreadCycles(InThreadCycles)
+		, TargetFrame(InTargetFrame)
 	{}
 
 	/** Serialization operator. */
@@ -299,6 +352,12 @@ struct FStatsFrameInfo
 
 	/** Thread cycles for this frame. */
 	TMap<uint32, int64> ThreadCycles;
+
+	/**
+	 *	Frame number of this frame, INDEX_NONE if the file is older than HAS_FRAME_NUMBERS_IN_TABLE_VER.
+	 *	Not serialized by the operator, the frame table stores all of them after the frames info.
+	 */
+	int64 TargetFrame;
 };
 
 
@@ -322,6 +381,9 @@ protected:
 	/** Thread cycles for the last frame. */
 	TMap<uint32, int64> ThreadCycles;
 
+	/** Frame number of the data in OutData. */
+	int64 OutDataFrame;
+
 	/** Filename of the archive that we are writing to. */
 	FString ArchiveFilename;
 
@@ -663,6 +725,18 @@ public:
 	{
 		Ar.Seek( Header.FrameTableOffset );
 		Ar << FramesInfo;
+
+		if( Header.Version >= EStatMagicWithHeader::HAS_FRAME_NUMBERS_IN_TABLE_VER )
+		{
+			TArray<int64> TargetFrames;
+			Ar << TargetFrames;
+			check( TargetFrames.Num() == FramesInfo.Num() );
+
+			for( int32 FrameIndex = 0; FrameIndex < FramesInfo.Num(); ++FrameIndex )
+			{
+				FramesInfo[FrameIndex].TargetFrame = TargetFrames[FrameIndex];
+			}
+		}
 	}
 
 	/**
@@ -79,6 +79,16 @@ public:
 		return UsedMalloc->ValidateHeap();
 	}
 
+	virtual void FlushCurrentThreadCache() override
+	{
+		UsedMalloc->FlushCurrentThreadCache();
+	}
+
+	virtual void Trim() override
+	{
+		UsedMalloc->Trim();
+	}
+
 	virtual bool Exec( UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar ) override
 	{
 		return UsedMalloc->Exec( InWorld, Cmd, Ar);
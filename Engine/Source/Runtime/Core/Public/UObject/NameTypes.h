@@ -76,6 +76,9 @@ namespace FNameDefs
 	// use of FNames to store asset path and content tags
 	static const uint32 NameHashBucketCount = 65536;
 #endif
+
+	// Adding a name locks only the buckets of its shard, so threads adding different names rarely wait on each other
+	static const uint32 NameHashShardCount = 64;
 }
 
 
@@ -117,6 +120,9 @@ private:
 	/** Index of name in hash. */
 	NAME_INDEX		Index;
 
+	/** Full hash of the name, compared before the string when walking a hash bin. Fits in the padding before HashNext on 64 bit. */
+	uint32			Hash;
+
 public:
 	/** Pointer to the next entry in this hash bin's linked list. */
 	FNameEntry*		HashNext;
@@ -143,6 +149,7 @@ public:
 	FNameEntry( enum ELinkerNameTableConstructor )
 	{
 		Index = NAME_WIDE_MASK;
+		Hash = 0;
 	}
 
 	/** 
@@ -174,6 +181,14 @@ public:
 		return (Index & NAME_WIDE_MASK);
 	}
 
+	/**
+	 * Returns the hash the name was added to the hash with, before it was masked to a bin index.
+	 */
+	FORCEINLINE uint32 GetHash() const
+	{
+		return Hash;
+	}
+
 	/**
 	 * @return FString of name portion minus number.
 	 */
@@ -244,7 +259,7 @@ public:
 	}
 
 	// Friend for access to Flags.
-	friend FNameEntry* AllocateNameEntry( const void* Name, NAME_INDEX Index, FNameEntry* HashNext, bool bIsPureAnsi );
+	friend FNameEntry* AllocateNameEntry( const void* Name, NAME_INDEX Index, uint32 Hash, FNameEntry* HashNext, bool bIsPureAnsi );
 };
 
 /**
@@ -936,7 +951,7 @@ private:
 	friend const TCHAR* DebugFName(int32);
 	friend const TCHAR* DebugFName(int32, int32);
 	friend const TCHAR* DebugFName(FName&);
-	friend FNameEntry* AllocateNameEntry( const void* Name, NAME_INDEX Index, FNameEntry* HashNext, bool bIsPureAnsi );
+	friend FNameEntry* AllocateNameEntry( const void* Name, NAME_INDEX Index, uint32 Hash, FNameEntry* HashNext, bool bIsPureAnsi );
 
 	/**
 	 * Shared initialization code (between two constructors)
@@ -985,6 +1000,9 @@ private:
 	/** Singleton to retrieve the critical section. */
 	static FCriticalSection* GetCriticalSection();
 
+	/** Singleton to retrieve the critical section that guards adding names to the hash bin HashIndex. */
+	static FCriticalSection* GetHashShardCriticalSection(int32 HashIndex);
+
 };
 
 template<> struct TIsZeroConstructType<class FName> { enum { Value = true }; };
@@ -56,6 +56,7 @@ typedef FWindowsPlatformTypes FPlatformTypes;
 #define PLATFORM_USES_MICROSOFT_LIBC_FUNCTIONS				1
 #define PLATFORM_SUPPORTS_TBB								1
 #define PLATFORM_SUPPORTS_NAMED_PIPES						1
+#define PLATFORM_SUPPORTS_RHI_THREAD						1
 #define PLATFORM_COMPILER_HAS_DEFAULTED_FUNCTIONS			0
 #if _MSC_VER >= 1800 || __clang__
 	#define PLATFORM_COMPILER_HAS_VARIADIC_TEMPLATES		1
@@ -61,6 +61,25 @@ struct CORE_API FWindowsPlatformMemory
 		HANDLE				Mapping;
 	};
 
+	/**
+	 * Windows representation of a mapped file
+	 */
+	struct FWindowsMappedFile : public FMappedFile
+	{
+		/** Returns the handle to file mapping object. */
+		HANDLE GetMapping() const { return Mapping; }
+
+		FWindowsMappedFile(const uint8* InData, int64 InSize, HANDLE InMapping)
+			:	FMappedFile(InData, InSize)
+			,	Mapping(InMapping)
+		{}
+
+	protected:
+
+		/** Handle of a file mapping object */
+		HANDLE				Mapping;
+	};
+
 	// Begin FGenericPlatformMemory interface
 	static void Init();
 	static class FMalloc* BaseAllocator();
@@ -72,6 +91,8 @@ struct CORE_API FWindowsPlatformMemory
 	static void BinnedFreeToOS( void* Ptr );
 	static FSharedMemoryRegion* MapNamedSharedMemoryRegion(const FString& InName, bool bCreate, uint32 AccessMode, SIZE_T Size);
 	static bool UnmapNamedSharedMemoryRegion(FSharedMemoryRegion * MemoryRegion);
+	static FMappedFile* MapFile(const TCHAR* Filename);
+	static bool UnmapFile(FMappedFile* MappedFile);
 	// End FGenericPlatformMemory interface
 };
 
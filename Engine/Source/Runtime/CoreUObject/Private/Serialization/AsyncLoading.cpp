@@ -95,6 +95,8 @@ void NotifyConstructedDuringAsyncLoading(UObject* Object, bool bSubObject)
 -----------------------------------------------------------------------------*/
 /** Array of packages that are being preloaded							*/
 static TIndirectArray<struct FAsyncPackage>	GObjAsyncPackages;
+/** Whether a priority changed and GObjAsyncPackages needs to be sorted again	*/
+static bool									GAsyncPackagesNeedSort = false;
 
 int32 FAsyncPackage::PreLoadIndex = 0;
 int32 FAsyncPackage::PostLoadIndex = 0;
@@ -118,6 +120,9 @@ FAsyncPackage::FAsyncPackage(const FName& InPackageName, const FGuid* InPackageG
 , bTimeLimitExceeded(false)
 , bLoadHasFailed(false)
 , bLoadHasFinished(false)
+, bLoadWasCancelled(false)
+, bRequestedDirectly(false)
+, Priority(0)
 , TickStartTime(0)
 , LastObjectWorkWasPerformedOn(NULL)
 , LastTypeOfWorkPerformed(NULL)
@@ -178,6 +183,71 @@ void FAsyncPackage::ResetLoader()
 	}
 }
 
+void FAsyncPackage::SetPriority(int32 InPriority)
+{
+	if (Priority != InPriority)
+	{
+		Priority = InPriority;
+		GAsyncPackagesNeedSort = true;
+
+		// This package can't finish before its imports, so they get at least the same priority
+		for (FAsyncPackage* PendingImport : PendingImportedPackages)
+		{
+			if (PendingImport->Priority < InPriority)
+			{
+				PendingImport->SetPriority(InPriority);
+			}
+		}
+	}
+}
+
+bool FAsyncPackage::Cancel()
+{
+	// Objects created by CreateExports can't be taken back, and packages importing this one still need it
+	if (bLoadHasFinished || bLoadHasFailed || ExportIndex > 0 || DependencyRefCount > 0)
+	{
+		return false;
+	}
+	bLoadWasCancelled = true;
+	// The request is withdrawn, if an import revives it the package is only kept for its importers
+	bRequestedDirectly = false;
+	return true;
+}
+
+void FAsyncPackage::ReleaseCancelled()
+{
+	check(bLoadWasCancelled);
+	UE_LOG(LogStreaming, Verbose, TEXT("FAsyncPackage::ReleaseCancelled for %s"), *PackageNameToLoad.ToString());
+
+	// Stop waiting for the imports, the ones nobody else needs and that weren't requested themselves are cancelled too
+	for (FAsyncPackage* PendingImport : PendingImportedPackages)
+	{
+		PendingImport->CompletionCallbacks.RemoveAll([this](const FLoadPackageAsyncDelegate& Callback)
+		{
+			return Callback.IsBoundToObject(this);
+		});
+		PendingImport->DependencyRefCount--;
+		check(PendingImport->DependencyRefCount >= 0);
+		if (PendingImport->DependencyRefCount == 0 && !PendingImport->bRequestedDirectly)
+		{
+			PendingImport->Cancel();
+		}
+	}
+	PendingImportedPackages.Empty();
+	FreeReferencedImports();
+
+	// Deleting the loader cancels its outstanding reads
+	ResetLoader();
+
+	// Same as a failed load for whoever requested it
+	for (int32 i = 0; i < CompletionCallbacks.Num(); i++)
+	{
+		CompletionCallbacks[i].ExecuteIfBound(PackageName, nullptr);
+	}
+	CompletionCallbacks.Empty();
+	bLoadHasFailed = true;
+}
+
 /**
  * Returns whether time limit has been exceeded.
  *
@@ -425,6 +495,11 @@ EAsyncPackageState::Type FAsyncPackage::CreateLinker()
 			Linker = ULinkerLoad::CreateLinkerAsync( Package, *PackageFileName, (FApp::IsGame() && !GIsEditor) ? (LOAD_SeekFree | LOAD_NoVerify) : LOAD_None  );
 		}
 
+		if (Linker)
+		{
+			QueueDependencyClosure();
+		}
+
 		UE_LOG(LogStreaming, Verbose, TEXT("FAsyncPackage::CreateLinker for %s finished."), *PackageNameToLoad.ToString());
 	}
 	return EAsyncPackageState::Complete;
@@ -509,6 +584,12 @@ void FAsyncPackage::AddImportDependency(int32 CurrentPackageIndex, const FName&
 	else
 	{
 		PackageToStream = &GObjAsyncPackages[ExistingAsyncPackageIndex];
+		PackageToStream->ClearCancelled();
+	}
+
+	if (PackageToStream->GetPriority() < Priority)
+	{
+		PackageToStream->SetPriority(Priority);
 	}
 	
 	if (!PackageToStream->HasFinishedLoading() && 
@@ -571,6 +652,33 @@ void FAsyncPackage::AddDependencyTree(int32 CurrentPackageIndex, FAsyncPackage&
 	SearchedPackages.Add(&ImportedPackage);
 }
 
+void FAsyncPackage::QueueDependencyClosure()
+{
+	TArray<FName> LoadOrder;
+	if (!FPackageDependencyGraph::Get().GetLoadOrder(GetPackageName(), LoadOrder))
+	{
+		// Not cooked, LoadImports discovers the imports as usual
+		return;
+	}
+
+	const int32 AsyncQueueIndex = FindAsyncPackage(GetPackageName());
+	check(AsyncQueueIndex != INDEX_NONE);
+
+	// Dependencies are inserted in front of this package, so walk the order backwards to get the leaves processed first.
+	for (int32 Index = LoadOrder.Num() - 1; Index >= 0; --Index)
+	{
+		const FName DependencyName = LoadOrder[Index];
+		// Existing packages are either loaded or part of a circular dependency, both are handled by LoadImports
+		if (ContainsDependencyPackage(PendingImportedPackages, DependencyName) == INDEX_NONE &&
+			!StaticFindObjectFast(UPackage::StaticClass(), nullptr, DependencyName, true))
+		{
+			AddImportDependency(AsyncQueueIndex, DependencyName);
+		}
+	}
+
+	UE_LOG(LogStreaming, Verbose, TEXT("FAsyncPackage::QueueDependencyClosure for %s: %d packages in the closure, %d queued"), *PackageNameToLoad.ToString(), LoadOrder.Num(), PendingImportedPackages.Num());
+}
+
 /** 
  * Load imports till time limit is exceeded.
  *
@@ -939,7 +1047,7 @@ EAsyncPackageState::Type FAsyncPackage::FinishObjects()
 /*-----------------------------------------------------------------------------
 	UObject async (pre)loading.
 -----------------------------------------------------------------------------*/
-FAsyncPackage& LoadPackageAsync( const FString& InPackageName, const FGuid* PackageGuid, FName PackageType, const TCHAR* InPackageToLoadFrom)
+FAsyncPackage& LoadPackageAsync( const FString& InPackageName, const FGuid* PackageGuid, FName PackageType, const TCHAR* InPackageToLoadFrom, int32 PackagePriority)
 {
 	// The comments clearly state that it should be a package name but we also handle it being a filename as this function is not perf critical
 	// and LoadPackage handles having a filename being passed in as well.
@@ -972,7 +1080,13 @@ FAsyncPackage& LoadPackageAsync( const FString& InPackageName, const FGuid* Pack
 		FAsyncPackage& PendingPackage = GObjAsyncPackages[PackageIndex];
 		if (PendingPackage.GetPackageName() == PackageFName)
 		{
-			// Early out as package is already being preloaded.
+			// Early out as package is already being preloaded. Requesting it again revives a cancelled request.
+			PendingPackage.ClearCancelled();
+			PendingPackage.SetRequestedDirectly();
+			if (PendingPackage.GetPriority() < PackagePriority)
+			{
+				PendingPackage.SetPriority(PackagePriority);
+			}
 			return PendingPackage;
 		}
 	}
@@ -987,18 +1101,37 @@ FAsyncPackage& LoadPackageAsync( const FString& InPackageName, const FGuid* Pack
 	{
 		UE_LOG(LogStreaming, Fatal, TEXT("Async loading code requires long package names (%s)."), *InPackageName);
 	}
-	// Add to (FIFO) queue.
+	// Add to queue, FIFO within the same priority.
 	FAsyncPackage *Package = new(GObjAsyncPackages)FAsyncPackage(PackageFName, PackageGuid, PackageType, FName(/*ENAME_LinkerConstructor,*/ *PackageToLoadFrom));
+	Package->SetPriority(PackagePriority);
+	Package->SetRequestedDirectly();
 	return *Package;
 }
 
-FAsyncPackage& LoadPackageAsync( const FString& InPackageName, FLoadPackageAsyncDelegate CompletionDelegate, const FGuid* PackageGuid, FName PackageType, const TCHAR* InPackageToLoadFrom)
+FAsyncPackage& LoadPackageAsync( const FString& InPackageName, FLoadPackageAsyncDelegate CompletionDelegate, const FGuid* PackageGuid, FName PackageType, const TCHAR* InPackageToLoadFrom, int32 PackagePriority)
 {
-	FAsyncPackage& AsyncPackage = LoadPackageAsync(InPackageName, PackageGuid, PackageType, InPackageToLoadFrom);
+	FAsyncPackage& AsyncPackage = LoadPackageAsync(InPackageName, PackageGuid, PackageType, InPackageToLoadFrom, PackagePriority);
 	AsyncPackage.AddCompletionCallback(CompletionDelegate);
 	return AsyncPackage;
 }
 
+bool SetAsyncLoadPriority( const FName& PackageName, int32 PackagePriority )
+{
+	const int32 PackageIndex = FindAsyncPackage(PackageName);
+	if (PackageIndex != INDEX_NONE)
+	{
+		GObjAsyncPackages[PackageIndex].SetPriority(PackagePriority);
+		return true;
+	}
+	return false;
+}
+
+bool CancelAsyncLoading( const FName& PackageName )
+{
+	const int32 PackageIndex = FindAsyncPackage(PackageName);
+	return PackageIndex != INDEX_NONE && GObjAsyncPackages[PackageIndex].Cancel();
+}
+
 /**
  * Returns the async load percentage for a package in flight with the passed in name or -1 if there isn't one.
  *
@@ -1090,6 +1223,17 @@ EAsyncPackageState::Type ProcessAsyncLoading( bool bUseTimeLimit, bool bUseFullT
 	EAsyncPackageState::Type CompletionState = EAsyncPackageState::Complete;
 
 	bool bWasLoading = GObjAsyncPackages.Num() > 0;
+
+	if (GAsyncPackagesNeedSort)
+	{
+		// Imports always have at least the priority of the packages waiting for them, so they stay in front of them.
+		StableSort(GObjAsyncPackages.GetData(), GObjAsyncPackages.Num(), [](const FAsyncPackage& A, const FAsyncPackage& B)
+		{
+			return A.GetPriority() > B.GetPriority();
+		});
+		GAsyncPackagesNeedSort = false;
+	}
+
 	// We need to loop as the function has to handle finish loading everything given no time limit
 	// like e.g. when called from FlushAsyncLoading.
 	for (int32 i = 0; LoadingState != EAsyncPackageState::TimeOut && i < GObjAsyncPackages.Num(); i++)
@@ -1103,6 +1247,15 @@ EAsyncPackageState::Type ProcessAsyncLoading( bool bUseTimeLimit, bool bUseFullT
 			continue;
 		}
 
+		if (Package.WasCancelled())
+		{
+			Package.ReleaseCancelled();
+			// @warning invalidates local Package variable!.
+			GObjAsyncPackages.RemoveAt(i);
+			i--;
+			continue;
+		}
+
 		
 		if (Package.HasFinishedLoading() == false)
 		{
@@ -1159,6 +1312,137 @@ EAsyncPackageState::Type ProcessAsyncLoading( bool bUseTimeLimit, bool bUseFullT
 }
 
 
+/*----------------------------------------------------------------------------
+	FPackageDependencyGraph.
+----------------------------------------------------------------------------*/
+
+FPackageDependencyGraph& FPackageDependencyGraph::Get()
+{
+	static FPackageDependencyGraph* Graph = nullptr;
+	if (!Graph)
+	{
+		Graph = new FPackageDependencyGraph();
+		if (FPlatformProperties::RequiresCookedData())
+		{
+			const FString GraphFilename = FPaths::GameDir() / GetFilename();
+			if (IFileManager::Get().FileSize(*GraphFilename) > 0 && Graph->Load(*GraphFilename))
+			{
+				UE_LOG(LogStreaming, Log, TEXT("Loaded the dependency graph of %d cooked packages."), Graph->Num());
+			}
+		}
+	}
+	return *Graph;
+}
+
+void FPackageDependencyGraph::SetDependencies(FName PackageName, const TArray<FName>& InDependencies)
+{
+	Dependencies.Add(PackageName, InDependencies);
+}
+
+bool FPackageDependencyGraph::GetLoadOrder(FName PackageName, TArray<FName>& OutLoadOrder) const
+{
+	if (!Dependencies.Contains(PackageName))
+	{
+		return false;
+	}
+
+	TSet<FName> Visited;
+	GatherLoadOrder(PackageName, Visited, OutLoadOrder);
+	// The package itself always comes last
+	OutLoadOrder.Pop();
+	return true;
+}
+
+void FPackageDependencyGraph::GatherLoadOrder(FName PackageName, TSet<FName>& Visited, TArray<FName>& OutLoadOrder) const
+{
+	bool bAlreadyVisited = false;
+	Visited.Add(PackageName, &bAlreadyVisited);
+	if (bAlreadyVisited)
+	{
+		// Either done or a circular dependency, in which case the order doesn't matter
+		return;
+	}
+
+	if (const TArray<FName>* PackageDependencies = Dependencies.Find(PackageName))
+	{
+		for (FName Dependency : *PackageDependencies)
+		{
+			GatherLoadOrder(Dependency, Visited, OutLoadOrder);
+		}
+	}
+	OutLoadOrder.Add(PackageName);
+}
+
+FArchive& operator<<(FArchive& Ar, FPackageDependencyGraph& Graph)
+{
+	// Names are stored as strings as there's no name table in this file
+	int32 NumPackages = Graph.Dependencies.Num();
+	Ar << NumPackages;
+
+	if (Ar.IsLoading())
+	{
+		Graph.Dependencies.Empty(NumPackages);
+		for (int32 PackageIndex = 0; PackageIndex < NumPackages && !Ar.IsError(); ++PackageIndex)
+		{
+			FString PackageName;
+			int32 NumDependencies = 0;
+			Ar << PackageName << NumDependencies;
+
+			TArray<FName>& PackageDependencies = Graph.Dependencies.Add(FName(*PackageName));
+			PackageDependencies.Empty(NumDependencies);
+			for (int32 DependencyIndex = 0; DependencyIndex < NumDependencies && !Ar.IsError(); ++DependencyIndex)
+			{
+				FString DependencyName;
+				Ar << DependencyName;
+				PackageDependencies.Add(FName(*DependencyName));
+			}
+		}
+	}
+	else
+	{
+		for (auto& Pair : Graph.Dependencies)
+		{
+			FString PackageName = Pair.Key.ToString();
+			int32 NumDependencies = Pair.Value.Num();
+			Ar << PackageName << NumDependencies;
+
+			for (FName Dependency : Pair.Value)
+			{
+				FString DependencyName = Dependency.ToString();
+				Ar << DependencyName;
+			}
+		}
+	}
+	return Ar;
+}
+
+bool FPackageDependencyGraph::Save(const TCHAR* Filename) const
+{
+	FArrayWriter SerializedGraph;
+	SerializedGraph << const_cast<FPackageDependencyGraph&>(*this);
+	return FFileHelper::SaveArrayToFile(SerializedGraph, Filename);
+}
+
+bool FPackageDependencyGraph::Load(const TCHAR* Filename)
+{
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, Filename))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(FileData);
+	Reader << *this;
+	if (Reader.IsError())
+	{
+		UE_LOG(LogStreaming, Warning, TEXT("Package dependency graph %s is corrupted, ignoring it."), Filename);
+		Dependencies.Empty();
+		return false;
+	}
+	return true;
+}
+
+
 /*----------------------------------------------------------------------------
 	FArchiveAsync.
 ----------------------------------------------------------------------------*/
@@ -1182,10 +1466,12 @@ FArchiveAsync::FArchiveAsync( const TCHAR* InFileName )
 	PrecacheStartPos[CURRENT]	= 0;
 	PrecacheEndPos[CURRENT]		= 0;
 	PrecacheBuffer[CURRENT]		= nullptr;
+	PrecacheRequestId[CURRENT]	= 0;
 
 	PrecacheStartPos[NEXT]		= 0;
 	PrecacheEndPos[NEXT]		= 0;
 	PrecacheBuffer[NEXT]		= nullptr;
+	PrecacheRequestId[NEXT]		= 0;
 
 	// Relies on default constructor initializing to 0.
 	check( PrecacheReadStatus[CURRENT].GetValue() == 0 );
@@ -1250,6 +1536,21 @@ void FArchiveAsync::FlushCache()
  */
 FArchiveAsync::~FArchiveAsync()
 {
+	// Nobody is going to read the data, e.g. a cancelled async load, so don't wait for reads that haven't started.
+	uint64 OutstandingRequests[2];
+	int32 NumOutstandingRequests = 0;
+	for( int32 BufferIndex = CURRENT; BufferIndex <= NEXT; BufferIndex++ )
+	{
+		if( PrecacheReadStatus[BufferIndex].GetValue() != 0 && PrecacheRequestId[BufferIndex] != 0 )
+		{
+			OutstandingRequests[NumOutstandingRequests++] = PrecacheRequestId[BufferIndex];
+		}
+	}
+	if( NumOutstandingRequests > 0 )
+	{
+		FIOSystem::Get().CancelRequests( OutstandingRequests, NumOutstandingRequests );
+	}
+
 	// Invalidate any precached data and free memory.
 	FlushCache();
 }
@@ -1400,7 +1701,7 @@ void FArchiveAsync::PrecacheCompressedChunk( int64 ChunkIndex, int64 BufferIndex
 	// Increment read status, request load and make sure that request was possible (e.g. filename was valid).
 	check( PrecacheReadStatus[BufferIndex].GetValue() == 0 );
 	PrecacheReadStatus[BufferIndex].Increment();
-	uint64 RequestId = FIOSystem::Get().LoadCompressedData( 
+	PrecacheRequestId[BufferIndex] = FIOSystem::Get().LoadCompressedData( 
 							FileName, 
 							ChunkToRead.CompressedOffset, 
 							ChunkToRead.CompressedSize, 
@@ -1409,7 +1710,7 @@ void FArchiveAsync::PrecacheCompressedChunk( int64 ChunkIndex, int64 BufferIndex
 							CompressionFlags, 
 							&PrecacheReadStatus[BufferIndex],
 							AIOP_Normal);
-	check(RequestId);
+	check(PrecacheRequestId[BufferIndex]);
 }
 
 /**
@@ -1509,14 +1810,14 @@ bool FArchiveAsync::Precache( int64 RequestOffset, int64 RequestSize )
 
 			// Increment read status, request load and make sure that request was possible (e.g. filename was valid).
 			PrecacheReadStatus[CURRENT].Increment();
-			uint64 RequestId = FIOSystem::Get().LoadData( 
+			PrecacheRequestId[CURRENT] = FIOSystem::Get().LoadData( 
 									FileName, 
 									PrecacheStartPos[CURRENT], 
 									PrecacheEndPos[CURRENT] - PrecacheStartPos[CURRENT], 
 									PrecacheBuffer[CURRENT], 
 									&PrecacheReadStatus[CURRENT],
 									AIOP_Normal );
-			check(RequestId);
+			check(PrecacheRequestId[CURRENT]);
 		}
 
 		return false;
@@ -1638,6 +1939,108 @@ void FArchiveAsync::Seek( int64 InPos )
 }
 
 
+#if USE_ASYNC_LOADING_THREAD
+
+/*----------------------------------------------------------------------------
+	FAsyncLoadingThread.
+----------------------------------------------------------------------------*/
+
+FAsyncLoadingThread& FAsyncLoadingThread::Get()
+{
+	// Never deleted, the thread is stopped in OnPreExit
+	static FAsyncLoadingThread* AsyncLoadingThread = new FAsyncLoadingThread();
+	return *AsyncLoadingThread;
+}
+
+bool FAsyncLoadingThread::IsEnabled()
+{
+	static const bool bEnabled = FPlatformProcess::SupportsMultithreading() && !FParse::Param(FCommandLine::Get(), TEXT("NoAsyncLoadingThread"));
+	return bEnabled;
+}
+
+FAsyncLoadingThread::FAsyncLoadingThread()
+	: QueuedEvent(FPlatformProcess::CreateSynchEvent())
+	, Thread(nullptr)
+{
+	Thread = FRunnableThread::Create(this, TEXT("AsyncLoadingThread"), 0, TPri_Normal);
+	FCoreDelegates::OnPreExit.AddRaw(this, &FAsyncLoadingThread::Shutdown);
+}
+
+FAsyncLoadingThread::~FAsyncLoadingThread()
+{
+	Shutdown();
+	delete QueuedEvent;
+}
+
+void FAsyncLoadingThread::QueueLinker(ULinkerLoad* Linker)
+{
+	if (!Thread)
+	{
+		// Shut down already, serialize on the caller
+		Linker->SerializeHeaderOnLoadingThread();
+		return;
+	}
+
+	{
+		FScopeLock Lock(&QueueCritical);
+		QueuedLinkers.Add(Linker);
+	}
+	QueuedEvent->Trigger();
+}
+
+uint32 FAsyncLoadingThread::Run()
+{
+	while (StopTaskCounter.GetValue() == 0)
+	{
+		ULinkerLoad* Linker = nullptr;
+		{
+			FScopeLock Lock(&QueueCritical);
+			if (QueuedLinkers.Num())
+			{
+				Linker = QueuedLinkers[0];
+				QueuedLinkers.RemoveAt(0, 1, false);
+			}
+		}
+
+		if (Linker)
+		{
+			Linker->SerializeHeaderOnLoadingThread();
+		}
+		else
+		{
+			QueuedEvent->Wait();
+		}
+	}
+	return 0;
+}
+
+void FAsyncLoadingThread::Stop()
+{
+	StopTaskCounter.Increment();
+	QueuedEvent->Trigger();
+}
+
+void FAsyncLoadingThread::Shutdown()
+{
+	if (Thread)
+	{
+		Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+
+		// Nobody is going to serialize these anymore, don't leave them waiting
+		FScopeLock Lock(&QueueCritical);
+		for (ULinkerLoad* Linker : QueuedLinkers)
+		{
+			Linker->AsyncHeaderState.Set(ULinkerLoad::ASYNCHEADER_Failed);
+		}
+		QueuedLinkers.Empty();
+	}
+}
+
+#endif // USE_ASYNC_LOADING_THREAD
+
 /*----------------------------------------------------------------------------
 	End.
 ----------------------------------------------------------------------------*/
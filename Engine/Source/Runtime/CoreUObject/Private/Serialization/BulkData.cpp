@@ -315,6 +315,10 @@ bool FUntypedBulkData::CanLoadFromDisk() const
  */
 ECompressionFlags FUntypedBulkData::GetDecompressionFlags() const
 {
+	if (BulkDataFlags & BULKDATA_SerializeCompressedLZ4)
+	{
+		return COMPRESS_LZ4;
+	}
 	return (BulkDataFlags & BULKDATA_SerializeCompressedZLIB) ? COMPRESS_ZLIB : COMPRESS_None;
 }
 
@@ -506,6 +510,17 @@ void FUntypedBulkData::Unlock() const
 	}
 }
 
+uint64 FUntypedBulkData::LoadIntoAsync( void* Dest, FThreadSafeCounter* Counter, EAsyncIOPriority Priority ) const
+{
+	check( Filename.Len() );
+
+	if( IsStoredCompressedOnDisk() )
+	{
+		return FIOSystem::Get().LoadCompressedData( Filename, GetBulkDataOffsetInFile(), GetBulkDataSizeOnDisk(), GetBulkDataSize(), Dest, GetDecompressionFlags(), Counter, Priority );
+	}
+	return FIOSystem::Get().LoadData( Filename, GetBulkDataOffsetInFile(), GetBulkDataSize(), Dest, Counter, Priority );
+}
+
 /**
  * Clears/ removes the bulk data and resets element count to 0.
  */
@@ -756,6 +771,13 @@ void FUntypedBulkData::Serialize( FArchive& Ar, UObject* Owner, int32 Idx )
 				if (Ar.IsCooking())
 				{
 					BaseCompressionMethod = Ar.CookingTarget()->GetBaseCompressionMethod();
+
+					// The format can be changed for all the bulk data, or only for the bulk data of some classes, e.g. to load textures faster
+					BaseCompressionMethod = FCompression::GetConfiguredCompressionFlags(TEXT("BulkDataFormat"), BaseCompressionMethod);
+					if (Owner)
+					{
+						BaseCompressionMethod = FCompression::GetConfiguredCompressionFlags(*FString::Printf(TEXT("BulkDataFormat_%s"), *Owner->GetClass()->GetName()), BaseCompressionMethod);
+					}
 				}
 
 				StoreCompressedOnDisk(BaseCompressionMethod);
@@ -913,8 +935,10 @@ void FUntypedBulkData::StoreCompressedOnDisk( ECompressionFlags CompressionFlags
 		else
 		{
 			// make sure a valid compression format was specified
-			check(CompressionFlags & COMPRESS_ZLIB);
-			BulkDataFlags |= (CompressionFlags & COMPRESS_ZLIB) ? BULKDATA_SerializeCompressedZLIB : BULKDATA_None;
+			const ECompressionFlags CompressionType = (ECompressionFlags)(CompressionFlags & COMPRESSION_FLAGS_TYPE_MASK);
+			check(CompressionType == COMPRESS_ZLIB || CompressionType == COMPRESS_LZ4);
+			BulkDataFlags &= ~BULKDATA_SerializeCompressed;
+			BulkDataFlags |= (CompressionType == COMPRESS_LZ4) ? BULKDATA_SerializeCompressedLZ4 : BULKDATA_SerializeCompressedZLIB;
 
 			// make sure we are not forcing the bulkdata to be stored inline if we use compression
 			BulkDataFlags &= ~BULKDATA_ForceInlinePayload;
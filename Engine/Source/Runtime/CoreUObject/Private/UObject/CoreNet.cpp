@@ -21,6 +21,17 @@ FClassNetCache::FClassNetCache( UClass* InClass )
 {}
 
 FClassNetCache * FClassNetCacheMgr::GetClassNetCache( UClass* Class )
+{
+	if ( bThreadSafe )
+	{
+		FScopeLock Lock( &CacheCS );
+		return FindOrCreateClassNetCache( Class );
+	}
+
+	return FindOrCreateClassNetCache( Class );
+}
+
+FClassNetCache * FClassNetCacheMgr::FindOrCreateClassNetCache( UClass* Class )
 {
 	FClassNetCache * Result = ClassFieldIndices.FindRef( Class );
 
@@ -32,7 +43,7 @@ FClassNetCache * FClassNetCacheMgr::GetClassNetCache( UClass* Class )
 
 		if ( Class->GetSuperClass() )
 		{
-			Result->Super		= GetClassNetCache(Class->GetSuperClass());
+			Result->Super		= FindOrCreateClassNetCache(Class->GetSuperClass());
 			Result->FieldsBase	= Result->Super->GetMaxIndex();
 		}
 
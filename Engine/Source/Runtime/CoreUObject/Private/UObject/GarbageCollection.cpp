@@ -6,6 +6,7 @@
 
 #include "CoreUObjectPrivate.h"
 #include "TaskGraphInterfaces.h"
+#include "ParallelFor.h"
 #include "IConsoleManager.h"
 #include "LinkerPlaceholderClass.h"
 
@@ -48,6 +49,9 @@ static bool GObjCurrentPurgeObjectIndexResetPastPermanent = false;
 /** Currently running a parallel reachability test.											*/
 static volatile bool GIsRunningParallelReachability = false;
 
+/** Whether an incremental reachability analysis has been started and not finished yet. Checked by the write barrier */
+COREUOBJECT_API bool GIsIncrementalReachabilityPending = false;
+
 /** Whether we are currently purging an object in the GC purge pass. */
 static bool GIsPurgingObject = false;
 
@@ -157,6 +161,233 @@ void SerializeRootSet( FArchive& Ar, EObjectFlags KeepFlags )
 	}
 }
 
+/**
+ * State of an incremental reachability analysis, which walks the references over several calls.
+ *
+ * Objects aren't flagged RF_Unreachable until the walk is done so weak pointers and object iterators keep working
+ * between the calls, the walk marks the objects it reaches on a bit array indexed like GUObjectArray instead.
+ * Objects reached but not walked yet wait on GrayObjects. A reference stored through UObjectProperty while the walk
+ * is in flight goes through the write barrier, which marks the object and queues it. Objects created during the walk
+ * are kept and walked at the end, together with the root set, as they may reference objects nobody else reaches now.
+ */
+class FIncrementalReachability : public FUObjectArray::FUObjectCreateListener
+{
+public:
+	/** Number of objects taken from the gray list at a time, the time limit is checked between batches */
+	enum { ObjectsPerBatch = 512 };
+
+	FIncrementalReachability()
+		: KeepFlags(RF_NoFlags)
+		, FirstGCIndex(0)
+		, NumMarkBits(0)
+		, NumSlices(0)
+		, WalkTime(0.0)
+	{
+	}
+
+	/**
+	 * Marks the object as reached. Objects created after the walk started are always considered reached.
+	 *
+	 * @return true if this call marked it, the caller is then in charge of walking its references
+	 */
+	FORCEINLINE bool Mark(const UObjectBase* Object)
+	{
+		return MarkIndex(GUObjectArray.ObjectToIndex(Object));
+	}
+
+	FORCEINLINE bool MarkIndex(int32 Index)
+	{
+		if( Index >= NumMarkBits )
+		{
+			return false;
+		}
+		volatile int32* Word = &MarkBits.GetData()[Index / 32];
+		const int32 Bit = 1 << (Index & 31);
+		for(;;)
+		{
+			const int32 OldValue = *Word;
+			if( OldValue & Bit )
+			{
+				return false;
+			}
+			if( FPlatformAtomics::InterlockedCompareExchange(Word, OldValue | Bit, OldValue) == OldValue )
+			{
+				return true;
+			}
+		}
+	}
+
+	FORCEINLINE bool IsMarked(int32 Index) const
+	{
+		return Index >= NumMarkBits || (MarkBits[Index / 32] & (1 << (Index & 31))) != 0;
+	}
+
+	/** Queues an object marked outside of the walk, from any thread */
+	void AddBarrierObject(UObject* Object)
+	{
+		FScopeLock Lock(&CriticalSection);
+		BarrierObjects.Add(Object);
+	}
+
+	virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override
+	{
+		// Reused indices may be below NumMarkBits, mark them so the object isn't taken as unreachable
+		MarkIndex(Index);
+		FScopeLock Lock(&CriticalSection);
+		CreatedObjects.Add((UObject*)Object);
+	}
+
+	/** Marks the roots and starts the walk */
+	void Begin(EObjectFlags InKeepFlags, bool bForceSingleThreaded);
+
+	/**
+	 * Walks the gray objects until there are none left or the time limit is reached.
+	 *
+	 * @param	TimeLimit	time limit for this call, 0 to walk until done
+	 * @return	true if there's nothing left to walk
+	 */
+	bool Walk(float TimeLimit);
+
+	/** Walks the root set again and the objects created since Begin, then flags whatever wasn't reached RF_Unreachable */
+	void End();
+
+private:
+	/** Moves the objects queued by the write barrier to the gray list */
+	void TakeBarrierObjects()
+	{
+		FScopeLock Lock(&CriticalSection);
+		GrayObjects.Append(BarrierObjects);
+		BarrierObjects.Reset();
+	}
+
+	/** Objects with these flags are kept regardless of being referenced or not */
+	EObjectFlags		KeepFlags;
+	/** First index of the objects that can be collected */
+	int32				FirstGCIndex;
+	/** Number of objects when the walk started, newer indices don't have a mark bit */
+	int32				NumMarkBits;
+	/** One bit per object, set once the object is reached */
+	TArray<int32>		MarkBits;
+	/** Objects reached but not walked yet */
+	TArray<UObject*>	GrayObjects;
+	/** Objects marked by the write barrier, guarded by CriticalSection */
+	TArray<UObject*>	BarrierObjects;
+	/** Objects created since the walk started, guarded by CriticalSection */
+	TArray<UObject*>	CreatedObjects;
+	FCriticalSection	CriticalSection;
+	/** Number of calls and total time spent walking, for the log */
+	int32				NumSlices;
+	double				WalkTime;
+};
+
+static FIncrementalReachability GIncrementalReachability;
+
+/**
+ * A group of objects kept or released as a unit. Members are never flagged RF_Unreachable on their own, a reference to
+ * a member reaches the cluster root instead, and only the root is walked. The references from the members to objects
+ * outside of the cluster are gathered when the cluster is created and walked together with the root.
+ */
+struct FUObjectCluster
+{
+	/** Index of the cluster root in GUObjectArray */
+	int32				RootIndex;
+	/** Indices of the members in GUObjectArray, not including the root */
+	TArray<int32>		Objects;
+	/** Objects outside of the cluster referenced by the root or the members */
+	TArray<UObject*>	ReferencedObjects;
+};
+
+static TSparseArray<FUObjectCluster> GUObjectClusters;
+/** Cluster of each object flagged RF_ClusterMember, indexed like GUObjectArray. Not meaningful for other objects */
+static TArray<int32> GObjectToClusterIndex;
+
+static FORCEINLINE FUObjectCluster& GetObjectCluster(const UObjectBase* Object)
+{
+	return GUObjectClusters[GObjectToClusterIndex[GUObjectArray.ObjectToIndex(Object)]];
+}
+
+static FORCEINLINE UObject* GetClusterRoot(const UObjectBase* Object)
+{
+	return (UObject*)GUObjectArray.IndexToObject(GetObjectCluster(Object).RootIndex);
+}
+
+/**
+ * Turns the members and the root of a cluster back into regular objects.
+ *
+ * @param	OutMembers	if set, gets the members that still belonged to the cluster
+ */
+static void DissolveCluster(int32 ClusterIndex, TArray<UObject*>* OutMembers = nullptr)
+{
+	FUObjectCluster& Cluster = GUObjectClusters[ClusterIndex];
+	for( int32 MemberIndex = 0; MemberIndex < Cluster.Objects.Num(); MemberIndex++ )
+	{
+		UObject* Object = (UObject*)GUObjectArray.IndexToObject(Cluster.Objects[MemberIndex]);
+		// The flag may be gone if the object was replaced in place since
+		if( Object && Object->HasAnyFlags(RF_ClusterMember) )
+		{
+			Object->ClearFlags(RF_ClusterMember);
+			if( OutMembers )
+			{
+				OutMembers->Add(Object);
+			}
+		}
+	}
+	if( UObject* Root = (UObject*)GUObjectArray.IndexToObject(Cluster.RootIndex) )
+	{
+		Root->ClearFlags(RF_ClusterMember);
+	}
+	GUObjectClusters.RemoveAt(ClusterIndex);
+}
+
+/** Releases the clusters whose root wasn't reached, flagging all their members RF_Unreachable */
+static void ReleaseUnreachableClusters()
+{
+	TArray<int32> ClustersToRelease;
+	for( TSparseArray<FUObjectCluster>::TConstIterator It(GUObjectClusters); It; ++It )
+	{
+		UObject* Root = (UObject*)GUObjectArray.IndexToObject(It->RootIndex);
+		if( Root->HasAnyFlags(RF_Unreachable) )
+		{
+			ClustersToRelease.Add(It.GetIndex());
+		}
+	}
+
+	TArray<UObject*> Members;
+	for( int32 Index = 0; Index < ClustersToRelease.Num(); Index++ )
+	{
+		Members.Reset();
+		DissolveCluster(ClustersToRelease[Index], &Members);
+		for( int32 MemberIndex = 0; MemberIndex < Members.Num(); MemberIndex++ )
+		{
+			Members[MemberIndex]->SetFlags(RF_Unreachable);
+		}
+	}
+}
+
+/** Reaches the root of a cluster through a reference to one of its members */
+static FORCEINLINE void HandleClusterRootReference(TArray<UObject*>& ObjectsToSerialize, UObject* ClusterRoot)
+{
+	if( ClusterRoot->HasAnyFlags( RF_Unreachable ) )
+	{
+		if( GIsRunningParallelReachability )
+		{
+			if( ClusterRoot->ThisThreadAtomicallyClearedRFUnreachable() )
+			{
+				ObjectsToSerialize.Add( ClusterRoot );
+			}
+		}
+		else
+		{
+			ClusterRoot->ClearFlags( RF_Unreachable );
+			ObjectsToSerialize.Add( ClusterRoot );
+		}
+	}
+	else if( GIsIncrementalReachabilityPending && GIncrementalReachability.Mark( ClusterRoot ) )
+	{
+		ObjectsToSerialize.Add( ClusterRoot );
+	}
+}
+
 /**
  * Handles object reference, potentially NULL'ing
  *
@@ -210,6 +441,17 @@ static FORCEINLINE void HandleObjectReference(TArray<UObject*>& ObjectsToSeriali
 					ObjectsToSerialize.Add( Object );
 				}
 			}
+			// References to cluster members reach the cluster root instead, the members themselves are never walked.
+			// Cluster roots that are already reachable do nothing here, besides being marked by an incremental walk.
+			else if( Object->HasAnyFlags( RF_ClusterMember ) )
+			{
+				HandleClusterRootReference( ObjectsToSerialize, GetClusterRoot( Object ) );
+			}
+			// Incremental walks mark on the side, nothing is flagged RF_Unreachable until the walk is done.
+			else if( GIsIncrementalReachabilityPending && GIncrementalReachability.Mark( Object ) )
+			{
+				ObjectsToSerialize.Add( Object );
+			}
 #if PERF_DETAILED_PER_CLASS_GC_STATS
 			GCurrentObjectRegularObjectRefs++;
 		}
@@ -381,6 +623,24 @@ private:
 		int32		LoopStartIndex;
 	};
 
+	/** Roots and classes gathered by one block of the initial mark */
+	struct FMarkBlock
+	{
+		TArray<UObject*>	Roots;
+		TArray<UClass*>		ClassesToAssemble;
+		/** Clusters with pending kill members, they go back to being regular objects */
+		TArray<int32>		ClustersToDissolve;
+		/** Cluster members that are roots themselves, they keep their cluster */
+		TArray<UObject*>	KeptClusterMembers;
+		int32				NumObjects;
+	};
+
+	/** Number of objects marked by each block of the initial mark */
+	enum { MarkObjectsPerBlock = 16384 };
+
+	/** A task that found this many new objects hands them to another task before going on, so idle workers can steal them */
+	enum { MaxObjectsBeforeSplit = 2048 };
+
 	class FGCTask
 	{
 		FArchiveRealtimeGC*	Owner;
@@ -427,61 +687,10 @@ public:
 	 */
 	void PerformReachabilityAnalysis( EObjectFlags KeepFlags, bool bForceSingleThreaded = false )
 	{
-		UObject* CurrentObject = NULL;
-
 		/** Growing array of objects that require serialization */
 		TArray<UObject*>	ObjectsToSerialize;
 
-		// Reset object count.
-		GObjectCountDuringLastMarkPhase = 0;
-
-		// Presize array and add a bit of extra slack for prefetching.
-		ObjectsToSerialize.Empty( GUObjectArray.GetObjectArrayNumMinusPermanent() + 2 );
-
-		for ( FRawObjectIterator It(true); It; ++It )
-		{
-			UObject* Object = *It;
-
-			//@todo UE4 - A prefetch was removed here. Re-add it. It wasn't right anyway, since it was ten items ahead and the consoles on have 8 prefetch slots
-			
-			// We can't collect garbage during an async load operation and by now all unreachable objects should've been purged.
-			checkf( !Object->HasAnyFlags(RF_Unreachable), TEXT("%s"), *Object->GetFullName() );
-	
-			// Keep track of how many objects are around.
-			GObjectCountDuringLastMarkPhase++;
-
-			// Special case handling for objects that are part of the root set.
-			if( Object->HasAnyFlags( RF_RootSet ) )
-			{
-				checkSlow( Object->IsValidLowLevel() );
-				// We cannot use RF_PendingKill on objects that are part of the root set.
-				checkCode( if( Object->HasAnyFlags( RF_PendingKill ) ) { UE_LOG(LogGarbage, Fatal, TEXT("Object %s is part of root set though has been marked RF_PendingKill!"), *Object->GetFullName() ); } );
-				ObjectsToSerialize.Add( Object );
-			}
-			// Regular objects.
-			else
-			{
-				// Mark objects as unreachable unless they have any of the passed in KeepFlags set and it's not marked for elimination..
-				if( Object->HasAnyFlags( KeepFlags ) && !Object->HasAnyFlags( RF_PendingKill ) )
-				{	
-					ObjectsToSerialize.Add( Object );
-				}
-				else
-				{
-					Object->SetFlags( RF_Unreachable );
-				}
-			}
-
-			// Assemble token stream for UClass objects. This is only done once for each class.
-			if (UClass* Class = dynamic_cast<UClass*>(Object))
-			{
-				if (!Class->HasAnyClassFlags(CLASS_TokenStreamAssembled))
-				{
-					Class->AssembleReferenceTokenStream();
-					check(Class->HasAnyClassFlags(CLASS_TokenStreamAssembled));
-				}
-			}
-		}
+		MarkObjects( ObjectsToSerialize, KeepFlags, bForceSingleThreaded, false );
 
 		if( ObjectsToSerialize.Num() )
 		{
@@ -515,14 +724,179 @@ public:
 				GIsRunningParallelReachability = false;
 			}
 		}
+
+		ReleaseUnreachableClusters();
+	}
+
+	/**
+	 * Marks all objects unreachable, except the root set and the objects with KeepFlags, which are added to ObjectsToSerialize.
+	 *
+	 * @param bIncremental	Mark the roots on the side for an incremental walk and leave RF_Unreachable alone
+	 */
+	void MarkObjects( TArray<UObject*>& ObjectsToSerialize, EObjectFlags KeepFlags, bool bForceSingleThreaded, bool bIncremental )
+	{
+		// Reset object count.
+		GObjectCountDuringLastMarkPhase = 0;
+
+		// Presize array and add a bit of extra slack for prefetching.
+		ObjectsToSerialize.Empty( GUObjectArray.GetObjectArrayNumMinusPermanent() + 2 );
+
+		// Mark the objects in blocks spread over the workers. Blocks only touch their own objects
+		const int32 NumGCObjects = GUObjectArray.GetObjectArrayNumMinusPermanent();
+		const int32 FirstGCIndex = GUObjectArray.GetObjectArrayNum() - NumGCObjects;
+		TArray<FMarkBlock> Blocks;
+		Blocks.SetNum((NumGCObjects + MarkObjectsPerBlock - 1) / MarkObjectsPerBlock);
+
+		ParallelFor(Blocks.Num(), [&](int32 BlockIndex)
+		{
+			FMarkBlock& Block = Blocks[BlockIndex];
+			Block.NumObjects = 0;
+
+			const int32 BlockStart = FirstGCIndex + BlockIndex * MarkObjectsPerBlock;
+			const int32 BlockEnd = FMath::Min(BlockStart + MarkObjectsPerBlock, FirstGCIndex + NumGCObjects);
+			for( int32 ObjectIndex = BlockStart; ObjectIndex < BlockEnd; ObjectIndex++ )
+			{
+				UObject* Object = (UObject*)GUObjectArray.IndexToObject(ObjectIndex);
+				if( !Object )
+				{
+					continue;
+				}
+
+				// We can't collect garbage during an async load operation and by now all unreachable objects should've been purged.
+				checkf( !Object->HasAnyFlags(RF_Unreachable), TEXT("%s"), *Object->GetFullName() );
+
+				// Keep track of how many objects are around.
+				Block.NumObjects++;
+
+				// Cluster members are kept or released with their root once the walk is done.
+				if( Object->HasAnyFlags( RF_ClusterMember ) && GetClusterRoot( Object ) != Object )
+				{
+					if( Object->HasAnyFlags( RF_PendingKill ) )
+					{
+						Block.ClustersToDissolve.AddUnique( GObjectToClusterIndex[ObjectIndex] );
+					}
+					else if( Object->HasAnyFlags( RF_RootSet ) || Object->HasAnyFlags( KeepFlags ) )
+					{
+						Block.KeptClusterMembers.Add( Object );
+					}
+				}
+				// Special case handling for objects that are part of the root set.
+				else if( Object->HasAnyFlags( RF_RootSet ) )
+				{
+					checkSlow( Object->IsValidLowLevel() );
+					// We cannot use RF_PendingKill on objects that are part of the root set.
+					checkCode( if( Object->HasAnyFlags( RF_PendingKill ) ) { UE_LOG(LogGarbage, Fatal, TEXT("Object %s is part of root set though has been marked RF_PendingKill!"), *Object->GetFullName() ); } );
+					Block.Roots.Add( Object );
+					if( bIncremental )
+					{
+						GIncrementalReachability.Mark( Object );
+					}
+				}
+				// Regular objects.
+				else
+				{
+					// Mark objects as unreachable unless they have any of the passed in KeepFlags set and it's not marked for elimination..
+					if( Object->HasAnyFlags( KeepFlags ) && !Object->HasAnyFlags( RF_PendingKill ) )
+					{	
+						Block.Roots.Add( Object );
+						if( bIncremental )
+						{
+							GIncrementalReachability.Mark( Object );
+						}
+					}
+					else if( !bIncremental )
+					{
+						Object->SetFlags( RF_Unreachable );
+					}
+				}
+
+				// Token streams are assembled below, assembling touches the super classes that other blocks may be marking
+				if (UClass* Class = dynamic_cast<UClass*>(Object))
+				{
+					if (!Class->HasAnyClassFlags(CLASS_TokenStreamAssembled))
+					{
+						Block.ClassesToAssemble.Add(Class);
+					}
+				}
+			}
+		}, bForceSingleThreaded);
+
+		for( int32 BlockIndex = 0; BlockIndex < Blocks.Num(); BlockIndex++ )
+		{
+			FMarkBlock& Block = Blocks[BlockIndex];
+			GObjectCountDuringLastMarkPhase += Block.NumObjects;
+			ObjectsToSerialize.Append( Block.Roots );
+
+			// Assemble token stream for UClass objects. This is only done once for each class.
+			for( int32 ClassIndex = 0; ClassIndex < Block.ClassesToAssemble.Num(); ClassIndex++ )
+			{
+				UClass* Class = Block.ClassesToAssemble[ClassIndex];
+				if (!Class->HasAnyClassFlags(CLASS_TokenStreamAssembled))
+				{
+					Class->AssembleReferenceTokenStream();
+					check(Class->HasAnyClassFlags(CLASS_TokenStreamAssembled));
+				}
+			}
+		}
+
+		// Members of dissolved clusters are regular objects again, same as above but they were skipped by the blocks
+		TArray<UObject*> Members;
+		for( int32 BlockIndex = 0; BlockIndex < Blocks.Num(); BlockIndex++ )
+		{
+			const TArray<int32>& ClustersToDissolve = Blocks[BlockIndex].ClustersToDissolve;
+			for( int32 Index = 0; Index < ClustersToDissolve.Num(); Index++ )
+			{
+				if( !GUObjectClusters.IsAllocated( ClustersToDissolve[Index] ) )
+				{
+					continue;
+				}
+				Members.Reset();
+				DissolveCluster( ClustersToDissolve[Index], &Members );
+				for( int32 MemberIndex = 0; MemberIndex < Members.Num(); MemberIndex++ )
+				{
+					UObject* Object = Members[MemberIndex];
+					if( Object->HasAnyFlags( RF_RootSet ) || (Object->HasAnyFlags( KeepFlags ) && !Object->HasAnyFlags( RF_PendingKill )) )
+					{
+						ObjectsToSerialize.Add( Object );
+						if( bIncremental )
+						{
+							GIncrementalReachability.Mark( Object );
+						}
+					}
+					else if( !bIncremental )
+					{
+						Object->SetFlags( RF_Unreachable );
+					}
+				}
+			}
+		}
+
+		// Rooted members keep their cluster, unless it was just dissolved and they were added above
+		for( int32 BlockIndex = 0; BlockIndex < Blocks.Num(); BlockIndex++ )
+		{
+			const TArray<UObject*>& KeptClusterMembers = Blocks[BlockIndex].KeptClusterMembers;
+			for( int32 Index = 0; Index < KeptClusterMembers.Num(); Index++ )
+			{
+				if( KeptClusterMembers[Index]->HasAnyFlags( RF_ClusterMember ) )
+				{
+					HandleClusterRootReference( ObjectsToSerialize, GetClusterRoot( KeptClusterMembers[Index] ) );
+				}
+			}
+		}
 	}
 
 	void DispatchObjectTasks(TArray<UObject*>& ObjectsToSerialize)
 	{
 	}
 
-	void ProcessObjectArray(TArray<UObject*>& InObjectsToSerializeArray, FGraphEventRef& MyCompletionGraphEvent)
+	/**
+	 * Walks the references of the passed in objects and of the objects they reach
+	 *
+	 * @param OutNewObjects	If set, only the passed in objects are walked and the newly reached ones are added here
+	 */
+	void ProcessObjectArray(TArray<UObject*>& InObjectsToSerializeArray, FGraphEventRef& MyCompletionGraphEvent, TArray<UObject*>* OutNewObjects = nullptr)
 	{		
+		check(!OutNewObjects || !GIsRunningParallelReachability);
 		UObject* CurrentObject = NULL;
 
 		const int32 MinDesiredObjectsPerSubTask = 128; // sometimes there will be less, a lot less
@@ -531,11 +905,14 @@ public:
 
 		/** Growing array of objects that require serialization */
 		TArray<UObject*>	NewObjectsToSerializeArray;
-		NewObjectsToSerializeArray.Empty( NewObjectsArrayLength );
+		if( !OutNewObjects )
+		{
+			NewObjectsToSerializeArray.Empty( NewObjectsArrayLength );
+		}
 
 		// Ping-pong between these two arrays if there's not enough objects to spawn a new task
 		TArray<UObject*>& ObjectsToSerialize = InObjectsToSerializeArray;
-		TArray<UObject*>& NewObjectsToSerialize = NewObjectsToSerializeArray;
+		TArray<UObject*>& NewObjectsToSerialize = OutNewObjects ? *OutNewObjects : NewObjectsToSerializeArray;
 
 		// Presized "recursion" stack for handling arrays and structs.
 		TArray<FStackEntry> Stack;
@@ -716,6 +1093,16 @@ public:
 				}
 				check(StackEntry == Stack.GetData());
 
+				// A reached cluster root keeps whatever its members reference
+				if( CurrentObject->HasAnyFlags( RF_ClusterMember ) && GetClusterRoot( CurrentObject ) == CurrentObject )
+				{
+					TArray<UObject*>& ClusterReferences = GetObjectCluster( CurrentObject ).ReferencedObjects;
+					for( int32 ReferenceIndex = 0; ReferenceIndex < ClusterReferences.Num(); ReferenceIndex++ )
+					{
+						HandleObjectReference( NewObjectsToSerialize, CurrentObject, ClusterReferences[ReferenceIndex], false );
+					}
+				}
+
 #if PERF_DETAILED_PER_CLASS_GC_STATS
 				// Detailed per class stats should not be performed when parallel GC is running
 				check( !GIsRunningParallelReachability );
@@ -735,6 +1122,14 @@ public:
 				// Reset current counts.
 				GCurrentObjectDisregardedObjectRefs = 0;
 				GCurrentObjectRegularObjectRefs		= 0;
+#endif
+				// Don't sit on a big batch of new objects while the other workers may be idle
+				if( GIsRunningParallelReachability && NewObjectsToSerialize.Num() >= MaxObjectsBeforeSplit )
+				{
+					MyCompletionGraphEvent->DontCompleteUntil(TGraphTask<FGCTask>::CreateTask().ConstructAndDispatchWhenReady(this, &NewObjectsToSerialize, 0, NewObjectsToSerialize.Num()));
+					NewObjectsToSerialize.Reset();
+				}
+#if PERF_DETAILED_PER_CLASS_GC_STATS
 			}
 			// Log summary stats.
 			LogClassCountInfo( TEXT("references to regular objects from"), GClassToRegularObjectRefsMap, 20, 0 );
@@ -754,7 +1149,7 @@ public:
 					StartIndex += NumThisTask;
 				}
 			}
-			else if( NewObjectsToSerialize.Num() )
+			else if( NewObjectsToSerialize.Num() && !OutNewObjects )
 			{
 				// Don't spawn a new task, continue in the current one
 				// To avoid allocating and moving memory around swap ObjectsToSerialize and NewObjectsToSerialize arrays
@@ -770,6 +1165,133 @@ public:
 	}
 };
 
+void FIncrementalReachability::Begin(EObjectFlags InKeepFlags, bool bForceSingleThreaded)
+{
+	check(!GIsIncrementalReachabilityPending);
+	const double StartTime = FPlatformTime::Seconds();
+
+	KeepFlags = InKeepFlags;
+	NumMarkBits = GUObjectArray.GetObjectArrayNum();
+	FirstGCIndex = NumMarkBits - GUObjectArray.GetObjectArrayNumMinusPermanent();
+	MarkBits.Init(0, (NumMarkBits + 31) / 32);
+	GrayObjects.Reset();
+	NumSlices = 1;
+
+	GIsIncrementalReachabilityPending = true;
+	GUObjectArray.AddUObjectCreateListener(this);
+
+	FArchiveRealtimeGC TagUsedRealtimeGC;
+	TagUsedRealtimeGC.MarkObjects(GrayObjects, KeepFlags, bForceSingleThreaded, true);
+
+	WalkTime = FPlatformTime::Seconds() - StartTime;
+}
+
+bool FIncrementalReachability::Walk(float TimeLimit)
+{
+	check(GIsIncrementalReachabilityPending);
+	const double StartTime = FPlatformTime::Seconds();
+	NumSlices++;
+
+	FArchiveRealtimeGC TagUsedRealtimeGC;
+	FGraphEventRef InvalidRef;
+	TArray<UObject*> Batch;
+	Batch.Empty(ObjectsPerBatch + 1);
+
+	TakeBarrierObjects();
+	while( GrayObjects.Num() )
+	{
+		// Walk depth first from the end of the list, it keeps the list short
+		const int32 NumInBatch = FMath::Min<int32>(ObjectsPerBatch, GrayObjects.Num());
+		Batch.Reset();
+		Batch.Append(GrayObjects.GetData() + GrayObjects.Num() - NumInBatch, NumInBatch);
+		GrayObjects.RemoveAt(GrayObjects.Num() - NumInBatch, NumInBatch, false);
+		TagUsedRealtimeGC.ProcessObjectArray(Batch, InvalidRef, &GrayObjects);
+
+		TakeBarrierObjects();
+		if( TimeLimit > 0.0f && FPlatformTime::Seconds() - StartTime > TimeLimit )
+		{
+			break;
+		}
+	}
+
+	WalkTime += FPlatformTime::Seconds() - StartTime;
+	return GrayObjects.Num() == 0;
+}
+
+void FIncrementalReachability::End()
+{
+	check(GIsIncrementalReachabilityPending);
+	const double StartTime = FPlatformTime::Seconds();
+
+	GUObjectArray.RemoveUObjectCreateListener(this);
+
+	// Native references aren't covered by the write barrier, walk the root set again to pick up what it references now.
+	// Roots that are already marked are walked too, it's the objects they reference that may have changed.
+	TArray<UObject*> ObjectsToSerialize;
+	{
+		FScopeLock Lock(&CriticalSection);
+		Exchange(ObjectsToSerialize, CreatedObjects);
+		ObjectsToSerialize.Append(BarrierObjects);
+		BarrierObjects.Empty();
+	}
+	ObjectsToSerialize.Append(GrayObjects);
+	GrayObjects.Empty();
+
+	for( int32 ObjectIndex = FirstGCIndex; ObjectIndex < GUObjectArray.GetObjectArrayNum(); ObjectIndex++ )
+	{
+		UObject* Object = (UObject*)GUObjectArray.IndexToObject(ObjectIndex);
+		if( Object && (Object->HasAnyFlags(RF_RootSet) || (Object->HasAnyFlags(KeepFlags) && !Object->HasAnyFlags(RF_PendingKill))) )
+		{
+			if( Object->HasAnyFlags(RF_ClusterMember) && GetClusterRoot(Object) != Object )
+			{
+				UObject* ClusterRoot = GetClusterRoot(Object);
+				MarkIndex(GUObjectArray.ObjectToIndex(ClusterRoot));
+				ObjectsToSerialize.Add(ClusterRoot);
+			}
+			else
+			{
+				MarkIndex(ObjectIndex);
+				ObjectsToSerialize.Add(Object);
+			}
+		}
+	}
+
+	if( ObjectsToSerialize.Num() )
+	{
+		FArchiveRealtimeGC TagUsedRealtimeGC;
+		FGraphEventRef InvalidRef;
+		TagUsedRealtimeGC.ProcessObjectArray(ObjectsToSerialize, InvalidRef);
+	}
+
+	GIsIncrementalReachabilityPending = false;
+	FPlatformMisc::MemoryBarrier();
+
+	// Anything that wasn't reached is garbage, from here on this is the same as a regular mark pass
+	for( int32 ObjectIndex = FirstGCIndex; ObjectIndex < NumMarkBits; ObjectIndex++ )
+	{
+		UObject* Object = (UObject*)GUObjectArray.IndexToObject(ObjectIndex);
+		// Cluster members are never marked, they go with their root below
+		if( Object && !IsMarked(ObjectIndex) && !(Object->HasAnyFlags(RF_ClusterMember) && GetClusterRoot(Object) != Object) )
+		{
+			Object->SetFlags(RF_Unreachable);
+		}
+	}
+	ReleaseUnreachableClusters();
+	MarkBits.Empty();
+	NumMarkBits = 0;
+
+	WalkTime += FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogGarbage, Log, TEXT("%f ms for incremental GC over %d slices"), WalkTime * 1000, NumSlices);
+}
+
+void IncrementalReachabilityWriteBarrierInternal(UObject* Object)
+{
+	if( !GUObjectAllocator.ResidesInPermanentPool(Object) && GIncrementalReachability.Mark(Object) )
+	{
+		GIncrementalReachability.AddBarrierObject(Object);
+	}
+}
+
 /**
  * Incrementally purge garbage by deleting all unreferenced objects after routing Destroy.
  *
@@ -1040,6 +1562,65 @@ COREUOBJECT_API EditorPostReachabilityAnalysisCallbackType EditorPostReachabilit
 static const auto CVarAllowParallelGC = 
 	IConsoleManager::Get().RegisterConsoleVariable( TEXT("AllowParallelGC"), 1, TEXT("Used to control parallel GC.") )->AsVariableInt();
 
+/** Fall back to single threaded GC if processor count is 1 or parallel GC is disabled or detailed per class gc stats are enabled (not thread safe) */
+static bool ShouldForceSingleThreadedGC()
+{
+	// Temporarily forcing single-threaded GC in the editor until Modify() can be safely removed from HandleObjectReference.
+	return !FApp::ShouldUseThreadingForPerformance() || !FPlatformProcess::SupportsMultithreading() ||
+#if PLATFORM_SUPPORTS_MULTITHREADED_GC
+		( FPlatformMisc::NumberOfCores() < 2 || CVarAllowParallelGC->GetValueOnGameThread() == 0 || PERF_DETAILED_PER_CLASS_GC_STATS );
+#else	//PLATFORM_SUPPORTS_MULTITHREADED_GC
+		true;
+#endif	//PLATFORM_SUPPORTS_MULTITHREADED_GC
+}
+
+/**
+ * Begins destroying the unreachable objects and kicks off the purge, the part of CollectGarbage after the reachability analysis.
+ *
+ * @param	bPerformFullPurge	if true, perform a full purge after the mark pass
+ */
+static void FinishGarbageCollection( bool bPerformFullPurge )
+{
+#if WITH_EDITOR
+	if ( GIsEditor && EditorPostReachabilityAnalysisCallback )
+	{
+		EditorPostReachabilityAnalysisCallback();
+	}
+#endif // WITH_EDITOR
+
+	// Unhash all unreachable objects.
+	const double StartTime = FPlatformTime::Seconds();
+	for ( FRawObjectIterator It(true); It; ++It )
+	{
+		//@todo UE4 - A prefetch was removed here. Re-add it. It wasn't right anyway, since it was ten items ahead and the consoles on have 8 prefetch slots
+
+		UObject* Object = *It;
+		if( Object->HasAnyFlags( RF_Unreachable ) )
+		{
+			// Begin the object's asynchronous destruction.
+			Object->ConditionalBeginDestroy();
+		}
+	}
+	UE_LOG(LogGarbage, Log, TEXT("%f ms for unhashing unreachable objects"), (FPlatformTime::Seconds() - StartTime) * 1000 );
+
+	// Set flag to indicate that we are relying on a purge to be performed.
+	GObjPurgeIsRequired = true;
+	// Reset purged count.
+	GPurgedObjectCountSinceLastMarkPhase = 0;
+
+	// Perform a full purge by not using a time limit for the incremental purge. The Editor always does a full purge.
+	if( bPerformFullPurge || GIsEditor )
+	{
+		IncrementalPurgeGarbage( false );	
+	}
+
+	// We're done collecting garbage. Note that IncrementalPurgeGarbage above might already clear it internally.
+	GIsGarbageCollecting = false;
+
+	// Route callbacks to verify GC assumptions
+	FCoreUObjectDelegates::PostGarbageCollect.Broadcast();
+}
+
 /** 
  * Deletes all unreferenced objects, keeping objects that have any of the passed in KeepFlags set
  *
@@ -1061,6 +1642,15 @@ void CollectGarbage( EObjectFlags KeepFlags, bool bPerformFullPurge )
 
 	UE_LOG(LogGarbage, Log, TEXT("Collecting garbage") );
 
+	// An incremental collection is still walking, finish it without a time limit instead of starting over
+	if( GIsIncrementalReachabilityPending )
+	{
+		GIncrementalReachability.Walk( 0.0f );
+		GIncrementalReachability.End();
+		FinishGarbageCollection( bPerformFullPurge );
+		return;
+	}
+
 	// Make sure previous incremental purge has finished or we do a full purge pass in case we haven't kicked one
 	// off yet since the last call to garbage collection.
 	if( GObjIncrementalPurgeIsInProgress || GObjPurgeIsRequired )
@@ -1114,15 +1704,7 @@ void CollectGarbage( EObjectFlags KeepFlags, bool bPerformFullPurge )
 	}
 #endif
 
-	// Fall back to single threaded GC if processor count is 1 or parallel GC is disabled
-	// or detailed per class gc stats are enabled (not thread safe)
-	// Temporarily forcing single-threaded GC in the editor until Modify() can be safely removed from HandleObjectReference.
-	const bool bForceSingleThreadedGC = !FApp::ShouldUseThreadingForPerformance() || !FPlatformProcess::SupportsMultithreading() ||
-#if PLATFORM_SUPPORTS_MULTITHREADED_GC
-		( FPlatformMisc::NumberOfCores() < 2 || CVarAllowParallelGC->GetValueOnGameThread() == 0 || PERF_DETAILED_PER_CLASS_GC_STATS );
-#else	//PLATFORM_SUPPORTS_MULTITHREADED_GC
-		true;
-#endif	//PLATFORM_SUPPORTS_MULTITHREADED_GC
+	const bool bForceSingleThreadedGC = ShouldForceSingleThreadedGC();
 
 	// Perform reachability analysis.
 	{
@@ -1132,44 +1714,156 @@ void CollectGarbage( EObjectFlags KeepFlags, bool bPerformFullPurge )
 		UE_LOG(LogGarbage, Log, TEXT("%f ms for GC"), (FPlatformTime::Seconds() - StartTime) * 1000 );
 	}
 
-#if WITH_EDITOR
-	if ( GIsEditor && EditorPostReachabilityAnalysisCallback )
+	FinishGarbageCollection( bPerformFullPurge );
+}
+
+bool CollectGarbageIncremental( EObjectFlags KeepFlags, float TimeLimit, bool bPerformFullPurge )
+{
+	// We can't collect garbage while there's a load in progress. E.g. one potential issue is Import.XObject
+	check( !IsLoading() );
+
+	if( !GIsIncrementalReachabilityPending )
 	{
-		EditorPostReachabilityAnalysisCallback();
+		FCoreUObjectDelegates::PreGarbageCollect.Broadcast();
+		TGuardValue<bool> GuardIsGarbageCollecting(GIsGarbageCollecting, true);
+
+		UE_LOG(LogGarbage, Log, TEXT("Collecting garbage incrementally") );
+
+		// Same as CollectGarbage, the mark bits can't be trusted while there are unreachable objects around
+		if( GObjIncrementalPurgeIsInProgress || GObjPurgeIsRequired )
+		{
+			IncrementalPurgeGarbage( false );
+		}
+		check( !GObjIncrementalPurgeIsInProgress );
+		check( !GObjPurgeIsRequired );
+
+		// Marking the roots is the first slice
+		GIncrementalReachability.Begin( KeepFlags, ShouldForceSingleThreadedGC() );
+		return false;
 	}
-#endif // WITH_EDITOR
 
-	// Unhash all unreachable objects.
-	const double StartTime = FPlatformTime::Seconds();
-	for ( FRawObjectIterator It(true); It; ++It )
+	GIsGarbageCollecting = true;
+
+	// Objects loaded asynchronously may not be ready to be walked, keep walking what's there until the loading is done
+	if( !GIncrementalReachability.Walk( TimeLimit ) || IsAsyncLoading() )
 	{
-		//@todo UE4 - A prefetch was removed here. Re-add it. It wasn't right anyway, since it was ten items ahead and the consoles on have 8 prefetch slots
+		GIsGarbageCollecting = false;
+		return false;
+	}
 
-		UObject* Object = *It;
-		if( Object->HasAnyFlags( RF_Unreachable ) )
+	GIncrementalReachability.End();
+	FinishGarbageCollection( bPerformFullPurge );
+	return true;
+}
+
+bool IsIncrementalReachabilityPending()
+{
+	return GIsIncrementalReachabilityPending;
+}
+
+bool CreateGCCluster( UObject* ClusterRoot )
+{
+	check( ClusterRoot );
+
+	// Nothing is static in the editor. The mark bits of an incremental walk don't know about clusters either
+	if( GIsEditor || GIsIncrementalReachabilityPending || ClusterRoot->HasAnyFlags( RF_ClusterMember | RF_PendingKill | RF_Unreachable ) ||
+		GUObjectAllocator.ResidesInPermanentPool( ClusterRoot ) || GUObjectArray.IsDisregardForGC( ClusterRoot ) )
+	{
+		return false;
+	}
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<UObject*> ObjectsInOuter;
+	GetObjectsWithOuter( ClusterRoot, ObjectsInOuter, true, RF_PendingKill | RF_Unreachable );
+
+	TArray<UObject*> Members;
+	Members.Reserve( ObjectsInOuter.Num() );
+	for( int32 Index = 0; Index < ObjectsInOuter.Num(); Index++ )
+	{
+		UObject* Object = ObjectsInOuter[Index];
+		// Classes and structs are left out, their token streams and the objects they own take part in every GC anyway
+		if( !Object->HasAnyFlags( RF_ClusterMember ) && !Object->IsA( UStruct::StaticClass() ) && Object->CanBeInCluster() &&
+			!GUObjectArray.IsDisregardForGC( Object ) )
 		{
-			// Begin the object's asynchronous destruction.
-			Object->ConditionalBeginDestroy();
+			Members.Add( Object );
 		}
 	}
-	UE_LOG(LogGarbage, Log, TEXT("%f ms for unhashing unreachable objects"), (FPlatformTime::Seconds() - StartTime) * 1000 );
+	if( Members.Num() == 0 )
+	{
+		return false;
+	}
 
-	// Set flag to indicate that we are relying on a purge to be performed.
-	GObjPurgeIsRequired = true;
-	// Reset purged count.
-	GPurgedObjectCountSinceLastMarkPhase = 0;
+	FUObjectCluster NewCluster;
+	NewCluster.RootIndex = GUObjectArray.ObjectToIndex( ClusterRoot );
+	const int32 ClusterIndex = GUObjectClusters.Add( NewCluster );
+	FUObjectCluster& Cluster = GUObjectClusters[ClusterIndex];
 
-	// Perform a full purge by not using a time limit for the incremental purge. The Editor always does a full purge.
-	if( bPerformFullPurge || GIsEditor )
+	if( GObjectToClusterIndex.Num() < GUObjectArray.GetObjectArrayNum() )
 	{
-		IncrementalPurgeGarbage( false );	
+		GObjectToClusterIndex.SetNum( GUObjectArray.GetObjectArrayNum() );
 	}
 
-	// We're done collecting garbage. Note that IncrementalPurgeGarbage above might already clear it internally.
-	GIsGarbageCollecting = false;
+	ClusterRoot->SetFlags( RF_ClusterMember );
+	GObjectToClusterIndex[Cluster.RootIndex] = ClusterIndex;
+	Cluster.Objects.Reserve( Members.Num() );
+	for( int32 Index = 0; Index < Members.Num(); Index++ )
+	{
+		const int32 ObjectIndex = GUObjectArray.ObjectToIndex( Members[Index] );
+		Members[Index]->SetFlags( RF_ClusterMember );
+		GObjectToClusterIndex[ObjectIndex] = ClusterIndex;
+		Cluster.Objects.Add( ObjectIndex );
+	}
 
-	// Route callbacks to verify GC assumptions
-	FCoreUObjectDelegates::PostGarbageCollect.Broadcast();
+	// Gather what the cluster references outside of itself, this is all the GC will walk from now on
+	TSet<UObject*> ReferencedObjects;
+	TArray<UObject*> References;
+	Members.Add( ClusterRoot );
+	for( int32 Index = 0; Index < Members.Num(); Index++ )
+	{
+		References.Reset();
+		FReferenceFinder ReferenceFinder( References );
+		ReferenceFinder.FindReferences( Members[Index] );
+		for( int32 ReferenceIndex = 0; ReferenceIndex < References.Num(); ReferenceIndex++ )
+		{
+			UObject* Object = References[ReferenceIndex];
+			const bool bInThisCluster = Object->HasAnyFlags( RF_ClusterMember ) && GObjectToClusterIndex[GUObjectArray.ObjectToIndex( Object )] == ClusterIndex;
+			if( !bInThisCluster && !GUObjectAllocator.ResidesInPermanentPool( Object ) )
+			{
+				ReferencedObjects.Add( Object );
+			}
+		}
+	}
+	Cluster.ReferencedObjects = ReferencedObjects.Array();
+
+	UE_LOG(LogGarbage, Log, TEXT("Created GC cluster for %s with %d objects and %d outside references in %f ms"), *ClusterRoot->GetFullName(),
+		Cluster.Objects.Num() + 1, Cluster.ReferencedObjects.Num(), (FPlatformTime::Seconds() - StartTime) * 1000 );
+	return true;
+}
+
+void DissolveGCCluster( UObject* ClusterObject )
+{
+	check( !GIsGarbageCollecting );
+	if( ClusterObject && ClusterObject->HasAnyFlags( RF_ClusterMember ) )
+	{
+		DissolveCluster( GObjectToClusterIndex[GUObjectArray.ObjectToIndex( ClusterObject )] );
+	}
+}
+
+void GCClusterWriteBarrier( UObject* ClusterObject, UObject* Object )
+{
+	if( !Object || !ClusterObject || !ClusterObject->HasAnyFlags( RF_ClusterMember ) || GUObjectAllocator.ResidesInPermanentPool( Object ) )
+	{
+		return;
+	}
+	check( !GIsGarbageCollecting );
+	FUObjectCluster& Cluster = GetObjectCluster( ClusterObject );
+	const bool bInThisCluster = Object->HasAnyFlags( RF_ClusterMember ) && &GetObjectCluster( Object ) == &Cluster;
+	if( !bInThisCluster )
+	{
+		Cluster.ReferencedObjects.AddUnique( Object );
+		// An incremental walk may have gone past the cluster root already
+		IncrementalReachabilityWriteBarrier( Object );
+	}
 }
 
 /**
@@ -545,6 +545,22 @@ ULinkerLoad::ELinkerStatus ULinkerLoad::Tick( float InTimeLimit, bool bInUseTime
 
 	if( bHasFinishedInitialization == false )
 	{
+#if USE_ASYNC_LOADING_THREAD
+		// The loading thread owns the linker until it's done with the header.
+		if( AsyncHeaderState.GetValue() == ASYNCHEADER_InFlight )
+		{
+			if( bInUseTimeLimit )
+			{
+				return LINKER_TimedOut;
+			}
+			WaitForAsyncHeader();
+		}
+		if( AsyncHeaderState.GetValue() == ASYNCHEADER_Failed )
+		{
+			return LINKER_Failed;
+		}
+#endif
+
 		// Store variables used by functions below.
 		TickStartTime		= FPlatformTime::Seconds();
 		bTimeLimitExceeded	= false;
@@ -561,6 +577,18 @@ ULinkerLoad::ELinkerStatus ULinkerLoad::Tick( float InTimeLimit, bool bInUseTime
 				Status = CreateLoader();
 			}
 
+#if USE_ASYNC_LOADING_THREAD
+			// Loader creation uses the precache and linker maps so it stays here, the header is serialized on the loading thread.
+			// Only async loads are handed over, a load without time limit would just wait for it.
+			if( Status != LINKER_Failed && bUseTimeLimit && AsyncHeaderState.GetValue() == ASYNCHEADER_None && FAsyncLoadingThread::IsEnabled() )
+			{
+				check( Loader );
+				AsyncHeaderState.Set( ASYNCHEADER_InFlight );
+				FAsyncLoadingThread::Get().QueueLinker( this );
+				return LINKER_TimedOut;
+			}
+#endif
+
 			// Serialize the package file summary and presize the various arrays (name, import & export map)
 			if( Status == LINKER_Loaded )
 			{
@@ -652,6 +680,67 @@ ULinkerLoad::ELinkerStatus ULinkerLoad::Tick( float InTimeLimit, bool bInUseTime
 	return Status;
 }
 
+#if USE_ASYNC_LOADING_THREAD
+void ULinkerLoad::SerializeHeaderOnLoadingThread()
+{
+	check( Loader );
+
+	// Blocking on I/O is fine here, so there's no time limit.
+	bUseTimeLimit		= false;
+	bUseFullTimeLimit	= false;
+	bTimeLimitExceeded	= false;
+
+	ELinkerStatus Status = LINKER_Loaded;
+	do
+	{
+		// Only precaches the summary, the loader has been created on the game thread.
+		Status = CreateLoader();
+
+		if( Status == LINKER_Loaded )
+		{
+			Status = SerializePackageFileSummary();
+		}
+
+		if( Status == LINKER_Loaded )
+		{
+			Status = SerializeNameMap();
+		}
+
+		if( Status == LINKER_Loaded )
+		{
+			Status = SerializeImportMap();
+		}
+
+		if( Status == LINKER_Loaded )
+		{
+			Status = SerializeExportMap();
+		}
+
+		// Without a time limit this only happens while waiting for a precache request.
+		if( Status == LINKER_TimedOut )
+		{
+			FPlatformProcess::Sleep(0);
+		}
+	}
+	while( Status == LINKER_TimedOut );
+
+	AsyncHeaderState.Set( Status == LINKER_Loaded ? ASYNCHEADER_Done : ASYNCHEADER_Failed );
+}
+
+void ULinkerLoad::WaitForAsyncHeader()
+{
+	if( AsyncHeaderState.GetValue() == ASYNCHEADER_InFlight )
+	{
+		double StartTime = FPlatformTime::Seconds();
+		while( AsyncHeaderState.GetValue() == ASYNCHEADER_InFlight )
+		{
+			FPlatformProcess::Sleep(0);
+		}
+		UE_LOG(LogStreaming, Verbose, TEXT("Waited %.3f sec for the async loading thread to serialize the header of '%s'."), FPlatformTime::Seconds() - StartTime, *Filename);
+	}
+}
+#endif // USE_ASYNC_LOADING_THREAD
+
 /**
  * Private constructor, passing arguments through from CreateLinker.
  *
@@ -3841,6 +3930,10 @@ extern TArray<ULinkerLoad*> GDelayedLinkerClosePackages;
  */
 void ULinkerLoad::Detach( bool bEnsureAllBulkDataIsLoaded )
 {
+#if USE_ASYNC_LOADING_THREAD
+	// The loading thread may still be reading through the loader.
+	WaitForAsyncHeader();
+#endif
 #if WITH_EDITOR
 	// Detach all lazy loaders.
 	DetachAllBulkData( bEnsureAllBulkDataIsLoaded );
@@ -1205,6 +1205,11 @@ bool UObject::IsAsset () const
 	return false;
 }
 
+bool UObject::CanBeInCluster() const
+{
+	return false;
+}
+
 bool UObject::IsSafeForRootSet() const
 {
 	if (IsInBlueprint())
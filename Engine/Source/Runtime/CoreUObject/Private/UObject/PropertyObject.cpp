@@ -69,6 +69,7 @@ void UObjectProperty::SetObjectPropertyValue(void* PropertyValueAddress, UObject
 	}
 #endif // USE_DEFERRED_DEPENDENCY_CHECK_VERIFICATION_TESTS
 
+	IncrementalReachabilityWriteBarrier(Value);
 	SetPropertyValue(PropertyValueAddress, Value);
 }
 
@@ -128,7 +128,8 @@ void UPackage::WaitForAsyncFileWrites()
 	}
 }
 
-void AsyncWriteFile(const TArray<uint8>& Data, const TCHAR* Filename, const FDateTime& TimeStamp)
+/** Writes the file on a background thread. Data is taken over and left empty, so the package buffer isn't copied */
+void AsyncWriteFile(TArray<uint8>& Data, const TCHAR* Filename, const FDateTime& TimeStamp)
 {
 	class FAsyncWriteWorker : public FNonAbandonableTask
 	{
@@ -142,11 +143,11 @@ void AsyncWriteFile(const TArray<uint8>& Data, const TCHAR* Filename, const FDat
 
 		/** Constructor
 		*/
-		FAsyncWriteWorker(const TCHAR* InFilename, const TArray<uint8>* InData, const FDateTime& InTimeStamp)
+		FAsyncWriteWorker(const TCHAR* InFilename, TArray<uint8>* InData, const FDateTime& InTimeStamp)
 			: Filename(InFilename)
-			, Data(*InData)
 			, FinalTimeStamp(InTimeStamp)
 		{
+			Exchange(Data, *InData);
 		}
 		
 		/** Write the file  */
@@ -750,6 +751,26 @@ public:
 	 * @return true if sucessful, false otherwise
 	 */
 	void CompressArchive( FArchive* FileReader, FArchive* FileWriter, ULinkerSave* SrcLinker )
+	{
+		TArray<int32> ExportSerialSizes;
+		ExportSerialSizes.Empty(SrcLinker->ExportMap.Num());
+		for( int32 ExportIndex=0; ExportIndex<SrcLinker->ExportMap.Num(); ExportIndex++ )
+		{
+			ExportSerialSizes.Add(SrcLinker->ExportMap[ExportIndex].SerialSize);
+		}
+		CompressArchive(FileReader, FileWriter, SrcLinker->Summary.TotalHeaderSize, ExportSerialSizes, SrcLinker->ForceByteSwapping());
+	}
+
+	/**
+	 * Compresses the passed in src archive and writes it to destination archive. Doesn't need the linker, so it can run on any thread.
+	 *
+	 * @param	FileReader			archive to read from
+	 * @param	FileWriter			archive to write to
+	 * @param	TotalHeaderSize		header size of the package, from the summary of the linker used to save the src file
+	 * @param	ExportSerialSizes	serial size of each export of the linker used to save the src file
+	 * @param	bForceByteSwapping	Should the output file be force-byteswapped
+	 */
+	void CompressArchive( FArchive* FileReader, FArchive* FileWriter, int32 TotalHeaderSize, const TArray<int32>& ExportSerialSizes, bool bForceByteSwapping )
 	{
 
 		// Read package file summary from source file.
@@ -757,13 +778,13 @@ public:
 		(*FileReader) << FileSummary;
 
 		// Propagate byte swapping.
-		FileWriter->SetByteSwapping( SrcLinker->ForceByteSwapping() );
+		FileWriter->SetByteSwapping( bForceByteSwapping );
 
 		// We don't compress the package file summary but treat everything afterwards
 		// till the first export as a single chunk. This basically lumps name and import 
 		// tables into one compressed block.
 		int32 StartOffset			= FileReader->Tell();
-		int32 RemainingHeaderSize	= SrcLinker->Summary.TotalHeaderSize - StartOffset;
+		int32 RemainingHeaderSize	= TotalHeaderSize - StartOffset;
 		CurrentChunk.UncompressedSize	= RemainingHeaderSize;
 		CurrentChunk.UncompressedOffset	= StartOffset;
 
@@ -772,10 +793,9 @@ public:
 		
 		// Iterate over all exports and add them separately. The underlying code will take
 		// care of merging small blocks.
-		for( int32 ExportIndex=0; ExportIndex<SrcLinker->ExportMap.Num(); ExportIndex++ )
+		for( int32 ExportIndex=0; ExportIndex<ExportSerialSizes.Num(); ExportIndex++ )
 		{
-			const FObjectExport& Export = SrcLinker->ExportMap[ExportIndex];		
-			AddToChunk( Export.SerialSize );
+			AddToChunk( ExportSerialSizes[ExportIndex] );
 		}
 		
 		// Finish chunk in flight and reset current chunk with size 0.
@@ -784,7 +804,7 @@ public:
 		ECompressionFlags BaseCompressionMethod = COMPRESS_Default;
 		if (FileWriter->IsCooking())
 		{
-			BaseCompressionMethod = FileWriter->CookingTarget()->GetBaseCompressionMethod();
+			BaseCompressionMethod = FCompression::GetConfiguredCompressionFlags(TEXT("PackageFormat"), FileWriter->CookingTarget()->GetBaseCompressionMethod());
 		}
 
 		// Write base version of package file summary after updating compressed chunks array and compression flags.
@@ -952,6 +972,79 @@ private:
 	FCompressedChunk			CurrentChunk;
 };
 
+/** Compresses and writes a package saved to memory on a background thread, see FFileCompressionHelper::CompressFile. Takes over the data of the linker's saver */
+static void AsyncCompressAndWriteFile(ULinkerSave* SrcLinker, const TCHAR* Filename, const FDateTime& TimeStamp)
+{
+	class FAsyncCompressAndWriteWorker : public FNonAbandonableTask
+	{
+	public:
+		/** Filename To write to**/
+		FString Filename;
+		/** Uncompressed package **/
+		TArray<uint8> Data;
+		/** What CompressArchive needs from the linker, which can be gone by the time the task runs */
+		int32 TotalHeaderSize;
+		TArray<int32> ExportSerialSizes;
+		bool bForceByteSwapping;
+		/** Timestamp to give the file. MinValue if shouldn't be modified */
+		FDateTime FinalTimeStamp;
+
+		FAsyncCompressAndWriteWorker(const TCHAR* InFilename, ULinkerSave* SrcLinker, const FDateTime& InTimeStamp)
+			: Filename(InFilename)
+			, TotalHeaderSize(SrcLinker->Summary.TotalHeaderSize)
+			, bForceByteSwapping(SrcLinker->ForceByteSwapping())
+			, FinalTimeStamp(InTimeStamp)
+		{
+			Exchange(Data, *(FBufferArchive*)(SrcLinker->Saver));
+			ExportSerialSizes.Empty(SrcLinker->ExportMap.Num());
+			for (int32 ExportIndex = 0; ExportIndex < SrcLinker->ExportMap.Num(); ExportIndex++)
+			{
+				ExportSerialSizes.Add(SrcLinker->ExportMap[ExportIndex].SerialSize);
+			}
+		}
+
+		/** Compress and write the file */
+		void DoWork()
+		{
+			check(Data.Num());
+			FString TmpFilename = FPaths::GetPath( Filename ) / ( FPaths::GetBaseFilename( Filename ) + TEXT( "_SaveCompressed.tmp" ));
+			FArchive* FileWriter = IFileManager::Get().CreateFileWriter( *TmpFilename );
+			if (!FileWriter)
+			{
+				UE_LOG(LogSavePackage, Fatal, TEXT("Could not write to %s!"), *TmpFilename);
+			}
+			else
+			{
+				FMemoryReader Reader(Data, true);
+				FFileCompressionHelper CompressionHelper;
+				CompressionHelper.CompressArchive(&Reader, FileWriter, TotalHeaderSize, ExportSerialSizes, bForceByteSwapping);
+
+				// Tear down file writer. This will flush the writer first.
+				delete FileWriter;
+				Data.Empty();
+
+				if (!IFileManager::Get().Move(*Filename, *TmpFilename))
+				{
+					UE_LOG(LogSavePackage, Fatal, TEXT("Could not move to %s."), *Filename);
+				}
+				else if (FinalTimeStamp != FDateTime::MinValue())
+				{
+					IFileManager::Get().SetTimeStamp(*Filename, FinalTimeStamp);
+				}
+			}
+			OutstandingAsyncWrites.Decrement();
+		}
+
+		static const TCHAR *Name()
+		{
+			return TEXT("FAsyncCompressAndWriteWorker");
+		}
+	};
+
+	OutstandingAsyncWrites.Increment();
+	(new FAutoDeleteAsyncTask<FAsyncCompressAndWriteWorker>(Filename, SrcLinker, TimeStamp))->StartBackgroundTask();
+}
+
 
 /**
  * Find most likely culprit that caused the objects in the passed in array to be considered for saving.
@@ -3578,7 +3671,16 @@ bool UPackage::SavePackage( UPackage* InOuter, UObject* Base, EObjectFlags TopLe
 				if( Success == true )
 				{
 					// Compress the temporarily file to destination.
-					if( bCompressFromMemory )
+					if( bCompressFromMemory && bSaveAsync )
+					{
+						UE_LOG(LogSavePackage, Log,  TEXT("Async compressing from memory to '%s'"), *NewPath );
+
+						AsyncCompressAndWriteFile(Linker, *NewPath, FinalTimeStamp);
+
+						// Detach archive used for memory saving.
+						Linker->Detach();
+					}
+					else if( bCompressFromMemory )
 					{
 						UE_LOG(LogSavePackage, Log,  TEXT("Compressing from memory to '%s'"), *NewPath );
 						FFileCompressionHelper CompressionHelper;
@@ -12,6 +12,8 @@ DEFINE_LOG_CATEGORY(LogScriptFrame);
 DEFINE_LOG_CATEGORY_STATIC(LogScriptCore, Log, All);
 
 DECLARE_CYCLE_STAT(TEXT("Blueprint Time"),STAT_BlueprintTime,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("ProcessEvent Calls"),STAT_ProcessEventCalls,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("ProcessEvent Calls Without Frame Copy"),STAT_ProcessEventCallsWithoutFrameCopy,STATGROUP_Game);
 
 
 /*-----------------------------------------------------------------------------
@@ -369,7 +371,15 @@ void UObject::CallFunction( FFrame& Stack, RESULT_DECL, UFunction* Function )
 {
 	checkSlow(Function);
 
-	if (Function->FunctionFlags & FUNC_Native)
+	if ((Function->FunctionFlags & (FUNC_Native | FUNC_Static | FUNC_BlueprintAuthorityOnly | FUNC_BlueprintCosmetic | FUNC_NetFuncFlags | FUNC_NetRequest | FUNC_NetResponse)) == (FUNC_Native | FUNC_Static))
+	{
+		// Static native functions (math and other library calls) can't be replicated or absorbed, so every
+		// GetFunctionCallspace returns Local for them: call them directly, they're most of what pure nodes run.
+		FScopeCycleCounterUObject FunctionScope(Function);
+
+		Function->Invoke(this, Stack, Result);
+	}
+	else if (Function->FunctionFlags & FUNC_Native)
 	{
 		// Call native networkable function.
 		uint8 Buffer[1024];
@@ -839,23 +849,40 @@ void UObject::ProcessEvent( UFunction* Function, void* Parms )
 	ScriptEntryTag++;
 
 	CONDITIONAL_SCOPE_CYCLE_COUNTER(STAT_BlueprintTime, ScriptEntryTag == 1);
+	INC_DWORD_STAT(STAT_ProcessEventCalls);
 
 	// Scope required for scoped script stats.
 	{
+		// Native functions have no locals and read their parameters into C++ variables, so the caller's parameters
+		// can be their frame: there is nothing to initialize, copy back or destroy.
+		const bool bUseParmsAsFrame = (Function->FunctionFlags & FUNC_Native) && Function->FirstPropertyToInit == NULL;
+
 		uint8* Frame = NULL;
 #if USE_UBER_GRAPH_PERSISTENT_FRAME
-		Frame = GetClass()->GetPersistentUberGraphFrame(this, Function);
+		if (!bUseParmsAsFrame)
+		{
+			Frame = GetClass()->GetPersistentUberGraphFrame(this, Function);
+		}
 #endif
 		const bool bUsePersistentFrame = (NULL != Frame);
-		if (!bUsePersistentFrame)
+		if (bUseParmsAsFrame)
 		{
-			Frame = (uint8*)FMemory_Alloca(Function->PropertiesSize);
-			// zero the local property memory
-			FMemory::Memzero(Frame + Function->ParmsSize, Function->PropertiesSize - Function->ParmsSize);
+			checkSlow(Function->PropertiesSize <= Align(Function->ParmsSize, Function->GetMinAlignment()));
+			Frame = (uint8*)Parms;
+			INC_DWORD_STAT(STAT_ProcessEventCallsWithoutFrameCopy);
 		}
+		else
+		{
+			if (!bUsePersistentFrame)
+			{
+				Frame = (uint8*)FMemory_Alloca(Function->PropertiesSize);
+				// zero the local property memory
+				FMemory::Memzero(Frame + Function->ParmsSize, Function->PropertiesSize - Function->ParmsSize);
+			}
 
-		// initialize the parameter properties
-		FMemory::Memcpy(Frame, Parms, Function->ParmsSize);
+			// initialize the parameter properties
+			FMemory::Memcpy(Frame, Parms, Function->ParmsSize);
+		}
 
 		// Create a new local execution stack.
 		FFrame NewStack(this, Function, Frame, NULL, Function->Children);
@@ -904,7 +931,7 @@ void UObject::ProcessEvent( UFunction* Function, void* Parms )
 #endif
 		}
 
-		if (!bUsePersistentFrame)
+		if (!bUsePersistentFrame && !bUseParmsAsFrame)
 		{
 			for (UProperty* LocalProp = Function->FirstPropertyToInit; LocalProp != NULL; LocalProp = (UProperty*)LocalProp->Next)
 			{
@@ -924,7 +951,7 @@ void UObject::ProcessEvent( UFunction* Function, void* Parms )
 			Function->Invoke(this, NewStack, (uint8*)Parms + Function->ReturnValueOffset);
 		}
 
-		if (!bUsePersistentFrame)
+		if (!bUsePersistentFrame && !bUseParmsAsFrame)
 		{
 			// Destroy local variables except function parameters.!! see also UObject::CallFunctionByNameWithArguments
 			// also copy back constructed value parms here so the correct copy is destroyed when the event function returns
@@ -5,6 +5,7 @@
 =============================================================================*/
 
 #include "CoreUObjectPrivate.h"
+#include "Containers/PagedFixedSizeAllocator.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUObjectAllocator, Log, All);
 
@@ -41,14 +42,33 @@ void FUObjectAllocator::BootMessage()
 }
 
 /**
- * Allocates a UObjectBase from the free store or the permanent object pool
+ * Makes objects of exactly this class come from a paged pool
+ *
+ * @param Class class whose objects to pool
+ */
+void FUObjectAllocator::RegisterPooledClass(const UClass* Class)
+{
+	check(IsInGameThread());
+	check(Class);
+	if (!ClassPools.Contains(Class))
+	{
+		const int32 ObjectSize = Align(Class->GetPropertiesSize(), 16);
+		// 64KB pages, or a single object for the huge ones
+		ClassPools.Add(Class, new FPagedFixedSizeAllocator(ObjectSize, FMath::Max(65536 / ObjectSize, 1)));
+		UE_LOG(LogUObjectAllocator, Log, TEXT("Pooling objects of class %s."), *Class->GetName());
+	}
+}
+
+/**
+ * Allocates a UObjectBase from the free store, the permanent object pool or the pool of its class
  *
  * @param Size size of uobject to allocate
  * @param Alignment alignment of uobject to allocate
  * @param bAllowPermanent if true, allow allocation in the permanent object pool, if it fits
+ * @param Class class of the uobject, used to find its pool if it has one
  * @return newly allocated UObjectBase (not really a UObjectBase yet, no constructor like thing has been called).
  */
-UObjectBase* FUObjectAllocator::AllocateUObject(int32 Size, int32 Alignment, bool bAllowPermanent)
+UObjectBase* FUObjectAllocator::AllocateUObject(int32 Size, int32 Alignment, bool bAllowPermanent, const UClass* Class)
 {
 	// Force alignment to 16 bytes
 	Alignment = 16;
@@ -78,8 +98,17 @@ UObjectBase* FUObjectAllocator::AllocateUObject(int32 Size, int32 Alignment, boo
 	}
 	else
 	{
-		// Allocate new memory of the appropriate size and alignment.
-		Result = (UObjectBase*)FMemory::Malloc( AlignedSize );
+		FPagedFixedSizeAllocator* ClassPool = (Class && ClassPools.Num()) ? ClassPools.FindRef(Class) : NULL;
+		// the class may have grown since it was registered, e.g. with hot reload
+		if (ClassPool && (uint32)AlignedSize <= ClassPool->GetElementSize())
+		{
+			Result = (UObjectBase*)ClassPool->Allocate();
+		}
+		else
+		{
+			// Allocate new memory of the appropriate size and alignment.
+			Result = (UObjectBase*)FMemory::Malloc( AlignedSize );
+		}
 	}
 	return Result;
 }
@@ -96,6 +125,15 @@ void FUObjectAllocator::FreeUObject(UObjectBase *Object) const
 	// Only free memory if it was allocated directly from allocator and not from permanent object pool.
 	if( ResidesInPermanentPool(Object) == false )
 	{
+		// The object is destroyed already, so the pool is found by address.
+		for (TMap<const UClass*, FPagedFixedSizeAllocator*>::TConstIterator It(ClassPools); It; ++It)
+		{
+			if (It.Value()->Contains(Object))
+			{
+				It.Value()->Free(Object);
+				return;
+			}
+		}
 		FMemory::Free(Object);
 	}
 	// We only destroy objects residing in permanent object pool during the exit purge.
@@ -1410,7 +1410,7 @@ UObject* StaticDuplicateObjectEx( FObjectDuplicationParameters& Parameters )
 	{
 	// make sure we are not duplicating RF_RootSet as this flag is special
 	// also make sure we are not duplicating the RF_ClassDefaultObject flag as this can only be set on the real CDO
-	Parameters.FlagMask &= ~(RF_RootSet|RF_ClassDefaultObject);
+	Parameters.FlagMask &= ~(RF_RootSet|RF_ClusterMember|RF_ClassDefaultObject);
 	}
 
 	// disable object and component instancing while we're duplicating objects, as we're going to instance components manually a little further below
@@ -1749,7 +1749,7 @@ UObject* StaticAllocateObject
 	if( Obj == NULL )
 	{
 		int32 Alignment	= FMath::Max( 4, InClass->GetMinAlignment() );
-		Obj = (UObject *)GUObjectAllocator.AllocateUObject(TotalSize,Alignment,GIsInitialLoad);
+		Obj = (UObject *)GUObjectAllocator.AllocateUObject(TotalSize,Alignment,GIsInitialLoad,InClass);
 	}
 	else
 	{
@@ -1548,6 +1548,8 @@ private:
 	uint8*							PrecacheBuffer[2];
 	/** Status of pending read, a value of 0 means no outstanding reads.			*/
 	FThreadSafeCounter				PrecacheReadStatus[2];
+	/** I/O request of the pending read, used to cancel it on destruction.			*/
+	uint64							PrecacheRequestId[2];
 	
 	/** Mapping of compressed <-> uncompresses sizes and offsets, NULL if not used.	*/
 	TArray<FCompressedChunk>*		CompressedChunks;
@@ -6,6 +6,52 @@
 
 #pragma once
 
+/**
+ * Package dependency graph written by the cooker, mapping each cooked package to the packages it imports.
+ * The async loader uses it to queue the whole dependency closure of a package as soon as it starts loading,
+ * instead of discovering the imports one level at a time as each linker finishes.
+ */
+class COREUOBJECT_API FPackageDependencyGraph
+{
+public:
+	/** @return the graph of the cooked game, loaded on first use. Empty for uncooked builds */
+	static FPackageDependencyGraph& Get();
+
+	/** Sets the packages directly imported by PackageName */
+	void SetDependencies(FName PackageName, const TArray<FName>& InDependencies);
+
+	/**
+	 * Gathers all the packages PackageName depends on, directly or not, in load order (each package comes after its dependencies).
+	 * PackageName itself is not included.
+	 *
+	 * @return false if the package is not in the graph
+	 */
+	bool GetLoadOrder(FName PackageName, TArray<FName>& OutLoadOrder) const;
+
+	/** @return number of packages in the graph */
+	int32 Num() const
+	{
+		return Dependencies.Num();
+	}
+
+	bool Save(const TCHAR* Filename) const;
+	bool Load(const TCHAR* Filename);
+
+	friend FArchive& operator<<(FArchive& Ar, FPackageDependencyGraph& Graph);
+
+	/** File the cooker writes the graph to, relative to the game directory */
+	static const TCHAR* GetFilename()
+	{
+		return TEXT("PackageDependencies.bin");
+	}
+
+private:
+	void GatherLoadOrder(FName PackageName, TSet<FName>& Visited, TArray<FName>& OutLoadOrder) const;
+
+	/** Packages imported by each package */
+	TMap<FName, TArray<FName> > Dependencies;
+};
+
 /**
  * Structure containing intermediate data required for async loading of all imports and exports of a
  * ULinkerLoad.
@@ -43,6 +89,56 @@ struct FAsyncPackage : public FGCObject
 	 */
 	void ResetLoader();
 
+	/**
+	 * @return Priority of this request, higher priorities are processed first
+	 */
+	FORCEINLINE int32 GetPriority() const
+	{
+		return Priority;
+	}
+
+	/**
+	 * Changes the priority of this request. Pending imports are raised to it too so they don't hold it back.
+	 */
+	void SetPriority(int32 InPriority);
+
+	/**
+	 * Cancels this request. The linker and the imports only needed by it are released on the next ProcessAsyncLoading
+	 * and the completion callbacks are called with a null package.
+	 *
+	 * @return false if it's too late: the load has finished, exports are being created, or other packages import it
+	 */
+	bool Cancel();
+
+	/**
+	 * @return true if this request has been cancelled and is waiting to be released
+	 */
+	FORCEINLINE bool WasCancelled() const
+	{
+		return bLoadWasCancelled;
+	}
+
+	/**
+	 * Releases the linker and imports of a cancelled request. Called by ProcessAsyncLoading before removing it.
+	 */
+	void ReleaseCancelled();
+
+	/**
+	 * Clears a pending cancellation, when the package is requested again before being released.
+	 */
+	FORCEINLINE void ClearCancelled()
+	{
+		bLoadWasCancelled = false;
+	}
+
+	/**
+	 * Marks this package as requested through LoadPackageAsync. Releasing a cancelled importer then doesn't cancel it.
+	 */
+	FORCEINLINE void SetRequestedDirectly()
+	{
+		bRequestedDirectly = true;
+	}
+
 	/**
 	 * Returns the name of the package to load.
 	 */
@@ -141,6 +237,12 @@ private:
 	bool						bLoadHasFailed;
 	/** True if our load has finished */
 	bool						bLoadHasFinished;
+	/** True if the request has been cancelled and is waiting to be released */
+	bool						bLoadWasCancelled;
+	/** True if LoadPackageAsync requested this package, false if it is only queued as an import of other packages */
+	bool						bRequestedDirectly;
+	/** Priority of the request, higher priorities are processed first									*/
+	int32						Priority;
 	/** The time taken when we started the tick.														*/
 	double						TickStartTime;
 	/** Last object work was performed on. Used for debugging/ logging purposes.						*/
@@ -309,6 +411,11 @@ private:
 	 * Removes references to any imported packages.
 	 */
 	void FreeReferencedImports();
+	/**
+	 * Queues all the packages this package depends on according to the cooked dependency graph,
+	 * so their I/O starts right away and dependencies are processed first.
+	 */
+	void QueueDependencyClosure();
 
 #if PERF_TRACK_DETAILED_ASYNC_STATS
 	/** Add this time taken for object of class Class to have CreateExport called, to the stats we track. */
@@ -320,3 +427,41 @@ private:
 };
 
 
+
+#if USE_ASYNC_LOADING_THREAD
+/**
+ * Thread serializing the package file summary, name, import and export maps of async loaded linkers.
+ * Everything past the header (import resolution, export creation, PostLoad) stays on the game thread.
+ */
+class FAsyncLoadingThread : public FRunnable
+{
+public:
+	/** @return the loading thread, it is started on the first call */
+	static FAsyncLoadingThread& Get();
+
+	/** @return true if async loads should hand their headers to the loading thread */
+	static bool IsEnabled();
+
+	/** Queues the header serialization of a linker. The linker must have a loader and must not be ticked until it's done. */
+	void QueueLinker(ULinkerLoad* Linker);
+
+	// FRunnable interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	FAsyncLoadingThread();
+	virtual ~FAsyncLoadingThread();
+
+	/** Stops the thread before the engine goes away */
+	void Shutdown();
+
+	/** Linkers waiting for the thread, guarded by QueueCritical */
+	TArray<ULinkerLoad*> QueuedLinkers;
+	FCriticalSection QueueCritical;
+	/** Triggered when a linker is queued or the thread is stopped */
+	FEvent* QueuedEvent;
+	FThreadSafeCounter StopTaskCounter;
+	FRunnableThread* Thread;
+};
+#endif // USE_ASYNC_LOADING_THREAD
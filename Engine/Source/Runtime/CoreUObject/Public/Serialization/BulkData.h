@@ -23,8 +23,10 @@ enum EBulkDataFlags
 	BULKDATA_Unused								= 1<<5,
 	/** Forces the payload to be saved inline, regardless of its size				*/
 	BULKDATA_ForceInlinePayload					= 1<<6,
+	/** If set, payload should be [un]compressed using LZ4 during serialization.	*/
+	BULKDATA_SerializeCompressedLZ4				= 1<<7,
 	/** Flag to check if either compression mode is specified						*/
-	BULKDATA_SerializeCompressed				= (BULKDATA_SerializeCompressedZLIB),
+	BULKDATA_SerializeCompressed				= (BULKDATA_SerializeCompressedZLIB | BULKDATA_SerializeCompressedLZ4),
 
 };
 
@@ -230,6 +232,17 @@ struct COREUOBJECT_API FUntypedBulkData
 	 */
 	void GetCopy( void** Dest, bool bDiscardInternalCopy = true );
 
+	/**
+	 * Reads the payload from its file straight into Dest, uncompressing it if it is stored compressed. The bulk data
+	 * itself isn't loaded, so Dest can be locked RHI memory and no intermediate copy is made, e.g. for streaming mips.
+	 *
+	 * @param Dest		Memory of at least GetBulkDataSize() bytes that must stay valid until the request is done
+	 * @param Counter	Thread safe counter decremented when the payload is in Dest, can be nullptr
+	 * @param Priority	Priority of the request
+	 * @return the index of the request to cancel it with, 0 if it couldn't be made
+	 */
+	uint64 LoadIntoAsync( void* Dest, FThreadSafeCounter* Counter, EAsyncIOPriority Priority ) const;
+
 	/**
 	 * Locks the bulk data and returns a pointer to it.
 	 *
@@ -72,12 +72,22 @@ private:
 class COREUOBJECT_API FClassNetCacheMgr
 {
 public:
+	FClassNetCacheMgr() : bThreadSafe( false ) { }
+
 	/** get the cached field to index mappings for the given class */
 	FClassNetCache *	GetClassNetCache( UClass * Class );
 	void				ClearClassNetCache();
 
+	/** Lock the caches while several threads can look them up at once */
+	void				SetThreadSafe( bool bInThreadSafe ) { bThreadSafe = bInThreadSafe; }
+
 private:
+	FClassNetCache *	FindOrCreateClassNetCache( UClass * Class );
+
 	TMap< TWeakObjectPtr< UClass >, FClassNetCache * > ClassFieldIndices;
+
+	FCriticalSection	CacheCS;
+	bool				bThreadSafe;
 };
 
 //
@@ -1203,6 +1203,7 @@ class ULinkerLoad : public ULinker, public FArchiveUObject
 	friend class UObject;
 	friend class UPackageMap;
 	friend struct FAsyncPackage;
+	friend class FAsyncLoadingThread;
 
 	/** Linker loading status. */
 	enum ELinkerStatus
@@ -1326,6 +1327,11 @@ private:
 	/** Used for ActiveClassRedirects functionality */
 	bool					bFixupExportMapDone;
 
+#if USE_ASYNC_LOADING_THREAD
+	/** State of the header serialization on the async loading thread, see EAsyncHeaderState.								*/
+	FThreadSafeCounter		AsyncHeaderState;
+#endif
+
 	/**
 	 * Helper struct to keep track of background file reads
 	 */
@@ -1762,6 +1768,26 @@ private:
 	 */
 	ELinkerStatus Tick( float InTimeLimit, bool bInUseTimeLimit, bool bInUseFullTimeLimit);
 
+#if USE_ASYNC_LOADING_THREAD
+	/** States of the header serialization handed to the async loading thread */
+	enum EAsyncHeaderState
+	{
+		ASYNCHEADER_None,
+		ASYNCHEADER_InFlight,
+		ASYNCHEADER_Done,
+		ASYNCHEADER_Failed,
+	};
+
+	/**
+	 * Serializes the package file summary, name, import and export maps without a time limit.
+	 * Called on the async loading thread, the game thread doesn't touch the linker while the state is ASYNCHEADER_InFlight.
+	 */
+	void SerializeHeaderOnLoadingThread();
+
+	/** Blocks until the async loading thread is done with this linker. */
+	void WaitForAsyncHeader();
+#endif
+
 	/**
 	 * Private constructor, passing arguments through from CreateLinker.
 	 *
@@ -405,6 +405,7 @@ enum EObjectFlags
 	RF_TextExportTransient		=0x00100000,	///< Do not export object to text form (e.g. copy/paste). Generally used for sub-objects that can be regenerated from data in their parent object.
 	RF_LoadCompleted			=0x00200000,	///< Object has been completely serialized by linkerload at least once. DO NOT USE THIS FLAG, It should be replaced with RF_WasLoaded.
 	RF_InheritableComponentTemplate = 0x00400000, ///< Archetype of the object can be in its super class
+	RF_ClusterMember			=0x00800000,	///< Object is part of a GC cluster, see CreateGCCluster. Never serialized.
 
 	// Special all and none masks
 	RF_AllFlags					=0x00ffffff,	///< All flags, used mainly for error checking
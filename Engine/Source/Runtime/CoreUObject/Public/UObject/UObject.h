@@ -528,6 +528,12 @@ public:
 	/** Returns true if this object is safe to add to the root set. */
 	virtual bool IsSafeForRootSet() const;
 
+	/**
+	 * Returns true if this object can be part of a GC cluster. The GC only walks the references a cluster had when it was created,
+	 * so the object must not pick up references to new objects once loaded, or report each one through GCClusterWriteBarrier.
+	 */
+	virtual bool CanBeInCluster() const;
+
 	/** 
 	 * Tags objects that are part of the same asset with the specified object flag, used for GC checking
 	 *
@@ -9,6 +9,8 @@
 #include "HAL/Platform.h"
 
 class UObjectBase;
+class UClass;
+class FPagedFixedSizeAllocator;
 
 class COREUOBJECT_API FUObjectAllocator
 {
@@ -49,14 +51,23 @@ public:
 	}
 
 	/**
-	 * Allocates a UObjectBase from the free store or the permanent object pool
+	 * Makes objects of exactly this class come from a paged pool, so they sit next to each other in memory.
+	 * Must be called from the game thread, before objects are allocated on other threads.
+	 *
+	 * @param Class class whose objects to pool, derived classes are not pooled
+	 */
+	void RegisterPooledClass(const UClass* Class);
+
+	/**
+	 * Allocates a UObjectBase from the free store, the permanent object pool or the pool of its class
 	 *
 	 * @param Size size of uobject to allocate
 	 * @param Alignment alignment of uobject to allocate
 	 * @param bAllowPermanent if true, allow allocation in the permanent object pool, if it fits
+	 * @param Class class of the uobject, used to find its pool if it has one
 	 * @return newly allocated UObjectBase (not really a UObjectBase yet, no constructor like thing has been called).
 	 */
-	UObjectBase* AllocateUObject(int32 Size, int32 Alignment, bool bAllowPermanent);
+	UObjectBase* AllocateUObject(int32 Size, int32 Alignment, bool bAllowPermanent, const UClass* Class = NULL);
 
 	/**
 	 * Returns a UObjectBase to the free store, unless it is in the permanent object pool
@@ -75,6 +86,8 @@ private:
 	uint8*						PermanentObjectPoolTail;
 	/** Tail that exceeded the size of the permanent object pool, >= PermanentObjectPoolTail.		*/
 	uint8*						PermanentObjectPoolExceededTail;
+	/** Pools of the classes registered with RegisterPooledClass.							*/
+	TMap<const UClass*, FPagedFixedSizeAllocator*>	ClassPools;
 };
 
 /** Global UObjectBase allocator							*/
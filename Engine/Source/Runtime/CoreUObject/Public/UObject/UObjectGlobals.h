@@ -263,9 +263,10 @@ struct FAsyncPackage;
  * @param	PackageGuid			GUID of the package to load, or NULL for "don't care"
  * @param	PackageType			A type name associated with this package for later use
  * @param	PackageToLoadFrom	If non-null, this is another package name. We load from this package name, into a (probably new) package named PackageName
+ * @param	PackagePriority		Higher priority requests are processed first, see SetAsyncLoadPriority
  * @return	Handle for this async loading request
  */
-COREUOBJECT_API FAsyncPackage& LoadPackageAsync( const FString& PackageName, FLoadPackageAsyncDelegate CompletionDelegate, const FGuid* RequiredGuid = NULL, FName PackageType = NAME_None, const TCHAR* PackageToLoadFrom = NULL );
+COREUOBJECT_API FAsyncPackage& LoadPackageAsync( const FString& PackageName, FLoadPackageAsyncDelegate CompletionDelegate, const FGuid* RequiredGuid = NULL, FName PackageType = NAME_None, const TCHAR* PackageToLoadFrom = NULL, int32 PackagePriority = 0 );
 
 /**
  * Asynchronously load a package and all contained objects that match context flags. Non- blocking.
@@ -274,9 +275,28 @@ COREUOBJECT_API FAsyncPackage& LoadPackageAsync( const FString& PackageName, FLo
  * @param	PackageGuid			GUID of the package to load, or NULL for "don't care"
  * @param	PackageType			A type name associated with this package for later use
  * @param	PackageToLoadFrom	If non-null, this is another package name. We load from this package name, into a (probably new) package named PackageName
+ * @param	PackagePriority		Higher priority requests are processed first, see SetAsyncLoadPriority
  * @return	Handle for this async loading request
  */
-COREUOBJECT_API FAsyncPackage& LoadPackageAsync( const FString& PackageName, const FGuid* RequiredGuid = NULL, FName PackageType = NAME_None, const TCHAR* PackageToLoadFrom = NULL );
+COREUOBJECT_API FAsyncPackage& LoadPackageAsync( const FString& PackageName, const FGuid* RequiredGuid = NULL, FName PackageType = NAME_None, const TCHAR* PackageToLoadFrom = NULL, int32 PackagePriority = 0 );
+
+/**
+ * Changes the priority of a package in flight. The packages it's waiting for are raised to the same priority.
+ *
+ * @param	PackageName			Name of the package
+ * @param	PackagePriority		New priority, higher priorities are processed first
+ * @return	false if the package isn't being async loaded
+ */
+COREUOBJECT_API bool SetAsyncLoadPriority( const FName& PackageName, int32 PackagePriority );
+
+/**
+ * Cancels the async load of a package that isn't needed anymore. Its linker, outstanding reads and imports nobody else
+ * needs are released, and the completion delegates are called with a null package.
+ *
+ * @param	PackageName			Name of the package
+ * @return	false if the package isn't being async loaded or is too far along (creating its objects, or imported by another package)
+ */
+COREUOBJECT_API bool CancelAsyncLoading( const FName& PackageName );
 
 /**
  * Returns the async load percentage for a package in flight with the passed in name or -1 if there isn't one.
@@ -293,6 +313,68 @@ COREUOBJECT_API float GetAsyncLoadPercentage( const FName& PackageName );
  * @param	bPerformFullPurge	if true, perform a full purge after the mark pass
  */
 COREUOBJECT_API void CollectGarbage( EObjectFlags KeepFlags, bool bPerformFullPurge = true );
+
+/**
+ * Same as CollectGarbage, but the reachability analysis is spread over several calls. The first call marks the roots,
+ * the following ones walk the references until TimeLimit is used up, and the call that runs out of references to walk
+ * unhashes the unreachable objects. Call it every frame until it returns true, a CollectGarbage call in between
+ * finishes the walk right away.
+ *
+ * References stored through UObjectProperty go through a write barrier while the walk is in flight. Native pointers
+ * assigned outside of AddReferencedObjects are only picked up if the root set still reaches them at the end.
+ *
+ * @param	KeepFlags			objects with those flags will be kept regardless of being referenced or not, only used by the first call
+ * @param	TimeLimit			soft time limit for walking references in this call, 0 for no limit
+ * @param	bPerformFullPurge	if true, perform a full purge once the mark pass is done
+ * @return	true if the collection finished on this call
+ */
+COREUOBJECT_API bool CollectGarbageIncremental( EObjectFlags KeepFlags, float TimeLimit, bool bPerformFullPurge = false );
+
+/**
+ * Returns whether an incremental garbage collection has been started and the reachability analysis isn't done yet.
+ */
+COREUOBJECT_API bool IsIncrementalReachabilityPending();
+
+/**
+ * Groups the objects inside ClusterRoot that can be in a cluster (see UObject::CanBeInCluster) into a GC cluster. The
+ * cluster is kept alive as a whole while the root or any member is referenced and released as a whole otherwise.
+ * The GC no longer walks the members, only what they referenced when the cluster was created, so a member picking up a
+ * reference to another object afterwards must report it through GCClusterWriteBarrier. A member becoming pending kill
+ * dissolves the cluster.
+ *
+ * @param	ClusterRoot		usually a package
+ * @return	true if a cluster was created
+ */
+COREUOBJECT_API bool CreateGCCluster( UObject* ClusterRoot );
+
+/**
+ * Turns the cluster the passed in object belongs to back into regular objects, e.g. before changing its references.
+ */
+COREUOBJECT_API void DissolveGCCluster( UObject* ClusterObject );
+
+/**
+ * Write barrier for GC clusters, call it when ClusterObject stores a strong reference to Object after it was loaded.
+ * If ClusterObject is part of a cluster, Object is added to the references the GC walks for it so it's kept alive with
+ * the cluster. References that are dropped again stay in the cluster until it's released or dissolved.
+ */
+COREUOBJECT_API void GCClusterWriteBarrier( UObject* ClusterObject, UObject* Object );
+
+/** Set while an incremental reachability analysis is in flight */
+extern COREUOBJECT_API bool GIsIncrementalReachabilityPending;
+
+COREUOBJECT_API void IncrementalReachabilityWriteBarrierInternal( UObject* Object );
+
+/**
+ * Write barrier for the incremental garbage collector, call it with the object when storing a strong reference
+ * the collector may have already walked past.
+ */
+FORCEINLINE void IncrementalReachabilityWriteBarrier( UObject* Object )
+{
+	if( GIsIncrementalReachabilityPending && Object )
+	{
+		IncrementalReachabilityWriteBarrierInternal( Object );
+	}
+}
 COREUOBJECT_API void SerializeRootSet( FArchive& Ar, EObjectFlags KeepFlags );
 
 /**
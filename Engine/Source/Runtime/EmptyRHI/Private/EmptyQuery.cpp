@@ -37,11 +37,13 @@ FRenderQueryRHIRef FEmptyDynamicRHI::RHICreateRenderQuery(ERenderQueryType Query
 	return new FEmptyRenderQuery(QueryType);
 }
 
+#if !PLATFORM_SUPPORTS_RHI_THREAD
 void FEmptyDynamicRHI::RHIResetRenderQuery(FRenderQueryRHIParamRef QueryRHI)
 {
 	DYNAMIC_CAST_EMPTYRESOURCE(RenderQuery,Query);
 
 }
+#endif
 
 bool FEmptyDynamicRHI::RHIGetRenderQueryResult(FRenderQueryRHIParamRef QueryRHI,uint64& OutNumPixels,bool bWait)
 {
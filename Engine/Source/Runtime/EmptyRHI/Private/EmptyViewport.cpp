@@ -60,6 +60,12 @@ bool FEmptyDynamicRHI::RHIIsDrawingViewport()
 	return true;
 }
 
+#if PLATFORM_SUPPORTS_RHI_THREAD
+void FEmptyDynamicRHI::RHIAdvanceFrameForGetViewportBackBuffer()
+{
+}
+#endif
+
 FTexture2DRHIRef FEmptyDynamicRHI::RHIGetViewportBackBuffer(FViewportRHIParamRef ViewportRHI)
 {
 	DYNAMIC_CAST_EMPTYRESOURCE(Viewport,Viewport);
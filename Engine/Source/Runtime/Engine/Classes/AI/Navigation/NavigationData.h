@@ -806,10 +806,12 @@ struct FAsyncPathFindingQuery : public FPathFindingQuery
 	const uint32 QueryID;
 	const FNavPathQueryDelegate OnDoneDelegate;
 	const TEnumAsByte<EPathFindingMode::Type> Mode;
+	TEnumAsByte<EAsyncPathQueryPriority::Type> Priority;
 	FPathFindingResult Result;
 
 	FAsyncPathFindingQuery()
 		: QueryID(INVALID_NAVQUERYID)
+		, Priority(EAsyncPathQueryPriority::Normal)
 	{ }
 
 	FAsyncPathFindingQuery(const UObject* InOwner, const ANavigationData* InNavData, const FVector& Start, const FVector& End, const FNavPathQueryDelegate& Delegate, TSharedPtr<const FNavigationQueryFilter> SourceQueryFilter);
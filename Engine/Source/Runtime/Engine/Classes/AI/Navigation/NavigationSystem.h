@@ -181,6 +181,15 @@ public:
 	UPROPERTY(config, EditAnywhere, Category=NavigationSystem)
 	float DirtyAreasUpdateFreq;
 
+	/** max number of tasks each frame's async path finding queries are split across */
+	UPROPERTY(config, EditAnywhere, Category=NavigationSystem, meta=(ClampMin="1"))
+	int32 MaxAsyncPathfindingWorkers;
+
+	/** time (in ms) async path finding queries can take each frame, shared by all workers. 
+	 *	Queries that don't fit wait for next frame, higher priority ones are run first. 0 means no limit */
+	UPROPERTY(config, EditAnywhere, Category=NavigationSystem, meta=(ClampMin="0.0"))
+	float AsyncPathfindingTimeBudget;
+
 	UPROPERTY()
 	TArray<ANavigationData*> NavDataSet;
 
@@ -341,9 +350,10 @@ public:
 	 *	@param PathToFill if points to an actual navigation path instance than this instance will be filled with resulting path. Otherwise a new instance will be created and 
 	 *		used in call to ResultDelegate
 	 *  @param Mode switch between normal and hierarchical path finding algorithms
+	 *	@param Priority queries with higher priority are run first when AsyncPathfindingTimeBudget doesn't cover all of them
 	 *	@return request ID
 	 */
-	uint32 FindPathAsync(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate, EPathFindingMode::Type Mode = EPathFindingMode::Regular);
+	uint32 FindPathAsync(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate, EPathFindingMode::Type Mode = EPathFindingMode::Regular, EAsyncPathQueryPriority::Type Priority = EAsyncPathQueryPriority::Normal);
 
 	/** Removes query indicated by given ID from queue of path finding requests to process. */
 	void AbortAsyncFindPathRequest(uint32 AsynPathQueryID);
@@ -812,11 +822,15 @@ private:
 	/** Adds given request to requests queue. Note it's to be called only on game thread only */
 	void AddAsyncQuery(const FAsyncPathFindingQuery& Query);
 		 
-	/** spawns a non-game-thread task to process requests given in PathFindingQueries.
+	/** spawns up to MaxAsyncPathfindingWorkers non-game-thread tasks to process requests given in PathFindingQueries.
 	 *	In the process PathFindingQueries gets copied. */
 	void TriggerAsyncQueries(TArray<FAsyncPathFindingQuery>& PathFindingQueries);
 
-	/** Processes pathfinding requests given in PathFindingQueries.*/
-	void PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries);
+	/** Processes pathfinding requests given in PathFindingQueries, in order. 
+	 *	Queries left when TimeBudget (ms, 0 for no limit) runs out are given back to game thread with PostponeAsyncQueries */
+	void PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries, float TimeBudget);
+
+	/** Puts queries that didn't fit in last frame's budget back at the front of the queue. Game thread only */
+	void PostponeAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries);
 };
 
@@ -476,6 +476,19 @@ namespace EPathFindingMode
 	};
 };
 
+/** Order async path finding queries are run in, when they don't all fit in the frame's time budget */
+namespace EAsyncPathQueryPriority
+{
+	enum Type
+	{
+		Low,
+		Normal,
+		High,
+
+		MAX
+	};
+};
+
 /**
 *	Delegate used to communicate that path finding query has been finished.
 *	@param uint32 unique Query ID of given query
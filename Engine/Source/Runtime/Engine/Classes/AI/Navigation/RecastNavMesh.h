@@ -552,6 +552,20 @@ class ENGINE_API ARecastNavMesh : public ANavigationData
 	UPROPERTY(EditAnywhere, Category = Generation, config, AdvancedDisplay)
 	uint32 bMarkLowHeightAreas : 1;
 
+	/** upper limit of tiles built at the same time. The actual number scales with the worker threads available, this only caps it */
+	UPROPERTY(EditAnywhere, Category = Generation, config, AdvancedDisplay, meta = (ClampMin = "1"))
+	int32 MaxSimultaneousTileGenerationJobsCount;
+
+	/** time (in ms) the game thread can spend each frame starting tile builds and adding built tiles to the navmesh. 
+	 *	At least one tile is started and one added per frame. 0 means no limit */
+	UPROPERTY(EditAnywhere, Category = Generation, config, AdvancedDisplay, meta = (ClampMin = "0.0"))
+	float TileProcessingTimeBudget;
+
+	/** dedicated servers only: tiles of streamed in levels are kept in the level's navmesh data chunk while all players
+	 *	are further than this from the level's navigable bounds, and attached back when one comes closer. 0 keeps all streamed in tiles attached */
+	UPROPERTY(EditAnywhere, Category = Runtime, config, meta = (ClampMin = "0.0"))
+	float TileResidencyDistance;
+
 	/** TODO: switch to disable new code from OffsetFromCorners if necessary - remove it later */
 	UPROPERTY(config)
 	uint32 bUseBetterOffsetsFromCorners : 1;
@@ -669,6 +683,7 @@ public:
 
 	virtual void OnStreamingLevelAdded(ULevel* InLevel) override;
 	virtual void OnStreamingLevelRemoved(ULevel* InLevel) override;
+	virtual void TickActor(float DeltaTime, enum ELevelTick TickType, FActorTickFunction& ThisTickFunction) override;
 	// End ANavigationData Interface
 
 protected:
@@ -838,6 +853,8 @@ public:
 	
 	// @todo docuement
 	static FPathFindingResult FindPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query);
+	/** FindPath refining a path found on cluster graph first, long paths visit much less nodes but are only optimal within the clusters along the way */
+	static FPathFindingResult FindHierarchicalPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query);
 	static bool TestPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query, int32* NumVisitedNodes);
 	static bool TestHierarchicalPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query, int32* NumVisitedNodes);
 	static bool NavMeshRaycast(const ANavigationData* Self, const FVector& RayStart, const FVector& RayEnd, FVector& HitLocation, TSharedPtr<const FNavigationQueryFilter> QueryFilter, const UObject* Querier, FRaycastResult& Result);
@@ -886,6 +903,12 @@ private:
 	/** @return Navmesh data chunk that belongs to this actor */
 	URecastNavMeshDataChunk* GetNavigationDataChunk(ULevel* InLevel) const;
 
+	/** attaches or detaches tiles of streamed in levels depending on players distance, see TileResidencyDistance */
+	void UpdateTileResidency();
+
+	/** shared by FindPath and FindHierarchicalPath */
+	static FPathFindingResult FindPathInternal(const FPathFindingQuery& Query, bool bUseClusterGraph);
+
 protected:
 	// retrieves RecastNavMeshImpl
 	FPImplRecastNavMesh* GetRecastNavMeshImpl() { return RecastNavMeshImpl; }
@@ -902,6 +925,12 @@ private:
 	 *	@TODO since it's no secret we're using recast there's no point in having separate implementation class. FPImplRecastNavMesh should be merged into ARecastNavMesh
 	 */
 	FPImplRecastNavMesh* RecastNavMeshImpl;
+
+	/** streamed in levels whose tiles are currently held by their data chunk instead of the navmesh */
+	TArray<TWeakObjectPtr<ULevel> > NonResidentLevels;
+
+	/** time left until next UpdateTileResidency call */
+	float TileResidencyUpdateTimeLeft;
 	
 #if RECAST_ASYNC_REBUILDING
 	/** batch query counter */
@@ -271,6 +271,13 @@ class ENGINE_API UAnimInstance : public UObject
 	UPROPERTY(Category = RootMotion, EditDefaultsOnly)
 	TEnumAsByte<ERootMotionMode::Type> RootMotionMode;
 
+	/**
+	 * If true, the graph update runs on the animation evaluation task instead of the game thread, after the native and blueprint update (see a.ParallelAnimUpdate).
+	 * The node input bindings and custom native nodes must then only read values of the instance, like the ones copied in NativeUpdateAnimation or BlueprintUpdateAnimation.
+	 */
+	UPROPERTY(Category = Optimization, EditDefaultsOnly)
+	uint32 bUseParallelGraphUpdate:1;
+
 public:
 
 	// @todo document
@@ -554,6 +561,19 @@ public:
 	void InitializeAnimation();
 	void UpdateAnimation(float DeltaSeconds);
 
+	/**
+	 * The parts of UpdateAnimation, for callers that run the graph update on another thread.
+	 * PreUpdateAnimation runs the native and blueprint update on the game thread, and returns false if the rest of the update is skipped.
+	 * UpdateAnimationGraph updates the nodes and ticks the asset players, it only touches this instance.
+	 * Montage_Advance and PostUpdateAnimation (notifies, curves to clear) then have to run on the game thread.
+	 */
+	bool PreUpdateAnimation(float DeltaSeconds);
+	void UpdateAnimationGraph(float DeltaSeconds);
+	void PostUpdateAnimation(float DeltaSeconds);
+
+	/** Returns true if UpdateAnimationGraph can run off the game thread */
+	bool CanUpdateAnimationGraphInParallel() const;
+
 	// Native initialization override point
 	virtual void NativeInitializeAnimation();
 
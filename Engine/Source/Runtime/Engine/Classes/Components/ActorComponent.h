@@ -488,6 +488,8 @@ public:
 	virtual void BeginDestroy() override;
 	virtual bool NeedsLoadForClient() const override;
 	virtual bool NeedsLoadForServer() const override;
+	/** Only native, non replicated components of actors that can be in a cluster, see AActor::CanBeInCluster. */
+	virtual bool CanBeInCluster() const override;
 	virtual int32 GetFunctionCallspace( UFunction* Function, void* Parameters, FFrame* Stack ) override;
 	virtual bool CallRemoteFunction( UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack ) override;
 	virtual void PostInitProperties() override;
@@ -70,6 +70,9 @@ class ENGINE_API UHierarchicalInstancedStaticMeshComponent : public UInstancedSt
 	UPROPERTY()
 	FBox UnbuiltInstanceBounds;
 
+	// Number of instances added, removed or moved in the tree without rebuilding it. Each edit loosens the tree, it is rebuilt async once they are too many.
+	int32 NumIncrementalEdits;
+
 	bool bIsAsyncBuilding;
 	bool bConcurrentRemoval;
 
@@ -79,6 +82,13 @@ class ENGINE_API UHierarchicalInstancedStaticMeshComponent : public UInstancedSt
 	// Apply the results of the async build
 	void ApplyBuildTreeAsync(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent, TSharedRef<FClusterBuilder, ESPMode::ThreadSafe> Builder, double StartTime);
 
+	// Whether the next add, remove or move can be applied to the current tree instead of rebuilding it
+	bool CanEditTreeIncrementally() const;
+	// Inserts the last added instance in the leaf whose bounds grow the least
+	void InsertInstanceIntoTree(int32 InstanceIndex);
+	// Grows the bounds of the clusters containing the instance to its current transform
+	void RefitTreeForInstance(int32 InstanceIndex);
+
 public:
 	virtual void Serialize(FArchive& Ar) override;
 	virtual FPrimitiveSceneProxy* CreateSceneProxy() override;
@@ -110,7 +120,7 @@ public:
 		);
 	void BuildFlatTree(const TArray<int32>& LeafInstanceCounts);
 	bool IsAsyncBuilding() const { return bIsAsyncBuilding; }
-	bool IsTreeFullyBuilt() const { return NumBuiltInstances == PerInstanceSMData.Num() && RemovedInstances.Num() == 0; }
+	bool IsTreeFullyBuilt() const { return NumBuiltInstances == PerInstanceSMData.Num() + RemovedInstances.Num(); }
 
 protected:
 	virtual void GetNavigationPerInstanceTransforms(const FBox& AreaBox, TArray<FTransform>& InstanceData) const override;
@@ -157,6 +157,11 @@ public:
 	virtual bool DoCustomNavigableGeometryExport(struct FNavigableGeometryExport* GeomExport) const override;
 	// End UPrimitiveComponent Interface
 
+	// Begin UStaticMeshComponent Interface
+	/** The instanced render data is built from all the LODs of the mesh. */
+	virtual bool SupportsStreamedLODs() const override { return false; }
+	// End UStaticMeshComponent Interface
+
 	//Begin UObject Interface
 	virtual void Serialize(FArchive& Ar) override;
 	virtual SIZE_T GetResourceSize(EResourceSizeMode::Type Mode) override;
@@ -40,6 +40,13 @@ public:
 		ParticleAllocation = NumExpectedParticles;
 	}
 
+	/** Sizes the previous buffer like the current one, dropping its content. The kill compaction copies the live particles into it */
+	void AllocatePreviousBuffer()
+	{
+		ParticleBuffers[CurrentBuffer ^ 0x1].Reset(ParticleAllocation * AttrMap.Num());
+		ParticleBuffers[CurrentBuffer ^ 0x1].AddUninitialized(ParticleAllocation * AttrMap.Num());
+	}
+
 	const FVector4 *GetAttributeData(FName Name) const
 	{
 		int32 Offset = AttrMap[Name] * ParticleAllocation;
@@ -35,6 +35,13 @@ struct FAnimationEvaluationContext
 	// Are we storing data in cache bones this tick
 	bool bDuplicateToCacheBones;
 
+	// Are we updating the anim graph before evaluating this tick
+	bool bDoUpdate;
+	float UpdateDeltaTime;
+
+	// Copy of the component morph target curves, applied over the ones of the graph update
+	TMap<FName, float> MorphTargetCurves;
+
 	FAnimationEvaluationContext()
 	{
 		Clear();
@@ -44,6 +51,7 @@ struct FAnimationEvaluationContext
 	{
 		AnimInstance = NULL;
 		SkeletalMesh = NULL;
+		bDoUpdate = false;
 	}
 
 };
@@ -450,6 +458,13 @@ public:
 	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Animation)
 	uint32 bPauseAnims:1;
 
+	/**
+	 * When playing a single sequence, share its evaluated pose with the other meshes of the same skeletal mesh and LOD playing it at about the same time.
+	 * The time is snapped to a.SharedPoseTimeStep, meant for crowds where the difference doesn't show.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Animation)
+	uint32 bSharePoseEvaluation:1;
+
 	/**
 	* Uses skinned data for collision data.
 	*/
@@ -1158,25 +1173,29 @@ private:
 	//Data for parallel evaluation of animation
 	FAnimationEvaluationContext AnimEvaluationContext;
 
+	/** Set during TickComponent, when TickAnimation can leave the graph update to RefreshBoneTransforms */
+	bool bDeferAnimGraphUpdate;
+
+	/** TickAnimation left the graph update of this tick to RefreshBoneTransforms */
+	bool bPendingAnimGraphUpdate;
+	float PendingAnimGraphUpdateDeltaTime;
+
+	/** Runs the graph update left by TickAnimation, and the game thread work that follows it */
+	void FinishPendingAnimGraphUpdate();
+
+	/** Game thread work of TickAnimation once the graph is updated */
+	void PostAnimGraphUpdate(float DeltaTime);
+
+	/** Sets the material parameters driven by the curves of the anim instance */
+	void UpdateAnimMaterialParameters();
+
+	/** Whether anything on a dedicated server reads the bone transforms: collision bodies, attached components or slave components */
+	bool NeedsBoneTransformsOnDedicatedServer() const;
+
 public:
 	// Parallel evaluation wrappers
-	void ParallelAnimationEvaluation() { PerformAnimationEvaluation(AnimEvaluationContext.SkeletalMesh, AnimEvaluationContext.AnimInstance, AnimEvaluationContext.SpaceBases, AnimEvaluationContext.LocalAtoms, AnimEvaluationContext.VertexAnims, AnimEvaluationContext.RootBoneTranslation); }
-	void CompleteParallelAnimationEvaluation()
-	{
-		if ((AnimEvaluationContext.AnimInstance == AnimScriptInstance) && (AnimEvaluationContext.SkeletalMesh == SkeletalMesh) && (AnimEvaluationContext.SpaceBases.Num() == GetNumSpaceBases()))
-		{
-			Exchange(AnimEvaluationContext.SpaceBases, AnimEvaluationContext.bDoInterpolation ? CachedSpaceBases : GetEditableSpaceBases() );
-			Exchange(AnimEvaluationContext.LocalAtoms, AnimEvaluationContext.bDoInterpolation ? CachedLocalAtoms : LocalAtoms);
-			Exchange(AnimEvaluationContext.VertexAnims, ActiveVertexAnims);
-			Exchange(AnimEvaluationContext.RootBoneTranslation, RootBoneTranslation);
-
-			PostAnimEvaluation(AnimEvaluationContext);
-		}
-		else
-		{
-			AnimEvaluationContext.Clear();
-		}
-	}
+	void ParallelAnimationEvaluation();
+	void CompleteParallelAnimationEvaluation();
 
 	friend class FSkeletalMeshComponentDetails;
 
@@ -146,6 +146,8 @@ class ENGINE_API USplineMeshComponent : public UStaticMeshComponent, public IInt
 
 	//Begin UStaticMeshComponent Interface
 	virtual class FStaticMeshStaticLightingMesh* AllocateStaticLightingMesh(int32 LODIndex, const TArray<ULightComponent*>& InRelevantLights);
+	/** The spline mesh proxy sets up the vertex factories of all the LODs. */
+	virtual bool SupportsStreamedLODs() const override { return false; }
 	//End UStaticMeshComponent Interface
 
 	// Begin Interface_CollisionDataProvider Interface
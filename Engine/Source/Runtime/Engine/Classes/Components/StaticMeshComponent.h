@@ -311,6 +311,15 @@ public:
 	 */
 	virtual bool HasLightmapTextureCoordinates() const;
 
+	/**
+	 *	Returns true if the component can render a static mesh whose first LODs are streamed out, see UStaticMesh::bStreamLODs.
+	 *	If not, the component keeps all the LODs of its static mesh loaded.
+	 */
+	virtual bool SupportsStreamedLODs() const
+	{
+		return true;
+	}
+
 	/**
 	 *	Get the memory used for texture-based light and shadow maps of the given width and height
 	 *
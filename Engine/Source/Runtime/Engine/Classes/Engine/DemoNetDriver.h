@@ -15,9 +15,33 @@ class UDemoNetDriver : public UNetDriver
 	/** Name of the file to read/write from */
 	FString				DemoFilename;
 
-	/** Handle to the archive that will read/write network packets */
+	/** Handle to the archive that will read/write network packets, over ChunkData */
 	FArchive*			FileAr;
 
+	/** Frames of the chunk being recorded or played back */
+	TArray< uint8 >		ChunkData;
+
+	/** Writes the recorded chunks to the demo file on a background thread */
+	class FDemoStreamWriter*	StreamWriter;
+
+	/** Reads the chunks of the demo file being played back */
+	class FDemoStreamReader*	StreamReader;
+
+	/** During playback, index of the chunk in ChunkData */
+	int32				CurrentChunkIndex;
+
+	/** During recording, demo time of the first frame in ChunkData */
+	float				ChunkStartTime;
+
+	/** During recording, demo time of the last checkpoint */
+	float				LastCheckpointTime;
+
+	/** Connection that replicates the full state of the demo connection while a checkpoint is saved */
+	UNetConnection*		CheckpointConnection;
+
+	/** Packets of the checkpoint being saved or loaded */
+	TArray< uint8 >		CheckpointData;
+
 	/** Current record/playback frame number */
 	int32				DemoFrameNum;
 
@@ -83,4 +107,20 @@ class UDemoNetDriver : public UNetDriver
 	void ResetDemoState();
 
 	void StopDemo();
+
+	/** Jumps playback to a time, starting from the last checkpoint before it */
+	void GotoTimeInSeconds( float TimeInSeconds );
+
+protected:
+	/** Hands the recorded frames over to the stream writer */
+	void FlushRecordedChunk();
+
+	/** Saves the state of every open channel of the demo connection, so playback can start from this point */
+	void SaveCheckpoint();
+
+	/** Rebuilds the playback state from CheckpointData on a new server connection. Returns false if the checkpoint is corrupt */
+	bool LoadCheckpoint();
+
+	/** Loads the next chunk of frames into ChunkData. Returns false at the end of the stream */
+	bool ReadNextChunk();
 };
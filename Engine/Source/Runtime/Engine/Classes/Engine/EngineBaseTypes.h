@@ -157,9 +157,25 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category="Tick", AdvancedDisplay)
 	uint32 bAllowTickOnDedicatedServer:1;
 
-	/** If false, this tick will run on the game thread, otherwise it will run on any thread in parallel with the game thread and in parallel with other "async ticks" **/
+	/** 
+	 * If false, this tick will run on the game thread, otherwise it will run on any thread in parallel with the game thread and in parallel with other "async ticks".
+	 * A tick running on any thread may only modify its own target, and only read the targets of its prerequisites. It must not create, destroy,
+	 * move or register objects, or run blueprint code. Ticks moved to a later tick group by their prerequisites still run on the game thread.
+	 **/
+	UPROPERTY(EditDefaultsOnly, Category="Tick", AdvancedDisplay)
 	uint32 bRunOnAnyThread:1;
 
+	/**
+	 * If true, and this tick function has no prerequisites, it may be ticked in one task with the other tick functions of the same class
+	 * and tick group, instead of a task of its own. The ticks in a batch run one after the other, in no particular order.
+	 **/
+	UPROPERTY(EditDefaultsOnly, Category="Tick", AdvancedDisplay)
+	uint32 bAllowTickBatching:1;
+
+	/** Minimum time between two ticks of this function, 0 to tick every frame. The tick is given the time elapsed since the last one. **/
+	UPROPERTY(EditDefaultsOnly, Category="Tick", meta=(DisplayName="Tick Interval (secs)", ClampMin="0.0"))
+	float TickInterval;
+
 private:
 	/** If true, means that this tick function is in the master array of tick functions **/
 	uint32 bRegistered:1;
@@ -176,6 +192,12 @@ private:
 	/** Internal data to track if we have finshed visiting this tick function yet this frame **/
 	int32 TickQueuedGFrameCounter;
 
+	/** Time elapsed since the last tick, when it is shorter than TickInterval **/
+	float TickIntervalElapsedTime;
+
+	/** Delta time the tick function is executed with this frame **/
+	float TickDeltaSeconds;
+
 protected:
 	/** Internal data that indicates the tick group we actually executed in (it may have been delayed due to prerequisites) **/
 	TEnumAsByte<enum ETickingGroup> ActualTickGroup;
@@ -277,6 +299,19 @@ private:
 	*/
 	void QueueTickFunctionParallel(const FTickContext& TickContext, TArray<FTickFunction*, TInlineAllocator<4> >& StackForCycleDetection);
 
+	/**
+	 * Checks the tick interval, and sets the delta time of the tick if it is due this frame
+	 * @param DeltaSeconds - frame time
+	 * @return true if the tick function ticks this frame
+	 */
+	bool UpdateTickInterval(float DeltaSeconds);
+
+	/** Returns the class the tick function is batched with when bAllowTickBatching is set, or NULL if it can't be batched **/
+	virtual UClass* GetTickBatchClass()
+	{
+		return NULL;
+	}
+
 	/** 
 	 * Abstract function actually execute the tick. 
 	 * @param DeltaTime - frame time to advance, in seconds
@@ -330,6 +365,8 @@ struct FActorTickFunction : public FTickFunction
 	ENGINE_API virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
 	/** Abstract function to describe this tick. Used to print messages about illegal cycles in the dependency graph **/
 	ENGINE_API virtual FString DiagnosticMessage();
+	/** Batches the tick with the other ticks of the same target class **/
+	ENGINE_API virtual UClass* GetTickBatchClass() override;
 };
 
 template<>
@@ -362,6 +399,8 @@ struct FActorComponentTickFunction : public FTickFunction
 	ENGINE_API virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
 	/** Abstract function to describe this tick. Used to print messages about illegal cycles in the dependency graph **/
 	ENGINE_API virtual FString DiagnosticMessage();
+	/** Batches the tick with the other ticks of the same target class **/
+	ENGINE_API virtual UClass* GetTickBatchClass() override;
 };
 
 
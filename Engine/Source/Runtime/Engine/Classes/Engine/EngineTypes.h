@@ -2249,6 +2249,23 @@ namespace EEndPlayReason
 
 DECLARE_DYNAMIC_DELEGATE(FTimerDynamicDelegate);
 
+/** Precision a replicated vector is rounded to. Lower precisions take less bits on the wire */
+UENUM()
+enum class EVectorQuantization : uint8
+{
+	RoundWholeNumber,		// Rounded to the nearest whole number
+	RoundOneDecimal,		// Rounded to one decimal place
+	RoundTwoDecimals,		// Rounded to two decimal places
+};
+
+/** Precision a replicated rotator is rounded to */
+UENUM()
+enum class ERotatorQuantization : uint8
+{
+	ByteComponents,			// Each axis is sent as a byte (about 1.4 degrees)
+	ShortComponents,		// Each axis is sent as a short (about 0.0055 degrees)
+};
+
 /** Replicated movement data of our RootComponent.
   * Struct used for efficient replication as velocity and location are generally replicated together (this saves a repindex) 
   * and velocity.Z is commonly zero (most position replications are for walking pawns). 
@@ -2278,6 +2295,18 @@ struct FRepMovement
 	UPROPERTY()
 	uint8 bRepPhysics : 1;
 
+	/** Precision of the replicated location. Not replicated, both ends use the value of the class defaults */
+	UPROPERTY(EditDefaultsOnly, Category=Replication, AdvancedDisplay)
+	EVectorQuantization LocationQuantizationLevel;
+
+	/** Precision of the replicated linear and angular velocity */
+	UPROPERTY(EditDefaultsOnly, Category=Replication, AdvancedDisplay)
+	EVectorQuantization VelocityQuantizationLevel;
+
+	/** Precision of the replicated rotation */
+	UPROPERTY(EditDefaultsOnly, Category=Replication, AdvancedDisplay)
+	ERotatorQuantization RotationQuantizationLevel;
+
 	FRepMovement()
 		: LinearVelocity(ForceInit)
 		, AngularVelocity(ForceInit)
@@ -2285,8 +2314,44 @@ struct FRepMovement
 		, Rotation(ForceInit)
 		, bSimulatedPhysicSleep(false)
 		, bRepPhysics(false)
+		, LocationQuantizationLevel(EVectorQuantization::RoundTwoDecimals)
+		, VelocityQuantizationLevel(EVectorQuantization::RoundTwoDecimals)
+		, RotationQuantizationLevel(ERotatorQuantization::ShortComponents)
 	{}
 
+	/** Returns the factor vectors are multiplied by before being rounded to integers for a quantization level */
+	static int32 GetQuantizationScale(EVectorQuantization QuantizationLevel)
+	{
+		switch (QuantizationLevel)
+		{
+			case EVectorQuantization::RoundWholeNumber:	return 1;
+			case EVectorQuantization::RoundOneDecimal:	return 10;
+			default:									return 100;
+		}
+	}
+
+	static bool SerializeQuantizedVector(FArchive& Ar, FVector& Vector, EVectorQuantization QuantizationLevel)
+	{
+		switch (QuantizationLevel)
+		{
+			case EVectorQuantization::RoundWholeNumber:	return SerializePackedVector<1, 20>(Vector, Ar);
+			case EVectorQuantization::RoundOneDecimal:	return SerializePackedVector<10, 24>(Vector, Ar);
+			default:									return SerializePackedVector<100, 30>(Vector, Ar);
+		}
+	}
+
+	static void SerializeQuantizedRotator(FArchive& Ar, FRotator& Rotator, ERotatorQuantization QuantizationLevel)
+	{
+		if (QuantizationLevel == ERotatorQuantization::ByteComponents)
+		{
+			Rotator.SerializeCompressed(Ar);
+		}
+		else
+		{
+			Rotator.SerializeCompressedShort(Ar);
+		}
+	}
+
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 	{
 		// pack bitfield with flags
@@ -2297,21 +2362,15 @@ struct FRepMovement
 
 		bOutSuccess = true;
 
-		bool bOutSuccessLocal = true;
-
 		// update location, linear velocity
-		Location.NetSerialize( Ar, Map, bOutSuccessLocal );
-		bOutSuccess &= bOutSuccessLocal;
-		Rotation.NetSerialize( Ar, Map, bOutSuccessLocal );
-		bOutSuccess &= bOutSuccessLocal;
-		LinearVelocity.NetSerialize( Ar, Map, bOutSuccessLocal );
-		bOutSuccess &= bOutSuccessLocal;
+		bOutSuccess &= SerializeQuantizedVector( Ar, Location, LocationQuantizationLevel );
+		SerializeQuantizedRotator( Ar, Rotation, RotationQuantizationLevel );
+		bOutSuccess &= SerializeQuantizedVector( Ar, LinearVelocity, VelocityQuantizationLevel );
 
 		// update angular velocity if required
 		if ( bRepPhysics )
 		{
-			AngularVelocity.NetSerialize( Ar, Map, bOutSuccessLocal );
-			bOutSuccess &= bOutSuccessLocal;
+			bOutSuccess &= SerializeQuantizedVector( Ar, AngularVelocity, VelocityQuantizationLevel );
 		}
 
 		return true;
@@ -534,8 +534,9 @@ public:
 	 *
 	 * @param NumComponentsToUpdate		Number of components to update in this run, 0 for all
 	 * @param bRerunConstructionScripts	If we want to rerun construction scripts on actors in level
+	 * @return							Number of components registered in this run
 	 */
-	void IncrementalUpdateComponents( int32 NumComponentsToUpdate, bool bRerunConstructionScripts );
+	int32 IncrementalUpdateComponents( int32 NumComponentsToUpdate, bool bRerunConstructionScripts );
 
 	/**
 	 * Invalidates the cached data used to render the level's UModel.
@@ -153,6 +153,9 @@ class ULevelStreaming : public UObject
 	/** Requested LOD */
 	int32 LevelLODIndex;
 
+	/** Priority of the async load request for this level, levels with a higher priority are loaded first */
+	int32 LoadPriority;
+
 	// Begin UObject Interface
 	virtual void PostLoad() override;
 	virtual void Serialize( FArchive& Ar ) override;
@@ -181,6 +184,9 @@ class ULevelStreaming : public UObject
 	/** Rename package name to PIE appropriate name */
 	ENGINE_API void RenameForPIE(int PIEInstanceID);
 
+	/** Sets the priority of the async load request for this level, reordering the request in case it is already pending */
+	ENGINE_API void SetLoadPriority(int32 InLoadPriority);
+
 	/**
 	 * Return whether this level should be present in memory which in turn tells the 
 	 * streaming code to stream it in. Please note that a change in value from false 
@@ -81,6 +81,27 @@ struct FActorPriority
 	FActorPriority(class UNetConnection* InConnection, struct FActorDestructionInfo * DestructInfo, const TArray<struct FNetViewer>& Viewers );
 };
 
+/** Update of an open actor channel sent on a worker thread, see net.ParallelReplication */
+struct FParallelChannelUpdate
+{
+	enum EResult
+	{
+		NotReached,			// The connection saturated first
+		Sent,
+		NotSent,			// Replicated, but nothing had to be sent
+		ChannelSaturated,
+		Skipped,			// The channel was closed in the meantime
+	};
+
+	class UActorChannel*	Channel;
+	int32					ConnectionIndex;	// Index of the connection of the channel in ClientConnections
+	EResult					Result;
+
+	FParallelChannelUpdate(class UActorChannel* InChannel, int32 InConnectionIndex) :
+		Channel(InChannel), ConnectionIndex(InConnectionIndex), Result(NotReached)
+	{}
+};
+
 struct FActorDestructionInfo
 {
 	TWeakObjectPtr<UObject>		ObjOuter;
@@ -295,6 +316,18 @@ public:
 	/** Creates if necessary, and returns a FRepLayout that maps to the passed in UStruct */
 	TSharedPtr<FRepLayout>		GetStructRepLayout( UStruct * Struct );
 
+	/** Buckets the considered actors for the relevancy checks, used when net.UseReplicationGraph is set */
+	TSharedPtr< class FNetReplicationGraph >	ReplicationGraph;
+
+	/** Creates the replication graph of this driver, override to use a game specific policy */
+	ENGINE_API virtual TSharedPtr< class FNetReplicationGraph > CreateReplicationGraph();
+
+	/** True while ServerReplicateActors replicates actors on worker threads, see net.ParallelReplication */
+	bool						bReplicatingInParallel;
+
+	/** Guards the state connections share (guid cache, rep layouts, property trackers) while they replicate in parallel */
+	mutable FCriticalSection	SharedReplicationCS;
+
 	TSet< TWeakPtr< FObjectReplicator > > UnmappedReplicators;
 
 	/** Handles to various registered delegates */
@@ -417,6 +450,16 @@ public:
 	 */
 	ENGINE_API virtual int32 ServerReplicateActors(float DeltaSeconds);
 
+	/**
+	 * Sends the channel updates ServerReplicateActors deferred, each actor on its own worker thread going through its connections in order,
+	 * then does the actor bookkeeping of the results on the game thread. Fills in the Result of each update.
+	 *
+	 * @param ParallelUpdates the updates of each client connection, in priority order
+	 *
+	 * @return the number of actors that were replicated
+	 */
+	int32 ReplicateChannelsInParallel(TArray< TArray<FParallelChannelUpdate> >& ParallelUpdates);
+
 	/**
 	 * Process a remote function call on some actor destined for a remote location
 	 *
@@ -543,3 +586,47 @@ protected:
 	/** Returns true if this actor is considered to be in a loaded level */
 	bool IsLevelInitializedForActor(const AActor* InActor, const UNetConnection* InConnection) const;
 };
+
+/**
+ * Scope lock that is only taken while a driver replicates its connections in parallel.
+ * Locks UNetDriver::SharedReplicationCS, or a lock of the shared object itself when one is given.
+ */
+class FNetParallelReplicationScopeLock
+{
+public:
+	explicit FNetParallelReplicationScopeLock(const UNetDriver* Driver)
+		: CriticalSection(Driver != NULL && Driver->bReplicatingInParallel ? &Driver->SharedReplicationCS : NULL)
+	{
+		if (CriticalSection)
+		{
+			CriticalSection->Lock();
+		}
+	}
+
+	FNetParallelReplicationScopeLock(const UNetDriver* Driver, FCriticalSection& InCriticalSection)
+		: CriticalSection(Driver != NULL && Driver->bReplicatingInParallel ? &InCriticalSection : NULL)
+	{
+		if (CriticalSection)
+		{
+			CriticalSection->Lock();
+		}
+	}
+
+	~FNetParallelReplicationScopeLock()
+	{
+		Unlock();
+	}
+
+	/** Releases the lock before the end of the scope */
+	void Unlock()
+	{
+		if (CriticalSection)
+		{
+			CriticalSection->Unlock();
+			CriticalSection = NULL;
+		}
+	}
+
+private:
+	FCriticalSection* CriticalSection;
+};
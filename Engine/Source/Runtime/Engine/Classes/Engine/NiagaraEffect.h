@@ -124,17 +124,8 @@ public:
 	}
 
 
-	void Tick(float DeltaSeconds)
-	{
-		// pass the constants down to the emitter
-		// TODO: should probably just pass a pointer to the table
-		for (TSharedPtr<FNiagaraSimulation>&it : Emitters)
-		{
-			it->SetConstants(Constants);
-			it->GetConstants().Merge(it->GetProperties()->ExternalConstants);
-			it->Tick(DeltaSeconds);
-		}
-	}
+	/** Ticks the emitters, in parallel as they don't share any data */
+	ENGINE_API void Tick(float DeltaSeconds);
 
 	void RenderModuleupdate()
 	{
@@ -156,19 +156,4 @@ private:
 
 	/** Spawn a new particle at this index */
 	int32 SpawnParticles(int32 NumToSpawn);
-
-	/** Util to move a particle */
-	void MoveParticleToIndex(int32 SrcIndex, int32 DestIndex)
-	{
-		FVector4 *SrcPtr = Data.GetCurrentBuffer() + SrcIndex;
-		FVector4 *DestPtr = Data.GetCurrentBuffer() + DestIndex;
-
-		for (int32 AttrIndex = 0; AttrIndex < Data.GetNumAttributes(); AttrIndex++)
-		{
-			*DestPtr = *SrcPtr;
-			DestPtr += Data.GetParticleAllocation();
-			SrcPtr += Data.GetParticleAllocation();
-		}
-	}
-
 };
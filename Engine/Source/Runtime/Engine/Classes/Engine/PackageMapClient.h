@@ -20,6 +20,7 @@
 
 #pragma once
 #include "Net/DataBunch.h"
+#include "Containers/RobinHoodMap.h"
 #include "PackageMapClient.generated.h"
 
 
@@ -71,8 +72,9 @@ public:
 
 	void			AsyncPackageCallback( const FName& PackageName, UPackage * Package );
 	
-	TMap< FNetworkGUID, FNetGuidCacheObject >		ObjectLookup;
-	TMap< TWeakObjectPtr< UObject >, FNetworkGUID >	NetGUIDLookup;
+	// Looked up for every object reference serialized, so they use a cache friendlier map than TMap
+	TRobinHoodMap< FNetworkGUID, FNetGuidCacheObject >			ObjectLookup;
+	TRobinHoodMap< TWeakObjectPtr< UObject >, FNetworkGUID >	NetGUIDLookup;
 	int32											UniqueNetIDs[2];
 
 	bool											IsExportingNetGUIDBunch;
@@ -350,6 +350,13 @@ class UStaticMesh : public UObject, public IInterface_CollisionDataProvider, pub
 	UPROPERTY(EditAnywhere, AdvancedDisplay, Category=Navigation)
 	uint32 bHasNavigationData:1;
 
+	/**
+	 * If true, all the LODs but the last one are cooked in their own bulk data and only loaded while the mesh is seen close enough to use them.
+	 * Saves memory for meshes mostly seen from far away. Instanced and spline mesh components and mesh particles keep all the LODs loaded.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category=StaticMesh)
+	uint32 bStreamLODs:1;
+
 	/**
 	 * Allows artists to adjust the distance where textures using UV 0 are streamed in/out.
 	 * 1.0 is the default, whereas a higher value increases the streamed-in resolution.
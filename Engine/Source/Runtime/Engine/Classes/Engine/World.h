@@ -636,6 +636,9 @@ private:
 	UPROPERTY(Transient)
 	TArray<class UMaterialParameterCollectionInstance*> ParameterCollectionInstances;
 
+	/** Released actors waiting to be reused by SpawnActorFromPool, by class. They stay in their level, which keeps them alive. */
+	TMap<UClass*, TArray<TWeakObjectPtr<AActor> > >	ActorPool;
+
 public:
 	/** Set the pointer to the Navgation system. */
 	void SetNavigationSystem( UNavigationSystem* InNavigationSystem);
@@ -727,6 +730,9 @@ private:
 	/** Gameplay timers. */
 	class FTimerManager* TimerManager;
 
+	/** Significance of the gameplay objects, shared by the systems that scale with it. */
+	class FSignificanceManager* SignificanceManager;
+
 	/** Latent action manager. */
 	struct FLatentActionManager LatentActionManager;
 
@@ -2165,6 +2171,9 @@ private:
 	/** Utility function to handle Exec/Console Commands related to stopping demo playback */
 	bool HandleDemoStopCommand( const TCHAR* Cmd, FOutputDevice& Ar, UWorld* InWorld );
 
+	/** Utility function to handle Exec/Console Commands related to jumping to a time in demo playback */
+	bool HandleDemoScrubCommand( const TCHAR* Cmd, FOutputDevice& Ar, UWorld* InWorld );
+
 public:
 
 	// Destroys the current demo net driver
@@ -2271,6 +2280,41 @@ public:
 		return (Class != NULL) ? Cast<T>(SpawnActor(Class, &Location, &Rotation, SpawnInfo )) : NULL;
 	}
 
+	/**
+	 * Spawns an actor, reusing a released actor of the same class when the pool has one. A reused actor skips
+	 * construction, component registration and BeginPlay: it is moved to the spawn transform, given the owner and
+	 * instigator of the parameters and gets AActor::OnReusedFromPool. Meant for actors that aren't replicated.
+	 *
+	 * @param	Class				Class of the actor
+	 * @param	Location			Spawn location
+	 * @param	Rotation			Spawn rotation
+	 * @param	SpawnParameters		Parameters for SpawnActor, only Owner and Instigator are used when reusing
+	 * @return						The actor, NULL if SpawnActor failed
+	 */
+	AActor* SpawnActorFromPool( UClass* Class, FVector const& Location, FRotator const& Rotation, const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters() );
+
+	/** Templated version of SpawnActorFromPool that allows you to specify a class type via the template type */
+	template< class T >
+	T* SpawnActorFromPool( FVector const& Location, FRotator const& Rotation, const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters() )
+	{
+		return CastChecked<T>(SpawnActorFromPool(T::StaticClass(), Location, Rotation, SpawnParameters),ECastCheckedType::NullAllowed);
+	}
+
+	/**
+	 * Puts an actor in the pool instead of destroying it, see AActor::OnReleasedToPool. Replicated actors are destroyed.
+	 *
+	 * @param	Actor	Actor spawned in this world that the caller is done with
+	 */
+	void ReleaseActorToPool( AActor* Actor );
+
+	/**
+	 * Spawns actors and releases them to the pool right away, so later spawns of the class don't construct anything.
+	 *
+	 * @param	Class	Class of the actors
+	 * @param	Count	Number of released actors the pool should have for this class
+	 */
+	void PrewarmActorPool( UClass* Class, int32 Count );
+
 	/** 
 	 *  Returns the current GameMode instance cast to the template type.
 	 *  This can only return a valid pointer on the server. Will always return null on a client
@@ -2562,6 +2606,12 @@ public:
 		return *TimerManager;
 	}
 
+	/** Returns SignificanceManager instance for this world. */
+	inline FSignificanceManager& GetSignificanceManager() const
+	{
+		return *SignificanceManager;
+	}
+
 	/** Returns LatentActionManager instance for this world. */
 	inline FLatentActionManager& GetLatentActionManager()
 	{
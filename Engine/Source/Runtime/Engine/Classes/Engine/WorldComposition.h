@@ -10,6 +10,7 @@ struct FWorldCompositionTile
 {
 	FWorldCompositionTile()
 		: StreamingLevelStateChangeTime(0.0)
+		, LastVisibleTime(0.0)
 	{
 	}
 	
@@ -21,6 +22,8 @@ struct FWorldCompositionTile
 	FWorldTileInfo			Info;
 	// Timestamp when we have changed streaming level state
 	double					StreamingLevelStateChangeTime;
+	// Timestamp when distance streaming last wanted this tile visible
+	double					LastVisibleTime;
 
 	friend FArchive& operator<<( FArchive& Ar, FWorldCompositionTile& D )
 	{
@@ -71,8 +74,11 @@ class ENGINE_API UWorldComposition : public UObject
 	/** Adds or removes level streaming objects to world based on distance settings from players current view */
 	void UpdateStreamingState();
 	
-	/** Adds or removes level streaming objects to world based on distance settings from current view point */
-	void UpdateStreamingState(const FVector& InLocation);
+	/** 
+	 * Adds or removes level streaming objects to world based on distance settings from current view point
+	 * Tiles along the path projected from InVelocity are loaded ahead of time, see TilesPrefetchTime
+	 */
+	void UpdateStreamingState(const FVector& InLocation, const FVector& InVelocity = FVector::ZeroVector);
 
 	/**
 	 * Evaluates current world origin location against provided view location
@@ -191,6 +197,11 @@ private:
 	// List of all tiles participating in the world composition
 	FTilesList					Tiles;
 
+	// View location (relative to the world absolute origin) and time of the last streaming update, to estimate the view velocity
+	FVector						StreamingViewLocation;
+	double						StreamingViewTime;
+	FVector						StreamingViewVelocity;
+
 public:
 	// Streaming level objects for each tile
 	UPROPERTY(transient)
@@ -199,4 +210,13 @@ public:
 	// Time threshold between tile streaming state changes
 	UPROPERTY(config)
 	double						TilesStreamingTimeThreshold;
+
+	// How far ahead in time (seconds) tiles along the projected view path are loaded, 0 disables prefetching
+	UPROPERTY(config)
+	float						TilesPrefetchTime;
+
+	// Maximum number of tiles kept loaded while hidden. Prefetched tiles are kept first, 
+	// then recently visible tiles, the least recently visible ones are unloaded first
+	UPROPERTY(config)
+	int32						TilesMaxNumHiddenLoaded;
 };
\ No newline at end of file
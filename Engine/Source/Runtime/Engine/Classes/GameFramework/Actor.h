@@ -221,6 +221,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Replication")
 	void SetReplicates(bool bInReplicates);
 
+	/** @return whether this Actor replicates to network clients */
+	bool GetIsReplicated() const { return bReplicates; }
+
 	/** Sets whether or not this Actor is an autonomous proxy, which is an actor on a network client that is controlled by a user on that client. */
 	void SetAutonomousProxy(bool bInAutonomousProxy);
 	
@@ -231,7 +234,7 @@ public:
 	ENetRole GetRemoteRole() const;
 
 	/** Used for replication of our RootComponent's position and velocity */
-	UPROPERTY(ReplicatedUsing=OnRep_ReplicatedMovement)
+	UPROPERTY(EditDefaultsOnly, ReplicatedUsing=OnRep_ReplicatedMovement, Category=Replication, AdvancedDisplay)
 	struct FRepMovement ReplicatedMovement;
 
 	/** Used for replicating attachment of this actor's RootComponent to another actor. */
@@ -293,7 +296,10 @@ public:
 	UPROPERTY()
 	FName NetDriverName;
 
-	/** Method that allows an actor to replicate subobjects on its actor channel */
+	/**
+	 * Method that allows an actor to replicate subobjects on its actor channel.
+	 * With net.ParallelReplication this can run on a worker thread, never at the same time as another update of this actor. Only touch this actor and its subobjects.
+	 */
 	virtual bool ReplicateSubobjects(class UActorChannel *Channel, class FOutBunch *Bunch, FReplicationFlags *RepFlags);
 
 	/** Called on the actor when a new subobject is dynamically created via replication */
@@ -998,6 +1004,26 @@ public:
 	/** Event when play begins for this actor. */
 	virtual void BeginPlay();
 
+	/** Event when this actor is taken from the actor pool of its world instead of being spawned. BeginPlay is not called again. */
+	UFUNCTION(BlueprintImplementableEvent, meta=(FriendlyName = "ReusedFromPool"))
+	virtual void ReceiveReusedFromPool();
+
+	/** Event when this actor is put back in the actor pool of its world instead of being destroyed. */
+	UFUNCTION(BlueprintImplementableEvent, meta=(FriendlyName = "ReleasedToPool"))
+	virtual void ReceiveReleasedToPool();
+
+	/**
+	 * Called by UWorld::SpawnActorFromPool after moving the actor to its spawn transform. Makes it visible, collide and
+	 * tick as its class defaults say. Override to reset gameplay state, calling Super.
+	 */
+	virtual void OnReusedFromPool();
+
+	/**
+	 * Called by UWorld::ReleaseActorToPool. Hides the actor and stops its collision, ticking and life span, while
+	 * keeping its components registered so reusing it doesn't create or register anything.
+	 */
+	virtual void OnReleasedToPool();
+
 	/** Event when this actor takes ANY damage */
 	UFUNCTION(BlueprintImplementableEvent, BlueprintAuthorityOnly, meta=(FriendlyName = "AnyDamage"), Category="Damage")
 	virtual void ReceiveAnyDamage(float Damage, const class UDamageType* DamageType, class AController* InstigatedBy, AActor* DamageCauser);
@@ -1142,6 +1168,8 @@ public:
 	virtual void BeginDestroy() override;
 	virtual bool IsReadyForFinishDestroy() override;
 	virtual bool Rename( const TCHAR* NewName=NULL, UObject* NewOuter=NULL, ERenameFlags Flags=REN_None ) override;
+	/** Only static native actors that don't replicate, anything that changes their references at runtime must call GCClusterWriteBarrier. */
+	virtual bool CanBeInCluster() const override;
 	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 #if WITH_EDITOR
 	virtual void PreEditChange(UProperty* PropertyThatWillChange) override;
@@ -1740,9 +1768,10 @@ public:
 	 * Incrementally registers components associated with this actor
 	 *
 	 * @param NumComponentsToRegister  Number of components to register in this run, 0 for all
+	 * @param OutNumRegistered			If not null, set to the number of components registered in this run
 	 * @return true when all components were registered for this actor
 	 */
-	bool IncrementalRegisterComponents(int32 NumComponentsToRegister);
+	bool IncrementalRegisterComponents(int32 NumComponentsToRegister, int32* OutNumRegistered = nullptr);
 
 	/** Flags all component's render state as dirty	 */
 	void MarkComponentsRenderStateDirty();
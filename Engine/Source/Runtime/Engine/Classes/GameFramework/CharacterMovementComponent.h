@@ -1490,6 +1490,19 @@ public:
 	/** Simulate movement on a non-owning client. */
 	virtual void SimulateMovement(float DeltaTime);
 
+	/**
+	 * Whether this simulated proxy runs the full sweep based SimulateMovement(), or only extrapolates its replicated movement with SimulateMovementSimplified().
+	 * By default proxies registered to the significance manager are simplified below p.NetProxyMinSignificance, the others further than
+	 * p.NetProxySimplifiedDistance from every local player view. Override to use game specific significance rules.
+	 */
+	virtual bool IsSimulatedProxySignificant() const;
+
+	/**
+	 * Cheap simulation of a non-owning client: the replicated velocity is integrated without sweeps nor floor checks,
+	 * the replicated updates and the client smoothing correct the position.
+	 */
+	virtual void SimulateMovementSimplified(float DeltaTime);
+
 	/** Force a client update by making it appear on the server that the client hasn't updated in a long time. */
 	virtual void ForceReplicationUpdate();
 	
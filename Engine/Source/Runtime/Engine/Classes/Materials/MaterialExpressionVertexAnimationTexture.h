@@ -0,0 +1,50 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+
+#pragma once
+#include "Materials/MaterialExpression.h"
+#include "MaterialExpressionVertexAnimationTexture.generated.h"
+
+/**
+ * Plays back an animation baked by FVertexAnimationTextureBaker, on the static mesh built along with the texture.
+ * Offset goes in World Position Offset. Normal is the world space normal of the vertex, it has to be passed to the pixel
+ * shader through Customized UVs since the texture can only be sampled at the vertices.
+ */
+UCLASS(collapsecategories, hidecategories=Object, MinimalAPI)
+class UMaterialExpressionVertexAnimationTexture : public UMaterialExpression
+{
+	GENERATED_UCLASS_BODY()
+
+	UPROPERTY(meta = (RequiredInput = "false", ToolTip = "Defaults to Game Time if not specified"))
+	FExpressionInput Time;
+
+	UPROPERTY(meta = (RequiredInput = "false", ToolTip = "Time added to Time, e.g. PerInstanceRandom so the instances don't play in sync"))
+	FExpressionInput TimeOffset;
+
+	/** Texture created by the bake */
+	UPROPERTY(EditAnywhere, Category=MaterialExpressionVertexAnimationTexture)
+	class UTexture2D* Texture;
+
+	/** Number of frames of the bake */
+	UPROPERTY(EditAnywhere, Category=MaterialExpressionVertexAnimationTexture, meta=(ClampMin = "1"))
+	int32 NumFrames;
+
+	/** Frame rate the animation was baked at */
+	UPROPERTY(EditAnywhere, Category=MaterialExpressionVertexAnimationTexture, meta=(ClampMin = "0.0"))
+	float FrameRate;
+
+	/** UV channel of the static mesh that holds the vertex index */
+	UPROPERTY(EditAnywhere, Category=MaterialExpressionVertexAnimationTexture)
+	uint32 VertexIndexCoordinate;
+
+
+	// Begin UMaterialExpression Interface
+	virtual int32 Compile(class FMaterialCompiler* Compiler, int32 OutputIndex, int32 MultiplexIndex) override;
+	virtual void GetCaption(TArray<FString>& OutCaptions) const override;
+	virtual UTexture* GetReferencedTexture() override;
+	virtual bool NeedsRealtimePreview() override { return Time.Expression == NULL; }
+	// End UMaterialExpression Interface
+};
+
+
+
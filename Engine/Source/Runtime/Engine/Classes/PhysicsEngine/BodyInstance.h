@@ -354,6 +354,14 @@ public:
 	void InitBody(class UBodySetup* Setup, const FTransform& Transform, class UPrimitiveComponent* PrimComp, class FPhysScene* InRBScene, PhysXAggregateType InAggregate = NULL);
 #endif	//WITH_PHYSX
 
+#if WITH_PHYSX
+	/**
+	 * Same as calling InitBody on each of Bodies with the matching transform, for many static bodies sharing a body setup (e.g. the instances of an instanced static mesh).
+	 * The actors are added to each scene in one go under a single lock, instead of one lock and one insertion per body.
+	 */
+	static void InitStaticBodies(const TArray<FBodyInstance*>& Bodies, const TArray<FTransform>& Transforms, class UBodySetup* Setup, class UPrimitiveComponent* PrimComp, class FPhysScene* InRBScene);
+#endif
+
 	void TermBody();
 
 
@@ -12,6 +12,8 @@ namespace physx
 	class PxRigidActor;
 }
 
+class FPhysXCookAsyncTask;
+
 /**
  * BodySetup contains all collision information that is associated with a single asset.
  * A single BodySetup instance is shared among many BodyInstances so that geometry data is not duplicated.
@@ -133,6 +135,9 @@ class UBodySetup : public UObject
 	/** Indicates whether this setup has any cooked collision data. */
 	bool bHasCookedCollisionData;
 
+	/** Cook of the missing cooked data started by BeginAsyncCook, adopted by GetCookedData */
+	FAsyncTask<FPhysXCookAsyncTask>* AsyncCookTask;
+
 public:
 	// Begin UObject interface.
 	virtual void Serialize(FArchive& Ar) override;
@@ -165,6 +170,17 @@ public:
 	/** Release Physics meshes (ConvexMeshes, TriMesh & TriMeshNegX) */
 	ENGINE_API void ClearPhysicsMeshes();
 
+	/**
+	 * Starts cooking the missing cooked data of the current physics format on a worker thread, so that CreatePhysicsMeshes doesn't cook it on the game thread.
+	 * The source data is copied by this call, it can be modified afterwards. CreatePhysicsMeshes waits for the cook if it is still running.
+	 *
+	 * @return true if a cook was started, false if there is nothing to cook or it can't be cooked on this platform.
+	 */
+	ENGINE_API bool BeginAsyncCook();
+
+	/** Returns whether CreatePhysicsMeshes can create the meshes without waiting for a cook started by BeginAsyncCook. */
+	ENGINE_API bool IsAsyncCookComplete() const;
+
 	/** Calculates the mass. You can pass in the component where additional information is pulled from ( Scale, PhysMaterialOverride ) */
 	ENGINE_API virtual float CalculateMass(const UPrimitiveComponent* Component = nullptr) const;
 
@@ -227,4 +243,7 @@ private:
 	void AddTriMeshToRigidActor(physx::PxRigidActor* PDestActor, const FVector& Scale3D, const FVector& Scale3DAbs) const;
 #endif // WITH_PHYSX
 
+private:
+	/** Waits for the cook started by BeginAsyncCook, if any, and stores its result in the cooked data. */
+	void FinishAsyncCook();
 };
@@ -143,6 +143,13 @@ class ENGINE_API UPhysicsSettings
 	UPROPERTY(config, EditAnywhere, meta = (ClampMin = "1", UIMin = "1", ClampMax = "16", UIMax = "16", editcondition = "bSubstepping"), Category=Framerate)
 	int32 MaxSubsteps;
 
+	/**
+	 * Whether every substep simulates exactly MaxSubstepDeltaTime, the time left over being carried to the next frame. The simulation
+	 * then doesn't depend on the frame rate, bodies are rendered interpolated between their last two simulated transforms.
+	 */
+	UPROPERTY(config, EditAnywhere, meta = (editcondition = "bSubstepping"), Category=Framerate)
+	bool bFixedSubstepDeltaTime;
+
 	/** Physics delta time smoothing factor for sync scene. */
 	UPROPERTY(config, EditAnywhere, AdvancedDisplay, meta = (ClampMin = "0.0", UIMin = "0.0", ClampMax = "1.0", UIMax = "1.0"), Category = Framerate)
 	float SyncSceneSmoothingFactor;
@@ -378,4 +378,10 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = Automation, meta = (FilePathFilter = "umap"))
 	TArray<FLaunchOnTestSettings> LaunchOnSettings;
 
+	/**
+	* Reference maps of the AHR benchmark. Each one is captured with a sweep of the AHR settings, see Maps.AHR Benchmark.
+	*/
+	UPROPERTY(config, EditAnywhere, Category = Automation, meta = (FilePathFilter = "umap"))
+	TArray<FFilePath> AHRBenchmarkMaps;
+
 };
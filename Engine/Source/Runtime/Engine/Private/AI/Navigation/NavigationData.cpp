@@ -65,6 +65,7 @@ FAsyncPathFindingQuery::FAsyncPathFindingQuery(const UObject* InOwner, const ANa
 : FPathFindingQuery(InOwner, InNavData, Start, End, SourceQueryFilter)
 , QueryID(GetUniqueID())
 , OnDoneDelegate(Delegate)
+, Priority(EAsyncPathQueryPriority::Normal)
 {
 
 }
@@ -74,6 +75,7 @@ FAsyncPathFindingQuery::FAsyncPathFindingQuery(const FPathFindingQuery& Query, c
 , QueryID(GetUniqueID())
 , OnDoneDelegate(Delegate)
 , Mode(QueryMode)
+, Priority(EAsyncPathQueryPriority::Normal)
 {
 
 }
@@ -209,6 +209,8 @@ UNavigationSystem::UNavigationSystem(const FObjectInitializer& ObjectInitializer
 	, bAddPlayersToGenerationSeeds(true)
 	, bSkipAgentHeightCheckWhenPickingNavData(false)
 	, DirtyAreasUpdateFreq(60)
+	, MaxAsyncPathfindingWorkers(4)
+	, AsyncPathfindingTimeBudget(0.f)
 	, OperationMode(FNavigationSystem::InvalidMode)
 	, NavOctree(NULL)
 	, bNavigationBuildingLocked(false)
@@ -813,7 +815,7 @@ void UNavigationSystem::AddAsyncQuery(const FAsyncPathFindingQuery& Query)
 	AsyncPathFindingQueries.Add(Query);
 }
 
-uint32 UNavigationSystem::FindPathAsync(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate, EPathFindingMode::Type Mode)
+uint32 UNavigationSystem::FindPathAsync(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate, EPathFindingMode::Type Mode, EAsyncPathQueryPriority::Type Priority)
 {
 	SCOPE_CYCLE_COUNTER(STAT_Navigation_RequestingAsyncPathfinding);
 
@@ -825,6 +827,7 @@ uint32 UNavigationSystem::FindPathAsync(const FNavAgentProperties& AgentProperti
 	if (Query.NavData.IsValid())
 	{
 		FAsyncPathFindingQuery AsyncQuery(Query, ResultDelegate, Mode);
+		AsyncQuery.Priority = Priority;
 
 		if (AsyncQuery.QueryID != INVALID_NAVQUERYID)
 		{
@@ -857,9 +860,40 @@ void UNavigationSystem::TriggerAsyncQueries(TArray<FAsyncPathFindingQuery>& Path
 		STAT_FSimpleDelegateGraphTask_NavigationSystemBatchedAsyncQueries,
 		STATGROUP_TaskGraphTasks);
 
-	FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
-		FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, &UNavigationSystem::PerformAsyncQueries, PathFindingQueries),
-		GET_STATID(STAT_FSimpleDelegateGraphTask_NavigationSystemBatchedAsyncQueries));
+	// Don't bother spreading a handful of queries over several tasks
+	static const int32 MinQueriesPerWorker = 16;
+	const int32 NumWorkers = FMath::Clamp(FMath::DivideAndRoundUp(PathFindingQueries.Num(), MinQueriesPerWorker), 1, FMath::Max(MaxAsyncPathfindingWorkers, 1));
+
+	// Deal the queries out highest priority first, so each worker starts with the ones that matter most
+	TArray<TArray<FAsyncPathFindingQuery> > WorkerQueries;
+	WorkerQueries.AddZeroed(NumWorkers);
+
+	int32 WorkerIndex = 0;
+	for (int32 Priority = EAsyncPathQueryPriority::MAX - 1; Priority >= 0; --Priority)
+	{
+		for (const FAsyncPathFindingQuery& Query : PathFindingQueries)
+		{
+			if (Query.Priority == Priority)
+			{
+				WorkerQueries[WorkerIndex].Add(Query);
+				WorkerIndex = (WorkerIndex + 1) % NumWorkers;
+			}
+		}
+	}
+
+	const float WorkerTimeBudget = AsyncPathfindingTimeBudget / NumWorkers;
+	for (TArray<FAsyncPathFindingQuery>& Queries : WorkerQueries)
+	{
+		FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
+			FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, &UNavigationSystem::PerformAsyncQueries, Queries, WorkerTimeBudget),
+			GET_STATID(STAT_FSimpleDelegateGraphTask_NavigationSystemBatchedAsyncQueries));
+	}
+}
+
+void UNavigationSystem::PostponeAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries)
+{
+	check(IsInGameThread());
+	AsyncPathFindingQueries.Insert(PathFindingQueries, 0);
 }
 
 static void AsyncQueryDone(FAsyncPathFindingQuery Query)
@@ -867,7 +901,7 @@ static void AsyncQueryDone(FAsyncPathFindingQuery Query)
 	Query.OnDoneDelegate.ExecuteIfBound(Query.QueryID, Query.Result.Result, Query.Result.Path);
 }
 
-void UNavigationSystem::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries)
+void UNavigationSystem::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries, float TimeBudget)
 {
 	SCOPE_CYCLE_COUNTER(STAT_Navigation_PathfindingAsync);
 
@@ -878,9 +912,30 @@ void UNavigationSystem::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathF
 	
 	const int32 QueriesCount = PathFindingQueries.Num();
 	FAsyncPathFindingQuery* Query = PathFindingQueries.GetData();
+	const double TimeLimit = TimeBudget > 0.f ? FPlatformTime::Seconds() + TimeBudget / 1000.0 : 0.0;
 
 	for (int32 QueryIndex = 0; QueryIndex < QueriesCount; ++QueryIndex, ++Query)
 	{
+		// Always run at least one, so every worker makes progress
+		if (QueryIndex > 0 && TimeLimit > 0.0 && FPlatformTime::Seconds() > TimeLimit)
+		{
+			TArray<FAsyncPathFindingQuery> PostponedQueries;
+			PostponedQueries.Reserve(QueriesCount - QueryIndex);
+			for (int32 PostponedIndex = QueryIndex; PostponedIndex < QueriesCount; ++PostponedIndex)
+			{
+				PostponedQueries.Add(PathFindingQueries[PostponedIndex]);
+			}
+
+			DECLARE_CYCLE_STAT(TEXT("FSimpleDelegateGraphTask.Postpone async nav queries"),
+				STAT_FSimpleDelegateGraphTask_PostponeAsyncNavQueries,
+				STATGROUP_TaskGraphTasks);
+
+			FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
+				FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, &UNavigationSystem::PostponeAsyncQueries, PostponedQueries),
+				GET_STATID(STAT_FSimpleDelegateGraphTask_PostponeAsyncNavQueries), NULL, ENamedThreads::GameThread);
+			break;
+		}
+
 		// @todo this is not necessarily the safest way to use UObjects outside of main thread. 
 		//	think about something else.
 		const ANavigationData* NavData = Query->NavData.IsValid() ? Query->NavData.Get() : GetMainNavData(FNavigationSystem::DontCreate);
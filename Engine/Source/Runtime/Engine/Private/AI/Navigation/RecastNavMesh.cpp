@@ -206,10 +206,14 @@ ARecastNavMesh::ARecastNavMesh(const FObjectInitializer& ObjectInitializer)
 	, DefaultMaxHierarchicalSearchNodes(RECAST_MAX_SEARCH_NODES)
 	, bPerformVoxelFiltering(true)	
 	, bMarkLowHeightAreas(false)
+	, MaxSimultaneousTileGenerationJobsCount(1024)
+	, TileProcessingTimeBudget(0.f)
+	, TileResidencyDistance(0.f)
 	, bUseVirtualFilters(true)
 	, TileSetUpdateInterval(1.0f)
 	, NavMeshVersion(NAVMESHVER_LATEST)	
 	, RecastNavMeshImpl(NULL)
+	, TileResidencyUpdateTimeLeft(0.f)
 {
 	HeuristicScale = 0.999f;
 	RegionPartitioning = ERecastPartitioning::Watershed;
@@ -227,7 +231,7 @@ ARecastNavMesh::ARecastNavMesh(const FObjectInitializer& ObjectInitializer)
 		INC_DWORD_STAT_BY( STAT_NavigationMemory, sizeof(*this) );
 
 		FindPathImplementation = FindPath;
-		FindHierarchicalPathImplementation = FindPath;
+		FindHierarchicalPathImplementation = FindHierarchicalPath;
 
 		TestPathImplementation = TestPath;
 		TestHierarchicalPathImplementation = TestHierarchicalPath;
@@ -1458,6 +1462,12 @@ void ARecastNavMesh::OnStreamingLevelRemoved(ULevel* InLevel)
 	
 	if (!bRebuildAtRuntime && GetWorld()->IsGameWorld())
 	{
+		if (NonResidentLevels.Remove(InLevel) > 0)
+		{
+			// tiles are already back in the chunk
+			return;
+		}
+
 		URecastNavMeshDataChunk* NavDataChunk = GetNavigationDataChunk(InLevel);
 		if (NavDataChunk)
 		{
@@ -1471,6 +1481,94 @@ void ARecastNavMesh::OnStreamingLevelRemoved(ULevel* InLevel)
 	}
 }
 
+void ARecastNavMesh::TickActor(float DeltaTime, enum ELevelTick TickType, FActorTickFunction& ThisTickFunction)
+{
+	Super::TickActor(DeltaTime, TickType, ThisTickFunction);
+
+	if (TileResidencyDistance > 0.f && !bRebuildAtRuntime && GetNetMode() == NM_DedicatedServer)
+	{
+		TileResidencyUpdateTimeLeft -= DeltaTime;
+		if (TileResidencyUpdateTimeLeft <= 0.f)
+		{
+			TileResidencyUpdateTimeLeft = TileSetUpdateInterval;
+			UpdateTileResidency();
+		}
+	}
+}
+
+void ARecastNavMesh::UpdateTileResidency()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_RecastNavMesh_UpdateTileResidency);
+
+	UWorld* World = GetWorld();
+	if (World == NULL || RecastNavMeshImpl == NULL || RecastNavMeshImpl->DetourNavMesh == NULL)
+	{
+		return;
+	}
+
+	TArray<FVector> PlayerLocations;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PlayerController = *It;
+		if (PlayerController != NULL)
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			PlayerLocations.Add(ViewLocation);
+		}
+	}
+
+	const float ResidencyDistanceSq = FMath::Square(TileResidencyDistance);
+	TArray<uint32> ChangedTiles;
+
+	for (ULevel* Level : World->GetLevels())
+	{
+		if (Level == NULL || Level->IsPersistentLevel() || !Level->bIsVisible)
+		{
+			continue;
+		}
+
+		URecastNavMeshDataChunk* NavDataChunk = GetNavigationDataChunk(Level);
+		if (NavDataChunk == NULL)
+		{
+			continue;
+		}
+
+		bool bPlayerNearby = false;
+		const TArray<FBox> LevelNavBounds = GetNavigableBoundsInLevel(Level->GetOutermost()->GetFName());
+		for (int32 PlayerIndex = 0; PlayerIndex < PlayerLocations.Num() && !bPlayerNearby; ++PlayerIndex)
+		{
+			for (const FBox& Bounds : LevelNavBounds)
+			{
+				if (Bounds.ComputeSquaredDistanceToPoint(PlayerLocations[PlayerIndex]) <= ResidencyDistanceSq)
+				{
+					bPlayerNearby = true;
+					break;
+				}
+			}
+		}
+
+		const bool bResident = !NonResidentLevels.Contains(Level);
+		if (bResident && !bPlayerNearby)
+		{
+			ChangedTiles.Append(NavDataChunk->DetachTiles(RecastNavMeshImpl->DetourNavMesh));
+			NonResidentLevels.Add(Level);
+		}
+		else if (!bResident && bPlayerNearby)
+		{
+			ChangedTiles.Append(NavDataChunk->AttachTiles(RecastNavMeshImpl->DetourNavMesh));
+			NonResidentLevels.Remove(Level);
+		}
+	}
+
+	if (ChangedTiles.Num() > 0)
+	{
+		InvalidateAffectedPaths(ChangedTiles);
+		RequestDrawingUpdate();
+	}
+}
+
 bool ARecastNavMesh::AdjustLocationWithFilter(const FVector& StartLoc, FVector& OutAdjustedLocation, const FNavigationQueryFilter& Filter, const UObject* QueryOwner) const
 {
 	INITIALIZE_NAVQUERY(NavQuery, Filter.GetMaxSearchNodes());
@@ -1503,6 +1601,16 @@ bool ARecastNavMesh::AdjustLocationWithFilter(const FVector& StartLoc, FVector&
 }
 
 FPathFindingResult ARecastNavMesh::FindPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query)
+{
+	return FindPathInternal(Query, /*bUseClusterGraph=*/false);
+}
+
+FPathFindingResult ARecastNavMesh::FindHierarchicalPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query)
+{
+	return FindPathInternal(Query, /*bUseClusterGraph=*/true);
+}
+
+FPathFindingResult ARecastNavMesh::FindPathInternal(const FPathFindingQuery& Query, bool bUseClusterGraph)
 {
 	const ANavigationData* Self = Query.NavData.Get();
 	check(Cast<const ARecastNavMesh>(Self));
@@ -1531,7 +1639,7 @@ FPathFindingResult ARecastNavMesh::FindPath(const FNavAgentProperties& AgentProp
 		if(Query.QueryFilter.IsValid())
 		{
 			Result.Result = RecastNavMesh->RecastNavMeshImpl->FindPath(Query.StartLocation, Query.EndLocation, *NavMeshPath,
-				*(Query.QueryFilter.Get()), Query.Owner.Get());
+				*(Query.QueryFilter.Get()), Query.Owner.Get(), bUseClusterGraph);
 		}
 		else
 		{
@@ -137,7 +137,7 @@ TArray<uint32> URecastNavMeshDataChunk::AttachTiles(dtNavMesh* NavMesh)
 #if WITH_RECAST	
 	for (FRecastTileData& TileData : Tiles)
 	{
-		if (TileData.TileRawData.IsValid())
+		if (TileData.TileRawData.IsValid() && TileData.TileRawData->RawData != nullptr)
 		{
 			dtStatus status = NavMesh->addTile(TileData.TileRawData->RawData, TileData.TileDataSize, DT_TILE_FREE_DATA, 0, &TileData.TileRef);
 			if (dtStatusFailed(status))
@@ -169,8 +169,14 @@ TArray<uint32> URecastNavMeshDataChunk::DetachTiles(dtNavMesh* NavMesh)
 	{
 		if (TileData.TileRef != 0)
 		{
-			NavMesh->removeTile(TileData.TileRef, &TileData.TileRawData->RawData, &TileData.TileDataSize);
-			Result.Add(NavMesh->decodePolyIdTile(TileData.TileRef));
+			dtStatus status = NavMesh->removeTile(TileData.TileRef, &TileData.TileRawData->RawData, &TileData.TileDataSize);
+			if (dtStatusSucceed(status))
+			{
+				Result.Add(NavMesh->decodePolyIdTile(TileData.TileRef));
+			}
+
+			// Tile will get a new ref when attached again
+			TileData.TileRef = 0;
 		}
 	}
 #endif// WITH_RECAST
@@ -1518,11 +1518,13 @@ bool FRecastTileGenerator::HasDataToBuild() const
 
 void FRecastTileGenerator::DoWork()
 {
+	MEMORY_TAG_SCOPE(Navigation);
 	bSucceeded = GenerateTile();
 }
 
 void FRecastTileGenerator::GatherGeometry(const FRecastNavMeshGenerator& ParentGenerator, bool bGeometryChanged)
 {
+	MEMORY_TAG_SCOPE(Navigation);
 	const UNavigationSystem*	NavSys = UNavigationSystem::GetCurrent(ParentGenerator.GetWorld());
 	const FNavigationOctree*	NavOctree = NavSys ? NavSys->GetNavOctree() : nullptr;
 	const FNavDataConfig*		NavDataConfig = &ParentGenerator.GetOwner()->NavDataConfig;
@@ -2786,7 +2788,7 @@ void FRecastNavMeshGenerator::Init()
 
 	/** setup maximum number of active tile generator*/
 	const int32 NumberOfWorkerThreads = FTaskGraphInterface::Get().GetNumWorkerThreads();
-	MaxTileGeneratorTasks = FMath::Max(NumberOfWorkerThreads*2, 1);
+	MaxTileGeneratorTasks = FMath::Clamp(NumberOfWorkerThreads*2, 1, FMath::Max(DestNavMesh->MaxSimultaneousTileGenerationJobsCount, 1));
 	UE_LOG(LogNavigation, Log, TEXT("Using max of %d workers to build navigation."), MaxTileGeneratorTasks);
 	NumActiveTiles = 0;
 
@@ -2986,7 +2988,7 @@ void FRecastNavMeshGenerator::TickAsyncBuild(float DeltaSeconds)
 	check(NavSys);
 	const int32 NumRunningTasks = NavSys->GetNumRunningBuildTasks();
 	const int32 NumTasksToSubmit = MaxTileGeneratorTasks - NumRunningTasks;
-	TArray<uint32> UpdatedTileIndices = ProcessTileTasks(NumTasksToSubmit);
+	TArray<uint32> UpdatedTileIndices = ProcessTileTasks(NumTasksToSubmit, DestNavMesh->TileProcessingTimeBudget);
 			
 	if (UpdatedTileIndices.Num() > 0)
 	{
@@ -3432,17 +3434,26 @@ TSharedRef<FRecastTileGenerator> FRecastNavMeshGenerator::CreateTileGenerator(co
 	return TileGenerator;
 }
 
-TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasks(const int32 NumTasksToSubmit)
+TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasks(const int32 NumTasksToSubmit, const float TimeBudgetMs)
 {
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_RecastNavMeshGenerator_ProcessTileTasks);
 	
 	TArray<uint32> UpdatedTiles;
 	const bool bHasTasksAtStart = GetNumRemaningBuildTasks() > 0;
+
+	// Gathering geometry for new tiles and adding built ones both happen here on the game thread, 
+	// a lot of tiles dirtied at once would otherwise hitch for as many frames as it takes to go through them
+	const double TimeLimit = TimeBudgetMs > 0.f ? FPlatformTime::Seconds() + TimeBudgetMs / 1000.0 : 0.0;
 	
 	int32 NumSubmittedTasks = 0;
 	// Submit pending tile elements
 	for (int32 ElementIdx = PendingDirtyTiles.Num()-1; ElementIdx >= 0 && NumSubmittedTasks < NumTasksToSubmit; ElementIdx--)
 	{
+		if (NumSubmittedTasks > 0 && TimeLimit > 0.0 && FPlatformTime::Seconds() > TimeLimit)
+		{
+			break;
+		}
+
 		FPendingTileElement& PendingElement = PendingDirtyTiles[ElementIdx];
 		FRunningTileElement RunningElement(PendingElement.Coord);
 		
@@ -3484,6 +3495,7 @@ TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasks(const int32 NumTasksToS
 	}
 	
 	// Collect completed tasks and apply generated data to navmesh
+	int32 NumCollectedTasks = 0;
 	for (int32 Idx = RunningDirtyTiles.Num() - 1; Idx >=0; --Idx)
 	{
 		FRunningTileElement& Element = RunningDirtyTiles[Idx];
@@ -3491,6 +3503,13 @@ TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasks(const int32 NumTasksToS
 
 		if (Element.AsyncTask->IsDone())
 		{
+			// The rest is picked up next frame
+			if (NumCollectedTasks > 0 && TimeLimit > 0.0 && FPlatformTime::Seconds() > TimeLimit)
+			{
+				break;
+			}
+			NumCollectedTasks++;
+
 			// Add generated tiles to navmesh
 			if (!Element.bShouldDiscard)
 			{
@@ -122,6 +122,24 @@ int32 FActiveSound::FindClosestListener( const TArray<FListener>& InListeners )
 	return ClosestListenerIndex;
 }
 
+bool FActiveSound::IsOutOfRangeLoop( const FListener& ClosestListener ) const
+{
+	// One shots end on their own, and couldn't be resumed where they were
+	if( !bLocationDefined || !bAllowSpatialization || bIsUISound || bAlwaysPlay || bFadingOut || Sound->GetDuration() < INDEFINITELY_LOOPING_DURATION )
+	{
+		return false;
+	}
+
+	// The attenuation of the sound itself can only make its range shorter
+	const float MaxDistance = bHasAttenuationSettings ? AttenuationSettings.GetMaxDimension() : Sound->GetMaxAudibleDistance();
+	if( MaxDistance >= WORLD_MAX || MaxDistance <= 0.f )
+	{
+		return false;
+	}
+
+	return FVector::DistSquared( Transform.GetTranslation(), ClosestListener.Transform.GetTranslation() ) > FMath::Square( MaxDistance );
+}
+
 
 void FActiveSound::UpdateWaveInstances( FAudioDevice* AudioDevice, TArray<FWaveInstance*> &InWaveInstances, const float DeltaTime )
 {
@@ -162,6 +180,15 @@ void FActiveSound::UpdateWaveInstances( FAudioDevice* AudioDevice, TArray<FWaveI
 
 	const FListener& ClosestListener = AudioDevice->Listeners[ ClosestListenerIndex ];
 
+	// Virtual while out of range: only the playback time advances, the node graph isn't parsed and no source is used.
+	// The sound is parsed again, restarting its looping waves, once a listener gets in range
+	if( IsOutOfRangeLoop( ClosestListener ) )
+	{
+		INC_DWORD_STAT( STAT_VirtualSounds );
+		LastLocation = Transform.GetTranslation();
+		return;
+	}
+
 	// Process occlusion before shifting the sounds position
 	if (World.IsValid())
 	{
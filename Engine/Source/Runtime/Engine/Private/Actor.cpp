@@ -125,6 +125,11 @@ FString FActorTickFunction::DiagnosticMessage()
 	return Target->GetFullName() + TEXT("[TickActor]");
 }
 
+UClass* FActorTickFunction::GetTickBatchClass()
+{
+	return Target ? Target->GetClass() : NULL;
+}
+
 bool AActor::CheckDefaultSubobjectsInternal()
 {
 	bool Result = Super::CheckDefaultSubobjectsInternal();
@@ -1397,6 +1402,12 @@ bool AActor::IsMatineeControlled() const
 	return bMovedByMatinee;
 }
 
+bool AActor::CanBeInCluster() const
+{
+	// Static native actors don't move nor run script, so their references stay the same once loaded. Replication can change them on clients
+	return IsRootComponentStatic() && !GetIsReplicated() && GetClass()->HasAnyClassFlags(CLASS_Native);
+}
+
 bool AActor::IsRootComponentStatic() const
 {
 	return(RootComponent != NULL && RootComponent->Mobility == EComponentMobility::Static);
@@ -2015,6 +2026,8 @@ void AActor::AddOwnedComponent(UActorComponent* Component)
 {
 	check(Component->GetOwner() == this);
 	OwnedComponents.AddUnique(Component);
+	// Components added at runtime aren't part of the cluster this actor may be in
+	GCClusterWriteBarrier(this, Component);
 
 	if (Component->GetIsReplicated())
 	{
@@ -2458,6 +2471,36 @@ void AActor::BeginPlay()
 	ReceiveBeginPlay();
 }
 
+void AActor::OnReusedFromPool()
+{
+	const AActor* Defaults = GetClass()->GetDefaultObject<AActor>();
+
+	SetActorHiddenInGame(Defaults->bHidden);
+	SetActorEnableCollision(Defaults->bActorEnableCollision);
+	SetActorTickEnabled(PrimaryActorTick.bStartWithTickEnabled);
+	for (UActorComponent* Component : GetComponents())
+	{
+		Component->SetComponentTickEnabled(Component->PrimaryComponentTick.bStartWithTickEnabled);
+	}
+	SetLifeSpan(Defaults->InitialLifeSpan);
+
+	ReceiveReusedFromPool();
+}
+
+void AActor::OnReleasedToPool()
+{
+	ReceiveReleasedToPool();
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+	for (UActorComponent* Component : GetComponents())
+	{
+		Component->SetComponentTickEnabled(false);
+	}
+	GetWorldTimerManager().ClearTimer(TimerHandle_LifeSpanExpired);
+}
+
 void AActor::EnableInput(APlayerController* PlayerController)
 {
 	if (PlayerController)
@@ -3225,7 +3268,7 @@ static USceneComponent* GetUnregisteredParent(UActorComponent* Component)
 	return ParentComponent;
 }
 
-bool AActor::IncrementalRegisterComponents(int32 NumComponentsToRegister)
+bool AActor::IncrementalRegisterComponents(int32 NumComponentsToRegister, int32* OutNumRegistered)
 {
 	if (NumComponentsToRegister == 0)
 	{
@@ -3279,6 +3322,11 @@ bool AActor::IncrementalRegisterComponents(int32 NumComponentsToRegister)
 		NumTotalRegisteredComponents++;
 	}
 
+	if (OutNumRegistered)
+	{
+		*OutNumRegistered = NumRegisteredComponentsThisRun;
+	}
+
 	// See whether we are done
 	if (Components.Num() == NumTotalRegisteredComponents)
 	{
@@ -388,6 +388,12 @@ bool UActorComponent::NeedsLoadForClient() const
 }
 
 
+bool UActorComponent::CanBeInCluster() const
+{
+	AActor* Owner = GetOwner();
+	return Owner && Owner->CanBeInCluster() && !GetIsReplicated() && GetClass()->HasAnyClassFlags(CLASS_Native);
+}
+
 bool UActorComponent::NeedsLoadForServer() const
 {
 	check(GetOuter());
@@ -608,6 +614,11 @@ FString FActorComponentTickFunction::DiagnosticMessage()
 	return Target->GetFullName() + TEXT("[TickComponent]");
 }
 
+UClass* FActorComponentTickFunction::GetTickBatchClass()
+{
+	return Target ? Target->GetClass() : NULL;
+}
+
 bool UActorComponent::SetupActorComponentTickFunction(struct FTickFunction* TickFunction)
 {
 	AActor* Owner = GetOwner();
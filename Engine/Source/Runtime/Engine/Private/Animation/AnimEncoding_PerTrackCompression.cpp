@@ -546,14 +546,7 @@ void AEFPerTrackCompressionCodec::GetBoneAtomRotation(
 			FQuat R1;
 			FAnimationCompression_PerTrackUtils::DecompressRotation(KeyFormat, FormatFlags, R1, TrackData, KeyData1);
 
-			// Fast linear quaternion interpolation.
-			// To ensure the 'shortest route', we make sure the dot product between the two keys is positive.
-			const float DotResult = (R0 | R1);
-			const float Bias = FMath::FloatSelect(DotResult, 1.0f, -1.0f);
-
-			FQuat BlendedQuat = (R0 * (1.f-Alpha)) + (R1 * (Alpha * Bias));
-			OutAtom.SetRotation( BlendedQuat );
-			OutAtom.NormalizeRotation();
+			OutAtom.SetRotation( BlendRotationKeys(R0, R1, Alpha) );
 #endif
 		}
 		else // (Index0 == Index1)
@@ -742,6 +735,20 @@ void AEFPerTrackCompressionCodec::GetBoneAtomScale(
 
 #if USE_ANIMATION_CODEC_BATCH_SOLVER
 
+/**
+* Prefetches the header and fixed data of a track, read before any of its keys
+*
+* @param	Seq				The animation sequence to use.
+* @param	Offset			Offset of the track in the compressed byte stream, INDEX_NONE for identity tracks.
+*/
+static FORCEINLINE void PrefetchTrack(const UAnimSequence& Seq, int32 Offset)
+{
+	if (Offset != INDEX_NONE)
+	{
+		FPlatformMisc::Prefetch(Seq.CompressedByteStream.GetData() + Offset);
+	}
+}
+
 /**
 * Decompress all requested rotation components from an Animation Sequence
 *
@@ -762,6 +769,12 @@ void AEFPerTrackCompressionCodec::GetPoseRotations(
 
 	for( int32 PairIndex = 0; PairIndex < PairCount; ++PairIndex )
 	{
+		const int32 PrefetchIndex = PairIndex + ANIMATION_CODEC_PREFETCH_DISTANCE;
+		if( PrefetchIndex < PairCount )
+		{
+			PrefetchTrack( Seq, Seq.CompressedTrackOffsets[DesiredPairs[PrefetchIndex].TrackIndex * 2 + 1] );
+		}
+
 		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
 		const int32 TrackIndex = Pair.TrackIndex;
 		const int32 AtomIndex = Pair.AtomIndex;
@@ -794,6 +807,12 @@ void AEFPerTrackCompressionCodec::GetPoseTranslations(
 
 	for( int32 PairIndex = 0; PairIndex < PairCount; ++PairIndex )
 	{
+		const int32 PrefetchIndex = PairIndex + ANIMATION_CODEC_PREFETCH_DISTANCE;
+		if( PrefetchIndex < PairCount )
+		{
+			PrefetchTrack( Seq, Seq.CompressedTrackOffsets[DesiredPairs[PrefetchIndex].TrackIndex * 2 + 0] );
+		}
+
 		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
 		const int32 TrackIndex = Pair.TrackIndex;
 		const int32 AtomIndex = Pair.AtomIndex;
@@ -828,6 +847,12 @@ void AEFPerTrackCompressionCodec::GetPoseScales(
 
 	for( int32 PairIndex = 0; PairIndex < PairCount; ++PairIndex )
 	{
+		const int32 PrefetchIndex = PairIndex + ANIMATION_CODEC_PREFETCH_DISTANCE;
+		if( PrefetchIndex < PairCount )
+		{
+			PrefetchTrack( Seq, Seq.CompressedScaleOffsets.GetOffsetData( DesiredPairs[PrefetchIndex].TrackIndex, 0 ) );
+		}
+
 		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
 		const int32 TrackIndex = Pair.TrackIndex;
 		const int32 AtomIndex = Pair.AtomIndex;
@@ -66,6 +66,7 @@ UAnimInstance::UAnimInstance(const FObjectInitializer& ObjectInitializer)
 {
 	RootNode = NULL;
 	RootMotionMode = ERootMotionMode::RootMotionFromMontagesOnly;
+	bUseParallelGraphUpdate = false;
 }
 
 void UAnimInstance::MakeSequenceTickRecord(FAnimTickRecord& TickRecord, class UAnimSequenceBase* Sequence, bool bLooping, float PlayRate, float FinalBlendWeight, float& CurrentTime) const
@@ -325,6 +326,36 @@ bool UAnimInstance::UpdateSnapshotAndSkipRemainingUpdate()
 #endif
 
 void UAnimInstance::UpdateAnimation(float DeltaSeconds)
+{
+	if (!PreUpdateAnimation(DeltaSeconds))
+	{
+		return;
+	}
+
+	UpdateAnimationGraph(DeltaSeconds);
+
+	// update montage should run in game thread
+	// if we do multi threading, make sure this stays in game thread
+	Montage_Advance(DeltaSeconds);
+
+	PostUpdateAnimation(DeltaSeconds);
+}
+
+bool UAnimInstance::CanUpdateAnimationGraphInParallel() const
+{
+#if WITH_EDITOR
+	// Links are fixed up and node visits recorded for the debugger during the update
+	if (GIsEditor)
+	{
+		return false;
+	}
+#endif
+
+	// Root motion from the asset players has to be consumed right after the update
+	return bUseParallelGraphUpdate && (RootNode != NULL) && (RootMotionMode != ERootMotionMode::RootMotionFromEverything);
+}
+
+bool UAnimInstance::PreUpdateAnimation(float DeltaSeconds)
 {
 #if WITH_EDITOR
 	if (GIsEditor)
@@ -349,7 +380,7 @@ void UAnimInstance::UpdateAnimation(float DeltaSeconds)
 
 		if (UpdateSnapshotAndSkipRemainingUpdate())
 		{
-			return;
+			return false;
 		}
 	}
 #endif
@@ -384,6 +415,11 @@ void UAnimInstance::UpdateAnimation(float DeltaSeconds)
 	// update weight before all nodes update comes in
 	Montage_UpdateWeight(DeltaSeconds);
 
+	return true;
+}
+
+void UAnimInstance::UpdateAnimationGraph(float DeltaSeconds)
+{
 	// Update the anim graph
 	if (RootNode != NULL)
 	{
@@ -443,11 +479,10 @@ void UAnimInstance::UpdateAnimation(float DeltaSeconds)
 			ExtractedRootMotion.AccumulateWithBlend(TickContext.RootMotionMovementParams.RootMotionTransform, AssetPlayerToTick.EffectiveBlendWeight);
 		}
 	}
+}
 
-	// update montage should run in game thread
-	// if we do multi threading, make sure this stays in game thread
-	Montage_Advance(DeltaSeconds);
-
+void UAnimInstance::PostUpdateAnimation(float DeltaSeconds)
+{
 	// We may have just partially blended root motion, so make it up to 1 by
 	// blending in identity too
 	if (ExtractedRootMotion.bHasRootMotion)
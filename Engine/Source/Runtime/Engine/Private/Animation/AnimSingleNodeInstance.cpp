@@ -17,6 +17,103 @@
 #include "Animation/AimOffsetBlendSpace1D.h"
 #include "Animation/AnimMontage.h"
 
+static TAutoConsoleVariable<float> CVarSharedPoseTimeStep(
+	TEXT("a.SharedPoseTimeStep"),
+	1.0f / 30.0f,
+	TEXT("Time step the sequence time is snapped to for meshes with bSharePoseEvaluation, so the ones playing a sequence at about the same time share one pose. 0 to disable sharing."));
+
+/////////////////////////////////////////////////////
+// FSharedSequencePoseCache
+/////////////////////////////////////////////////////
+
+/**
+ * Sequence poses evaluated this frame for meshes with bSharePoseEvaluation, keyed by sequence, snapped time and required bones.
+ * Evaluation runs on the parallel animation tasks, so the cache is locked, but only to look up or add a pose.
+ */
+class FSharedSequencePoseCache
+{
+public:
+	FSharedSequencePoseCache()
+		: Frame(0)
+	{
+	}
+
+	/** Fills OutPose with the pose of the sequence, evaluated at most once per frame for each key */
+	void GetPose(const UAnimSequence* Sequence, float Time, const FBoneContainer& RequiredBones, FTransformArrayA2& OutPose)
+	{
+		const float TimeStep = CVarSharedPoseTimeStep.GetValueOnAnyThread();
+		if (TimeStep <= 0.0f)
+		{
+			FAnimationRuntime::GetPoseFromSequence(Sequence, RequiredBones, OutPose, FAnimExtractContext(Time, Sequence->bEnableRootMotion));
+			return;
+		}
+
+		const TArray<FBoneIndexType>& BoneIndices = RequiredBones.GetBoneIndicesArray();
+
+		FKey Key;
+		Key.Sequence = Sequence;
+		Key.Asset = RequiredBones.GetAsset();
+		Key.TimeStepIndex = FMath::RoundToInt(Time / TimeStep);
+		Key.BonesCrc = FCrc::MemCrc32(BoneIndices.GetData(), BoneIndices.Num() * sizeof(FBoneIndexType));
+
+		{
+			FScopeLock Lock(&CriticalSection);
+
+			if (Frame != GFrameCounter)
+			{
+				Poses.Reset();
+				Frame = GFrameCounter;
+			}
+
+			const FTransformArrayA2* SharedPose = Poses.Find(Key);
+			if (SharedPose && SharedPose->Num() == OutPose.Num())
+			{
+				OutPose = *SharedPose;
+				return;
+			}
+		}
+
+		const float SnappedTime = FMath::Clamp(Key.TimeStepIndex * TimeStep, 0.0f, Sequence->SequenceLength);
+		FAnimationRuntime::GetPoseFromSequence(Sequence, RequiredBones, OutPose, FAnimExtractContext(SnappedTime, Sequence->bEnableRootMotion));
+
+		{
+			FScopeLock Lock(&CriticalSection);
+
+			if (Frame == GFrameCounter)
+			{
+				Poses.Add(Key, OutPose);
+			}
+		}
+	}
+
+private:
+	struct FKey
+	{
+		const UAnimSequence* Sequence;
+		const UObject* Asset;
+		int32 TimeStepIndex;
+		uint32 BonesCrc;
+
+		bool operator==(const FKey& Other) const
+		{
+			return Sequence == Other.Sequence && Asset == Other.Asset && TimeStepIndex == Other.TimeStepIndex && BonesCrc == Other.BonesCrc;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombine(HashCombine(PointerHash(Key.Sequence), PointerHash(Key.Asset)), HashCombine(Key.TimeStepIndex, Key.BonesCrc));
+		}
+	};
+
+	FCriticalSection CriticalSection;
+	TMap<FKey, FTransformArrayA2> Poses;
+
+	/** Frame the poses were evaluated for */
+	uint64 Frame;
+};
+
+static FSharedSequencePoseCache GSharedSequencePoseCache;
+
 /////////////////////////////////////////////////////
 // UAnimSingleNodeInstance
 /////////////////////////////////////////////////////
@@ -334,6 +431,10 @@ bool UAnimSingleNodeInstance::NativeEvaluateAnimation(FPoseContext& Output)
 					BlendRotationOffset(BasePose, AdditivePose, 1.0f, Output.Pose);
 				}
 			}
+			else if (GetSkelMeshComponent()->bSharePoseEvaluation)
+			{
+				GSharedSequencePoseCache.GetPose(Sequence, CurrentTime, RequiredBones, Output.Pose.Bones);
+			}
 			else
 			{
 				// if sekeltalmesh isn't there, we'll need to use skeleton
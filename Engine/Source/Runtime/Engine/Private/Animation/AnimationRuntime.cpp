@@ -69,40 +69,16 @@ void FAnimationRuntime::BlendPosesTogether(int32 NumPoses, const FTransformArray
 	{
 		// debug purpose for now, but this can cause 0 bone transform, so we'd like to catch it 
 		float WeightSum=0.f;
+		TArray<const FTransform*, TInlineAllocator<8>> PoseData;
 		for (int32 i = 0; i < NumPoses; ++i)
 		{
-			const ScalarRegister VBlendWeight(SourceWeights[i]);
-			const FTransformArrayA2& SourceAtoms = *SourcePoses[i];
-
 			WeightSum += SourceWeights[i];
-
-			if (i == 0)
-			{
-				// First pose will just overwrite the destination
-				for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
-				{
-					const int32 BoneIndex = RequiredBoneIndices[j];
-					ResultAtoms[BoneIndex] = SourceAtoms[BoneIndex] * VBlendWeight;
-				}
-			}
-			else
-			{
-				// Subsequent poses need to be blended in
-				for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
-				{
-					const int32 BoneIndex = RequiredBoneIndices[j];
-					ResultAtoms[BoneIndex].AccumulateWithShortestRotation(SourceAtoms[BoneIndex], VBlendWeight);
-				}
-			}
+			PoseData.Add(SourcePoses[i]->GetData());
 		}
 
-		ensure (WeightSum != 0.f);
+		FTransformBatch::BlendPoses(ResultAtoms.GetData(), PoseData.GetData(), SourceWeights, NumPoses, RequiredBoneIndices.GetData(), RequiredBoneIndices.Num());
 
-		// Ensure that all of the resulting rotations are normalized
-		if( NumPoses > 1 )
-		{
-			FAnimationRuntime::NormalizeRotations(RequiredBones, ResultAtoms);
-		}
+		ensure (WeightSum != 0.f);
 	}
 }
 
@@ -121,38 +97,15 @@ void FAnimationRuntime::BlendPosesTogether(int32 NumPoses, const TArray<FTransfo
 {
 	check(NumPoses > 0);
 
-
 	const TArray<FBoneIndexType> & RequiredBoneIndices = RequiredBones.GetBoneIndicesArray();
+	TArray<const FTransform*, TInlineAllocator<8>> PoseData;
 	for (int32 i = 0; i < NumPoses; ++i)
 	{
-		const ScalarRegister VBlendWeight(SourceWeights[i]);
-		const FTransformArrayA2& SourceAtoms = SourcePoses[i];
-
-		if (i == 0)
-		{
-			// First pose will just overwrite the destination
-			for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
-			{
-				const int32 BoneIndex = RequiredBoneIndices[j];
-				ResultAtoms[BoneIndex] = SourceAtoms[BoneIndex] * VBlendWeight;
-			}
-		}
-		else
-		{
-			// Subsequent poses need to be blended in
-			for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
-			{
-				const int32 BoneIndex = RequiredBoneIndices[j];
-				ResultAtoms[BoneIndex].AccumulateWithShortestRotation(SourceAtoms[BoneIndex], VBlendWeight);
-			}
-		}
+		PoseData.Add(SourcePoses[i].GetData());
 	}
 
-	// Ensure that all of the resulting rotations are normalized
-	if( NumPoses > 1 )
-	{
-		FAnimationRuntime::NormalizeRotations(RequiredBones, ResultAtoms);
-	}
+	// Rotations are normalized by the blend when there is more than one pose
+	FTransformBatch::BlendPoses(ResultAtoms.GetData(), PoseData.GetData(), SourceWeights.GetData(), NumPoses, RequiredBoneIndices.GetData(), RequiredBoneIndices.Num());
 }
 
 /**
@@ -344,18 +297,13 @@ void FAnimationRuntime::BlendAdditivePose(const FTransformArrayA2& SourcePoses,
 void FAnimationRuntime::CombineWithAdditiveAnimations(int32 NumAdditivePoses, const FTransformArrayA2** SourceAdditivePoses, const float* SourceAdditiveWeights, const FBoneContainer& RequiredBones, /*inout*/ FTransformArrayA2& Atoms)
 {
 	const TArray<FBoneIndexType> & RequiredBoneIndices = RequiredBones.GetBoneIndicesArray();
+	TArray<const FTransform*, TInlineAllocator<8>> PoseData;
 	for (int32 PoseIndex = 0; PoseIndex < NumAdditivePoses; ++PoseIndex)
 	{
-		const ScalarRegister VBlendWeight(SourceAdditiveWeights[PoseIndex]);
-		const FTransformArrayA2& SourceAtoms = *SourceAdditivePoses[PoseIndex];
-
-		for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
-		{
-			const int32 BoneIndex = RequiredBoneIndices[j];
-			FTransform SourceAtom = SourceAtoms[BoneIndex];
-			FTransform::BlendFromIdentityAndAccumulate(Atoms[BoneIndex], SourceAtom, VBlendWeight);
-		}
+		PoseData.Add(SourceAdditivePoses[PoseIndex]->GetData());
 	}
+
+	FTransformBatch::AccumulateAdditivePoses(Atoms.GetData(), PoseData.GetData(), SourceAdditiveWeights, NumAdditivePoses, RequiredBoneIndices.GetData(), RequiredBoneIndices.Num());
 }
 
 void FAnimationRuntime::GetPoseFromSequence(
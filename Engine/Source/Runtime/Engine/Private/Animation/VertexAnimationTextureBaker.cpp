@@ -0,0 +1,272 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	VertexAnimationTextureBaker.cpp: Bakes skeletal animations into vertex animation textures.
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "VertexAnimationTextureBaker.h"
+#include "AnimationRuntime.h"
+#include "SkeletalMeshTypes.h"
+#include "GPUSkinPublicDefs.h"
+
+#if WITH_EDITOR
+#include "RawMesh.h"
+
+/** Skins the position and normal of one vertex of the LOD model with the RefToLocal matrices of a pose */
+template <bool bExtraBoneInfluencesT>
+static void SkinVertex(const FSkelMeshChunk& Chunk, const FSkeletalMeshVertexBuffer& VertexBuffer, uint32 VertexIndex, bool bSoftVertex, const TArray<FMatrix>& RefToLocals, FVector& OutPosition, FVector& OutNormal)
+{
+	const TGPUSkinVertexBase<bExtraBoneInfluencesT>* SrcVertex = VertexBuffer.GetVertexPtr<bExtraBoneInfluencesT>(VertexIndex);
+	const FVector Position = VertexBuffer.GetVertexPositionFast(SrcVertex);
+	const FVector Normal = SrcVertex->TangentZ;
+
+	if (!bSoftVertex)
+	{
+		const FMatrix& RefToLocal = RefToLocals[Chunk.BoneMap[SrcVertex->InfluenceBones[SkinningTools::GetRigidInfluenceIndex()]]];
+		OutPosition = RefToLocal.TransformPosition(Position);
+		OutNormal = RefToLocal.TransformVector(Normal).GetSafeNormal();
+		return;
+	}
+
+	OutPosition = FVector::ZeroVector;
+	OutNormal = FVector::ZeroVector;
+
+#if !PLATFORM_LITTLE_ENDIAN
+	// uint8[] elements in LOD.VertexBufferGPUSkin have been swapped for VET_UBYTE4 vertex stream use
+	for (int32 InfluenceIndex = MAX_INFLUENCES - 1; InfluenceIndex >= MAX_INFLUENCES - Chunk.MaxBoneInfluences; InfluenceIndex--)
+#else
+	for (int32 InfluenceIndex = 0; InfluenceIndex < Chunk.MaxBoneInfluences; InfluenceIndex++)
+#endif
+	{
+		const FMatrix& RefToLocal = RefToLocals[Chunk.BoneMap[SrcVertex->InfluenceBones[InfluenceIndex]]];
+		const float Weight = (float)SrcVertex->InfluenceWeights[InfluenceIndex] / 255.0f;
+
+		OutPosition += RefToLocal.TransformPosition(Position) * Weight;
+		OutNormal += RefToLocal.TransformVector(Normal) * Weight;
+	}
+
+	OutNormal = OutNormal.GetSafeNormal();
+}
+
+/** Skins every vertex of the LOD model, in vertex buffer order */
+static void SkinVertices(const FStaticLODModel& Model, const TArray<FMatrix>& RefToLocals, TArray<FVector>& OutPositions, TArray<FVector>& OutNormals)
+{
+	OutPositions.SetNumUninitialized(Model.NumVertices);
+	OutNormals.SetNumUninitialized(Model.NumVertices);
+
+	const bool bExtraBoneInfluences = Model.VertexBufferGPUSkin.HasExtraBoneInfluences();
+
+	for (int32 ChunkIndex = 0; ChunkIndex < Model.Chunks.Num(); ++ChunkIndex)
+	{
+		const FSkelMeshChunk& Chunk = Model.Chunks[ChunkIndex];
+
+		for (int32 SkinType = 0; SkinType < 2; ++SkinType)
+		{
+			const bool bSoftVertex = SkinType == 1;
+			const uint32 FirstVertex = bSoftVertex ? Chunk.GetSoftVertexBufferIndex() : Chunk.GetRigidVertexBufferIndex();
+			const uint32 NumVertices = bSoftVertex ? Chunk.GetNumSoftVertices() : Chunk.GetNumRigidVertices();
+
+			for (uint32 VertexIndex = FirstVertex; VertexIndex < FirstVertex + NumVertices; ++VertexIndex)
+			{
+				if (bExtraBoneInfluences)
+				{
+					SkinVertex<true>(Chunk, Model.VertexBufferGPUSkin, VertexIndex, bSoftVertex, RefToLocals, OutPositions[VertexIndex], OutNormals[VertexIndex]);
+				}
+				else
+				{
+					SkinVertex<false>(Chunk, Model.VertexBufferGPUSkin, VertexIndex, bSoftVertex, RefToLocals, OutPositions[VertexIndex], OutNormals[VertexIndex]);
+				}
+			}
+		}
+	}
+}
+
+/** Builds a static mesh from the LOD model in its ref pose, with the index of each vertex in the U of VertexIndexCoordinate */
+static UStaticMesh* CreateVertexAnimationStaticMesh(USkeletalMesh* SkeletalMesh, const FStaticLODModel& Model, int32 VertexIndexCoordinate, UObject* Outer, FName Name)
+{
+	const FSkeletalMeshVertexBuffer& VertexBuffer = Model.VertexBufferGPUSkin;
+	const FRawStaticIndexBuffer16or32Interface* IndexBuffer = Model.MultiSizeIndexContainer.GetIndexBuffer();
+
+	FRawMesh RawMesh;
+
+	RawMesh.VertexPositions.SetNumUninitialized(Model.NumVertices);
+	for (uint32 VertexIndex = 0; VertexIndex < Model.NumVertices; ++VertexIndex)
+	{
+		RawMesh.VertexPositions[VertexIndex] = VertexBuffer.GetVertexPositionSlow(VertexIndex);
+	}
+
+	for (int32 SectionIndex = 0; SectionIndex < Model.Sections.Num(); ++SectionIndex)
+	{
+		const FSkelMeshSection& Section = Model.Sections[SectionIndex];
+
+		for (uint32 TriangleIndex = 0; TriangleIndex < Section.NumTriangles; ++TriangleIndex)
+		{
+			RawMesh.FaceMaterialIndices.Add(Section.MaterialIndex);
+			RawMesh.FaceSmoothingMasks.Add(1);
+
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 VertexIndex = IndexBuffer->Get(Section.BaseIndex + TriangleIndex * 3 + Corner);
+				const TGPUSkinVertexBase<false>* SrcVertex = VertexBuffer.GetVertexPtr<false>(VertexIndex);
+
+				const FVector TangentX = SrcVertex->TangentX;
+				const FVector TangentZ = SrcVertex->TangentZ;
+				const float BasisSign = SrcVertex->TangentZ.Vector.W > 127 ? 1.0f : -1.0f;
+
+				RawMesh.WedgeIndices.Add(VertexIndex);
+				RawMesh.WedgeTangentX.Add(TangentX);
+				RawMesh.WedgeTangentY.Add((TangentZ ^ TangentX) * BasisSign);
+				RawMesh.WedgeTangentZ.Add(TangentZ);
+
+				for (uint32 TexCoordIndex = 0; TexCoordIndex < Model.NumTexCoords; ++TexCoordIndex)
+				{
+					RawMesh.WedgeTexCoords[TexCoordIndex].Add(VertexBuffer.GetVertexUV(VertexIndex, TexCoordIndex));
+				}
+
+				RawMesh.WedgeTexCoords[VertexIndexCoordinate].Add(FVector2D((VertexIndex + 0.5f) / Model.NumVertices, 0.5f));
+			}
+		}
+	}
+
+	UStaticMesh* StaticMesh = NewNamedObject<UStaticMesh>(Outer, Name, RF_Public | RF_Standalone);
+
+	FStaticMeshSourceModel* SrcModel = new(StaticMesh->SourceModels) FStaticMeshSourceModel();
+
+	// Nothing may change the vertices the texture columns were baked for
+	SrcModel->BuildSettings.bRecomputeNormals = false;
+	SrcModel->BuildSettings.bRecomputeTangents = false;
+	SrcModel->BuildSettings.bRemoveDegenerates = false;
+	SrcModel->BuildSettings.bGenerateLightmapUVs = false;
+	// Half precision can't tell apart the vertex indices of meshes over a couple thousand vertices
+	SrcModel->BuildSettings.bUseFullPrecisionUVs = true;
+	SrcModel->RawMeshBulkData->SaveRawMesh(RawMesh);
+
+	for (int32 MaterialIndex = 0; MaterialIndex < SkeletalMesh->Materials.Num(); ++MaterialIndex)
+	{
+		StaticMesh->Materials.Add(SkeletalMesh->Materials[MaterialIndex].MaterialInterface);
+	}
+
+	StaticMesh->Build();
+	StaticMesh->MarkPackageDirty();
+
+	return StaticMesh;
+}
+
+bool FVertexAnimationTextureBaker::Bake(USkeletalMesh* SkeletalMesh, const UAnimSequence* Sequence, float FrameRate, UObject* Outer, const FString& BaseName, FVertexAnimationTextureBakeResult& OutResult)
+{
+	OutResult = FVertexAnimationTextureBakeResult();
+
+	if (!SkeletalMesh || !Sequence || !SkeletalMesh->GetImportedResource() || SkeletalMesh->GetImportedResource()->LODModels.Num() == 0)
+	{
+		UE_LOG(LogAnimation, Warning, TEXT("FVertexAnimationTextureBaker::Bake: Missing skeletal mesh or sequence."));
+		return false;
+	}
+
+	if (FrameRate <= 0.0f)
+	{
+		UE_LOG(LogAnimation, Warning, TEXT("FVertexAnimationTextureBaker::Bake: Invalid frame rate %f."), FrameRate);
+		return false;
+	}
+
+	if (Sequence->GetSkeleton() != SkeletalMesh->Skeleton)
+	{
+		UE_LOG(LogAnimation, Warning, TEXT("FVertexAnimationTextureBaker::Bake: %s is not for the skeleton of %s."), *Sequence->GetName(), *SkeletalMesh->GetName());
+		return false;
+	}
+
+	const FStaticLODModel& Model = SkeletalMesh->GetImportedResource()->LODModels[0];
+	const int32 NumFrames = FMath::Max(FMath::RoundToInt(Sequence->SequenceLength * FrameRate), 1);
+	const int32 MaxTextureSize = GetMax2DTextureDimension();
+
+	if ((int32)Model.NumVertices > MaxTextureSize || NumFrames * 2 > MaxTextureSize)
+	{
+		UE_LOG(LogAnimation, Warning, TEXT("FVertexAnimationTextureBaker::Bake: %s has %u vertices and %s %i frames, the texture can't be larger than %i."),
+			*SkeletalMesh->GetName(), Model.NumVertices, *Sequence->GetName(), NumFrames, MaxTextureSize);
+		return false;
+	}
+
+	if (Model.NumTexCoords >= MAX_MESH_TEXTURE_COORDS)
+	{
+		UE_LOG(LogAnimation, Warning, TEXT("FVertexAnimationTextureBaker::Bake: %s has no UV channel left for the vertex index."), *SkeletalMesh->GetName());
+		return false;
+	}
+
+	const FReferenceSkeleton& RefSkeleton = SkeletalMesh->RefSkeleton;
+	const int32 NumBones = RefSkeleton.GetNum();
+
+	TArray<FBoneIndexType> RequiredBoneIndices;
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		RequiredBoneIndices.Add(BoneIndex);
+	}
+	FBoneContainer RequiredBones(RequiredBoneIndices, *SkeletalMesh);
+
+	TArray<FVector> RefPositions;
+	RefPositions.SetNumUninitialized(Model.NumVertices);
+	for (uint32 VertexIndex = 0; VertexIndex < Model.NumVertices; ++VertexIndex)
+	{
+		RefPositions[VertexIndex] = Model.VertexBufferGPUSkin.GetVertexPositionSlow(VertexIndex);
+	}
+
+	UTexture2D* Texture = NewNamedObject<UTexture2D>(Outer, FName(*(BaseName + TEXT("_VAT"))), RF_Public | RF_Standalone);
+	Texture->Source.Init(Model.NumVertices, NumFrames * 2, 1, 1, TSF_RGBA16F);
+
+	FFloat16Color* TextureData = (FFloat16Color*)Texture->Source.LockMip(0);
+
+	FTransformArrayA2 LocalAtoms;
+	LocalAtoms.SetNumUninitialized(NumBones);
+	TArray<FTransform> SpaceBases;
+	SpaceBases.SetNumUninitialized(NumBones);
+	TArray<FMatrix> RefToLocals;
+	RefToLocals.SetNumUninitialized(NumBones);
+	TArray<FVector> Positions;
+	TArray<FVector> Normals;
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const float Time = Frame / FrameRate;
+		Sequence->GetAnimationPose(LocalAtoms, RequiredBones, FAnimExtractContext(Time));
+
+		// Bones always come after their parent
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			const int32 ParentIndex = RefSkeleton.GetParentIndex(BoneIndex);
+			SpaceBases[BoneIndex] = (ParentIndex == INDEX_NONE) ? LocalAtoms[BoneIndex] : LocalAtoms[BoneIndex] * SpaceBases[ParentIndex];
+			RefToLocals[BoneIndex] = SkeletalMesh->RefBasesInvMatrix[BoneIndex] * SpaceBases[BoneIndex].ToMatrixWithScale();
+		}
+
+		SkinVertices(Model, RefToLocals, Positions, Normals);
+
+		FFloat16Color* OffsetRow = TextureData + Frame * Model.NumVertices;
+		FFloat16Color* NormalRow = TextureData + (NumFrames + Frame) * Model.NumVertices;
+
+		for (uint32 VertexIndex = 0; VertexIndex < Model.NumVertices; ++VertexIndex)
+		{
+			OffsetRow[VertexIndex] = FFloat16Color(FLinearColor(Positions[VertexIndex] - RefPositions[VertexIndex]));
+			NormalRow[VertexIndex] = FFloat16Color(FLinearColor(Normals[VertexIndex]));
+		}
+	}
+
+	Texture->Source.UnlockMip(0);
+
+	// The texels are vertices, they can't be filtered or compressed
+	Texture->SRGB = false;
+	Texture->CompressionSettings = TC_HDR;
+	Texture->MipGenSettings = TMGS_NoMipmaps;
+	Texture->Filter = TF_Nearest;
+	Texture->AddressX = TA_Clamp;
+	Texture->AddressY = TA_Wrap;
+	Texture->NeverStream = true;
+	Texture->PostEditChange();
+	Texture->MarkPackageDirty();
+
+	OutResult.Texture = Texture;
+	OutResult.NumFrames = NumFrames;
+	OutResult.VertexIndexCoordinate = Model.NumTexCoords;
+	OutResult.StaticMesh = CreateVertexAnimationStaticMesh(SkeletalMesh, Model, Model.NumTexCoords, Outer, FName(*(BaseName + TEXT("_VATMesh"))));
+
+	return true;
+}
+
+#endif // WITH_EDITOR
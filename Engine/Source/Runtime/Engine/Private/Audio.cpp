@@ -25,6 +25,7 @@ DEFINE_LOG_CATEGORY(LogAudio);
 
 DEFINE_STAT(STAT_AudioMemorySize);
 DEFINE_STAT(STAT_ActiveSounds);
+DEFINE_STAT(STAT_VirtualSounds);
 DEFINE_STAT(STAT_AudioSources);
 DEFINE_STAT(STAT_WaveInstances);
 DEFINE_STAT(STAT_WavesDroppedDueToPriority);
@@ -1774,6 +1774,7 @@ void FAudioDevice::StartSources( TArray<FWaveInstance*>& WaveInstances, int32 Fi
 void FAudioDevice::Update( bool bGameTicking )
 {
 	SCOPE_CYCLE_COUNTER( STAT_AudioUpdateTime );
+	MEMORY_TAG_SCOPE( Audio );
 
 	// Start a new frame
 	CurrentTick++;
@@ -260,34 +260,7 @@ void FStreamingWaveData::BeginPendingRequests(const TArray<uint32>& IndicesToLoa
 			else
 #endif // #if WITH_EDITORONLY_DATA
 			{
-				check(Chunk.BulkData.GetFilename().Len());
-				if (Chunk.BulkData.IsStoredCompressedOnDisk())
-				{
-					IORequestIndices.AddUnique(FIOSystem::Get().LoadCompressedData(
-						Chunk.BulkData.GetFilename(),						// filename
-						Chunk.BulkData.GetBulkDataOffsetInFile(),			// offset
-						Chunk.BulkData.GetBulkDataSizeOnDisk(),				// compressed size
-						Chunk.BulkData.GetBulkDataSize(),					// uncompressed size
-						ChunkStorage->Data,									// dest pointer
-						Chunk.BulkData.GetDecompressionFlags(),				// compressed data format
-						&PendingChunkChangeRequestStatus,					// counter to decrement
-						AsyncIOPriority										// priority
-						)
-						);
-				}
-				// Load async.
-				else
-				{
-					IORequestIndices.AddUnique(FIOSystem::Get().LoadData(
-						Chunk.BulkData.GetFilename(),						// filename
-						Chunk.BulkData.GetBulkDataOffsetInFile(),			// offset
-						Chunk.BulkData.GetBulkDataSize(),					// size
-						ChunkStorage->Data,									// dest pointer
-						&PendingChunkChangeRequestStatus,					// counter to decrement
-						AsyncIOPriority										// priority
-						)
-						);
-				}
+				IORequestIndices.AddUnique(Chunk.BulkData.LoadIntoAsync(ChunkStorage->Data, &PendingChunkChangeRequestStatus, AsyncIOPriority));
 				check(IORequestIndices[IORequestIndices.Num() - 1]);
 			}
 		}
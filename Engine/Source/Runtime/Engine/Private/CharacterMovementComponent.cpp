@@ -51,6 +51,22 @@ static TAutoConsoleVariable<float> CVarNetProxyShrinkRadius(
 	TEXT("<= 0: disabled, > 0: shrink by this amount."),
 	ECVF_Default);
 
+static TAutoConsoleVariable<float> CVarNetProxySimplifiedDistance(
+	TEXT("p.NetProxySimplifiedDistance"),
+	0.f,
+	TEXT("Simulated proxies further than this from every local player view only extrapolate their replicated movement, without sweeps nor floor checks.\n")
+	TEXT("See UCharacterMovementComponent::IsSimulatedProxySignificant().\n")
+	TEXT("<= 0: disabled, > 0: distance in world units."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarNetProxyMinSignificance(
+	TEXT("p.NetProxyMinSignificance"),
+	0.f,
+	TEXT("Simulated proxies whose owner is registered to the significance manager only extrapolate their replicated movement below this significance.\n")
+	TEXT("Replaces p.NetProxySimplifiedDistance for those proxies.\n")
+	TEXT("<= 0: disabled, > 0: minimum significance of the full simulation."),
+	ECVF_Default);
+
 static TAutoConsoleVariable<float> CVarNetProxyShrinkHalfHeight(
 	TEXT("p.NetProxyShrinkHalfHeight"),
 	0.01f,
@@ -990,10 +1006,14 @@ void UCharacterMovementComponent::SimulatedTick(float DeltaSeconds)
 		{
 			PerformMovement(DeltaSeconds);
 		}
-		else
+		else if (IsSimulatedProxySignificant())
 		{
 			SimulateMovement(DeltaSeconds);
 		}
+		else
+		{
+			SimulateMovementSimplified(DeltaSeconds);
+		}
 	}
 
 	if( GetNetMode() == NM_Client )
@@ -1171,6 +1191,120 @@ void UCharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 	LastUpdateLocation = UpdatedComponent ? UpdatedComponent->GetComponentLocation() : FVector::ZeroVector;
 }
 
+bool UCharacterMovementComponent::IsSimulatedProxySignificant() const
+{
+	const float MinSignificance = CVarNetProxyMinSignificance.GetValueOnGameThread();
+	float Significance;
+	if (MinSignificance > 0.f && CharacterOwner && GetWorld()->GetSignificanceManager().QuerySignificance(CharacterOwner, Significance))
+	{
+		return Significance >= MinSignificance;
+	}
+
+	const float SimplifiedDistance = CVarNetProxySimplifiedDistance.GetValueOnGameThread();
+	if (SimplifiedDistance <= 0.f || !HasValidData())
+	{
+		return true;
+	}
+
+	const FVector Location = UpdatedComponent->GetComponentLocation();
+	const float SimplifiedDistanceSq = FMath::Square(SimplifiedDistance);
+	bool bHasLocalView = false;
+
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		APlayerController* PlayerController = *Iterator;
+		if (PlayerController && PlayerController->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			if (FVector::DistSquared(ViewLocation, Location) <= SimplifiedDistanceSq)
+			{
+				return true;
+			}
+			bHasLocalView = true;
+		}
+	}
+
+	// Without a local view there is nothing to measure the distance from
+	return !bHasLocalView;
+}
+
+void UCharacterMovementComponent::SimulateMovementSimplified(float DeltaSeconds)
+{
+	if (!HasValidData() || UpdatedComponent->Mobility != EComponentMobility::Movable || UpdatedComponent->IsSimulatingPhysics())
+	{
+		return;
+	}
+
+	// Same early outs as SimulateMovement()
+	if (CharacterOwner->ReplicatedMovement.Location.IsZero() &&
+		CharacterOwner->ReplicatedMovement.Rotation.IsZero() &&
+		CharacterOwner->ReplicatedMovement.LinearVelocity.IsZero())
+	{
+		return;
+	}
+
+	if (CharacterOwner->GetReplicatedBasedMovement().IsBaseUnresolved())
+	{
+		return;
+	}
+
+	// Handle network changes, the floor is not tracked so it isn't updated on teleports
+	if (bNetworkUpdateReceived)
+	{
+		bNetworkUpdateReceived = false;
+		if (bNetworkMovementModeChanged)
+		{
+			bNetworkMovementModeChanged = false;
+			ApplyNetworkMovementMode(CharacterOwner->GetReplicatedMovementMode());
+		}
+		bJustTeleported = false;
+	}
+
+	HandlePendingLaunch();
+
+	if (MovementMode == MOVE_None)
+	{
+		return;
+	}
+
+	Acceleration = Velocity.GetSafeNormal();	// Not currently used for simulated movement
+	AnalogInputModifier = 1.0f;				// Not currently used for simulated movement
+
+	MaybeUpdateBasedMovement(DeltaSeconds);
+
+	const FVector OldVelocity = Velocity;
+	const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+
+	// Falling proxies keep falling until the server says otherwise, walking ones keep the height of their last update
+	if (MovementMode == MOVE_Falling && !CharacterOwner->bSimGravityDisabled)
+	{
+		Velocity = NewFallVelocity(Velocity, FVector(0.f,0.f,GetGravityZ()), DeltaSeconds);
+	}
+	else if (MovementMode == MOVE_Walking)
+	{
+		Velocity.Z = 0.f;
+	}
+
+	// consume path following requested velocity
+	bHasRequestedVelocity = false;
+
+	const FVector Delta = Velocity * DeltaSeconds;
+	if (!Delta.IsNearlyZero())
+	{
+		MoveUpdatedComponent(Delta, CharacterOwner->GetActorRotation(), false);
+	}
+
+	OnMovementUpdated(DeltaSeconds, OldLocation, OldVelocity);
+	CallMovementUpdateDelegate(DeltaSeconds, OldLocation, OldVelocity);
+
+	SaveBaseLocation();
+	UpdateComponentVelocity();
+
+	LastUpdateLocation = UpdatedComponent->GetComponentLocation();
+}
+
 UPrimitiveComponent* UCharacterMovementComponent::GetMovementBase() const
 {
 	return CharacterOwner ? CharacterOwner->GetMovementBase() : NULL;
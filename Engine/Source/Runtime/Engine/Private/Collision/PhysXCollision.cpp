@@ -934,6 +934,173 @@ bool RaycastSingle(const UWorld* World, struct FHitResult& OutHit, const FVector
 	return bHaveBlockingHit;
 }
 
+#if WITH_PHYSX
+
+/**
+ * Pre-filter shader of RaycastSingleBatch, does what FPxQueryFilterCallback::preFilter does for single queries.
+ * word0 of the query filter holds the query type in its lowest bit, and above it the offset in the constant block
+ * of the components ignored by the query: their count followed by their ids.
+ */
+static PxSceneQueryHitType::Enum RaycastSingleBatchPreFilter(PxFilterData QueryFilter, PxFilterData ShapeFilter, const void* ConstantBlock, PxU32 ConstantBlockSize, PxHitFlags& HitFlags)
+{
+	const uint32* IgnoreComponents = (const uint32*)ConstantBlock + (QueryFilter.word0 >> 1);
+	const uint32 NumIgnoreComponents = *IgnoreComponents++;
+	for (uint32 Index = 0; Index < NumIgnoreComponents; Index++)
+	{
+		if (IgnoreComponents[Index] == ShapeFilter.word0)
+		{
+			return PxSceneQueryHitType::eNONE;
+		}
+	}
+
+	QueryFilter.word0 &= 0x1;
+
+	// First check complexity, none of them matches
+	const PxU32 CommonFlags = ShapeFilter.word3 & QueryFilter.word3 & 0xFFFFFF;
+	if (!(CommonFlags & EPDF_SimpleCollision) && !(CommonFlags & EPDF_ComplexCollision))
+	{
+		return PxSceneQueryHitType::eNONE;
+	}
+
+	const PxSceneQueryHitType::Enum Result = FPxQueryFilterCallback::CalcQueryHitType(QueryFilter, ShapeFilter, true);
+
+	// Touches are meaningless for single queries
+	return (Result == PxSceneQueryHitType::eTOUCH) ? PxSceneQueryHitType::eNONE : Result;
+}
+
+bool CanRaycastSingleBatch(const UWorld* World, const struct FCollisionQueryParams& Params)
+{
+	if ((World == NULL) || (World->GetPhysicsScene() == NULL))
+	{
+		return false;
+	}
+
+	// The async scene is only queried by RaycastSingle, as it needs the closest of the two blocking hits
+	if (Params.bTraceAsyncScene && World->GetPhysicsScene()->HasAsyncScene())
+	{
+		return false;
+	}
+
+#if WITH_BOX2D
+	if (GetDefault<UPhysicsSettings>()->bEnable2DPhysics)
+	{
+		return false;
+	}
+#endif // WITH_BOX2D
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	if ((World->DebugDrawTraceTag != NAME_None) && (World->DebugDrawTraceTag == Params.TraceTag))
+	{
+		return false;
+	}
+#endif //!(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+
+	return true;
+}
+
+void RaycastSingleBatch(const UWorld* World, FTraceDatum* const* Traces, int32 NumTraces)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Collision_RaycastSingleBatch);
+
+	// The ignore lists are put in the constant block of the batch, consecutive traces usually come from the same requester and share theirs
+	TArray<uint32, TInlineAllocator<ASYNC_TRACE_BUFFER_SIZE * 2> > IgnoreComponentLists;
+	TArray<PxFilterData, TInlineAllocator<ASYNC_TRACE_BUFFER_SIZE> > QueryFilters;
+	TArray<FTraceDatum*, TInlineAllocator<ASYNC_TRACE_BUFFER_SIZE> > QueryTraces;
+	const TArray<uint32, TInlineAllocator<1> >* LastIgnoreComponents = NULL;
+	uint32 IgnoreComponentsOffset = 0;
+
+	for (int32 TraceIndex = 0; TraceIndex < NumTraces; TraceIndex++)
+	{
+		FTraceDatum& Trace = *Traces[TraceIndex];
+		const FCollisionQueryParams& Params = Trace.CollisionParams.CollisionQueryParam;
+
+		Trace.OutHits.AddZeroed(1);
+		Trace.OutHits[0].TraceStart = Trace.Start;
+		Trace.OutHits[0].TraceEnd = Trace.End;
+
+		if ((Trace.End - Trace.Start).SizeSquared() <= FMath::Square(KINDA_SMALL_NUMBER))
+		{
+			continue;
+		}
+
+		if (LastIgnoreComponents == NULL || *LastIgnoreComponents != Params.IgnoreComponents)
+		{
+			LastIgnoreComponents = &Params.IgnoreComponents;
+			IgnoreComponentsOffset = IgnoreComponentLists.Num();
+			IgnoreComponentLists.Add(Params.IgnoreComponents.Num());
+			IgnoreComponentLists.Append(Params.IgnoreComponents);
+		}
+
+		QueryFilters.Add(CreateQueryFilterData(Trace.TraceChannel, Params.bTraceComplex, Trace.CollisionParams.ResponseParam.CollisionResponse, Trace.CollisionParams.ObjectQueryParam, false));
+		QueryFilters.Last().word0 |= IgnoreComponentsOffset << 1;
+		QueryTraces.Add(&Trace);
+	}
+
+	const int32 NumQueries = QueryTraces.Num();
+	if (NumQueries == 0)
+	{
+		return;
+	}
+
+	TArray<PxRaycastQueryResult, TInlineAllocator<ASYNC_TRACE_BUFFER_SIZE> > Results;
+	Results.AddUninitialized(NumQueries);
+
+	PxBatchQueryDesc BatchDesc(NumQueries, 0, 0);
+	BatchDesc.queryMemory.userRaycastResultBuffer = Results.GetData();
+	BatchDesc.filterShaderData = IgnoreComponentLists.GetData();
+	BatchDesc.filterShaderDataSize = IgnoreComponentLists.Num() * sizeof(uint32);
+	BatchDesc.preFilterShader = RaycastSingleBatchPreFilter;
+
+	PxScene* SyncScene = World->GetPhysicsScene()->GetPhysXScene(PST_Sync);
+	PxBatchQuery* BatchQuery = NULL;
+	{
+		// The scene keeps a list of its batch queries, which isn't safe to change under a read lock
+		SCOPED_SCENE_WRITE_LOCK(SyncScene);
+		BatchQuery = SyncScene->createBatchQuery(BatchDesc);
+	}
+
+	const PxSceneQueryFlags POutputFlags = PxSceneQueryFlag::ePOSITION | PxSceneQueryFlag::eNORMAL | PxSceneQueryFlag::eDISTANCE | PxSceneQueryFlag::eMTD;
+
+	for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+	{
+		const FTraceDatum& Trace = *QueryTraces[QueryIndex];
+		const FVector Delta = Trace.End - Trace.Start;
+		const float DeltaMag = Delta.Size();
+
+		PxSceneQueryFilterData PQueryFilterData(QueryFilters[QueryIndex], PxSceneQueryFilterFlag::eSTATIC | PxSceneQueryFilterFlag::eDYNAMIC | PxSceneQueryFilterFlag::ePREFILTER);
+		BatchQuery->raycast(U2PVector(Trace.Start), U2PVector(Delta / DeltaMag), DeltaMag, 0, POutputFlags, PQueryFilterData);
+	}
+
+	{
+		// The hits are converted under the lock as well, as that reads the shapes that were hit
+		SCOPED_SCENE_READ_LOCK(SyncScene);
+		BatchQuery->execute();
+
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+		{
+			FTraceDatum& Trace = *QueryTraces[QueryIndex];
+			const PxRaycastQueryResult& Result = Results[QueryIndex];
+
+			if (Result.queryStatus == PxBatchQueryStatus::eSUCCESS && Result.hasBlock)
+			{
+				const FCollisionQueryParams& Params = Trace.CollisionParams.CollisionQueryParam;
+				PxFilterData PFilter = QueryFilters[QueryIndex];
+				PFilter.word0 &= 0x1;
+
+				const PxTransform PStartTM(U2PVector(Trace.Start));
+				ConvertQueryImpactHit(Result.block, Trace.OutHits[0], (Trace.End - Trace.Start).Size(), PFilter, Trace.Start, Trace.End, NULL, PStartTM, Params.bReturnFaceIndex, Params.bReturnPhysicalMaterial);
+			}
+		}
+	}
+
+	{
+		SCOPED_SCENE_WRITE_LOCK(SyncScene);
+		BatchQuery->release();
+	}
+}
+
+#endif // WITH_PHYSX
+
 bool RaycastMulti(const UWorld* World, TArray<struct FHitResult>& OutHits, const FVector& Start, const FVector& End, ECollisionChannel TraceChannel, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParams, const struct FCollisionObjectQueryParams& ObjectParams)
 {
 	if ((World == NULL) || (World->GetPhysicsScene() == NULL))
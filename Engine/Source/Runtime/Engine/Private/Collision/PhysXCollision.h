@@ -149,6 +149,17 @@ PxTransform ConvertToPhysXCapsulePose(const FTransform& GeomPose);
 /** Utility for creating a PhysX PxFilterData for performing a query (trace) against the scene */
 PxFilterData CreateQueryFilterData(const uint8 MyChannel, const bool bTraceComplex, const FCollisionResponseContainer& InCollisionResponseContainer, const struct FCollisionObjectQueryParams & ObjectParam, const bool bMultitrace);
 
+// BATCHED RAYCAST
+
+/** Whether RaycastSingleBatch gives the same result as RaycastSingle for a trace with these params, it only queries the sync scene and doesn't debug draw */
+bool CanRaycastSingleBatch(const UWorld* World, const struct FCollisionQueryParams& Params);
+
+/**
+ * Runs the single line traces of async trace requests as one PhysX batch query, the result of each is written to its OutHits[0].
+ * The filter setup is done once for the batch, and the scene queried with a single lock. Every trace must pass CanRaycastSingleBatch for World.
+ */
+void RaycastSingleBatch(const UWorld* World, struct FTraceDatum* const* Traces, int32 NumTraces);
+
 #endif // WITH_PHYX
 
 
@@ -29,6 +29,7 @@ DEFINE_LOG_CATEGORY(LogCollision);
 
 DEFINE_STAT(STAT_Collision_RaycastAny);
 DEFINE_STAT(STAT_Collision_RaycastSingle);
+DEFINE_STAT(STAT_Collision_RaycastSingleBatch);
 DEFINE_STAT(STAT_Collision_RaycastMultiple);
 DEFINE_STAT(STAT_Collision_GeomSweepAny);
 DEFINE_STAT(STAT_Collision_GeomSweepSingle);
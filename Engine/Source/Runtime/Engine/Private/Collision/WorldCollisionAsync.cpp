@@ -90,6 +90,12 @@ namespace
 #if UE_WITH_PHYSICS
 		check(TraceDataBuffer);
 
+#if WITH_PHYSX
+		// Single line traces of the world are collected and run as one batch at the end, the rest is run one by one
+		const UWorld* BatchWorld = TraceDataBuffer->PhysWorld.Get();
+		TArray<FTraceDatum*, TInlineAllocator<ASYNC_TRACE_BUFFER_SIZE> > BatchedTraces;
+#endif // WITH_PHYSX
+
 		for (; TotalCount; --TotalCount)
 		{
 			FTraceDatum& TraceData = *TraceDataBuffer++;
@@ -99,6 +105,13 @@ namespace
 			{
 				if ((TraceData.CollisionParams.CollisionShape.ShapeType == ECollisionShape::Line) || TraceData.CollisionParams.CollisionShape.IsNearlyZero())
 				{
+#if WITH_PHYSX
+					if (!TraceData.bIsMultiTrace && TraceData.PhysWorld.Get() == BatchWorld && CanRaycastSingleBatch(BatchWorld, TraceData.CollisionParams.CollisionQueryParam))
+					{
+						BatchedTraces.Add(&TraceData);
+					}
+					else
+#endif // WITH_PHYSX
 					if (TraceData.bIsMultiTrace)
 					{
 						RaycastMulti(TraceData.PhysWorld.Get(), TraceData.OutHits, TraceData.Start, TraceData.End, TraceData.TraceChannel,
@@ -127,6 +140,13 @@ namespace
 				}
 			}
 		}
+
+#if WITH_PHYSX
+		if (BatchedTraces.Num() > 0)
+		{
+			RaycastSingleBatch(BatchWorld, BatchedTraces.GetData(), BatchedTraces.Num());
+		}
+#endif // WITH_PHYSX
 	#endif //UE_WITH_PHYSICS
 	}
 
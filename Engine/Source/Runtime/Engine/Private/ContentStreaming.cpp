@@ -7,8 +7,10 @@
 #include "EnginePrivate.h"
 #include "GenericPlatformMemoryPoolStats.h"
 #include "AudioStreaming.h"
+#include "MeshStreaming.h"
 #include "Engine/LightMapTexture2D.h"
 #include "Engine/ShadowMapTexture2D.h"
+#include "ParallelFor.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogContentStreaming, Log, All);
 
@@ -141,6 +143,20 @@ static TAutoConsoleVariable<int32> CVarSetTextureStreaming(
 	ECVF_Default | ECVF_RenderThreadSafe);
 #endif
 
+static TAutoConsoleVariable<int32> CVarStreamingUseGPUFeedback(
+	TEXT("r.Streaming.UseGPUFeedback"),
+	0,
+	TEXT("Whether the mips reported with FStreamingManagerTexture::SetTextureFeedback replace the distance based heuristics.\n")
+	TEXT("0: off (default)\n")
+	TEXT("1: on"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamingGPUFeedbackTimeout(
+	TEXT("r.Streaming.GPUFeedbackTimeout"),
+	2.0f,
+	TEXT("Seconds the feedback reported for a texture is used, after that the texture goes back to the distance based heuristics."),
+	ECVF_Default);
+
 static TAutoConsoleVariable<int32> CVarStreamingUseFixedPoolSize(
 	TEXT("r.Streaming.UseFixedPoolSize"),
 	0,
@@ -211,6 +227,7 @@ enum ETextureStreamingType
 	StreamType_Forced,
 	StreamType_LastRenderTime,
 	StreamType_Orphaned,
+	StreamType_Feedback,
 	StreamType_Other,
 };
 
@@ -221,6 +238,7 @@ static const TCHAR* GStreamTypeNames[] =
 	TEXT("Forced"),
 	TEXT("LastRenderTime"),
 	TEXT("Orphaned"),
+	TEXT("Feedback"),
 	TEXT("Other"),
 };
 
@@ -258,9 +276,12 @@ struct FStreamingTexture
 		bUsesLastRenderHeuristics = false;
 		bUsesForcedHeuristics = false;
 		bUsesOrphanedHeuristics = false;
+		bUsesFeedbackHeuristics = false;
 		bNeedPrimitiveUpdate = false;
 		BoostFactor = 1.0f;
 		InstanceRemovedTimestamp = -FLT_MAX;
+		FeedbackTimestamp = -FLT_MAX;
+		FeedbackMips = 0;
 		LastRenderTimeRefCountTimestamp = -FLT_MAX;
 		LastRenderTimeRefCount = 0;
 
@@ -298,6 +319,10 @@ struct FStreamingTexture
 		{
 			return StreamType_Forced;
 		}
+		else if ( bUsesFeedbackHeuristics )
+		{
+			return StreamType_Feedback;
+		}
 		else if ( bUsesDynamicHeuristics )
 		{
 			return StreamType_Dynamic;
@@ -450,6 +475,11 @@ struct FStreamingTexture
 	/** Current number of instances that need LRT heuristics for this texture. */
 	int32			LastRenderTimeRefCount;
 
+	/** FApp::GetCurrentTime() when FeedbackMips was last reported, see FStreamingManagerTexture::SetTextureFeedback. */
+	double			FeedbackTimestamp;
+	/** Number of mips the GPU sampled from this texture, as last reported. */
+	int32			FeedbackMips;
+
 	/**
 	 * Temporary boost of the streaming distance factor.
 	 * This factor is automatically reset to 1.0 after it's been used for mip-calculations.
@@ -474,6 +504,8 @@ struct FStreamingTexture
 	uint32			bUsesForcedHeuristics : 1;
 	/** Whether this texture uses the OrphanedTexture heuristics. */
 	uint32			bUsesOrphanedHeuristics : 1;
+	/** Whether this texture uses the mips reported by the GPU feedback instead of the other heuristics. */
+	uint32			bUsesFeedbackHeuristics : 1;
 	/** Whether this texture has been replaced in a material and all primitives using it call NotifyPrimitiveUpdated(). */
 	uint32			bNeedPrimitiveUpdate : 1;
 };
@@ -1114,18 +1146,22 @@ private:
 		// Number of textures that want more mips.
 		ThreadStats.NumWantingTextures = 0;
 
-		for ( int32 Index=0; Index < StreamingManager.StreamingTextures.Num() && !IsAborted(); ++Index )
+		// The wanted mips of each texture only depend on the texture itself and the thread settings (views and instances
+		// cached by UpdateThreadData), so they are computed in parallel. The stats and priorities are gathered serially below.
+		ParallelFor( StreamingManager.StreamingTextures.Num(), [&]( int32 Index )
 		{
 			FStreamingTexture& StreamingTexture = StreamingManager.StreamingTextures[ Index ];
-
-			int32 ResidentTextureSize = StreamingTexture.GetSize( StreamingTexture.ResidentMips );
-			ThreadStats.TotalResidentSize += ResidentTextureSize;
+			if ( IsAborted() )
+			{
+				return;
+			}
 
 			StreamingTexture.bUsesStaticHeuristics = false;
 			StreamingTexture.bUsesDynamicHeuristics = (StreamingTexture.DynamicScreenSize > 0.0f) ? true : false;
 			StreamingTexture.bUsesLastRenderHeuristics = false;
 			StreamingTexture.bUsesForcedHeuristics = false;
 			StreamingTexture.bUsesOrphanedHeuristics = false;
+			StreamingTexture.bUsesFeedbackHeuristics = false;
 
 			if ( StreamingTexture.bReadyForStreaming )
 			{
@@ -1134,7 +1170,18 @@ private:
 
 				// Determine how many mips this texture should have in memory.
 				StreamingManager.CalcWantedMips( StreamingTexture );
+			}
+		});
 
+		for ( int32 Index=0; Index < StreamingManager.StreamingTextures.Num() && !IsAborted(); ++Index )
+		{
+			FStreamingTexture& StreamingTexture = StreamingManager.StreamingTextures[ Index ];
+
+			int32 ResidentTextureSize = StreamingTexture.GetSize( StreamingTexture.ResidentMips );
+			ThreadStats.TotalResidentSize += ResidentTextureSize;
+
+			if ( StreamingTexture.bReadyForStreaming )
+			{
 				if ( StreamingTexture.WantedMips > StreamingTexture.ResidentMips )
 				{
 					ThreadStats.NumWantingTextures++;
@@ -1589,6 +1636,9 @@ FStreamingManagerCollection::FStreamingManagerCollection()
 
 	AudioStreamingManager = new FAudioStreamingManager();
 	AddStreamingManager( AudioStreamingManager );
+
+	MeshStreamingManager = new FStreamingManagerMesh();
+	AddStreamingManager( MeshStreamingManager );
 }
 
 /**
@@ -1784,6 +1834,12 @@ IAudioStreamingManager& FStreamingManagerCollection::GetAudioStreamingManager()
 	return *AudioStreamingManager;
 }
 
+IMeshStreamingManager& FStreamingManagerCollection::GetMeshStreamingManager() const
+{
+	check(MeshStreamingManager);
+	return *MeshStreamingManager;
+}
+
 /** Don't stream world resources for the next NumFrames. */
 void FStreamingManagerCollection::SetDisregardWorldResourcesForFrames(int32 NumFrames )
 {
@@ -2186,6 +2242,9 @@ FStreamingManagerTexture::FStreamingManagerTexture()
 		FTextureLODSettings::FTextureLODGroup& TexGroup = GSystemSettings.TextureLODSettings.GetTextureLODGroup( LODGroup );
 		ThreadSettings.NumStreamedMips[LODGroup] = TexGroup.NumStreamedMips;
 	}
+	ThreadSettings.bOnlyStreamInTextures = false;
+	ThreadSettings.bUseGPUFeedback = false;
+	ThreadSettings.GPUFeedbackTimeout = 0.0f;
 
 	// setup the streaming resource flush function pointer
 	GFlushStreamingFunc = &FlushResourceStreaming;
@@ -2485,6 +2544,21 @@ void FStreamingManagerTexture::UpdateThreadData()
 	}
 	PendingStreamingTextures.Empty();
 
+	// Apply the GPU feedback reported since the last update.
+	const double CurrentTime = FApp::GetCurrentTime();
+	for ( TMap<UTexture2D*,int32>::TConstIterator It(PendingTextureFeedback); It; ++It )
+	{
+		UTexture2D* Texture = It.Key();
+		int32 Index = Texture->StreamingIndex;
+		if ( Index >= 0 && Index < StreamingTextures.Num() && StreamingTextures[ Index ].Texture == Texture )
+		{
+			FStreamingTexture& StreamingTexture = StreamingTextures[ Index ];
+			StreamingTexture.FeedbackMips = It.Value();
+			StreamingTexture.FeedbackTimestamp = CurrentTime;
+		}
+	}
+	PendingTextureFeedback.Reset();
+
 	// Remove old levels. Note: Don't try to access the ULevel object, it may have been deleted already!
 	for ( int32 LevelIndex=0; LevelIndex < ThreadSettings.LevelData.Num(); ++LevelIndex )
 	{
@@ -2581,6 +2655,12 @@ void FStreamingManagerTexture::UpdateThreadData()
 	
 	ThreadSettings.MipBias = FMath::Max(CVarStreamingMipBias.GetValueOnGameThread(), 0.0f);
 
+	static const auto CVarOnlyStreamInTextures = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("r.OnlyStreamInTextures"));
+	ThreadSettings.bOnlyStreamInTextures = CVarOnlyStreamInTextures->GetValueOnGameThread() != 0;
+
+	ThreadSettings.bUseGPUFeedback = CVarStreamingUseGPUFeedback.GetValueOnGameThread() != 0;
+	ThreadSettings.GPUFeedbackTimeout = CVarStreamingGPUFeedbackTimeout.GetValueOnGameThread();
+
 	// Update the thread-safe cache information for dynamic primitives.
 	UpdateDynamicPrimitiveCache();
 }
@@ -2852,6 +2932,20 @@ void FStreamingManagerTexture::RemoveStreamingTexture( UTexture2D* Texture )
 
 //	checkSlow( Texture->StreamingIndex == -1 );	// The texture should have been in one of the two arrays!
 	Texture->StreamingIndex = -1;
+
+	PendingTextureFeedback.Remove( Texture );
+}
+
+/**
+ * Reports the number of mips the GPU sampled from a texture.
+ */
+void FStreamingManagerTexture::SetTextureFeedback( UTexture2D* Texture, int32 SampledMips )
+{
+	check( IsInGameThread() );
+
+	// Several reports between two updates keep the largest one.
+	int32& PendingMips = PendingTextureFeedback.FindOrAdd( Texture );
+	PendingMips = FMath::Max( PendingMips, SampledMips );
 }
 
 /** Called when an actor is spawned. */
@@ -3930,8 +4024,7 @@ void FStreamingManagerTexture::CalcMinMaxMips( FStreamingTexture& StreamingTextu
 	// Don't stream in all referenced textures but rather only those that have been rendered in the last 5 minutes if
 	// we only stream in textures. This means you still might see texture popping, but the option is designed to avoid
 	// hitching due to CPU overhead, which is still taken care off by the 5 minute rule.
-	static auto CVarOnlyStreamInTextures = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("r.OnlyStreamInTextures"));
-	if( CVarOnlyStreamInTextures->GetValueOnAnyThread() != 0 )
+	if( ThreadSettings.bOnlyStreamInTextures )
 	{
 		float SecondsSinceLastRender = StreamingTexture.LastRenderTime;
 		if( SecondsSinceLastRender < 300 )
@@ -4033,8 +4126,18 @@ void FStreamingManagerTexture::CalcWantedMips( FStreamingTexture& StreamingTextu
 	float MinDistance = StreamingTexture.bUsesDynamicHeuristics ? FMath::Sqrt(StreamingTexture.DynamicMinDistanceSq) : FLT_MAX;
 	STAT(FFloatMipLevel PerfectWantedMips = WantedMips);
 
+	const bool bUseFeedback = ThreadSettings.bUseGPUFeedback && (FApp::GetCurrentTime() - StreamingTexture.FeedbackTimestamp) < ThreadSettings.GPUFeedbackTimeout;
+
 	// Figure out miplevels to request based on handlers.
-	if ( StreamingTexture.MinAllowedMips != StreamingTexture.MaxAllowedMips )
+	if ( StreamingTexture.MinAllowedMips != StreamingTexture.MaxAllowedMips && bUseFeedback )
+	{
+		// The GPU reported what it actually sampled, which the bounds and texel factors can only overestimate.
+		WantedMips = FFloatMipLevel::FromMipLevel( StreamingTexture.FeedbackMips );
+		STAT( PerfectWantedMips = WantedMips );
+		MinDistance = 0.0f;
+		StreamingTexture.bUsesFeedbackHeuristics = true;
+	}
+	else if ( StreamingTexture.MinAllowedMips != StreamingTexture.MaxAllowedMips )
 	{
 		// Iterate over all handlers and figure out the maximum requested number of mips.
 		for( int32 HandlerIndex=0; HandlerIndex<TextureStreamingHandlers.Num(); HandlerIndex++ )
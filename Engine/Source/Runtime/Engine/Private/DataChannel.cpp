@@ -731,7 +731,7 @@ FPacketIdRange UChannel::SendBunch( FOutBunch* Bunch, bool Merge )
 		Bunch                          = &Connection->LastOut;
 		check(!Bunch->IsError());
 		Connection->LastStart.Pop( Connection->SendBuffer );
-		Connection->Driver->OutBunches--;
+		FPlatformAtomics::InterlockedDecrement( (volatile int32*)&Connection->Driver->OutBunches );
 	}
 
 	//-----------------------------------------------------
@@ -900,11 +900,11 @@ FOutBunch* UChannel::PrepBunch(FOutBunch* Bunch, FOutBunch* OutBunch, bool Merge
 		Connection->LastOutBunch = OutBunch;
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-		if (CVarNetReliableDebug.GetValueOnGameThread() == 1)
+		if (CVarNetReliableDebug.GetValueOnAnyThread() == 1)
 		{
 			UE_LOG(LogNetTraffic, Warning, TEXT("%s. Reliable: %s"), *Describe(), *Bunch->DebugString);
 		}
-		if (CVarNetReliableDebug.GetValueOnGameThread() == 2)
+		if (CVarNetReliableDebug.GetValueOnAnyThread() == 2)
 		{
 			UE_LOG(LogNetTraffic, Warning, TEXT("%s. Reliable: %s"), *Describe(), *Bunch->DebugString);
 			PrintReliableBunchBuffer();
@@ -1365,7 +1365,7 @@ void UActorChannel::Close()
 
 			// Validation checking
 			static const auto ValidateCVar = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("net.DormancyValidate"));
-			if ( ValidateCVar && ValidateCVar->GetValueOnGameThread() > 0 )
+			if ( ValidateCVar && ValidateCVar->GetValueOnAnyThread() > 0 )
 			{
 				bKeepReplicators = true;		// We need to keep the replicators around so we can use
 			}
@@ -1959,7 +1959,7 @@ bool UActorChannel::ReplicateActor()
 	}
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-	if (CVarNetReliableDebug.GetValueOnGameThread() > 0)
+	if (CVarNetReliableDebug.GetValueOnAnyThread() > 0)
 	{
 		Bunch.DebugString = FString::Printf(TEXT("%.2f ActorBunch: %s"), Connection->Driver->Time, *Actor->GetName() );
 	}
@@ -2525,9 +2525,13 @@ bool UActorChannel::ReplicateSubobject(UObject *Obj, FOutBunch &Bunch, const FRe
 	// here, by forcing the packagemap to give them a NetGUID.
 	//
 	// Once we can lazily handle unmapped references on the client side, this can be simplified.
-	if ( !Connection->Driver->GuidCache->SupportsObject( Obj ) )
 	{
-		FNetworkGUID NetGUID = Connection->Driver->GuidCache->AssignNewNetGUID_Server( Obj );	//Make sure he gets a NetGUID so that he is now 'supported'
+		FNetParallelReplicationScopeLock GuidCacheLock( Connection->Driver );
+
+		if ( !Connection->Driver->GuidCache->SupportsObject( Obj ) )
+		{
+			FNetworkGUID NetGUID = Connection->Driver->GuidCache->AssignNewNetGUID_Server( Obj );	//Make sure he gets a NetGUID so that he is now 'supported'
+		}
 	}
 
 	bool NewSubobject = false;
@@ -244,6 +244,12 @@ void FObjectReplicator::StartReplicating( class UActorChannel * InActorChannel )
 	ObjectNetGUID = OwningChannel->Connection->Driver->GuidCache->GetOrAssignNetGUID( GetObject() );
 	check( !ObjectNetGUID.IsDefault() && ObjectNetGUID.IsValid() );
 
+	// Movement baselines only make sense within a channel, a replicator coming back from dormancy starts from full values
+	if ( RepState != NULL )
+	{
+		RepState->MovementHistories.Empty();
+	}
+
 	// Allocate retirement list.
 	// SetNum now constructs, so this is safe
 	Retirement.SetNum( ObjectClass->ClassReps.Num() );
@@ -847,6 +853,9 @@ void FObjectReplicator::ReplicateCustomDeltaProperties( FOutBunch & Bunch, int32
 
 	UNetConnection * OwningChannelConnection = OwningChannel->Connection;
 
+	// Custom delta serializers (fast arrays) update state on the object itself, which the other connections share
+	FNetParallelReplicationScopeLock SharedStateLock( OwningChannelConnection->Driver );
+
 	// Replicate those properties.
 	for ( int32 i = 0; i < LifetimeCustomDeltaProperties.Num(); i++ )
 	{
@@ -939,7 +948,7 @@ bool FObjectReplicator::ReplicateProperties( FOutBunch & Bunch, FReplicationFlag
 	{
 		static const auto* CVar = IConsoleManager::Get().FindTConsoleVariableDataInt( TEXT( "net.RPC.Debug" ) );
 
-		if ( CVar && CVar->GetValueOnGameThread() == 1 )
+		if ( CVar && CVar->GetValueOnAnyThread() == 1 )
 		{
 			UE_LOG( LogNetTraffic, Warning,	TEXT("      Sending queued RPCs: %s. Channel[%d] [%.1f bytes]"), *Object->GetName(), OwningChannel->ChIndex, RemoteFunctions->GetNumBits() / 8.f );
 		}
@@ -15,14 +15,19 @@
 #include "GameFramework/PlayerStart.h"
 #include "GameFramework/SpectatorPawnMovement.h"
 #include "Engine/GameInstance.h"
+#include "Net/DemoStream.h"
 
 DEFINE_LOG_CATEGORY_STATIC( LogDemo, Log, All );
 
 static TAutoConsoleVariable<float> CVarDemoRecordHz( TEXT( "demo.RecordHz" ), 10, TEXT( "Number of demo frames recorded per second" ) );
 static TAutoConsoleVariable<float> CVarDemoTimeDilation( TEXT( "demo.TimeDilation" ), -1.0f, TEXT( "Override time dilation during demo playback (-1 = don't override)" ) );
+static TAutoConsoleVariable<float> CVarDemoCheckpointInterval( TEXT( "demo.CheckpointInterval" ), 30.0f, TEXT( "Seconds of demo time between checkpoints, playback can only jump back to a checkpoint (0 = no checkpoints)" ) );
 
 static const int32 MAX_DEMO_READ_WRITE_BUFFER = 1024 * 2;
 
+/** Recorded frames are handed over to the stream writer once they fill this many bytes */
+static const int32 DEMO_CHUNK_SIZE = 1024 * 64;
+
 #define DEMO_CHECKSUMS 0		// When setting this to 1, this will invalidate all demos, you will need to re-record and playback
 
 /*-----------------------------------------------------------------------------
@@ -43,6 +48,8 @@ bool UDemoNetDriver::InitBase( bool bInitAsClient, FNetworkNotify* InNotify, con
 		bIsRecordingDemoFrame	= false;
 		bDemoPlaybackDone		= false;
 		EndOfStreamOffset		= 0;
+		CurrentChunkIndex		= INDEX_NONE;
+		CheckpointConnection	= NULL;
 
 		ResetDemoState();
 
@@ -61,6 +68,12 @@ void UDemoNetDriver::FinishDestroy()
 		{
 			StopDemo();
 		}
+
+		delete StreamWriter;
+		StreamWriter = NULL;
+
+		delete StreamReader;
+		StreamReader = NULL;
 	}
 
 	Super::FinishDestroy();
@@ -72,7 +85,7 @@ FString UDemoNetDriver::LowLevelGetNetworkNumber()
 }
 
 #define NETWORK_DEMO_MAGIC			( 0x2CF5A13D )
-#define NETWORK_DEMO_VERSION		( 0 )
+#define NETWORK_DEMO_VERSION		( 1 )		// 1: Frames are stored in compressed chunks, with checkpoints
 
 struct FNetworkDemoHeader
 {
@@ -113,6 +126,8 @@ void UDemoNetDriver::ResetDemoState()
 {
 	DemoFrameNum	= 0;
 	LastRecordTime	= 0;
+	ChunkStartTime	= 0;
+	LastCheckpointTime	= 0;
 	DemoDeltaTime	= 0;
 	DemoTotalTime	= 0;
 	DemoCurrentTime	= 0;
@@ -265,9 +280,24 @@ bool UDemoNetDriver::InitConnect( FNetworkNotify* InNotify, const FURL& ConnectU
 	// Jump back to start of stream
 	FileAr->Seek( OldPos );
 
-	// Remember where the meta data is, this is where we must stop reading the demo stream
+	// Remember where the meta data is, this is where we must stop reading the demo stream (0 if the recording was cut short)
 	EndOfStreamOffset = DemoHeader.MetaDataOffset;
 
+	// The file now belongs to the stream reader, frames are read from the current chunk
+	StreamReader	= new FDemoStreamReader( FileAr, EndOfStreamOffset );
+	FileAr			= new FMemoryReader( ChunkData );
+
+	CurrentChunkIndex = INDEX_NONE;
+
+	const TArray< FDemoChunkInfo >& Chunks = StreamReader->GetChunks();
+
+	if ( DemoTotalTime == 0 && Chunks.Num() > 0 )
+	{
+		DemoTotalTime = Chunks.Last().Header.EndTime;
+	}
+
+	StreamReader->PrefetchChunk( 0 );
+
 	return true;
 }
 
@@ -314,6 +344,10 @@ bool UDemoNetDriver::InitListen( FNetworkNotify* InNotify, FURL& ListenURL, bool
 	// Write the initial header (a lot of the fields will be placeholder until we fill them in later)
 	(*FileAr) << DemoHeader;
 
+	// The file now belongs to the stream writer, frames are recorded in memory until they fill a chunk
+	StreamWriter	= new FDemoStreamWriter( FileAr );
+	FileAr			= new FMemoryWriter( ChunkData );
+
 	// Spawn the demo recording spectator.
 	SpawnDemoRecSpectator( Connection );
 
@@ -417,8 +451,13 @@ void UDemoNetDriver::StopDemo()
 	if ( !ServerConnection )
 	{
 		// Finish writing the header and other information that goes at the end
-		if ( FileAr != NULL && World != NULL )
+		if ( StreamWriter != NULL && World != NULL )
 		{
+			FlushRecordedChunk();
+
+			// Wait for the writer thread to be done with the chunks, the file is ours again
+			FArchive* DemoFileAr = StreamWriter->Finish();
+
 			DemoTotalFrames = DemoFrameNum;
 			DemoTotalTime	= DemoCurrentTime;
 
@@ -439,17 +478,17 @@ void UDemoNetDriver::StopDemo()
 			DemoHeader.LevelName			= World->GetCurrentLevel()->GetOutermost()->GetName();
 			DemoHeader.NumFrames			= DemoTotalFrames;
 			DemoHeader.TotalTime			= DemoTotalTime;
-			DemoHeader.MetaDataOffset		= FileAr->Tell();
+			DemoHeader.MetaDataOffset		= DemoFileAr->Tell();
 			DemoHeader.NumStreamingLevels	= NumStreamingLevels;
 
 			// Seek to beginning
-			FileAr->Seek( 0 );
+			DemoFileAr->Seek( 0 );
 
 			// Re-write header with new info
-			(*FileAr) << DemoHeader;
+			(*DemoFileAr) << DemoHeader;
 
 			// Restore file position to end of stream
-			FileAr->Seek( DemoHeader.MetaDataOffset );
+			DemoFileAr->Seek( DemoHeader.MetaDataOffset );
 
 			//
 			// Write meta data
@@ -466,13 +505,18 @@ void UDemoNetDriver::StopDemo()
 
 					UE_LOG( LogDemo, Log, TEXT( "  StreamingLevel: %s, %s" ), *PackageName, *PackageNameToLoad );
 
-					(*FileAr) << PackageName;
-					(*FileAr) << PackageNameToLoad;
-					(*FileAr) << World->StreamingLevels[i]->LevelTransform;
+					(*DemoFileAr) << PackageName;
+					(*DemoFileAr) << PackageNameToLoad;
+					(*DemoFileAr) << World->StreamingLevels[i]->LevelTransform;
 				}
 			}
+
+			delete DemoFileAr;
 		}
 
+		delete StreamWriter;
+		StreamWriter = NULL;
+
 		// let GC cleanup the object
 		if ( ClientConnections.Num() > 0 && ClientConnections[0] != NULL )
 		{
@@ -489,11 +533,16 @@ void UDemoNetDriver::StopDemo()
 		ServerConnection->Close();
 		ServerConnection->CleanUp(); // make sure DemoRecSpectator gets destroyed immediately
 		ServerConnection = NULL;
+
+		delete StreamReader;
+		StreamReader = NULL;
 	}
 
 	delete FileAr;
 	FileAr = NULL;
 
+	ChunkData.Empty();
+
 	check( ClientConnections.Num() == 0 );
 	check( ServerConnection == NULL );
 }
@@ -621,6 +670,137 @@ void UDemoNetDriver::TickDemoRecord( float DeltaSeconds )
 	int32 EndCount = 0;
 
 	*FileAr << EndCount;
+
+	const float CheckpointInterval = CVarDemoCheckpointInterval.GetValueOnGameThread();
+	const bool bCheckpointDue = CheckpointInterval > 0.0f && DemoCurrentTime - LastCheckpointTime >= CheckpointInterval;
+
+	// A checkpoint always ends the chunk, so playback can go on from the chunk right after it
+	if ( ChunkData.Num() >= DEMO_CHUNK_SIZE || bCheckpointDue )
+	{
+		FlushRecordedChunk();
+	}
+
+	if ( bCheckpointDue )
+	{
+		SaveCheckpoint();
+		LastCheckpointTime = DemoCurrentTime;
+	}
+}
+
+void UDemoNetDriver::FlushRecordedChunk()
+{
+	if ( StreamWriter == NULL || ChunkData.Num() == 0 )
+	{
+		return;
+	}
+
+	// Compressed and written on the writer thread, the next frames start a new chunk
+	StreamWriter->QueueChunk( DEMOCHUNK_Frames, ChunkStartTime, DemoCurrentTime, ChunkData );
+	FileAr->Seek( 0 );
+
+	ChunkStartTime = DemoCurrentTime;
+}
+
+void UDemoNetDriver::SaveCheckpoint()
+{
+	check( CheckpointConnection == NULL );
+
+	UNetConnection* Connection = ClientConnections[0];
+
+	CheckpointData.Reset();
+
+	{
+		FMemoryWriter CheckpointAr( CheckpointData );
+
+		// Playback goes on with the packets and reliable bunches the demo connection sends after this point
+		int32 InPacketId = Connection->OutPacketId - 1;
+		CheckpointAr << InPacketId;
+
+		TArray< int32 > ReliableChannels;
+
+		for ( int32 i = 0; i < MAX_CHANNELS; i++ )
+		{
+			if ( Connection->OutReliable[i] != 0 )
+			{
+				ReliableChannels.Add( i );
+			}
+		}
+
+		int32 NumReliable = ReliableChannels.Num();
+		CheckpointAr << NumReliable;
+
+		for ( int32 i = 0; i < ReliableChannels.Num(); i++ )
+		{
+			CheckpointAr << ReliableChannels[i];
+			CheckpointAr << Connection->OutReliable[ ReliableChannels[i] ];
+		}
+	}
+
+	// Replicate the actors of the demo connection from scratch on a connection of their own, the packets end up in CheckpointData
+	UDemoNetConnection* NewConnection = ConstructObject<UDemoNetConnection>( UDemoNetConnection::StaticClass() );
+	NewConnection->InitConnection( this, USOCK_Open, Connection->URL, 1000000 );
+
+	ClientConnections.Add( NewConnection );
+	CheckpointConnection = NewConnection;
+
+	for ( auto It = Connection->ActorChannels.CreateConstIterator(); It; ++It )
+	{
+		UActorChannel* Channel = It.Value();
+
+		if ( Channel == NULL || Channel->Closing || Channel->Actor == NULL )
+		{
+			continue;
+		}
+
+		// Same channel index, so the bunches recorded after the checkpoint find their channel
+		UActorChannel* CheckpointChannel = (UActorChannel*)CheckpointConnection->CreateChannel( CHTYPE_Actor, 1, Channel->ChIndex );
+
+		if ( CheckpointChannel != NULL )
+		{
+			CheckpointChannel->SetChannelActor( Channel->Actor );
+			CheckpointChannel->ReplicateActor();
+		}
+	}
+
+	// Dormant actors are sent once and closed dormant again, so playback has them in their last replicated state
+	for ( int32 i = 0; i < World->NetworkActors.Num(); i++ )
+	{
+		AActor* Actor = World->NetworkActors[i];
+
+		if ( !Connection->DormantActors.Contains( Actor ) )
+		{
+			continue;
+		}
+
+		UActorChannel* CheckpointChannel = (UActorChannel*)CheckpointConnection->CreateChannel( CHTYPE_Actor, 1 );
+
+		if ( CheckpointChannel != NULL )
+		{
+			CheckpointChannel->SetChannelActor( Actor );
+			CheckpointChannel->ReplicateActor();
+
+			CheckpointChannel->Dormant = 1;
+			CheckpointChannel->Close();
+		}
+	}
+
+	CheckpointConnection->FlushNet();
+
+	CheckpointConnection->Close();
+	CheckpointConnection->CleanUp();
+	CheckpointConnection = NULL;
+
+	check( ClientConnections.Num() == 1 );
+
+	// Write a count of 0 to signal the end of the checkpoint
+	FMemoryWriter CheckpointAr( CheckpointData, false, true );
+
+	int32 EndCount = 0;
+	CheckpointAr << EndCount;
+
+	UE_LOG( LogDemo, Verbose, TEXT( "UDemoNetDriver::SaveCheckpoint: Time: %2.2f, Bytes: %i" ), DemoCurrentTime, CheckpointData.Num() );
+
+	StreamWriter->QueueChunk( DEMOCHUNK_Checkpoint, DemoCurrentTime, DemoCurrentTime, CheckpointData );
 }
 
 bool UDemoNetDriver::ReadDemoFrame()
@@ -631,7 +811,7 @@ bool UDemoNetDriver::ReadDemoFrame()
 		return false;
 	}
 
-	if ( FileAr->AtEnd() || FileAr->Tell() >= EndOfStreamOffset )
+	if ( FileAr->AtEnd() && !ReadNextChunk() )
 	{
 		bDemoPlaybackDone = true;
 
@@ -770,6 +950,282 @@ bool UDemoNetDriver::ReadDemoFrame()
 	return true;
 }
 
+/** Returns the index of the first chunk of frames after ChunkIndex, or INDEX_NONE */
+static int32 FindNextFramesChunk( const TArray< FDemoChunkInfo >& Chunks, int32 ChunkIndex )
+{
+	for ( int32 i = ChunkIndex + 1; i < Chunks.Num(); i++ )
+	{
+		if ( Chunks[i].Header.ChunkType == DEMOCHUNK_Frames )
+		{
+			return i;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+bool UDemoNetDriver::ReadNextChunk()
+{
+	// Chunks are never empty, but a corrupt one could be
+	while ( FileAr->AtEnd() )
+	{
+		const int32 ChunkIndex = FindNextFramesChunk( StreamReader->GetChunks(), CurrentChunkIndex );
+
+		if ( ChunkIndex == INDEX_NONE )
+		{
+			return false;
+		}
+
+		if ( !StreamReader->ReadChunk( ChunkIndex, ChunkData ) )
+		{
+			UE_LOG( LogDemo, Warning, TEXT( "UDemoNetDriver::ReadNextChunk: Failed to read chunk %i, ending playback" ), ChunkIndex );
+			ChunkData.Empty();
+			return false;
+		}
+
+		CurrentChunkIndex = ChunkIndex;
+		FileAr->Seek( 0 );
+
+		// Decompress the next chunk while this one plays
+		StreamReader->PrefetchChunk( FindNextFramesChunk( StreamReader->GetChunks(), ChunkIndex ) );
+	}
+
+	return true;
+}
+
+bool UDemoNetDriver::LoadCheckpoint()
+{
+	if ( CheckpointData.Num() == 0 )
+	{
+		// Starting from the beginning of the stream
+		return true;
+	}
+
+	FMemoryReader CheckpointAr( CheckpointData );
+
+	int32 InPacketId	= 0;
+	int32 NumReliable	= 0;
+
+	CheckpointAr << InPacketId;
+	CheckpointAr << NumReliable;
+
+	if ( CheckpointAr.IsError() || NumReliable < 0 || NumReliable > MAX_CHANNELS )
+	{
+		UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::LoadCheckpoint: Failed to read checkpoint header" ) );
+		return false;
+	}
+
+	TArray< int32 > ReliableSequences;
+	ReliableSequences.AddZeroed( NumReliable * 2 );
+
+	for ( int32 i = 0; i < ReliableSequences.Num(); i++ )
+	{
+		CheckpointAr << ReliableSequences[i];
+	}
+
+	while ( true )
+	{
+		uint8 ReadBuffer[ MAX_DEMO_READ_WRITE_BUFFER ];
+
+		int32 PacketBytes = 0;
+
+		CheckpointAr << PacketBytes;
+
+		if ( CheckpointAr.IsError() || PacketBytes < 0 || PacketBytes > sizeof( ReadBuffer ) )
+		{
+			UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::LoadCheckpoint: Failed to read checkpoint PacketBytes" ) );
+			return false;
+		}
+
+		if ( PacketBytes == 0 )
+		{
+			break;
+		}
+
+		CheckpointAr.Serialize( ReadBuffer, PacketBytes );
+
+		if ( CheckpointAr.IsError() )
+		{
+			UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::LoadCheckpoint: Failed to read checkpoint packet" ) );
+			return false;
+		}
+
+		ServerConnection->ReceivedRawPacket( ReadBuffer, PacketBytes );
+
+		if ( ServerConnection == NULL || ServerConnection->State == USOCK_Closed )
+		{
+			UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::LoadCheckpoint: ReceivedRawPacket closed connection" ) );
+			return false;
+		}
+	}
+
+	// Pick up the sequences of the recorded stream where the checkpoint was saved
+	ServerConnection->InPacketId = InPacketId;
+
+	FMemory::Memzero( ServerConnection->InReliable, sizeof( ServerConnection->InReliable ) );
+
+	for ( int32 i = 0; i < NumReliable; i++ )
+	{
+		const int32 ChIndex = ReliableSequences[ i * 2 ];
+
+		if ( ChIndex < 0 || ChIndex >= MAX_CHANNELS )
+		{
+			UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::LoadCheckpoint: Invalid channel index %i" ), ChIndex );
+			return false;
+		}
+
+		ServerConnection->InReliable[ ChIndex ] = ReliableSequences[ i * 2 + 1 ];
+	}
+
+	return true;
+}
+
+void UDemoNetDriver::GotoTimeInSeconds( float TimeInSeconds )
+{
+	if ( ServerConnection == NULL || StreamReader == NULL || World == NULL )
+	{
+		UE_LOG( LogDemo, Warning, TEXT( "GotoTimeInSeconds: No demo is playing" ) );
+		return;
+	}
+
+	TimeInSeconds = FMath::Clamp( TimeInSeconds, 0.0f, DemoTotalTime );
+
+	const TArray< FDemoChunkInfo >& Chunks = StreamReader->GetChunks();
+
+	const int32 CheckpointIndex		= StreamReader->FindCheckpoint( TimeInSeconds );
+	const float CheckpointTime		= CheckpointIndex != INDEX_NONE ? Chunks[CheckpointIndex].Header.StartTime : 0.0f;
+
+	if ( TimeInSeconds >= DemoCurrentTime && ( CheckpointIndex == INDEX_NONE || CheckpointTime <= DemoCurrentTime ) && !bDemoPlaybackDone )
+	{
+		// No checkpoint on the way, reading the frames up to the new time is cheaper
+		DemoDeltaTime	+= TimeInSeconds - DemoCurrentTime;
+		DemoCurrentTime	= TimeInSeconds;
+
+		while ( ReadDemoFrame() )
+		{
+			DemoFrameNum++;
+		}
+
+		return;
+	}
+
+	CheckpointData.Reset();
+
+	if ( CheckpointIndex != INDEX_NONE && !StreamReader->ReadChunk( CheckpointIndex, CheckpointData ) )
+	{
+		UE_LOG( LogDemo, Warning, TEXT( "GotoTimeInSeconds: Failed to read checkpoint at %2.2f" ), CheckpointTime );
+		return;
+	}
+
+	UE_LOG( LogDemo, Log, TEXT( "GotoTimeInSeconds: Jumping to %2.2f from checkpoint at %2.2f" ), TimeInSeconds, CheckpointTime );
+
+	// The spectator stays where it is looking from
+	APlayerController* OldSpectatorController = SpectatorController;
+
+	FVector ViewLocation( 0 );
+	FRotator ViewRotation( 0 );
+
+	if ( OldSpectatorController != NULL )
+	{
+		OldSpectatorController->GetPlayerViewPoint( ViewLocation, ViewRotation );
+	}
+
+	// Destroy the actors the demo spawned, startup actors and the spectator are detached from their channel and kept
+	for ( int32 i = ServerConnection->OpenChannels.Num() - 1; i >= 0; i-- )
+	{
+		UActorChannel* ActorChannel = Cast< UActorChannel >( ServerConnection->OpenChannels[i] );
+
+		if ( ActorChannel == NULL )
+		{
+			continue;
+		}
+
+		AActor* Actor = ActorChannel->GetActor();
+
+		if ( Actor != NULL && ( Actor->IsNetStartupActor() || Actor == OldSpectatorController ) )
+		{
+			if ( bDemoPlaybackDone && Cast< APlayerController >( Actor ) == NULL )
+			{
+				// Paused when playback reached the end
+				Actor->CustomTimeDilation = 1.0f;
+			}
+
+			ActorChannel->Actor = NULL;
+		}
+
+		ActorChannel->Dormant = 0;
+		ActorChannel->ConditionalCleanUp( true );
+	}
+
+	for ( auto It = ServerConnection->DormantActors.CreateConstIterator(); It; ++It )
+	{
+		AActor* Actor = const_cast< AActor* >( *It );
+
+		if ( Actor != NULL && !Actor->IsPendingKill() && !Actor->IsNetStartupActor() )
+		{
+			World->DestroyActor( Actor, true );
+		}
+	}
+
+	// Don't let the connection destroy the spectator, it is replaced once the new one is replicated
+	ServerConnection->OwningActor		= NULL;
+	ServerConnection->PlayerController	= NULL;
+
+	const FURL ConnectURL = ServerConnection->URL;
+
+	ServerConnection->Close();
+	ServerConnection->CleanUp();
+
+	check( ServerConnection == NULL );
+
+	ServerConnection = ConstructObject<UNetConnection>( UDemoNetConnection::StaticClass() );
+	ServerConnection->InitConnection( this, USOCK_Pending, ConnectURL, 1000000 );
+	ServerConnection->CreateChannel( CHTYPE_Control, 1 );
+
+	if ( !LoadCheckpoint() )
+	{
+		StopDemo();
+
+		if ( World->GetGameInstance() != NULL )
+		{
+			World->GetGameInstance()->HandleDemoPlaybackFailure( EDemoPlayFailure::Corrupt, FString( TEXT( "UDemoNetDriver::GotoTimeInSeconds: Failed to load checkpoint" ) ) );
+		}
+
+		return;
+	}
+
+	// Playback goes on with the frames recorded right after the checkpoint
+	CurrentChunkIndex = CheckpointIndex;
+
+	ChunkData.Reset();
+	FileAr->Seek( 0 );
+
+	bDemoPlaybackDone	= false;
+	DemoCurrentTime		= TimeInSeconds;
+	DemoDeltaTime		= TimeInSeconds - CheckpointTime;
+
+	while ( ReadDemoFrame() )
+	{
+		DemoFrameNum++;
+	}
+
+	if ( ServerConnection == NULL )
+	{
+		// Reading the frames stopped the demo
+		return;
+	}
+
+	if ( OldSpectatorController != NULL && SpectatorController != OldSpectatorController )
+	{
+		World->DestroyActor( OldSpectatorController );
+
+		if ( SpectatorController != NULL )
+		{
+			SpectatorController->SetInitialLocationAndRotation( ViewLocation, ViewRotation );
+		}
+	}
+}
+
 void UDemoNetDriver::TickDemoPlayback( float DeltaSeconds )
 {
 	if ( ServerConnection == NULL || ServerConnection->State == USOCK_Closed )
@@ -867,6 +1323,16 @@ void UDemoNetConnection::LowLevelSend( void* Data, int32 Count )
 		UE_LOG( LogDemo, Fatal, TEXT( "UDemoNetConnection::LowLevelSend: Count > MAX_DEMO_READ_WRITE_BUFFER." ) );
 	}
 
+	if ( GetDriver()->CheckpointConnection == this )
+	{
+		// Packets of the checkpoint being saved are kept out of the frame stream
+		FMemoryWriter CheckpointAr( GetDriver()->CheckpointData, false, true );
+
+		CheckpointAr << Count;
+		CheckpointAr.Serialize( Data, Count );
+		return;
+	}
+
 	if ( !GetDriver()->ServerConnection && GetDriver()->FileAr )
 	{
 		// If we're outside of an official demo frame, we need to queue this up or it will throw off the stream
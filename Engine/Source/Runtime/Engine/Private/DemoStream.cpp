@@ -0,0 +1,265 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	DemoStream.cpp: Chunked storage of demo recordings.
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "Net/DemoStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC( LogDemoStream, Log, All );
+
+/*-----------------------------------------------------------------------------
+	FDemoStreamWriter.
+-----------------------------------------------------------------------------*/
+
+FDemoStreamWriter::FDemoStreamWriter( FArchive* InArchive )
+	: Archive( InArchive )
+	, Thread( NULL )
+	, WorkEvent( FPlatformProcess::CreateSynchEvent() )
+{
+	check( Archive != NULL );
+	Thread = FRunnableThread::Create( this, TEXT( "DemoStreamWriter" ), 0, TPri_BelowNormal );
+}
+
+FDemoStreamWriter::~FDemoStreamWriter()
+{
+	if ( Thread != NULL )
+	{
+		delete Finish();
+	}
+
+	delete WorkEvent;
+	WorkEvent = NULL;
+}
+
+void FDemoStreamWriter::QueueChunk( EDemoChunkType ChunkType, float StartTime, float EndTime, TArray< uint8 >& Data )
+{
+	check( Thread != NULL );
+
+	FPendingChunk* Chunk = new FPendingChunk;
+
+	Chunk->Header.ChunkType	= ChunkType;
+	Chunk->Header.StartTime	= StartTime;
+	Chunk->Header.EndTime	= EndTime;
+
+	Exchange( Chunk->Data, Data );
+	Data.Empty();
+
+	PendingChunks.Enqueue( Chunk );
+	WorkEvent->Trigger();
+}
+
+FArchive* FDemoStreamWriter::Finish()
+{
+	if ( Thread != NULL )
+	{
+		FinishRequested.Set( 1 );
+		WorkEvent->Trigger();
+
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = NULL;
+	}
+
+	FArchive* Result = Archive;
+	Archive = NULL;
+
+	return Result;
+}
+
+uint32 FDemoStreamWriter::Run()
+{
+	for ( ;; )
+	{
+		// Checked before emptying the queue, every chunk is queued before the request to finish
+		const bool bLastPass = FinishRequested.GetValue() != 0;
+
+		FPendingChunk* Chunk = NULL;
+
+		while ( PendingChunks.Dequeue( Chunk ) )
+		{
+			WriteChunk( *Chunk );
+			delete Chunk;
+		}
+
+		if ( bLastPass )
+		{
+			break;
+		}
+
+		WorkEvent->Wait();
+	}
+
+	return 0;
+}
+
+void FDemoStreamWriter::Stop()
+{
+	FinishRequested.Set( 1 );
+	WorkEvent->Trigger();
+}
+
+void FDemoStreamWriter::WriteChunk( FPendingChunk& Chunk )
+{
+	const int32 UncompressedSize = Chunk.Data.Num();
+
+	int32 CompressedSize = FCompression::CompressMemoryBound( COMPRESS_ZLIB, UncompressedSize );
+	CompressedData.SetNumUninitialized( CompressedSize );
+
+	// Chunks that don't get smaller are stored as they are
+	const bool bCompressed = UncompressedSize > 0 &&
+		FCompression::CompressMemory( COMPRESS_ZLIB, CompressedData.GetData(), CompressedSize, Chunk.Data.GetData(), UncompressedSize ) &&
+		CompressedSize < UncompressedSize;
+
+	Chunk.Header.UncompressedSize	= UncompressedSize;
+	Chunk.Header.CompressedSize		= bCompressed ? CompressedSize : UncompressedSize;
+
+	*Archive << Chunk.Header;
+	Archive->Serialize( bCompressed ? CompressedData.GetData() : Chunk.Data.GetData(), Chunk.Header.CompressedSize );
+
+	// So a recording that is cut short can still be played up to its last chunk
+	Archive->Flush();
+
+	if ( Archive->IsError() )
+	{
+		UE_LOG( LogDemoStream, Warning, TEXT( "FDemoStreamWriter::WriteChunk: Failed to write %i bytes." ), Chunk.Header.CompressedSize );
+	}
+}
+
+/*-----------------------------------------------------------------------------
+	FDemoStreamReader.
+-----------------------------------------------------------------------------*/
+
+FDemoStreamReader::FDemoStreamReader( FArchive* InArchive, int64 EndOffset )
+	: Archive( InArchive )
+	, bPrefetchStarted( false )
+{
+	check( Archive != NULL );
+
+	if ( EndOffset <= 0 )
+	{
+		// The recording didn't finish, read every complete chunk
+		EndOffset = Archive->TotalSize();
+	}
+
+	while ( Archive->Tell() + FDemoChunkHeader::SerializedSize <= EndOffset )
+	{
+		FDemoChunkInfo Chunk;
+
+		*Archive << Chunk.Header;
+		Chunk.DataOffset = Archive->Tell();
+
+		if ( Archive->IsError() || Chunk.Header.CompressedSize < 0 || Chunk.Header.UncompressedSize < 0 || Chunk.DataOffset + Chunk.Header.CompressedSize > EndOffset )
+		{
+			UE_LOG( LogDemoStream, Warning, TEXT( "FDemoStreamReader: Stream is truncated after %i chunks." ), Chunks.Num() );
+			break;
+		}
+
+		Chunks.Add( Chunk );
+
+		Archive->Seek( Chunk.DataOffset + Chunk.Header.CompressedSize );
+	}
+
+	PrefetchTask.GetTask().Reader = this;
+}
+
+FDemoStreamReader::~FDemoStreamReader()
+{
+	if ( bPrefetchStarted )
+	{
+		PrefetchTask.EnsureCompletion();
+	}
+
+	delete Archive;
+	Archive = NULL;
+}
+
+bool FDemoStreamReader::ReadChunk( int32 ChunkIndex, TArray< uint8 >& OutData )
+{
+	if ( bPrefetchStarted )
+	{
+		PrefetchTask.EnsureCompletion();
+		bPrefetchStarted = false;
+
+		FDemoChunkReadTask& Task = PrefetchTask.GetTask();
+
+		if ( Task.ChunkIndex == ChunkIndex )
+		{
+			Exchange( OutData, Task.Data );
+			Task.Data.Empty();
+			return Task.bSuccess;
+		}
+	}
+
+	return LoadChunk( ChunkIndex, OutData );
+}
+
+void FDemoStreamReader::PrefetchChunk( int32 ChunkIndex )
+{
+	if ( !Chunks.IsValidIndex( ChunkIndex ) )
+	{
+		return;
+	}
+
+	if ( bPrefetchStarted )
+	{
+		PrefetchTask.EnsureCompletion();
+	}
+
+	FDemoChunkReadTask& Task = PrefetchTask.GetTask();
+
+	Task.ChunkIndex	= ChunkIndex;
+	Task.bSuccess	= false;
+
+	PrefetchTask.StartBackgroundTask();
+	bPrefetchStarted = true;
+}
+
+int32 FDemoStreamReader::FindCheckpoint( float Time ) const
+{
+	int32 Result = INDEX_NONE;
+
+	for ( int32 i = 0; i < Chunks.Num(); i++ )
+	{
+		if ( Chunks[i].Header.ChunkType != DEMOCHUNK_Checkpoint )
+		{
+			continue;
+		}
+
+		if ( Chunks[i].Header.StartTime > Time )
+		{
+			break;
+		}
+
+		Result = i;
+	}
+
+	return Result;
+}
+
+bool FDemoStreamReader::LoadChunk( int32 ChunkIndex, TArray< uint8 >& OutData )
+{
+	const FDemoChunkHeader& Header = Chunks[ChunkIndex].Header;
+
+	Archive->Seek( Chunks[ChunkIndex].DataOffset );
+
+	OutData.SetNumUninitialized( Header.UncompressedSize );
+
+	if ( Header.CompressedSize == Header.UncompressedSize )
+	{
+		Archive->Serialize( OutData.GetData(), Header.UncompressedSize );
+		return !Archive->IsError();
+	}
+
+	CompressedData.SetNumUninitialized( Header.CompressedSize );
+	Archive->Serialize( CompressedData.GetData(), Header.CompressedSize );
+
+	if ( Archive->IsError() || !FCompression::UncompressMemory( COMPRESS_ZLIB, OutData.GetData(), Header.UncompressedSize, CompressedData.GetData(), Header.CompressedSize ) )
+	{
+		UE_LOG( LogDemoStream, Warning, TEXT( "FDemoStreamReader::LoadChunk: Chunk %i is corrupt." ), ChunkIndex );
+		return false;
+	}
+
+	return true;
+}
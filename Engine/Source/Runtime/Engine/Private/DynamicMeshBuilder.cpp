@@ -279,8 +279,8 @@ class FDynamicMeshVertexFactory : public FDynamicPrimitiveResource, public FLoca
 {
 public:
 
-	/** Initialization constructor. */
-	FDynamicMeshVertexFactory(const FDynamicMeshVertexBuffer* VertexBuffer)
+	/** Initialization constructor, VertexBuffer must hold FDynamicMeshVertex. */
+	FDynamicMeshVertexFactory(const FVertexBuffer* VertexBuffer)
 	{
 		// Initialize the vertex factory's stream components.
 		if(IsInRenderingThread())
@@ -300,7 +300,7 @@ public:
 		    ENQUEUE_UNIQUE_RENDER_COMMAND_TWOPARAMETER(
 			    InitVertexFactory,
 			    FLocalVertexFactory*,VertexFactory,this,
-			    const FDynamicMeshVertexBuffer*,VertexBuffer,VertexBuffer,
+			    const FVertexBuffer*,VertexBuffer,VertexBuffer,
 			    {
 				    DataType TheData;
 				    TheData.PositionComponent = STRUCTMEMBER_VERTEXSTREAMCOMPONENT(VertexBuffer,FDynamicMeshVertex,Position,VET_Float3);
@@ -417,26 +417,18 @@ class FMeshBuilderOneFrameResources : public FOneFrameResource
 public:
 
 	FMeshBuilderOneFrameResources() :
-		VertexBuffer(NULL),
-		IndexBuffer(NULL),
 		VertexFactory(NULL),
 		PrimitiveUniformBuffer(NULL)
 	{}
 
-	FDynamicMeshVertexBuffer* VertexBuffer;
-	FDynamicMeshIndexBuffer* IndexBuffer;
 	FDynamicMeshVertexFactory* VertexFactory;
 	FDynamicMeshPrimitiveUniformBuffer* PrimitiveUniformBuffer;
 
 	virtual ~FMeshBuilderOneFrameResources()
 	{
-		VertexBuffer->ReleaseResource();
-		IndexBuffer->ReleaseResource();
 		VertexFactory->ReleaseResource();
 		PrimitiveUniformBuffer->ReleaseResource();
 
-		delete VertexBuffer;
-		delete IndexBuffer;
 		delete VertexFactory;
 		delete PrimitiveUniformBuffer;
 	}
@@ -454,17 +446,30 @@ void FDynamicMeshBuilder::GetMesh(const FMatrix& LocalToWorld,const FMaterialRen
 	{
 		FMeshBuilderOneFrameResources& OneFrameResources = Collector.AllocateOneFrameResource<FMeshBuilderOneFrameResources>();
 
-		OneFrameResources.VertexBuffer = VertexBuffer;
-		OneFrameResources.IndexBuffer = IndexBuffer;
+		// Suballocate the vertices and indices from the global dynamic buffers, which the renderer commits once
+		// before drawing, instead of creating and locking buffers for each mesh.
+		const int32 NumVertices = VertexBuffer->Vertices.Num();
+		const int32 NumIndices = IndexBuffer->Indices.Num();
+		const uint32 VertexStride = sizeof(FDynamicMeshVertex);
 
-		OneFrameResources.VertexBuffer->InitResource();
-		OneFrameResources.IndexBuffer->InitResource();
+		// One extra vertex so the vertices can start on a whole vertex of the buffer, indices are relative to that
+		FGlobalDynamicVertexBuffer::FAllocation VertexAllocation = FGlobalDynamicVertexBuffer::Get().Allocate((NumVertices + 1) * VertexStride);
+		const uint32 BaseVertexIndex = (VertexAllocation.VertexOffset + VertexStride - 1) / VertexStride;
+		FMemory::Memcpy(VertexAllocation.Buffer + (BaseVertexIndex * VertexStride - VertexAllocation.VertexOffset), VertexBuffer->Vertices.GetData(), NumVertices * VertexStride);
 
-		OneFrameResources.VertexFactory = new FDynamicMeshVertexFactory(VertexBuffer);
+		FGlobalDynamicIndexBuffer::FAllocation IndexAllocation = FGlobalDynamicIndexBuffer::Get().Allocate<uint32>(NumIndices);
+		uint32* Indices = (uint32*)IndexAllocation.Buffer;
+		for (int32 Index = 0; Index < NumIndices; ++Index)
+		{
+			Indices[Index] = BaseVertexIndex + IndexBuffer->Indices[Index];
+		}
+
+		OneFrameResources.VertexFactory = new FDynamicMeshVertexFactory(VertexAllocation.VertexBuffer);
 		OneFrameResources.VertexFactory->InitResource();
 
 		// Create the primitive uniform buffer.
 		OneFrameResources.PrimitiveUniformBuffer = new FDynamicMeshPrimitiveUniformBuffer();
+		OneFrameResources.PrimitiveUniformBuffer->BufferUsage = UniformBuffer_SingleFrame;
 		FPrimitiveUniformShaderParameters PrimitiveParams = GetPrimitiveUniformShaderParameters(
 			LocalToWorld,
 			LocalToWorld.GetOrigin(),
@@ -491,15 +496,15 @@ void FDynamicMeshBuilder::GetMesh(const FMatrix& LocalToWorld,const FMaterialRen
 		// Draw the mesh.
 		FMeshBatch& Mesh = Collector.AllocateMesh();
 		FMeshBatchElement& BatchElement = Mesh.Elements[0];
-		BatchElement.IndexBuffer = IndexBuffer;
+		BatchElement.IndexBuffer = IndexAllocation.IndexBuffer;
 		Mesh.VertexFactory = OneFrameResources.VertexFactory;
 		Mesh.MaterialRenderProxy = MaterialRenderProxy;
 		BatchElement.PrimitiveUniformBufferResource = OneFrameResources.PrimitiveUniformBuffer;
 		// previous l2w not used so treat as static
-		BatchElement.FirstIndex = 0;
-		BatchElement.NumPrimitives = IndexBuffer->Indices.Num() / 3;
-		BatchElement.MinVertexIndex = 0;
-		BatchElement.MaxVertexIndex = VertexBuffer->Vertices.Num() - 1;
+		BatchElement.FirstIndex = IndexAllocation.FirstIndex;
+		BatchElement.NumPrimitives = NumIndices / 3;
+		BatchElement.MinVertexIndex = BaseVertexIndex;
+		BatchElement.MaxVertexIndex = BaseVertexIndex + NumVertices - 1;
 		Mesh.ReverseCulling = LocalToWorld.Determinant() < 0.0f ? true : false;
 		Mesh.bDisableBackfaceCulling = bDisableBackfaceCulling;
 		Mesh.Type = PT_TriangleList;
@@ -512,8 +517,9 @@ void FDynamicMeshBuilder::GetMesh(const FMatrix& LocalToWorld,const FMaterialRen
 
 		Collector.AddMesh(ViewIndex, Mesh);
 
-		// Clear the resource pointers so they cannot be overwritten accidentally.
-		// These resources will be released by the PDI.
+		// The data is in the global buffers now, the builder can't be used again like after Draw.
+		delete VertexBuffer;
+		delete IndexBuffer;
 		VertexBuffer = NULL;
 		IndexBuffer = NULL;
 	}
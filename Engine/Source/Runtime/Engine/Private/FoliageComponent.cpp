@@ -60,7 +60,7 @@ FPrimitiveSceneProxy* UInteractiveFoliageComponent::CreateSceneProxy()
 	if(StaticMesh == NULL
 		|| StaticMesh->RenderData == NULL
 		|| StaticMesh->RenderData->LODResources.Num() == 0
-		|| StaticMesh->RenderData->LODResources[0].VertexBuffer.GetNumVertices() == 0)
+		|| StaticMesh->RenderData->LODResources[StaticMesh->RenderData->CurrentFirstLODIdx].VertexBuffer.GetNumVertices() == 0)
 	{
 		return NULL;
 	}
@@ -0,0 +1,282 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+FramePipelineStats.cpp: Per frame timings of the game, rendering and RHI threads and of the GPU.
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "FramePipelineStats.h"
+#include "RenderCore.h"
+
+#if !UE_BUILD_SHIPPING
+
+static TAutoConsoleVariable<int32> CVarFramePipelineNumFrames(
+	TEXT("t.FramePipeline.NumFrames"),
+	300,
+	TEXT("Number of frames kept by the frame pipeline stats, displayed by stat pipeline and written by DumpFramePipeline."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFramePipelineBoundThreshold(
+	TEXT("t.FramePipeline.BoundThreshold"),
+	0.75f,
+	TEXT("Share of the frame time a stage must be busy for the frame to be classified as bound by it.\n")
+	TEXT("The frames in which no stage is busy for that long are not bound, e.g. when the frame rate is capped."),
+	ECVF_Default);
+
+const TCHAR* EFramePipelineBound::ToString(EFramePipelineBound::Type Bound)
+{
+	switch (Bound)
+	{
+	case EFramePipelineBound::Game: return TEXT("Game");
+	case EFramePipelineBound::Render: return TEXT("Render");
+	case EFramePipelineBound::RHI: return TEXT("RHI");
+	case EFramePipelineBound::GPU: return TEXT("GPU");
+	default: return TEXT("None");
+	}
+}
+
+/** Colors of the stages in the graph, the same as in stat unitgraph. */
+static FLinearColor GetBoundColor(EFramePipelineBound::Type Bound)
+{
+	switch (Bound)
+	{
+	case EFramePipelineBound::Game: return FLinearColor(1.0f, 0.1f, 0.1f);
+	case EFramePipelineBound::Render: return FLinearColor(0.1f, 0.1f, 1.0f);
+	case EFramePipelineBound::RHI: return FLinearColor(0.1f, 1.0f, 1.0f);
+	case EFramePipelineBound::GPU: return FLinearColor(1.0f, 1.0f, 0.1f);
+	default: return FLinearColor(0.4f, 0.4f, 0.4f);
+	}
+}
+
+EFramePipelineBound::Type FFramePipelineSample::Classify(const FFramePipelineSample& Sample, float BoundThreshold)
+{
+	float StageTimes[EFramePipelineBound::Num];
+	StageTimes[EFramePipelineBound::None] = Sample.FrameTime * BoundThreshold;
+	StageTimes[EFramePipelineBound::Game] = Sample.GameThreadTime;
+	StageTimes[EFramePipelineBound::Render] = Sample.RenderThreadTime;
+	StageTimes[EFramePipelineBound::RHI] = Sample.RHIThreadTime;
+	StageTimes[EFramePipelineBound::GPU] = Sample.GPUTime > 0.0f ? Sample.GPUTime : Sample.RenderThreadTime + Sample.PresentTime;
+
+	// the earlier stages win the ties, as they feed the later ones
+	int32 Bound = EFramePipelineBound::None;
+	for (int32 Stage = EFramePipelineBound::Game; Stage < EFramePipelineBound::Num; ++Stage)
+	{
+		if (StageTimes[Stage] > StageTimes[Bound])
+		{
+			Bound = Stage;
+		}
+	}
+	return (EFramePipelineBound::Type)Bound;
+}
+
+FFramePipelineStats& FFramePipelineStats::Get()
+{
+	static FFramePipelineStats Singleton;
+	return Singleton;
+}
+
+FFramePipelineStats::FFramePipelineStats()
+	: NextSampleIndex(0)
+	, LastGameThreadWaitCycles(0)
+	, LastRenderThreadWaitCycles(0)
+	, LastRHIThreadCycles(0)
+	, bHasLastCycles(false)
+{
+}
+
+void FFramePipelineStats::Tick(float DeltaSeconds)
+{
+	check(IsInGameThread());
+
+	// the accumulators are never reset, so the differences are valid even when they wrap
+	const uint32 GameThreadWaitCycles = GGameThreadWaitForRenderThreadCycles;
+	const uint32 RenderThreadWaitCycles = GRenderThreadWaitForRHIThreadCycles;
+	const uint32 RHIThreadCycles = GRHIThreadExecuteCycles;
+	const bool bHadLastCycles = bHasLastCycles;
+	const uint32 GameThreadWaitDelta = GameThreadWaitCycles - LastGameThreadWaitCycles;
+	const uint32 RenderThreadWaitDelta = RenderThreadWaitCycles - LastRenderThreadWaitCycles;
+	const uint32 RHIThreadDelta = RHIThreadCycles - LastRHIThreadCycles;
+	LastGameThreadWaitCycles = GameThreadWaitCycles;
+	LastRenderThreadWaitCycles = RenderThreadWaitCycles;
+	LastRHIThreadCycles = RHIThreadCycles;
+	bHasLastCycles = true;
+	if (!bHadLastCycles)
+	{
+		return;
+	}
+
+	FFramePipelineSample Sample;
+	Sample.FrameTime = DeltaSeconds * 1000.0f;
+	Sample.GameThreadTime = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	Sample.GameThreadWaitTime = FPlatformTime::ToMilliseconds(GameThreadWaitDelta);
+	Sample.RenderThreadTime = FPlatformTime::ToMilliseconds(GRenderThreadTime);
+	Sample.RenderThreadWaitTime = FPlatformTime::ToMilliseconds(RenderThreadWaitDelta);
+	Sample.RHIThreadTime = FPlatformTime::ToMilliseconds(RHIThreadDelta);
+	Sample.PresentTime = FPlatformTime::ToMilliseconds(GSwapBufferTime);
+	Sample.GPUTime = FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles());
+	Sample.FramesInFlight = (int32)(GFrameNumber - GFrameNumberRenderThread);
+	Sample.Bound = FFramePipelineSample::Classify(Sample, CVarFramePipelineBoundThreshold.GetValueOnGameThread());
+
+	// start over when the number of frames changes, until the buffer is full the next index is its end
+	const int32 NumFrames = FMath::Clamp(CVarFramePipelineNumFrames.GetValueOnGameThread(), 1, 100000);
+	if (Samples.Num() > NumFrames || (Samples.Num() < NumFrames && NextSampleIndex != Samples.Num()))
+	{
+		Samples.Reset();
+		NextSampleIndex = 0;
+	}
+
+	if (Samples.Num() < NumFrames)
+	{
+		Samples.Add(Sample);
+	}
+	else
+	{
+		Samples[NextSampleIndex] = Sample;
+	}
+	NextSampleIndex = (NextSampleIndex + 1) % NumFrames;
+}
+
+void FFramePipelineStats::GetSamples(TArray<FFramePipelineSample>& OutSamples) const
+{
+	OutSamples.Reset(Samples.Num());
+	for (int32 Index = 0; Index < Samples.Num(); ++Index)
+	{
+		OutSamples.Add(Samples[(NextSampleIndex + Index) % Samples.Num()]);
+	}
+}
+
+int32 FFramePipelineStats::DrawStat(FViewport* Viewport, FCanvas* Canvas, int32 X, int32 Y) const
+{
+	TArray<FFramePipelineSample> OrderedSamples;
+	GetSamples(OrderedSamples);
+
+	UFont* Font = GEngine->GetSmallFont();
+	const int32 RowHeight = FMath::TruncToInt(Font->GetMaxCharHeight() * 1.1f);
+	if (OrderedSamples.Num() == 0)
+	{
+		Canvas->DrawShadowedString(X, Y, TEXT("Pipeline: no frames yet"), Font, FLinearColor::White);
+		return Y + RowHeight;
+	}
+
+	FFramePipelineSample Average;
+	FMemory::Memzero(&Average, sizeof(Average));
+	int32 NumBound[EFramePipelineBound::Num] = { 0 };
+	for (const FFramePipelineSample& Sample : OrderedSamples)
+	{
+		Average.FrameTime += Sample.FrameTime;
+		Average.GameThreadTime += Sample.GameThreadTime;
+		Average.GameThreadWaitTime += Sample.GameThreadWaitTime;
+		Average.RenderThreadTime += Sample.RenderThreadTime;
+		Average.RenderThreadWaitTime += Sample.RenderThreadWaitTime;
+		Average.RHIThreadTime += Sample.RHIThreadTime;
+		Average.PresentTime += Sample.PresentTime;
+		Average.GPUTime += Sample.GPUTime;
+		Average.FramesInFlight += Sample.FramesInFlight;
+		NumBound[Sample.Bound]++;
+	}
+	const float InvNum = 1.0f / OrderedSamples.Num();
+	const float PercentPerFrame = 100.0f * InvNum;
+
+	Canvas->DrawShadowedString(X, Y, *FString::Printf(TEXT("Pipeline, last %d frames: %.2f ms, %.1f frames in flight"), OrderedSamples.Num(), Average.FrameTime * InvNum, Average.FramesInFlight * InvNum), Font, FLinearColor::White);
+	Y += RowHeight;
+
+	const FString StageLines[EFramePipelineBound::Num] =
+	{
+		TEXT("Not bound"),
+		FString::Printf(TEXT("Game: %.2f ms, %.2f ms waiting on render"), Average.GameThreadTime * InvNum, Average.GameThreadWaitTime * InvNum),
+		FString::Printf(TEXT("Render: %.2f ms, %.2f ms waiting on RHI"), Average.RenderThreadTime * InvNum, Average.RenderThreadWaitTime * InvNum),
+		GRHIThread ? FString::Printf(TEXT("RHI: %.2f ms"), Average.RHIThreadTime * InvNum) : FString(TEXT("RHI: no RHI thread, part of render")),
+		FString::Printf(TEXT("GPU: %.2f ms, %.2f ms presenting"), Average.GPUTime * InvNum, Average.PresentTime * InvNum),
+	};
+	const EFramePipelineBound::Type LastBound = OrderedSamples.Last().Bound;
+	for (int32 Stage = EFramePipelineBound::Game; Stage <= EFramePipelineBound::Num; ++Stage)
+	{
+		// the frames that aren't bound are listed last
+		const EFramePipelineBound::Type Bound = (EFramePipelineBound::Type)(Stage % EFramePipelineBound::Num);
+		const FString Line = FString::Printf(TEXT("%s%s - %.0f%% bound"), Bound == LastBound ? TEXT("> ") : TEXT("  "), *StageLines[Bound], NumBound[Bound] * PercentPerFrame);
+		Canvas->DrawShadowedString(X, Y, *Line, Font, GetBoundColor(Bound));
+		Y += RowHeight;
+	}
+
+	// one column per frame, as high as its frame time and colored by what bound it, with lines at 16.6 and 33.3 ms
+	const float GraphPixelsPerFrame = FMath::Max(1.0f, FMath::Min(2.0f, 600.0f * InvNum));
+	const float GraphPixelsPerMS = 3.0f;
+	const float GraphHeightInMS = 50.0f;
+	const float GraphLeft = X;
+	const float GraphRight = GraphLeft + GraphPixelsPerFrame * OrderedSamples.Num();
+	const float GraphBottom = Y + 4.0f + GraphHeightInMS * GraphPixelsPerMS;
+
+	FBatchedElements* BatchedElements = Canvas->GetBatchedElements(FCanvas::ET_Line);
+	FHitProxyId HitProxyId = Canvas->GetHitProxyId();
+	BatchedElements->AddReserveLines(3 + OrderedSamples.Num());
+	BatchedElements->AddLine(FVector(GraphLeft, GraphBottom, 0.0f), FVector(GraphRight, GraphBottom, 0.0f), FLinearColor(0.1f, 0.1f, 0.1f), HitProxyId);
+	BatchedElements->AddLine(FVector(GraphLeft, GraphBottom - 16.6f * GraphPixelsPerMS, 0.0f), FVector(GraphRight, GraphBottom - 16.6f * GraphPixelsPerMS, 0.0f), FLinearColor(0.03f, 0.1f, 0.03f), HitProxyId);
+	BatchedElements->AddLine(FVector(GraphLeft, GraphBottom - 33.3f * GraphPixelsPerMS, 0.0f), FVector(GraphRight, GraphBottom - 33.3f * GraphPixelsPerMS, 0.0f), FLinearColor(0.1f, 0.03f, 0.03f), HitProxyId);
+	for (int32 Index = 0; Index < OrderedSamples.Num(); ++Index)
+	{
+		const FFramePipelineSample& Sample = OrderedSamples[Index];
+		const float ColumnX = GraphLeft + Index * GraphPixelsPerFrame;
+		const float ColumnHeight = FMath::Min(Sample.FrameTime, GraphHeightInMS) * GraphPixelsPerMS;
+		BatchedElements->AddLine(FVector(ColumnX, GraphBottom - 1.0f, 0.0f), FVector(ColumnX, GraphBottom - 1.0f - ColumnHeight, 0.0f), GetBoundColor(Sample.Bound), HitProxyId);
+	}
+
+	return FMath::TruncToInt(GraphBottom) + RowHeight;
+}
+
+FString FFramePipelineStats::DumpToCSV() const
+{
+#if ALLOW_DEBUG_FILES
+	const FString OutputDir = FPaths::ProfilingDir() + TEXT("FramePipeline/");
+	IFileManager::Get().MakeDirectory(*OutputDir, true);
+	const FString Filename = OutputDir + FString::Printf(TEXT("FramePipeline-%s.csv"), *FDateTime::Now().ToString());
+
+	FArchive* OutputFile = IFileManager::Get().CreateDebugFileWriter(*Filename);
+	if (OutputFile)
+	{
+		TArray<FFramePipelineSample> OrderedSamples;
+		GetSamples(OrderedSamples);
+
+		OutputFile->Logf(TEXT("Frame,Frame (ms),GT (ms),GT Wait RT (ms),RT (ms),RT Wait RHI (ms),RHI (ms),Present (ms),GPU (ms),Frames In Flight,Bound"));
+		for (int32 Index = 0; Index < OrderedSamples.Num(); ++Index)
+		{
+			const FFramePipelineSample& Sample = OrderedSamples[Index];
+			OutputFile->Logf(TEXT("%d,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%d,%s"), Index, Sample.FrameTime, Sample.GameThreadTime, Sample.GameThreadWaitTime,
+				Sample.RenderThreadTime, Sample.RenderThreadWaitTime, Sample.RHIThreadTime, Sample.PresentTime, Sample.GPUTime, Sample.FramesInFlight, EFramePipelineBound::ToString(Sample.Bound));
+		}
+		delete OutputFile;
+		return Filename;
+	}
+#endif
+	return FString();
+}
+
+static void DumpFramePipeline()
+{
+	TArray<FFramePipelineSample> OrderedSamples;
+	FFramePipelineStats::Get().GetSamples(OrderedSamples);
+
+	int32 NumBound[EFramePipelineBound::Num] = { 0 };
+	for (const FFramePipelineSample& Sample : OrderedSamples)
+	{
+		NumBound[Sample.Bound]++;
+	}
+	for (int32 Bound = 0; Bound < EFramePipelineBound::Num; ++Bound)
+	{
+		UE_LOG(LogEngine, Display, TEXT("%s bound: %d of %d frames"), EFramePipelineBound::ToString((EFramePipelineBound::Type)Bound), NumBound[Bound], OrderedSamples.Num());
+	}
+
+	const FString Filename = FFramePipelineStats::Get().DumpToCSV();
+	if (Filename.Len())
+	{
+		UE_LOG(LogEngine, Display, TEXT("Frame pipeline timings written to %s"), *Filename);
+	}
+}
+
+static FAutoConsoleCommand GDumpFramePipelineCmd(
+	TEXT("DumpFramePipeline"),
+	TEXT("Writes the timings of the last frames of the game, rendering and RHI threads and of the GPU to a csv file in the profiling directory,\n")
+	TEXT("with what bound each frame. See t.FramePipeline.NumFrames and t.FramePipeline.BoundThreshold."),
+	FConsoleCommandDelegate::CreateStatic(&DumpFramePipeline)
+	);
+
+#endif // !UE_BUILD_SHIPPING
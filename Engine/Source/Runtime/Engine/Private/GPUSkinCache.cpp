@@ -34,6 +34,16 @@ static FAutoConsoleVariableRef CVarMaxGPUSkinCacheElementsPerFrame(
 	TEXT("The maximum compute processed skin cache elements per frame.")
 	);
 
+int32 GGPUSkinCacheReuse = 1;
+static FAutoConsoleVariableRef CVarGPUSkinCacheReuse(
+	TEXT("r.SkinCachingReuse"),
+	GGPUSkinCacheReuse,
+	TEXT("Whether meshes whose bones were not updated this frame (not recently rendered, update rate optimizations) keep the skin cache output of their last update.\n")
+	TEXT("Once that output is about to be overwritten, they are skinned again into the cache from their last bones instead of being skinned in the vertex shader of each pass.\n")
+	TEXT("0 is off, 1 is on(default)"),
+	ECVF_RenderThreadSafe
+	);
+
 TGlobalResource<FGPUSkinCache> GGPUSkinCache;
 
 IMPLEMENT_UNIFORM_BUFFER_STRUCT(GPUSkinCacheBonesUniformShaderParameters,TEXT("GPUSkinCacheBones"));
@@ -358,7 +368,18 @@ int32 FGPUSkinCache::StartCacheMesh(FRHICommandListImmediate& RHICmdList, int32
 	return ECSInfo->Key;
 }
 
-bool FGPUSkinCache::IsElementProcessed(int32 Key)
+bool FGPUSkinCache::IsOutputValid(const FElementCacheStatusInfo& CacheInfo) const
+{
+	if (CacheInfo.FrameUpdated == GFrameNumberRenderThread)
+	{
+		return true;
+	}
+
+	// The output of a frame is only overwritten once the frame slot comes around again, until then it can be reused
+	return GGPUSkinCacheReuse && GFrameNumberRenderThread - CacheInfo.FrameUpdated < GPUSKINCACHE_FRAMES;
+}
+
+bool FGPUSkinCache::IsElementProcessed(int32 Key, const FVertexFactory* TargetVertexFactory)
 {
 	if (!GEnableGPUSkinCache)
 	{
@@ -369,7 +390,8 @@ bool FGPUSkinCache::IsElementProcessed(int32 Key)
 	{
 		FElementCacheStatusInfo& CacheInfo = CachedElements.GetData()[Key];
 
-		if (CacheInfo.FrameUpdated == GFrameNumberRenderThread)
+		// The element may have been evicted and reused by another mesh
+		if (CacheInfo.TargetVertexFactory == TargetVertexFactory && IsOutputValid(CacheInfo))
 		{
 			return true;
 		}
@@ -384,8 +406,8 @@ bool FGPUSkinCache::SetVertexStreamFromCache(FRHICommandList& RHICmdList, int32
 	{
 		FElementCacheStatusInfo& CacheInfo = CachedElements.GetData()[Key];
 
-		// Verify that we found the correct chunk and that is was processed this frame
-		if (CacheInfo.BatchElement->BaseVertexIndex == BaseVertexIndex && CacheInfo.TargetVertexFactory == VertexFactory && CacheInfo.FrameUpdated == GFrameNumberRenderThread)
+		// Verify that we found the correct chunk and that its output is valid this frame
+		if (CacheInfo.BatchElement->BaseVertexIndex == BaseVertexIndex && CacheInfo.TargetVertexFactory == VertexFactory && IsOutputValid(CacheInfo))
 		{
 			int32 CompensatedOffset = ((int32)CacheInfo.StreamOffset*4) - (CacheInfo.BatchElement->BaseVertexIndex * CacheInfo.StreamStride);
 			if (CompensatedOffset < 0)
@@ -398,7 +420,9 @@ bool FGPUSkinCache::SetVertexStreamFromCache(FRHICommandList& RHICmdList, int32
 			FVertexShaderRHIParamRef VertexShaderRHI = Shader->GetVertexShader();
 			if (VelocityPass && VertexShaderRHI)
 			{
-				int32 PreviousCompensatedOffset = ((int32)CacheInfo.PreviousFrameStreamOffset*4) - (CacheInfo.BatchElement->BaseVertexIndex * CacheInfo.StreamStride);
+				// A reused output did not move since the last frame
+				const uint32 PreviousFrameStreamOffset = CacheInfo.FrameUpdated == GFrameNumberRenderThread ? CacheInfo.PreviousFrameStreamOffset : CacheInfo.StreamOffset;
+				int32 PreviousCompensatedOffset = ((int32)PreviousFrameStreamOffset*4) - (CacheInfo.BatchElement->BaseVertexIndex * CacheInfo.StreamStride);
 				if (PreviousCompensatedOffset < 0)
 				{
 					return false;
@@ -457,7 +481,8 @@ FGPUSkinCache::FElementCacheStatusInfo* FGPUSkinCache::FindEvictableCacheStatusI
 		CSInfo++;
 	}
 
-	if (BestEntry && BestFrameCounter < GFrameNumberRenderThread)
+	// Outputs still reused by their mesh can't be evicted, it may already be gathered for drawing with the cache
+	if (BestEntry && !IsOutputValid(*BestEntry))
 	{
 		return BestEntry;
 	}
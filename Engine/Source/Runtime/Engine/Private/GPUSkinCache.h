@@ -34,7 +34,8 @@ public:
 	void	Initialize();
 	void	Cleanup();
 
-	bool	IsElementProcessed(int32 Key);
+	// Whether the element has a valid output this frame for the vertex factory, either skinned this frame or reused from a recent frame
+	bool	IsElementProcessed(int32 Key, const FVertexFactory* TargetVertexFactory);
 
 	// For each SkeletalMeshObject:
 	//	Call Begin*
@@ -114,6 +115,8 @@ private:
 
 	FElementCacheStatusInfo* FindEvictableCacheStatusInfo();
 
+	bool	IsOutputValid(const FElementCacheStatusInfo& CacheInfo) const;
+
 	void	DispatchSkinCacheProcess(FRHICommandListImmediate& RHICmdList, uint32 InputStreamFloatOffset, uint32 OutputBufferFloatOffset, FBoneBufferTypeRef BoneBuffer, FUniformBufferRHIRef UniformBuffer, const FVertexBufferInfo* VBInfo, uint32 VertexStride, uint32 VertexCount, const FVector& MeshOrigin, const FVector& MeshExtension, bool bUseExtraBoneInfluences, ERHIFeatureLevel::Type FeatureLevel);
 
 	bool	Initialized : 1;
@@ -137,4 +140,5 @@ BEGIN_UNIFORM_BUFFER_STRUCT(GPUSkinCacheBonesUniformShaderParameters,)
 END_UNIFORM_BUFFER_STRUCT(GPUSkinCacheBonesUniformShaderParameters)
 
 extern	int32 GEnableGPUSkinCache;
+extern	int32 GGPUSkinCacheReuse;
 extern	TGlobalResource<FGPUSkinCache> GGPUSkinCache;
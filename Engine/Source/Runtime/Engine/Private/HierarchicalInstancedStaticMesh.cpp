@@ -10,6 +10,7 @@
 #include "InstancedStaticMesh.h"
 #include "NavigationSystemHelpers.h"
 #include "AI/Navigation/NavCollision.h"
+#include "ParallelFor.h"
 
 static TAutoConsoleVariable<int32> CVarFoliageSplitFactor(
 	TEXT("foliage.SplitFactor"),
@@ -61,6 +62,16 @@ TAutoConsoleVariable<float> CVarFoliageLODDistanceScale(
 	1.0f,
 	TEXT("Scale factor for the distance used in computing LOD for foliage."));
 
+static TAutoConsoleVariable<float> CVarFoliageIncrementalEditFraction(
+	TEXT("foliage.IncrementalEditFraction"),
+	0.1f,
+	TEXT("Fraction of the instances of a built foliage tree that can be added, removed or moved by editing the tree in place. Past it the tree is rebuilt async. 0 always rebuilds."));
+
+static TAutoConsoleVariable<int32> CVarFoliageParallelTraversalMinClusters(
+	TEXT("foliage.ParallelTraversalMinClusters"),
+	1024,
+	TEXT("Cluster trees with at least this many nodes are traversed on the task graph worker threads. 0 disables the parallel traversal."));
+
 
 DECLARE_CYCLE_STAT(TEXT("Traversal Time"),STAT_FoliageTraversalTime,STATGROUP_Foliage);
 DECLARE_CYCLE_STAT(TEXT("Build Time"), STAT_FoliageBuildTime, STATGROUP_Foliage);
@@ -565,7 +576,8 @@ static FAutoConsoleCommand UnFreezeFoliageCullingCmd(
 
 
 struct FFoliageElementParams;
-struct FFoliageRenderInstanceParams;
+template<typename AllocatorType> struct TFoliageRenderInstanceParams;
+typedef TFoliageRenderInstanceParams<SceneRenderingAllocator> FFoliageRenderInstanceParams;
 struct FFoliageCullInstanceParams;
 
 class FHierarchicalStaticMeshSceneProxy : public FInstancedStaticMeshSceneProxy
@@ -650,20 +662,27 @@ public:
 
 	void FillDynamicMeshElements(FMeshElementCollector& Collector, const FFoliageElementParams& ElementParams, const FFoliageRenderInstanceParams& Instances) const;
 
+	/** Adds to OutRuns the runs of the instances of the subtree at Index that pass the culling */
+	template<bool TUseVector, typename RunsType>
+	void Traverse(const FFoliageCullInstanceParams& Params, const RunsType& OutRuns, int32 Index, int32 MinLOD, int32 MaxLOD, bool bFullyContained = false) const;
+
+	/** Same result as Traverse from the root, with the subtrees traversed on the task graph worker threads */
 	template<bool TUseVector>
-	void Traverse(const FFoliageCullInstanceParams& Params, int32 Index, int32 MinLOD, int32 MaxLOD, bool bFullyContained = false) const;
+	void TraverseParallel(const FFoliageCullInstanceParams& Params, int32 MinLOD, int32 MaxLOD, bool bFullyContained) const;
 };
 
-struct FFoliageRenderInstanceParams
+/** Runs of instances to render for each LOD. The worker threads collect theirs with the default allocator, as they have no mem stack mark */
+template<typename AllocatorType>
+struct TFoliageRenderInstanceParams
 {
 	bool bNeedsSingleLODRuns;
 	bool bNeedsMultipleLODRuns;
-	mutable TArray<uint32, SceneRenderingAllocator> MultipleLODRuns[MAX_STATIC_MESH_LODS];
-	mutable TArray<uint32, SceneRenderingAllocator> SingleLODRuns[MAX_STATIC_MESH_LODS];
+	mutable TArray<uint32, AllocatorType> MultipleLODRuns[MAX_STATIC_MESH_LODS];
+	mutable TArray<uint32, AllocatorType> SingleLODRuns[MAX_STATIC_MESH_LODS];
 	mutable int32 TotalSingleLODInstances[MAX_STATIC_MESH_LODS];
 	mutable int32 TotalMultipleLODInstances[MAX_STATIC_MESH_LODS];
 
-	FFoliageRenderInstanceParams(bool InbNeedsSingleLODRuns, bool InbNeedsMultipleLODRuns)
+	TFoliageRenderInstanceParams(bool InbNeedsSingleLODRuns, bool InbNeedsMultipleLODRuns)
 		: bNeedsSingleLODRuns(InbNeedsSingleLODRuns)
 		, bNeedsMultipleLODRuns(InbNeedsMultipleLODRuns)
 	{
@@ -673,7 +692,7 @@ struct FFoliageRenderInstanceParams
 			TotalMultipleLODInstances[Index] = 0;
 		}
 	}
-	static FORCEINLINE_DEBUGGABLE void AddRun(TArray<uint32, SceneRenderingAllocator>& Array, int32 FirstInstance, int32 LastInstance)
+	static FORCEINLINE_DEBUGGABLE void AddRun(TArray<uint32, AllocatorType>& Array, int32 FirstInstance, int32 LastInstance)
 	{
 		if (Array.Num() && Array.Last() + 1 == FirstInstance)
 		{
@@ -706,6 +725,25 @@ struct FFoliageRenderInstanceParams
 	{
 		AddRun(MinLod, MaxLod, Node.FirstInstance, Node.LastInstance);
 	}
+
+	/** Appends runs collected after the ones already added */
+	template<typename OtherAllocatorType>
+	void AppendRuns(const TFoliageRenderInstanceParams<OtherAllocatorType>& Other) const
+	{
+		for (int32 Lod = 0; Lod < MAX_STATIC_MESH_LODS; Lod++)
+		{
+			for (int32 Run = 0; Run < Other.SingleLODRuns[Lod].Num(); Run += 2)
+			{
+				AddRun(SingleLODRuns[Lod], Other.SingleLODRuns[Lod][Run], Other.SingleLODRuns[Lod][Run + 1]);
+			}
+			for (int32 Run = 0; Run < Other.MultipleLODRuns[Lod].Num(); Run += 2)
+			{
+				AddRun(MultipleLODRuns[Lod], Other.MultipleLODRuns[Lod][Run], Other.MultipleLODRuns[Lod][Run + 1]);
+			}
+			TotalSingleLODInstances[Lod] += Other.TotalSingleLODInstances[Lod];
+			TotalMultipleLODInstances[Lod] += Other.TotalMultipleLODInstances[Lod];
+		}
+	}
 };
 
 struct FFoliageCullInstanceParams : public FFoliageRenderInstanceParams
@@ -827,15 +865,22 @@ static FORCEINLINE_DEBUGGABLE bool CullNode(const FFoliageCullInstanceParams& Pa
 	return false;
 }
 
+enum EFoliageNodeVisit
+{
+	FoliageNode_Culled,
+	FoliageNode_Run,		// All the instances of the node are rendered
+	FoliageNode_Split,		// The children of the node need to be visited
+};
+
+/** Culls a node and narrows its LOD range, the range and containment are updated for the children */
 template<bool TUseVector>
-void FHierarchicalStaticMeshSceneProxy::Traverse(const FFoliageCullInstanceParams& Params, int32 Index, int32 MinLOD, int32 MaxLOD, bool bFullyContained) const
+static FORCEINLINE_DEBUGGABLE EFoliageNodeVisit VisitNode(const FFoliageCullInstanceParams& Params, const FClusterNode& Node, int32& MinLOD, int32& MaxLOD, bool& bFullyContained)
 {
-	const FClusterNode& Node = Params.Tree[Index];
 	if (!bFullyContained)
 	{
 		if (CullNode<TUseVector>(Params, Node, bFullyContained))
 		{
-			return;
+			return FoliageNode_Culled;
 		}
 	}
 
@@ -854,7 +899,7 @@ void FHierarchicalStaticMeshSceneProxy::Traverse(const FFoliageCullInstanceParam
 		}
 		if (MinLOD >= Params.LODs)
 		{
-			return;
+			return FoliageNode_Culled;
 		}
 		while (MaxLOD > MinLOD && FarDot < Params.LODPlanesMin[MaxLOD - 1])
 		{
@@ -867,12 +912,124 @@ void FHierarchicalStaticMeshSceneProxy::Traverse(const FFoliageCullInstanceParam
 	if (!bSplit)
 	{
 		MaxLOD = FMath::Min(MaxLOD, Params.LODs - 1);
-		Params.AddRun(MinLOD, MaxLOD, Node);
+		return FoliageNode_Run;
+	}
+	return FoliageNode_Split;
+}
+
+template<bool TUseVector, typename RunsType>
+void FHierarchicalStaticMeshSceneProxy::Traverse(const FFoliageCullInstanceParams& Params, const RunsType& OutRuns, int32 Index, int32 MinLOD, int32 MaxLOD, bool bFullyContained) const
+{
+	const FClusterNode& Node = Params.Tree[Index];
+	switch (VisitNode<TUseVector>(Params, Node, MinLOD, MaxLOD, bFullyContained))
+	{
+	case FoliageNode_Culled:
 		return;
+	case FoliageNode_Run:
+		OutRuns.AddRun(MinLOD, MaxLOD, Node);
+		return;
+	default:
+		break;
 	}
 	for (int32 ChildIndex = Node.FirstChild; ChildIndex <= Node.LastChild; ChildIndex++)
 	{
-		Traverse<TUseVector>(Params, ChildIndex, MinLOD, MaxLOD, bFullyContained);
+		Traverse<TUseVector>(Params, OutRuns, ChildIndex, MinLOD, MaxLOD, bFullyContained);
+	}
+}
+
+/** A node to traverse from, or a run found while splitting the tree for the parallel traversal */
+struct FFoliageTraversalItem
+{
+	int32 Index;
+	int32 MinLOD;
+	int32 MaxLOD;
+	bool bFullyContained;
+	bool bVisited;
+
+	FFoliageTraversalItem(int32 InIndex, int32 InMinLOD, int32 InMaxLOD, bool InbFullyContained)
+		: Index(InIndex)
+		, MinLOD(InMinLOD)
+		, MaxLOD(InMaxLOD)
+		, bFullyContained(InbFullyContained)
+		, bVisited(false)
+	{
+	}
+};
+
+template<bool TUseVector>
+void FHierarchicalStaticMeshSceneProxy::TraverseParallel(const FFoliageCullInstanceParams& Params, int32 MinLOD, int32 MaxLOD, bool bFullyContained) const
+{
+	// Split the top of the tree until there are a few subtrees per thread. The items stay in traversal order, so the runs can be merged in order
+	const int32 NumItemsWanted = (FTaskGraphInterface::Get().GetNumWorkerThreads() + 1) * 4;
+
+	TArray<FFoliageTraversalItem, SceneRenderingAllocator> Items;
+	TArray<FFoliageTraversalItem, SceneRenderingAllocator> SplitItems;
+	new(Items) FFoliageTraversalItem(0, MinLOD, MaxLOD, bFullyContained);
+
+	bool bSplitAny = true;
+	while (bSplitAny && Items.Num() < NumItemsWanted)
+	{
+		bSplitAny = false;
+		SplitItems.Reset();
+
+		for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ItemIndex++)
+		{
+			FFoliageTraversalItem Item = Items[ItemIndex];
+			if (Item.bVisited)
+			{
+				SplitItems.Add(Item);
+				continue;
+			}
+
+			const FClusterNode& Node = Params.Tree[Item.Index];
+			switch (VisitNode<TUseVector>(Params, Node, Item.MinLOD, Item.MaxLOD, Item.bFullyContained))
+			{
+			case FoliageNode_Culled:
+				break;
+			case FoliageNode_Run:
+				Item.bVisited = true;
+				SplitItems.Add(Item);
+				break;
+			default:
+				bSplitAny = true;
+				for (int32 ChildIndex = Node.FirstChild; ChildIndex <= Node.LastChild; ChildIndex++)
+				{
+					new(SplitItems) FFoliageTraversalItem(ChildIndex, Item.MinLOD, Item.MaxLOD, Item.bFullyContained);
+				}
+				break;
+			}
+		}
+
+		Exchange(Items, SplitItems);
+	}
+
+	TArray<TFoliageRenderInstanceParams<FDefaultAllocator>> SubtreeRuns;
+	SubtreeRuns.Reserve(Items.Num());
+	for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ItemIndex++)
+	{
+		new(SubtreeRuns) TFoliageRenderInstanceParams<FDefaultAllocator>(Params.bNeedsSingleLODRuns, Params.bNeedsMultipleLODRuns);
+	}
+
+	ParallelFor(Items.Num(), [&](int32 ItemIndex)
+	{
+		const FFoliageTraversalItem& Item = Items[ItemIndex];
+		if (!Item.bVisited)
+		{
+			Traverse<TUseVector>(Params, SubtreeRuns[ItemIndex], Item.Index, Item.MinLOD, Item.MaxLOD, Item.bFullyContained);
+		}
+	});
+
+	for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ItemIndex++)
+	{
+		const FFoliageTraversalItem& Item = Items[ItemIndex];
+		if (Item.bVisited)
+		{
+			Params.AddRun(Item.MinLOD, Item.MaxLOD, Params.Tree[Item.Index]);
+		}
+		else
+		{
+			Params.AppendRuns(SubtreeRuns[ItemIndex]);
+		}
 	}
 }
 
@@ -1221,15 +1378,29 @@ void FHierarchicalStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<cons
 						MinLOD = Force;
 						MaxLOD = Force;
 					}
+					const int32 ParallelTraversalMinClusters = CVarFoliageParallelTraversalMinClusters.GetValueOnRenderThread();
+					const bool bParallelTraversal = ParallelTraversalMinClusters > 0 && ClusterTree.Num() >= ParallelTraversalMinClusters && FApp::ShouldUseThreadingForPerformance();
+
 					if (CVarCullAll.GetValueOnRenderThread() < 1)
 					{
-						if (bUseVectorCull)
+						if (bParallelTraversal)
+						{
+							if (bUseVectorCull)
+							{
+								TraverseParallel<true>(InstanceParams, MinLOD, MaxLOD, bDisableCull);
+							}
+							else
+							{
+								TraverseParallel<false>(InstanceParams, MinLOD, MaxLOD, bDisableCull);
+							}
+						}
+						else if (bUseVectorCull)
 						{
-							Traverse<true>(InstanceParams, 0, MinLOD, MaxLOD, bDisableCull);
+							Traverse<true>(InstanceParams, InstanceParams, 0, MinLOD, MaxLOD, bDisableCull);
 						}
 						else
 						{
-							Traverse<false>(InstanceParams, 0, MinLOD, MaxLOD, bDisableCull);
+							Traverse<false>(InstanceParams, InstanceParams, 0, MinLOD, MaxLOD, bDisableCull);
 						}
 					}
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
@@ -1322,6 +1493,7 @@ UHierarchicalInstancedStaticMeshComponent::UHierarchicalInstancedStaticMeshCompo
 	, ClusterTreePtr(MakeShareable(new TArray<FClusterNode>))
 	, NumBuiltInstances(0)
 	, UnbuiltInstanceBounds(0)
+	, NumIncrementalEdits(0)
 	, bIsAsyncBuilding(false)
 	, bConcurrentRemoval(false)
 	, AccumulatedNavigationDirtyArea(0)
@@ -1361,7 +1533,20 @@ bool UHierarchicalInstancedStaticMeshComponent::RemoveInstance(int32 InstanceInd
 	PartialNavigationUpdate(InstanceIndex);
 
 	// Save the render index
-	RemovedInstances.Add(InstanceReorderTable[InstanceIndex]);
+	const int32 RemovedRenderIndex = InstanceReorderTable[InstanceIndex];
+	RemovedInstances.Add(RemovedRenderIndex);
+
+	// Keep the tree order remapping valid: the removed render index becomes a hole and the last instance is swapped in its place
+	const int32 LastInstanceIndex = PerInstanceSMData.Num() - 1;
+	const int32 MovedRenderIndex = InstanceReorderTable[LastInstanceIndex];
+	if (SortedInstances.IsValidIndex(RemovedRenderIndex))
+	{
+		SortedInstances[RemovedRenderIndex] = INDEX_NONE;
+	}
+	if (InstanceIndex != LastInstanceIndex && SortedInstances.IsValidIndex(MovedRenderIndex))
+	{
+		SortedInstances[MovedRenderIndex] = InstanceIndex;
+	}
 	
 	// Remove the instance
 	PerInstanceSMData.RemoveAtSwap(InstanceIndex);
@@ -1378,6 +1563,12 @@ bool UHierarchicalInstancedStaticMeshComponent::RemoveInstance(int32 InstanceInd
 		// invalidate the results of the current async build as it's too slow to fix up deletes
 		bConcurrentRemoval = true;
 	}
+	else if (CanEditTreeIncrementally())
+	{
+		// the hole is hidden by the instance buffer, the tree stays valid as it is
+		++NumIncrementalEdits;
+		FlushAccumulatedNavigationUpdates();
+	}
 	else
 	{
 		BuildTreeAsync();
@@ -1412,6 +1603,16 @@ bool UHierarchicalInstancedStaticMeshComponent::UpdateInstanceTransform(int32 In
 		return false;
 	}
 
+	if (CanEditTreeIncrementally())
+	{
+		// Keep the render index and refit the clusters containing it
+		bool Result = Super::UpdateInstanceTransform(InstanceIndex, NewInstanceTransform, bWorldSpace);
+		RefitTreeForInstance(InstanceIndex);
+		++NumIncrementalEdits;
+		FlushAccumulatedNavigationUpdates();
+		return Result;
+	}
+
 	if (IsAsyncBuilding())
 	{
 		// invalidate the results of the current async build we need to modify the tree
@@ -1419,7 +1620,12 @@ bool UHierarchicalInstancedStaticMeshComponent::UpdateInstanceTransform(int32 In
 	}
 
 	// Treat the old instance render data like a removal.
-	RemovedInstances.Add(InstanceReorderTable[InstanceIndex]);
+	const int32 OldRenderIndex = InstanceReorderTable[InstanceIndex];
+	RemovedInstances.Add(OldRenderIndex);
+	if (SortedInstances.IsValidIndex(OldRenderIndex))
+	{
+		SortedInstances[OldRenderIndex] = INDEX_NONE;
+	}
 
 	// Allocate a new instance render order ID, rendered last
 	InstanceReorderTable[InstanceIndex] = PerInstanceSMData.Num()-1 + RemovedInstances.Num();
@@ -1440,6 +1646,14 @@ int32 UHierarchicalInstancedStaticMeshComponent::AddInstance(const FTransform& I
 {
 	int32 InstanceIndex = UInstancedStaticMeshComponent::AddInstance(InstanceTransform);
 
+	if (PerInstanceSMData.Num() > 1 && CanEditTreeIncrementally())
+	{
+		InsertInstanceIntoTree(InstanceIndex);
+		++NumIncrementalEdits;
+		FlushAccumulatedNavigationUpdates();
+		return InstanceIndex;
+	}
+
 	// Need to offset the newly added instance's RenderIndex by the amount that will be adjusted at the end of the frame
 	InstanceReorderTable.Add(InstanceIndex + RemovedInstances.Num());
 
@@ -1470,11 +1684,135 @@ void UHierarchicalInstancedStaticMeshComponent::ClearInstances()
 
 	ClusterTreePtr = MakeShareable(new TArray<FClusterNode>);
 	NumBuiltInstances = 0;
+	NumIncrementalEdits = 0;
 	UnbuiltInstanceBounds.Init();
+	SortedInstances.Empty();
 
 	Super::ClearInstances();
 }
 
+bool UHierarchicalInstancedStaticMeshComponent::CanEditTreeIncrementally() const
+{
+	// The tree must cover every render index, a partially built one is about to be replaced anyway
+	if (IsAsyncBuilding() || !StaticMesh || ClusterTreePtr->Num() == 0 || !IsTreeFullyBuilt() || SortedInstances.Num() != NumBuiltInstances)
+	{
+		return false;
+	}
+
+	const int32 MaxIncrementalEdits = FMath::TruncToInt(CVarFoliageIncrementalEditFraction.GetValueOnGameThread() * NumBuiltInstances);
+	return NumIncrementalEdits < MaxIncrementalEdits;
+}
+
+void UHierarchicalInstancedStaticMeshComponent::InsertInstanceIntoTree(int32 InstanceIndex)
+{
+	check(InstanceIndex == PerInstanceSMData.Num() - 1 && InstanceReorderTable.Num() == InstanceIndex);
+
+	const FBox InstanceBox = StaticMesh->GetBounds().GetBox().TransformBy(PerInstanceSMData[InstanceIndex].Transform);
+
+	// The scene proxy shares the current tree with the render thread, so edit a copy
+	TSharedPtr<TArray<FClusterNode>, ESPMode::ThreadSafe> NewClusterTreePtr = MakeShareable(new TArray<FClusterNode>(*ClusterTreePtr));
+	TArray<FClusterNode>& ClusterTree = *NewClusterTreePtr;
+
+	// Descend to the leaf whose bounds grow the least, growing the bounds of the path on the way
+	int32 NodeIndex = 0;
+	while (true)
+	{
+		FClusterNode& Node = ClusterTree[NodeIndex];
+		const FBox NodeBox = FBox(Node.BoundMin, Node.BoundMax) + InstanceBox;
+		Node.BoundMin = NodeBox.Min;
+		Node.BoundMax = NodeBox.Max;
+
+		if (Node.FirstChild < 0)
+		{
+			break;
+		}
+
+		int32 BestChild = Node.FirstChild;
+		float BestGrowth = MAX_flt;
+		for (int32 Child = Node.FirstChild; Child <= Node.LastChild; Child++)
+		{
+			const FBox ChildBox(ClusterTree[Child].BoundMin, ClusterTree[Child].BoundMax);
+			const float Growth = (ChildBox + InstanceBox).GetVolume() - ChildBox.GetVolume();
+			if (Growth < BestGrowth)
+			{
+				BestGrowth = Growth;
+				BestChild = Child;
+			}
+		}
+		NodeIndex = BestChild;
+	}
+
+	// The instance gets the render index right after the last one of the leaf, every render index from there on moves up by one.
+	// Ranges are nested, so the nodes that contain the one before are the leaf and its ancestors
+	const int32 RenderIndex = ClusterTree[NodeIndex].LastInstance + 1;
+	for (FClusterNode& Node : ClusterTree)
+	{
+		if (Node.FirstInstance >= RenderIndex)
+		{
+			Node.FirstInstance++;
+			Node.LastInstance++;
+		}
+		else if (Node.LastInstance >= RenderIndex - 1)
+		{
+			Node.LastInstance++;
+		}
+	}
+
+	for (int32& Index : InstanceReorderTable)
+	{
+		if (Index >= RenderIndex)
+		{
+			Index++;
+		}
+	}
+	for (int32& Index : RemovedInstances)
+	{
+		if (Index >= RenderIndex)
+		{
+			Index++;
+		}
+	}
+
+	InstanceReorderTable.Add(RenderIndex);
+	SortedInstances.Insert(InstanceIndex, RenderIndex);
+	NumBuiltInstances++;
+
+	ClusterTreePtr = NewClusterTreePtr;
+}
+
+void UHierarchicalInstancedStaticMeshComponent::RefitTreeForInstance(int32 InstanceIndex)
+{
+	const int32 RenderIndex = InstanceReorderTable[InstanceIndex];
+	const FBox InstanceBox = StaticMesh->GetBounds().GetBox().TransformBy(PerInstanceSMData[InstanceIndex].Transform);
+
+	// The scene proxy shares the current tree with the render thread, so edit a copy
+	TSharedPtr<TArray<FClusterNode>, ESPMode::ThreadSafe> NewClusterTreePtr = MakeShareable(new TArray<FClusterNode>(*ClusterTreePtr));
+	TArray<FClusterNode>& ClusterTree = *NewClusterTreePtr;
+
+	// Bounds only grow, the old position is still covered until the next rebuild
+	int32 NodeIndex = 0;
+	while (NodeIndex >= 0)
+	{
+		FClusterNode& Node = ClusterTree[NodeIndex];
+		const FBox NodeBox = FBox(Node.BoundMin, Node.BoundMax) + InstanceBox;
+		Node.BoundMin = NodeBox.Min;
+		Node.BoundMax = NodeBox.Max;
+
+		int32 NextNode = INDEX_NONE;
+		for (int32 Child = Node.FirstChild; Child >= 0 && Child <= Node.LastChild; Child++)
+		{
+			if (ClusterTree[Child].FirstInstance <= RenderIndex && RenderIndex <= ClusterTree[Child].LastInstance)
+			{
+				NextNode = Child;
+				break;
+			}
+		}
+		NodeIndex = NextNode;
+	}
+
+	ClusterTreePtr = NewClusterTreePtr;
+}
+
 bool UHierarchicalInstancedStaticMeshComponent::ShouldCreatePhysicsState() const
 {
 	if (bDisableCollision)
@@ -1515,6 +1853,7 @@ void UHierarchicalInstancedStaticMeshComponent::BuildTree()
 		Builder->Build();
 
 		NumBuiltInstances = Builder->Result->InstanceReorderTable.Num();
+		NumIncrementalEdits = 0;
 		UnbuiltInstanceBounds.Init();
 		RemovedInstances.Empty();
 
@@ -1561,6 +1900,7 @@ void UHierarchicalInstancedStaticMeshComponent::AcceptPrebuiltTree(
 	)
 {
 	NumBuiltInstances = PerInstanceSMData.Num();
+	NumIncrementalEdits = 0;
 	UnbuiltInstanceBounds.Init();
 	RemovedInstances.Empty();
 	ClusterTreePtr = MakeShareable(new TArray<FClusterNode>);
@@ -1616,6 +1956,7 @@ void UHierarchicalInstancedStaticMeshComponent::BuildFlatTree(const TArray<int32
 		}
 
 		NumBuiltInstances = PerInstanceSMData.Num();
+		NumIncrementalEdits = 0;
 		UnbuiltInstanceBounds.Init();
 		RemovedInstances.Empty();
 
@@ -1701,6 +2042,7 @@ void UHierarchicalInstancedStaticMeshComponent::ApplyBuildTreeAsync(ENamedThread
 	else
 	{
 		NumBuiltInstances = Builder->Result->InstanceReorderTable.Num();
+		NumIncrementalEdits = 0;
 
 	    if (NumBuiltInstances < PerInstanceSMData.Num())
 	    {
@@ -1828,6 +2170,11 @@ static void GatherInstanceTransformsInArea(const UHierarchicalInstancedStaticMes
 			for (int32 i = ChildNode.FirstInstance; i <= ChildNode.LastInstance; ++i)
 			{
 				int32 SortedIdx = bUseRemaping ? Component.SortedInstances[i] : i;
+				if (SortedIdx == INDEX_NONE)
+				{
+					// removed since the tree was built
+					continue;
+				}
 				FTransform InstanceToComponent(Component.PerInstanceSMData[SortedIdx].Transform);
 				if (!InstanceToComponent.GetScale3D().IsZero())
 				{
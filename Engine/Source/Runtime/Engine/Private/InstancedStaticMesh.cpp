@@ -879,6 +879,31 @@ void UInstancedStaticMeshComponent::CreateAllInstanceBodies()
 	int32 NumBodies = PerInstanceSMData.Num();
 	InstanceBodies.Init(NumBodies);
 
+#if WITH_PHYSX
+	// Static instances don't use aggregates, create all their actors first and add them to the scene at once
+	UBodySetup* BodySetup = StaticMesh ? GetBodySetup() : NULL;
+	if (Mobility != EComponentMobility::Movable && BodySetup)
+	{
+		TArray<FTransform> Transforms;
+		Transforms.Reserve(NumBodies);
+
+		for (int32 i = 0; i < NumBodies; ++i)
+		{
+			FBodyInstance* InstanceBodyInstance = new FBodyInstance;
+			InstanceBodyInstance->CopyBodyInstancePropertiesFrom(&BodyInstance);
+			InstanceBodyInstance->InstanceBodyIndex = i;
+			InstanceBodyInstance->bSimulatePhysics = false;
+			InstanceBodyInstance->bAutoWeld = false;
+			InstanceBodies[i] = InstanceBodyInstance;
+
+			Transforms.Add(FTransform(PerInstanceSMData[i].Transform) * ComponentToWorld);
+		}
+
+		FBodyInstance::InitStaticBodies(InstanceBodies, Transforms, BodySetup, this, GetWorld()->GetPhysicsScene());
+		return;
+	}
+#endif //WITH_PHYSX
+
 	for (int32 i = 0; i < NumBodies; ++i)
 	{
 		InstanceBodies[i] = new FBodyInstance;
@@ -690,8 +690,10 @@ static void SortActorsHierarchy(TTransArray<AActor*>& Actors)
 	});
 }
 
-void ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bRerunConstructionScripts)
+int32 ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bRerunConstructionScripts)
 {
+	int32 NumComponentsUpdated = 0;
+
 	// A value of 0 means that we want to update all components.
 	if (NumComponentsToUpdate != 0)
 	{
@@ -714,7 +716,9 @@ void ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bReru
 		bool bAllComponentsRegistered = true;
 		if (Actor)
 		{
-			bAllComponentsRegistered = Actor->IncrementalRegisterComponents(NumComponentsToUpdate);
+			int32 NumActorComponentsRegistered = 0;
+			bAllComponentsRegistered = Actor->IncrementalRegisterComponents(NumComponentsToUpdate, &NumActorComponentsRegistered);
+			NumComponentsUpdated += NumActorComponentsRegistered;
 		}
 
 		if (bAllComponentsRegistered)
@@ -757,6 +761,8 @@ void ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bReru
 		// The editor is never allowed to incrementally updated components.  Make sure to pass in a value of zero for NumActorsToUpdate.
 		check(OwningWorld->IsGameWorld());
 	}
+
+	return NumComponentsUpdated;
 }
 
 #if WITH_EDITOR
@@ -353,6 +353,57 @@ AActor* UWorld::SpawnActor( UClass* Class, FVector const* Location, FRotator con
 }
 
 
+AActor* UWorld::SpawnActorFromPool( UClass* Class, FVector const& Location, FRotator const& Rotation, const FActorSpawnParameters& SpawnParameters )
+{
+	TArray<TWeakObjectPtr<AActor> >* PooledActors = ActorPool.Find(Class);
+	while (PooledActors && PooledActors->Num())
+	{
+		AActor* Actor = PooledActors->Pop().Get();
+		// skip the actors destroyed while in the pool, e.g. when their level was unloaded
+		if (Actor && !Actor->IsPendingKill())
+		{
+			SCOPE_CYCLE_COUNTER(STAT_SpawnActorFromPoolTime);
+			Actor->SetOwner(SpawnParameters.Owner);
+			Actor->Instigator = SpawnParameters.Instigator;
+			Actor->TeleportTo(Location, Rotation, false, true);
+			Actor->OnReusedFromPool();
+			OnActorSpawned.Broadcast(Actor);
+			return Actor;
+		}
+	}
+	return SpawnActor(Class, &Location, &Rotation, SpawnParameters);
+}
+
+void UWorld::ReleaseActorToPool( AActor* Actor )
+{
+	check(Actor && Actor->GetWorld() == this);
+	if (Actor->GetIsReplicated() || bIsTearingDown)
+	{
+		Actor->Destroy();
+		return;
+	}
+	Actor->OnReleasedToPool();
+	ActorPool.FindOrAdd(Actor->GetClass()).Add(Actor);
+}
+
+void UWorld::PrewarmActorPool( UClass* Class, int32 Count )
+{
+	TArray<TWeakObjectPtr<AActor> >& PooledActors = ActorPool.FindOrAdd(Class);
+	FActorSpawnParameters SpawnInfo;
+	SpawnInfo.bNoCollisionFail = true;
+	while (PooledActors.Num() < Count)
+	{
+		AActor* Actor = SpawnActor(Class, NULL, NULL, SpawnInfo);
+		if (!Actor || Actor->GetIsReplicated())
+		{
+			UE_LOG(LogSpawn, Warning, TEXT("PrewarmActorPool failed for class %s"), *Class->GetName());
+			break;
+		}
+		Actor->OnReleasedToPool();
+		PooledActors.Add(Actor);
+	}
+}
+
 ABrush* UWorld::SpawnBrush()
 {
 	FActorSpawnParameters SpawnInfo;
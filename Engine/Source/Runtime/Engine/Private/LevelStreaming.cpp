@@ -473,7 +473,7 @@ bool ULevelStreaming::RequestLevel(UWorld* PersistentWorld, bool bAllowLevelLoad
 			// Kick off async load request.
 			LoadPackageAsync(*DesiredPackageName.ToString(), 
 				FLoadPackageAsyncDelegate::CreateUObject(this, &ULevelStreaming::AsyncLevelLoadComplete), 
-				NULL, NAME_None, *PackageNameToLoadFrom
+				NULL, NAME_None, *PackageNameToLoadFrom, LoadPriority
 				).SetPackageData(PackageFlags, PIEInstanceID);
 
 			// streamingServer: server loads everything?
@@ -738,6 +738,21 @@ void ULevelStreaming::SetWorldAssetByPackageName(FName InPackageName)
 	WorldAsset = TargetWorldPackageName + TEXT(".") + TargetWorldObjectName;
 }
 
+void ULevelStreaming::SetLoadPriority(int32 InLoadPriority)
+{
+	if (LoadPriority == InLoadPriority)
+	{
+		return;
+	}
+
+	LoadPriority = InLoadPriority;
+
+	if (bHasLoadRequestPending)
+	{
+		SetAsyncLoadPriority(GetLODPackageName(), LoadPriority);
+	}
+}
+
 void ULevelStreaming::RenameForPIE(int32 PIEInstanceID)
 {
 	// Apply PIE prefix so this level references
@@ -881,6 +896,7 @@ ULevelStreaming::ULevelStreaming(const FObjectInitializer& ObjectInitializer)
 	MinTimeBetweenVolumeUnloadRequests = 2.0f;
 	bDrawOnLevelStatusMap = true;
 	LevelLODIndex = INDEX_NONE;
+	LoadPriority = 0;
 }
 
 #if WITH_EDITOR
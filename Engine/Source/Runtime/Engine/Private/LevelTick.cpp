@@ -43,6 +43,7 @@ DEFINE_STAT(STAT_AsyncWorkWaitTime);
 DEFINE_STAT(STAT_PhysicsTime);
 
 DEFINE_STAT(STAT_SpawnActorTime);
+DEFINE_STAT(STAT_SpawnActorFromPoolTime);
 
 DEFINE_STAT(STAT_GCSweepTime);
 DEFINE_STAT(STAT_GCMarkTime);
@@ -76,6 +77,7 @@ DEFINE_STAT(STAT_NetConsiderActorsTime);
 DEFINE_STAT(STAT_NetInitialDormantCheckTime);
 DEFINE_STAT(STAT_NetPrioritizeActorsTime);
 DEFINE_STAT(STAT_NetReplicateActorsTime);
+DEFINE_STAT(STAT_NetParallelReplicateTime);
 DEFINE_STAT(STAT_NetReplicateDynamicPropTime);
 DEFINE_STAT(STAT_NetSkippedDynamicProps);
 DEFINE_STAT(STAT_NetSerializeItemDeltaTime);
@@ -701,6 +703,16 @@ static TAutoConsoleVariable<int32> CVarAllowAsyncRenderThreadUpdates(
 	0,
 	TEXT("Used to control async renderthread updates."));
 
+static TAutoConsoleVariable<int32> CVarIncrementalReachabilityGC(
+	TEXT("gc.IncrementalReachability"),
+	0,
+	TEXT("If 1, the periodic garbage collection walks the object graph over several frames instead of in one go."));
+
+static TAutoConsoleVariable<float> CVarIncrementalReachabilityTimeLimit(
+	TEXT("gc.IncrementalReachabilityTimeLimit"),
+	2.0f,
+	TEXT("Time in milliseconds the incremental garbage collection can spend walking the object graph each frame."));
+
 void UWorld::MarkActorComponentForNeededEndOfFrameUpdate(class UActorComponent* Component, bool bForceGameThread)
 {
 	check(!bPostTickComponentUpdate); // can't call this while we are doing the updates
@@ -1096,6 +1108,9 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 	// If caller wants time update only, or we are paused, skip the rest.
 	if (bDoingActorTicks)
 	{
+		// Significances are updated before any tick is scheduled, so their post functions can change tick intervals
+		SignificanceManager->Tick(this);
+
 		// Reset Async Trace before Tick starts 
 		{
 			SCOPE_CYCLE_COUNTER(STAT_ResetAsyncTraceTickTime);
@@ -1299,13 +1314,34 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 		{
 			bShouldDelayGarbageCollect = false;
 		}
+		// Keep walking the object graph if an incremental collection is in flight.
+		else if( IsIncrementalReachabilityPending() )
+		{
+			SCOPE_CYCLE_COUNTER(STAT_GCMarkTime);
+			if( CollectGarbageIncremental( GARBAGE_COLLECTION_KEEPFLAGS, CVarIncrementalReachabilityTimeLimit.GetValueOnGameThread() / 1000.0f ) )
+			{
+				CleanupActors();
+				TimeSinceLastPendingKillPurge = 0;
+			}
+		}
 		// Perform incremental purge update if it's pending or in progress.
 		else if( !IsIncrementalPurgePending() 
 		// Purge reference to pending kill objects every now and so often.
 		&&	(TimeSinceLastPendingKillPurge > TimeBetweenPurgingPendingKillObjects) && TimeBetweenPurgingPendingKillObjects > 0 )
 		{
 			SCOPE_CYCLE_COUNTER(STAT_GCMarkTime);
-			PerformGarbageCollectionAndCleanupActors();
+			if( CVarIncrementalReachabilityGC.GetValueOnGameThread() != 0 )
+			{
+				// Only marks the roots, the walk goes on over the next frames. Same as below, don't start while loading.
+				if( !IsAsyncLoading() )
+				{
+					CollectGarbageIncremental( GARBAGE_COLLECTION_KEEPFLAGS, CVarIncrementalReachabilityTimeLimit.GetValueOnGameThread() / 1000.0f );
+				}
+			}
+			else
+			{
+				PerformGarbageCollectionAndCleanupActors();
+			}
 		}
 		else
 		{
@@ -698,6 +698,7 @@ void ULightComponent::SetLightFunctionMaterial(UMaterialInterface* NewLightFunct
 		&& NewLightFunctionMaterial != LightFunctionMaterial)
 	{
 		LightFunctionMaterial = NewLightFunctionMaterial;
+		GCClusterWriteBarrier(this, LightFunctionMaterial);
 		MarkRenderStateDirty();
 	}
 }
@@ -938,6 +939,7 @@ void ULightComponent::SetMaterial(int32 ElementIndex, UMaterialInterface* InMate
 	if (ElementIndex == 0)
 	{
 		LightFunctionMaterial = InMaterial;
+		GCClusterWriteBarrier(this, LightFunctionMaterial);
 		MarkRenderStateDirty();
 	}
 }
@@ -121,6 +121,7 @@
 #include "Materials/MaterialExpressionTransform.h"
 #include "Materials/MaterialExpressionTransformPosition.h"
 #include "Materials/MaterialExpressionTwoSidedSign.h"
+#include "Materials/MaterialExpressionVertexAnimationTexture.h"
 #include "Materials/MaterialExpressionVertexColor.h"
 #include "Materials/MaterialExpressionVertexNormalWS.h"
 #include "Materials/MaterialExpressionViewSize.h"
@@ -8211,6 +8212,75 @@ void UMaterialExpressionVertexNormalWS::GetCaption(TArray<FString>& OutCaptions)
 	OutCaptions.Add(TEXT("VertexNormalWS"));
 }
 
+//
+//	UMaterialExpressionVertexAnimationTexture
+//
+UMaterialExpressionVertexAnimationTexture::UMaterialExpressionVertexAnimationTexture(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// Structure to hold one-time initialization
+	struct FConstructorStatics
+	{
+		FString NAME_Utility;
+		FConstructorStatics()
+			: NAME_Utility(LOCTEXT( "Utility", "Utility" ).ToString())
+		{
+		}
+	};
+	static FConstructorStatics ConstructorStatics;
+
+	MenuCategories.Add(ConstructorStatics.NAME_Utility);
+
+	Texture = NULL;
+	NumFrames = 1;
+	FrameRate = 30.0f;
+	VertexIndexCoordinate = 1;
+
+	Outputs.Reset();
+	Outputs.Add(FExpressionOutput(TEXT("Offset")));
+	Outputs.Add(FExpressionOutput(TEXT("Normal")));
+}
+
+int32 UMaterialExpressionVertexAnimationTexture::Compile(class FMaterialCompiler* Compiler, int32 OutputIndex, int32 MultiplexIndex)
+{
+	if (!Texture)
+	{
+		return CompilerError(Compiler, TEXT("Missing input Texture"));
+	}
+
+	const int32 FrameCount = FMath::Max(NumFrames, 1);
+
+	int32 TimeArg = Time.Expression ? Time.Compile(Compiler) : Compiler->GameTime(false, 0.0f);
+	if (TimeOffset.Expression)
+	{
+		TimeArg = Compiler->Add(TimeArg, TimeOffset.Compile(Compiler));
+	}
+
+	// Looping frame index, the Min keeps Frac rounding up to 1 from reading the first normal row
+	const int32 Frames = Compiler->Constant(FrameCount);
+	const int32 Loop = Compiler->Frac(Compiler->Div(Compiler->Mul(TimeArg, Compiler->Constant(FrameRate)), Frames));
+	const int32 Frame = Compiler->Min(Compiler->Floor(Compiler->Mul(Loop, Frames)), Compiler->Constant(FrameCount - 1));
+
+	// Offsets are in the first NumFrames rows, normals in the next ones
+	const int32 Row = OutputIndex == 0 ? Frame : Compiler->Add(Frame, Frames);
+	const int32 V = Compiler->Div(Compiler->Add(Row, Compiler->Constant(0.5f)), Compiler->Constant(2.0f * FrameCount));
+	const int32 U = Compiler->ComponentMask(Compiler->TextureCoordinate(VertexIndexCoordinate, false, false), 1, 0, 0, 0);
+
+	const int32 Sample = Compiler->TextureSample(Compiler->Texture(Texture), Compiler->AppendVector(U, V), SAMPLERTYPE_LinearColor, Compiler->Constant(0.0f), TMVM_MipLevel);
+
+	return Compiler->TransformVector(TRANSFORMSOURCE_Local, TRANSFORM_World, Compiler->ComponentMask(Sample, 1, 1, 1, 0));
+}
+
+void UMaterialExpressionVertexAnimationTexture::GetCaption(TArray<FString>& OutCaptions) const
+{
+	OutCaptions.Add(TEXT("Vertex Animation Texture"));
+}
+
+UTexture* UMaterialExpressionVertexAnimationTexture::GetReferencedTexture()
+{
+	return Texture;
+}
+
 UMaterialExpressionPixelNormalWS::UMaterialExpressionPixelNormalWS(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -49,6 +49,7 @@ void UMeshComponent::SetMaterial(int32 ElementIndex, UMaterialInterface* Materia
 
 			// Set the material and invalidate things
 			OverrideMaterials[ElementIndex] = Material;
+			GCClusterWriteBarrier(this, Material);
 			MarkRenderStateDirty();
 
 			if (BodyInstance.IsValidBodyInstance())
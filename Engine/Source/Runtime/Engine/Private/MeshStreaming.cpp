@@ -0,0 +1,466 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+MeshStreaming.cpp: Implementation of mesh LOD streaming classes.
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "MeshStreaming.h"
+#include "StaticMeshResources.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMeshStreaming, Log, All);
+
+static TAutoConsoleVariable<float> CVarMeshStreamingScreenSizeScale(
+	TEXT("r.MeshStreaming.ScreenSizeScale"),
+	1.5f,
+	TEXT("Scale of the screen size of the components when computing the LODs to stream in.\n")
+	TEXT("Above 1 the LODs are loaded before the components switch to them, which hides the streaming latency."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarMeshStreamingStreamOutDelay(
+	TEXT("r.MeshStreaming.StreamOutDelay"),
+	5.0f,
+	TEXT("Seconds a LOD must not be wanted by any component before it is streamed out."),
+	ECVF_Default);
+
+/** Seconds between two computations of the wanted LODs. */
+static const float MeshStreamingUpdateInterval = 0.25f;
+
+/*------------------------------------------------------------------------------
+	FStreamingStaticMesh
+------------------------------------------------------------------------------*/
+
+FStreamingStaticMesh::FStreamingStaticMesh(UStaticMesh* InStaticMesh)
+	: StaticMesh(InStaticMesh)
+	, PendingFirstLODIdx(INDEX_NONE)
+	, TimeWantingFewerLODs(0.0f)
+	, bForceFullyResident(false)
+{
+}
+
+/*------------------------------------------------------------------------------
+	Streaming manager dealing with mesh LODs.
+------------------------------------------------------------------------------*/
+
+FStreamingManagerMesh::FStreamingManagerMesh()
+	: TimeSinceLastUpdate(0.0f)
+	, DisregardWorldResourcesFrames(0)
+{
+}
+
+FStreamingManagerMesh::~FStreamingManagerMesh()
+{
+	for (auto It = StreamingMeshes.CreateIterator(); It; ++It)
+	{
+		CancelStreamIn(*It.Value());
+		delete It.Value();
+	}
+}
+
+void FStreamingManagerMesh::UpdateResourceStreaming(float DeltaTime, bool bProcessEverything /*= false*/)
+{
+	// The stream ins are finished as soon as their requests are done, only the wanted LODs are throttled
+	int32 NumPendingStreamIns = 0;
+	for (auto It = StreamingMeshes.CreateIterator(); It; ++It)
+	{
+		FStreamingStaticMesh& StreamingMesh = *It.Value();
+		if (StreamingMesh.PendingFirstLODIdx != INDEX_NONE)
+		{
+			if (StreamingMesh.PendingRequestCount.GetValue() == 0)
+			{
+				FinishStreamIn(StreamingMesh);
+			}
+			else
+			{
+				NumPendingStreamIns++;
+			}
+		}
+	}
+
+	TimeSinceLastUpdate += DeltaTime;
+	if (DisregardWorldResourcesFrames > 0)
+	{
+		DisregardWorldResourcesFrames--;
+		return;
+	}
+
+	// Without views there is nothing to compute the wanted LODs from, so keep the loaded ones
+	if ((TimeSinceLastUpdate < MeshStreamingUpdateInterval && !bProcessEverything) || CurrentViewInfos.Num() == 0)
+	{
+		return;
+	}
+
+	const float ElapsedTime = TimeSinceLastUpdate;
+	TimeSinceLastUpdate = 0.0f;
+
+	const float StreamOutDelay = CVarMeshStreamingStreamOutDelay.GetValueOnGameThread();
+	for (auto It = StreamingMeshes.CreateIterator(); It; ++It)
+	{
+		FStreamingStaticMesh& StreamingMesh = *It.Value();
+		if (StreamingMesh.bForceFullyResident || StreamingMesh.PendingFirstLODIdx != INDEX_NONE)
+		{
+			continue;
+		}
+
+		const int32 CurrentFirstLODIdx = StreamingMesh.StaticMesh->RenderData->CurrentFirstLODIdx;
+		const int32 WantedFirstLODIdx = ComputeWantedFirstLODIdx(StreamingMesh);
+		if (WantedFirstLODIdx < CurrentFirstLODIdx)
+		{
+			StreamingMesh.TimeWantingFewerLODs = 0.0f;
+			if (StreamingMesh.ReleaseFence.IsFenceComplete())
+			{
+				StartStreamIn(StreamingMesh, WantedFirstLODIdx);
+				NumPendingStreamIns++;
+			}
+		}
+		else if (WantedFirstLODIdx > CurrentFirstLODIdx)
+		{
+			// Waiting a bit avoids reloading the LODs of components going back and forth around a switch distance
+			StreamingMesh.TimeWantingFewerLODs += ElapsedTime;
+			if (StreamingMesh.TimeWantingFewerLODs >= StreamOutDelay || bProcessEverything)
+			{
+				StreamOut(StreamingMesh, WantedFirstLODIdx);
+			}
+		}
+		else
+		{
+			StreamingMesh.TimeWantingFewerLODs = 0.0f;
+		}
+	}
+
+	NumWantingResources = NumPendingStreamIns;
+	NumWantingResourcesCounter++;
+}
+
+int32 FStreamingManagerMesh::BlockTillAllRequestsFinished(float TimeLimit /*= 0.0f*/, bool bLogResults /*= false*/)
+{
+	double StartTime = FPlatformTime::Seconds();
+	float ElapsedTime = 0.0f;
+
+	int32 NumPendingStreamIns = 0;
+	do
+	{
+		NumPendingStreamIns = 0;
+		for (auto It = StreamingMeshes.CreateIterator(); It; ++It)
+		{
+			FStreamingStaticMesh& StreamingMesh = *It.Value();
+			if (StreamingMesh.PendingFirstLODIdx != INDEX_NONE)
+			{
+				if (StreamingMesh.PendingRequestCount.GetValue() == 0)
+				{
+					FinishStreamIn(StreamingMesh);
+				}
+				else
+				{
+					NumPendingStreamIns++;
+				}
+			}
+		}
+
+		// Check for time limit.
+		ElapsedTime = float(FPlatformTime::Seconds() - StartTime);
+		if (TimeLimit > 0.0f && ElapsedTime > TimeLimit)
+		{
+			break;
+		}
+
+		if (NumPendingStreamIns)
+		{
+			FPlatformProcess::Sleep(0.010f);
+		}
+	} while (NumPendingStreamIns);
+
+	if (bLogResults)
+	{
+		UE_LOG(LogMeshStreaming, Log, TEXT("Blocking on mesh streaming: %.1f ms (%d meshes still pending)"), ElapsedTime * 1000.0f, NumPendingStreamIns);
+	}
+	return NumPendingStreamIns;
+}
+
+void FStreamingManagerMesh::CancelForcedResources()
+{
+}
+
+void FStreamingManagerMesh::NotifyLevelChange()
+{
+}
+
+void FStreamingManagerMesh::SetDisregardWorldResourcesForFrames(int32 NumFrames)
+{
+	DisregardWorldResourcesFrames = NumFrames;
+}
+
+void FStreamingManagerMesh::AddPreparedLevel(class ULevel* Level)
+{
+}
+
+void FStreamingManagerMesh::RemoveLevel(class ULevel* Level)
+{
+}
+
+void FStreamingManagerMesh::NotifyPrimitiveAttached(const UPrimitiveComponent* Primitive, EDynamicPrimitiveType DynamicType)
+{
+	UpdateComponent(Primitive);
+}
+
+void FStreamingManagerMesh::NotifyPrimitiveDetached(const UPrimitiveComponent* Primitive)
+{
+	RemoveComponent(Primitive);
+}
+
+void FStreamingManagerMesh::NotifyPrimitiveUpdated(const UPrimitiveComponent* Primitive)
+{
+	UpdateComponent(Primitive);
+}
+
+void FStreamingManagerMesh::AddStreamingMesh(UStaticMesh* StaticMesh)
+{
+	if (StreamingMeshes.Find(StaticMesh) == NULL)
+	{
+		StreamingMeshes.Add(StaticMesh, new FStreamingStaticMesh(StaticMesh));
+	}
+}
+
+void FStreamingManagerMesh::RemoveStreamingMesh(UStaticMesh* StaticMesh)
+{
+	FStreamingStaticMesh* StreamingMesh = NULL;
+	if (StreamingMeshes.RemoveAndCopyValue(StaticMesh, StreamingMesh))
+	{
+		CancelStreamIn(*StreamingMesh);
+
+		for (int32 ComponentIndex = 0; ComponentIndex < StreamingMesh->Components.Num(); ++ComponentIndex)
+		{
+			ComponentMeshes.Remove(StreamingMesh->Components[ComponentIndex]);
+		}
+		delete StreamingMesh;
+	}
+}
+
+bool FStreamingManagerMesh::IsManagedStreamingMesh(const UStaticMesh* StaticMesh) const
+{
+	return StreamingMeshes.Find(const_cast<UStaticMesh*>(StaticMesh)) != NULL;
+}
+
+void FStreamingManagerMesh::ForceAllLODsResident(UStaticMesh* StaticMesh)
+{
+	FStreamingStaticMesh** StreamingMeshPtr = StreamingMeshes.Find(StaticMesh);
+	if (StreamingMeshPtr == NULL || (*StreamingMeshPtr)->bForceFullyResident)
+	{
+		return;
+	}
+
+	FStreamingStaticMesh& StreamingMesh = **StreamingMeshPtr;
+	StreamingMesh.bForceFullyResident = true;
+
+	// The pending requests may already be writing to the payloads, so they are waited for rather than canceled
+	if (StreamingMesh.PendingFirstLODIdx != INDEX_NONE)
+	{
+		while (StreamingMesh.PendingRequestCount.GetValue() > 0)
+		{
+			FPlatformProcess::Sleep(0);
+		}
+		FinishStreamIn(StreamingMesh);
+	}
+
+	FStaticMeshRenderData* RenderData = StaticMesh->RenderData;
+	if (RenderData->CurrentFirstLODIdx > 0)
+	{
+		for (int32 LODIndex = 0; LODIndex < RenderData->CurrentFirstLODIdx; ++LODIndex)
+		{
+			FByteBulkData& BulkData = RenderData->LODResources[LODIndex].StreamingBulkData;
+			TArray<uint8>& LODData = StreamingMesh.PendingLODData[LODIndex];
+			LODData.Empty(BulkData.GetBulkDataSize());
+			LODData.AddUninitialized(BulkData.GetBulkDataSize());
+
+			void* Dest = LODData.GetData();
+			BulkData.GetCopy(&Dest, true);
+		}
+		StreamingMesh.PendingFirstLODIdx = 0;
+		FinishStreamIn(StreamingMesh);
+	}
+}
+
+void FStreamingManagerMesh::UpdateComponent(const UPrimitiveComponent* Primitive)
+{
+	const UStaticMeshComponent* Component = Cast<const UStaticMeshComponent>(Primitive);
+	UStaticMesh* StaticMesh = Component ? Component->StaticMesh : NULL;
+
+	UStaticMesh** TrackedMesh = ComponentMeshes.Find(Primitive);
+	if (TrackedMesh && *TrackedMesh == StaticMesh)
+	{
+		return;
+	}
+	RemoveComponent(Primitive);
+
+	FStreamingStaticMesh** StreamingMesh = StaticMesh ? StreamingMeshes.Find(StaticMesh) : NULL;
+	if (StreamingMesh)
+	{
+		// Called before the component creates its render state, so it will only see the first LODs if it needs them
+		if (!Component->SupportsStreamedLODs())
+		{
+			ForceAllLODsResident(StaticMesh);
+		}
+
+		// The components are only modified to update their render state
+		(*StreamingMesh)->Components.Add(const_cast<UStaticMeshComponent*>(Component));
+		ComponentMeshes.Add(Primitive, StaticMesh);
+	}
+}
+
+void FStreamingManagerMesh::RemoveComponent(const UPrimitiveComponent* Primitive)
+{
+	UStaticMesh* StaticMesh = NULL;
+	if (ComponentMeshes.RemoveAndCopyValue(Primitive, StaticMesh))
+	{
+		FStreamingStaticMesh** StreamingMesh = StreamingMeshes.Find(StaticMesh);
+		if (StreamingMesh)
+		{
+			(*StreamingMesh)->Components.RemoveSingleSwap(const_cast<UStaticMeshComponent*>(static_cast<const UStaticMeshComponent*>(Primitive)));
+		}
+	}
+}
+
+int32 FStreamingManagerMesh::ComputeWantedFirstLODIdx(const FStreamingStaticMesh& StreamingMesh) const
+{
+	const FStaticMeshRenderData* RenderData = StreamingMesh.StaticMesh->RenderData;
+	const float ScreenSizeScale = CVarMeshStreamingScreenSizeScale.GetValueOnGameThread();
+
+	int32 WantedFirstLODIdx = RenderData->GetNumStreamedLODs();
+	for (int32 ComponentIndex = 0; ComponentIndex < StreamingMesh.Components.Num() && WantedFirstLODIdx > 0; ++ComponentIndex)
+	{
+		const UStaticMeshComponent* Component = StreamingMesh.Components[ComponentIndex];
+		if (!Component->IsRegistered())
+		{
+			continue;
+		}
+
+		if (Component->ForcedLodModel > 0)
+		{
+			WantedFirstLODIdx = FMath::Min(WantedFirstLODIdx, Component->ForcedLodModel - 1);
+			continue;
+		}
+
+		const FBoxSphereBounds& Bounds = Component->Bounds;
+		for (int32 ViewIndex = 0; ViewIndex < CurrentViewInfos.Num(); ++ViewIndex)
+		{
+			const FStreamingViewInfo& ViewInfo = CurrentViewInfos[ViewIndex];
+
+			// Same as ComputeBoundsScreenSize. The views don't have a height, a 16:9 aspect ratio overestimates the screen size of most of them
+			const float Distance = FMath::Max(FVector::Dist(Bounds.Origin, ViewInfo.ViewOrigin), 1.0f);
+			const float ScreenRadius = 0.5f * ViewInfo.FOVScreenSize * Bounds.SphereRadius / Distance;
+			const float ScreenArea = ViewInfo.ScreenSize * ViewInfo.ScreenSize * (9.0f / 16.0f);
+			const float ScreenSize = PI * ScreenRadius * ScreenRadius / FMath::Max(ScreenArea, 1.0f) * ViewInfo.BoostFactor * ScreenSizeScale;
+
+			// Walk backwards like ComputeStaticMeshLOD
+			int32 LODIndex = 0;
+			for (int32 Index = RenderData->LODResources.Num() - 1; Index > 0; --Index)
+			{
+				if (RenderData->ScreenSize[Index] > ScreenSize)
+				{
+					LODIndex = Index;
+					break;
+				}
+			}
+			WantedFirstLODIdx = FMath::Min(WantedFirstLODIdx, LODIndex);
+		}
+	}
+	return WantedFirstLODIdx;
+}
+
+void FStreamingManagerMesh::StartStreamIn(FStreamingStaticMesh& StreamingMesh, int32 FirstLODIdx)
+{
+	FStaticMeshRenderData* RenderData = StreamingMesh.StaticMesh->RenderData;
+	check(StreamingMesh.PendingFirstLODIdx == INDEX_NONE && FirstLODIdx < RenderData->CurrentFirstLODIdx);
+
+	StreamingMesh.PendingFirstLODIdx = FirstLODIdx;
+	for (int32 LODIndex = FirstLODIdx; LODIndex < RenderData->CurrentFirstLODIdx; ++LODIndex)
+	{
+		const FByteBulkData& BulkData = RenderData->LODResources[LODIndex].StreamingBulkData;
+		TArray<uint8>& LODData = StreamingMesh.PendingLODData[LODIndex];
+		LODData.Empty(BulkData.GetBulkDataSize());
+		LODData.AddUninitialized(BulkData.GetBulkDataSize());
+
+		// Increment the counter before the request, it can complete before LoadIntoAsync returns
+		StreamingMesh.PendingRequestCount.Increment();
+		const uint64 IORequestIndex = BulkData.LoadIntoAsync(LODData.GetData(), &StreamingMesh.PendingRequestCount, AIOP_BelowNormal);
+		check(IORequestIndex);
+		StreamingMesh.IORequestIndices.Add(IORequestIndex);
+	}
+}
+
+void FStreamingManagerMesh::FinishStreamIn(FStreamingStaticMesh& StreamingMesh)
+{
+	FStaticMeshRenderData* RenderData = StreamingMesh.StaticMesh->RenderData;
+	check(StreamingMesh.PendingFirstLODIdx != INDEX_NONE && StreamingMesh.PendingRequestCount.GetValue() == 0);
+
+	// The buffers are loaded again in place, so the render thread must be done releasing them
+	StreamingMesh.ReleaseFence.Wait();
+
+	for (int32 LODIndex = StreamingMesh.PendingFirstLODIdx; LODIndex < RenderData->CurrentFirstLODIdx; ++LODIndex)
+	{
+		FStaticMeshLODResources& LODResources = RenderData->LODResources[LODIndex];
+		{
+			FMemoryReader Ar(StreamingMesh.PendingLODData[LODIndex], /*bIsPersistent=*/ true);
+			LODResources.SerializeStreamedBuffers(Ar, false, false);
+		}
+		StreamingMesh.PendingLODData[LODIndex].Empty();
+
+		LODResources.InitVertexResources(StreamingMesh.StaticMesh);
+	}
+
+	RenderData->CurrentFirstLODIdx = StreamingMesh.PendingFirstLODIdx;
+	StreamingMesh.PendingFirstLODIdx = INDEX_NONE;
+	StreamingMesh.IORequestIndices.Empty();
+
+	// The proxies only render the LODs that were loaded when they were created
+	for (int32 ComponentIndex = 0; ComponentIndex < StreamingMesh.Components.Num(); ++ComponentIndex)
+	{
+		StreamingMesh.Components[ComponentIndex]->MarkRenderStateDirty();
+	}
+}
+
+void FStreamingManagerMesh::StreamOut(FStreamingStaticMesh& StreamingMesh, int32 FirstLODIdx)
+{
+	FStaticMeshRenderData* RenderData = StreamingMesh.StaticMesh->RenderData;
+	const int32 OldFirstLODIdx = RenderData->CurrentFirstLODIdx;
+	check(StreamingMesh.PendingFirstLODIdx == INDEX_NONE && FirstLODIdx > OldFirstLODIdx && FirstLODIdx <= RenderData->GetNumStreamedLODs());
+
+	RenderData->CurrentFirstLODIdx = FirstLODIdx;
+	StreamingMesh.TimeWantingFewerLODs = 0.0f;
+
+	// The proxies using the LODs must be removed from the scene before the LODs are released
+	for (int32 ComponentIndex = 0; ComponentIndex < StreamingMesh.Components.Num(); ++ComponentIndex)
+	{
+		UStaticMeshComponent* Component = StreamingMesh.Components[ComponentIndex];
+		if (Component->IsRenderStateCreated())
+		{
+			Component->RecreateRenderState_Concurrent();
+		}
+	}
+
+	for (int32 LODIndex = OldFirstLODIdx; LODIndex < FirstLODIdx; ++LODIndex)
+	{
+		RenderData->LODResources[LODIndex].ReleaseVertexResources();
+	}
+	StreamingMesh.ReleaseFence.BeginFence();
+}
+
+void FStreamingManagerMesh::CancelStreamIn(FStreamingStaticMesh& StreamingMesh)
+{
+	if (StreamingMesh.PendingFirstLODIdx != INDEX_NONE)
+	{
+		// The canceled requests decrement the counter, the ones already being processed still write to the payloads
+		FIOSystem::Get().CancelRequests(StreamingMesh.IORequestIndices.GetData(), StreamingMesh.IORequestIndices.Num());
+		while (StreamingMesh.PendingRequestCount.GetValue() > 0)
+		{
+			FPlatformProcess::Sleep(0);
+		}
+
+		for (int32 LODIndex = 0; LODIndex < MAX_STATIC_MESH_LODS; ++LODIndex)
+		{
+			StreamingMesh.PendingLODData[LODIndex].Empty();
+		}
+		StreamingMesh.PendingFirstLODIdx = INDEX_NONE;
+		StreamingMesh.IORequestIndices.Empty();
+	}
+}
@@ -562,12 +562,12 @@ void UNetConnection::FlushNet(bool bIgnoreSimulation)
 		OutLagPacketId [Index] = OutPacketId;
 		OutLagTime     [Index] = Driver->Time;
 		OutPacketId++;
-		Driver->OutPackets++;
+		FPlatformAtomics::InterlockedIncrement( (volatile int32*)&Driver->OutPackets );
 		LastSendTime = Driver->Time;
 		const int32 PacketBytes = SendBuffer.GetNumBytes() + PacketOverhead;
 		QueuedBytes += PacketBytes;
 		OutBytes += PacketBytes;
-		Driver->OutBytes += PacketBytes;
+		FPlatformAtomics::InterlockedAdd( (volatile int32*)&Driver->OutBytes, PacketBytes );
 		InitSendBuffer();
 	}
 
@@ -1120,7 +1120,8 @@ int32 UNetConnection::SendRawBunch( FOutBunch& Bunch, bool InAllowMerge )
 	ValidateSendBuffer();
 	check(!Bunch.ReceivedAck);
 	check(!Bunch.IsError());
-	Driver->OutBunches++;
+	// Connections can send from several threads with net.ParallelReplication
+	FPlatformAtomics::InterlockedIncrement( (volatile int32*)&Driver->OutBunches );
 	TimeSensitive = 1;
 
 	// Build header.
@@ -1187,7 +1188,7 @@ int32 UNetConnection::SendRawBunch( FOutBunch& Bunch, bool InAllowMerge )
 
 	if (Bunch.bHasGUIDs)
 	{
-		Driver->NetGUIDOutBytes += (Header.GetNumBits() + Bunch.GetNumBits()) >> 3;
+		FPlatformAtomics::InterlockedAdd( (volatile int32*)&Driver->NetGUIDOutBytes, (Header.GetNumBits() + Bunch.GetNumBits()) >> 3 );
 	}
 
 	// Verified client ping tracking - caches some semi-random bytes of the packet, for ping validation
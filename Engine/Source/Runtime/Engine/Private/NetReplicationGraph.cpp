@@ -0,0 +1,301 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	NetReplicationGraph.cpp: Buckets of actors for relevancy checks
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "Net/NetReplicationGraph.h"
+#include "GameFramework/GameNetworkManager.h"
+
+static TAutoConsoleVariable<float> CVarRepGraphCellSize(
+	TEXT( "net.RepGraph.CellSize" ),
+	10000.0f,
+	TEXT( "Size of a cell of the replication graph spatial grid, in world units." ) );
+
+/** Actors whose cull distance covers more cells than this go in the non spatial list */
+static const int32 MaxCellsPerActor = 64;
+
+/** Max number of bases and attach parents followed from a viewer */
+static const int32 MaxViewerBaseDepth = 8;
+
+FNetReplicationGraph::FNetReplicationGraph()
+	: Actors( NULL )
+	, CellSize( 10000.0f )
+	, GatherTag( 0 )
+{
+}
+
+FNetReplicationGraph::EActorBucket FNetReplicationGraph::ClassifyActor( const AActor* Actor ) const
+{
+	// These follow the relevancy rules of AActor, APawn and APlayerController, and must reach at least as far
+	if ( Actor->bAlwaysRelevant )
+	{
+		return ActorBucket_Always;
+	}
+
+	if ( Cast< APlayerController >( Actor ) )
+	{
+		// Only relevant to its own connection
+		return ActorBucket_KeyedOnly;
+	}
+
+	const USceneComponent* RootComponent = Actor->GetRootComponent();
+	const bool bNoCollision = !RootComponent || !RootComponent->IsCollisionEnabled();
+
+	if ( const APawn* Pawn = Cast< APawn >( Actor ) )
+	{
+		if ( Pawn->GetMovementBase() || ( RootComponent && RootComponent->AttachParent ) )
+		{
+			return ActorBucket_Dependent;
+		}
+
+		if ( ( Pawn->bHidden || Pawn->bOnlyRelevantToOwner ) && bNoCollision )
+		{
+			return ActorBucket_KeyedOnly;
+		}
+
+		// Pawns always use their cull distance
+		return ActorBucket_Spatial;
+	}
+
+	if ( Actor->bNetUseOwnerRelevancy && Actor->GetOwner() )
+	{
+		return ActorBucket_Dependent;
+	}
+
+	if ( Actor->bOnlyRelevantToOwner )
+	{
+		return ActorBucket_KeyedOnly;
+	}
+
+	if ( RootComponent && RootComponent->AttachParent )
+	{
+		return ActorBucket_Dependent;
+	}
+
+	if ( !RootComponent || ( Actor->bHidden && bNoCollision ) )
+	{
+		return ActorBucket_KeyedOnly;
+	}
+
+	if ( !GetDefault< AGameNetworkManager >()->bUseDistanceBasedRelevancy )
+	{
+		return ActorBucket_NonSpatial;
+	}
+
+	return ActorBucket_Spatial;
+}
+
+void FNetReplicationGraph::GetRelevancyKeys( const AActor* Actor, TArray< const AActor*, TInlineAllocator< 8 > >& OutKeys ) const
+{
+	// Relevant to itself and every actor up the owner chain
+	for ( const AActor* Owner = Actor; Owner; Owner = Owner->GetOwner() )
+	{
+		OutKeys.AddUnique( Owner );
+	}
+
+	if ( Actor->Instigator )
+	{
+		OutKeys.AddUnique( Actor->Instigator );
+	}
+
+	const APawn* Pawn = Cast< APawn >( Actor );
+	if ( Pawn && Pawn->Controller )
+	{
+		OutKeys.AddUnique( Pawn->Controller );
+	}
+}
+
+void FNetReplicationGraph::PrepareForReplication( const TArray< AActor* >& ConsiderList )
+{
+	Actors = &ConsiderList;
+
+	ActorIndices.Empty( ConsiderList.Num() );
+	AlwaysRelevant.Reset();
+	NonSpatial.Reset();
+	Dependent.Reset();
+	TeamLists.Reset();
+	KeyedActors.Reset();
+	Grid.Reset();
+
+	GatherTags.Reset();
+	GatherTags.AddZeroed( ConsiderList.Num() );
+	GatherTag = 0;
+
+	CellSize = FMath::Max( CVarRepGraphCellSize.GetValueOnGameThread(), 100.0f );
+
+	TArray< const AActor*, TInlineAllocator< 8 > > Keys;
+
+	for ( int32 i = 0; i < ConsiderList.Num(); i++ )
+	{
+		const AActor* Actor = ConsiderList[i];
+		ActorIndices.Add( Actor, i );
+
+		Keys.Reset();
+		GetRelevancyKeys( Actor, Keys );
+		for ( int32 k = 0; k < Keys.Num(); k++ )
+		{
+			KeyedActors.Add( Keys[k], i );
+		}
+
+		const int32 Team = GetActorTeam( Actor );
+		if ( Team != INDEX_NONE )
+		{
+			TeamLists.FindOrAdd( Team ).Add( i );
+		}
+
+		switch ( ClassifyActor( Actor ) )
+		{
+			case ActorBucket_Always:		AlwaysRelevant.Add( i );	break;
+			case ActorBucket_NonSpatial:	NonSpatial.Add( i );		break;
+			case ActorBucket_Dependent:		Dependent.Add( i );			break;
+			case ActorBucket_Spatial:		AddSpatialActor( i, Actor );	break;
+			case ActorBucket_KeyedOnly:		break;
+		}
+	}
+}
+
+void FNetReplicationGraph::AddSpatialActor( int32 ActorIndex, const AActor* Actor )
+{
+	const FVector Location = Actor->GetActorLocation();
+	const float CullDistance = FMath::Sqrt( Actor->NetCullDistanceSquared );
+
+	const FIntPoint MinCell = GetCell( Location - FVector( CullDistance ), CellSize );
+	const FIntPoint MaxCell = GetCell( Location + FVector( CullDistance ), CellSize );
+
+	// Checked for every connection, cheaper than filling this many cells
+	const int64 NumCells = int64( MaxCell.X - MinCell.X + 1 ) * int64( MaxCell.Y - MinCell.Y + 1 );
+	if ( NumCells > MaxCellsPerActor )
+	{
+		NonSpatial.Add( ActorIndex );
+		return;
+	}
+
+	for ( int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++ )
+	{
+		for ( int32 X = MinCell.X; X <= MaxCell.X; X++ )
+		{
+			Grid.FindOrAdd( FIntPoint( X, Y ) ).Add( ActorIndex );
+		}
+	}
+}
+
+void FNetReplicationGraph::AddCandidate( int32 ActorIndex, UNetConnection* Connection, bool bSkipDormant, TArray< AActor* >& OutActors )
+{
+	if ( GatherTags[ActorIndex] == GatherTag )
+	{
+		return;
+	}
+	GatherTags[ActorIndex] = GatherTag;
+
+	AActor* Actor = ( *Actors )[ActorIndex];
+	if ( bSkipDormant && Connection->DormantActors.Contains( Actor ) )
+	{
+		return;
+	}
+
+	OutActors.Add( Actor );
+}
+
+void FNetReplicationGraph::AddKeyedCandidates( const AActor* Key, UNetConnection* Connection, bool bSkipDormant, TArray< AActor* >& OutActors )
+{
+	if ( Key == NULL )
+	{
+		return;
+	}
+
+	for ( auto It = KeyedActors.CreateConstKeyIterator( Key ); It; ++It )
+	{
+		AddCandidate( It.Value(), Connection, bSkipDormant, OutActors );
+	}
+}
+
+void FNetReplicationGraph::GatherActorsForConnection( UNetConnection* Connection, const TArray< FNetViewer >& Viewers, bool bSkipDormant, TArray< AActor* >& OutActors )
+{
+	check( Actors != NULL );
+
+	if ( ++GatherTag == 0 )
+	{
+		// Wrapped around, tags from old gathers could match again
+		FMemory::Memzero( GatherTags.GetData(), GatherTags.Num() * sizeof( uint32 ) );
+		GatherTag = 1;
+	}
+
+	for ( int32 i = 0; i < AlwaysRelevant.Num(); i++ )
+	{
+		AddCandidate( AlwaysRelevant[i], Connection, bSkipDormant, OutActors );
+	}
+
+	const int32 Team = GetConnectionTeam( Connection );
+	if ( Team != INDEX_NONE )
+	{
+		if ( const TArray< int32 >* TeamList = TeamLists.Find( Team ) )
+		{
+			for ( int32 i = 0; i < TeamList->Num(); i++ )
+			{
+				AddCandidate( ( *TeamList )[i], Connection, bSkipDormant, OutActors );
+			}
+		}
+	}
+
+	for ( int32 i = 0; i < NonSpatial.Num(); i++ )
+	{
+		AddCandidate( NonSpatial[i], Connection, bSkipDormant, OutActors );
+	}
+
+	for ( int32 i = 0; i < Dependent.Num(); i++ )
+	{
+		AddCandidate( Dependent[i], Connection, bSkipDormant, OutActors );
+	}
+
+	for ( int32 v = 0; v < Viewers.Num(); v++ )
+	{
+		const FNetViewer& Viewer = Viewers[v];
+
+		AddKeyedCandidates( Viewer.InViewer, Connection, bSkipDormant, OutActors );
+		AddKeyedCandidates( Viewer.Viewer, Connection, bSkipDormant, OutActors );
+
+		// Pawns are relevant to the viewers based on them
+		const AActor* Base = Viewer.Viewer;
+		for ( int32 Depth = 0; Base && Depth < MaxViewerBaseDepth; Depth++ )
+		{
+			const APawn* BasePawn = Cast< APawn >( Base );
+			const AActor* MovementBase = APawn::GetMovementBaseActor( BasePawn );
+			const USceneComponent* RootComponent = Base->GetRootComponent();
+			const AActor* AttachParent = ( RootComponent && RootComponent->AttachParent ) ? RootComponent->AttachParent->GetOwner() : NULL;
+
+			const int32* MovementBaseIndex = MovementBase ? ActorIndices.Find( MovementBase ) : NULL;
+			if ( MovementBaseIndex )
+			{
+				AddCandidate( *MovementBaseIndex, Connection, bSkipDormant, OutActors );
+			}
+
+			const int32* AttachParentIndex = AttachParent ? ActorIndices.Find( AttachParent ) : NULL;
+			if ( AttachParentIndex )
+			{
+				AddCandidate( *AttachParentIndex, Connection, bSkipDormant, OutActors );
+			}
+
+			Base = MovementBase ? MovementBase : AttachParent;
+		}
+
+		if ( const TArray< int32 >* Cell = Grid.Find( GetCell( Viewer.ViewLocation, CellSize ) ) )
+		{
+			for ( int32 i = 0; i < Cell->Num(); i++ )
+			{
+				AddCandidate( ( *Cell )[i], Connection, bSkipDormant, OutActors );
+			}
+		}
+	}
+
+	// Open channels are handled by the driver whether the actor is relevant or not
+	for ( auto It = Connection->ActorChannels.CreateConstIterator(); It; ++It )
+	{
+		const int32* ActorIndex = ActorIndices.Find( It.Key().Get() );
+		if ( ActorIndex )
+		{
+			AddCandidate( *ActorIndex, Connection, bSkipDormant, OutActors );
+		}
+	}
+}
@@ -9,6 +9,7 @@
 #include "Net/UnrealNetwork.h"
 #include "Net/NetworkProfiler.h"
 #include "Net/RepLayout.h"
+#include "Net/NetReplicationGraph.h"
 #include "Engine/ActorChannel.h"
 #include "Engine/VoiceChannel.h"
 #include "GameFramework/GameNetworkManager.h"
@@ -18,6 +19,7 @@
 #include "Engine/PackageMapClient.h"
 #include "GameFramework/PlayerState.h"
 #include "GameFramework/GameMode.h"
+#include "ParallelFor.h"
 
 // Default net driver stats
 DEFINE_STAT(STAT_Ping);
@@ -93,6 +95,20 @@ static TAutoConsoleVariable<int32> CVarNetDormancyValidate(
 	TEXT("0: Dont validate. 1: Validate on wake up. 2: Validate on each net update"),
 	ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarUseReplicationGraph(
+	TEXT("net.UseReplicationGraph"),
+	0,
+	TEXT("Buckets the considered actors once per frame, so each connection only checks the relevancy of the actors that can be relevant to it")
+	TEXT("0: Check every considered actor for every connection. 1: Use the replication graph"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarParallelReplication(
+	TEXT("net.ParallelReplication"),
+	0,
+	TEXT("Sends the property updates of open actor channels of different actors in parallel, after every connection has been prioritized")
+	TEXT("0: Replicate every channel on the game thread. 1: Replicate open channels on the task graph worker threads"),
+	ECVF_Default);
+
 /*-----------------------------------------------------------------------------
 	UNetDriver implementation.
 -----------------------------------------------------------------------------*/
@@ -119,6 +135,7 @@ UNetDriver::UNetDriver(const FObjectInitializer& ObjectInitializer)
 ,	StatPeriod(1.f)
 ,	NetTag(0)
 ,	DebugRelevantActors(false)
+,	bReplicatingInParallel(false)
 {
 }
 
@@ -1725,6 +1742,118 @@ FActorPriority::FActorPriority(class UNetConnection* InConnection, struct FActor
 	}
 }
 
+/** Opening a channel assigns guids and can spawn subobjects, so it stays on the game thread */
+static bool CanReplicateChannelInParallel(const UActorChannel* Channel)
+{
+	return Channel->OpenPacketId.First != INDEX_NONE;
+}
+
+int32 UNetDriver::ReplicateChannelsInParallel(TArray< TArray<FParallelChannelUpdate> >& ParallelUpdates)
+{
+	SCOPE_CYCLE_COUNTER(STAT_NetParallelReplicateTime);
+
+	// Work is split by actor, not by connection. ReplicateActor downgrades and restores the remote role of the actor,
+	// and runs its ReplicateSubobjects, so an actor must only be replicated by one thread at a time.
+	// Each actor goes through its connections in connection order, with the connection locked while its channel replicates.
+	TArray< TArray<FParallelChannelUpdate*> > ActorUpdates;
+	{
+		TMap<AActor*, int32> ActorIndices;
+		for (int32 ConnIdx = 0; ConnIdx < ParallelUpdates.Num(); ConnIdx++)
+		{
+			TArray<FParallelChannelUpdate>& Updates = ParallelUpdates[ConnIdx];
+			for (int32 UpdateIdx = 0; UpdateIdx < Updates.Num(); UpdateIdx++)
+			{
+				int32* ActorIndex = ActorIndices.Find(Updates[UpdateIdx].Channel->Actor);
+				if (ActorIndex == NULL)
+				{
+					ActorIndex = &ActorIndices.Add(Updates[UpdateIdx].Channel->Actor, ActorUpdates.AddDefaulted());
+				}
+				ActorUpdates[*ActorIndex].Add(&Updates[UpdateIdx]);
+			}
+		}
+	}
+
+	// Sized once, the locks are never moved
+	TArray<FCriticalSection> ConnectionLocks;
+	ConnectionLocks.SetNum(ParallelUpdates.Num());
+
+	bReplicatingInParallel = true;
+	NetCache->SetThreadSafe(true);
+
+	ParallelFor(ActorUpdates.Num(), [this, &ActorUpdates, &ConnectionLocks](int32 ActorIdx)
+	{
+		const TArray<FParallelChannelUpdate*>& Updates = ActorUpdates[ActorIdx];
+
+		for (int32 UpdateIdx = 0; UpdateIdx < Updates.Num(); UpdateIdx++)
+		{
+			FParallelChannelUpdate& Update = *Updates[UpdateIdx];
+			UActorChannel* Channel = Update.Channel;
+			UNetConnection* Connection = Channel->Connection;
+
+			FScopeLock ConnectionLock(&ConnectionLocks[Update.ConnectionIndex]);
+
+			// Left for the next frame
+			if (!Connection->IsNetReady(0))
+			{
+				Update.Result = FParallelChannelUpdate::NotReached;
+			}
+			else if (Channel->Closing || Channel->Actor == NULL)
+			{
+				Update.Result = FParallelChannelUpdate::Skipped;
+			}
+			else if (!Channel->IsNetReady(0))
+			{
+				Update.Result = FParallelChannelUpdate::ChannelSaturated;
+			}
+			else
+			{
+				Update.Result = Channel->ReplicateActor() ? FParallelChannelUpdate::Sent : FParallelChannelUpdate::NotSent;
+			}
+		}
+	});
+
+	NetCache->SetThreadSafe(false);
+	bReplicatingInParallel = false;
+
+	// Bookkeeping that touches the actors is done here, in connection order, the same way the serial path does it
+	int32 Updated = 0;
+	for (int32 ConnIdx = 0; ConnIdx < ParallelUpdates.Num(); ConnIdx++)
+	{
+		const TArray<FParallelChannelUpdate>& Updates = ParallelUpdates[ConnIdx];
+		for (int32 UpdateIdx = 0; UpdateIdx < Updates.Num(); UpdateIdx++)
+		{
+			const FParallelChannelUpdate& Update = Updates[UpdateIdx];
+			AActor* Actor = Update.Channel->Actor;
+
+			switch (Update.Result)
+			{
+				case FParallelChannelUpdate::Sent:
+					if (DebugRelevantActors)
+					{
+						LastSentActors.Add(Actor);
+					}
+					Updated++;
+					break;
+				case FParallelChannelUpdate::NotSent:
+					Updated++;
+					break;
+				case FParallelChannelUpdate::ChannelSaturated:
+					UE_LOG(LogNetTraffic, Log, TEXT("- Channel saturated, forcing pending update for %s"), *Actor->GetName());
+					Actor->ForceNetUpdate();
+					break;
+				case FParallelChannelUpdate::NotReached:
+					UE_LOG(LogNetTraffic, Log, TEXT(" Saturated. Mark %s NetUpdateTime to be checked for next tick"), *Actor->GetName());
+					Actor->bPendingNetUpdate = true;
+					break;
+				case FParallelChannelUpdate::Skipped:
+					break;
+			}
+		}
+	}
+
+	return Updated;
+}
+
 int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 {
 	SCOPE_CYCLE_COUNTER(STAT_NetServerRepActorsTime);
@@ -2025,6 +2154,36 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 	SET_DWORD_STAT(STAT_NumInitiallyDormantActors,NumInitiallyDormant);
 	SET_DWORD_STAT(STAT_NumConsideredActors,ConsiderList.Num());
 
+	// Bucket the consider list once, instead of checking every actor against every connection
+	const bool bUseReplicationGraph = CVarUseReplicationGraph.GetValueOnGameThread() != 0;
+	if (bUseReplicationGraph)
+	{
+		if (!ReplicationGraph.IsValid())
+		{
+			ReplicationGraph = CreateReplicationGraph();
+		}
+		ReplicationGraph->PrepareForReplication(ConsiderList);
+	}
+
+	// Actors gathered by the replication graph for the current connection
+	TArray<AActor*> ConnectionConsiderList;
+
+	// Open channels of each connection to replicate on the worker threads, in priority order
+	bool bParallelReplication = CVarParallelReplication.GetValueOnGameThread() != 0 && FApp::ShouldUseThreadingForPerformance();
+#if USE_NETWORK_PROFILER
+	bParallelReplication = bParallelReplication && !GNetworkProfiler.IsTrackingEnabled();
+#endif
+	TArray< TArray<FParallelChannelUpdate> > ParallelUpdates;
+	if (bParallelReplication)
+	{
+		ParallelUpdates.SetNum(ClientConnections.Num());
+	}
+
+	// Connection the replicated actor stats are reported for, the parallel updates are added to its counts once sent
+	int32 StatConnIdx = INDEX_NONE;
+	int32 StatActorUpdates = 0;
+	int32 StatActorUpdatesSent = 0;
+
 	for( int32 i=0; i < ClientConnections.Num(); i++ )
 	{
 		UNetConnection* Connection = ClientConnections[i];
@@ -2037,23 +2196,39 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 		{
 			//UE_LOG(LogNet, Log, TEXT("skipping update to %s"),*Connection->GetName());
 			// then mark each considered actor as bPendingNetUpdate so that they will be considered again the next frame when the connection is actually ticked
-			for (int32 ConsiderIdx = 0; ConsiderIdx < ConsiderList.Num(); ConsiderIdx++)
+			if (bUseReplicationGraph)
 			{
-				AActor *Actor = ConsiderList[ConsiderIdx];
-				// if the actor hasn't already been flagged by another connection,
-				if (Actor != NULL && !Actor->bPendingNetUpdate)
+				// Only actors with a channel get flagged, so the channels are enough
+				for (auto It = Connection->ActorChannels.CreateConstIterator(); It; ++It)
 				{
-					// find the channel
-					UActorChannel *Channel = Connection->ActorChannels.FindRef(Actor);
-					// and if the channel last update time doesn't match the last net update time for the actor
-					if (Channel != NULL && Channel->LastUpdateTime < Actor->LastNetUpdateTime)
+					AActor* Actor = It.Key().Get();
+					UActorChannel* Channel = It.Value();
+					if (Actor != NULL && Channel != NULL && !Actor->bPendingNetUpdate && Channel->LastUpdateTime < Actor->LastNetUpdateTime && ReplicationGraph->IsConsidered(Actor))
 					{
-						//UE_LOG(LogNet, Log, TEXT("flagging %s for a future update"),*Actor->GetName());
-						// flag it for a pending update
 						Actor->bPendingNetUpdate = true;
 					}
 				}
 			}
+			else
+			{
+				for (int32 ConsiderIdx = 0; ConsiderIdx < ConsiderList.Num(); ConsiderIdx++)
+				{
+					AActor *Actor = ConsiderList[ConsiderIdx];
+					// if the actor hasn't already been flagged by another connection,
+					if (Actor != NULL && !Actor->bPendingNetUpdate)
+					{
+						// find the channel
+						UActorChannel *Channel = Connection->ActorChannels.FindRef(Actor);
+						// and if the channel last update time doesn't match the last net update time for the actor
+						if (Channel != NULL && Channel->LastUpdateTime < Actor->LastNetUpdateTime)
+						{
+							//UE_LOG(LogNet, Log, TEXT("flagging %s for a future update"),*Actor->GetName());
+							// flag it for a pending update
+							Actor->bPendingNetUpdate = true;
+						}
+					}
+				}
+			}
 			// clear the time sensitive flag to avoid sending an extra packet to this connection
 			Connection->TimeSensitive = false;
 
@@ -2136,9 +2311,20 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 				AGameMode const* const GameMode = World->GetAuthGameMode();
 				bool bLowNetBandwidth = !bCPUSaturated && (Connection->CurrentNetSpeed / float(GameMode->NumPlayers + GameMode->NumBots) < 500.f );
 
-				for( j=0; j<ConsiderList.Num(); j++ )
+				const TArray<AActor*>* ConnectionActors = &ConsiderList;
+				if (bUseReplicationGraph)
 				{
-					AActor* Actor = ConsiderList[j];
+					// Dormant actors are skipped below anyway, unless they have to be validated
+					const bool bSkipDormant = CVarSetNetDormancyEnabled.GetValueOnGameThread() == 1 && CVarNetDormancyValidate.GetValueOnGameThread() != 2;
+
+					ConnectionConsiderList.Reset();
+					ReplicationGraph->GatherActorsForConnection(Connection, ConnectionViewers, bSkipDormant, ConnectionConsiderList);
+					ConnectionActors = &ConnectionConsiderList;
+				}
+
+				for( j=0; j<ConnectionActors->Num(); j++ )
+				{
+					AActor* Actor = (*ConnectionActors)[j];
 					UActorChannel* Channel = Connection->ActorChannels.FindRef(Actor);
 
 					// Skip Actor if dormant
@@ -2410,16 +2596,24 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 										LastRelevantActors.Add( Actor );
 									}
 
-									if (Channel->ReplicateActor())
+									if (bParallelReplication && CanReplicateChannelInParallel(Channel))
 									{
-										ActorUpdatesThisConnectionSent++;
-										if (DebugRelevantActors)
+										// Sent once every connection is prioritized, see below
+										ParallelUpdates[i].Add(FParallelChannelUpdate(Channel, i));
+									}
+									else
+									{
+										if (Channel->ReplicateActor())
 										{
-											LastSentActors.Add( Actor );
+											ActorUpdatesThisConnectionSent++;
+											if (DebugRelevantActors)
+											{
+												LastSentActors.Add( Actor );
+											}
 										}
+										ActorUpdatesThisConnection++;
+										Updated++;
 									}
-									ActorUpdatesThisConnection++;
-									Updated++;
 								}
 								else
 								{							
@@ -2495,6 +2689,32 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 
 			SET_DWORD_STAT(STAT_NumReplicatedActorAttempts,ActorUpdatesThisConnection);
 			SET_DWORD_STAT(STAT_NumReplicatedActors,ActorUpdatesThisConnectionSent);
+			StatConnIdx = i;
+			StatActorUpdates = ActorUpdatesThisConnection;
+			StatActorUpdatesSent = ActorUpdatesThisConnectionSent;
+		}
+	}
+
+	if (bParallelReplication)
+	{
+		Updated += ReplicateChannelsInParallel(ParallelUpdates);
+
+		if (StatConnIdx != INDEX_NONE)
+		{
+			const TArray<FParallelChannelUpdate>& Updates = ParallelUpdates[StatConnIdx];
+			for (int32 UpdateIdx = 0; UpdateIdx < Updates.Num(); UpdateIdx++)
+			{
+				if (Updates[UpdateIdx].Result == FParallelChannelUpdate::Sent)
+				{
+					StatActorUpdatesSent++;
+				}
+				if (Updates[UpdateIdx].Result == FParallelChannelUpdate::Sent || Updates[UpdateIdx].Result == FParallelChannelUpdate::NotSent)
+				{
+					StatActorUpdates++;
+				}
+			}
+			SET_DWORD_STAT(STAT_NumReplicatedActorAttempts,StatActorUpdates);
+			SET_DWORD_STAT(STAT_NumReplicatedActors,StatActorUpdatesSent);
 		}
 	}
 
@@ -2752,6 +2972,8 @@ static void	DumpRelevantActors( UWorld* InWorld )
 
 TSharedPtr<FRepChangedPropertyTracker> UNetDriver::FindOrCreateRepChangedPropertyTracker(UObject* Obj)
 {
+	FNetParallelReplicationScopeLock SharedStateLock( this );
+
 	TSharedPtr<FRepChangedPropertyTracker> * GlobalPropertyTrackerPtr = RepChangedPropertyTrackerMap.Find( Obj );
 
 	if ( !GlobalPropertyTrackerPtr ) 
@@ -2768,6 +2990,8 @@ TSharedPtr<FRepChangedPropertyTracker> UNetDriver::FindOrCreateRepChangedPropert
 
 TSharedPtr<FRepLayout> UNetDriver::GetObjectClassRepLayout( UClass * Class )
 {
+	FNetParallelReplicationScopeLock SharedStateLock( this );
+
 	TSharedPtr<FRepLayout> * RepLayoutPtr = RepLayoutMap.Find( Class );
 
 	if ( !RepLayoutPtr ) 
@@ -2808,6 +3032,11 @@ TSharedPtr<FRepLayout> UNetDriver::GetStructRepLayout( UStruct * Struct )
 	return *RepLayoutPtr;
 }
 
+TSharedPtr<FNetReplicationGraph> UNetDriver::CreateReplicationGraph()
+{
+	return TSharedPtr<FNetReplicationGraph>( new FNetReplicationGraph() );
+}
+
 FAutoConsoleCommandWithWorld	DumpRelevantActorsCommand(
 	TEXT("net.DumpRelevantActors"), 
 	TEXT( "Dumps information on relevant actors during next network update" ), 
@@ -2,6 +2,7 @@
 
 #include "EnginePrivate.h"
 #include "Engine/NiagaraEffect.h"
+#include "ParallelFor.h"
 
 
 
@@ -70,4 +71,21 @@ TSharedPtr<FNiagaraSimulation> FNiagaraEffectInstance::AddEmitter(FNiagaraEmitte
 	SceneProxy->UpdateEffectRenderers(this);
 
 	return Sim;
-}
\ No newline at end of file
+}
+
+
+void FNiagaraEffectInstance::Tick(float DeltaSeconds)
+{
+	// pass the constants down to the emitter
+	// TODO: should probably just pass a pointer to the table
+	for (TSharedPtr<FNiagaraSimulation>&it : Emitters)
+	{
+		it->SetConstants(Constants);
+		it->GetConstants().Merge(it->GetProperties()->ExternalConstants);
+	}
+
+	ParallelFor(Emitters.Num(), [&](int32 EmitterIndex)
+	{
+		Emitters[EmitterIndex]->Tick(DeltaSeconds);
+	});
+}
@@ -4,6 +4,47 @@
 #include "Engine/NiagaraSimulation.h"
 #include "Engine/NiagaraEffectRenderer.h"
 #include "VectorVM.h"
+#include "ParallelFor.h"
+
+/** Particles handled by each task of the VM runs and of the kill compaction, large emitters are split in blocks of this size */
+static const int32 NiagaraParticlesPerBlock = 4096;
+
+/**
+ * Runs a script on NumParticles particles, split in blocks run in parallel.
+ * Inputs and Outputs are the first particle of each attribute, the attributes are InputStride and OutputStride vectors apart.
+ */
+static void ExecScriptInBlocks(UNiagaraScript* Script, FVector4* Inputs, int32 InputStride, FVector4* Outputs, int32 OutputStride, const FVector4* ConstantTable, int32 NumParticles)
+{
+	const int32 NumAttr = Script->Attributes.Num();
+
+	check(NumAttr < VectorVM::MaxInputRegisters);
+	check(NumAttr < VectorVM::MaxOutputRegisters);
+
+	const int32 NumBlocks = FMath::DivideAndRoundUp(NumParticles, NiagaraParticlesPerBlock);
+	ParallelFor(NumBlocks, [&](int32 BlockIndex)
+	{
+		const int32 FirstParticle = BlockIndex * NiagaraParticlesPerBlock;
+		VectorRegister* InputRegisters[VectorVM::MaxInputRegisters] = { 0 };
+		VectorRegister* OutputRegisters[VectorVM::MaxOutputRegisters] = { 0 };
+
+		// Setup input and output registers.
+		for (int32 AttrIndex = 0; AttrIndex < NumAttr; ++AttrIndex)
+		{
+			InputRegisters[AttrIndex] = (VectorRegister*)(Inputs + AttrIndex * InputStride + FirstParticle);
+			OutputRegisters[AttrIndex] = (VectorRegister*)(Outputs + AttrIndex * OutputStride + FirstParticle);
+		}
+
+		VectorVM::Exec(
+			Script->ByteCode.GetData(),
+			InputRegisters,
+			NumAttr,
+			OutputRegisters,
+			NumAttr,
+			ConstantTable,
+			FMath::Min(NiagaraParticlesPerBlock, NumParticles - FirstParticle)
+			);
+	});
+}
 
 
 FNiagaraSimulation::FNiagaraSimulation(FNiagaraEmitterProperties *InProps) 
@@ -109,30 +150,16 @@ void FNiagaraSimulation::UpdateParticles(
 	Age += DeltaSeconds;
 	Constants.SetOrAdd(TEXT("Emitter Age"), FVector4(Age, Age, Age, Age));
 
-	VectorRegister* InputRegisters[VectorVM::MaxInputRegisters] = { 0 };
-	VectorRegister* OutputRegisters[VectorVM::MaxOutputRegisters] = { 0 };
-	const int32 NumAttr = Props->UpdateScript->Attributes.Num();
-
-	check(NumAttr < VectorVM::MaxInputRegisters);
-	check(NumAttr < VectorVM::MaxOutputRegisters);
-
-	// Setup input and output registers.
-	for (int32 AttrIndex = 0; AttrIndex < NumAttr; ++AttrIndex)
-	{
-		InputRegisters[AttrIndex] = (VectorRegister*)(PrevParticles + AttrIndex * PrevNumVectorsPerAttribute);
-		OutputRegisters[AttrIndex] = (VectorRegister*)(Particles + AttrIndex * NumVectorsPerAttribute);
-	}
-
 	//Fill constant table with required emitter constants and internal script constants.
 	TArray<FVector4> ConstantTable;
 	Props->UpdateScript->ConstantData.FillConstantTable(Constants, ConstantTable);
 
-	VectorVM::Exec(
-		Props->UpdateScript->ByteCode.GetData(),
-		InputRegisters,
-		NumAttr,
-		OutputRegisters,
-		NumAttr,
+	ExecScriptInBlocks(
+		Props->UpdateScript,
+		PrevParticles,
+		PrevNumVectorsPerAttribute,
+		Particles,
+		NumVectorsPerAttribute,
 		ConstantTable.GetData(),
 		NumParticles
 		);
@@ -152,49 +179,82 @@ int32 FNiagaraSimulation::SpawnAndKillParticles(int32 NumToSpawn)
 	// run the spawn graph over all new particles
 	if (Props->SpawnScript && Props->SpawnScript->ByteCode.Num())
 	{
-		VectorRegister* InputRegisters[VectorVM::MaxInputRegisters] = { 0 };
-		VectorRegister* OutputRegisters[VectorVM::MaxOutputRegisters] = { 0 };
-		const int32 NumAttr = Props->SpawnScript->Attributes.Num();
-		const int32 NumVectors = NumToSpawn;
-
-		check(NumAttr < VectorVM::MaxInputRegisters);
-		check(NumAttr < VectorVM::MaxOutputRegisters);
-
 		FVector4 *NewParticlesStart = Data.GetCurrentBuffer() + OrigNumParticles;
 
-		// Setup input and output registers.
-		for (int32 AttrIndex = 0; AttrIndex < NumAttr; ++AttrIndex)
-		{
-			InputRegisters[AttrIndex] = (VectorRegister*)(NewParticlesStart + AttrIndex * Data.GetParticleAllocation());
-			OutputRegisters[AttrIndex] = (VectorRegister*)(NewParticlesStart + AttrIndex * Data.GetParticleAllocation());
-		}
-
 		//Fill constant table with required emitter constants and internal script constants.
 		TArray<FVector4> ConstantTable;
 		Props->SpawnScript->ConstantData.FillConstantTable(Constants, ConstantTable);
 
-		VectorVM::Exec(
-			Props->SpawnScript->ByteCode.GetData(),
-			InputRegisters,
-			NumAttr,
-			OutputRegisters,
-			NumAttr,
+		ExecScriptInBlocks(
+			Props->SpawnScript,
+			NewParticlesStart,
+			Data.GetParticleAllocation(),
+			NewParticlesStart,
+			Data.GetParticleAllocation(),
 			ConstantTable.GetData(),
-			NumVectors
+			NumToSpawn
 			);
 	}
 
-	// Iterate over looking for dead particles and move from the end of the list to the dead location, compacting in the process
-	int32 ParticleIndex = 0;
+	// Compact the live particles, keeping their order. Each block of particles counts its live ones, the prefix sum
+	// of the counts gives where each block goes, then the blocks are copied in parallel to the previous buffer, which
+	// isn't needed anymore once the update has run. The particles spawned this frame are all alive.
 	const FVector4* ParticleRelativeTimes = Data.GetAttributeData("Age");
-	while (ParticleIndex < OrigNumParticles)
+	const int32 NumBlocks = FMath::DivideAndRoundUp(CurNumParticles, NiagaraParticlesPerBlock);
+
+	TArray<int32, TInlineAllocator<64> > BlockOffsets;
+	BlockOffsets.AddZeroed(NumBlocks + 1);
+
+	ParallelFor(NumBlocks, [&](int32 BlockIndex)
 	{
-		if (ParticleRelativeTimes[ParticleIndex].X > 1.0f)
+		const int32 FirstParticle = BlockIndex * NiagaraParticlesPerBlock;
+		const int32 LastParticle = FMath::Min(FirstParticle + NiagaraParticlesPerBlock, CurNumParticles);
+		const int32 LastOldParticle = FMath::Min(LastParticle, OrigNumParticles);
+
+		int32 NumDead = 0;
+		for (int32 ParticleIndex = FirstParticle; ParticleIndex < LastOldParticle; ParticleIndex++)
 		{
-			// Particle is dead, move one from the end here.
-			MoveParticleToIndex(--CurNumParticles, ParticleIndex);
+			NumDead += ParticleRelativeTimes[ParticleIndex].X > 1.0f ? 1 : 0;
 		}
-		ParticleIndex++;
+		BlockOffsets[BlockIndex + 1] = LastParticle - FirstParticle - NumDead;
+	});
+
+	for (int32 BlockIndex = 0; BlockIndex < NumBlocks; BlockIndex++)
+	{
+		BlockOffsets[BlockIndex + 1] += BlockOffsets[BlockIndex];
+	}
+
+	const int32 NumAlive = BlockOffsets[NumBlocks];
+	if (NumAlive < CurNumParticles)
+	{
+		Data.AllocatePreviousBuffer();
+		const FVector4* SrcParticles = Data.GetCurrentBuffer();
+		FVector4* DestParticles = Data.GetPreviousBuffer();
+		const int32 NumAttr = Data.GetNumAttributes();
+		const int32 Stride = Data.GetParticleAllocation();
+
+		ParallelFor(NumBlocks, [&](int32 BlockIndex)
+		{
+			const int32 FirstParticle = BlockIndex * NiagaraParticlesPerBlock;
+			const int32 LastParticle = FMath::Min(FirstParticle + NiagaraParticlesPerBlock, CurNumParticles);
+
+			for (int32 AttrIndex = 0; AttrIndex < NumAttr; ++AttrIndex)
+			{
+				const FVector4* SrcAttr = SrcParticles + AttrIndex * Stride;
+				FVector4* DestAttr = DestParticles + AttrIndex * Stride;
+				int32 DestIndex = BlockOffsets[BlockIndex];
+				for (int32 ParticleIndex = FirstParticle; ParticleIndex < LastParticle; ParticleIndex++)
+				{
+					if (ParticleIndex >= OrigNumParticles || ParticleRelativeTimes[ParticleIndex].X <= 1.0f)
+					{
+						DestAttr[DestIndex++] = SrcAttr[ParticleIndex];
+					}
+				}
+			}
+		});
+
+		Data.SwapBuffers();
+		CurNumParticles = NumAlive;
 	}
 
 	Data.SetNumParticles(CurNumParticles);
@@ -51,6 +51,9 @@ bool UPackageMapClient::SerializeObject( FArchive& Ar, UClass* Class, UObject*&
 
 	if (Ar.IsSaving())
 	{
+		// The guid cache and its export state are shared by all the connections
+		FNetParallelReplicationScopeLock GuidCacheLock( Connection->Driver );
+
 		// If pending kill, just serialize as NULL.
 		// TWeakObjectPtrs of PendingKill objects will behave strangely with TSets and TMaps
 		//	PendingKill objects will collide with each other and with NULL objects in those data structures.
@@ -350,7 +353,7 @@ void UPackageMapClient::InternalWriteObject( FArchive & Ar, FNetworkGUID NetGUID
 
 	const bool bNoLoad = !CanClientLoadObject( Object, NetGUID );
 
-	if ( CVarAllowAsyncLoading.GetValueOnGameThread() > 0 && IsNetGUIDAuthority() && !GuidCache->IsExportingNetGUIDBunch && !bNoLoad )
+	if ( CVarAllowAsyncLoading.GetValueOnAnyThread() > 0 && IsNetGUIDAuthority() && !GuidCache->IsExportingNetGUIDBunch && !bNoLoad )
 	{
 		// These are guids that must exist on the client in a package
 		// The client needs to know about these so it can determine if it has finished loading them
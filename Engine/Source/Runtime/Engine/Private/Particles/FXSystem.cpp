@@ -47,10 +47,14 @@ namespace FXConsoleVariables
 {
 	int32 VisualizeGPUSimulation = 0;
 	int32 bAllowGPUSorting = true;
+	int32 bAllowCoherentGPUSorting = false;
+	int32 CoherentGPUSortPasses = 1;
+	float CoherentGPUSortMaxViewMove = 100.0f;
 	int32 bAllowCulling = true;
 	int32 bFreezeGPUSimulation = false;
 	int32 bFreezeParticleSimulation = false;
-	int32 bAllowAsyncTick = false;
+	int32 bAllowAsyncTick = true;
+	int32 bAllowVectorizedUpdate = true;
 	float ParticleSlackGPU = 0.02f;
 	int32 MaxParticleTilePreAllocation = 100;
 	int32 MaxCPUParticlesPerEmitter = 1000;
@@ -75,6 +79,25 @@ namespace FXConsoleVariables
 		TEXT("Allow particles to be sorted on the GPU."),
 		ECVF_Cheat
 		);
+	FAutoConsoleVariableRef CVarAllowCoherentGPUSorting(
+		TEXT("FX.AllowCoherentGPUSorting"),
+		bAllowCoherentGPUSorting,
+		TEXT("Allow GPU particles to be sorted from the order of the previous frame with a few local sort passes instead of a full radix sort.\n")
+		TEXT("A full sort is still done when the sorted emitters change or a view moves more than FX.CoherentGPUSortMaxViewMove."),
+		ECVF_Cheat
+		);
+	FAutoConsoleVariableRef CVarCoherentGPUSortPasses(
+		TEXT("FX.CoherentGPUSortPasses"),
+		CoherentGPUSortPasses,
+		TEXT("Number of pairs of local sort passes done on the order of the previous frame, each pair lets a particle move up to 1024 places."),
+		ECVF_Cheat
+		);
+	FAutoConsoleVariableRef CVarCoherentGPUSortMaxViewMove(
+		TEXT("FX.CoherentGPUSortMaxViewMove"),
+		CoherentGPUSortMaxViewMove,
+		TEXT("Distance in world units a view can move in a frame and still sort its GPU particles from the order of the previous frame."),
+		ECVF_Cheat
+		);
 	FAutoConsoleVariableRef CVarFreezeGPUSimulation(
 		TEXT("FX.FreezeGPUSimulation"),
 		bFreezeGPUSimulation,
@@ -90,7 +113,13 @@ namespace FXConsoleVariables
 	FAutoConsoleVariableRef CVarAllowAsyncTick(
 		TEXT("FX.AllowAsyncTick"),
 		bAllowAsyncTick,
-		TEXT("allow parallel ticking of particle systems."),
+		TEXT("allow parallel ticking of particle systems. Systems using modules that need the game thread (collision, camera, skeletal mesh sources, ...) always tick on the game thread."),
+		ECVF_Cheat
+		);
+	FAutoConsoleVariableRef CVarAllowVectorizedUpdate(
+		TEXT("FX.AllowVectorizedUpdate"),
+		bAllowVectorizedUpdate,
+		TEXT("allow emitters that only use color/size over life, acceleration and constant drag update modules to update their particles in a single vectorized pass."),
 		ECVF_Cheat
 		);
 	FAutoConsoleVariableRef CVarParticleSlackGPU(
@@ -3533,6 +3533,7 @@ void UParticleSystemComponent::SetMaterial(int32 ElementIndex, UMaterialInterfac
 			EmitterMaterials.AddZeroed(ElementIndex + 1 - EmitterMaterials.Num());
 		}
 		EmitterMaterials[ElementIndex] = Material;
+		GCClusterWriteBarrier(this, Material);
 		bIsViewRelevanceDirty = true;
 	}
 }
@@ -5529,8 +5530,9 @@ bool UParticleSystemComponent::GetFloatParameter(const FName InName,float& OutFl
 			}
 			else if (Param.ParamType == PSPT_ScalarRand)
 			{
-				check(IsInGameThread());
-				OutFloat = Param.Scalar + (Param.Scalar_Low - Param.Scalar) * FMath::SRand();
+				// Can be called from an async tick, the seeded random stream is only for the game thread
+				const float RandValue = IsInGameThread() ? FMath::SRand() : FMath::FRand();
+				OutFloat = Param.Scalar + (Param.Scalar_Low - Param.Scalar) * RandValue;
 				return true;
 			}
 		}
@@ -5560,8 +5562,8 @@ bool UParticleSystemComponent::GetVectorParameter(const FName InName,FVector& Ou
 			}
 			else if (Param.ParamType == PSPT_VectorRand)
 			{
-				check(IsInGameThread());
-				FVector RandValue(FMath::SRand(), FMath::SRand(), FMath::SRand());
+				// Can be called from an async tick, the seeded random stream is only for the game thread
+				FVector RandValue = IsInGameThread() ? FVector(FMath::SRand(), FMath::SRand(), FMath::SRand()) : FVector(FMath::FRand(), FMath::FRand(), FMath::FRand());
 				OutVector = Param.Vector + (Param.Vector_Low - Param.Vector) * RandValue;
 				return true;
 			}
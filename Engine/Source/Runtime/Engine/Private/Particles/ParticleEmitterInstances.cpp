@@ -10,8 +10,12 @@
 #include "LevelUtils.h"
 #include "FXSystem.h"
 
+#include "Particles/Acceleration/ParticleModuleAcceleration.h"
+#include "Particles/Acceleration/ParticleModuleAccelerationConstant.h"
+#include "Particles/Acceleration/ParticleModuleAccelerationDrag.h"
 #include "Particles/Camera/ParticleModuleCameraOffset.h"
 #include "Particles/Collision/ParticleModuleCollisionGPU.h"
+#include "Particles/Color/ParticleModuleColorOverLife.h"
 #include "Particles/Event/ParticleModuleEventGenerator.h"
 #include "Particles/Event/ParticleModuleEventReceiverBase.h"
 #include "Particles/Light/ParticleModuleLightBase.h"
@@ -20,6 +24,7 @@
 #include "Particles/Orbit/ParticleModuleOrbit.h"
 #include "Particles/Orientation/ParticleModuleOrientationAxisLock.h"
 #include "Particles/Parameter/ParticleModuleParameterDynamic.h"
+#include "Particles/Size/ParticleModuleSizeMultiplyLife.h"
 #include "Particles/Spawn/ParticleModuleSpawn.h"
 #include "Particles/TypeData/ParticleModuleTypeDataMesh.h"
 #include "Particles/ParticleLODLevel.h"
@@ -812,6 +817,212 @@ float FParticleEmitterInstance::Tick_SpawnParticles(float DeltaTime, UParticleLO
 	return SpawnFraction;
 }
 
+/*-----------------------------------------------------------------------------
+	Vectorized module update.
+-----------------------------------------------------------------------------*/
+
+/** Per particle operation of an update module, applied by VectorizedModuleUpdate */
+struct FParticleVectorizedUpdateOp
+{
+	enum EType
+	{
+		/** Color = ColorOverLife(RelativeTime), Alpha = AlphaOverLife(RelativeTime) */
+		OP_ColorOverLife,
+		/** Size *= LifeMultiplier(RelativeTime) */
+		OP_SizeMultiplyLife,
+		/** Velocity and BaseVelocity += Vector * DeltaTime */
+		OP_ConstantAcceleration,
+		/** Velocity and BaseVelocity += UsedAcceleration payload * DeltaTime */
+		OP_PayloadAcceleration,
+		/** Velocity and BaseVelocity += Velocity * -DragCoefficient * DeltaTime */
+		OP_ConstantDrag,
+	};
+
+	EType						Type;
+	const FRawDistribution*		Distribution;
+	const FRawDistribution*		AlphaDistribution;
+	/** Acceleration * DeltaTime, or -DragCoefficient * DeltaTime replicated */
+	FVector						Vector;
+	uint32						PayloadOffset;
+};
+
+typedef TArray<FParticleVectorizedUpdateOp, TInlineAllocator<8> > FParticleVectorizedUpdateOps;
+
+/**
+ *	Builds the vectorized operations of the update modules of a LOD level.
+ *	Only the common modules are supported, and only when they can be evaluated without the component
+ *	(baked distributions, constant drag).
+ *
+ *	@return	bool	false if a module of the LOD level has to run its own Update
+ */
+static bool BuildVectorizedModuleUpdate(FParticleEmitterInstance* Owner, UParticleLODLevel* LODLevel, UParticleLODLevel* HighestLODLevel, float DeltaTime, FParticleVectorizedUpdateOps& OutOps)
+{
+	const bool bUseLocalSpace = LODLevel->RequiredModule->bUseLocalSpace;
+
+	for (int32 ModuleIndex = 0; ModuleIndex < LODLevel->UpdateModules.Num(); ModuleIndex++)
+	{
+		UParticleModule* Module = LODLevel->UpdateModules[ModuleIndex];
+		if (!Module || !Module->bEnabled || !Module->bUpdateModule)
+		{
+			continue;
+		}
+
+		FParticleVectorizedUpdateOp Op;
+		Op.Distribution = NULL;
+		Op.AlphaDistribution = NULL;
+		Op.Vector = FVector::ZeroVector;
+		Op.PayloadOffset = 0;
+
+		const UClass* ModuleClass = Module->GetClass();
+		if (ModuleClass == UParticleModuleColorOverLife::StaticClass())
+		{
+			UParticleModuleColorOverLife* ColorModule = (UParticleModuleColorOverLife*)Module;
+			Op.Type = FParticleVectorizedUpdateOp::OP_ColorOverLife;
+			Op.Distribution = ColorModule->ColorOverLife.GetFastRawDistribution();
+			Op.AlphaDistribution = ColorModule->AlphaOverLife.GetFastRawDistribution();
+			if (!Op.Distribution || !Op.AlphaDistribution)
+			{
+				return false;
+			}
+		}
+		else if (ModuleClass == UParticleModuleSizeMultiplyLife::StaticClass())
+		{
+			UParticleModuleSizeMultiplyLife* SizeModule = (UParticleModuleSizeMultiplyLife*)Module;
+			Op.Type = FParticleVectorizedUpdateOp::OP_SizeMultiplyLife;
+			Op.Distribution = SizeModule->LifeMultiplier.GetFastRawDistribution();
+			if (!Op.Distribution || !SizeModule->MultiplyX || !SizeModule->MultiplyY || !SizeModule->MultiplyZ)
+			{
+				return false;
+			}
+		}
+		else if (ModuleClass == UParticleModuleAccelerationConstant::StaticClass())
+		{
+			UParticleModuleAccelerationConstant* AccelerationModule = (UParticleModuleAccelerationConstant*)Module;
+			FVector Acceleration = AccelerationModule->Acceleration;
+			if (AccelerationModule->bAlwaysInWorldSpace && bUseLocalSpace)
+			{
+				Acceleration = Owner->Component->ComponentToWorld.InverseTransformVector(Acceleration);
+			}
+			Op.Type = FParticleVectorizedUpdateOp::OP_ConstantAcceleration;
+			Op.Vector = Acceleration * DeltaTime;
+		}
+		else if (ModuleClass == UParticleModuleAcceleration::StaticClass())
+		{
+			UParticleModuleAcceleration* AccelerationModule = (UParticleModuleAcceleration*)Module;
+			if (AccelerationModule->bAlwaysInWorldSpace && bUseLocalSpace)
+			{
+				return false;
+			}
+			uint32* Offset = Owner->ModuleOffsetMap.Find(HighestLODLevel->UpdateModules[ModuleIndex]);
+			Op.Type = FParticleVectorizedUpdateOp::OP_PayloadAcceleration;
+			Op.Vector = FVector(DeltaTime);
+			Op.PayloadOffset = Offset ? *Offset : 0;
+		}
+		else if (ModuleClass == UParticleModuleAccelerationDrag::StaticClass())
+		{
+			// Not Cast, the parameter distributions derive from the constant one
+			UDistributionFloat* DragDistribution = ((UParticleModuleAccelerationDrag*)Module)->DragCoefficient;
+			if (!DragDistribution || DragDistribution->GetClass() != UDistributionFloatConstant::StaticClass())
+			{
+				return false;
+			}
+			UDistributionFloatConstant* DragCoefficient = (UDistributionFloatConstant*)DragDistribution;
+			Op.Type = FParticleVectorizedUpdateOp::OP_ConstantDrag;
+			Op.Vector = FVector(-DragCoefficient->Constant * DeltaTime);
+		}
+		else
+		{
+			return false;
+		}
+
+		OutOps.Add(Op);
+	}
+
+	return true;
+}
+
+/** Adds Delta to the XYZ of an aligned FVector followed by a 4 byte member, leaving the member untouched */
+FORCEINLINE static void VectorAddXYZAligned(void* Dest, const VectorRegister& Delta)
+{
+	const VectorRegister Value = VectorLoadAligned(Dest);
+	const VectorRegister NewValue = VectorMergeVecXYZ_VecW(VectorAdd(Value, Delta), Value);
+	VectorStoreAligned(NewValue, Dest);
+}
+
+/**
+ *	Applies the operations of every update module to each particle in a single pass, instead of looping
+ *	over the particles once per module. The FBaseParticle members are in 16 byte rows, which are updated
+ *	as vector registers.
+ */
+static void VectorizedModuleUpdate(FParticleEmitterInstance* Owner, const FParticleVectorizedUpdateOps& Ops)
+{
+	uint8* ParticleData = Owner->ParticleData;
+	const uint32 ParticleStride = Owner->ParticleStride;
+	const uint16* ParticleIndices = Owner->ParticleIndices;
+
+	checkSlow(IsAligned(ParticleData, 16) && IsAligned(ParticleStride, 16));
+
+	for (int32 i = Owner->ActiveParticles - 1; i >= 0; i--)
+	{
+		uint8* ParticleBase = ParticleData + ParticleIndices[i] * ParticleStride;
+		FBaseParticle& Particle = *((FBaseParticle*)ParticleBase);
+		if (i > 0)
+		{
+			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i-1] * ParticleStride));
+			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i-1] * ParticleStride) + CACHE_LINE_SIZE);
+		}
+		if ((Particle.Flags & STATE_Particle_Freeze) != 0)
+		{
+			continue;
+		}
+
+		for (int32 OpIndex = 0; OpIndex < Ops.Num(); OpIndex++)
+		{
+			const FParticleVectorizedUpdateOp& Op = Ops[OpIndex];
+			switch (Op.Type)
+			{
+			case FParticleVectorizedUpdateOp::OP_ColorOverLife:
+				{
+					Op.Distribution->GetValue3None(Particle.RelativeTime, &Particle.Color.R);
+					Op.AlphaDistribution->GetValue1None(Particle.RelativeTime, &Particle.Color.A);
+				}
+				break;
+			case FParticleVectorizedUpdateOp::OP_SizeMultiplyLife:
+				{
+					FVector SizeScale;
+					Op.Distribution->GetValue3None(Particle.RelativeTime, &SizeScale.X);
+					// Size shares its row with Flags
+					const VectorRegister Size = VectorLoadAligned(&Particle.Size);
+					const VectorRegister NewSize = VectorMergeVecXYZ_VecW(VectorMultiply(Size, VectorLoadFloat3_W1(&SizeScale)), Size);
+					VectorStoreAligned(NewSize, &Particle.Size);
+				}
+				break;
+			case FParticleVectorizedUpdateOp::OP_ConstantAcceleration:
+				{
+					const VectorRegister Delta = VectorLoadFloat3_W0(&Op.Vector);
+					VectorAddXYZAligned(&Particle.Velocity, Delta);
+					VectorAddXYZAligned(&Particle.BaseVelocity, Delta);
+				}
+				break;
+			case FParticleVectorizedUpdateOp::OP_PayloadAcceleration:
+				{
+					const VectorRegister Delta = VectorMultiply(VectorLoadFloat3_W0(ParticleBase + Op.PayloadOffset), VectorLoadFloat3_W0(&Op.Vector));
+					VectorAddXYZAligned(&Particle.Velocity, Delta);
+					VectorAddXYZAligned(&Particle.BaseVelocity, Delta);
+				}
+				break;
+			case FParticleVectorizedUpdateOp::OP_ConstantDrag:
+				{
+					const VectorRegister Delta = VectorMultiply(VectorLoadAligned(&Particle.Velocity), VectorLoadFloat3_W0(&Op.Vector));
+					VectorAddXYZAligned(&Particle.Velocity, Delta);
+					VectorAddXYZAligned(&Particle.BaseVelocity, Delta);
+				}
+				break;
+			}
+		}
+	}
+}
+
 /**
  *	Tick sub-function that handles module updates
  *
@@ -822,6 +1033,17 @@ void FParticleEmitterInstance::Tick_ModuleUpdate(float DeltaTime, UParticleLODLe
 {
 	UParticleLODLevel* HighestLODLevel = SpriteTemplate->LODLevels[0];
 	check(HighestLODLevel);
+
+	if (FXConsoleVariables::bAllowVectorizedUpdate && ActiveParticles > 0 && ParticleData && ParticleIndices)
+	{
+		FParticleVectorizedUpdateOps Ops;
+		if (BuildVectorizedModuleUpdate(this, InCurrentLODLevel, HighestLODLevel, DeltaTime, Ops))
+		{
+			VectorizedModuleUpdate(this, Ops);
+			return;
+		}
+	}
+
 	for (int32 ModuleIndex = 0; ModuleIndex < InCurrentLODLevel->UpdateModules.Num(); ModuleIndex++)
 	{
 		UParticleModule* CurrentModule = InCurrentLODLevel->UpdateModules[ModuleIndex];
@@ -2812,6 +3034,12 @@ void FParticleMeshEmitterInstance::InitParameters(UParticleEmitter* InTemplate,
 	MeshTypeData = CastChecked<UParticleModuleTypeDataMesh>(LODLevel->TypeDataModule);
 	check(MeshTypeData);
 
+	// Mesh particles are rendered with the first LOD of the mesh, it can't be streamed out
+	if (MeshTypeData->Mesh)
+	{
+		IStreamingManager::Get().GetMeshStreamingManager().ForceAllLODsResident(MeshTypeData->Mesh);
+	}
+
 	// Grab the MeshRotationRate module offset, if there is one...
 	MeshRotationActive = false;
 	if (LODLevel->RequiredModule->ScreenAlignment == PSA_Velocity
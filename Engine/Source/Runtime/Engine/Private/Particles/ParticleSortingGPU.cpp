@@ -5,6 +5,7 @@
 ==============================================================================*/
 
 #include "EnginePrivate.h"
+#include "FXSystem.h"
 #include "ParticleSortingGPU.h"
 #include "ParticleSimulationGPU.h"
 #include "ParticleHelper.h"
@@ -29,6 +30,7 @@ BEGIN_UNIFORM_BUFFER_STRUCT( FParticleKeyGenParameters, )
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER( FVector4, ViewOrigin )
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER( uint32, ChunksPerGroup )
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER( uint32, ExtraChunkCount )
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER( uint32, InputOffset )
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER( uint32, OutputOffset )
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER( uint32, EmitterKey )
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER( uint32, KeyCount )
@@ -167,12 +169,150 @@ private:
 };
 IMPLEMENT_SHADER_TYPE(,FParticleSortKeyGenCS,TEXT("ParticleSortKeyGen"),TEXT("GenerateParticleSortKeys"),SF_Compute);
 
+/*------------------------------------------------------------------------------
+	Shaders used to refine the sorting results of the previous frame.
+------------------------------------------------------------------------------*/
+
+/** The number of threads per group used to sort blocks of particles, each thread sorts two particles. */
+#define PARTICLE_COHERENT_SORT_THREAD_COUNT 512
+
+/** The number of particles sorted by a thread group. */
+#define PARTICLE_COHERENT_SORT_BLOCK_SIZE (PARTICLE_COHERENT_SORT_THREAD_COUNT * 2)
+
+/**
+ * Compute shader used to sort blocks of particles in place, with a bitonic sort in shared memory.
+ */
+class FParticleCoherentSortCS : public FGlobalShader
+{
+	DECLARE_SHADER_TYPE(FParticleCoherentSortCS,Global);
+
+public:
+
+	static bool ShouldCache( EShaderPlatform Platform )
+	{
+		return IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment( EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment )
+	{
+		FGlobalShader::ModifyCompilationEnvironment( Platform, OutEnvironment );
+		OutEnvironment.SetDefine( TEXT("THREAD_COUNT"), PARTICLE_COHERENT_SORT_THREAD_COUNT );
+	}
+
+	/** Default constructor. */
+	FParticleCoherentSortCS()
+	{
+	}
+
+	/** Initialization constructor. */
+	explicit FParticleCoherentSortCS( const ShaderMetaType::CompiledShaderInitializerType& Initializer )
+		: FGlobalShader(Initializer)
+	{
+		InOutKeys.Bind( Initializer.ParameterMap, TEXT("InOutKeys") );
+		InOutValues.Bind( Initializer.ParameterMap, TEXT("InOutValues") );
+		BlockOffset.Bind( Initializer.ParameterMap, TEXT("BlockOffset") );
+		KeyCount.Bind( Initializer.ParameterMap, TEXT("KeyCount") );
+	}
+
+	/** Serialization. */
+	virtual bool Serialize( FArchive& Ar ) override
+	{
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize( Ar );
+		Ar << InOutKeys;
+		Ar << InOutValues;
+		Ar << BlockOffset;
+		Ar << KeyCount;
+		return bShaderHasOutdatedParameters;
+	}
+
+	/**
+	 * Set the buffers to sort.
+	 */
+	void SetBuffers(FRHICommandList& RHICmdList, FUnorderedAccessViewRHIParamRef KeysUAV, FUnorderedAccessViewRHIParamRef ValuesUAV, uint32 InKeyCount)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+		RHICmdList.SetUAVParameter(ComputeShaderRHI, InOutKeys.GetBaseIndex(), KeysUAV);
+		RHICmdList.SetUAVParameter(ComputeShaderRHI, InOutValues.GetBaseIndex(), ValuesUAV);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, KeyCount, InKeyCount);
+	}
+
+	/**
+	 * Set the index of the first particle of the first block.
+	 */
+	void SetBlockOffset(FRHICommandList& RHICmdList, uint32 InBlockOffset)
+	{
+		SetShaderValue(RHICmdList, GetComputeShader(), BlockOffset, InBlockOffset);
+	}
+
+	/**
+	 * Unbinds any buffers that have been bound.
+	 */
+	void UnbindBuffers(FRHICommandList& RHICmdList)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+		RHICmdList.SetUAVParameter(ComputeShaderRHI, InOutKeys.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
+		RHICmdList.SetUAVParameter(ComputeShaderRHI, InOutValues.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
+	}
+
+private:
+
+	/** Keys and values sorted in place. */
+	FShaderResourceParameter InOutKeys;
+	FShaderResourceParameter InOutValues;
+	/** Index of the first particle of the first block. */
+	FShaderParameter BlockOffset;
+	/** The number of valid keys. */
+	FShaderParameter KeyCount;
+};
+IMPLEMENT_SHADER_TYPE(,FParticleCoherentSortCS,TEXT("ParticleSortCoherent"),TEXT("SortParticleBlocks"),SF_Compute);
+
+/**
+ * Sort particles whose keys are already nearly in order, as when they are generated in the order of the previous frame.
+ * Blocks of particles are sorted, then the same blocks offset by half a block so particles can cross the block boundaries.
+ * Each pair of passes moves a particle up to a block away from its initial position, particles further away than that are only sorted
+ * over the next frames.
+ * @param KeyBufferUAV - Unordered access view of the buffer containing the keys.
+ * @param ValueBufferUAV - Unordered access view of the buffer containing the values, as 32 bit integers.
+ * @param Count - How many items in the buffer need to be sorted.
+ * @param PassCount - The number of pairs of passes.
+ */
+static void SortParticlesCoherent(
+	FRHICommandListImmediate& RHICmdList,
+	FUnorderedAccessViewRHIParamRef KeyBufferUAV,
+	FUnorderedAccessViewRHIParamRef ValueBufferUAV,
+	uint32 Count,
+	int32 PassCount,
+	ERHIFeatureLevel::Type FeatureLevel
+	)
+{
+	SCOPED_DRAW_EVENT(RHICmdList, ParticleSortCoherent);
+	check(FeatureLevel == ERHIFeatureLevel::SM5);
+
+	TShaderMapRef<FParticleCoherentSortCS> SortCS(GetGlobalShaderMap(FeatureLevel));
+	RHICmdList.SetComputeShader(SortCS->GetComputeShader());
+	SortCS->SetBuffers(RHICmdList, KeyBufferUAV, ValueBufferUAV, Count);
+
+	for (int32 PassIndex = 0; PassIndex < PassCount * 2; ++PassIndex)
+	{
+		const uint32 BlockOffset = (PassIndex & 1) ? PARTICLE_COHERENT_SORT_BLOCK_SIZE / 2 : 0;
+		if (BlockOffset < Count)
+		{
+			SortCS->SetBlockOffset(RHICmdList, BlockOffset);
+			DispatchComputeShader(RHICmdList, *SortCS, FMath::DivideAndRoundUp<uint32>(Count - BlockOffset, PARTICLE_COHERENT_SORT_BLOCK_SIZE), 1, 1);
+		}
+	}
+
+	SortCS->UnbindBuffers(RHICmdList);
+}
+
 /**
  * Generate sort keys for a list of particles.
  * @param KeyBufferUAV - Unordered access view of the buffer where sort keys will be stored.
  * @param SortedVertexBufferUAV - Unordered access view of the vertex buffer where particle indices will be stored.
  * @param PositionTextureRHI - The texture containing world space positions for all particles.
  * @param SimulationsToSort - A list of simulations to generate sort keys for.
+ * @param PreviousSortedVertexBufferSRV - If set, the particle indices are read from the sorting results of the previous frame instead
+ *			of the simulations, to keep their order. The simulations must be laid out as in that sort.
  * @returns the total number of particles being sorted.
  */
 static int32 GenerateParticleSortKeys(
@@ -181,7 +321,8 @@ static int32 GenerateParticleSortKeys(
 	FUnorderedAccessViewRHIParamRef SortedVertexBufferUAV,
 	FTexture2DRHIParamRef PositionTextureRHI,
 	const TArray<FParticleSimulationSortInfo>& SimulationsToSort,
-	ERHIFeatureLevel::Type FeatureLevel
+	ERHIFeatureLevel::Type FeatureLevel,
+	FShaderResourceViewRHIParamRef PreviousSortedVertexBufferSRV = nullptr
 	)
 {
 	SCOPED_DRAW_EVENT(RHICmdList, ParticleSortKeyGen);
@@ -212,13 +353,14 @@ static int32 GenerateParticleSortKeys(
 		KeyGenParameters.ViewOrigin = SortInfo.ViewOrigin;
 		KeyGenParameters.ChunksPerGroup = ChunkCount / GroupCount;
 		KeyGenParameters.ExtraChunkCount = ChunkCount % GroupCount;
+		KeyGenParameters.InputOffset = PreviousSortedVertexBufferSRV ? TotalParticleCount : 0;
 		KeyGenParameters.OutputOffset = TotalParticleCount;
 		KeyGenParameters.EmitterKey = SimulationIndex << 16;
 		KeyGenParameters.KeyCount = ParticleCount;
 		KeyGenUniformBuffer = FParticleKeyGenUniformBufferRef::CreateUniformBufferImmediate( KeyGenParameters, UniformBuffer_SingleDraw );
 
 		// Dispatch.
-		KeyGenCS->SetParameters(RHICmdList, KeyGenUniformBuffer, SortInfo.VertexBufferSRV);
+		KeyGenCS->SetParameters(RHICmdList, KeyGenUniformBuffer, PreviousSortedVertexBufferSRV ? PreviousSortedVertexBufferSRV : SortInfo.VertexBufferSRV);
 		DispatchComputeShader(RHICmdList, *KeyGenCS, GroupCount, 1, 1);
 
 		// Update offset in to the buffer.
@@ -264,6 +406,11 @@ void FParticleSortBuffers::InitRHI()
  */
 void FParticleSortBuffers::ReleaseRHI()
 {
+	SortedVertexBufferSRVs.Empty();
+	SortedParticleCounts.Empty();
+	SortedViewOrigins.Empty();
+	SortedBufferIndex = INDEX_NONE;
+
 	for ( int32 BufferIndex = 0; BufferIndex < 2; ++BufferIndex )
 	{
 		KeyBufferUAVs[BufferIndex].SafeRelease();
@@ -296,6 +443,52 @@ FGPUSortBuffers FParticleSortBuffers::GetSortBuffers()
 	return SortBuffers;
 }
 
+/**
+ * Retrieve the buffer holding the previous sorting results if they can be used as the initial order of this sort.
+ */
+int32 FParticleSortBuffers::GetCoherentBufferIndex(const TArray<FParticleSimulationSortInfo>& SimulationsToSort, float MaxViewMove) const
+{
+	if (SortedBufferIndex == INDEX_NONE || SortedVertexBufferSRVs.Num() != SimulationsToSort.Num())
+	{
+		return INDEX_NONE;
+	}
+
+	for (int32 SimulationIndex = 0; SimulationIndex < SimulationsToSort.Num(); ++SimulationIndex)
+	{
+		const FParticleSimulationSortInfo& SortInfo = SimulationsToSort[SimulationIndex];
+		if (SortedVertexBufferSRVs[SimulationIndex] != SortInfo.VertexBufferSRV
+			|| SortedParticleCounts[SimulationIndex] != SortInfo.ParticleCount
+			|| FVector::DistSquared(SortedViewOrigins[SimulationIndex], SortInfo.ViewOrigin) > FMath::Square(MaxViewMove))
+		{
+			return INDEX_NONE;
+		}
+	}
+
+	return SortedBufferIndex;
+}
+
+/**
+ * Record the simulations whose sorting results are stored in the given buffer, for the next sort.
+ */
+void FParticleSortBuffers::SetSortedSimulations(const TArray<FParticleSimulationSortInfo>& SimulationsToSort, int32 BufferIndex)
+{
+	check((BufferIndex & 0xFFFFFFFE) == 0);
+	const int32 SimulationCount = SimulationsToSort.Num();
+	SortedVertexBufferSRVs.Reset(SimulationCount);
+	SortedParticleCounts.Reset(SimulationCount);
+	SortedViewOrigins.Reset(SimulationCount);
+
+	for (int32 SimulationIndex = 0; SimulationIndex < SimulationCount; ++SimulationIndex)
+	{
+		const FParticleSimulationSortInfo& SortInfo = SimulationsToSort[SimulationIndex];
+		SortedVertexBufferSRVs.Add(SortInfo.VertexBufferSRV);
+		SortedParticleCounts.Add(SortInfo.ParticleCount);
+		SortedViewOrigins.Add(SortInfo.ViewOrigin);
+	}
+
+	SortedBufferIndex = BufferIndex;
+}
+
 /*------------------------------------------------------------------------------
 	Public interface.
 ------------------------------------------------------------------------------*/
@@ -327,6 +520,35 @@ int32 SortParticlesGPU(
 		}
 	}
 
+	// If the same particles were sorted last frame from about the same place, their previous order only needs a few local passes.
+	const int32 CoherentBufferIndex = FXConsoleVariables::bAllowCoherentGPUSorting && FXConsoleVariables::CoherentGPUSortPasses > 0
+		? ParticleSortBuffers.GetCoherentBufferIndex(SimulationsToSort, FXConsoleVariables::CoherentGPUSortMaxViewMove)
+		: INDEX_NONE;
+
+	if (CoherentBufferIndex != INDEX_NONE)
+	{
+		// The keys are generated in the other buffer, the previous results are read while they are written.
+		const int32 BufferIndex = CoherentBufferIndex ^ 0x1;
+		const int32 TotalParticleCount = GenerateParticleSortKeys(
+			RHICmdList,
+			ParticleSortBuffers.GetKeyBufferUAV(BufferIndex),
+			ParticleSortBuffers.GetVertexBufferUAV(BufferIndex),
+			PositionTextureRHI,
+			SimulationsToSort,
+			FeatureLevel,
+			ParticleSortBuffers.GetSortedVertexBufferSRV(CoherentBufferIndex)
+			);
+
+		// Update stats.
+		INC_DWORD_STAT_BY( STAT_SortedGPUEmitters, SimulationsToSort.Num() );
+		INC_DWORD_STAT_BY( STAT_SortedGPUParticles, TotalParticleCount );
+
+		FGPUSortBuffers SortBuffers = ParticleSortBuffers.GetSortBuffers();
+		SortParticlesCoherent(RHICmdList, SortBuffers.RemoteKeyUAVs[BufferIndex], SortBuffers.RemoteValueUAVs[BufferIndex], TotalParticleCount, FXConsoleVariables::CoherentGPUSortPasses, FeatureLevel);
+		ParticleSortBuffers.SetSortedSimulations(SimulationsToSort, BufferIndex);
+		return BufferIndex;
+	}
+
 	// First generate keys for each emitter to be sorted.
 	
 	const int32 TotalParticleCount = GenerateParticleSortKeys(
@@ -346,5 +568,9 @@ int32 SortParticlesGPU(
 	const uint32 EmitterKeyMask = (1 << FMath::CeilLogTwo( SimulationsToSort.Num() )) - 1;
 	const uint32 KeyMask = (EmitterKeyMask << 16) | 0xFFFF;
 	FGPUSortBuffers SortBuffers = ParticleSortBuffers.GetSortBuffers();
-	return SortGPUBuffers(RHICmdList, SortBuffers, 0, KeyMask, TotalParticleCount, FeatureLevel);
+	const int32 BufferIndex = SortGPUBuffers(RHICmdList, SortBuffers, 0, KeyMask, TotalParticleCount, FeatureLevel);
+
+	// Always recorded, the buffers are overwritten even while the previous order is not used.
+	ParticleSortBuffers.SetSortedSimulations(SimulationsToSort, BufferIndex);
+	return BufferIndex;
 }
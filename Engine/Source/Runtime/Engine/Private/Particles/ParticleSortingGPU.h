@@ -9,6 +9,7 @@
 #include "RenderResource.h"
 
 struct FGPUSortBuffers;
+struct FParticleSimulationSortInfo;
 
 /**
  * Buffers in GPU memory used to sort particles.
@@ -19,7 +20,8 @@ public:
 
 	/** Initialization constructor. */
 	explicit FParticleSortBuffers(int32 InBufferSize)
-		: BufferSize(InBufferSize)
+		: SortedBufferIndex(INDEX_NONE)
+		, BufferSize(InBufferSize)
 	{
 	}
 
@@ -36,17 +38,19 @@ public:
 	/**
 	 * Retrieve the UAV for writing particle sort keys.
 	 */
-	FUnorderedAccessViewRHIParamRef GetKeyBufferUAV()
+	FUnorderedAccessViewRHIParamRef GetKeyBufferUAV(int32 BufferIndex = 0)
 	{
-		return KeyBufferUAVs[0];
+		check((BufferIndex & 0xFFFFFFFE) == 0);
+		return KeyBufferUAVs[BufferIndex];
 	}
 
 	/**
 	 * Retrieve the UAV for writing particle vertices.
 	 */
-	FUnorderedAccessViewRHIParamRef GetVertexBufferUAV()
+	FUnorderedAccessViewRHIParamRef GetVertexBufferUAV(int32 BufferIndex = 0)
 	{
-		return VertexBufferUAVs[0];
+		check((BufferIndex & 0xFFFFFFFE) == 0);
+		return VertexBufferUAVs[BufferIndex];
 	}
 
 	/**
@@ -77,8 +81,28 @@ public:
 	 */
 	int32 GetSize() { return BufferSize; }
 
+	/**
+	 * Retrieve the buffer holding the previous sorting results if they can be used as the initial order of this sort.
+	 * That is only the case if the same simulations are sorted in the same order, with the same particle count, from views that did not move more than MaxViewMove.
+	 * @returns the buffer index of the previous results, INDEX_NONE if the particles must be fully sorted.
+	 */
+	int32 GetCoherentBufferIndex(const TArray<FParticleSimulationSortInfo>& SimulationsToSort, float MaxViewMove) const;
+
+	/**
+	 * Record the simulations whose sorting results are stored in the given buffer, for the next sort.
+	 */
+	void SetSortedSimulations(const TArray<FParticleSimulationSortInfo>& SimulationsToSort, int32 BufferIndex);
+
 private:
 
+	/** Vertex buffers of the simulations in the last sorting results. Referenced so a new buffer can't reuse the address of a released one. */
+	TArray<FShaderResourceViewRHIRef> SortedVertexBufferSRVs;
+	/** Particle count and view origin of the simulations in the last sorting results. */
+	TArray<uint32> SortedParticleCounts;
+	TArray<FVector> SortedViewOrigins;
+	/** Buffer index of the last sorting results, INDEX_NONE if there are none. */
+	int32 SortedBufferIndex;
+
 	/** Vertex buffer storage for particle sort keys. */
 	FVertexBufferRHIRef KeyBuffers[2];
 	/** Shader resource view for particle sort keys. */
@@ -908,6 +908,17 @@ void FBodyInstance::UpdatePhysicsFilterData(bool bForceSimpleAsComplex)
 }
 
 
+#if WITH_PHYSX
+/** Static actors created while FBodyInstance::InitStaticBodies runs, that InitBody leaves to it to add to the scenes */
+struct FDeferredStaticActors
+{
+	TArray<PxActor*> Sync;
+	TArray<PxActor*> Async;
+};
+
+static FDeferredStaticActors* GDeferredStaticActors = NULL;
+#endif
+
 #if UE_WITH_PHYSICS
 void FBodyInstance::InitBody(UBodySetup* Setup, const FTransform& Transform, UPrimitiveComponent* PrimComp, FPhysScene* InRBScene, PxAggregate* InAggregate)
 {
@@ -1347,6 +1358,18 @@ void FBodyInstance::InitBody(UBodySetup* Setup, const FTransform& Transform, UPr
 			PSceneForNewDynamic->addAggregate(*BodyAggregate);
 		}
 	}
+	else if(PNewDynamic == NULL && GDeferredStaticActors != NULL)
+	{
+		// InitStaticBodies adds them along with the other bodies
+		if(PNewActorSync != NULL)
+		{
+			GDeferredStaticActors->Sync.Add(PNewActorSync);
+		}
+		if(PNewActorAsync != NULL)
+		{
+			GDeferredStaticActors->Async.Add(PNewActorAsync);
+		}
+	}
 	else
 	{
 		// Actually add actor(s) to scene(s) (if not artic link)
@@ -1419,6 +1442,43 @@ void FBodyInstance::InitBody(UBodySetup* Setup, const FTransform& Transform, UPr
 }
 #endif // UE_WITH_PHYSICS
 
+#if WITH_PHYSX
+void FBodyInstance::InitStaticBodies(const TArray<FBodyInstance*>& Bodies, const TArray<FTransform>& Transforms, UBodySetup* Setup, UPrimitiveComponent* PrimComp, FPhysScene* InRBScene)
+{
+	check(IsInGameThread());
+	check(Bodies.Num() == Transforms.Num());
+	check(GDeferredStaticActors == NULL);
+
+	FDeferredStaticActors DeferredActors;
+	DeferredActors.Sync.Reserve(Bodies.Num());
+	if (InRBScene && InRBScene->HasAsyncScene())
+	{
+		DeferredActors.Async.Reserve(Bodies.Num());
+	}
+
+	GDeferredStaticActors = &DeferredActors;
+	for (int32 BodyIdx = 0; BodyIdx < Bodies.Num(); ++BodyIdx)
+	{
+		Bodies[BodyIdx]->InitBody(Setup, Transforms[BodyIdx], PrimComp, InRBScene);
+	}
+	GDeferredStaticActors = NULL;
+
+	if (DeferredActors.Sync.Num() > 0)
+	{
+		PxScene* PSceneSync = InRBScene->GetPhysXScene(PST_Sync);
+		SCOPED_SCENE_WRITE_LOCK(PSceneSync);
+		PSceneSync->addActors(DeferredActors.Sync.GetData(), DeferredActors.Sync.Num());
+	}
+
+	if (DeferredActors.Async.Num() > 0)
+	{
+		PxScene* PSceneAsync = InRBScene->GetPhysXScene(PST_Async);
+		SCOPED_SCENE_WRITE_LOCK(PSceneAsync);
+		PSceneAsync->addActors(DeferredActors.Async.GetData(), DeferredActors.Async.Num());
+	}
+}
+#endif // WITH_PHYSX
+
 #if WITH_PHYSX
 TArray<int32> FBodyInstance::AddCollisionNotifyInfo(const FBodyInstance* Body0, const FBodyInstance* Body1, const physx::PxContactPair * Pairs, uint32 NumPairs, TArray<FCollisionNotifyInfo> & PendingNotifyInfos)
 {
@@ -55,6 +55,7 @@ UBodySetup::UBodySetup(const FObjectInitializer& ObjectInitializer)
 	SetFlags(RF_Transactional);
 	bSharedCookedData = false;
 	CookedFormatDataOverride = nullptr;
+	AsyncCookTask = nullptr;
 }
 
 void UBodySetup::CopyBodyPropertiesFrom(const UBodySetup* FromSetup)
@@ -690,6 +691,8 @@ void UBodySetup::BeginDestroy()
 {
 	Super::BeginDestroy();
 
+	FinishAsyncCook();
+
 	AggGeom.FreeRenderInfo();
 }	
 
@@ -854,6 +857,8 @@ FByteBulkData* UBodySetup::GetCookedData(FName Format)
 		return NULL;
 	}
 
+	FinishAsyncCook();
+
 	IInterface_CollisionDataProvider* CDP = Cast<IInterface_CollisionDataProvider>(GetOuter());
 
 	// If there is nothing to cook or if we are reading data from a cooked package for an asset with no collision, 
@@ -889,6 +894,7 @@ FByteBulkData* UBodySetup::GetCookedData(FName Format)
 			GetDerivedDataCacheRef().GetSynchronous(DerivedPhysXData, OutData);
 		#elif WITH_RUNTIME_PHYSICS_COOKING
 			DerivedPhysXData->Build(OutData);
+			delete DerivedPhysXData;
 		#endif
 			if (OutData.Num())
 			{
@@ -900,6 +906,9 @@ FByteBulkData* UBodySetup::GetCookedData(FName Format)
 		else
 #endif
 		{
+#if WITH_RUNTIME_PHYSICS_COOKING || WITH_EDITOR
+			delete DerivedPhysXData;
+#endif
 			UE_LOG(LogPhysics, Warning, TEXT("Attempt to build physics data for %s when we are unable to."), *GetPathName());
 		}
 	}
@@ -908,6 +917,81 @@ FByteBulkData* UBodySetup::GetCookedData(FName Format)
 	return Result->GetBulkDataSize() > 0 ? Result : NULL; // we don't return empty bulk data...but we save it to avoid thrashing the DDC
 }
 
+bool UBodySetup::BeginAsyncCook()
+{
+#if WITH_PHYSX && (WITH_RUNTIME_PHYSICS_COOKING || WITH_EDITOR)
+	static FName PhysicsFormatName(FPlatformProperties::GetPhysicsFormat());
+
+	// A previous cook may still be running, e.g. if the body setup was invalidated since
+	FinishAsyncCook();
+
+	if (IsTemplate() || !bHasCookedCollisionData)
+	{
+		return false;
+	}
+
+	// Same conditions as GetCookedData
+	FFormatContainer* UseCookedData = CookedFormatDataOverride ? CookedFormatDataOverride : &CookedFormatData;
+	IInterface_CollisionDataProvider* CDP = Cast<IInterface_CollisionDataProvider>(GetOuter());
+	if (UseCookedData->Contains(PhysicsFormatName) || (AggGeom.ConvexElems.Num() == 0 && (CDP == NULL || CDP->ContainsPhysicsTriMeshData(bMeshCollideAll) == false)))
+	{
+		return false;
+	}
+
+	FDerivedDataPhysXCooker* DerivedPhysXData = new FDerivedDataPhysXCooker(PhysicsFormatName, this);
+	if (!DerivedPhysXData->CanBuild())
+	{
+		delete DerivedPhysXData;
+		return false;
+	}
+
+	// Everything the cook reads from this body setup and its outer is copied here
+	DerivedPhysXData->GatherCookInput();
+	AsyncCookTask = new FAsyncTask<FPhysXCookAsyncTask>(DerivedPhysXData, PhysicsFormatName, BodySetupGuid);
+	AsyncCookTask->StartBackgroundTask();
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool UBodySetup::IsAsyncCookComplete() const
+{
+#if WITH_PHYSX && (WITH_RUNTIME_PHYSICS_COOKING || WITH_EDITOR)
+	return AsyncCookTask == nullptr || AsyncCookTask->IsWorkDone();
+#else
+	return true;
+#endif
+}
+
+void UBodySetup::FinishAsyncCook()
+{
+#if WITH_PHYSX && (WITH_RUNTIME_PHYSICS_COOKING || WITH_EDITOR)
+	if (AsyncCookTask)
+	{
+		AsyncCookTask->EnsureCompletion();
+		const FPhysXCookAsyncTask& Task = AsyncCookTask->GetTask();
+
+		// The result is stale if the physics data was invalidated while it was being cooked
+		FFormatContainer* UseCookedData = CookedFormatDataOverride ? CookedFormatDataOverride : &CookedFormatData;
+		if (Task.DataGuid == BodySetupGuid && !UseCookedData->Contains(Task.Format))
+		{
+			// Stored even when empty, like GetCookedData does
+			FByteBulkData& Result = UseCookedData->GetFormat(Task.Format);
+			if (Task.OutData.Num())
+			{
+				Result.Lock(LOCK_READ_WRITE);
+				FMemory::Memcpy(Result.Realloc(Task.OutData.Num()), Task.OutData.GetData(), Task.OutData.Num());
+				Result.Unlock();
+			}
+		}
+
+		delete AsyncCookTask;
+		AsyncCookTask = nullptr;
+	}
+#endif
+}
+
 void UBodySetup::PostInitProperties()
 {
 	Super::PostInitProperties();
@@ -7,11 +7,75 @@
 
 #include "IPhysXFormatModule.h"
 
+static TAutoConsoleVariable<int32> CVarCookedDataCacheSize(
+	TEXT("p.CookedDataCacheSize"),
+	4096,
+	TEXT("Size in KB of the cache of the physics data cooked at runtime or in the editor, keyed by their source data.\n")
+	TEXT("Body setups with the same collision, e.g. the segments of a spline, are only cooked once. 0 disables the cache."),
+	ECVF_Default);
+
+/** Results of the recent cooks, keyed by a hash of their source data. Oldest entries are evicted first */
+class FPhysXCookedDataCache
+{
+public:
+	FPhysXCookedDataCache()
+		: TotalSize(0)
+	{
+	}
+
+	bool Find(const FSHAHash& Hash, TArray<uint8>& OutData)
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		const TArray<uint8>* Data = Entries.Find(Hash);
+		if (Data)
+		{
+			OutData = *Data;
+		}
+		return Data != NULL;
+	}
+
+	void Add(const FSHAHash& Hash, const TArray<uint8>& Data)
+	{
+		const int64 MaxSize = (int64)CVarCookedDataCacheSize.GetValueOnAnyThread() * 1024;
+
+		FScopeLock ScopeLock(&CriticalSection);
+		if (Data.Num() > MaxSize || Entries.Contains(Hash))
+		{
+			return;
+		}
+		while (TotalSize + Data.Num() > MaxSize)
+		{
+			TotalSize -= Entries.FindChecked(InsertionOrder[0]).Num();
+			Entries.Remove(InsertionOrder[0]);
+			InsertionOrder.RemoveAt(0);
+		}
+		Entries.Add(Hash, Data);
+		InsertionOrder.Add(Hash);
+		TotalSize += Data.Num();
+	}
+
+private:
+	FCriticalSection CriticalSection;
+	TMap<FSHAHash, TArray<uint8> > Entries;
+	TArray<FSHAHash> InsertionOrder;
+	int64 TotalSize;
+};
+
+static FPhysXCookedDataCache GPhysXCookedDataCache;
+
+/** The cooker is shared by the game thread and the async cooks */
+static FCriticalSection GPhysXCookCriticalSection;
+
 FDerivedDataPhysXCooker::FDerivedDataPhysXCooker( FName InFormat, UBodySetup* InBodySetup )
 	: BodySetup( InBodySetup )
 	, CollisionDataProvider( NULL )
 	, Format( InFormat )
 	, Cooker( NULL )
+	, bCookInputGathered( false )
+	, bCookConvex( false )
+	, bCookTriMesh( false )
+	, bCookMirroredTriMesh( false )
+	, bPerPolySkeletalMesh( false )
 {
 	check( BodySetup != NULL );
 	CollisionDataProvider = BodySetup->GetOuter();
@@ -43,10 +107,92 @@ void FDerivedDataPhysXCooker::InitCooker()
 #endif
 }
 
+void FDerivedDataPhysXCooker::GatherCookInput()
+{
+	check(Cooker != NULL);
+
+	SourcePathName = CollisionDataProvider->GetPathName();
+
+	// Cook convex meshes, but only if we are not forcing complex collision to be used as simple collision as well
+	if( BodySetup->CollisionTraceFlag != CTF_UseComplexAsSimple && BodySetup->AggGeom.ConvexElems.Num() > 0 )
+	{
+		bCookConvex = true;
+		ConvexVertices.Empty(BodySetup->AggGeom.ConvexElems.Num());
+		for( int32 ElementIndex = 0; ElementIndex < BodySetup->AggGeom.ConvexElems.Num(); ElementIndex++ )
+		{
+			ConvexVertices.Add(BodySetup->AggGeom.ConvexElems[ElementIndex].VertexData);
+		}
+	}
+
+	// Cook trimeshes, but only if we do not frce simple collision to be used as complex collision as well
+	const bool bUsingAllTriData = BodySetup->bMeshCollideAll;
+	if( BodySetup->CollisionTraceFlag != CTF_UseSimpleAsComplex && ShouldGenerateTriMeshData(bUsingAllTriData) )
+	{
+		bCookMirroredTriMesh = bGenerateMirroredMesh && ShouldGenerateNegXTriMeshData();
+		if( bGenerateNormalMesh || bCookMirroredTriMesh )
+		{
+			IInterface_CollisionDataProvider* CDP = Cast<IInterface_CollisionDataProvider>(CollisionDataProvider);
+			check(CDP != NULL); // It's all been checked by ShouldGenerateTriMeshData
+			bCookTriMesh = CDP->GetPhysicsTriMeshData(&TriMeshData, bUsingAllTriData);
+		}
+
+		if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(CollisionDataProvider))
+		{
+			ensure(SkeletalMesh->bEnablePerPolyCollision);
+			bPerPolySkeletalMesh = true;
+		}
+	}
+
+	bCookInputGathered = true;
+}
+
+FSHAHash FDerivedDataPhysXCooker::HashCookInput() const
+{
+	FSHA1 HashState;
+	const FString FormatString = Format.ToString();
+	HashState.UpdateWithString(*FormatString, FormatString.Len());
+
+	const uint16 CookerVersion = Cooker->GetVersion( Format );
+	const uint8 Flags[] = { bGenerateNormalMesh, bGenerateMirroredMesh, bCookConvex, bCookTriMesh, bCookMirroredTriMesh, bPerPolySkeletalMesh, (uint8)TriMeshData.bFlipNormals };
+	HashState.Update((const uint8*)&CookerVersion, sizeof(CookerVersion));
+	HashState.Update(Flags, sizeof(Flags));
+
+	// The element sizes go in too, so that moving vertices from one element to the next changes the hash
+	for( int32 ElementIndex = 0; ElementIndex < ConvexVertices.Num(); ElementIndex++ )
+	{
+		const int32 NumVertices = ConvexVertices[ElementIndex].Num();
+		HashState.Update((const uint8*)&NumVertices, sizeof(NumVertices));
+		HashState.Update((const uint8*)ConvexVertices[ElementIndex].GetData(), NumVertices * sizeof(FVector));
+	}
+
+	const int32 TriMeshSizes[] = { TriMeshData.Vertices.Num(), TriMeshData.Indices.Num(), TriMeshData.MaterialIndices.Num() };
+	HashState.Update((const uint8*)TriMeshSizes, sizeof(TriMeshSizes));
+	HashState.Update((const uint8*)TriMeshData.Vertices.GetData(), TriMeshData.Vertices.Num() * sizeof(FVector));
+	HashState.Update((const uint8*)TriMeshData.Indices.GetData(), TriMeshData.Indices.Num() * sizeof(FTriIndices));
+	HashState.Update((const uint8*)TriMeshData.MaterialIndices.GetData(), TriMeshData.MaterialIndices.Num() * sizeof(uint16));
+	HashState.Final();
+
+	FSHAHash Hash;
+	HashState.GetHash(Hash.Hash);
+	return Hash;
+}
+
 bool FDerivedDataPhysXCooker::Build( TArray<uint8>& OutData )
 {
 	check(Cooker != NULL);
 
+	if( !bCookInputGathered )
+	{
+		GatherCookInput();
+	}
+
+	// Body setups with the same source data, like spline segments sharing a mesh and a shape, cook to the same data
+	const FSHAHash CookInputHash = HashCookInput();
+	if( GPhysXCookedDataCache.Find(CookInputHash, OutData) )
+	{
+		return true;
+	}
+
 	FMemoryWriter Ar( OutData );
 	uint8 bLittleEndian = PLATFORM_LITTLE_ENDIAN;
 	int32 NumConvexElementsCooked = 0;
@@ -60,30 +206,31 @@ bool FDerivedDataPhysXCooker::Build( TArray<uint8>& OutData )
 	Ar << bTriMeshCooked;
 	Ar << bMirroredTriMeshCooked;
 
-	// Cook convex meshes, but only if we are not forcing complex collision to be used as simple collision as well
-	if( BodySetup && BodySetup->CollisionTraceFlag != CTF_UseComplexAsSimple && BodySetup->AggGeom.ConvexElems.Num() > 0 )
 	{
-		if( bGenerateNormalMesh )
-		{
-			NumConvexElementsCooked = BuildConvex( OutData, false );
-		}
-		if ( bGenerateMirroredMesh )
-		{
-			NumMirroredElementsCooked = BuildConvex( OutData, true );
-		}
-	}
+		FScopeLock ScopeLock(&GPhysXCookCriticalSection);
 
-	// Cook trimeshes, but only if we do not frce simple collision to be used as complex collision as well
-	bool bUsingAllTriData = BodySetup != NULL ? BodySetup->bMeshCollideAll : false;
-	if( (BodySetup == NULL || BodySetup->CollisionTraceFlag != CTF_UseSimpleAsComplex) && ShouldGenerateTriMeshData(bUsingAllTriData) )
-	{
-		if( bGenerateNormalMesh )
+		if( bCookConvex )
 		{
-			bTriMeshCooked = (uint8)BuildTriMesh( OutData, false, bUsingAllTriData );
+			if( bGenerateNormalMesh )
+			{
+				NumConvexElementsCooked = BuildConvex( OutData, false );
+			}
+			if ( bGenerateMirroredMesh )
+			{
+				NumMirroredElementsCooked = BuildConvex( OutData, true );
+			}
 		}
-		if( bGenerateMirroredMesh && ShouldGenerateNegXTriMeshData() )
+
+		if( bCookTriMesh )
 		{
-			bMirroredTriMeshCooked = (uint8)BuildTriMesh( OutData, true, bUsingAllTriData );
+			if( bGenerateNormalMesh )
+			{
+				bTriMeshCooked = (uint8)BuildTriMesh( OutData, false );
+			}
+			if( bCookMirroredTriMesh )
+			{
+				bMirroredTriMeshCooked = (uint8)BuildTriMesh( OutData, true );
+			}
 		}
 	}
 
@@ -94,47 +241,48 @@ bool FDerivedDataPhysXCooker::Build( TArray<uint8>& OutData )
 	Ar << bTriMeshCooked;
 	Ar << bMirroredTriMeshCooked;
 
+	GPhysXCookedDataCache.Add(CookInputHash, OutData);
+
 	// Whatever got cached return true. We want to cache 'failure' too.
 	return true;
 }
 
 int32 FDerivedDataPhysXCooker::BuildConvex( TArray<uint8>& OutData, bool InMirrored )
 {	
-	check( BodySetup != NULL );
-	for( int32 ElementIndex = 0; ElementIndex < BodySetup->AggGeom.ConvexElems.Num(); ElementIndex++ )
+	for( int32 ElementIndex = 0; ElementIndex < ConvexVertices.Num(); ElementIndex++ )
 	{
 		const TArray<FVector>* MeshVertices = NULL;
 		TArray<FVector> MirroredVerts;
-		const FKConvexElem& ConvexElem = BodySetup->AggGeom.ConvexElems[ElementIndex];
+		const TArray<FVector>& VertexData = ConvexVertices[ElementIndex];
 
 		if( InMirrored )
 		{
-			MirroredVerts.AddUninitialized(ConvexElem.VertexData.Num());
-			for(int32 VertIdx=0; VertIdx<ConvexElem.VertexData.Num(); VertIdx++)
+			MirroredVerts.AddUninitialized(VertexData.Num());
+			for(int32 VertIdx=0; VertIdx<VertexData.Num(); VertIdx++)
 			{
-				MirroredVerts[VertIdx] = ConvexElem.VertexData[VertIdx] * FVector(-1,1,1);
+				MirroredVerts[VertIdx] = VertexData[VertIdx] * FVector(-1,1,1);
 			}
 			MeshVertices = &MirroredVerts;
 		}
 		else
 		{
-			MeshVertices = &ConvexElem.VertexData;
+			MeshVertices = &VertexData;
 		}
 
 		// Store info on the cooking result (1 byte)
 		int32 ResultInfoOffset = OutData.Add( false );
 
 		// Cook and store Result at ResultInfoOffset
-		UE_LOG(LogPhysics, Log, TEXT("Cook Convex: %s %d (FlipX:%d)"), *BodySetup->GetOuter()->GetPathName(), ElementIndex, InMirrored);		
+		UE_LOG(LogPhysics, Log, TEXT("Cook Convex: %s %d (FlipX:%d)"), *SourcePathName, ElementIndex, InMirrored);		
 		bool Result = Cooker->CookConvex( Format, *MeshVertices, OutData );
 		if( !Result )
 		{
-			UE_LOG(LogPhysics, Warning, TEXT("Failed to cook convex: %s %d (FlipX:%d). The remaining elements will not get cooked."), *BodySetup->GetOuter()->GetPathName(), ElementIndex, InMirrored);
+			UE_LOG(LogPhysics, Warning, TEXT("Failed to cook convex: %s %d (FlipX:%d). The remaining elements will not get cooked."), *SourcePathName, ElementIndex, InMirrored);
 		}
 		OutData[ ResultInfoOffset ] = Result;
 	}
 
-	return BodySetup->AggGeom.ConvexElems.Num();
+	return ConvexVertices.Num();
 }
 
 bool FDerivedDataPhysXCooker::ShouldGenerateTriMeshData(bool InUseAllTriData)
@@ -154,57 +302,44 @@ bool FDerivedDataPhysXCooker::ShouldGenerateNegXTriMeshData()
 }
 
 
-bool FDerivedDataPhysXCooker::BuildTriMesh( TArray<uint8>& OutData, bool bInMirrored, bool InUseAllTriData )
+bool FDerivedDataPhysXCooker::BuildTriMesh( TArray<uint8>& OutData, bool bInMirrored )
 {
 	check(Cooker != NULL);
 
 	bool bResult = false;
-	FTriMeshCollisionData TriangleMeshDesc;
-	IInterface_CollisionDataProvider* CDP = Cast<IInterface_CollisionDataProvider>(CollisionDataProvider);
-	check(CDP != NULL); // It's all been checked before getting into this function
-		
-	bool bHaveTriMeshData = CDP->GetPhysicsTriMeshData(&TriangleMeshDesc, InUseAllTriData);
-	if(bHaveTriMeshData)
-	{
-		// If any of the below checks gets hit this usually means 
-		// IInterface_CollisionDataProvider::ContainsPhysicsTriMeshData did not work properly.
-		const int32 NumIndices = TriangleMeshDesc.Indices.Num();
-		const int32 NumVerts = TriangleMeshDesc.Vertices.Num();
-		if(NumIndices == 0 || NumVerts == 0 || TriangleMeshDesc.MaterialIndices.Num() > NumIndices)
-		{
-			UE_LOG(LogPhysics, Warning, TEXT("FDerivedDataPhysXCooker::BuildTriMesh: Triangle data from '%s' invalid (%d verts, %d indices)."), *CollisionDataProvider->GetPathName(), NumVerts, NumIndices );
-			return bResult;
-		}
 
-		TArray<FVector>* MeshVertices = NULL;
-		TArray<FVector> MirroredVerts;
+	// If any of the below checks gets hit this usually means 
+	// IInterface_CollisionDataProvider::ContainsPhysicsTriMeshData did not work properly.
+	const int32 NumIndices = TriMeshData.Indices.Num();
+	const int32 NumVerts = TriMeshData.Vertices.Num();
+	if(NumIndices == 0 || NumVerts == 0 || TriMeshData.MaterialIndices.Num() > NumIndices)
+	{
+		UE_LOG(LogPhysics, Warning, TEXT("FDerivedDataPhysXCooker::BuildTriMesh: Triangle data from '%s' invalid (%d verts, %d indices)."), *SourcePathName, NumVerts, NumIndices );
+		return bResult;
+	}
 
-		if( bInMirrored )
-		{
-			MirroredVerts.AddUninitialized(NumVerts);
-			for(int32 VertIdx=0; VertIdx<NumVerts; VertIdx++)
-			{
-				MirroredVerts[VertIdx] = TriangleMeshDesc.Vertices[VertIdx] * FVector(-1,1,1);
-			}
-			MeshVertices = &MirroredVerts;
-		}
-		else
-		{
-			MeshVertices = &TriangleMeshDesc.Vertices;
-		}
+	const TArray<FVector>* MeshVertices = NULL;
+	TArray<FVector> MirroredVerts;
 
-		UE_LOG(LogPhysics, Log, TEXT("Cook TriMesh: %s (FlipX: %d)"), *CollisionDataProvider->GetPathName(), bInMirrored);
-		bool bPerPolySkeletalMesh = false;
-		if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(CollisionDataProvider))
-		{
-			ensure(SkeletalMesh->bEnablePerPolyCollision);
-			bPerPolySkeletalMesh = true;
-		}
-		bResult = Cooker->CookTriMesh( Format, *MeshVertices, TriangleMeshDesc.Indices, TriangleMeshDesc.MaterialIndices, bInMirrored ? !TriangleMeshDesc.bFlipNormals : TriangleMeshDesc.bFlipNormals, OutData, bPerPolySkeletalMesh );
-		if( !bResult )
+	if( bInMirrored )
+	{
+		MirroredVerts.AddUninitialized(NumVerts);
+		for(int32 VertIdx=0; VertIdx<NumVerts; VertIdx++)
 		{
-			UE_LOG(LogPhysics, Warning, TEXT("Failed to cook TriMesh: %s (FlipX:%d)."), *CollisionDataProvider->GetPathName(), bInMirrored );
+			MirroredVerts[VertIdx] = TriMeshData.Vertices[VertIdx] * FVector(-1,1,1);
 		}
+		MeshVertices = &MirroredVerts;
+	}
+	else
+	{
+		MeshVertices = &TriMeshData.Vertices;
+	}
+
+	UE_LOG(LogPhysics, Log, TEXT("Cook TriMesh: %s (FlipX: %d)"), *SourcePathName, bInMirrored);
+	bResult = Cooker->CookTriMesh( Format, *MeshVertices, TriMeshData.Indices, TriMeshData.MaterialIndices, bInMirrored ? !TriMeshData.bFlipNormals : TriMeshData.bFlipNormals, OutData, bPerPolySkeletalMesh );
+	if( !bResult )
+	{
+		UE_LOG(LogPhysics, Warning, TEXT("Failed to cook TriMesh: %s (FlipX:%d)."), *SourcePathName, bInMirrored );
 	}
 
 	return bResult;
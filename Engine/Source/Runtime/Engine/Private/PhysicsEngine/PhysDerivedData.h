@@ -25,6 +25,16 @@ private:
 	FGuid DataGuid;
 	FString MeshId;
 
+	/** Whether the source data below was copied from the body setup, after which the cook doesn't touch the body setup or its outer */
+	bool bCookInputGathered;
+	bool bCookConvex;
+	bool bCookTriMesh;
+	bool bCookMirroredTriMesh;
+	bool bPerPolySkeletalMesh;
+	TArray< TArray<FVector> > ConvexVertices;
+	FTriMeshCollisionData TriMeshData;
+	FString SourcePathName;
+
 public:
 	FDerivedDataPhysXCooker( FName InFormat, UBodySetup* InBodySetup );
 
@@ -67,7 +77,7 @@ public:
 
 	virtual bool IsBuildThreadsafe() const override
 	{
-		return false;
+		return bCookInputGathered;
 	}
 
 	virtual bool Build( TArray<uint8>& OutData ) override;
@@ -77,13 +87,56 @@ public:
 	{
 		return !!Cooker;
 	}
+
+	/** Copies the source data of the cook from the body setup. Must be called on the game thread, Build does it if it wasn't done before */
+	void GatherCookInput();
+
 private:
 
 	void InitCooker();
 	int32 BuildConvex( TArray<uint8>& OutData, bool InMirrored );
-	bool BuildTriMesh( TArray<uint8>& OutData, bool InMirrored, bool InUseAllTriData );
+	bool BuildTriMesh( TArray<uint8>& OutData, bool InMirrored );
 	bool ShouldGenerateTriMeshData(bool InUseAllTriData);
 	bool ShouldGenerateNegXTriMeshData();
+	FSHAHash HashCookInput() const;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Async cook of a body setup, see UBodySetup::BeginAsyncCook
+class FPhysXCookAsyncTask : public FNonAbandonableTask
+{
+public:
+	/** Takes ownership of the cooker, which must have gathered its input */
+	FPhysXCookAsyncTask( FDerivedDataPhysXCooker* InDerivedPhysXData, FName InFormat, const FGuid& InDataGuid )
+		: DerivedPhysXData( InDerivedPhysXData )
+		, Format( InFormat )
+		, DataGuid( InDataGuid )
+	{
+	}
+
+	void DoWork()
+	{
+	#if WITH_EDITOR
+		GetDerivedDataCacheRef().GetSynchronous(DerivedPhysXData, OutData);
+	#else
+		DerivedPhysXData->Build(OutData);
+		delete DerivedPhysXData;
+	#endif
+		DerivedPhysXData = NULL;
+	}
+
+	static const TCHAR* Name()
+	{
+		return TEXT("FPhysXCookAsyncTask");
+	}
+
+	FDerivedDataPhysXCooker* DerivedPhysXData;
+
+	/** Format and body setup guid the data is cooked for, the body setup may have been invalidated by the time the task is done */
+	FName Format;
+	FGuid DataGuid;
+
+	TArray<uint8> OutData;
 };
 
 #endif	//WITH_PHYSX && WITH_EDITOR
\ No newline at end of file
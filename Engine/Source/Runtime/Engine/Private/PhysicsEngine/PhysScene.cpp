@@ -116,6 +116,7 @@ FPhysScene::FPhysScene()
 
 		// Also initialize scene data
 		bPhysXSceneExecuting[SceneType] = false;
+		bPhysXSceneSimulating[SceneType] = false;
 
 		// Initialize to a value which would be acceptable if FrameTimeSmoothingFactor[i] = 1.0f, i.e. constant simulation substeps
 		AveragedFrameTime[SceneType] = InitialAverageFrameRate;
@@ -601,6 +602,7 @@ void FPhysScene::TickPhysScene(uint32 SceneType, FGraphEventRef& InOutCompletion
 	}
 #endif	//	#if !WITH_APEX
 #endif // WITH_PHYSX
+	bPhysXSceneSimulating[SceneType] = bTaskOutstanding;
 	if (!bTaskOutstanding)
 	{
 		InOutCompletionEvent->DispatchSubsequents(); // nothing to do, so nothing to wait for
@@ -692,7 +694,18 @@ void FPhysScene::ProcessPhysScene(uint32 SceneType)
 	check(PScene);
 	PxU32 OutErrorCode = 0;
 
+	// Fixed delta time substepping can have no substep to run this frame. The active bodies of the last step are kept, so they keep being interpolated
+	if (!bPhysXSceneSimulating[SceneType])
+	{
+		PhysicsSubsceneCompletion[SceneType] = NULL;
+		bPhysXSceneExecuting[SceneType] = false;
+		return;
+	}
+
+	// Wait for the simulation to finish before taking the write lock, fetchResults is then only swapping the results in.
+	// This way the scene can be queried until the very end of the simulation, queries never wait on it.
 #if !WITH_APEX
+	PScene->checkResults(true);
 	PScene->lockWrite();
 	PScene->fetchResults(true, &OutErrorCode);
 	PScene->unlockWrite();
@@ -700,6 +713,7 @@ void FPhysScene::ProcessPhysScene(uint32 SceneType)
 	// The APEX scene calls the fetchResults function for the PhysX scene, so we only call ApexScene->fetchResults().
 	NxApexScene* ApexScene = GetApexScene(SceneType);
 	check(ApexScene);
+	ApexScene->checkResults(true);
 	ApexScene->fetchResults(true, &OutErrorCode);
 #endif	//	#if !WITH_APEX
 
@@ -722,7 +736,8 @@ void FPhysScene::UpdateActiveTransforms(uint32 SceneType)
 	}
 	PxScene* PScene = GetPhysXScene(SceneType);
 	check(PScene);
-	SCOPED_SCENE_WRITE_LOCK(PScene);
+	// Only reading the results, so traces can go on while the list is built
+	SCOPED_SCENE_READ_LOCK(PScene);
 
 	PxU32 NumTransforms = 0;
 	const PxActiveTransform* PActiveTransforms = PScene->getActiveTransforms(NumTransforms);
@@ -767,7 +782,13 @@ void FPhysScene::SyncComponentsToBodies(uint32 SceneType)
 		AActor* Owner = BodyInstance->OwnerComponent->GetOwner();
 
 		// See if the transform is actually different, and if so, move the component to match physics
-		const FTransform NewTransform = BodyInstance->GetUnrealWorldTransform();
+		FTransform NewTransform = BodyInstance->GetUnrealWorldTransform();
+#if WITH_SUBSTEPPING
+		if (IsSubstepping(SceneType))
+		{
+			PhysSubSteppers[SceneType]->InterpolateTransform(BodyInstance, NewTransform);
+		}
+#endif
 		if (!NewTransform.EqualsNoScale(BodyInstance->OwnerComponent->ComponentToWorld))
 		{
 			const FVector MoveBy = NewTransform.GetLocation() - BodyInstance->OwnerComponent->ComponentToWorld.GetLocation();
@@ -24,6 +24,8 @@ FPhysSubstepTask::FPhysSubstepTask(PxApexScene * GivenScene) :
 	StepScale(0.f),
 	TotalSubTime(0.f),
 	CurrentSubStep(0),
+	bFixedDeltaTime(false),
+	AccumulatedTime(0.f),
 	VehicleManager(NULL),
 	PAScene(GivenScene)
 {
@@ -46,6 +48,8 @@ void FPhysSubstepTask::RemoveBodyInstance(FBodyInstance* BodyInstance)
 	//This is the same lock that we use when iterating over the internal buffer - so it's safe to modify this buffer from this thread.
 	//If this assumption changes you need to take care of accessing the buffer from both threads
 	PhysTargetBuffers[!External].Remove(BodyInstance);
+
+	PreviousTransforms.Remove(BodyInstance);
 }
 
 void FPhysSubstepTask::SetKinematicTarget(FBodyInstance* Body, const FTransform& TM)
@@ -285,6 +289,53 @@ void FPhysSubstepTask::SubstepInterpolation(float InAlpha, float DeltaTime)
 #endif
 }
 
+void FPhysSubstepTask::SavePreviousTransforms()
+{
+#if WITH_PHYSX
+#if WITH_APEX
+	PxScene * PScene = PAScene->getPhysXScene();
+#else
+	PxScene * PScene = PAScene;
+#endif
+
+	PreviousTransforms.Reset();
+
+	SCOPED_SCENE_READ_LOCK(PScene);
+
+	TArray<PxActor*> PActors;
+	PActors.AddUninitialized(PScene->getNbActors(PxActorTypeSelectionFlag::eRIGID_DYNAMIC));
+	PScene->getActors(PxActorTypeSelectionFlag::eRIGID_DYNAMIC, PActors.GetData(), PActors.Num());
+
+	for (PxActor* PActor : PActors)
+	{
+		PxRigidDynamic* PRigidDynamic = PActor->isRigidDynamic();
+		if (PRigidDynamic->isSleeping() || !IsRigidBodyNonKinematic(PRigidDynamic))
+		{
+			continue;
+		}
+
+		if (const FBodyInstance* BodyInstance = FPhysxUserData::Get<FBodyInstance>(PRigidDynamic->userData))
+		{
+			PreviousTransforms.Add(BodyInstance, P2UTransform(PRigidDynamic->getGlobalPose()));
+		}
+	}
+#endif
+}
+
+void FPhysSubstepTask::InterpolateTransform(const FBodyInstance* Body, FTransform& InOutTM) const
+{
+	if (!bFixedDeltaTime)
+	{
+		return;
+	}
+
+	if (const FTransform* PreviousTM = PreviousTransforms.Find(Body))
+	{
+		const FTransform CurrentTM = InOutTM;
+		InOutTM.Blend(*PreviousTM, CurrentTM, AccumulatedTime / SubTime);
+	}
+}
+
 float FPhysSubstepTask::UpdateTime(float UseDelta)
 {
 	float FrameRate = 1.f;
@@ -296,6 +347,21 @@ float FPhysSubstepTask::UpdateTime(float UseDelta)
 	
 	float FrameRateInv = 1.f / FrameRate;
 
+	bFixedDeltaTime = PhysSetting->bFixedSubstepDeltaTime;
+	if (bFixedDeltaTime)
+	{
+		// Only whole substeps are simulated, the rest is carried over to the next frame. A frame can have no substep at all
+		AccumulatedTime += UseDelta;
+		NumSubsteps = FMath::Min(FMath::FloorToInt(AccumulatedTime * FrameRateInv), (int32)MaxSubSteps);
+		SubTime = FrameRate;
+		DeltaSeconds = NumSubsteps * SubTime;
+
+		// Time that can't be caught up with MaxSubSteps is dropped, the simulation slows down instead of falling further behind
+		AccumulatedTime = FMath::Min(AccumulatedTime - DeltaSeconds, SubTime);
+
+		return NumSubsteps > 0 ? SubTime : 0.f;
+	}
+
 	//Figure out how big dt to make for desired framerate
 	DeltaSeconds = FMath::Min(UseDelta, MaxSubSteps * FrameRate);
 	NumSubsteps = FMath::CeilToInt(DeltaSeconds * FrameRateInv);
@@ -356,9 +422,15 @@ void FPhysSubstepTask::SubstepSimulationStart()
 		TotalSubTime += SubTime;
 	}
 
-	float DeltaTime = bLastSubstep ? (DeltaSeconds - TotalSubTime) : SubTime;
+	// Fixed substeps always use SubTime exactly, so the same inputs simulate the same way whatever the frame rate
+	float DeltaTime = (bLastSubstep && !bFixedDeltaTime) ? (DeltaSeconds - TotalSubTime) : SubTime;
 	float Interpolation = bLastSubstep ? 1.f : Alpha;
 
+	if (bLastSubstep && bFixedDeltaTime)
+	{
+		SavePreviousTransforms();
+	}
+
 #if WITH_VEHICLE
 	if (VehicleManager)
 	{
@@ -390,6 +462,8 @@ void FPhysSubstepTask::SubstepSimulationEnd(ENamedThreads::Type CurrentThread, c
 			SCOPE_CYCLE_COUNTER(STAT_TotalPhysicsTime);
 			SCOPE_CYCLE_COUNTER(STAT_SubstepSimulationEnd);
 
+			// Wait outside of the write lock, so the scene can be queried while the substep finishes
+			PAScene->checkResults(true);
 #if WITH_APEX
 			PAScene->fetchResults(true, &OutErrorCode);
 #else
@@ -126,6 +126,9 @@ public:
 	void SwapBuffers();
 	float UpdateTime(float UseDelta);
 
+	/** With fixed delta time substeps, moves a body's transform back between the two last simulated steps, by the time carried over to the next frame */
+	void InterpolateTransform(const FBodyInstance* Body, FTransform& InOutTM) const;
+
 	void SetVehicleManager(class FPhysXVehicleManager *	InVehicleManager);
 	void SubstepSimulationStart();
 	void SubstepSimulationEnd(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent);
@@ -142,6 +145,9 @@ private:
 	void ApplyTorques(const FPhysTarget& PhysTarget, FBodyInstance* BodyInstance);
 	void InterpolateKinematicActor(const FPhysTarget& PhysTarget, FBodyInstance* BodyInstance, float Alpha);
 
+	/** Saves the transforms of the awake bodies before the last substep, for InterpolateTransform */
+	void SavePreviousTransforms();
+
 	typedef TMap<FBodyInstance*, FPhysTarget> PhysTargetMap;
 	PhysTargetMap PhysTargetBuffers[2];	//need to double buffer between physics thread and game thread
 	uint32 NumSubsteps;
@@ -155,6 +161,13 @@ private:
 	uint32 CurrentSubStep;
 	FGraphEventRef CompletionEvent;
 
+	/** Whether the substeps of this frame are all SubTime long, see UPhysicsSettings::bFixedSubstepDeltaTime */
+	bool bFixedDeltaTime;
+	/** Time not simulated yet with fixed delta time substeps, always less than a substep */
+	float AccumulatedTime;
+	/** Transforms of the bodies before the last substep, with fixed delta time substeps */
+	TMap<const FBodyInstance*, FTransform> PreviousTransforms;
+
 	/** Vehicle scene */
 	class FPhysXVehicleManager*			VehicleManager;
 
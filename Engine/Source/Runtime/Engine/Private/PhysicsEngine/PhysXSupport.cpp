@@ -573,7 +573,7 @@ public:
 	}
 	static ENamedThreads::Type GetDesiredThread()
 	{
-		return ENamedThreads::AnyThread;
+		return ENamedThreads::AnyHiPriThread; // the game thread waits on it this frame
 	}
 	static ESubsequentsMode::Type GetSubsequentsMode() 
 	{ 
@@ -20,6 +20,7 @@ UPhysicsSettings::UPhysicsSettings(const FObjectInitializer& ObjectInitializer)
 	, bSubsteppingAsync(false)
 	, MaxSubstepDeltaTime(1.f / 60.f)
 	, MaxSubsteps(6)
+	, bFixedSubstepDeltaTime(false)
 	, SyncSceneSmoothingFactor(0.0f)
 	, AsyncSceneSmoothingFactor(0.99f)
 	, InitialAverageFrameRate(1.f / 60.f)
@@ -12,6 +12,10 @@
 
 static TAutoConsoleVariable<int32> CVarAllowPropertySkipping( TEXT( "net.AllowPropertySkipping" ), 1, TEXT( "Allow skipping of properties that haven't changed for other clients" ) );
 
+static TAutoConsoleVariable<int32> CVarShareChangelists( TEXT( "net.ShareChangelists" ), 0, TEXT( "Diff replicated properties once per frame for all connections, and share the resulting change lists" ) );
+
+static TAutoConsoleVariable<int32> CVarRepMovementDelta( TEXT( "net.RepMovementDelta" ), 1, TEXT( "Send replicated movement as a delta from the last value acked by the connection" ) );
+
 static TAutoConsoleVariable<int32> CVarDoPropertyChecksum( TEXT( "net.DoPropertyChecksum" ), 0, TEXT( "" ) );
 
 FAutoConsoleVariable CVarDoReplicationContextString( TEXT( "net.ContextDebug" ), 0, TEXT( "" ) );
@@ -604,6 +608,9 @@ bool FRepLayout::ReplicateProperties(
 	FRepChangedPropertyTracker *	ChangeTracker	= RepState->RepChangedPropertyTracker.Get();
 	const uint8 *					CompareData		= RepState->StaticBuffer.GetData();
 
+	// The tracker is shared by every connection replicating this object, it is locked until the change list is built
+	FNetParallelReplicationScopeLock TrackerLock( NetDriver, ChangeTracker->CompareCS );
+
 	// Rebuild conditional properties if needed
 	if ( RepState->RepFlags.Value != RepFlags.Value || RepState->ActiveStatusChanged != ChangeTracker->ActiveStatusChanged )
 	{
@@ -615,20 +622,46 @@ bool FRepLayout::ReplicateProperties(
 
 	bool PropertyChanged = false;
 
+	// Unconditional properties that changed since the last time, when the change lists are shared
+	TArray< uint16 > SharedChanged;
+
 #ifdef ENABLE_SUPER_CHECKSUMS
 	const bool bIsAllAcked = AllAcked( RepState );
 
 	if ( bIsAllAcked || !RepState->OpenAckedCalled )
 #endif
 	{
-		const int32	AllowSkipping = CVarAllowPropertySkipping.GetValueOnGameThread();
+		const int32	AllowSkipping = CVarAllowPropertySkipping.GetValueOnAnyThread();
+		const bool	bShareChangelists = CVarShareChangelists.GetValueOnAnyThread() > 0;
 		
 		const bool bCanSkip =	AllowSkipping > 0 && 
 								RepState->LastReplicationFrame != 0 &&
 								ChangeTracker->LastReplicationFrame == NetDriver->ReplicationFrame &&
 								ChangeTracker->LastReplicationGroupFrame == RepState->LastReplicationFrame;
 
-		if ( bCanSkip )
+		if ( bShareChangelists )
+		{
+			// Drop what the per connection compare left behind, and make sure it compares again if the mode is switched back
+			if ( ChangeTracker->UnconditionalPropChanged )
+			{
+				for ( int32 i = UnconditionalLifetime.Num() - 1; i >= 0; i-- )
+				{
+					ChangeTracker->Parents[UnconditionalLifetime[i]].Changed.Empty();
+				}
+				ChangeTracker->UnconditionalPropChanged = false;
+			}
+			ChangeTracker->LastReplicationFrame = 0;
+
+			// The unconditional properties are diffed once per frame for all connections, this one just picks up what it hasn't seen yet
+			UpdateSharedChangelist( ChangeTracker, RepState, ObjectClass, Data, NetDriver->ReplicationFrame );
+			GatherSharedChanges( ChangeTracker, RepState, CompareData, Data, SharedChanged );
+
+			if ( SharedChanged.Num() > 0 )
+			{
+				PropertyChanged = true;
+			}
+		}
+		else if ( bCanSkip )
 		{
 			INC_DWORD_STAT_BY( STAT_NetSkippedDynamicProps, UnconditionalLifetime.Num() );
 
@@ -722,11 +755,20 @@ bool FRepLayout::ReplicateProperties(
 
 			Changed.Add( 0 );
 
+			if ( SharedChanged.Num() > 0 )
+			{
+				TArray< uint16 > Temp = Changed;
+				Changed.Empty();
+				MergeDirtyList( RepState, (void*)Data, Temp, SharedChanged, Changed );
+			}
+
 #ifdef SANITY_CHECK_MERGES
 			SanityCheckChangeList( Data, Changed );
 #endif
 		}
 
+		TrackerLock.Unlock();
+
 		// Update the history, and merge in any nak'd change lists
 		UpdateChangelistHistory( RepState, ObjectClass, Data, OwningChannel->Connection->OutAckPacketId, &Changed );
 
@@ -838,6 +880,96 @@ void FRepLayout::UpdateChangelistHistory( FRepState * RepState, UClass * ObjectC
 	check( RepState->NumNaks == 0 );	// Make sure we processed all the naks properly
 }
 
+void FRepLayout::UpdateSharedChangelist( FRepChangedPropertyTracker * ChangeTracker, FRepState * RepState, UClass * ObjectClass, const uint8* RESTRICT Data, const uint32 ReplicationFrame ) const
+{
+	FRepState * SharedState = ChangeTracker->SharedShadowState;
+
+	if ( SharedState == NULL )
+	{
+		// Start from the current state, each connection catches up with its own shadow state the first time
+		SharedState = ChangeTracker->SharedShadowState = new FRepState();
+		SharedState->RepLayout = RepState->RepLayout;
+		SharedState->StaticBuffer.AddZeroed( ObjectClass->GetDefaultsCount() );
+		ConstructProperties( SharedState );
+		InitProperties( SharedState, (uint8*)Data );
+		ChangeTracker->LastSharedCompareFrame = ReplicationFrame;
+		return;
+	}
+
+	if ( ChangeTracker->LastSharedCompareFrame == ReplicationFrame )
+	{
+		return;		// Another connection already did the diff this frame
+	}
+
+	ChangeTracker->LastSharedCompareFrame = ReplicationFrame;
+
+	// The unconditional change lists of the tracker aren't used by the connections in this mode, so they're free to use here
+	if ( !CompareProperties( SharedState, SharedState->StaticBuffer.GetData(), Data, ChangeTracker->Parents, UnconditionalLifetime ) )
+	{
+		return;
+	}
+
+	TArray< uint16 > & Changed = ChangeTracker->SharedHistory[ ChangeTracker->SharedHistoryEnd % FRepChangedPropertyTracker::MAX_SHARED_HISTORY ];
+	Changed.Empty();
+
+	uint8* ShadowData = SharedState->StaticBuffer.GetData();
+
+	// In the order of the parents so that the change list is sorted
+	for ( int32 i = 0; i < Parents.Num(); i++ )
+	{
+		TArray< uint16 > & ParentChanged = ChangeTracker->Parents[i].Changed;
+
+		if ( ParentChanged.Num() > 0 && !( Parents[i].Flags & PARENT_IsConditional ) )
+		{
+			Changed.Append( ParentChanged );
+			ParentChanged.Empty();
+
+			// Bring the shared shadow state up to date for this property
+			const PTRINT Offset = Parents[i].Property->ContainerPtrToValuePtr<uint8>( ShadowData, Parents[i].ArrayIndex ) - ShadowData;
+			Parents[i].Property->CopySingleValue( ShadowData + Offset, Data + Offset );
+		}
+	}
+
+	Changed.Add( 0 );
+
+	ChangeTracker->SharedHistoryEnd++;
+}
+
+void FRepLayout::GatherSharedChanges( FRepChangedPropertyTracker * ChangeTracker, FRepState * RepState, const uint8* RESTRICT CompareData, const uint8* RESTRICT Data, TArray< uint16 > & OutChanged ) const
+{
+	check( OutChanged.Num() == 0 );
+
+	if ( RepState->LastSharedChangelist == INDEX_NONE || ChangeTracker->SharedHistoryEnd - RepState->LastSharedChangelist > FRepChangedPropertyTracker::MAX_SHARED_HISTORY )
+	{
+		// First replication of this connection, or it missed more change lists than we keep: diff against its own shadow state
+		TArray< FRepChangedParent > ChangedParents;
+		ChangedParents.SetNum( Parents.Num() );
+
+		if ( CompareProperties( RepState, CompareData, Data, ChangedParents, UnconditionalLifetime ) )
+		{
+			for ( int32 i = 0; i < ChangedParents.Num(); i++ )
+			{
+				OutChanged.Append( ChangedParents[i].Changed );
+			}
+
+			OutChanged.Add( 0 );
+		}
+	}
+	else
+	{
+		// Merge the change lists made since the last time this connection replicated
+		for ( int32 i = RepState->LastSharedChangelist; i < ChangeTracker->SharedHistoryEnd; i++ )
+		{
+			const TArray< uint16 > & HistoryChanged = ChangeTracker->SharedHistory[ i % FRepChangedPropertyTracker::MAX_SHARED_HISTORY ];
+
+			TArray< uint16 > Temp = OutChanged;
+			MergeDirtyList( RepState, (void*)Data, Temp, HistoryChanged, OutChanged );
+		}
+	}
+
+	RepState->LastSharedChangelist = ChangeTracker->SharedHistoryEnd;
+}
+
 void FRepLayout::OpenAcked( FRepState * RepState ) const
 {
 	check( RepState != NULL );
@@ -865,6 +997,21 @@ void FRepLayout::PostReplicate( FRepState * RepState, FPacketIdRange & PacketRan
 			}
 		}
 	}
+
+	for ( auto It = RepState->MovementHistories.CreateIterator(); It; ++It )
+	{
+		FRepMovementHistory & History = It.Value();
+
+		for ( int32 i = 0; i < FRepMovementHistory::MAX_HISTORY; i++ )
+		{
+			FRepMovementBaseline & Baseline = History.Baselines[i];
+
+			if ( Baseline.bValid && Baseline.OutPacketIdRange.First == INDEX_NONE )
+			{
+				Baseline.OutPacketIdRange = PacketRange;
+			}
+		}
+	}
 }
 
 void FRepLayout::ReceivedNak( FRepState * RepState, int32 NakPacketId ) const
@@ -887,6 +1034,22 @@ void FRepLayout::ReceivedNak( FRepState * RepState, int32 NakPacketId ) const
 			RepState->NumNaks++;
 		}
 	}
+
+	for ( auto It = RepState->MovementHistories.CreateIterator(); It; ++It )
+	{
+		FRepMovementHistory & History = It.Value();
+
+		for ( int32 i = 0; i < FRepMovementHistory::MAX_HISTORY; i++ )
+		{
+			FRepMovementBaseline & Baseline = History.Baselines[i];
+
+			if ( Baseline.bCanBeBase && Baseline.OutPacketIdRange.InRange( NakPacketId ) )
+			{
+				// The other end never got it
+				Baseline.bCanBeBase = false;
+			}
+		}
+	}
 }
 
 bool FRepLayout::AllAcked( FRepState * RepState ) const
@@ -1002,6 +1165,278 @@ void FRepLayout::SendProperties_DynamicArray_r(
 	WritePropertyHandle( WriterState.Writer, 0, WriterState.bDoChecksum );		// Signify end of dynamic array
 }
 
+/** Quantized values are clamped so the difference of two of them always fits in 30 bits */
+static const int32 MaxQuantizedMovementValue = ( 1 << 29 ) - 1;
+
+static void QuantizeMovementVector( const FVector& Vector, EVectorQuantization QuantizationLevel, int32 Out[3] )
+{
+	const int32 Scale = FRepMovement::GetQuantizationScale( QuantizationLevel );
+	const bool bValid = !Vector.ContainsNaN();
+
+	for ( int32 i = 0; i < 3; i++ )
+	{
+		Out[i] = bValid ? FMath::Clamp( FMath::RoundToInt( Vector[i] * Scale ), -MaxQuantizedMovementValue, MaxQuantizedMovementValue ) : 0;
+	}
+}
+
+static FVector DequantizeMovementVector( const int32 Value[3], EVectorQuantization QuantizationLevel )
+{
+	const float Scale = FRepMovement::GetQuantizationScale( QuantizationLevel );
+	return FVector( Value[0] / Scale, Value[1] / Scale, Value[2] / Scale );
+}
+
+static void QuantizeRepMovement( const FRepMovement& Movement, FRepMovementBaseline& Out )
+{
+	QuantizeMovementVector( Movement.Location, Movement.LocationQuantizationLevel, Out.Location );
+	QuantizeMovementVector( Movement.LinearVelocity, Movement.VelocityQuantizationLevel, Out.LinearVelocity );
+
+	if ( Movement.bRepPhysics )
+	{
+		QuantizeMovementVector( Movement.AngularVelocity, Movement.VelocityQuantizationLevel, Out.AngularVelocity );
+	}
+	else
+	{
+		// Not sent, so the receiver can't know it
+		FMemory::Memzero( Out.AngularVelocity, sizeof( Out.AngularVelocity ) );
+	}
+
+	const bool bByteComponents = Movement.RotationQuantizationLevel == ERotatorQuantization::ByteComponents;
+	const float Angles[3] = { Movement.Rotation.Pitch, Movement.Rotation.Yaw, Movement.Rotation.Roll };
+
+	for ( int32 i = 0; i < 3; i++ )
+	{
+		Out.Rotation[i] = bByteComponents ? FRotator::CompressAxisToByte( Angles[i] ) : FRotator::CompressAxisToShort( Angles[i] );
+	}
+}
+
+static void DequantizeRepMovement( const FRepMovementBaseline& Value, FRepMovement& Movement )
+{
+	Movement.Location		= DequantizeMovementVector( Value.Location, Movement.LocationQuantizationLevel );
+	Movement.LinearVelocity	= DequantizeMovementVector( Value.LinearVelocity, Movement.VelocityQuantizationLevel );
+
+	if ( Movement.bRepPhysics )
+	{
+		Movement.AngularVelocity = DequantizeMovementVector( Value.AngularVelocity, Movement.VelocityQuantizationLevel );
+	}
+
+	if ( Movement.RotationQuantizationLevel == ERotatorQuantization::ByteComponents )
+	{
+		Movement.Rotation = FRotator( FRotator::DecompressAxisFromByte( (uint16)Value.Rotation[0] ), FRotator::DecompressAxisFromByte( (uint16)Value.Rotation[1] ), FRotator::DecompressAxisFromByte( (uint16)Value.Rotation[2] ) );
+	}
+	else
+	{
+		Movement.Rotation = FRotator( FRotator::DecompressAxisFromShort( (uint16)Value.Rotation[0] ), FRotator::DecompressAxisFromShort( (uint16)Value.Rotation[1] ), FRotator::DecompressAxisFromShort( (uint16)Value.Rotation[2] ) );
+	}
+}
+
+/** 
+ * Serializes Value as a delta from Base. Components are sent with the bit count of the largest delta, 
+ * so a component that didn't change only costs the bit count.
+ * @param WrapMask	if not 0, the components wrap around at WrapMask + 1 (rotation axes)
+ */
+static void SerializeMovementDelta( FArchive& Ar, const int32 Base[3], int32 Value[3], const uint32 WrapMask )
+{
+	int32 Delta[3];
+
+	if ( Ar.IsSaving() )
+	{
+		uint32 MaxAbsDelta = 0;
+
+		for ( int32 i = 0; i < 3; i++ )
+		{
+			Delta[i] = Value[i] - Base[i];
+
+			if ( WrapMask != 0 )
+			{
+				// Take the shortest way around
+				Delta[i] &= WrapMask;
+				if ( (uint32)Delta[i] > ( WrapMask >> 1 ) )
+				{
+					Delta[i] -= (int32)( WrapMask + 1 );
+				}
+			}
+
+			MaxAbsDelta = FMath::Max( MaxAbsDelta, (uint32)FMath::Abs( Delta[i] ) );
+		}
+
+		uint32 Bits = MaxAbsDelta > 0 ? FMath::CeilLogTwo( MaxAbsDelta + 1 ) : 0;
+		Ar.SerializeInt( Bits, 32 );
+
+		if ( Bits > 0 )
+		{
+			const int32 Bias = 1 << Bits;
+			for ( int32 i = 0; i < 3; i++ )
+			{
+				uint32 Biased = Delta[i] + Bias;
+				Ar.SerializeInt( Biased, 1u << ( Bits + 1 ) );
+			}
+		}
+	}
+	else
+	{
+		uint32 Bits = 0;
+		Ar.SerializeInt( Bits, 32 );
+
+		if ( Bits > 30 )
+		{
+			Ar.SetError();
+			return;
+		}
+
+		const int32 Bias = 1 << Bits;
+		for ( int32 i = 0; i < 3; i++ )
+		{
+			uint32 Biased = Bias;
+			if ( Bits > 0 )
+			{
+				Ar.SerializeInt( Biased, 1u << ( Bits + 1 ) );
+			}
+
+			Value[i] = Base[i] + ( (int32)Biased - Bias );
+
+			if ( WrapMask != 0 )
+			{
+				Value[i] &= WrapMask;
+			}
+		}
+	}
+}
+
+static void SerializeRepMovementBaseline( FArchive& Ar, const FRepMovementBaseline& Base, FRepMovementBaseline& Value, const bool bRepPhysics, const ERotatorQuantization RotationQuantizationLevel )
+{
+	const uint32 RotationWrapMask = RotationQuantizationLevel == ERotatorQuantization::ByteComponents ? 0xFF : 0xFFFF;
+
+	SerializeMovementDelta( Ar, Base.Location, Value.Location, 0 );
+	SerializeMovementDelta( Ar, Base.Rotation, Value.Rotation, RotationWrapMask );
+	SerializeMovementDelta( Ar, Base.LinearVelocity, Value.LinearVelocity, 0 );
+
+	if ( bRepPhysics )
+	{
+		SerializeMovementDelta( Ar, Base.AngularVelocity, Value.AngularVelocity, 0 );
+	}
+}
+
+/**
+ * Sends a FRepMovement as a delta from the newest value the connection acked, or from zero when there is none.
+ * The baselines are tracked per FRepState, with the packet ranges filled in by PostReplicate and cleared by ReceivedNak.
+ */
+static void SendRepMovement( FRepState * RepState, FRepWriterState & WriterState, const int32 CmdIndex, const FRepMovement & Movement )
+{
+	FRepMovementHistory & History = RepState->MovementHistories.FindOrAdd( CmdIndex );
+	FNetBitWriter & Writer = WriterState.Writer;
+
+	FRepMovementBaseline NewValue;
+	QuantizeRepMovement( Movement, NewValue );
+	NewValue.Seq = History.NextSeq++;
+
+	const FRepMovementBaseline * Base = NULL;
+	uint32 BaseOffset = 0;
+
+	if ( WriterState.bAllowMovementDelta )
+	{
+		for ( uint32 Offset = 1; Offset < FRepMovementHistory::MAX_HISTORY; Offset++ )
+		{
+			const uint8 BaseSeq = NewValue.Seq - Offset;
+			const FRepMovementBaseline & Candidate = History.Baselines[BaseSeq % FRepMovementHistory::MAX_HISTORY];
+
+			if ( Candidate.bValid && Candidate.bCanBeBase && Candidate.Seq == BaseSeq && Candidate.OutPacketIdRange.First != INDEX_NONE && Candidate.OutPacketIdRange.Last <= WriterState.AckPacketId )
+			{
+				Base = &Candidate;
+				BaseOffset = Offset;
+				break;
+			}
+		}
+	}
+
+	uint8 Flags = ( Movement.bSimulatedPhysicSleep << 0 ) | ( Movement.bRepPhysics << 1 );
+	Writer.SerializeBits( &Flags, 2 );
+
+	Writer << NewValue.Seq;
+
+	uint8 bDelta = Base != NULL ? 1 : 0;
+	Writer.SerializeBits( &bDelta, 1 );
+
+	if ( bDelta )
+	{
+		Writer.SerializeInt( BaseOffset, FRepMovementHistory::MAX_HISTORY );
+	}
+
+	SerializeRepMovementBaseline( Writer, Base != NULL ? *Base : FRepMovementBaseline(), NewValue, Movement.bRepPhysics, Movement.RotationQuantizationLevel );
+
+	// Packet ids are filled in by PostReplicate
+	NewValue.bValid		= true;
+	NewValue.bCanBeBase	= WriterState.bMovementCanBeBase;
+
+	History.Baselines[NewValue.Seq % FRepMovementHistory::MAX_HISTORY] = NewValue;
+}
+
+static void ReceiveRepMovement( FRepState * RepState, const int32 CmdIndex, FNetBitReader & Reader, FRepMovement & Movement )
+{
+	FRepMovementHistory & History = RepState->MovementHistories.FindOrAdd( CmdIndex );
+
+	uint8 Flags = 0;
+	Reader.SerializeBits( &Flags, 2 );
+
+	const bool bSimulatedPhysicSleep	= ( Flags & ( 1 << 0 ) ) != 0;
+	const bool bRepPhysics				= ( Flags & ( 1 << 1 ) ) != 0;
+
+	FRepMovementBaseline NewValue;
+	Reader << NewValue.Seq;
+
+	uint8 bDelta = 0;
+	Reader.SerializeBits( &bDelta, 1 );
+
+	const FRepMovementBaseline * Base = NULL;
+	bool bHaveBase = true;
+
+	if ( bDelta )
+	{
+		uint32 BaseOffset = 0;
+		Reader.SerializeInt( BaseOffset, FRepMovementHistory::MAX_HISTORY );
+
+		const uint8 BaseSeq = NewValue.Seq - BaseOffset;
+		const FRepMovementBaseline & Candidate = History.Baselines[BaseSeq % FRepMovementHistory::MAX_HISTORY];
+
+		if ( Candidate.bValid && Candidate.Seq == BaseSeq )
+		{
+			Base = &Candidate;
+		}
+		else
+		{
+			bHaveBase = false;
+		}
+	}
+
+	// Always read the payload, to stay in sync with the rest of the bunch
+	SerializeRepMovementBaseline( Reader, Base != NULL ? *Base : FRepMovementBaseline(), NewValue, bRepPhysics, Movement.RotationQuantizationLevel );
+
+	if ( Reader.IsError() )
+	{
+		return;
+	}
+
+	if ( !bHaveBase )
+	{
+		// Only happens if the baseline was received out of order, a newer value will follow
+		UE_LOG( LogNet, Verbose, TEXT( "ReceiveRepMovement: Missing baseline for movement %i, update dropped" ), NewValue.Seq );
+		return;
+	}
+
+	NewValue.bValid = true;
+	History.Baselines[NewValue.Seq % FRepMovementHistory::MAX_HISTORY] = NewValue;
+
+	Movement.bSimulatedPhysicSleep	= bSimulatedPhysicSleep;
+	Movement.bRepPhysics			= bRepPhysics;
+	DequantizeRepMovement( NewValue, Movement );
+}
+
+/** Returns true if a cmd is a FRepMovement property that goes through SendRepMovement/ReceiveRepMovement */
+static FORCEINLINE bool IsDeltaRepMovementCmd( const FRepLayoutCmd& Cmd, const FRepParentCmd& Parent )
+{
+	// Movement inside structs or arrays doesn't have a stable cmd to key the history with
+	return Cmd.Type == REPCMD_RepMovement && Cmd.Property == Parent.Property;
+}
+
 uint16 FRepLayout::SendProperties_r( 
 	FRepState *	RESTRICT		RepState, 
 	const FReplicationFlags &	RepFlags,
@@ -1040,14 +1475,21 @@ uint16 FRepLayout::SendProperties_r(
 #endif
 
 			const int32 NumStartBits = WriterState.Writer.GetNumBits();
+
+			const FRepParentCmd& ParentCmd = Parents[Cmd.ParentIndex];
 			
 			// This property changed, so send it
-			Cmd.Property->NetSerializeItem( WriterState.Writer, WriterState.Writer.PackageMap, (void*)( Data + Cmd.Offset ) );
+			if ( IsDeltaRepMovementCmd( Cmd, ParentCmd ) )
+			{
+				SendRepMovement( RepState, WriterState, CmdIndex, *(const FRepMovement*)( Data + Cmd.Offset ) );
+			}
+			else
+			{
+				Cmd.Property->NetSerializeItem( WriterState.Writer, WriterState.Writer.PackageMap, (void*)( Data + Cmd.Offset ) );
+			}
 
 			const int32 NumEndBits = WriterState.Writer.GetNumBits();
 
-			const FRepParentCmd& ParentCmd = Parents[Cmd.ParentIndex];
-
 			NETWORK_PROFILER( GNetworkProfiler.TrackReplicateProperty( ParentCmd.Property, NumEndBits - NumStartBits ) );
 
 			// Make the shadow state match the actual state at the time of send
@@ -1133,13 +1575,22 @@ void FRepLayout::SendProperties(
 	bool &						bContentBlockWritten ) const
 {
 #ifdef ENABLE_PROPERTY_CHECKSUMS
-	const bool bDoChecksum = CVarDoPropertyChecksum.GetValueOnGameThread() == 1;
+	const bool bDoChecksum = CVarDoPropertyChecksum.GetValueOnAnyThread() == 1;
 #else
 	const bool bDoChecksum = false;
 #endif
 
 	FRepWriterState WriterState( Writer, Changed, bDoChecksum );
 
+	// Reliable bunches can be resent long after the baseline they were written against, and internally acked connections (replays) have to be readable from any point
+	UNetConnection * Connection = OwningChannel->Connection;
+	WriterState.bAllowMovementDelta	= CVarRepMovementDelta.GetValueOnAnyThread() != 0 && !Writer.bReliable && !Connection->InternalAck;
+	WriterState.AckPacketId			= Connection->OutAckPacketId;
+
+	// The receiver drops unreliable bunches that arrive before the channel is open, even though their packets get acked.
+	// Only values sent once the open was acked are guaranteed to have been read; reliable ones are full values that are never used as bases.
+	WriterState.bMovementCanBeBase	= WriterState.bAllowMovementDelta && OwningChannel->OpenAcked;
+
 #ifdef ENABLE_PROPERTY_CHECKSUMS
 	Writer.WriteBit( bDoChecksum ? 1 : 0 );
 #endif
@@ -1268,6 +1719,18 @@ public:
 		ReadNextHandle();
 	}
 
+	void ReceivePropertyItem( const FRepLayoutCmd& Cmd, const FRepParentCmd& Parent, const int32 CmdIndex, uint8* RESTRICT Data )
+	{
+		if ( IsDeltaRepMovementCmd( Cmd, Parent ) )
+		{
+			ReceiveRepMovement( RepState, CmdIndex, Bunch, *(FRepMovement*)Data );
+		}
+		else
+		{
+			Cmd.Property->NetSerializeItem( Bunch, Bunch.PackageMap, Data );
+		}
+	}
+
 	PROCESS_CMD( FReceivedPropertiesStackState )
 	{
 		check( StackState.UnmappedGuids != NULL );
@@ -1289,7 +1752,7 @@ public:
 			StoreProperty( Cmd, ShadowData + Cmd.Offset, Data + SwappedCmd.Offset );
 
 			// Read the property
-			Cmd.Property->NetSerializeItem( Bunch, Bunch.PackageMap, Data + SwappedCmd.Offset );
+			ReceivePropertyItem( Cmd, Parent, CmdIndex, Data + SwappedCmd.Offset );
 
 			// Check to see if this property changed
 			if ( Parent.RepNotifyCondition == REPNOTIFY_Always || !PropertiesAreIdentical( Cmd, ShadowData + Cmd.Offset, Data + SwappedCmd.Offset ) )
@@ -1299,7 +1762,7 @@ public:
 		} 
 		else
 		{
-			Cmd.Property->NetSerializeItem( Bunch, Bunch.PackageMap, Data + SwappedCmd.Offset );
+			ReceivePropertyItem( Cmd, Parent, CmdIndex, Data + SwappedCmd.Offset );
 		}
 
 		const TArray< FNetworkGUID > & TrackedUnmappedGuids = Bunch.PackageMap->GetTrackedUnmappedGuids();
@@ -2659,6 +3122,11 @@ void FRepLayout::GetLifetimeCustomDeltaProperties( TArray< int32 > & OutCustom )
 	}
 }
 
+FRepChangedPropertyTracker::~FRepChangedPropertyTracker()
+{
+	delete SharedShadowState;
+}
+
 FRepState::~FRepState()
 {
 	if (RepLayout.IsValid() && StaticBuffer.Num() > 0)
@@ -55,6 +55,14 @@ static TAutoConsoleVariable<int32> CVarEffectsQuality(
 	TEXT(" 0:low, 1:med, 2:high, 3:epic, default: 3"),
 	ECVF_ScalabilityGroup);
 
+// @RyanTorant
+static TAutoConsoleVariable<int32> CVarAHRQuality(
+	TEXT("sg.AHRQuality"),
+	3,
+	TEXT("Scalability quality state (internally used by scalability system, ini load/save or using SCALABILITY console command)\n")
+	TEXT(" 0:low, 1:med, 2:high, 3:epic, default: 3"),
+	ECVF_ScalabilityGroup);
+
 namespace Scalability
 {
 	// Select a the correct quality level for the given benchmark value and thresholds
@@ -199,6 +207,10 @@ void OnChangeEffectsQuality(IConsoleVariable* Var)
 {
 	SetGroupQualityLevel(TEXT("EffectsQuality"), Var->GetInt());
 }
+void OnChangeAHRQuality(IConsoleVariable* Var)
+{
+	SetGroupQualityLevel(TEXT("AHRQuality"), Var->GetInt());
+}
 
 void InitScalabilitySystem()
 {
@@ -221,6 +233,7 @@ void InitScalabilitySystem()
 	CVarPostProcessQuality.AsVariable()->SetOnChangedCallback(FConsoleVariableDelegate::CreateStatic(&OnChangePostProcessQuality));
 	CVarTextureQuality.AsVariable()->SetOnChangedCallback(FConsoleVariableDelegate::CreateStatic(&OnChangeTextureQuality));
 	CVarEffectsQuality.AsVariable()->SetOnChangedCallback(FConsoleVariableDelegate::CreateStatic(&OnChangeEffectsQuality));
+	CVarAHRQuality.AsVariable()->SetOnChangedCallback(FConsoleVariableDelegate::CreateStatic(&OnChangeAHRQuality));
 }
 
 /** Get the percentage scale for a given quality level */
@@ -253,6 +266,8 @@ FQualityLevels BenchmarkQualityLevels(uint32 WorkScale)
 	Results.PostProcessQuality = ComputeOptionFromPerfIndex(GPUPerfIndex, 20, 50, 70);
 	Results.TextureQuality = ComputeOptionFromPerfIndex(GPUPerfIndex, 10, 40, 70);
 	Results.EffectsQuality = ComputeOptionFromPerfIndex(MinPerfIndex, 25, 55, 70);
+	// The GI cost is almost all on the GPU
+	Results.AHRQuality = ComputeOptionFromPerfIndex(GPUPerfIndex, 30, 55, 80);
 
 	return Results;
 }
@@ -341,6 +356,7 @@ void ProcessCommand(const TCHAR* Cmd, FOutputDevice& Ar)
 		PrintGroupInfo(TEXT("PostProcessQuality"), bInfoMode);
 		PrintGroupInfo(TEXT("TextureQuality"), bInfoMode);
 		PrintGroupInfo(TEXT("EffectsQuality"), bInfoMode);
+		PrintGroupInfo(TEXT("AHRQuality"), bInfoMode);
 	}
 }
 
@@ -353,6 +369,7 @@ void SetQualityLevels(const FQualityLevels& QualityLevels)
 	CVarPostProcessQuality.AsVariable()->Set(QualityLevels.PostProcessQuality, ECVF_SetByScalability);
 	CVarTextureQuality.AsVariable()->Set(QualityLevels.TextureQuality, ECVF_SetByScalability);
 	CVarEffectsQuality.AsVariable()->Set(QualityLevels.EffectsQuality, ECVF_SetByScalability);
+	CVarAHRQuality.AsVariable()->Set(QualityLevels.AHRQuality, ECVF_SetByScalability);
 }
 
 FQualityLevels GetQualityLevels()
@@ -367,6 +384,7 @@ FQualityLevels GetQualityLevels()
 	Ret.PostProcessQuality = CVarPostProcessQuality.GetValueOnGameThread();
 	Ret.TextureQuality = CVarTextureQuality.GetValueOnGameThread();
 	Ret.EffectsQuality = CVarEffectsQuality.GetValueOnGameThread();
+	Ret.AHRQuality = CVarAHRQuality.GetValueOnGameThread();
 
 	return Ret;
 }
@@ -391,6 +409,7 @@ void FQualityLevels::SetFromSingleQualityLevel(int32 Value)
 	PostProcessQuality = Value;
 	TextureQuality = Value;
 	EffectsQuality = Value;
+	AHRQuality = Value;
 }
 
 void LoadState(const FString& IniName)
@@ -412,6 +431,7 @@ void LoadState(const FString& IniName)
 	GConfig->GetInt(Section, TEXT("sg.PostProcessQuality"), State.PostProcessQuality, IniName);
 	GConfig->GetInt(Section, TEXT("sg.TextureQuality"), State.TextureQuality, IniName);
 	GConfig->GetInt(Section, TEXT("sg.EffectsQuality"), State.EffectsQuality, IniName);
+	GConfig->GetInt(Section, TEXT("sg.AHRQuality"), State.AHRQuality, IniName);
 
 	SetQualityLevels(State);
 }
@@ -432,6 +452,7 @@ void SaveState(const FString& IniName)
 	GConfig->SetInt(Section, TEXT("sg.PostProcessQuality"), State.PostProcessQuality, IniName);
 	GConfig->SetInt(Section, TEXT("sg.TextureQuality"), State.TextureQuality, IniName);
 	GConfig->SetInt(Section, TEXT("sg.EffectsQuality"), State.EffectsQuality, IniName);
+	GConfig->SetInt(Section, TEXT("sg.AHRQuality"), State.AHRQuality, IniName);
 }
 
 void RecordQualityLevelsAnalytics(bool bAutoApplied)
@@ -449,6 +470,7 @@ void RecordQualityLevelsAnalytics(bool bAutoApplied)
 		Attributes.Add(FAnalyticsEventAttribute(TEXT("PostProcessQuality"), State.PostProcessQuality));
 		Attributes.Add(FAnalyticsEventAttribute(TEXT("TextureQuality"), State.TextureQuality));
 		Attributes.Add(FAnalyticsEventAttribute(TEXT("EffectsQuality"), State.EffectsQuality));
+		Attributes.Add(FAnalyticsEventAttribute(TEXT("AHRQuality"), State.AHRQuality));
 		Attributes.Add(FAnalyticsEventAttribute(TEXT("AutoAppliedSettings"), bAutoApplied));
 
 		FEngineAnalytics::GetProvider().RecordEvent(TEXT("Editor.Performance.ScalabiltySettings"), Attributes);
@@ -978,6 +978,9 @@ void USceneComponent::AttachTo(class USceneComponent* Parent, FName InSocketName
 		{
 			Parent->AttachChildren.Add(this);
 		}
+		// Either side may be part of a GC cluster the other isn't in
+		GCClusterWriteBarrier(Parent, this);
+		GCClusterWriteBarrier(this, Parent);
 
 		switch ( AttachType )
 		{
@@ -297,18 +297,23 @@ int8 ComputeStaticMeshLOD( const FStaticMeshRenderData* RenderData, const FVecto
 
 int8 ComputeLODForMeshes( const TIndirectArray<class FStaticMesh>& StaticMeshes, const FSceneView& View, const FVector4& Origin, float SphereRadius, int32 ForcedLODLevel, float ScreenSizeScale )
 {
-	int8 LODToRender = 0;
+	// The first LODs may have no static meshes, e.g. when they are streamed out, so fall back to the first LOD that has some
+	int8 MinLOD = MAX_int8;
+	int8 MaxLOD = 0;
+	for(int32 MeshIndex = 0 ; MeshIndex < StaticMeshes.Num() ; ++MeshIndex)
+	{
+		const FStaticMesh&  Mesh = StaticMeshes[MeshIndex];
+		MinLOD = FMath::Min(MinLOD, Mesh.LODIndex);
+		MaxLOD = FMath::Max(MaxLOD, Mesh.LODIndex);
+	}
+	MinLOD = FMath::Min(MinLOD, MaxLOD);
+
+	int8 LODToRender = MinLOD;
 
 	// Handle forced LOD level first
 	if(ForcedLODLevel >= 0)
 	{
-		int8 MaxLOD = 0;
-		for(int32 MeshIndex = 0 ; MeshIndex < StaticMeshes.Num() ; ++MeshIndex)
-		{
-			const FStaticMesh&  Mesh = StaticMeshes[MeshIndex];
-			MaxLOD = FMath::Max(MaxLOD, Mesh.LODIndex);
-		}
-		LODToRender = FMath::Clamp<int8>(ForcedLODLevel, 0, MaxLOD);
+		LODToRender = FMath::Clamp<int8>(ForcedLODLevel, MinLOD, MaxLOD);
 	}
 	else
 	{
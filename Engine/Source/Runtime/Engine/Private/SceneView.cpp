@@ -72,6 +72,67 @@ static TAutoConsoleVariable<float> CVarSSAOFadeRadiusScale(
 	TEXT(" 0.01:smallest .. 1.0:normal (default), <1:smaller, >1:larger"),
 	ECVF_Cheat | ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<int32> CVarDynamicResolution(
+	TEXT("r.DynamicResolution"),
+	0,
+	TEXT("Adjusts the screen percentage of the game views every frame to keep the GPU frame time on r.DynamicResolution.TargetGPUTime.\n")
+	TEXT("The scene render targets stay allocated for the max screen percentage. Overrides r.ScreenPercentage.\n")
+	TEXT(" 0: off (default)\n")
+	TEXT(" 1: on"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarDynamicResolutionTargetGPUTime(
+	TEXT("r.DynamicResolution.TargetGPUTime"),
+	16.0f,
+	TEXT("GPU frame time in milliseconds the dynamic resolution aims for, a bit under the frame budget (default 16, for 60 fps)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDynamicResolutionMinScreenPercentage(
+	TEXT("r.DynamicResolution.MinScreenPercentage"),
+	50.0f,
+	TEXT("Lowest screen percentage the dynamic resolution goes to (default 50)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDynamicResolutionMaxScreenPercentage(
+	TEXT("r.DynamicResolution.MaxScreenPercentage"),
+	100.0f,
+	TEXT("Highest screen percentage the dynamic resolution goes to, the scene render targets are allocated for it (default 100)."),
+	ECVF_RenderThreadSafe);
+
+/** Screen percentage picked by the dynamic resolution, and the frame it was picked on. */
+static float GDynamicResolutionScreenPercentage = 100.0f;
+static uint64 GDynamicResolutionFrameCounter = 0;
+
+/** Returns the screen percentage the dynamic resolution picks for this frame, updated from the GPU frame time once per frame. */
+static float GetDynamicResolutionScreenPercentage()
+{
+	const float MaxPercentage = FMath::Clamp(CVarDynamicResolutionMaxScreenPercentage.GetValueOnGameThread(), 10.0f, 400.0f);
+	const float MinPercentage = FMath::Clamp(CVarDynamicResolutionMinScreenPercentage.GetValueOnGameThread(), 10.0f, MaxPercentage);
+
+	if (GDynamicResolutionFrameCounter != GFrameCounter)
+	{
+		GDynamicResolutionFrameCounter = GFrameCounter;
+
+		// measured with timestamps by the RHI, 0 if it doesn't support them
+		const float GPUTime = FPlatformTime::ToMilliseconds(GGPUFrameTime);
+		const float TargetGPUTime = FMath::Max(CVarDynamicResolutionTargetGPUTime.GetValueOnGameThread(), 1.0f);
+
+		// the GPU time is roughly proportional to the number of pixels, so to the square of the screen percentage.
+		// Ignore small errors and only move part of the way, by a few percent at most: the measured time lags a frame or two
+		// behind and every change of the view size costs the temporal histories
+		if (GPUTime > 0.0f && FMath::Abs(GPUTime - TargetGPUTime) > 0.05f * TargetGPUTime)
+		{
+			const float WantedPercentage = GDynamicResolutionScreenPercentage * FMath::Sqrt(TargetGPUTime / GPUTime);
+			GDynamicResolutionScreenPercentage += FMath::Clamp((WantedPercentage - GDynamicResolutionScreenPercentage) * 0.25f, -5.0f, 5.0f);
+		}
+
+		GDynamicResolutionScreenPercentage = FMath::Clamp(GDynamicResolutionScreenPercentage, MinPercentage, MaxPercentage);
+	}
+
+	// whole percents, so the view size doesn't change for every little variation of the GPU time
+	return FMath::Clamp(FMath::RoundToFloat(GDynamicResolutionScreenPercentage), MinPercentage, MaxPercentage);
+}
+
 // Engine default (project settings):
 
 static TAutoConsoleVariable<int32> CVarDefaultBloom(
@@ -1151,6 +1212,11 @@ void FSceneView::EndFinalPostprocessSettings(const FSceneViewInitOptions& ViewIn
 		}
 	}
 
+	if(CVarDynamicResolution.GetValueOnGameThread() != 0)
+	{
+		FinalPostProcessSettings.ScreenPercentage = GetDynamicResolutionScreenPercentage();
+	}
+
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 	{
 		float Value = CVarSSRMaxRoughness.GetValueOnGameThread();
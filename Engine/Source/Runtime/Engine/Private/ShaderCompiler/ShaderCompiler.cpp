@@ -13,6 +13,7 @@
 #include "EngineModule.h"
 #include "ShaderCompiler.h"
 #include "RendererInterface.h"
+#include "Networking.h"
 
 DEFINE_LOG_CATEGORY(LogShaderCompilers);
 
@@ -59,8 +60,10 @@ static TAutoConsoleVariable<FString> CVarD3DCompilerPath(TEXT("r.D3DCompilerPath
 // Serialize Queued Job information
 static void DoWriteTasks(TArray<FShaderCompileJob*>& QueuedJobs, FArchive& TransferFile)
 {
-	int32 ShaderCompileWorkerInputVersion = 2;
+	int32 ShaderCompileWorkerInputVersion = 3;
 	TransferFile << ShaderCompileWorkerInputVersion;
+	uint32 ShaderFileCacheGeneration = GetShaderFileCacheGeneration();
+	TransferFile << ShaderFileCacheGeneration;
 	int32 NumBatches = QueuedJobs.Num();
 	TransferFile << NumBatches;
 
@@ -318,6 +321,229 @@ struct FPipeWorkerInfo
 };
 #endif	// PLATFORM_SUPPORTS_NAMED_PIPES
 
+/** Seconds to wait for a remote worker to accept the connection before compiling its jobs locally */
+static const double RemoteWorkerConnectTimeout = 5.0;
+
+/** Seconds before a remote worker that failed is sent jobs again */
+static const double RemoteWorkerRetryDelay = 30.0;
+
+/**
+ * Connection to a ShaderCompileWorker running as an agent on another machine (-communicatethroughsocket), 
+ * see RemoteShaderCompileWorkers in DevOptions.Shaders. 
+ * Uses the same transfer format as the named pipes: job batch size and data, then results size and data.
+ * Sockets are non-blocking so a slow or dead agent never stalls the compiling thread.
+ */
+struct FRemoteWorkerInfo
+{
+	/** Whether the worker is remote, false for workers running on this machine */
+	bool bIsRemote;
+
+	/** Address of the agent */
+	FIPv4Endpoint Endpoint;
+
+	/** Connection for the current batch, one connection per batch */
+	FSocket* Socket;
+
+	enum EState
+	{
+		State_Idle,
+		State_Connecting,
+		State_SendingJobData,
+		State_ReceivingResultSize,
+		State_ReceivingResults,
+	};
+
+	EState State;
+
+	// Holds the serialized data for queued jobs to send to the agent, and how much of it was sent
+	TArray<uint8> WorkJobBuffer;
+	int32 BytesSent;
+
+	// Holds the size of the response from the agent, the response, and how much of it was received
+	int32 ResultsTransferSize;
+	TArray<uint8> ResultsBuffer;
+	int32 BytesReceived;
+
+	/** Time the current state was entered */
+	double StateStartTime;
+
+	/** The agent isn't fed jobs before this time, set when it failed */
+	double RetryTime;
+
+	FRemoteWorkerInfo() :
+		bIsRemote(false),
+		Socket(NULL),
+		State(State_Idle),
+		BytesSent(0),
+		ResultsTransferSize(0),
+		BytesReceived(0),
+		StateStartTime(0),
+		RetryTime(0)
+	{
+	}
+
+	~FRemoteWorkerInfo()
+	{
+		Disconnect();
+	}
+
+	/** @return Whether new jobs can be given to this worker */
+	bool IsAvailable() const
+	{
+		return !bIsRemote || FPlatformTime::Seconds() >= RetryTime;
+	}
+
+	void WriteTasks(TArray<FShaderCompileJob*>& QueuedJobs)
+	{
+		TArray<uint8> Buffer;
+		FMemoryWriter BufferWriter(Buffer);
+		DoWriteTasks(QueuedJobs, BufferWriter);
+
+		WorkJobBuffer.Empty(0);
+		FMemoryWriter TransferWriter(WorkJobBuffer);
+		int32 BufferSize = Buffer.Num();
+		TransferWriter << BufferSize;
+		TransferWriter.Serialize(Buffer.GetData(), Buffer.Num());
+		TransferWriter.Close();
+
+		Disconnect();
+	}
+
+	/** 
+	 * Advances the transfer with the agent as far as it can go without blocking.
+	 * @param bOutFailed	set when the agent can't be reached or the connection was lost, the jobs need to be compiled elsewhere
+	 * @return true once the results were received into ResultsBuffer
+	 */
+	bool UpdateResultsState(bool& bOutFailed)
+	{
+		bOutFailed = false;
+
+		switch (State)
+		{
+			case State_Idle:
+			{
+				ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+				Socket = SocketSubsystem ? SocketSubsystem->CreateSocket(NAME_Stream, TEXT("Remote ShaderCompileWorker"), false) : NULL;
+				if (!Socket || !Socket->SetNonBlocking() || !Socket->Connect(*Endpoint.ToInternetAddr()))
+				{
+					bOutFailed = true;
+					return false;
+				}
+				SetState(State_Connecting);
+				return false;
+			}
+
+			case State_Connecting:
+				if (Socket->Wait(ESocketWaitConditions::WaitForWrite, FTimespan::Zero()))
+				{
+					if (Socket->GetConnectionState() != SCS_Connected)
+					{
+						bOutFailed = true;
+						return false;
+					}
+					BytesSent = 0;
+					SetState(State_SendingJobData);
+				}
+				else if (FPlatformTime::Seconds() - StateStartTime > RemoteWorkerConnectTimeout)
+				{
+					bOutFailed = true;
+				}
+				return false;
+
+			case State_SendingJobData:
+				if (Socket->Wait(ESocketWaitConditions::WaitForWrite, FTimespan::Zero()))
+				{
+					int32 Sent = 0;
+					if (!Socket->Send(WorkJobBuffer.GetData() + BytesSent, WorkJobBuffer.Num() - BytesSent, Sent))
+					{
+						bOutFailed = true;
+						return false;
+					}
+					BytesSent += Sent;
+					if (BytesSent == WorkJobBuffer.Num())
+					{
+						BytesReceived = 0;
+						SetState(State_ReceivingResultSize);
+					}
+				}
+				return false;
+
+			case State_ReceivingResultSize:
+				if (ReceiveBytes((uint8*)&ResultsTransferSize, sizeof(ResultsTransferSize), bOutFailed))
+				{
+					if (ResultsTransferSize <= 0)
+					{
+						bOutFailed = true;
+						return false;
+					}
+					ResultsBuffer.Empty(ResultsTransferSize);
+					ResultsBuffer.AddUninitialized(ResultsTransferSize);
+					BytesReceived = 0;
+					SetState(State_ReceivingResults);
+				}
+				else
+				{
+					return false;
+				}
+				// Results may already be there
+				// fall through
+
+			case State_ReceivingResults:
+				if (ReceiveBytes(ResultsBuffer.GetData(), ResultsBuffer.Num(), bOutFailed))
+				{
+					Disconnect();
+					return true;
+				}
+				return false;
+
+			default:
+				// Unknown state!
+				check(0);
+				return false;
+		}
+	}
+
+	void Disconnect()
+	{
+		if (Socket)
+		{
+			Socket->Close();
+			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+			Socket = NULL;
+		}
+		SetState(State_Idle);
+	}
+
+private:
+	void SetState(EState NewState)
+	{
+		State = NewState;
+		StateStartTime = FPlatformTime::Seconds();
+	}
+
+	/** Receives what is available of Size bytes into Dest, continuing from BytesReceived. @return true once all Size bytes were received */
+	bool ReceiveBytes(uint8* Dest, int32 Size, bool& bOutFailed)
+	{
+		while (BytesReceived < Size)
+		{
+			if (!Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::Zero()))
+			{
+				return false;
+			}
+
+			// Readable with nothing to read means the agent closed the connection (e.g. it crashed)
+			int32 Read = 0;
+			if (!Socket->Recv(Dest + BytesReceived, Size - BytesReceived, Read) || Read == 0)
+			{
+				bOutFailed = true;
+				return false;
+			}
+			BytesReceived += Read;
+		}
+		return true;
+	}
+};
+
 /** Information tracked for each shader compile worker process instance. */
 struct FShaderCompileWorkerInfo
 {
@@ -340,6 +566,9 @@ struct FShaderCompileWorkerInfo
 	bool bWorkerForPipeWasLaunched;
 #endif
 
+	/** Connection to the agent, for workers on other machines */
+	FRemoteWorkerInfo RemoteWorker;
+
 	/** Time at which the worker started the most recent batch of tasks. */
 	double StartTime;
 
@@ -470,6 +699,22 @@ FShaderCompileThreadRunnable::FShaderCompileThreadRunnable(FShaderCompilingManag
 		WorkerInfos.Add(new FShaderCompileWorkerInfo());
 	}
 
+	// Agents on other machines come after the local workers, so compiling during the game only feeds local ones
+	for (const FString& RemoteWorkerAddress : Manager->RemoteShaderCompileWorkers)
+	{
+		FIPv4Endpoint Endpoint;
+		if (!FIPv4Endpoint::Parse(RemoteWorkerAddress, Endpoint))
+		{
+			UE_LOG(LogShaderCompilers, Warning, TEXT("Ignoring remote ShaderCompileWorker '%s', expected an address like 10.0.0.1:8500."), *RemoteWorkerAddress);
+			continue;
+		}
+
+		FShaderCompileWorkerInfo* RemoteWorkerInfo = new FShaderCompileWorkerInfo();
+		RemoteWorkerInfo->RemoteWorker.bIsRemote = true;
+		RemoteWorkerInfo->RemoteWorker.Endpoint = Endpoint;
+		WorkerInfos.Add(RemoteWorkerInfo);
+	}
+
 	if (Manager->bAllowAsynchronousShaderCompiling && !FPlatformProperties::RequiresCookedData())
 	{
 		Thread = FRunnableThread::Create(this, TEXT("ShaderCompilingThread"), 0, TPri_Normal, FPlatformAffinity::GetPoolThreadMask());
@@ -563,7 +808,7 @@ int32 FShaderCompileThreadRunnable::PullTasksFromQueue()
 			FShaderCompileWorkerInfo& CurrentWorkerInfo = *WorkerInfos[WorkerIndex];
 
 			// If this worker doesn't have any queued jobs, look for more in the input queue
-			if (CurrentWorkerInfo.QueuedJobs.Num() == 0 && WorkerIndex < NumWorkersToFeed)
+			if (CurrentWorkerInfo.QueuedJobs.Num() == 0 && WorkerIndex < NumWorkersToFeed && CurrentWorkerInfo.RemoteWorker.IsAvailable())
 			{
 				check(!CurrentWorkerInfo.bComplete);
 
@@ -576,17 +821,26 @@ int32 FShaderCompileThreadRunnable::PullTasksFromQueue()
 					// Don't put more than one low latency task into a batch
 					for (; JobIndex < Manager->MaxShaderJobBatchSize && JobIndex < Manager->CompileQueue.Num() && !bAddedLowLatencyTask; JobIndex++)
 					{
+						// Remote workers add a network round trip, leave the jobs someone is waiting on to the local ones
+						if (CurrentWorkerInfo.RemoteWorker.bIsRemote && Manager->CompileQueue[JobIndex]->bOptimizeForLowLatency)
+						{
+							break;
+						}
+
 						bAddedLowLatencyTask |= Manager->CompileQueue[JobIndex]->bOptimizeForLowLatency;
 						CurrentWorkerInfo.QueuedJobs.Add(Manager->CompileQueue[JobIndex]);
 					}
 
-					// Update the worker state as having new tasks that need to be issued					
-					// don't reset worker app ID, because the shadercompilerworkers don't shutdown immediately after finishing a single job queue.
-					CurrentWorkerInfo.bIssuedTasksToWorker = false;					
-					CurrentWorkerInfo.bLaunchedWorker = false;
-					CurrentWorkerInfo.StartTime = FPlatformTime::Seconds();
-					NumActiveThreads++;
-					Manager->CompileQueue.RemoveAt(0, JobIndex);
+					if (JobIndex > 0)
+					{
+						// Update the worker state as having new tasks that need to be issued					
+						// don't reset worker app ID, because the shadercompilerworkers don't shutdown immediately after finishing a single job queue.
+						CurrentWorkerInfo.bIssuedTasksToWorker = false;					
+						CurrentWorkerInfo.bLaunchedWorker = false;
+						CurrentWorkerInfo.StartTime = FPlatformTime::Seconds();
+						NumActiveThreads++;
+						Manager->CompileQueue.RemoveAt(0, JobIndex);
+					}
 				}
 			}
 			else
@@ -667,6 +921,12 @@ void FShaderCompileThreadRunnable::WriteNewTasks()
 			// 'Only' indicates that the worker should keep checking for more tasks after this one
 			FArchive* TransferFile = NULL;
 
+			if (CurrentWorkerInfo.RemoteWorker.bIsRemote)
+			{
+				// Sent by ReadAvailableResults as the connection allows
+				CurrentWorkerInfo.RemoteWorker.WriteTasks(CurrentWorkerInfo.QueuedJobs);
+			}
+			else
 #if PLATFORM_SUPPORTS_NAMED_PIPES
 			if (GShaderPipeConfig.bUseNamedPipes && !GShaderPipeConfig.bSingleJobPerNamedPipeProcess)
 			{
@@ -786,6 +1046,12 @@ bool FShaderCompileThreadRunnable::LaunchWorkersIfNeeded()
 			continue;
 		}
 
+		// Agents on other machines are started there
+		if (CurrentWorkerInfo.RemoteWorker.bIsRemote)
+		{
+			continue;
+		}
+
 #if PLATFORM_SUPPORTS_NAMED_PIPES
 		if (GShaderPipeConfig.bUseNamedPipes && !GShaderPipeConfig.bSingleJobPerNamedPipeProcess)
 		{
@@ -853,6 +1119,27 @@ void FShaderCompileThreadRunnable::ReadAvailableResults()
 		// Check for available result files
 		if (CurrentWorkerInfo.QueuedJobs.Num() > 0)
 		{
+			if (CurrentWorkerInfo.RemoteWorker.bIsRemote)
+			{
+				bool bFailed = false;
+				if (CurrentWorkerInfo.RemoteWorker.UpdateResultsState(bFailed))
+				{
+					FMemoryReader ResultReader(CurrentWorkerInfo.RemoteWorker.ResultsBuffer);
+					DoReadTaskResults(CurrentWorkerInfo.QueuedJobs, ResultReader);
+					CurrentWorkerInfo.bComplete = true;
+				}
+				else if (bFailed)
+				{
+					UE_LOG(LogShaderCompilers, Warning, TEXT("Remote ShaderCompileWorker %s failed, its %u jobs go back to the queue and it won't be used for %.0fs."), 
+						*CurrentWorkerInfo.RemoteWorker.Endpoint.ToString(), CurrentWorkerInfo.QueuedJobs.Num(), RemoteWorkerRetryDelay);
+
+					CurrentWorkerInfo.RemoteWorker.Disconnect();
+					CurrentWorkerInfo.RemoteWorker.RetryTime = FPlatformTime::Seconds() + RemoteWorkerRetryDelay;
+					ReturnJobsToQueue(CurrentWorkerInfo);
+				}
+				continue;
+			}
+
 #if PLATFORM_SUPPORTS_NAMED_PIPES
 			if (GShaderPipeConfig.bUseNamedPipes && !GShaderPipeConfig.bSingleJobPerNamedPipeProcess)
 			{
@@ -912,6 +1199,17 @@ void FShaderCompileThreadRunnable::ReadAvailableResults()
 	}
 }
 
+void FShaderCompileThreadRunnable::ReturnJobsToQueue(FShaderCompileWorkerInfo& CurrentWorkerInfo)
+{
+	// Enter the critical section so we can access the input queue
+	FScopeLock Lock(&Manager->CompileQueueSection);
+
+	// Back to the front, they were the next ones to compile
+	Manager->CompileQueue.Insert(CurrentWorkerInfo.QueuedJobs, 0);
+	CurrentWorkerInfo.QueuedJobs.Empty();
+	CurrentWorkerInfo.bIssuedTasksToWorker = false;
+}
+
 void FShaderCompileThreadRunnable::CompileDirectlyThroughDll()
 {
 	for (int32 WorkerIndex = 0; WorkerIndex < WorkerInfos.Num(); WorkerIndex++)
@@ -1073,6 +1371,16 @@ FShaderCompilingManager::FShaderCompilingManager() :
 	GShaderPipeConfig.ReadFromConfigIni();
 #endif
 
+	// Agents on other machines only take part in the regular worker loop, which single job named pipe processes don't use
+	bool bCanUseRemoteWorkers = bAllowCompilingThroughWorkers && bAllowAsynchronousShaderCompiling;
+#if PLATFORM_SUPPORTS_NAMED_PIPES
+	bCanUseRemoteWorkers = bCanUseRemoteWorkers && !(GShaderPipeConfig.bUseNamedPipes && GShaderPipeConfig.bSingleJobPerNamedPipeProcess);
+#endif
+	if (bCanUseRemoteWorkers)
+	{
+		GConfig->GetArray(TEXT("DevOptions.Shaders"), TEXT("RemoteShaderCompileWorkers"), RemoteShaderCompileWorkers, GEngineIni);
+	}
+
 	GRetryShaderCompilation = bPromptToRetryFailedShaderCompiles;
 
 	verify(GConfig->GetFloat( TEXT("DevOptions.Shaders"), TEXT("ProcessGameThreadTargetTime"), ProcessGameThreadTargetTime, GEngineIni ));
@@ -0,0 +1,188 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SignificanceManager.cpp: Per world significance of gameplay objects
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Significance Manager"), STAT_SignificanceManager, STATGROUP_Game);
+
+void FSignificanceManager::RegisterObject(UObject* Object, FName Tag, const FSignificanceFunction& SignificanceFunction, const FPostSignificanceFunction& PostSignificanceFunction)
+{
+	check(IsInGameThread());
+	check(Object && SignificanceFunction);
+
+	// A destroyed object that was not unregistered may have left its address behind
+	int32* ExistingIndex = ObjectIndices.Find(Object);
+	if (ExistingIndex)
+	{
+		RemoveObjectAt(*ExistingIndex);
+	}
+
+	const int32 Index = ManagedObjects.AddDefaulted();
+	FManagedObjectInfo& Info = ManagedObjects[Index];
+	Info.Object = Object;
+	Info.ObjectKey = Object;
+	Info.Tag = Tag;
+	Info.Significance = 0.f;
+	Info.SignificanceFunction = SignificanceFunction;
+	Info.PostSignificanceFunction = PostSignificanceFunction;
+	ObjectIndices.Add(Object, Index);
+}
+
+void FSignificanceManager::UnregisterObject(UObject* Object)
+{
+	check(IsInGameThread());
+
+	int32* Index = ObjectIndices.Find(Object);
+	if (Index)
+	{
+		RemoveObjectAt(*Index);
+	}
+}
+
+void FSignificanceManager::RemoveObjectAt(int32 Index)
+{
+	ObjectIndices.Remove(ManagedObjects[Index].ObjectKey);
+	ManagedObjects.RemoveAtSwap(Index);
+
+	if (Index < ManagedObjects.Num())
+	{
+		ObjectIndices.Add(ManagedObjects[Index].ObjectKey, Index);
+	}
+}
+
+bool FSignificanceManager::QuerySignificance(const UObject* Object, float& OutSignificance) const
+{
+	const int32* Index = ObjectIndices.Find(Object);
+	if (Index)
+	{
+		OutSignificance = ManagedObjects[*Index].Significance;
+		return true;
+	}
+	return false;
+}
+
+void FSignificanceManager::GetObjectsWithTag(FName Tag, TArray<UObject*>& OutObjects) const
+{
+	for (const FManagedObjectInfo& Info : ManagedObjects)
+	{
+		UObject* Object = Info.Object.Get();
+		if (Object && Info.Tag == Tag)
+		{
+			OutObjects.Add(Object);
+		}
+	}
+}
+
+void FSignificanceManager::Tick(UWorld* World)
+{
+	if (ManagedObjects.Num() == 0)
+	{
+		return;
+	}
+
+	// On a server the remote players count as much as the local ones
+	TArray<FTransform> WorldViewPoints;
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		APlayerController* PlayerController = *Iterator;
+		if (PlayerController)
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			WorldViewPoints.Add(FTransform(ViewRotation, ViewLocation));
+		}
+	}
+
+	Update(WorldViewPoints);
+}
+
+void FSignificanceManager::Update(const TArray<FTransform>& InViewPoints)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SignificanceManager);
+	check(IsInGameThread());
+
+	ViewPoints = InViewPoints;
+
+	// Drop the objects destroyed since the last update
+	for (int32 Index = ManagedObjects.Num() - 1; Index >= 0; --Index)
+	{
+		if (!ManagedObjects[Index].Object.IsValid())
+		{
+			RemoveObjectAt(Index);
+		}
+	}
+
+	TArray<float> NewSignificances;
+	NewSignificances.AddUninitialized(ManagedObjects.Num());
+
+	ParallelFor(ManagedObjects.Num(), [this, &NewSignificances](int32 Index)
+	{
+		const FManagedObjectInfo& Info = ManagedObjects[Index];
+		NewSignificances[Index] = Info.SignificanceFunction(Info.Object.Get(), ViewPoints);
+	});
+
+	// Post functions may register or unregister objects, so they are called on a copy of what changed
+	struct FChangedSignificance
+	{
+		TWeakObjectPtr<UObject> Object;
+		float OldSignificance;
+		float NewSignificance;
+		FPostSignificanceFunction PostSignificanceFunction;
+	};
+	TArray<FChangedSignificance> Changes;
+
+	for (int32 Index = 0; Index < ManagedObjects.Num(); ++Index)
+	{
+		FManagedObjectInfo& Info = ManagedObjects[Index];
+		if (Info.Significance != NewSignificances[Index])
+		{
+			if (Info.PostSignificanceFunction)
+			{
+				const int32 ChangeIndex = Changes.AddDefaulted();
+				Changes[ChangeIndex].Object = Info.Object;
+				Changes[ChangeIndex].OldSignificance = Info.Significance;
+				Changes[ChangeIndex].NewSignificance = NewSignificances[Index];
+				Changes[ChangeIndex].PostSignificanceFunction = Info.PostSignificanceFunction;
+			}
+			Info.Significance = NewSignificances[Index];
+		}
+	}
+
+	for (const FChangedSignificance& Change : Changes)
+	{
+		UObject* Object = Change.Object.Get();
+		if (Object)
+		{
+			Change.PostSignificanceFunction(Object, Change.OldSignificance, Change.NewSignificance);
+		}
+	}
+}
+
+float FSignificanceManager::GetActorScreenSizeSignificance(const AActor* Actor, const TArray<FTransform>& InViewPoints, float Importance)
+{
+	const USceneComponent* RootComponent = Actor ? Actor->GetRootComponent() : nullptr;
+	if (!RootComponent)
+	{
+		return 0.f;
+	}
+
+	const FBoxSphereBounds& Bounds = RootComponent->Bounds;
+	float Significance = 0.f;
+
+	for (const FTransform& ViewPoint : InViewPoints)
+	{
+		// Inside the bounds counts as filling the screen
+		const float Distance = FMath::Max(FVector::Dist(ViewPoint.GetLocation(), Bounds.Origin), Bounds.SphereRadius);
+		if (Distance > 0.f)
+		{
+			Significance = FMath::Max(Significance, Bounds.SphereRadius / Distance);
+		}
+	}
+
+	return Significance * Importance;
+}
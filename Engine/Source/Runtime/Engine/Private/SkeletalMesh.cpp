@@ -4205,6 +4205,9 @@ void FSkeletalMeshSceneProxy::GetMeshElementsConditionallySelectable(const TArra
 		}
 	}
 
+	// Meshes that were not updated this frame still draw from the skin cache
+	MeshObject->RefreshGPUSkinCache_RenderThread(FRHICommandListExecutor::GetImmediateCommandList());
+
 	const int32 LODIndex = MeshObject->GetLOD();
 	check(LODIndex < SkelMeshResource->LODModels.Num());
 	const FStaticLODModel& LODModel = SkelMeshResource->LODModels[LODIndex];
@@ -27,6 +27,8 @@
 #include "PhysicsEngine/PhysicsAsset.h"
 
 TAutoConsoleVariable<int32> CVarUseParallelAnimationEvaluation(TEXT("a.ParallelAnimEvaluation"), 1, TEXT("If 1, animation evaluation will be run across the task graph system. If 0, evaluation will run purely on the game thread"));
+TAutoConsoleVariable<int32> CVarUseParallelAnimUpdate(TEXT("a.ParallelAnimUpdate"), 1, TEXT("If 1, the graph update of anim instances that allow it is run with the parallel evaluation. If 0, the update runs on the game thread"));
+TAutoConsoleVariable<int32> CVarDedicatedServerSkipBoneRefresh(TEXT("a.DedicatedServerSkipBoneRefresh"), 0, TEXT("If 1, dedicated servers don't refresh the bone transforms of skeletal meshes that nothing reads them from (no enabled physics bodies, attached components or slave components). The pose is still ticked, so root motion and notifies keep working"));
 
 class FParallelAnimationEvaluationTask
 {
@@ -44,7 +46,7 @@ public:
 	}
 	static ENamedThreads::Type GetDesiredThread()
 	{
-		return ENamedThreads::AnyThread;
+		return ENamedThreads::AnyHiPriThread; // the game thread waits on it this frame
 	}
 	static ESubsequentsMode::Type GetSubsequentsMode()
 	{
@@ -137,6 +139,10 @@ USkeletalMeshComponent::USkeletalMeshComponent(const FObjectInitializer& ObjectI
 	RagdollAggregateThreshold = UPhysicsSettings::Get()->RagdollAggregateThreshold;
 
 	bTickInEditor = true;
+
+	bDeferAnimGraphUpdate = false;
+	bPendingAnimGraphUpdate = false;
+	PendingAnimGraphUpdateDeltaTime = 0.0f;
 }
 
 
@@ -444,15 +450,51 @@ void USkeletalMeshComponent::LoadedFromAnotherClass(const FName& OldClassName)
 }
 #endif // WITH_EDITOR
 
+/** Overrides the morph target curves of an anim instance with the ones set on the component */
+static void OverrideMorphTargetCurves(const TMap<FName, float>& ComponentCurves, TMap<FName, float>& OutAnimCurves)
+{
+	for( auto Iter = ComponentCurves.CreateConstIterator(); Iter; ++Iter )
+	{
+		float *CurveValPtr = OutAnimCurves.Find(Iter.Key());
+		if ( CurveValPtr )
+		{
+			// override the value if Kismet request was made
+			*CurveValPtr = Iter.Value();
+		}
+		else
+		{
+			OutAnimCurves.Add(Iter.Key(), Iter.Value());
+		}				
+	}
+}
+
 void USkeletalMeshComponent::TickAnimation(float DeltaTime)
 {
 	SCOPE_CYCLE_COUNTER(STAT_AnimTickTime);
+	MEMORY_TAG_SCOPE(Animation);
 	if (SkeletalMesh != NULL)
 	{
 		if (AnimScriptInstance != NULL)
 		{
-			// Tick the animation
-			AnimScriptInstance->UpdateAnimation(DeltaTime * GlobalAnimRateScale);
+			const float AnimDeltaTime = DeltaTime * GlobalAnimRateScale;
+
+			if (bDeferAnimGraphUpdate && AnimScriptInstance->CanUpdateAnimationGraphInParallel())
+			{
+				// Only the blueprint update and the montages run here, the graph is updated by the evaluation task started in RefreshBoneTransforms
+				if (AnimScriptInstance->PreUpdateAnimation(AnimDeltaTime))
+				{
+					AnimScriptInstance->Montage_Advance(AnimDeltaTime);
+
+					bPendingAnimGraphUpdate = true;
+					PendingAnimGraphUpdateDeltaTime = AnimDeltaTime;
+					return;
+				}
+			}
+			else
+			{
+				// Tick the animation
+				AnimScriptInstance->UpdateAnimation(AnimDeltaTime);
+			}
 
 			// TODO @LinaH - I've hit access violations due to AnimScriptInstance being NULL after this, probably due to
 			// AnimNotifies?  Please take a look and fix as we discussed.  Temporary fix:
@@ -462,49 +504,73 @@ void USkeletalMeshComponent::TickAnimation(float DeltaTime)
 				// add MorphTarget Curves from Kismet driven or any other source
 				// and overwrite if it exists
 				// Tick always should maintain this list, not Evaluate
-				for( auto Iter = MorphTargetCurves.CreateConstIterator(); Iter; ++Iter )
-				{
-					float *CurveValPtr = AnimScriptInstance->MorphTargetCurves.Find(Iter.Key());
-					if ( CurveValPtr )
-					{
-						// override the value if Kismet request was made
-						*CurveValPtr = Iter.Value();
-					}
-					else
-					{
-						AnimScriptInstance->MorphTargetCurves.Add(Iter.Key(), Iter.Value());
-					}				
-				}
+				OverrideMorphTargetCurves(MorphTargetCurves, AnimScriptInstance->MorphTargetCurves);
+
+				UpdateAnimMaterialParameters();
+			}
+		}
+	}
+}
+
+void USkeletalMeshComponent::FinishPendingAnimGraphUpdate()
+{
+	bPendingAnimGraphUpdate = false;
+
+	if (AnimScriptInstance != NULL)
+	{
+		AnimScriptInstance->UpdateAnimationGraph(PendingAnimGraphUpdateDeltaTime);
+		AnimScriptInstance->PostUpdateAnimation(PendingAnimGraphUpdateDeltaTime);
+
+		if (AnimScriptInstance != NULL)
+		{
+			OverrideMorphTargetCurves(MorphTargetCurves, AnimScriptInstance->MorphTargetCurves);
+
+			UpdateAnimMaterialParameters();
+		}
+	}
+}
+
+void USkeletalMeshComponent::PostAnimGraphUpdate(float DeltaTime)
+{
+	if (AnimScriptInstance != NULL)
+	{
+		// Morph target curves were applied on the evaluation task
+		AnimScriptInstance->PostUpdateAnimation(DeltaTime);
+
+		if (AnimScriptInstance != NULL)
+		{
+			UpdateAnimMaterialParameters();
+		}
+	}
+}
+
+void USkeletalMeshComponent::UpdateAnimMaterialParameters()
+{
+	if(AnimScriptInstance->MaterialParameterCurves.Num() > 0)
+	{
+		for( auto Iter = AnimScriptInstance->MaterialParameterCurves.CreateConstIterator(); Iter; ++Iter )
+		{
+			FName ParameterName = Iter.Key();
+			float ParameterValue = Iter.Value();
 
-				//Update material parameters
-				if(AnimScriptInstance->MaterialParameterCurves.Num() > 0)
+			for(int32 MaterialIndex = 0; MaterialIndex < GetNumMaterials(); ++MaterialIndex)
+			{
+				UMaterialInterface* MaterialInterface = GetMaterial(MaterialIndex);
+				if (MaterialInterface)
 				{
-					for( auto Iter = AnimScriptInstance->MaterialParameterCurves.CreateConstIterator(); Iter; ++Iter )
+					float TestValue; //not used but needed for GetScalarParameterValue call
+					if(MaterialInterface->GetScalarParameterValue(ParameterName,TestValue))
 					{
-						FName ParameterName = Iter.Key();
-						float ParameterValue = Iter.Value();
-
-						for(int32 MaterialIndex = 0; MaterialIndex < GetNumMaterials(); ++MaterialIndex)
+						UMaterialInstanceDynamic* DynamicMaterial = Cast<UMaterialInstanceDynamic>(MaterialInterface);
+						if(!DynamicMaterial) //Is it already a UMaterialInstanceDynamic (ie we used it last tick)
 						{
-							UMaterialInterface* MaterialInterface = GetMaterial(MaterialIndex);
-							if (MaterialInterface)
-							{
-								float TestValue; //not used but needed for GetScalarParameterValue call
-								if(MaterialInterface->GetScalarParameterValue(ParameterName,TestValue))
-								{
-									UMaterialInstanceDynamic* DynamicMaterial = Cast<UMaterialInstanceDynamic>(MaterialInterface);
-									if(!DynamicMaterial) //Is it already a UMaterialInstanceDynamic (ie we used it last tick)
-									{
-										DynamicMaterial = CreateAndSetMaterialInstanceDynamic(MaterialIndex);
-									}
-									DynamicMaterial->SetScalarParameterValue(ParameterName, ParameterValue);
-								
-									//Assume that we only set the parameter on one of the materials, remove this break
-									//if that is no longer desired
-									break;
-								}
-							}
+							DynamicMaterial = CreateAndSetMaterialInstanceDynamic(MaterialIndex);
 						}
+						DynamicMaterial->SetScalarParameterValue(ParameterName, ParameterValue);
+					
+						//Assume that we only set the parameter on one of the materials, remove this break
+						//if that is no longer desired
+						break;
 					}
 				}
 			}
@@ -541,10 +607,22 @@ bool USkeletalMeshComponent::ShouldUpdateTransform(bool bLODHasChanged) const
 	// If forcing RefPose we can skip updating the skeleton for perf, except if it's using MorphTargets.
 	const bool bSkipBecauseOfRefPose = bForceRefpose && bOldForceRefPose && (MorphTargetCurves.Num() == 0) && ((AnimScriptInstance)? AnimScriptInstance->MorphTargetCurves.Num() == 0 : true);
 
+	// Nothing renders on a dedicated server, so the bones are only needed by what reads them on the game thread
+	if (!bLODHasChanged && IsRunningDedicatedServer() && CVarDedicatedServerSkipBoneRefresh.GetValueOnGameThread() && !NeedsBoneTransformsOnDedicatedServer())
+	{
+		return false;
+	}
+
 	// LOD changing should always trigger an update.
 	return (bLODHasChanged || (!bNoSkeletonUpdate && !bSkipBecauseOfRefPose && Super::ShouldUpdateTransform(bLODHasChanged)));
 }
 
+bool USkeletalMeshComponent::NeedsBoneTransformsOnDedicatedServer() const
+{
+	// Bodies follow the bones for hit detection, sockets for the attached components, and slaves copy the pose
+	return (Bodies.Num() > 0 && IsCollisionEnabled()) || AttachChildren.Num() > 0 || SlavePoseComponents.Num() > 0;
+}
+
 bool USkeletalMeshComponent::ShouldTickPose() const
 {
 	// When we stop root motion we go back to ticking after CharacterMovement. Unfortunately that means that we could tick twice that frame.
@@ -561,8 +639,19 @@ void USkeletalMeshComponent::TickPose(float DeltaTime)
 
 void USkeletalMeshComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
+	// The graph update is only left to the evaluation task when the pose is ticked from here, RefreshBoneTransforms follows
+	bDeferAnimGraphUpdate = ThisTickFunction && CVarUseParallelAnimUpdate.GetValueOnGameThread() && CVarUseParallelAnimationEvaluation.GetValueOnGameThread();
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	bDeferAnimGraphUpdate = false;
+
+	// The bones weren't refreshed this tick, finish the update here
+	if (bPendingAnimGraphUpdate)
+	{
+		FinishPendingAnimGraphUpdate();
+	}
+
 	// Update bOldForceRefPose
 	bOldForceRefPose = bForceRefpose;
 }
@@ -907,6 +996,7 @@ void USkeletalMeshComponent::UpdateSlaveComponent()
 void USkeletalMeshComponent::PerformAnimationEvaluation(const USkeletalMesh* InSkeletalMesh, UAnimInstance* InAnimInstance, TArray<FTransform>& OutSpaceBases, TArray<FTransform>& OutLocalAtoms, TArray<FActiveVertexAnim>& OutVertexAnims, FVector& OutRootBoneTranslation) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_PerformAnimEvaluation);
+	MEMORY_TAG_SCOPE(Animation);
 	// Can't do anything without a SkeletalMesh
 	// Do nothing more if no bones in skeleton.
 	if (!InSkeletalMesh || OutSpaceBases.Num() == 0)
@@ -923,6 +1013,7 @@ void USkeletalMeshComponent::PerformAnimationEvaluation(const USkeletalMesh* InS
 void USkeletalMeshComponent::RefreshBoneTransforms(FActorComponentTickFunction* TickFunction)
 {
 	SCOPE_CYCLE_COUNTER(STAT_RefreshBoneTransforms);
+	MEMORY_TAG_SCOPE(Animation);
 
 	if (!SkeletalMesh || GetNumSpaceBases() == 0)
 	{
@@ -972,6 +1063,15 @@ void USkeletalMeshComponent::RefreshBoneTransforms(FActorComponentTickFunction*
 			AnimEvaluationContext.VertexAnims = ActiveVertexAnims;
 		}
 
+		if (bPendingAnimGraphUpdate)
+		{
+			// The task updates the graph before evaluating it, with a copy of the curves that can be changed on the game thread meanwhile
+			bPendingAnimGraphUpdate = false;
+			AnimEvaluationContext.bDoUpdate = true;
+			AnimEvaluationContext.UpdateDeltaTime = PendingAnimGraphUpdateDeltaTime;
+			AnimEvaluationContext.MorphTargetCurves = MorphTargetCurves;
+		}
+
 		// start parallel work
 		FGraphEventRef EvaluationTickEvent = TGraphTask<FParallelAnimationEvaluationTask>::CreateTask().ConstructAndDispatchWhenReady(this);
 
@@ -984,6 +1084,11 @@ void USkeletalMeshComponent::RefreshBoneTransforms(FActorComponentTickFunction*
 	}
 	else
 	{
+		if (bPendingAnimGraphUpdate)
+		{
+			FinishPendingAnimGraphUpdate();
+		}
+
 		if (AnimEvaluationContext.bDoEvaluation)
 		{
 			if (AnimEvaluationContext.bDoInterpolation)
@@ -1006,6 +1111,44 @@ void USkeletalMeshComponent::RefreshBoneTransforms(FActorComponentTickFunction*
 
 }
 
+void USkeletalMeshComponent::ParallelAnimationEvaluation()
+{
+	if (AnimEvaluationContext.bDoUpdate && AnimEvaluationContext.AnimInstance)
+	{
+		AnimEvaluationContext.AnimInstance->UpdateAnimationGraph(AnimEvaluationContext.UpdateDeltaTime);
+		OverrideMorphTargetCurves(AnimEvaluationContext.MorphTargetCurves, AnimEvaluationContext.AnimInstance->MorphTargetCurves);
+	}
+
+	PerformAnimationEvaluation(AnimEvaluationContext.SkeletalMesh, AnimEvaluationContext.AnimInstance, AnimEvaluationContext.SpaceBases, AnimEvaluationContext.LocalAtoms, AnimEvaluationContext.VertexAnims, AnimEvaluationContext.RootBoneTranslation);
+}
+
+void USkeletalMeshComponent::CompleteParallelAnimationEvaluation()
+{
+	if ((AnimEvaluationContext.AnimInstance == AnimScriptInstance) && (AnimEvaluationContext.SkeletalMesh == SkeletalMesh) && (AnimEvaluationContext.SpaceBases.Num() == GetNumSpaceBases()))
+	{
+		Exchange(AnimEvaluationContext.SpaceBases, AnimEvaluationContext.bDoInterpolation ? CachedSpaceBases : GetEditableSpaceBases() );
+		Exchange(AnimEvaluationContext.LocalAtoms, AnimEvaluationContext.bDoInterpolation ? CachedLocalAtoms : LocalAtoms);
+		Exchange(AnimEvaluationContext.VertexAnims, ActiveVertexAnims);
+		Exchange(AnimEvaluationContext.RootBoneTranslation, RootBoneTranslation);
+
+		// PostAnimEvaluation clears the context
+		const bool bDidUpdate = AnimEvaluationContext.bDoUpdate;
+		const float UpdateDeltaTime = AnimEvaluationContext.UpdateDeltaTime;
+
+		PostAnimEvaluation(AnimEvaluationContext);
+
+		if (bDidUpdate)
+		{
+			// Notifies and material parameters of the update that ran on the task
+			PostAnimGraphUpdate(UpdateDeltaTime);
+		}
+	}
+	else
+	{
+		AnimEvaluationContext.Clear();
+	}
+}
+
 void USkeletalMeshComponent::PostAnimEvaluation(FAnimationEvaluationContext& EvaluationContext)
 {
 	if (AnimScriptInstance)
@@ -285,7 +285,7 @@ void FSkeletalMeshObjectGPUSkin::UpdateDynamicData_RenderThread(FRHICommandListI
 			ShaderData.UpdateBoneData(FeatureLevel);
 
 			// Try to use the GPU skinning cache if possible
-			if (bGPUSkinCacheEnabled && ChunkIdx < MAX_GPUSKINCACHE_CHUNKS_PER_LOD && !bClothFactory && Chunk.MaxBoneInfluences > 0 && DynamicData->NumWeightedActiveVertexAnims <= 0)
+			if (bGPUSkinCacheEnabled && CanUseGPUSkinCache(ChunkIdx, Chunk, bClothFactory))
 			{
 				int32 Key = GGPUSkinCache.StartCacheMesh(RHICmdList, GPUSkinCacheKeys[ChunkIdx], &VertexFactoryData.VertexFactories[ChunkIdx], &VertexFactoryData.PassthroughVertexFactories[ChunkIdx], Chunk, this, Chunk.HasExtraBoneInfluences());
 				if(Key >= 0)
@@ -429,6 +429,46 @@ void FSkeletalMeshObjectGPUSkin::FSkeletalMeshObjectLOD::UpdateMorphVertexBuffer
 	}
 }
 
+bool FSkeletalMeshObjectGPUSkin::CanUseGPUSkinCache(int32 ChunkIdx, const FSkelMeshChunk& Chunk, bool bClothFactory) const
+{
+	return ChunkIdx < MAX_GPUSKINCACHE_CHUNKS_PER_LOD && !bClothFactory && Chunk.MaxBoneInfluences > 0 && DynamicData->NumWeightedActiveVertexAnims <= 0;
+}
+
+void FSkeletalMeshObjectGPUSkin::RefreshGPUSkinCache_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+	if (!GEnableGPUSkinCache || !GGPUSkinCacheReuse || FeatureLevel < ERHIFeatureLevel::SM5 || !DynamicData)
+	{
+		return;
+	}
+
+	// Only the chunks of the LOD being rendered, with the bones of the last update still in their vertex factories.
+	// Chunks updated or still reusing a recent output this frame are left alone.
+	FSkeletalMeshObjectLOD& LOD = LODs[DynamicData->LODIndex];
+	FVertexFactoryData& VertexFactoryData = LOD.GPUSkinVertexFactories;
+	const TArray<FSkelMeshChunk>& Chunks = GetRenderChunks(DynamicData->LODIndex);
+
+	if (VertexFactoryData.VertexFactories.Num() < Chunks.Num())
+	{
+		return;
+	}
+
+	for (int32 ChunkIdx = 0; ChunkIdx < Chunks.Num(); ChunkIdx++)
+	{
+		const FSkelMeshChunk& Chunk = Chunks[ChunkIdx];
+		const bool bClothFactory = (DynamicData->ClothSimulUpdateData.Num() > 0) && Chunk.HasApexClothData();
+
+		if (CanUseGPUSkinCache(ChunkIdx, Chunk, bClothFactory)
+			&& !GGPUSkinCache.IsElementProcessed(GPUSkinCacheKeys[ChunkIdx], &VertexFactoryData.PassthroughVertexFactories[ChunkIdx]))
+		{
+			int32 Key = GGPUSkinCache.StartCacheMesh(RHICmdList, GPUSkinCacheKeys[ChunkIdx], &VertexFactoryData.VertexFactories[ChunkIdx], &VertexFactoryData.PassthroughVertexFactories[ChunkIdx], Chunk, this, Chunk.HasExtraBoneInfluences());
+			if (Key >= 0)
+			{
+				GPUSkinCacheKeys[ChunkIdx] = (int16)Key;
+			}
+		}
+	}
+}
+
 const FVertexFactory* FSkeletalMeshObjectGPUSkin::GetVertexFactory(int32 LODIndex,int32 ChunkIdx) const
 {
 	checkSlow( LODs.IsValidIndex(LODIndex) );
@@ -453,7 +493,7 @@ const FVertexFactory* FSkeletalMeshObjectGPUSkin::GetVertexFactory(int32 LODInde
 	else
 	{
 		// If the GPU skinning cache was used, return the passthrough vertex factory
-		if (GGPUSkinCache.IsElementProcessed(GPUSkinCacheKeys[ChunkIdx]))
+		if (GGPUSkinCache.IsElementProcessed(GPUSkinCacheKeys[ChunkIdx], &LOD.GPUSkinVertexFactories.PassthroughVertexFactories[ChunkIdx]))
 		{
 			return &LOD.GPUSkinVertexFactories.PassthroughVertexFactories[ChunkIdx];
 		}
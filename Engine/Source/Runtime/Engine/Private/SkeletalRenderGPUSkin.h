@@ -249,6 +249,7 @@ public:
 	virtual void ReleaseResources() override;
 	virtual void Update(int32 LODIndex,USkinnedMeshComponent* InMeshComponent,const TArray<FActiveVertexAnim>& ActiveVertexAnims) override;
 	virtual void UpdateDynamicData_RenderThread(FRHICommandListImmediate& RHICmdList, FDynamicSkelMeshObjectData* InDynamicData) override;
+	virtual void RefreshGPUSkinCache_RenderThread(FRHICommandListImmediate& RHICmdList) override;
 	virtual const FVertexFactory* GetVertexFactory(int32 LODIndex,int32 ChunkIdx) const override;
 	virtual void CacheVertices(int32 LODIndex, bool bForce) const override {}
 	virtual bool IsCPUSkinned() const override { return false; }
@@ -494,6 +495,11 @@ private:
 	*/
 	void ReleaseMorphResources();
 
+	/**
+	* Whether a chunk of the current LOD can be skinned in the GPU skin cache rather than in the vertex shader.
+	*/
+	bool CanUseGPUSkinCache(int32 ChunkIdx, const FSkelMeshChunk& Chunk, bool bClothFactory) const;
+
 	/** Render data for each LOD */
 	TArray<struct FSkeletalMeshObjectLOD> LODs;
 
@@ -1784,6 +1784,13 @@ void USkinnedMeshComponent::AnimUpdateRateTick()
 		CurrentComponent = (ComponentStack.Num() > 0) ? ComponentStack.Pop() : NULL;
 	}
 
+	// Actors registered to the significance manager use their significance as screen size, so all the systems agree on it
+	float Significance;
+	if (GetWorld()->GetSignificanceManager().QuerySignificance(Owner, Significance))
+	{
+		MaxDistanceFactor = Significance;
+	}
+
 	// Figure out which update rate should be used.
 	AnimUpdateRateSetParams(bRecentlyRendered, MaxDistanceFactor, bPlayingRootMotion);
 }
@@ -777,7 +777,11 @@ void USplineMeshComponent::RecreateCollision()
 			}
 		}
 
-		BodySetup->CreatePhysicsMeshes();
+		// Cook off the game thread until the physics state is created. GetBodySetup needs the tri mesh right away if there is no simple collision
+		if (BodySetup->AggGeom.GetElementCount() == 0 || !BodySetup->BeginAsyncCook())
+		{
+			BodySetup->CreatePhysicsMeshes();
+		}
 		CachedMeshBodySetupGuid = StaticMesh->BodySetup->BodySetupGuid;
 	}
 	else
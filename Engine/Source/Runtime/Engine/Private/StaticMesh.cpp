@@ -30,6 +30,14 @@ DEFINE_LOG_CATEGORY(LogStaticMesh);
 /** Package name, that if set will cause only static meshes in that package to be rebuilt based on SM version. */
 ENGINE_API FName GStaticMeshPackageNameToRebuild = NAME_None;
 
+static TAutoConsoleVariable<int32> CVarMeshStreaming(
+	TEXT("r.MeshStreaming"),
+	1,
+	TEXT("Whether the LODs of the static meshes cooked with bStreamLODs are streamed.\n")
+	TEXT("0: the streamed LODs are loaded with the mesh, 1: they are only loaded when they are wanted (default).\n")
+	TEXT("Only affects the meshes loaded afterwards."),
+	ECVF_Default);
+
 /*-----------------------------------------------------------------------------
 	FStaticMeshVertexBuffer
 -----------------------------------------------------------------------------*/
@@ -295,25 +303,80 @@ void FStaticMeshLODResources::Serialize(FArchive& Ar, UObject* Owner, int32 Inde
 
 	if( !StripFlags.IsDataStrippedForServer() )
 	{
-		PositionVertexBuffer.Serialize( Ar, bNeedsCPUAccess );
-		VertexBuffer.Serialize( Ar, bNeedsCPUAccess );
-		ColorVertexBuffer.Serialize( Ar, bNeedsCPUAccess );
-		IndexBuffer.Serialize( Ar, bNeedsCPUAccess );
-		DepthOnlyIndexBuffer.Serialize(Ar, bNeedsCPUAccess);
+		const bool bSerializeWireframe = !StripFlags.IsEditorDataStripped();
+		const bool bSerializeAdjacency = !StripFlags.IsClassDataStripped( AdjacencyDataStripFlag );
+
+		// bIsLODStreamed is set by FStaticMeshRenderData::Serialize while cooking
+		Ar << bIsLODStreamed;
 
-		if( !StripFlags.IsEditorDataStripped() )
+		if (!bIsLODStreamed)
 		{
-			WireframeIndexBuffer.Serialize(Ar, bNeedsCPUAccess);
+			SerializeBuffers(Ar, bNeedsCPUAccess, bSerializeWireframe, bSerializeAdjacency);
 		}
-
-		if ( !StripFlags.IsClassDataStripped( AdjacencyDataStripFlag ) )
+		else
 		{
-			AdjacencyIndexBuffer.Serialize( Ar, bNeedsCPUAccess );
-			bHasAdjacencyInfo = AdjacencyIndexBuffer.GetNumIndices() != 0;
+			if (Ar.IsSaving())
+			{
+				TArray<uint8> Payload;
+				FMemoryWriter PayloadAr(Payload, /*bIsPersistent=*/ true);
+				PayloadAr.SetByteSwapping(Ar.ForceByteSwapping());
+				SerializeStreamedBuffers(PayloadAr, bSerializeWireframe, bSerializeAdjacency);
+
+				StreamingBulkData.Lock(LOCK_READ_WRITE);
+				FMemory::Memcpy(StreamingBulkData.Realloc(Payload.Num()), Payload.GetData(), Payload.Num());
+				StreamingBulkData.Unlock();
+			}
+
+			StreamingBulkData.Serialize(Ar, Owner, Index);
+
+			// Without streaming the payload is loaded with the mesh, which then behaves as if the LOD wasn't streamed.
+#if WITH_EDITOR
+			// LoadIntoAsync needs the file of the payload, which editor builds don't keep
+			const bool bCanStream = false;
+#else
+			const bool bCanStream = !bNeedsCPUAccess && CVarMeshStreaming.GetValueOnAnyThread() != 0 && StreamingBulkData.CanLoadFromDisk();
+#endif
+			if (Ar.IsLoading() && !bCanStream)
+			{
+				void* Payload = NULL;
+				StreamingBulkData.GetCopy(&Payload, true);
+
+				FBufferReader PayloadAr(Payload, StreamingBulkData.GetBulkDataSize(), /*bInFreeOnClose=*/ true, /*bIsPersistent=*/ true);
+				SerializeStreamedBuffers(PayloadAr, false, false);
+				bIsLODStreamed = false;
+			}
 		}
 	}
 }
 
+void FStaticMeshLODResources::SerializeStreamedBuffers(FArchive& Ar, bool bSerializeWireframe, bool bSerializeAdjacency)
+{
+	// The streamed payload is only loaded by cooked builds, which never need the resource data
+	Ar << bSerializeWireframe;
+	Ar << bSerializeAdjacency;
+	SerializeBuffers(Ar, /*bNeedsCPUAccess=*/ false, bSerializeWireframe, bSerializeAdjacency);
+}
+
+void FStaticMeshLODResources::SerializeBuffers(FArchive& Ar, bool bNeedsCPUAccess, bool bSerializeWireframe, bool bSerializeAdjacency)
+{
+	PositionVertexBuffer.Serialize( Ar, bNeedsCPUAccess );
+	VertexBuffer.Serialize( Ar, bNeedsCPUAccess );
+	ColorVertexBuffer.Serialize( Ar, bNeedsCPUAccess );
+	IndexBuffer.Serialize( Ar, bNeedsCPUAccess );
+	DepthOnlyIndexBuffer.Serialize(Ar, bNeedsCPUAccess);
+
+	if( bSerializeWireframe )
+	{
+		WireframeIndexBuffer.Serialize(Ar, bNeedsCPUAccess);
+	}
+
+	if ( bSerializeAdjacency )
+	{
+		AdjacencyIndexBuffer.Serialize( Ar, bNeedsCPUAccess );
+		bHasAdjacencyInfo = AdjacencyIndexBuffer.GetNumIndices() != 0;
+	}
+}
+
 int32 FStaticMeshLODResources::GetNumTriangles() const
 {
 	int32 NumTriangles = 0;
@@ -474,6 +537,7 @@ FStaticMeshLODResources::FStaticMeshLODResources()
 	: DistanceFieldData(NULL)
 	, MaxDeviation(0.0f)
 	, bHasAdjacencyInfo(false)
+	, bIsLODStreamed(false)
 {
 }
 
@@ -483,6 +547,16 @@ FStaticMeshLODResources::~FStaticMeshLODResources()
 }
 
 void FStaticMeshLODResources::InitResources(UStaticMesh* Parent)
+{
+	InitVertexResources(Parent);
+
+	if (DistanceFieldData)
+	{
+		DistanceFieldData->VolumeTexture.Initialize();
+	}
+}
+
+void FStaticMeshLODResources::InitVertexResources(UStaticMesh* Parent)
 {
 	const auto MaxShaderPlatform = GShaderPlatformForFeatureLevel[GMaxRHIFeatureLevel];
 
@@ -523,11 +597,6 @@ void FStaticMeshLODResources::InitResources(UStaticMesh* Parent)
 	InitVertexFactory(VertexFactory, Parent, NULL);
 	BeginInitResource(&VertexFactory);
 
-	if (DistanceFieldData)
-	{
-		DistanceFieldData->VolumeTexture.Initialize();
-	}
-
 	const uint32 StaticMeshVertexMemory = 
 		VertexBuffer.GetStride() * VertexBuffer.GetNumVertices() + 
 		PositionVertexBuffer.GetStride() * PositionVertexBuffer.GetNumVertices();
@@ -542,6 +611,16 @@ void FStaticMeshLODResources::InitResources(UStaticMesh* Parent)
 }
 
 void FStaticMeshLODResources::ReleaseResources()
+{
+	ReleaseVertexResources();
+
+	if (DistanceFieldData)
+	{
+		DistanceFieldData->VolumeTexture.Release();
+	}
+}
+
+void FStaticMeshLODResources::ReleaseVertexResources()
 {
 	// TODO: The sizes for index buffers will be incorrect outside of the editor because we will have freed the CPU arrays.
 	const uint32 StaticMeshVertexMemory = 
@@ -572,11 +651,6 @@ void FStaticMeshLODResources::ReleaseResources()
 
 	// Release the vertex factories.
 	BeginReleaseResource(&VertexFactory);
-
-	if (DistanceFieldData)
-	{
-		DistanceFieldData->VolumeTexture.Release();
-	}
 }
 
 /*------------------------------------------------------------------------------
@@ -584,7 +658,8 @@ void FStaticMeshLODResources::ReleaseResources()
 ------------------------------------------------------------------------------*/
 
 FStaticMeshRenderData::FStaticMeshRenderData()
-	: MaxStreamingTextureFactor(0.0f)
+	: CurrentFirstLODIdx(0)
+	, MaxStreamingTextureFactor(0.0f)
 	, bLODsShareStaticLighting(false)
 {
 	for (int32 LODIndex = 0; LODIndex < MAX_STATIC_MESH_LODS; ++LODIndex)
@@ -616,8 +691,29 @@ void FStaticMeshRenderData::Serialize(FArchive& Ar, UStaticMesh* Owner, bool bCo
 
 #endif // #if WITH_EDITORONLY_DATA
 
+#if WITH_EDITOR
+	// All the LODs but the last one can be streamed, so there is always one to render. The flags only apply to the cooked data
+	const bool bStreamLODs = bCooked && Ar.IsSaving() && Owner->bStreamLODs;
+	for (int32 LODIndex = 0; bStreamLODs && LODIndex < LODResources.Num() - 1; ++LODIndex)
+	{
+		LODResources[LODIndex].bIsLODStreamed = true;
+	}
+#endif // #if WITH_EDITOR
+
 	LODResources.Serialize(Ar, Owner);
 
+#if WITH_EDITOR
+	for (int32 LODIndex = 0; bStreamLODs && LODIndex < LODResources.Num(); ++LODIndex)
+	{
+		LODResources[LODIndex].bIsLODStreamed = false;
+	}
+#endif // #if WITH_EDITOR
+
+	if (Ar.IsLoading())
+	{
+		CurrentFirstLODIdx = GetNumStreamedLODs();
+	}
+
 	// Inline the distance field derived data for cooked builds
 	if (bCooked)
 	{
@@ -672,7 +768,15 @@ void FStaticMeshRenderData::InitResources(UStaticMesh* Owner)
 
 	for (int32 LODIndex = 0; LODIndex < LODResources.Num(); ++LODIndex)
 	{
-		LODResources[LODIndex].InitResources(Owner);
+		// The distance field data of the streamed out LODs is still used
+		if (LODIndex >= CurrentFirstLODIdx)
+		{
+			LODResources[LODIndex].InitResources(Owner);
+		}
+		else if (LODResources[LODIndex].DistanceFieldData)
+		{
+			LODResources[LODIndex].DistanceFieldData->VolumeTexture.Initialize();
+		}
 	}
 }
 
@@ -680,7 +784,14 @@ void FStaticMeshRenderData::ReleaseResources()
 {
 	for (int32 LODIndex = 0; LODIndex < LODResources.Num(); ++LODIndex)
 	{
-		LODResources[LODIndex].ReleaseResources();
+		if (LODIndex >= CurrentFirstLODIdx)
+		{
+			LODResources[LODIndex].ReleaseResources();
+		}
+		else if (LODResources[LODIndex].DistanceFieldData)
+		{
+			LODResources[LODIndex].DistanceFieldData->VolumeTexture.Release();
+		}
 	}
 }
 
@@ -693,6 +804,16 @@ void FStaticMeshRenderData::AllocateLODResources(int32 NumLODs)
 	}
 }
 
+int32 FStaticMeshRenderData::GetNumStreamedLODs() const
+{
+	int32 NumStreamedLODs = 0;
+	while (NumStreamedLODs < LODResources.Num() && LODResources[NumStreamedLODs].bIsLODStreamed)
+	{
+		NumStreamedLODs++;
+	}
+	return NumStreamedLODs;
+}
+
 #if WITH_EDITOR
 /**
  * Calculates the view distance that a mesh should be displayed at.
@@ -1026,7 +1147,7 @@ FArchive& operator<<(FArchive& Ar, FMeshBuildSettings& BuildSettings)
 // differences, etc.) replace the version GUID below with a new one.
 // In case of merge conflicts with DDC versions, you MUST generate a new GUID
 // and set this new GUID as the version.
-#define STATICMESH_DERIVEDDATA_VER TEXT("46A8778361B442A9523C54440EA1E9D")
+#define STATICMESH_DERIVEDDATA_VER TEXT("15A4D74430F9459DB68799CAA41A328")
 
 static const FString& GetStaticMeshDerivedDataVersion()
 {
@@ -1204,6 +1325,11 @@ void UStaticMesh::InitResources()
 	if (RenderData)
 	{
 		RenderData->InitResources(this);
+
+		if (RenderData->GetNumStreamedLODs() > 0)
+		{
+			IStreamingManager::Get().GetMeshStreamingManager().AddStreamingMesh(this);
+		}
 	}
 
 #if STATS
@@ -1314,7 +1440,7 @@ bool UStaticMesh::HasValidRenderData() const
 	return RenderData != NULL
 		&& RenderData->LODResources.Num() > 0
 		&& RenderData->LODResources.GetData() != NULL
-		&& RenderData->LODResources[0].VertexBuffer.GetNumVertices() > 0;
+		&& RenderData->LODResources[RenderData->CurrentFirstLODIdx].VertexBuffer.GetNumVertices() > 0;
 }
 
 FBoxSphereBounds UStaticMesh::GetBounds() const
@@ -1364,6 +1490,12 @@ void UStaticMesh::ReleaseResources()
 
 	if (RenderData)
 	{
+		// Waits for the LODs being streamed in, the LODs it streamed in are released below
+		if (!IStreamingManager::HasShutdown() && IStreamingManager::Get().GetMeshStreamingManager().IsManagedStreamingMesh(this))
+		{
+			IStreamingManager::Get().GetMeshStreamingManager().RemoveStreamingMesh(this);
+		}
+
 		RenderData->ReleaseResources();
 	}
 
@@ -1977,7 +2109,7 @@ bool UStaticMesh::ContainsPhysicsTriMeshData(bool bInUseAllTriData) const
 {
 	if (RenderData
 		&& RenderData->LODResources.Num() > 0
-		&& RenderData->LODResources[0].PositionVertexBuffer.GetNumVertices() > 0)
+		&& RenderData->LODResources[RenderData->CurrentFirstLODIdx].PositionVertexBuffer.GetNumVertices() > 0)
 	{
 		// In non-cooked builds we need to look at the section info map to get
 		// accurate per-section info.
@@ -492,7 +492,7 @@ void UStaticMeshComponent::GetStreamingTextureInfo(TArray<FStreamingTexturePrimi
 		bool bHasValidLightmapCoordinates = ((StaticMesh->LightMapCoordinateIndex >= 0)
 			&& StaticMesh->RenderData
 			&& StaticMesh->RenderData->LODResources.Num() > 0
-			&& ((uint32)StaticMesh->LightMapCoordinateIndex < StaticMesh->RenderData->LODResources[0].VertexBuffer.GetNumTexCoords()));
+			&& ((uint32)StaticMesh->LightMapCoordinateIndex < StaticMesh->RenderData->LODResources[StaticMesh->RenderData->CurrentFirstLODIdx].VertexBuffer.GetNumTexCoords()));
 
 		// We need to come up with a compensation factor for spline deformed meshes
 		float SplineDeformFactor = 1.f;
@@ -1365,7 +1365,7 @@ bool UStaticMeshComponent::HasLightmapTextureCoordinates() const
 		(StaticMesh->RenderData != NULL) &&
 		(StaticMesh->RenderData->LODResources.Num() > 0) &&
 		(StaticMesh->LightMapCoordinateIndex >= 0) &&	
-		((uint32)StaticMesh->LightMapCoordinateIndex < StaticMesh->RenderData->LODResources[0].VertexBuffer.GetNumTexCoords()))
+		((uint32)StaticMesh->LightMapCoordinateIndex < StaticMesh->RenderData->LODResources[StaticMesh->RenderData->CurrentFirstLODIdx].VertexBuffer.GetNumTexCoords()))
 	{
 		return true;
 	}
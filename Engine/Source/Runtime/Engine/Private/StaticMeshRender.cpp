@@ -14,6 +14,7 @@
 #include "ComponentReregisterContext.h"
 #include "Components/BrushComponent.h"
 #include "AI/Navigation/NavCollision.h"
+#include "Containers/PagedFixedSizeAllocator.h"
 
 /** If true, optimized depth-only index buffers are used for shadow rendering. */
 static bool GUseShadowIndexBuffer = true;
@@ -48,6 +49,30 @@ static FAutoConsoleCommand GToggleForceDefaultMaterialCmd(
 	FConsoleCommandDelegate::CreateStatic(ToggleForceDefaultMaterial)
 	);
 
+/** Paged pool for FStaticMeshSceneProxy, 64KB pages. */
+static FPagedFixedSizeAllocator GStaticMeshSceneProxyAllocator(sizeof(FStaticMeshSceneProxy), FMath::Max<uint32>(65536 / sizeof(FStaticMeshSceneProxy), 1));
+
+void* FStaticMeshSceneProxy::operator new(size_t Size)
+{
+	if (Size == sizeof(FStaticMeshSceneProxy))
+	{
+		return GStaticMeshSceneProxyAllocator.Allocate();
+	}
+	return FMemory::Malloc(Size);
+}
+
+void FStaticMeshSceneProxy::operator delete(void* RawMemory, size_t Size)
+{
+	if (Size == sizeof(FStaticMeshSceneProxy))
+	{
+		GStaticMeshSceneProxyAllocator.Free(RawMemory);
+	}
+	else
+	{
+		FMemory::Free(RawMemory);
+	}
+}
+
 /** Initialization constructor. */
 FStaticMeshSceneProxy::FStaticMeshSceneProxy(UStaticMeshComponent* InComponent):
 	FPrimitiveSceneProxy(InComponent, InComponent->StaticMesh->GetFName()),
@@ -56,6 +81,7 @@ FStaticMeshSceneProxy::FStaticMeshSceneProxy(UStaticMeshComponent* InComponent):
 	BodySetup(InComponent->GetBodySetup()),
 	RenderData(InComponent->StaticMesh->RenderData),
 	ForcedLodModel(InComponent->ForcedLodModel),
+	FirstLODIdx(InComponent->StaticMesh->RenderData->CurrentFirstLODIdx),
 	bCastShadow(InComponent->CastShadow),
 	CollisionTraceFlag(ECollisionTraceFlag::CTF_UseDefault),
 	MaterialRelevance(InComponent->GetMaterialRelevance(GetScene().GetFeatureLevel())),
@@ -434,7 +460,7 @@ void FStaticMeshSceneProxy::DrawStaticElements(FStaticPrimitiveDrawInterface* PD
 		//check if a LOD is being forced
 		if (ForcedLodModel > 0) 
 		{
-			int32 LODIndex = FMath::Clamp(ForcedLodModel, 1, NumLODs) - 1;
+			int32 LODIndex = FMath::Clamp(ForcedLodModel, FirstLODIdx + 1, NumLODs) - 1;
 			const FStaticMeshLODResources& LODModel = RenderData->LODResources[LODIndex];
 			// Draw the static mesh elements.
 			for(int32 SectionIndex = 0; SectionIndex < LODModel.Sections.Num(); SectionIndex++)
@@ -464,7 +490,7 @@ void FStaticMeshSceneProxy::DrawStaticElements(FStaticPrimitiveDrawInterface* PD
 		} 
 		else //no LOD is being forced, submit them all with appropriate cull distances
 		{
-			for(int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+			for(int32 LODIndex = FirstLODIdx; LODIndex < NumLODs; LODIndex++)
 			{
 				const FStaticMeshLODResources& LODModel = RenderData->LODResources[LODIndex];
 				float ScreenSize = GetScreenSize(LODIndex);
@@ -999,8 +1025,8 @@ FStaticMeshSceneProxy::FLODInfo::FLODInfo(const UStaticMeshComponent* InComponen
 		ShadowMap = ComponentLODInfo.ShadowMap;
 		IrrelevantLights = InComponent->IrrelevantLights;
 
-		// Initialize this LOD's overridden vertex colors, if it has any
-		if( ComponentLODInfo.OverrideVertexColors )
+		// Initialize this LOD's overridden vertex colors, if it has any. Streamed out LODs are never rendered by the proxy
+		if( ComponentLODInfo.OverrideVertexColors && LODIndex >= RenderData->CurrentFirstLODIdx )
 		{
 			FStaticMeshLODResources& LODRenderData = RenderData->LODResources[LODIndex];
 			
@@ -1151,23 +1177,23 @@ int32 FStaticMeshSceneProxy::GetLOD(const FSceneView* View) const
 	//If a LOD is being forced, use that one
 	if (CVarForcedLODLevel >= 0)
 	{
-		return FMath::Clamp<int32>(CVarForcedLODLevel, 0, RenderData->LODResources.Num() - 1);
+		return FMath::Clamp<int32>(CVarForcedLODLevel, FirstLODIdx, RenderData->LODResources.Num() - 1);
 	}
 
 	if (ForcedLodModel > 0)
 	{
-		return FMath::Clamp(ForcedLodModel, 1, RenderData->LODResources.Num()) - 1;
+		return FMath::Clamp(ForcedLodModel, FirstLODIdx + 1, RenderData->LODResources.Num()) - 1;
 	}
 
 #if WITH_EDITOR
 	if (View->Family && View->Family->EngineShowFlags.LOD == 0)
 	{
-		return 0;
+		return FirstLODIdx;
 	}
 #endif
 
 	const FBoxSphereBounds& Bounds = GetBounds();
-	return ComputeStaticMeshLOD(RenderData, Bounds.Origin, Bounds.SphereRadius, *View);
+	return FMath::Max<int32>(ComputeStaticMeshLOD(RenderData, Bounds.Origin, Bounds.SphereRadius, *View), FirstLODIdx);
 }
 
 FPrimitiveSceneProxy* UStaticMeshComponent::CreateSceneProxy()
@@ -1175,7 +1201,7 @@ FPrimitiveSceneProxy* UStaticMeshComponent::CreateSceneProxy()
 	if(StaticMesh == NULL
 		|| StaticMesh->RenderData == NULL
 		|| StaticMesh->RenderData->LODResources.Num() == 0
-		|| StaticMesh->RenderData->LODResources[0].VertexBuffer.GetNumVertices() == 0)
+		|| StaticMesh->RenderData->LODResources[StaticMesh->RenderData->CurrentFirstLODIdx].VertexBuffer.GetNumVertices() == 0)
 	{
 		return NULL;
 	}
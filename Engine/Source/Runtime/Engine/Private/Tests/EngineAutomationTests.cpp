@@ -426,6 +426,87 @@ bool FCinematicFPSPerfTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+/**
+ * AHR benchmark - Sweeps the AHR settings on the reference maps and captures the GPU time of each stage and the memory of the volumes and targets.
+ * The captures of each map are appended to Saved/Profiling/AHRBenchmark/<Map>.csv, and the ones of this run are written to <Map>.json
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FAHRBenchmarkTest, "Maps.AHR Benchmark", (EAutomationTestFlags::ATF_Game | EAutomationTestFlags::ATF_NonNullRHI));
+
+void FAHRBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray <FString>& OutTestCommands) const
+{
+	const UAutomationTestSettings* AutomationTestSettings = GetDefault<UAutomationTestSettings>();
+	check(AutomationTestSettings);
+
+	for (const FFilePath& BenchmarkMap : AutomationTestSettings->AHRBenchmarkMaps)
+	{
+		OutBeautifiedNames.Add(FPaths::GetBaseFilename(BenchmarkMap.FilePath));
+		OutTestCommands.Add(BenchmarkMap.FilePath);
+	}
+}
+
+bool FAHRBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const FString MapName = Parameters;
+	const FString ReportName = FPaths::GetBaseFilename(MapName);
+
+	// Swept settings, every combination is captured
+	const float VoxelSizeScales[] = { 0.5f, 1.0f, 2.0f };
+	const int32 DiffuseDirections[] = { 1, 3, 5 };
+	const float SamplesScales[] = { 0.5f, 1.0f };
+	const float ScreenPercentages[] = { 50.0f, 100.0f };
+
+	// Changing the voxel size rebuilds the volumes and resets the temporal history, give them some time before capturing
+	const float WarmUpTime = 1.0f;
+	const float CaptureTime = 2.0f;
+
+	// The settings are restored once the sweep is done
+	const TCHAR* SweptVariables[] = { TEXT("r.AHRVoxelSizeScale"), TEXT("r.AHRDiffuseDirections"), TEXT("r.AHRSamplesScale"), TEXT("r.ScreenPercentage") };
+	TArray<FString> RestoreCommands;
+	for (const TCHAR* VariableName : SweptVariables)
+	{
+		IConsoleVariable* Variable = IConsoleManager::Get().FindConsoleVariable(VariableName);
+		if (!Variable)
+		{
+			UE_LOG(LogEngineAutomationTests, Error, TEXT("The AHR benchmark needs %s, which is not registered."), VariableName);
+			return false;
+		}
+		RestoreCommands.Add(FString::Printf(TEXT("%s %s"), VariableName, *Variable->GetString()));
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FEngineWaitLatentCommand(1.0f));
+	ADD_LATENT_AUTOMATION_COMMAND(FLoadGameMapCommand(MapName));
+	ADD_LATENT_AUTOMATION_COMMAND(FEngineWaitLatentCommand(2.0f));
+
+	for (float VoxelSizeScale : VoxelSizeScales)
+	{
+		for (int32 Directions : DiffuseDirections)
+		{
+			for (float SamplesScale : SamplesScales)
+			{
+				for (float ScreenPercentage : ScreenPercentages)
+				{
+					ADD_LATENT_AUTOMATION_COMMAND(FExecStringLatentCommand(FString::Printf(TEXT("r.AHRVoxelSizeScale %g"), VoxelSizeScale)));
+					ADD_LATENT_AUTOMATION_COMMAND(FExecStringLatentCommand(FString::Printf(TEXT("r.AHRDiffuseDirections %d"), Directions)));
+					ADD_LATENT_AUTOMATION_COMMAND(FExecStringLatentCommand(FString::Printf(TEXT("r.AHRSamplesScale %g"), SamplesScale)));
+					ADD_LATENT_AUTOMATION_COMMAND(FExecStringLatentCommand(FString::Printf(TEXT("r.ScreenPercentage %g"), ScreenPercentage)));
+					ADD_LATENT_AUTOMATION_COMMAND(FEngineWaitLatentCommand(WarmUpTime));
+
+					ADD_LATENT_AUTOMATION_COMMAND(FExecStringLatentCommand(TEXT("r.AHRBenchmark.Begin")));
+					ADD_LATENT_AUTOMATION_COMMAND(FEngineWaitLatentCommand(CaptureTime));
+					ADD_LATENT_AUTOMATION_COMMAND(FExecStringLatentCommand(FString::Printf(TEXT("r.AHRBenchmark.End %s"), *ReportName)));
+				}
+			}
+		}
+	}
+
+	for (const FString& RestoreCommand : RestoreCommands)
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FExecStringLatentCommand(RestoreCommand));
+	}
+
+	return true;
+}
+
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLogTypesTest, "Automation Framework.Logging Test", EAutomationTestFlags::ATF_None)
 
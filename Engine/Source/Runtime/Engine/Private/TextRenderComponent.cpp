@@ -855,6 +855,7 @@ void UTextRenderComponent::SetText(const FString& Value)
 void UTextRenderComponent::SetTextMaterial(class UMaterialInterface* Value)
 {
 	TextMaterial = Value;
+	GCClusterWriteBarrier(this, TextMaterial);
 	MarkRenderStateDirty();	
 }
 
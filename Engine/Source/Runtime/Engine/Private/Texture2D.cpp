@@ -1751,36 +1751,9 @@ void FTexture2DResource::LoadMipData()
 
 				EAsyncIOPriority AsyncIOPriority = bPrioritizedIORequest ? AIOP_BelowNormal : AIOP_Low;
 
-				// Load and decompress async.
-				{
-					check(MipMap.BulkData.GetFilename().Len());
-					if( MipMap.BulkData.IsStoredCompressedOnDisk() )
-					{
-						IORequestIndices[IORequestCount++] = FIOSystem::Get().LoadCompressedData( 
-							MipMap.BulkData.GetFilename(),						// filename
-							MipMap.BulkData.GetBulkDataOffsetInFile(),			// offset
-							MipMap.BulkData.GetBulkDataSizeOnDisk(),			// compressed size
-							MipMap.BulkData.GetBulkDataSize(),					// uncompressed size
-							TheMipData,											// dest pointer
-							MipMap.BulkData.GetDecompressionFlags(),			// compressed data format
-							&Owner->PendingMipChangeRequestStatus,				// counter to decrement
-							AsyncIOPriority										// priority
-							);
-					}
-					// Load async.
-					else
-					{
-						IORequestIndices[IORequestCount++] = FIOSystem::Get().LoadData( 
-							MipMap.BulkData.GetFilename(),						// filename
-							MipMap.BulkData.GetBulkDataOffsetInFile(),			// offset
-							MipMap.BulkData.GetBulkDataSize(),					// size
-							TheMipData,											// dest pointer
-							&Owner->PendingMipChangeRequestStatus,				// counter to decrement
-							AsyncIOPriority										// priority
-							);
-					}
-					check(IORequestIndices[MipIndex]);
-				}
+				// Load and decompress async, straight into the locked mip.
+				IORequestIndices[IORequestCount++] = MipMap.BulkData.LoadIntoAsync( TheMipData, &Owner->PendingMipChangeRequestStatus, AsyncIOPriority );
+				check(IORequestIndices[MipIndex]);
 			}
 
 			// Are we reducing the mip-count?
@@ -1866,32 +1839,7 @@ void FTexture2DResource::LoadMipData()
 			else
 #endif // #if WITH_EDITORONLY_DATA
 			{
-				check(MipMap.BulkData.GetFilename().Len());
-				if( MipMap.BulkData.IsStoredCompressedOnDisk() )
-				{
-					IORequestIndices[IORequestCount++] = FIOSystem::Get().LoadCompressedData( 
-						MipMap.BulkData.GetFilename(),						// filename
-						MipMap.BulkData.GetBulkDataOffsetInFile(),			// offset
-						MipMap.BulkData.GetBulkDataSizeOnDisk(),			// compressed size
-						MipMap.BulkData.GetBulkDataSize(),					// uncompressed size
-						TheMipData,											// dest pointer
-						MipMap.BulkData.GetDecompressionFlags(),			// compressed data format
-						&Owner->PendingMipChangeRequestStatus,				// counter to decrement
-						AsyncIOPriority										// priority
-						);
-				}
-				// Load async.
-				else
-				{
-					IORequestIndices[IORequestCount++] = FIOSystem::Get().LoadData( 
-						MipMap.BulkData.GetFilename(),						// filename
-						MipMap.BulkData.GetBulkDataOffsetInFile(),			// offset
-						MipMap.BulkData.GetBulkDataSize(),					// size
-						TheMipData,											// dest pointer
-						&Owner->PendingMipChangeRequestStatus,				// counter to decrement
-						AsyncIOPriority										// priority
-						);
-				}
+				IORequestIndices[IORequestCount++] = MipMap.BulkData.LoadIntoAsync( TheMipData, &Owner->PendingMipChangeRequestStatus, AsyncIOPriority );
 				check(IORequestIndices[MipIndex]);
 			}
 		}
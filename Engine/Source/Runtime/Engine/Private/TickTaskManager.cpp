@@ -22,7 +22,17 @@ static TAutoConsoleVariable<int32> CVarLogTicks(
 static TAutoConsoleVariable<int32> CVarAllowAsyncComponentTicks(
 	TEXT("AllowAsyncComponentTicks"),
 	0,
-	TEXT("Used to control async component ticks."));
+	TEXT("If non zero, the tick functions with bRunOnAnyThread set run on worker threads, in parallel with the other ticks of their tick group."));
+
+static TAutoConsoleVariable<int32> CVarAllowBatchedTicks(
+	TEXT("AllowBatchedTicks"),
+	1,
+	TEXT("If non zero, the tick functions with bAllowTickBatching set are ticked in batches of the same class and tick group, instead of a task each."));
+
+static TAutoConsoleVariable<int32> CVarTickBatchSize(
+	TEXT("TickBatchSize"),
+	64,
+	TEXT("Max number of tick functions ticked by one batch task."));
 
 struct FTickContext
 {
@@ -70,9 +80,30 @@ class FTickTaskSequencer
 	/** Start event for each phase of ticks */
 	FGraphEventRef		TickGroupStartEvents[TG_MAX];
 
+	/** Tick functions ticked by one task, see FTickFunction::bAllowTickBatching */
+	struct FTickBatch
+	{
+		TArray<FTickFunction*>	TickFunctions;
+		FGraphEventRef			CompletionEvent;
+		ELevelTick				TickType;
+		bool					bRunOnAnyThread;
+	};
+
+	/**
+	 * Batches of each tick group that can still be added to, for game thread and any thread ticks, by class.
+	 * Each batch is owned by its task, which is created with the batch and waits for the start of the tick group.
+	 */
+	TMap<UClass*, FTickBatch*>	OpenTickBatches[TG_MAX][2];
+
 	/** If true, allow concurrent ticks **/
 	bool				bAllowConcurrentTicks; 
 
+	/** If true, allow batched ticks **/
+	bool				bAllowBatchedTicks;
+
+	/** Max number of ticks in a batch **/
+	int32				TickBatchSize;
+
 	/** If true, log each tick **/
 	bool				bLogTicks; 
 
@@ -110,6 +141,7 @@ public:
 		checkSlow(TickFunction->ActualTickGroup >=0 && TickFunction->ActualTickGroup < TG_MAX);
 
 		FTickContext UseContext = TickContext;
+		UseContext.DeltaSeconds = TickFunction->TickDeltaSeconds;
 	   
 		bool bIsOriginalTickGroup = (TickFunction->ActualTickGroup == TickFunction->TickGroup);
 
@@ -121,6 +153,51 @@ public:
 		TickFunction->CompletionHandle = TGraphTask<FTickFunctionTask>::CreateTask(Prerequisites, TickContext.Thread).ConstructAndDispatchWhenReady(TickFunction, &UseContext, bLogTicks);
 	}
 
+	/**
+	 * Adds a tick function without prerequisites to the batch of its class and tick group, creating a batch task if needed
+	 *
+	 * @param	TickFunction - the tick function to queue
+	 * @param	Context - tick context to tick in. Thread here is the current thread.
+	 * @return	false if the tick function can't be batched, it must be queued on its own
+	 */
+	bool QueueBatchedTickTask(FTickFunction* TickFunction, const FTickContext& TickContext)
+	{
+		checkSlow(TickContext.Thread == ENamedThreads::GameThread);
+
+		if (!bAllowBatchedTicks || TickFunction->ActualTickGroup != TickFunction->TickGroup)
+		{
+			return false;
+		}
+
+		UClass* BatchClass = TickFunction->GetTickBatchClass();
+		if (!BatchClass)
+		{
+			return false;
+		}
+
+		const ETickingGroup TickGroup = TickFunction->ActualTickGroup;
+		const bool bRunOnAnyThread = TickFunction->bRunOnAnyThread && bAllowConcurrentTicks;
+
+		FTickBatch*& Batch = OpenTickBatches[TickGroup][bRunOnAnyThread].FindOrAdd(BatchClass);
+		if (!Batch || Batch->TickFunctions.Num() >= TickBatchSize)
+		{
+			Batch = new FTickBatch;
+			Batch->TickType = TickContext.TickType;
+			Batch->bRunOnAnyThread = bRunOnAnyThread;
+
+			FGraphEventArray Prerequisites;
+			Prerequisites.Add(GetTickGroupStartEvent(TickGroup));
+
+			// The batch is filled until the tick group is released, the task can't start before that
+			Batch->CompletionEvent = TGraphTask<FTickBatchTask>::CreateTask(&Prerequisites, TickContext.Thread).ConstructAndDispatchWhenReady(Batch, bLogTicks);
+			AddTickTaskCompletion(TickGroup, Batch->CompletionEvent);
+		}
+
+		Batch->TickFunctions.Add(TickFunction);
+		TickFunction->CompletionHandle = Batch->CompletionEvent;
+		return true;
+	}
+
 	/** Add a completion handle to a tick group **/
 	FORCEINLINE void AddTickTaskCompletion(ETickingGroup TickGroup, const FGraphEventRef& CompletionHandle)
 	{
@@ -168,6 +245,10 @@ public:
 		checkSlow(WorldTickGroup >=0 && WorldTickGroup < TG_MAX);
 		check(TickGroupStartEvents[WorldTickGroup].GetReference()); // the start event should exist
 
+		// the batches belong to their tasks now, new ticks of this group (newly spawned ones) go in new batches
+		OpenTickBatches[WorldTickGroup][0].Reset();
+		OpenTickBatches[WorldTickGroup][1].Reset();
+
 		if (SingleThreadedMode())
 		{
 			TickGroupStartEvents[WorldTickGroup]->DispatchSubsequents(ENamedThreads::GameThread); // start this tick group
@@ -232,6 +313,8 @@ public:
 		{
 			bAllowConcurrentTicks = !!CVarAllowAsyncComponentTicks.GetValueOnGameThread();
 		}
+		bAllowBatchedTicks = !!CVarAllowBatchedTicks.GetValueOnGameThread();
+		TickBatchSize = FMath::Max(CVarTickBatchSize.GetValueOnGameThread(), 1);
 		for (int32 Index = 0; Index < TG_MAX; Index++)
 		{
 			check(!TickCompletionEvents[Index].Num());  // we should not be adding to these outside of a ticking proper and they were already cleared after they were ticked
@@ -260,6 +343,8 @@ private:
 
 	FTickTaskSequencer()
 		: bAllowConcurrentTicks(false)
+		, bAllowBatchedTicks(false)
+		, TickBatchSize(1)
 		, bLogTicks(false)
 	{
 	}
@@ -319,7 +404,57 @@ private:
 				UE_LOG(LogTick, Log, TEXT("tick %6d %2d %s"),GFrameCounter, (int32)CurrentThread, *Target->DiagnosticMessage());
 			}
 			Target->ExecuteTick(Context.DeltaSeconds, Context.TickType, CurrentThread, MyCompletionGraphEvent);
-			Target->CompletionHandle = NULL; // Allow the old completion handle to be recycled
+			if (Context.Thread == ENamedThreads::GameThread)
+			{
+				Target->CompletionHandle = NULL; // Allow the old completion handle to be recycled
+			}
+			// else the game thread can still be storing or reading the handle, QueueTickFunction replaces or clears it next frame
+		}
+	};
+
+	/** Helper class define the task of ticking a batch of tick functions **/
+	class FTickBatchTask
+	{
+		/** Batch to tick, owned by the task **/
+		FTickBatch*				Batch;
+		/** If true, log each tick **/
+		bool					bLogTick; 
+	public:
+		FTickBatchTask(FTickBatch* InBatch, bool InbLogTick)
+			: Batch(InBatch)
+			, bLogTick(InbLogTick)
+		{
+		}
+		FORCEINLINE TStatId GetStatId() const
+		{
+			RETURN_QUICK_DECLARE_CYCLE_STAT(FTickBatchTask, STATGROUP_TaskGraphTasks);
+		}
+		/** return the thread for this task **/
+		ENamedThreads::Type GetDesiredThread()
+		{
+			return Batch->bRunOnAnyThread ? ENamedThreads::AnyThread : ENamedThreads::GameThread;
+		}
+		static ESubsequentsMode::Type GetSubsequentsMode() 
+		{ 
+			return ESubsequentsMode::TrackSubsequents; 
+		}
+		void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+		{
+			for (int32 Index = 0; Index < Batch->TickFunctions.Num(); Index++)
+			{
+				FTickFunction* Target = Batch->TickFunctions[Index];
+				if (bLogTick)
+				{
+					UE_LOG(LogTick, Log, TEXT("tick %6d %2d %s [Batched]"),GFrameCounter, (int32)CurrentThread, *Target->DiagnosticMessage());
+				}
+				Target->ExecuteTick(Target->TickDeltaSeconds, Batch->TickType, CurrentThread, MyCompletionGraphEvent);
+				if (!Batch->bRunOnAnyThread)
+				{
+					Target->CompletionHandle = NULL; // Allow the old completion handle to be recycled
+				}
+			}
+			delete Batch;
+			Batch = NULL;
 		}
 	};
 };
@@ -949,10 +1084,14 @@ FTickFunction::FTickFunction()
 	, bCanEverTick(false)
 	, bAllowTickOnDedicatedServer(true)
 	, bRunOnAnyThread(false)
+	, bAllowTickBatching(false)
+	, TickInterval(0.0f)
 	, bRegistered(false)
 	, bTickEnabled(true)
 	, TickVisitedGFrameCounter(0)
 	, TickQueuedGFrameCounter(0)
+	, TickIntervalElapsedTime(0.0f)
+	, TickDeltaSeconds(0.0f)
 	, ActualTickGroup(TG_PrePhysics)
 	, EnableParent(NULL)
 	, TickTaskLevel(NULL)
@@ -1051,7 +1190,7 @@ void FTickFunction::QueueTickFunction(const struct FTickContext& TickContext)
 	if (TickVisitedGFrameCounter != GFrameCounter)
 	{
 		TickVisitedGFrameCounter = GFrameCounter;
-		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled))
+		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled) && UpdateTickInterval(TickContext.DeltaSeconds))
 		{
 			ETickingGroup MaxPrerequisiteTickGroup =  ETickingGroup(0);
 
@@ -1093,17 +1232,44 @@ void FTickFunction::QueueTickFunction(const struct FTickContext& TickContext)
 			}
 			ActualTickGroup = MyActualTickGroup;
 
+			// a batch only waits for the start of its tick group
+			const bool bCanBatch = bAllowTickBatching && !TaskPrerequisites.Num();
+
 			// we don't need to add a tick group prerequisite if we already have a prerequisite in the correct tick group (in that case, the delay until the correct tick group is implicit)
 			if (!TaskPrerequisites.Num() || MaxPrerequisiteTickGroup < MyActualTickGroup)
 			{
 				TaskPrerequisites.Add(FTickTaskSequencer::Get().GetTickGroupStartEvent(MyActualTickGroup));
 			}
-			FTickTaskSequencer::Get().QueueTickTask(&TaskPrerequisites, this, TickContext);
+			if (!bCanBatch || !FTickTaskSequencer::Get().QueueBatchedTickTask(this, TickContext))
+			{
+				FTickTaskSequencer::Get().QueueTickTask(&TaskPrerequisites, this, TickContext);
+			}
+		}
+		else
+		{
+			// not ticking this frame, the handle of an earlier tick that ran on a worker thread must not be used by the prerequisites of other ticks
+			CompletionHandle = NULL;
 		}
 		TickQueuedGFrameCounter = GFrameCounter;
 	}
 }
 
+bool FTickFunction::UpdateTickInterval(float DeltaSeconds)
+{
+	const float ElapsedTime = TickIntervalElapsedTime + DeltaSeconds;
+	if (TickInterval > 0.0f && ElapsedTime < TickInterval)
+	{
+		// not due, the prerequisites of other ticks see it as disabled for this frame
+		TickIntervalElapsedTime = ElapsedTime;
+		CompletionHandle = NULL;
+		return false;
+	}
+
+	TickIntervalElapsedTime = 0.0f;
+	TickDeltaSeconds = ElapsedTime;
+	return true;
+}
+
 /**
 	* Queues a tick function for execution, assuming parallel queuing
 	* @param TickContext - context to tick in
@@ -1124,7 +1290,7 @@ void FTickFunction::QueueTickFunctionParallel(const FTickContext& TickContext, T
 	if (bProcessTick)
 	{
 		check(bRegistered);
-		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled))
+		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled) && UpdateTickInterval(TickContext.DeltaSeconds))
 		{
 			ETickingGroup MaxPrerequisiteTickGroup =  ETickingGroup(0);
 
@@ -1180,6 +1346,11 @@ void FTickFunction::QueueTickFunctionParallel(const FTickContext& TickContext, T
 			}
 			FTickTaskSequencer::Get().StartTickTask(&TaskPrerequisites, this, TickContext);
 		}
+		else
+		{
+			// not ticking this frame, the handle of an earlier tick that ran on a worker thread must not be used by the prerequisites of other ticks
+			CompletionHandle = NULL;
+		}
 		FPlatformMisc::MemoryBarrier();
 		TickQueuedGFrameCounter = GFrameCounter;
 	}
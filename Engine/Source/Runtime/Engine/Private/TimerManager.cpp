@@ -6,6 +6,8 @@
 
 #include "EnginePrivate.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Timers Fired"), STAT_TimersFired, STATGROUP_Game);
+
 void FTimerHandle::MakeValid()
 {
 	static int LastAssignedHandle = -1;
@@ -32,37 +34,17 @@ inline bool DEPRECATED_CompareUnifiedDelegates(const FTimerUnifiedDelegate& Lhs,
 /** Will find and return a timer if it exists, regardless whether it is paused. */ 
 FTimerData const* FTimerManager::DEPRECATED_FindTimer(FTimerUnifiedDelegate const& InDelegate, int32* OutTimerIndex) const
 {
-	int32 ActiveTimerIdx = DEPRECATED_FindTimerInList(ActiveTimerHeap, InDelegate);
-	if (ActiveTimerIdx != INDEX_NONE)
-	{
-		// found it in the active heap
-		if (OutTimerIndex)
-		{
-			*OutTimerIndex = ActiveTimerIdx;
-		}
-		return &ActiveTimerHeap[ActiveTimerIdx];
-	}
-
-	int32 PausedTimerIdx = DEPRECATED_FindTimerInList(PausedTimerList, InDelegate);
-	if (PausedTimerIdx != INDEX_NONE)
+	// timers set without a handle can only be found by their delegate
+	for (TSparseArray<FTimerData>::TConstIterator It(Timers); It; ++It)
 	{
-		// found it in the paused list
-		if (OutTimerIndex)
+		if (!It->TimerHandle.IsValid() && DEPRECATED_CompareUnifiedDelegates(It->TimerDelegate, InDelegate))
 		{
-			*OutTimerIndex = PausedTimerIdx;
-		}
-		return &PausedTimerList[PausedTimerIdx];
-	}
-
-	int32 PendingTimerIdx = DEPRECATED_FindTimerInList(PendingTimerList, InDelegate);
-	if (PendingTimerIdx != INDEX_NONE)
-	{
-		// found it in the pending list
-		if (OutTimerIndex)
-		{
-			*OutTimerIndex = PendingTimerIdx;
+			if (OutTimerIndex)
+			{
+				*OutTimerIndex = It.GetIndex();
+			}
+			return &*It;
 		}
-		return &PendingTimerList[PendingTimerIdx];
 	}
 
 	return nullptr;
@@ -70,72 +52,57 @@ FTimerData const* FTimerManager::DEPRECATED_FindTimer(FTimerUnifiedDelegate cons
 
 FTimerData const* FTimerManager::FindTimer(FTimerHandle const& InHandle, int32* OutTimerIndex) const
 {
-	int32 ActiveTimerIdx = FindTimerInList(ActiveTimerHeap, InHandle);
-	if (ActiveTimerIdx != INDEX_NONE)
+	if (InHandle.IsValid())
 	{
-		// found it in the active heap
-		if (OutTimerIndex)
+		if (int32 const* TimerIdx = TimerIndicesByHandle.Find(InHandle))
 		{
-			*OutTimerIndex = ActiveTimerIdx;
+			if (OutTimerIndex)
+			{
+				*OutTimerIndex = *TimerIdx;
+			}
+			return &Timers[*TimerIdx];
 		}
-		return &ActiveTimerHeap[ActiveTimerIdx];
 	}
 
-	int32 PausedTimerIdx = FindTimerInList(PausedTimerList, InHandle);
-	if (PausedTimerIdx != INDEX_NONE)
-	{
-		// found it in the paused list
-		if (OutTimerIndex)
-		{
-			*OutTimerIndex = PausedTimerIdx;
-		}
-		return &PausedTimerList[PausedTimerIdx];
-	}
+	return nullptr;
+}
 
-	int32 PendingTimerIdx = FindTimerInList(PendingTimerList, InHandle);
-	if (PendingTimerIdx != INDEX_NONE)
+int32 FTimerManager::AddTimer(FTimerData const& TimerData)
+{
+	int32 const TimerIdx = Timers.Add(TimerData);
+	if (TimerData.TimerHandle.IsValid())
 	{
-		// found it in the pending list
-		if (OutTimerIndex)
-		{
-			*OutTimerIndex = PendingTimerIdx;
-		}
-		return &PendingTimerList[PendingTimerIdx];
+		TimerIndicesByHandle.Add(TimerData.TimerHandle, TimerIdx);
 	}
-
-	return nullptr;
+	return TimerIdx;
 }
 
-
-/** Will find the given timer in the given TArray and return its index. */ 
-int32 FTimerManager::DEPRECATED_FindTimerInList(const TArray<FTimerData> &SearchArray, FTimerUnifiedDelegate const& InDelegate) const
+void FTimerManager::RemoveTimer(int32 TimerIdx)
 {
-	for (int32 Idx=0; Idx<SearchArray.Num(); ++Idx)
+	FTimerData const& TimerData = Timers[TimerIdx];
+	if (TimerData.TimerHandle.IsValid())
 	{
-		if (!SearchArray[Idx].TimerHandle.IsValid() && DEPRECATED_CompareUnifiedDelegates(SearchArray[Idx].TimerDelegate, InDelegate))
-		{
-			return Idx;
-		}
+		TimerIndicesByHandle.Remove(TimerData.TimerHandle);
 	}
+	Timers.RemoveAt(TimerIdx);
+}
 
-	return INDEX_NONE;
+void FTimerManager::PushActiveTimer(int32 TimerIdx)
+{
+	FTimerData& TimerData = Timers[TimerIdx];
+	TimerData.Status = ETimerStatus::Active;
+	TimerData.HeapSerial = ++LastHeapSerial;
+	ActiveTimerHeap.HeapPush(FTimerHeapEntry(TimerData.ExpireTime, TimerIdx, TimerData.HeapSerial));
 }
 
-/** Will find the given timer in the given TArray and return its index. */
-int32 FTimerManager::FindTimerInList(const TArray<FTimerData> &SearchArray, FTimerHandle const& InHandle) const
+bool FTimerManager::IsHeapEntryLive(FTimerHeapEntry const& Entry) const
 {
-	if (InHandle.IsValid())
+	if (Entry.TimerIndex < Timers.GetMaxIndex() && Timers.IsAllocated(Entry.TimerIndex))
 	{
-		for (int32 Idx = 0; Idx < SearchArray.Num(); ++Idx)
-		{
-			if (SearchArray[Idx].TimerHandle == InHandle)
-			{
-				return Idx;
-			}
-		}
+		FTimerData const& TimerData = Timers[Entry.TimerIndex];
+		return TimerData.Status == ETimerStatus::Active && TimerData.HeapSerial == Entry.Serial;
 	}
-
-	return INDEX_NONE;
+	return false;
 }
 
 /** Finds a handle to a dynamic timer bound to a particular pointer and function name. */
@@ -146,19 +113,12 @@ FTimerHandle FTimerManager::K2_FindDynamicTimerHandle(FTimerDynamicDelegate InDy
 		return CurrentlyExecutingTimer.TimerHandle;
 	}
 
-	if (auto* Timer = ActiveTimerHeap.FindByPredicate([=](const FTimerData& Data){ return Data.TimerDelegate.FuncDynDelegate == InDynamicDelegate; }))
+	for (FTimerData const& Timer : Timers)
 	{
-		return Timer->TimerHandle;
-	}
-
-	if (auto* Timer = PausedTimerList.FindByPredicate([=](const FTimerData& Data){ return Data.TimerDelegate.FuncDynDelegate == InDynamicDelegate; }))
-	{
-		return Timer->TimerHandle;
-	}
-
-	if (auto* Timer = PendingTimerList.FindByPredicate([=](const FTimerData& Data){ return Data.TimerDelegate.FuncDynDelegate == InDynamicDelegate; }))
-	{
-		return Timer->TimerHandle;
+		if (Timer.TimerDelegate.FuncDynDelegate == InDynamicDelegate)
+		{
+			return Timer.TimerHandle;
+		}
 	}
 
 	return FTimerHandle();
@@ -221,15 +181,14 @@ void FTimerManager::InternalSetTimer(FTimerData& NewTimerData, float InRate, boo
 		if (HasBeenTickedThisFrame())
 		{
 			NewTimerData.ExpireTime = InternalTime + FirstDelay;
-			NewTimerData.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush(NewTimerData);
+			PushActiveTimer(AddTimer(NewTimerData));
 		}
 		else
 		{
 			// Store time remaining in ExpireTime while pending
 			NewTimerData.ExpireTime = FirstDelay;
 			NewTimerData.Status = ETimerStatus::Pending;
-			PendingTimerList.Add(NewTimerData);
+			PendingTimerList.Add(AddTimer(NewTimerData));
 		}
 	}
 }
@@ -244,8 +203,7 @@ void FTimerManager::InternalSetTimerForNextTick(FTimerUnifiedDelegate const& InD
 	NewTimerData.bLoop = false;
 	NewTimerData.TimerDelegate = InDelegate;
 	NewTimerData.ExpireTime = InternalTime;
-	NewTimerData.Status = ETimerStatus::Active;
-	ActiveTimerHeap.HeapPush(NewTimerData);
+	PushActiveTimer(AddTimer(NewTimerData));
 }
 
 void FTimerManager::DEPRECATED_InternalClearTimer(FTimerUnifiedDelegate const& InDelegate)
@@ -303,21 +261,20 @@ void FTimerManager::InternalClearTimer(int32 TimerIdx, ETimerStatus::Type TimerS
 {
 	switch (TimerStatus)
 	{
-		case ETimerStatus::Pending:
-			PendingTimerList.RemoveAtSwap(TimerIdx);
-			break;
-
 		case ETimerStatus::Active:
-			ActiveTimerHeap.HeapRemoveAt(TimerIdx);
+			// the heap entry goes stale, it is dropped when it reaches the top or the heap gets compacted
+			++NumStaleHeapEntries;
 			break;
 
+		case ETimerStatus::Pending:
 		case ETimerStatus::Paused:
-			PausedTimerList.RemoveAtSwap(TimerIdx);
 			break;
 
 		default:
 			check(false);
 	}
+
+	RemoveTimer(TimerIdx);
 }
 
 
@@ -325,40 +282,19 @@ void FTimerManager::InternalClearAllTimers(void const* Object)
 {
 	if (Object)
 	{
-		// search active timer heap for timers using this object and remove them
-		int32 const OldActiveHeapSize = ActiveTimerHeap.Num();
-
-		for (int32 Idx=0; Idx<ActiveTimerHeap.Num(); ++Idx)
-		{
-			if ( ActiveTimerHeap[Idx].TimerDelegate.IsBoundToObject(Object) )
-			{
-				// remove this item
-				// this will break the heap property, but we will re-heapify afterward
-				ActiveTimerHeap.RemoveAtSwap(Idx--);
-			}
-		}
-		if (OldActiveHeapSize != ActiveTimerHeap.Num())
-		{
-			// need to heapify
-			ActiveTimerHeap.Heapify();
-		}
-
-		// search paused timer list for timers using this object and remove them, too
-		for (int32 Idx=0; Idx<PausedTimerList.Num(); ++Idx)
+		// search all timers for the ones using this object and remove them
+		TArray<int32, TInlineAllocator<16>> TimersToClear;
+		for (TSparseArray<FTimerData>::TConstIterator It(Timers); It; ++It)
 		{
-			if (PausedTimerList[Idx].TimerDelegate.IsBoundToObject(Object))
+			if (It->TimerDelegate.IsBoundToObject(Object))
 			{
-				PausedTimerList.RemoveAtSwap(Idx--);
+				TimersToClear.Add(It.GetIndex());
 			}
 		}
 
-		// search pending timer list for timers using this object and remove them, too
-		for (int32 Idx=0; Idx<PendingTimerList.Num(); ++Idx)
+		for (int32 TimerIdx : TimersToClear)
 		{
-			if (PendingTimerList[Idx].TimerDelegate.IsBoundToObject(Object))
-			{
-				PendingTimerList.RemoveAtSwap(Idx--);
-			}
+			InternalClearTimer(TimerIdx, Timers[TimerIdx].Status);
 		}
 
 		// Edge case. We're currently handling this timer when it got cleared.  Unbind it to prevent it firing again
@@ -424,59 +360,49 @@ void FTimerManager::InternalPauseTimer( FTimerData const* TimerToPause, int32 Ti
 
 	if( TimerToPause && (TimerToPause->Status != ETimerStatus::Paused) )
 	{
-		ETimerStatus::Type PreviousStatus = TimerToPause->Status;
-
-		// Add to Paused list
-		int32 NewIndex = PausedTimerList.Add(*TimerToPause);
+		FTimerData& Timer = Timers[TimerIdx];
+		check(&Timer == TimerToPause);
 
-		// Set new status
-		FTimerData &NewTimer = PausedTimerList[NewIndex];
-		NewTimer.Status = ETimerStatus::Paused;
-
-		// Remove from previous TArray
-		switch( PreviousStatus )
+		switch( Timer.Status )
 		{
 			case ETimerStatus::Active : 
 				// Store time remaining in ExpireTime while paused
-				NewTimer.ExpireTime = NewTimer.ExpireTime - InternalTime;
-				ActiveTimerHeap.HeapRemoveAt(TimerIdx); 
+				Timer.ExpireTime = Timer.ExpireTime - InternalTime;
+				++NumStaleHeapEntries;
 				break;
 			
 			case ETimerStatus::Pending : 
-				PendingTimerList.RemoveAtSwap(TimerIdx); 
+				// the pending list entry is skipped once the timer is no longer pending
 				break;
 
 			default : check(false);
 		}
+
+		Timer.Status = ETimerStatus::Paused;
 	}
 }
 
-void FTimerManager::InternalUnPauseTimer(int32 PausedTimerIdx)
+void FTimerManager::InternalUnPauseTimer(int32 TimerIdx)
 {
 	// not currently threadsafe
 	check(IsInGameThread());
 
-	if (PausedTimerIdx != INDEX_NONE)
+	if (TimerIdx != INDEX_NONE && Timers[TimerIdx].Status == ETimerStatus::Paused)
 	{
-		FTimerData& TimerToUnPause = PausedTimerList[PausedTimerIdx];
-		check(TimerToUnPause.Status == ETimerStatus::Paused);
+		FTimerData& TimerToUnPause = Timers[TimerIdx];
 
-		// Move it out of paused list and into proper TArray
+		// Move it out of paused and into the proper state
 		if( HasBeenTickedThisFrame() )
 		{
 			// Convert from time remaining back to a valid ExpireTime
 			TimerToUnPause.ExpireTime += InternalTime;
-			TimerToUnPause.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush(TimerToUnPause);
+			PushActiveTimer(TimerIdx);
 		}
 		else
 		{
 			TimerToUnPause.Status = ETimerStatus::Pending;
-			PendingTimerList.Add(TimerToUnPause);
+			PendingTimerList.Add(TimerIdx);
 		}
-
-		// remove from paused list
-		PausedTimerList.RemoveAtSwap(PausedTimerIdx);
 	}
 }
 
@@ -491,15 +417,33 @@ void FTimerManager::Tick(float DeltaTime)
 
 	InternalTime += DeltaTime;
 
+	// Drop the stale entries once they outnumber the live ones, so cleared timers don't keep the heap deep
+	if (NumStaleHeapEntries > ActiveTimerHeap.Num() / 2)
+	{
+		ActiveTimerHeap.RemoveAll([this](const FTimerHeapEntry& Entry){ return !IsHeapEntryLive(Entry); });
+		ActiveTimerHeap.Heapify();
+		NumStaleHeapEntries = 0;
+	}
+
+	uint32 NumTimersFired = 0;
+
 	while (ActiveTimerHeap.Num() > 0)
 	{
-		FTimerData& Top = ActiveTimerHeap.HeapTop();
-		if (InternalTime > Top.ExpireTime)
+		FTimerHeapEntry const& Top = ActiveTimerHeap.HeapTop();
+		if (!IsHeapEntryLive(Top))
+		{
+			ActiveTimerHeap.HeapPopDiscard();
+			NumStaleHeapEntries = FMath::Max(NumStaleHeapEntries - 1, 0);
+		}
+		else if (InternalTime > Top.ExpireTime)
 		{
 			// Timer has expired! Fire the delegate, then handle potential looping.
 
 			// Remove it from the heap and store it while we're executing
-			ActiveTimerHeap.HeapPop(CurrentlyExecutingTimer); 
+			int32 const TimerIdx = Top.TimerIndex;
+			ActiveTimerHeap.HeapPopDiscard();
+			CurrentlyExecutingTimer = Timers[TimerIdx];
+			RemoveTimer(TimerIdx);
 
 			// Determine how many times the timer may have elapsed (e.g. for large DeltaTime on a short looping timer)
 			int32 const CallCount = CurrentlyExecutingTimer.bLoop ? 
@@ -510,6 +454,7 @@ void FTimerManager::Tick(float DeltaTime)
 			for (int32 CallIdx=0; CallIdx<CallCount; ++CallIdx)
 			{ 
 				CurrentlyExecutingTimer.TimerDelegate.Execute();
+				++NumTimersFired;
 
 				// If timer was cleared in the delegate execution, don't execute further 
 				if( !CurrentlyExecutingTimer.TimerHandle.IsValid() && !CurrentlyExecutingTimer.TimerDelegate.IsBound() )
@@ -528,7 +473,7 @@ void FTimerManager::Tick(float DeltaTime)
 			{
 				// Put this timer back on the heap
 				CurrentlyExecutingTimer.ExpireTime += CallCount * CurrentlyExecutingTimer.Rate;
-				ActiveTimerHeap.HeapPush(CurrentlyExecutingTimer);
+				PushActiveTimer(AddTimer(CurrentlyExecutingTimer));
 			}
 
 			CurrentlyExecutingTimer.TimerDelegate.Unbind();
@@ -540,6 +485,8 @@ void FTimerManager::Tick(float DeltaTime)
 		}
 	}
 
+	INC_DWORD_STAT_BY(STAT_TimersFired, NumTimersFired);
+
 	// Timer has been ticked.
 	LastTickedFrame = GFrameCounter;
 
@@ -548,13 +495,17 @@ void FTimerManager::Tick(float DeltaTime)
 	{
 		for(int32 Index=0; Index<PendingTimerList.Num(); Index++)
 		{
-			FTimerData& TimerToActivate = PendingTimerList[Index];
-			// Convert from time remaining back to a valid ExpireTime
-			TimerToActivate.ExpireTime += InternalTime;
-			TimerToActivate.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush( TimerToActivate );
+			int32 const TimerIdx = PendingTimerList[Index];
+
+			// timers cleared, paused or already activated since they were added are skipped
+			if (Timers.IsAllocated(TimerIdx) && Timers[TimerIdx].Status == ETimerStatus::Pending)
+			{
+				// Convert from time remaining back to a valid ExpireTime
+				Timers[TimerIdx].ExpireTime += InternalTime;
+				PushActiveTimer(TimerIdx);
+			}
 		}
-		PendingTimerList.Empty();
+		PendingTimerList.Reset();
 	}
 }
 
@@ -264,6 +264,53 @@ bool TimerManagerTest_LoopingTimers_DifferentHandles(UWorld* World, FAutomationT
 	return true;
 }
 
+// Clearing and pausing timers leaves stale entries in the active heap, make sure they never fire
+bool TimerManagerTest_ClearAndPauseManyTimers(UWorld* World, FAutomationTestBase* Test)
+{
+	FTimerManager& TimerManager = World->GetTimerManager();
+	const int32 NumTimers = 64;
+
+	int32 CallCount = 0;
+	auto Func = [](int* CallCount){ (*CallCount)++; };
+	FTimerDelegate Delegate = FTimerDelegate::CreateStatic(Func, &CallCount);
+
+	TArray<FTimerHandle> Handles;
+	Handles.Init(FTimerHandle(), NumTimers);
+	for (int32 Idx = 0; Idx < NumTimers; ++Idx)
+	{
+		TimerManager.SetTimer(Handles[Idx], Delegate, 0.5f + Idx * 0.01f, false);
+	}
+	TimerTest_TickWorld(World, KINDA_SMALL_NUMBER);
+
+	// clear one in four, pause one in four and reset one in four to a later time
+	for (int32 Idx = 0; Idx < NumTimers; Idx += 4)
+	{
+		TimerManager.ClearTimer(Handles[Idx]);
+		TimerManager.PauseTimer(Handles[Idx + 1]);
+		TimerManager.SetTimer(Handles[Idx + 2], Delegate, 5.f, false);
+	}
+
+	Test->TestFalse(TIMER_TEST_TEXT("Cleared timer no longer exists"), TimerManager.TimerExists(Handles[0]));
+	Test->TestTrue(TIMER_TEST_TEXT("Paused timer is paused"), TimerManager.IsTimerPaused(Handles[1]));
+	Test->TestTrue(TIMER_TEST_TEXT("Reset timer has its new time remaining"),
+		FMath::IsNearlyEqual(TimerManager.GetTimerRemaining(Handles[2]), 5.0f, 1e-2f));
+
+	TimerTest_TickWorld(World, 2.f);
+	Test->TestTrue(TIMER_TEST_TEXT("Only the untouched timers fired"), CallCount == NumTimers / 4);
+	Test->TestTrue(TIMER_TEST_TEXT("Paused timer still exists"), TimerManager.TimerExists(Handles[1]));
+
+	TimerManager.UnPauseTimer(Handles[1]);
+	TimerTest_TickWorld(World, 1.f);
+	Test->TestTrue(TIMER_TEST_TEXT("Unpaused timer fired"), CallCount == NumTimers / 4 + 1);
+
+	for (FTimerHandle& Handle : Handles)
+	{
+		TimerManager.ClearTimer(Handle);
+	}
+
+	return true;
+}
+
 bool FTimerManagerTest::RunTest(const FString& Parameters)
 {
 	UWorld *World = UWorld::CreateWorld(EWorldType::Game, false);
@@ -279,6 +326,7 @@ bool FTimerManagerTest::RunTest(const FString& Parameters)
 	TimerManagerTest_ValidTimer_HandleWithDelegate(World, this);
 	TimerManagerTest_ValidTimer_HandleLoopingSetDuringExecute(World, this);
 	TimerManagerTest_LoopingTimers_DifferentHandles(World, this);
+	TimerManagerTest_ClearAndPauseManyTimers(World, this);
 
 	GEngine->DestroyWorldContext(World);
 	World->DestroyWorld(false);
@@ -98,6 +98,7 @@
 #include "GameFramework/GameUserSettings.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "Engine/UserInterfaceSettings.h"
+#include "FramePipelineStats.h"
 
 DEFINE_LOG_CATEGORY(LogEngine);
 
@@ -152,6 +153,11 @@ static TAutoConsoleVariable<int32> CVarAllowOneFrameThreadLag(
 	TEXT("Whether to allow the rendering thread to lag one frame behind the game thread (0: disabled, otherwise enabled)")
 	);
 
+static TAutoConsoleVariable<int32> CVarCreateGCClusters(
+	TEXT("gc.CreateGCClusters"),
+	0,
+	TEXT("If 1, the static content of a map is grouped into a GC cluster once the map is loaded, so the GC doesn't walk it on every pass."));
+
 static FAutoConsoleVariable CVarSystemResolution(
 	TEXT("r.SetRes"),
 	TEXT("1280x720w"),
@@ -668,6 +674,22 @@ void UEngine::Init(IEngineLoop* InEngineLoop)
 	FURL::StaticInit();
 	ULinkerLoad::StaticInit(UTexture2D::StaticClass());
 
+	// Pool the objects of the classes that are iterated a lot.
+	TArray<FString> PooledObjectClasses;
+	GConfig->GetArray(TEXT("Core.System"), TEXT("PooledObjectClasses"), PooledObjectClasses, GEngineIni);
+	for (int32 ClassIndex = 0; ClassIndex < PooledObjectClasses.Num(); ++ClassIndex)
+	{
+		UClass* PooledClass = FindObject<UClass>(NULL, *PooledObjectClasses[ClassIndex]);
+		if (PooledClass)
+		{
+			GUObjectAllocator.RegisterPooledClass(PooledClass);
+		}
+		else
+		{
+			UE_LOG(LogEngine, Warning, TEXT("Unknown class %s in PooledObjectClasses."), *PooledObjectClasses[ClassIndex]);
+		}
+	}
+
 #if !UE_BUILD_SHIPPING
 	// Check for overrides to the default map on the command line
 	TCHAR MapName[512];
@@ -889,6 +911,7 @@ void UEngine::Init(IEngineLoop* InEngineLoop)
 	EngineStats.Add(FEngineStatFuncs(TEXT("STAT_UnitGraph"), TEXT("STATCAT_Engine"), FText::GetEmpty(), NULL, &UEngine::ToggleStatUnitGraph));
 	EngineStats.Add(FEngineStatFuncs(TEXT("STAT_UnitTime"), TEXT("STATCAT_Engine"), FText::GetEmpty(), NULL, &UEngine::ToggleStatUnitTime));
 	EngineStats.Add(FEngineStatFuncs(TEXT("STAT_Raw"), TEXT("STATCAT_Engine"), FText::GetEmpty(), NULL, &UEngine::ToggleStatRaw));
+	EngineStats.Add(FEngineStatFuncs(TEXT("STAT_Pipeline"), TEXT("STATCAT_Engine"), FText::GetEmpty(), &UEngine::RenderStatPipeline, NULL));
 #endif
 
 	// Let any listeners know about the new stats
@@ -2944,6 +2967,11 @@ bool UEngine::HandleToggleRHIThreadCommand( const TCHAR* Cmd, FOutputDevice& Ar
 		check(!GRHIThread);
 		Ar.Logf( TEXT("Can't switch to RHI thread mode when we are not running a multithreaded renderer."));
 	}
+	else if (!GRHISupportsRHIThread)
+	{
+		check(!GRHIThread);
+		Ar.Logf( TEXT("The current RHI does not support the RHI thread."));
+	}
 	else
 	{
 		bool bWasRHIThread = !!GRHIThread;
@@ -9051,6 +9079,12 @@ bool UEngine::LoadMap( FWorldContext& WorldContext, FURL URL, class UPendingNetG
 
 	// send a callback message
 	FCoreUObjectDelegates::PostLoadMap.Broadcast();
+
+	// Everything that's going to be hooked up on load is by now, static content keeps its references from here on
+	if (CVarCreateGCClusters.GetValueOnGameThread() != 0)
+	{
+		CreateGCCluster(WorldContext.World()->GetOutermost());
+	}
 	
 	WorldContext.World()->bWorldWasLoadedThisTick = true;
 
@@ -11163,6 +11197,14 @@ int32 UEngine::RenderStatUnit(UWorld* World, FViewport* Viewport, FCanvas* Canva
 	return Y;
 }
 
+// PIPELINE
+#if !UE_BUILD_SHIPPING
+int32 UEngine::RenderStatPipeline(UWorld* World, FViewport* Viewport, FCanvas* Canvas, int32 X, int32 Y, const FVector* ViewLocation, const FRotator* ViewRotation)
+{
+	return FFramePipelineStats::Get().DrawStat(Viewport, Canvas, X, Y);
+}
+#endif
+
 // UNITMAX
 #if !UE_BUILD_SHIPPING
 bool UEngine::ToggleStatUnitMax(UWorld* World, FCommonViewportClient* ViewportClient, const TCHAR* Stream)
@@ -111,6 +111,7 @@ UWorld::UWorld( const FObjectInitializer& ObjectInitializer )
 ,	NextTravelType(TRAVEL_Relative)
 {
 	TimerManager = new FTimerManager();
+	SignificanceManager = new FSignificanceManager();
 #if WITH_EDITOR
 	bBroadcastSelectionChange = true; //Ed Only
 #endif // WITH_EDITOR
@@ -450,6 +451,11 @@ void UWorld::FinishDestroy()
 		delete TimerManager;
 	}
 
+	if (SignificanceManager)
+	{
+		delete SignificanceManager;
+	}
+
 	// Remove the PKG_ContainsMap flag from packages that no longer contain a world
 	{
 		UPackage* WorldPackage = GetOutermost();
@@ -1472,6 +1478,9 @@ DEFINE_STAT(STAT_UpdateLevelStreamingTime);
  *
  * @return true if time limit has been exceeded, false otherwise
  */
+/** Running average of the time it takes to register a component during level streaming, in ms. 0 until measured */
+static double GLevelStreamingComponentRegistrationTime = 0.0;
+
 static bool IsTimeLimitExceeded( const TCHAR* CurrentTask, double StartTime, ULevel* Level )
 {
 	bool bIsTimeLimitExceed = false;
@@ -1625,11 +1634,26 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform )
 		// from disk rather than duplicated
 		const bool bRerunConstructionScript = !(FPlatformProperties::RequiresCookedData() || (IsPlayInEditor() && Level->bWasDuplicatedForPIE));
 		
-		// Incrementally update components.
-		int32 NumComponentsToUpdate = GEngine->LevelStreamingComponentsRegistrationGranularity;
+		// Incrementally update components. The granularity is the most components registered in one run, each run is also sized
+		// to what is left of the time limit, from the measured registration time, so a run of expensive components can't blow the limit
+		const int32 MaxComponentsToUpdate = GEngine->LevelStreamingComponentsRegistrationGranularity;
+		int32 NumComponentsToUpdate = MaxComponentsToUpdate;
 		do
 		{
-			Level->IncrementalUpdateComponents( (!IsGameWorld() || IsRunningCommandlet()) ? 0 : NumComponentsToUpdate, bRerunConstructionScript );
+			if ( bConsiderTimeLimit && MaxComponentsToUpdate > 0 && GLevelStreamingComponentRegistrationTime > 0.0 )
+			{
+				const double TimeLeft = GEngine->LevelStreamingActorsUpdateTimeLimit - (FPlatformTime::Seconds() - StartTime) * 1000;
+				NumComponentsToUpdate = FMath::Clamp( FMath::FloorToInt( TimeLeft / GLevelStreamingComponentRegistrationTime ), 1, MaxComponentsToUpdate );
+			}
+
+			const double RunStartTime = FPlatformTime::Seconds();
+			const int32 NumComponentsUpdated = Level->IncrementalUpdateComponents( (!IsGameWorld() || IsRunningCommandlet()) ? 0 : NumComponentsToUpdate, bRerunConstructionScript );
+
+			if ( NumComponentsUpdated > 0 )
+			{
+				const double RunTimePerComponent = (FPlatformTime::Seconds() - RunStartTime) * 1000 / NumComponentsUpdated;
+				GLevelStreamingComponentRegistrationTime = GLevelStreamingComponentRegistrationTime > 0.0 ? FMath::Lerp( GLevelStreamingComponentRegistrationTime, RunTimePerComponent, 0.25 ) : RunTimePerComponent;
+			}
 		}
 		while( (!bConsiderTimeLimit || !IsTimeLimitExceeded( TEXT("updating components"), StartTime, Level )) && !Level->bAreComponentsCurrentlyRegistered );
 
@@ -2483,6 +2507,10 @@ bool UWorld::Exec( UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar )
 	{		
 		return HandleDemoStopCommand( Cmd, Ar, InWorld );
 	}
+	else if( FParse::Command( &Cmd, TEXT("DEMOSCRUB") ) )
+	{		
+		return HandleDemoScrubCommand( Cmd, Ar, InWorld );
+	}
 	else if( ExecPhysCommands( Cmd, &Ar, InWorld ) )
 	{
 		return HandleLogActorCountsCommand( Cmd, Ar, InWorld );
@@ -2650,6 +2678,18 @@ bool UWorld::HandleDemoStopCommand( const TCHAR* Cmd, FOutputDevice& Ar, UWorld*
 	return true;
 }
 
+bool UWorld::HandleDemoScrubCommand( const TCHAR* Cmd, FOutputDevice& Ar, UWorld* InWorld )
+{
+	if ( DemoNetDriver == NULL || DemoNetDriver->ServerConnection == NULL )
+	{
+		Ar.Log( TEXT( "DEMOSCRUB: No demo is playing" ) );
+		return true;
+	}
+
+	DemoNetDriver->GotoTimeInSeconds( FCString::Atof( Cmd ) );
+	return true;
+}
+
 void UWorld::DestroyDemoNetDriver()
 {
 	if ( DemoNetDriver != NULL )
@@ -2953,6 +2993,8 @@ void UWorld::CleanupWorld(bool bSessionEnded, bool bCleanupResources, UWorld* Ne
 
 	FWorldDelegates::OnWorldCleanup.Broadcast(this, bSessionEnded, bCleanupResources);
 
+	ActorPool.Empty();
+
 	if (AISystem != NULL)
 	{
 		AISystem->CleanupWorld(bSessionEnded, bCleanupResources, NewWorld);
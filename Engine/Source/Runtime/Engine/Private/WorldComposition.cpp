@@ -15,8 +15,26 @@ UWorldComposition::FEnableWorldCompositionEvent UWorldComposition::EnableWorldCo
 UWorldComposition::FWorldCompositionChangedEvent UWorldComposition::WorldCompositionChangedEvent;
 #endif // WITH_EDITOR
 
+/** Number of points sampled along the projected view path when prefetching tiles */
+static const int32 TilesPrefetchNumSteps = 4;
+
+/** View velocity is not estimated across updates further apart than this (seconds), e.g. after a hitch or a pause */
+static const double TilesViewVelocityMaxDeltaTime = 1.0;
+
+/** Async load priorities of the tiles, tiles needed right now are loaded before the prefetched ones */
+enum ETileLoadPriority
+{
+	TileLoadPriority_Prefetch	= 0,
+	TileLoadPriority_Visible	= 1,
+};
+
 UWorldComposition::UWorldComposition(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, StreamingViewLocation(FVector::ZeroVector)
+	, StreamingViewTime(0.0)
+	, StreamingViewVelocity(FVector::ZeroVector)
+	, TilesPrefetchTime(0.f)
+	, TilesMaxNumHiddenLoaded(0)
 {
 }
 
@@ -536,7 +554,7 @@ void UWorldComposition::GetDistanceVisibleLevels(
 	}
 }
 
-void UWorldComposition::UpdateStreamingState(const FVector& InLocation)
+void UWorldComposition::UpdateStreamingState(const FVector& InLocation, const FVector& InVelocity)
 {
 	// Get the list of visible and hidden levels from current view point
 	TArray<FDistanceVisibleLevel> DistanceVisibleLevels;
@@ -544,16 +562,108 @@ void UWorldComposition::UpdateStreamingState(const FVector& InLocation)
 	GetDistanceVisibleLevels(InLocation, DistanceVisibleLevels, DistanceHiddenLevels);
 
 	UWorld* OwningWorld = GetWorld();
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	// Hidden levels which stay loaded, sorted by how soon they are going to be needed
+	struct FHiddenLoadedTile
+	{
+		int32	TileIdx;
+		int32	LODIndex;
+		int32	LoadPriority;
+		double	SortKey;
+
+		bool operator<(const FHiddenLoadedTile& Other) const
+		{
+			return SortKey < Other.SortKey;
+		}
+	};
+	TArray<FHiddenLoadedTile> HiddenLoadedTiles;
+	
+	if (TilesMaxNumHiddenLoaded > 0 && DistanceHiddenLevels.Num() > 0)
+	{
+		// LOD each hidden tile is needed at along the projected view path, and in how many seconds
+		TArray<int32> PrefetchLODIndex;
+		TArray<double> PrefetchTime;
+		PrefetchLODIndex.Init(INDEX_NONE, Tiles.Num());
+		PrefetchTime.Init(-1.0, Tiles.Num());
+		
+		if (TilesPrefetchTime > 0.f && !InVelocity.IsNearlyZero())
+		{
+			TArray<bool> bIsTileHidden;
+			bIsTileHidden.Init(false, Tiles.Num());
+			for (const auto& Level : DistanceHiddenLevels)
+			{
+				bIsTileHidden[Level.TileIdx] = true;
+			}
+			
+			TArray<FDistanceVisibleLevel> PredictedVisibleLevels;
+			TArray<FDistanceVisibleLevel> PredictedHiddenLevels;
+			for (int32 StepIdx = 1; StepIdx <= TilesPrefetchNumSteps; ++StepIdx)
+			{
+				const float StepTime = TilesPrefetchTime * StepIdx / TilesPrefetchNumSteps;
+				PredictedVisibleLevels.Reset();
+				PredictedHiddenLevels.Reset();
+				GetDistanceVisibleLevels(InLocation + InVelocity * StepTime, PredictedVisibleLevels, PredictedHiddenLevels);
+
+				// Keep LOD requested by the earliest step, the one tile is going to be shown with first
+				for (const auto& Level : PredictedVisibleLevels)
+				{
+					if (bIsTileHidden[Level.TileIdx] && PrefetchTime[Level.TileIdx] < 0.0)
+					{
+						PrefetchLODIndex[Level.TileIdx] = Level.LODIndex;
+						PrefetchTime[Level.TileIdx] = StepTime;
+					}
+				}
+			}
+		}
+
+		for (const auto& Level : DistanceHiddenLevels)
+		{
+			const ULevelStreaming* StreamingLevel = TilesStreaming[Level.TileIdx];
+			const FWorldCompositionTile& Tile = Tiles[Level.TileIdx];
+
+			if (PrefetchTime[Level.TileIdx] >= 0.0)
+			{
+				FHiddenLoadedTile HiddenTile = {Level.TileIdx, PrefetchLODIndex[Level.TileIdx], TileLoadPriority_Prefetch, PrefetchTime[Level.TileIdx]};
+				HiddenLoadedTiles.Add(HiddenTile);
+			}
+			else if (StreamingLevel->bShouldBeLoaded && Tile.LastVisibleTime > 0.0)
+			{
+				// Recently visible tiles stay loaded as they are, after all prefetched ones
+				FHiddenLoadedTile HiddenTile = {Level.TileIdx, StreamingLevel->LevelLODIndex, TileLoadPriority_Prefetch, TilesPrefetchTime + (CurrentTime - Tile.LastVisibleTime)};
+				HiddenLoadedTiles.Add(HiddenTile);
+			}
+		}
+
+		HiddenLoadedTiles.Sort();
+		
+		// Evict whatever does not fit in the budget
+		if (HiddenLoadedTiles.Num() > TilesMaxNumHiddenLoaded)
+		{
+			HiddenLoadedTiles.SetNum(TilesMaxNumHiddenLoaded);
+		}
+	}
 
-	// Set distance hidden levels to unload
+	// Set distance hidden levels to unload, unless they stay loaded
 	for (const auto& Level : DistanceHiddenLevels)
 	{
-		CommitTileStreamingState(OwningWorld, Level.TileIdx, false, false, Level.LODIndex);
+		const FHiddenLoadedTile* HiddenTile = HiddenLoadedTiles.FindByPredicate([&](const FHiddenLoadedTile& Other) { return Other.TileIdx == Level.TileIdx; });
+		if (HiddenTile)
+		{
+			TilesStreaming[Level.TileIdx]->SetLoadPriority(HiddenTile->LoadPriority);
+			CommitTileStreamingState(OwningWorld, Level.TileIdx, true, false, HiddenTile->LODIndex);
+		}
+		else
+		{
+			CommitTileStreamingState(OwningWorld, Level.TileIdx, false, false, Level.LODIndex);
+		}
 	}
 
 	// Set distance visible levels to load
 	for (const auto& Level : DistanceVisibleLevels)
 	{
+		Tiles[Level.TileIdx].LastVisibleTime = CurrentTime;
+		TilesStreaming[Level.TileIdx]->SetLoadPriority(TileLoadPriority_Visible);
 		CommitTileStreamingState(OwningWorld, Level.TileIdx, true, true, Level.LODIndex);
 	}
 }
@@ -597,12 +707,30 @@ void UWorldComposition::UpdateStreamingState()
 	if (NumViews > 0)
 	{
 		CentroidLocation/= NumViews;
+
+		// Estimate view velocity in absolute space, so world origin shifts don't show up as movement
+		const FVector AbsoluteLocation = CentroidLocation + FVector(PlayWorld->OriginLocation);
+		const double CurrentTime = FPlatformTime::Seconds();
+		const double DeltaTime = CurrentTime - StreamingViewTime;
+		if (DeltaTime > TilesViewVelocityMaxDeltaTime)
+		{
+			StreamingViewVelocity = FVector::ZeroVector;
+		}
+		else if (DeltaTime > 0.0)
+		{
+			// Smoothed, so a single uneven frame doesn't send prefetching off in a random direction
+			const FVector Velocity = (AbsoluteLocation - StreamingViewLocation) / DeltaTime;
+			StreamingViewVelocity = FMath::Lerp(StreamingViewVelocity, Velocity, 0.25f);
+		}
+		StreamingViewLocation = AbsoluteLocation;
+		StreamingViewTime = CurrentTime;
+		
 		if (PlayWorld->GetWorldSettings()->bEnableWorldOriginRebasing)
 		{
 			EvaluateWorldOriginLocation(CentroidLocation);
 		}
 		
-		UpdateStreamingState(CentroidLocation);
+		UpdateStreamingState(CentroidLocation, StreamingViewVelocity);
 	}
 }
 
@@ -646,8 +774,10 @@ void UWorldComposition::CommitTileStreamingState(UWorld* PersistenWorld, int32 T
 	}
 
 	// Quit early in case we have cooldown on streaming state changes
+	// Showing a tile which is already loaded with the requested LOD is never held back, that's what it was prefetched for
+	const bool bShowLoadedTile = (StreamingLevel->bShouldBeLoaded && bShouldBeLoaded && bShouldBeVisible && StreamingLevel->LevelLODIndex == LODIdx);
 	const bool bUseStreamingStateCooldown = (PersistenWorld->IsGameWorld() && PersistenWorld->FlushLevelStreamingType == EFlushLevelStreamingType::None);
-	if (bUseStreamingStateCooldown && TilesStreamingTimeThreshold > 0.0)
+	if (bUseStreamingStateCooldown && TilesStreamingTimeThreshold > 0.0 && !bShowLoadedTile)
 	{
 		const double CurrentTime = FPlatformTime::Seconds();
 		const double TimePassed = CurrentTime - Tile.StreamingLevelStateChangeTime;
@@ -101,8 +101,9 @@ public:
 	/** Supported queries */
 
 	// @TODONAV
-	/** Generates path from the given query. Synchronous. */
-	ENavigationQueryResult::Type FindPath(const FVector& StartLoc, const FVector& EndLoc, FNavMeshPath& Path, const FNavigationQueryFilter& Filter, const UObject* Owner) const;
+	/** Generates path from the given query. Synchronous. 
+	 *	@param bUseClusterGraph	searches only polygons along the path found on cluster graph first, see dtNavMeshQuery::findPathHierarchical */
+	ENavigationQueryResult::Type FindPath(const FVector& StartLoc, const FVector& EndLoc, FNavMeshPath& Path, const FNavigationQueryFilter& Filter, const UObject* Owner, bool bUseClusterGraph = false) const;
 
 	/** Check if path exists */
 	ENavigationQueryResult::Type TestPath(const FVector& StartLoc, const FVector& EndLoc, const FNavigationQueryFilter& Filter, const UObject* Owner, int32* NumVisitedNodes = 0) const;
@@ -416,8 +416,8 @@ protected:
 	/** Marks grid tiles affected by specified areas as dirty */
 	void MarkDirtyTiles(const TArray<FNavigationDirtyArea>& DirtyAreas);
 	
-	/** Processes pending tile generattion tasks */
-	TArray<uint32> ProcessTileTasks(const int32 NumTasksToSubmit);
+	/** Processes pending tile generattion tasks. Stops starting and adding tiles once TimeBudgetMs is spent, if > 0 */
+	TArray<uint32> ProcessTileTasks(const int32 NumTasksToSubmit, const float TimeBudgetMs = 0.f);
 
 	/** Adds generated tiles to NavMesh, replacing old ones */
 	TArray<uint32> AddGeneratedTiles(const FRecastTileGenerator& TileGenerator);
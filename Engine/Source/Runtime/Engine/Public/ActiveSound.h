@@ -247,6 +247,9 @@ public:
 private:
 	void UpdateAdjustVolumeMultiplier(const float DeltaTime);
 
+	/** Returns true if this is a looping sound too far from the closest listener to be heard, see UpdateWaveInstances */
+	bool IsOutOfRangeLoop( const struct FListener& ClosestListener ) const;
+
 	/** if OcclusionCheckInterval > 0.0, checks if the sound has become (un)occluded during playback
 	 * and calls eventOcclusionChanged() if so
 	 * primarily used for gameplay-relevant ambient sounds
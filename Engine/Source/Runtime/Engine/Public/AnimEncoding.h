@@ -149,6 +149,27 @@ class FMemoryReader;
 void PadMemoryWriter(FMemoryWriter* MemoryWriter, uint8*& TrackData, const int32 Alignment);
 void PadMemoryReader(FMemoryReader* MemoryReader, uint8*& TrackData, const int32 Alignment);
 
+/** How many tracks ahead the batch solvers prefetch the key data of, so it is in the cache when the track is decoded */
+#define ANIMATION_CODEC_PREFETCH_DISTANCE 4
+
+/**
+ * Fast linear interpolation between two rotation keys, taking the shortest route, with a normalized result.
+ * Runs on vector registers instead of the scalar FQuat operators.
+ *
+ * @param	R0		The key before the time to solve for.
+ * @param	R1		The key after the time to solve for.
+ * @param	Alpha	The blend weight of R1.
+ * @return	The blended rotation.
+ */
+FORCEINLINE FQuat BlendRotationKeys(const FQuat& R0, const FQuat& R1, float Alpha)
+{
+	const VectorRegister BlendedQuat = VectorLerpQuat(VectorLoadAligned(&R0), VectorLoadAligned(&R1), VectorLoadFloat1(&Alpha));
+
+	FQuat Result;
+	VectorStoreAligned(VectorNormalizeQuaternion(BlendedQuat), &Result);
+	return Result;
+}
+
 
 class AnimEncoding
 {
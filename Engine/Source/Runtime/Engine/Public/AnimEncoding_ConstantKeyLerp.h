@@ -159,6 +159,20 @@ public:
 		float RelativePos);
 #if USE_ANIMATION_CODEC_BATCH_SOLVER
 
+	/**
+	 * Prefetches the key a batch solver will read first for a track. Keys are evenly spaced, so it is found without the full TimeToIndex
+	 *
+	 * @param	Stream			The compressed animation data of the track.
+	 * @param	NumKeys			The number of keys present in Stream.
+	 * @param	KeySize			The size of a key in Stream.
+	 * @param	RelativePos		Current position within the animation to solve for in the range [0.0,1.0].
+	 */
+	static void PrefetchKeys(
+		const uint8* RESTRICT Stream,
+		int32 NumKeys,
+		int32 KeySize,
+		float RelativePos);
+
 	/**
 	 * Decompress all requested rotation components from an Animation Sequence
 	 *
@@ -254,14 +268,7 @@ FORCEINLINE void AEFConstantKeyLerp<FORMAT>::GetBoneAtomRotation(
 			DecompressRotation<FORMAT>( R0, RotStream, KeyData0 );
 			DecompressRotation<FORMAT>( R1, RotStream, KeyData1 );
 
-			// Fast linear quaternion interpolation.
-			// To ensure the 'shortest route', we make sure the dot product between the two keys is positive.
-			const float DotResult = (R0 | R1);
-			const float Bias = FMath::FloatSelect(DotResult, 1.0f, -1.0f);
-
-			FQuat BlendedQuat = (R0 * (1.f-Alpha)) + (R1 * (Alpha * Bias));
-			BlendedQuat.Normalize();
-			OutAtom.SetRotation( BlendedQuat );
+			OutAtom.SetRotation( BlendRotationKeys(R0, R1, Alpha) );
 		}
 		else // (Index0 == Index1)
 		{
@@ -367,6 +374,32 @@ FORCEINLINE void AEFConstantKeyLerp<FORMAT>::GetBoneAtomScale(
 
 #if USE_ANIMATION_CODEC_BATCH_SOLVER
 
+/**
+ * Prefetches the key a batch solver will read first for a track. Keys are evenly spaced, so it is found without the full TimeToIndex
+ *
+ * @param	Stream			The compressed animation data of the track.
+ * @param	NumKeys			The number of keys present in Stream.
+ * @param	KeySize			The size of a key in Stream.
+ * @param	RelativePos		Current position within the animation to solve for in the range [0.0,1.0].
+ */
+template<int32 FORMAT>
+FORCEINLINE void AEFConstantKeyLerp<FORMAT>::PrefetchKeys(
+	const uint8* RESTRICT Stream,
+	int32 NumKeys,
+	int32 KeySize,
+	float RelativePos)
+{
+	// Holds the Min and Range data, or the only key
+	FPlatformMisc::Prefetch(Stream);
+
+	if (NumKeys > 1)
+	{
+		const int32 StreamOffset = (FORMAT == ACF_IntervalFixed32NoW) ? (sizeof(float)*6) : 0; // offset past Min and Range data
+		const int32 KeyIndex = FMath::Clamp(FMath::TruncToInt(RelativePos * float(NumKeys - 1)), 0, NumKeys - 1);
+		FPlatformMisc::Prefetch(Stream + StreamOffset + KeyIndex*KeySize);
+	}
+}
+
 /**
  * Decompress all requested rotation components from an Animation Sequence
  *
@@ -385,9 +418,17 @@ inline void AEFConstantKeyLerp<FORMAT>::GetPoseRotations(
 {
 	const int32 PairCount = DesiredPairs.Num();
 	const float RelativePos = Time / (float)Seq.SequenceLength;
+	const int32 KeySize = CompressedRotationStrides[FORMAT]*CompressedRotationNum[FORMAT];
 
 	for (int32 PairIndex=0; PairIndex<PairCount; ++PairIndex)
 	{
+		const int32 PrefetchIndex = PairIndex + ANIMATION_CODEC_PREFETCH_DISTANCE;
+		if (PrefetchIndex < PairCount)
+		{
+			const int32* RESTRICT PrefetchTrackData = Seq.CompressedTrackOffsets.GetData() + (DesiredPairs[PrefetchIndex].TrackIndex*4);
+			PrefetchKeys(Seq.CompressedByteStream.GetData() + *(PrefetchTrackData+2), *(PrefetchTrackData+3), KeySize, RelativePos);
+		}
+
 		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
 		const int32 TrackIndex = Pair.TrackIndex;
 		const int32 AtomIndex = Pair.AtomIndex;
@@ -440,6 +481,13 @@ inline void AEFConstantKeyLerp<FORMAT>::GetPoseTranslations(
 			FPlatformMisc::Prefetch(Atoms.GetData() + DesiredPairs[PrefetchIndex].AtomIndex);
 		}
 
+		const int32 KeysPrefetchIndex = PairIndex + ANIMATION_CODEC_PREFETCH_DISTANCE;
+		if (KeysPrefetchIndex < PairCount)
+		{
+			const int32* RESTRICT PrefetchTrackData = Seq.CompressedTrackOffsets.GetData() + (DesiredPairs[KeysPrefetchIndex].TrackIndex*4);
+			PrefetchKeys(Seq.CompressedByteStream.GetData() + *(PrefetchTrackData+0), *(PrefetchTrackData+1), CompressedTranslationStrides[FORMAT]*CompressedTranslationNum[FORMAT], RelativePos);
+		}
+
 		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
 		const int32 TrackIndex = Pair.TrackIndex;
 		const int32 AtomIndex = Pair.AtomIndex;
@@ -494,6 +542,13 @@ inline void AEFConstantKeyLerp<FORMAT>::GetPoseScales(
 			FPlatformMisc::Prefetch(Atoms.GetData() + DesiredPairs[PrefetchIndex].AtomIndex);
 		}
 
+		const int32 KeysPrefetchIndex = PairIndex + ANIMATION_CODEC_PREFETCH_DISTANCE;
+		if (KeysPrefetchIndex < PairCount)
+		{
+			const int32 PrefetchTrackIndex = DesiredPairs[KeysPrefetchIndex].TrackIndex;
+			PrefetchKeys(Seq.CompressedByteStream.GetData() + Seq.CompressedScaleOffsets.GetOffsetData(PrefetchTrackIndex, 0), Seq.CompressedScaleOffsets.GetOffsetData(PrefetchTrackIndex, 1), CompressedScaleStrides[FORMAT]*CompressedScaleNum[FORMAT], RelativePos);
+		}
+
 		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
 		const int32 TrackIndex = Pair.TrackIndex;
 		const int32 AtomIndex = Pair.AtomIndex;
@@ -163,6 +163,22 @@ public:
 
 #if USE_ANIMATION_CODEC_BATCH_SOLVER
 
+	/**
+	 * Prefetches the start of a track and the part of its frame table TimeToIndex starts searching from
+	 *
+	 * @param	Seq				The animation sequence to use.
+	 * @param	Stream			The compressed animation data of the track.
+	 * @param	NumKeys			The number of keys present in Stream.
+	 * @param	KeySize			The size of a key in Stream.
+	 * @param	RelativePos		Current position within the animation to solve for in the range [0.0,1.0].
+	 */
+	static void PrefetchKeys(
+		const UAnimSequence& Seq,
+		const uint8* RESTRICT Stream,
+		int32 NumKeys,
+		int32 KeySize,
+		float RelativePos);
+
 	/**
 	 * Decompress all requested rotation components from an Animation Sequence
 	 *
@@ -259,13 +275,7 @@ FORCEINLINE_DEBUGGABLE void AEFVariableKeyLerp<FORMAT>::GetBoneAtomRotation(
 			DecompressRotation<FORMAT>( R0, RotStream, KeyData0 );
 			DecompressRotation<FORMAT>( R1, RotStream, KeyData1 );
 
-			// Fast linear quaternion interpolation.
-			// To ensure the 'shortest route', we make sure the dot product between the two keys is positive.
-			const float DotResult = (R0 | R1);
-			const float Bias = FMath::FloatSelect(DotResult, 1.0f, -1.0f);
-			FQuat RLerped((R0 * (1.f-Alpha)) + (R1 * (Alpha * Bias)));
-			RLerped.Normalize();
-			OutAtom.SetRotation(RLerped);
+			OutAtom.SetRotation(BlendRotationKeys(R0, R1, Alpha));
 		}
 		else // (Index0 == Index1)
 		{
@@ -377,6 +387,35 @@ FORCEINLINE_DEBUGGABLE void AEFVariableKeyLerp<FORMAT>::GetBoneAtomScale(
 
 #if USE_ANIMATION_CODEC_BATCH_SOLVER
 
+/**
+ * Prefetches the start of a track and the part of its frame table TimeToIndex starts searching from
+ *
+ * @param	Seq				The animation sequence to use.
+ * @param	Stream			The compressed animation data of the track.
+ * @param	NumKeys			The number of keys present in Stream.
+ * @param	KeySize			The size of a key in Stream.
+ * @param	RelativePos		Current position within the animation to solve for in the range [0.0,1.0].
+ */
+template<int32 FORMAT>
+FORCEINLINE void AEFVariableKeyLerp<FORMAT>::PrefetchKeys(
+	const UAnimSequence& Seq,
+	const uint8* RESTRICT Stream,
+	int32 NumKeys,
+	int32 KeySize,
+	float RelativePos)
+{
+	FPlatformMisc::Prefetch(Stream);
+
+	if (NumKeys > 1)
+	{
+		const int32 StreamOffset = (FORMAT == ACF_IntervalFixed32NoW) ? (sizeof(float)*6) : 0; // offset past Min and Range data
+		const uint8* RESTRICT FrameTable = Align(Stream + StreamOffset + NumKeys*KeySize, 4);
+		const int32 KeyEstimate = FMath::Clamp(FMath::TruncToInt(RelativePos * float(NumKeys - 1)), 0, NumKeys - 1);
+		const int32 FrameSize = (Seq.NumFrames > 0xFF) ? sizeof(uint16) : sizeof(uint8);
+		FPlatformMisc::Prefetch(FrameTable + KeyEstimate*FrameSize);
+	}
+}
+
 /**
  * Decompress all requested rotation components from an Animation Sequence
  *
@@ -395,9 +434,17 @@ FORCEINLINE_DEBUGGABLE void AEFVariableKeyLerp<FORMAT>::GetPoseRotations(
 {
 	const int32 PairCount = DesiredPairs.Num();
 	const float RelativePos = Time / (float)Seq.SequenceLength;
+	const int32 KeySize = CompressedRotationStrides[FORMAT]*CompressedRotationNum[FORMAT];
 
 	for (int32 PairIndex=0; PairIndex<PairCount; ++PairIndex)
 	{
+		const int32 PrefetchIndex = PairIndex + ANIMATION_CODEC_PREFETCH_DISTANCE;
+		if (PrefetchIndex < PairCount)
+		{
+			const int32* RESTRICT PrefetchTrackData = Seq.CompressedTrackOffsets.GetData() + (DesiredPairs[PrefetchIndex].TrackIndex*4);
+			PrefetchKeys(Seq, Seq.CompressedByteStream.GetData() + *(PrefetchTrackData+2), *(PrefetchTrackData+3), KeySize, RelativePos);
+		}
+
 		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
 		const int32 TrackIndex = Pair.TrackIndex;
 		const int32 AtomIndex = Pair.AtomIndex;
@@ -431,9 +478,17 @@ FORCEINLINE_DEBUGGABLE void AEFVariableKeyLerp<FORMAT>::GetPoseTranslations(
 {
 	const int32 PairCount= DesiredPairs.Num();
 	const float RelativePos = Time / (float)Seq.SequenceLength;
+	const int32 KeySize = CompressedTranslationStrides[FORMAT]*CompressedTranslationNum[FORMAT];
 
 	for (int32 PairIndex=0; PairIndex<PairCount; ++PairIndex)
 	{
+		const int32 PrefetchIndex = PairIndex + ANIMATION_CODEC_PREFETCH_DISTANCE;
+		if (PrefetchIndex < PairCount)
+		{
+			const int32* RESTRICT PrefetchTrackData = Seq.CompressedTrackOffsets.GetData() + (DesiredPairs[PrefetchIndex].TrackIndex*4);
+			PrefetchKeys(Seq, Seq.CompressedByteStream.GetData() + *(PrefetchTrackData+0), *(PrefetchTrackData+1), KeySize, RelativePos);
+		}
+
 		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
 		const int32 TrackIndex = Pair.TrackIndex;
 		const int32 AtomIndex = Pair.AtomIndex;
@@ -469,9 +524,17 @@ FORCEINLINE_DEBUGGABLE void AEFVariableKeyLerp<FORMAT>::GetPoseScales(
 
 	const int32 PairCount= DesiredPairs.Num();
 	const float RelativePos = Time / (float)Seq.SequenceLength;
+	const int32 KeySize = CompressedScaleStrides[FORMAT]*CompressedScaleNum[FORMAT];
 
 	for (int32 PairIndex=0; PairIndex<PairCount; ++PairIndex)
 	{
+		const int32 PrefetchIndex = PairIndex + ANIMATION_CODEC_PREFETCH_DISTANCE;
+		if (PrefetchIndex < PairCount)
+		{
+			const int32 PrefetchTrackIndex = DesiredPairs[PrefetchIndex].TrackIndex;
+			PrefetchKeys(Seq, Seq.CompressedByteStream.GetData() + Seq.CompressedScaleOffsets.GetOffsetData(PrefetchTrackIndex, 0), Seq.CompressedScaleOffsets.GetOffsetData(PrefetchTrackIndex, 1), KeySize, RelativePos);
+		}
+
 		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
 		const int32 TrackIndex = Pair.TrackIndex;
 		const int32 AtomIndex = Pair.AtomIndex;
@@ -149,3 +149,49 @@ public:
 
 typedef FAsyncTask<FAsyncAudioDecompressWorker> FAsyncAudioDecompress;
 
+/**
+ * Decodes the next buffer of a realtime decompressed sound on a pool thread, so starting or servicing
+ * realtime sources doesn't decode on the audio thread. T is the platform sound buffer, it must provide
+ * bool ReadCompressedData( uint8* Destination, bool bLooping ), and not be touched until the task is done.
+ */
+template<class T>
+class FAsyncRealtimeAudioDecodeWorker : public FNonAbandonableTask
+{
+protected:
+	T*			Buffer;
+	uint8*		Destination;
+	bool		bLooping;
+	bool		bLooped;
+
+public:
+	FAsyncRealtimeAudioDecodeWorker(T* InBuffer, uint8* InDestination, bool bInLooping)
+		: Buffer(InBuffer)
+		, Destination(InDestination)
+		, bLooping(bInLooping)
+		, bLooped(false)
+	{
+	}
+
+	/**
+	 * Decodes one buffer of PCM data
+	 */
+	void DoWork()
+	{
+		bLooped = Buffer->ReadCompressedData(Destination, bLooping);
+	}
+
+	/** @return whether the end of the data was reached by the decode, valid once the task is done */
+	bool GetLooped() const
+	{
+		return bLooped;
+	}
+
+	/** Give the name for external event viewers
+	* @return	the name to display in external event viewers
+	*/
+	static const TCHAR *Name()
+	{
+		return TEXT("FAsyncRealtimeAudioDecode");
+	}
+};
+
@@ -65,6 +65,7 @@ class UActorComponent;
 class UPrimitiveComponent;
 class AActor;
 class UTexture2D;
+class UStaticMesh;
 class FSoundSource;
 template<typename T>
 class FAsyncTask;
@@ -516,6 +517,24 @@ struct IAudioStreamingManager : public IStreamingManager
 	virtual const uint8* GetLoadedChunk(const USoundWave* SoundWave, uint32 ChunkIndex) const = 0;
 };
 
+/**
+ * Interface to add functions specifically related to mesh LOD streaming
+ */
+struct IMeshStreamingManager : public IStreamingManager
+{
+	/** Adds a new Static Mesh with streamed LODs to the streaming manager. */
+	virtual void AddStreamingMesh(UStaticMesh* StaticMesh) = 0;
+
+	/** Removes a Static Mesh from the streaming manager, waiting for its pending requests. The LODs it streamed in stay initialized. */
+	virtual void RemoveStreamingMesh(UStaticMesh* StaticMesh) = 0;
+
+	/** Returns true if this is a Static Mesh that is managed by the streaming manager. */
+	virtual bool IsManagedStreamingMesh(const UStaticMesh* StaticMesh) const = 0;
+
+	/** Loads all the LODs of a managed Static Mesh right away and never streams them out again, for the users that need them all. */
+	virtual void ForceAllLODsResident(UStaticMesh* StaticMesh) = 0;
+};
+
 /**
  * Streaming manager collection, routing function calls to streaming managers that have been added
  * via AddStreamingManager.
@@ -599,6 +618,11 @@ struct FStreamingManagerCollection : public IStreamingManager
 	 */
 	ENGINE_API IAudioStreamingManager& GetAudioStreamingManager() const;
 
+	/**
+	 * Gets a reference to the Mesh Streaming Manager interface
+	 */
+	ENGINE_API IMeshStreamingManager& GetMeshStreamingManager() const;
+
 	/**
 	 * Adds a streaming manager to the array of managers to route function calls to.
 	 *
@@ -698,6 +722,9 @@ protected:
 
 	/** The audio streaming manager, should always exist */
 	IAudioStreamingManager* AudioStreamingManager;
+
+	/** The mesh streaming manager, should always exist */
+	IMeshStreamingManager* MeshStreamingManager;
 };
 
 /*-----------------------------------------------------------------------------
@@ -985,6 +1012,16 @@ struct FStreamingManagerTexture : public ITextureStreamingManager
 	 */
 	virtual void NotifyPrimitiveUpdated( const UPrimitiveComponent* Primitive );
 
+	/**
+	 * Reports the number of mips the GPU sampled from a texture, e.g. read back from the feedback buffer of a low resolution pass.
+	 * While r.Streaming.UseGPUFeedback is set, recent feedback replaces the distance based heuristics of the texture.
+	 * Game thread only, the feedback is applied at the start of the next update.
+	 *
+	 * @param Texture		Texture that was sampled
+	 * @param SampledMips	Number of mips needed for the most detailed mip sampled (including the base mip)
+	 */
+	void SetTextureFeedback( UTexture2D* Texture, int32 SampledMips );
+
 	bool AddDynamicPrimitive( const UPrimitiveComponent* Primitive, EDynamicPrimitiveType DynamicType );
 	bool RemoveDynamicPrimitive( const UPrimitiveComponent* Primitive, EDynamicPrimitiveType DynamicType );
 
@@ -1192,6 +1229,15 @@ protected:
 
 			/** from cvar, >=0 */
 			float MipBias;
+
+			/** from r.OnlyStreamInTextures, looked up on the game thread since the mips are computed on several threads */
+			bool bOnlyStreamInTextures;
+
+			/** from r.Streaming.UseGPUFeedback */
+			bool bUseGPUFeedback;
+
+			/** from r.Streaming.GPUFeedbackTimeout, in seconds */
+			float GPUFeedbackTimeout;
 		};
 
 		/** Thread-safe helper data for streaming information. */
@@ -1242,6 +1288,9 @@ protected:
 	/** New textures, before they've been added to the thread-safe container. */
 	TArray<UTexture2D*>		PendingStreamingTextures;
 
+	/** GPU feedback reported by SetTextureFeedback, before it's been copied to the thread-safe container. */
+	TMap<UTexture2D*,int32>	PendingTextureFeedback;
+
 	struct FPendingPrimitiveType
 	{
 		FPendingPrimitiveType( EDynamicPrimitiveType InDynamicType, bool bInShouldTrack )
@@ -317,5 +317,6 @@
 #include "CanvasTypes.h"							// Canvas.
 #include "EngineUtils.h"
 #include "TimerManager.h"					// Game play timers
+#include "SignificanceManager.h"				// Significance of gameplay objects
 #include "SlateCore.h"
 #include "SlateBasics.h"
@@ -35,6 +35,7 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("Deferred Tick Time"),STAT_DeferredTickTime,STATG
  */
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Async Physics Time"),STAT_PhysicsTime,STATGROUP_Game, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn Actor Time"),STAT_SpawnActorTime,STATGROUP_Game, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn Actor From Pool Time"),STAT_SpawnActorFromPoolTime,STATGROUP_Game, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("MoveComponent Time"),STAT_MoveComponentTime,STATGROUP_Game, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateOverlaps Time"),STAT_UpdateOverlaps,STATGROUP_Game, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdatePhysicsVolume Time"),STAT_UpdatePhysicsVolume,STATGROUP_Game, );
@@ -65,6 +66,7 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("  Consider Actors Time"),STAT_NetConsiderActorsT
 DECLARE_CYCLE_STAT_EXTERN(TEXT("  Inital Dormant Time"),STAT_NetInitialDormantCheckTime,STATGROUP_Game, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("  Prioritize Actors Time"),STAT_NetPrioritizeActorsTime,STATGROUP_Game, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("  Replicate Actors Time"),STAT_NetReplicateActorsTime,STATGROUP_Game, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("  Parallel Replicate Time"),STAT_NetParallelReplicateTime,STATGROUP_Game, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("  Dynamic Property Rep Time"),STAT_NetReplicateDynamicPropTime,STATGROUP_Game, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("  Skipped Dynamic Props"),STAT_NetSkippedDynamicProps,STATGROUP_Game, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("  NetSerializeItemDelta Time"),STAT_NetSerializeItemDeltaTime,STATGROUP_Game, );
@@ -46,6 +46,12 @@ namespace FXConsoleVariables
 	extern int32 VisualizeGPUSimulation;
 	/** true if GPU emitters are permitted to sort. */
 	extern int32 bAllowGPUSorting;
+	/** true if GPU emitters may start from the order of the previous frame instead of a full sort. */
+	extern int32 bAllowCoherentGPUSorting;
+	/** Number of pairs of local sort passes refining the order of the previous frame. */
+	extern int32 CoherentGPUSortPasses;
+	/** Distance a sorting view can move in a frame before the order of the previous frame is discarded. */
+	extern float CoherentGPUSortMaxViewMove;
 	/** true if emitters can be culled. */
 	extern int32 bAllowCulling;
 	/** true if GPU particle simulation is frozen. */
@@ -54,6 +60,8 @@ namespace FXConsoleVariables
 	extern int32 bFreezeParticleSimulation;
 	/** true if we allow async ticks */
 	extern int32 bAllowAsyncTick;
+	/** true if emitters using only modules with a vectorized update are updated in a single pass */
+	extern int32 bAllowVectorizedUpdate;
 	/** Amount of slack to allocate for GPU particles to prevent tile churn as percentage of total particles. */
 	extern float ParticleSlackGPU;
 	/** Maximum tile preallocation for GPU particles. */
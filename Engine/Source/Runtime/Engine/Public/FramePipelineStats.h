@@ -0,0 +1,98 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+FramePipelineStats.h: Per frame timings of the game, rendering and RHI threads and of the GPU.
+=============================================================================*/
+
+#pragma once
+
+#if !UE_BUILD_SHIPPING
+
+/** Stage of the frame pipeline that limited a frame. */
+namespace EFramePipelineBound
+{
+	enum Type
+	{
+		/** No stage was busy for most of the frame, e.g. the frame rate is capped. */
+		None,
+		Game,
+		Render,
+		RHI,
+		GPU,
+		Num
+	};
+
+	ENGINE_API const TCHAR* ToString(EFramePipelineBound::Type Bound);
+}
+
+/** Timings of one frame, in milliseconds. */
+struct FFramePipelineSample
+{
+	float FrameTime;
+	/** Game thread time, excluding its waits. */
+	float GameThreadTime;
+	/** Time the game thread was blocked on rendering thread fences. */
+	float GameThreadWaitTime;
+	/** Rendering thread time, excluding its waits. */
+	float RenderThreadTime;
+	/** Time the rendering thread was blocked on the RHI thread. */
+	float RenderThreadWaitTime;
+	/** Time the RHI thread executed command lists. 0 without an RHI thread, the RHI work is then part of the rendering thread time. */
+	float RHIThreadTime;
+	/** Time the rendering thread spent presenting, which is where it waits on the GPU and for vsync. */
+	float PresentTime;
+	/** Time the GPU was busy, 0 if the RHI doesn't time its frames. */
+	float GPUTime;
+	/** Number of frames the rendering thread is behind the game thread. */
+	int32 FramesInFlight;
+	/** What limited the frame, see Classify. */
+	EFramePipelineBound::Type Bound;
+
+	/**
+	 * Returns the stage that was busy the longest, if it was busy for at least BoundThreshold of the frame.
+	 * Without GPU timings, the GPU is assumed to be busy while the rendering thread works and then presents.
+	 */
+	ENGINE_API static EFramePipelineBound::Type Classify(const FFramePipelineSample& Sample, float BoundThreshold);
+};
+
+/**
+ * Rolling buffer of the pipeline timings of the last frames, displayed by "stat pipeline" and written by the DumpFramePipeline command.
+ * Sampled once per frame on the game thread. The timings of each thread are the ones of the last frame it completed,
+ * so with r.OneFrameThreadLag the rendering thread and GPU ones are a frame behind the game thread ones.
+ */
+class ENGINE_API FFramePipelineStats
+{
+public:
+	static FFramePipelineStats& Get();
+
+	/** Records the timings of the last frame. Game thread only. */
+	void Tick(float DeltaSeconds);
+
+	/** Draws the average timings, the share of the frames bound by each stage and a graph of the frames colored by what bound them. Returns the next Y. */
+	int32 DrawStat(FViewport* Viewport, FCanvas* Canvas, int32 X, int32 Y) const;
+
+	/** Writes the buffered frames to a csv file in the profiling directory. Returns its name, empty if it couldn't be written. */
+	FString DumpToCSV() const;
+
+	/** Returns the buffered frames, from the oldest to the newest. */
+	void GetSamples(TArray<FFramePipelineSample>& OutSamples) const;
+
+private:
+	FFramePipelineStats();
+
+	/** Ring buffer of the last frames. */
+	TArray<FFramePipelineSample> Samples;
+
+	/** Index the next frame is written to in Samples. */
+	int32 NextSampleIndex;
+
+	/** Values of the cycle accumulators at the last sample. */
+	uint32 LastGameThreadWaitCycles;
+	uint32 LastRenderThreadWaitCycles;
+	uint32 LastRHIThreadCycles;
+
+	/** Whether the accumulators were read once, the first frame has no previous values to take the difference with. */
+	bool bHasLastCycles;
+};
+
+#endif // !UE_BUILD_SHIPPING
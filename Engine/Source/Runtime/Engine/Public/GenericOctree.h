@@ -374,15 +374,6 @@ public:
 			}
 		}
 
-		/** Destructor. */
-		~FNode()
-		{
-			FOREACH_OCTREE_CHILD_NODE(ChildRef)
-			{
-				delete Children[ChildRef.Index];
-			}
-		}
-
 		// Accessors.
 		FORCEINLINE ElementConstIt GetElementIt() const { return ElementConstIt(Elements); }
 		FORCEINLINE bool IsLeaf() const { return bIsLeaf; }
@@ -442,7 +433,7 @@ public:
 		/** The parent of this node. */
 		const FNode* Parent;
 
-		/** The children of the node. */
+		/** The children of the node, owned by the octree's node pool. */
 		mutable FNode* Children[8];
 
 		/** The number of elements contained by the node and its child nodes. */
@@ -454,6 +445,82 @@ public:
 
 
 
+	/**
+	 * Storage of the nodes below the root. Nodes are allocated from blocks of contiguous memory rather than one by one,
+	 * so the children created by a split, and the paths traversals take through them, stay close together. Freed nodes are reused first.
+	 */
+	class FNodePool
+	{
+	public:
+
+		FNodePool()
+		:	FreeList(NULL)
+		,	NumUsedInLastBlock(0)
+		{}
+
+		~FNodePool()
+		{
+			Empty();
+		}
+
+		FNode* Allocate(const FNode* Parent)
+		{
+			void* Memory = FreeList;
+			if (FreeList)
+			{
+				FreeList = FreeList->Next;
+			}
+			else
+			{
+				if (Blocks.Num() == 0 || NumUsedInLastBlock == GetBlockSize(Blocks.Num() - 1))
+				{
+					Blocks.Add(FMemory::Malloc(GetBlockSize(Blocks.Num()) * sizeof(FNode), ALIGNOF(FNode)));
+					NumUsedInLastBlock = 0;
+				}
+				Memory = (FNode*)Blocks.Last() + NumUsedInLastBlock++;
+			}
+			return new(Memory) FNode(Parent);
+		}
+
+		/** Frees a node, its children must have been freed already. */
+		void Free(FNode* Node)
+		{
+			Node->~FNode();
+			FFreeNode* FreeNode = (FFreeNode*)Node;
+			FreeNode->Next = FreeList;
+			FreeList = FreeNode;
+		}
+
+		/** Releases the memory of the pool, all its nodes must have been freed. */
+		void Empty()
+		{
+			for (void* Block : Blocks)
+			{
+				FMemory::Free(Block);
+			}
+			Blocks.Empty();
+			FreeList = NULL;
+			NumUsedInLastBlock = 0;
+		}
+
+	private:
+
+		struct FFreeNode
+		{
+			FFreeNode* Next;
+		};
+
+		/** Blocks grow with the tree, so small octrees don't pay for large ones. */
+		static int32 GetBlockSize(int32 BlockIndex)
+		{
+			return 8 << FMath::Min(BlockIndex, 6);
+		}
+
+		TArray<void*> Blocks;
+		FFreeNode* FreeList;
+		int32 NumUsedInLastBlock;
+	};
+
 	/** A reference to an octree node, its context, and a read lock. */
 	class FNodeReference
 	{
@@ -684,8 +751,10 @@ public:
 
 	void Destroy()
 	{
+		FreeChildren(RootNode);
 		RootNode.~FNode();
 		new (&RootNode) FNode(NULL);
+		NodePool.Empty();
 
 		// this looks a bit @hacky, but FNode's destructor doesn't 
 		// update TotalSizeBytes so better to set it to 0 than
@@ -693,6 +762,85 @@ public:
 		SetOctreeMemoryUsage(this, 0);
 	}
 
+	/**
+	 * Finds the elements that intersect each of a set of boxes in one traversal of the tree: a node is visited once for all the boxes that reach it,
+	 * instead of once per box with a TConstElementBoxIterator each.
+	 * @param QueryBoxes - The boxes to find the intersecting elements of.
+	 * @param Func - Called as Func(QueryIndex, Element) for each box and element that intersect.
+	 */
+	template<typename FuncType>
+	void FindElementsIntersectingBoxes(const TArray<FBoxCenterAndExtent>& QueryBoxes, const FuncType& Func) const
+	{
+		struct FBatchNodeReference
+		{
+			const FNode* Node;
+			FOctreeNodeContext Context;
+			/** The boxes of the current batch that reach the node. */
+			uint32 QueryMask;
+		};
+		TArray<FBatchNodeReference, DefaultStackAllocator> NodeStack;
+
+		// The boxes that reach a node are a bit mask, so they are answered in batches of 32
+		for (int32 FirstQuery = 0; FirstQuery < QueryBoxes.Num(); FirstQuery += 32)
+		{
+			const int32 NumQueries = FMath::Min(QueryBoxes.Num() - FirstQuery, 32);
+			const FBoxCenterAndExtent* Queries = &QueryBoxes[FirstQuery];
+
+			FBatchNodeReference& Root = NodeStack[NodeStack.AddUninitialized()];
+			Root.Node = &RootNode;
+			Root.Context = RootNodeContext;
+			Root.QueryMask = NumQueries == 32 ? 0xffffffff : ((1u << NumQueries) - 1);
+
+			while (NodeStack.Num())
+			{
+				const FBatchNodeReference Current = NodeStack.Pop(false);
+
+				for (ElementConstIt ElementIt(Current.Node->Elements); ElementIt; ++ElementIt)
+				{
+					const auto& ElementBounds = OctreeSemantics::GetBoundingBox(*ElementIt);
+					for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+					{
+						if ((Current.QueryMask & (1u << QueryIndex)) && Intersect(ElementBounds, Queries[QueryIndex]))
+						{
+							Func(FirstQuery + QueryIndex, *ElementIt);
+						}
+					}
+				}
+
+				if (!Current.Node->IsLeaf())
+				{
+					// Gather the boxes that reach each child
+					uint32 ChildQueryMasks[8] = { 0 };
+					for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+					{
+						if (Current.QueryMask & (1u << QueryIndex))
+						{
+							const FOctreeChildNodeSubset IntersectingChildSubset = Current.Context.GetIntersectingChildren(Queries[QueryIndex]);
+							FOREACH_OCTREE_CHILD_NODE(ChildRef)
+							{
+								if (IntersectingChildSubset.Contains(ChildRef))
+								{
+									ChildQueryMasks[ChildRef.Index] |= 1u << QueryIndex;
+								}
+							}
+						}
+					}
+
+					FOREACH_OCTREE_CHILD_NODE(ChildRef)
+					{
+						if (ChildQueryMasks[ChildRef.Index] && Current.Node->HasChild(ChildRef))
+						{
+							FBatchNodeReference& Child = NodeStack[NodeStack.AddUninitialized()];
+							Child.Node = Current.Node->GetChild(ChildRef);
+							Current.Context.GetChildContext(ChildRef, &Child.Context);
+							Child.QueryMask = ChildQueryMasks[ChildRef.Index];
+						}
+					}
+				}
+			}
+		}
+	}
+
 	/** Accesses an octree element by ID. */
 	ElementType& GetElementById(FOctreeElementId ElementId);
 
@@ -728,9 +876,37 @@ public:
 
 	/** Initialization constructor. */
 	TOctree(const FVector& InOrigin,float InExtent);
+
+	/** Only empty octrees can be copied, the nodes belong to the node pool of their octree. */
+	TOctree(const TOctree& Other)
+	:	RootNode(NULL)
+	,	RootNodeContext(Other.RootNodeContext)
+	,	MinLeafExtent(Other.MinLeafExtent)
+	,	TotalSizeBytes(0)
+	{
+		check(Other.RootNode.GetInclusiveElementCount() == 0);
+	}
+
+	/** Only empty octrees can be assigned, e.g. to reset an octree with new bounds. */
+	TOctree& operator=(const TOctree& Other)
+	{
+		check(Other.RootNode.GetInclusiveElementCount() == 0);
+		Destroy();
+		RootNodeContext = Other.RootNodeContext;
+		MinLeafExtent = Other.MinLeafExtent;
+		return *this;
+	}
+
+	~TOctree()
+	{
+		FreeChildren(RootNode);
+	}
 			
 private:
 
+	/** Storage of the nodes below the root. */
+	FNodePool NodePool;
+
 	/** The octree's root node. */
 	FNode RootNode;
 
@@ -747,6 +923,9 @@ private:
 
 	SIZE_T TotalSizeBytes;
 
+	/** Frees the children of a node and their subtrees. */
+	void FreeChildren(const FNode& Node);
+
 	/** Adds an element to a node or its children. */
 	void AddElementToNode(
 		typename TTypeTraits<ElementType>::ConstInitType Element,
@@ -38,13 +38,11 @@ FORCEINLINE FOctreeChildNodeSubset FOctreeNodeContext::GetIntersectingChildren(c
 		VectorLoadFloat1(&ChildExtent)
 		);
 
-	// Intersect the query bounds with the node's children's bounds.
-	Result.bPositiveX = VectorAnyGreaterThan(VectorReplicate(QueryBoundsMax,0),VectorReplicate(PositiveChildBoundsMin,0)) != false;
-	Result.bPositiveY = VectorAnyGreaterThan(VectorReplicate(QueryBoundsMax,1),VectorReplicate(PositiveChildBoundsMin,1)) != false;
-	Result.bPositiveZ = VectorAnyGreaterThan(VectorReplicate(QueryBoundsMax,2),VectorReplicate(PositiveChildBoundsMin,2)) != false;
-	Result.bNegativeX = VectorAnyGreaterThan(VectorReplicate(QueryBoundsMin,0),VectorReplicate(NegativeChildBoundsMax,0)) == false;
-	Result.bNegativeY = VectorAnyGreaterThan(VectorReplicate(QueryBoundsMin,1),VectorReplicate(NegativeChildBoundsMax,1)) == false;
-	Result.bNegativeZ = VectorAnyGreaterThan(VectorReplicate(QueryBoundsMin,2),VectorReplicate(NegativeChildBoundsMax,2)) == false;
+	// Intersect the query bounds with the node's children's bounds, all three axes at once. The mask bits are in XYZ order, like the subset's.
+	const uint32 PositiveBits = VectorMaskBits(VectorCompareGT(QueryBoundsMax,PositiveChildBoundsMin));
+	const uint32 NegativeBits = VectorMaskBits(VectorCompareGE(NegativeChildBoundsMax,QueryBoundsMin));
+	Result.PositiveChildBits = PositiveBits & 7;
+	Result.NegativeChildBits = NegativeBits & 7;
 	return Result;
 }
 
@@ -149,7 +147,7 @@ void TOctree<ElementType,OctreeSemantics>::AddElementToNode(
 				// Create the child node if it hasn't been created yet.
 				if(!Node.Children[ChildRef.Index])
 				{
-					Node.Children[ChildRef.Index] = new typename TOctree<ElementType,OctreeSemantics>::FNode(&Node);
+					Node.Children[ChildRef.Index] = NodePool.Allocate(&Node);
 					SetOctreeMemoryUsage(this, TotalSizeBytes + sizeof(*Node.Children[ChildRef.Index]));
 				}
 
@@ -254,9 +252,21 @@ void TOctree<ElementType,OctreeSemantics>::RemoveElement(FOctreeElementId Elemen
 			{
 				SetOctreeMemoryUsage(this, TotalSizeBytes - sizeof(*CollapseNode->Children[ChildRef.Index]));
 			}
+		}
+		FreeChildren(*CollapseNode);
+	}
+}
 
-			delete CollapseNode->Children[ChildRef.Index];
-			CollapseNode->Children[ChildRef.Index] = NULL;
+template<typename ElementType,typename OctreeSemantics>
+void TOctree<ElementType,OctreeSemantics>::FreeChildren(const FNode& Node)
+{
+	FOREACH_OCTREE_CHILD_NODE(ChildRef)
+	{
+		if (FNode* Child = Node.Children[ChildRef.Index])
+		{
+			FreeChildren(*Child);
+			NodePool.Free(Child);
+			Node.Children[ChildRef.Index] = NULL;
 		}
 	}
 }
@@ -351,16 +361,10 @@ void TOctree<ElementType,OctreeSemantics>::ApplyOffset(const FVector& InOffset)
 	// Shift elements
 	RootNode.ApplyOffset(InOffset);
 	
-	// Make a local copy of all nodes
-	FNode OldRootNode = RootNode;
-	
-	// Assign to root node a NULL node, so Destroy procedure will not delete child nodes
-	RootNode = FNode(nullptr);
-	// Call destroy to clean up octree
-	Destroy();
-
-	// Add all elements from a saved nodes to a new empty octree
-	for (TConstIterator<> NodeIt(OldRootNode, RootNodeContext); NodeIt.HasPendingNodes(); NodeIt.Advance())
+	// Gather all the elements, the nodes are freed by Destroy
+	TArray<ElementType> Elements;
+	Elements.Empty(RootNode.GetInclusiveElementCount());
+	for (TConstIterator<> NodeIt(*this); NodeIt.HasPendingNodes(); NodeIt.Advance())
 	{
 		const auto& CurrentNode = NodeIt.GetCurrentNode();
 
@@ -374,11 +378,18 @@ void TOctree<ElementType,OctreeSemantics>::ApplyOffset(const FVector& InOffset)
 
 		for (auto ElementIt = CurrentNode.GetElementIt(); ElementIt; ++ElementIt)
 		{
-			AddElement(*ElementIt);
+			Elements.Add(*ElementIt);
 		}
 	}
 
-	// Saved nodes will be deleted on scope exit
+	// Call destroy to clean up octree
+	Destroy();
+
+	// Add all the elements to the new empty octree
+	for (const auto& Element : Elements)
+	{
+		AddElement(Element);
+	}
 }
 
 
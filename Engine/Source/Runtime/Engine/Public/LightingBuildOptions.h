@@ -17,6 +17,7 @@ public:
 	,	bOnlyBuildCurrentLevel(false)
 	,	bOnlyBuildSelectedLevels(false)
 	,	bOnlyBuildVisibility(false)
+	,	bOnlyBuildChanged(false)
 	,	bShowLightingBuildInfo(false)
 	,	QualityLevel(Quality_Preview)
 	,	NumUnusedLocalCores(1)
@@ -39,6 +40,8 @@ public:
 	bool					bOnlyBuildSelectedLevels;
 	/** Whether to only build visibility, and leave lighting untouched.				*/
 	bool					bOnlyBuildVisibility;
+	/** Whether to only build lighting for actors affected by lights or geometry changed since the last build. */
+	bool					bOnlyBuildChanged;
 	/** Whether to display the lighting build info following a build.				*/
 	bool					bShowLightingBuildInfo;
 	/** The quality level to use for the lighting build. (0-3)						*/
@@ -0,0 +1,110 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+MeshStreaming.h: Definitions of classes used for mesh LOD streaming.
+=============================================================================*/
+
+#pragma once
+
+/**
+ * A static mesh whose first LODs are streamed, see FStaticMeshLODResources::bIsLODStreamed.
+ */
+struct FStreamingStaticMesh
+{
+	/** Constructor, initializing all members */
+	FStreamingStaticMesh(UStaticMesh* InStaticMesh);
+
+	/** Static mesh this streaming data is for. */
+	UStaticMesh* StaticMesh;
+
+	/** Registered and unregistered components using the static mesh. */
+	TArray<UStaticMeshComponent*> Components;
+
+	/** First LOD being streamed in, all the LODs from it to FStaticMeshRenderData::CurrentFirstLODIdx are loaded. INDEX_NONE if there is no stream in. */
+	int32 PendingFirstLODIdx;
+
+	/** Payloads of the LODs being streamed in, indexed by LOD. */
+	TArray<uint8> PendingLODData[MAX_STATIC_MESH_LODS];
+
+	/** Indices of the IO requests of the stream in, to cancel them. */
+	TArray<uint64> IORequestIndices;
+
+	/** Number of IO requests of the stream in that are not done yet. */
+	FThreadSafeCounter PendingRequestCount;
+
+	/** Fence of the release of the last streamed out LODs, their buffers can't be loaded again before it is complete. */
+	FRenderCommandFence ReleaseFence;
+
+	/** Seconds the components have wanted fewer LODs than are loaded. */
+	float TimeWantingFewerLODs;
+
+	/** Whether a component needs all the LODs, they are never streamed out again. */
+	bool bForceFullyResident;
+};
+
+/**
+ * Streaming manager dealing with the LODs of the static meshes cooked with bStreamLODs.
+ * The LODs the components of a mesh want are computed from their screen size in the streaming views, like ComputeStaticMeshLOD does.
+ * The missing ones are loaded asynchronously, and the ones that are not wanted anymore for a while are released.
+ */
+struct FStreamingManagerMesh : public IMeshStreamingManager
+{
+	/** Constructor, initializing all members */
+	FStreamingManagerMesh();
+
+	virtual ~FStreamingManagerMesh();
+
+	// IStreamingManager interface
+	virtual void UpdateResourceStreaming( float DeltaTime, bool bProcessEverything=false ) override;
+	virtual int32 BlockTillAllRequestsFinished( float TimeLimit = 0.0f, bool bLogResults = false ) override;
+	virtual void CancelForcedResources() override;
+	virtual void NotifyLevelChange() override;
+	virtual void SetDisregardWorldResourcesForFrames( int32 NumFrames ) override;
+	virtual void AddPreparedLevel( class ULevel* Level ) override;
+	virtual void RemoveLevel( class ULevel* Level ) override;
+	virtual void NotifyPrimitiveAttached( const UPrimitiveComponent* Primitive, EDynamicPrimitiveType DynamicType ) override;
+	virtual void NotifyPrimitiveDetached( const UPrimitiveComponent* Primitive ) override;
+	virtual void NotifyPrimitiveUpdated( const UPrimitiveComponent* Primitive ) override;
+	// End IStreamingManager interface
+
+	// IMeshStreamingManager interface
+	virtual void AddStreamingMesh(UStaticMesh* StaticMesh) override;
+	virtual void RemoveStreamingMesh(UStaticMesh* StaticMesh) override;
+	virtual bool IsManagedStreamingMesh(const UStaticMesh* StaticMesh) const override;
+	virtual void ForceAllLODsResident(UStaticMesh* StaticMesh) override;
+	// End IMeshStreamingManager interface
+
+protected:
+	/** Starts tracking the static mesh of a component, or stops if it isn't a managed one. */
+	void UpdateComponent(const UPrimitiveComponent* Primitive);
+
+	/** Stops tracking a component. */
+	void RemoveComponent(const UPrimitiveComponent* Primitive);
+
+	/** Returns the first LOD the registered components of the mesh want to render in the current views. */
+	int32 ComputeWantedFirstLODIdx(const FStreamingStaticMesh& StreamingMesh) const;
+
+	/** Issues the IO requests loading the LODs from FirstLODIdx to the first loaded one. */
+	void StartStreamIn(FStreamingStaticMesh& StreamingMesh, int32 FirstLODIdx);
+
+	/** Initializes the LODs loaded by the stream in once its requests are done, and has the components use them. */
+	void FinishStreamIn(FStreamingStaticMesh& StreamingMesh);
+
+	/** Has the components stop using the LODs before FirstLODIdx and releases them. */
+	void StreamOut(FStreamingStaticMesh& StreamingMesh, int32 FirstLODIdx);
+
+	/** Cancels the IO requests of a stream in and waits for the ones that already started. */
+	void CancelStreamIn(FStreamingStaticMesh& StreamingMesh);
+
+	/** Static meshes being managed. Allocated separately as the IO requests reference their counters. */
+	TMap<UStaticMesh*, FStreamingStaticMesh*> StreamingMeshes;
+
+	/** Static mesh each tracked component was added with. */
+	TMap<const UPrimitiveComponent*, UStaticMesh*> ComponentMeshes;
+
+	/** Seconds since the wanted LODs were last computed. */
+	float TimeSinceLastUpdate;
+
+	/** Number of frames during which the wanted LODs aren't computed, set while the world is being loaded. */
+	int32 DisregardWorldResourcesFrames;
+};
@@ -0,0 +1,158 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	DemoStream.h:
+	Chunked storage of demo recordings. The recorded frames are grouped in chunks that are compressed
+	and written on a background thread, and checkpoints are stored in chunks of their own so playback
+	can jump to one without reading the frames that come before it.
+=============================================================================*/
+#pragma once
+
+/** What a demo chunk holds */
+enum EDemoChunkType
+{
+	/** Consecutive recorded frames */
+	DEMOCHUNK_Frames		= 0,
+	/** Full state of the demo connection at a point in time, see UDemoNetDriver::SaveCheckpoint */
+	DEMOCHUNK_Checkpoint	= 1,
+};
+
+/** Header written in front of the data of each chunk */
+struct FDemoChunkHeader
+{
+	/** Size of the header in the stream */
+	enum { SerializedSize = 20 };
+
+	uint32	ChunkType;
+	float	StartTime;			// Demo time the chunk starts at, or of the checkpoint
+	float	EndTime;			// Demo time of the last frame of the chunk
+	int32	UncompressedSize;
+	int32	CompressedSize;		// Same as UncompressedSize when the data is stored uncompressed
+
+	FDemoChunkHeader() :
+		ChunkType( DEMOCHUNK_Frames ),
+		StartTime( 0 ),
+		EndTime( 0 ),
+		UncompressedSize( 0 ),
+		CompressedSize( 0 )
+	{}
+
+	friend FArchive& operator << ( FArchive& Ar, FDemoChunkHeader& Header )
+	{
+		Ar << Header.ChunkType;
+		Ar << Header.StartTime;
+		Ar << Header.EndTime;
+		Ar << Header.UncompressedSize;
+		Ar << Header.CompressedSize;
+
+		return Ar;
+	}
+};
+
+/** Chunk of a demo being played back, and where its data is in the stream */
+struct FDemoChunkInfo
+{
+	FDemoChunkHeader	Header;
+	int64				DataOffset;
+};
+
+/**
+ * Compresses and appends chunks to a demo stream on its own thread, so recording never waits on the disk.
+ * The game thread only hands over the chunk data, the thread owns the archive until Finish is called.
+ */
+class ENGINE_API FDemoStreamWriter : public FRunnable
+{
+public:
+	/** Takes ownership of the archive, the chunks are written from its current position */
+	FDemoStreamWriter( FArchive* InArchive );
+	virtual ~FDemoStreamWriter();
+
+	/** Queues a chunk for writing. Data is taken over and left empty */
+	void QueueChunk( EDemoChunkType ChunkType, float StartTime, float EndTime, TArray< uint8 >& Data );
+
+	/** Waits until every queued chunk is written, and stops the thread. Gives the archive back to the caller */
+	FArchive* Finish();
+
+	// Begin FRunnable interface.
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	// End FRunnable interface.
+
+private:
+	struct FPendingChunk
+	{
+		FDemoChunkHeader	Header;
+		TArray< uint8 >		Data;
+	};
+
+	void WriteChunk( FPendingChunk& Chunk );
+
+	FArchive*							Archive;
+	FRunnableThread*					Thread;
+
+	/** Triggered when a chunk is queued or the writer is asked to finish */
+	FEvent*								WorkEvent;
+	FThreadSafeCounter					FinishRequested;
+
+	TQueue< FPendingChunk*, EQueueMode::Spsc >	PendingChunks;
+
+	/** Only used by the writer thread */
+	TArray< uint8 >						CompressedData;
+};
+
+/**
+ * Reads back the chunks of a demo stream. The chunk list is built up front from the chunk headers,
+ * and the chunk that will be needed next can be read and decompressed in the background.
+ */
+class ENGINE_API FDemoStreamReader
+{
+public:
+	/** Takes ownership of the archive, and scans the chunks from its current position to EndOffset (or the end of the archive if 0) */
+	FDemoStreamReader( FArchive* InArchive, int64 EndOffset );
+	~FDemoStreamReader();
+
+	const TArray< FDemoChunkInfo >& GetChunks() const { return Chunks; }
+
+	/** Reads and decompresses a chunk, using the prefetched data when it is the one asked for. Returns false if the chunk is corrupt */
+	bool ReadChunk( int32 ChunkIndex, TArray< uint8 >& OutData );
+
+	/** Starts reading a chunk in the background */
+	void PrefetchChunk( int32 ChunkIndex );
+
+	/** Returns the index of the last checkpoint at or before Time, or INDEX_NONE if there is none */
+	int32 FindCheckpoint( float Time ) const;
+
+private:
+	/** Reads a chunk from the archive, can be called from any thread as long as only one call is in flight */
+	bool LoadChunk( int32 ChunkIndex, TArray< uint8 >& OutData );
+
+	class FDemoChunkReadTask : public FNonAbandonableTask
+	{
+	public:
+		FDemoChunkReadTask() : Reader( NULL ), ChunkIndex( INDEX_NONE ), bSuccess( false ) {}
+
+		void DoWork()
+		{
+			bSuccess = Reader->LoadChunk( ChunkIndex, Data );
+		}
+
+		static const TCHAR* Name()
+		{
+			return TEXT( "FDemoChunkReadTask" );
+		}
+
+		FDemoStreamReader*	Reader;
+		int32				ChunkIndex;
+		TArray< uint8 >		Data;
+		bool				bSuccess;
+	};
+
+	FArchive*							Archive;
+	TArray< FDemoChunkInfo >			Chunks;
+
+	FAsyncTask< FDemoChunkReadTask >	PrefetchTask;
+	bool								bPrefetchStarted;
+
+	/** Only used by LoadChunk */
+	TArray< uint8 >						CompressedData;
+};
@@ -0,0 +1,102 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	NetReplicationGraph.h:
+	FNetReplicationGraph sorts the actors considered for replication into buckets once per frame,
+	so each connection only runs the relevancy checks on the actors that can be relevant to it.
+=============================================================================*/
+#pragma once
+
+/** FNetReplicationGraph
+ * Replication policy used by UNetDriver::ServerReplicateActors when net.UseReplicationGraph is set.
+ *
+ * PrepareForReplication puts every actor of the consider list in one or more buckets:
+ *	- Always relevant actors
+ *	- Team lists, for the actors a game wants to reach every member of a team
+ *	- A spatial grid, where each actor is added to the cells its cull distance overlaps
+ *	- Actors keyed by the actors they are relevant to no matter where they are (owners, instigator, controller)
+ *	- Dependent actors, whose relevancy follows another actor (owner relevancy, attachments, movement bases)
+ *	- Actors without distance relevancy, or with a cull distance too large for the grid
+ *
+ * GatherActorsForConnection then builds the candidate list of one connection from the buckets its viewers touch.
+ * The candidates still go through IsNetRelevantFor, the graph only has to never leave out an actor that could be relevant.
+ * Games with custom IsNetRelevantFor rules that reach further than the engine ones override ClassifyActor.
+ */
+class ENGINE_API FNetReplicationGraph
+{
+public:
+	/** Bucket an actor is put in by ClassifyActor */
+	enum EActorBucket
+	{
+		/** Relevant to every connection */
+		ActorBucket_Always,
+		/** Only relevant to the actors it is keyed by */
+		ActorBucket_KeyedOnly,
+		/** Relevant when a viewer is in its cull distance */
+		ActorBucket_Spatial,
+		/** Relevancy doesn't depend on the viewer location */
+		ActorBucket_NonSpatial,
+		/** Relevancy follows another actor, checked for every connection */
+		ActorBucket_Dependent,
+	};
+
+	FNetReplicationGraph();
+	virtual ~FNetReplicationGraph() { }
+
+	/** Rebuilds the buckets from this frame consider list. The list must stay alive until the replication of the frame is done */
+	void PrepareForReplication( const TArray< AActor* >& ConsiderList );
+
+	/**
+	 * Appends to OutActors the actors of the consider list that can be relevant to a connection, each one once.
+	 * Actors with an open channel on the connection are always added, the driver still has to update their dormancy and relevant time.
+	 * @param bSkipDormant	if true, the actors dormant on the connection are left out
+	 */
+	void GatherActorsForConnection( UNetConnection* Connection, const TArray< struct FNetViewer >& Viewers, bool bSkipDormant, TArray< AActor* >& OutActors );
+
+	/** Returns true if the actor is in this frame consider list */
+	bool IsConsidered( const AActor* Actor ) const
+	{
+		return ActorIndices.Contains( Actor );
+	}
+
+protected:
+	/** Returns the bucket of an actor. Called once per frame for each considered actor */
+	virtual EActorBucket ClassifyActor( const AActor* Actor ) const;
+
+	/** Returns the team list an actor goes in, in addition to its bucket, or INDEX_NONE */
+	virtual int32 GetActorTeam( const AActor* Actor ) const { return INDEX_NONE; }
+
+	/** Returns the team of a connection, or INDEX_NONE */
+	virtual int32 GetConnectionTeam( const UNetConnection* Connection ) const { return INDEX_NONE; }
+
+	/** Adds the actors an actor is relevant to wherever they are: its owners, instigator and controller */
+	virtual void GetRelevancyKeys( const AActor* Actor, TArray< const AActor*, TInlineAllocator< 8 > >& OutKeys ) const;
+
+private:
+	void AddCandidate( int32 ActorIndex, UNetConnection* Connection, bool bSkipDormant, TArray< AActor* >& OutActors );
+	void AddKeyedCandidates( const AActor* Key, UNetConnection* Connection, bool bSkipDormant, TArray< AActor* >& OutActors );
+	void AddSpatialActor( int32 ActorIndex, const AActor* Actor );
+
+	static FIntPoint GetCell( const FVector& Location, float CellSize )
+	{
+		return FIntPoint( FMath::FloorToInt( Location.X / CellSize ), FMath::FloorToInt( Location.Y / CellSize ) );
+	}
+
+	/** Consider list of the frame, the buckets store indices into it */
+	const TArray< AActor* >*		Actors;
+	TMap< const AActor*, int32 >	ActorIndices;
+
+	TArray< int32 >					AlwaysRelevant;
+	TArray< int32 >					NonSpatial;
+	TArray< int32 >					Dependent;
+	TMap< int32, TArray< int32 > >	TeamLists;
+	TMultiMap< const AActor*, int32 >	KeyedActors;
+	TMap< FIntPoint, TArray< int32 > >	Grid;
+
+	/** Cell size the grid was built with this frame */
+	float							CellSize;
+
+	/** Tag of the last gather each actor was added to, to add it only once per connection */
+	TArray< uint32 >				GatherTags;
+	uint32							GatherTag;
+};
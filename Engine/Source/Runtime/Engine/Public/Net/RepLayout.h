@@ -25,8 +25,8 @@ public:
 class FRepChangedPropertyTracker : public IRepChangedPropertyTracker
 {
 public:
-	FRepChangedPropertyTracker() : LastReplicationGroupFrame( 0 ), LastReplicationFrame( 0 ), ActiveStatusChanged( false ), UnconditionalPropChanged( false ) { }
-	virtual ~FRepChangedPropertyTracker() { }
+	FRepChangedPropertyTracker() : LastReplicationGroupFrame( 0 ), LastReplicationFrame( 0 ), ActiveStatusChanged( false ), UnconditionalPropChanged( false ), LastSharedCompareFrame( 0 ), SharedShadowState( NULL ), SharedHistoryEnd( 0 ) { }
+	virtual ~FRepChangedPropertyTracker();
 
 	virtual void SetCustomIsActiveOverride( const uint16 RepIndex, const bool bIsActive ) override
 	{
@@ -52,6 +52,18 @@ public:
 
 	uint32						ActiveStatusChanged;
 	bool						UnconditionalPropChanged;
+
+	// Shared change lists (net.ShareChangelists): the unconditional properties are diffed once per frame against a single shadow state,
+	// and each connection merges the change lists it hasn't seen yet
+	static const int32 MAX_SHARED_HISTORY = 32;
+
+	uint32						LastSharedCompareFrame;
+	class FRepState *			SharedShadowState;
+	TArray< uint16 >			SharedHistory[MAX_SHARED_HISTORY];
+	int32						SharedHistoryEnd;
+
+	// Taken by the connections comparing against this tracker while they replicate in parallel (net.ParallelReplication)
+	FCriticalSection			CompareCS;
 };
 
 class FRepLayout;
@@ -94,6 +106,48 @@ public:
 	TMap< int32, FUnmappedGuidMgrElement > Map;
 };
 
+/** FRepMovementBaseline
+ *  A FRepMovement quantized the way it was sent. Both ends keep the same values, so deltas can be taken between them
+*/
+class FRepMovementBaseline
+{
+public:
+	FRepMovementBaseline() : 
+		Seq( 0 ), 
+		bValid( false ), 
+		bCanBeBase( false )
+	{
+		FMemory::Memzero( Location, sizeof( Location ) );
+		FMemory::Memzero( Rotation, sizeof( Rotation ) );
+		FMemory::Memzero( LinearVelocity, sizeof( LinearVelocity ) );
+		FMemory::Memzero( AngularVelocity, sizeof( AngularVelocity ) );
+	}
+
+	int32				Location[3];
+	int32				Rotation[3];
+	int32				LinearVelocity[3];
+	int32				AngularVelocity[3];
+
+	FPacketIdRange		OutPacketIdRange;		// Sending side only, packets the value went out in
+	uint8				Seq;
+	bool				bValid;
+	bool				bCanBeBase;				// Sending side only, false if the value was lost, went out reliably or before the channel was open acked
+};
+
+/** FRepMovementHistory
+ *  Last values of a replicated FRepMovement, that the next ones are sent as deltas from
+*/
+class FRepMovementHistory
+{
+public:
+	FRepMovementHistory() : NextSeq( 0 ) { }
+
+	static const int32 MAX_HISTORY = 8;
+
+	FRepMovementBaseline		Baselines[MAX_HISTORY];		// Indexed by Seq % MAX_HISTORY
+	uint8						NextSeq;					// Sending side only
+};
+
 /** FRepState
  *  Stores state used by the FRepLayout manager
 */
@@ -107,7 +161,8 @@ public:
 		NumNaks( 0 ),
 		OpenAckedCalled( false ),
 		AwakeFromDormancy( false ),
-		ActiveStatusChanged( 0 )
+		ActiveStatusChanged( 0 ),
+		LastSharedChangelist( INDEX_NONE )
 	{ }
 
 	~FRepState();
@@ -139,6 +194,9 @@ public:
 	TArray< uint16 >				ConditionalLifetime;		// Properties the need to be checked conditionally (based on net initial, role, etc)
 	FReplicationFlags				RepFlags;
 	uint32							ActiveStatusChanged;
+	int32							LastSharedChangelist;		// End of the shared history the last time this state was replicated, INDEX_NONE before the first time
+
+	TMap< int32, FRepMovementHistory >	MovementHistories;		// Movement baselines, keyed by the index of the cmd of the movement property
 };
 
 enum ERepLayoutCmdType
@@ -219,7 +277,10 @@ public:
 		Writer( InWriter ), 
 		Changed( InChanged ),
 		CurrentChanged( 0 ),
-		bDoChecksum( bInDoChecksum )
+		bDoChecksum( bInDoChecksum ),
+		bAllowMovementDelta( false ),
+		bMovementCanBeBase( false ),
+		AckPacketId( INDEX_NONE )
 	{
 	}
 
@@ -227,6 +288,9 @@ public:
 	TArray< uint16 > &	Changed;
 	int32				CurrentChanged;
 	bool				bDoChecksum;
+	bool				bAllowMovementDelta;	// True if movement can be sent as a delta from an acked baseline
+	bool				bMovementCanBeBase;		// True if the movement written now can be a baseline once acked
+	int32				AckPacketId;			// Most recent packet acked by the connection
 };
 
 /** FRepLayout
@@ -332,6 +396,9 @@ private:
 
 	void UpdateChangelistHistory( FRepState * RepState, UClass * ObjectClass, const uint8* RESTRICT Data, const int32 AckPacketId, TArray< uint16 > * OutMerged ) const;
 
+	void UpdateSharedChangelist( FRepChangedPropertyTracker * ChangeTracker, FRepState * RepState, UClass * ObjectClass, const uint8* RESTRICT Data, const uint32 ReplicationFrame ) const;
+	void GatherSharedChanges( FRepChangedPropertyTracker * ChangeTracker, FRepState * RepState, const uint8* RESTRICT CompareData, const uint8* RESTRICT Data, TArray< uint16 > & OutChanged ) const;
+
 	uint16 CompareProperties_r(
 		const int32				CmdStart,
 		const int32				CmdEnd,
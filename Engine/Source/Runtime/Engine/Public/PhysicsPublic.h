@@ -273,6 +273,9 @@ public:
 	/** Whether or not the given scene is between its execute and sync point. */
 	bool							bPhysXSceneExecuting[PST_MAX];
 
+	/** Whether the given scene's simulation was started by its last TickPhysScene, it isn't when there was no time to simulate */
+	bool							bPhysXSceneSimulating[PST_MAX];
+
 	/** Frame time, weighted with current frame time. */
 	float							AveragedFrameTime[PST_MAX];
 
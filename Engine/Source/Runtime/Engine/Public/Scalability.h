@@ -21,6 +21,8 @@ namespace Scalability
 		int32 PostProcessQuality;
 		int32 TextureQuality;
 		int32 EffectsQuality;
+		// @RyanTorant
+		int32 AHRQuality;
 
 		FQualityLevels()
 		{
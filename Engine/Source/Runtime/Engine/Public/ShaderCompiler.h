@@ -103,6 +103,9 @@ private:
 	/** Used when compiling through workers, attempts to open the worker output file if the worker is done and read the results. */
 	void ReadAvailableResults();
 
+	/** Used when a remote worker failed, puts its jobs back at the front of Manager->CompileQueue so another worker picks them up. */
+	void ReturnJobsToQueue(FShaderCompileWorkerInfo& CurrentWorkerInfo);
+
 	/** Used when compiling directly through the console tools dll. */
 	void CompileDirectlyThroughDll();
 
@@ -204,6 +207,8 @@ private:
 	FString AbsoluteShaderDebugInfoDirectory;
 	/** Name of the shader worker application. */
 	FString ShaderCompileWorkerName;
+	/** Addresses (ip:port) of ShaderCompileWorker agents on other machines to send job batches to, in addition to the local workers. */
+	TArray<FString> RemoteShaderCompileWorkers;
 	/** Whether the SCW has crashed and we should fall back to calling the compiler dll's directly. */
 	bool bFallBackToDirectCompiles;
 
@@ -0,0 +1,83 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SignificanceManager.h: Per world significance of gameplay objects
+=============================================================================*/
+
+#pragma once
+
+/**
+ * Computes once per frame how significant the registered objects are to the players of a world, and lets the systems that scale their work
+ * (tick interval, animation update rate, simulated proxy movement, replication priority, ...) all use that one value instead of their own heuristics.
+ * Significance is screen size like: 0 for objects that don't matter, the ratio of their radius to their distance to the closest view by default,
+ * scaled by their gameplay importance.
+ */
+class ENGINE_API FSignificanceManager : public FNoncopyable
+{
+public:
+
+	/** Computes the significance of an object for the view points of the frame. Called in parallel for all the objects, so it must only read them. */
+	typedef TFunction<float(const UObject*, const TArray<FTransform>&)> FSignificanceFunction;
+
+	/** Called on the game thread when the significance of an object changed, with its old and new significance. */
+	typedef TFunction<void(UObject*, float, float)> FPostSignificanceFunction;
+
+	/**
+	 * Starts tracking the significance of an object, its post significance function is called on the next update.
+	 * @param Object - The object, unregistered automatically if it is destroyed.
+	 * @param Tag - Lets systems find the objects they care about, see GetObjectsWithTag().
+	 */
+	void RegisterObject(UObject* Object, FName Tag, const FSignificanceFunction& SignificanceFunction, const FPostSignificanceFunction& PostSignificanceFunction = FPostSignificanceFunction());
+
+	/** Stops tracking the significance of an object. */
+	void UnregisterObject(UObject* Object);
+
+	/**
+	 * Retrieves the significance of a registered object.
+	 * @returns false if the object is not registered.
+	 */
+	bool QuerySignificance(const UObject* Object, float& OutSignificance) const;
+
+	/** Retrieves the registered objects with a tag. */
+	void GetObjectsWithTag(FName Tag, TArray<UObject*>& OutObjects) const;
+
+	/** The view points the significances were last computed for. */
+	const TArray<FTransform>& GetViewPoints() const
+	{
+		return ViewPoints;
+	}
+
+	/** Computes the significances for the view points of the player controllers of the world, called by the world tick. */
+	void Tick(UWorld* World);
+
+	/** Computes the significances for the given view points. */
+	void Update(const TArray<FTransform>& InViewPoints);
+
+	/**
+	 * Default significance of an actor: the largest ratio of the radius of its root component bounds to their distance to a view point, scaled by Importance.
+	 * Safe to use in a significance function.
+	 */
+	static float GetActorScreenSizeSignificance(const AActor* Actor, const TArray<FTransform>& InViewPoints, float Importance = 1.f);
+
+private:
+
+	struct FManagedObjectInfo
+	{
+		TWeakObjectPtr<UObject> Object;
+		/** Address the object was registered with, still valid as a key once it is destroyed. */
+		const UObject* ObjectKey;
+		FName Tag;
+		float Significance;
+		FSignificanceFunction SignificanceFunction;
+		FPostSignificanceFunction PostSignificanceFunction;
+	};
+
+	void RemoveObjectAt(int32 Index);
+
+	/** The registered objects. */
+	TArray<FManagedObjectInfo> ManagedObjects;
+	/** Index of each registered object in ManagedObjects. */
+	TMap<const UObject*, int32> ObjectIndices;
+	/** The view points of the last update. */
+	TArray<FTransform> ViewPoints;
+};
@@ -46,6 +46,12 @@ public:
 	 */
 	virtual void UpdateDynamicData_RenderThread(FRHICommandListImmediate& RHICmdList, class FDynamicSkelMeshObjectData* InDynamicData) = 0;
 
+	/**
+	 * Called by the rendering thread when the mesh is gathered for drawing, to skin again in the GPU skin cache the chunks
+	 * whose cached output of the last update can't be reused anymore.
+	 */
+	virtual void RefreshGPUSkinCache_RenderThread(FRHICommandListImmediate& RHICmdList) {}
+
 	/**
 	 * @param	LODIndex - each LOD has its own vertex data
 	 * @param	ChunkIdx - not used
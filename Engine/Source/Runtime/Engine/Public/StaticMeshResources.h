@@ -561,6 +561,12 @@ struct FStaticMeshLODResources
 	/** True if the adjacency index buffer contained data at init. Needed as it will not be available to the CPU afterwards. */
 	bool bHasAdjacencyInfo;
 
+	/** True if the vertex and index buffers of this LOD are cooked in StreamingBulkData instead of inline, see FStreamingManagerMesh. */
+	bool bIsLODStreamed;
+
+	/** The vertex and index buffers of a streamed LOD, loaded only while the LOD is wanted. */
+	FByteBulkData StreamingBulkData;
+
 	/** Default constructor. */
 	FStaticMeshLODResources();
 
@@ -572,9 +578,21 @@ struct FStaticMeshLODResources
 	/** Releases all rendering resources. */
 	void ReleaseResources();
 
+	/** Initializes the vertex and index buffers and the vertex factory, the only resources a streamed LOD doesn't always have. */
+	void InitVertexResources(UStaticMesh* Parent);
+
+	/** Releases the resources initialized by InitVertexResources. */
+	void ReleaseVertexResources();
+
 	/** Serialize. */
 	void Serialize(FArchive& Ar, UObject* Owner, int32 Idx);
 
+	/**
+	 * Serializes the vertex and index buffers as they are stored in StreamingBulkData.
+	 * The wireframe and adjacency flags are only used when saving, loading reads them from the payload.
+	 */
+	void SerializeStreamedBuffers(FArchive& Ar, bool bSerializeWireframe, bool bSerializeAdjacency);
+
 	/** Return the triangle count of this LOD. */
 	ENGINE_API int32 GetNumTriangles() const;
 
@@ -591,6 +609,11 @@ struct FStaticMeshLODResources
 	 * @param	InOverrideColorVertexBuffer		Optional color vertex buffer to use *instead* of the color vertex stream associated with this static mesh
 	 */
 	void InitVertexFactory(FLocalVertexFactory& InOutVertexFactory, UStaticMesh* InParentMesh, FColorVertexBuffer* InOverrideColorVertexBuffer);
+
+private:
+
+	/** Serializes the vertex and index buffers, inline or in the streamed payload. */
+	void SerializeBuffers(FArchive& Ar, bool bNeedsCPUAccess, bool bSerializeWireframe, bool bSerializeAdjacency);
 };
 
 /**
@@ -608,6 +631,12 @@ public:
 	/** Screen size to switch LODs */
 	float ScreenSize[MAX_STATIC_MESH_LODS];
 
+	/**
+	 * Index of the first LOD whose vertex and index buffers are loaded and initialized. The LODs before it are streamed out,
+	 * only their sections and distance field data are available. Only changes on the game thread, see FStreamingManagerMesh.
+	 */
+	int32 CurrentFirstLODIdx;
+
 	/** Streaming texture factors. */
 	float StreamingTextureFactors[MAX_STATIC_TEXCOORDS];
 
@@ -658,6 +687,9 @@ public:
 	/** Allocate LOD resources. */
 	ENGINE_API void AllocateLODResources(int32 NumLODs);
 
+	/** Returns the number of LODs that are cooked in their own bulk data, they are always the first ones. */
+	ENGINE_API int32 GetNumStreamedLODs() const;
+
 private:
 #if WITH_EDITORONLY_DATA
 	/** Allow the editor to explicitly update section information. */
@@ -741,6 +773,13 @@ public:
 
 	virtual ~FStaticMeshSceneProxy() {}
 
+	/**
+	 * Custom new/delete, static mesh proxies come from a paged pool so the render thread walking them touches
+	 * contiguous memory. Derived proxies of a different size use the regular heap.
+	 */
+	void* operator new(size_t Size);
+	void operator delete(void* RawMemory, size_t Size);
+
 	/** Gets the number of mesh batches required to represent the proxy, aside from section needs. */
 	virtual int32 GetNumMeshBatches() const
 	{
@@ -873,6 +912,9 @@ protected:
 	 */
 	int32 ForcedLodModel;
 
+	/** First LOD whose resources were initialized when the proxy was created, the LODs before it are streamed out and never rendered. */
+	int32 FirstLODIdx;
+
 	FVector TotalScale3D;
 
 	uint32 bCastShadow : 1;
@@ -111,6 +111,11 @@ struct FTimerHandle
 		return FString::Printf(TEXT("%d"), Handle);
 	}
 
+	friend uint32 GetTypeHash(const FTimerHandle& InHandle)
+	{
+		return GetTypeHash(InHandle.Handle);
+	}
+
 private:
 	int32 Handle;
 };
@@ -148,9 +153,12 @@ struct FTimerData
 
 	FTimerHandle TimerHandle;
 
+	/** Serial of the heap entry that is live for this timer while it is active, see FTimerHeapEntry. */
+	uint32 HeapSerial;
+
 	FTimerData()
 		: bLoop(false), Status(ETimerStatus::Active)
-		, Rate(0), ExpireTime(0)
+		, Rate(0), ExpireTime(0), HeapSerial(0)
 	{}
 
 	/** Operator less, used to sort the heap based on time until execution. **/
@@ -161,6 +169,29 @@ struct FTimerData
 };
 
 
+/**
+ * Entry of the active timer heap. Timers are stored once by the timer manager and the heap only records when they expire.
+ * Clearing or pausing an active timer doesn't touch the heap, its entry goes stale instead and is skipped when it reaches the top.
+ */
+struct FTimerHeapEntry
+{
+	/** Copy of the ExpireTime of the timer, so the heap can be ordered without looking the timers up. */
+	double ExpireTime;
+	/** Index of the timer in the timer manager storage. */
+	int32 TimerIndex;
+	/** The entry is only live while it matches the HeapSerial of the timer at TimerIndex. */
+	uint32 Serial;
+
+	FTimerHeapEntry(double InExpireTime, int32 InTimerIndex, uint32 InSerial)
+		: ExpireTime(InExpireTime), TimerIndex(InTimerIndex), Serial(InSerial)
+	{}
+
+	bool operator<(const FTimerHeapEntry& Other) const
+	{
+		return ExpireTime < Other.ExpireTime;
+	}
+};
+
 /** 
  * Class to globally manage timers.
  */
@@ -179,7 +210,9 @@ public:
 	// Timer API
 
 	FTimerManager()
-		: InternalTime(0.0)
+		: NumStaleHeapEntries(0)
+		, LastHeapSerial(0)
+		, InternalTime(0.0)
 		, LastTickedFrame(static_cast<uint64>(-1))
 	{}
 
@@ -393,14 +426,16 @@ public:
 	DELEGATE_DEPRECATED("This overload of UnPauseTimer is deprecated, use UnPauseTimer(FTimerHandle InHandle) instead.")
 	FORCEINLINE void UnPauseTimer(UserClass* inObj, typename FTimerDelegate::TUObjectMethodDelegate< UserClass >::FMethodPtr inTimerMethod)
 	{
-		int32 TimerIdx = DEPRECATED_FindTimerInList( PausedTimerList, FTimerUnifiedDelegate( FTimerDelegate::CreateUObject(inObj, inTimerMethod) ) );
+		int32 TimerIdx = INDEX_NONE;
+		DEPRECATED_FindTimer( FTimerUnifiedDelegate( FTimerDelegate::CreateUObject(inObj, inTimerMethod) ), &TimerIdx );
 		InternalUnPauseTimer(TimerIdx);
 	}
 	template< class UserClass >
 	DELEGATE_DEPRECATED("This overload of UnPauseTimer is deprecated, use UnPauseTimer(FTimerHandle InHandle) instead.")
 	FORCEINLINE void UnPauseTimer(UserClass* inObj, typename FTimerDelegate::TUObjectMethodDelegate_Const< UserClass >::FMethodPtr inTimerMethod)
 	{
-		int32 TimerIdx = DEPRECATED_FindTimerInList( PausedTimerList, FTimerUnifiedDelegate( FTimerDelegate::CreateUObject(inObj, inTimerMethod) ) );
+		int32 TimerIdx = INDEX_NONE;
+		DEPRECATED_FindTimer( FTimerUnifiedDelegate( FTimerDelegate::CreateUObject(inObj, inTimerMethod) ), &TimerIdx );
 		InternalUnPauseTimer(TimerIdx);
 	}
 
@@ -408,20 +443,23 @@ public:
 	DELEGATE_DEPRECATED("This overload of UnPauseTimer is deprecated, use UnPauseTimer(FTimerHandle InHandle) instead.")
 	FORCEINLINE void UnPauseTimer(FTimerDelegate const& InDelegate)
 	{
-		int32 TimerIdx = DEPRECATED_FindTimerInList( PausedTimerList, FTimerUnifiedDelegate(InDelegate) );
+		int32 TimerIdx = INDEX_NONE;
+		DEPRECATED_FindTimer( FTimerUnifiedDelegate(InDelegate), &TimerIdx );
 		InternalUnPauseTimer(TimerIdx);
 	}
 	/** Version that takes a dynamic delegate (e.g. for UFunctions). */
 	DELEGATE_DEPRECATED("This overload of UnPauseTimer is deprecated, use UnPauseTimer(FTimerHandle InHandle) instead.")
 	FORCEINLINE void UnPauseTimer(FTimerDynamicDelegate const& InDynDelegate)
 	{
-		int32 TimerIdx = DEPRECATED_FindTimerInList( PausedTimerList, FTimerUnifiedDelegate(InDynDelegate) );
+		int32 TimerIdx = INDEX_NONE;
+		DEPRECATED_FindTimer( FTimerUnifiedDelegate(InDynDelegate), &TimerIdx );
 		InternalUnPauseTimer(TimerIdx);
 	}
 	/** Version that takes a handle */
 	FORCEINLINE void UnPauseTimer(FTimerHandle InHandle)
 	{
-		int32 TimerIdx = FindTimerInList(PausedTimerList, InHandle);
+		int32 TimerIdx = INDEX_NONE;
+		FindTimer(InHandle, &TimerIdx);
 		InternalUnPauseTimer(TimerIdx);
 	}
 
@@ -763,27 +801,39 @@ private:
 	void InternalClearTimer( int32 TimerIdx, ETimerStatus::Type TimerStatus );
 	void InternalClearAllTimers( void const* Object );
 
-	/** Will find a timer in the active, paused, or pending list. */
+	/** Will find an active, paused or pending timer, OutTimerIndex is its index in Timers. */
 	FTimerData const* DEPRECATED_FindTimer( FTimerUnifiedDelegate const& InDelegate, int32* OutTimerIndex=nullptr ) const;
 	FTimerData const* FindTimer( FTimerHandle const& InHandle, int32* OutTimerIndex = nullptr ) const;
 
+	/** Adds a timer to the storage, returns its index. */
+	int32 AddTimer( FTimerData const& TimerData );
+	/** Removes a timer from the storage, it must not have a live heap entry. */
+	void RemoveTimer( int32 TimerIdx );
+	/** Makes a timer active and pushes its heap entry, ExpireTime must already be on the manager's clock. */
+	void PushActiveTimer( int32 TimerIdx );
+	bool IsHeapEntryLive( FTimerHeapEntry const& Entry ) const;
+
 	void InternalPauseTimer( FTimerData const* TimerToPause, int32 TimerIdx );
-	void InternalUnPauseTimer( int32 PausedTimerIdx );
+	void InternalUnPauseTimer( int32 TimerIdx );
 	
 	float InternalGetTimerRate( FTimerData const* const TimerData ) const;
 	float InternalGetTimerElapsed( FTimerData const* const TimerData ) const;
 	float InternalGetTimerRemaining( FTimerData const* const TimerData ) const;
 
-	/** Will find the given timer in the given TArray and return its index. */ 
-	int32 DEPRECATED_FindTimerInList( const TArray<FTimerData> &SearchArray, FTimerUnifiedDelegate const& InDelegate ) const;
-	int32 FindTimerInList( const TArray<FTimerData> &SearchArray, FTimerHandle const& InHandle ) const;
+	/** All the active, paused and pending timers. Indices are stable while a timer exists. */
+	TSparseArray<FTimerData> Timers;
+	/** Index in Timers of the timers that have a valid handle. */
+	TMap<FTimerHandle, int32> TimerIndicesByHandle;
+
+	/** Heap of actively running timers, ordered by expiry. May hold stale entries, see FTimerHeapEntry. */
+	TArray<FTimerHeapEntry> ActiveTimerHeap;
+	/** Number of stale entries in ActiveTimerHeap, the heap is compacted once they are the majority. */
+	int32 NumStaleHeapEntries;
+	/** Last serial given to a heap entry. */
+	uint32 LastHeapSerial;
 
-	/** Heap of actively running timers. */
-	TArray<FTimerData> ActiveTimerHeap;
-	/** Unordered list of paused timers. */
-	TArray<FTimerData> PausedTimerList;
-	/** List of timers added this frame, to be added after timer has been ticked */
-	TArray<FTimerData> PendingTimerList;
+	/** Index in Timers of the timers added this frame, to be activated after timer has been ticked. Entries of timers that are no longer pending are skipped. */
+	TArray<int32> PendingTimerList;
 
 	/** An internally consistent clock, independent of World.  Advances during ticking. */
 	double InternalTime;
@@ -0,0 +1,61 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	VertexAnimationTextureBaker.h: Bakes skeletal animations into vertex animation textures.
+=============================================================================*/
+
+#pragma once
+
+#if WITH_EDITOR
+
+/** Assets created by FVertexAnimationTextureBaker::Bake */
+struct FVertexAnimationTextureBakeResult
+{
+	/** Per vertex offsets and normals of each frame, see FVertexAnimationTextureBaker */
+	class UTexture2D*	Texture;
+
+	/** LOD 0 of the skeletal mesh in its ref pose, with the vertex index in VertexIndexCoordinate */
+	class UStaticMesh*	StaticMesh;
+
+	/** Number of frames in the texture, to set on UMaterialExpressionVertexAnimationTexture */
+	int32				NumFrames;
+
+	/** UV channel of the static mesh that holds the vertex index, to set on UMaterialExpressionVertexAnimationTexture */
+	int32				VertexIndexCoordinate;
+
+	FVertexAnimationTextureBakeResult()
+		: Texture(NULL)
+		, StaticMesh(NULL)
+		, NumFrames(0)
+		, VertexIndexCoordinate(INDEX_NONE)
+	{
+	}
+};
+
+/**
+ * Bakes a sequence played on a skeletal mesh into a texture, so the animation can be played back on static meshes
+ * (instanced static meshes for crowds and flocks) by UMaterialExpressionVertexAnimationTexture, without any skinning.
+ *
+ * Column N of the texture is render vertex N of the LOD 0 of the skeletal mesh. For NumFrames frames:
+ *	- rows [0, NumFrames) hold the offset of each vertex from its ref pose position, in component space
+ *	- rows [NumFrames, 2 * NumFrames) hold the skinned normal of each vertex
+ * The static mesh build can reorder the vertices, so each vertex of the static mesh built along with the texture
+ * finds its column with the vertex index stored in its UVs.
+ */
+struct ENGINE_API FVertexAnimationTextureBaker
+{
+	/**
+	 * Bakes a sequence into a texture, and builds the static mesh to play it on.
+	 *
+	 * @param SkeletalMesh	mesh to bake, only LOD 0 is used
+	 * @param Sequence		sequence to bake, must be for the skeleton of the mesh. Played looping, its length is split in frames
+	 * @param FrameRate		frames per second of the sequence baked
+	 * @param Outer			outer of the assets created
+	 * @param BaseName		the assets are named BaseName_VAT and BaseName_VATMesh
+	 * @param OutResult		created assets
+	 * @return false if the mesh can't be baked, the reason is logged
+	 */
+	static bool Bake(USkeletalMesh* SkeletalMesh, const UAnimSequence* Sequence, float FrameRate, UObject* Outer, const FString& BaseName, FVertexAnimationTextureBakeResult& OutResult);
+};
+
+#endif // WITH_EDITOR
@@ -604,7 +604,11 @@ FActiveGameplayEffectHandle UAbilitySystemComponent::ApplyGameplayEffectSpecToSe
 
 void UAbilitySystemComponent::ExecutePeriodicEffect(FActiveGameplayEffectHandle	Handle)
 {
-	ActiveGameplayEffects.ExecutePeriodicGameplayEffect(Handle);
+	// The timers of all the components queue their executions, which run together once the timers are done
+	if (!FAggregatorFrameBatch::QueuePeriodicEffect(this, Handle))
+	{
+		ActiveGameplayEffects.ExecutePeriodicGameplayEffect(Handle);
+	}
 }
 
 void UAbilitySystemComponent::ExecuteGameplayEffect(FGameplayEffectSpec &Spec, FPredictionKey PredictionKey)
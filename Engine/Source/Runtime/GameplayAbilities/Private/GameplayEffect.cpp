@@ -1677,6 +1677,9 @@ void FActiveGameplayEffectsContainer::AddActiveGameplayEffectGrantedTagsAndModif
 /** Called on server to remove a GameplayEffect */
 bool FActiveGameplayEffectsContainer::RemoveActiveGameplayEffect(FActiveGameplayEffectHandle Handle)
 {
+	// If a period timer fired earlier this frame, that execution used to come before the removal
+	FAggregatorFrameBatch::ExecuteQueuedPeriodicEffect(Owner, Handle);
+
 	// Could make this a map for quicker lookup
 	for (int32 Idx = 0; Idx < GameplayEffects.Num(); ++Idx)
 	{
@@ -1906,6 +1909,9 @@ float FActiveGameplayEffectsContainer::GetWorldTime() const
 
 void FActiveGameplayEffectsContainer::CheckDuration(FActiveGameplayEffectHandle Handle)
 {
+	// A period that ended this frame before the duration did has to execute before the effect is removed
+	FAggregatorFrameBatch::ExecuteQueuedPeriodicEffect(Owner, Handle);
+
 	for (int32 Idx = 0; Idx < GameplayEffects.Num(); ++Idx)
 	{
 		FActiveGameplayEffect& Effect = GameplayEffects[Idx];
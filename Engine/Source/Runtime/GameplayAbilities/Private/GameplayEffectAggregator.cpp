@@ -3,6 +3,23 @@
 #include "AbilitySystemPrivatePCH.h"
 #include "GameplayEffectAggregator.h"
 #include "AbilitySystemComponent.h"
+#include "Tickable.h"
+
+int32 DeferAggregatorDirty = 1;
+static FAutoConsoleVariableRef CVarDeferAggregatorDirty(
+	TEXT("AbilitySystem.DeferAggregatorDirty"),
+	DeferAggregatorDirty,
+	TEXT("Defers the updates of the attributes after their mods change to once a frame, see FAggregatorFrameBatch"),
+	ECVF_Default
+	);
+
+int32 BatchPeriodicEffects = 1;
+static FAutoConsoleVariableRef CVarBatchPeriodicEffects(
+	TEXT("AbilitySystem.BatchPeriodicEffects"),
+	BatchPeriodicEffects,
+	TEXT("Runs the periodic effect executions of all ability system components together once a frame, see FAggregatorFrameBatch"),
+	ECVF_Default
+	);
 
 bool FAggregatorMod::Qualifies(const FAggregatorEvaluateParameters& Parameters) const
 {
@@ -43,55 +60,84 @@ float FAggregator::Evaluate(const FAggregatorEvaluateParameters& Parameters) con
 
 float FAggregator::EvaluateWithBase(float InlineBaseValue, const FAggregatorEvaluateParameters& Parameters) const
 {
-	for (const FAggregatorMod& Mod : Mods[EGameplayModOp::Override])
+	FAggregatorModSums ScratchSums;
+	const FAggregatorModSums& Sums = GetModSums(Parameters, ScratchSums);
+
+	if (Sums.bOverride)
 	{
-		if (Mod.Qualifies(Parameters))
-		{
-			return Mod.EvaluatedMagnitude;
-		}
+		return Sums.Override;
 	}
 
-	float Additive = SumMods(Mods[EGameplayModOp::Additive], 0.f, Parameters);
-	float Multiplicitive = SumMods(Mods[EGameplayModOp::Multiplicitive], 1.f, Parameters);
-	float Division = SumMods(Mods[EGameplayModOp::Division], 1.f, Parameters);
+	return ((InlineBaseValue + Sums.Additive) * Sums.Multiplicitive) / Sums.Division;
+}
+
+float FAggregator::ReverseEvaluate(float FinalValue, const FAggregatorEvaluateParameters& Parameters) const
+{
+	FAggregatorModSums ScratchSums;
+	const FAggregatorModSums& Sums = GetModSums(Parameters, ScratchSums);
 
-	if (FMath::IsNearlyZero(Division))
+	if (Sums.bOverride)
 	{
-		ABILITY_LOG(Warning, TEXT("Division summation was 0.0f in FAggregator."));
-		Division = 1.f;
+		// This is the case we can't really handle due to lack of information.
+		return FinalValue;
 	}
 
-	return ((InlineBaseValue + Additive) * Multiplicitive) / Division;
+	if (Sums.Multiplicitive <= SMALL_NUMBER)
+	{
+		return FinalValue;
+	}
+
+	float CalculatedBaseValue = (FinalValue * Sums.Division / Sums.Multiplicitive) - Sums.Additive;
+	return CalculatedBaseValue;
 }
 
-float FAggregator::ReverseEvaluate(float FinalValue, const FAggregatorEvaluateParameters& Parameters) const
+const FAggregatorModSums& FAggregator::GetModSums(const FAggregatorEvaluateParameters& Parameters, FAggregatorModSums& ScratchSums) const
 {
+	// Without tags or filters, whether a mod qualifies only depends on the mod itself
+	if (Parameters.SourceTags || Parameters.TargetTags || Parameters.AppliedSourceTagFilter.Num() > 0 || Parameters.AppliedTargetTagFilter.Num() > 0)
+	{
+		ComputeModSums(Parameters, ScratchSums);
+		return ScratchSums;
+	}
+
+	FAggregatorModSums& CachedSums = CachedModSums[Parameters.IncludePredictiveMods ? 1 : 0];
+	if (!CachedSums.bValid)
+	{
+		ComputeModSums(Parameters, CachedSums);
+	}
+	return CachedSums;
+}
+
+void FAggregator::ComputeModSums(const FAggregatorEvaluateParameters& Parameters, FAggregatorModSums& OutSums) const
+{
+	OutSums = FAggregatorModSums();
+	OutSums.bValid = true;
+
 	for (const FAggregatorMod& Mod : Mods[EGameplayModOp::Override])
 	{
 		if (Mod.Qualifies(Parameters))
 		{
-			// This is the case we can't really handle due to lack of information.
-			return FinalValue;
+			OutSums.bOverride = true;
+			OutSums.Override = Mod.EvaluatedMagnitude;
+			return;
 		}
 	}
 
-	float Additive = SumMods(Mods[EGameplayModOp::Additive], 0.f, Parameters);
-	float Multiplicitive = SumMods(Mods[EGameplayModOp::Multiplicitive], 1.f, Parameters);
-	float Division = SumMods(Mods[EGameplayModOp::Division], 1.f, Parameters);
+	OutSums.Additive = SumMods(Mods[EGameplayModOp::Additive], 0.f, Parameters);
+	OutSums.Multiplicitive = SumMods(Mods[EGameplayModOp::Multiplicitive], 1.f, Parameters);
+	OutSums.Division = SumMods(Mods[EGameplayModOp::Division], 1.f, Parameters);
 
-	if (FMath::IsNearlyZero(Division))
+	if (FMath::IsNearlyZero(OutSums.Division))
 	{
 		ABILITY_LOG(Warning, TEXT("Division summation was 0.0f in FAggregator."));
-		Division = 1.f;
-	}
-
-	if (Multiplicitive <= SMALL_NUMBER)
-	{
-		return FinalValue;
+		OutSums.Division = 1.f;
 	}
+}
 
-	float CalculatedBaseValue = (FinalValue * Division / Multiplicitive) - Additive;
-	return CalculatedBaseValue;
+void FAggregator::InvalidateModSums()
+{
+	CachedModSums[0].bValid = false;
+	CachedModSums[1].bValid = false;
 }
 
 float FAggregator::EvaluateBonus(const FAggregatorEvaluateParameters& Parameters) const
@@ -182,7 +228,8 @@ void FAggregator::AddMod(float EvaluatedMagnitude, TEnumAsByte<EGameplayModOp::T
 	if (IsPredicted)
 		NumPredictiveMods++;
 
-	BroadcastOnDirty();
+	InvalidateModSums();
+	DeferOnDirty();
 }
 
 void FAggregator::RemoveMod(FActiveGameplayEffectHandle ActiveHandle)
@@ -195,7 +242,8 @@ void FAggregator::RemoveMod(FActiveGameplayEffectHandle ActiveHandle)
 		RemoveModsWithActiveHandle(Mods[EGameplayModOp::Override], ActiveHandle);
 	}
 
-	BroadcastOnDirty();
+	InvalidateModSums();
+	DeferOnDirty();
 }
 
 void FAggregator::AddModsFrom(const FAggregator& SourceAggregator)
@@ -204,6 +252,7 @@ void FAggregator::AddModsFrom(const FAggregator& SourceAggregator)
 	{
 		Mods[idx].Append(SourceAggregator.Mods[idx]);
 	}
+	InvalidateModSums();
 }
 
 void FAggregator::AddDependant(FActiveGameplayEffectHandle Handle)
@@ -239,6 +288,7 @@ void FAggregator::TakeSnapshotOf(const FAggregator& AggToSnapshot)
 	{
 		Mods[idx] = AggToSnapshot.Mods[idx];
 	}
+	InvalidateModSums();
 }
 
 void FAggregator::BroadcastOnDirty()
@@ -258,6 +308,9 @@ void FAggregator::BroadcastOnDirty()
 	}
 
 	TGuardValue<bool>	Guard(IsBroadcastingDirty, true);
+
+	// This broadcast covers any deferred one
+	bOnDirtyDeferred = false;
 	
 	OnDirty.Broadcast(this);
 
@@ -276,6 +329,15 @@ void FAggregator::BroadcastOnDirty()
 
 }
 
+void FAggregator::DeferOnDirty()
+{
+	// Without dependants or a bound OnDirty there is nothing to broadcast. Cyclic dependencies go through BroadcastOnDirty to be detected.
+	if (IsBroadcastingDirty || (Dependants.Num() > 0 || OnDirty.IsBound()) == false || !FAggregatorFrameBatch::DeferOnDirty(this))
+	{
+		BroadcastOnDirty();
+	}
+}
+
 void FAggregatorRef::TakeSnapshotOf(const FAggregatorRef& RefToSnapshot)
 {
 	if (RefToSnapshot.Data.IsValid())
@@ -340,4 +402,130 @@ void FScopedAggregatorOnDirtyBatch::EndNetReceiveLock()
 		EndLock();
 		GlobalFromNetworkUpdate = false;
 	}
-}
\ No newline at end of file
+}
+
+TArray<TWeakPtr<FAggregator>> FAggregatorFrameBatch::DeferredAggregators;
+TArray<FAggregatorFrameBatch::FQueuedPeriodicEffect> FAggregatorFrameBatch::QueuedPeriodicEffects;
+bool FAggregatorFrameBatch::bFlushing = false;
+
+/** Flushes FAggregatorFrameBatch once a frame, right after the timers tick */
+class FAggregatorFrameBatchTicker : public FTickableGameObject
+{
+public:
+	virtual void Tick(float DeltaTime) override
+	{
+		FAggregatorFrameBatch::Flush();
+	}
+
+	virtual bool IsTickable() const override
+	{
+		return FAggregatorFrameBatch::HasPendingWork();
+	}
+
+	virtual bool IsTickableWhenPaused() const override
+	{
+		return true;
+	}
+
+	virtual bool IsTickableInEditor() const override
+	{
+		return true;
+	}
+
+	virtual TStatId GetStatId() const override
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FAggregatorFrameBatchTicker, STATGROUP_Tickables);
+	}
+};
+
+/** Created on first use, so it registers with the tickable objects after the engine module initialized them */
+static void EnsureFrameBatchTicker()
+{
+	static FAggregatorFrameBatchTicker Ticker;
+}
+
+bool FAggregatorFrameBatch::DeferOnDirty(FAggregator* Aggregator)
+{
+	// Within a FScopedAggregatorOnDirtyBatch, the scope already batches the call
+	if (!DeferAggregatorDirty || bFlushing || FScopedAggregatorOnDirtyBatch::GlobalBatchCount > 0)
+	{
+		return false;
+	}
+
+	if (!Aggregator->bOnDirtyDeferred)
+	{
+		EnsureFrameBatchTicker();
+		Aggregator->bOnDirtyDeferred = true;
+		DeferredAggregators.Add(Aggregator->AsShared());
+	}
+	return true;
+}
+
+bool FAggregatorFrameBatch::QueuePeriodicEffect(UAbilitySystemComponent* Owner, FActiveGameplayEffectHandle Handle)
+{
+	if (!BatchPeriodicEffects || bFlushing)
+	{
+		return false;
+	}
+
+	EnsureFrameBatchTicker();
+	FQueuedPeriodicEffect QueuedEffect;
+	QueuedEffect.Owner = Owner;
+	QueuedEffect.Handle = Handle;
+	QueuedPeriodicEffects.Add(QueuedEffect);
+	return true;
+}
+
+void FAggregatorFrameBatch::ExecuteQueuedPeriodicEffect(UAbilitySystemComponent* Owner, FActiveGameplayEffectHandle Handle)
+{
+	for (int32 Idx = 0; Idx < QueuedPeriodicEffects.Num(); ++Idx)
+	{
+		if (QueuedPeriodicEffects[Idx].Handle == Handle && QueuedPeriodicEffects[Idx].Owner.Get() == Owner)
+		{
+			QueuedPeriodicEffects.RemoveAt(Idx);
+
+			TGuardValue<bool> Guard(bFlushing, true);
+			Owner->ExecutePeriodicEffect(Handle);
+			return;
+		}
+	}
+}
+
+void FAggregatorFrameBatch::Flush()
+{
+	if (bFlushing)
+	{
+		return;
+	}
+
+	TGuardValue<bool> Guard(bFlushing, true);
+
+	// Periodic effects first, so the mods they change are part of this flush. Executions can queue nothing while flushing.
+	TArray<FQueuedPeriodicEffect> PeriodicEffects;
+	Exchange(PeriodicEffects, QueuedPeriodicEffects);
+	for (const FQueuedPeriodicEffect& QueuedEffect : PeriodicEffects)
+	{
+		UAbilitySystemComponent* Owner = QueuedEffect.Owner.Get();
+		if (Owner)
+		{
+			Owner->ExecutePeriodicEffect(QueuedEffect.Handle);
+		}
+	}
+
+	// Aggregators that were destroyed since, or already broadcast, are skipped
+	TArray<TWeakPtr<FAggregator>> Aggregators;
+	Exchange(Aggregators, DeferredAggregators);
+	for (const TWeakPtr<FAggregator>& WeakAggregator : Aggregators)
+	{
+		TSharedPtr<FAggregator> Aggregator = WeakAggregator.Pin();
+		if (Aggregator.IsValid() && Aggregator->bOnDirtyDeferred)
+		{
+			Aggregator->BroadcastOnDirty();
+		}
+	}
+}
+
+bool FAggregatorFrameBatch::HasPendingWork()
+{
+	return DeferredAggregators.Num() > 0 || QueuedPeriodicEffects.Num() > 0;
+}
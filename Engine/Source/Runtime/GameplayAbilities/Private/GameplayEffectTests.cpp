@@ -166,6 +166,9 @@ public: // the tests
 			BuffHandle = SourceComponent->ApplyGameplayEffectToTarget(DamageBuffEffect, DestComponent, 1.f);
 		}
 
+		// mod changes reach the attributes once a frame
+		TickWorld(SMALL_NUMBER);
+
 		// check that the value changed
 		TestEqual(SKILL_TEST_TEXT("Mana Buffed"), DestComponent->GetSet<UAbilitySystemTestAttributeSet>()->Mana, StartingMana + BuffValue);
 
@@ -176,6 +179,8 @@ public: // the tests
 			DestComponent->RemoveActiveGameplayEffect(BuffHandle);
 		}
 
+		TickWorld(SMALL_NUMBER);
+
 		// check that the value changed back
 		TestEqual(SKILL_TEST_TEXT("Mana Restored"), DestComponent->GetSet<UAbilitySystemTestAttributeSet>()->Mana, StartingMana);
 	}
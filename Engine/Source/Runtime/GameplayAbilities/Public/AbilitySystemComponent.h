@@ -821,6 +821,7 @@ protected:
 	friend struct FActiveGameplayEffectsContainer;
 	friend struct FActiveGameplayCue;
 	friend struct FActiveGameplayCueContainer;
+	friend struct FAggregatorFrameBatch;
 
 private:
 	FDelegateHandle MonitoredTagChangedDelegatHandle;
@@ -33,12 +33,25 @@ struct GAMEPLAYABILITIES_API FAggregatorMod
 	bool Qualifies(const FAggregatorEvaluateParameters& Parameters) const;
 };
 
+/** Sums of the mods of an aggregator that qualify for some parameters, what is left of an evaluation once the base value is known */
+struct GAMEPLAYABILITIES_API FAggregatorModSums
+{
+	FAggregatorModSums() : bValid(false), bOverride(false), Override(0.f), Additive(0.f), Multiplicitive(1.f), Division(1.f) { }
+
+	bool	bValid;
+	bool	bOverride;		// If true, the evaluation is Override regardless of the base value
+	float	Override;
+	float	Additive;
+	float	Multiplicitive;
+	float	Division;
+};
+
 
 struct GAMEPLAYABILITIES_API FAggregator : public TSharedFromThis<FAggregator>
 {
 	DECLARE_MULTICAST_DELEGATE_OneParam(FOnAggregatorDirty, FAggregator*);
 
-	FAggregator(float InBaseValue=0.f) : NetUpdateID(0), BaseValue(InBaseValue), IsBroadcastingDirty(false), NumPredictiveMods(0) { }
+	FAggregator(float InBaseValue=0.f) : NetUpdateID(0), BaseValue(InBaseValue), IsBroadcastingDirty(false), bOnDirtyDeferred(false), NumPredictiveMods(0) { }
 
 	/** Simple accessor to base value */
 	float GetBaseValue() const;
@@ -77,19 +90,35 @@ struct GAMEPLAYABILITIES_API FAggregator : public TSharedFromThis<FAggregator>
 private:
 
 	void BroadcastOnDirty();
+	/** Like BroadcastOnDirty, but leaves it to FAggregatorFrameBatch when it can. Used for mod changes, which nothing needs right away */
+	void DeferOnDirty();
 	float SumMods(const TArray<FAggregatorMod> &Mods, float Bias, const FAggregatorEvaluateParameters& Parameters) const;
 	void RemoveModsWithActiveHandle(TArray<FAggregatorMod>& Mods, FActiveGameplayEffectHandle ActiveHandle);
 
+	/** 
+	 * Returns the sums of the mods that qualify for Parameters. Evaluations without tags or filters, which is how the attributes themselves
+	 * are evaluated, are cached until the mods change, so changing the base value doesn't walk the mods again.
+	 */
+	const FAggregatorModSums& GetModSums(const FAggregatorEvaluateParameters& Parameters, FAggregatorModSums& ScratchSums) const;
+	void ComputeModSums(const FAggregatorEvaluateParameters& Parameters, FAggregatorModSums& OutSums) const;
+	void InvalidateModSums();
+
 	float	BaseValue;
 	TArray<FAggregatorMod>	Mods[EGameplayModOp::Max];
 
+	/** Mod sums of the evaluations without tags or filters, without and with the predictive mods */
+	mutable FAggregatorModSums	CachedModSums[2];
+
 	/** ActiveGE handles that we need to notify if we change. NOT copied over during snapshots. */
 	TArray<FActiveGameplayEffectHandle>	Dependants;
 	bool	IsBroadcastingDirty;
+	/** True while FAggregatorFrameBatch holds an OnDirty broadcast for us */
+	bool	bOnDirtyDeferred;
 	int32	NumPredictiveMods;
 
 	friend struct FAggregator;
 	friend struct FScopedAggregatorOnDirtyBatch;	// Only outside class that gets to call BroadcastOnDirty()
+	friend struct FAggregatorFrameBatch;
 	friend class UAbilitySystemComponent;	// Only needed for DisplayDebug()
 };
 
@@ -128,4 +157,46 @@ struct GAMEPLAYABILITIES_API FScopedAggregatorOnDirtyBatch
 
 	static bool		GlobalFromNetworkUpdate;
 	static int32	NetUpdateID;
-};
\ No newline at end of file
+};
+
+/**
+ *	Coalesces the gameplay effect work of all ability system components to once a frame, right after the timers of the world tick.
+ *
+ *	-Mod changes, from effects being added, removed or having their magnitudes recalculated, defer their aggregator's OnDirty call here.
+ *	 However many effects change in a frame, each aggregator then updates its attribute and notifies its dependants once.
+ *	 Base value changes from executions still broadcast right away, as PostGameplayEffectExecute reads the new attribute value.
+ *	-Periodic effect timers queue their executions here, and all of them run in a single pass.
+ *
+ *	The attribute properties only see mod changes once the batch is flushed. Both can be turned off with
+ *	AbilitySystem.DeferAggregatorDirty and AbilitySystem.BatchPeriodicEffects.
+ */
+struct GAMEPLAYABILITIES_API FAggregatorFrameBatch
+{
+	/** Holds the OnDirty call of Aggregator until the next flush. Returns false if it has to be broadcast right away */
+	static bool DeferOnDirty(FAggregator* Aggregator);
+
+	/** Queues the execution of a periodic effect until the next flush. Returns false if it has to be executed right away */
+	static bool QueuePeriodicEffect(class UAbilitySystemComponent* Owner, FActiveGameplayEffectHandle Handle);
+
+	/** Executes the queued execution of Handle now, if any. For effects about to be removed before the flush */
+	static void ExecuteQueuedPeriodicEffect(class UAbilitySystemComponent* Owner, FActiveGameplayEffectHandle Handle);
+
+	/** Executes the queued periodic effects, then broadcasts the deferred OnDirty calls */
+	static void Flush();
+
+	static bool HasPendingWork();
+
+private:
+
+	struct FQueuedPeriodicEffect
+	{
+		TWeakObjectPtr<class UAbilitySystemComponent> Owner;
+		FActiveGameplayEffectHandle Handle;
+	};
+
+	static TArray<TWeakPtr<FAggregator>>	DeferredAggregators;
+	static TArray<FQueuedPeriodicEffect>	QueuedPeriodicEffects;
+
+	/** Everything runs right away while flushing, which keeps the cyclic dependency detection of BroadcastOnDirty working */
+	static bool	bFlushing;
+};
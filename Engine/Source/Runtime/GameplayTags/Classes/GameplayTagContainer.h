@@ -205,6 +205,21 @@ struct GAMEPLAYTAGS_API FGameplayTagContainer
 	 */
 	bool Serialize(FArchive& Ar);
 
+	/**
+	 * Serialize the tag container for replication, as dense tag indices when every tag is indexed. Relies on the server and the
+	 * clients building their tag trees from the same tables, as the names are only sent when a tag has no index
+	 *
+	 * @param Ar			Archive to serialize to
+	 * @param Map			Package map of the connection
+	 * @param bOutSuccess	Set to false if the data read is invalid
+	 *
+	 * @return True if the container was serialized
+	 */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	/** Text import writes the tags through reflection, so only invalidate the tag bits and let the default import run */
+	bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
+
 	/** Renames any tags that may have changed by the ini file */
 	void RedirectTags();
 
@@ -256,6 +271,24 @@ protected:
 	*/
 	bool DoesTagContainerMatch(const FGameplayTagContainer& OtherContainer, TEnumAsByte<EGameplayTagMatchType::Type> TagMatchType, TEnumAsByte<EGameplayTagMatchType::Type> OtherTagMatchType, EGameplayContainerMatchType ContainerMatchType) const;
 
+	/**
+	 * Rebuilds the tag bits if they were built for another generation of the tag indices, or invalidated
+	 *
+	 * @return True if every tag of the container is indexed
+	 */
+	bool UpdateTagBits(const class UGameplayTagsManager& TagManager) const;
+
+	/** Adds a tag that was just added to GameplayTags to the tag bits */
+	void AddTagBits(const FGameplayTag& Tag);
+
+	/** Forces the tag bits to be rebuilt on the next query */
+	void InvalidateTagBits()
+	{
+		ExplicitTagBits.Reset();
+		ImpliedTagBits.Reset();
+		TagBitsGeneration = 0;
+	}
+
 
 private:
 
@@ -267,6 +300,20 @@ private:
 	UPROPERTY(VisibleAnywhere, Category=GameplayTags)
 	TArray<FGameplayTag> GameplayTags;
 
+	/**
+	 * Cache of GameplayTags as bits of the dense tag indices of UGameplayTagsManager, so queries are word-wise ANDs.
+	 * Explicit holds the tags of the container, Implied the tags and all of their parents. Kept current by every method that
+	 * changes GameplayTags, rebuilt on the next query if the manager indices changed.
+	 */
+	mutable TArray<uint32> ExplicitTagBits;
+	mutable TArray<uint32> ImpliedTagBits;
+
+	/** Generation of the manager indices the bits were built for, 0 if they have to be rebuilt */
+	mutable uint32 TagBitsGeneration;
+
+	/** False if some tag of the container isn't in the tag tree, so it has no bit */
+	mutable bool bAllTagsIndexed;
+
 	/**
 	 * DO NOT USE DIRECTLY
 	 * STL-like iterators to enable range-based for loop support.
@@ -282,6 +329,8 @@ struct TStructOpsTypeTraits<FGameplayTagContainer> : public TStructOpsTypeTraits
 	enum
 	{
 		WithSerializer = true,
+		WithNetSerializer = true,
+		WithImportTextItem = true,
 		WithIdenticalViaEquality = true,
 		WithCopy = true
 	};
@@ -234,6 +234,44 @@ class GAMEPLAYTAGS_API UGameplayTagsManager : public UObject
 	 */
 	bool GameplayTagsMatch(const FGameplayTag& GameplayTagOne, TEnumAsByte<EGameplayTagMatchType::Type> MatchTypeOne, const FGameplayTag& GameplayTagTwo, TEnumAsByte<EGameplayTagMatchType::Type> MatchTypeTwo) const;
 
+	/**
+	 * Gets the dense index of a tag. Indices are assigned in the order the tags are added to the tree, so a parent always has a lower
+	 * index than its children, and the same tables give the same indices on every machine
+	 *
+	 * @param GameplayTag	The tag to get the index of
+	 *
+	 * @return The index of the tag, or INDEX_NONE if the tag is not in the tree
+	 */
+	int32 GetGameplayTagIndex(const FGameplayTag& GameplayTag) const
+	{
+		const int32* TagIndex = GameplayTagIndexMap.Find(GameplayTag.GetTagName());
+		return TagIndex ? *TagIndex : INDEX_NONE;
+	}
+
+	/** Returns the index of the direct parent of the tag at TagIndex, or INDEX_NONE if it is a root tag */
+	int32 GetParentTagIndex(int32 TagIndex) const
+	{
+		return ParentTagIndices[TagIndex];
+	}
+
+	/** Returns the tag at TagIndex */
+	const FGameplayTag& GetGameplayTagFromIndex(int32 TagIndex) const
+	{
+		return IndexedGameplayTags[TagIndex];
+	}
+
+	/** Returns the number of indexed tags, every index is lower than this */
+	int32 GetNumIndexedTags() const
+	{
+		return IndexedGameplayTags.Num();
+	}
+
+	/** Returns a number that changes whenever the tag indices are invalidated, so containers know when to rebuild their tag bits */
+	uint32 GetTagIndexGeneration() const
+	{
+		return TagIndexGeneration;
+	}
+
 	/** Event for when assets are added to the registry */
 	DECLARE_EVENT(UGameplayTagsManager, FGameplayTagTreeChanged);
 	virtual FGameplayTagTreeChanged& OnGameplayTagTreeChanged() { return GameplayTagTreeChangedEvent; }
@@ -279,6 +317,18 @@ private:
 	/** Map of Names to tags - Internal use only*/
 	TMap<FName, FGameplayTag> GameplayTagMap;
 
+	/** Map of Names to dense tag indices - Internal use only*/
+	TMap<FName, int32> GameplayTagIndexMap;
+
+	/** Tags by dense index */
+	TArray<FGameplayTag> IndexedGameplayTags;
+
+	/** Index of the direct parent of each indexed tag, INDEX_NONE for root tags */
+	TArray<int32> ParentTagIndices;
+
+	/** Changed whenever the tree is destroyed, as the indices of the new tree won't match */
+	uint32 TagIndexGeneration;
+
 	/** Holds all of the valid gameplay-related tags that can be applied to assets */
 	UPROPERTY()
 	TArray<UDataTable*> GameplayTagTables;
@@ -4,15 +4,94 @@
 
 const FGameplayTagContainer FGameplayTagContainer::EmptyContainer;
 
+/** Sets the bit of a tag index, growing the bits as needed */
+static FORCEINLINE void SetTagBit(TArray<uint32>& TagBits, int32 TagIndex)
+{
+	const int32 WordIndex = TagIndex >> 5;
+	if (WordIndex >= TagBits.Num())
+	{
+		TagBits.AddZeroed(WordIndex + 1 - TagBits.Num());
+	}
+	TagBits[WordIndex] |= 1u << (TagIndex & 31);
+}
+
+static FORCEINLINE bool TestTagBit(const TArray<uint32>& TagBits, int32 TagIndex)
+{
+	const int32 WordIndex = TagIndex >> 5;
+	return WordIndex < TagBits.Num() && (TagBits[WordIndex] & (1u << (TagIndex & 31))) != 0;
+}
+
+/** Returns true if A and B share a bit */
+static bool TagBitsOverlap(const TArray<uint32>& A, const TArray<uint32>& B)
+{
+	const int32 NumWords = FMath::Min(A.Num(), B.Num());
+	for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+	{
+		if (A[WordIndex] & B[WordIndex])
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/** Returns true if every bit of B is set in A */
+static bool TagBitsContain(const TArray<uint32>& A, const TArray<uint32>& B)
+{
+	for (int32 WordIndex = 0; WordIndex < B.Num(); ++WordIndex)
+	{
+		const uint32 AWord = WordIndex < A.Num() ? A[WordIndex] : 0;
+		if (B[WordIndex] & ~AWord)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/** Returns true if the tag, and its parents if MatchType includes them, has a bit set in TagBits */
+static bool TagMatchesBits(const UGameplayTagsManager& TagManager, int32 TagIndex, TEnumAsByte<EGameplayTagMatchType::Type> MatchType, const TArray<uint32>& TagBits)
+{
+	if (MatchType == EGameplayTagMatchType::Explicit)
+	{
+		return TestTagBit(TagBits, TagIndex);
+	}
+
+	for (; TagIndex != INDEX_NONE; TagIndex = TagManager.GetParentTagIndex(TagIndex))
+	{
+		if (TestTagBit(TagBits, TagIndex))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/** Sets the bit of the tag in ExplicitTagBits and the bits of the tag and all of its parents in ImpliedTagBits */
+static void AddTagIndexBits(const UGameplayTagsManager& TagManager, int32 TagIndex, TArray<uint32>& ExplicitTagBits, TArray<uint32>& ImpliedTagBits)
+{
+	SetTagBit(ExplicitTagBits, TagIndex);
+	for (; TagIndex != INDEX_NONE; TagIndex = TagManager.GetParentTagIndex(TagIndex))
+	{
+		SetTagBit(ImpliedTagBits, TagIndex);
+	}
+}
+
 FGameplayTagContainer::FGameplayTagContainer()
+	: TagBitsGeneration(0)
+	, bAllTagsIndexed(true)
 {}
 
 FGameplayTagContainer::FGameplayTagContainer(FGameplayTagContainer const& Other)
+	: TagBitsGeneration(0)
+	, bAllTagsIndexed(true)
 {
 	*this = Other;
 }
 
 FGameplayTagContainer::FGameplayTagContainer(const FGameplayTag& Tag)
+	: TagBitsGeneration(0)
+	, bAllTagsIndexed(true)
 {
 	AddTag(Tag);
 }
@@ -27,6 +106,11 @@ FGameplayTagContainer& FGameplayTagContainer::operator=(FGameplayTagContainer co
 	GameplayTags.Empty(Other.GameplayTags.Num());
 	GameplayTags.Append(Other.GameplayTags);
 
+	ExplicitTagBits = Other.ExplicitTagBits;
+	ImpliedTagBits = Other.ImpliedTagBits;
+	TagBitsGeneration = Other.TagBitsGeneration;
+	bAllTagsIndexed = Other.bAllTagsIndexed;
+
 	return *this;
 }
 
@@ -36,29 +120,33 @@ bool FGameplayTagContainer::operator==(FGameplayTagContainer const& Other) const
 	{
 		return false;
 	}
+
+	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
+	const bool bAllIndexed = UpdateTagBits(TagManager);
+	if (Other.UpdateTagBits(TagManager) && bAllIndexed)
+	{
+		return TagBitsContain(ExplicitTagBits, Other.ExplicitTagBits) && TagBitsContain(Other.ExplicitTagBits, ExplicitTagBits);
+	}
 	return Filter(Other, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit).Num() == this->Num();
 }
 
 bool FGameplayTagContainer::operator!=(FGameplayTagContainer const& Other) const
 {
-	if (GameplayTags.Num() != Other.GameplayTags.Num())
-	{
-		return true;
-	}
-	return Filter(Other, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit).Num() != this->Num();
+	return !(*this == Other);
 }
 
 bool FGameplayTagContainer::HasTag(FGameplayTag const& TagToCheck, TEnumAsByte<EGameplayTagMatchType::Type> TagMatchType, TEnumAsByte<EGameplayTagMatchType::Type> TagToCheckMatchType) const
 {
 	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
-	for (TArray<FGameplayTag>::TConstIterator It(this->GameplayTags); It; ++It)
+	const int32 TagIndex = TagManager.GetGameplayTagIndex(TagToCheck);
+	if (TagIndex == INDEX_NONE)
 	{
-		if (TagManager.GameplayTagsMatch(*It, TagMatchType, TagToCheck, TagToCheckMatchType) == true)
-		{
-			return true;
-		}
+		// Tags that aren't in the tree never match
+		return false;
 	}
-	return false;
+
+	UpdateTagBits(TagManager);
+	return TagMatchesBits(TagManager, TagIndex, TagToCheckMatchType, TagMatchType == EGameplayTagMatchType::Explicit ? ExplicitTagBits : ImpliedTagBits);
 }
 
 FGameplayTagContainer FGameplayTagContainer::GetGameplayTagParents() const
@@ -80,15 +168,16 @@ FGameplayTagContainer FGameplayTagContainer::Filter(const FGameplayTagContainer&
 	FGameplayTagContainer ResultContainer;
 	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
 
-	
-	for (TArray<FGameplayTag>::TConstIterator OtherIt(OtherContainer.GameplayTags); OtherIt; ++OtherIt)
+	OtherContainer.UpdateTagBits(TagManager);
+	const TArray<uint32>& OtherTagBits = OtherTagMatchType == EGameplayTagMatchType::Explicit ? OtherContainer.ExplicitTagBits : OtherContainer.ImpliedTagBits;
+
+	// A tag matches some tag of OtherContainer if it matches the union of their bits
+	for (TArray<FGameplayTag>::TConstIterator It(this->GameplayTags); It; ++It)
 	{
-		for (TArray<FGameplayTag>::TConstIterator It(this->GameplayTags); It; ++It)
+		const int32 TagIndex = TagManager.GetGameplayTagIndex(*It);
+		if (TagIndex != INDEX_NONE && TagMatchesBits(TagManager, TagIndex, TagMatchType, OtherTagBits))
 		{
-			if (TagManager.GameplayTagsMatch(*It, TagMatchType, *OtherIt, OtherTagMatchType) == true)
-			{
-				ResultContainer.AddTag(*It);
-			}
+			ResultContainer.AddTag(*It);
 		}
 	}
 
@@ -97,37 +186,39 @@ FGameplayTagContainer FGameplayTagContainer::Filter(const FGameplayTagContainer&
 
 bool FGameplayTagContainer::DoesTagContainerMatch(const FGameplayTagContainer& OtherContainer, TEnumAsByte<EGameplayTagMatchType::Type> TagMatchType, TEnumAsByte<EGameplayTagMatchType::Type> OtherTagMatchType, EGameplayContainerMatchType ContainerMatchType) const
 {
+	check(ContainerMatchType == EGameplayContainerMatchType::All || ContainerMatchType == EGameplayContainerMatchType::Any);
 	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
 
-	for (TArray<FGameplayTag>::TConstIterator OtherIt(OtherContainer.GameplayTags); OtherIt; ++OtherIt)
-	{
-		bool bTagFound = false;
+	UpdateTagBits(TagManager);
+	const bool bOtherAllTagsIndexed = OtherContainer.UpdateTagBits(TagManager);
+	const TArray<uint32>& TagBits = TagMatchType == EGameplayTagMatchType::Explicit ? ExplicitTagBits : ImpliedTagBits;
 
-		for (TArray<FGameplayTag>::TConstIterator It(this->GameplayTags); It; ++It)
-		{
-			if (TagManager.GameplayTagsMatch(*It, TagMatchType, *OtherIt, OtherTagMatchType) == true)
-			{
-				if (ContainerMatchType == EGameplayContainerMatchType::Any)
-				{
-					return true;
-				}
+	if (ContainerMatchType == EGameplayContainerMatchType::Any)
+	{
+		// Two tags match if they share a tag once expanded, so some pair matches if the unions of the two containers share one
+		return TagBitsOverlap(TagBits, OtherTagMatchType == EGameplayTagMatchType::Explicit ? OtherContainer.ExplicitTagBits : OtherContainer.ImpliedTagBits);
+	}
 
-				bTagFound = true;
+	// Tags that aren't in the tree never match, so they can't all be found
+	if (!bOtherAllTagsIndexed)
+	{
+		return false;
+	}
 
-				// we only need one match per tag in OtherContainer, so don't bother looking for more
-				break;
-			}
-		}
+	if (OtherTagMatchType == EGameplayTagMatchType::Explicit)
+	{
+		return TagBitsContain(TagBits, OtherContainer.ExplicitTagBits);
+	}
 
-		if (ContainerMatchType == EGameplayContainerMatchType::All && bTagFound == false)
+	// The union of the parents can't tell which tag of OtherContainer they came from, so each tag needs its own test
+	for (TArray<FGameplayTag>::TConstIterator OtherIt(OtherContainer.GameplayTags); OtherIt; ++OtherIt)
+	{
+		if (!TagMatchesBits(TagManager, TagManager.GetGameplayTagIndex(*OtherIt), OtherTagMatchType, TagBits))
 		{
 			return false;
 		}
 	}
-
-	// if we've reached this far then either we are looking for any match and didn't find one (return false) or we're looking for all matches and didn't miss one (return true).
-	check(ContainerMatchType == EGameplayContainerMatchType::All || ContainerMatchType == EGameplayContainerMatchType::Any);
-	return ContainerMatchType == EGameplayContainerMatchType::All;
+	return true;
 }
 
 
@@ -165,23 +256,75 @@ void FGameplayTagContainer::AddTag(const FGameplayTag& TagToAdd)
 	if (TagToAdd.IsValid())
 	{
 		// Don't want duplicate tags
-		GameplayTags.AddUnique(TagToAdd);
+		const int32 NumTags = GameplayTags.Num();
+		if (GameplayTags.AddUnique(TagToAdd) == NumTags)
+		{
+			AddTagBits(TagToAdd);
+		}
 	}
 }
 
 void FGameplayTagContainer::AddTagFast(const FGameplayTag& TagToAdd)
 {
 	GameplayTags.Add(TagToAdd);
+	AddTagBits(TagToAdd);
 }
 
 void FGameplayTagContainer::RemoveTag(FGameplayTag TagToRemove)
 {
-	GameplayTags.Remove(TagToRemove);
+	// The parents of the tag may be implied by other tags too, so rebuild the bits rather than clearing them
+	if (GameplayTags.Remove(TagToRemove) > 0)
+	{
+		InvalidateTagBits();
+	}
 }
 
 void FGameplayTagContainer::RemoveAllTags(int32 Slack)
 {
 	GameplayTags.Empty(Slack);
+	InvalidateTagBits();
+}
+
+bool FGameplayTagContainer::UpdateTagBits(const UGameplayTagsManager& TagManager) const
+{
+	if (TagBitsGeneration != TagManager.GetTagIndexGeneration())
+	{
+		ExplicitTagBits.Reset();
+		ImpliedTagBits.Reset();
+		bAllTagsIndexed = true;
+
+		for (TArray<FGameplayTag>::TConstIterator It(GameplayTags); It; ++It)
+		{
+			const int32 TagIndex = TagManager.GetGameplayTagIndex(*It);
+			if (TagIndex == INDEX_NONE)
+			{
+				bAllTagsIndexed = false;
+				continue;
+			}
+
+			AddTagIndexBits(TagManager, TagIndex, ExplicitTagBits, ImpliedTagBits);
+		}
+
+		TagBitsGeneration = TagManager.GetTagIndexGeneration();
+	}
+	return bAllTagsIndexed;
+}
+
+void FGameplayTagContainer::AddTagBits(const FGameplayTag& Tag)
+{
+	// If the bits aren't current they are rebuilt from GameplayTags, which already holds the tag, on the next query
+	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
+	if (TagBitsGeneration == TagManager.GetTagIndexGeneration())
+	{
+		const int32 TagIndex = TagManager.GetGameplayTagIndex(Tag);
+		if (TagIndex == INDEX_NONE)
+		{
+			bAllTagsIndexed = false;
+			return;
+		}
+
+		AddTagIndexBits(TagManager, TagIndex, ExplicitTagBits, ImpliedTagBits);
+	}
 }
 
 bool FGameplayTagContainer::Serialize(FArchive& Ar)
@@ -199,6 +342,8 @@ bool FGameplayTagContainer::Serialize(FArchive& Ar)
 	
 	if (Ar.IsLoading())
 	{
+		InvalidateTagBits();
+
 		// Regardless of version, want loading to have a chance to handle redirects
 		RedirectTags();
 
@@ -217,6 +362,77 @@ bool FGameplayTagContainer::Serialize(FArchive& Ar)
 	return true;
 }
 
+bool FGameplayTagContainer::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
+	const uint32 NumIndexedTags = TagManager.GetNumIndexedTags();
+
+	// Fall back to the names if some tag has no index
+	uint8 bUseTagIndices = 0;
+	if (Ar.IsSaving())
+	{
+		bUseTagIndices = (UpdateTagBits(TagManager) && (uint32)GameplayTags.Num() <= NumIndexedTags) ? 1 : 0;
+	}
+	Ar.SerializeBits(&bUseTagIndices, 1);
+
+	if (!bUseTagIndices)
+	{
+		Ar << GameplayTags;
+		if (Ar.IsLoading())
+		{
+			InvalidateTagBits();
+		}
+		bOutSuccess = true;
+		return true;
+	}
+
+	uint32 NumTags = GameplayTags.Num();
+	Ar.SerializeIntPacked(NumTags);
+
+	if (Ar.IsSaving())
+	{
+		for (TArray<FGameplayTag>::TConstIterator It(GameplayTags); It; ++It)
+		{
+			uint32 TagIndex = TagManager.GetGameplayTagIndex(*It);
+			Ar.SerializeInt(TagIndex, NumIndexedTags);
+		}
+		bOutSuccess = true;
+		return true;
+	}
+
+	if (NumTags > NumIndexedTags)
+	{
+		UE_LOG(LogGameplayTags, Warning, TEXT("FGameplayTagContainer::NetSerialize received %u tags, only %u are indexed."), NumTags, NumIndexedTags);
+		bOutSuccess = false;
+		return true;
+	}
+
+	RemoveAllTags(NumTags);
+	UpdateTagBits(TagManager);
+
+	bOutSuccess = true;
+	for (uint32 TagIdx = 0; TagIdx < NumTags; ++TagIdx)
+	{
+		uint32 TagIndex = 0;
+		Ar.SerializeInt(TagIndex, NumIndexedTags);
+		if (TagIndex < NumIndexedTags)
+		{
+			AddTagFast(TagManager.GetGameplayTagFromIndex(TagIndex));
+		}
+		else
+		{
+			bOutSuccess = false;
+		}
+	}
+	return true;
+}
+
+bool FGameplayTagContainer::ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText)
+{
+	InvalidateTagBits();
+	return false;
+}
+
 void FGameplayTagContainer::RedirectTags()
 {
 	FConfigSection* PackageRedirects = GConfig->GetSectionPrivate( TEXT("/Script/Engine.Engine"), false, true, GEngineIni );
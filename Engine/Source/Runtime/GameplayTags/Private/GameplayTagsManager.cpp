@@ -11,6 +11,7 @@
 
 UGameplayTagsManager::UGameplayTagsManager(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, TagIndexGeneration(1)
 {
 #if WITH_EDITOR
 	RegisteredObjectReimport = false;
@@ -213,6 +214,11 @@ void UGameplayTagsManager::DestroyGameplayTagTree()
 		GameplayRootTag->ResetNode();
 		GameplayRootTag.Reset();
 	}
+
+	GameplayTagIndexMap.Empty();
+	IndexedGameplayTags.Empty();
+	ParentTagIndices.Empty();
+	++TagIndexGeneration;
 }
 
 int32 UGameplayTagsManager::InsertTagIntoNodeArray(FName Tag, TWeakPtr<FGameplayTagNode> ParentNode, TArray< TSharedPtr<FGameplayTagNode> >& NodeArray, FText CategoryDescription)
@@ -238,6 +244,11 @@ int32 UGameplayTagsManager::InsertTagIntoNodeArray(FName Tag, TWeakPtr<FGameplay
 		FGameplayTag GameplayTag = FGameplayTag(TagNode->GetCompleteTag());
 		GameplayTagMap.Add(TagNode->GetCompleteTag(), GameplayTag);
 		GameplayTagNodeMap.Add(GameplayTag, TagNode);
+
+		// Parents are always inserted before their children, so they already have an index
+		TSharedPtr<FGameplayTagNode> Parent = ParentNode.Pin();
+		ParentTagIndices.Add(Parent.IsValid() ? GameplayTagIndexMap.FindChecked(Parent->GetCompleteTag()) : INDEX_NONE);
+		GameplayTagIndexMap.Add(TagNode->GetCompleteTag(), IndexedGameplayTags.Add(GameplayTag));
 	}
 
 	return InsertionIdx;
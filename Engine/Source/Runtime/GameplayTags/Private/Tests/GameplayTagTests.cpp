@@ -29,6 +29,36 @@ bool GameplayTagTest_SimpleTest()
 	return Tag.GetTagName() == TagName;
 }
 
+bool GameplayTagTest_ContainerTest()
+{
+	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
+	FGameplayTag ParentTag = TagManager.RequestGameplayTag(FName(TEXT("GameplayTagTest")));
+	FGameplayTag Tag1 = TagManager.RequestGameplayTag(FName(TEXT("GameplayTagTest.Test1")));
+	FGameplayTag Tag2 = TagManager.RequestGameplayTag(FName(TEXT("GameplayTagTest.Test2")));
+
+	FGameplayTagContainer Container(Tag1);
+	FGameplayTagContainer BothTags(Tag1);
+	BothTags.AddTag(Tag2);
+
+	bool bSuccess = true;
+	bSuccess &= Container.HasTag(Tag1, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit);
+	bSuccess &= !Container.HasTag(ParentTag, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit);
+	bSuccess &= Container.HasTag(ParentTag, EGameplayTagMatchType::IncludeParentTags, EGameplayTagMatchType::Explicit);
+	bSuccess &= Container.MatchesAny(BothTags, false);
+	bSuccess &= !Container.MatchesAll(BothTags, false);
+	bSuccess &= Container.MatchesAll(FGameplayTagContainer(ParentTag), false);
+
+	Container.AddTag(Tag2);
+	bSuccess &= Container.MatchesAll(BothTags, false);
+	bSuccess &= Container == BothTags;
+
+	Container.RemoveTag(Tag1);
+	bSuccess &= !Container.HasTag(Tag1, EGameplayTagMatchType::IncludeParentTags, EGameplayTagMatchType::Explicit);
+	bSuccess &= Container.HasTag(ParentTag, EGameplayTagMatchType::IncludeParentTags, EGameplayTagMatchType::Explicit);
+	bSuccess &= Container != BothTags;
+	return bSuccess;
+}
+
 bool FGameplayTagTest::RunTest(const FString& Parameters)
 {
 #if WITH_EDITOR
@@ -40,6 +70,7 @@ bool FGameplayTagTest::RunTest(const FString& Parameters)
 	// Run Tests
 	bool bSuccess = true;
 	bSuccess &= GameplayTagTest_SimpleTest();
+	bSuccess &= GameplayTagTest_ContainerTest();
 	// Add more tests here... 
 
 	return bSuccess;
@@ -57,6 +57,24 @@ public:
 			}
 		};
 
+		// Helper class to find all files.
+		class FFileSearchVisitor : public IPlatformFile::FDirectoryVisitor
+		{
+			TArray<FString>& FoundFiles;
+		public:
+			FFileSearchVisitor(TArray<FString>& InFoundFiles)
+				: FoundFiles(InFoundFiles)
+			{}
+			virtual bool Visit(const TCHAR* FilenameOrDirectory, bool bIsDirectory)
+			{
+				if (bIsDirectory == false)
+				{
+					FoundFiles.Add(FilenameOrDirectory);
+				}
+				return true;
+			}
+		};
+
 		check(CurrentMountPaks);
 
 		BPSModule->SaveManifestToFile(ManifestPath, BuildManifest.ToSharedRef());
@@ -69,7 +87,23 @@ public:
 				PlatformFile.DeleteDirectoryRecursively(*DestDir);
 			}
 			PlatformFile.CreateDirectoryTree(*DestDir);
-			if (PlatformFile.CopyDirectoryTree(*DestDir, *SrcDir, true))
+			// Move the installed files rather than copying them, which is only a rename when the content directory is on the same volume.
+			// Files that can't be moved are copied, the installed directory is only deleted once every file made it
+			TArray<FString> InstalledFiles;
+			FFileSearchVisitor InstalledVisitor(InstalledFiles);
+			PlatformFile.IterateDirectoryRecursively(*SrcDir, InstalledVisitor);
+			bool bMovedAll = true;
+			for (const FString& InstalledFile : InstalledFiles)
+			{
+				check(InstalledFile.StartsWith(SrcDir));
+				const FString DestFile = DestDir / InstalledFile.RightChop(SrcDir.Len());
+				PlatformFile.CreateDirectoryTree(*FPaths::GetPath(DestFile));
+				if (!PlatformFile.MoveFile(*DestFile, *InstalledFile) && !PlatformFile.CopyFile(*DestFile, *InstalledFile))
+				{
+					bMovedAll = false;
+				}
+			}
+			if (bMovedAll)
 			{
 				PlatformFile.DeleteDirectoryRecursively(*SrcDir);
 			}
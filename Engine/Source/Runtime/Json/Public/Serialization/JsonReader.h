@@ -42,14 +42,14 @@ public:
 			return false;
 		}
 
-		if (Stream == nullptr)
+		if ((Stream == nullptr) && (Buffer == nullptr))
 		{
 			Notation = EJsonNotation::Error;
 			SetErrorMessage(TEXT("Null Stream"));
 			return true;
 		}
 
-		const bool AtEndOfStream = Stream->AtEnd();
+		const bool AtEndOfStream = IsAtEnd();
 
 		if (AtEndOfStream && !FinishedReadingRootObject)
 		{
@@ -114,7 +114,7 @@ public:
 			return true;
 		}
 
-		if (FinishedReadingRootObject && !Stream->AtEnd())
+		if (FinishedReadingRootObject && !IsAtEnd())
 		{
 			ParseWhiteSpace();
 		}
@@ -174,6 +174,9 @@ protected:
 		: ParseState()
 		, CurrentToken( EJsonToken::None )
 		, Stream( nullptr )
+		, Buffer( nullptr )
+		, BufferNum( 0 )
+		, BufferIndex( 0 )
 		, Identifier()
 		, ErrorMessage()
 		, StringValue()
@@ -193,6 +196,9 @@ protected:
 		: ParseState()
 		, CurrentToken(EJsonToken::None)
 		, Stream(InStream)
+		, Buffer(nullptr)
+		, BufferNum(0)
+		, BufferIndex(0)
 		, Identifier()
 		, ErrorMessage()
 		, StringValue()
@@ -203,8 +209,74 @@ protected:
 		, FinishedReadingRootObject(false)
 	{ }
 
+	/**
+	 * Makes the reader parse the given characters in place, instead of going through an archive for each of them.
+	 * The characters must outlive the reader.
+	 *
+	 * @param InBuffer The characters to parse.
+	 * @param InBufferNum The number of characters.
+	 */
+	void SetBuffer( const CharType* InBuffer, int32 InBufferNum )
+	{
+		Buffer = InBuffer;
+		BufferNum = InBufferNum;
+		BufferIndex = 0;
+	}
+
 private:
 
+	FORCEINLINE bool IsAtEnd() const
+	{
+		return (Buffer != nullptr) ? (BufferIndex >= BufferNum) : Stream->AtEnd();
+	}
+
+	/** Reads the next character, a null character past the end. */
+	FORCEINLINE CharType ReadChar()
+	{
+		if (Buffer != nullptr)
+		{
+			const int32 Index = BufferIndex++;
+			return (Index < BufferNum) ? Buffer[Index] : CharType('\0');
+		}
+
+		CharType Char;
+		Stream->Serialize(&Char, sizeof(CharType));
+		return Char;
+	}
+
+	/** Steps back over the character that was last read. */
+	FORCEINLINE void UnreadChar()
+	{
+		if (Buffer != nullptr)
+		{
+			--BufferIndex;
+		}
+		else
+		{
+			Stream->Seek(Stream->Tell() - sizeof(CharType));
+		}
+	}
+
+	/** Appends characters of the input to a string, decoding them if they are UTF-8. */
+	static void AppendChars( FString& String, const TCHAR* Chars, int32 Num )
+	{
+		String.AppendChars(Chars, Num);
+	}
+
+	static void AppendChars( FString& String, const UTF8CHAR* Chars, int32 Num )
+	{
+		FUTF8ToTCHAR Converted((const ANSICHAR*)Chars, Num);
+		String.AppendChars(Converted.Get(), Converted.Length());
+	}
+
+	static void AppendChars( FString& String, const ANSICHAR* Chars, int32 Num )
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			String += Chars[Index];
+		}
+	}
+
 	void SetErrorMessage( const FString& Message )
 	{
 		ErrorMessage = Message + FString::Printf(TEXT(" Line: %u Ch: %u"), LineNumber, CharacterNumber);
@@ -301,7 +373,7 @@ private:
 				return false;
 			}
 
-			Identifier = StringValue;
+			Identifier = MoveTemp(StringValue);
 			Token = EJsonToken::None;
 
 			if (!NextToken(Token))
@@ -365,10 +437,9 @@ private:
 
 	bool NextToken( EJsonToken& OutToken )
 	{
-		while (!Stream->AtEnd())
+		while (!IsAtEnd())
 		{
-			CharType Char;
-			Stream->Serialize(&Char, sizeof(CharType));
+			CharType Char = ReadChar();
 			++CharacterNumber;
 
 			if (Char == CharType('\0'))
@@ -439,9 +510,9 @@ private:
 						FString Test;
 						Test += Char;
 
-						while (!Stream->AtEnd())
+						while (!IsAtEnd())
 						{
-							Stream->Serialize(&Char, sizeof(CharType));
+							Char = ReadChar();
 
 							if (IsAlphaNumber(Char))
 							{
@@ -451,7 +522,7 @@ private:
 							else
 							{
 								// backtrack and break
-								Stream->Seek(Stream->Tell() - sizeof(CharType));
+								UnreadChar();
 								break;
 							}
 						}
@@ -495,75 +566,98 @@ private:
 	{
 		FString String;
 
+		// Characters read from an archive since the last escape, the input is used in place when it is a buffer
+		TArray<CharType, TInlineAllocator<128>> Run;
+
 		while (true)
 		{
-			if (Stream->AtEnd())
+			// Append everything up to the next quote or escape at once, which also decodes multi-byte UTF-8 characters
+			const int32 RunStart = BufferIndex;
+			CharType Char;
+
+			while (true)
 			{
-				SetErrorMessage( TEXT("String Token Abruptly Ended.") );
-				return false;
+				if (IsAtEnd())
+				{
+					SetErrorMessage( TEXT("String Token Abruptly Ended.") );
+					return false;
+				}
+
+				Char = ReadChar();
+				++CharacterNumber;
+
+				if ((Char == CharType('\"')) || (Char == CharType('\\')))
+				{
+					break;
+				}
+
+				if (Buffer == nullptr)
+				{
+					Run.Add(Char);
+				}
 			}
 
-			CharType Char;
-			Stream->Serialize(&Char, sizeof(CharType));
-			++CharacterNumber;
+			if (Buffer != nullptr)
+			{
+				AppendChars(String, Buffer + RunStart, BufferIndex - 1 - RunStart);
+			}
+			else
+			{
+				AppendChars(String, Run.GetData(), Run.Num());
+				Run.Reset();
+			}
 
 			if (Char == CharType('\"'))
 			{
 				break;
 			}
 
-			if (Char == CharType('\\'))
-			{
-				Stream->Serialize(&Char, sizeof(CharType));
-				++CharacterNumber;
+			// escaped character
+			Char = ReadChar();
+			++CharacterNumber;
 
-				switch (Char)
+			switch (Char)
+			{
+			case CharType('\"'): case CharType('\\'): case CharType('/'): String += Char; break;
+			case CharType('f'): String += CharType('\f'); break;
+			case CharType('r'): String += CharType('\r'); break;
+			case CharType('n'): String += CharType('\n'); break;
+			case CharType('b'): String += CharType('\b'); break;
+			case CharType('t'): String += CharType('\t'); break;
+			case CharType('u'):
+				// 4 hex digits, like \uAB23, which is a 16 bit number that we would usually see as 0xAB23
 				{
-				case CharType('\"'): case CharType('\\'): case CharType('/'): String += Char; break;
-				case CharType('f'): String += CharType('\f'); break;
-				case CharType('r'): String += CharType('\r'); break;
-				case CharType('n'): String += CharType('\n'); break;
-				case CharType('b'): String += CharType('\b'); break;
-				case CharType('t'): String += CharType('\t'); break;
-				case CharType('u'):
-					// 4 hex digits, like \uAB23, which is a 16 bit number that we would usually see as 0xAB23
-					{
-						int32 HexNum = 0;
+					int32 HexNum = 0;
 
-						for (int32 Radix = 3; Radix >= 0; --Radix)
+					for (int32 Radix = 3; Radix >= 0; --Radix)
+					{
+						if (IsAtEnd())
 						{
-							if (Stream->AtEnd())
-							{
-								SetErrorMessage( TEXT("String Token Abruptly Ended.") );
-								return false;
-							}
-
-							Stream->Serialize(&Char, sizeof(CharType));
-							++CharacterNumber;
+							SetErrorMessage( TEXT("String Token Abruptly Ended.") );
+							return false;
+						}
 
-							int32 HexDigit = FParse::HexDigit(Char);
+						Char = ReadChar();
+						++CharacterNumber;
 
-							if ((HexDigit == 0) && (Char != CharType('0')))
-							{
-								SetErrorMessage( TEXT("Invalid Hexadecimal digit parsed.") );
-								return false;
-							}
+						int32 HexDigit = FParse::HexDigit(Char);
 
-							HexNum += HexDigit * FMath::Pow(16, Radix);
+						if ((HexDigit == 0) && (Char != CharType('0')))
+						{
+							SetErrorMessage( TEXT("Invalid Hexadecimal digit parsed.") );
+							return false;
 						}
 
-						String += (CharType)HexNum;
+						HexNum += HexDigit * FMath::Pow(16, Radix);
 					}
-					break;
 
-				default:
-					SetErrorMessage( TEXT("Bad Json escaped char.") );
-					return false;
+					String += (TCHAR)HexNum;
 				}
-			}
-			else
-			{
-				String += Char;
+				break;
+
+			default:
+				SetErrorMessage( TEXT("Bad Json escaped char.") );
+				return false;
 			}
 		}
 
@@ -588,7 +682,7 @@ private:
 			}
 			else
 			{
-				Stream->Serialize(&Char, sizeof(CharType));
+				Char = ReadChar();
 				++CharacterNumber;
 			}
 
@@ -670,7 +764,7 @@ private:
 			else
 			{
 				// backtrack once because we read a non-number character
-				Stream->Seek(Stream->Tell() - sizeof(CharType));
+				UnreadChar();
 				--CharacterNumber;
 				// and now the number is fully tokenized
 				break;
@@ -690,10 +784,9 @@ private:
 
 	void ParseWhiteSpace()
 	{
-		while (!Stream->AtEnd())
+		while (!IsAtEnd())
 		{
-			CharType Char;
-			Stream->Serialize(&Char, sizeof(CharType));
+			CharType Char = ReadChar();
 			++CharacterNumber;
 
 			if (IsLineBreak(Char))
@@ -705,7 +798,7 @@ private:
 			if (!IsWhitespace(Char))
 			{
 				// backtrack and break
-				Stream->Seek(Stream->Tell() - sizeof(CharType));
+				UnreadChar();
 				--CharacterNumber;
 				break;
 			}
@@ -753,6 +846,10 @@ protected:
 	EJsonToken CurrentToken;
 
 	FArchive* Stream;
+	/** Characters parsed in place when set, used instead of the stream. */
+	const CharType* Buffer;
+	int32 BufferNum;
+	int32 BufferIndex;
 	FString Identifier;
 	FString ErrorMessage;
 	FString StringValue;
@@ -776,14 +873,7 @@ public:
 
 public:
 
-	virtual ~FJsonStringReader()
-	{
-		if (Reader != nullptr)
-		{
-			check(Reader->Close());
-			delete Reader;
-		}
-	}
+	virtual ~FJsonStringReader() { }
 
 protected:
 
@@ -794,23 +884,54 @@ protected:
 	 */
 	FJsonStringReader( const FString& JsonString )
 		: Content(JsonString)
-		, Reader(nullptr)
 	{
 		if (Content.IsEmpty())
 		{
 			return;
 		}
 
-		Reader = new FBufferReader((void*)*Content, Content.Len() * sizeof(TCHAR), false);
-		check(Reader);
-
-		Stream = Reader;
+		SetBuffer(*Content, Content.Len());
 	}
 
 protected:
 
 	const FString Content;
-	FBufferReader* Reader;
+};
+
+
+/**
+ * Reads Json from UTF-8 text in memory, such as a response payload, without converting it to TCHAR first.
+ * The text is parsed in place and must outlive the reader.
+ */
+class FJsonUtf8BufferReader
+	: public TJsonReader<UTF8CHAR>
+{
+public:
+
+	static TSharedRef<FJsonUtf8BufferReader> Create( const UTF8CHAR* Data, int32 Num )
+	{
+		return MakeShareable(new FJsonUtf8BufferReader(Data, Num));
+	}
+
+public:
+
+	virtual ~FJsonUtf8BufferReader() { }
+
+protected:
+
+	/**
+	 * Creates and initializes a new instance.
+	 *
+	 * @param Data The UTF-8 text to parse.
+	 * @param Num The number of bytes of text.
+	 */
+	FJsonUtf8BufferReader( const UTF8CHAR* Data, int32 Num )
+	{
+		if (Num > 0)
+		{
+			SetBuffer(Data, Num);
+		}
+	}
 };
 
 
@@ -22,7 +22,7 @@ public:
 			return false;
 		}
 
-		OutArray = State.Array;
+		OutArray = MoveTemp(State.Array);
 
 		return true;
 	}
@@ -171,7 +171,7 @@ private:
 					if (ScopeStack.Num() > 0)
 					{
 						Identifier = CurrentState->Identifier;
-						NewValue = MakeShareable(new FJsonValueArray(CurrentState->Array));
+						NewValue = MakeShareable(new FJsonValueArray(MoveTemp(CurrentState->Array)));
 						CurrentState = ScopeStack.Pop();
 					}
 				}
@@ -216,7 +216,11 @@ private:
 			return false;
 		}
 
-		OutStackState = *CurrentState.Get();
+		// the parsed values are handed over rather than copied
+		OutStackState.Type = CurrentState->Type;
+		OutStackState.Identifier = MoveTemp(CurrentState->Identifier);
+		OutStackState.Array = MoveTemp(CurrentState->Array);
+		OutStackState.Object = CurrentState->Object;
 
 		return true;
 	}
@@ -17,6 +17,8 @@ namespace physx
 }
 #endif // WITH_PHYSX
 
+class FLandscapeHeightfieldCreateTask;
+
 UCLASS(MinimalAPI)
 class ULandscapeHeightfieldCollisionComponent : public UPrimitiveComponent
 {
@@ -122,6 +124,9 @@ class ULandscapeHeightfieldCollisionComponent : public UPrimitiveComponent
 	/** Physics engine version of heightfield data. */
 	TRefCountPtr<struct FPhysXHeightfieldRef>	HeightfieldRef;
 
+	/** Creates the heightfield from CookedCollisionData off the game thread, between PostLoad and CreateCollisionObject */
+	FAsyncTask<FLandscapeHeightfieldCreateTask>*	AsyncHeightfieldTask;
+
 	enum ECollisionQuadFlags
 	{
 		QF_PhysicalMaterialMask = 63,	// Mask value for the physical material index, stored in the lower 6 bits.
@@ -182,6 +187,11 @@ class ULandscapeHeightfieldCollisionComponent : public UPrimitiveComponent
 	/** Creates collision object from a cooked collision data */
 	virtual void CreateCollisionObject();
 
+#if WITH_PHYSX
+	/** Waits for the heightfield started in PostLoad, if any. The caller owns the returned heightfield */
+	physx::PxHeightField* FinishAsyncHeightfieldCreation();
+#endif // WITH_PHYSX
+
 	/** Return the landscape actor associated with this component. */
 	class ALandscape* GetLandscapeActor() const;
 	LANDSCAPE_API class ALandscapeProxy* GetLandscapeProxy() const;
@@ -31,6 +31,47 @@ LandscapeCollision.cpp: Landscape collision
 
 TMap<FGuid, ULandscapeHeightfieldCollisionComponent::FPhysXHeightfieldRef* > GSharedHeightfieldRefs;
 
+static TAutoConsoleVariable<int32> CVarLandscapeAsyncCollisionCreation(
+	TEXT("p.LandscapeAsyncCollisionCreation"),
+	1,
+	TEXT("Whether the PhysX heightfields of cooked landscape collision are created on a worker thread once the component is loaded.\n")
+	TEXT("0: created on the game thread when the component registers\n")
+	TEXT("1: created on a worker thread after load (default)"),
+	ECVF_Default);
+
+/** Creates the PhysX heightfield of a cooked collision component, started by ULandscapeHeightfieldCollisionComponent::PostLoad */
+class FLandscapeHeightfieldCreateTask : public FNonAbandonableTask
+{
+public:
+	FLandscapeHeightfieldCreateTask(const TArray<uint8>& InCookedCollisionData)
+		: CookedCollisionData(InCookedCollisionData)
+#if WITH_PHYSX
+		, Heightfield(nullptr)
+#endif
+	{
+	}
+
+	void DoWork()
+	{
+#if WITH_PHYSX
+		FPhysXInputStream HeightFieldStream(CookedCollisionData.GetData(), CookedCollisionData.Num());
+		Heightfield = GPhysXSDK->createHeightField(HeightFieldStream);
+#endif
+	}
+
+	static const TCHAR* Name()
+	{
+		return TEXT("FLandscapeHeightfieldCreateTask");
+	}
+
+	/** Owned by the component, which doesn't touch it until the task is complete */
+	const TArray<uint8>& CookedCollisionData;
+
+#if WITH_PHYSX
+	physx::PxHeightField* Heightfield;
+#endif
+};
+
 ULandscapeHeightfieldCollisionComponent::FPhysXHeightfieldRef::~FPhysXHeightfieldRef()
 {
 #if WITH_PHYSX
@@ -255,12 +296,30 @@ void ULandscapeHeightfieldCollisionComponent::ApplyWorldOffset(const FVector& In
 	}
 }
 
+#if WITH_PHYSX
+physx::PxHeightField* ULandscapeHeightfieldCollisionComponent::FinishAsyncHeightfieldCreation()
+{
+	physx::PxHeightField* Heightfield = nullptr;
+	if (AsyncHeightfieldTask)
+	{
+		// Usually done by now, the level streams in over several frames before its components register
+		AsyncHeightfieldTask->EnsureCompletion();
+		Heightfield = AsyncHeightfieldTask->GetTask().Heightfield;
+		delete AsyncHeightfieldTask;
+		AsyncHeightfieldTask = nullptr;
+	}
+	return Heightfield;
+}
+#endif //WITH_PHYSX
+
 void ULandscapeHeightfieldCollisionComponent::CreateCollisionObject()
 {
 #if WITH_PHYSX	
 	// If we have not created a heightfield yet - do it now.
 	if (!IsValidRef(HeightfieldRef))
 	{
+		PxHeightField* AsyncHeightfield = FinishAsyncHeightfieldCreation();
+
 		FPhysXHeightfieldRef* ExistingHeightfieldRef = nullptr;
 		bool bCheckDDC = true;
 
@@ -285,6 +344,11 @@ void ULandscapeHeightfieldCollisionComponent::CreateCollisionObject()
 		if (ExistingHeightfieldRef)
 		{
 			HeightfieldRef = ExistingHeightfieldRef;
+
+			if (AsyncHeightfield)
+			{
+				GPhysXPendingKillHeightfield.Add(AsyncHeightfield);
+			}
 		}
 		else
 		{
@@ -298,7 +362,12 @@ void ULandscapeHeightfieldCollisionComponent::CreateCollisionObject()
 			{
 				HeightfieldRef = GSharedHeightfieldRefs.Add(HeightfieldGuid, new FPhysXHeightfieldRef(HeightfieldGuid));
 
-				// Create heightfield shape
+				// Create heightfield shape, unless it was created after load
+				if (AsyncHeightfield)
+				{
+					HeightfieldRef->RBHeightfield = AsyncHeightfield;
+				}
+				else
 				{
 					FPhysXInputStream HeightFieldStream(CookedCollisionData.GetData(), CookedCollisionData.Num());
 					HeightfieldRef->RBHeightfield = GPhysXSDK->createHeightField(HeightFieldStream);
@@ -977,6 +1046,13 @@ FBoxSphereBounds ULandscapeHeightfieldCollisionComponent::CalcBounds(const FTran
 
 void ULandscapeHeightfieldCollisionComponent::BeginDestroy()
 {
+#if WITH_PHYSX
+	if (PxHeightField* AsyncHeightfield = FinishAsyncHeightfieldCreation())
+	{
+		GPhysXPendingKillHeightfield.Add(AsyncHeightfield);
+	}
+#endif// WITH_PHYSX
+
 	HeightfieldRef = NULL;
 	HeightfieldGuid = FGuid();
 	Super::BeginDestroy();
@@ -1305,6 +1381,18 @@ void ULandscapeHeightfieldCollisionComponent::PostLoad()
 		bShouldSaveCookedDataToDDC[1] = true;
 	}
 #endif//WITH_EDITOR
+
+#if WITH_PHYSX
+	// Cooked data is already in memory at this point. Creating the heightfield from it is the expensive part of registering the component,
+	// so start it now and let it run while the rest of the level streams in
+	if (FPlatformProperties::RequiresCookedData() && CVarLandscapeAsyncCollisionCreation.GetValueOnGameThread() != 0 &&
+		!HasAnyFlags(RF_ClassDefaultObject) && !AsyncHeightfieldTask && CookedCollisionData.Num() &&
+		HeightfieldGuid.IsValid() && !GSharedHeightfieldRefs.Contains(HeightfieldGuid))
+	{
+		AsyncHeightfieldTask = new FAsyncTask<FLandscapeHeightfieldCreateTask>(CookedCollisionData);
+		AsyncHeightfieldTask->StartBackgroundTask();
+	}
+#endif// WITH_PHYSX
 }
 
 void ULandscapeHeightfieldCollisionComponent::PreSave()
@@ -1779,4 +1867,5 @@ ULandscapeHeightfieldCollisionComponent::ULandscapeHeightfieldCollisionComponent
 	Mobility = EComponentMobility::Static;
 	bCanEverAffectNavigation = true;
 	bHasCustomNavigableGeometry = EHasCustomNavigableGeometry::Yes;
+	AsyncHeightfieldTask = nullptr;
 }
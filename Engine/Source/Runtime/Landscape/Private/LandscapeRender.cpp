@@ -1377,6 +1377,36 @@ void FLandscapeComponentSceneProxy::CalcLODParamsForSubsection(const class FScen
 	OutNeighborLODs[3] = FMath::Max<float>(OutfLOD, CalcDesiredLOD(View, CameraLocalPos, SubX,     SubY + 1));
 }
 
+void FLandscapeComponentSceneProxy::CalcLODParamsForSubsections(const class FSceneView& View, const FVector2D& CameraLocalPos, int32 BatchLOD, FVector4& OutfLODs, FVector4* OutNeighborLODs) const
+{
+	// The subsections share their inner neighbors, so every desired LOD is only calculated once. Indices are offset by one for the neighbor components
+	float DesiredLODs[LANDSCAPE_MAX_SUBSECTION_NUM + 2][LANDSCAPE_MAX_SUBSECTION_NUM + 2];
+	for (int32 SubY = -1; SubY <= NumSubsections; SubY++)
+	{
+		for (int32 SubX = -1; SubX <= NumSubsections; SubX++)
+		{
+			// Corners are never a neighbor
+			const bool bIsCorner = (SubX < 0 || SubX >= NumSubsections) && (SubY < 0 || SubY >= NumSubsections);
+			DesiredLODs[SubX + 1][SubY + 1] = bIsCorner ? 0.0f : CalcDesiredLOD(View, CameraLocalPos, SubX, SubY);
+		}
+	}
+
+	for (int32 SubY = 0; SubY < NumSubsections; SubY++)
+	{
+		for (int32 SubX = 0; SubX < NumSubsections; SubX++)
+		{
+			int32 SubIndex = SubX + 2 * SubY;
+			float fLOD = FMath::Max<float>(BatchLOD, DesiredLODs[SubX + 1][SubY + 1]);
+			OutfLODs[SubIndex] = fLOD;
+
+			OutNeighborLODs[SubIndex][0] = FMath::Max<float>(fLOD, DesiredLODs[SubX + 1][SubY    ]);
+			OutNeighborLODs[SubIndex][1] = FMath::Max<float>(fLOD, DesiredLODs[SubX    ][SubY + 1]);
+			OutNeighborLODs[SubIndex][2] = FMath::Max<float>(fLOD, DesiredLODs[SubX + 2][SubY + 1]);
+			OutNeighborLODs[SubIndex][3] = FMath::Max<float>(fLOD, DesiredLODs[SubX + 1][SubY + 2]);
+		}
+	}
+}
+
 void FLandscapeComponentSceneProxy::GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const
 {
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_FLandscapeComponentSceneProxy_GetMeshElements);
@@ -2198,14 +2228,7 @@ public:
 
 		if (BatchElementParams->SubX == -1)
 		{
-			for (int32 SubY = 0; SubY < SceneProxy->NumSubsections; SubY++)
-			{
-				for (int32 SubX = 0; SubX < SceneProxy->NumSubsections; SubX++)
-				{
-					int32 SubIndex = SubX + 2 * SubY;
-					SceneProxy->CalcLODParamsForSubsection(View, CameraLocalPos, SubX, SubY, BatchElementParams->CurrentLOD, fCurrentLODs[SubIndex], CurrentNeighborLODs[SubIndex]);
-				}
-			}
+			SceneProxy->CalcLODParamsForSubsections(View, CameraLocalPos, BatchElementParams->CurrentLOD, fCurrentLODs, CurrentNeighborLODs);
 		}
 		else
 		{
@@ -2496,32 +2519,52 @@ void ULandscapeComponent::GetStreamingTextureInfo(TArray<FStreamingTexturePrimit
 		}
 	}
 
+	// The component data textures are reported once per subsection. The streaming manager wants all the mips as soon as the
+	// view is inside an instance bounds, and a single sphere around the whole component is large enough to catch views that
+	// only see its far corner. The texel factor doesn't change, the subsections have the same texel density.
+	TArray<FSphere, TInlineAllocator<4> > SubsectionSpheres;
+	{
+		const FBox Box = Bounds.GetBox();
+		const int32 NumSplits = FMath::Max(NumSubsections, 1);
+		const FVector SubsectionSize((Box.Max.X - Box.Min.X) / NumSplits, (Box.Max.Y - Box.Min.Y) / NumSplits, Box.Max.Z - Box.Min.Z);
+		for (int32 SubY = 0; SubY < NumSplits; SubY++)
+		{
+			for (int32 SubX = 0; SubX < NumSplits; SubX++)
+			{
+				const FVector SubsectionMin = Box.Min + FVector(SubX * SubsectionSize.X, SubY * SubsectionSize.Y, 0);
+				SubsectionSpheres.Add(FBox(SubsectionMin, SubsectionMin + SubsectionSize).GetSphere());
+			}
+		}
+	}
+
+	auto AddSubsectionStreamingTextures = [&](UTexture2D* Texture, float InTexelFactor)
+	{
+		for (int32 SubsectionIndex = 0; SubsectionIndex < SubsectionSpheres.Num(); SubsectionIndex++)
+		{
+			FStreamingTexturePrimitiveInfo& StreamingTexture = *new(OutStreamingTextures)FStreamingTexturePrimitiveInfo;
+			StreamingTexture.Bounds = SubsectionSpheres[SubsectionIndex];
+			StreamingTexture.TexelFactor = InTexelFactor;
+			StreamingTexture.Texture = Texture;
+		}
+	};
+
 	// Weightmap
 	for (int32 TextureIndex = 0; TextureIndex < WeightmapTextures.Num(); TextureIndex++)
 	{
-		FStreamingTexturePrimitiveInfo& StreamingWeightmap = *new(OutStreamingTextures)FStreamingTexturePrimitiveInfo;
-		StreamingWeightmap.Bounds = BoundingSphere;
-		StreamingWeightmap.TexelFactor = TexelFactor;
-		StreamingWeightmap.Texture = WeightmapTextures[TextureIndex];
+		AddSubsectionStreamingTextures(WeightmapTextures[TextureIndex], TexelFactor);
 	}
 
 	// Heightmap
 	if (HeightmapTexture)
 	{
 		float HeightmapTexelFactor = TexelFactor * (HeightmapTexture->GetSizeY() / (ComponentSizeQuads + 1));
-		FStreamingTexturePrimitiveInfo& StreamingHeightmap = *new(OutStreamingTextures)FStreamingTexturePrimitiveInfo;
-		StreamingHeightmap.Bounds = BoundingSphere;
-		StreamingHeightmap.TexelFactor = ForcedLOD >= 0 ? -13 + ForcedLOD : HeightmapTexelFactor; // Minus Value indicate ForcedLOD, 13 for 8k texture
-		StreamingHeightmap.Texture = HeightmapTexture;
+		AddSubsectionStreamingTextures(HeightmapTexture, ForcedLOD >= 0 ? -13 + ForcedLOD : HeightmapTexelFactor); // Minus Value indicate ForcedLOD, 13 for 8k texture
 	}
 
 	// XYOffset
 	if (XYOffsetmapTexture)
 	{
-		FStreamingTexturePrimitiveInfo& StreamingXYOffset = *new(OutStreamingTextures)FStreamingTexturePrimitiveInfo;
-		StreamingXYOffset.Bounds = BoundingSphere;
-		StreamingXYOffset.TexelFactor = TexelFactor;
-		StreamingXYOffset.Texture = XYOffsetmapTexture;
+		AddSubsectionStreamingTextures(XYOffsetmapTexture, TexelFactor);
 	}
 
 #if WITH_EDITOR
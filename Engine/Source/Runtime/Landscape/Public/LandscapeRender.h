@@ -510,6 +510,8 @@ public:
 	float CalcDesiredLOD(const FSceneView& View, const FVector2D& CameraLocalPos, int32 SubX, int32 SubY) const;
 	int32 CalcLODForSubsection(const FSceneView& View, int32 SubX, int32 SubY, const FVector2D& CameraLocalPos) const;
 	void CalcLODParamsForSubsection(const FSceneView& View, const FVector2D& CameraLocalPos, int32 SubX, int32 SubY, int32 BatchLOD, float& OutfLOD, FVector4& OutNeighborLODs) const;
+	/** Same as CalcLODParamsForSubsection for every subsection, for the combined batch element */
+	void CalcLODParamsForSubsections(const FSceneView& View, const FVector2D& CameraLocalPos, int32 BatchLOD, FVector4& OutfLODs, FVector4* OutNeighborLODs) const;
 	uint64 GetStaticBatchElementVisibility(const FSceneView& View, const FMeshBatch* Batch) const;
 
 	// FLandcapeSceneProxy
@@ -46,6 +46,7 @@
 	#include "ContentStreaming.h"
 	#include "HighResScreenshot.h"
 	#include "HotReloadInterface.h"
+	#include "FramePipelineStats.h"
 
 #if !UE_SERVER
 	#include "HeadMountedDisplay.h"
@@ -1383,7 +1384,8 @@ int32 FEngineLoop::PreInit( const TCHAR* CmdLine )
 	if (GUseThreadedRendering)
 	{
 #if PLATFORM_SUPPORTS_RHI_THREAD
-		const bool DefaultUseRHIThread = true;
+		// RHIInit has run, only default to the RHI thread when the RHI can execute there
+		const bool DefaultUseRHIThread = GRHISupportsRHIThread;
 		GUseRHIThread = DefaultUseRHIThread;
 		if (FParse::Param(FCommandLine::Get(),TEXT("rhithread")))
 		{
@@ -2201,6 +2203,10 @@ void FEngineLoop::Tick()
 
 		GEngine->TickFPSChart( FApp::GetDeltaTime() );
 
+#if !UE_BUILD_SHIPPING
+		FFramePipelineStats::Get().Tick( FApp::GetDeltaTime() );
+#endif
+
 		// Update platform memory and memory allocator stats.
 		FPlatformMemory::UpdateStats();
 		GMalloc->UpdateStats();
@@ -2359,6 +2365,7 @@ void FEngineLoop::Tick()
 		{
 			RHICmdList.EndFrame();
 			RHICmdList.PopEvent();
+			FFrameMemStack::Get().EndFrame();
 		});
 	} 
 
@@ -4,23 +4,42 @@
 
 
 /**
- * Implements an asynchronous task for dispatching a message to a recipient.
+ * Implements an asynchronous task for dispatching a batch of messages to their recipients on one thread.
  */
 class FMessageDispatchTask
 {
+public:
+
+	/** Structure for a message to deliver to a recipient. */
+	struct FDelivery
+	{
+		/** Holds the message context. */
+		IMessageContextPtr Context;
+
+		/** Holds a reference to the recipient. */
+		IReceiveMessagesWeakPtr RecipientPtr;
+
+		/** Default constructor. */
+		FDelivery() { }
+
+		/** Creates and initializes a new instance. */
+		FDelivery( const IMessageContextRef& InContext, const IReceiveMessagesWeakPtr& InRecipient )
+			: Context(InContext)
+			, RecipientPtr(InRecipient)
+		{ }
+	};
+
 public:
 
 	/**
 	 * Creates and initializes a new instance.
 	 *
-	 * @param InThread The name of the thread to dispatch the message on.
-	 * @param InContext The context of the message to dispatch.
-	 * @param InRecipient The message recipient.
+	 * @param InThread The name of the thread to dispatch the messages on.
+	 * @param InDeliveries The messages to dispatch, in order.
 	 * @param InTracer The message tracer to notify.
 	 */
-	FMessageDispatchTask( ENamedThreads::Type InThread, IMessageContextRef InContext, IReceiveMessagesWeakPtr InRecipient, FMessageTracerPtr InTracer )
-		: Context(InContext)
-		, RecipientPtr(InRecipient)
+	FMessageDispatchTask( ENamedThreads::Type InThread, TArray<FDelivery>&& InDeliveries, FMessageTracerPtr InTracer )
+		: Deliveries(MoveTemp(InDeliveries))
 		, Thread(InThread)
 		, TracerPtr(InTracer)
 	{ }
@@ -35,22 +54,26 @@ public:
 	 */
 	void DoTask( ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent )
 	{
-		IReceiveMessagesPtr Recipient = RecipientPtr.Pin();
+		FMessageTracerPtr Tracer = TracerPtr.Pin();
 
-		if (Recipient.IsValid())
+		for (int32 DeliveryIndex = 0; DeliveryIndex < Deliveries.Num(); ++DeliveryIndex)
 		{
-			FMessageTracerPtr Tracer = TracerPtr.Pin();
+			const IMessageContextRef Context = Deliveries[DeliveryIndex].Context.ToSharedRef();
+			IReceiveMessagesPtr Recipient = Deliveries[DeliveryIndex].RecipientPtr.Pin();
 
-			if (Tracer.IsValid())
+			if (Recipient.IsValid())
 			{
-				Tracer->TraceDispatchedMessage(Context, Recipient.ToSharedRef(), true);
-			}
-		
-			Recipient->ReceiveMessage(Context);
+				if (Tracer.IsValid())
+				{
+					Tracer->TraceDispatchedMessage(Context, Recipient.ToSharedRef(), true);
+				}
 
-			if (TracerPtr.IsValid())
-			{
-				Tracer->TraceHandledMessage(Context, Recipient.ToSharedRef());
+				Recipient->ReceiveMessage(Context);
+
+				if (Tracer.IsValid())
+				{
+					Tracer->TraceHandledMessage(Context, Recipient.ToSharedRef());
+				}
 			}
 		}
 	}
@@ -84,11 +107,8 @@ public:
 
 private:
 
-	/** Holds the message context. */
-	IMessageContextRef Context;
-
-	/** Holds a reference to the recipient. */
-	IReceiveMessagesWeakPtr RecipientPtr;
+	/** Holds the messages to dispatch. */
+	TArray<FDelivery> Deliveries;
 
 	/** Holds the name of the thread that the router is running on. */
 	ENamedThreads::Type Thread;
@@ -3,13 +3,19 @@
 #include "MessagingPrivatePCH.h"
 
 
+/** Maximum number of messages batched up for named threads before they are dispatched. */
+static const int32 MaxPendingDeliveries = 256;
+
+
 /* FMessageRouter structors
  *****************************************************************************/
 
 FMessageRouter::FMessageRouter()
 	: DelayedMessagesSequence(0)
+	, NumPendingDeliveries(0)
 	, Stopping(false)
 	, Tracer(MakeShareable(new FMessageTracer()))
+	, WorkPending(0)
 {
 	ActiveSubscriptions.FindOrAdd(NAME_All);
 	WorkEvent = FPlatformProcess::CreateSynchEvent(true);
@@ -41,17 +47,20 @@ uint32 FMessageRouter::Run()
 		{
 			CurrentTime = FDateTime::UtcNow();
 
+			// reset before draining, so that commands enqueued during the drain wake the thread up again
+			WorkEvent->Reset();
+			FPlatformAtomics::InterlockedExchange(&WorkPending, 0);
+
 			CommandDelegate Command;
 
 			while (Commands.Dequeue(Command))
 			{
 				Command.Execute();
 			}
-
-			WorkEvent->Reset();
 		}
 
 		ProcessDelayedMessages();
+		FlushPendingDeliveries();
 	}
 
 	return 0;
@@ -155,13 +164,53 @@ void FMessageRouter::DispatchMessage( const IMessageContextRef& Context )
 			}
 			else
 			{
-				TGraphTask<FMessageDispatchTask>::CreateTask().ConstructAndDispatchWhenReady(RecipientThread, Context, Recipient, Tracer);
+				// batch up the messages for named threads, rather than queuing a task per message
+				int32 PendingIndex = 0;
+
+				while ((PendingIndex < PendingDeliveries.Num()) && (PendingDeliveries[PendingIndex].Thread != RecipientThread))
+				{
+					++PendingIndex;
+				}
+
+				if (PendingIndex == PendingDeliveries.Num())
+				{
+					PendingDeliveries.Add(FPendingDeliveries(RecipientThread));
+				}
+
+				PendingDeliveries[PendingIndex].Deliveries.Add(FMessageDispatchTask::FDelivery(Context, Recipient));
+
+				if (++NumPendingDeliveries >= MaxPendingDeliveries)
+				{
+					FlushPendingDeliveries();
+				}
 			}
 		}
 	}
 }
 
 
+void FMessageRouter::FlushPendingDeliveries()
+{
+	if (NumPendingDeliveries == 0)
+	{
+		return;
+	}
+
+	for (int32 PendingIndex = 0; PendingIndex < PendingDeliveries.Num(); ++PendingIndex)
+	{
+		FPendingDeliveries& Pending = PendingDeliveries[PendingIndex];
+
+		if (Pending.Deliveries.Num() > 0)
+		{
+			TGraphTask<FMessageDispatchTask>::CreateTask().ConstructAndDispatchWhenReady(Pending.Thread, MoveTemp(Pending.Deliveries), Tracer);
+			Pending.Deliveries.Reset();
+		}
+	}
+
+	NumPendingDeliveries = 0;
+}
+
+
 void FMessageRouter::FilterSubscriptions( TArray<IMessageSubscriptionPtr>& Subscriptions, const IMessageContextRef& Context, TArray<IReceiveMessagesPtr>& OutRecipients )
 {
 	EMessageScope MessageScope = Context->GetScope();
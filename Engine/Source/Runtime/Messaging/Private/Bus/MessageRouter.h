@@ -144,7 +144,11 @@ protected:
 			return false;
 		}
 
-		WorkEvent->Trigger();
+		// only the first command since the router thread last woke up needs to signal it
+		if (FPlatformAtomics::InterlockedExchange(&WorkPending, 1) == 0)
+		{
+			WorkEvent->Trigger();
+		}
 
 		return true;
 	}
@@ -166,6 +170,9 @@ protected:
 	 */
 	void DispatchMessage( const IMessageContextRef& Message );
 
+	/** Dispatches the messages that were batched up for recipients on named threads, one task per thread. */
+	void FlushPendingDeliveries();
+
 	/** Processes all delayed messages. */
 	void ProcessDelayedMessages();
 
@@ -204,6 +211,22 @@ private:
 		}
 	};
 
+	// Structure for the messages waiting to be dispatched on a named thread.
+	struct FPendingDeliveries
+	{
+		// Holds the name of the thread to dispatch the messages on.
+		ENamedThreads::Type Thread;
+
+		// Holds the messages to dispatch, in the order they were routed.
+		TArray<FMessageDispatchTask::FDelivery> Deliveries;
+
+
+		// Creates and initializes a new instance.
+		FPendingDeliveries( ENamedThreads::Type InThread )
+			: Thread(InThread)
+		{ }
+	};
+
 private:
 
 	/** Handles adding message interceptors. */
@@ -247,6 +270,12 @@ private:
 	/** Holds the collection of delayed messages. */
 	TArray<FDelayedMessage> DelayedMessages;
 
+	/** Holds the messages batched up per recipient thread since the last flush. */
+	TArray<FPendingDeliveries> PendingDeliveries;
+
+	/** Holds the number of batched messages since the last flush. */
+	int32 NumPendingDeliveries;
+
 	/** Holds a sequence number for delayed messages. */
 	int64 DelayedMessagesSequence;
 
@@ -258,4 +287,7 @@ private:
 
 	/** Holds an event signaling that work is available. */
 	FEvent* WorkEvent;
+
+	/** Holds a flag indicating that WorkEvent was triggered and the router thread did not pick up the work yet. */
+	volatile int32 WorkPending;
 };
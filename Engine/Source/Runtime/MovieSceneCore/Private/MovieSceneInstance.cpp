@@ -10,22 +10,11 @@ FMovieSceneInstance::FMovieSceneInstance( UMovieScene& InMovieScene )
 
 void FMovieSceneInstance::Update( float Position, float LastPosition, class IMovieScenePlayer& Player )
 {
-	// Update each type
-	TArray<UObject*> Objects;
-	for( FMovieSceneInstanceMap::TIterator It( MasterTrackInstances ); It; ++It )
+	// Update each type, in the order of the maps the template was compiled from
+	for( int32 EvaluationIndex = 0; EvaluationIndex < EvaluationTemplate.Num(); ++EvaluationIndex )
 	{
-		It.Value()->Update( Position, LastPosition, Objects, Player );
-	}
-
-	TMap<FGuid, FMovieSceneObjectBindingInstance>::TIterator ObjectIt = ObjectBindingInstances.CreateIterator();
-	for(; ObjectIt; ++ObjectIt )
-	{
-		FMovieSceneObjectBindingInstance& ObjectBindingInstance = ObjectIt.Value();
-		
-		for( FMovieSceneInstanceMap::TIterator It = ObjectBindingInstance.TrackInstances.CreateIterator(); It; ++It )
-		{
-			It.Value()->Update( Position, LastPosition, ObjectBindingInstance.RuntimeObjects, Player );
-		}
+		const FTrackInstanceEvaluation& Evaluation = EvaluationTemplate[EvaluationIndex];
+		Evaluation.TrackInstance->Update( Position, LastPosition, *Evaluation.RuntimeObjects, Player );
 	}
 }
 
@@ -70,6 +59,34 @@ void FMovieSceneInstance::RefreshInstance( IMovieScenePlayer& Player )
 			It.RemoveCurrent();
 		}
 	}
+
+	CompileEvaluationTemplate();
+}
+
+void FMovieSceneInstance::CompileEvaluationTemplate()
+{
+	EvaluationTemplate.Reset();
+
+	for( FMovieSceneInstanceMap::TConstIterator It( MasterTrackInstances ); It; ++It )
+	{
+		FTrackInstanceEvaluation Evaluation;
+		Evaluation.TrackInstance = It.Value().Get();
+		Evaluation.RuntimeObjects = &NoRuntimeObjects;
+		EvaluationTemplate.Add( Evaluation );
+	}
+
+	for( TMap<FGuid, FMovieSceneObjectBindingInstance>::TConstIterator ObjectIt( ObjectBindingInstances ); ObjectIt; ++ObjectIt )
+	{
+		const FMovieSceneObjectBindingInstance& ObjectBindingInstance = ObjectIt.Value();
+
+		for( FMovieSceneInstanceMap::TConstIterator It( ObjectBindingInstance.TrackInstances ); It; ++It )
+		{
+			FTrackInstanceEvaluation Evaluation;
+			Evaluation.TrackInstance = It.Value().Get();
+			Evaluation.RuntimeObjects = &ObjectBindingInstance.RuntimeObjects;
+			EvaluationTemplate.Add( Evaluation );
+		}
+	}
 }
 
 
@@ -38,6 +38,33 @@ public:
 	 */
 	void CallFunction( UObject* InRuntimeObject, void* FunctionParams );
 
+	/**
+	 * Calls the setter function for a specific runtime object, unless the bound property already has the value.
+	 * Saves a function call for the keys that hold a value, as the setter is called every frame otherwise.
+	 * ValueType must be the type of the property and the only parameter of its setter, so not usable with bitfield bools.
+	 *
+	 * @param InRuntimeObject	The runtime object whose function to call
+	 * @param Value				The value to pass to the function
+	 */
+	template <typename ValueType>
+	void CallFunctionIfChanged( UObject* InRuntimeObject, ValueType& Value )
+	{
+		const FPropertyAndFunction* PropAndFunction = RuntimeObjectToFunctionMap.Find(InRuntimeObject);
+		if(PropAndFunction && PropAndFunction->Function)
+		{
+			if(PropAndFunction->PropertyAddress.Address)
+			{
+				const ValueType* CurrentValue = PropAndFunction->PropertyAddress.Property->ContainerPtrToValuePtr<ValueType>(PropAndFunction->PropertyAddress.Address);
+				if(CurrentValue && *CurrentValue == Value)
+				{
+					return;
+				}
+			}
+
+			InRuntimeObject->ProcessEvent(PropAndFunction->Function, &Value);
+		}
+	}
+
 	/**
 	 * Rebuilds the property and function mappings for a set of runtime objects
 	 *
@@ -28,6 +28,9 @@ public:
 	UMovieScene* GetMovieScene() { return MovieScene.Get(); }
 private:
 	void RefreshInstanceMap( const TArray<UMovieSceneTrack*>& Tracks, const TArray<UObject*>& RuntimeObjects, FMovieSceneInstanceMap& TrackInstances, class IMovieScenePlayer& Player );
+
+	/** Rebuilds EvaluationTemplate from the track and object binding instances */
+	void CompileEvaluationTemplate();
 private:
 	/** A paring of a runtime object guid to a runtime data and track instances animating the runtime objects */
 	struct FMovieSceneObjectBindingInstance
@@ -46,6 +49,21 @@ private:
 	FMovieSceneInstanceMap MasterTrackInstances;
 	/** All object binding instances */
 	TMap<FGuid, FMovieSceneObjectBindingInstance> ObjectBindingInstances;
+
+	/** A track instance to update, with the runtime objects it animates */
+	struct FTrackInstanceEvaluation
+	{
+		class IMovieSceneTrackInstance* TrackInstance;
+		const TArray<UObject*>* RuntimeObjects;
+	};
+
+	/**
+	 * Flat list of the track instances to update, master tracks first, built when the instance is refreshed so that updates
+	 * don't walk the maps. Points into the maps above, which are only modified by RefreshInstance.
+	 */
+	TArray<FTrackInstanceEvaluation> EvaluationTemplate;
+	/** Runtime objects of the master tracks, which don't animate any */
+	TArray<UObject*> NoRuntimeObjects;
 };
 
 
@@ -24,7 +24,7 @@ void FMovieSceneColorTrackInstance::Update( float Position, float LastPosition,
 			if(ColorTrack->Eval(Position, LastPosition, LinearColor))
 			{
 				FSlateColor NewColor(LinearColor);
-				PropertyBindings->CallFunction(Object, &NewColor);
+				PropertyBindings->CallFunctionIfChanged(Object, NewColor);
 			}
 		}
 		else
@@ -32,7 +32,7 @@ void FMovieSceneColorTrackInstance::Update( float Position, float LastPosition,
 			FLinearColor ColorValue = PropertyBindings->GetCurrentValue<FLinearColor>(Object);
 			if(ColorTrack->Eval(Position, LastPosition, ColorValue))
 			{
-				PropertyBindings->CallFunction(Object, &ColorValue);
+				PropertyBindings->CallFunctionIfChanged(Object, ColorValue);
 			}
 		}
 	}
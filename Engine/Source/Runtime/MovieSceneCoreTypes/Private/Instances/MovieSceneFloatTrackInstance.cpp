@@ -18,7 +18,7 @@ void FMovieSceneFloatTrackInstance::Update( float Position, float LastPosition,
 	{
 		for(UObject* Object : RuntimeObjects)
 		{
-			PropertyBindings->CallFunction( Object, &FloatValue );
+			PropertyBindings->CallFunctionIfChanged( Object, FloatValue );
 		}
 	}
 }
@@ -23,7 +23,7 @@ void FMovieSceneVectorTrackInstance::Update( float Position, float LastPosition,
 				FVector2D Value(Vector.X, Vector.Y);
 				for(UObject* Object : RuntimeObjects)
 				{
-					PropertyBindings->CallFunction(Object, &Value);
+					PropertyBindings->CallFunctionIfChanged(Object, Value);
 				}
 				break;
 			}
@@ -32,7 +32,7 @@ void FMovieSceneVectorTrackInstance::Update( float Position, float LastPosition,
 				FVector Value(Vector.X, Vector.Y, Vector.Z);
 				for(UObject* Object : RuntimeObjects)
 				{
-					PropertyBindings->CallFunction(Object, &Value);
+					PropertyBindings->CallFunctionIfChanged(Object, Value);
 				}
 				break;
 			}
@@ -40,7 +40,7 @@ void FMovieSceneVectorTrackInstance::Update( float Position, float LastPosition,
 			{
 				for(UObject* Object : RuntimeObjects)
 				{
-					PropertyBindings->CallFunction(Object, &Vector);
+					PropertyBindings->CallFunctionIfChanged(Object, Vector);
 				}
 				break;
 			}
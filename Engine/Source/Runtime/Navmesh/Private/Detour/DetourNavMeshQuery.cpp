@@ -1241,6 +1241,97 @@ dtStatus dtNavMeshQuery::findPath(dtPolyRef startRef, dtPolyRef endRef,
 								  const float* startPos, const float* endPos,
 								  const dtQueryFilter* filter,
 								  dtQueryResult& result, float* totalCost) const
+{
+	return findPathInClusters(startRef, endRef, startPos, endPos, filter, 0, 0, result, totalCost);
+}
+
+//@UE4 BEGIN
+static const int MAX_CLUSTER_CORRIDOR = 256;
+
+dtStatus dtNavMeshQuery::findPathHierarchical(dtPolyRef startRef, dtPolyRef endRef,
+											  const float* startPos, const float* endPos,
+											  const dtQueryFilter* filter,
+											  dtQueryResult& result, float* totalCost) const
+{
+	dtClusterRef corridor[MAX_CLUSTER_CORRIDOR];
+	int ncorridor = 0;
+
+	dtStatus status = DT_FAILURE;
+	if (startRef && endRef && m_nav->isValidPolyRef(startRef) && m_nav->isValidPolyRef(endRef))
+	{
+		status = findClusterPath(startRef, endRef, corridor, &ncorridor, MAX_CLUSTER_CORRIDOR);
+	}
+
+	// Cluster path must reach the end in full, otherwise it's not known where to refine it
+	if (dtStatusSucceed(status) && !dtStatusDetail(status, DT_PARTIAL_RESULT | DT_BUFFER_TOO_SMALL))
+	{
+		// Sort for lookups in isPolyInClusters
+		for (int i = 1; i < ncorridor; ++i)
+		{
+			const dtClusterRef ref = corridor[i];
+			int j = i - 1;
+			for (; j >= 0 && corridor[j] > ref; --j)
+			{
+				corridor[j + 1] = corridor[j];
+			}
+			corridor[j + 1] = ref;
+		}
+
+		const int clusterQueryNodes = m_queryNodes;
+		status = findPathInClusters(startRef, endRef, startPos, endPos, filter, corridor, ncorridor, result, totalCost);
+		m_queryNodes += clusterQueryNodes;
+
+		if (dtStatusSucceed(status) && !dtStatusDetail(status, DT_PARTIAL_RESULT))
+		{
+			return status;
+		}
+
+		result.reset();
+	}
+
+	// Filter excluded the corridor, or there is no cluster graph
+	return findPathInClusters(startRef, endRef, startPos, endPos, filter, 0, 0, result, totalCost);
+}
+
+bool dtNavMeshQuery::isPolyInClusters(const dtMeshTile* tile, dtPolyRef ref, const dtClusterRef* allowedClusters, const int nallowedClusters) const
+{
+	const unsigned int polyIdx = m_nav->decodePolyIdPoly(ref);
+	if (tile->polyClusters == 0 || polyIdx >= (unsigned int)tile->header->offMeshBase)
+	{
+		return true;
+	}
+
+	const dtClusterRef clusterRef = m_nav->getClusterRefBase(tile) | (dtClusterRef)tile->polyClusters[polyIdx];
+
+	int lo = 0;
+	int hi = nallowedClusters - 1;
+	while (lo <= hi)
+	{
+		const int mid = (lo + hi) / 2;
+		if (allowedClusters[mid] == clusterRef)
+		{
+			return true;
+		}
+
+		if (allowedClusters[mid] < clusterRef)
+		{
+			lo = mid + 1;
+		}
+		else
+		{
+			hi = mid - 1;
+		}
+	}
+
+	return false;
+}
+//@UE4 END
+
+dtStatus dtNavMeshQuery::findPathInClusters(dtPolyRef startRef, dtPolyRef endRef,
+											const float* startPos, const float* endPos,
+											const dtQueryFilter* filter,
+											const dtClusterRef* allowedClusters, const int nallowedClusters,
+											dtQueryResult& result, float* totalCost) const
 {
 	dtAssert(m_nav);
 	dtAssert(m_nodePool);
@@ -1342,6 +1433,11 @@ dtStatus dtNavMeshQuery::findPath(dtPolyRef startRef, dtPolyRef endRef,
 			if (!filter->passFilter(neighbourRef, neighbourTile, neighbourPoly) || !passLinkFilterByRef(neighbourTile, neighbourRef))
 				continue;
 
+//@UE4 BEGIN
+			if (allowedClusters && !isPolyInClusters(neighbourTile, neighbourRef, allowedClusters, nallowedClusters))
+				continue;
+//@UE4 END
+
 			dtNode* neighbourNode = m_nodePool->getNode(neighbourRef);
 			if (!neighbourNode)
 			{
@@ -1471,6 +1567,175 @@ dtStatus dtNavMeshQuery::findPath(dtPolyRef startRef, dtPolyRef endRef,
 	return status;
 }
 
+//@UE4 BEGIN
+dtStatus dtNavMeshQuery::findClusterPath(dtPolyRef startRef, dtPolyRef endRef,
+										 dtClusterRef* path, int* pathCount, const int maxPath) const
+{
+	dtAssert(m_nav);
+	dtAssert(m_nodePool);
+	dtAssert(m_openList);
+
+	*pathCount = 0;
+	m_queryNodes = 0;
+
+	const dtMeshTile* startTile = m_nav->getTileByRef(startRef);
+	const dtMeshTile* endTile = m_nav->getTileByRef(endRef);
+	const unsigned int startPolyIdx = m_nav->decodePolyIdPoly(startRef);
+	const unsigned int endPolyIdx = m_nav->decodePolyIdPoly(endRef);
+
+	if (startTile == 0 || endTile == 0 || !path || maxPath <= 0 ||
+		startTile->polyClusters == 0 || endTile->polyClusters == 0 ||
+		startPolyIdx >= (unsigned int)startTile->header->offMeshBase ||
+		endPolyIdx >= (unsigned int)endTile->header->offMeshBase)
+	{
+		// this means most probably the hierarchical graph has not been build at all
+		return DT_FAILURE | DT_INVALID_PARAM;
+	}
+
+	const unsigned int startIdx = startTile->polyClusters[startPolyIdx];
+	const unsigned int endIdx = endTile->polyClusters[endPolyIdx];
+	const dtCluster& startCluster = startTile->clusters[startIdx];
+	const dtCluster& endCluster = endTile->clusters[endIdx];
+
+	const dtClusterRef startCRef = m_nav->getClusterRefBase(startTile) | (dtClusterRef)startIdx;
+	const dtClusterRef endCRef = m_nav->getClusterRefBase(endTile) | (dtClusterRef)endIdx;
+	if (startCRef == endCRef)
+	{
+		path[0] = startCRef;
+		*pathCount = 1;
+		return DT_SUCCESS;
+	}
+
+	m_nodePool->clear();
+	m_openList->clear();
+
+	dtNode* startNode = m_nodePool->getNode(startCRef);
+	dtVcopy(startNode->pos, startCluster.center);
+	startNode->pidx = 0;
+	startNode->cost = 0;
+	startNode->total = dtVdist(startCluster.center, endCluster.center) * H_SCALE;
+	startNode->id = startCRef;
+	startNode->flags = DT_NODE_OPEN;
+	m_openList->push(startNode);
+	m_queryNodes++;
+
+	dtNode* lastBestNode = startNode;
+	float lastBestNodeCost = startNode->total;
+
+	dtStatus status = DT_SUCCESS;
+	while (!m_openList->empty())
+	{
+		dtNode* bestNode = m_openList->pop();
+		bestNode->flags &= ~DT_NODE_OPEN;
+		bestNode->flags |= DT_NODE_CLOSED;
+
+		if (bestNode->id == endCRef)
+		{
+			lastBestNode = bestNode;
+			break;
+		}
+
+		const dtClusterRef bestRef = bestNode->id;
+		const dtMeshTile* bestTile = m_nav->getTileByRef(bestRef);
+		const dtCluster* bestCluster = &bestTile->clusters[m_nav->decodeClusterIdCluster(bestRef)];
+		const dtClusterRef parentRef = (bestNode->pidx) ? m_nodePool->getNodeAtIdx(bestNode->pidx)->id : 0;
+
+		unsigned int i = bestCluster->firstLink;
+		while (i != DT_NULL_LINK)
+		{
+			const dtClusterLink& link = m_nav->getClusterLink(bestTile, i);
+			i = link.next;
+
+			const dtClusterRef& neighbourRef = link.ref;
+			if (!neighbourRef || neighbourRef == parentRef || (link.flags & DT_CLINK_VALID_FWD) == 0)
+				continue;
+
+			const dtMeshTile* neighbourTile = m_nav->getTileByRef(neighbourRef);
+			const dtCluster* neighbourCluster = &neighbourTile->clusters[m_nav->decodeClusterIdCluster(neighbourRef)];
+
+			dtNode* neighbourNode = m_nodePool->getNode(neighbourRef);
+			if (!neighbourNode)
+			{
+				status |= DT_OUT_OF_NODES;
+				continue;
+			}
+
+			if (neighbourNode->flags == 0)
+			{
+				dtVcopy(neighbourNode->pos, neighbourCluster->center);
+			}
+
+			// Distance between cluster centers, close enough to the cost of crossing them at this level
+			const float cost = bestNode->cost + dtVdist(bestNode->pos, neighbourNode->pos);
+			const float heuristic = (neighbourRef != endCRef) ? dtVdist(neighbourNode->pos, endCluster.center)*H_SCALE : 0.0f;
+			const float total = cost + heuristic;
+
+			if ((neighbourNode->flags & DT_NODE_OPEN) && total >= neighbourNode->total)
+				continue;
+			if ((neighbourNode->flags & DT_NODE_CLOSED) && total >= neighbourNode->total)
+				continue;
+
+			neighbourNode->pidx = m_nodePool->getNodeIdx(bestNode);
+			neighbourNode->id = neighbourRef;
+			neighbourNode->flags = (neighbourNode->flags & ~DT_NODE_CLOSED);
+			neighbourNode->cost = cost;
+			neighbourNode->total = total;
+
+			if (neighbourNode->flags & DT_NODE_OPEN)
+			{
+				m_openList->modify(neighbourNode);
+			}
+			else
+			{
+				neighbourNode->flags |= DT_NODE_OPEN;
+				m_openList->push(neighbourNode);
+				m_queryNodes++;
+			}
+
+			if (heuristic < lastBestNodeCost)
+			{
+				lastBestNodeCost = heuristic;
+				lastBestNode = neighbourNode;
+			}
+		}
+	}
+
+	if (lastBestNode->id != endCRef)
+		status |= DT_PARTIAL_RESULT;
+
+	// Reverse the path.
+	dtNode* prev = 0;
+	dtNode* node = lastBestNode;
+	do
+	{
+		dtNode* next = m_nodePool->getNodeAtIdx(node->pidx);
+		node->pidx = m_nodePool->getNodeIdx(prev);
+		prev = node;
+		node = next;
+	}
+	while (node);
+
+	// Store path
+	int n = 0;
+	node = prev;
+	do
+	{
+		path[n++] = node->id;
+		node = m_nodePool->getNodeAtIdx(node->pidx);
+		if (node && n >= maxPath)
+		{
+			status |= DT_BUFFER_TOO_SMALL;
+			break;
+		}
+	}
+	while (node);
+
+	*pathCount = n;
+
+	return status;
+}
+//@UE4 END
+
 dtStatus dtNavMeshQuery::testClusterPath(dtPolyRef startRef, dtPolyRef endRef) const
 {
 	const dtMeshTile* startTile = m_nav->getTileByRef(startRef);
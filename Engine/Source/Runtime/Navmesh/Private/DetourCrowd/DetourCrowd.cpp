@@ -344,7 +344,8 @@ dtCrowd::dtCrowd() :
 	m_agents(0),
 	m_activeAgents(0),
 	m_agentAnims(0),
-	m_obstacleQuery(0),
+	m_obstacleQueries(0),
+	m_numObstacleQueries(0),
 	m_grid(0),
 	m_pathResult(0),
 	m_maxPathResult(0),
@@ -384,8 +385,11 @@ void dtCrowd::purge()
 	dtFreeProximityGrid(m_grid);
 	m_grid = 0;
 
-	dtFreeObstacleAvoidanceQuery(m_obstacleQuery);
-	m_obstacleQuery = 0;
+	for (int i = 0; i < m_numObstacleQueries; ++i)
+		dtFreeObstacleAvoidanceQuery(m_obstacleQueries[i]);
+	dtFree(m_obstacleQueries);
+	m_obstacleQueries = 0;
+	m_numObstacleQueries = 0;
 	
 	dtFreeNavMeshQuery(m_navquery);
 	m_navquery = 0;
@@ -461,13 +465,23 @@ bool dtCrowd::init(const int maxAgents, const float maxAgentRadius, dtNavMesh* n
 	return true;
 }
 
-bool dtCrowd::initAvoidance(const int maxNeighbors, const int maxWalls, const int maxCustomPatterns)
+bool dtCrowd::initAvoidance(const int maxNeighbors, const int maxWalls, const int maxCustomPatterns, const int numWorkers)
 {
-	m_obstacleQuery = dtAllocObstacleAvoidanceQuery();
-	if (!m_obstacleQuery)
-		return false;
-	if (!m_obstacleQuery->init(maxNeighbors, maxWalls, maxCustomPatterns))
+	const int numQueries = dtMax(numWorkers, 1);
+	m_obstacleQueries = (dtObstacleAvoidanceQuery**)dtAlloc(sizeof(dtObstacleAvoidanceQuery*)*numQueries, DT_ALLOC_PERM);
+	if (!m_obstacleQueries)
 		return false;
+	memset(m_obstacleQueries, 0, sizeof(dtObstacleAvoidanceQuery*)*numQueries);
+	m_numObstacleQueries = numQueries;
+
+	for (int i = 0; i < numQueries; ++i)
+	{
+		m_obstacleQueries[i] = dtAllocObstacleAvoidanceQuery();
+		if (!m_obstacleQueries[i])
+			return false;
+		if (!m_obstacleQueries[i]->init(maxNeighbors, maxWalls, maxCustomPatterns))
+			return false;
+	}
 
 	// Init obstacle query params.
 	memset(m_obstacleQueryParams, 0, sizeof(m_obstacleQueryParams));
@@ -504,12 +518,13 @@ const dtObstacleAvoidanceParams* dtCrowd::getObstacleAvoidanceParams(const int i
 
 void dtCrowd::setObstacleAvoidancePattern(int idx, const float* angles, const float* radii, int nsamples)
 {
-	m_obstacleQuery->setCustomSamplingPattern(idx, angles, radii, nsamples);
+	for (int i = 0; i < m_numObstacleQueries; ++i)
+		m_obstacleQueries[i]->setCustomSamplingPattern(idx, angles, radii, nsamples);
 }
 
 bool dtCrowd::getObstacleAvoidancePattern(int idx, float* angles, float* radii, int* nsamples)
 {
-	return m_obstacleQuery->getCustomSamplingPattern(idx, angles, radii, nsamples);
+	return m_obstacleQueries[0]->getCustomSamplingPattern(idx, angles, radii, nsamples);
 }
 
 const int dtCrowd::getAgentCount() const
@@ -1429,9 +1444,14 @@ void dtCrowd::updateStepNextMovePoint(const float dt, dtCrowdAgentDebugInfo* deb
 }
 
 void dtCrowd::updateStepSteering(const float dt, dtCrowdAgentDebugInfo*)
+{
+	updateStepSteeringRange(dt, 0, m_numActiveAgents);
+}
+
+void dtCrowd::updateStepSteeringRange(const float dt, const int agentBegin, const int agentEnd)
 {
 	// Calculate steering.
-	for (int i = 0; i < m_numActiveAgents; ++i)
+	for (int i = agentBegin; i < agentEnd; ++i)
 	{
 		dtCrowdAgent* ag = m_activeAgents[i];
 
@@ -1516,12 +1536,18 @@ void dtCrowd::updateStepSteering(const float dt, dtCrowdAgentDebugInfo*)
 }
 
 void dtCrowd::updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug)
+{
+	m_velocitySampleCount = updateStepAvoidanceRange(dt, 0, m_numActiveAgents, 0, debug);
+}
+
+int dtCrowd::updateStepAvoidanceRange(const float dt, const int agentBegin, const int agentEnd, const int workerIdx, dtCrowdAgentDebugInfo* debug)
 {
 	const int debugIdx = debug ? debug->idx : -1;
-	m_velocitySampleCount = 0;
+	dtObstacleAvoidanceQuery* obstacleQuery = m_obstacleQueries[workerIdx];
+	int velocitySampleCount = 0;
 
 	// Velocity planning.	
-	for (int i = 0; i < m_numActiveAgents; ++i)
+	for (int i = agentBegin; i < agentEnd; ++i)
 	{
 		dtCrowdAgent* ag = m_activeAgents[i];
 
@@ -1530,13 +1556,13 @@ void dtCrowd::updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug)
 
 		if (ag->params.updateFlags & DT_CROWD_OBSTACLE_AVOIDANCE)
 		{
-			m_obstacleQuery->reset();
+			obstacleQuery->reset();
 
 			// Add neighbours as obstacles.
 			for (int j = 0; j < ag->nneis; ++j)
 			{
 				const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
-				m_obstacleQuery->addCircle(nei->npos, nei->params.radius, nei->vel, nei->dvel);
+				obstacleQuery->addCircle(nei->npos, nei->params.radius, nei->vel, nei->dvel);
 			}
 
 			// Append neighbour segments as obstacles.
@@ -1545,7 +1571,7 @@ void dtCrowd::updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug)
 				const float* s = ag->boundary.getSegment(j);
 				if (dtTriArea2D(ag->npos, s, s + 3) < 0.0f)
 					continue;
-				m_obstacleQuery->addSegment(s, s + 3);
+				obstacleQuery->addSegment(s, s + 3);
 			}
 
 			dtObstacleAvoidanceDebugData* vod = 0;
@@ -1555,11 +1581,11 @@ void dtCrowd::updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug)
 
 			// Sample new safe velocity.
 			const dtObstacleAvoidanceParams* params = &m_obstacleQueryParams[ag->params.obstacleAvoidanceType];
-			const int ns = m_obstacleQuery->sampleVelocity(
+			const int ns = obstacleQuery->sampleVelocity(
 					ag->npos, ag->params.radius, ag->desiredSpeed,
 					ag->vel, ag->dvel, ag->nvel, params, vod);
 
-			m_velocitySampleCount += ns;
+			velocitySampleCount += ns;
 		}
 		else
 		{
@@ -1567,6 +1593,8 @@ void dtCrowd::updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug)
 			dtVcopy(ag->nvel, ag->dvel);
 		}
 	}
+
+	return velocitySampleCount;
 }
 
 void dtCrowd::updateStepMove(const float dt, dtCrowdAgentDebugInfo*)
@@ -278,6 +278,7 @@ struct dtQueryResultPack
 struct NAVMESH_API dtQueryResult
 {
 	inline void reserve(int n) { data.resize(n); data.resize(0); }
+	inline void reset() { data.resize(0); }
 	inline int size() const { return data.size(); }
 
 	inline dtPolyRef getRef(int idx) const { return data[idx].ref; }
@@ -346,6 +347,26 @@ public:
 	///  @param[in]		endRef				The reference id of the end polygon.
 	dtStatus testClusterPath(dtPolyRef startRef, dtPolyRef endRef) const; 
 
+	//@UE4 BEGIN
+	/// Finds a path from the start polygon's cluster to the end polygon's cluster using cluster graph
+	/// (does not use query filter, cost is distance between cluster centers)
+	///  @param[in]		startRef	The reference id of the start polygon.
+	///  @param[in]		endRef		The reference id of the end polygon.
+	///  @param[out]	path		Clusters from start to end. [(clusterRef) * @p pathCount]
+	///  @param[out]	pathCount	The number of clusters returned.
+	///  @param[in]		maxPath		The maximum number of clusters the path array can hold. [Limit: >= 1]
+	dtStatus findClusterPath(dtPolyRef startRef, dtPolyRef endRef,
+							 dtClusterRef* path, int* pathCount, const int maxPath) const;
+
+	/// Same as findPath, but searches only polygons of clusters on the path found by findClusterPath.
+	/// Long paths visit a fraction of the nodes findPath does, at the cost of path being optimal only within the cluster corridor.
+	/// Falls back to findPath when there is no cluster graph, or no path passing the filter within the corridor.
+	dtStatus findPathHierarchical(dtPolyRef startRef, dtPolyRef endRef,
+								  const float* startPos, const float* endPos,
+								  const dtQueryFilter* filter,
+								  dtQueryResult& result, float* totalCost) const;
+	//@UE4 END
+
 	/// Finds the straight path from the start to the end position within the polygon corridor.
 	///  @param[in]		startPos			Path start position. [(x, y, z)]
 	///  @param[in]		endPos				Path end position. [(x, y, z)]
@@ -669,6 +690,18 @@ public:
 	/// @}
 	
 private:
+
+	//@UE4 BEGIN
+	/// findPath, limited to polygons of clusters in sorted allowedClusters array if there is one
+	dtStatus findPathInClusters(dtPolyRef startRef, dtPolyRef endRef,
+								const float* startPos, const float* endPos,
+								const dtQueryFilter* filter,
+								const dtClusterRef* allowedClusters, const int nallowedClusters,
+								dtQueryResult& result, float* totalCost) const;
+
+	/// Returns true if polygon belongs to one of clusters in sorted allowedClusters array. Polygons without cluster (off-mesh links) always pass.
+	bool isPolyInClusters(const dtMeshTile* tile, dtPolyRef ref, const dtClusterRef* allowedClusters, const int nallowedClusters) const;
+	//@UE4 END
 	
 	/// Returns neighbour tile based on side.
 	dtMeshTile* getNeighbourTileAt(int x, int y, int side) const;
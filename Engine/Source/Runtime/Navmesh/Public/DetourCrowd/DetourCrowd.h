@@ -223,7 +223,8 @@ class NAVMESH_API dtCrowd
 	dtPathQueue m_pathq;
 
 	dtObstacleAvoidanceParams m_obstacleQueryParams[DT_CROWD_MAX_OBSTAVOIDANCE_PARAMS];
-	dtObstacleAvoidanceQuery* m_obstacleQuery;
+	dtObstacleAvoidanceQuery** m_obstacleQueries;	///< [UE4] one per avoidance worker, see initAvoidance
+	int m_numObstacleQueries;
 	
 	dtProximityGrid* m_grid;
 	
@@ -273,8 +274,12 @@ public:
 	///  @param[in]		maxNeighbors		The maximum number of processed neighbors
 	///  @param[in]		maxWalls			The maximum number of processed wall segments
 	///  @param[in]		maxCustomPatterns	The maximum number of custom sampling patterns
+	///  @param[in]		numWorkers			The number of avoidance queries, for running updateStepAvoidanceRange on that many threads at once
 	/// @return True if the initialization succeeded.
-	bool initAvoidance(const int maxNeighbors, const int maxWalls, const int maxCustomPatterns);
+	bool initAvoidance(const int maxNeighbors, const int maxWalls, const int maxCustomPatterns, const int numWorkers = 1);
+
+	/// [UE4] Gets the number of avoidance workers set up by initAvoidance
+	inline int getAvoidanceWorkerCount() const { return m_numObstacleQueries; }
 	
 	/// Sets the shared avoidance configuration for the specified index.
 	///  @param[in]		idx		The index. [Limits: 0 <= value < #DT_CROWD_MAX_OBSTAVOIDANCE_PARAMS]
@@ -403,11 +408,28 @@ public:
 	/// @param[in]		nagents	Number of active agents
 	void updateStepSteering(const float dt, dtCrowdAgentDebugInfo* debug);
 
+	/// [UE4] Steering of active agents in range [agentBegin, agentEnd)
+	/// Depends only on neighbour data gathered by updateStepProximityData, different ranges can be updated in parallel.
+	/// @param[in]		dt			Delta time in seconds
+	/// @param[in]		agentBegin	First active agent
+	/// @param[in]		agentEnd	One past the last active agent
+	void updateStepSteeringRange(const float dt, const int agentBegin, const int agentEnd);
+
 	/// [UE4] Split update into several smaller components: avoidance
 	/// @param[in]		dt		Delta time in seconds
 	/// @param[in]		nagents	Number of active agents
 	void updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug);
 
+	/// [UE4] Avoidance of active agents in range [agentBegin, agentEnd), using avoidance query of given worker
+	/// Different ranges can be updated in parallel after steering, as long as each uses a different worker.
+	/// Doesn't change getVelocitySampleCount.
+	/// @param[in]		dt			Delta time in seconds
+	/// @param[in]		agentBegin	First active agent
+	/// @param[in]		agentEnd	One past the last active agent
+	/// @param[in]		workerIdx	Avoidance worker [Limits: 0 <= value < getAvoidanceWorkerCount()]
+	/// @return The number of velocity samples taken
+	int updateStepAvoidanceRange(const float dt, const int agentBegin, const int agentEnd, const int workerIdx, dtCrowdAgentDebugInfo* debug);
+
 	/// [UE4] Split update into several smaller components: integrate velocities and handle collisions
 	/// @param[in]		dt		Delta time in seconds
 	/// @param[in]		nagents	Number of active agents
@@ -24,6 +24,7 @@ FNetworkPlatformFile::FNetworkPlatformFile()
 	: bHasLoadedDDCDirectories(false)
 	, InnerPlatformFile(NULL)
 	, bIsUsable(false)
+	, bServerCompressesFiles(false)
 	, FinishedAsyncNetworkReadUnsolicitedFiles(NULL)
 	, FinishedAsyncWriteUnsolicitedFiles(NULL)
 	, Transport(NULL)
@@ -176,6 +177,13 @@ void FNetworkPlatformFile::InitializeAfterSetActive()
 			TMap<FString, FDateTime> ServerCachedFiles;
 			Response << ServerCachedFiles;
 
+			// the server tells whether it compresses the synced files, older servers don't
+			bServerCompressesFiles = false;
+			if (!Response.AtEnd())
+			{
+				Response << bServerCompressesFiles;
+			}
+
 			bool bDeleteAllFiles = true;
 			// Check the stored cooked version
 			FString CookedVersionFile = FPaths::GeneratedConfigDir() / TEXT("CookedVersion.txt");
@@ -636,6 +644,10 @@ void FNetworkPlatformFile::FillGetFileList(FNetworkFileArchive& Payload, bool bI
 	Payload << GameRelPath;
 	Payload << Directories;
 	Payload << bInStreamingFileRequest;
+
+	// streaming clients read through file handles, only synced files are compressed
+	bool bAcceptsCompressedFiles = !bInStreamingFileRequest;
+	Payload << bAcceptsCompressedFiles;
 }
 
 void FNetworkPlatformFile::ProcessServerInitialResponse(FArrayReader& InResponse, int32 OutServerPackageVersion, int32 OutServerPackageLicenseeVersion)
@@ -733,17 +745,20 @@ public:
 	FDateTime ServerTimeStamp;
 	IPlatformFile& InnerPlatformFile;
 	FScopedEvent* Event;
+	/** whether the server may have compressed the file contents **/
+	bool bCompressed;
 
 	uint8 Buffer[128 * 1024];
 
 	/** Constructor
 	*/
-	FAsyncNetworkWriteWorker(const TCHAR* InFilename, FArchive* InArchive, FDateTime InServerTimeStamp, IPlatformFile* InInnerPlatformFile, FScopedEvent* InEvent)
+	FAsyncNetworkWriteWorker(const TCHAR* InFilename, FArchive* InArchive, FDateTime InServerTimeStamp, IPlatformFile* InInnerPlatformFile, FScopedEvent* InEvent, bool bInCompressed)
 		: Filename(InFilename)
 		, FileArchive(InArchive)
 		, ServerTimeStamp(InServerTimeStamp)
 		, InnerPlatformFile(*InInnerPlatformFile)
 		, Event(InEvent)
+		, bCompressed(bInCompressed)
 	{
 	}
 		
@@ -759,6 +774,12 @@ public:
 		// before exiting this worker.
 		uint64 FileSize;
 		*FileArchive << FileSize;
+		// 0 if the contents follow uncompressed
+		uint64 CompressedFileSize = 0;
+		if (bCompressed)
+		{
+			*FileArchive << CompressedFileSize;
+		}
 		if (ServerTimeStamp != FDateTime::MinValue())  // if the file didn't actually exist on the server, don't create a zero byte file
 		{
 			FString TempFilename = Filename + TEXT(".tmp");
@@ -772,9 +793,29 @@ public:
 					UE_LOG(LogNetworkPlatformFile, Fatal, TEXT("Could not open file for writing '%s'."), *TempFilename);
 				}
 
+				if (CompressedFileSize > 0)
+				{
+					// decompress the whole file at once, it was compressed as a single block
+					TArray<uint8> CompressedContents;
+					CompressedContents.AddUninitialized(CompressedFileSize);
+					FileArchive->Serialize(CompressedContents.GetData(), CompressedContents.Num());
+
+					TArray<uint8> Contents;
+					Contents.AddUninitialized(FileSize);
+					if (!FCompression::UncompressMemory(COMPRESS_ZLIB, Contents.GetData(), Contents.Num(), CompressedContents.GetData(), CompressedContents.Num()))
+					{
+						UE_LOG(LogNetworkPlatformFile, Fatal, TEXT("Could not decompress '%s'."), *Filename);
+					}
+
+					if (!FileHandle->Write(Contents.GetData(), Contents.Num()))
+					{
+						UE_LOG(LogNetworkPlatformFile, Fatal, TEXT("Could not write '%s'."), *TempFilename);
+					}
+				}
+
 				// now write the file from bytes pulled from the archive
 				// read/write a chunk at a time
-				uint64 RemainingData = FileSize;
+				uint64 RemainingData = (CompressedFileSize > 0) ? 0 : FileSize;
 				while (RemainingData)
 				{
 					// read next chunk from archive
@@ -834,18 +875,18 @@ public:
 /**
  * Write a file async or sync, with the data coming from a TArray or an FArchive/Filesize
  */
-void SyncWriteFile(FArchive* Archive, const FString& Filename, FDateTime ServerTimeStamp, IPlatformFile& InnerPlatformFile)
+void SyncWriteFile(FArchive* Archive, const FString& Filename, FDateTime ServerTimeStamp, IPlatformFile& InnerPlatformFile, bool bCompressed)
 {
 	FScopedEvent* NullEvent = NULL;
-	(new FAutoDeleteAsyncTask<FAsyncNetworkWriteWorker>(*Filename, Archive, ServerTimeStamp, &InnerPlatformFile, NullEvent))->StartSynchronousTask();
+	(new FAutoDeleteAsyncTask<FAsyncNetworkWriteWorker>(*Filename, Archive, ServerTimeStamp, &InnerPlatformFile, NullEvent, bCompressed))->StartSynchronousTask();
 }
 
-void AsyncWriteFile(FArchive* Archive, const FString& Filename, FDateTime ServerTimeStamp, IPlatformFile& InnerPlatformFile, FScopedEvent* Event = NULL)
+void AsyncWriteFile(FArchive* Archive, const FString& Filename, FDateTime ServerTimeStamp, IPlatformFile& InnerPlatformFile, bool bCompressed, FScopedEvent* Event = NULL)
 {
-	(new FAutoDeleteAsyncTask<FAsyncNetworkWriteWorker>(*Filename, Archive, ServerTimeStamp, &InnerPlatformFile, Event))->StartBackgroundTask();
+	(new FAutoDeleteAsyncTask<FAsyncNetworkWriteWorker>(*Filename, Archive, ServerTimeStamp, &InnerPlatformFile, Event, bCompressed))->StartBackgroundTask();
 }
 
-void AsyncReadUnsolicitedFiles(int32 InNumUnsolictedFiles, FNetworkPlatformFile& InNetworkFile, IPlatformFile& InInnerPlatformFile, FString& InServerEngineDir, FString& InServerGameDir, FScopedEvent *InNetworkDoneEvent, FScopedEvent *InWritingDoneEvent)
+void AsyncReadUnsolicitedFiles(int32 InNumUnsolictedFiles, FNetworkPlatformFile& InNetworkFile, IPlatformFile& InInnerPlatformFile, FString& InServerEngineDir, FString& InServerGameDir, bool bInCompressed, FScopedEvent *InNetworkDoneEvent, FScopedEvent *InWritingDoneEvent)
 {
 	class FAsyncReadUnsolicitedFile : public FNonAbandonableTask
 	{
@@ -855,15 +896,17 @@ void AsyncReadUnsolicitedFiles(int32 InNumUnsolictedFiles, FNetworkPlatformFile&
 		IPlatformFile& InnerPlatformFile;
 		FString ServerEngineDir;
 		FString ServerGameDir;
+		bool bCompressed; // whether the server may have compressed the files
 		FScopedEvent* NetworkDoneEvent; // finished using the network
 		FScopedEvent* WritingDoneEvent; // finished writing the files to disk
 
-		FAsyncReadUnsolicitedFile(int32 In_NumUnsolictedFiles, FNetworkPlatformFile* In_NetworkFile, IPlatformFile* In_InnerPlatformFile, FString& In_ServerEngineDir, FString& In_ServerGameDir, FScopedEvent *InNetworkDoneEvent, FScopedEvent *InWritingDoneEvent )
+		FAsyncReadUnsolicitedFile(int32 In_NumUnsolictedFiles, FNetworkPlatformFile* In_NetworkFile, IPlatformFile* In_InnerPlatformFile, FString& In_ServerEngineDir, FString& In_ServerGameDir, bool bIn_Compressed, FScopedEvent *InNetworkDoneEvent, FScopedEvent *InWritingDoneEvent )
 			: NumUnsolictedFiles(In_NumUnsolictedFiles)
 			, NetworkFile(*In_NetworkFile)
 			, InnerPlatformFile(*In_InnerPlatformFile)
 			, ServerEngineDir(In_ServerEngineDir)
 			, ServerGameDir(In_ServerGameDir)
+			, bCompressed(bIn_Compressed)
 			, NetworkDoneEvent(InNetworkDoneEvent)
 			, WritingDoneEvent(InWritingDoneEvent)
 		{
@@ -892,7 +935,7 @@ void AsyncReadUnsolicitedFiles(int32 InNumUnsolictedFiles, FNetworkPlatformFile&
 					*UnsolictedResponse << UnsolictedServerTimeStamp;
 
 					// write the file by pulling out of the FArrayReader
-					AsyncWriteFile(UnsolictedResponse, UnsolictedReplyFile, UnsolictedServerTimeStamp, InnerPlatformFile, WritingDoneEvent);
+					AsyncWriteFile(UnsolictedResponse, UnsolictedReplyFile, UnsolictedServerTimeStamp, InnerPlatformFile, bCompressed, WritingDoneEvent);
 				}
 			}
 			NetworkDoneEvent->Trigger();
@@ -906,7 +949,7 @@ void AsyncReadUnsolicitedFiles(int32 InNumUnsolictedFiles, FNetworkPlatformFile&
 		}
 	};
 
-	(new FAutoDeleteAsyncTask<FAsyncReadUnsolicitedFile>(InNumUnsolictedFiles, &InNetworkFile, &InInnerPlatformFile, InServerEngineDir, InServerGameDir, InNetworkDoneEvent, InWritingDoneEvent))->StartSynchronousTask();
+	(new FAutoDeleteAsyncTask<FAsyncReadUnsolicitedFile>(InNumUnsolictedFiles, &InNetworkFile, &InInnerPlatformFile, InServerEngineDir, InServerGameDir, bInCompressed, InNetworkDoneEvent, InWritingDoneEvent))->StartSynchronousTask();
 }
 
 /**
@@ -1023,7 +1066,7 @@ void FNetworkPlatformFile::EnsureFileIsLocal(const FString& Filename)
 	Response << ServerTimeStamp;
 
 	// write the file in chunks, synchronously
-	SyncWriteFile(&Response, ReplyFile, ServerTimeStamp, *InnerPlatformFile);
+	SyncWriteFile(&Response, ReplyFile, ServerTimeStamp, *InnerPlatformFile, bServerCompressesFiles);
 
 	int32 NumUnsolictedFiles;
 	Response << NumUnsolictedFiles;
@@ -1034,7 +1077,7 @@ void FNetworkPlatformFile::EnsureFileIsLocal(const FString& Filename)
 		check( FinishedAsyncWriteUnsolicitedFiles == NULL );
 		FinishedAsyncNetworkReadUnsolicitedFiles = new FScopedEvent;
 		FinishedAsyncWriteUnsolicitedFiles = new FScopedEvent;
-		AsyncReadUnsolicitedFiles(NumUnsolictedFiles, *this, *InnerPlatformFile, ServerEngineDir, ServerGameDir, FinishedAsyncNetworkReadUnsolicitedFiles, FinishedAsyncWriteUnsolicitedFiles);
+		AsyncReadUnsolicitedFiles(NumUnsolictedFiles, *this, *InnerPlatformFile, ServerEngineDir, ServerGameDir, bServerCompressesFiles, FinishedAsyncNetworkReadUnsolicitedFiles, FinishedAsyncWriteUnsolicitedFiles);
 	}
 	
 	ThisTime = 1000.0f * float(FPlatformTime::Seconds() - StartTime);
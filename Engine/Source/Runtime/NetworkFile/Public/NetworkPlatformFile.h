@@ -201,6 +201,9 @@ protected:
 	bool				bIsUsable;
 	int32				FileServerPort;
 
+	/** Whether the server sends the contents of synced files compressed */
+	bool				bServerCompressesFiles;
+
 private:
 
 	/* Unsolicitied files events */
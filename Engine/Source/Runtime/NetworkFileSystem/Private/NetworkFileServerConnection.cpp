@@ -12,6 +12,7 @@ FNetworkFileServerClientConnection::FNetworkFileServerClientConnection( const FF
 		const FRecompileShadersDelegate& InRecompileShadersDelegate, const TArray<ITargetPlatform*>& InActiveTargetPlatforms )
 	: LastHandleId(0)
 	, Sandbox(NULL)
+	, bCompressFiles(false)
 	, ActiveTargetPlatforms(InActiveTargetPlatforms)
 {
 	if (InFileRequestDelegate.IsBound())
@@ -647,6 +648,14 @@ bool FNetworkFileServerClientConnection::ProcessGetFileList( FArchive& In, FArch
 	In << RootDirectories;
 	In << bIsStreamingRequest;
 
+	// older clients don't tell whether they accept compressed files
+	bool bClientAcceptsCompressedFiles = false;
+	if (!In.AtEnd())
+	{
+		In << bClientAcceptsCompressedFiles;
+	}
+	bCompressFiles = bClientAcceptsCompressedFiles && !FParse::Param(FCommandLine::Get(), TEXT("NoFileServerCompression"));
+
 	ConnectedPlatformName = TEXT("");
 
 	bool bSendLowerCase = false;
@@ -838,6 +847,10 @@ bool FNetworkFileServerClientConnection::ProcessGetFileList( FArchive& In, FArch
 		FixedTimes = FixupSandboxPathsForClient(Sandbox, VisitorForCacheDates.FileTimes, LocalEngineDir, LocalGameDir, bSendLowerCase);
 		Out << FixedTimes;
 	}
+
+	// tell the client how the synced files will be sent, older clients don't read it
+	Out << bCompressFiles;
+
 	return true;
 }
 
@@ -899,6 +912,35 @@ void FNetworkFileServerClientConnection::PackageFile( FString& Filename, FArchiv
 	Out << ServerTimeStamp;
 	uint64 FileSize = Contents.Num();
 	Out << FileSize;
+
+	if (bCompressFiles)
+	{
+		// a compressed size of 0 means the contents follow as they are, because compressing didn't make them smaller
+		TArray<uint8> CompressedContents;
+		int32 CompressedSize = 0;
+
+		if (Contents.Num() > 0)
+		{
+			const ECompressionFlags CompressionFlags = (ECompressionFlags)(COMPRESS_ZLIB | COMPRESS_BiasSpeed);
+			CompressedSize = FCompression::CompressMemoryBound(CompressionFlags, Contents.Num());
+			CompressedContents.AddUninitialized(CompressedSize);
+
+			if (!FCompression::CompressMemory(CompressionFlags, CompressedContents.GetData(), CompressedSize, Contents.GetData(), Contents.Num()) || (CompressedSize >= Contents.Num()))
+			{
+				CompressedSize = 0;
+			}
+		}
+
+		uint64 CompressedFileSize = CompressedSize;
+		Out << CompressedFileSize;
+
+		if (CompressedFileSize > 0)
+		{
+			Out.Serialize(CompressedContents.GetData(), CompressedFileSize);
+			return;
+		}
+	}
+
 	Out.Serialize(Contents.GetData(), FileSize);
 }
 
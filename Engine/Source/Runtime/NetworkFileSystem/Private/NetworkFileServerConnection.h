@@ -179,6 +179,9 @@ private:
 	// Holds the list of unsolicited files to send in separate packets.
 	TArray<FString> UnsolictedFiles;
 
+	// Holds a flag indicating whether the contents of synced files are sent compressed.
+	bool bCompressFiles;
+
 	// Holds the list of directories being watched.
 	TArray<FString> WatchedDirectories;
 
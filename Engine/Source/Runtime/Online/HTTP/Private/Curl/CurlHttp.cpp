@@ -51,6 +51,15 @@ FCurlHttpRequest::FCurlHttpRequest(CURLM * InMultiHandle)
 		// associate with this just in case
 		curl_easy_setopt(EasyHandle, CURLOPT_PRIVATE, this);
 
+		// reuse DNS lookups and TLS sessions of the other requests
+		if (FCurlHttpManager::GShareHandle)
+		{
+			curl_easy_setopt(EasyHandle, CURLOPT_SHARE, FCurlHttpManager::GShareHandle);
+		}
+
+		// keep the pooled connections alive while they are idle
+		curl_easy_setopt(EasyHandle, CURLOPT_TCP_KEEPALIVE, 1L);
+
 		if (FCurlHttpManager::CurlRequestOptions.bUseHttpProxy)
 		{
 			// guaranteed to be valid at this point
@@ -7,8 +7,25 @@
 #if WITH_LIBCURL
 
 CURLM * FCurlHttpManager::GMultiHandle = NULL;
+CURLSH * FCurlHttpManager::GShareHandle = NULL;
 FCurlHttpManager::FCurlRequestOptions FCurlHttpManager::CurlRequestOptions;
 
+namespace CurlHttpManager
+{
+	/** Locks for the data shared through GShareHandle, requests can be created and destroyed on any thread */
+	FCriticalSection ShareLocks[CURL_LOCK_DATA_LAST];
+
+	void LockShareData(CURL* Handle, curl_lock_data Data, curl_lock_access Access, void* UserData)
+	{
+		ShareLocks[Data].Lock();
+	}
+
+	void UnlockShareData(CURL* Handle, curl_lock_data Data, void* UserData)
+	{
+		ShareLocks[Data].Unlock();
+	}
+}
+
 void FCurlHttpManager::InitCurl()
 {
 	if (GMultiHandle != NULL)
@@ -67,6 +84,19 @@ void FCurlHttpManager::InitCurl()
 		{
 			UE_LOG(LogInit, Fatal, TEXT("Could not initialize create libcurl multi handle! HTTP transfers will not function properly."));
 		}
+
+		GShareHandle = curl_share_init();
+		if (NULL != GShareHandle)
+		{
+			curl_share_setopt(GShareHandle, CURLSHOPT_LOCKFUNC, CurlHttpManager::LockShareData);
+			curl_share_setopt(GShareHandle, CURLSHOPT_UNLOCKFUNC, CurlHttpManager::UnlockShareData);
+			curl_share_setopt(GShareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+			curl_share_setopt(GShareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+		}
+		else
+		{
+			UE_LOG(LogInit, Warning, TEXT("Could not initialize libcurl share handle, TLS sessions will not be reused across connections."));
+		}
 	}
 	else
 	{
@@ -101,6 +131,23 @@ void FCurlHttpManager::InitCurl()
 		CurlRequestOptions.bDontReuseConnections = true;
 	}
 
+	// same setting as the other HTTP implementations, see FHttpModule::GetHttpMaxConnectionsPerServer()
+	int32 MaxHostConnections = 16;
+	GConfig->GetInt(TEXT("HTTP"), TEXT("HttpMaxConnectionsPerServer"), MaxHostConnections, GEngineIni);
+	CurlRequestOptions.MaxHostConnections = FMath::Max(0, MaxHostConnections);
+
+	bool bAllowPipelining = false;
+	if (GConfig->GetBool(TEXT("HTTP"), TEXT("bAllowPipelining"), bAllowPipelining, GEngineIni))
+	{
+		CurlRequestOptions.bAllowPipelining = bAllowPipelining;
+	}
+
+	if (GMultiHandle != NULL)
+	{
+		curl_multi_setopt(GMultiHandle, CURLMOPT_MAX_HOST_CONNECTIONS, (long)CurlRequestOptions.MaxHostConnections);
+		curl_multi_setopt(GMultiHandle, CURLMOPT_PIPELINING, CurlRequestOptions.bAllowPipelining ? 1L : 0L);
+	}
+
 	// discover cert location
 	if (PLATFORM_LINUX)	// only relevant to Linux (for now?), not #ifdef'ed to keep the code checked by the compiler when compiling for other platforms
 	{
@@ -155,6 +202,16 @@ void FCurlHttpManager::FCurlRequestOptions::Log()
 		bDontReuseConnections ? TEXT("NOT ") : TEXT("")
 		);
 
+	UE_LOG(LogInit, Log, TEXT(" - MaxHostConnections = %d  - Libcurl will %s"),
+		MaxHostConnections,
+		(MaxHostConnections > 0) ? TEXT("queue requests above that many connections to a host") : TEXT("not limit the connections to a host")
+		);
+
+	UE_LOG(LogInit, Log, TEXT(" - bAllowPipelining = %s  - Libcurl will %spipeline requests on a connection"),
+		bAllowPipelining ? TEXT("true") : TEXT("false"),
+		bAllowPipelining ? TEXT("") : TEXT("NOT ")
+		);
+
 	UE_LOG(LogInit, Log, TEXT(" - CertBundlePath = %s  - Libcurl will %s"),
 		(CertBundlePath != nullptr) ? *FString(CertBundlePath) : TEXT("nullptr"),
 		(CertBundlePath != nullptr) ? TEXT("set CURLOPT_CAINFO to it") : TEXT("use whatever was configured at build time.")
@@ -170,6 +227,13 @@ void FCurlHttpManager::ShutdownCurl()
 		GMultiHandle = NULL;
 	}
 
+	// the requests detach from it when their easy handles are cleaned up
+	if (NULL != GShareHandle)
+	{
+		curl_share_cleanup(GShareHandle);
+		GShareHandle = NULL;
+	}
+
 	curl_global_cleanup();
 }
 
@@ -39,12 +39,17 @@ public:
 	static void ShutdownCurl();
 	static CURLM * GMultiHandle;
 
+	/** share handle that lets all the requests reuse DNS lookups and TLS sessions, even when they cannot reuse a connection */
+	static CURLSH * GShareHandle;
+
 	static struct FCurlRequestOptions
 	{
 		FCurlRequestOptions()
 			:	bVerifyPeer(true)
 			,	bUseHttpProxy(false)
 			,	bDontReuseConnections(false)
+			,	MaxHostConnections(0)
+			,	bAllowPipelining(false)
 			,	CertBundlePath(nullptr)
 		{}
 
@@ -60,6 +65,12 @@ public:
 		/** Forbid reuse connections (for debugging purposes, since normally it's faster to reuse) */
 		bool bDontReuseConnections;
 
+		/** Maximum number of simultaneous connections to a single host, requests above that wait for a pooled connection (0 = no limit) */
+		int32 MaxHostConnections;
+
+		/** Whether or not requests to the same host may be pipelined on a single connection */
+		bool bAllowPipelining;
+
 		/** Address of the HTTP proxy */
 		FString HttpProxyAddress;
 
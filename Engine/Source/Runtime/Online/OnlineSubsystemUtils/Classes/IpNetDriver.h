@@ -7,6 +7,17 @@
 #pragma once
 #include "IpNetDriver.generated.h"
 
+/** A datagram queued to be sent with the others of the same flush */
+struct FIpPendingDatagram
+{
+	/** Offset of the data in the queue buffer */
+	int32 Offset;
+	/** Size of the data */
+	int32 Count;
+	/** Address to send to */
+	TSharedPtr<FInternetAddr> Address;
+};
+
 UCLASS(transient, config=Engine)
 class ONLINESUBSYSTEMUTILS_API UIpNetDriver : public UNetDriver
 {
@@ -30,6 +41,17 @@ class ONLINESUBSYSTEMUTILS_API UIpNetDriver : public UNetDriver
 	/** Underlying socket communication */
 	FSocket* Socket;
 
+	/** True while TickFlush runs with net.BatchSocketIO set, the connections queue their datagrams instead of sending them */
+	bool bBatchingSends;
+
+	/** Datagrams queued during the flush, and their data */
+	TArray<FIpPendingDatagram> PendingDatagrams;
+	TArray<uint8> PendingDatagramData;
+
+	/** Buffers and source addresses of the batched receives */
+	TArray<uint8> ReceiveBuffer;
+	TArray< TSharedPtr<FInternetAddr> > ReceiveAddresses;
+
 	// Begin UNetDriver interface.
 	virtual bool IsAvailable() const override;
 	virtual bool InitBase(bool bInitAsClient, FNetworkNotify* InNotify, const FURL& URL, bool bReuseAddressAndPort, FString& Error) override;
@@ -37,6 +59,7 @@ class ONLINESUBSYSTEMUTILS_API UIpNetDriver : public UNetDriver
 	virtual bool InitListen( FNetworkNotify* InNotify, FURL& LocalURL, bool bReuseAddressAndPort, FString& Error ) override;
 	virtual void ProcessRemoteFunction(class AActor* Actor, class UFunction* Function, void* Parameters, struct FOutParmRec* OutParms, struct FFrame* Stack, class UObject* SubObject = NULL) override;
 	virtual void TickDispatch( float DeltaTime ) override;
+	virtual void TickFlush( float DeltaSeconds ) override;
 	virtual FString LowLevelGetNetworkNumber() override;
 	virtual void LowLevelDestroy() override;
 	virtual class ISocketSubsystem* GetSocketSubsystem() override;
@@ -59,6 +82,16 @@ class ONLINESUBSYSTEMUTILS_API UIpNetDriver : public UNetDriver
 	virtual int GetClientPort();
 	// End UIpNetDriver interface.
 
+	/**
+	 * Queues a datagram for the driver socket until the end of TickFlush, when the sends are batched
+	 *
+	 * @return false if the datagram wasn't queued, and the caller has to send it
+	 */
+	bool QueueDatagram(const uint8* Data, int32 Count, const TSharedPtr<FInternetAddr>& Address);
+
+	/** Sends the queued datagrams, in as few system calls as the socket allows */
+	void FlushPendingDatagrams();
+
 	// Begin FExec Interface
 	virtual bool Exec( UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar=*GLog ) override;
 	// End FExec Interface
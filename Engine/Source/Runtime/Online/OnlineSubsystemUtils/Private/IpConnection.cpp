@@ -128,7 +128,14 @@ void UIpConnection::LowLevelSend( void* Data, int32 Count )
 			ResolveInfo = NULL;
 		}
 	}
-	// Send to remote.
+	// Send to remote, or leave it to the driver if it sends the datagrams of this flush together
+	UIpNetDriver* IpDriver = Cast<UIpNetDriver>(Driver);
+	if (IpDriver && IpDriver->Socket == Socket && IpDriver->QueueDatagram((uint8*)Data, Count, RemoteAddr))
+	{
+		NETWORK_PROFILER(GNetworkProfiler.TrackSocketSendTo(Socket->GetDescription(),Data,Count,*RemoteAddr));
+		return;
+	}
+
 	int32 BytesSent = 0;
 	CLOCK_CYCLES(Driver->SendCycles);
 	Socket->SendTo((uint8*)Data, Count, BytesSent, *RemoteAddr);
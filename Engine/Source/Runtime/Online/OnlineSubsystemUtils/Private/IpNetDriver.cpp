@@ -20,8 +20,18 @@ Notes:
 /** Size of the network recv buffer */
 #define NETWORK_MAX_PACKET (576)
 
+/** Number of datagrams read by a batched receive */
+#define NETWORK_RECV_BATCH (32)
+
+static TAutoConsoleVariable<int32> CVarNetBatchSocketIO(
+	TEXT("net.BatchSocketIO"),
+	1,
+	TEXT("Sends the datagrams of a net driver flush together, and reads the incoming ones in batches, on the sockets that support it (sendmmsg/recvmmsg)"),
+	ECVF_Default);
+
 UIpNetDriver::UIpNetDriver(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, bBatchingSends(false)
 {
 }
 
@@ -168,17 +178,34 @@ void UIpNetDriver::TickDispatch( float DeltaTime )
 
 	ISocketSubsystem* SocketSubsystem = GetSocketSubsystem();
 
+	// Buffers for a batch of incoming packets, a single one reads them the way the socket did before batching
+	const int32 NumBuffers = CVarNetBatchSocketIO.GetValueOnGameThread() != 0 ? NETWORK_RECV_BATCH : 1;
+	if (ReceiveAddresses.Num() < NumBuffers)
+	{
+		ReceiveBuffer.SetNumUninitialized(NumBuffers * NETWORK_MAX_PACKET);
+		while (ReceiveAddresses.Num() < NumBuffers)
+		{
+			ReceiveAddresses.Add(SocketSubsystem->CreateInternetAddr());
+		}
+	}
+
+	FSocketDatagram Datagrams[NETWORK_RECV_BATCH];
+	for (int32 i = 0; i < NumBuffers; i++)
+	{
+		Datagrams[i].Data = ReceiveBuffer.GetData() + i * NETWORK_MAX_PACKET;
+		Datagrams[i].Count = NETWORK_MAX_PACKET;
+		Datagrams[i].Address = ReceiveAddresses[i].Get();
+	}
+
 	// Process all incoming packets.
-	uint8 Data[NETWORK_MAX_PACKET];
-	TSharedRef<FInternetAddr> FromAddr = SocketSubsystem->CreateInternetAddr();
 	for( ; Socket != NULL; )
 	{
-		int32 BytesRead = 0;
 		// Get data, if any.
 		CLOCK_CYCLES(RecvCycles);
-		bool bOk = Socket->RecvFrom(Data, sizeof(Data), BytesRead, *FromAddr);
+		const int32 NumReceived = Socket->RecvFromBatch(Datagrams, NumBuffers);
 		UNCLOCK_CYCLES(RecvCycles);
 		// Handle result.
+		const bool bOk = NumReceived > 0;
 		if( bOk == false )
 		{
 			ESocketErrors Error = SocketSubsystem->GetLastErrorCode();
@@ -195,88 +222,162 @@ void UIpNetDriver::TickDispatch( float DeltaTime )
 					UE_LOG(LogNet, Warning, TEXT("UDP recvfrom error: %i (%s) from %s"),
 						(int32)Error,
 						SocketSubsystem->GetSocketError(Error),
-						*FromAddr->ToString(true));
+						*Datagrams[0].Address->ToString(true));
 					break;
 				}
 			}
 		}
-		// Figure out which socket the received data came from.
-		UIpConnection* Connection = NULL;
-		if (GetServerConnection() && (*GetServerConnection()->RemoteAddr == *FromAddr))
-		{
-			Connection = GetServerConnection();
-		}
-		for( int32 i=0; i<ClientConnections.Num() && !Connection; i++ )
+
+		// A failed read is handled once, with the source address the socket reported for it
+		const int32 NumToProcess = bOk ? NumReceived : 1;
+		for( int32 DatagramIdx = 0; DatagramIdx < NumToProcess; DatagramIdx++ )
 		{
-			UIpConnection* TestConnection = (UIpConnection*)ClientConnections[i]; 
-            check(TestConnection);
-			if(*TestConnection->RemoteAddr == *FromAddr)
+			const FInternetAddr& FromAddr = *Datagrams[DatagramIdx].Address;
+
+			// Figure out which socket the received data came from.
+			UIpConnection* Connection = NULL;
+			if (GetServerConnection() && (*GetServerConnection()->RemoteAddr == FromAddr))
 			{
-				Connection = TestConnection;
+				Connection = GetServerConnection();
+			}
+			for( int32 i=0; i<ClientConnections.Num() && !Connection; i++ )
+			{
+				UIpConnection* TestConnection = (UIpConnection*)ClientConnections[i]; 
+				check(TestConnection);
+				if(*TestConnection->RemoteAddr == FromAddr)
+				{
+					Connection = TestConnection;
+				}
 			}
-		}
 
-		if( bOk == false )
-		{
-			if( Connection )
+			if( bOk == false )
 			{
-				if( Connection != GetServerConnection() )
+				if( Connection )
 				{
-					// We received an ICMP port unreachable from the client, meaning the client is no longer running the game
-					// (or someone is trying to perform a DoS attack on the client)
-
-					// rcg08182002 Some buggy firewalls get occasional ICMP port
-					// unreachable messages from legitimate players. Still, this code
-					// will drop them unceremoniously, so there's an option in the .INI
-					// file for servers with such flakey connections to let these
-					// players slide...which means if the client's game crashes, they
-					// might get flooded to some degree with packets until they timeout.
-					// Either way, this should close up the usual DoS attacks.
-					if ((Connection->State != USOCK_Open) || (!AllowPlayerPortUnreach))
+					if( Connection != GetServerConnection() )
 					{
-						if (LogPortUnreach)
+						// We received an ICMP port unreachable from the client, meaning the client is no longer running the game
+						// (or someone is trying to perform a DoS attack on the client)
+
+						// rcg08182002 Some buggy firewalls get occasional ICMP port
+						// unreachable messages from legitimate players. Still, this code
+						// will drop them unceremoniously, so there's an option in the .INI
+						// file for servers with such flakey connections to let these
+						// players slide...which means if the client's game crashes, they
+						// might get flooded to some degree with packets until they timeout.
+						// Either way, this should close up the usual DoS attacks.
+						if ((Connection->State != USOCK_Open) || (!AllowPlayerPortUnreach))
 						{
-							UE_LOG(LogNet, Log, TEXT("Received ICMP port unreachable from client %s.  Disconnecting."),
-								*FromAddr->ToString(true));
+							if (LogPortUnreach)
+							{
+								UE_LOG(LogNet, Log, TEXT("Received ICMP port unreachable from client %s.  Disconnecting."),
+									*FromAddr.ToString(true));
+							}
+							Connection->CleanUp();
 						}
-						Connection->CleanUp();
+					}
+				}
+				else
+				{
+					if (LogPortUnreach)
+					{
+						UE_LOG(LogNet, Log, TEXT("Received ICMP port unreachable from %s.  No matching connection found."),
+							*FromAddr.ToString(true));
 					}
 				}
 			}
 			else
 			{
-				if (LogPortUnreach)
+				// If we didn't find a client connection, maybe create a new one.
+				if( !Connection )
 				{
-					UE_LOG(LogNet, Log, TEXT("Received ICMP port unreachable from %s.  No matching connection found."),
-						*FromAddr->ToString(true));
+					// Determine if allowing for client/server connections
+					const bool bAcceptingConnection = Notify->NotifyAcceptingConnection() == EAcceptConnection::Accept;
+
+					if (bAcceptingConnection)
+					{
+						Connection = ConstructObject<UIpConnection>(NetConnectionClass);
+						check(Connection);
+						Connection->InitRemoteConnection( this, Socket,  FURL(), FromAddr, USOCK_Open);
+						Notify->NotifyAcceptedConnection( Connection );
+						AddClientConnection(Connection);
+					}
 				}
-			}
-		}
-		else
-		{
-			// If we didn't find a client connection, maybe create a new one.
-			if( !Connection )
-			{
-				// Determine if allowing for client/server connections
-				const bool bAcceptingConnection = Notify->NotifyAcceptingConnection() == EAcceptConnection::Accept;
 
-				if (bAcceptingConnection)
+				// Send the packet to the connection for processing.
+				if( Connection )
 				{
-					Connection = ConstructObject<UIpConnection>(NetConnectionClass);
-                    check(Connection);
-					Connection->InitRemoteConnection( this, Socket,  FURL(), *FromAddr, USOCK_Open);
-					Notify->NotifyAcceptedConnection( Connection );
-					AddClientConnection(Connection);
+					Connection->ReceivedRawPacket( Datagrams[DatagramIdx].Data, Datagrams[DatagramIdx].BytesTransferred );
 				}
 			}
+		}
+	}
+}
 
-			// Send the packet to the connection for processing.
-			if( Connection )
-			{
-				Connection->ReceivedRawPacket( Data, BytesRead );
-			}
+void UIpNetDriver::TickFlush( float DeltaSeconds )
+{
+	// Every connection flushes in here, so their datagrams can go out together
+	bBatchingSends = Socket != NULL && CVarNetBatchSocketIO.GetValueOnGameThread() != 0;
+
+	Super::TickFlush( DeltaSeconds );
+
+	bBatchingSends = false;
+	FlushPendingDatagrams();
+}
+
+bool UIpNetDriver::QueueDatagram(const uint8* Data, int32 Count, const TSharedPtr<FInternetAddr>& Address)
+{
+	if (!bBatchingSends)
+	{
+		return false;
+	}
+
+	// Connections can flush from worker threads with net.ParallelReplication
+	FNetParallelReplicationScopeLock QueueLock(this);
+
+	FIpPendingDatagram Datagram;
+	Datagram.Offset = PendingDatagramData.Num();
+	Datagram.Count = Count;
+	Datagram.Address = Address;
+	PendingDatagrams.Add(Datagram);
+
+	PendingDatagramData.Append(Data, Count);
+	return true;
+}
+
+void UIpNetDriver::FlushPendingDatagrams()
+{
+	if (PendingDatagrams.Num() == 0)
+	{
+		return;
+	}
+
+	if (Socket != NULL)
+	{
+		// The data is only moved around until now, so these pointers stay valid
+		TArray<FSocketDatagram> Datagrams;
+		Datagrams.AddDefaulted(PendingDatagrams.Num());
+		for (int32 i = 0; i < PendingDatagrams.Num(); i++)
+		{
+			Datagrams[i].Data = PendingDatagramData.GetData() + PendingDatagrams[i].Offset;
+			Datagrams[i].Count = PendingDatagrams[i].Count;
+			Datagrams[i].Address = PendingDatagrams[i].Address.Get();
+		}
+
+		CLOCK_CYCLES(SendCycles);
+		int32 NumSent = 0;
+		while (NumSent < Datagrams.Num())
+		{
+			NumSent += Socket->SendToBatch(Datagrams.GetData() + NumSent, Datagrams.Num() - NumSent);
+
+			// Skip the one that failed, like a failed SendTo of a single connection doesn't stop the others
+			NumSent++;
 		}
+		UNCLOCK_CYCLES(SendCycles);
 	}
+
+	PendingDatagrams.Reset();
+	PendingDatagramData.Reset();
 }
 
 void UIpNetDriver::ProcessRemoteFunction(class AActor* Actor, UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack, class UObject* SubObject )
@@ -343,6 +444,9 @@ void UIpNetDriver::LowLevelDestroy()
 {
 	Super::LowLevelDestroy();
 
+	PendingDatagrams.Empty();
+	PendingDatagramData.Empty();
+
 	// Close the socket.
 	if( Socket && !HasAnyFlags(RF_ClassDefaultObject) )
 	{
@@ -54,6 +54,9 @@ PFNGLGETOBJECTLABELKHRPROC				glGetObjectLabelKHR = NULL;
 PFNGLOBJECTPTRLABELKHRPROC				glObjectPtrLabelKHR = NULL;
 PFNGLGETOBJECTPTRLABELKHRPROC			glGetObjectPtrLabelKHR = NULL;
 
+PFNGLGETPROGRAMBINARYOESPROC			glGetProgramBinaryOES = NULL;
+PFNGLPROGRAMBINARYOESPROC				glProgramBinaryOES = NULL;
+
 struct FPlatformOpenGLDevice
 {
 
@@ -349,6 +352,16 @@ void FAndroidOpenGL::ProcessExtensions(const FString& ExtensionsString)
 	glLabelObjectEXT = (PFNGLLABELOBJECTEXTPROC)((void*)eglGetProcAddress("glLabelObjectEXT"));
 	glGetObjectLabelEXT = (PFNGLGETOBJECTLABELEXTPROC)((void*)eglGetProcAddress("glGetObjectLabelEXT"));
 
+	if (ExtensionsString.Contains(TEXT("GL_OES_get_program_binary")))
+	{
+		glGetProgramBinaryOES = (PFNGLGETPROGRAMBINARYOESPROC)((void*)eglGetProcAddress("glGetProgramBinaryOES"));
+		glProgramBinaryOES = (PFNGLPROGRAMBINARYOESPROC)((void*)eglGetProcAddress("glProgramBinaryOES"));
+		if (glGetProgramBinaryOES == NULL)
+		{
+			glProgramBinaryOES = NULL;
+		}
+	}
+
 	bSupportsETC2 = bES30Support;
 	bUseES30ShadingLanguage = bES30Support;
 
@@ -112,6 +112,8 @@ extern PFNGLOBJECTLABELKHRPROC			glObjectLabelKHR;
 extern PFNGLGETOBJECTLABELKHRPROC		glGetObjectLabelKHR;
 extern PFNGLOBJECTPTRLABELKHRPROC		glObjectPtrLabelKHR;
 extern PFNGLGETOBJECTPTRLABELKHRPROC	glGetObjectPtrLabelKHR;
+extern PFNGLGETPROGRAMBINARYOESPROC		glGetProgramBinaryOES;
+extern PFNGLPROGRAMBINARYOESPROC		glProgramBinaryOES;
 
 #include "OpenGLES2.h"
 
@@ -196,6 +198,21 @@ struct FAndroidOpenGL : public FOpenGLES2
 		}
 		return FR_WaitFailed;
 	}
+
+	static FORCEINLINE bool SupportsProgramBinary()
+	{
+		return glProgramBinaryOES != NULL;
+	}
+
+	static FORCEINLINE void GetProgramBinary(GLuint Program, GLsizei BufSize, GLsizei* Length, GLenum* BinaryFormat, void* Binary)
+	{
+		glGetProgramBinaryOES(Program, BufSize, Length, BinaryFormat, Binary);
+	}
+
+	static FORCEINLINE void ProgramBinary(GLuint Program, GLenum BinaryFormat, const void* Binary, GLsizei Length)
+	{
+		glProgramBinaryOES(Program, BinaryFormat, Binary, Length);
+	}
 	
 
 	// Required:
@@ -1034,10 +1034,34 @@ void _DeleteQueriesForCurrentContext( SDL_HGLContext hGLContext )
 
 }
 
+bool FLinuxOpenGL::bSupportsBufferStorage = false;
+bool FLinuxOpenGL::bSupportsBindlessTexture = false;
+bool FLinuxOpenGL::bSupportsProgramBinary = false;
+
 void FLinuxOpenGL::ProcessExtensions( const FString& ExtensionsString )
 {
 	FOpenGL4::ProcessExtensions(ExtensionsString);
 
+	int32 MajorVersion = 0;
+	int32 MinorVersion = 0;
+	FString Version = ANSI_TO_TCHAR((const ANSICHAR*)glGetString(GL_VERSION));
+	FString MajorString, MinorString;
+	if (Version.Split(TEXT("."), &MajorString, &MinorString))
+	{
+		MajorVersion = FCString::Atoi(*MajorString);
+		MinorVersion = FCString::Atoi(*MinorString);
+	}
+
+	bSupportsBufferStorage = glBufferStorage != NULL && (ExtensionsString.Contains(TEXT("GL_ARB_buffer_storage")) || (MajorVersion == 4 && MinorVersion >= 4) || (MajorVersion > 4));
+	bSupportsBindlessTexture = glGetTextureSamplerHandleARB != NULL && ExtensionsString.Contains(TEXT("GL_ARB_bindless_texture"));
+
+	GLint NumProgramBinaryFormats = 0;
+	if (ExtensionsString.Contains(TEXT("GL_ARB_get_program_binary")) || (MajorVersion == 4 && MinorVersion >= 1) || (MajorVersion > 4))
+	{
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &NumProgramBinaryFormats);
+	}
+	bSupportsProgramBinary = NumProgramBinaryFormats > 0 && glGetProgramBinary != NULL && glProgramBinary != NULL && glProgramParameteri != NULL;
+
 	FString VendorName( ANSI_TO_TCHAR((const ANSICHAR*)glGetString(GL_VENDOR) ) );
 
 	if ( VendorName.Contains(TEXT("ATI ")) )
@@ -336,7 +336,15 @@
 	EnumMacro(PFNGLTEXSTORAGE2DMULTISAMPLEPROC, glTexStorage2DMultisample)\
 	EnumMacro(PFNGLDRAWELEMENTSINDIRECTPROC, glDrawElementsIndirect)\
 	EnumMacro(PFNGLDRAWARRAYSINDIRECTPROC, glDrawArraysIndirect)\
-	EnumMacro(PFNGLDEPTHBOUNDSEXTPROC, glDepthBoundsEXT)
+	EnumMacro(PFNGLDEPTHBOUNDSEXTPROC, glDepthBoundsEXT)\
+	EnumMacro(PFNGLGETTEXTUREHANDLENVPROC, glGetTextureHandleARB)\
+	EnumMacro(PFNGLGETTEXTURESAMPLERHANDLENVPROC, glGetTextureSamplerHandleARB)\
+	EnumMacro(PFNGLMAKETEXTUREHANDLERESIDENTNVPROC, glMakeTextureHandleResidentARB)\
+	EnumMacro(PFNGLUNIFORMHANDLEUI64NVPROC, glUniformHandleui64ARB)\
+	EnumMacro(PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC, glMakeTextureHandleNonResidentARB)\
+	EnumMacro(PFNGLGETPROGRAMBINARYPROC, glGetProgramBinary)\
+	EnumMacro(PFNGLPROGRAMBINARYPROC, glProgramBinary)\
+	EnumMacro(PFNGLPROGRAMPARAMETERIPROC, glProgramParameteri)
 
 /** List of all OpenGL entry points. */
 #define ENUM_GL_ENTRYPOINTS_ALL(EnumMacro) \
@@ -436,7 +444,78 @@ struct FLinuxOpenGL : public FOpenGL4
 		glCopyImageSubData( SrcName, SrcTarget, SrcLevel, SrcX, SrcY, SrcZ, DstName, DstTarget, DstLevel, DstX, DstY, DstZ, Width, Height, Depth);
     }
 
+	// SDL_GL_GetProcAddress returns a pointer for any name under GLX, so these go by the extension string instead
+	static FORCEINLINE bool SupportsBufferStorage()
+	{
+		return bSupportsBufferStorage;
+	}
+
+	static FORCEINLINE bool SupportsBindlessTexture()
+	{
+		return bSupportsBindlessTexture;
+	}
+
+	static FORCEINLINE void BufferStorage(GLenum Target, GLsizeiptr Size, const void *Data, GLbitfield Flags)
+	{
+		glBufferStorage(Target, Size, Data, Flags);
+	}
+
+	static FORCEINLINE GLuint64 GetTextureSamplerHandle(GLuint Texture, GLuint Sampler)
+	{
+		return glGetTextureSamplerHandleARB( Texture, Sampler);
+	}
+
+	static FORCEINLINE GLuint64 GetTextureHandle(GLuint Texture)
+	{
+		return glGetTextureHandleARB(Texture);
+	}
+
+	static FORCEINLINE void MakeTextureHandleResident(GLuint64 TextureHandle)
+	{
+		glMakeTextureHandleResidentARB(TextureHandle);
+	}
+
+	static FORCEINLINE void MakeTextureHandleNonResident(GLuint64 TextureHandle)
+	{
+		glMakeTextureHandleNonResidentARB(TextureHandle);
+	}
+
+	static FORCEINLINE void UniformHandleui64(GLint Location, GLuint64 Value)
+	{
+		glUniformHandleui64ARB( Location, Value);
+	}
+
+	static FORCEINLINE bool SupportsProgramBinary()
+	{
+		return bSupportsProgramBinary;
+	}
+
+	static FORCEINLINE void GetProgramBinary(GLuint Program, GLsizei BufSize, GLsizei* Length, GLenum* BinaryFormat, void* Binary)
+	{
+		glGetProgramBinary(Program, BufSize, Length, BinaryFormat, Binary);
+	}
+
+	static FORCEINLINE void ProgramBinary(GLuint Program, GLenum BinaryFormat, const void* Binary, GLsizei Length)
+	{
+		glProgramBinary(Program, BinaryFormat, Binary, Length);
+	}
+
+	static FORCEINLINE void ProgramParameter(GLuint Program, GLenum PName, GLint Value)
+	{
+		glProgramParameteri(Program, PName, Value);
+	}
+
 	static void ProcessExtensions( const FString& ExtensionsString );
+
+private:
+	/** GL_ARB_buffer_storage or GL 4.4 */
+	static bool bSupportsBufferStorage;
+
+	/** GL_ARB_bindless_texture */
+	static bool bSupportsBindlessTexture;
+
+	/** GL_ARB_get_program_binary or GL 4.1, with at least one binary format */
+	static bool bSupportsProgramBinary;
 };
 
 typedef FLinuxOpenGL FOpenGL;
@@ -24,6 +24,7 @@ FRenderQueryRHIRef FOpenGLDynamicRHI::RHICreateRenderQuery(ERenderQueryType Quer
 	return new FOpenGLRenderQuery(QueryType);
 }
 
+#if !PLATFORM_SUPPORTS_RHI_THREAD
 void FOpenGLDynamicRHI::RHIResetRenderQuery(FRenderQueryRHIParamRef QueryRHI)
 {
 	DYNAMIC_CAST_OPENGLRESOURCE(RenderQuery,Query);
@@ -33,6 +34,7 @@ void FOpenGLDynamicRHI::RHIResetRenderQuery(FRenderQueryRHIParamRef QueryRHI)
 		Query->bResultIsCached = false;
 	}
 }
+#endif
 
 void FOpenGLDynamicRHI::RHIBeginRenderQuery(FRenderQueryRHIParamRef QueryRHI)
 {
@@ -43,6 +45,9 @@ void FOpenGLDynamicRHI::RHIBeginRenderQuery(FRenderQueryRHIParamRef QueryRHI)
 	if(Query->QueryType == RQT_Occlusion)
 	{
 		check(PendingState.RunningOcclusionQuery == 0);
+#if PLATFORM_SUPPORTS_RHI_THREAD
+		Query->bResultIsCached = false;
+#endif
 
 		if (!Query->bInvalidResource && !PlatformContextIsCurrent(Query->ResourceContext))
 		{
@@ -75,6 +80,9 @@ void FOpenGLDynamicRHI::RHIEndRenderQuery(FRenderQueryRHIParamRef QueryRHI)
 
 	if (Query)
 	{
+#if PLATFORM_SUPPORTS_RHI_THREAD
+		Query->bResultIsCached = false; // for occlusion queries, this is redundant with the one in begin
+#endif
 		if(Query->QueryType == RQT_Occlusion)
 		{
 			if (!Query->bInvalidResource && !PlatformContextIsCurrent(Query->ResourceContext))
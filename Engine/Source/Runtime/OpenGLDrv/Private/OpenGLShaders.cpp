@@ -515,6 +515,7 @@ ShaderType* CompileOpenGLShader(const TArray<uint8>& Code)
 	Shader = new ShaderType();
 	Shader->Resource = Resource;
 	Shader->Bindings = Header.Bindings;
+	FSHA1::HashBuffer(Code.GetData(), Code.Num(), Shader->Hash.Hash);
 	Shader->UniformBuffersCopyInfo = Header.UniformBuffersCopyInfo;
 
 #if DEBUG_GL_SHADERS
@@ -645,6 +646,7 @@ public:
 	{
 		FOpenGLShaderBindings Bindings;
 		GLuint Resource;
+		FSHAHash Hash;
 	}
 	Shaders[CrossCompiler::NUM_SHADER_STAGES];
 
@@ -763,6 +765,212 @@ static FOpenGLProgramsForReuse& GetOpenGLProgramsCache()
 	return ProgramsCache;
 }
 
+namespace OpenGLConsoleVariables
+{
+	int32 bUseProgramBinaryCache = 1;
+	static FAutoConsoleVariableRef CVarUseProgramBinaryCache(
+		TEXT("OpenGL.ProgramBinaryCache"),
+		bUseProgramBinaryCache,
+		TEXT("If true, linked programs are saved to disk and loaded from there on the next runs instead of being linked again."),
+		ECVF_ReadOnly
+		);
+};
+
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+
+#ifndef GL_PROGRAM_BINARY_LENGTH
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+
+/**
+ * Binaries of the programs linked on previous runs, keyed by the hashes of their shaders.
+ *
+ * The file starts with the driver strings, the whole cache is discarded when they change. New binaries are appended
+ * as soon as their program is linked, so that nothing is lost when the application is killed instead of exiting.
+ */
+class FOpenGLProgramBinaryCache
+{
+public:
+	static FOpenGLProgramBinaryCache& Get()
+	{
+		static FOpenGLProgramBinaryCache Cache;
+		return Cache;
+	}
+
+	bool IsEnabled() const
+	{
+		return bEnabled;
+	}
+
+	/** Returns the key of the program linking the shaders in Config. */
+	static FSHAHash GetProgramKey(const FOpenGLLinkedProgramConfiguration& Config)
+	{
+		FSHA1 HashState;
+		for (int32 Stage = 0; Stage < CrossCompiler::NUM_SHADER_STAGES; Stage++)
+		{
+			if (Config.Shaders[Stage].Resource)
+			{
+				HashState.Update((const uint8*)&Stage, sizeof(Stage));
+				HashState.Update(Config.Shaders[Stage].Hash.Hash, sizeof(Config.Shaders[Stage].Hash.Hash));
+			}
+		}
+		HashState.Final();
+
+		FSHAHash Key;
+		HashState.GetHash(Key.Hash);
+		return Key;
+	}
+
+	/**
+	 * Loads the cached binary of a program into a newly created program object.
+	 * @return false if there is no binary for that key or the driver rejected it, the program then has to be linked
+	 */
+	bool LoadProgram(const FSHAHash& Key, GLuint Program)
+	{
+		const FProgramBinary* Binary = Binaries.Find(Key);
+		if (!Binary)
+		{
+			return false;
+		}
+
+		FOpenGL::ProgramBinary(Program, Binary->Format, Binary->Data.GetData(), Binary->Data.Num());
+
+		GLint LinkStatus = 0;
+		glGetProgramiv(Program, GL_LINK_STATUS, &LinkStatus);
+		if (LinkStatus != GL_TRUE)
+		{
+			// the program is linked again and its new binary replaces this one
+			Binaries.Remove(Key);
+			return false;
+		}
+		return true;
+	}
+
+	/** Gets the binary of a program that was just linked and appends it to the cache. */
+	void SaveProgram(const FSHAHash& Key, GLuint Program)
+	{
+		GLint BinaryLength = 0;
+		glGetProgramiv(Program, GL_PROGRAM_BINARY_LENGTH, &BinaryLength);
+		if (BinaryLength <= 0)
+		{
+			return;
+		}
+
+		FProgramBinary& Binary = Binaries.Add(Key);
+		Binary.Format = 0;
+		Binary.Data.SetNumUninitialized(BinaryLength);
+		GLsizei Length = 0;
+		FOpenGL::GetProgramBinary(Program, BinaryLength, &Length, &Binary.Format, Binary.Data.GetData());
+		Binary.Data.SetNum(Length);
+
+		FArchive* Ar = IFileManager::Get().CreateFileWriter(*Filename, FILEWRITE_Append);
+		if (Ar)
+		{
+			FSHAHash SavedKey = Key;
+			SerializeBinary(*Ar, SavedKey, Binary);
+			delete Ar;
+		}
+	}
+
+private:
+	enum { CacheFileVersion = 1 };
+
+	struct FProgramBinary
+	{
+		GLenum Format;
+		TArray<uint8> Data;
+	};
+
+	FOpenGLProgramBinaryCache()
+		: bEnabled(OpenGLConsoleVariables::bUseProgramBinaryCache && FOpenGL::SupportsProgramBinary())
+	{
+		if (!bEnabled)
+		{
+			return;
+		}
+
+		Filename = FPaths::GameSavedDir() / TEXT("OpenGL") / TEXT("ProgramBinaries.bin");
+		DriverString = FString::Printf(TEXT("%s;%s;%s"),
+			ANSI_TO_TCHAR((const ANSICHAR*)glGetString(GL_VENDOR)),
+			ANSI_TO_TCHAR((const ANSICHAR*)glGetString(GL_RENDERER)),
+			ANSI_TO_TCHAR((const ANSICHAR*)glGetString(GL_VERSION)));
+
+		bool bFileIsValid = false;
+		FArchive* Ar = IFileManager::Get().CreateFileReader(*Filename);
+		if (Ar)
+		{
+			int32 FileVersion = 0;
+			FString FileDriverString;
+			*Ar << FileVersion;
+			if (FileVersion == CacheFileVersion)
+			{
+				*Ar << FileDriverString;
+			}
+
+			bFileIsValid = !Ar->IsError() && FileVersion == CacheFileVersion && FileDriverString == DriverString;
+			while (bFileIsValid && Ar->Tell() < Ar->TotalSize())
+			{
+				FSHAHash Key;
+				FProgramBinary Binary;
+				SerializeBinary(*Ar, Key, Binary);
+
+				// a binary cut short by a crash invalidates the rest of the file
+				bFileIsValid = !Ar->IsError();
+				if (bFileIsValid)
+				{
+					Binaries.Add(Key, Binary);
+				}
+			}
+			delete Ar;
+		}
+
+		if (!bFileIsValid)
+		{
+			// start over with the binaries that could be read
+			WriteFile();
+		}
+
+		UE_LOG(LogRHI, Log, TEXT("Loaded %d program binaries from %s"), Binaries.Num(), *Filename);
+	}
+
+	static void SerializeBinary(FArchive& Ar, FSHAHash& Key, FProgramBinary& Binary)
+	{
+		uint32 Format = Binary.Format;
+		Ar << Key;
+		Ar << Format;
+		Ar << Binary.Data;
+		Binary.Format = Format;
+	}
+
+	void WriteFile()
+	{
+		FArchive* Ar = IFileManager::Get().CreateFileWriter(*Filename);
+		if (!Ar)
+		{
+			UE_LOG(LogRHI, Warning, TEXT("Could not write the program binary cache %s, it is disabled"), *Filename);
+			bEnabled = false;
+			return;
+		}
+
+		int32 FileVersion = CacheFileVersion;
+		*Ar << FileVersion;
+		*Ar << DriverString;
+		for (TMap<FSHAHash, FProgramBinary>::TIterator It(Binaries); It; ++It)
+		{
+			FSHAHash Key = It.Key();
+			SerializeBinary(*Ar, Key, It.Value());
+		}
+		delete Ar;
+	}
+
+	bool bEnabled;
+	FString Filename;
+	FString DriverString;
+	TMap<FSHAHash, FProgramBinary> Binaries;
+};
+
 // This short queue preceding released programs cache is here because usually the programs are requested again
 // very shortly after they're released, so looking through recently released programs first provides tangible
 // performance improvement.
@@ -1249,96 +1457,110 @@ static FOpenGLLinkedProgram* LinkProgram( const FOpenGLLinkedProgramConfiguratio
 	check( (Config.Shaders[CrossCompiler::SHADER_STAGE_VERTEX].Resource == 0) != (Config.Shaders[CrossCompiler::SHADER_STAGE_COMPUTE].Resource == 0));
 	check( (Config.Shaders[CrossCompiler::SHADER_STAGE_PIXEL].Resource == 0) != (Config.Shaders[CrossCompiler::SHADER_STAGE_COMPUTE].Resource == 0));
 
-	if (Config.Shaders[CrossCompiler::SHADER_STAGE_VERTEX].Resource)
-	{
-		glAttachShader(Program, Config.Shaders[CrossCompiler::SHADER_STAGE_VERTEX].Resource);
-	}
-	if (Config.Shaders[CrossCompiler::SHADER_STAGE_PIXEL].Resource)
-	{
-		glAttachShader(Program, Config.Shaders[CrossCompiler::SHADER_STAGE_PIXEL].Resource);
-	}
-	if (Config.Shaders[CrossCompiler::SHADER_STAGE_GEOMETRY].Resource)
-	{
-		glAttachShader(Program, Config.Shaders[CrossCompiler::SHADER_STAGE_GEOMETRY].Resource);
-	}
-	if (Config.Shaders[CrossCompiler::SHADER_STAGE_HULL].Resource)
-	{
-		glAttachShader(Program, Config.Shaders[CrossCompiler::SHADER_STAGE_HULL].Resource);
-	}
-	if (Config.Shaders[CrossCompiler::SHADER_STAGE_DOMAIN].Resource)
+	FOpenGLProgramBinaryCache& BinaryCache = FOpenGLProgramBinaryCache::Get();
+	const FSHAHash BinaryKey = BinaryCache.IsEnabled() ? FOpenGLProgramBinaryCache::GetProgramKey(Config) : FSHAHash();
+	if (!BinaryCache.IsEnabled() || !BinaryCache.LoadProgram(BinaryKey, Program))
 	{
-		glAttachShader(Program, Config.Shaders[CrossCompiler::SHADER_STAGE_DOMAIN].Resource);
-	}
-	if (Config.Shaders[CrossCompiler::SHADER_STAGE_COMPUTE].Resource)
-	{
-		glAttachShader(Program, Config.Shaders[CrossCompiler::SHADER_STAGE_COMPUTE].Resource);
-	}
-	
-	// E.g. GLSL_430 uses layout(location=xx) instead of having to call glBindAttribLocation and glBindFragDataLocation
-	if (OpenGLShaderPlatformNeedsBindLocation(GMaxRHIShaderPlatform))
-	{
-		// Bind attribute indices.
 		if (Config.Shaders[CrossCompiler::SHADER_STAGE_VERTEX].Resource)
 		{
-			uint32 Mask = Config.Shaders[CrossCompiler::SHADER_STAGE_VERTEX].Bindings.InOutMask;
-			uint32 Index = 0;
-			FCStringAnsi::Strcpy(Buf, "in_ATTRIBUTE");
-			while (Mask)
+			glAttachShader(Program, Config.Shaders[CrossCompiler::SHADER_STAGE_VERTEX].Resource);
+		}
+		if (Config.Shaders[CrossCompiler::SHADER_STAGE_PIXEL].Resource)
+		{
+			glAttachShader(Program, Config.Shaders[CrossCompiler::SHADER_STAGE_PIXEL].Resource);
+		}
+		if (Config.Shaders[CrossCompiler::SHADER_STAGE_GEOMETRY].Resource)
+		{
+			glAttachShader(Program, Config.Shaders[CrossCompiler::SHADER_STAGE_GEOMETRY].Resource);
+		}
+		if (Config.Shaders[CrossCompiler::SHADER_STAGE_HULL].Resource)
+		{
+			glAttachShader(Program, Config.Shaders[CrossCompiler::SHADER_STAGE_HULL].Resource);
+		}
+		if (Config.Shaders[CrossCompiler::SHADER_STAGE_DOMAIN].Resource)
+		{
+			glAttachShader(Program, Config.Shaders[CrossCompiler::SHADER_STAGE_DOMAIN].Resource);
+		}
+		if (Config.Shaders[CrossCompiler::SHADER_STAGE_COMPUTE].Resource)
+		{
+			glAttachShader(Program, Config.Shaders[CrossCompiler::SHADER_STAGE_COMPUTE].Resource);
+		}
+	
+		// E.g. GLSL_430 uses layout(location=xx) instead of having to call glBindAttribLocation and glBindFragDataLocation
+		if (OpenGLShaderPlatformNeedsBindLocation(GMaxRHIShaderPlatform))
+		{
+			// Bind attribute indices.
+			if (Config.Shaders[CrossCompiler::SHADER_STAGE_VERTEX].Resource)
 			{
-				if (Mask & 0x1)
+				uint32 Mask = Config.Shaders[CrossCompiler::SHADER_STAGE_VERTEX].Bindings.InOutMask;
+				uint32 Index = 0;
+				FCStringAnsi::Strcpy(Buf, "in_ATTRIBUTE");
+				while (Mask)
 				{
-					if (Index < 10)
-					{
-						Buf[12] = '0' + Index;
-						Buf[13] = 0;
-					}
-					else
+					if (Mask & 0x1)
 					{
-						Buf[12] = '1';
-						Buf[13] = '0' + (Index % 10);
-						Buf[14] = 0;
+						if (Index < 10)
+						{
+							Buf[12] = '0' + Index;
+							Buf[13] = 0;
+						}
+						else
+						{
+							Buf[12] = '1';
+							Buf[13] = '0' + (Index % 10);
+							Buf[14] = 0;
+						}
+					glBindAttribLocation(Program, Index, Buf);
 					}
-				glBindAttribLocation(Program, Index, Buf);
+					Index++;
+					Mask >>= 1;
 				}
-				Index++;
-				Mask >>= 1;
 			}
-		}
 
-		// Bind frag data locations.
-		if (Config.Shaders[CrossCompiler::SHADER_STAGE_PIXEL].Resource)
-		{
-			uint32 Mask = (Config.Shaders[CrossCompiler::SHADER_STAGE_PIXEL].Bindings.InOutMask) & 0x7fff; // mask out the depth bit
-			uint32 Index = 0;
-			FCStringAnsi::Strcpy(Buf, "out_Target");
-			while (Mask)
+			// Bind frag data locations.
+			if (Config.Shaders[CrossCompiler::SHADER_STAGE_PIXEL].Resource)
 			{
-				if (Mask & 0x1)
+				uint32 Mask = (Config.Shaders[CrossCompiler::SHADER_STAGE_PIXEL].Bindings.InOutMask) & 0x7fff; // mask out the depth bit
+				uint32 Index = 0;
+				FCStringAnsi::Strcpy(Buf, "out_Target");
+				while (Mask)
 				{
-					if (Index < 10)
-					{
-						Buf[10] = '0' + Index;
-						Buf[11] = 0;
-					}
-					else
+					if (Mask & 0x1)
 					{
-						Buf[10] = '1';
-						Buf[11] = '0' + (Index % 10);
-						Buf[12] = 0;
+						if (Index < 10)
+						{
+							Buf[10] = '0' + Index;
+							Buf[11] = 0;
+						}
+						else
+						{
+							Buf[10] = '1';
+							Buf[11] = '0' + (Index % 10);
+							Buf[12] = 0;
+						}
+						FOpenGL::BindFragDataLocation(Program, Index, Buf);
 					}
-					FOpenGL::BindFragDataLocation(Program, Index, Buf);
+					Index++;
+					Mask >>= 1;
 				}
-				Index++;
-				Mask >>= 1;
 			}
 		}
-	}
 
-	// Link.
-	glLinkProgram(Program);
-	if (!VerifyLinkedProgram(Program))
-	{
-		return NULL;
+		// Link.
+		if (BinaryCache.IsEnabled())
+		{
+			FOpenGL::ProgramParameter(Program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		}
+		glLinkProgram(Program);
+		if (!VerifyLinkedProgram(Program))
+		{
+			return NULL;
+		}
+
+		if (BinaryCache.IsEnabled())
+		{
+			BinaryCache.SaveProgram(BinaryKey, Program);
+		}
 	}
 
 	FOpenGLLinkedProgram* LinkedProgram = new FOpenGLLinkedProgram;
@@ -1435,6 +1657,7 @@ FComputeShaderRHIRef FOpenGLDynamicRHI::RHICreateComputeShader(const TArray<uint
 
 	Config.Shaders[CrossCompiler::SHADER_STAGE_COMPUTE].Resource = ComputeShader->Resource;
 	Config.Shaders[CrossCompiler::SHADER_STAGE_COMPUTE].Bindings = ComputeShader->Bindings;
+	Config.Shaders[CrossCompiler::SHADER_STAGE_COMPUTE].Hash = ComputeShader->Hash;
 
 	ComputeShader->LinkedProgram = LinkProgram( Config);
 
@@ -1507,12 +1730,15 @@ FBoundShaderStateRHIRef FOpenGLDynamicRHI::RHICreateBoundShaderState(
 		// Fill-in the configuration
 		Config.Shaders[CrossCompiler::SHADER_STAGE_VERTEX].Bindings = VertexShader->Bindings;
 		Config.Shaders[CrossCompiler::SHADER_STAGE_VERTEX].Resource = VertexShader->Resource;
+		Config.Shaders[CrossCompiler::SHADER_STAGE_VERTEX].Hash = VertexShader->Hash;
 		Config.Shaders[CrossCompiler::SHADER_STAGE_PIXEL].Bindings = PixelShader->Bindings;
 		Config.Shaders[CrossCompiler::SHADER_STAGE_PIXEL].Resource = PixelShader->Resource;
+		Config.Shaders[CrossCompiler::SHADER_STAGE_PIXEL].Hash = PixelShader->Hash;
 		if (GeometryShader)
 		{
 			Config.Shaders[CrossCompiler::SHADER_STAGE_GEOMETRY].Bindings = GeometryShader->Bindings;
 			Config.Shaders[CrossCompiler::SHADER_STAGE_GEOMETRY].Resource = GeometryShader->Resource;
+			Config.Shaders[CrossCompiler::SHADER_STAGE_GEOMETRY].Hash = GeometryShader->Hash;
 		}
 
 		if ( FOpenGL::SupportsTessellation())
@@ -1521,11 +1747,13 @@ FBoundShaderStateRHIRef FOpenGLDynamicRHI::RHICreateBoundShaderState(
 			{
 				Config.Shaders[CrossCompiler::SHADER_STAGE_HULL].Bindings = HullShader->Bindings;
 				Config.Shaders[CrossCompiler::SHADER_STAGE_HULL].Resource = HullShader->Resource;
+				Config.Shaders[CrossCompiler::SHADER_STAGE_HULL].Hash = HullShader->Hash;
 			}
 			if ( DomainShader)
 			{
 				Config.Shaders[CrossCompiler::SHADER_STAGE_DOMAIN].Bindings = DomainShader->Bindings;
 				Config.Shaders[CrossCompiler::SHADER_STAGE_DOMAIN].Resource = DomainShader->Resource;
+				Config.Shaders[CrossCompiler::SHADER_STAGE_DOMAIN].Hash = DomainShader->Hash;
 			}
 		}
 
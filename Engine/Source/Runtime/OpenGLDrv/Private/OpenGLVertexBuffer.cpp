@@ -37,6 +37,15 @@ static uint32 FreeSpace = 0;
 static uint32 OffsetVB = 0;
 static const uint32 PerFrameMax = 1024*1024*4;
 
+/** Fence issued at the start of a frame, signaled once the GPU is done with the copies retired in the frames before it */
+struct PoolFrameFence
+{
+	UGLsync Sync;
+	int32 Frame;
+};
+
+static TArray<PoolFrameFence> FrameFences;
+
 void* GetAllocation( void* Target, uint32 Size, uint32 Offset)
 {
 	if (FOpenGL::SupportsBufferStorage() && OpenGLConsoleVariables::bUseStagingBuffer)
@@ -121,14 +130,31 @@ bool RetireAllocation( FOpenGLVertexBuffer* Target)
 
 void BeginFrame_VertexBufferCleanup()
 {
-	if (GFrameNumberRenderThread < 3)
+	if (PoolVB == 0)
 	{
 		return;
 	}
 
-	int32 NumToRetire = 0;
-	int32 FrameToRecover = GFrameNumberRenderThread - 3;
+	// The copies out of the pool are retired with the frame that issued them, so the space can be reused as soon as the
+	// GPU has gone past the fence of a later frame instead of assuming it is never more than 3 frames behind
+	int32 FrameToRecover = -1;
+	while (FrameFences.Num())
+	{
+		const FOpenGL::EFenceResult Result = FOpenGL::ClientWaitSync(FrameFences[0].Sync, 0, 0);
+		if (Result != FOpenGL::FR_AlreadySignaled && Result != FOpenGL::FR_ConditionSatisfied)
+		{
+			break;
+		}
+		FrameToRecover = FrameFences[0].Frame;
+		FOpenGL::DeleteSync(FrameFences[0].Sync);
+		FrameFences.RemoveAt(0);
+	}
+
+	PoolFrameFence* Fence = new(FrameFences) PoolFrameFence;
+	Fence->Sync = FOpenGL::FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	Fence->Frame = GFrameNumberRenderThread - 1;
 
+	int32 NumToRetire = 0;
 	while (NumToRetire < AllocationList.Num())
 	{
 		PoolAllocation *Alloc = AllocationList[NumToRetire];
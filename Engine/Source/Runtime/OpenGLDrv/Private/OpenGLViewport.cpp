@@ -202,6 +202,12 @@ bool FOpenGLDynamicRHI::RHIIsDrawingViewport()
 	return DrawingViewport != NULL;
 }
 
+#if PLATFORM_SUPPORTS_RHI_THREAD
+void FOpenGLDynamicRHI::RHIAdvanceFrameForGetViewportBackBuffer()
+{
+}
+#endif
+
 #endif
 
 FTexture2DRHIRef FOpenGLDynamicRHI::RHIGetViewportBackBuffer(FViewportRHIParamRef ViewportRHI)
@@ -348,6 +348,9 @@
 	EnumMacro(PFNGLMAKETEXTUREHANDLERESIDENTNVPROC, glMakeTextureHandleResidentARB)\
 	EnumMacro(PFNGLUNIFORMHANDLEUI64NVPROC, glUniformHandleui64ARB)\
 	EnumMacro(PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC, glMakeTextureHandleNonResidentARB)\
+	EnumMacro(PFNGLGETPROGRAMBINARYPROC, glGetProgramBinary)\
+	EnumMacro(PFNGLPROGRAMBINARYPROC, glProgramBinary)\
+	EnumMacro(PFNGLPROGRAMPARAMETERIPROC, glProgramParameteri)\
 	EnumMacro(PFNGLPUSHDEBUGGROUPPROC, glPushDebugGroupKHR)\
 	EnumMacro(PFNGLPOPDEBUGGROUPPROC, glPopDebugGroupKHR)\
 	EnumMacro(PFNGLOBJECTLABELPROC, glObjectLabelKHR)\
@@ -530,6 +533,26 @@ struct FWindowsOpenGL : public FOpenGL4
 		glUniformHandleui64ARB( Location, Value);
 	}
 
+	static FORCEINLINE bool SupportsProgramBinary()
+	{
+		return glGetProgramBinary != NULL && glProgramBinary != NULL && glProgramParameteri != NULL;
+	}
+
+	static FORCEINLINE void GetProgramBinary(GLuint Program, GLsizei BufSize, GLsizei* Length, GLenum* BinaryFormat, void* Binary)
+	{
+		glGetProgramBinary(Program, BufSize, Length, BinaryFormat, Binary);
+	}
+
+	static FORCEINLINE void ProgramBinary(GLuint Program, GLenum BinaryFormat, const void* Binary, GLsizei Length)
+	{
+		glProgramBinary(Program, BinaryFormat, Binary, Length);
+	}
+
+	static FORCEINLINE void ProgramParameter(GLuint Program, GLenum PName, GLint Value)
+	{
+		glProgramParameteri(Program, PName, Value);
+	}
+
 };
 
 #else
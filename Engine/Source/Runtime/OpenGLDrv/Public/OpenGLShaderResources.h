@@ -226,6 +226,9 @@ public:
 	/** External bindings for this shader. */
 	FOpenGLShaderBindings Bindings;
 
+	/** Hash of the code, identifies the programs using this shader in the program binary cache. */
+	FSHAHash Hash;
+
 	// List of memory copies from RHIUniformBuffer to packed uniforms
 	TArray<FOpenGLUniformBufferCopyInfo> UniformBuffersCopyInfo;
 
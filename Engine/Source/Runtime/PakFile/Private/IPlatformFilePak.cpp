@@ -12,6 +12,7 @@
 #include "PublicKey.inl"
 #include "AES.h"
 #include "GenericPlatformChunkInstall.h"
+#include "ParallelFor.h"
 
 DEFINE_LOG_CATEGORY(LogPakFile);
 
@@ -78,33 +79,10 @@ template< typename EncryptionPolicy = FPakNoEncryption >
 class FPakCompressedReaderPolicy
 {
 public:
-	class FPakUncompressTask : public FNonAbandonableTask
+	enum
 	{
-	public:
-		uint8*				UncompressedBuffer;
-		int32				UncompressedSize;
-		uint8*				CompressedBuffer;
-		int32				CompressedSize;
-		ECompressionFlags	Flags;
-		void*				CopyOut;
-		int64				CopyOffset;
-		int64				CopyLength;
-
-		void DoWork()
-		{
-			// Decrypt and Uncompress from memory to memory.
-			int64 EncryptionSize = EncryptionPolicy::AlignReadRequest(CompressedSize);
-			EncryptionPolicy::DecryptBlock(CompressedBuffer, EncryptionSize);
-			FCompression::UncompressMemory(Flags, UncompressedBuffer, UncompressedSize, CompressedBuffer, CompressedSize, false);
-			if (CopyOut)
-			{
-				FMemory::Memcpy(CopyOut, UncompressedBuffer+CopyOffset, CopyLength);
-			}
-		}
-		static const TCHAR *Name()
-		{
-			return TEXT("FPakUncompressTask");
-		}
+		/** Max number of blocks read with a single request and decompressed in parallel. */
+		MaxBlocksPerBatch = 32,
 	};
 
 	FPakCompressedReaderPolicy(const FPakFile& InPakFile, const FPakEntry& InPakEntry, FArchive* InPakReader)
@@ -129,77 +107,57 @@ public:
 	void Serialize(int64 DesiredPosition, void* V, int64 Length)
 	{
 		const int32 CompressionBlockSize = PakEntry.CompressionBlockSize;
-		uint32 CompressionBlockIndex = DesiredPosition / CompressionBlockSize;
-		uint8* WorkingBuffers[2];
-		int64 DirectCopyStart = DesiredPosition % PakEntry.CompressionBlockSize;
-		FAsyncTask<FPakUncompressTask> UncompressTask;
+		const ECompressionFlags Flags = (ECompressionFlags)PakEntry.CompressionMethod;
 		FCompressionScratchBuffers& ScratchSpace = FCompressionScratchBuffers::Get();
-		bool bStartedUncompress = false;
-
-		int64 WorkingBufferRequiredSize = FCompression::CompressMemoryBound((ECompressionFlags)PakEntry.CompressionMethod,CompressionBlockSize);
-		WorkingBufferRequiredSize = EncryptionPolicy::AlignReadRequest(WorkingBufferRequiredSize);
-		ScratchSpace.EnsureBufferSpace(CompressionBlockSize, WorkingBufferRequiredSize*2);
-		WorkingBuffers[0] = ScratchSpace.ScratchBuffer;
-		WorkingBuffers[1] = ScratchSpace.ScratchBuffer + WorkingBufferRequiredSize;
 
 		while (Length > 0)
 		{
-			const FPakCompressedBlock& Block = PakEntry.CompressionBlocks[CompressionBlockIndex];
-			int64 Pos = CompressionBlockIndex * CompressionBlockSize;
-			int64 CompressedBlockSize = Block.CompressedEnd-Block.CompressedStart;
-			int64 UncompressedBlockSize = FMath::Min<int64>(PakEntry.UncompressedSize-Pos, PakEntry.CompressionBlockSize);
-			int64 ReadSize = EncryptionPolicy::AlignReadRequest(CompressedBlockSize);
-			int64 WriteSize = FMath::Min<int64>(UncompressedBlockSize - DirectCopyStart, Length);
-			PakReader->Seek(Block.CompressedStart);
-			PakReader->Serialize(WorkingBuffers[CompressionBlockIndex & 1],ReadSize);
-			if (bStartedUncompress)
-			{
-				UncompressTask.EnsureCompletion();
-				bStartedUncompress = false;
-			}
-
-			FPakUncompressTask& TaskDetails = UncompressTask.GetTask();
-			if (DirectCopyStart == 0 && Length >= CompressionBlockSize)
-			{
-				// Block can be decompressed directly into output buffer
-				TaskDetails.Flags = (ECompressionFlags)PakEntry.CompressionMethod;
-				TaskDetails.UncompressedBuffer = (uint8*)V;
-				TaskDetails.UncompressedSize = UncompressedBlockSize;
-				TaskDetails.CompressedBuffer = WorkingBuffers[CompressionBlockIndex & 1];
-				TaskDetails.CompressedSize = CompressedBlockSize;
-				TaskDetails.CopyOut = nullptr;
-			}
-			else
-			{
-				// Block needs to be copied from a working buffer
-				TaskDetails.Flags = (ECompressionFlags)PakEntry.CompressionMethod;
-				TaskDetails.UncompressedBuffer = (uint8*)ScratchSpace.TempBuffer;
-				TaskDetails.UncompressedSize = UncompressedBlockSize;
-				TaskDetails.CompressedBuffer = WorkingBuffers[CompressionBlockIndex & 1];
-				TaskDetails.CompressedSize = CompressedBlockSize;
-				TaskDetails.CopyOut = V;
-				TaskDetails.CopyOffset = DirectCopyStart;
-				TaskDetails.CopyLength = WriteSize;
-			}
-			
-			if (Length == WriteSize)
-			{
-				UncompressTask.StartSynchronousTask();
-			}
-			else
+			// Only the blocks overlapping the request are read. They're stored back to back, so a batch is a single read
+			const int32 FirstBlock = DesiredPosition / CompressionBlockSize;
+			const int32 LastBlock = FMath::Min<int64>((DesiredPosition + Length - 1) / CompressionBlockSize, FirstBlock + MaxBlocksPerBatch - 1);
+			const FPakCompressedBlock& LastCompressedBlock = PakEntry.CompressionBlocks[LastBlock];
+			const int64 BatchStart = PakEntry.CompressionBlocks[FirstBlock].CompressedStart;
+			const int64 BatchSize = LastCompressedBlock.CompressedStart - BatchStart + EncryptionPolicy::AlignReadRequest(LastCompressedBlock.CompressedEnd - LastCompressedBlock.CompressedStart);
+			ScratchSpace.EnsureBufferSpace(CompressionBlockSize, BatchSize);
+			uint8* CompressedBatch = ScratchSpace.ScratchBuffer;
+			PakReader->Seek(BatchStart);
+			PakReader->Serialize(CompressedBatch, BatchSize);
+
+			const int64 RequestEnd = DesiredPosition + Length;
+			ParallelFor(LastBlock - FirstBlock + 1, [&](int32 Index)
 			{
-				UncompressTask.StartBackgroundTask();
-			}
-			bStartedUncompress = true;
-			V = (void*)((uint8*)V + WriteSize);
-			Length -= WriteSize;
-			DirectCopyStart = 0;
-			++CompressionBlockIndex;
-		}
+				const int32 BlockIndex = FirstBlock + Index;
+				const FPakCompressedBlock& Block = PakEntry.CompressionBlocks[BlockIndex];
+				const int64 BlockPos = (int64)BlockIndex * CompressionBlockSize;
+				const int32 UncompressedBlockSize = (int32)FMath::Min<int64>(PakEntry.UncompressedSize - BlockPos, CompressionBlockSize);
+				const int32 CompressedBlockSize = (int32)(Block.CompressedEnd - Block.CompressedStart);
+				uint8* CompressedData = CompressedBatch + (Block.CompressedStart - BatchStart);
+				EncryptionPolicy::DecryptBlock(CompressedData, EncryptionPolicy::AlignReadRequest(CompressedBlockSize));
+
+				// Part of the request that falls in this block
+				const int64 CopyStart = FMath::Max(DesiredPosition, BlockPos);
+				const int64 CopyEnd = FMath::Min(RequestEnd, BlockPos + UncompressedBlockSize);
+				uint8* Dest = (uint8*)V + (CopyStart - DesiredPosition);
+				if (CopyStart == BlockPos && CopyEnd == BlockPos + UncompressedBlockSize)
+				{
+					// Block can be decompressed directly into output buffer
+					FCompression::UncompressMemory(Flags, Dest, UncompressedBlockSize, CompressedData, CompressedBlockSize, false);
+				}
+				else
+				{
+					// Block needs to be copied from a working buffer of the thread doing the work
+					FCompressionScratchBuffers& ThreadScratchSpace = FCompressionScratchBuffers::Get();
+					ThreadScratchSpace.EnsureBufferSpace(CompressionBlockSize, 0);
+					uint8* TempBuffer = ThreadScratchSpace.TempBuffer;
+					FCompression::UncompressMemory(Flags, TempBuffer, UncompressedBlockSize, CompressedData, CompressedBlockSize, false);
+					FMemory::Memcpy(Dest, TempBuffer + (CopyStart - BlockPos), CopyEnd - CopyStart);
+				}
+			});
 
-		if(bStartedUncompress)
-		{
-			UncompressTask.EnsureCompletion();
+			const int64 BatchLength = FMath::Min<int64>(RequestEnd, (int64)(LastBlock + 1) * CompressionBlockSize) - DesiredPosition;
+			V = (void*)((uint8*)V + BatchLength);
+			DesiredPosition += BatchLength;
+			Length -= BatchLength;
 		}
 	}
 };
@@ -234,6 +192,8 @@ FPakFile::FPakFile(const TCHAR* Filename, bool bIsSigned)
 	: PakFilename(Filename)
 	, bSigned(bIsSigned)
 	, bIsValid(false)
+	, MappedPak(NULL)
+	, bDirectoryIndexBuilt(false)
 {
 	FArchive* Reader = GetSharedReader(NULL);
 	if (Reader)
@@ -247,6 +207,8 @@ FPakFile::FPakFile(IPlatformFile* LowerLevel, const TCHAR* Filename, bool bIsSig
 	: PakFilename(Filename)
 	, bSigned(bIsSigned)
 	, bIsValid(false)
+	, MappedPak(NULL)
+	, bDirectoryIndexBuilt(false)
 {
 	FArchive* Reader = GetSharedReader(LowerLevel);
 	if (Reader)
@@ -259,12 +221,51 @@ FPakFile::FPakFile(IPlatformFile* LowerLevel, const TCHAR* Filename, bool bIsSig
 FPakFile::FPakFile(FArchive* Archive)
 	: bSigned(false)
 	, bIsValid(false)
+	, MappedPak(NULL)
+	, bDirectoryIndexBuilt(false)
 {
 	Initialize(Archive);
 }
 
 FPakFile::~FPakFile()
 {
+	if (MappedPak)
+	{
+		FPlatformMemory::UnmapFile(MappedPak);
+		MappedPak = NULL;
+	}
+}
+
+bool FPakFile::MapPak()
+{
+#if PLATFORM_64BITS
+	// Signed paks have to go through the signature checks of the reader, and archive backed paks have no file to map
+	if (!MappedPak && bIsValid && !bSigned && !PakFilename.IsEmpty())
+	{
+		MappedPak = FPlatformMemory::MapFile(*PakFilename);
+		if (MappedPak && MappedPak->GetSize() < Info.IndexOffset + Info.IndexSize + Info.GetSerializedSize())
+		{
+			UE_LOG(LogPakFile, Warning, TEXT("Mapped pak \"%s\" size doesn't match its info, falling back to regular reads."), *PakFilename);
+			FPlatformMemory::UnmapFile(MappedPak);
+			MappedPak = NULL;
+		}
+	}
+#endif
+	return MappedPak != NULL;
+}
+
+const uint8* FPakFile::GetMappedEntryData(const FPakEntry& Entry) const
+{
+	if (!MappedPak || Entry.CompressionMethod != COMPRESS_None || Entry.bEncrypted)
+	{
+		return NULL;
+	}
+	const int64 OffsetToFile = Entry.Offset + Entry.GetSerializedSize(Info.Version);
+	if (OffsetToFile + Entry.Size > MappedPak->GetSize())
+	{
+		return NULL;
+	}
+	return MappedPak->GetData() + OffsetToFile;
 }
 
 FArchive* FPakFile::CreatePakReader(const TCHAR* Filename)
@@ -346,6 +347,28 @@ void FPakFile::LoadIndex(FArchive* Reader)
 		// Allocate enough memory to hold all entries (and not reallocate while they're being added to it).
 		Files.Empty(NumEntries);
 
+		if (Info.Version >= FPakInfo::PakFile_Version_PathHashIndex)
+		{
+			// Sorted path hashes and the packed entries, no filenames are needed to look files up
+			PathHashes.AddUninitialized(NumEntries);
+			PathHashEntries.AddUninitialized(NumEntries);
+			for (int32 HashIndex = 0; HashIndex < NumEntries; HashIndex++)
+			{
+				IndexReader << PathHashes[HashIndex];
+				IndexReader << PathHashEntries[HashIndex];
+			}
+			Files.AddDefaulted(NumEntries);
+			for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+			{
+				Files[EntryIndex].Serialize(IndexReader, Info.Version);
+			}
+
+			// The filenames are only needed for directory iteration, keep them serialized until then
+			const int64 FilenamesOffset = IndexReader.Tell();
+			PackedFilenames.Append(IndexData.GetData() + FilenamesOffset, IndexData.Num() - FilenamesOffset);
+			return;
+		}
+
 		for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
 		{
 			// Serialize from memory.
@@ -358,44 +381,96 @@ void FPakFile::LoadIndex(FArchive* Reader)
 			Files.Add(Entry);
 
 			// Construct Index of all directories in pak file.
-			FString Path = FPaths::GetPath(Filename);
-			MakeDirectoryFromPath(Path);
-			FPakDirectory* Directory = Index.Find(Path);
-			if (Directory != NULL)
+			AddEntryToIndex(Filename, &Files.Last());
+		}
+		bDirectoryIndexBuilt = true;
+	}
+}
+
+void FPakFile::AddEntryToIndex(const FString& Filename, FPakEntry* Entry) const
+{
+	FString Path = FPaths::GetPath(Filename);
+	MakeDirectoryFromPath(Path);
+	FPakDirectory* Directory = Index.Find(Path);
+	if (Directory != NULL)
+	{
+		Directory->Add(Filename, Entry);	
+	}
+	else
+	{
+		FPakDirectory NewDirectory;
+		NewDirectory.Add(Filename, Entry);
+		Index.Add(Path, NewDirectory);
+
+		// add the parent directories up to the mount point
+		while (MountPoint != Path)
+		{
+			Path = Path.Left(Path.Len()-1);
+			int32 Offset = 0;
+			if (Path.FindLastChar('/', Offset))
 			{
-				Directory->Add(Filename, &Files.Last());	
+				Path = Path.Left(Offset);
+				MakeDirectoryFromPath(Path);
+				if (Index.Find(Path) == NULL)
+				{
+					FPakDirectory ParentDirectory;
+					Index.Add(Path, ParentDirectory);
+				}
 			}
 			else
 			{
-				FPakDirectory NewDirectory;
-				NewDirectory.Add(Filename, &Files.Last());
-				Index.Add(Path, NewDirectory);
-
-				// add the parent directories up to the mount point
-				while (MountPoint != Path)
-				{
-					Path = Path.Left(Path.Len()-1);
-					int32 Offset = 0;
-					if (Path.FindLastChar('/', Offset))
-					{
-						Path = Path.Left(Offset);
-						MakeDirectoryFromPath(Path);
-						if (Index.Find(Path) == NULL)
-						{
-							FPakDirectory ParentDirectory;
-							Index.Add(Path, ParentDirectory);
-						}
-					}
-					else
-					{
-						Path = MountPoint;
-					}
-				}
+				Path = MountPoint;
 			}
 		}
 	}
 }
 
+void FPakFile::BuildDirectoryIndex() const
+{
+	FScopeLock ScopedLock(&DirectoryIndexCritical);
+	if (!bDirectoryIndexBuilt)
+	{
+		FMemoryReader FilenamesReader(PackedFilenames);
+		for (int32 EntryIndex = 0; EntryIndex < Files.Num(); EntryIndex++)
+		{
+			FString Filename;
+			FilenamesReader << Filename;
+			AddEntryToIndex(Filename, const_cast<FPakEntry*>(&Files[EntryIndex]));
+		}
+		PackedFilenames.Empty();
+
+		// Make sure the index is complete before other threads can see the flag
+		FPlatformMisc::MemoryBarrier();
+		bDirectoryIndexBuilt = true;
+	}
+}
+
+const FPakEntry* FPakFile::FindHashed(const TCHAR* RelativeFilename) const
+{
+	const uint64 Hash = HashPath(RelativeFilename);
+
+	// Binary search, UnrealPak makes sure that hashes are unique within a pak
+	int32 Min = 0;
+	int32 Max = PathHashes.Num();
+	while (Min < Max)
+	{
+		const int32 Middle = Min + (Max - Min) / 2;
+		if (PathHashes[Middle] < Hash)
+		{
+			Min = Middle + 1;
+		}
+		else
+		{
+			Max = Middle;
+		}
+	}
+	if (Min < PathHashes.Num() && PathHashes[Min] == Hash)
+	{
+		return &Files[PathHashEntries[Min]];
+	}
+	return NULL;
+}
+
 FArchive* FPakFile::GetSharedReader(IPlatformFile* LowerLevel)
 {
 	uint32 Thread = FPlatformTLS::GetCurrentThreadId();
@@ -488,6 +563,8 @@ void FPakPlatformFile::HandlePakListCommand(const TCHAR* Cmd, FOutputDevice& Ar)
 FPakPlatformFile::FPakPlatformFile()
 	: LowerLevel(NULL)
 	, bSigned(false)
+	, bMapPaks(false)
+	, AsyncReadThreadPool(NULL)
 {
 }
 
@@ -495,6 +572,26 @@ FPakPlatformFile::~FPakPlatformFile()
 {
 	FCoreDelegates::OnMountPak.Unbind();
 
+	// Requests that haven't started are cancelled, the ones in flight finish before the threads go away.
+	{
+		TArray<FPakAsyncReadRequest*> QueuedRequests;
+		{
+			FScopeLock ScopedLock(&AsyncReadCritical);
+			QueuedRequests = AsyncReadQueue;
+			AsyncReadQueue.Empty();
+		}
+		for (FPakAsyncReadRequest* Request : QueuedRequests)
+		{
+			Request->Complete(FPakAsyncReadRequest::State_Cancelled);
+		}
+	}
+	if (AsyncReadThreadPool)
+	{
+		AsyncReadThreadPool->Destroy();
+		delete AsyncReadThreadPool;
+		AsyncReadThreadPool = NULL;
+	}
+
 	// We need to flush async IO... if it hasn't been shut down already.
 	if (FIOSystem::HasShutdown() == false)
 	{
@@ -633,6 +730,9 @@ bool FPakPlatformFile::Initialize(IPlatformFile* Inner, const TCHAR* CmdLine)
 #else
 	bSigned = true;
 #endif
+
+	// Uncompressed files are then read straight from the mapping, which also lets processes share the pak pages
+	bMapPaks = PLATFORM_64BITS && !bSigned && FParse::Param(CmdLine, TEXT("MappedPaks"));
 	
 	TArray<FString> PaksToLoad;
 #if !UE_BUILD_SHIPPING
@@ -687,6 +787,10 @@ bool FPakPlatformFile::Mount(const TCHAR* InPakFilename, uint32 PakOrder, const
 			{
 				Pak->SetMountPoint(InPath);
 			}
+			if (bMapPaks && !Pak->MapPak())
+			{
+				UE_LOG(LogPakFile, Warning, TEXT("Failed to map pak \"%s\", using regular reads."), InPakFilename);
+			}
 			{
 				// Add new pak file
 				FScopeLock ScopedLock(&PakListCritical);
@@ -731,6 +835,10 @@ IFileHandle* FPakPlatformFile::CreatePakFileHandle(const TCHAR* Filename, FPakFi
 	{
 		Result = new FPakFileHandle< FPakReaderPolicy<FPakSimpleEncryption> >(*PakFile, *FileEntry, PakReader, true);
 	}
+	else if (PakFile->GetMappedEntryData(*FileEntry))
+	{
+		Result = new FPakFileHandle<FPakMappedReaderPolicy>(*PakFile, *FileEntry, PakReader, true);
+	}
 	else
 	{
 		Result = new FPakFileHandle<>(*PakFile, *FileEntry, PakReader, true);
@@ -763,6 +871,168 @@ IFileHandle* FPakPlatformFile::OpenRead(const TCHAR* Filename)
 	return Result;
 }
 
+bool FPakPlatformFile::GetMappedFileRegion(const TCHAR* Filename, const uint8*& OutData, int64& OutSize)
+{
+	FPakFile* PakFile = NULL;
+	const FPakEntry* FileEntry = FindFileInPakFiles(Filename, &PakFile);
+	const uint8* Data = FileEntry ? PakFile->GetMappedEntryData(*FileEntry) : NULL;
+	if (Data)
+	{
+		OutData = Data;
+		OutSize = FileEntry->Size;
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Work item of the pak async read threads. Each one performs the highest priority request queued at the time it runs.
+ */
+class FPakAsyncReadWork : public FQueuedWork
+{
+	FPakPlatformFile& Owner;
+
+public:
+
+	FPakAsyncReadWork(FPakPlatformFile& InOwner)
+		: Owner(InOwner)
+	{}
+
+	virtual void DoThreadedWork() override
+	{
+		Owner.ProcessNextAsyncRead();
+		delete this;
+	}
+
+	virtual void Abandon() override
+	{
+		delete this;
+	}
+};
+
+FPakAsyncReadRequest::FPakAsyncReadRequest(FPakPlatformFile* InOwner, const TCHAR* InFilename, int64 InOffset, int64 InSize, uint8* InDest, EAsyncIOPriority InPriority, const FPakAsyncReadCallback& InCallback)
+	: Owner(InOwner)
+	, Filename(InFilename)
+	, Offset(InOffset)
+	, Size(InSize)
+	, Dest(InDest)
+	, Priority(InPriority)
+	, Callback(InCallback)
+	, State(State_Queued)
+	, DoneEvent(FPlatformProcess::CreateSynchEvent(true))
+{
+}
+
+FPakAsyncReadRequest::~FPakAsyncReadRequest()
+{
+	// Even if it reports complete, the read thread may still be about to trigger the event
+	if (!Cancel())
+	{
+		WaitCompletion();
+	}
+	delete DoneEvent;
+}
+
+void FPakAsyncReadRequest::Complete(EState FinalState)
+{
+	Callback.ExecuteIfBound(FinalState == State_Succeeded, this);
+	State.Set(FinalState);
+	// The owner may delete the request as soon as this is triggered
+	DoneEvent->Trigger();
+}
+
+void FPakAsyncReadRequest::WaitCompletion()
+{
+	DoneEvent->Wait();
+}
+
+bool FPakAsyncReadRequest::Cancel()
+{
+	{
+		FScopeLock ScopedLock(&Owner->AsyncReadCritical);
+		if (State.GetValue() != State_Queued)
+		{
+			return false;
+		}
+		Owner->AsyncReadQueue.Remove(this);
+	}
+	// The work item that was queued for it just finds one request less in the queue
+	Complete(State_Cancelled);
+	return true;
+}
+
+FPakAsyncReadRequest* FPakPlatformFile::ReadAsync(const TCHAR* Filename, int64 Offset, int64 Size, uint8* Dest, EAsyncIOPriority Priority, FPakAsyncReadCallback Callback)
+{
+	if (FindFileInPakFiles(Filename) == NULL)
+	{
+		return NULL;
+	}
+
+	FPakAsyncReadRequest* Request = new FPakAsyncReadRequest(this, Filename, Offset, Size, Dest, Priority, Callback);
+	if (!FPlatformProcess::SupportsMultithreading())
+	{
+		Request->State.Set(FPakAsyncReadRequest::State_InFlight);
+		Request->Complete(PerformAsyncRead(*Request) ? FPakAsyncReadRequest::State_Succeeded : FPakAsyncReadRequest::State_Failed);
+		return Request;
+	}
+
+	{
+		FScopeLock ScopedLock(&AsyncReadCritical);
+		if (!AsyncReadThreadPool)
+		{
+			// Blocking reads, so a few threads are enough to keep the device busy
+			int32 NumThreads = 2;
+			FParse::Value(FCommandLine::Get(), TEXT("PakAsyncReadThreads="), NumThreads);
+			AsyncReadThreadPool = FQueuedThreadPool::Allocate();
+			verify(AsyncReadThreadPool->Create(FMath::Max(NumThreads, 1), 64 * 1024));
+		}
+
+		// FIFO within the same priority
+		int32 InsertIndex = AsyncReadQueue.Num();
+		while (InsertIndex > 0 && AsyncReadQueue[InsertIndex - 1]->Priority < Priority)
+		{
+			InsertIndex--;
+		}
+		AsyncReadQueue.Insert(Request, InsertIndex);
+	}
+	AsyncReadThreadPool->AddQueuedWork(new FPakAsyncReadWork(*this));
+	return Request;
+}
+
+void FPakPlatformFile::ProcessNextAsyncRead()
+{
+	FPakAsyncReadRequest* Request = NULL;
+	{
+		FScopeLock ScopedLock(&AsyncReadCritical);
+		if (AsyncReadQueue.Num() == 0)
+		{
+			// Cancelled
+			return;
+		}
+		Request = AsyncReadQueue[0];
+		AsyncReadQueue.RemoveAt(0, 1, false);
+		Request->State.Set(FPakAsyncReadRequest::State_InFlight);
+	}
+
+	const bool bSuccess = PerformAsyncRead(*Request);
+	Request->Complete(bSuccess ? FPakAsyncReadRequest::State_Succeeded : FPakAsyncReadRequest::State_Failed);
+}
+
+bool FPakPlatformFile::PerformAsyncRead(FPakAsyncReadRequest& Request)
+{
+	FPakFile* PakFile = NULL;
+	const FPakEntry* FileEntry = FindFileInPakFiles(*Request.Filename, &PakFile);
+	if (FileEntry == NULL || Request.Offset < 0 || Request.Size < 0 || Request.Offset + Request.Size > FileEntry->UncompressedSize)
+	{
+		UE_LOG(LogPakFile, Warning, TEXT("Invalid async read of %s (offset %lld, size %lld)."), *Request.Filename, Request.Offset, Request.Size);
+		return false;
+	}
+
+	// The handle uses the pak reader of this thread, so reads on other threads aren't blocked by it
+	TAutoPtr<IFileHandle> Handle(CreatePakFileHandle(*Request.Filename, PakFile, FileEntry));
+	return Handle.IsValid() && Handle->Seek(Request.Offset) && Handle->Read(Request.Dest, Request.Size);
+}
+
 bool FPakPlatformFile::BufferedCopyFile(IFileHandle& Dest, IFileHandle& Source, const int64 FileSize, uint8* Buffer, const int64 BufferSize) const
 {	
 	int64 RemainingSizeToCopy = FileSize;
@@ -23,8 +23,9 @@ struct FPakInfo
 		PakFile_Version_Initial = 1,
 		PakFile_Version_NoTimestamps = 2,
 		PakFile_Version_CompressionEncryption = 3,
+		PakFile_Version_PathHashIndex = 4,
 
-		PakFile_Version_Latest = PakFile_Version_CompressionEncryption
+		PakFile_Version_Latest = PakFile_Version_PathHashIndex
 	};
 
 	/** Pak file magic value. */
@@ -264,14 +265,26 @@ class PAKFILE_API FPakFile : FNoncopyable
 	FString MountPoint;
 	/** Info on all files stored in pak. */
 	TArray<FPakEntry> Files;	
-	/** Pak Index organized as a map of directories for faster Directory iteration. */
-	TMap<FString, FPakDirectory> Index;
+	/** Pak Index organized as a map of directories for faster Directory iteration. Built on first use when the pak has path hashes. */
+	mutable TMap<FString, FPakDirectory> Index;
+	/** Sorted hashes of the filenames relative to the mount point, empty for paks older than PakFile_Version_PathHashIndex. */
+	TArray<uint64> PathHashes;
+	/** Index in Files of the entry matching each of PathHashes. */
+	TArray<int32> PathHashEntries;
+	/** Serialized filenames of all entries, in Files order, kept until the directory index is built. */
+	mutable TArray<uint8> PackedFilenames;
+	/** True once Index is complete. */
+	mutable volatile bool bDirectoryIndexBuilt;
+	/** Critical section for building Index. */
+	mutable FCriticalSection DirectoryIndexCritical;
 	/** Timestamp of this pak file. */
 	FDateTime Timestamp;	
 	/** True if this is a signed pak file. */
 	bool bSigned;
 	/** True if this pak file is valid and usable */
 	bool bIsValid;
+	/** Read only mapping of the whole pak, NULL unless MapPak succeeded. */
+	FPlatformMemory::FMappedFile* MappedPak;
 
 	FArchive* CreatePakReader(const TCHAR* Filename);
 	FArchive* CreatePakReader(IFileHandle& InHandle, const TCHAR* Filename);
@@ -325,6 +338,32 @@ public:
 		return PakFilename;
 	}
 
+	/**
+	 * Maps the whole pak into the address space so that uncompressed entries can be accessed without copies.
+	 * Only possible on 64 bit platforms and for paks that are not signed.
+	 *
+	 * @return true if the pak is mapped.
+	 */
+	bool MapPak();
+
+	/**
+	 * Checks if the pak file is mapped.
+	 *
+	 * @return true if MapPak succeeded.
+	 */
+	bool IsMapped() const
+	{
+		return MappedPak != NULL;
+	}
+
+	/**
+	 * Gets a view of the data of an entry in the mapped pak.
+	 *
+	 * @param Entry Entry of this pak.
+	 * @return Pointer to the first byte of the file, NULL if the pak isn't mapped or the entry is compressed or encrypted.
+	 */
+	const uint8* GetMappedEntryData(const FPakEntry& Entry) const;
+
 	/**
 	 * Gets pak file index.
 	 *
@@ -332,6 +371,10 @@ public:
 	 */
 	const TMap<FString, FPakDirectory>& GetIndex() const
 	{
+		if (!bDirectoryIndexBuilt)
+		{
+			BuildDirectoryIndex();
+		}
 		return Index;
 	}
 
@@ -351,6 +394,10 @@ public:
 	const FPakEntry* Find(const FString& Filename) const
 	{		
 		const FPakEntry*const * FoundFile = NULL;
+		if (PathHashes.Num())
+		{
+			return Filename.StartsWith(MountPoint) ? FindHashed(*Filename + MountPoint.Len()) : NULL;
+		}
 		if (Filename.StartsWith(MountPoint))
 		{
 			FString Path(FPaths::GetPath(Filename));
@@ -407,7 +454,7 @@ public:
 		if ((Directory.StartsWith(MountPoint)) || (MountPoint.StartsWith(Directory)))
 		{
 			TArray<FString> DirectoriesInPak; // List of all unique directories at path
-			for (TMap<FString, FPakDirectory>::TConstIterator It(Index); It; ++It)
+			for (TMap<FString, FPakDirectory>::TConstIterator It(GetIndex()); It; ++It)
 			{
 				FString PakPath(MountPoint + It.Key());
 				// Check if the file is under the specified path.
@@ -469,7 +516,7 @@ public:
 		// Check the specified path is under the mount point of this pak file.
 		if (Directory.StartsWith(MountPoint))
 		{
-			PakDirectory = Index.Find(Directory.Mid(MountPoint.Len()));
+			PakDirectory = GetIndex().Find(Directory.Mid(MountPoint.Len()));
 		}
 		return PakDirectory;
 	}
@@ -574,8 +621,45 @@ private:
 	 */
 	void LoadIndex(FArchive* Reader);
 
+	/**
+	 * Adds an entry to the directory index, creating its directory and the parent ones if needed.
+	 */
+	void AddEntryToIndex(const FString& Filename, FPakEntry* Entry) const;
+
+	/**
+	 * Builds the directory index from the packed filenames of a pak with path hashes.
+	 */
+	void BuildDirectoryIndex() const;
+
+	/**
+	 * Looks up an entry in the path hashes.
+	 *
+	 * @param RelativeFilename Filename relative to the mount point.
+	 * @return Pointer to pak file entry if the file was found, NULL otherwise.
+	 */
+	const FPakEntry* FindHashed(const TCHAR* RelativeFilename) const;
+
 public:
 
+	/**
+	 * Hashes a filename relative to the mount point for the index lookups. Case insensitive, like the directory index.
+	 *
+	 * @param RelativeFilename Filename to hash.
+	 * @return 64 bit FNV-1a hash of the lower case filename.
+	 */
+	static uint64 HashPath(const TCHAR* RelativeFilename)
+	{
+		uint64 Hash = 0xcbf29ce484222325ull;
+		for (const TCHAR* Char = RelativeFilename; *Char; ++Char)
+		{
+			// Hash UTF-16 code units so that the result is the same whatever the size of TCHAR
+			const uint16 Unit = (uint16)FChar::ToLower(*Char);
+			Hash = (Hash ^ (Unit & 0xff)) * 0x100000001b3ull;
+			Hash = (Hash ^ (Unit >> 8)) * 0x100000001b3ull;
+		}
+		return Hash;
+	}
+
 	/**
 	 * Helper function to append '/' at the end of path.
 	 *
@@ -675,6 +759,41 @@ public:
 	}
 };
 
+/**
+ * Reader policy for uncompressed and unencrypted files of a mapped pak. The pak reader is only used to verify the file header.
+ */
+class PAKFILE_API FPakMappedReaderPolicy
+{
+public:
+	/** Pak file that own this file data */
+	const FPakFile&		PakFile;
+	/** Pak file entry for this file. */
+	const FPakEntry&	PakEntry;
+	/** Pak file archive to read the file header from. */
+	FArchive*			PakReader;
+	/** First byte of the file in the mapped pak. */
+	const uint8*		MappedData;
+
+	FPakMappedReaderPolicy(const FPakFile& InPakFile,const FPakEntry& InPakEntry,FArchive* InPakReader)
+		: PakFile(InPakFile)
+		, PakEntry(InPakEntry)
+		, PakReader(InPakReader)
+	{
+		MappedData = PakFile.GetMappedEntryData(PakEntry);
+		check(MappedData);
+	}
+
+	FORCEINLINE int64 FileSize() const 
+	{
+		return PakEntry.Size;
+	}
+
+	FORCEINLINE void Serialize(int64 DesiredPosition, void* V, int64 Length)
+	{
+		FMemory::Memcpy(V, MappedData + DesiredPosition, Length);
+	}
+};
+
 /**
  * File handle to read from pak file.
  */
@@ -776,6 +895,86 @@ public:
 	/// END IFileHandle Interface
 };
 
+class FPakAsyncReadRequest;
+
+/** Called on a pak read thread once an async read is done, or on the cancelling thread if it never ran. */
+DECLARE_DELEGATE_TwoParams(FPakAsyncReadCallback, bool /*bWasSuccessful*/, FPakAsyncReadRequest* /*Request*/);
+
+/**
+ * Async read of a range of a file stored in a pak, issued by FPakPlatformFile::ReadAsync.
+ * The request is owned by the caller, who deletes it once it has completed.
+ */
+class PAKFILE_API FPakAsyncReadRequest : FNoncopyable
+{
+	friend class FPakPlatformFile;
+
+	enum EState
+	{
+		State_Queued,
+		State_InFlight,
+		State_Succeeded,
+		State_Failed,
+		State_Cancelled,
+	};
+
+	/** Platform file the request is queued on. */
+	class FPakPlatformFile* Owner;
+	/** File in the mounted paks to read from. */
+	FString Filename;
+	/** Offset in the (uncompressed) file. */
+	int64 Offset;
+	/** Number of bytes to read. */
+	int64 Size;
+	/** Destination buffer, at least Size bytes. */
+	uint8* Dest;
+	/** Requests with a higher priority are read first. */
+	EAsyncIOPriority Priority;
+	/** Optional completion callback. */
+	FPakAsyncReadCallback Callback;
+	/** One of EState. */
+	FThreadSafeCounter State;
+	/** Triggered once the request has completed. */
+	FEvent* DoneEvent;
+
+	FPakAsyncReadRequest(FPakPlatformFile* InOwner, const TCHAR* InFilename, int64 InOffset, int64 InSize, uint8* InDest, EAsyncIOPriority InPriority, const FPakAsyncReadCallback& InCallback);
+
+	/** Calls the callback, sets the final state and wakes up waiters. The request can be deleted right after. */
+	void Complete(EState FinalState);
+
+public:
+
+	/** Waits for the request to complete if it's still pending. */
+	~FPakAsyncReadRequest();
+
+	/**
+	 * @return true if the request has completed, successfully or not.
+	 */
+	bool IsComplete() const
+	{
+		return State.GetValue() >= State_Succeeded;
+	}
+
+	/**
+	 * @return true if the data has been read into the destination buffer.
+	 */
+	bool WasSuccessful() const
+	{
+		return State.GetValue() == State_Succeeded;
+	}
+
+	/**
+	 * Blocks until the request has completed.
+	 */
+	void WaitCompletion();
+
+	/**
+	 * Cancels the request if it hasn't started yet.
+	 *
+	 * @return true if the request has been cancelled, false if it is already in flight or complete.
+	 */
+	bool Cancel();
+};
+
 /**
  * Platform file wrapper to be able to use pak files.
  **/
@@ -803,8 +1002,31 @@ class PAKFILE_API FPakPlatformFile : public IPlatformFile
 	TArray<FPakListEntry> PakFiles;
 	/** True if this we're using signed content. */
 	bool bSigned;
+	/** True if paks should be mapped into memory when mounted. */
+	bool bMapPaks;
 	/** Synchronization object for accessing the list of currently mounted pak files. */
 	FCriticalSection PakListCritical;
+	/** Async read requests waiting for a thread, sorted by priority. */
+	TArray<FPakAsyncReadRequest*> AsyncReadQueue;
+	/** Synchronization object for accessing AsyncReadQueue. */
+	FCriticalSection AsyncReadCritical;
+	/** Threads performing the async reads, created on first use. */
+	FQueuedThreadPool* AsyncReadThreadPool;
+
+	friend class FPakAsyncReadRequest;
+	friend class FPakAsyncReadWork;
+
+	/**
+	 * Pops the highest priority async read and performs it. Called on the async read threads.
+	 */
+	void ProcessNextAsyncRead();
+
+	/**
+	 * Reads the range of an async read request into its destination buffer.
+	 *
+	 * @return true if the read succeeded.
+	 */
+	bool PerformAsyncRead(FPakAsyncReadRequest& Request);
 
 	/**
 	 * Gets mounted pak files
@@ -1110,6 +1332,33 @@ public:
 
 	virtual IFileHandle* OpenRead(const TCHAR* Filename) override;
 
+	/**
+	 * Reads a range of a file stored in one of the mounted paks without blocking the calling thread.
+	 * Reads are performed by a small pool of threads, each with its own pak reader, so several of them can
+	 * be in flight at once, even within the same pak. Compressed and encrypted files are supported.
+	 *
+	 * @param Filename File to read from.
+	 * @param Offset Offset in the uncompressed file.
+	 * @param Size Number of bytes to read.
+	 * @param Dest Buffer to read into, must stay valid until the request has completed.
+	 * @param Priority Requests with a higher priority are read first.
+	 * @param Callback Optional delegate called once the read is done, on the thread that performed it.
+	 * @return Request to poll or wait on, to delete once complete. NULL if the file isn't stored in a pak.
+	 */
+	FPakAsyncReadRequest* ReadAsync(const TCHAR* Filename, int64 Offset, int64 Size, uint8* Dest, EAsyncIOPriority Priority = AIOP_Normal, FPakAsyncReadCallback Callback = FPakAsyncReadCallback());
+
+	/**
+	 * Gets a zero copy view of a file stored in a mapped pak (see -MappedPaks). Bulk data can be used straight
+	 * from the view instead of being read into a temporary buffer, and the pages are shared with every other
+	 * process mapping the same pak.
+	 *
+	 * @param Filename File to look for.
+	 * @param OutData Set to the first byte of the file. Valid as long as the pak stays mounted.
+	 * @param OutSize Set to the size of the file.
+	 * @return true if the file is stored uncompressed and unencrypted in a mapped pak.
+	 */
+	bool GetMappedFileRegion(const TCHAR* Filename, const uint8*& OutData, int64& OutSize);
+
 	virtual IFileHandle* OpenWrite(const TCHAR* Filename, bool bAppend = false, bool bAllowRead = false) override
 	{
 		// No modifications allowed on pak files.
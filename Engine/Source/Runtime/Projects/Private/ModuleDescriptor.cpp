@@ -346,8 +346,11 @@ void FModuleDescriptor::LoadModulesForPhase(ELoadingPhase::Type LoadingPhase, co
 
 				// NOTE: Loading this module may cause other modules to become loaded, both in the engine or game, or other modules 
 				//       that are part of this project or plugin.  That's totally fine.
+				// Nothing uses the module yet, so modules that support it are only started up when first accessed.
 				EModuleLoadResult FailureReason;
-				const TSharedPtr<IModuleInterface>& ModuleInterface = FModuleManager::Get().LoadModuleWithFailureReason( Descriptor.Name, FailureReason );
+				const bool bWasReloaded = false;
+				const bool bAllowLazyStartup = true;
+				const TSharedPtr<IModuleInterface>& ModuleInterface = FModuleManager::Get().LoadModuleWithFailureReason( Descriptor.Name, FailureReason, bWasReloaded, bAllowLazyStartup );
 				if( ModuleInterface.IsValid() )
 				{
 					// Module loaded OK (or was already loaded.)
@@ -58,6 +58,9 @@ static TAutoConsoleVariable<int32> CVarRHIDeferredContextWidth(
 
 RHI_API FRHICommandListExecutor GRHICommandList;
 
+RHI_API uint32 GRHIThreadExecuteCycles = 0;
+RHI_API uint32 GRenderThreadWaitForRHIThreadCycles = 0;
+
 static FGraphEventArray AllOutstandingTasks;
 static FGraphEventArray WaitOutstandingTasks;
 static FGraphEventRef RHIThreadTask;
@@ -155,8 +158,10 @@ public:
 	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_RHIThreadExecute);
+		const uint32 StartCycles = FPlatformTime::Cycles();
 		FRHICommandListExecutor::ExecuteInner_DoExecute(*RHICmdList);
 		delete RHICmdList;
+		GRHIThreadExecuteCycles += FPlatformTime::Cycles() - StartCycles;
 	}
 };
 
@@ -474,7 +479,9 @@ void FRHICommandListExecutor::WaitOnRHIThreadFence(FGraphEventRef& Fence)
 			// this is a deadlock. RT tasks must be done by now or they won't be done. We could add a third queue...
 			UE_LOG(LogRHI, Fatal, TEXT("Deadlock in WaitOnRHIThreadFence."));
 		}
+		const uint32 StartCycles = FPlatformTime::Cycles();
 		FTaskGraphInterface::Get().WaitUntilTaskCompletes(Fence, ENamedThreads::RenderThread_Local);
+		GRenderThreadWaitForRHIThreadCycles += FPlatformTime::Cycles() - StartCycles;
 	}
 }
 
@@ -948,6 +955,7 @@ void FRHICommandListBase::WaitForRHIThreadTasks()
 	while (RHIThreadTask.GetReference())
 	{
 		SCOPE_CYCLE_COUNTER(STAT_ExplicitWaitRHIThread);
+		const uint32 StartCycles = FPlatformTime::Cycles();
 		if (FTaskGraphInterface::Get().IsThreadProcessingTasks(ENamedThreads::RenderThread_Local))
 		{
 			// we have to spin here because all task threads might be stalled, meaning the fire event anythread task might not be hit.
@@ -962,6 +970,7 @@ void FRHICommandListBase::WaitForRHIThreadTasks()
 		{
 			FTaskGraphInterface::Get().WaitUntilTaskCompletes(RHIThreadTask, ENamedThreads::RenderThread_Local);
 		}
+		GRenderThreadWaitForRHIThreadCycles += FPlatformTime::Cycles() - StartCycles;
 		if (RHIThreadTask.GetReference() && RHIThreadTask->IsComplete())
 		{
 			RHIThreadTask = nullptr;
@@ -88,6 +88,12 @@ extern RHI_API bool GHardwareHiddenSurfaceRemoval;
 /** true if the RHI supports asynchronous creation of texture resources */
 extern RHI_API bool GRHISupportsAsyncTextureCreation;
 
+/**
+ * true if the RHI can execute command lists on the RHI thread, on platforms with PLATFORM_SUPPORTS_RHI_THREAD.
+ * When false the RHI thread is never started, and static states are only created on the rendering thread.
+ */
+extern RHI_API bool GRHISupportsRHIThread;
+
 /** Can we handle quad primitives? */
 extern RHI_API bool GSupportsQuads;
 
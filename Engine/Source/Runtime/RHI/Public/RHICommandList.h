@@ -1996,6 +1996,11 @@ private:
 
 extern RHI_API FRHICommandListExecutor GRHICommandList;
 
+/** Cycles the RHI thread spent executing command lists. Never reset, readers take the difference between two frames. */
+extern RHI_API uint32 GRHIThreadExecuteCycles;
+/** Cycles the rendering thread spent waiting on the RHI thread. Never reset, readers take the difference between two frames. */
+extern RHI_API uint32 GRenderThreadWaitForRHIThreadCycles;
+
 FORCEINLINE_DEBUGGABLE FRHICommandListImmediate& FRHICommandListExecutor::GetImmediateCommandList()
 {
 	return GRHICommandList.CommandListImmediate;
@@ -65,13 +65,18 @@ public:
 		if (!StaticResource)
 		{
 #if PLATFORM_SUPPORTS_RHI_THREAD
-			FStaticStateResource* NewStaticResource = new FStaticStateResource();
-			FStaticStateResource* ValueWas = (FStaticStateResource*)FPlatformAtomics::InterlockedCompareExchangePointer((void**)&StaticResource, NewStaticResource, nullptr);
-			if (ValueWas)
+			// RHIs that can't run on the RHI thread, like OpenGL, can't create states off the rendering thread either
+			if (GRHISupportsRHIThread)
 			{
-				// we made a redundant one...leak it
+				FStaticStateResource* NewStaticResource = new FStaticStateResource();
+				FStaticStateResource* ValueWas = (FStaticStateResource*)FPlatformAtomics::InterlockedCompareExchangePointer((void**)&StaticResource, NewStaticResource, nullptr);
+				if (ValueWas)
+				{
+					// we made a redundant one...leak it
+				}
 			}
-#else
+			else
+#endif
 			if (!IsInRenderingThread())
 			{
 				check(IsInParallelRenderingThread());
@@ -84,7 +89,6 @@ public:
 			{
 				StaticResource = new FStaticStateResource();
 			}
-#endif
 		}
 		return StaticResource->StateRHI;
 	};
@@ -114,6 +114,7 @@ DEFINE_STAT(STAT_WholeSceneShadows);
 DEFINE_STAT(STAT_PerObjectShadows);
 DEFINE_STAT(STAT_PreShadows);
 DEFINE_STAT(STAT_CachedPreShadows);
+DEFINE_STAT(STAT_CachedWholeSceneShadows);
 DEFINE_STAT(STAT_ShadowDynamicPathDrawCalls);
 
 DEFINE_STAT(STAT_TranslucentInjectTime);
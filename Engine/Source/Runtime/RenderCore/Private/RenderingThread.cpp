@@ -256,6 +256,9 @@ public:
 /** The rendering thread main loop */
 void RenderingThreadMain( FEvent* TaskGraphBoundSyncEvent )
 {
+	// Everything the rendering thread allocates is accounted to rendering
+	MEMORY_TAG_SCOPE(Rendering);
+
 	ENamedThreads::RenderThread = ENamedThreads::Type(ENamedThreads::ActualRenderingThread);
 	ENamedThreads::RenderThread_Local = ENamedThreads::Type(ENamedThreads::ActualRenderingThread_Local);
 	FTaskGraphInterface::Get().AttachToThread(ENamedThreads::RenderThread);
@@ -517,7 +520,8 @@ void StartRenderingThread()
 
 	check(!GRHIThread)
 #if PLATFORM_SUPPORTS_RHI_THREAD
-	if (GUseRHIThread)
+	// RHIs that can't execute on another thread, like OpenGL whose context belongs to the render thread, keep executing there
+	if (GUseRHIThread && GRHISupportsRHIThread)
 	{
 		if (!FTaskGraphInterface::Get().IsThreadProcessingTasks(ENamedThreads::RHIThread))
 		{
@@ -721,6 +725,8 @@ bool FRenderCommandFence::IsFenceComplete() const
 
 /** How many cycles the gamethread used (excluding idle time). It's set once per frame in FViewport::Draw. */
 uint32 GGameThreadTime = 0;
+/** Cycles the gamethread spent blocked on rendering thread fences and frame prerequisites. */
+uint32 GGameThreadWaitForRenderThreadCycles = 0;
 /** How many cycles it took to swap buffers to present the frame. */
 uint32 GSwapBufferTime = 0;
 
@@ -743,6 +749,7 @@ static void GameThreadWaitForTask(const FGraphEventRef& Task, bool bEmptyGameThr
 	{
 		SCOPE_CYCLE_COUNTER(STAT_GameIdleTime);
 		{
+			const uint32 StartCycles = FPlatformTime::Cycles();
 			static int32 NumRecursiveCalls = 0;
 			static TArray<FEvent*> EventPool;
 			
@@ -790,6 +797,11 @@ static void GameThreadWaitForTask(const FGraphEventRef& Task, bool bEmptyGameThr
 
 			// Return the event to the pool and decrement the recursion counter.
 			EventPool.Push(Event);
+			if (NumRecursiveCalls == 1)
+			{
+				// the recursive waits are within the outer one
+				GGameThreadWaitForRenderThreadCycles += FPlatformTime::Cycles() - StartCycles;
+			}
 			NumRecursiveCalls--;
 		}
 	}
@@ -17,6 +17,31 @@
 #include <vector>
 using namespace std;
 
+// Times a stage of the pipeline on the GPU while on scope
+class FAHRScopedGPUStage
+{
+public:
+	FAHRScopedGPUStage(FRHICommandListImmediate& InRHICmdList, EAHRGPUStage InStage)
+		: RHICmdList(InRHICmdList)
+		, Stage(InStage)
+	{
+		AHREngine.BeginGPUStage(RHICmdList, Stage);
+	}
+	~FAHRScopedGPUStage()
+	{
+		AHREngine.EndGPUStage(RHICmdList, Stage);
+	}
+private:
+	FRHICommandListImmediate& RHICmdList;
+	EAHRGPUStage Stage;
+};
+
+// Number of diffuse directions traced this frame. The remaining targets are left black
+static int32 GetAHRNumDiffuseDirections()
+{
+	return FMath::Clamp(CVarAHRDiffuseDirections.GetValueOnRenderThread(),1,5);
+}
+
 // Using a full screen quad at every stage instead of a cs as the targets are already setted for a quad. Also, not using groupshared memory.
 template<int _dummy>
 class AHRPassVS : public FGlobalShader
@@ -219,13 +244,16 @@ IMPLEMENT_SHADER_TYPE(template<>,AHRPerPixelInterpolationKernelGenerator<1>,TEXT
 void  FApproximateHybridRaytracer::StartFrame(FRHICommandListImmediate& RHICmdList,FViewInfo& View)
 {	
 	SCOPED_DRAW_EVENT(RHICmdList,AHRStartFrame);
+	SCOPE_CYCLE_COUNTER(STAT_AHRStartFrame);
+
+	UpdateGPUStats(RHICmdList);
 
 	// Check if the bounds are valid
 	if(View.FinalPostProcessSettings.AHR_internal_initialized)
 	{
 		gridSettings.Bounds = View.FinalPostProcessSettings.AHR_internal_SceneBounds;
 		gridSettings.Center = View.FinalPostProcessSettings.AHR_internal_SceneOrigins;
-		gridSettings.VoxelSize = View.FinalPostProcessSettings.AHRVoxelSize;
+		gridSettings.VoxelSize = View.FinalPostProcessSettings.AHRVoxelSize*FMath::Max(CVarAHRVoxelSizeScale.GetValueOnRenderThread(),0.1f);
 
 		gridSettings.SliceSize.X = ceil(gridSettings.Bounds.X / gridSettings.VoxelSize);
 		gridSettings.SliceSize.Y = ceil(gridSettings.Bounds.Y / gridSettings.VoxelSize);
@@ -250,23 +278,60 @@ void  FApproximateHybridRaytracer::StartFrame(FRHICommandListImmediate& RHICmdLi
 			gridSettings.SliceSize.Y = ceil(gridSettings.Bounds.Y / gridSettings.VoxelSize);
 			gridSettings.SliceSize.Z = ceil(gridSettings.Bounds.Z / gridSettings.VoxelSize);
 		}
+
+		// Keep the grid around the camera, moving it in whole bricks. The volumes are addressed toroidally, so the voxels already
+		// on the volume stay valid and only the newly exposed slabs need to be revoxelized
+		if(CVarAHRGridFollowsCamera.GetValueOnRenderThread() != 0)
+		{
+			// Whole bricks per axis, so the offset stays aligned with the bricks and the occupancy cells
+			gridSettings.SliceSize.X = FMath::Max(gridSettings.SliceSize.X / AHR_STATIC_BRICK_SIZE, 1)*AHR_STATIC_BRICK_SIZE;
+			gridSettings.SliceSize.Y = FMath::Max(gridSettings.SliceSize.Y / AHR_STATIC_BRICK_SIZE, 1)*AHR_STATIC_BRICK_SIZE;
+			gridSettings.SliceSize.Z = FMath::Max(gridSettings.SliceSize.Z / AHR_STATIC_BRICK_SIZE, 1)*AHR_STATIC_BRICK_SIZE;
+
+			const FVector BrickWorldSize = (gridSettings.Bounds*2.0f) / FVector(gridSettings.SliceSize.X,gridSettings.SliceSize.Y,gridSettings.SliceSize.Z) * AHR_STATIC_BRICK_SIZE;
+			const FVector& ViewOrigin = View.ViewMatrices.ViewOrigin;
+			const FIntVector CenterBrick(FMath::FloorToInt(ViewOrigin.X / BrickWorldSize.X),
+										 FMath::FloorToInt(ViewOrigin.Y / BrickWorldSize.Y),
+										 FMath::FloorToInt(ViewOrigin.Z / BrickWorldSize.Z));
+			gridSettings.Center = FVector(CenterBrick.X*BrickWorldSize.X,CenterBrick.Y*BrickWorldSize.Y,CenterBrick.Z*BrickWorldSize.Z);
+
+			// Global index of the first voxel of the grid, wrapped to the volume size
+			auto WrapIndex = [](int32 Value,int32 Max){ return ((Value % Max) + Max) % Max; };
+			for(int32 Axis = 0;Axis < 3;Axis++)
+				gridSettings.ToroidalOffset(Axis) = WrapIndex(CenterBrick(Axis)*AHR_STATIC_BRICK_SIZE - gridSettings.SliceSize(Axis)/2,gridSettings.SliceSize(Axis));
+		}
+		else
+		{
+			gridSettings.ToroidalOffset = FIntVector(0,0,0);
+		}
+	}
+
+	// Advance the kernel rotation. The history can't be reprojected across a camera cut
+	if(CVarAHRTemporalAccumulation.GetValueOnRenderThread() != 0)
+	{
+		TemporalFrameIndex++;
+		if(View.bCameraCut)
+			bTemporalHistoryValid = false;
 	}
 
-	// If the size of the shadow texture changed we need to rebuild the buffer
+	// If the size of the shadow atlas changed we need to rebuild it
 	{
 		FScopeLock ScopeLock(&cs);
-		auto shadowRes = GSceneRenderTargets.GetShadowDepthTextureResolution();
+		int32 atlasRes = FMath::RoundUpToPowerOfTwo(FMath::Clamp(CVarAHRShadowAtlasResolution.GetValueOnRenderThread(),AHR_MIN_SHADOW_TILE*2,8192));
 
-		if(shadowRes.X != prevShadowRes.X && shadowRes.Y != prevShadowRes.Y)
+		if(atlasRes != ShadowAtlasResolution)
 		{
-			for(int i = 0;i < MAX_AHR_LIGHTS;i++)
-			{
-				FRHIResourceCreateInfo createInfo;
-				lightDepths[i] = RHICreateTexture2D(shadowRes.X,shadowRes.Y,PF_ShadowDepth,1,1,TexCreate_ShaderResource,createInfo);
-			}
+			FRHIResourceCreateInfo createInfo;
+			ShadowAtlas = RHICreateTexture2D(atlasRes,atlasRes,PF_R32_FLOAT,1,1,TexCreate_ShaderResource | TexCreate_UAV,createInfo);
+			ShadowAtlasUAV = RHICreateUnorderedAccessView(ShadowAtlas);
+			ShadowAtlasResolution = atlasRes;
+			UpdateVolumeMemoryStats();
+
+			// The tiles handed out this frame point to the old atlas
+			currentLightIDX = 0;
+			ShadowAtlasCursor = FIntPoint::ZeroValue;
+			ShadowAtlasRowHeight = 0;
 		}
-
-		prevShadowRes = shadowRes;
 	}
 
 	// If the screen res changed, rebuild kernels
@@ -309,6 +374,149 @@ void  FApproximateHybridRaytracer::StartFrame(FRHICommandListImmediate& RHICmdLi
 	}
 }
 
+// Copies (and downsamples) the shadow depths of a light to its tile on the shadow atlas
+class AHRCopyShadowToAtlas : public FGlobalShader
+{
+	DECLARE_SHADER_TYPE(AHRCopyShadowToAtlas,Global);
+
+public:
+
+	static bool ShouldCache(EShaderPlatform Platform)
+	{
+		return RHISupportsComputeShaders(Platform);
+	}
+
+	static void ModifyCompilationEnvironment( EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment )
+	{
+		FGlobalShader::ModifyCompilationEnvironment( Platform, OutEnvironment );
+	}
+
+	/** Default constructor. */
+	AHRCopyShadowToAtlas()
+	{
+	}
+
+	/** Initialization constructor. */
+	explicit AHRCopyShadowToAtlas( const ShaderMetaType::CompiledShaderInitializerType& Initializer )
+		: FGlobalShader(Initializer)
+	{
+		ShadowDepth.Bind( Initializer.ParameterMap, TEXT("ShadowDepth") );
+		ShadowAtlas.Bind( Initializer.ParameterMap, TEXT("ShadowAtlas") );
+		sourceRect.Bind( Initializer.ParameterMap, TEXT("sourceRect") );
+		tileRect.Bind( Initializer.ParameterMap, TEXT("tileRect") );
+	}
+
+	/** Serialization. */
+	virtual bool Serialize( FArchive& Ar ) override
+	{
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize( Ar );
+		Ar << ShadowDepth;
+		Ar << ShadowAtlas;
+		Ar << sourceRect;
+		Ar << tileRect;
+		return bShaderHasOutdatedParameters;
+	}
+
+	/**
+	 * Set parameters for this shader.
+	 */
+	
+	void SetParameters(FRHICommandList& RHICmdList, FUnorderedAccessViewRHIParamRef ShadowAtlasUAV,FTextureRHIParamRef ShadowDepthTexture,const FIntRect& inSourceRect,const FIntVector& inTileRect)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+
+		if ( ShadowAtlas.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, ShadowAtlas.GetBaseIndex(), ShadowAtlasUAV);
+		SetTextureParameter(RHICmdList, ComputeShaderRHI, ShadowDepth, ShadowDepthTexture);
+
+		SetShaderValue(RHICmdList, ComputeShaderRHI, sourceRect, inSourceRect );
+		SetShaderValue(RHICmdList, ComputeShaderRHI, tileRect, inTileRect );
+	}
+
+	/**
+	 * Unbinds any buffers that have been bound.
+	 */
+	void UnbindBuffers(FRHICommandList& RHICmdList)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+		if ( ShadowAtlas.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, ShadowAtlas.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
+	}
+
+private:
+	FShaderResourceParameter ShadowDepth;
+	FShaderResourceParameter ShadowAtlas;
+	FShaderParameter sourceRect;
+	FShaderParameter tileRect;
+};
+
+IMPLEMENT_SHADER_TYPE(,AHRCopyShadowToAtlas,TEXT("AHRCopyShadowToAtlas"),TEXT("main"),SF_Compute);
+
+bool FApproximateHybridRaytracer::AllocateShadowAtlasTile(int32 TileSize, FIntPoint& OutOrigin)
+{
+	FIntPoint origin = ShadowAtlasCursor;
+	int32 rowHeight = ShadowAtlasRowHeight;
+
+	// Doesn't fit on the current row, start a new one
+	if(origin.X + TileSize > ShadowAtlasResolution)
+	{
+		origin.X = 0;
+		origin.Y += rowHeight;
+		rowHeight = 0;
+	}
+	if(origin.Y + TileSize > ShadowAtlasResolution)
+		return false;
+
+	OutOrigin = origin;
+	ShadowAtlasCursor = FIntPoint(origin.X + TileSize,origin.Y);
+	ShadowAtlasRowHeight = FMath::Max(rowHeight,TileSize);
+	return true;
+}
+
+void FApproximateHybridRaytracer::AppendLight(FRHICommandListImmediate& RHICmdList, const FProjectedShadowInfo& Shadow, FTexture2DRHIParamRef ShadowDepth)
+{
+	if(currentLightIDX >= MAX_AHR_LIGHTS)
+	{
+		UE_LOG(LogRenderer, Warning, TEXT("Tried to add more lights to the AHR engine that the maximum supported, will be ignored."));
+		return;
+	}
+	if(!IsValidRef(ShadowAtlas))
+		return;
+
+	// The shadow resolution already follows the size of the light on screen, but the grid doesn't need the full detail.
+	// Lights that cover the whole screen get a quarter of the atlas, the rest are scaled down from there
+	int32 maxTile = FMath::Min<int32>(ShadowAtlasResolution/2,FMath::RoundUpToPowerOfTwo(FMath::Max(Shadow.ResolutionX,Shadow.ResolutionY)));
+	int32 tileSize = FMath::RoundUpToPowerOfTwo(FMath::Max(1,FMath::TruncToInt(Shadow.MaxScreenPercent*ShadowAtlasResolution/2)));
+	tileSize = FMath::Clamp(tileSize,AHR_MIN_SHADOW_TILE,FMath::Max(maxTile,AHR_MIN_SHADOW_TILE));
+
+	// If the atlas is getting full, try with smaller tiles before dropping the light
+	FIntPoint tileOrigin;
+	while(!AllocateShadowAtlasTile(tileSize,tileOrigin))
+	{
+		tileSize /= 2;
+		if(tileSize < AHR_MIN_SHADOW_TILE)
+		{
+			UE_LOG(LogRenderer, Warning, TEXT("The AHR shadow atlas is full, the light will be ignored. Consider increasing r.AHRShadowAtlasResolution."));
+			return;
+		}
+	}
+
+	FIntRect sourceRect(Shadow.X + SHADOW_BORDER,Shadow.Y + SHADOW_BORDER,Shadow.X + SHADOW_BORDER + Shadow.ResolutionX,Shadow.Y + SHADOW_BORDER + Shadow.ResolutionY);
+
+	TShaderMapRef<AHRCopyShadowToAtlas> copyCS(GetGlobalShaderMap(GetFeatureLevel()));
+	RHICmdList.SetComputeShader(copyCS->GetComputeShader());
+	copyCS->SetParameters(RHICmdList, ShadowAtlasUAV,ShadowDepth,sourceRect,FIntVector(tileOrigin.X,tileOrigin.Y,tileSize));
+	DispatchComputeShader(RHICmdList, *copyCS, fceil((uint32)tileSize,16u), fceil((uint32)tileSize,16u), 1);
+	copyCS->UnbindBuffers(RHICmdList);
+
+	AHRLightData& light = lights[currentLightIDX];
+	light.ViewProj = FTranslationMatrix(Shadow.PreShadowTranslation)*Shadow.SubjectAndReceiverMatrix;
+	light.AtlasScaleBias = FVector4(float(tileSize)/float(ShadowAtlasResolution),float(tileSize)/float(ShadowAtlasResolution),
+									float(tileOrigin.X)/float(ShadowAtlasResolution),float(tileOrigin.Y)/float(ShadowAtlasResolution));
+	light.IsValid = true;
+	currentLightIDX++;
+}
+
 class AHRDynamicStaticVolumeCombine : public FGlobalShader
 {
 	DECLARE_SHADER_TYPE(AHRDynamicStaticVolumeCombine,Global);
@@ -491,9 +699,10 @@ private:
 	FShaderParameter gridRes;
 };
 
-class AHREmissiveConvolution : public FGlobalShader
+// Propagates the light of the voxels to their neighbours on a region of the bounce volume, see r.AHRMultiBounce
+class AHRPropagateBounce : public FGlobalShader
 {
-	DECLARE_SHADER_TYPE(AHREmissiveConvolution,Global);
+	DECLARE_SHADER_TYPE(AHRPropagateBounce,Global);
 
 public:
 
@@ -508,26 +717,36 @@ public:
 	}
 
 	/** Default constructor. */
-	AHREmissiveConvolution()
+	AHRPropagateBounce()
 	{
 	}
 
 	/** Initialization constructor. */
-	explicit AHREmissiveConvolution( const ShaderMetaType::CompiledShaderInitializerType& Initializer )
+	explicit AHRPropagateBounce( const ShaderMetaType::CompiledShaderInitializerType& Initializer )
 		: FGlobalShader(Initializer)
 	{
-		SceneVolume.Bind( Initializer.ParameterMap, TEXT("SceneVolume") );
 		EmissiveVolume.Bind( Initializer.ParameterMap, TEXT("EmissiveVolume") );
+		BounceVolume.Bind( Initializer.ParameterMap, TEXT("RWBounceVolume") );
 		gridRes.Bind( Initializer.ParameterMap, TEXT("gridRes") );
+		regionMin.Bind( Initializer.ParameterMap, TEXT("regionMin") );
+		regionSize.Bind( Initializer.ParameterMap, TEXT("regionSize") );
+		toroidalOffset.Bind( Initializer.ParameterMap, TEXT("toroidalOffset") );
+		bounceIntensity.Bind( Initializer.ParameterMap, TEXT("bounceIntensity") );
+		temporalWeight.Bind( Initializer.ParameterMap, TEXT("temporalWeight") );
 	}
 
 	/** Serialization. */
 	virtual bool Serialize( FArchive& Ar ) override
 	{
 		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize( Ar );
-		Ar << SceneVolume;
 		Ar << EmissiveVolume;
+		Ar << BounceVolume;
 		Ar << gridRes;
+		Ar << regionMin;
+		Ar << regionSize;
+		Ar << toroidalOffset;
+		Ar << bounceIntensity;
+		Ar << temporalWeight;
 		return bShaderHasOutdatedParameters;
 	}
 
@@ -535,19 +754,22 @@ public:
 	 * Set parameters for this shader.
 	 */
 	
-	void SetParameters(FRHICommandList& RHICmdList, FUnorderedAccessViewRHIParamRef EmissiveVolumeUAV,
-													FShaderResourceViewRHIParamRef SceneVolumeSRV,
-													FIntVector inGridRes
-													)
+	void SetParameters(FRHICommandList& RHICmdList, FShaderResourceViewRHIParamRef EmissiveVolumeSRV, FUnorderedAccessViewRHIParamRef BounceVolumeUAV,
+						FIntVector inGridRes, FIntVector inRegionMin, FIntVector inRegionSize, FIntVector inToroidalOffset, float inBounceIntensity, float inTemporalWeight)
 	{
 		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
 
 		if ( EmissiveVolume.IsBound() )
-			RHICmdList.SetUAVParameter(ComputeShaderRHI, EmissiveVolume.GetBaseIndex(),EmissiveVolumeUAV );
-		if ( SceneVolume.IsBound() )
-			RHICmdList.SetShaderResourceViewParameter(ComputeShaderRHI,SceneVolume.GetBaseIndex(), SceneVolumeSRV);
+			RHICmdList.SetShaderResourceViewParameter(ComputeShaderRHI, EmissiveVolume.GetBaseIndex(), EmissiveVolumeSRV);
+		if ( BounceVolume.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, BounceVolume.GetBaseIndex(), BounceVolumeUAV);
 
 		SetShaderValue(RHICmdList, ComputeShaderRHI, gridRes, inGridRes );
+		SetShaderValue(RHICmdList, ComputeShaderRHI, regionMin, inRegionMin );
+		SetShaderValue(RHICmdList, ComputeShaderRHI, regionSize, inRegionSize );
+		SetShaderValue(RHICmdList, ComputeShaderRHI, toroidalOffset, inToroidalOffset );
+		SetShaderValue(RHICmdList, ComputeShaderRHI, bounceIntensity, inBounceIntensity );
+		SetShaderValue(RHICmdList, ComputeShaderRHI, temporalWeight, inTemporalWeight );
 	}
 
 	/**
@@ -557,281 +779,1094 @@ public:
 	{
 		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
 		if ( EmissiveVolume.IsBound() )
-			RHICmdList.SetUAVParameter(ComputeShaderRHI, EmissiveVolume.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
-		if ( SceneVolume.IsBound() )
-			RHICmdList.SetShaderResourceViewParameter(ComputeShaderRHI,SceneVolume.GetBaseIndex(), FShaderResourceViewRHIParamRef());
+			RHICmdList.SetShaderResourceViewParameter(ComputeShaderRHI, EmissiveVolume.GetBaseIndex(), FShaderResourceViewRHIParamRef());
+		if ( BounceVolume.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, BounceVolume.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
 	}
 
 private:
-	FShaderResourceParameter SceneVolume;
 	FShaderResourceParameter EmissiveVolume;
+	FShaderResourceParameter BounceVolume;
 	FShaderParameter gridRes;
+	FShaderParameter regionMin;
+	FShaderParameter regionSize;
+	FShaderParameter toroidalOffset;
+	FShaderParameter bounceIntensity;
+	FShaderParameter temporalWeight;
 };
 
-
-
-IMPLEMENT_SHADER_TYPE(,AHRDynamicStaticVolumeCombine,TEXT("AHRDynamicStaticVolumeCombine"),TEXT("mainBinary"),SF_Compute);
-IMPLEMENT_SHADER_TYPE(,AHRDynamicStaticEmissiveVolumeCombine,TEXT("AHRDynamicStaticVolumeCombine"),TEXT("mainEmissive"),SF_Compute);
-IMPLEMENT_SHADER_TYPE(,AHREmissiveConvolution,TEXT("AHREmissiveConvolution"),TEXT("main"),SF_Compute);
-
-
-//std::mutex cs;
-//pthread_mutex_t Mutex;
-AHRGridSettings prevGridSettings;
-vector<FName> prevStaticObjects;
-//once_flag stdOnceFlag;
-template<class Function>
-void Once(Function&& f)
+// Adds the bounce volume to the combined emissive volume
+class AHRAddBounce : public FGlobalShader
 {
-	static bool run = true;
-	if(run)
-		f();
-	run = false;
-	return;
-}
+	DECLARE_SHADER_TYPE(AHRAddBounce,Global);
 
-void FApproximateHybridRaytracer::VoxelizeScene(FRHICommandListImmediate& RHICmdList,FViewInfo& View)
-{
-	SCOPED_DRAW_EVENT(RHICmdList,AHRVoxelizeScene);
-#if 0
-	/*static bool ran = false;
-	if(ran) return;
-	ran = true;
-	if(View.PrimitivesToVoxelize.Num() == 0)
-		return;*/
-	
-	bool RebuildGrids = View.FinalPostProcessSettings.AHRRebuildGrids;
-	
-	/*if(AHRGlobalSignal_RebuildGrids.load() == 1)
-	{
-		RebuildGrids = true;
-		AHRGlobalSignal_RebuildGrids.store(0);
-	}*/
-	TArray<const FPrimitiveSceneInfo*,SceneRenderingAllocator> staticObjects;
-	TArray<const FPrimitiveSceneInfo*,SceneRenderingAllocator> dynamicsObjects;
-	bool voxelizeStatic = false;
-	uint32 currentMatIDX = 0;
-	//cs.lock();
-	//pthread_mutex_lock(&Mutex);
-	{
-		// Make this thread-safe
-		FScopeLock ScopeLock(&cs);
-		// Could this be optimized? It feels wrong...
-		bool staticListChanged = false;
-		for(auto obj : View.PrimitivesToVoxelize)
-		{
-			if(obj->Proxy->NeedsEveryFrameVoxelization())
-			{
-				dynamicsObjects.Add(obj);
-			}
-			else
-			{
-				// Check if the object exists on the prev statics. O(x^2). Need to make this faster
-				bool found = false;
-				for(auto sObjName : prevStaticObjects)
-					found |= sObjName == obj->Proxy->GetOwnerName();
-				staticListChanged |= !found;
-				staticObjects.Add(obj);
-			}
-		}
-		// Voxelize static only once, to the static grid. Revoxelize static if something changed (add, delete, grid res changed)
-		voxelizeStatic = prevGridSettings.Bounds != gridSettings.Bounds ||
-						 prevGridSettings.Center != gridSettings.Center ||
-						 prevGridSettings.SliceSize != gridSettings.SliceSize ||
-						 prevStaticObjects.size() != staticObjects.Num() ||
-					     staticListChanged ||
-						 RebuildGrids;
-		if(voxelizeStatic)
-		{
-			// we are going to voxelize, so store state
-			prevStaticObjects.clear();
-			for(auto obj : staticObjects)
-				prevStaticObjects.push_back(obj->Proxy->GetOwnerName());
-			prevGridSettings = gridSettings;
-		}
-		// Check if the palette changed
-		/*
-		bool paletteChanged = false;
-		for(int i = 0; i < 256; i++) paletteChanged |= (prevPalette[i] != palette[i]);
-		if(paletteChanged)
-		{
-			// TODO: a dynamic texture could be more efficient, specially if the material emissive color is driven trough blueprints/c++ code and changes often
-			// Recreate the texture
-			for(int i = 0; i < 256; i++) prevPalette[i] = palette[i];
-			// Destroy the texture
-			EmissivePaletteTexture.SafeRelease();
-			EmissivePaletteSRV.SafeRelease();
-			FRHIResourceCreateInfo CreateInfo;
-			EmissivePaletteTexture = RHICreateTexture2D(256,1,PF_B8G8R8A8,1,1,TexCreate_ShaderResource,CreateInfo);
-			// Copy palette
-			uint8 palleteTexBuff[256*4];
-			for(int i = 0; i < 256; i++)
-			{
-				auto col = palette[i].Quantize();
-				palleteTexBuff[i*4]     =  col.B;
-				palleteTexBuff[i*4 + 1] =  col.G;
-				palleteTexBuff[i*4 + 2] =  col.R;
-				palleteTexBuff[i*4 + 3] =  col.A; // Alpha is used as a multiplier
-			}
-			uint32 Stride = 0;
-			uint8* textureData = (uint8*)RHILockTexture2D( EmissivePaletteTexture, 0, RLM_WriteOnly, Stride, false );
-			FMemory::Memcpy(textureData, palleteTexBuff, 256*4);
-			RHIUnlockTexture2D( EmissivePaletteTexture, 0, false );
-			EmissivePaletteSRV = RHICreateShaderResourceView(EmissivePaletteTexture,0,1,PF_B8G8R8A8);
-		}*/
-	}
-	//pthread_mutex_unlock(&Mutex);
-	//cs.unlock();
-	uint32 cls[4] = { 0,0,0,0 };
-	// Voxelize only static
-	if( staticObjects.Num( ) > 0  && voxelizeStatic)
-	{
-		// Clear
-		RHICmdList.ClearUAV(StaticSceneVolume->UAV, cls);
-		RHICmdList.ClearUAV(StaticEmissiveVolume->UAV, cls);
-		SetStaticVolumeAsActive();
-		TAHRVoxelizerElementPDI<FAHRVoxelizerDrawingPolicyFactory> Drawer(
-			&View, FAHRVoxelizerDrawingPolicyFactory::ContextType(RHICmdList) );
-		for( auto PrimitiveSceneInfo : staticObjects )
-		{
-			FScopeCycleCounter Context( PrimitiveSceneInfo->Proxy->GetStatId( ) );
-			Drawer.SetPrimitive( PrimitiveSceneInfo->Proxy );
-			
-			// Calls SceneProxy DrawDynamicElements function
-			PrimitiveSceneInfo->Proxy->DrawDynamicElements(&Drawer,&View,EDrawDynamicFlags::Voxelize);
-		}
+public:
+
+	static bool ShouldCache(EShaderPlatform Platform)
+	{
+		return RHISupportsComputeShaders(Platform);
 	}
-	
-	// Voxelize dynamic to the dynamic grid
-	RHICmdList.ClearUAV(DynamicSceneVolume->UAV, cls);
-	RHICmdList.ClearUAV(DynamicEmissiveVolume->UAV, cls);
-	SetDynamicVolumeAsActive();
-	TAHRVoxelizerElementPDI<FAHRVoxelizerDrawingPolicyFactory> Drawer(
-			&View, FAHRVoxelizerDrawingPolicyFactory::ContextType(RHICmdList) );
-	for( auto PrimitiveSceneInfo : dynamicsObjects )
+
+	static void ModifyCompilationEnvironment( EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment )
 	{
-		FScopeCycleCounter Context( PrimitiveSceneInfo->Proxy->GetStatId( ) );
-		Drawer.SetPrimitive( PrimitiveSceneInfo->Proxy );
-		
-		FAHRVoxelizerDrawingPolicyFactory::DrawDynamicMesh(RHICmdList, View, Context, *(PrimitiveSceneInfo->Proxy-> false, true, p.PrimitiveSceneProxy, MeshBatch.BatchHitProxyId);
-		// Calls SceneProxy DrawDynamicElements function
-		PrimitiveSceneInfo->Proxy->DrawDynamicElements(&Drawer,&View,EDrawDynamicFlags::Voxelize);
+		FGlobalShader::ModifyCompilationEnvironment( Platform, OutEnvironment );
 	}
-	
-	// Dispatch a compute shader that applies a per voxel pack or between the static grid and the dynamic grid.
-	// The dynamic grid is the one that gets binded as an SRV
-	TShaderMapRef<AHRDynamicStaticVolumeCombine> combineCS(GetGlobalShaderMap(View.GetFeatureLevel()));
-	RHICmdList.SetComputeShader(combineCS->GetComputeShader());
-	uint32 l = gridSettings.SliceSize.X*gridSettings.SliceSize.Y*gridSettings.SliceSize.Z/32;
-	uint32 x = ceil(cbrt(l / 256.0f)); // cbrt = cubic root
-	combineCS->SetParameters(RHICmdList, DynamicSceneVolume->UAV,DynamicEmissiveVolume->UAV,StaticSceneVolume->SRV,StaticEmissiveVolume->SRV,FIntVector(x*8,x*8,x*4));
-	DispatchComputeShader(RHICmdList, *combineCS, x, x, x);
-	combineCS->UnbindBuffers(RHICmdList);
-	
-	TShaderMapRef<AHRDynamicStaticEmissiveVolumeCombine> combineCSEmissive(GetGlobalShaderMap(View.GetFeatureLevel()));
-	RHICmdList.SetComputeShader(combineCSEmissive->GetComputeShader());
-	l = gridSettings.SliceSize.X*gridSettings.SliceSize.Y*gridSettings.SliceSize.Z/4;
-	x = ceil(cbrt(l / 256.0f)); // cbrt = cubic root
-	combineCSEmissive->SetParameters(RHICmdList, DynamicSceneVolume->UAV,DynamicEmissiveVolume->UAV,StaticSceneVolume->SRV,StaticEmissiveVolume->SRV,FIntVector(x*8,x*8,x*4));
-	DispatchComputeShader(RHICmdList, *combineCSEmissive, x, x ,x);
-	combineCSEmissive->UnbindBuffers(RHICmdList);
-#endif
-	uint32 cls[4] = { 0,0,0,0 };
 
-	// Voxelize to the dynamic grid
-	RHICmdList.ClearUAV(DynamicSceneVolume->UAV, cls);
-	RHICmdList.ClearUAV(DynamicEmissiveVolume->UAV, cls);
-	SetDynamicVolumeAsActive();
+	/** Default constructor. */
+	AHRAddBounce()
+	{
+	}
 
-	for(auto e : View.PrimitivesElementsToVoxelize)
+	/** Initialization constructor. */
+	explicit AHRAddBounce( const ShaderMetaType::CompiledShaderInitializerType& Initializer )
+		: FGlobalShader(Initializer)
 	{
-		FAHRVoxelizerDrawingPolicyFactory::DrawDynamicMesh(RHICmdList, View, FAHRVoxelizerDrawingPolicyFactory::ContextType(), *e.Mesh, false, true, e.PrimitiveSceneProxy, e.Mesh->BatchHitProxyId);
+		EmissiveVolume.Bind( Initializer.ParameterMap, TEXT("RWEmissiveVolume") );
+		BounceVolume.Bind( Initializer.ParameterMap, TEXT("BounceVolume") );
+		gridRes.Bind( Initializer.ParameterMap, TEXT("gridRes") );
 	}
 
-	// Blur the emissive grid to get multiple bounces
-	/*
-	TShaderMapRef<AHREmissiveConvolution> blurCS(GetGlobalShaderMap(View.GetFeatureLevel()));
-	RHICmdList.SetComputeShader(blurCS->GetComputeShader());
-	blurCS->SetParameters(RHICmdList, DynamicEmissiveVolume->UAV,DynamicSceneVolume->SRV,FIntVector(gridSettings.SliceSize.X/2,gridSettings.SliceSize.Y/2,gridSettings.SliceSize.Z/2));
-	DispatchComputeShader(RHICmdList, *blurCS, gridSettings.SliceSize.X/8u, gridSettings.SliceSize.Y/8u, gridSettings.SliceSize.Z/4u);
-	blurCS->UnbindBuffers(RHICmdList);*/
+	/** Serialization. */
+	virtual bool Serialize( FArchive& Ar ) override
+	{
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize( Ar );
+		Ar << EmissiveVolume;
+		Ar << BounceVolume;
+		Ar << gridRes;
+		return bShaderHasOutdatedParameters;
+	}
 
-	// New frame, new starting idx
-	currentLightIDX = 0;
-}
+	/**
+	 * Set parameters for this shader.
+	 */
+	
+	void SetParameters(FRHICommandList& RHICmdList, FUnorderedAccessViewRHIParamRef EmissiveVolumeUAV, FShaderResourceViewRHIParamRef BounceVolumeSRV, FIntVector inGridRes)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
 
-///
-/// Tracing
-///
-BEGIN_UNIFORM_BUFFER_STRUCT(AHRTraceSceneCB,)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector2D,ScreenRes)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector2D,SamplingKernelUVScaling)
+		if ( EmissiveVolume.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, EmissiveVolume.GetBaseIndex(), EmissiveVolumeUAV);
+		if ( BounceVolume.IsBound() )
+			RHICmdList.SetShaderResourceViewParameter(ComputeShaderRHI, BounceVolume.GetBaseIndex(), BounceVolumeSRV);
 
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FIntVector,SliceSize)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector,HalfInvSceneBounds)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector,WorldToVoxelOffset) // -SceneCenter/SceneBounds
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector,invVoxel)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector,VoxelScaleMult)
+		SetShaderValue(RHICmdList, ComputeShaderRHI, gridRes, inGridRes );
+	}
 
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(float,InitialDispMult)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(float,SamplesDispMultiplier)
+	/**
+	 * Unbinds any buffers that have been bound.
+	 */
+	void UnbindBuffers(FRHICommandList& RHICmdList)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+		if ( EmissiveVolume.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, EmissiveVolume.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
+		if ( BounceVolume.IsBound() )
+			RHICmdList.SetShaderResourceViewParameter(ComputeShaderRHI, BounceVolume.GetBaseIndex(), FShaderResourceViewRHIParamRef());
+	}
 
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(uint32,GlossyRayCount)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(uint32,GlossySamplesCount)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(uint32,DiffuseRayCount)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(uint32,DiffuseSamplesCount)
+private:
+	FShaderResourceParameter EmissiveVolume;
+	FShaderResourceParameter BounceVolume;
+	FShaderParameter gridRes;
+};
 
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector,LostRayColor)
 
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(float,RayIndex)
-END_UNIFORM_BUFFER_STRUCT(AHRTraceSceneCB)
-IMPLEMENT_UNIFORM_BUFFER_STRUCT(AHRTraceSceneCB,TEXT("AHRTraceCB"));
 
+// Clears a region of the static volumes, used to revoxelize only the bricks that changed
 template<int _dummy>
-class AHRTraceScenePS : public FGlobalShader
+class AHRClearVolumeRegion : public FGlobalShader
 {
-	DECLARE_SHADER_TYPE(AHRTraceScenePS,Global)
+	DECLARE_SHADER_TYPE(AHRClearVolumeRegion,Global);
+
 public:
 
 	static bool ShouldCache(EShaderPlatform Platform)
 	{
-		return IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5);
+		return RHISupportsComputeShaders(Platform);
 	}
 
-	static void ModifyCompilationEnvironment(EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment)
+	static void ModifyCompilationEnvironment( EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment )
 	{
-		FGlobalShader::ModifyCompilationEnvironment(Platform, OutEnvironment);
-		if(CVarAHRTraceReflections.GetValueOnRenderThread() == 1)
-			OutEnvironment.SetDefine(TEXT("_GLOSSY"),1);
+		FGlobalShader::ModifyCompilationEnvironment( Platform, OutEnvironment );
 	}
 
-	AHRTraceScenePS(const ShaderMetaType::CompiledShaderInitializerType& Initializer)
-	:	FGlobalShader(Initializer)
+	/** Default constructor. */
+	AHRClearVolumeRegion()
 	{
-		DeferredParameters.Bind(Initializer.ParameterMap);
-		SceneVolume.Bind(Initializer.ParameterMap, TEXT("SceneVolume"));
-		LinearSampler.Bind(Initializer.ParameterMap, TEXT("samLinear"));
-		cb.Bind(Initializer.ParameterMap, TEXT("AHRTraceCB"));
-
-		EmissiveVolume.Bind(Initializer.ParameterMap, TEXT("EmissiveVolume"));
-
-		SamplingKernel.Bind(Initializer.ParameterMap, TEXT("SamplingKernel"));
-		samPoint.Bind(Initializer.ParameterMap, TEXT("samPoint"));
-
-		ObjNormal.Bind(Initializer.ParameterMap, TEXT("ObjNormal"));
 	}
 
-	AHRTraceScenePS()
+	/** Initialization constructor. */
+	explicit AHRClearVolumeRegion( const ShaderMetaType::CompiledShaderInitializerType& Initializer )
+		: FGlobalShader(Initializer)
 	{
+		Volume.Bind( Initializer.ParameterMap, TEXT("Volume") );
+		gridRes.Bind( Initializer.ParameterMap, TEXT("gridRes") );
+		regionMin.Bind( Initializer.ParameterMap, TEXT("regionMin") );
+		regionSize.Bind( Initializer.ParameterMap, TEXT("regionSize") );
+		toroidalOffset.Bind( Initializer.ParameterMap, TEXT("toroidalOffset") );
 	}
 
-	void SetParameters(	FRHICommandList& RHICmdList, const FSceneView& View, 
-						const FShaderResourceViewRHIRef& sceneVolumeSRV, 
-						const FShaderResourceViewRHIRef& emissiveVolumeSRV )
+	/** Serialization. */
+	virtual bool Serialize( FArchive& Ar ) override
 	{
-		FRHIResourceCreateInfo CreateInfo;
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize( Ar );
+		Ar << Volume;
+		Ar << gridRes;
+		Ar << regionMin;
+		Ar << regionSize;
+		Ar << toroidalOffset;
+		return bShaderHasOutdatedParameters;
+	}
 
-		const FPixelShaderRHIParamRef ShaderRHI = GetPixelShader();
+	/**
+	 * Set parameters for this shader.
+	 */
+	
+	void SetParameters(FRHICommandList& RHICmdList, FUnorderedAccessViewRHIParamRef VolumeUAV,FIntVector inGridRes,FIntVector inRegionMin,FIntVector inRegionSize,FIntVector inToroidalOffset)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+
+		if ( Volume.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, Volume.GetBaseIndex(), VolumeUAV);
+
+		SetShaderValue(RHICmdList, ComputeShaderRHI, gridRes, inGridRes );
+		SetShaderValue(RHICmdList, ComputeShaderRHI, regionMin, inRegionMin );
+		SetShaderValue(RHICmdList, ComputeShaderRHI, regionSize, inRegionSize );
+		SetShaderValue(RHICmdList, ComputeShaderRHI, toroidalOffset, inToroidalOffset );
+	}
+
+	/**
+	 * Unbinds any buffers that have been bound.
+	 */
+	void UnbindBuffers(FRHICommandList& RHICmdList)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+		if ( Volume.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, Volume.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
+	}
+
+private:
+	FShaderResourceParameter Volume;
+	FShaderParameter gridRes;
+	FShaderParameter regionMin;
+	FShaderParameter regionSize;
+	FShaderParameter toroidalOffset;
+};
+
+
+// Builds the coarse occupancy level of the combined scene volume
+class AHRBuildOccupancy : public FGlobalShader
+{
+	DECLARE_SHADER_TYPE(AHRBuildOccupancy,Global);
+
+public:
+
+	static bool ShouldCache(EShaderPlatform Platform)
+	{
+		return RHISupportsComputeShaders(Platform);
+	}
+
+	static void ModifyCompilationEnvironment( EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment )
+	{
+		FGlobalShader::ModifyCompilationEnvironment( Platform, OutEnvironment );
+	}
+
+	/** Default constructor. */
+	AHRBuildOccupancy()
+	{
+	}
+
+	/** Initialization constructor. */
+	explicit AHRBuildOccupancy( const ShaderMetaType::CompiledShaderInitializerType& Initializer )
+		: FGlobalShader(Initializer)
+	{
+		SceneVolume.Bind( Initializer.ParameterMap, TEXT("SceneVolume") );
+		OccupancyVolume.Bind( Initializer.ParameterMap, TEXT("OccupancyVolume") );
+		gridRes.Bind( Initializer.ParameterMap, TEXT("gridRes") );
+		wordCount.Bind( Initializer.ParameterMap, TEXT("wordCount") );
+	}
+
+	/** Serialization. */
+	virtual bool Serialize( FArchive& Ar ) override
+	{
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize( Ar );
+		Ar << SceneVolume;
+		Ar << OccupancyVolume;
+		Ar << gridRes;
+		Ar << wordCount;
+		return bShaderHasOutdatedParameters;
+	}
+
+	/**
+	 * Set parameters for this shader.
+	 */
+	
+	void SetParameters(FRHICommandList& RHICmdList, FUnorderedAccessViewRHIParamRef OccupancyVolumeUAV,FShaderResourceViewRHIParamRef SceneVolumeSRV,FIntVector inGridRes,uint32 inWordCount)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+
+		if ( OccupancyVolume.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, OccupancyVolume.GetBaseIndex(), OccupancyVolumeUAV);
+		if ( SceneVolume.IsBound() )
+			RHICmdList.SetShaderResourceViewParameter(ComputeShaderRHI,SceneVolume.GetBaseIndex(), SceneVolumeSRV);
+
+		SetShaderValue(RHICmdList, ComputeShaderRHI, gridRes, inGridRes );
+		SetShaderValue(RHICmdList, ComputeShaderRHI, wordCount, inWordCount );
+	}
+
+	/**
+	 * Unbinds any buffers that have been bound.
+	 */
+	void UnbindBuffers(FRHICommandList& RHICmdList)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+		if ( OccupancyVolume.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, OccupancyVolume.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
+		if ( SceneVolume.IsBound() )
+			RHICmdList.SetShaderResourceViewParameter(ComputeShaderRHI,SceneVolume.GetBaseIndex(), FShaderResourceViewRHIParamRef());
+	}
+
+private:
+	FShaderResourceParameter SceneVolume;
+	FShaderResourceParameter OccupancyVolume;
+	FShaderParameter gridRes;
+	FShaderParameter wordCount;
+};
+
+
+IMPLEMENT_SHADER_TYPE(,AHRDynamicStaticVolumeCombine,TEXT("AHRDynamicStaticVolumeCombine"),TEXT("mainBinary"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(,AHRDynamicStaticEmissiveVolumeCombine,TEXT("AHRDynamicStaticVolumeCombine"),TEXT("mainEmissive"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(,AHRPropagateBounce,TEXT("AHREmissiveConvolution"),TEXT("propagate"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(,AHRAddBounce,TEXT("AHREmissiveConvolution"),TEXT("addBounce"),SF_Compute);
+// Voxel (on grid space) of a splatted primitive, matches the uint4 of AHRSplatPoints.usf
+struct FAHRSplatPoint
+{
+	uint32 X, Y, Z, Pad;
+};
+
+// Marks the voxels of a batch of points on the binary volume
+class AHRSplatPoints : public FGlobalShader
+{
+	DECLARE_SHADER_TYPE(AHRSplatPoints,Global);
+
+public:
+
+	static bool ShouldCache(EShaderPlatform Platform)
+	{
+		return RHISupportsComputeShaders(Platform);
+	}
+
+	static void ModifyCompilationEnvironment( EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment )
+	{
+		FGlobalShader::ModifyCompilationEnvironment( Platform, OutEnvironment );
+		OutEnvironment.SetDefine(TEXT("AHR_SPLAT_BATCH_SIZE"),AHR_SPLAT_BATCH_SIZE);
+	}
+
+	/** Default constructor. */
+	AHRSplatPoints()
+	{
+	}
+
+	/** Initialization constructor. */
+	explicit AHRSplatPoints( const ShaderMetaType::CompiledShaderInitializerType& Initializer )
+		: FGlobalShader(Initializer)
+	{
+		Volume.Bind( Initializer.ParameterMap, TEXT("Volume") );
+		gridRes.Bind( Initializer.ParameterMap, TEXT("gridRes") );
+		toroidalOffset.Bind( Initializer.ParameterMap, TEXT("toroidalOffset") );
+		numPoints.Bind( Initializer.ParameterMap, TEXT("numPoints") );
+		points.Bind( Initializer.ParameterMap, TEXT("points") );
+	}
+
+	/** Serialization. */
+	virtual bool Serialize( FArchive& Ar ) override
+	{
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize( Ar );
+		Ar << Volume;
+		Ar << gridRes;
+		Ar << toroidalOffset;
+		Ar << numPoints;
+		Ar << points;
+		return bShaderHasOutdatedParameters;
+	}
+
+	/**
+	 * Set parameters for this shader.
+	 */
+	
+	void SetParameters(FRHICommandList& RHICmdList, FUnorderedAccessViewRHIParamRef VolumeUAV,FIntVector inGridRes,FIntVector inToroidalOffset)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+
+		if ( Volume.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, Volume.GetBaseIndex(), VolumeUAV);
+
+		SetShaderValue(RHICmdList, ComputeShaderRHI, gridRes, inGridRes );
+		SetShaderValue(RHICmdList, ComputeShaderRHI, toroidalOffset, inToroidalOffset );
+	}
+
+	void SetPoints(FRHICommandList& RHICmdList, const FAHRSplatPoint* inPoints, uint32 inNumPoints)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+
+		SetShaderValue(RHICmdList, ComputeShaderRHI, numPoints, inNumPoints );
+		SetShaderValueArray(RHICmdList, ComputeShaderRHI, points, inPoints, inNumPoints );
+	}
+
+	/**
+	 * Unbinds any buffers that have been bound.
+	 */
+	void UnbindBuffers(FRHICommandList& RHICmdList)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+		if ( Volume.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, Volume.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
+	}
+
+private:
+	FShaderResourceParameter Volume;
+	FShaderParameter gridRes;
+	FShaderParameter toroidalOffset;
+	FShaderParameter numPoints;
+	FShaderParameter points;
+};
+
+
+IMPLEMENT_SHADER_TYPE(template<>,AHRClearVolumeRegion<0>,TEXT("AHRClearVolumeRegion"),TEXT("clearBinary"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(template<>,AHRClearVolumeRegion<1>,TEXT("AHRClearVolumeRegion"),TEXT("clearEmissive"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(,AHRBuildOccupancy,TEXT("AHRBuildOccupancy"),TEXT("main"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(,AHRSplatPoints,TEXT("AHRSplatPoints"),TEXT("main"),SF_Compute);
+
+void FApproximateHybridRaytracer::ClearStaticRegion(FRHICommandListImmediate& RHICmdList,FViewInfo& View,const FIntVector& RegionMin,const FIntVector& RegionMax)
+{
+	const FIntVector RegionSize = RegionMax - RegionMin;
+
+	TShaderMapRef<AHRClearVolumeRegion<0>> clearCS(GetGlobalShaderMap(View.GetFeatureLevel()));
+	RHICmdList.SetComputeShader(clearCS->GetComputeShader());
+	clearCS->SetParameters(RHICmdList, StaticSceneVolume->UAV, gridSettings.SliceSize, RegionMin, RegionSize, gridSettings.ToroidalOffset);
+	DispatchComputeShader(RHICmdList, *clearCS, fceil((uint32)RegionSize.X,8u), fceil((uint32)RegionSize.Y,8u), fceil((uint32)RegionSize.Z,4u));
+	clearCS->UnbindBuffers(RHICmdList);
+
+	// The emissive volume is half res. The brick size is even, so the region maps exactly
+	const FIntVector HalfRegionSize = FIntVector(fceil((uint32)RegionSize.X,2u),fceil((uint32)RegionSize.Y,2u),fceil((uint32)RegionSize.Z,2u));
+
+	TShaderMapRef<AHRClearVolumeRegion<1>> clearEmissiveCS(GetGlobalShaderMap(View.GetFeatureLevel()));
+	RHICmdList.SetComputeShader(clearEmissiveCS->GetComputeShader());
+	clearEmissiveCS->SetParameters(RHICmdList, StaticEmissiveVolume->UAV, gridSettings.SliceSize/2, RegionMin/2, HalfRegionSize, gridSettings.ToroidalOffset/2);
+	DispatchComputeShader(RHICmdList, *clearEmissiveCS, fceil((uint32)HalfRegionSize.X,8u), fceil((uint32)HalfRegionSize.Y,8u), fceil((uint32)HalfRegionSize.Z,4u));
+	clearEmissiveCS->UnbindBuffers(RHICmdList);
+}
+
+void FApproximateHybridRaytracer::SplatPrimitives(FRHICommandListImmediate& RHICmdList,FViewInfo& View,const TArray<const FPrimitiveSceneProxy*,SceneRenderingAllocator>& Primitives)
+{
+	if(Primitives.Num() == 0)
+		return;
+
+	SCOPED_DRAW_EVENT(RHICmdList,AHRSplatPrimitives);
+
+	// Voxel of the center of the bounds, on grid space
+	const FVector HalfInvSceneBounds = FVector(0.5f) / gridSettings.Bounds;
+	const FVector WorldToVoxelOffset = -gridSettings.Center*HalfInvSceneBounds + 0.5f;
+	const FVector GridSize(gridSettings.SliceSize.X,gridSettings.SliceSize.Y,gridSettings.SliceSize.Z);
+
+	TArray<FAHRSplatPoint,SceneRenderingAllocator> Points;
+	Points.Reserve(Primitives.Num());
+	for(auto Proxy : Primitives)
+	{
+		const FVector Local = (Proxy->GetBounds().Origin*HalfInvSceneBounds + WorldToVoxelOffset)*GridSize;
+		const FIntVector Voxel(FMath::FloorToInt(Local.X),FMath::FloorToInt(Local.Y),FMath::FloorToInt(Local.Z));
+		if(Voxel.X >= 0 && Voxel.Y >= 0 && Voxel.Z >= 0 &&
+		   Voxel.X < gridSettings.SliceSize.X && Voxel.Y < gridSettings.SliceSize.Y && Voxel.Z < gridSettings.SliceSize.Z)
+		{
+			FAHRSplatPoint Point = { (uint32)Voxel.X, (uint32)Voxel.Y, (uint32)Voxel.Z, 0 };
+			Points.Add(Point);
+		}
+	}
+
+	TShaderMapRef<AHRSplatPoints> splatCS(GetGlobalShaderMap(View.GetFeatureLevel()));
+	RHICmdList.SetComputeShader(splatCS->GetComputeShader());
+	splatCS->SetParameters(RHICmdList, (*currentVolume)->UAV, gridSettings.SliceSize, gridSettings.ToroidalOffset);
+	for(int32 First = 0;First < Points.Num();First += AHR_SPLAT_BATCH_SIZE)
+	{
+		splatCS->SetPoints(RHICmdList, &Points[First], FMath::Min(Points.Num() - First, AHR_SPLAT_BATCH_SIZE));
+		DispatchComputeShader(RHICmdList, *splatCS, 1, 1, 1);
+	}
+	splatCS->UnbindBuffers(RHICmdList);
+}
+
+bool FApproximateHybridRaytracer::GetScrolledRegions(const AHRGridSettings& PrevSettings,TArray<FIntVector,TInlineAllocator<6>>& OutRegions) const
+{
+	const FIntVector& Size = gridSettings.SliceSize;
+	const FVector VoxelWorldSize = (gridSettings.Bounds*2.0f) / FVector(Size.X,Size.Y,Size.Z);
+	const FVector Delta = (gridSettings.Center - PrevSettings.Center) / VoxelWorldSize;
+	const FIntVector DeltaVoxels(FMath::RoundToInt(Delta.X),FMath::RoundToInt(Delta.Y),FMath::RoundToInt(Delta.Z));
+
+	// The toroidal offset must have followed the movement, otherwise the volume content doesn't match the new addressing
+	auto WrapIndex = [](int32 Value,int32 Max){ return ((Value % Max) + Max) % Max; };
+	for(int32 Axis = 0;Axis < 3;Axis++)
+	{
+		if(FMath::Abs(DeltaVoxels(Axis)) >= Size(Axis) ||
+		   WrapIndex(PrevSettings.ToroidalOffset(Axis) + DeltaVoxels(Axis),Size(Axis)) != gridSettings.ToroidalOffset(Axis))
+			return false;
+	}
+
+	// One slab per axis, on the side that entered the grid
+	for(int32 Axis = 0;Axis < 3;Axis++)
+	{
+		if(DeltaVoxels(Axis) == 0)
+			continue;
+
+		FIntVector SlabMin(0,0,0);
+		FIntVector SlabMax = Size;
+		if(DeltaVoxels(Axis) > 0)
+			SlabMin(Axis) = Size(Axis) - DeltaVoxels(Axis);
+		else
+			SlabMax(Axis) = -DeltaVoxels(Axis);
+
+		OutRegions.Add(SlabMin);
+		OutRegions.Add(SlabMax);
+	}
+
+	return true;
+}
+
+void FApproximateHybridRaytracer::PropagateBounce(FRHICommandListImmediate& RHICmdList,FViewInfo& View)
+{
+	SCOPED_DRAW_EVENT(RHICmdList,AHRPropagateBounce);
+
+	const FIntVector HalfSliceSize = gridSettings.SliceSize/2;
+	const FIntVector HalfToroidalOffset = gridSettings.ToroidalOffset/2;
+
+	// The bounces follow the grid like the static volume does. If it can't be scrolled they are rebuilt from scratch
+	TArray<FIntVector,TInlineAllocator<6>> ScrolledRegions;
+	bool bReset = !bBounceHistoryValid ||
+		View.FinalPostProcessSettings.AHRRebuildGrids ||
+		bounceGridSettings.Bounds != gridSettings.Bounds ||
+		bounceGridSettings.SliceSize != gridSettings.SliceSize;
+	if(!bReset && bounceGridSettings.Center != gridSettings.Center)
+		bReset = !GetScrolledRegions(bounceGridSettings,ScrolledRegions);
+	bounceGridSettings = gridSettings;
+
+	if(bReset)
+	{
+		uint32 cls[4] = { 0,0,0,0 };
+		RHICmdList.ClearUAV(BounceVolume->UAV, cls);
+		bBounceHistoryValid = true;
+		bBounceFullyDirty = true;
+
+		// Drop the sweep in progress, the new one covers everything
+		BounceRegionMin = BounceRegionMax = FIntVector(0,0,0);
+		BounceCursor = 0;
+		BounceSweepsLeft = 0;
+	}
+
+	// The slabs that entered the grid hold the bounces of the other side
+	for(int32 i = 0;i < ScrolledRegions.Num();i += 2)
+	{
+		const FIntVector RegionMin = ScrolledRegions[i]/2;
+		const FIntVector RegionSize = FIntVector(fceil((uint32)ScrolledRegions[i + 1].X,2u),fceil((uint32)ScrolledRegions[i + 1].Y,2u),fceil((uint32)ScrolledRegions[i + 1].Z,2u)) - RegionMin;
+
+		TShaderMapRef<AHRClearVolumeRegion<1>> clearCS(GetGlobalShaderMap(View.GetFeatureLevel()));
+		RHICmdList.SetComputeShader(clearCS->GetComputeShader());
+		clearCS->SetParameters(RHICmdList, BounceVolume->UAV, HalfSliceSize, RegionMin, RegionSize, HalfToroidalOffset);
+		DispatchComputeShader(RHICmdList, *clearCS, fceil((uint32)RegionSize.X,8u), fceil((uint32)RegionSize.Y,8u), fceil((uint32)RegionSize.Z,4u));
+		clearCS->UnbindBuffers(RHICmdList);
+
+		BounceDirtyBounds += GetVoxelRegionBounds(ScrolledRegions[i],ScrolledRegions[i + 1]);
+	}
+
+	// The lights aren't bounded, so one that changed relights the whole grid
+	bool bLightsChanged = PrevNumLights != currentLightIDX;
+	for(uint32 i = 0;i < currentLightIDX;i++)
+	{
+		bLightsChanged |= !PrevLightViewProj[i].Equals(lights[i].ViewProj);
+		PrevLightViewProj[i] = lights[i].ViewProj;
+	}
+	PrevNumLights = currentLightIDX;
+	bBounceFullyDirty |= bLightsChanged;
+
+	// A new sweep starts with what got dirty during the last one. The regions that haven't converged yet keep being swept
+	if(BounceCursor >= BounceRegionMax.Z)
+	{
+		FIntVector DirtyMin, DirtyMax;
+		bool bDirty = false;
+		if(bBounceFullyDirty)
+		{
+			DirtyMin = FIntVector(0,0,0);
+			DirtyMax = HalfSliceSize;
+			bDirty = true;
+		}
+		else if(BounceDirtyBounds.IsValid && GetVoxelRegion(BounceDirtyBounds,2,DirtyMin,DirtyMax))
+		{
+			// One voxel of margin, so the neighbours gather the change too
+			DirtyMin = FIntVector(FMath::Max(DirtyMin.X/2 - 1,0),FMath::Max(DirtyMin.Y/2 - 1,0),FMath::Max(DirtyMin.Z/2 - 1,0));
+			DirtyMax = FIntVector(FMath::Min(DirtyMax.X/2 + 1,HalfSliceSize.X),FMath::Min(DirtyMax.Y/2 + 1,HalfSliceSize.Y),FMath::Min(DirtyMax.Z/2 + 1,HalfSliceSize.Z));
+			bDirty = true;
+		}
+
+		if(BounceSweepsLeft > 0)
+			BounceSweepsLeft--;
+
+		if(bDirty)
+		{
+			if(BounceSweepsLeft > 0)
+			{
+				DirtyMin = FIntVector(FMath::Min(DirtyMin.X,BounceRegionMin.X),FMath::Min(DirtyMin.Y,BounceRegionMin.Y),FMath::Min(DirtyMin.Z,BounceRegionMin.Z));
+				DirtyMax = FIntVector(FMath::Max(DirtyMax.X,BounceRegionMax.X),FMath::Max(DirtyMax.Y,BounceRegionMax.Y),FMath::Max(DirtyMax.Z,BounceRegionMax.Z));
+			}
+			BounceRegionMin = DirtyMin;
+			BounceRegionMax = DirtyMax;
+			BounceSweepsLeft = AHR_BOUNCE_SWEEPS;
+		}
+		// Once converged, stay at the end of the region so the next dirty bounds start a sweep right away
+		BounceCursor = BounceSweepsLeft > 0 ? BounceRegionMin.Z : BounceRegionMax.Z;
+		bBounceFullyDirty = false;
+		BounceDirtyBounds.Init();
+	}
+
+	// Propagate a few slices of the region
+	if(BounceSweepsLeft > 0)
+	{
+		const int32 SlicesPerFrame = FMath::Max(CVarAHRBounceSlicesPerFrame.GetValueOnRenderThread(),1);
+		const FIntVector RegionMin(BounceRegionMin.X,BounceRegionMin.Y,BounceCursor);
+		const FIntVector RegionSize(BounceRegionMax.X - BounceRegionMin.X,BounceRegionMax.Y - BounceRegionMin.Y,FMath::Min(SlicesPerFrame,BounceRegionMax.Z - BounceCursor));
+		BounceCursor += RegionSize.Z;
+
+		TShaderMapRef<AHRPropagateBounce> propagateCS(GetGlobalShaderMap(View.GetFeatureLevel()));
+		RHICmdList.SetComputeShader(propagateCS->GetComputeShader());
+		propagateCS->SetParameters(RHICmdList, DynamicEmissiveVolume->SRV, BounceVolume->UAV, HalfSliceSize, RegionMin, RegionSize, HalfToroidalOffset,
+									FMath::Clamp(CVarAHRBounceIntensity.GetValueOnRenderThread(),0.0f,0.95f),
+									FMath::Clamp(CVarAHRBounceTemporalWeight.GetValueOnRenderThread(),0.0f,0.99f));
+		DispatchComputeShader(RHICmdList, *propagateCS, fceil((uint32)RegionSize.X,8u), fceil((uint32)RegionSize.Y,8u), fceil((uint32)RegionSize.Z,4u));
+		propagateCS->UnbindBuffers(RHICmdList);
+	}
+
+	// The combined emissive volume is rebuilt every frame, so the bounces are added back on all of it
+	TShaderMapRef<AHRAddBounce> addCS(GetGlobalShaderMap(View.GetFeatureLevel()));
+	RHICmdList.SetComputeShader(addCS->GetComputeShader());
+	addCS->SetParameters(RHICmdList, DynamicEmissiveVolume->UAV, BounceVolume->SRV, HalfSliceSize);
+	DispatchComputeShader(RHICmdList, *addCS, fceil((uint32)HalfSliceSize.X,8u), fceil((uint32)HalfSliceSize.Y,8u), fceil((uint32)HalfSliceSize.Z,4u));
+	addCS->UnbindBuffers(RHICmdList);
+}
+
+typedef TArray<FViewInfo::AHRElementToVoxelize,SceneRenderingAllocator> FAHRElementsToVoxelize;
+
+// Records the voxelization draws of a range of elements on a parallel command list
+class FAHRVoxelizeElementsThreadTask
+{
+	FRHICommandList& RHICmdList;
+	const FViewInfo& View;
+	const FAHRElementsToVoxelize& Elements;
+	FAHRVoxelizerDrawingPolicyFactory::ContextType Context;
+	int32 First;
+	int32 Last;
+
+public:
+
+	FAHRVoxelizeElementsThreadTask(
+		FRHICommandList& InRHICmdList,
+		const FViewInfo& InView,
+		const FAHRElementsToVoxelize& InElements,
+		const FAHRVoxelizerDrawingPolicyFactory::ContextType& InContext,
+		int32 InFirst,
+		int32 InLast
+		)
+		: RHICmdList(InRHICmdList)
+		, View(InView)
+		, Elements(InElements)
+		, Context(InContext)
+		, First(InFirst)
+		, Last(InLast)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FAHRVoxelizeElementsThreadTask, STATGROUP_TaskGraphTasks);
+	}
+
+	ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::TrackSubsequents; }
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		for(int32 i = First;i <= Last;i++)
+		{
+			const FViewInfo::AHRElementToVoxelize& e = Elements[i];
+			FAHRVoxelizerDrawingPolicyFactory::DrawDynamicMesh(RHICmdList, View, Context, *e.Mesh, false, true, e.PrimitiveSceneProxy, e.Mesh->BatchHitProxyId);
+		}
+		RHICmdList.HandleRTThreadTaskCompletion(MyCompletionGraphEvent);
+	}
+};
+
+// Issues the voxelization draws of the elements to the volumes captured on the context.
+// With parallel algorithms the elements are split across FParallelCommandListSet::Width command lists, the same way the static draw lists split their policies
+static void VoxelizeElements(FRHICommandListImmediate& RHICmdList, const FViewInfo& View, const FAHRElementsToVoxelize& Elements, const FAHRVoxelizerDrawingPolicyFactory::ContextType& Context)
+{
+	if(Elements.Num() == 0)
+		return;
+
+	if(GRHICommandList.UseParallelAlgorithms() && CVarAHRParallelVoxelization.GetValueOnRenderThread() != 0)
+	{
+		// Declared first so the recording tasks are waited on after the set submitted its command lists
+		FScopedCommandListWaitForTasks Flusher(RHICmdList);
+
+		// Every draw sets its whole state, so the command lists need no setup and can go to deferred contexts
+		FParallelCommandListSet ParallelSet(View, RHICmdList, nullptr, true);
+
+		const int32 EffectiveThreads = FMath::Min<int32>(Elements.Num(), ParallelSet.Width);
+		const int32 NumPer = Elements.Num() / EffectiveThreads;
+		const int32 Extra = Elements.Num() - NumPer * EffectiveThreads;
+
+		int32 Start = 0;
+		for(int32 ThreadIndex = 0;ThreadIndex < EffectiveThreads;ThreadIndex++)
+		{
+			const int32 Last = Start + (NumPer - 1) + (ThreadIndex < Extra);
+
+			FRHICommandList* CmdList = ParallelSet.NewParallelCommandList();
+			FGraphEventRef AnyThreadCompletionEvent = TGraphTask<FAHRVoxelizeElementsThreadTask>::CreateTask(nullptr, ENamedThreads::RenderThread)
+				.ConstructAndDispatchWhenReady(*CmdList, View, Elements, Context, Start, Last);
+			ParallelSet.AddParallelCommandList(CmdList, AnyThreadCompletionEvent);
+
+			Start = Last + 1;
+		}
+		check(Start == Elements.Num());
+	}
+	else
+	{
+		for(auto e : Elements)
+			FAHRVoxelizerDrawingPolicyFactory::DrawDynamicMesh(RHICmdList, View, Context, *e.Mesh, false, true, e.PrimitiveSceneProxy, e.Mesh->BatchHitProxyId);
+	}
+}
+
+void FApproximateHybridRaytracer::VoxelizeScene(FRHICommandListImmediate& RHICmdList,FViewInfo& View)
+{
+	SCOPED_DRAW_EVENT(RHICmdList,AHRVoxelizeScene);
+	SCOPE_CYCLE_COUNTER(STAT_AHRVoxelizeScene);
+	FAHRScopedGPUStage GPUStage(RHICmdList,AHRStage_VoxelizeScene);
+
+	uint32 cls[4] = { 0,0,0,0 };
+	const bool bUseStaticVolume = CVarAHRStaticVolume.GetValueOnRenderThread() != 0;
+
+	// Dirty regions of the static volume, as min/max pairs on grid space
+	TArray<FIntVector,TInlineAllocator<6>> DirtyRegions;
+
+	// Static primitives are voxelized only once to the static volume. The whole volume is rebuilt if the grid changed or if it was requested
+	if( !bUseStaticVolume ||
+		View.FinalPostProcessSettings.AHRRebuildGrids ||
+		staticGridSettings.Bounds != gridSettings.Bounds ||
+		staticGridSettings.SliceSize != gridSettings.SliceSize)
+	{
+		bStaticVolumeFullyDirty = true;
+	}
+	else if(staticGridSettings.Center != gridSettings.Center && !bStaticVolumeFullyDirty)
+	{
+		// If the grid scrolled only the newly exposed slabs need to be revoxelized
+		if(!GetScrolledRegions(staticGridSettings,DirtyRegions))
+			bStaticVolumeFullyDirty = true;
+	}
+	staticGridSettings = gridSettings;
+
+	if(bUseStaticVolume)
+	{
+		FIntVector RegionMin, RegionMax;
+		if(GetStaticDirtyRegion(RegionMin,RegionMax))
+		{
+			DirtyRegions.Add(RegionMin);
+			DirtyRegions.Add(RegionMax);
+		}
+
+		if(bStaticVolumeFullyDirty || DirtyRegions.Num() > 0)
+		{
+			SCOPED_DRAW_EVENT(RHICmdList,AHRVoxelizeStatic);
+
+			TArray<FBox,TInlineAllocator<3>> RegionsBounds;
+			if(bStaticVolumeFullyDirty)
+			{
+				RHICmdList.ClearUAV(StaticSceneVolume->UAV, cls);
+				RHICmdList.ClearUAV(StaticEmissiveVolume->UAV, cls);
+			}
+			else
+			{
+				// Only clear the dirty bricks
+				for(int32 i = 0;i < DirtyRegions.Num();i += 2)
+				{
+					ClearStaticRegion(RHICmdList,View,DirtyRegions[i],DirtyRegions[i + 1]);
+					RegionsBounds.Add(GetVoxelRegionBounds(DirtyRegions[i],DirtyRegions[i + 1]));
+				}
+			}
+
+			// Revoxelize every static element that touches a cleared region, not only the dirty ones, as the clear also removed their voxels
+			SetStaticVolumeAsActive();
+
+			FAHRElementsToVoxelize StaticElements;
+			for(auto e : View.PrimitivesElementsToVoxelize)
+			{
+				if(e.PrimitiveSceneProxy->NeedsEveryFrameVoxelization())
+					continue;
+
+				bool bTouchesDirtyRegion = bStaticVolumeFullyDirty;
+				const FBox ElementBounds = e.PrimitiveSceneProxy->GetBounds().GetBox();
+				for(int32 i = 0;i < RegionsBounds.Num() && !bTouchesDirtyRegion;i++)
+					bTouchesDirtyRegion = RegionsBounds[i].Intersect(ElementBounds);
+
+				if(bTouchesDirtyRegion)
+				{
+					StaticElements.Add(e);
+					INC_DWORD_STAT(STAT_AHRVoxelizedElements);
+					INC_DWORD_STAT_BY(STAT_AHRVoxelizedTriangles, e.Mesh->GetNumPrimitives());
+				}
+			}
+
+			VoxelizeElements(RHICmdList, View, StaticElements, FAHRVoxelizerDrawingPolicyFactory::ContextType());
+
+			TArray<const FPrimitiveSceneProxy*,SceneRenderingAllocator> StaticPrimitivesToSplat;
+			for(auto Proxy : View.PrimitivesToSplat)
+			{
+				if(Proxy->NeedsEveryFrameVoxelization())
+					continue;
+
+				bool bTouchesDirtyRegion = bStaticVolumeFullyDirty;
+				const FBox PrimitiveBounds = Proxy->GetBounds().GetBox();
+				for(int32 i = 0;i < RegionsBounds.Num() && !bTouchesDirtyRegion;i++)
+					bTouchesDirtyRegion = RegionsBounds[i].Intersect(PrimitiveBounds);
+
+				if(bTouchesDirtyRegion)
+					StaticPrimitivesToSplat.Add(Proxy);
+			}
+			SplatPrimitives(RHICmdList, View, StaticPrimitivesToSplat);
+		}
+
+		bStaticVolumeFullyDirty = false;
+		StaticDirtyBounds.Init();
+	}
+
+	// Voxelize to the dynamic grid
+	RHICmdList.ClearUAV(DynamicSceneVolume->UAV, cls);
+	RHICmdList.ClearUAV(DynamicEmissiveVolume->UAV, cls);
+	SetDynamicVolumeAsActive();
+
+	FAHRElementsToVoxelize DynamicElements;
+	for(auto e : View.PrimitivesElementsToVoxelize)
+	{
+		if(!bUseStaticVolume || e.PrimitiveSceneProxy->NeedsEveryFrameVoxelization())
+		{
+			// Moving geometry changes the bounces around it
+			BounceDirtyBounds += e.PrimitiveSceneProxy->GetBounds().GetBox();
+			DynamicElements.Add(e);
+			INC_DWORD_STAT(STAT_AHRVoxelizedElements);
+			INC_DWORD_STAT_BY(STAT_AHRVoxelizedTriangles, e.Mesh->GetNumPrimitives());
+		}
+	}
+
+	VoxelizeElements(RHICmdList, View, DynamicElements, FAHRVoxelizerDrawingPolicyFactory::ContextType());
+
+	TArray<const FPrimitiveSceneProxy*,SceneRenderingAllocator> DynamicPrimitivesToSplat;
+	for(auto Proxy : View.PrimitivesToSplat)
+	{
+		if(!bUseStaticVolume || Proxy->NeedsEveryFrameVoxelization())
+			DynamicPrimitivesToSplat.Add(Proxy);
+	}
+	SplatPrimitives(RHICmdList, View, DynamicPrimitivesToSplat);
+
+	if(bUseStaticVolume)
+	{
+		SCOPED_DRAW_EVENT(RHICmdList,AHRCombineVolumes);
+
+		// Dispatch a compute shader that applies a per voxel pack or between the static grid and the dynamic grid.
+		// The dynamic grid is the one that gets binded as an SRV
+		TShaderMapRef<AHRDynamicStaticVolumeCombine> combineCS(GetGlobalShaderMap(View.GetFeatureLevel()));
+		RHICmdList.SetComputeShader(combineCS->GetComputeShader());
+		uint32 l = gridSettings.SliceSize.X*gridSettings.SliceSize.Y*gridSettings.SliceSize.Z/32;
+		uint32 x = ceil(cbrt(l / 256.0f)); // cbrt = cubic root
+		combineCS->SetParameters(RHICmdList, DynamicSceneVolume->UAV,DynamicEmissiveVolume->UAV,StaticSceneVolume->SRV,StaticEmissiveVolume->SRV,FIntVector(x*8,x*8,x*4));
+		DispatchComputeShader(RHICmdList, *combineCS, x, x, x);
+		combineCS->UnbindBuffers(RHICmdList);
+
+		// One uint per emissive voxel, and the emissive volume is half res
+		TShaderMapRef<AHRDynamicStaticEmissiveVolumeCombine> combineCSEmissive(GetGlobalShaderMap(View.GetFeatureLevel()));
+		RHICmdList.SetComputeShader(combineCSEmissive->GetComputeShader());
+		l = gridSettings.SliceSize.X*gridSettings.SliceSize.Y*gridSettings.SliceSize.Z/8;
+		x = ceil(cbrt(l / 256.0f)); // cbrt = cubic root
+		combineCSEmissive->SetParameters(RHICmdList, DynamicSceneVolume->UAV,DynamicEmissiveVolume->UAV,StaticSceneVolume->SRV,StaticEmissiveVolume->SRV,FIntVector(x*8,x*8,x*4));
+		DispatchComputeShader(RHICmdList, *combineCSEmissive, x, x ,x);
+		combineCSEmissive->UnbindBuffers(RHICmdList);
+	}
+
+	// Build the coarse occupancy from the combined volume, so the tracing can skip the empty space
+	{
+		SCOPED_DRAW_EVENT(RHICmdList,AHRBuildOccupancy);
+
+		RHICmdList.ClearUAV(OccupancyVolume->UAV, cls);
+
+		uint32 wordCount = fceil((uint32)(gridSettings.SliceSize.X*gridSettings.SliceSize.Y*gridSettings.SliceSize.Z),32u);
+		TShaderMapRef<AHRBuildOccupancy> occupancyCS(GetGlobalShaderMap(View.GetFeatureLevel()));
+		RHICmdList.SetComputeShader(occupancyCS->GetComputeShader());
+		occupancyCS->SetParameters(RHICmdList, OccupancyVolume->UAV, DynamicSceneVolume->SRV, gridSettings.SliceSize, wordCount);
+		DispatchComputeShader(RHICmdList, *occupancyCS, fceil(wordCount,256u), 1, 1);
+		occupancyCS->UnbindBuffers(RHICmdList);
+	}
+
+	// Multiple bounces, propagated incrementally instead of blurring the whole emissive grid every frame
+	if(CVarAHRMultiBounce.GetValueOnRenderThread() != 0)
+	{
+		PropagateBounce(RHICmdList,View);
+	}
+	else
+	{
+		// The bounces stop being tracked, start over when they are turned back on
+		bBounceHistoryValid = false;
+		BounceDirtyBounds.Init();
+	}
+
+	// New frame, new starting idx
+	currentLightIDX = 0;
+	ShadowAtlasCursor = FIntPoint::ZeroValue;
+	ShadowAtlasRowHeight = 0;
+}
+
+///
+/// Tracing
+///
+BEGIN_UNIFORM_BUFFER_STRUCT(AHRTraceSceneCB,)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector2D,ScreenRes)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector2D,SamplingKernelUVScaling)
+
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FIntVector,SliceSize)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FIntVector,ToroidalOffset)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector,HalfInvSceneBounds)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector,WorldToVoxelOffset) // -SceneCenter/SceneBounds
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector,invVoxel)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector,VoxelScaleMult)
+
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(float,InitialDispMult)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(float,SamplesDispMultiplier)
+
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(uint32,GlossyRayCount)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(uint32,GlossySamplesCount)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(uint32,DiffuseRayCount)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(uint32,DiffuseSamplesCount)
+
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector,LostRayColor)
+
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(float,RayIndex)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector2D,KernelRotation)
+END_UNIFORM_BUFFER_STRUCT(AHRTraceSceneCB)
+IMPLEMENT_UNIFORM_BUFFER_STRUCT(AHRTraceSceneCB,TEXT("AHRTraceCB"));
+
+static AHRTraceSceneCB GetAHRTraceSceneCB(const FVector2D& ScreenRes, const float& RayIndex, const FSceneView& View)
+{
+	AHRTraceSceneCB cbdata;
+	AHRGridSettings ahrGrid = AHREngine.GetGridSettings();
+
+	cbdata.SamplingKernelUVScaling = ScreenRes / FVector2D(4.0f,4.0f);
+	cbdata.SliceSize.X = ahrGrid.SliceSize.X;
+	cbdata.SliceSize.Y = ahrGrid.SliceSize.Y;
+	cbdata.SliceSize.Z = ahrGrid.SliceSize.Z;
+	cbdata.ToroidalOffset = ahrGrid.ToroidalOffset;
+	cbdata.ScreenRes = ScreenRes;
+	cbdata.invVoxel = FVector(1.0f / float(cbdata.SliceSize.X),
+							  1.0f / float(cbdata.SliceSize.Y),
+							  1.0f / float(cbdata.SliceSize.Z));
+	cbdata.VoxelScaleMult = cbdata.invVoxel*ahrGrid.Bounds;
+	cbdata.HalfInvSceneBounds = FVector(0.5f) / ahrGrid.Bounds;
+	cbdata.WorldToVoxelOffset = -ahrGrid.Center*cbdata.HalfInvSceneBounds + 0.5f; // -SceneCenter/SceneBounds
+	const float SamplesScale = CVarAHRSamplesScale.GetValueOnRenderThread();
+	cbdata.GlossyRayCount = View.FinalPostProcessSettings.AHRGlossyRayCount;
+	cbdata.GlossySamplesCount = FMath::Max(1,FMath::RoundToInt(View.FinalPostProcessSettings.AHRGlossySamplesCount*SamplesScale));
+	cbdata.DiffuseRayCount = View.FinalPostProcessSettings.AHRDiffuseRayCount;
+	cbdata.DiffuseSamplesCount = FMath::Max(1,FMath::RoundToInt(View.FinalPostProcessSettings.AHRDiffuseSamplesCount*SamplesScale));
+	cbdata.LostRayColor.X = View.FinalPostProcessSettings.AHRLostRayColor.R;
+	cbdata.LostRayColor.Y = View.FinalPostProcessSettings.AHRLostRayColor.G;
+	cbdata.LostRayColor.Z = View.FinalPostProcessSettings.AHRLostRayColor.B;
+	cbdata.InitialDispMult = View.FinalPostProcessSettings.AHRInitialDisplacement;
+	cbdata.SamplesDispMultiplier = View.FinalPostProcessSettings.AHRSamplesDisplacement;
+	cbdata.RayIndex = RayIndex;
+	cbdata.KernelRotation = AHREngine.GetKernelRotation();
+
+	return cbdata;
+}
+
+template<int _dummy>
+class AHRTraceScenePS : public FGlobalShader
+{
+	DECLARE_SHADER_TYPE(AHRTraceScenePS,Global)
+public:
+
+	static bool ShouldCache(EShaderPlatform Platform)
+	{
+		return IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		// Nothing here may depend on runtime state such as cvars, or a single global shader map couldn't be shared through the DDC.
+		// The reflection trace is its own entry point, and is picked at runtime
+		FGlobalShader::ModifyCompilationEnvironment(Platform, OutEnvironment);
+	}
+
+	AHRTraceScenePS(const ShaderMetaType::CompiledShaderInitializerType& Initializer)
+	:	FGlobalShader(Initializer)
+	{
+		DeferredParameters.Bind(Initializer.ParameterMap);
+		SceneVolume.Bind(Initializer.ParameterMap, TEXT("SceneVolume"));
+		LinearSampler.Bind(Initializer.ParameterMap, TEXT("samLinear"));
+		cb.Bind(Initializer.ParameterMap, TEXT("AHRTraceCB"));
+
+		EmissiveVolume.Bind(Initializer.ParameterMap, TEXT("EmissiveVolume"));
+		OccupancyVolume.Bind(Initializer.ParameterMap, TEXT("OccupancyVolume"));
+
+		SamplingKernel.Bind(Initializer.ParameterMap, TEXT("SamplingKernel"));
+		samPoint.Bind(Initializer.ParameterMap, TEXT("samPoint"));
+
+		ObjNormal.Bind(Initializer.ParameterMap, TEXT("ObjNormal"));
+		GlobalDistanceFieldParameters.Bind(Initializer.ParameterMap);
+	}
+
+	AHRTraceScenePS()
+	{
+	}
+
+	void SetParameters(	FRHICommandList& RHICmdList, const FSceneView& View, 
+						const FShaderResourceViewRHIRef& sceneVolumeSRV, 
+						const FShaderResourceViewRHIRef& emissiveVolumeSRV,
+						const FShaderResourceViewRHIRef& occupancyVolumeSRV,
+						const FGlobalDistanceFieldInfo& GlobalDistanceFieldInfo )
+	{
+		FRHIResourceCreateInfo CreateInfo;
+
+		const FPixelShaderRHIParamRef ShaderRHI = GetPixelShader();
+		FGlobalShader::SetParameters(RHICmdList, ShaderRHI,View);
+		DeferredParameters.Set(RHICmdList, ShaderRHI, View);
+
+		if(SceneVolume.IsBound())
+			RHICmdList.SetShaderResourceViewParameter(ShaderRHI,SceneVolume.GetBaseIndex(),sceneVolumeSRV);
+		if(EmissiveVolume.IsBound())
+			RHICmdList.SetShaderResourceViewParameter(ShaderRHI,EmissiveVolume.GetBaseIndex(),emissiveVolumeSRV);
+		if(OccupancyVolume.IsBound())
+			RHICmdList.SetShaderResourceViewParameter(ShaderRHI,OccupancyVolume.GetBaseIndex(),occupancyVolumeSRV);
+		if(LinearSampler.IsBound())
+			RHICmdList.SetShaderSampler(ShaderRHI,LinearSampler.GetBaseIndex(),TStaticSamplerState<SF_Trilinear,AM_Wrap,AM_Wrap,AM_Wrap>::GetRHI());
+	
+		if(ObjNormal.IsBound())
+			RHICmdList.SetShaderResourceViewParameter(ShaderRHI,ObjNormal.GetBaseIndex(),AHREngine.ObjectNormalSRV);
+
+		// Replaces the occupancy skip when the view has clipmaps, see r.AHRGlobalDistanceField
+		if(GlobalDistanceFieldParameters.IsBound())
+			GlobalDistanceFieldParameters.Set(RHICmdList, ShaderRHI, GlobalDistanceFieldInfo);
+	}
+
+	void SetSamplingKernel(FRHICommandList& RHICmdList,const FTexture2DRHIRef& samplingKernelTex,const float& RayIndex,const FVector2D& ScreenRes, const FSceneView& View)
+	{
+		const FPixelShaderRHIParamRef ShaderRHI = GetPixelShader();
+
+		auto spoint = TStaticSamplerState<SF_Point,AM_Wrap,AM_Wrap,AM_Wrap>::GetRHI();
+		SetTextureParameter(RHICmdList, ShaderRHI, SamplingKernel, samPoint,spoint, samplingKernelTex);	
+
+		if(samPoint.IsBound())
+			RHICmdList.SetShaderSampler(ShaderRHI,LinearSampler.GetBaseIndex(),spoint);
+
+		AHRTraceSceneCB cbdata = GetAHRTraceSceneCB(ScreenRes, RayIndex, View);
+		SetUniformBufferParameterImmediate(RHICmdList, ShaderRHI,cb,cbdata);
+	}
+	virtual bool Serialize(FArchive& Ar)
+	{		
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize(Ar);
+		Ar << DeferredParameters;
+		Ar << SceneVolume;
+		Ar << LinearSampler;
+		Ar << cb;
+		Ar << EmissiveVolume;
+		Ar << OccupancyVolume;
+		Ar << SamplingKernel;
+		Ar << samPoint;
+
+		Ar << ObjNormal;
+		Ar << GlobalDistanceFieldParameters;
+		return bShaderHasOutdatedParameters;
+	}
+
+	FGlobalBoundShaderState& GetBoundShaderState()
+	{
+		static FGlobalBoundShaderState State;
+
+		return State;
+	}
+
+private:
+	FDeferredPixelShaderParameters DeferredParameters;
+	FShaderResourceParameter SceneVolume;
+	FShaderResourceParameter LinearSampler;
+	TShaderUniformBufferParameter<AHRTraceSceneCB> cb;
+
+	FShaderResourceParameter EmissiveVolume;
+	FShaderResourceParameter OccupancyVolume;
+
+	FShaderResourceParameter SamplingKernel;
+	FShaderResourceParameter samPoint;
+
+	FShaderResourceParameter ObjNormal;
+	FGlobalDistanceFieldParameters GlobalDistanceFieldParameters;
+};
+IMPLEMENT_SHADER_TYPE(template<>,AHRTraceScenePS<0>,TEXT("AHRTraceSPH"),TEXT("main"),SF_Pixel);
+IMPLEMENT_SHADER_TYPE(template<>,AHRTraceScenePS<1>,TEXT("AHRTraceSPH"),TEXT("traceReflections"),SF_Pixel);
+
+// bTraceReflections selects the permutation that also traces the reflection ray, see r.AHRTraceReflections
+template<uint32 bTraceReflections>
+class AHRTraceSceneCS : public FGlobalShader
+{
+	DECLARE_SHADER_TYPE(AHRTraceSceneCS,Global)
+public:
+
+	static bool ShouldCache(EShaderPlatform Platform)
+	{
+		return IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Platform, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("AHR_TRACE_REFLECTIONS"),bTraceReflections);
+	}
+
+	AHRTraceSceneCS(const ShaderMetaType::CompiledShaderInitializerType& Initializer)
+	:	FGlobalShader(Initializer)
+	{
+		DeferredParameters.Bind(Initializer.ParameterMap);
+		SceneVolume.Bind(Initializer.ParameterMap, TEXT("SceneVolume"));
+		LinearSampler.Bind(Initializer.ParameterMap, TEXT("samLinear"));
+		cb.Bind(Initializer.ParameterMap, TEXT("AHRTraceCB"));
+
+		EmissiveVolume.Bind(Initializer.ParameterMap, TEXT("EmissiveVolume"));
+		OccupancyVolume.Bind(Initializer.ParameterMap, TEXT("OccupancyVolume"));
+		ObjNormal.Bind(Initializer.ParameterMap, TEXT("ObjNormal"));
+		DispatchToUV.Bind(Initializer.ParameterMap, TEXT("DispatchToUV"));
+		TraceRect.Bind(Initializer.ParameterMap, TEXT("TraceRect"));
+		NumDiffuseDirections.Bind(Initializer.ParameterMap, TEXT("NumDiffuseDirections"));
+		GlobalDistanceFieldParameters.Bind(Initializer.ParameterMap);
+
+		for(int32 i = 0;i < 5;i++)
+			SamplingKernel[i].Bind(Initializer.ParameterMap, *FString::Printf(TEXT("SamplingKernel%d"),i));
+		for(int32 i = 0;i < 6;i++)
+			RaytracingTarget[i].Bind(Initializer.ParameterMap, *FString::Printf(TEXT("RaytracingTarget%d"),i));
+	}
+
+	AHRTraceSceneCS()
+	{
+	}
+
+	void SetParameters(	FRHICommandList& RHICmdList, const FSceneView& View, 
+						const FShaderResourceViewRHIRef& sceneVolumeSRV, 
+						const FShaderResourceViewRHIRef& emissiveVolumeSRV,
+						const FShaderResourceViewRHIRef& occupancyVolumeSRV,
+						const FGlobalDistanceFieldInfo& GlobalDistanceFieldInfo,
+						const FVector2D& ScreenRes, const FVector2D& inDispatchToUV, const FIntRect& inTraceRect )
+	{
+		const FComputeShaderRHIParamRef ShaderRHI = GetComputeShader();
 		FGlobalShader::SetParameters(RHICmdList, ShaderRHI,View);
 		DeferredParameters.Set(RHICmdList, ShaderRHI, View);
 
@@ -839,51 +1874,43 @@ public:
 			RHICmdList.SetShaderResourceViewParameter(ShaderRHI,SceneVolume.GetBaseIndex(),sceneVolumeSRV);
 		if(EmissiveVolume.IsBound())
 			RHICmdList.SetShaderResourceViewParameter(ShaderRHI,EmissiveVolume.GetBaseIndex(),emissiveVolumeSRV);
+		if(OccupancyVolume.IsBound())
+			RHICmdList.SetShaderResourceViewParameter(ShaderRHI,OccupancyVolume.GetBaseIndex(),occupancyVolumeSRV);
 		if(LinearSampler.IsBound())
 			RHICmdList.SetShaderSampler(ShaderRHI,LinearSampler.GetBaseIndex(),TStaticSamplerState<SF_Trilinear,AM_Wrap,AM_Wrap,AM_Wrap>::GetRHI());
-	
 		if(ObjNormal.IsBound())
 			RHICmdList.SetShaderResourceViewParameter(ShaderRHI,ObjNormal.GetBaseIndex(),AHREngine.ObjectNormalSRV);
-	}
-
-	void SetSamplingKernel(FRHICommandList& RHICmdList,const FTexture2DRHIRef& samplingKernelTex,const float& RayIndex,const FVector2D& ScreenRes, const FSceneView& View)
-	{
-		const FPixelShaderRHIParamRef ShaderRHI = GetPixelShader();
-
-		auto spoint = TStaticSamplerState<SF_Point,AM_Wrap,AM_Wrap,AM_Wrap>::GetRHI();
-		SetTextureParameter(RHICmdList, ShaderRHI, SamplingKernel, samPoint,spoint, samplingKernelTex);	
 
-		if(samPoint.IsBound())
-			RHICmdList.SetShaderSampler(ShaderRHI,LinearSampler.GetBaseIndex(),spoint);
+		// The kernels are read with Load, no sampler needed
+		for(int32 i = 0;i < 5;i++)
+			SetTextureParameter(RHICmdList, ShaderRHI, SamplingKernel[i], GSceneRenderTargets.AHRPerPixelTracingKernel[i]->GetRenderTargetItem().ShaderResourceTexture);
+		for(int32 i = 0;i < 6;i++)
+		{
+			if(RaytracingTarget[i].IsBound())
+				RHICmdList.SetUAVParameter(ShaderRHI, RaytracingTarget[i].GetBaseIndex(), GSceneRenderTargets.AHRRaytracingTarget[i]->GetRenderTargetItem().UAV);
+		}
 
-		AHRTraceSceneCB cbdata;
+		SetShaderValue(RHICmdList, ShaderRHI, DispatchToUV, inDispatchToUV);
+		SetShaderValue(RHICmdList, ShaderRHI, TraceRect, inTraceRect);
+		SetShaderValue(RHICmdList, ShaderRHI, NumDiffuseDirections, (uint32)GetAHRNumDiffuseDirections());
 
-		AHRGridSettings ahrGrid = AHREngine.GetGridSettings();
+		if(GlobalDistanceFieldParameters.IsBound())
+			GlobalDistanceFieldParameters.Set(RHICmdList, ShaderRHI, GlobalDistanceFieldInfo);
 
-		
-		cbdata.SamplingKernelUVScaling = ScreenRes / FVector2D(4.0f,4.0f);
-		cbdata.SliceSize.X = ahrGrid.SliceSize.X;
-		cbdata.SliceSize.Y = ahrGrid.SliceSize.Y;
-		cbdata.SliceSize.Z = ahrGrid.SliceSize.Z;
-		cbdata.ScreenRes = ScreenRes;
-		cbdata.invVoxel = FVector(1.0f / float(cbdata.SliceSize.X),
-								  1.0f / float(cbdata.SliceSize.Y),
-								  1.0f / float(cbdata.SliceSize.Z));
-		cbdata.VoxelScaleMult = cbdata.invVoxel*ahrGrid.Bounds;
-		cbdata.HalfInvSceneBounds = FVector(0.5f) / ahrGrid.Bounds;
-		cbdata.WorldToVoxelOffset = -ahrGrid.Center*cbdata.HalfInvSceneBounds + 0.5f; // -SceneCenter/SceneBounds
-		cbdata.GlossyRayCount = View.FinalPostProcessSettings.AHRGlossyRayCount;
-		cbdata.GlossySamplesCount = View.FinalPostProcessSettings.AHRGlossySamplesCount;
-		cbdata.DiffuseRayCount = View.FinalPostProcessSettings.AHRDiffuseRayCount;
-		cbdata.DiffuseSamplesCount = View.FinalPostProcessSettings.AHRDiffuseSamplesCount;
-		cbdata.LostRayColor.X = View.FinalPostProcessSettings.AHRLostRayColor.R;
-		cbdata.LostRayColor.Y = View.FinalPostProcessSettings.AHRLostRayColor.G;
-		cbdata.LostRayColor.Z = View.FinalPostProcessSettings.AHRLostRayColor.B;
-		cbdata.InitialDispMult = View.FinalPostProcessSettings.AHRInitialDisplacement;
-		cbdata.SamplesDispMultiplier = View.FinalPostProcessSettings.AHRSamplesDisplacement;
-		cbdata.RayIndex = RayIndex;
+		AHRTraceSceneCB cbdata = GetAHRTraceSceneCB(ScreenRes, 0, View);
 		SetUniformBufferParameterImmediate(RHICmdList, ShaderRHI,cb,cbdata);
 	}
+
+	void UnbindBuffers(FRHICommandList& RHICmdList)
+	{
+		const FComputeShaderRHIParamRef ShaderRHI = GetComputeShader();
+		for(int32 i = 0;i < 6;i++)
+		{
+			if(RaytracingTarget[i].IsBound())
+				RHICmdList.SetUAVParameter(ShaderRHI, RaytracingTarget[i].GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
+		}
+	}
+
 	virtual bool Serialize(FArchive& Ar)
 	{		
 		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize(Ar);
@@ -892,20 +1919,19 @@ public:
 		Ar << LinearSampler;
 		Ar << cb;
 		Ar << EmissiveVolume;
-		Ar << SamplingKernel;
-		Ar << samPoint;
-
+		Ar << OccupancyVolume;
 		Ar << ObjNormal;
+		Ar << DispatchToUV;
+		Ar << TraceRect;
+		Ar << NumDiffuseDirections;
+		Ar << GlobalDistanceFieldParameters;
+		for(int32 i = 0;i < 5;i++)
+			Ar << SamplingKernel[i];
+		for(int32 i = 0;i < 6;i++)
+			Ar << RaytracingTarget[i];
 		return bShaderHasOutdatedParameters;
 	}
 
-	FGlobalBoundShaderState& GetBoundShaderState()
-	{
-		static FGlobalBoundShaderState State;
-
-		return State;
-	}
-
 private:
 	FDeferredPixelShaderParameters DeferredParameters;
 	FShaderResourceParameter SceneVolume;
@@ -913,40 +1939,83 @@ private:
 	TShaderUniformBufferParameter<AHRTraceSceneCB> cb;
 
 	FShaderResourceParameter EmissiveVolume;
-
-	FShaderResourceParameter SamplingKernel;
-	FShaderResourceParameter samPoint;
-
+	FShaderResourceParameter OccupancyVolume;
 	FShaderResourceParameter ObjNormal;
+	FShaderParameter DispatchToUV;
+	FShaderParameter TraceRect;
+	FShaderParameter NumDiffuseDirections;
+	FGlobalDistanceFieldParameters GlobalDistanceFieldParameters;
+
+	FShaderResourceParameter SamplingKernel[5];
+	FShaderResourceParameter RaytracingTarget[6];
 };
-IMPLEMENT_SHADER_TYPE(template<>,AHRTraceScenePS<0>,TEXT("AHRTraceSPH"),TEXT("main"),SF_Pixel);
-IMPLEMENT_SHADER_TYPE(template<>,AHRTraceScenePS<1>,TEXT("AHRTraceSPH"),TEXT("traceReflections"),SF_Pixel);
+IMPLEMENT_SHADER_TYPE(template<>,AHRTraceSceneCS<0>,TEXT("AHRTraceSPH"),TEXT("traceAllCS"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(template<>,AHRTraceSceneCS<1>,TEXT("AHRTraceSPH"),TEXT("traceAllCS"),SF_Compute);
+
+template<uint32 bTraceReflections>
+static void DispatchTraceSceneCS(FRHICommandListImmediate& RHICmdList, const FViewInfo& View,
+								 const FShaderResourceViewRHIRef& sceneVolumeSRV,
+								 const FShaderResourceViewRHIRef& emissiveVolumeSRV,
+								 const FShaderResourceViewRHIRef& occupancyVolumeSRV,
+								 const FVector2D& ScreenRes, const FVector2D& DispatchToUV, const FIntRect& TraceRect)
+{
+	TShaderMapRef<AHRTraceSceneCS<bTraceReflections>> TraceCS(View.ShaderMap);
+	RHICmdList.SetComputeShader(TraceCS->GetComputeShader());
+
+	TraceCS->SetParameters(RHICmdList, View, sceneVolumeSRV, emissiveVolumeSRV, occupancyVolumeSRV, View.GlobalDistanceFieldInfo, ScreenRes, DispatchToUV, TraceRect);
+	DispatchComputeShader(RHICmdList, *TraceCS, fceil((uint32)TraceRect.Width(),8u), fceil((uint32)TraceRect.Height(),8u), 1);
+	TraceCS->UnbindBuffers(RHICmdList);
+}
 
 void FApproximateHybridRaytracer::TraceScene(FRHICommandListImmediate& RHICmdList,FViewInfo& View)
 {
 	SCOPED_DRAW_EVENT(RHICmdList,AHRTraceScene);
+	SCOPE_CYCLE_COUNTER(STAT_AHRTraceScene);
+	FAHRScopedGPUStage GPUStage(RHICmdList,AHRStage_TraceScene);
 	RHICmdList.SetBlendState(TStaticBlendState<CW_RGBA>::GetRHI());
 
-	// Draw a full screen quad into the half res target
-	const auto& ___tmpTarget = GSceneRenderTargets.AHRRaytracingTarget[0]->GetRenderTargetItem().TargetableTexture->GetTexture2D();
-	//FVector2D texSize(View.Family->FamilySizeX,View.Family->FamilySizeY);//(___tmpTarget->GetSizeX(),___tmpTarget->GetSizeY());
-	//FIntRect SrcRect = View.ViewRect;
-	//FIntRect DestRect(FIntPoint(0,0),FIntPoint(texSize.X/2,texSize.Y/2));
-	
-	FIntRect SrcRect = FIntRect(View.ViewRect.Min,FIntPoint(View.Family->FamilySizeX,View.Family->FamilySizeY))/2;//View.ViewRect/2;
-	// Viewport size not even also causes issue
-	FIntRect DestRect = FIntRect::DivideAndRoundUp(SrcRect, 2);
+	// Each view traces its own rect of the half res targets, so split screen and stereo views share the targets (and the voxelization)
+	// without overwriting each other. The first view of the family clears them for everyone
+	const FIntRect TraceRect = FIntRect::DivideAndRoundUp(View.ViewRect,2);
+	const bool bFirstView = View.Family->Views[0] == &View;
+	// Scale used to look up the tracing kernels, the same for every view
+	const FIntPoint KernelScreenRes = FIntPoint::DivideAndRoundUp(FIntPoint(View.Family->FamilySizeX,View.Family->FamilySizeY)/2,2);
+	// Picks the permutation instead of recompiling, the reflection target is left black when off
+	const bool bTraceReflections = CVarAHRTraceReflections.GetValueOnRenderThread() != 0;
+
+	// Compute path, all the rays on a single dispatch
+	if(CVarAHRTraceCompute.GetValueOnRenderThread() != 0)
+	{
+		SCOPED_DRAW_EVENT(RHICmdList,AHRTraceScene_compute);
+
+		// A texel of the targets covers 2x2 pixels of the scene buffers
+		const FIntPoint BufferSize = GSceneRenderTargets.GetBufferSizeXY();
+		const FVector2D DispatchToUV(2.0f / float(BufferSize.X),2.0f / float(BufferSize.Y));
+
+		// Match the pass path, so the skipped directions stay black
+		if(bFirstView)
+		{
+			uint32 cls[4] = { 0,0,0,0 };
+			for(int32 i = 0;i < 6;i++)
+				RHICmdList.ClearUAV(GSceneRenderTargets.AHRRaytracingTarget[i]->GetRenderTargetItem().UAV, cls);
+		}
 
-	RHICmdList.SetViewport(0, 0, 0.0f, DestRect.Max.X, DestRect.Max.Y, 1.0f );
+		// The dynamic grid should have both the static and dynamic data by now
+		if(bTraceReflections)
+			DispatchTraceSceneCS<1>(RHICmdList, View, DynamicSceneVolume->SRV, DynamicEmissiveVolume->SRV, OccupancyVolume->SRV,
+									FVector2D(KernelScreenRes.X,KernelScreenRes.Y), DispatchToUV, TraceRect);
+		else
+			DispatchTraceSceneCS<0>(RHICmdList, View, DynamicSceneVolume->SRV, DynamicEmissiveVolume->SRV, OccupancyVolume->SRV,
+									FVector2D(KernelScreenRes.X,KernelScreenRes.Y), DispatchToUV, TraceRect);
+		return;
+	}
 
-	//RHICmdList.SetViewport(SrcRect.Min.X, SrcRect.Min.Y, 0.0f,texSize.X, texSize.Y, 1.0f);
 	RHICmdList.SetRasterizerState(TStaticRasterizerState<FM_Solid, CM_None>::GetRHI());
 	RHICmdList.SetDepthStencilState(TStaticDepthStencilState<false, CF_Always>::GetRHI());
 
 	// Get the shaders
 	TShaderMapRef<AHRPassVS<1>> VertexShader(View.ShaderMap);
 	TShaderMapRef<AHRTraceScenePS<0>> PixelShader(View.ShaderMap);
-	TShaderMapRef<AHRTraceScenePS<1>> PixelShaderRefl(View.ShaderMap);
 
 	SetGlobalBoundShaderState(RHICmdList, View.FeatureLevel, PixelShader->GetBoundShaderState(),  GFilterVertexDeclaration.VertexDeclarationRHI, *VertexShader, *PixelShader);
 	VertexShader->SetParameters(RHICmdList,View);
@@ -954,64 +2023,90 @@ void FApproximateHybridRaytracer::TraceScene(FRHICommandListImmediate& RHICmdLis
 	// The dynamic grid should have both the static and dynamic data by now
 	PixelShader->SetParameters(RHICmdList, View, 
 									DynamicSceneVolume->SRV,
-									DynamicEmissiveVolume->SRV );
+									DynamicEmissiveVolume->SRV,
+									OccupancyVolume->SRV,
+									View.GlobalDistanceFieldInfo );
 
-	// Trace one ray per direction, hardcoding at 5 + reflection
+	// Trace one ray per direction, up to 5 + reflection
+	const int32 NumDiffuseDirections = GetAHRNumDiffuseDirections();
 	for(int i = 0;i < 5;i++)
 	{
 		SCOPED_DRAW_EVENT(RHICmdList,AHRTraceScene_diffuse);
 
+		if(i >= NumDiffuseDirections)
+		{
+			// Not traced on this quality level, just clear it
+			SetRenderTarget(RHICmdList, GSceneRenderTargets.AHRRaytracingTarget[i]->GetRenderTargetItem().TargetableTexture, FTextureRHIRef());
+			RHICmdList.SetViewport(TraceRect.Min.X, TraceRect.Min.Y, 0.0f, TraceRect.Max.X, TraceRect.Max.Y, 1.0f);
+			RHICmdList.Clear(true, FLinearColor::Black, false, 1.0f, false, 0, FIntRect());
+			continue;
+		}
+
 		// Set the render target
 		const auto& target = GSceneRenderTargets.AHRRaytracingTarget[i]->GetRenderTargetItem().TargetableTexture->GetTexture2D();
 		SetRenderTarget(RHICmdList, target, FTextureRHIRef());
+		// Setting the target resets the viewport. It also limits the clear to the rect of this view
+		RHICmdList.SetViewport(TraceRect.Min.X, TraceRect.Min.Y, 0.0f, TraceRect.Max.X, TraceRect.Max.Y, 1.0f);
 		
 		// Clear the target before drawing
 		RHICmdList.Clear(true, FLinearColor::Black, false, 1.0f, false, 0, FIntRect());
 
 		// Bound shader parameters
-		PixelShader->SetSamplingKernel(RHICmdList,GSceneRenderTargets.AHRPerPixelTracingKernel[i]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D(),i,FVector2D(DestRect.Max.X,DestRect.Max.Y),View);
+		PixelShader->SetSamplingKernel(RHICmdList,GSceneRenderTargets.AHRPerPixelTracingKernel[i]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D(),i,FVector2D(KernelScreenRes.X,KernelScreenRes.Y),View);
 
-		// Draw a quad mapping scene color to the view's render target
+		// Draw a quad mapping scene color to the view's render target. The VS doubles the UVs
 		DrawRectangle(
 			RHICmdList,
 			0.0f, 0.0f,
-			DestRect.Width(), DestRect.Height(),
-			DestRect.Min.X, DestRect.Min.Y, 
-			SrcRect.Width(), SrcRect.Height(),
-			DestRect.Size(),
+			TraceRect.Width(), TraceRect.Height(),
+			View.ViewRect.Min.X/2, View.ViewRect.Min.Y/2, 
+			View.ViewRect.Width()/2, View.ViewRect.Height()/2,
+			TraceRect.Size(),
 			GSceneRenderTargets.GetBufferSizeXY(),
 			*VertexShader,
 			EDRF_UseTriangleOptimization);
 	}
 
+	if(!bTraceReflections)
+	{
+		// Left black, the composite adds nothing
+		SetRenderTarget(RHICmdList, GSceneRenderTargets.AHRRaytracingTarget[5]->GetRenderTargetItem().TargetableTexture, FTextureRHIRef());
+		RHICmdList.SetViewport(TraceRect.Min.X, TraceRect.Min.Y, 0.0f, TraceRect.Max.X, TraceRect.Max.Y, 1.0f);
+		RHICmdList.Clear(true, FLinearColor::Black, false, 1.0f, false, 0, FIntRect());
+	}
+	else
 	{
 		SCOPED_DRAW_EVENT(RHICmdList,AHRTraceScene_reflection);
+		TShaderMapRef<AHRTraceScenePS<1>> PixelShaderRefl(View.ShaderMap);
 
 		// Trace reflections
 		SetGlobalBoundShaderState(RHICmdList, View.FeatureLevel, PixelShaderRefl->GetBoundShaderState(),  GFilterVertexDeclaration.VertexDeclarationRHI, *VertexShader, *PixelShaderRefl);
 		// The dynamic grid should have both the static and dynamic data by now
 		PixelShaderRefl->SetParameters(RHICmdList, View, 
 										DynamicSceneVolume->SRV,
-										DynamicEmissiveVolume->SRV );
+										DynamicEmissiveVolume->SRV,
+										OccupancyVolume->SRV,
+										View.GlobalDistanceFieldInfo );
 
 		// Set the render target
 		const auto& target = GSceneRenderTargets.AHRRaytracingTarget[5]->GetRenderTargetItem().TargetableTexture->GetTexture2D();
 		SetRenderTarget(RHICmdList, target, FTextureRHIRef());
+		RHICmdList.SetViewport(TraceRect.Min.X, TraceRect.Min.Y, 0.0f, TraceRect.Max.X, TraceRect.Max.Y, 1.0f);
 		
 		// Clear the target before drawing
 		RHICmdList.Clear(true, FLinearColor::Black, false, 1.0f, false, 0, FIntRect());
 
 		// Bound shader parameters
-		PixelShaderRefl->SetSamplingKernel(RHICmdList,FTexture2DRHIRef(),-1,FVector2D(DestRect.Max.X,DestRect.Max.Y),View);
+		PixelShaderRefl->SetSamplingKernel(RHICmdList,FTexture2DRHIRef(),-1,FVector2D(KernelScreenRes.X,KernelScreenRes.Y),View);
 
 		// Draw a quad mapping scene color to the view's render target
 		DrawRectangle(
 				RHICmdList,
 				0.0f, 0.0f,
-				DestRect.Width(), DestRect.Height(),
-				DestRect.Min.X, DestRect.Min.Y, 
-				SrcRect.Width(), SrcRect.Height(),
-				DestRect.Size(),
+				TraceRect.Width(), TraceRect.Height(),
+				View.ViewRect.Min.X/2, View.ViewRect.Min.Y/2, 
+				View.ViewRect.Width()/2, View.ViewRect.Height()/2,
+				TraceRect.Size(),
 				GSceneRenderTargets.GetBufferSizeXY(),
 				*VertexShader,
 				EDRF_UseTriangleOptimization);
@@ -1022,76 +2117,92 @@ void FApproximateHybridRaytracer::TraceScene(FRHICommandListImmediate& RHICmdLis
 ///
 /// Upsampling and composite
 ///
-class AHRBlur : public FGlobalShader
+// Depth and normal aware blur of one trace. Both passes of the separable kernel run on a single dispatch through groupshared memory
+class AHRBilateralBlurCS : public FGlobalShader
 {
-	DECLARE_SHADER_TYPE(AHRBlur,Global)
+	DECLARE_SHADER_TYPE(AHRBilateralBlurCS,Global);
+
 public:
+
 	static bool ShouldCache(EShaderPlatform Platform)
 	{
 		return IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5);
 	}
 
-	static void ModifyCompilationEnvironment(EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment)
+	static void ModifyCompilationEnvironment( EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment )
 	{
-		FGlobalShader::ModifyCompilationEnvironment(Platform, OutEnvironment);
+		FGlobalShader::ModifyCompilationEnvironment( Platform, OutEnvironment );
 	}
 
-	AHRBlur(const ShaderMetaType::CompiledShaderInitializerType& Initializer)
-	:	FGlobalShader(Initializer)
+	/** Default constructor. */
+	AHRBilateralBlurCS()
 	{
-		DeferredParameters.Bind(Initializer.ParameterMap);
-		samLinear.Bind(Initializer.ParameterMap, TEXT("samLinear"));
-		ObjNormal.Bind(Initializer.ParameterMap,TEXT("ObjNormal"));
-		Trace.Bind(Initializer.ParameterMap,TEXT("Trace"));
-		prevTrace.Bind(Initializer.ParameterMap,TEXT("prevTrace"));
-		BlurData.Bind(Initializer.ParameterMap,TEXT("BlurData"));
 	}
 
-	AHRBlur()
+	/** Initialization constructor. */
+	explicit AHRBilateralBlurCS( const ShaderMetaType::CompiledShaderInitializerType& Initializer )
+		: FGlobalShader(Initializer)
 	{
+		DeferredParameters.Bind(Initializer.ParameterMap);
+		samLinear.Bind(Initializer.ParameterMap, TEXT("samLinear"));
+		ObjNormal.Bind(Initializer.ParameterMap, TEXT("ObjNormal"));
+		Trace.Bind(Initializer.ParameterMap, TEXT("Trace"));
+		Output.Bind(Initializer.ParameterMap, TEXT("Output"));
+		BlurData.Bind(Initializer.ParameterMap, TEXT("BlurData"));
 	}
 
-	virtual bool Serialize(FArchive& Ar)
+	/** Serialization. */
+	virtual bool Serialize( FArchive& Ar ) override
 	{
-		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize(Ar);
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize( Ar );
 		Ar << DeferredParameters;
 		Ar << samLinear;
 		Ar << ObjNormal;
 		Ar << Trace;
-		Ar << prevTrace;
+		Ar << Output;
 		Ar << BlurData;
 		return bShaderHasOutdatedParameters;
 	}
-	void SetParameters(FRHICommandList& RHICmdList, const FSceneView& View, FRHITexture2D* TraceTex, FRHITexture2D* prevTraceTex, float blurXMask,float blurYMask)
+
+	/**
+	 * Set parameters for this shader.
+	 */
+	void SetParameters(FRHICommandList& RHICmdList, const FSceneView& View, FTextureRHIParamRef TraceTex, FUnorderedAccessViewRHIParamRef OutputUAV, const FIntPoint& TraceSize, const FIntPoint& BlurExtent)
 	{
-		const FPixelShaderRHIParamRef ShaderRHI = GetPixelShader();
-		FGlobalShader::SetParameters(RHICmdList, ShaderRHI,View);
-		DeferredParameters.Set(RHICmdList, ShaderRHI, View);
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+		FGlobalShader::SetParameters(RHICmdList, ComputeShaderRHI, View);
+		DeferredParameters.Set(RHICmdList, ComputeShaderRHI, View);
 
-		auto sampler = TStaticSamplerState<SF_Trilinear,AM_Wrap,AM_Wrap,AM_Wrap>::GetRHI();
+		auto sampler = TStaticSamplerState<SF_Bilinear,AM_Clamp,AM_Clamp,AM_Clamp>::GetRHI();
 		if(ObjNormal.IsBound())
-			RHICmdList.SetShaderResourceViewParameter(ShaderRHI,ObjNormal.GetBaseIndex(),AHREngine.ObjectNormalSRV);
+			RHICmdList.SetShaderResourceViewParameter(ComputeShaderRHI,ObjNormal.GetBaseIndex(),AHREngine.ObjectNormalSRV);
 		if(samLinear.IsBound())
-			RHICmdList.SetShaderSampler(ShaderRHI,samLinear.GetBaseIndex(),sampler);
+			RHICmdList.SetShaderSampler(ComputeShaderRHI,samLinear.GetBaseIndex(),sampler);
 
-		SetTextureParameter(RHICmdList, ShaderRHI, Trace, samLinear,sampler, TraceTex);
-		SetTextureParameter(RHICmdList, ShaderRHI, prevTrace, samLinear,sampler, prevTraceTex);	
+		SetTextureParameter(RHICmdList, ComputeShaderRHI, Trace, TraceTex);
 
-		SetShaderValue(RHICmdList, ShaderRHI, BlurData, FVector4(1.0f / float(TraceTex->GetSizeX()),1.0f / float(TraceTex->GetSizeY()),
-																 blurXMask,blurYMask));
+		if ( Output.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, Output.GetBaseIndex(), OutputUAV);
+
+		SetShaderValue(RHICmdList, ComputeShaderRHI, BlurData, FVector4(1.0f / float(TraceSize.X),1.0f / float(TraceSize.Y),BlurExtent.X,BlurExtent.Y));
 	}
 
-	FGlobalBoundShaderState& GetBoundShaderState()
+	/**
+	 * Unbinds any buffers that have been bound.
+	 */
+	void UnbindBuffers(FRHICommandList& RHICmdList)
 	{
-		static FGlobalBoundShaderState State;
-		return State;
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+		if ( Output.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, Output.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
 	}
+
 private:
 	FDeferredPixelShaderParameters DeferredParameters;
 	FShaderResourceParameter samLinear;
 	FShaderResourceParameter ObjNormal;
 	FShaderResourceParameter Trace;
-	FShaderResourceParameter prevTrace;
+	FShaderResourceParameter Output;
 	FShaderParameter BlurData;
 };
 /*
@@ -1248,80 +2359,200 @@ private:
 //IMPLEMENT_SHADER_TYPE(,AHRBlurV,TEXT("AHRUpsample"),TEXT("BlurV"),SF_Pixel);
 
 // Sadly can't use templates here, as for some reason switching shader causes a MASIVE slowdown
-IMPLEMENT_SHADER_TYPE(,AHRBlur,TEXT("AHRBlur"),TEXT("main"),SF_Pixel);
+IMPLEMENT_SHADER_TYPE(,AHRBilateralBlurCS,TEXT("AHRBilateralBlur"),TEXT("main"),SF_Compute);
 
 
-void FApproximateHybridRaytracer::Upsample(FRHICommandListImmediate& RHICmdList,FViewInfo& View)
+class AHRTemporalAccumulationCS : public FGlobalShader
 {
+	DECLARE_SHADER_TYPE(AHRTemporalAccumulationCS,Global);
 
-	SCOPED_DRAW_EVENT(RHICmdList,AHRUpsample);
+public:
 
-	RHICmdList.SetBlendState(TStaticBlendState<CW_RGBA>::GetRHI());
-	RHICmdList.SetRasterizerState(TStaticRasterizerState<FM_Solid, CM_None>::GetRHI());
-	RHICmdList.SetDepthStencilState(TStaticDepthStencilState<false, CF_Always>::GetRHI());
+	static bool ShouldCache(EShaderPlatform Platform)
+	{
+		return IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5);
+	}
 
-	const auto& ___tmpTarget = GSceneRenderTargets.AHRRaytracingTarget[0]->GetRenderTargetItem().TargetableTexture->GetTexture2D();
-	FVector2D texSize(___tmpTarget->GetSizeX(),___tmpTarget->GetSizeY());
-	FIntRect SrcRect = View.ViewRect;
-	FIntRect DestRect(FIntPoint(0,0),FIntPoint(texSize.X,texSize.Y));
+	static void ModifyCompilationEnvironment( EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment )
+	{
+		FGlobalShader::ModifyCompilationEnvironment( Platform, OutEnvironment );
+	}
 
-	RHICmdList.SetViewport(SrcRect.Min.X, SrcRect.Min.Y, 0.0f,texSize.X, texSize.Y, 1.0f);
+	/** Default constructor. */
+	AHRTemporalAccumulationCS()
+	{
+	}
 
-	// Get the shaders
-	TShaderMapRef<AHRPassVS<0>> VertexShader(View.ShaderMap);
-	TShaderMapRef<AHRBlur> PSBlur(View.ShaderMap);
+	/** Initialization constructor. */
+	explicit AHRTemporalAccumulationCS( const ShaderMetaType::CompiledShaderInitializerType& Initializer )
+		: FGlobalShader(Initializer)
+	{
+		samLinear.Bind(Initializer.ParameterMap, TEXT("samLinear"));
+		Trace.Bind(Initializer.ParameterMap, TEXT("Trace"));
+		History.Bind(Initializer.ParameterMap, TEXT("History"));
+		Reprojection.Bind(Initializer.ParameterMap, TEXT("Reprojection"));
+		Output.Bind(Initializer.ParameterMap, TEXT("Output"));
+		TemporalData.Bind(Initializer.ParameterMap, TEXT("TemporalData"));
+		TraceRect.Bind(Initializer.ParameterMap, TEXT("TraceRect"));
+		ReprojectionOrigin.Bind(Initializer.ParameterMap, TEXT("ReprojectionOrigin"));
+	}
 
-	SetGlobalBoundShaderState(RHICmdList, View.FeatureLevel, PSBlur->GetBoundShaderState(),  GFilterVertexDeclaration.VertexDeclarationRHI, *VertexShader, *PSBlur);
-	VertexShader->SetParameters(RHICmdList,View);
+	/** Serialization. */
+	virtual bool Serialize( FArchive& Ar ) override
+	{
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize( Ar );
+		Ar << samLinear;
+		Ar << Trace;
+		Ar << History;
+		Ar << Reprojection;
+		Ar << Output;
+		Ar << TemporalData;
+		Ar << TraceRect;
+		Ar << ReprojectionOrigin;
+		return bShaderHasOutdatedParameters;
+	}
+
+	/**
+	 * Set parameters for this shader.
+	 */
+	void SetParameters(FRHICommandList& RHICmdList, const FSceneView& View, FTextureRHIParamRef TraceTex, FTextureRHIParamRef HistoryTex, FTextureRHIParamRef ReprojectionTex,
+					   FUnorderedAccessViewRHIParamRef OutputUAV, const FVector4& inTemporalData, const FIntRect& inTraceRect)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+		FGlobalShader::SetParameters(RHICmdList, ComputeShaderRHI, View);
+
+		auto sampler = TStaticSamplerState<SF_Bilinear,AM_Clamp,AM_Clamp,AM_Clamp>::GetRHI();
+		if(samLinear.IsBound())
+			RHICmdList.SetShaderSampler(ComputeShaderRHI,samLinear.GetBaseIndex(),sampler);
+
+		SetTextureParameter(RHICmdList, ComputeShaderRHI, Trace, TraceTex);
+		SetTextureParameter(RHICmdList, ComputeShaderRHI, History, HistoryTex);
+		SetTextureParameter(RHICmdList, ComputeShaderRHI, Reprojection, ReprojectionTex);
+
+		if ( Output.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, Output.GetBaseIndex(), OutputUAV);
+
+		SetShaderValue(RHICmdList, ComputeShaderRHI, TemporalData, inTemporalData);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, TraceRect, inTraceRect);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, ReprojectionOrigin, View.ViewRect.Min);
+	}
+
+	/**
+	 * Unbinds any buffers that have been bound.
+	 */
+	void UnbindBuffers(FRHICommandList& RHICmdList)
+	{
+		FComputeShaderRHIParamRef ComputeShaderRHI = GetComputeShader();
+		if ( Output.IsBound() )
+			RHICmdList.SetUAVParameter(ComputeShaderRHI, Output.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
+	}
+
+private:
+	FShaderResourceParameter samLinear;
+	FShaderResourceParameter Trace;
+	FShaderResourceParameter History;
+	FShaderResourceParameter Reprojection;
+	FShaderResourceParameter Output;
+	FShaderParameter TemporalData;
+	FShaderParameter TraceRect;
+	FShaderParameter ReprojectionOrigin;
+};
+IMPLEMENT_SHADER_TYPE(,AHRTemporalAccumulationCS,TEXT("AHRTemporal"),TEXT("accumulate"),SF_Compute);
+
+FVector2D FApproximateHybridRaytracer::GetKernelRotation() const
+{
+	if(CVarAHRTemporalAccumulation.GetValueOnRenderThread() == 0)
+		return FVector2D(1.0f,0.0f);
+
+	// Golden angle, so consecutive frames cover the disk evenly
+	const float Angle = float(TemporalFrameIndex % 1024u)*2.39996323f;
+	return FVector2D(FMath::Cos(Angle),FMath::Sin(Angle));
+}
+
+void FApproximateHybridRaytracer::TemporalAccumulation(FRHICommandListImmediate& RHICmdList,const TArray<FViewInfo>& Views)
+{
+	SCOPED_DRAW_EVENT(RHICmdList,AHRTemporalAccumulation);
 
-	// The reflection buffer is not blurred
+	const FIntPoint Size = GSceneRenderTargets.AHRHistoryScratch->GetDesc().Extent;
+	const FVector4 TemporalData(1.0f / float(Size.X),1.0f / float(Size.Y),
+								FMath::Clamp(CVarAHRTemporalWeight.GetValueOnRenderThread(),0.0f,0.99f),
+								bTemporalHistoryValid ? 1.0f : 0.0f);
+
+	// The reprojection is shared with the other temporal passes of the view. Views without a state have no history to reproject to
+	TArray<FTextureRHIParamRef, TInlineAllocator<2> > ViewReprojections;
+	for(const FViewInfo& View : Views)
+	{
+		FSceneViewState* ViewState = (FSceneViewState*)View.State;
+		ViewReprojections.Add(ViewState ? ViewState->TemporalReprojection.Update(RHICmdList,View)->GetRenderTargetItem().ShaderResourceTexture.GetReference() : GBlackTexture->TextureRHI.GetReference());
+	}
+
+	// The reflection buffer is view dependent, so only accumulate the diffuse traces
+	// Every view reprojects its own rect with its own matrices. All of them have to be written before the swap
+	TShaderMapRef<AHRTemporalAccumulationCS> AccumulateCS(Views[0].ShaderMap);
 	for(int i = 0;i < 5;i++)
 	{
-		// Horizontal pass
-		FRHITexture2D * target = GSceneRenderTargets.AHRUpsampledTarget0->GetRenderTargetItem().TargetableTexture->GetTexture2D();
-		SetRenderTarget(RHICmdList, target, FTextureRHIRef());
-		PSBlur->SetParameters(RHICmdList, View,GSceneRenderTargets.AHRRaytracingTarget[i]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D(),
-											   GSceneRenderTargets.AHRUpsampledTarget1->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D(),1,0);
+		for(int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
+		{
+			const FViewInfo& View = Views[ViewIndex];
+			const FIntRect TraceRect = FIntRect::DivideAndRoundUp(View.ViewRect,2);
+
+			RHICmdList.SetComputeShader(AccumulateCS->GetComputeShader());
+			AccumulateCS->SetParameters(RHICmdList, View,
+										GSceneRenderTargets.AHRRaytracingTarget[i]->GetRenderTargetItem().ShaderResourceTexture,
+										GSceneRenderTargets.AHRHistory[i]->GetRenderTargetItem().ShaderResourceTexture,
+										ViewReprojections[ViewIndex],
+										GSceneRenderTargets.AHRHistoryScratch->GetRenderTargetItem().UAV,
+										TemporalData, TraceRect);
+			DispatchComputeShader(RHICmdList, *AccumulateCS, fceil((uint32)TraceRect.Width(),16u), fceil((uint32)TraceRect.Height(),16u), 1);
+			AccumulateCS->UnbindBuffers(RHICmdList);
+		}
 
-		// Draw!
-		DrawRectangle( 
-			RHICmdList,
-			0, 0,
-			DestRect.Width(), DestRect.Height(),
-			SrcRect.Min.X, SrcRect.Min.Y, 
-			SrcRect.Width(), SrcRect.Height(),
-			DestRect.Size(),
-			GSceneRenderTargets.GetBufferSizeXY(),
-			*VertexShader,
-			EDRF_UseTriangleOptimization);
+		// The result becomes the new history. The old one is free, so reuse it as the scratch target of the next ray
+		Swap(GSceneRenderTargets.AHRHistory[i],GSceneRenderTargets.AHRHistoryScratch);
+	}
 
-		// Vertical pass
-		target = GSceneRenderTargets.AHRRaytracingTarget[i]->GetRenderTargetItem().TargetableTexture->GetTexture2D();
-		SetRenderTarget(RHICmdList, target, FTextureRHIRef());
-		PSBlur->SetParameters(RHICmdList, View,GSceneRenderTargets.AHRUpsampledTarget0->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D(),
-											   GSceneRenderTargets.AHRUpsampledTarget1->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D(),0,1);
+	bTemporalHistoryValid = true;
+}
 
-		// Draw!
-		DrawRectangle( 
-			RHICmdList,
-			0, 0,
-			DestRect.Width(), DestRect.Height(),
-			SrcRect.Min.X, SrcRect.Min.Y, 
-			SrcRect.Width(), SrcRect.Height(),
-			DestRect.Size(),
-			GSceneRenderTargets.GetBufferSizeXY(),
-			*VertexShader,
-			EDRF_UseTriangleOptimization);
+void FApproximateHybridRaytracer::Upsample(FRHICommandListImmediate& RHICmdList,const TArray<FViewInfo>& Views)
+{
+	const FViewInfo& View = Views[0];
 
-		// Copy to the prev target
-		
-		// DEBUG!!!
-		// Disabled for now
+	SCOPED_DRAW_EVENT(RHICmdList,AHRUpsample);
+	SCOPE_CYCLE_COUNTER(STAT_AHRUpsample);
+	FAHRScopedGPUStage GPUStage(RHICmdList,AHRStage_Upsample);
+
+	// When folded into the composite, the traces are filtered while upsampling there
+	if(CVarAHRUpsampleInComposite.GetValueOnRenderThread() == 0)
+	{
+		const FIntPoint Size = GSceneRenderTargets.AHRRaytracingTarget[0]->GetDesc().Extent;
+		TShaderMapRef<AHRBilateralBlurCS> BlurCS(View.ShaderMap);
+
+		// Only the part of the targets the views traced, they are allocated for the largest screen percentage of the dynamic resolution
+		FIntPoint BlurExtent(0,0);
+		for(const FViewInfo& ViewInfo : Views)
+			BlurExtent = BlurExtent.ComponentMax(FIntRect::DivideAndRoundUp(ViewInfo.ViewRect,2).Max);
+		BlurExtent = BlurExtent.ComponentMin(Size);
 
-		/*RHICmdList.CopyToResolveTarget(GSceneRenderTargets.AHRRaytracingTarget[i]->GetRenderTargetItem().ShaderResourceTexture,
-			                           GSceneRenderTargets.AHRUpsampledTarget1->GetRenderTargetItem().TargetableTexture,
-									   true, FResolveParams());*/
+		// The reflection buffer is not blurred. All the views are blurred at once, the depth and normal weights keep them apart
+		for(int i = 0;i < 5;i++)
+		{
+			RHICmdList.SetComputeShader(BlurCS->GetComputeShader());
+			BlurCS->SetParameters(RHICmdList, View, GSceneRenderTargets.AHRRaytracingTarget[i]->GetRenderTargetItem().ShaderResourceTexture,
+								  GSceneRenderTargets.AHRUpsampledTarget->GetRenderTargetItem().UAV, Size, BlurExtent);
+			DispatchComputeShader(RHICmdList, *BlurCS, fceil((uint32)BlurExtent.X,16u), fceil((uint32)BlurExtent.Y,16u), 1);
+			BlurCS->UnbindBuffers(RHICmdList);
+
+			// The blurred trace takes the place of the raw one, and the raw one is the scratch target of the next ray
+			Swap(GSceneRenderTargets.AHRRaytracingTarget[i],GSceneRenderTargets.AHRUpsampledTarget);
+		}
 	}
+
+	// Accumulate the traces over frames. They are only blurred here when the filtering is not folded into the composite
+	if(CVarAHRTemporalAccumulation.GetValueOnRenderThread() != 0)
+		TemporalAccumulation(RHICmdList,Views);
+	else
+		bTemporalHistoryValid = false;
 		
 	return;
 #if 0
@@ -1442,11 +2673,73 @@ void FApproximateHybridRaytracer::Upsample(FRHICommandListImmediate& RHICmdList,
 #endif
 }
 
-BEGIN_UNIFORM_BUFFER_STRUCT(AHRCompositeCB,)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(float,GIMultiplier)
-END_UNIFORM_BUFFER_STRUCT(AHRCompositeCB)
 IMPLEMENT_UNIFORM_BUFFER_STRUCT(AHRCompositeCB,TEXT("AHRCompositeCB"));
 
+void FAHRCompositeParameters::Bind(const FShaderParameterMap& ParameterMap)
+{
+	LinearSampler.Bind(ParameterMap, TEXT("samLinear"));
+	cb.Bind(ParameterMap,TEXT("AHRCompositeCB"));
+	ObjNormal.Bind(ParameterMap,TEXT("ObjNormal"));
+
+	for(int32 i = 0; i < ARRAY_COUNT(Trace); i++)
+		Trace[i].Bind(ParameterMap, *FString::Printf(TEXT("Trace%d"), i));
+	for(int32 i = 0; i < ARRAY_COUNT(Kernel); i++)
+		Kernel[i].Bind(ParameterMap, *FString::Printf(TEXT("Kernel%d"), i));
+}
+
+template<typename ShaderRHIParamRef>
+void FAHRCompositeParameters::Set(FRHICommandList& RHICmdList, const ShaderRHIParamRef ShaderRHI, const FSceneView& View, EAHRCompositeMode Mode) const
+{
+	auto sampler = TStaticSamplerState<SF_Trilinear,AM_Wrap,AM_Wrap,AM_Wrap>::GetRHI();
+		
+	if(ObjNormal.IsBound())
+		RHICmdList.SetShaderResourceViewParameter(ShaderRHI,ObjNormal.GetBaseIndex(),AHREngine.ObjectNormalSRV);
+	AHRCompositeCB cbdata;
+
+	// Compensate the directions that aren't traced on the lower quality levels
+	cbdata.GIMultiplier = View.FinalPostProcessSettings.AHRIntensity*5.0f / float(GetAHRNumDiffuseDirections());
+
+	// All the traces have the same size, the reflection one is the only one kept by every mode
+	const FIntPoint TraceSize = GSceneRenderTargets.AHRRaytracingTarget[5]->GetDesc().Extent;
+	cbdata.UpsampleData = FVector4(CVarAHRUpsampleInComposite.GetValueOnRenderThread() != 0 ? 1.0f : 0.0f,float(Mode),
+								   1.0f / float(TraceSize.X),1.0f / float(TraceSize.Y));
+
+	SetUniformBufferParameterImmediate(RHICmdList, ShaderRHI,cb,cbdata);
+
+	// With the temporal accumulation on, the diffuse traces are read from the history
+	const TRefCountPtr<IPooledRenderTarget>* DiffuseTargets = CVarAHRTemporalAccumulation.GetValueOnRenderThread() != 0 ? GSceneRenderTargets.AHRHistory : GSceneRenderTargets.AHRRaytracingTarget;
+	for(int32 i = 0; i < ARRAY_COUNT(Trace); i++)
+	{
+		// The reflection trace is never accumulated
+		const TRefCountPtr<IPooledRenderTarget>& Target = i < 5 ? DiffuseTargets[i] : GSceneRenderTargets.AHRRaytracingTarget[5];
+		FTextureRHIParamRef TraceTexture = Target.IsValid() ? Target->GetRenderTargetItem().ShaderResourceTexture.GetReference() : GBlackTexture->TextureRHI.GetReference();
+		SetTextureParameter(RHICmdList, ShaderRHI, Trace[i], LinearSampler,sampler, TraceTexture);
+	}
+
+	for(int32 i = 0; i < ARRAY_COUNT(Kernel); i++)
+		SetTextureParameter(RHICmdList, ShaderRHI, Kernel[i], LinearSampler,sampler, GSceneRenderTargets.AHRPerPixelInterpolationKernel[i]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D());
+
+	if(LinearSampler.IsBound())
+		RHICmdList.SetShaderSampler(ShaderRHI,LinearSampler.GetBaseIndex(),sampler);
+}
+
+template void FAHRCompositeParameters::Set<FPixelShaderRHIParamRef>(FRHICommandList& RHICmdList, const FPixelShaderRHIParamRef ShaderRHI, const FSceneView& View, EAHRCompositeMode Mode) const;
+template void FAHRCompositeParameters::Set<FComputeShaderRHIParamRef>(FRHICommandList& RHICmdList, const FComputeShaderRHIParamRef ShaderRHI, const FSceneView& View, EAHRCompositeMode Mode) const;
+
+FArchive& operator<<(FArchive& Ar, FAHRCompositeParameters& Parameters)
+{
+	Ar << Parameters.LinearSampler;
+	Ar << Parameters.cb;
+	Ar << Parameters.ObjNormal;
+
+	for(int32 i = 0; i < ARRAY_COUNT(Parameters.Trace); i++)
+		Ar << Parameters.Trace[i];
+	for(int32 i = 0; i < ARRAY_COUNT(Parameters.Kernel); i++)
+		Ar << Parameters.Kernel[i];
+
+	return Ar;
+}
+
 class AHRCompositePS : public FGlobalShader
 {
 	DECLARE_SHADER_TYPE(AHRCompositePS,Global)
@@ -1466,82 +2759,26 @@ public:
 	:	FGlobalShader(Initializer)
 	{
 		DeferredParameters.Bind(Initializer.ParameterMap);
-		LinearSampler.Bind(Initializer.ParameterMap, TEXT("samLinear"));
-		cb.Bind(Initializer.ParameterMap,TEXT("AHRCompositeCB"));
-		ObjNormal.Bind(Initializer.ParameterMap,TEXT("ObjNormal"));
-
-		Trace0.Bind(Initializer.ParameterMap, TEXT("Trace0"));
-		Trace1.Bind(Initializer.ParameterMap, TEXT("Trace1"));
-		Trace2.Bind(Initializer.ParameterMap, TEXT("Trace2"));
-		Trace3.Bind(Initializer.ParameterMap, TEXT("Trace3"));
-		Trace4.Bind(Initializer.ParameterMap, TEXT("Trace4"));
-		Trace5.Bind(Initializer.ParameterMap, TEXT("Trace5"));
-
-		Kernel0.Bind(Initializer.ParameterMap, TEXT("Kernel0"));
-		Kernel1.Bind(Initializer.ParameterMap, TEXT("Kernel1"));
-		Kernel2.Bind(Initializer.ParameterMap, TEXT("Kernel2"));
-		Kernel3.Bind(Initializer.ParameterMap, TEXT("Kernel3"));
-		Kernel4.Bind(Initializer.ParameterMap, TEXT("Kernel4"));
+		CompositeParameters.Bind(Initializer.ParameterMap);
 	}
 
 	AHRCompositePS()
 	{
 	}
 
-	void SetParameters(FRHICommandList& RHICmdList, const FSceneView& View)
+	void SetParameters(FRHICommandList& RHICmdList, const FSceneView& View, bool bReflectionInTiledPass)
 	{
 		const FPixelShaderRHIParamRef ShaderRHI = GetPixelShader();
 		FGlobalShader::SetParameters(RHICmdList, ShaderRHI,View);
 		DeferredParameters.Set(RHICmdList, ShaderRHI, View);
-
-		auto sampler = TStaticSamplerState<SF_Trilinear,AM_Wrap,AM_Wrap,AM_Wrap>::GetRHI();
-		
-		if(ObjNormal.IsBound())
-			RHICmdList.SetShaderResourceViewParameter(ShaderRHI,ObjNormal.GetBaseIndex(),AHREngine.ObjectNormalSRV);
-		AHRCompositeCB cbdata;
-
-		cbdata.GIMultiplier = View.FinalPostProcessSettings.AHRIntensity;
-
-		SetUniformBufferParameterImmediate(RHICmdList, ShaderRHI,cb,cbdata);
-
-		SetTextureParameter(RHICmdList, ShaderRHI, Trace0, LinearSampler,sampler, GSceneRenderTargets.AHRRaytracingTarget[0]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D());	
-		SetTextureParameter(RHICmdList, ShaderRHI, Trace1, LinearSampler,sampler, GSceneRenderTargets.AHRRaytracingTarget[1]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D());	
-		SetTextureParameter(RHICmdList, ShaderRHI, Trace2, LinearSampler,sampler, GSceneRenderTargets.AHRRaytracingTarget[2]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D());	
-		SetTextureParameter(RHICmdList, ShaderRHI, Trace3, LinearSampler,sampler, GSceneRenderTargets.AHRRaytracingTarget[3]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D());	
-		SetTextureParameter(RHICmdList, ShaderRHI, Trace4, LinearSampler,sampler, GSceneRenderTargets.AHRRaytracingTarget[4]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D());	
-		SetTextureParameter(RHICmdList, ShaderRHI, Trace5, LinearSampler,sampler, GSceneRenderTargets.AHRRaytracingTarget[5]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D());	
-
-		SetTextureParameter(RHICmdList, ShaderRHI, Kernel0, LinearSampler,sampler, GSceneRenderTargets.AHRPerPixelInterpolationKernel[0]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D());	
-		SetTextureParameter(RHICmdList, ShaderRHI, Kernel1, LinearSampler,sampler, GSceneRenderTargets.AHRPerPixelInterpolationKernel[1]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D());	
-		SetTextureParameter(RHICmdList, ShaderRHI, Kernel2, LinearSampler,sampler, GSceneRenderTargets.AHRPerPixelInterpolationKernel[2]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D());	
-		SetTextureParameter(RHICmdList, ShaderRHI, Kernel3, LinearSampler,sampler, GSceneRenderTargets.AHRPerPixelInterpolationKernel[3]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D());	
-		SetTextureParameter(RHICmdList, ShaderRHI, Kernel4, LinearSampler,sampler, GSceneRenderTargets.AHRPerPixelInterpolationKernel[4]->GetRenderTargetItem().ShaderResourceTexture->GetTexture2D());	
-
-		if(LinearSampler.IsBound())
-			RHICmdList.SetShaderSampler(ShaderRHI,LinearSampler.GetBaseIndex(),sampler);
+		CompositeParameters.Set(RHICmdList, ShaderRHI, View, bReflectionInTiledPass ? AHRComposite_GI : AHRComposite_All);
 	}
 
 	virtual bool Serialize(FArchive& Ar)
 	{		
 		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize(Ar);
 		Ar << DeferredParameters;
-		Ar << LinearSampler;
-		Ar << cb;
-		Ar << ObjNormal;
-
-		Ar << Trace0;
-		Ar << Trace1;
-		Ar << Trace2;
-		Ar << Trace3;
-		Ar << Trace4;
-		Ar << Trace5;
-
-		Ar << Kernel0;
-		Ar << Kernel1;
-		Ar << Kernel2;
-		Ar << Kernel3;
-		Ar << Kernel4;
-
+		Ar << CompositeParameters;
 		return bShaderHasOutdatedParameters;
 	}
 
@@ -1554,19 +2791,15 @@ public:
 
 private:
 	FDeferredPixelShaderParameters DeferredParameters;
-	FShaderResourceParameter LinearSampler;
-	FShaderResourceParameter ObjNormal;
-
-	FShaderResourceParameter Trace0,Trace1,Trace2,Trace3,Trace4,Trace5;
-	FShaderResourceParameter Kernel0,Kernel1,Kernel2,Kernel3,Kernel4;
-
-	TShaderUniformBufferParameter<AHRCompositeCB> cb;
+	FAHRCompositeParameters CompositeParameters;
 };
 IMPLEMENT_SHADER_TYPE(,AHRCompositePS,TEXT("AHRComposite"),TEXT("PS"),SF_Pixel);
 
-void FApproximateHybridRaytracer::Composite(FRHICommandListImmediate& RHICmdList,FViewInfo& View)
+void FApproximateHybridRaytracer::Composite(FRHICommandListImmediate& RHICmdList,FViewInfo& View,bool bReflectionInTiledPass)
 {
 	SCOPED_DRAW_EVENT(RHICmdList,AHRComposite);
+	SCOPE_CYCLE_COUNTER(STAT_AHRComposite);
+	FAHRScopedGPUStage GPUStage(RHICmdList,AHRStage_Composite);
 
 	// Simply render a full screen quad and sample the upsampled buffer. Use additive blending to mix it with the light accumulation buffer
 	// Only one view at a time for now (1/11/2014)
@@ -1586,7 +2819,7 @@ void FApproximateHybridRaytracer::Composite(FRHICommandListImmediate& RHICmdList
 
 
 	// Set the viewport, raster state and depth stencil
-	FIntRect DestRect(View.ViewRect.Min,FIntPoint(View.Family->FamilySizeX,View.Family->FamilySizeY));
+	FIntRect DestRect = View.ViewRect;
 	RHICmdList.SetViewport(DestRect.Min.X,DestRect.Min.Y,0.0f,DestRect.Max.X,DestRect.Max.Y,1.0f);
 	//RHICmdList.SetViewport(0, 0, 0.0f,ResX, ResY, 1.0f);
 	RHICmdList.SetRasterizerState(TStaticRasterizerState<FM_Solid, CM_None>::GetRHI());
@@ -1601,7 +2834,7 @@ void FApproximateHybridRaytracer::Composite(FRHICommandListImmediate& RHICmdList
 	VertexShader->SetParameters(RHICmdList,View);
 	float scalingX = float(View.Family->FamilySizeX) / float(GSceneRenderTargets.GetBufferSizeXY().X);
 	float scalingY = float(View.Family->FamilySizeY) / float(GSceneRenderTargets.GetBufferSizeXY().Y);
-	PixelShader->SetParameters(RHICmdList, View);
+	PixelShader->SetParameters(RHICmdList, View, bReflectionInTiledPass);
 
 	// Draw!
 	DrawRectangle( 
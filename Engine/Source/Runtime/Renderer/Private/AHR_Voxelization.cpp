@@ -8,6 +8,7 @@
 #include "AHR_Voxelization_Shaders.h"
 
 IMPLEMENT_MATERIAL_SHADER_TYPE(,FAHRVoxelizationVertexShader,TEXT("AHRVoxelizationVS"),TEXT("Main"),SF_Vertex);
+IMPLEMENT_MATERIAL_SHADER_TYPE(,FAHRVoxelizationAxisVertexShader,TEXT("AHRVoxelizationVS"),TEXT("MainAxis"),SF_Vertex);
 IMPLEMENT_MATERIAL_SHADER_TYPE(,FAHRVoxelizationGeometryShader,TEXT("AHRVoxelizationGS"),TEXT("Main"),SF_Geometry);
 IMPLEMENT_MATERIAL_SHADER_TYPE(,FAHRVoxelizationPixelShader,TEXT("AHRVoxelizationPS"),TEXT("Main"),SF_Pixel);
 
@@ -125,23 +126,28 @@ bool FAHRVoxelizerDrawingPolicyFactory::DrawDynamicMesh(
 	FAHRVoxelizerDrawingPolicy DrawingPolicy( Mesh.VertexFactory,
 											  Mesh.MaterialRenderProxy, *Material,
 											  featureLevel,
-											  &DrawingContext );
+											  &DrawingContext,
+											  CVarAHRVoxelizationGeometryShader.GetValueOnAnyThread() == 0 );
 
 	RHICmdList.BuildAndSetLocalBoundShaderState(DrawingPolicy.GetBoundShaderStateInput(View.GetFeatureLevel()));
-	DrawingPolicy.SetSharedState(RHICmdList, &View, FAHRVoxelizerDrawingPolicy::ContextDataType());
 
-	for( int32 BatchElementIndex = 0, Num = Mesh.Elements.Num(); BatchElementIndex < Num; BatchElementIndex++ )
+	for( uint32 Pass = 0; Pass < DrawingPolicy.GetNumPasses(); Pass++ )
 	{
-		DrawingPolicy.SetMeshRenderState( RHICmdList, 
-										  View,
-										  PrimitiveSceneProxy,
-										  Mesh,
-										  BatchElementIndex,
-										  bBackFace,
-										  FAHRVoxelizerDrawingPolicy::ElementDataType(),
-										  FMeshDrawingPolicy::ContextDataType() );
-
-		DrawingPolicy.DrawMesh(RHICmdList, Mesh, BatchElementIndex);
+		DrawingPolicy.SetSharedState(RHICmdList, &View, FAHRVoxelizerDrawingPolicy::ContextDataType(), Pass);
+
+		for( int32 BatchElementIndex = 0, Num = Mesh.Elements.Num(); BatchElementIndex < Num; BatchElementIndex++ )
+		{
+			DrawingPolicy.SetMeshRenderState( RHICmdList, 
+											  View,
+											  PrimitiveSceneProxy,
+											  Mesh,
+											  BatchElementIndex,
+											  bBackFace,
+											  FAHRVoxelizerDrawingPolicy::ElementDataType(),
+											  FMeshDrawingPolicy::ContextDataType() );
+
+			DrawingPolicy.DrawMesh(RHICmdList, Mesh, BatchElementIndex);
+		}
 	}
 
 	// Unbind
@@ -97,7 +97,13 @@ public:
 	enum { bAllowSimpleElements = false };
 	struct ContextType
 	{
+		// Volumes the draws write to. Captured when the draws are issued, as the active volume can change before a parallel command list is recorded
+		FUnorderedAccessViewRHIRef SceneVolumeUAV;
+		FUnorderedAccessViewRHIRef EmissiveVolumeUAV;
+
 		ContextType()
+			: SceneVolumeUAV(AHREngine.GetSceneVolumeUAV())
+			, EmissiveVolumeUAV(AHREngine.GetEmissiveVolumeUAV())
 		{
 		}
 	};
@@ -135,42 +141,67 @@ public:
 							    const FMaterialRenderProxy* InMaterialRenderProxy,
 							    const FMaterial& InMaterialResource,
 								ERHIFeatureLevel::Type InFeatureLevel,
-								FAHRVoxelizerDrawingPolicyFactory::ContextType* _context) : FMeshDrawingPolicy(InVertexFactory,InMaterialRenderProxy,InMaterialResource,bOverrideWithShaderComplexity)
+								FAHRVoxelizerDrawingPolicyFactory::ContextType* _context,
+								bool bInAxisPasses) : FMeshDrawingPolicy(InVertexFactory,InMaterialRenderProxy,InMaterialResource,bOverrideWithShaderComplexity)
 	{
 		context = _context;
+		bAxisPasses = bInAxisPasses;
 
-		// Get the shaders
-		VertexShader = InMaterialResource.GetShader<FAHRVoxelizationVertexShader>(InVertexFactory->GetType());
-		GeometryShader = InMaterialResource.GetShader<FAHRVoxelizationGeometryShader>(InVertexFactory->GetType());
+		// Get the shaders. The axis passes project in the vertex shader, and need no geometry shader
+		VertexShader = nullptr;
+		AxisVertexShader = nullptr;
+		GeometryShader = nullptr;
+		if(bAxisPasses)
+		{
+			AxisVertexShader = InMaterialResource.GetShader<FAHRVoxelizationAxisVertexShader>(InVertexFactory->GetType());
+		}
+		else
+		{
+			VertexShader = InMaterialResource.GetShader<FAHRVoxelizationVertexShader>(InVertexFactory->GetType());
+			GeometryShader = InMaterialResource.GetShader<FAHRVoxelizationGeometryShader>(InVertexFactory->GetType());
+		}
 		PixelShader = InMaterialResource.GetShader<FAHRVoxelizationPixelShader>(InVertexFactory->GetType());
 	}
 
+	// Number of times every element is drawn, once per axis without the geometry shader
+	uint32 GetNumPasses() const { return bAxisPasses ? 3 : 1; }
+
 	// FMeshDrawingPolicy interface.
 	bool Matches(const FAHRVoxelizerDrawingPolicy& Other) const
 	{
 		return FMeshDrawingPolicy::Matches(Other) &&
 			VertexShader == Other.VertexShader &&
+			AxisVertexShader == Other.AxisVertexShader &&
 			PixelShader == Other.PixelShader &&
 			GeometryShader == Other.GeometryShader;
 	}
 
-	void SetSharedState(FRHICommandList& RHICmdList, const FViewInfo* View, const ContextDataType PolicyContext) const
+	// Pass is the axis to project along for the axis passes, ignored with the geometry shader
+	void SetSharedState(FRHICommandList& RHICmdList, const FViewInfo* View, const ContextDataType PolicyContext, uint32 Pass = 0) const
 	{
 		// Set the shaders parameters
-		VertexShader->SetParameters(RHICmdList, MaterialRenderProxy, VertexFactory, *MaterialResource, *View);
-		GeometryShader->SetParameters(RHICmdList, MaterialRenderProxy, VertexFactory, *MaterialResource, *View);
-		PixelShader->SetParameters(RHICmdList, MaterialRenderProxy,*MaterialResource,View);
+		const uint32 ProjectionAxis = bAxisPasses ? Pass : AHR_DOMINANT_AXIS;
+		if(bAxisPasses)
+		{
+			AxisVertexShader->SetParameters(RHICmdList, MaterialRenderProxy, VertexFactory, *MaterialResource, *View, ProjectionAxis);
+		}
+		else
+		{
+			VertexShader->SetParameters(RHICmdList, MaterialRenderProxy, VertexFactory, *MaterialResource, *View);
+			GeometryShader->SetParameters(RHICmdList, MaterialRenderProxy, VertexFactory, *MaterialResource, *View);
+		}
+		PixelShader->SetParameters(RHICmdList, MaterialRenderProxy,*MaterialResource,View,ProjectionAxis);
 	}
 
 	FBoundShaderStateInput GetBoundShaderStateInput(ERHIFeatureLevel::Type InFeatureLevel)
 	{
 		return FBoundShaderStateInput(
 			FMeshDrawingPolicy::GetVertexDeclaration(), 
-			VertexShader->GetVertexShader(),
+			bAxisPasses ? AxisVertexShader->GetVertexShader() : VertexShader->GetVertexShader(),
 			FHullShaderRHIParamRef(), 
 			FDomainShaderRHIParamRef(), 
 			PixelShader->GetPixelShader(),
-			GeometryShader->GetGeometryShader());
+			bAxisPasses ? FGeometryShaderRHIParamRef() : GeometryShader->GetGeometryShader());
 	}
 
 	void SetMeshRenderState(
@@ -186,8 +217,15 @@ public:
 	{
 		const FMeshBatchElement& BatchElement = Mesh.Elements[BatchElementIndex];
 
-		VertexShader->SetMesh(RHICmdList, VertexFactory,View,PrimitiveSceneProxy,BatchElement);
-		GeometryShader->SetMesh(RHICmdList, VertexFactory,View,PrimitiveSceneProxy,BatchElement);
+		if(bAxisPasses)
+		{
+			AxisVertexShader->SetMesh(RHICmdList, VertexFactory,View,PrimitiveSceneProxy,BatchElement);
+		}
+		else
+		{
+			VertexShader->SetMesh(RHICmdList, VertexFactory,View,PrimitiveSceneProxy,BatchElement);
+			GeometryShader->SetMesh(RHICmdList, VertexFactory,View,PrimitiveSceneProxy,BatchElement);
+		}
 		PixelShader->SetMesh(RHICmdList, VertexFactory,View,PrimitiveSceneProxy,BatchElement);
 
 		RHICmdList.SetDepthStencilState(TStaticDepthStencilState<false, CF_Always>::GetRHI());
@@ -199,7 +237,7 @@ public:
 		Mesh.VertexFactory->Set(RHICmdList);
 	
 		// Bind the voxels UAV and bind a null depth-stencil buffer
-		FUnorderedAccessViewRHIParamRef uavs[] = { AHREngine.GetSceneVolumeUAV(),AHREngine.GetEmissiveVolumeUAV() };
+		FUnorderedAccessViewRHIParamRef uavs[] = { context->SceneVolumeUAV,context->EmissiveVolumeUAV };
 		RHICmdList.SetRenderTargets(0,nullptr,nullptr,2,uavs);
 
 		//FMeshDrawingPolicy::SetMeshRenderState(RHICmdList, View,PrimitiveSceneProxy,Mesh,BatchElementIndex,bBackFace,FMeshDrawingPolicy::ElementDataType(),PolicyContext);
@@ -208,6 +246,7 @@ public:
 	friend int32 CompareDrawingPolicy(const FAHRVoxelizerDrawingPolicy& A,const FAHRVoxelizerDrawingPolicy& B)
 	{
 		COMPAREDRAWINGPOLICYMEMBERS(VertexShader);
+		COMPAREDRAWINGPOLICYMEMBERS(AxisVertexShader);
 		COMPAREDRAWINGPOLICYMEMBERS(PixelShader);
 		COMPAREDRAWINGPOLICYMEMBERS(GeometryShader);
 
@@ -215,7 +254,9 @@ public:
 	}
 private:
 	FAHRVoxelizerDrawingPolicyFactory::ContextType* context;
+	bool bAxisPasses;
 	FAHRVoxelizationVertexShader* VertexShader;
+	FAHRVoxelizationAxisVertexShader* AxisVertexShader;
 	FAHRVoxelizationGeometryShader* GeometryShader;
 	FAHRVoxelizationPixelShader* PixelShader;
 };
\ No newline at end of file
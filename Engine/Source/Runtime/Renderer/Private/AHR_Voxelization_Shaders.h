@@ -7,24 +7,53 @@ BEGIN_UNIFORM_BUFFER_STRUCT(AHRVoxelizationCB,)
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector2D,ScreenRes)
 
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FIntVector,SliceSize)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FIntVector,ToroidalOffset)
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector,HalfInvSceneBounds)
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector,WorldToVoxelOffset) // -SceneCenter/SceneBounds
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector,invVoxel)
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(float,TriangleSizeMultiplier)
+	// Axis the pass projects along without the geometry shader, AHR_DOMINANT_AXIS when the geometry shader picks it per triangle
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(uint32,ProjectionAxis)
 
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FMatrix,ShadowMatrix0)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FMatrix,ShadowMatrix1)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FMatrix,ShadowMatrix2)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FMatrix,ShadowMatrix3)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FMatrix,ShadowMatrix4)
-
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector2D,ShadowViewportScaling0)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector2D,ShadowViewportScaling1)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector2D,ShadowViewportScaling2)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector2D,ShadowViewportScaling3)
-	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector2D,ShadowViewportScaling4)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(uint32,NumLights)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER_ARRAY(FMatrix,ShadowMatrix,[MAX_AHR_LIGHTS])
+	// Tile of each light on the shadow atlas. xy is the scale, zw the bias
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER_ARRAY(FVector4,ShadowAtlasScaleBias,[MAX_AHR_LIGHTS])
 END_UNIFORM_BUFFER_STRUCT(AHRVoxelizationCB)
 
+// Must match AHRVoxelizationCommon.usf
+#define AHR_DOMINANT_AXIS 3
+
+inline AHRVoxelizationCB GetAHRVoxelizationCB(const FSceneView& View, uint32 ProjectionAxis)
+{
+	AHRVoxelizationCB cbdata;
+
+	auto gridCFG = AHREngine.GetGridSettings();
+	cbdata.SliceSize.X = gridCFG.SliceSize.X;
+	cbdata.SliceSize.Y = gridCFG.SliceSize.Y;
+	cbdata.SliceSize.Z = gridCFG.SliceSize.Z;
+	cbdata.ToroidalOffset = gridCFG.ToroidalOffset;
+	cbdata.ScreenRes.X = View.Family->FamilySizeX/2;
+	cbdata.ScreenRes.Y = View.Family->FamilySizeY/2;
+	cbdata.invVoxel = FVector(1.0f / float(gridCFG.SliceSize.X),
+							  1.0f / float(gridCFG.SliceSize.Y),
+							  1.0f / float(gridCFG.SliceSize.Z));
+
+	cbdata.HalfInvSceneBounds = FVector(0.5f) / gridCFG.Bounds;
+	cbdata.WorldToVoxelOffset = -gridCFG.Center*cbdata.HalfInvSceneBounds + 0.5f; // -SceneCenter/SceneBounds
+	cbdata.TriangleSizeMultiplier = View.FinalPostProcessSettings.TriangleSizeMultiplier;
+	cbdata.ProjectionAxis = ProjectionAxis;
+
+	cbdata.NumLights = AHREngine.GetNumLights();
+	for(uint32 i = 0;i < AHREngine.GetNumLights();i++)
+	{
+		cbdata.ShadowMatrix[i] = AHREngine.GetLightsList()[i].ViewProj;
+		cbdata.ShadowAtlasScaleBias[i] = AHREngine.GetLightsList()[i].AtlasScaleBias;
+	}
+
+	return cbdata;
+}
+
 
 class FAHRVoxelizationVertexShader : public FMeshMaterialShader
 {
@@ -73,6 +102,60 @@ public:
 private:
 };
 
+// Vertex shader of the geometry shader free path, projects the elements along the axis of the pass
+class FAHRVoxelizationAxisVertexShader : public FMeshMaterialShader
+{
+	DECLARE_SHADER_TYPE(FAHRVoxelizationAxisVertexShader,MeshMaterial);
+
+protected:
+	FAHRVoxelizationAxisVertexShader() {}
+	FAHRVoxelizationAxisVertexShader(const FMeshMaterialShaderType::CompiledShaderInitializerType& Initializer):
+	FMeshMaterialShader(Initializer)
+	{
+		cb.Bind(Initializer.ParameterMap, TEXT("AHRVoxelizationCB"));
+	}
+
+public:
+	static bool ShouldCache(EShaderPlatform Platform,const FMaterial* Material,const FVertexFactoryType* VertexFactoryType)
+	{
+		return IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(EShaderPlatform Platform, const FMaterial* Material, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FMeshMaterialShader::ModifyCompilationEnvironment(Platform, Material, OutEnvironment);
+	}
+
+	virtual bool Serialize(FArchive& Ar)
+	{
+		bool bShaderHasOutdatedParameters = FMeshMaterialShader::Serialize(Ar);
+		Ar << cb;
+		return bShaderHasOutdatedParameters;
+	}
+
+	void SetParameters(
+		FRHICommandList& RHICmdList, 
+		const FMaterialRenderProxy* MaterialRenderProxy,
+		const FVertexFactory* VertexFactory,
+		const FMaterial& InMaterialResource,
+		const FSceneView& View,
+		uint32 ProjectionAxis
+		)
+	{
+		const auto ShaderRHI = GetVertexShader();
+		FMeshMaterialShader::SetParameters(RHICmdList, ShaderRHI,MaterialRenderProxy,InMaterialResource,View, ESceneRenderTargetsMode::DontSet);
+		SetUniformBufferParameterImmediate(RHICmdList, ShaderRHI,cb,GetAHRVoxelizationCB(View, ProjectionAxis));
+	}
+
+	void SetMesh(FRHICommandList& RHICmdList, const FVertexFactory* VertexFactory,const FSceneView& View,const FPrimitiveSceneProxy* Proxy,const FMeshBatchElement& BatchElement)
+	{
+		FMeshMaterialShader::SetMesh(RHICmdList, GetVertexShader(),VertexFactory,View,Proxy,BatchElement);
+	}
+
+private:
+	TShaderUniformBufferParameter<AHRVoxelizationCB> cb;
+};
+
 class FAHRVoxelizationGeometryShader : public FMeshMaterialShader
 {
 	DECLARE_SHADER_TYPE(FAHRVoxelizationGeometryShader,MeshMaterial);
@@ -113,21 +196,7 @@ public:
 	{
 		//FMeshMaterialShader::SetParameters(RHICmdList, GetVertexShader(),MaterialRenderProxy,InMaterialResource,View,ESceneRenderTargetsMode::DontSet);
 		const auto ShaderRHI = GetGeometryShader();
-		AHRVoxelizationCB cbdata;
-
-		auto gridCFG = AHREngine.GetGridSettings();
-		cbdata.SliceSize.X = gridCFG.SliceSize.X;
-		cbdata.SliceSize.Y = gridCFG.SliceSize.Y;
-		cbdata.SliceSize.Z = gridCFG.SliceSize.Z;
-		cbdata.ScreenRes.X = View.Family->FamilySizeX/2;
-		cbdata.ScreenRes.Y = View.Family->FamilySizeY/2;
-		cbdata.invVoxel = FVector(1.0f / float(gridCFG.SliceSize.X),
-								  1.0f / float(gridCFG.SliceSize.Y),
-								  1.0f / float(gridCFG.SliceSize.Z));
-
-		cbdata.HalfInvSceneBounds = FVector(0.5f) / gridCFG.Bounds;
-		cbdata.WorldToVoxelOffset = -gridCFG.Center*cbdata.HalfInvSceneBounds + 0.5f; // -SceneCenter/SceneBounds
-		cbdata.TriangleSizeMultiplier = View.FinalPostProcessSettings.TriangleSizeMultiplier;
+		AHRVoxelizationCB cbdata = GetAHRVoxelizationCB(View, AHR_DOMINANT_AXIS);
 
 		SetUniformBufferParameterImmediate(RHICmdList, ShaderRHI,cb,cbdata);
 	}
@@ -162,7 +231,7 @@ public:
 		FMeshMaterialShader(Initializer)
 	{
 		cb.Bind(Initializer.ParameterMap, TEXT("AHRVoxelizationCB"));
-		ShadowDepth0.Bind(Initializer.ParameterMap, TEXT("ShadowDepth0"));
+		ShadowAtlas.Bind(Initializer.ParameterMap, TEXT("ShadowAtlas"));
 		pointSampler.Bind(Initializer.ParameterMap, TEXT("pointSampler"));
 	}
 	FAHRVoxelizationPixelShader() {}
@@ -171,34 +240,18 @@ public:
 		FRHICommandList& RHICmdList, 
 		const FMaterialRenderProxy* MaterialRenderProxy, 
 		const FMaterial& MaterialResource, 
-		const FSceneView* View)
+		const FSceneView* View,
+		uint32 ProjectionAxis)
 	{
 		const FPixelShaderRHIParamRef ShaderRHI = GetPixelShader();
 
 		FMeshMaterialShader::SetParameters(RHICmdList, ShaderRHI, MaterialRenderProxy, MaterialResource, *View, ESceneRenderTargetsMode::DontSet);
 
-		AHRVoxelizationCB cbdata;
-		auto gridCFG = AHREngine.GetGridSettings();
-		cbdata.SliceSize.X = gridCFG.SliceSize.X;
-		cbdata.SliceSize.Y = gridCFG.SliceSize.Y;
-		cbdata.SliceSize.Z = gridCFG.SliceSize.Z;
-		cbdata.ScreenRes.X = View->Family->FamilySizeX/2;
-		cbdata.ScreenRes.Y = View->Family->FamilySizeY/2;
-		cbdata.invVoxel = FVector(1.0f / float(gridCFG.SliceSize.X),
-								  1.0f / float(gridCFG.SliceSize.Y),
-								  1.0f / float(gridCFG.SliceSize.Z));
-
-		cbdata.HalfInvSceneBounds = FVector(0.5f) / gridCFG.Bounds;
-		cbdata.WorldToVoxelOffset = -gridCFG.Center*cbdata.HalfInvSceneBounds + 0.5f; // -SceneCenter/SceneBounds
-		cbdata.TriangleSizeMultiplier = View->FinalPostProcessSettings.TriangleSizeMultiplier;
-
-		cbdata.ShadowMatrix0 = AHREngine.GetLightsList()[0].ViewProj;
-		cbdata.ShadowViewportScaling0 = AHREngine.GetLightsList()[0].ViewportScaling;
-
+		AHRVoxelizationCB cbdata = GetAHRVoxelizationCB(*View, ProjectionAxis);
 		SetUniformBufferParameterImmediate(RHICmdList, ShaderRHI,cb,cbdata);
 
 		auto sampler = TStaticSamplerState<SF_Point,AM_Border,AM_Border,AM_Border,0,0,0,SCF_Never>::GetRHI();
-		SetTextureParameter(RHICmdList, ShaderRHI, ShadowDepth0, pointSampler,sampler, AHREngine.GetShadowTexture(0));		
+		SetTextureParameter(RHICmdList, ShaderRHI, ShadowAtlas, pointSampler,sampler, AHREngine.GetShadowAtlas());		
 		
 		if(pointSampler.IsBound())
 			RHICmdList.SetShaderSampler(ShaderRHI,pointSampler.GetBaseIndex(),sampler);
@@ -213,13 +266,13 @@ public:
 	{
 		bool bShaderHasOutdatedParameters = FMeshMaterialShader::Serialize(Ar);
 		Ar << cb;
-		Ar << ShadowDepth0;
+		Ar << ShadowAtlas;
 		Ar << pointSampler;
 		return bShaderHasOutdatedParameters;
 	}
 
 private:
 	TShaderUniformBufferParameter<AHRVoxelizationCB> cb;
-	FShaderResourceParameter ShadowDepth0;
+	FShaderResourceParameter ShadowAtlas;
 	FShaderResourceParameter pointSampler;
 };
\ No newline at end of file
@@ -6,6 +6,31 @@
 
 TGlobalResource<FApproximateHybridRaytracer> AHREngine;
 
+DEFINE_STAT(STAT_AHRStartFrame);
+DEFINE_STAT(STAT_AHRVoxelizeScene);
+DEFINE_STAT(STAT_AHRTraceScene);
+DEFINE_STAT(STAT_AHRUpsample);
+DEFINE_STAT(STAT_AHRComposite);
+
+DEFINE_STAT(STAT_AHRGPUVoxelizeScene);
+DEFINE_STAT(STAT_AHRGPUTraceScene);
+DEFINE_STAT(STAT_AHRGPUUpsample);
+DEFINE_STAT(STAT_AHRGPUComposite);
+
+DEFINE_STAT(STAT_AHRPrimitivesToVoxelize);
+DEFINE_STAT(STAT_AHRVoxelizedElements);
+DEFINE_STAT(STAT_AHRVoxelizedTriangles);
+DEFINE_STAT(STAT_AHRSplattedPrimitives);
+
+DEFINE_STAT(STAT_AHRSceneVolumeMemory);
+DEFINE_STAT(STAT_AHREmissiveVolumeMemory);
+DEFINE_STAT(STAT_AHROccupancyVolumeMemory);
+DEFINE_STAT(STAT_AHRShadowAtlasMemory);
+DEFINE_STAT(STAT_AHRRaytracingTargetMemory);
+DEFINE_STAT(STAT_AHRUpsampledTargetMemory);
+DEFINE_STAT(STAT_AHRHistoryTargetMemory);
+DEFINE_STAT(STAT_AHRKernelTargetMemory);
+
 TAutoConsoleVariable<int32> CVarApproximateHybridRaytracing = TAutoConsoleVariable<int32>(
 	TEXT("r.ApproximateHybridRaytracing"),
 	0,
@@ -28,10 +53,164 @@ TAutoConsoleVariable<int32> CVarAHRTraceReflections = TAutoConsoleVariable<int32
 	TEXT(" 1 : on"),
 	ECVF_RenderThreadSafe);
 
+TAutoConsoleVariable<int32> CVarAHRStaticVolume = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRStaticVolume"),
+	1,
+	TEXT("Keep a persistent voxel volume for the primitives that don't need every frame voxelization.\n")
+	TEXT("Only the bricks touched by added, removed or moved primitives are revoxelized. Note that the lighting stored on the static volume is only updated when revoxelized.\n")
+	TEXT(" 0 : off, voxelize everything every frame\n")
+	TEXT(" 1 : on (default)"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHRGridFollowsCamera = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRGridFollowsCamera"),
+	0,
+	TEXT("Center the voxel grid on the camera instead of on the post process volume. The grid moves in whole bricks and the volumes are\n")
+	TEXT("addressed toroidally, so only the newly exposed slabs get revoxelized.\n")
+	TEXT(" 0 : off (default)\n")
+	TEXT(" 1 : on"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHRTraceCompute = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRTraceCompute"),
+	0,
+	TEXT("Trace the 5 diffuse rays and the reflection ray with a single compute dispatch, instead of one full screen pass per ray.\n")
+	TEXT(" 0 : off, one pass per ray (default)\n")
+	TEXT(" 1 : on"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHREarlyVoxelization = TAutoConsoleVariable<int32>(
+	TEXT("r.AHREarlyVoxelization"),
+	0,
+	TEXT("When to voxelize the scene. Voxelizing before the depth prepass gives the GPU the voxelization, combine and occupancy work\n")
+	TEXT("ahead of the GBuffer passes, instead of stalling right before the lighting.\n")
+	TEXT(" 0 : after the base pass, before the lighting (default)\n")
+	TEXT(" 1 : before the depth prepass"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHRTemporalAccumulation = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRTemporalAccumulation"),
+	0,
+	TEXT("Accumulate the traced diffuse GI over frames. The history is reprojected with the previous frame matrices and rejected with depth and normal.\n")
+	TEXT("The tracing kernels are rotated every frame, so the ray and sample counts can be lowered for the same quality.\n")
+	TEXT(" 0 : off (default)\n")
+	TEXT(" 1 : on"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<float> CVarAHRTemporalWeight = TAutoConsoleVariable<float>(
+	TEXT("r.AHRTemporalWeight"),
+	0.9f,
+	TEXT("Weight of the history on the temporal accumulation. Higher is smoother, but slower to react. Default value is 0.9"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHRUpsampleInComposite = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRUpsampleInComposite"),
+	0,
+	TEXT("Where the diffuse traces are filtered.\n")
+	TEXT(" 0 : bilateral blur compute pass at trace resolution, then a bilinear upsample on the composite (default)\n")
+	TEXT(" 1 : no separate pass, the composite does a joint bilateral upsample of the traces. Cheaper but noisier, best used with r.AHRTemporalAccumulation"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHRDiffuseDirections = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRDiffuseDirections"),
+	5,
+	TEXT("Number of diffuse directions traced per pixel, from 1 to 5. Set by sg.AHRQuality. Default value is 5"),
+	ECVF_Scalability | ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<float> CVarAHRSamplesScale = TAutoConsoleVariable<float>(
+	TEXT("r.AHRSamplesScale"),
+	1.0f,
+	TEXT("Scale applied to the diffuse and glossy samples count of the post process settings. Set by sg.AHRQuality. Default value is 1"),
+	ECVF_Scalability | ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<float> CVarAHRVoxelSizeScale = TAutoConsoleVariable<float>(
+	TEXT("r.AHRVoxelSizeScale"),
+	1.0f,
+	TEXT("Scale applied to the voxel size of the post process settings. Higher values mean a coarser, cheaper grid. Set by sg.AHRQuality. Default value is 1"),
+	ECVF_Scalability | ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHRShadowAtlasResolution = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRShadowAtlasResolution"),
+	2048,
+	TEXT("Resolution of the atlas that stores the shadow depths of the lights injected on the grid. Each light gets a tile\n")
+	TEXT("sized by its screen contribution, lights that don't fit are dropped. Default value is 2048"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHRParallelVoxelization = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRParallelVoxelization"),
+	1,
+	TEXT("Record the voxelization draws on parallel command lists, like the base pass. Only used when the RHI supports parallel algorithms.\n")
+	TEXT(" 0 : off, draw on the render thread\n")
+	TEXT(" 1 : on (default)"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHRGlobalDistanceField = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRGlobalDistanceField"),
+	0,
+	TEXT("Skip empty space along the traced rays with the global distance field instead of the coarse occupancy grid.\n")
+	TEXT("Takes longer steps in open areas, but primitives without a mesh distance field, like skeletal meshes, can be stepped over.\n")
+	TEXT(" 0 : off, occupancy grid (default)\n")
+	TEXT(" 1 : on, needs r.GlobalDistanceField and generated mesh distance fields"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHRTiledReflections = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRTiledReflections"),
+	1,
+	TEXT("Where the AHR traces are blended with the scene.\n")
+	TEXT(" 0 : on the AHR composite\n")
+	TEXT(" 1 : the reflection trace on the tiled deferred reflection environment compute shader, when it runs, saving the reads of the composite (default)\n")
+	TEXT(" 2 : the whole AHR composite (GI and reflection) on the tiled deferred reflection environment compute shader, when it runs,\n")
+	TEXT("     saving the composite pass and its read-modify-write of scene color. Screen space reflections then miss the AHR GI"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHRVoxelizationDetail = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRVoxelizationDetail"),
+	1,
+	TEXT("Geometry submitted to the voxelization.\n")
+	TEXT(" 0 : LOD 0 of every primitive inside the grid\n")
+	TEXT(" 1 : the coarsest static mesh LOD whose triangles are still smaller than a voxel, and primitives smaller than a voxel are splatted as a single voxel (default)"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHRVoxelizationGeometryShader = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRVoxelizationGeometryShader"),
+	1,
+	TEXT("How the voxelization projects every triangle along its dominant axis.\n")
+	TEXT(" 0 : draw the elements once per axis, projected on the vertex shader, and drop the triangles of the other axes on the pixel shader.\n")
+	TEXT("     Three times the vertex work, but no geometry shader, which is slow on some GPUs\n")
+	TEXT(" 1 : pick the axis per triangle on a geometry shader (default)"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHRMultiBounce = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRMultiBounce"),
+	1,
+	TEXT("Multiple bounces of the GI. The light of the voxels is propagated to their neighbours a few slices per frame, only where the geometry or the lights changed,\n")
+	TEXT("and accumulated over the frames, so the bounces converge after a few sweeps at a fixed cost per frame.\n")
+	TEXT(" 0 : off, only the direct lighting and the emissive of the voxels are traced\n")
+	TEXT(" 1 : on (default)"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarAHRBounceSlicesPerFrame = TAutoConsoleVariable<int32>(
+	TEXT("r.AHRBounceSlicesPerFrame"),
+	8,
+	TEXT("Number of slices of the half res emissive grid the bounces are propagated on each frame, see r.AHRMultiBounce. Higher converges faster but costs more. Default value is 8"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<float> CVarAHRBounceIntensity = TAutoConsoleVariable<float>(
+	TEXT("r.AHRBounceIntensity"),
+	0.4f,
+	TEXT("Fraction of the light of the neighbour voxels that is reflected on each bounce. Must be below 1 for the bounces to converge. Default value is 0.4"),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<float> CVarAHRBounceTemporalWeight = TAutoConsoleVariable<float>(
+	TEXT("r.AHRBounceTemporalWeight"),
+	0.5f,
+	TEXT("Weight of the previous bounces when a voxel is propagated again. Higher is more stable, but slower to react to changes. Default value is 0.5"),
+	ECVF_RenderThreadSafe);
 
 void FApproximateHybridRaytracer::UpdateSettings()
 {
 	check(IsInRenderingThread());
+	MEMORY_TAG_SCOPE(AHRVoxels);
 
 	bool changed = false;
 
@@ -73,8 +252,24 @@ void FApproximateHybridRaytracer::UpdateSettings()
 		if(StaticEmissiveVolume)
 		{
 			StaticEmissiveVolume->Release();
-			DynamicEmissiveVolume->Initialize((gridSettings.SliceSize.X/2)*(gridSettings.SliceSize.Y/2)*(gridSettings.SliceSize.Z/2)*4);
+			StaticEmissiveVolume->Initialize((gridSettings.SliceSize.X/2)*(gridSettings.SliceSize.Y/2)*(gridSettings.SliceSize.Z/2)*4);
+		}
+		if(BounceVolume)
+		{
+			BounceVolume->Release();
+			BounceVolume->Initialize((gridSettings.SliceSize.X/2)*(gridSettings.SliceSize.Y/2)*(gridSettings.SliceSize.Z/2)*4);
+		}
+
+		if(OccupancyVolume)
+		{
+			OccupancyVolume->Release();
+			OccupancyVolume->Initialize(GetAHROccupancyVolumeSize(gridSettings.SliceSize),BUF_FastVRAM);
 		}
+
+		// The static volume is gone, so everything needs to be revoxelized
+		bStaticVolumeFullyDirty = true;
+		bBounceHistoryValid = false;
+		UpdateVolumeMemoryStats();
 		/*
 		// Destroy the emissive grid and recreate
 		StaticEmissiveVolume.SafeRelease();
@@ -93,6 +288,218 @@ void FApproximateHybridRaytracer::UpdateSettings()
 		DynamicEmissiveVolumeUAV = RHICreateUnorderedAccessView(DynamicEmissiveVolume);*/
 	}
 }
+void FApproximateHybridRaytracer::UpdateVolumeMemoryStats()
+{
+	SET_MEMORY_STAT(STAT_AHRSceneVolumeMemory, (StaticSceneVolume ? StaticSceneVolume->NumBytes : 0) + (DynamicSceneVolume ? DynamicSceneVolume->NumBytes : 0));
+	SET_MEMORY_STAT(STAT_AHREmissiveVolumeMemory, (StaticEmissiveVolume ? StaticEmissiveVolume->NumBytes : 0) + (DynamicEmissiveVolume ? DynamicEmissiveVolume->NumBytes : 0) + (BounceVolume ? BounceVolume->NumBytes : 0));
+	SET_MEMORY_STAT(STAT_AHROccupancyVolumeMemory, OccupancyVolume ? OccupancyVolume->NumBytes : 0);
+	SET_MEMORY_STAT(STAT_AHRShadowAtlasMemory, ShadowAtlasResolution*ShadowAtlasResolution*sizeof(float));
+}
+
+uint32 FApproximateHybridRaytracer::GetVolumesMemorySize() const
+{
+	uint32 Size = ShadowAtlasResolution*ShadowAtlasResolution*sizeof(float);
+	const FRWBufferByteAddress* Volumes[] = { StaticSceneVolume, DynamicSceneVolume, StaticEmissiveVolume, DynamicEmissiveVolume, BounceVolume, OccupancyVolume };
+	for(const FRWBufferByteAddress* Volume : Volumes)
+	{
+		if(Volume)
+			Size += Volume->NumBytes;
+	}
+	return Size;
+}
+
+void FApproximateHybridRaytracer::BeginGPUStage(FRHICommandListImmediate& RHICmdList, EAHRGPUStage Stage)
+{
+#if STATS
+	FRenderQueryRHIRef& Query = GPUTimerQueries[GPUTimerFrame][Stage][0];
+	if(bTimeGPUStages && Query && !GPUTimerIssued[GPUTimerFrame][Stage])
+		RHICmdList.EndRenderQuery(Query);
+#endif
+}
+
+void FApproximateHybridRaytracer::EndGPUStage(FRHICommandListImmediate& RHICmdList, EAHRGPUStage Stage)
+{
+#if STATS
+	FRenderQueryRHIRef& Query = GPUTimerQueries[GPUTimerFrame][Stage][1];
+	if(bTimeGPUStages && Query && !GPUTimerIssued[GPUTimerFrame][Stage])
+	{
+		RHICmdList.EndRenderQuery(Query);
+		GPUTimerIssued[GPUTimerFrame][Stage] = true;
+	}
+#endif
+}
+
+#if STATS
+// Reads the stage timestamps of a frame of the ring where the RHI commands execute, on the RHI thread if there is one.
+// Reading them on the rendering thread would need to flush the RHI thread first
+struct FRHICommandReadAHRGPUTimers : public FRHICommand<FRHICommandReadAHRGPUTimers>
+{
+	FRenderQueryRHIRef Queries[AHRStage_Num][2];
+	bool bIssued[AHRStage_Num];
+	FAHRGPUTimerReadback* Readback;
+	int32 ReadbackNumber;
+
+	FRHICommandReadAHRGPUTimers(FRenderQueryRHIRef (&InQueries)[AHRStage_Num][2], const bool (&InIssued)[AHRStage_Num], FAHRGPUTimerReadback* InReadback, int32 InReadbackNumber)
+		: Readback(InReadback)
+		, ReadbackNumber(InReadbackNumber)
+	{
+		for(int32 Stage = 0;Stage < AHRStage_Num;Stage++)
+		{
+			Queries[Stage][0] = InQueries[Stage][0];
+			Queries[Stage][1] = InQueries[Stage][1];
+			bIssued[Stage] = InIssued[Stage];
+		}
+	}
+
+	void Execute(FRHICommandListBase& CmdList)
+	{
+		for(int32 Stage = 0;Stage < AHRStage_Num;Stage++)
+		{
+			// Don't wait, if the GPU is that far behind just drop the sample
+			Readback->bRead[Stage] = bIssued[Stage] &&
+				GDynamicRHI->RHIGetRenderQueryResult(Queries[Stage][0], Readback->Times[Stage][0], false) &&
+				GDynamicRHI->RHIGetRenderQueryResult(Queries[Stage][1], Readback->Times[Stage][1], false);
+		}
+		FPlatformMisc::MemoryBarrier();
+		Readback->ReadbackNumber = ReadbackNumber;
+	}
+};
+#endif
+
+void FApproximateHybridRaytracer::UpdateGPUStats(FRHICommandListImmediate& RHICmdList)
+{
+#if STATS
+	// Publish the times read back since last frame. If the RHI thread didn't get to it yet the sample is dropped
+	float StageTimes[AHRStage_Num] = { 0 };
+	if(PendingReadbackFrame != INDEX_NONE)
+	{
+		const FAHRGPUTimerReadback& Readback = GPUTimerReadbacks[PendingReadbackFrame];
+		if(Readback.ReadbackNumber == PendingReadbackNumber)
+		{
+			FPlatformMisc::MemoryBarrier();
+			for(int32 Stage = 0;Stage < AHRStage_Num;Stage++)
+			{
+				const uint64 Begin = Readback.Times[Stage][0];
+				const uint64 End = Readback.Times[Stage][1];
+				if(!Readback.bRead[Stage] || End < Begin)
+					continue;
+
+				// Timestamps are on microseconds
+				StageTimes[Stage] = (End - Begin) / 1000.0f;
+
+				if(bBenchmarkCapturing)
+				{
+					BenchmarkStageTimes[Stage] += StageTimes[Stage];
+					BenchmarkStageSamples[Stage]++;
+				}
+			}
+		}
+		PendingReadbackFrame = INDEX_NONE;
+	}
+
+	// The oldest frame of the ring is the one that is going to be reused, it was issued AHR_GPU_TIMER_LATENCY - 1 frames ago.
+	// Its readback executes before the queries of this frame are, as the RHI commands keep their order
+	GPUTimerFrame = (GPUTimerFrame + 1) % AHR_GPU_TIMER_LATENCY;
+
+	bool bAnyIssued = false;
+	for(int32 Stage = 0;Stage < AHRStage_Num;Stage++)
+		bAnyIssued |= GPUTimerIssued[GPUTimerFrame][Stage];
+
+	if(bAnyIssued)
+	{
+		PendingReadbackFrame = GPUTimerFrame;
+		PendingReadbackNumber++;
+		FAHRGPUTimerReadback* Readback = &GPUTimerReadbacks[GPUTimerFrame];
+		if(RHICmdList.Bypass())
+		{
+			FRHICommandReadAHRGPUTimers Cmd(GPUTimerQueries[GPUTimerFrame], GPUTimerIssued[GPUTimerFrame], Readback, PendingReadbackNumber);
+			Cmd.Execute(RHICmdList);
+		}
+		else
+		{
+			new (RHICmdList.AllocCommand<FRHICommandReadAHRGPUTimers>()) FRHICommandReadAHRGPUTimers(GPUTimerQueries[GPUTimerFrame], GPUTimerIssued[GPUTimerFrame], Readback, PendingReadbackNumber);
+		}
+		FMemory::Memzero(GPUTimerIssued[GPUTimerFrame],sizeof(GPUTimerIssued[GPUTimerFrame]));
+	}
+
+	// The queries are only issued when someone looks at the times, the stat ids of a hidden stat group are none
+	bTimeGPUStages = bBenchmarkCapturing || FThreadStats::IsCollectingData(GET_STATID(STAT_AHRGPUVoxelizeScene));
+
+	SET_FLOAT_STAT(STAT_AHRGPUVoxelizeScene, StageTimes[AHRStage_VoxelizeScene]);
+	SET_FLOAT_STAT(STAT_AHRGPUTraceScene, StageTimes[AHRStage_TraceScene]);
+	SET_FLOAT_STAT(STAT_AHRGPUUpsample, StageTimes[AHRStage_Upsample]);
+	SET_FLOAT_STAT(STAT_AHRGPUComposite, StageTimes[AHRStage_Composite]);
+
+	if(bBenchmarkCapturing)
+		BenchmarkFrames++;
+#endif
+}
+
+void FApproximateHybridRaytracer::BeginBenchmarkCapture()
+{
+	check(IsInRenderingThread());
+
+	bBenchmarkCapturing = true;
+	bTimeGPUStages = true;
+	BenchmarkFrames = 0;
+	FMemory::Memzero(BenchmarkStageTimes,sizeof(BenchmarkStageTimes));
+	FMemory::Memzero(BenchmarkStageSamples,sizeof(BenchmarkStageSamples));
+}
+
+void FApproximateHybridRaytracer::EndBenchmarkCapture(FAHRBenchmarkResult& OutResult)
+{
+	check(IsInRenderingThread());
+
+	bBenchmarkCapturing = false;
+	OutResult.NumFrames = BenchmarkFrames;
+	for(int32 Stage = 0;Stage < AHRStage_Num;Stage++)
+		OutResult.StageTimes[Stage] = BenchmarkStageSamples[Stage] ? float(BenchmarkStageTimes[Stage] / BenchmarkStageSamples[Stage]) : 0.0f;
+	OutResult.VolumesMemory = GetVolumesMemorySize();
+	OutResult.TargetsMemory = GSceneRenderTargets.GetAHRTargetsMemorySize();
+}
+
+bool FApproximateHybridRaytracer::GetStaticDirtyRegion(FIntVector& OutMin, FIntVector& OutMax) const
+{
+	if(bStaticVolumeFullyDirty)
+	{
+		OutMin = FIntVector(0,0,0);
+		OutMax = gridSettings.SliceSize;
+		return true;
+	}
+
+	if(!StaticDirtyBounds.IsValid)
+		return false;
+
+	return GetVoxelRegion(StaticDirtyBounds,AHR_STATIC_BRICK_SIZE,OutMin,OutMax);
+}
+
+bool FApproximateHybridRaytracer::GetVoxelRegion(const FBox& Bounds, int32 SnapSize, FIntVector& OutMin, FIntVector& OutMax) const
+{
+	// Same mapping as the voxelization shaders, the grid goes from Center - Bounds to Center + Bounds
+	const FVector GridMin = gridSettings.Center - gridSettings.Bounds;
+	const FVector VoxelsPerUnit = FVector(gridSettings.SliceSize.X,gridSettings.SliceSize.Y,gridSettings.SliceSize.Z) / (gridSettings.Bounds*2.0f);
+	const FVector LocalMin = (Bounds.Min - GridMin)*VoxelsPerUnit / float(SnapSize);
+	const FVector LocalMax = (Bounds.Max - GridMin)*VoxelsPerUnit / float(SnapSize);
+
+	OutMin.X = FMath::Clamp(FMath::FloorToInt(LocalMin.X)*SnapSize, 0, gridSettings.SliceSize.X);
+	OutMin.Y = FMath::Clamp(FMath::FloorToInt(LocalMin.Y)*SnapSize, 0, gridSettings.SliceSize.Y);
+	OutMin.Z = FMath::Clamp(FMath::FloorToInt(LocalMin.Z)*SnapSize, 0, gridSettings.SliceSize.Z);
+	OutMax.X = FMath::Clamp(FMath::CeilToInt(LocalMax.X)*SnapSize, 0, gridSettings.SliceSize.X);
+	OutMax.Y = FMath::Clamp(FMath::CeilToInt(LocalMax.Y)*SnapSize, 0, gridSettings.SliceSize.Y);
+	OutMax.Z = FMath::Clamp(FMath::CeilToInt(LocalMax.Z)*SnapSize, 0, gridSettings.SliceSize.Z);
+
+	// Empty if the bounds are fully outside the grid
+	return OutMax.X > OutMin.X && OutMax.Y > OutMin.Y && OutMax.Z > OutMin.Z;
+}
+
+FBox FApproximateHybridRaytracer::GetVoxelRegionBounds(const FIntVector& Min, const FIntVector& Max) const
+{
+	const FVector GridMin = gridSettings.Center - gridSettings.Bounds;
+	const FVector UnitsPerVoxel = (gridSettings.Bounds*2.0f) / FVector(gridSettings.SliceSize.X,gridSettings.SliceSize.Y,gridSettings.SliceSize.Z);
+
+	return FBox(GridMin + FVector(Min.X,Min.Y,Min.Z)*UnitsPerVoxel,
+				GridMin + FVector(Max.X,Max.Y,Max.Z)*UnitsPerVoxel);
+}
 /*
 void FApproximateHybridRaytracer::ClearGrids(FRHICommandListImmediate& RHICmdList)
 {
@@ -121,6 +528,8 @@ bool UseApproximateHybridRaytracingRT(ERHIFeatureLevel::Type InFeatureLevel)
 
 void FApproximateHybridRaytracer::InitDynamicRHI()
 {
+	MEMORY_TAG_SCOPE(AHRVoxels);
+
 	// On start, init it to 256
 	gridSettings.SliceSize = FIntVector(256,256,256);
 	gridSettings.Bounds = FVector(1000,1000,1000);
@@ -137,6 +546,23 @@ void FApproximateHybridRaytracer::InitDynamicRHI()
 
 	StaticEmissiveVolume = new FRWBufferByteAddress;
 	StaticEmissiveVolume->Initialize((gridSettings.SliceSize.X/2)*(gridSettings.SliceSize.Y/2)*(gridSettings.SliceSize.Z/2)*4);
+
+	BounceVolume = new FRWBufferByteAddress;
+	BounceVolume->Initialize((gridSettings.SliceSize.X/2)*(gridSettings.SliceSize.Y/2)*(gridSettings.SliceSize.Z/2)*4);
+	bBounceHistoryValid = false;
+
+	OccupancyVolume = new FRWBufferByteAddress;
+	OccupancyVolume->Initialize(GetAHROccupancyVolumeSize(gridSettings.SliceSize),BUF_FastVRAM);
+	UpdateVolumeMemoryStats();
+
+#if STATS
+	// Create the GPU timers. RHICreateRenderQuery returns null if timestamps aren't supported
+	for(auto& FrameQueries : GPUTimerQueries)
+		for(auto& StageQueries : FrameQueries)
+			for(auto& Query : StageQueries)
+				Query = RHICreateRenderQuery(RQT_AbsoluteTime);
+	FMemory::Memzero(GPUTimerIssued,sizeof(GPUTimerIssued));
+#endif
 	/*
 	FRHIResourceCreateInfo CreateInfo;
 	StaticEmissiveVolume = RHICreateTexture3D(gridSettings.SliceSize.X,gridSettings.SliceSize.Y,gridSettings.SliceSize.Z,PF_R8_UINT,1,TexCreate_UAV | TexCreate_ShaderResource,CreateInfo);
@@ -236,17 +662,152 @@ void FApproximateHybridRaytracer::ReleaseDynamicRHI()
 		StaticEmissiveVolume->Release();
 		delete StaticEmissiveVolume;
 	}
+	if(BounceVolume)
+	{
+		BounceVolume->Release();
+		delete BounceVolume;
+	}
+	if(OccupancyVolume)
+	{
+		OccupancyVolume->Release();
+		delete OccupancyVolume;
+	}
+	StaticSceneVolume = DynamicSceneVolume = nullptr;
+	StaticEmissiveVolume = DynamicEmissiveVolume = nullptr;
+	BounceVolume = nullptr;
+	OccupancyVolume = nullptr;
+	UpdateVolumeMemoryStats();
+
+	ShadowAtlas.SafeRelease();
+	ShadowAtlasUAV.SafeRelease();
+	ShadowAtlasResolution = 0;
+
+	for(auto& FrameQueries : GPUTimerQueries)
+		for(auto& StageQueries : FrameQueries)
+			for(auto& Query : StageQueries)
+				Query.SafeRelease();
 }
 
-void FApproximateHybridRaytracer::AppendLight(const AHRLightData& light)
+#if STATS
+// Benchmark captures, driven by the AHR benchmark automation test or by hand.
+// A capture averages the GPU stages from r.AHRBenchmark.Begin to r.AHRBenchmark.End, and is saved along with the settings it ran with
+struct FAHRBenchmarkRow
+{
+	float VoxelSizeScale;
+	float SamplesScale;
+	int32 DiffuseDirections;
+	float ScreenPercentage;
+	FIntPoint BufferSize;
+	FAHRBenchmarkResult Result;
+};
+
+static const TCHAR* GAHRStageNames[AHRStage_Num] = { TEXT("VoxelizeScene"), TEXT("TraceScene"), TEXT("Upsample"), TEXT("Composite") };
+
+static float GetAHRBenchmarkTotalTime(const FAHRBenchmarkResult& Result)
 {
-	if(currentLightIDX < MAX_AHR_LIGHTS)
+	float Total = 0;
+	for(float StageTime : Result.StageTimes)
+		Total += StageTime;
+	return Total;
+}
+
+// The CSV keeps the captures of every run, for regression tracking
+static bool AppendAHRBenchmarkCSV(const FString& Filename, const FAHRBenchmarkRow& Row)
+{
+	FString CSV;
+	if(!FFileHelper::LoadFileToString(CSV, *Filename))
 	{
-		lights[currentLightIDX] = light;
-		currentLightIDX++;
+		CSV = TEXT("Date,Changelist,VoxelSizeScale,SamplesScale,DiffuseDirections,ScreenPercentage,BufferSizeX,BufferSizeY,Frames");
+		for(const TCHAR* StageName : GAHRStageNames)
+			CSV += FString::Printf(TEXT(",%s (ms)"), StageName);
+		CSV += TEXT(",Total (ms),Volumes (MB),Targets (MB)") LINE_TERMINATOR;
 	}
-	else
+
+	CSV += FString::Printf(TEXT("%s,%d,%g,%g,%d,%g,%d,%d,%u"), *FDateTime::Now().ToString(), GEngineVersion.GetChangelist(),
+		Row.VoxelSizeScale, Row.SamplesScale, Row.DiffuseDirections, Row.ScreenPercentage, Row.BufferSize.X, Row.BufferSize.Y, Row.Result.NumFrames);
+	for(float StageTime : Row.Result.StageTimes)
+		CSV += FString::Printf(TEXT(",%.3f"), StageTime);
+	CSV += FString::Printf(TEXT(",%.3f,%.2f,%.2f%s"), GetAHRBenchmarkTotalTime(Row.Result), Row.Result.VolumesMemory / (1024.0f * 1024.0f), Row.Result.TargetsMemory / (1024.0f * 1024.0f), LINE_TERMINATOR);
+
+	return FFileHelper::SaveStringToFile(CSV, *Filename);
+}
+
+// The JSON only holds the captures of the last run
+static bool WriteAHRBenchmarkJSON(const FString& Filename, const FString& ReportName, const TArray<FAHRBenchmarkRow>& Rows)
+{
+	FString JSON = FString::Printf(TEXT("{\n\t\"Report\": \"%s\",\n\t\"Date\": \"%s\",\n\t\"Changelist\": %d,\n\t\"Captures\": [\n"), *ReportName, *FDateTime::Now().ToString(), GEngineVersion.GetChangelist());
+	for(int32 RowIndex = 0;RowIndex < Rows.Num();RowIndex++)
 	{
-		UE_LOG(LogRenderer, Warning, TEXT("Tried to add more lights to the AHR engine that the maximum supported, will be ignored."));
+		const FAHRBenchmarkRow& Row = Rows[RowIndex];
+		JSON += FString::Printf(TEXT("\t\t{ \"VoxelSizeScale\": %g, \"SamplesScale\": %g, \"DiffuseDirections\": %d, \"ScreenPercentage\": %g, \"BufferSize\": [%d, %d], \"Frames\": %u, \"StageTimes\": {"),
+			Row.VoxelSizeScale, Row.SamplesScale, Row.DiffuseDirections, Row.ScreenPercentage, Row.BufferSize.X, Row.BufferSize.Y, Row.Result.NumFrames);
+		for(int32 Stage = 0;Stage < AHRStage_Num;Stage++)
+			JSON += FString::Printf(TEXT("%s \"%s\": %.3f"), Stage ? TEXT(",") : TEXT(""), GAHRStageNames[Stage], Row.Result.StageTimes[Stage]);
+		JSON += FString::Printf(TEXT(" }, \"Total\": %.3f, \"VolumesMB\": %.2f, \"TargetsMB\": %.2f }%s\n"), GetAHRBenchmarkTotalTime(Row.Result),
+			Row.Result.VolumesMemory / (1024.0f * 1024.0f), Row.Result.TargetsMemory / (1024.0f * 1024.0f), RowIndex + 1 < Rows.Num() ? TEXT(",") : TEXT(""));
 	}
+	JSON += TEXT("\t]\n}\n");
+
+	return FFileHelper::SaveStringToFile(JSON, *Filename);
 }
+
+// Captures of this run, by report
+static TMap<FString,TArray<FAHRBenchmarkRow>> GAHRBenchmarkReports;
+
+static void BeginAHRBenchmarkCapture(const TArray<FString>& Args)
+{
+	ENQUEUE_UNIQUE_RENDER_COMMAND(
+		BeginAHRBenchmarkCapture,
+	{
+		AHREngine.BeginBenchmarkCapture();
+	});
+}
+
+static void EndAHRBenchmarkCapture(const TArray<FString>& Args)
+{
+	const FString ReportName = Args.Num() > 0 ? Args[0] : TEXT("AHRBenchmark");
+
+	FAHRBenchmarkRow Row;
+	Row.VoxelSizeScale = CVarAHRVoxelSizeScale.GetValueOnGameThread();
+	Row.SamplesScale = CVarAHRSamplesScale.GetValueOnGameThread();
+	Row.DiffuseDirections = CVarAHRDiffuseDirections.GetValueOnGameThread();
+	static const auto CVarScreenPercentage = IConsoleManager::Get().FindTConsoleVariableDataFloat(TEXT("r.ScreenPercentage"));
+	Row.ScreenPercentage = CVarScreenPercentage->GetValueOnGameThread();
+
+	FAHRBenchmarkRow* RowPtr = &Row;
+	ENQUEUE_UNIQUE_RENDER_COMMAND_ONEPARAMETER(
+		EndAHRBenchmarkCapture,
+		FAHRBenchmarkRow*, OutRow, RowPtr,
+	{
+		AHREngine.EndBenchmarkCapture(OutRow->Result);
+		OutRow->BufferSize = GSceneRenderTargets.GetBufferSizeXY();
+	});
+	FlushRenderingCommands();
+
+	if(Row.Result.NumFrames == 0)
+		UE_LOG(LogRenderer, Warning, TEXT("The AHR benchmark capture for %s has no frames, was r.AHRBenchmark.Begin called and AHR enabled?"), *ReportName);
+
+	TArray<FAHRBenchmarkRow>& Rows = GAHRBenchmarkReports.FindOrAdd(ReportName);
+	Rows.Add(Row);
+
+	const FString BasePath = FPaths::ProfilingDir() / TEXT("AHRBenchmark") / ReportName;
+	if(!AppendAHRBenchmarkCSV(BasePath + TEXT(".csv"), Row) || !WriteAHRBenchmarkJSON(BasePath + TEXT(".json"), ReportName, Rows))
+	{
+		UE_LOG(LogRenderer, Warning, TEXT("Failed to write the AHR benchmark report %s"), *BasePath);
+	}
+}
+
+static FAutoConsoleCommand GAHRBenchmarkBeginCmd(
+	TEXT("r.AHRBenchmark.Begin"),
+	TEXT("Starts averaging the GPU times of the AHR stages, see r.AHRBenchmark.End"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(BeginAHRBenchmarkCapture)
+	);
+
+static FAutoConsoleCommand GAHRBenchmarkEndCmd(
+	TEXT("r.AHRBenchmark.End"),
+	TEXT("Ends the capture started by r.AHRBenchmark.Begin, and adds the averages, memory and AHR settings to a report.\n")
+	TEXT("The parameter is the name of the report (default: AHRBenchmark). Every capture is appended to Saved/Profiling/AHRBenchmark/<Report>.csv,\n")
+	TEXT("and <Report>.json is rewritten with the captures of this run"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(EndAHRBenchmarkCapture)
+	);
+#endif
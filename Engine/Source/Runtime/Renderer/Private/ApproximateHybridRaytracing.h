@@ -4,10 +4,72 @@
 // small macro
 #define _DEBUG_MSG(msg) ::MessageBoxA(nullptr,__FUNCTION__##" "##msg,"DEBUG",MB_ICONWARNING)
 #define MAX_AHR_LIGHTS 5
+// Smallest tile (in texels) a light can get on the shadow atlas
+#define AHR_MIN_SHADOW_TILE 128
+// Size (in voxels) of the cubic bricks used to track the dirty regions of the static volume
+#define AHR_STATIC_BRICK_SIZE 32
+// Size (in voxels) of a cell of the coarse occupancy volume used to skip empty space while tracing. Must match AHRCommon.usf
+#define AHR_OCCUPANCY_CELL_SIZE 8
+// Points marked per dispatch of the splatting of the primitives smaller than a voxel
+#define AHR_SPLAT_BATCH_SIZE 64
+// Number of sweeps of the bounce propagation over a dirty region before it is considered converged
+#define AHR_BOUNCE_SWEEPS 4
+
+// Frames in flight of the GPU timer queries, so reading them back never stalls
+#define AHR_GPU_TIMER_LATENCY 3
+
+DECLARE_STATS_GROUP(TEXT("AHR"), STATGROUP_AHR, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("StartFrame"),STAT_AHRStartFrame,STATGROUP_AHR, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("VoxelizeScene"),STAT_AHRVoxelizeScene,STATGROUP_AHR, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("TraceScene"),STAT_AHRTraceScene,STATGROUP_AHR, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Upsample"),STAT_AHRUpsample,STATGROUP_AHR, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Composite"),STAT_AHRComposite,STATGROUP_AHR, );
+
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("GPU VoxelizeScene (ms)"),STAT_AHRGPUVoxelizeScene,STATGROUP_AHR, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("GPU TraceScene (ms)"),STAT_AHRGPUTraceScene,STATGROUP_AHR, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("GPU Upsample (ms)"),STAT_AHRGPUUpsample,STATGROUP_AHR, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("GPU Composite (ms)"),STAT_AHRGPUComposite,STATGROUP_AHR, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Primitives to voxelize"),STAT_AHRPrimitivesToVoxelize,STATGROUP_AHR, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Voxelized elements"),STAT_AHRVoxelizedElements,STATGROUP_AHR, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Voxelized triangles"),STAT_AHRVoxelizedTriangles,STATGROUP_AHR, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Splatted primitives"),STAT_AHRSplattedPrimitives,STATGROUP_AHR, );
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Scene volumes"),STAT_AHRSceneVolumeMemory,STATGROUP_AHR, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Emissive volumes"),STAT_AHREmissiveVolumeMemory,STATGROUP_AHR, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Occupancy volume"),STAT_AHROccupancyVolumeMemory,STATGROUP_AHR, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Shadow atlas"),STAT_AHRShadowAtlasMemory,STATGROUP_AHR, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Raytracing targets"),STAT_AHRRaytracingTargetMemory,STATGROUP_AHR, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Upsampled targets"),STAT_AHRUpsampledTargetMemory,STATGROUP_AHR, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("History targets"),STAT_AHRHistoryTargetMemory,STATGROUP_AHR, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Kernel targets"),STAT_AHRKernelTargetMemory,STATGROUP_AHR, );
 
 extern TAutoConsoleVariable<int32> CVarApproximateHybridRaytracing;
 extern TAutoConsoleVariable<int32> CVarAHRMaxSliceSize;
 extern TAutoConsoleVariable<int32> CVarAHRTraceReflections;
+extern TAutoConsoleVariable<int32> CVarAHRStaticVolume;
+extern TAutoConsoleVariable<int32> CVarAHRGridFollowsCamera;
+extern TAutoConsoleVariable<int32> CVarAHRTraceCompute;
+extern TAutoConsoleVariable<int32> CVarAHREarlyVoxelization;
+extern TAutoConsoleVariable<int32> CVarAHRTemporalAccumulation;
+extern TAutoConsoleVariable<float> CVarAHRTemporalWeight;
+extern TAutoConsoleVariable<int32> CVarAHRUpsampleInComposite;
+extern TAutoConsoleVariable<int32> CVarAHRDiffuseDirections;
+extern TAutoConsoleVariable<float> CVarAHRSamplesScale;
+extern TAutoConsoleVariable<float> CVarAHRVoxelSizeScale;
+extern TAutoConsoleVariable<int32> CVarAHRShadowAtlasResolution;
+extern TAutoConsoleVariable<int32> CVarAHRParallelVoxelization;
+extern TAutoConsoleVariable<int32> CVarAHRGlobalDistanceField;
+extern TAutoConsoleVariable<int32> CVarAHRTiledReflections;
+extern TAutoConsoleVariable<int32> CVarAHRVoxelizationDetail;
+extern TAutoConsoleVariable<int32> CVarAHRVoxelizationGeometryShader;
+extern TAutoConsoleVariable<int32> CVarAHRMultiBounce;
+extern TAutoConsoleVariable<int32> CVarAHRBounceSlicesPerFrame;
+extern TAutoConsoleVariable<float> CVarAHRBounceIntensity;
+extern TAutoConsoleVariable<float> CVarAHRBounceTemporalWeight;
+
+class FProjectedShadowInfo;
 
 struct AHRLightData
 {
@@ -15,18 +77,23 @@ struct AHRLightData
 	{
 		IsValid = false;
 		ViewProj = FMatrix::Identity;
-		ViewportScaling = FVector2D(1,1);
+		AtlasScaleBias = FVector4(1,1,0,0);
 	}
 	bool IsValid;
 	FMatrix ViewProj;
-	FVector2D ViewportScaling;
+	// Maps the shadow UVs to the tile of the light on the shadow atlas. xy is the scale, zw the bias
+	FVector4 AtlasScaleBias;
 };
 struct AHRGridSettings
 {
+	AHRGridSettings() : ToroidalOffset(0,0,0) {}
+
 	FVector Bounds;
 	FVector Center;
 	float VoxelSize;
 	FIntVector SliceSize;
+	// Offset (in voxels) applied to the volume addressing, wrapped to SliceSize. Non zero only when the grid follows the camera
+	FIntVector ToroidalOffset;
 };
 
 inline int fceil(int a,int b)
@@ -34,6 +101,43 @@ inline int fceil(int a,int b)
 	return (a + b - 1)/b;
 }
 
+// Size in bytes of the coarse occupancy volume, one bit per cell
+inline uint32 GetAHROccupancyVolumeSize(const FIntVector& SliceSize)
+{
+	uint32 Cells = fceil(SliceSize.X,AHR_OCCUPANCY_CELL_SIZE)*fceil(SliceSize.Y,AHR_OCCUPANCY_CELL_SIZE)*fceil(SliceSize.Z,AHR_OCCUPANCY_CELL_SIZE);
+	return fceil(Cells,32)*4;
+}
+
+// Pipeline stages timed on the GPU
+enum EAHRGPUStage
+{
+	AHRStage_VoxelizeScene,
+	AHRStage_TraceScene,
+	AHRStage_Upsample,
+	AHRStage_Composite,
+	AHRStage_Num
+};
+
+// Stage timestamps of a frame, read back where the RHI commands execute so the rendering thread never waits for them
+struct FAHRGPUTimerReadback
+{
+	uint64 Times[AHRStage_Num][2];
+	bool bRead[AHRStage_Num];
+	// Number of the readback the times are for, written by the RHI thread after the times
+	volatile int32 ReadbackNumber;
+};
+
+// Averages of a benchmark capture, see r.AHRBenchmark.Begin
+struct FAHRBenchmarkResult
+{
+	uint32 NumFrames;
+	// Average GPU time of each stage, in ms. Only the frames whose timers were read back are averaged
+	float StageTimes[AHRStage_Num];
+	// Size in bytes of the volumes and of the AHR targets when the capture ended
+	uint32 VolumesMemory;
+	uint32 TargetsMemory;
+};
+
 // Main class
 class FApproximateHybridRaytracer : public FRenderResource
 {
@@ -43,19 +147,45 @@ public:
 	{
 		currentVolume = nullptr;
 		StaticSceneVolume = DynamicSceneVolume = nullptr;
+		StaticEmissiveVolume = DynamicEmissiveVolume = nullptr;
+		OccupancyVolume = nullptr;
+		BounceVolume = nullptr;
 		currentLightIDX = 0;
-		prevShadowRes.X = -1;
-		prevShadowRes.Y = -1;
+		ShadowAtlasResolution = 0;
+		ShadowAtlasCursor = FIntPoint::ZeroValue;
+		ShadowAtlasRowHeight = 0;
 		screenResChanged = false;
+		bStaticVolumeFullyDirty = true;
+		StaticDirtyBounds.Init();
+		bTemporalHistoryValid = false;
+		TemporalFrameIndex = 0;
+		bBounceHistoryValid = false;
+		bBounceFullyDirty = true;
+		BounceDirtyBounds.Init();
+		BounceRegionMin = BounceRegionMax = FIntVector(0,0,0);
+		BounceCursor = 0;
+		BounceSweepsLeft = 0;
+		PrevNumLights = 0;
+		GPUTimerFrame = 0;
+		FMemory::Memzero(GPUTimerIssued,sizeof(GPUTimerIssued));
+		bTimeGPUStages = false;
+		FMemory::Memzero(GPUTimerReadbacks,sizeof(GPUTimerReadbacks));
+		PendingReadbackFrame = INDEX_NONE;
+		PendingReadbackNumber = 0;
+		bBenchmarkCapturing = false;
+		BenchmarkFrames = 0;
+		FMemory::Memzero(BenchmarkStageTimes,sizeof(BenchmarkStageTimes));
+		FMemory::Memzero(BenchmarkStageSamples,sizeof(BenchmarkStageSamples));
 	}
 
 	// Main pipeline functions
 	void StartFrame(FRHICommandListImmediate& RHICmdList,FViewInfo& View);
 	void VoxelizeScene(FRHICommandListImmediate& RHICmdList,FViewInfo& View);
 	void TraceScene(FRHICommandListImmediate& RHICmdList,FViewInfo& View);
-	void Upsample(FRHICommandListImmediate& RHICmdList,FViewInfo& View);
-	void Composite(FRHICommandListImmediate& RHICmdList,FViewInfo& View);
-	void SignalWindowResize(){ screenResChanged = true; }
+	void Upsample(FRHICommandListImmediate& RHICmdList,const TArray<FViewInfo>& Views);
+	// With bReflectionInTiledPass the reflection trace is left to the tiled deferred reflection environment, see r.AHRTiledReflections
+	void Composite(FRHICommandListImmediate& RHICmdList,FViewInfo& View,bool bReflectionInTiledPass);
+	void SignalWindowResize(){ screenResChanged = true; bTemporalHistoryValid = false; }
 
 	// Data functions
 	void UpdateSettings(); // Resizes the grid if needed
@@ -67,17 +197,61 @@ public:
 	FUnorderedAccessViewRHIRef GetSceneVolumeUAV(){ return (*currentVolume)->UAV; }
 	FUnorderedAccessViewRHIRef GetEmissiveVolumeUAV(){ return (*currentEmissiveVolume)->UAV; }
 
-	void AppendLight(const AHRLightData& light);
+	// Static volume invalidation. Static primitives are voxelized once, and only the bricks touched by
+	// an added, removed or moved primitive are cleared and revoxelized
+	void MarkStaticRegionDirty(const FBoxSphereBounds& Bounds){ StaticDirtyBounds += Bounds.GetBox(); BounceDirtyBounds += Bounds.GetBox(); }
+	void InvalidateStaticVolume(){ bStaticVolumeFullyDirty = true; bBounceFullyDirty = true; }
+
+	FShaderResourceViewRHIRef GetOccupancyVolumeSRV(){ return OccupancyVolume->SRV; }
+
+	// Rotation (cos,sin) applied to the tracing kernels around the normal. Changes every frame when the temporal accumulation is on
+	FVector2D GetKernelRotation() const;
+
+	// Copies the shadow depths of the light to a tile of the shadow atlas, sized by the screen contribution of the shadow.
+	// Lights that don't touch the grid should be culled by the caller
+	void AppendLight(FRHICommandListImmediate& RHICmdList, const FProjectedShadowInfo& Shadow, FTexture2DRHIParamRef ShadowDepth);
 	AHRLightData* GetLightsList(){ return lights; }
-	FTexture2DRHIRef GetCurrentShadowTexture(){ return lightDepths[currentLightIDX]; }
-	FTexture2DRHIRef GetShadowTexture(uint32 idx){ return lightDepths[idx]; }
+	uint32 GetNumLights() const { return currentLightIDX; }
+	FTexture2DRHIRef GetShadowAtlas(){ return ShadowAtlas; }
 
 	// FRenderResource code : Mainly, InitDynamicRHI()/ReleaseDynamicRHI(). Also, IsInitialized()
 	void InitDynamicRHI() override final;
 	void ReleaseDynamicRHI() override final;
 
+	// GPU timing of the pipeline stages. The results are read back a few frames later and surfaced on stat AHR
+	void BeginGPUStage(FRHICommandListImmediate& RHICmdList, EAHRGPUStage Stage);
+	void EndGPUStage(FRHICommandListImmediate& RHICmdList, EAHRGPUStage Stage);
+
+	// Benchmark captures. Between the begin and the end the stage times are accumulated instead of only being set on the stats
+	void BeginBenchmarkCapture();
+	void EndBenchmarkCapture(FAHRBenchmarkResult& OutResult);
+
 	FShaderResourceViewRHIRef ObjectNormalSRV;
 private:
+	// Gets the dirty region of the static volume, in voxels and snapped to the brick grid. Returns false if there is nothing to revoxelize
+	bool GetStaticDirtyRegion(FIntVector& OutMin, FIntVector& OutMax) const;
+	// World space box covered by a region of the volume
+	FBox GetVoxelRegionBounds(const FIntVector& Min, const FIntVector& Max) const;
+	// Gets the slabs exposed by scrolling the grid since PrevSettings. Returns false if the volume can't be scrolled and needs a full rebuild
+	bool GetScrolledRegions(const AHRGridSettings& PrevSettings, TArray<FIntVector,TInlineAllocator<6>>& OutRegions) const;
+	// Clears a region (on grid space) of the static volumes
+	void ClearStaticRegion(FRHICommandListImmediate& RHICmdList, FViewInfo& View, const FIntVector& RegionMin, const FIntVector& RegionMax);
+	// Multiple bounces. Propagates a few slices of the dirty region of the bounce volume from the combined emissive volume,
+	// then adds the bounces to the combined emissive volume for the tracing
+	void PropagateBounce(FRHICommandListImmediate& RHICmdList, FViewInfo& View);
+	// Gets the region of the grid covered by a world space box, in voxels and snapped to SnapSize. Returns false if it is outside of the grid
+	bool GetVoxelRegion(const FBox& Bounds, int32 SnapSize, FIntVector& OutMin, FIntVector& OutMax) const;
+	// Marks the voxels of the primitives too small to be rasterized on the active volume. Only touches the binary volume
+	void SplatPrimitives(FRHICommandListImmediate& RHICmdList, FViewInfo& View, const TArray<const FPrimitiveSceneProxy*,SceneRenderingAllocator>& Primitives);
+	// Blends the blurred diffuse traces with the reprojected history
+	void TemporalAccumulation(FRHICommandListImmediate& RHICmdList, const TArray<FViewInfo>& Views);
+	// Reads back the oldest GPU timers that are ready, and moves on to the next frame of the ring
+	void UpdateGPUStats(FRHICommandListImmediate& RHICmdList);
+	// Sets the memory stats of the volumes. Called whenever they are (re)created
+	void UpdateVolumeMemoryStats();
+	// Size in bytes of the scene, emissive and occupancy volumes and the shadow atlas
+	uint32 GetVolumesMemorySize() const;
+
 	bool screenResChanged;
 	FRWBufferByteAddress** currentVolume; // ptr-to-ptr to remember people that this is JUST AN UTILITY! IT IS NOT THE ACTUAL VOLUME!
 	FRWBufferByteAddress** currentEmissiveVolume;
@@ -98,17 +272,112 @@ private:
 	FRWBufferByteAddress* StaticEmissiveVolume;
 	FRWBufferByteAddress* DynamicEmissiveVolume;
 
+	// Coarse level of the combined scene volume. One bit per AHR_OCCUPANCY_CELL_SIZE^3 voxels, rebuilt after every voxelization
+	FRWBufferByteAddress* OccupancyVolume;
+
+	// Bounce lighting, same layout as the emissive volumes. Accumulated over the frames, see r.AHRMultiBounce
+	FRWBufferByteAddress* BounceVolume;
+
 	FTexture2DRHIRef SamplingKernel[6];
 
 	AHRLightData lights[MAX_AHR_LIGHTS];
-	FTexture2DRHIRef lightDepths[MAX_AHR_LIGHTS];
 	uint32 currentLightIDX;
 
+	// Shadow depths of all the injected lights. Tiles are handed out with a shelf allocator, reset with the lights list
+	bool AllocateShadowAtlasTile(int32 TileSize, FIntPoint& OutOrigin);
+	FTexture2DRHIRef ShadowAtlas;
+	FUnorderedAccessViewRHIRef ShadowAtlasUAV;
+	int32 ShadowAtlasResolution;
+	FIntPoint ShadowAtlasCursor;
+	int32 ShadowAtlasRowHeight;
+
 	AHRGridSettings gridSettings;
-	FIntPoint prevShadowRes;
+
+	// Grid settings used the last time the static volume was written. Any change on them invalidates the whole volume
+	AHRGridSettings staticGridSettings;
+	bool bStaticVolumeFullyDirty;
+	FBox StaticDirtyBounds;
+
+	// False if the history targets don't hold the previous frame (first frame, resizes, camera cuts or the accumulation was off)
+	bool bTemporalHistoryValid;
+	uint32 TemporalFrameIndex;
+
+	// Multiple bounces. The geometry and lights that changed are accumulated on BounceDirtyBounds, which is merged into the region
+	// being propagated when a sweep over it ends. The region and the cursor (a slice) are on the half res grid of the bounce volume
+	AHRGridSettings bounceGridSettings;
+	bool bBounceHistoryValid;
+	bool bBounceFullyDirty;
+	FBox BounceDirtyBounds;
+	FIntVector BounceRegionMin;
+	FIntVector BounceRegionMax;
+	int32 BounceCursor;
+	int32 BounceSweepsLeft;
+	// Lights of the last voxelization, a light that changed relights the whole grid
+	FMatrix PrevLightViewProj[MAX_AHR_LIGHTS];
+	uint32 PrevNumLights;
+
+	// Begin/end timestamps of each stage, for each frame in flight. Null if the RHI doesn't support timestamps
+	FRenderQueryRHIRef GPUTimerQueries[AHR_GPU_TIMER_LATENCY][AHRStage_Num][2];
+	bool GPUTimerIssued[AHR_GPU_TIMER_LATENCY][AHRStage_Num];
+	uint32 GPUTimerFrame;
+	// Whether the stages are timed this frame, only while stat AHR is shown or a benchmark capture runs
+	bool bTimeGPUStages;
+
+	// Stage times of each frame of the ring, read back on the RHI thread
+	FAHRGPUTimerReadback GPUTimerReadbacks[AHR_GPU_TIMER_LATENCY];
+	// Readback enqueued last frame, published by UpdateGPUStats if the RHI thread got to it. INDEX_NONE if none
+	int32 PendingReadbackFrame;
+	int32 PendingReadbackNumber;
+
+	// Sums and sample counts of the stage times of the benchmark capture in progress
+	bool bBenchmarkCapturing;
+	uint32 BenchmarkFrames;
+	double BenchmarkStageTimes[AHRStage_Num];
+	uint32 BenchmarkStageSamples[AHRStage_Num];
 };
 
 extern TGlobalResource<FApproximateHybridRaytracer> AHREngine;
 
 // use for render thread only
-bool UseApproximateHybridRaytracingRT(ERHIFeatureLevel::Type InFeatureLevel);
\ No newline at end of file
+bool UseApproximateHybridRaytracingRT(ERHIFeatureLevel::Type InFeatureLevel);
+
+BEGIN_UNIFORM_BUFFER_STRUCT(AHRCompositeCB,)
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(float,GIMultiplier)
+	// x is 1 if the composite has to filter the diffuse traces itself, y is the EAHRCompositeMode. zw is the pixel size of the traces
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER(FVector4,UpsampleData)
+END_UNIFORM_BUFFER_STRUCT(AHRCompositeCB)
+
+// What GetAHRComposite (AHRCompositeCommon.usf) returns. Must match AHRCompositeCommon.usf
+enum EAHRCompositeMode
+{
+	AHRComposite_All,
+	// The GI only, weighted for the reflection blended by another pass
+	AHRComposite_GI,
+	// The reflection only
+	AHRComposite_Reflection,
+};
+
+// Parameters of GetAHRComposite, shared by the AHR composite and the tiled reflection environment
+// The traces that were already released are bound as black
+class FAHRCompositeParameters
+{
+public:
+	void Bind(const FShaderParameterMap& ParameterMap);
+
+	bool IsBound() const
+	{
+		return cb.IsBound();
+	}
+
+	template<typename ShaderRHIParamRef>
+	void Set(FRHICommandList& RHICmdList, const ShaderRHIParamRef ShaderRHI, const FSceneView& View, EAHRCompositeMode Mode) const;
+
+	friend FArchive& operator<<(FArchive& Ar, FAHRCompositeParameters& Parameters);
+
+private:
+	FShaderResourceParameter LinearSampler;
+	FShaderResourceParameter ObjNormal;
+	FShaderResourceParameter Trace[6];
+	FShaderResourceParameter Kernel[5];
+	TShaderUniformBufferParameter<AHRCompositeCB> cb;
+};
@@ -125,9 +125,13 @@ struct FTransientDecalRenderData
 	const FMaterial* MaterialResource;
 	const FDeferredDecalProxy* DecalProxy;
 	bool bHasNormal;
+	FMatrix ComponentToWorldMatrix;
+	float ConservativeRadius;
 
-	FTransientDecalRenderData(const FScene& InScene, FDeferredDecalProxy* InDecalProxy)
+	FTransientDecalRenderData(const FScene& InScene, FDeferredDecalProxy* InDecalProxy, const FMatrix& InComponentToWorldMatrix, float InConservativeRadius)
 		: DecalProxy(InDecalProxy)
+		, ComponentToWorldMatrix(InComponentToWorldMatrix)
+		, ConservativeRadius(InConservativeRadius)
 	{
 		MaterialProxy = InDecalProxy->DecalMaterial->GetRenderProxy(InDecalProxy->bOwnerSelected);
 		MaterialResource = MaterialProxy->GetMaterial(InScene.GetFeatureLevel());
@@ -626,14 +630,18 @@ private:
 static TGlobalResource<FUnitCubeVertexBuffer> GUnitCubeVertexBuffer;
 static TGlobalResource<FUnitCubeIndexBuffer> GUnitCubeIndexBuffer;
 
-void SetShader(const FRenderingCompositePassContext& Context, const FTransientDecalRenderData& DecalData, FShader* VertexShader)
+// @param bShaderStateChanged false if the previous decal used the same shaders, only the parameters are set then
+void SetShader(const FRenderingCompositePassContext& Context, bool bShaderStateChanged, const FTransientDecalRenderData& DecalData, FShader* VertexShader)
 {
 	const FSceneView& View = Context.View;
 	
 	const FMaterialShaderMap* MaterialShaderMap = DecalData.MaterialResource->GetRenderingThreadShaderMap();
 	FDeferredDecalPS* PixelShader = MaterialShaderMap->GetShader<FDeferredDecalPS>();
 
-	Context.RHICmdList.SetLocalBoundShaderState(Context.RHICmdList.BuildLocalBoundShaderState(GetVertexDeclarationFVector3(), VertexShader->GetVertexShader(), FHullShaderRHIRef(), FDomainShaderRHIRef(), PixelShader->GetPixelShader(), FGeometryShaderRHIRef()));
+	if (bShaderStateChanged)
+	{
+		Context.RHICmdList.SetLocalBoundShaderState(Context.RHICmdList.BuildLocalBoundShaderState(GetVertexDeclarationFVector3(), VertexShader->GetVertexShader(), FHullShaderRHIRef(), FDomainShaderRHIRef(), PixelShader->GetPixelShader(), FGeometryShaderRHIRef()));
+	}
 
 	PixelShader->SetParameters(Context.RHICmdList, View, DecalData.MaterialProxy, *DecalData.DecalProxy);
 }
@@ -808,7 +816,7 @@ void FRCPassPostProcessDeferredDecals::Process(FRenderingCompositePassContext& C
 
 		if (bIsShown)
 		{
-			FTransientDecalRenderData Data(Scene, DecalProxy);
+			FTransientDecalRenderData Data(Scene, DecalProxy, ComponentToWorldMatrix, ConservativeRadius);
 
 			uint32 DecalRenderStage = ComputeRenderStage(Data.DecalBlendMode);
 
@@ -853,6 +861,11 @@ void FRCPassPostProcessDeferredDecals::Process(FRenderingCompositePassContext& C
 				{
 					return B.bHasNormal < A.bHasNormal;
 				}
+				// Batch decals with the same shaders together, material instances of the same parent share them
+				if (B.MaterialResource != A.MaterialResource)
+				{
+					return B.MaterialResource < A.MaterialResource;
+				}
 				// Batch decals with the same material together
 				if (B.MaterialProxy != A.MaterialProxy )
 				{
@@ -870,6 +883,7 @@ void FRCPassPostProcessDeferredDecals::Process(FRenderingCompositePassContext& C
 		int32 LastDecalHasNormal = -1; // Decal state can change based on its normal property.(SM5)
 		ERenderTargetMode LastRenderTargetMode = RTM_Unknown;
 		int32 WasInsideDecal = -1;
+		const FMaterialShaderMap* LastMaterialShaderMap = NULL;
 		const ERHIFeatureLevel::Type SMFeatureLevel = Context.GetFeatureLevel();
 
 		SCOPED_DRAW_EVENT(RHICmdList, Decals);
@@ -880,8 +894,8 @@ void FRCPassPostProcessDeferredDecals::Process(FRenderingCompositePassContext& C
 		for (int32 DecalIndex = 0; DecalIndex < SortedDecals.Num(); DecalIndex++)
 		{
 			const FTransientDecalRenderData& DecalData = SortedDecals[DecalIndex];
-			const FDeferredDecalProxy& DecalProxy = *DecalData.DecalProxy;
-			const FMatrix ComponentToWorldMatrix = DecalProxy.ComponentTrans.ToMatrixWithScale();
+			const FMatrix& ComponentToWorldMatrix = DecalData.ComponentToWorldMatrix;
+			const float ConservativeRadius = DecalData.ConservativeRadius;
 
 			// Set vertex shader params
 			const FMaterialShaderMap* MaterialShaderMap = DecalData.MaterialResource->GetRenderingThreadShaderMap();
@@ -899,15 +913,10 @@ void FRCPassPostProcessDeferredDecals::Process(FRenderingCompositePassContext& C
 					bThisDecalUsesStencil = RenderPreStencil(Context, MaterialShaderMap, ComponentToWorldMatrix, FrustumComponentToClip);
 					WasInsideDecal = -1;
 					LastDecalBlendMode = -1;
+					LastMaterialShaderMap = NULL;
 				}
 			}
 
-			// can be optimized as we test against a sphere around the box instead of the box itself
-			const float ConservativeRadius = FMath::Sqrt(
-				ComponentToWorldMatrix.GetScaledAxis( EAxis::X ).SizeSquared() * FMath::Square(GDefaultDecalSize.X) +
-				ComponentToWorldMatrix.GetScaledAxis( EAxis::Y ).SizeSquared() * FMath::Square(GDefaultDecalSize.Y) +
-				ComponentToWorldMatrix.GetScaledAxis( EAxis::Z ).SizeSquared() * FMath::Square(GDefaultDecalSize.Z));
-
 			EDecalBlendMode DecalBlendMode = DecalData.DecalBlendMode;
 
 			ERenderTargetMode CurrentRenderTargetMode = ComputeRenderTargetMode(DecalBlendMode);
@@ -971,16 +980,20 @@ void FRCPassPostProcessDeferredDecals::Process(FRenderingCompositePassContext& C
 			}
 
 			{
+				// Decals are sorted by material within a blend mode, so consecutive decals mostly share their shaders
 				FDeferredDecalVS* VertexShader = MaterialShaderMap->GetShader<FDeferredDecalVS>();
-				SetShader(Context, DecalData, VertexShader);
+				SetShader(Context, MaterialShaderMap != LastMaterialShaderMap, DecalData, VertexShader);
+				LastMaterialShaderMap = MaterialShaderMap;
 
 				VertexShader->SetParameters(RHICmdList, View, FrustumComponentToClip);
 
-				const int32 IsInsideDecal = ((FVector)View.ViewMatrices.ViewOrigin - ComponentToWorldMatrix.GetOrigin()).SizeSquared() < FMath::Square(ConservativeRadius * 1.05f + View.NearClippingDistance * 2.0f) + ( bThisDecalUsesStencil ) ? 2 : 0;
+				// bit 0: camera inside the decal bounds, bit 1: decal uses the pre stencil mask
+				const bool bInsideDecal = ((FVector)View.ViewMatrices.ViewOrigin - ComponentToWorldMatrix.GetOrigin()).SizeSquared() < FMath::Square(ConservativeRadius * 1.05f + View.NearClippingDistance * 2.0f);
+				const int32 IsInsideDecal = (bInsideDecal ? 1 : 0) + (bThisDecalUsesStencil ? 2 : 0);
 				if ( WasInsideDecal != IsInsideDecal )
 				{
 					WasInsideDecal = IsInsideDecal;
-					if ( !(IsInsideDecal & 1) )
+					if ( IsInsideDecal & 1 )
 					{
 						// Render backfaces with depth tests disabled since the camera is inside (or close to inside) the light function geometry
 						RHICmdList.SetRasterizerState(View.bReverseCulling ? TStaticRasterizerState<FM_Solid, CM_CCW>::GetRHI() : TStaticRasterizerState<FM_Solid, CM_CW>::GetRHI());
@@ -1046,8 +1059,6 @@ void FRCPassPostProcessDeferredDecals::Process(FRenderingCompositePassContext& C
 					}
 				}
 
-				SetShader(Context, DecalData, VertexShader);
-
 				RHICmdList.DrawIndexedPrimitive(GUnitCubeIndexBuffer.IndexBufferRHI, PT_TriangleList, 0, 0, 8, 0, GUnitCubeIndexBuffer.GetIndexCount() / 3, 0);
 			}
 		}
@@ -647,21 +647,7 @@ void FDeferredShadingSceneRenderer::Render(FRHICommandListImmediate& RHICmdList)
 	// @RyanTorant
 	// Store all the primitives that need to be voxelized
 	if(UseApproximateHybridRaytracingRT(FeatureLevel))
-	{
-		for(auto primitive : Scene->Primitives)
-		{
-			FPrimitiveViewRelevance ViewRelevance = primitive->Proxy->GetViewRelevance(&Views[0]);
-
-			// Check that the object is inside the grid
-			FBox vgridBox;
-			vgridBox.BuildAABB(Views[0].FinalPostProcessSettings.AHR_internal_SceneOrigins,Views[0].FinalPostProcessSettings.AHR_internal_SceneBounds);
-
-			if( ViewRelevance.bNeedsVoxelization && 
-				ViewRelevance.bRenderInMainPass && 
-				!ViewRelevance.bEditorPrimitiveRelevance && 
-				FBoxSphereBounds::BoxesIntersect(primitive->Proxy->GetBounds(),FBoxSphereBounds(vgridBox))) Views[0].PrimitivesToVoxelize.Add(primitive);
-		}
-	}
+		GatherPrimitivesToVoxelize();
 
 	// Find the visible primitives.
 	InitViews(RHICmdList);
@@ -673,10 +659,15 @@ void FDeferredShadingSceneRenderer::Render(FRHICommandListImmediate& RHICmdList)
 		FRHICommandListExecutor::GetImmediateCommandList().ImmediateFlush(EImmediateFlushType::FlushRHIThreadFlushResources);
 	}
 
-	if (ShouldPrepareForDistanceFieldAO() || ShouldPrepareForDistanceFieldShadows())
+	if (ShouldPrepareForDistanceFieldAO() || ShouldPrepareForDistanceFieldShadows() || ShouldPrepareGlobalDistanceField())
 	{
 		GDistanceFieldVolumeTextureAtlas.UpdateAllocations();
 		UpdateGlobalDistanceFieldObjectBuffers(RHICmdList);
+
+		if (ShouldPrepareGlobalDistanceField())
+		{
+			UpdateGlobalDistanceFieldVolume(RHICmdList);
+		}
 	}
 
 	const bool bIsWireframe = ViewFamily.EngineShowFlags.Wireframe;
@@ -747,6 +738,13 @@ void FDeferredShadingSceneRenderer::Render(FRHICommandListImmediate& RHICmdList)
 		Scene->FXSystem->PreRender(RHICmdList);
 	}
 
+	// @RyanTorant
+	// The voxelization only needs the elements gathered on InitViews and the committed dynamic buffers, not the GBuffer,
+	// so it can be issued ahead of the depth prepass and the base pass
+	const bool bAHREarlyVoxelization = UseApproximateHybridRaytracingRT(FeatureLevel) && CVarAHREarlyVoxelization.GetValueOnRenderThread() != 0;
+	if(bAHREarlyVoxelization)
+		AHREngine.VoxelizeScene(RHICmdList,Views[0]);
+
 	GRenderTargetPool.AddPhaseEvent(TEXT("EarlyZPass"));
 
 	// Draw the scene pre-pass / early z pass, populating the scene depth buffer and HiZ
@@ -879,7 +877,7 @@ void FDeferredShadingSceneRenderer::Render(FRHICommandListImmediate& RHICmdList)
 
 	// After this point we have the PrimitivesToVoxelize array filled, so we can start voxelization
 	// Trying to delay this as much as possible, to be sure that all the objects are properly set up
-	if(UseApproximateHybridRaytracingRT(FeatureLevel))
+	if(UseApproximateHybridRaytracingRT(FeatureLevel) && !bAHREarlyVoxelization)
 		AHREngine.VoxelizeScene(RHICmdList,Views[0]);
 
 	// Render lighting.
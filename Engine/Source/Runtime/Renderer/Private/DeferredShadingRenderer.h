@@ -135,6 +135,21 @@ private:
 	/** Updates the preshadow cache, allocating new preshadows that can fit and evicting old ones. */
 	void UpdatePreshadowCache();
 
+	/**
+	 * Places a whole scene shadow in its light's cached depth target if its casters are all static.
+	 * @return true if the shadow uses the cache, its depths are then up to date if bDepthsCached is set
+	 */
+	bool AllocateCachedWholeSceneShadow(FProjectedShadowInfo* ProjectedShadowInfo);
+
+	/**
+	 * Places a distant directional light cascade in its cached depth target, reusing the depths of a previous frame when they are recent enough.
+	 * @return true if the cascade uses the cache, its depths are then reused if bDepthsCached is set
+	 */
+	bool AllocateCachedShadowCascade(FProjectedShadowInfo* ProjectedShadowInfo);
+
+	/** Releases the cached shadow depths that haven't been used for a while. */
+	void ReleaseUnusedCachedShadows();
+
 	/** Finds a matching cached preshadow, if one exists. */
 	TRefCountPtr<FProjectedShadowInfo> GetCachedPreshadow(
 		const FLightPrimitiveInteraction* InParentInteraction,
@@ -166,6 +181,9 @@ private:
 	void InitViews(FRHICommandListImmediate& RHICmdList);
 
 	// @RyanTorant
+	/** Finds the primitives inside the AHR grid that need to be voxelized, and their static elements. Runs on task threads **/
+	void GatherPrimitivesToVoxelize();
+
 	/** Gets the elements from each primitive that needs to be voxelized **/
 	void GetElementsToVoxelize(FRHICommandListImmediate& RHICmdList);
 
@@ -280,6 +298,12 @@ private:
 	/** Caches the depths of any preshadows that should be cached, and renders their projections. */
 	bool RenderCachedPreshadows(FRHICommandListImmediate& RHICmdList, const FLightSceneInfo* LightSceneInfo);
 
+	/** Renders the depths of cached whole scene shadows that are out of date, and renders their projections. */
+	bool RenderCachedWholeSceneShadows(FRHICommandListImmediate& RHICmdList, const FLightSceneInfo* LightSceneInfo, const TArray<FProjectedShadowInfo*, SceneRenderingAllocator>& Shadows, bool& bInjectedTranslucentVolume);
+
+	/** Whether the light's shadow depths should be copied to the AHR shadow atlas. */
+	bool ShouldInjectLightIntoAHR(const FLightSceneInfo* LightSceneInfo) const;
+
 	/**
 	  * Used by RenderLights to render a light function to the attenuation buffer.
 	  *
@@ -340,6 +364,9 @@ private:
 	void RenderStandardDeferredImageBasedReflections(FRHICommandListImmediate& RHICmdList, bool bReflectionEnv, const TRefCountPtr<IPooledRenderTarget>& DynamicBentNormalAO);
 
 	bool ShouldDoReflectionEnvironment() const;
+
+	/** Whether RenderDeferredReflections will use RenderTiledDeferredImageBasedReflections. */
+	bool ShouldDoTiledDeferredReflections() const;
 	
 	bool ShouldRenderDynamicSkyLight() const;
 
@@ -349,5 +376,11 @@ private:
 
 	void UpdateGlobalDistanceFieldObjectBuffers(FRHICommandListImmediate& RHICmdList);
 
+	/** Whether the global distance field clipmaps should be updated for features that use them, see GlobalDistanceField.cpp. */
+	bool ShouldPrepareGlobalDistanceField() const;
+
+	/** Composites the regions of the global distance field clipmaps that scrolled in or where the scene changed. */
+	void UpdateGlobalDistanceFieldVolume(FRHICommandListImmediate& RHICmdList);
+
 	friend class FTranslucentPrimSet;
 };
@@ -17,6 +17,7 @@ static const int32 GMaxNumObjectsPerTile = 512;
 extern uint32 UpdateObjectsGroupSize;
 
 extern FIntPoint GetBufferSizeForAO();
+extern bool DoesPlatformSupportDistanceFieldAO(EShaderPlatform Platform);
 
 class FDistanceFieldObjectBuffers
 {
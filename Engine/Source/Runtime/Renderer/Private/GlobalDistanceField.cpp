@@ -0,0 +1,467 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	GlobalDistanceField.cpp
+=============================================================================*/
+
+#include "RendererPrivate.h"
+#include "ScenePrivate.h"
+#include "UniformBuffer.h"
+#include "ShaderParameters.h"
+#include "DistanceFieldLightingShared.h"
+#include "GlobalDistanceField.h"
+#include "RHICommandList.h"
+#include "SceneUtils.h"
+#include "DistanceFieldAtlas.h"
+
+int32 GGlobalDistanceField = 1;
+FAutoConsoleVariableRef CVarGlobalDistanceField(
+	TEXT("r.GlobalDistanceField"),
+	GGlobalDistanceField,
+	TEXT("Whether the global distance field is allowed. It is composited from the mesh distance fields into camera centered clipmaps,\n")
+	TEXT("and only built when a feature uses it, see r.AHRGlobalDistanceField."),
+	ECVF_RenderThreadSafe
+	);
+
+int32 GGlobalDistanceFieldNumClipmaps = GMaxGlobalDistanceFieldClipmaps;
+FAutoConsoleVariableRef CVarGlobalDistanceFieldNumClipmaps(
+	TEXT("r.GlobalDistanceField.NumClipmaps"),
+	GGlobalDistanceFieldNumClipmaps,
+	TEXT("Number of clipmaps of the global distance field, each one twice as large as the previous one."),
+	ECVF_RenderThreadSafe
+	);
+
+float GGlobalDistanceFieldClipmapExtent = 2500.0f;
+FAutoConsoleVariableRef CVarGlobalDistanceFieldClipmapExtent(
+	TEXT("r.GlobalDistanceField.ClipmapExtent"),
+	GGlobalDistanceFieldClipmapExtent,
+	TEXT("World space half size of the finest clipmap of the global distance field."),
+	ECVF_RenderThreadSafe
+	);
+
+int32 GGlobalDistanceFieldFullUpdate = 0;
+FAutoConsoleVariableRef CVarGlobalDistanceFieldFullUpdate(
+	TEXT("r.GlobalDistanceField.FullUpdate"),
+	GGlobalDistanceFieldFullUpdate,
+	TEXT("Debugging option, composites the whole global distance field every frame instead of only the scrolled and modified regions."),
+	ECVF_Cheat | ECVF_RenderThreadSafe
+	);
+
+/** Distance, in texels of a clipmap, the clipmap distances are clamped to. Objects further away from a texel don't need to be composited into it. */
+static const float GGlobalDistanceFieldMaxDistanceInTexels = 8.0f;
+/** The clipmaps scroll in steps of that many texels, so they are scrolled every few frames instead of every frame. Also the size of the composite thread groups. */
+static const int32 GGlobalDistanceFieldScrollGranularity = 4;
+/** Past that many modified regions on a clipmap, they are composited as a single region covering all of them. */
+static const int32 GMaxGlobalDistanceFieldModifiedRegions = 8;
+
+bool SupportsGlobalDistanceField(ERHIFeatureLevel::Type FeatureLevel, EShaderPlatform ShaderPlatform)
+{
+	return GGlobalDistanceField
+		&& FeatureLevel >= ERHIFeatureLevel::SM5
+		&& DoesPlatformSupportDistanceFieldAO(ShaderPlatform);
+}
+
+bool FDeferredShadingSceneRenderer::ShouldPrepareGlobalDistanceField() const
+{
+	return SupportsGlobalDistanceField(Scene->GetFeatureLevel(), Scene->GetShaderPlatform())
+		&& UseApproximateHybridRaytracingRT(FeatureLevel)
+		&& CVarAHRGlobalDistanceField.GetValueOnRenderThread() != 0;
+}
+
+class FGlobalDistanceFieldCulledObjectIndicesResource : public FRenderResource
+{
+public:
+
+	FCPUUpdatedBuffer CulledObjectIndices;
+
+	FGlobalDistanceFieldCulledObjectIndicesResource()
+	{
+		CulledObjectIndices.Format = PF_R32_UINT;
+		CulledObjectIndices.Stride = 1;
+	}
+
+	virtual void InitDynamicRHI()  override
+	{
+		CulledObjectIndices.Initialize();
+	}
+
+	virtual void ReleaseDynamicRHI() override
+	{
+		CulledObjectIndices.Release();
+	}
+};
+
+TGlobalResource<FGlobalDistanceFieldCulledObjectIndicesResource> GGlobalDistanceFieldCulledObjectIndices;
+
+class FCompositeObjectDistanceFieldsCS : public FGlobalShader
+{
+	DECLARE_SHADER_TYPE(FCompositeObjectDistanceFieldsCS,Global)
+public:
+
+	static bool ShouldCache(EShaderPlatform Platform)
+	{
+		return IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5) && DoesPlatformSupportDistanceFieldAO(Platform);
+	}
+
+	static void ModifyCompilationEnvironment(EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Platform,OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("COMPOSITE_THREADGROUP_SIZE"), GGlobalDistanceFieldScrollGranularity);
+		OutEnvironment.SetDefine(TEXT("GLOBAL_DF_RESOLUTION"), GGlobalDistanceFieldResolution);
+	}
+
+	FCompositeObjectDistanceFieldsCS(const ShaderMetaType::CompiledShaderInitializerType& Initializer)
+		: FGlobalShader(Initializer)
+	{
+		ObjectBufferParameters.Bind(Initializer.ParameterMap);
+		DistanceFieldTexture.Bind(Initializer.ParameterMap, TEXT("DistanceFieldTexture"));
+		DistanceFieldSampler.Bind(Initializer.ParameterMap, TEXT("DistanceFieldSampler"));
+		RWGlobalDistanceFieldTexture.Bind(Initializer.ParameterMap, TEXT("RWGlobalDistanceFieldTexture"));
+		CulledObjectIndices.Bind(Initializer.ParameterMap, TEXT("CulledObjectIndices"));
+		CulledObjectIndexOffset.Bind(Initializer.ParameterMap, TEXT("CulledObjectIndexOffset"));
+		NumCulledObjects.Bind(Initializer.ParameterMap, TEXT("NumCulledObjects"));
+		UpdateRegionMin.Bind(Initializer.ParameterMap, TEXT("UpdateRegionMin"));
+		UpdateRegionSize.Bind(Initializer.ParameterMap, TEXT("UpdateRegionSize"));
+		ClipmapVoxelSize.Bind(Initializer.ParameterMap, TEXT("ClipmapVoxelSize"));
+		ClipmapMaxDistance.Bind(Initializer.ParameterMap, TEXT("ClipmapMaxDistance"));
+	}
+
+	FCompositeObjectDistanceFieldsCS()
+	{
+	}
+
+	void SetParameters(
+		FRHICommandList& RHICmdList,
+		const FScene* Scene,
+		const FGlobalDistanceFieldClipmap& Clipmap,
+		FUnorderedAccessViewRHIParamRef ClipmapUAV,
+		const FIntVector& RegionMin,
+		const FIntVector& RegionSize,
+		int32 ObjectIndexOffset,
+		int32 NumObjects)
+	{
+		FComputeShaderRHIParamRef ShaderRHI = GetComputeShader();
+
+		ObjectBufferParameters.Set(RHICmdList, ShaderRHI, *(Scene->DistanceFieldSceneData.ObjectBuffers), Scene->DistanceFieldSceneData.NumObjectsInBuffer);
+
+		SetTextureParameter(
+			RHICmdList,
+			ShaderRHI,
+			DistanceFieldTexture,
+			DistanceFieldSampler,
+			TStaticSamplerState<SF_Bilinear,AM_Clamp,AM_Clamp,AM_Clamp>::GetRHI(),
+			GDistanceFieldVolumeTextureAtlas.VolumeTextureRHI
+			);
+
+		RWGlobalDistanceFieldTexture.SetTexture(RHICmdList, ShaderRHI, NULL, ClipmapUAV);
+		SetSRVParameter(RHICmdList, ShaderRHI, CulledObjectIndices, GGlobalDistanceFieldCulledObjectIndices.CulledObjectIndices.BufferSRV);
+		SetShaderValue(RHICmdList, ShaderRHI, CulledObjectIndexOffset, ObjectIndexOffset);
+		SetShaderValue(RHICmdList, ShaderRHI, NumCulledObjects, NumObjects);
+		SetShaderValue(RHICmdList, ShaderRHI, UpdateRegionMin, RegionMin);
+		SetShaderValue(RHICmdList, ShaderRHI, UpdateRegionSize, RegionSize);
+		SetShaderValue(RHICmdList, ShaderRHI, ClipmapVoxelSize, Clipmap.VoxelSize);
+		SetShaderValue(RHICmdList, ShaderRHI, ClipmapMaxDistance, Clipmap.MaxDistance);
+	}
+
+	void UnsetParameters(FRHICommandList& RHICmdList)
+	{
+		RWGlobalDistanceFieldTexture.UnsetUAV(RHICmdList, GetComputeShader());
+	}
+
+	virtual bool Serialize(FArchive& Ar)
+	{
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize(Ar);
+		Ar << ObjectBufferParameters;
+		Ar << DistanceFieldTexture;
+		Ar << DistanceFieldSampler;
+		Ar << RWGlobalDistanceFieldTexture;
+		Ar << CulledObjectIndices;
+		Ar << CulledObjectIndexOffset;
+		Ar << NumCulledObjects;
+		Ar << UpdateRegionMin;
+		Ar << UpdateRegionSize;
+		Ar << ClipmapVoxelSize;
+		Ar << ClipmapMaxDistance;
+		return bShaderHasOutdatedParameters;
+	}
+
+private:
+
+	FDistanceFieldObjectBufferParameters ObjectBufferParameters;
+	FShaderResourceParameter DistanceFieldTexture;
+	FShaderResourceParameter DistanceFieldSampler;
+	FRWShaderParameter RWGlobalDistanceFieldTexture;
+	FShaderResourceParameter CulledObjectIndices;
+	FShaderParameter CulledObjectIndexOffset;
+	FShaderParameter NumCulledObjects;
+	FShaderParameter UpdateRegionMin;
+	FShaderParameter UpdateRegionSize;
+	FShaderParameter ClipmapVoxelSize;
+	FShaderParameter ClipmapMaxDistance;
+};
+
+IMPLEMENT_SHADER_TYPE(,FCompositeObjectDistanceFieldsCS,TEXT("GlobalDistanceField"),TEXT("CompositeObjectDistanceFieldsCS"),SF_Compute);
+
+/** A region of a clipmap to composite, in texels of the world space lattice of the clipmap. */
+class FGlobalDistanceFieldUpdateRegion
+{
+public:
+
+	FIntVector Min;
+	FIntVector Max;
+	FViewInfo* View;
+	int32 ClipmapIndex;
+	FUnorderedAccessViewRHIParamRef ClipmapUAV;
+	int32 ObjectIndexOffset;
+	int32 NumObjects;
+};
+
+/** World space box of a region of the lattice of a clipmap. */
+static FBox GetLatticeRegionBounds(const FIntVector& Min, const FIntVector& Max, float VoxelSize)
+{
+	return FBox(FVector(Min.X, Min.Y, Min.Z) * VoxelSize, FVector(Max.X, Max.Y, Max.Z) * VoxelSize);
+}
+
+/** Texels of the lattice of a clipmap covered by a world space box, clipped to the clipmap. Returns false if the box doesn't touch the clipmap. */
+static bool GetBoundsLatticeRegion(const FBox& Bounds, float VoxelSize, const FIntVector& ClipmapMin, const FIntVector& ClipmapMax, FIntVector& OutMin, FIntVector& OutMax)
+{
+	OutMin.X = FMath::Max(FMath::FloorToInt(Bounds.Min.X / VoxelSize), ClipmapMin.X);
+	OutMin.Y = FMath::Max(FMath::FloorToInt(Bounds.Min.Y / VoxelSize), ClipmapMin.Y);
+	OutMin.Z = FMath::Max(FMath::FloorToInt(Bounds.Min.Z / VoxelSize), ClipmapMin.Z);
+	OutMax.X = FMath::Min(FMath::CeilToInt(Bounds.Max.X / VoxelSize), ClipmapMax.X);
+	OutMax.Y = FMath::Min(FMath::CeilToInt(Bounds.Max.Y / VoxelSize), ClipmapMax.Y);
+	OutMax.Z = FMath::Min(FMath::CeilToInt(Bounds.Max.Z / VoxelSize), ClipmapMax.Z);
+
+	return OutMin.X < OutMax.X && OutMin.Y < OutMax.Y && OutMin.Z < OutMax.Z;
+}
+
+void FDeferredShadingSceneRenderer::UpdateGlobalDistanceFieldVolume(FRHICommandListImmediate& RHICmdList)
+{
+	FDistanceFieldSceneData& DistanceFieldSceneData = Scene->DistanceFieldSceneData;
+
+	if (!GDistanceFieldVolumeTextureAtlas.VolumeTextureRHI || !DistanceFieldSceneData.ObjectBuffers)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UpdateGlobalDistanceField);
+	SCOPED_DRAW_EVENT(RHICmdList, UpdateGlobalDistanceField);
+
+	const int32 NumClipmaps = FMath::Clamp(GGlobalDistanceFieldNumClipmaps, 1, GMaxGlobalDistanceFieldClipmaps);
+	const uint32 ModifiedBoundsEnd = DistanceFieldSceneData.PrimitiveModifiedBoundsBase + DistanceFieldSceneData.PrimitiveModifiedBounds.Num();
+	TArray<FGlobalDistanceFieldUpdateRegion, SceneRenderingAllocator> UpdateRegions;
+
+	for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
+	{
+		FViewInfo& View = Views[ViewIndex];
+		FSceneViewState* ViewState = (FSceneViewState*)View.State;
+
+		// The clipmaps are only updated incrementally, so they need to persist
+		if (!ViewState)
+		{
+			continue;
+		}
+
+		// A view state that missed some of the modifications, because they were trimmed from the log, has to composite everything again
+		const bool bModificationsMissed = ViewState->GlobalDistanceFieldModifiedBoundsSequence < DistanceFieldSceneData.PrimitiveModifiedBoundsBase
+			|| ViewState->GlobalDistanceFieldModifiedBoundsSequence > ModifiedBoundsEnd;
+		const int32 FirstModifiedBoundsIndex = bModificationsMissed ? 0 : ViewState->GlobalDistanceFieldModifiedBoundsSequence - DistanceFieldSceneData.PrimitiveModifiedBoundsBase;
+
+		View.GlobalDistanceFieldInfo.bInitialized = true;
+		View.GlobalDistanceFieldInfo.Clipmaps.Reset();
+
+		for (int32 ClipmapIndex = 0; ClipmapIndex < NumClipmaps; ClipmapIndex++)
+		{
+			FGlobalDistanceFieldClipmapState& ClipmapState = ViewState->GlobalDistanceFieldClipmapState[ClipmapIndex];
+			const float Extent = GGlobalDistanceFieldClipmapExtent * FMath::Pow(2.0f, ClipmapIndex);
+			const float VoxelSize = 2 * Extent / GGlobalDistanceFieldResolution;
+
+			const IPooledRenderTarget* PreviousTexture = ClipmapState.VolumeTexture;
+			FPooledRenderTargetDesc Desc(FPooledRenderTargetDesc::CreateVolumeDesc(
+				GGlobalDistanceFieldResolution,
+				GGlobalDistanceFieldResolution,
+				GGlobalDistanceFieldResolution,
+				PF_R16F,
+				TexCreate_ShaderResource,
+				TexCreate_UAV,
+				false));
+			GRenderTargetPool.FindFreeElement(Desc, ClipmapState.VolumeTexture, TEXT("GlobalDistanceFieldClipmap"));
+
+			// Follow the view in steps of a few texels
+			const float ScrollStep = VoxelSize * GGlobalDistanceFieldScrollGranularity;
+			const FIntVector CenterTexel(
+				FMath::RoundToInt(View.ViewMatrices.ViewOrigin.X / ScrollStep) * GGlobalDistanceFieldScrollGranularity,
+				FMath::RoundToInt(View.ViewMatrices.ViewOrigin.Y / ScrollStep) * GGlobalDistanceFieldScrollGranularity,
+				FMath::RoundToInt(View.ViewMatrices.ViewOrigin.Z / ScrollStep) * GGlobalDistanceFieldScrollGranularity);
+			const FIntVector ClipmapMin = CenterTexel - FIntVector(GGlobalDistanceFieldResolution / 2);
+			const FIntVector ClipmapMax = ClipmapMin + FIntVector(GGlobalDistanceFieldResolution);
+			const FIntVector Scroll = CenterTexel - ClipmapState.CenterTexel;
+
+			FGlobalDistanceFieldClipmap& Clipmap = *new(View.GlobalDistanceFieldInfo.Clipmaps) FGlobalDistanceFieldClipmap();
+			Clipmap.Bounds = GetLatticeRegionBounds(ClipmapMin, ClipmapMax, VoxelSize);
+			Clipmap.VoxelSize = VoxelSize;
+			Clipmap.MaxDistance = VoxelSize * GGlobalDistanceFieldMaxDistanceInTexels;
+			Clipmap.Texture = ClipmapState.VolumeTexture->GetRenderTargetItem().ShaderResourceTexture;
+
+			FGlobalDistanceFieldUpdateRegion Region;
+			Region.View = &View;
+			Region.ClipmapIndex = ClipmapIndex;
+			Region.ClipmapUAV = ClipmapState.VolumeTexture->GetRenderTargetItem().UAV;
+
+			const bool bFullUpdate = GGlobalDistanceFieldFullUpdate
+				|| bModificationsMissed
+				|| !ClipmapState.bValid
+				|| ClipmapState.VolumeTexture != PreviousTexture
+				|| ClipmapState.Extent != Extent
+				|| FMath::Abs(Scroll.X) >= GGlobalDistanceFieldResolution
+				|| FMath::Abs(Scroll.Y) >= GGlobalDistanceFieldResolution
+				|| FMath::Abs(Scroll.Z) >= GGlobalDistanceFieldResolution;
+
+			if (bFullUpdate)
+			{
+				Region.Min = ClipmapMin;
+				Region.Max = ClipmapMax;
+				UpdateRegions.Add(Region);
+			}
+			else
+			{
+				// The slabs scrolled in on each axis. Their overlaps are composited twice, which is cheaper than splitting them
+				for (int32 Axis = 0; Axis < 3; Axis++)
+				{
+					const int32 AxisScroll = Scroll(Axis);
+
+					if (AxisScroll != 0)
+					{
+						Region.Min = ClipmapMin;
+						Region.Max = ClipmapMax;
+
+						if (AxisScroll > 0)
+						{
+							Region.Min(Axis) = ClipmapMax(Axis) - AxisScroll;
+						}
+						else
+						{
+							Region.Max(Axis) = ClipmapMin(Axis) - AxisScroll;
+						}
+
+						UpdateRegions.Add(Region);
+					}
+				}
+
+				// The regions around the primitives that were added, removed or moved since the last update, as far as their distance reaches
+				const int32 FirstModifiedRegion = UpdateRegions.Num();
+				FIntVector MergedMin(MAX_int32, MAX_int32, MAX_int32);
+				FIntVector MergedMax(MIN_int32, MIN_int32, MIN_int32);
+
+				for (int32 BoundsIndex = FirstModifiedBoundsIndex; BoundsIndex < DistanceFieldSceneData.PrimitiveModifiedBounds.Num(); BoundsIndex++)
+				{
+					const FBox ModifiedBounds = DistanceFieldSceneData.PrimitiveModifiedBounds[BoundsIndex].ExpandBy(Clipmap.MaxDistance + VoxelSize);
+
+					if (GetBoundsLatticeRegion(ModifiedBounds, VoxelSize, ClipmapMin, ClipmapMax, Region.Min, Region.Max))
+					{
+						UpdateRegions.Add(Region);
+
+						MergedMin = FIntVector(FMath::Min(MergedMin.X, Region.Min.X), FMath::Min(MergedMin.Y, Region.Min.Y), FMath::Min(MergedMin.Z, Region.Min.Z));
+						MergedMax = FIntVector(FMath::Max(MergedMax.X, Region.Max.X), FMath::Max(MergedMax.Y, Region.Max.Y), FMath::Max(MergedMax.Z, Region.Max.Z));
+					}
+				}
+
+				if (UpdateRegions.Num() - FirstModifiedRegion > GMaxGlobalDistanceFieldModifiedRegions)
+				{
+					UpdateRegions.RemoveAt(FirstModifiedRegion, UpdateRegions.Num() - FirstModifiedRegion);
+					Region.Min = MergedMin;
+					Region.Max = MergedMax;
+					UpdateRegions.Add(Region);
+				}
+			}
+
+			ClipmapState.CenterTexel = CenterTexel;
+			ClipmapState.Extent = Extent;
+			ClipmapState.bValid = true;
+		}
+
+		ViewState->GlobalDistanceFieldModifiedBoundsSequence = ModifiedBoundsEnd;
+	}
+
+	if (UpdateRegions.Num() == 0)
+	{
+		return;
+	}
+
+	// Cull the objects to each region on the CPU. The bounds of a primitive cover all of its instances
+	TArray<uint32> CulledObjectIndices;
+
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_CullGlobalDistanceFieldObjects);
+
+		TArray<FBox> ObjectBounds;
+		ObjectBounds.Empty(DistanceFieldSceneData.PrimitiveInstanceMapping.Num());
+
+		for (int32 ObjectIndex = 0; ObjectIndex < DistanceFieldSceneData.PrimitiveInstanceMapping.Num(); ObjectIndex++)
+		{
+			ObjectBounds.Add(DistanceFieldSceneData.PrimitiveInstanceMapping[ObjectIndex].Primitive->Proxy->GetBounds().GetBox());
+		}
+
+		for (int32 RegionIndex = 0; RegionIndex < UpdateRegions.Num(); RegionIndex++)
+		{
+			FGlobalDistanceFieldUpdateRegion& Region = UpdateRegions[RegionIndex];
+			const FGlobalDistanceFieldClipmap& Clipmap = Region.View->GlobalDistanceFieldInfo.Clipmaps[Region.ClipmapIndex];
+			const FBox RegionBounds = GetLatticeRegionBounds(Region.Min, Region.Max, Clipmap.VoxelSize).ExpandBy(Clipmap.MaxDistance);
+
+			Region.ObjectIndexOffset = CulledObjectIndices.Num();
+
+			for (int32 ObjectIndex = 0; ObjectIndex < ObjectBounds.Num(); ObjectIndex++)
+			{
+				if (RegionBounds.Intersect(ObjectBounds[ObjectIndex]))
+				{
+					CulledObjectIndices.Add(ObjectIndex);
+				}
+			}
+
+			Region.NumObjects = CulledObjectIndices.Num() - Region.ObjectIndexOffset;
+		}
+	}
+
+	FCPUUpdatedBuffer& CulledObjectIndicesBuffer = GGlobalDistanceFieldCulledObjectIndices.CulledObjectIndices;
+
+	if (CulledObjectIndices.Num() > 0)
+	{
+		if (CulledObjectIndices.Num() > CulledObjectIndicesBuffer.MaxElements)
+		{
+			CulledObjectIndicesBuffer.MaxElements = CulledObjectIndices.Num() * 5 / 4;
+			CulledObjectIndicesBuffer.Release();
+			CulledObjectIndicesBuffer.Initialize();
+		}
+
+		void* LockedBuffer = RHILockVertexBuffer(CulledObjectIndicesBuffer.Buffer, 0, CulledObjectIndicesBuffer.Buffer->GetSize(), RLM_WriteOnly);
+		const uint32 MemcpySize = CulledObjectIndices.GetTypeSize() * CulledObjectIndices.Num();
+		check(CulledObjectIndicesBuffer.Buffer->GetSize() >= MemcpySize);
+		FPlatformMemory::Memcpy(LockedBuffer, CulledObjectIndices.GetData(), MemcpySize);
+		RHIUnlockVertexBuffer(CulledObjectIndicesBuffer.Buffer);
+	}
+	else if (CulledObjectIndicesBuffer.MaxElements == 0)
+	{
+		// The composite still reads the buffer when there are no objects
+		CulledObjectIndicesBuffer.MaxElements = 1;
+		CulledObjectIndicesBuffer.Initialize();
+	}
+
+	TShaderMapRef<FCompositeObjectDistanceFieldsCS> ComputeShader(GetGlobalShaderMap(Scene->GetFeatureLevel()));
+	RHICmdList.SetComputeShader(ComputeShader->GetComputeShader());
+
+	for (int32 RegionIndex = 0; RegionIndex < UpdateRegions.Num(); RegionIndex++)
+	{
+		const FGlobalDistanceFieldUpdateRegion& Region = UpdateRegions[RegionIndex];
+		const FGlobalDistanceFieldClipmap& Clipmap = Region.View->GlobalDistanceFieldInfo.Clipmaps[Region.ClipmapIndex];
+		const FIntVector RegionSize = Region.Max - Region.Min;
+
+		ComputeShader->SetParameters(RHICmdList, Scene, Clipmap, Region.ClipmapUAV, Region.Min, RegionSize, Region.ObjectIndexOffset, Region.NumObjects);
+
+		DispatchComputeShader(RHICmdList, *ComputeShader,
+			FMath::DivideAndRoundUp(RegionSize.X, GGlobalDistanceFieldScrollGranularity),
+			FMath::DivideAndRoundUp(RegionSize.Y, GGlobalDistanceFieldScrollGranularity),
+			FMath::DivideAndRoundUp(RegionSize.Z, GGlobalDistanceFieldScrollGranularity));
+
+		ComputeShader->UnsetParameters(RHICmdList);
+	}
+}
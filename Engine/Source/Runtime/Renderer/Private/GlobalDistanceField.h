@@ -0,0 +1,139 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	GlobalDistanceField.h
+=============================================================================*/
+
+#pragma once
+
+/** Number of clipmaps of the global distance field, each one covering twice the extent of the previous one. Must match GlobalDistanceFieldShared.usf. */
+const int32 GMaxGlobalDistanceFieldClipmaps = 4;
+/** Resolution of each clipmap, in texels per side. */
+const int32 GGlobalDistanceFieldResolution = 128;
+
+/**
+ * Persistent state of a clipmap, stored in the view state since the clipmap follows the view.
+ * The texels are addressed toroidally by their position on the world space lattice of the clipmap,
+ * so moving the clipmap only recomposites the slabs that were scrolled in.
+ */
+class FGlobalDistanceFieldClipmapState
+{
+public:
+
+	FGlobalDistanceFieldClipmapState() :
+		CenterTexel(FIntVector::ZeroValue),
+		Extent(0),
+		bValid(false)
+	{}
+
+	TRefCountPtr<IPooledRenderTarget> VolumeTexture;
+
+	/** Texel the clipmap is centered on, on the world space lattice of the clipmap. */
+	FIntVector CenterTexel;
+	/** World space half size of the clipmap the texture was composited with. */
+	float Extent;
+	/** False until the whole clipmap has been composited. */
+	bool bValid;
+};
+
+/** A clipmap of the global distance field, as used by the current frame. */
+class FGlobalDistanceFieldClipmap
+{
+public:
+
+	FBox Bounds;
+	float VoxelSize;
+	float MaxDistance;
+	FTextureRHIParamRef Texture;
+};
+
+/** Global distance field parameters of a view for the current frame. */
+class FGlobalDistanceFieldInfo
+{
+public:
+
+	FGlobalDistanceFieldInfo() :
+		bInitialized(false)
+	{}
+
+	bool bInitialized;
+	TArray<FGlobalDistanceFieldClipmap, TInlineAllocator<GMaxGlobalDistanceFieldClipmaps> > Clipmaps;
+};
+
+class FGlobalDistanceFieldParameters
+{
+public:
+	void Bind(const FShaderParameterMap& ParameterMap)
+	{
+		for (int32 ClipmapIndex = 0; ClipmapIndex < GMaxGlobalDistanceFieldClipmaps; ClipmapIndex++)
+		{
+			GlobalDistanceFieldTexture[ClipmapIndex].Bind(ParameterMap, *FString::Printf(TEXT("GlobalDistanceFieldTexture%u"), ClipmapIndex));
+			GlobalDistanceFieldSampler[ClipmapIndex].Bind(ParameterMap, *FString::Printf(TEXT("GlobalDistanceFieldSampler%u"), ClipmapIndex));
+		}
+
+		GlobalVolumeCenterAndExtent.Bind(ParameterMap, TEXT("GlobalVolumeCenterAndExtent"));
+		GlobalVolumeTexelSizeAndMaxDistance.Bind(ParameterMap, TEXT("GlobalVolumeTexelSizeAndMaxDistance"));
+		NumGlobalClipmaps.Bind(ParameterMap, TEXT("NumGlobalClipmaps"));
+	}
+
+	bool IsBound() const
+	{
+		return NumGlobalClipmaps.IsBound();
+	}
+
+	template<typename TParamRef>
+	void Set(FRHICommandList& RHICmdList, const TParamRef& ShaderRHI, const FGlobalDistanceFieldInfo& GlobalDistanceFieldInfo)
+	{
+		FVector4 CenterAndExtent[GMaxGlobalDistanceFieldClipmaps];
+		FVector4 TexelSizeAndMaxDistance[GMaxGlobalDistanceFieldClipmaps];
+
+		for (int32 ClipmapIndex = 0; ClipmapIndex < GMaxGlobalDistanceFieldClipmaps; ClipmapIndex++)
+		{
+			const bool bValidClipmap = GlobalDistanceFieldInfo.bInitialized && ClipmapIndex < GlobalDistanceFieldInfo.Clipmaps.Num();
+			FTextureRHIParamRef TextureValue = bValidClipmap ? GlobalDistanceFieldInfo.Clipmaps[ClipmapIndex].Texture : NULL;
+
+			// The texture is addressed toroidally, so it must be sampled with wrapping
+			SetTextureParameter(RHICmdList, ShaderRHI, GlobalDistanceFieldTexture[ClipmapIndex], GlobalDistanceFieldSampler[ClipmapIndex], TStaticSamplerState<SF_Bilinear, AM_Wrap, AM_Wrap, AM_Wrap>::GetRHI(), TextureValue ? TextureValue : GBlackVolumeTexture->TextureRHI.GetReference());
+
+			if (bValidClipmap)
+			{
+				const FGlobalDistanceFieldClipmap& Clipmap = GlobalDistanceFieldInfo.Clipmaps[ClipmapIndex];
+				CenterAndExtent[ClipmapIndex] = FVector4(Clipmap.Bounds.GetCenter(), Clipmap.Bounds.GetExtent().X);
+				TexelSizeAndMaxDistance[ClipmapIndex] = FVector4(Clipmap.VoxelSize, Clipmap.MaxDistance, 0, 0);
+			}
+			else
+			{
+				CenterAndExtent[ClipmapIndex] = FVector4(0, 0, 0, 0);
+				TexelSizeAndMaxDistance[ClipmapIndex] = FVector4(1, 0, 0, 0);
+			}
+		}
+
+		SetShaderValueArray(RHICmdList, ShaderRHI, GlobalVolumeCenterAndExtent, CenterAndExtent, GMaxGlobalDistanceFieldClipmaps);
+		SetShaderValueArray(RHICmdList, ShaderRHI, GlobalVolumeTexelSizeAndMaxDistance, TexelSizeAndMaxDistance, GMaxGlobalDistanceFieldClipmaps);
+		SetShaderValue(RHICmdList, ShaderRHI, NumGlobalClipmaps, GlobalDistanceFieldInfo.bInitialized ? GlobalDistanceFieldInfo.Clipmaps.Num() : 0);
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FGlobalDistanceFieldParameters& Parameters)
+	{
+		for (int32 ClipmapIndex = 0; ClipmapIndex < GMaxGlobalDistanceFieldClipmaps; ClipmapIndex++)
+		{
+			Ar << Parameters.GlobalDistanceFieldTexture[ClipmapIndex];
+			Ar << Parameters.GlobalDistanceFieldSampler[ClipmapIndex];
+		}
+
+		Ar << Parameters.GlobalVolumeCenterAndExtent;
+		Ar << Parameters.GlobalVolumeTexelSizeAndMaxDistance;
+		Ar << Parameters.NumGlobalClipmaps;
+		return Ar;
+	}
+
+private:
+	FShaderResourceParameter GlobalDistanceFieldTexture[GMaxGlobalDistanceFieldClipmaps];
+	FShaderResourceParameter GlobalDistanceFieldSampler[GMaxGlobalDistanceFieldClipmaps];
+	FShaderParameter GlobalVolumeCenterAndExtent;
+	FShaderParameter GlobalVolumeTexelSizeAndMaxDistance;
+	FShaderParameter NumGlobalClipmaps;
+};
+
+/** Whether the global distance field can be used on this platform, see r.GlobalDistanceField. */
+extern bool SupportsGlobalDistanceField(ERHIFeatureLevel::Type FeatureLevel, EShaderPlatform ShaderPlatform);
@@ -24,9 +24,48 @@ static TAutoConsoleVariable<int32> CVarLightPropagationVolume(
 	TEXT(" 1: on"),
 	ECVF_RenderThreadSafe | ECVF_ReadOnly);
 
+static TAutoConsoleVariable<int32> CVarLPVPropagationIterations(
+	TEXT("r.LPV.PropagationIterations"),
+	3,
+	TEXT("Number of LPV propagation iterations, each one moves the light by a cell. Default is 3."),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarLPVPropagationFrames(
+	TEXT("r.LPV.PropagationFrames"),
+	1,
+	TEXT("Number of frames the LPV propagation iterations are split across. The volume is kept from frame to frame,\n")
+	TEXT("so the lighting still converges, only more slowly. Default is 1, all the iterations every frame."),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarLPVSparsePropagation(
+	TEXT("r.LPV.SparsePropagation"),
+	1,
+	TEXT("Skip the propagation of the blocks of the LPV where neither the block nor its neighbours have light.\n")
+	TEXT(" 0: off, propagate the whole volume\n")
+	TEXT(" 1: on (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarLPVActiveBlockThreshold(
+	TEXT("r.LPV.ActiveBlockThreshold"),
+	0.0001f,
+	TEXT("Intensity under which a cell of the LPV counts as unlit for r.LPV.SparsePropagation. The light of blocks that\n")
+	TEXT("are skipped is dropped, so higher values are faster but cut the faint light off sooner."),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarLPVPropagateGroupShared(
+	TEXT("r.LPV.PropagateGroupShared"),
+	1,
+	TEXT("Read the neighbour cells of the LPV propagation from groupshared memory, loading each cell of a block and its border once\n")
+	TEXT("instead of once per neighbour.\n")
+	TEXT(" 0: off\n")
+	TEXT(" 1: on (default)"),
+	ECVF_RenderThreadSafe);
+
 // ----------------------------------------------------------------------------
 
 static const uint32 LPV_GRIDRES = 32;
+// Size of the blocks of the active block mask, which are also the propagation thread groups
+static const uint32 LPV_BLOCK_SIZE = 4;
 static float LPV_CENTRE_OFFSET = 10.0f;
 
 #define LPV_AMBIENT_CUBE 0
@@ -126,6 +165,9 @@ public:
 
 		GvListBufferSRV.Bind(Initializer.ParameterMap, TEXT("gGvListBuffer") );
 		GvListHeadBufferSRV.Bind(Initializer.ParameterMap, TEXT("gGvListHeadBuffer") );
+
+		ActiveBlocksSRV.Bind(Initializer.ParameterMap, TEXT("gLpvActiveBlocks") );
+		ActiveBlocksUAV.Bind(Initializer.ParameterMap, TEXT("RWLpvActiveBlocks") );
 	}
 
 	static void ModifyCompilationEnvironment( EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment )
@@ -175,6 +217,9 @@ public:
 		Ar << GvListBufferSRV;
 		Ar << GvListHeadBufferSRV;
 
+		Ar << ActiveBlocksSRV;
+		Ar << ActiveBlocksUAV;
+
 		return bShaderHasOutdatedParameters;
 	}
 
@@ -262,6 +307,14 @@ public:
 		{
 			RHICmdList.SetShaderResourceViewParameter(ShaderRHI, GvListHeadBufferSRV.GetBaseIndex(), Params.GvListHeadBufferSRV);
 		}
+		if(ActiveBlocksSRV.IsBound())
+		{
+			RHICmdList.SetShaderResourceViewParameter(ShaderRHI, ActiveBlocksSRV.GetBaseIndex(), Params.ActiveBlocksSRV);
+		}
+		if(ActiveBlocksUAV.IsBound())
+		{
+			RHICmdList.SetUAVParameter(ShaderRHI, ActiveBlocksUAV.GetBaseIndex(), Params.ActiveBlocksUAV);
+		}
 	}
 
 	// Unbinds any buffers that have been bound.
@@ -336,6 +389,14 @@ public:
 		{
 			RHICmdList.SetUAVParameter(ShaderRHI, GvListHeadBufferUAV.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
 		}
+		if(ActiveBlocksSRV.IsBound())
+		{
+			RHICmdList.SetShaderResourceViewParameter(ShaderRHI, ActiveBlocksSRV.GetBaseIndex(), FShaderResourceViewRHIParamRef());
+		}
+		if(ActiveBlocksUAV.IsBound())
+		{
+			RHICmdList.SetUAVParameter(ShaderRHI, ActiveBlocksUAV.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
+		}
 	}
 
 protected:
@@ -368,6 +429,9 @@ protected:
 
 	FShaderResourceParameter GvListBufferSRV;
 	FShaderResourceParameter GvListHeadBufferSRV;
+
+	FShaderResourceParameter ActiveBlocksSRV;
+	FShaderResourceParameter ActiveBlocksUAV;
 };
 
 
@@ -578,6 +642,7 @@ enum PropagateShaderFlags
 {
 	PROPAGATE_SECONDARY_OCCLUSION	= 0x01,
 	PROPAGATE_MULTIPLE_BOUNCES		= 0x02,
+	PROPAGATE_GROUPSHARED			= 0x04,
 
 	PROPAGATE_SECONDARY_OCCLUSION_AND_MULTIPLE_BOUNCES		= PROPAGATE_SECONDARY_OCCLUSION | PROPAGATE_MULTIPLE_BOUNCES,
 };
@@ -595,6 +660,7 @@ public:
 	{
 		OutEnvironment.SetDefine(TEXT("LPV_SECONDARY_OCCLUSION"), (uint32)(ShaderFlags & PROPAGATE_SECONDARY_OCCLUSION ? 1 : 0));
 		OutEnvironment.SetDefine(TEXT("LPV_MULTIPLE_BOUNCES_ENABLED"), (uint32)(ShaderFlags & PROPAGATE_MULTIPLE_BOUNCES ? 1 : 0));
+		OutEnvironment.SetDefine(TEXT("PROPOGATE_USE_LDS"), (uint32)(ShaderFlags & PROPAGATE_GROUPSHARED ? 1 : 0));
 			
 		FLpvWriteShaderCSBase::ModifyCompilationEnvironment( Platform, OutEnvironment );
 	}
@@ -606,31 +672,76 @@ public:
 	virtual bool Serialize( FArchive& Ar ) override			{ return FLpvWriteShaderCSBase::Serialize( Ar ); }
 };
 
-IMPLEMENT_SHADER_TYPE(template<>,TLpvPropagateCS<0>,													TEXT("LPVPropagate"),TEXT("CSPropogate"),SF_Compute);
-IMPLEMENT_SHADER_TYPE(template<>,TLpvPropagateCS<PROPAGATE_SECONDARY_OCCLUSION>,						TEXT("LPVPropagate"),TEXT("CSPropogate"),SF_Compute);
-IMPLEMENT_SHADER_TYPE(template<>,TLpvPropagateCS<PROPAGATE_MULTIPLE_BOUNCES>,							TEXT("LPVPropagate"),TEXT("CSPropogate"),SF_Compute);
-IMPLEMENT_SHADER_TYPE(template<>,TLpvPropagateCS<PROPAGATE_SECONDARY_OCCLUSION_AND_MULTIPLE_BOUNCES>,	TEXT("LPVPropagate"),TEXT("CSPropogate"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(template<>,TLpvPropagateCS<0>,																	TEXT("LPVPropagate"),TEXT("CSPropogate"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(template<>,TLpvPropagateCS<PROPAGATE_SECONDARY_OCCLUSION>,										TEXT("LPVPropagate"),TEXT("CSPropogate"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(template<>,TLpvPropagateCS<PROPAGATE_MULTIPLE_BOUNCES>,											TEXT("LPVPropagate"),TEXT("CSPropogate"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(template<>,TLpvPropagateCS<PROPAGATE_SECONDARY_OCCLUSION_AND_MULTIPLE_BOUNCES>,					TEXT("LPVPropagate"),TEXT("CSPropogate"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(template<>,TLpvPropagateCS<PROPAGATE_GROUPSHARED>,												TEXT("LPVPropagate"),TEXT("CSPropogate"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(template<>,TLpvPropagateCS<PROPAGATE_GROUPSHARED | PROPAGATE_SECONDARY_OCCLUSION>,				TEXT("LPVPropagate"),TEXT("CSPropogate"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(template<>,TLpvPropagateCS<PROPAGATE_GROUPSHARED | PROPAGATE_MULTIPLE_BOUNCES>,					TEXT("LPVPropagate"),TEXT("CSPropogate"),SF_Compute);
+IMPLEMENT_SHADER_TYPE(template<>,TLpvPropagateCS<PROPAGATE_GROUPSHARED | PROPAGATE_SECONDARY_OCCLUSION_AND_MULTIPLE_BOUNCES>,	TEXT("LPVPropagate"),TEXT("CSPropogate"),SF_Compute);
 
-FLpvWriteShaderCSBase* GetPropagateShader(FViewInfo& View, bool bSecondaryOcclusion, bool bSecondaryBounces )
+FLpvWriteShaderCSBase* GetPropagateShader(FViewInfo& View, bool bSecondaryOcclusion, bool bSecondaryBounces, bool bGroupShared )
 {
+	const uint32 ShaderFlags = (bSecondaryOcclusion ? PROPAGATE_SECONDARY_OCCLUSION : 0)
+		| (bSecondaryBounces ? PROPAGATE_MULTIPLE_BOUNCES : 0)
+		| (bGroupShared ? PROPAGATE_GROUPSHARED : 0);
+
 	FLpvWriteShaderCSBase* ShaderOut = NULL;
-	if ( bSecondaryBounces )
-	{
-		if ( bSecondaryOcclusion ) 
-			ShaderOut = (FLpvWriteShaderCSBase*)*TShaderMapRef<TLpvPropagateCS<PROPAGATE_SECONDARY_OCCLUSION_AND_MULTIPLE_BOUNCES> >(View.ShaderMap);
-		else 
-			ShaderOut = (FLpvWriteShaderCSBase*)*TShaderMapRef<TLpvPropagateCS<PROPAGATE_MULTIPLE_BOUNCES> >(View.ShaderMap);
-	}
-	else
+	switch ( ShaderFlags )
 	{
-		if ( bSecondaryOcclusion ) 
-			ShaderOut = (FLpvWriteShaderCSBase*)*TShaderMapRef<TLpvPropagateCS<PROPAGATE_SECONDARY_OCCLUSION> >(View.ShaderMap);
-		else 
-			ShaderOut = (FLpvWriteShaderCSBase*)*TShaderMapRef<TLpvPropagateCS<0> >(View.ShaderMap);
+	case 0:
+		ShaderOut = (FLpvWriteShaderCSBase*)*TShaderMapRef<TLpvPropagateCS<0> >(View.ShaderMap);
+		break;
+	case PROPAGATE_SECONDARY_OCCLUSION:
+		ShaderOut = (FLpvWriteShaderCSBase*)*TShaderMapRef<TLpvPropagateCS<PROPAGATE_SECONDARY_OCCLUSION> >(View.ShaderMap);
+		break;
+	case PROPAGATE_MULTIPLE_BOUNCES:
+		ShaderOut = (FLpvWriteShaderCSBase*)*TShaderMapRef<TLpvPropagateCS<PROPAGATE_MULTIPLE_BOUNCES> >(View.ShaderMap);
+		break;
+	case PROPAGATE_SECONDARY_OCCLUSION_AND_MULTIPLE_BOUNCES:
+		ShaderOut = (FLpvWriteShaderCSBase*)*TShaderMapRef<TLpvPropagateCS<PROPAGATE_SECONDARY_OCCLUSION_AND_MULTIPLE_BOUNCES> >(View.ShaderMap);
+		break;
+	case PROPAGATE_GROUPSHARED:
+		ShaderOut = (FLpvWriteShaderCSBase*)*TShaderMapRef<TLpvPropagateCS<PROPAGATE_GROUPSHARED> >(View.ShaderMap);
+		break;
+	case PROPAGATE_GROUPSHARED | PROPAGATE_SECONDARY_OCCLUSION:
+		ShaderOut = (FLpvWriteShaderCSBase*)*TShaderMapRef<TLpvPropagateCS<PROPAGATE_GROUPSHARED | PROPAGATE_SECONDARY_OCCLUSION> >(View.ShaderMap);
+		break;
+	case PROPAGATE_GROUPSHARED | PROPAGATE_MULTIPLE_BOUNCES:
+		ShaderOut = (FLpvWriteShaderCSBase*)*TShaderMapRef<TLpvPropagateCS<PROPAGATE_GROUPSHARED | PROPAGATE_MULTIPLE_BOUNCES> >(View.ShaderMap);
+		break;
+	default:
+		ShaderOut = (FLpvWriteShaderCSBase*)*TShaderMapRef<TLpvPropagateCS<PROPAGATE_GROUPSHARED | PROPAGATE_SECONDARY_OCCLUSION_AND_MULTIPLE_BOUNCES> >(View.ShaderMap);
+		break;
 	}
 	return ShaderOut;
 }
 
+// ----------------------------------------------------------------------------
+// Compute shader to flag the blocks of the LPV which have some light
+// ----------------------------------------------------------------------------
+class FLpvBuildActiveBlocksCS : public FLpvWriteShaderCSBase
+{
+	DECLARE_SHADER_TYPE(FLpvBuildActiveBlocksCS,Global);
+
+public:
+	//@todo-rco: Remove this when reenabling for OpenGL
+	static bool ShouldCache( EShaderPlatform Platform )		{ return IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5) && !IsOpenGLPlatform(Platform); }
+
+	static void ModifyCompilationEnvironment( EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment )
+	{
+		FLpvWriteShaderCSBase::ModifyCompilationEnvironment( Platform, OutEnvironment );
+	}
+
+	FLpvBuildActiveBlocksCS()	{	}
+
+	explicit FLpvBuildActiveBlocksCS( const ShaderMetaType::CompiledShaderInitializerType& Initializer ) : FLpvWriteShaderCSBase(Initializer)		{	}
+
+	virtual bool Serialize( FArchive& Ar ) override			{ return FLpvWriteShaderCSBase::Serialize( Ar ); }
+};
+IMPLEMENT_SHADER_TYPE(,FLpvBuildActiveBlocksCS,TEXT("LPVPropagate"),TEXT("CSBuildActiveBlocks"),SF_Compute);
+
 // ----------------------------------------------------------------------------
 // Base injection compute shader
 // ----------------------------------------------------------------------------
@@ -699,6 +810,7 @@ FLightPropagationVolume::FLightPropagationVolume() :
 	, bEnabled( false )
 	, mWriteBufferIndex( 0 )
 	, GeometryVolumeGenerated( false )
+	, PropagationFrameIndex( 0 )
 {
 	bNeedsBufferClear = true;
 
@@ -732,6 +844,10 @@ FLightPropagationVolume::FLightPropagationVolume() :
 	GvListHeadBuffer = new FRWBufferByteAddress();
 	GvListHeadBuffer->Initialize(LPV_GRIDRES*LPV_GRIDRES*LPV_GRIDRES * 4, BUF_ByteAddressBuffer);
 
+	const uint32 BlocksPerSide = LPV_GRIDRES / LPV_BLOCK_SIZE;
+	ActiveBlocksBuffer = new FRWBuffer();
+	ActiveBlocksBuffer->Initialize(sizeof(uint32), BlocksPerSide*BlocksPerSide*BlocksPerSide, PF_R32_UINT);
+
 	LpvWriteUniformBufferParams = new FLpvWriteUniformBufferParameters;
 	FMemory::Memzero( LpvWriteUniformBufferParams, sizeof(FLpvWriteUniformBufferParameters) );
 
@@ -785,6 +901,9 @@ FLightPropagationVolume::~FLightPropagationVolume()
 	GvListBuffer->Release();
 	delete GvListBuffer;
 
+	ActiveBlocksBuffer->Release();
+	delete ActiveBlocksBuffer;
+
 	delete LpvWriteUniformBufferParams;
 }  
 
@@ -902,6 +1021,7 @@ void FLightPropagationVolume::InitSettings(FRHICommandList& RHICmdList, const FS
 		LpvWriteUniformBufferParams->GeometryVolumeInjectionBias	= View.FinalPostProcessSettings.LPVGeometryVolumeBias * LpvScale;
 		LpvWriteUniformBufferParams->VplInjectionBias				= View.FinalPostProcessSettings.LPVVplInjectionBias * LpvScale;
 		LpvWriteUniformBufferParams->PropagationIndex				= 0;
+		LpvWriteUniformBufferParams->ActiveBlockThreshold			= FMath::Max(CVarLPVActiveBlockThreshold.GetValueOnRenderThread(), 0.0f);
 		LpvWriteUniformBufferParams->EmissiveInjectionMultiplier	= View.FinalPostProcessSettings.LPVEmissiveInjectionIntensity;
 
 
@@ -1123,15 +1243,30 @@ void FLightPropagationVolume::Propagate(FRHICommandListImmediate& RHICmdList, FV
 		static int PropagationStep = 0;
 
 		SCOPED_DRAW_EVENT(RHICmdList, LpvPropagate);
-		static int numIterations = 3;
-		for ( int i=0; i<numIterations; i++ )
+
+		// The volume is kept from frame to frame, so the iterations can be split across frames: each frame does its share
+		const int32 NumIterations = FMath::Max(CVarLPVPropagationIterations.GetValueOnRenderThread(), 0);
+		const int32 NumFrames = FMath::Max(CVarLPVPropagationFrames.GetValueOnRenderThread(), 1);
+		const int32 FrameSlot = PropagationFrameIndex % NumFrames;
+		const int32 NumFrameIterations = NumIterations * (FrameSlot + 1) / NumFrames - NumIterations * FrameSlot / NumFrames;
+		PropagationFrameIndex++;
+
+		const bool bSparsePropagation = CVarLPVSparsePropagation.GetValueOnRenderThread() != 0;
+		const bool bGroupShared = CVarLPVPropagateGroupShared.GetValueOnRenderThread() != 0;
+
+		if ( !bSparsePropagation && NumFrameIterations > 0 )
+		{
+			// Every block is active
+			uint32 ActiveValues[4] = { 1, 1, 1, 1 };
+			RHICmdList.ClearUAV( ActiveBlocksBuffer->UAV, ActiveValues );
+		}
+
+		for ( int i=0; i<NumFrameIterations; i++ )
 		{
 			// Disable secondary occlusion on the first iteration
 			bool bSecondaryOcclusion	= (SecondaryOcclusionStrength > 0.001f); 
 			bool bSecondaryBounces		= (SecondaryBounceStrength > 0.001f); 
 			mWriteBufferIndex = 1-mWriteBufferIndex; // Swap buffers with each iteration
-			FLpvWriteShaderCSBase* Shader = GetPropagateShader(View, bSecondaryOcclusion, bSecondaryBounces);
-			RHICmdList.SetComputeShader(Shader->GetComputeShader());
 
 			LpvWriteUniformBufferParams->PropagationIndex = PropagationStep;
 			PropagationStep++;
@@ -1140,9 +1275,24 @@ void FLightPropagationVolume::Propagate(FRHICommandListImmediate& RHICmdList, FV
 
 			FLpvBaseWriteShaderParams ShaderParams;
 			GetShaderParams( ShaderParams );
+
+			// Light moves a cell per iteration, so a mask built from the source of this iteration stays valid (once dilated by a block
+			// in the propagation) for LPV_BLOCK_SIZE iterations
+			if ( bSparsePropagation && i % LPV_BLOCK_SIZE == 0 )
+			{
+				SCOPED_DRAW_EVENT(RHICmdList, LpvBuildActiveBlocks);
+				TShaderMapRef<FLpvBuildActiveBlocksCS> BuildActiveBlocksShader(View.ShaderMap);
+				RHICmdList.SetComputeShader(BuildActiveBlocksShader->GetComputeShader());
+				BuildActiveBlocksShader->SetParameters(RHICmdList, ShaderParams );
+				DispatchComputeShader(RHICmdList, *BuildActiveBlocksShader, LPV_GRIDRES/LPV_BLOCK_SIZE, LPV_GRIDRES/LPV_BLOCK_SIZE, LPV_GRIDRES/LPV_BLOCK_SIZE );
+				BuildActiveBlocksShader->UnbindBuffers(RHICmdList);
+			}
+
+			FLpvWriteShaderCSBase* Shader = GetPropagateShader(View, bSecondaryOcclusion, bSecondaryBounces, bGroupShared);
+			RHICmdList.SetComputeShader(Shader->GetComputeShader());
 			Shader->SetParameters(RHICmdList, ShaderParams );
 
-			DispatchComputeShader(RHICmdList, Shader, LPV_GRIDRES/4, LPV_GRIDRES/4, LPV_GRIDRES/4 );
+			DispatchComputeShader(RHICmdList, Shader, LPV_GRIDRES/LPV_BLOCK_SIZE, LPV_GRIDRES/LPV_BLOCK_SIZE, LPV_GRIDRES/LPV_BLOCK_SIZE );
 
 			Shader->UnbindBuffers(RHICmdList); 
 		}
@@ -1187,6 +1337,8 @@ void FLightPropagationVolume::GetShaderParams( FLpvBaseWriteShaderParams& OutPar
 	OutParams.GvListBufferUAV = GvListBuffer->UAV;
 	OutParams.GvListHeadBufferSRV = GvListHeadBuffer->SRV;
 	OutParams.GvListHeadBufferUAV = GvListHeadBuffer->UAV;
+	OutParams.ActiveBlocksSRV = ActiveBlocksBuffer->SRV;
+	OutParams.ActiveBlocksUAV = ActiveBlocksBuffer->UAV;
 
 	OutParams.UniformBuffer = LpvWriteUniformBuffer;
 }
@@ -86,6 +86,7 @@ BEGIN_UNIFORM_BUFFER_STRUCT( FLpvWriteUniformBufferParameters, )
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER( float, GeometryVolumeInjectionBias )
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER( float, EmissiveInjectionMultiplier )
 	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER( int,	 PropagationIndex )
+	DECLARE_UNIFORM_BUFFER_STRUCT_MEMBER( float, ActiveBlockThreshold )
 END_UNIFORM_BUFFER_STRUCT( FLpvWriteUniformBufferParameters )
 
 // ----------------------------------------------------------------------------
@@ -118,6 +119,9 @@ struct FLpvBaseWriteShaderParams
 	FUnorderedAccessViewRHIParamRef GvListHeadBufferUAV;
 	FShaderResourceViewRHIParamRef	GvListBufferSRV;
 	FUnorderedAccessViewRHIParamRef GvListBufferUAV;
+
+	FShaderResourceViewRHIParamRef	ActiveBlocksSRV;
+	FUnorderedAccessViewRHIParamRef ActiveBlocksUAV;
 };
 
 class FLightPropagationVolume // @TODO: this should probably be derived from FRenderResource (with InitDynamicRHI etc)
@@ -206,6 +210,9 @@ public:
 #else
 	FRWBuffer*							GvBuffer;			
 #endif
+	// One flag per block of 4x4x4 cells with some light, propagation skips the blocks with no lit neighbour
+	FRWBuffer*							ActiveBlocksBuffer;
+
 	float								SecondaryOcclusionStrength;
 	float								SecondaryBounceStrength;
 
@@ -216,6 +223,9 @@ public:
 	uint32								mWriteBufferIndex;
 	bool								bNeedsBufferClear;
 
+	// Frames since the LPV was created, to split the propagation iterations across frames
+	uint32								PropagationFrameIndex;
+
 	FBox								BoundingBox;
 	bool								GeometryVolumeGenerated; 
 
@@ -556,12 +556,32 @@ void FDeferredShadingSceneRenderer::RenderLights(FRHICommandListImmediate& RHICm
 		if(UseApproximateHybridRaytracingRT(FeatureLevel) && Views[0].Family->FamilySizeX > 256 && Views[0].Family->FamilySizeY > 256) // bypass aux. views
 		{
 			
+			GSceneRenderTargets.AllocAHRTransientTargets();
+
+			// The tiled reflection environment already reads the GBuffer of every pixel, blending the reflection trace there is cheaper than on the composite
+			// With r.AHRTiledReflections 2 it does the whole composite, as it rewrites every pixel of scene color anyway
+			const int32 TiledReflectionsMode = ShouldDoTiledDeferredReflections() ? CVarAHRTiledReflections.GetValueOnRenderThread() : 0;
+			const bool bReflectionInTiledPass = TiledReflectionsMode != 0;
+			const bool bCompositeInTiledPass = TiledReflectionsMode > 1;
+
 			// No need to set the render target before, as both functions set their own rt
-			AHREngine.TraceScene(RHICmdList,Views[0]);
-			AHREngine.Upsample(RHICmdList,Views[0]);
+			// Every view traces its own rect of the trace targets, the voxelization is shared
+			for(int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
+			{
+				AHREngine.TraceScene(RHICmdList,Views[ViewIndex]);
+			}
+			AHREngine.Upsample(RHICmdList,Views);
 			// Add to the light accumulation buffer by rendering a quad with additive blending
 			GSceneRenderTargets.BeginRenderingSceneColor(RHICmdList);
-			AHREngine.Composite(RHICmdList,Views[0]);
+			if(!bCompositeInTiledPass)
+			{
+				for(int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
+				{
+					AHREngine.Composite(RHICmdList,Views[ViewIndex],bReflectionInTiledPass);
+				}
+			}
+
+			GSceneRenderTargets.ReleaseAHRTransientTargets(bReflectionInTiledPass,bCompositeInTiledPass);
 		}
 
 		// Do not resolve to scene color texture, this is done lazily
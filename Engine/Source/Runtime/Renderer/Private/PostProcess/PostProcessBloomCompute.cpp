@@ -0,0 +1,363 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	PostProcessBloomCompute.cpp: Compute shader version of the bloom downsample chain and blur.
+=============================================================================*/
+
+#include "RendererPrivate.h"
+#include "ScenePrivate.h"
+#include "SceneFilterRendering.h"
+#include "PostProcessBloomCompute.h"
+#include "PostProcessing.h"
+#include "SceneUtils.h"
+
+static TAutoConsoleVariable<int32> CVarBloomCompute(
+	TEXT("r.Bloom.Compute"),
+	0,
+	TEXT("Builds the bloom downsample chain and blurs it with compute shaders instead of one pixel shader pass per step.\n")
+	TEXT("The four downsamples are done in one dispatch and each blur direction reads its rows once into groupshared memory.\n")
+	TEXT("Only the first downsample keeps the 4x4 kernel of r.BloomQuality's pixel shader path, the next ones use 2x2.\n")
+	TEXT(" 0: off, pixel shaders (default)\n")
+	TEXT(" 1: on, SM5 only"),
+	ECVF_RenderThreadSafe);
+
+bool UseComputeBloom(ERHIFeatureLevel::Type FeatureLevel)
+{
+	return FeatureLevel >= ERHIFeatureLevel::SM5 && CVarBloomCompute.GetValueOnRenderThread() != 0;
+}
+
+/** Encapsulates the bloom downsample chain compute shader. */
+class FPostProcessBloomDownsampleCS : public FGlobalShader
+{
+	DECLARE_SHADER_TYPE(FPostProcessBloomDownsampleCS, Global);
+
+	static bool ShouldCache(EShaderPlatform Platform)
+	{
+		return IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Platform, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), FRCPassPostProcessBloomDownsampleCS::ThreadGroupSize);
+		OutEnvironment.CompilerFlags.Add(CFLAG_StandardOptimization);
+	}
+
+	/** Default constructor. */
+	FPostProcessBloomDownsampleCS() {}
+
+public:
+	FPostProcessPassParameters PostprocessParameter;
+	FShaderResourceParameter OutputTextures[FRCPassPostProcessBloomDownsampleCS::NumOutputs];
+	FShaderParameter OutputRects[FRCPassPostProcessBloomDownsampleCS::NumOutputs];
+	FShaderParameter GroupOrigin;
+
+	/** Initialization constructor. */
+	FPostProcessBloomDownsampleCS(const ShaderMetaType::CompiledShaderInitializerType& Initializer)
+		: FGlobalShader(Initializer)
+	{
+		PostprocessParameter.Bind(Initializer.ParameterMap);
+		for (uint32 OutputIndex = 0; OutputIndex < FRCPassPostProcessBloomDownsampleCS::NumOutputs; ++OutputIndex)
+		{
+			OutputTextures[OutputIndex].Bind(Initializer.ParameterMap, *FString::Printf(TEXT("OutputTexture%u"), OutputIndex));
+			OutputRects[OutputIndex].Bind(Initializer.ParameterMap, *FString::Printf(TEXT("OutputRect%u"), OutputIndex));
+		}
+		GroupOrigin.Bind(Initializer.ParameterMap, TEXT("GroupOrigin"));
+	}
+
+	void SetCS(FRHICommandList& RHICmdList, const FRenderingCompositePassContext& Context, const FIntRect* OutputRectValues, FIntPoint GroupOriginValue)
+	{
+		const FComputeShaderRHIParamRef ShaderRHI = GetComputeShader();
+
+		FGlobalShader::SetParameters(RHICmdList, ShaderRHI, Context.View);
+
+		PostprocessParameter.SetCS(ShaderRHI, Context, TStaticSamplerState<SF_Bilinear,AM_Clamp,AM_Clamp,AM_Clamp>::GetRHI());
+
+		for (uint32 OutputIndex = 0; OutputIndex < FRCPassPostProcessBloomDownsampleCS::NumOutputs; ++OutputIndex)
+		{
+			SetShaderValue(RHICmdList, ShaderRHI, OutputRects[OutputIndex], OutputRectValues[OutputIndex]);
+		}
+		SetShaderValue(RHICmdList, ShaderRHI, GroupOrigin, GroupOriginValue);
+	}
+
+	// FShader interface.
+	virtual bool Serialize(FArchive& Ar)
+	{
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize(Ar);
+		Ar << PostprocessParameter;
+		for (uint32 OutputIndex = 0; OutputIndex < FRCPassPostProcessBloomDownsampleCS::NumOutputs; ++OutputIndex)
+		{
+			Ar << OutputTextures[OutputIndex] << OutputRects[OutputIndex];
+		}
+		Ar << GroupOrigin;
+		return bShaderHasOutdatedParameters;
+	}
+};
+
+IMPLEMENT_SHADER_TYPE(,FPostProcessBloomDownsampleCS,TEXT("PostProcessBloomCompute"),TEXT("DownsampleCS"),SF_Compute);
+
+void FRCPassPostProcessBloomDownsampleCS::Process(FRenderingCompositePassContext& Context)
+{
+	SCOPED_DRAW_EVENT(Context.RHICmdList, BloomDownsampleCS);
+	const FPooledRenderTargetDesc* InputDesc = GetInputDesc(ePId_Input0);
+
+	if(!InputDesc)
+	{
+		// input is not hooked up correctly
+		return;
+	}
+
+	const FSceneView& View = Context.View;
+
+	// e.g. 4 means the input texture is 4x smaller than the buffer size
+	uint32 ScaleFactor = GSceneRenderTargets.GetBufferSizeXY().X / InputDesc->Extent.X;
+
+	// same rects as a chain of FRCPassPostProcessDownsample
+	FIntRect OutputRects[NumOutputs];
+	FIntRect SrcRect = View.ViewRect / ScaleFactor;
+	for (uint32 OutputIndex = 0; OutputIndex < NumOutputs; ++OutputIndex)
+	{
+		OutputRects[OutputIndex] = FIntRect::DivideAndRoundUp(SrcRect, 2);
+		SrcRect = OutputRects[OutputIndex];
+	}
+
+	// the thread groups are aligned on multiples of their size so the texels of the smaller outputs never straddle two groups
+	const FIntPoint GroupOrigin = (OutputRects[0].Min / (int32)ThreadGroupSize) * (int32)ThreadGroupSize;
+	const FIntPoint ThreadGroupCount(
+		FMath::DivideAndRoundUp(OutputRects[0].Max.X - GroupOrigin.X, (int32)ThreadGroupSize),
+		FMath::DivideAndRoundUp(OutputRects[0].Max.Y - GroupOrigin.Y, (int32)ThreadGroupSize));
+
+	TShaderMapRef<FPostProcessBloomDownsampleCS> ComputeShader(Context.GetShaderMap());
+
+	Context.RHICmdList.SetComputeShader(ComputeShader->GetComputeShader());
+	SetRenderTarget(Context.RHICmdList, FTextureRHIRef(), FTextureRHIRef());
+
+	// set destinations
+	const FSceneRenderTargetItem* DestRenderTargets[NumOutputs];
+	for (uint32 OutputIndex = 0; OutputIndex < NumOutputs; ++OutputIndex)
+	{
+		DestRenderTargets[OutputIndex] = &PassOutputs[OutputIndex].RequestSurface(Context);
+		check(DestRenderTargets[OutputIndex]->UAV);
+		Context.RHICmdList.SetUAVParameter(ComputeShader->GetComputeShader(), ComputeShader->OutputTextures[OutputIndex].GetBaseIndex(), DestRenderTargets[OutputIndex]->UAV);
+	}
+
+	ComputeShader->SetCS(Context.RHICmdList, Context, OutputRects, GroupOrigin);
+
+	DispatchComputeShader(Context.RHICmdList, *ComputeShader, ThreadGroupCount.X, ThreadGroupCount.Y, 1);
+
+	// un-set destinations
+	for (uint32 OutputIndex = 0; OutputIndex < NumOutputs; ++OutputIndex)
+	{
+		Context.RHICmdList.SetUAVParameter(ComputeShader->GetComputeShader(), ComputeShader->OutputTextures[OutputIndex].GetBaseIndex(), NULL);
+		Context.RHICmdList.CopyToResolveTarget(DestRenderTargets[OutputIndex]->TargetableTexture, DestRenderTargets[OutputIndex]->ShaderResourceTexture, false, FResolveParams());
+	}
+}
+
+FPooledRenderTargetDesc FRCPassPostProcessBloomDownsampleCS::ComputeOutputDesc(EPassOutputId InPassOutputId) const
+{
+	static const TCHAR* DebugNames[NumOutputs] = { TEXT("BloomDownsample1"), TEXT("BloomDownsample2"), TEXT("BloomDownsample3"), TEXT("BloomDownsample4") };
+
+	FPooledRenderTargetDesc Ret = PassInputs[0].GetOutput()->RenderTargetDesc;
+
+	Ret.Reset();
+
+	for (uint32 OutputIndex = 0; OutputIndex <= (uint32)InPassOutputId; ++OutputIndex)
+	{
+		Ret.Extent = FIntPoint::DivideAndRoundUp(Ret.Extent, 2);
+	}
+
+	Ret.Extent.X = FMath::Max(1, Ret.Extent.X);
+	Ret.Extent.Y = FMath::Max(1, Ret.Extent.Y);
+
+	Ret.TargetableFlags |= TexCreate_RenderTargetable | TexCreate_UAV;
+	Ret.DebugName = DebugNames[InPassOutputId];
+
+	return Ret;
+}
+
+
+/**
+ * Encapsulates the bloom blur compute shader.
+ * @param bVertical 0: blurs along X, 1: along Y
+ * @param bAdditive 1: adds ePId_Input1 to the result
+ */
+template<uint32 bVertical, uint32 bAdditive>
+class TPostProcessBloomBlurCS : public FGlobalShader
+{
+	DECLARE_SHADER_TYPE(TPostProcessBloomBlurCS, Global);
+
+	static bool ShouldCache(EShaderPlatform Platform)
+	{
+		return IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Platform, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("BLUR_TILE_SIZE"), FRCPassPostProcessBloomBlurCS::TileSize);
+		OutEnvironment.SetDefine(TEXT("BLUR_TILE_ROWS"), FRCPassPostProcessBloomBlurCS::TileRows);
+		OutEnvironment.SetDefine(TEXT("MAX_FILTER_SAMPLES"), MAX_FILTER_SAMPLES);
+		OutEnvironment.SetDefine(TEXT("BLUR_VERTICAL"), bVertical);
+		OutEnvironment.SetDefine(TEXT("BLUR_ADDITIVE"), bAdditive);
+		OutEnvironment.CompilerFlags.Add(CFLAG_StandardOptimization);
+	}
+
+	/** Default constructor. */
+	TPostProcessBloomBlurCS() {}
+
+public:
+	FPostProcessPassParameters PostprocessParameter;
+	FShaderResourceParameter OutputTexture;
+	FShaderParameter OutputRect;
+	FShaderParameter NumSamples;
+	FShaderParameter SampleOffsets;
+	FShaderParameter SampleWeights;
+
+	/** Initialization constructor. */
+	TPostProcessBloomBlurCS(const ShaderMetaType::CompiledShaderInitializerType& Initializer)
+		: FGlobalShader(Initializer)
+	{
+		PostprocessParameter.Bind(Initializer.ParameterMap);
+		OutputTexture.Bind(Initializer.ParameterMap, TEXT("OutputTexture"));
+		OutputRect.Bind(Initializer.ParameterMap, TEXT("OutputRect"));
+		NumSamples.Bind(Initializer.ParameterMap, TEXT("NumSamples"));
+		SampleOffsets.Bind(Initializer.ParameterMap, TEXT("SampleOffsets"));
+		SampleWeights.Bind(Initializer.ParameterMap, TEXT("SampleWeights"));
+	}
+
+	void SetCS(FRHICommandList& RHICmdList, const FRenderingCompositePassContext& Context, const FIntRect& OutputRectValue, const FVector2D* OffsetAndWeight, const FLinearColor& Tint, uint32 NumSamplesValue)
+	{
+		const FComputeShaderRHIParamRef ShaderRHI = GetComputeShader();
+
+		FGlobalShader::SetParameters(RHICmdList, ShaderRHI, Context.View);
+
+		PostprocessParameter.SetCS(ShaderRHI, Context, TStaticSamplerState<SF_Bilinear,AM_Clamp,AM_Clamp,AM_Clamp>::GetRHI());
+
+		SetShaderValue(RHICmdList, ShaderRHI, OutputRect, OutputRectValue);
+		SetShaderValue(RHICmdList, ShaderRHI, NumSamples, NumSamplesValue);
+
+		// 4 offsets per register
+		FVector4 PackedOffsets[MAX_FILTER_SAMPLES / 4];
+		FLinearColor Weights[MAX_FILTER_SAMPLES];
+		FMemory::Memzero(PackedOffsets, sizeof(PackedOffsets));
+		for (uint32 SampleIndex = 0; SampleIndex < NumSamplesValue; ++SampleIndex)
+		{
+			PackedOffsets[SampleIndex / 4][SampleIndex % 4] = OffsetAndWeight[SampleIndex].X;
+			Weights[SampleIndex] = Tint * OffsetAndWeight[SampleIndex].Y;
+		}
+		SetShaderValueArray(RHICmdList, ShaderRHI, SampleOffsets, PackedOffsets, MAX_FILTER_SAMPLES / 4);
+		SetShaderValueArray(RHICmdList, ShaderRHI, SampleWeights, Weights, NumSamplesValue);
+	}
+
+	// FShader interface.
+	virtual bool Serialize(FArchive& Ar)
+	{
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize(Ar);
+		Ar << PostprocessParameter << OutputTexture << OutputRect << NumSamples << SampleOffsets << SampleWeights;
+		return bShaderHasOutdatedParameters;
+	}
+};
+
+// #define avoids a lot of code duplication
+#define VARIATION1(A, B) typedef TPostProcessBloomBlurCS<A, B> TPostProcessBloomBlurCS##A##B; \
+	IMPLEMENT_SHADER_TYPE(template<>,TPostProcessBloomBlurCS##A##B,TEXT("PostProcessBloomCompute"),TEXT("BlurCS"),SF_Compute);
+
+VARIATION1(0, 0)			VARIATION1(0, 1)
+VARIATION1(1, 0)			VARIATION1(1, 1)
+#undef VARIATION1
+
+FRCPassPostProcessBloomBlurCS::FRCPassPostProcessBloomBlurCS(EFilterShape InFilterShape, float InSizeScale, const TCHAR* InDebugName, FLinearColor InTintValue)
+	: FilterShape(InFilterShape)
+	, SizeScale(InSizeScale)
+	, TintValue(InTintValue)
+	, DebugName(InDebugName)
+{
+}
+
+template<uint32 bVertical, uint32 bAdditive>
+static void DispatchBloomBlur(const FRenderingCompositePassContext& Context, const FSceneRenderTargetItem& DestRenderTarget, const FIntRect& DestRect, const FVector2D* OffsetAndWeight, const FLinearColor& Tint, uint32 NumSamples)
+{
+	TShaderMapRef<TPostProcessBloomBlurCS<bVertical, bAdditive> > ComputeShader(Context.GetShaderMap());
+
+	Context.RHICmdList.SetComputeShader(ComputeShader->GetComputeShader());
+
+	Context.RHICmdList.SetUAVParameter(ComputeShader->GetComputeShader(), ComputeShader->OutputTexture.GetBaseIndex(), DestRenderTarget.UAV);
+	ComputeShader->SetCS(Context.RHICmdList, Context, DestRect, OffsetAndWeight, Tint, NumSamples);
+
+	const FIntPoint TileExtent = bVertical ? FIntPoint(FRCPassPostProcessBloomBlurCS::TileRows, FRCPassPostProcessBloomBlurCS::TileSize) : FIntPoint(FRCPassPostProcessBloomBlurCS::TileSize, FRCPassPostProcessBloomBlurCS::TileRows);
+	DispatchComputeShader(Context.RHICmdList, *ComputeShader, FMath::DivideAndRoundUp(DestRect.Width(), TileExtent.X), FMath::DivideAndRoundUp(DestRect.Height(), TileExtent.Y), 1);
+
+	Context.RHICmdList.SetUAVParameter(ComputeShader->GetComputeShader(), ComputeShader->OutputTexture.GetBaseIndex(), NULL);
+}
+
+void FRCPassPostProcessBloomBlurCS::Process(FRenderingCompositePassContext& Context)
+{
+	const FPooledRenderTargetDesc* InputDesc = GetInputDesc(ePId_Input0);
+
+	// input is not hooked up correctly
+	check(InputDesc);
+
+	const FSceneView& View = Context.View;
+	const auto FeatureLevel = Context.View.GetFeatureLevel();
+
+	FIntPoint SrcSize = InputDesc->Extent;
+	int32 SrcSizeForThisAxis = (FilterShape == EFS_Horiz) ? SrcSize.X : SrcSize.Y;
+
+	// same kernel as FRCPassPostProcessWeightedSampleSum, which has the same size on both axes
+	// in texel (input resolution), *2 as we use the diameter
+	// we scale by width because FOV is defined horizontally
+	float EffectiveBlurRadius = SizeScale * SrcSizeForThisAxis * 2 / 100.0f;
+
+	// the samples must stay within the apron of groupshared texels around the tile, which is MAX_FILTER_SAMPLES wide
+	FVector2D OffsetAndWeight[MAX_FILTER_SAMPLES];
+	uint32 NumSamples = FRCPassPostProcessWeightedSampleSum::Compute1DGaussianFilterKernel(FeatureLevel, EffectiveBlurRadius, OffsetAndWeight, MAX_FILTER_SAMPLES);
+
+	SCOPED_DRAW_EVENTF(Context.RHICmdList, BloomBlurCS, TEXT("BloomBlurCS#%d"), NumSamples);
+
+	const FSceneRenderTargetItem& DestRenderTarget = PassOutputs[0].RequestSurface(Context);
+	check(DestRenderTarget.UAV);
+
+	SetRenderTarget(Context.RHICmdList, FTextureRHIRef(), FTextureRHIRef());
+
+	// e.g. 4 means the texture is 4x smaller than the buffer size
+	FIntPoint ScaleFactor = GSceneRenderTargets.GetBufferSizeXY() / SrcSize;
+	FIntRect DestRect = View.ViewRect / ScaleFactor;
+
+	const bool bAdditive = PassInputs[1].GetOutput() != 0;
+
+	if (FilterShape == EFS_Horiz)
+	{
+		if (bAdditive)
+		{
+			DispatchBloomBlur<0, 1>(Context, DestRenderTarget, DestRect, OffsetAndWeight, TintValue, NumSamples);
+		}
+		else
+		{
+			DispatchBloomBlur<0, 0>(Context, DestRenderTarget, DestRect, OffsetAndWeight, TintValue, NumSamples);
+		}
+	}
+	else
+	{
+		if (bAdditive)
+		{
+			DispatchBloomBlur<1, 1>(Context, DestRenderTarget, DestRect, OffsetAndWeight, TintValue, NumSamples);
+		}
+		else
+		{
+			DispatchBloomBlur<1, 0>(Context, DestRenderTarget, DestRect, OffsetAndWeight, TintValue, NumSamples);
+		}
+	}
+
+	Context.RHICmdList.CopyToResolveTarget(DestRenderTarget.TargetableTexture, DestRenderTarget.ShaderResourceTexture, false, FResolveParams());
+}
+
+FPooledRenderTargetDesc FRCPassPostProcessBloomBlurCS::ComputeOutputDesc(EPassOutputId InPassOutputId) const
+{
+	FPooledRenderTargetDesc Ret = PassInputs[0].GetOutput()->RenderTargetDesc;
+
+	Ret.Reset();
+	Ret.TargetableFlags |= TexCreate_RenderTargetable | TexCreate_UAV;
+	Ret.DebugName = DebugName;
+
+	return Ret;
+}
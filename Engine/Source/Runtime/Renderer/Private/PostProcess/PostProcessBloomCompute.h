@@ -0,0 +1,60 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	PostProcessBloomCompute.h: Compute shader version of the bloom downsample chain and blur.
+=============================================================================*/
+
+#pragma once
+
+#include "RenderingCompositionGraph.h"
+#include "PostProcessWeightedSampleSum.h"
+
+/** Whether AddBloom should use the compute passes below, see r.Bloom.Compute. */
+extern bool UseComputeBloom(ERHIFeatureLevel::Type FeatureLevel);
+
+// derives from TRenderingCompositePassBase<InputCount, OutputCount>
+// ePId_Input0: bloom setup output, to downsample
+// ePId_Output0..3: the input downsampled 2, 4, 8 and 16 times, as FRCPassPostProcessDownsample would chain them
+class FRCPassPostProcessBloomDownsampleCS : public TRenderingCompositePassBase<1, 4>
+{
+public:
+	// interface FRenderingCompositePass ---------
+	virtual void Process(FRenderingCompositePassContext& Context);
+	virtual void Release() override { delete this; }
+	virtual FPooledRenderTargetDesc ComputeOutputDesc(EPassOutputId InPassOutputId) const;
+
+	// changing this number require PostProcessBloomCompute.usf to be recompiled
+	// texels of the first output a thread group computes per side, the following outputs get half as many each
+	static const uint32 ThreadGroupSize = 16;
+
+	static const uint32 NumOutputs = 4;
+};
+
+// derives from TRenderingCompositePassBase<InputCount, OutputCount>
+// ePId_Input0: texture to blur
+// ePId_Input1: optional additive input (usually the blurred lower resolution bloom)
+// One direction of the separable Gaussian of FRCPassPostProcessWeightedSampleSum, reading the rows (or columns) once into groupshared memory.
+class FRCPassPostProcessBloomBlurCS : public TRenderingCompositePassBase<2, 1>
+{
+public:
+	// constructor
+	FRCPassPostProcessBloomBlurCS(EFilterShape InFilterShape, float InSizeScale, const TCHAR* InDebugName, FLinearColor InTintValue = FLinearColor::White);
+
+	// interface FRenderingCompositePass ---------
+	virtual void Process(FRenderingCompositePassContext& Context);
+	virtual void Release() override { delete this; }
+	virtual FPooledRenderTargetDesc ComputeOutputDesc(EPassOutputId InPassOutputId) const;
+
+	// changing these numbers require PostProcessBloomCompute.usf to be recompiled
+	// texels along the filter direction a thread group computes
+	static const uint32 TileSize = 64;
+	// rows (or columns) a thread group computes
+	static const uint32 TileRows = 4;
+
+private:
+	// e.g. EFS_Horiz or EFS_Vert
+	EFilterShape FilterShape;
+	float SizeScale;
+	FLinearColor TintValue;
+	const TCHAR* DebugName;
+};
@@ -269,11 +269,7 @@ static float NormalDistributionUnscaled(float X,float Mean,float Variance)
 	return FMath::Exp(-FMath::Square(X - Mean) / (2.0f * Variance));
 }
 
-/**
- * @return NumSamples >0
- */
-
-static uint32 Compute1DGaussianFilterKernel(ERHIFeatureLevel::Type InFeatureLevel, float KernelRadius, FVector2D OutOffsetAndWeight[MAX_FILTER_SAMPLES], uint32 MaxFilterSamples)
+uint32 FRCPassPostProcessWeightedSampleSum::Compute1DGaussianFilterKernel(ERHIFeatureLevel::Type InFeatureLevel, float KernelRadius, FVector2D* OutOffsetAndWeight, uint32 MaxFilterSamples)
 {
 	float ClampedKernelRadius = FRCPassPostProcessWeightedSampleSum::GetClampedKernelRadius( InFeatureLevel, KernelRadius );
 	int32 IntegerKernelRadius = FRCPassPostProcessWeightedSampleSum::GetIntegerKernelRadius( InFeatureLevel, KernelRadius );
@@ -122,6 +122,13 @@ public:
 	static float GetClampedKernelRadius(ERHIFeatureLevel::Type InFeatureLevel, float KernelRadius);
 	static int GetIntegerKernelRadius(ERHIFeatureLevel::Type InFeatureLevel, float KernelRadius);
 
+	/**
+	 * Computes a normalized 1D Gaussian kernel where each sample is placed between two texels to use bilinear filtering.
+	 * @param OutOffsetAndWeight - MAX_FILTER_SAMPLES entries receiving the offset in texels (X) and the weight (Y) of the samples
+	 * @return number of samples, >0
+	 */
+	static uint32 Compute1DGaussianFilterKernel(ERHIFeatureLevel::Type InFeatureLevel, float KernelRadius, FVector2D* OutOffsetAndWeight, uint32 MaxFilterSamples);
+
 private:
 	void DrawQuad(FRHICommandListImmediate& RHICmdList, bool bDoFastBlur, FIntRect SrcRect, FIntRect DestRect, bool bRequiresClear, FIntPoint DestSize, FIntPoint SrcSize, FShader* VertexShader) const;
 	static uint32 GetMaxNumSamples(ERHIFeatureLevel::Type InFeatureLevel);
@@ -13,6 +13,7 @@
 #include "PostProcessInput.h"
 #include "PostProcessWeightedSampleSum.h"
 #include "PostProcessBloomSetup.h"
+#include "PostProcessBloomCompute.h"
 #include "PostProcessMobile.h"
 #include "PostProcessDownsample.h"
 #include "PostProcessHistogram.h"
@@ -167,6 +168,18 @@ static FRenderingCompositeOutputRef RenderBloom(
 	FLinearColor Tint = FLinearColor::White,
 	const FRenderingCompositeOutputRef Additive = FRenderingCompositeOutputRef())
 {
+	if (UseComputeBloom(Context.View.GetFeatureLevel()))
+	{
+		FRenderingCompositePass* BloomBlurX = Context.Graph.RegisterPass(new(FMemStack::Get()) FRCPassPostProcessBloomBlurCS(EFS_Horiz, Size, TEXT("BloomBlurX")));
+		BloomBlurX->SetInput(ePId_Input0, PreviousBloom);
+
+		FRenderingCompositePass* BloomBlurY = Context.Graph.RegisterPass(new(FMemStack::Get()) FRCPassPostProcessBloomBlurCS(EFS_Vert, Size, TEXT("BloomBlurY"), Tint));
+		BloomBlurY->SetInput(ePId_Input0, FRenderingCompositeOutputRef(BloomBlurX));
+		BloomBlurY->SetInput(ePId_Input1, Additive);
+
+		return FRenderingCompositeOutputRef(BloomBlurY);
+	}
+
 	return RenderGaussianBlur(Context, TEXT("BloomBlurX"), TEXT("BloomBlurY"), PreviousBloom, Size, Tint, Additive);
 }
 
@@ -410,14 +423,28 @@ static FRenderingCompositeOutputRef AddBloom(FPostprocessContext Context, FRende
 	// Perform down sample. Used by both bloom and lens flares.
 	static const int32 DownSampleStages = 5;
 	FRenderingCompositeOutputRef PostProcessDownsamples[DownSampleStages] = {PostProcessDownsample0};
-	for (int i = 1; i < DownSampleStages; i++)
+	if (UseComputeBloom(Context.View.GetFeatureLevel()))
+	{
+		// all the downsamples in one dispatch
+		static_assert(FRCPassPostProcessBloomDownsampleCS::NumOutputs == DownSampleStages - 1, "The compute downsample must output all the DownSampleStages.");
+		FRenderingCompositePass* Pass = Context.Graph.RegisterPass(new(FMemStack::Get()) FRCPassPostProcessBloomDownsampleCS());
+		Pass->SetInput(ePId_Input0, PostProcessDownsample0);
+		for (int i = 1; i < DownSampleStages; i++)
+		{
+			PostProcessDownsamples[i] = FRenderingCompositeOutputRef(Pass, (EPassOutputId)(ePId_Output0 + i - 1));
+		}
+	}
+	else
 	{
-		static const TCHAR* PassLabels[] =
-			{NULL, TEXT("BloomDownsample1"), TEXT("BloomDownsample2"), TEXT("BloomDownsample3"), TEXT("BloomDownsample4")};
-		static_assert(ARRAY_COUNT(PassLabels) == DownSampleStages, "PassLabel count must be equal to DownSampleStages.");
-		FRenderingCompositePass* Pass = Context.Graph.RegisterPass(new(FMemStack::Get()) FRCPassPostProcessDownsample(PF_Unknown, 1, PassLabels[i]));
-		Pass->SetInput(ePId_Input0, PostProcessDownsamples[i - 1]);
-		PostProcessDownsamples[i] = FRenderingCompositeOutputRef(Pass);
+		for (int i = 1; i < DownSampleStages; i++)
+		{
+			static const TCHAR* PassLabels[] =
+				{NULL, TEXT("BloomDownsample1"), TEXT("BloomDownsample2"), TEXT("BloomDownsample3"), TEXT("BloomDownsample4")};
+			static_assert(ARRAY_COUNT(PassLabels) == DownSampleStages, "PassLabel count must be equal to DownSampleStages.");
+			FRenderingCompositePass* Pass = Context.Graph.RegisterPass(new(FMemStack::Get()) FRCPassPostProcessDownsample(PF_Unknown, 1, PassLabels[i]));
+			Pass->SetInput(ePId_Input0, PostProcessDownsamples[i - 1]);
+			PostProcessDownsamples[i] = FRenderingCompositeOutputRef(Pass);
+		}
 	}
 
 	FRenderingCompositeOutputRef BloomOutput;
@@ -47,6 +47,15 @@ void RenderTargetPoolEvents(const TArray<FString>& Args)
 }
 
 // CVars and commands
+static TAutoConsoleVariable<int32> CVarRenderTargetPoolAliasCompatible(
+	TEXT("r.RenderTargetPool.AliasCompatible"),
+	1,
+	TEXT("If no free render target matches a request exactly, hand out a free one that has more targetable flags (e.g. UAV).\n")
+	TEXT("This lets targets that are only used for part of the frame share memory with other passes.\n")
+	TEXT(" 0: off, only exact matches\n")
+	TEXT(" 1: on (default)"),
+	ECVF_RenderThreadSafe);
+
 static FAutoConsoleCommand GRenderTargetPoolEventsCmd(
 	TEXT("r.RenderTargetPool.Events"),
 	TEXT("Visualize the render target pool events over time in one frame. Optional parameter defines threshold in KB.\n")
@@ -176,7 +185,8 @@ bool FRenderTargetPool::FindFreeElement(const FPooledRenderTargetDesc& Desc, TRe
 
 		const bool bExactMatch = true;
 
-		if(Out->GetDesc().Compare(Desc, bExactMatch))
+		// a target handed out by the compatible pass below doesn't match its request exactly, keep it or the caller loses its content every frame
+		if(Out->GetDesc().Compare(Desc, bExactMatch) || (CVarRenderTargetPoolAliasCompatible.GetValueOnRenderThread() && Out->GetDesc().IsCompatible(Desc)))
 		{
 			// we can reuse the same, but the debug name might have changed
 			Current->Desc.DebugName = InDebugName;
@@ -210,7 +220,7 @@ bool FRenderTargetPool::FindFreeElement(const FPooledRenderTargetDesc& Desc, TRe
 
 		// first we try exact, if that fails we try without TexCreate_FastVRAM
 		// (easily we can run out of VRam, if this search becomes a performance problem we can optimize or we should use less TexCreate_FastVRAM)
-		for(uint32 Pass = 0; Pass < PassCount; ++Pass)
+		for(uint32 Pass = 0; Pass < PassCount && !Found; ++Pass)
 		{
 			bool bExactMatch = (Pass == 0);
 
@@ -226,6 +236,22 @@ bool FRenderTargetPool::FindFreeElement(const FPooledRenderTargetDesc& Desc, TRe
 				}
 			}
 		}
+
+		// then a free element that can do more than requested, rather than creating a new one
+		if(!Found && CVarRenderTargetPoolAliasCompatible.GetValueOnRenderThread())
+		{
+			for(uint32 i = 0, Num = (uint32)PooledRenderTargets.Num(); i < Num; ++i)
+			{
+				FPooledRenderTarget* Element = PooledRenderTargets[i];
+
+				if(Element && Element->IsFree() && Element->GetDesc().IsCompatible(Desc))
+				{
+					Found = Element;
+					FoundIndex = i;
+					break;
+				}
+			}
+		}
 	}
 
 	if(!Found)
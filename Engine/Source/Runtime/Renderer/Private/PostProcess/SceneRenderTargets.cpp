@@ -179,6 +179,30 @@ FIntPoint FSceneRenderTargets::ComputeDesiredSize(const FSceneViewFamily& ViewFa
 			checkNoEntry();
 	}
 
+	// With the dynamic resolution the views only cover part of the targets. Allocate them for its max screen percentage, so they aren't reallocated when it changes
+	{
+		static const auto CVarDynamicResolution = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("r.DynamicResolution"));
+		static const auto CVarDynamicResolutionMax = IConsoleManager::Get().FindTConsoleVariableDataFloat(TEXT("r.DynamicResolution.MaxScreenPercentage"));
+
+		if (CVarDynamicResolution->GetValueOnRenderThread() != 0 && !bIsSceneCapture && !bIsReflectionCapture && ViewFamily.Views.Num() > 0)
+		{
+			const FSceneView* View = ViewFamily.Views[0];
+			const float ScreenPercentage = View->FinalPostProcessSettings.ScreenPercentage;
+
+			// The editor views ignore the screen percentage, see r.ScreenPercentage.Editor
+			const bool bScreenPercentageApplied = ScreenPercentage == 100.0f || View->ViewRect.Size() != View->UnscaledViewRect.Size();
+
+			if (ScreenPercentage > 0.0f && bScreenPercentageApplied)
+			{
+				const float Scale = FMath::Max(CVarDynamicResolutionMax->GetValueOnRenderThread(), ScreenPercentage) / ScreenPercentage;
+				const FIntPoint MaxSize(FMath::CeilToInt(ViewFamily.FamilySizeX * Scale), FMath::CeilToInt(ViewFamily.FamilySizeY * Scale));
+
+				// The truncation of the family size to whole pixels varies with the screen percentage, round up so it doesn't change the size
+				DesiredBufferSize = DesiredBufferSize.ComponentMax(FIntPoint::DivideAndRoundUp(MaxSize, 8) * 8);
+			}
+		}
+	}
+
 
 	// we want to shrink the buffer but as we can have multiple scenecaptures per frame we have to delay that a frame to get all size requests
 	{
@@ -373,21 +397,55 @@ inline uint16 GetNumSceneColorMSAASamples(ERHIFeatureLevel::Type InFeatureLevel)
 	return NumSamples;
 }
 
-void FSceneRenderTargets::AllocAHRTargets()
+// @RyanTorant
+static uint32 ComputeAHRTargetsMemorySize(const TRefCountPtr<IPooledRenderTarget>* Targets, int32 NumTargets)
+{
+	uint32 Size = 0;
+	for(int32 i = 0;i < NumTargets;i++)
+	{
+		if(Targets[i])
+			Size += Targets[i]->ComputeMemorySize();
+	}
+	return Size;
+}
+
+void FSceneRenderTargets::UpdateAHRTargetsMemoryStats()
 {
-	if(AHRRaytracingTarget[0]) return; // Already initialized
+	const uint32 RaytracingSize = ComputeAHRTargetsMemorySize(AHRRaytracingTarget, ARRAY_COUNT(AHRRaytracingTarget));
+	const uint32 UpsampledSize = ComputeAHRTargetsMemorySize(&AHRUpsampledTarget, 1);
+	const uint32 HistorySize =	ComputeAHRTargetsMemorySize(AHRHistory, ARRAY_COUNT(AHRHistory)) +
+								ComputeAHRTargetsMemorySize(&AHRHistoryScratch, 1);
+	const uint32 KernelSize =	ComputeAHRTargetsMemorySize(AHRPerPixelTracingKernel, ARRAY_COUNT(AHRPerPixelTracingKernel)) +
+								ComputeAHRTargetsMemorySize(AHRPerPixelInterpolationKernel, ARRAY_COUNT(AHRPerPixelInterpolationKernel)) +
+								ComputeAHRTargetsMemorySize(&AHRPerPixelInterpolationKernel_tmp, 1);
+
+	SET_MEMORY_STAT(STAT_AHRRaytracingTargetMemory, RaytracingSize);
+	SET_MEMORY_STAT(STAT_AHRUpsampledTargetMemory, UpsampledSize);
+	SET_MEMORY_STAT(STAT_AHRHistoryTargetMemory, HistorySize);
+	SET_MEMORY_STAT(STAT_AHRKernelTargetMemory, KernelSize);
+	AHRTargetsMemorySize = RaytracingSize + UpsampledSize + HistorySize + KernelSize;
+}
 
-	// Create the targets
+/** Desc of the trace, upsample and history targets. UAV so the compute trace (and the blur and the temporal accumulation) can write to them */
+static FPooledRenderTargetDesc GetAHRTraceTargetDesc(FIntPoint BufferSize)
+{
 	FPooledRenderTargetDesc Desc(FPooledRenderTargetDesc::Create2DDesc(BufferSize/2, PF_FloatRGBA, TexCreate_None, TexCreate_RenderTargetable | TexCreate_ShaderResource, false));
-	GRenderTargetPool.FindFreeElement(Desc, AHRRaytracingTarget[0], TEXT("RaytracingTarget0"));
-	GRenderTargetPool.FindFreeElement(Desc, AHRRaytracingTarget[1], TEXT("RaytracingTarget1"));
-	GRenderTargetPool.FindFreeElement(Desc, AHRRaytracingTarget[2], TEXT("RaytracingTarget2"));
-	GRenderTargetPool.FindFreeElement(Desc, AHRRaytracingTarget[3], TEXT("RaytracingTarget3"));
-	GRenderTargetPool.FindFreeElement(Desc, AHRRaytracingTarget[4], TEXT("RaytracingTarget4"));
-	GRenderTargetPool.FindFreeElement(Desc, AHRRaytracingTarget[5], TEXT("RaytracingTarget5"));
+	Desc.TargetableFlags |= TexCreate_UAV;
+	return Desc;
+}
 
-	GRenderTargetPool.FindFreeElement(Desc, AHRUpsampledTarget0, TEXT("AHRUpsampledTarget0"));
-	GRenderTargetPool.FindFreeElement(Desc, AHRUpsampledTarget1, TEXT("AHRUpsampledTarget1"));
+void FSceneRenderTargets::AllocAHRTargets()
+{
+	if(AHRHistoryScratch) return; // Already initialized
+
+	// Create the targets. The trace and upsample targets are only needed during the AHR lighting, see AllocAHRTransientTargets
+	const FPooledRenderTargetDesc TraceDesc = GetAHRTraceTargetDesc(BufferSize);
+	GRenderTargetPool.FindFreeElement(TraceDesc, AHRHistory[0], TEXT("AHRHistory0"));
+	GRenderTargetPool.FindFreeElement(TraceDesc, AHRHistory[1], TEXT("AHRHistory1"));
+	GRenderTargetPool.FindFreeElement(TraceDesc, AHRHistory[2], TEXT("AHRHistory2"));
+	GRenderTargetPool.FindFreeElement(TraceDesc, AHRHistory[3], TEXT("AHRHistory3"));
+	GRenderTargetPool.FindFreeElement(TraceDesc, AHRHistory[4], TEXT("AHRHistory4"));
+	GRenderTargetPool.FindFreeElement(TraceDesc, AHRHistoryScratch, TEXT("AHRHistoryScratch"));
 
 	// Create the kernel textures
 	FPooledRenderTargetDesc Desc2(FPooledRenderTargetDesc::Create2DDesc(BufferSize/2, PF_A2B10G10R10, TexCreate_None, TexCreate_UAV | TexCreate_ShaderResource, false));
@@ -404,10 +462,37 @@ void FSceneRenderTargets::AllocAHRTargets()
 	GRenderTargetPool.FindFreeElement(Desc2, AHRPerPixelInterpolationKernel[4], TEXT("AHRPerPixelInterpolationKernel4"));
 	GRenderTargetPool.FindFreeElement(Desc2, AHRPerPixelInterpolationKernel_tmp, TEXT("AHRPerPixelInterpolationKernel4"));
 
+	UpdateAHRTargetsMemoryStats();
+
 	// Fill the kernel textures
 	AHREngine.SignalWindowResize();
 }
 
+void FSceneRenderTargets::AllocAHRTransientTargets()
+{
+	const FPooledRenderTargetDesc TraceDesc = GetAHRTraceTargetDesc(BufferSize);
+	GRenderTargetPool.FindFreeElement(TraceDesc, AHRRaytracingTarget[0], TEXT("RaytracingTarget0"));
+	GRenderTargetPool.FindFreeElement(TraceDesc, AHRRaytracingTarget[1], TEXT("RaytracingTarget1"));
+	GRenderTargetPool.FindFreeElement(TraceDesc, AHRRaytracingTarget[2], TEXT("RaytracingTarget2"));
+	GRenderTargetPool.FindFreeElement(TraceDesc, AHRRaytracingTarget[3], TEXT("RaytracingTarget3"));
+	GRenderTargetPool.FindFreeElement(TraceDesc, AHRRaytracingTarget[4], TEXT("RaytracingTarget4"));
+	GRenderTargetPool.FindFreeElement(TraceDesc, AHRRaytracingTarget[5], TEXT("RaytracingTarget5"));
+
+	GRenderTargetPool.FindFreeElement(TraceDesc, AHRUpsampledTarget, TEXT("AHRUpsampledTarget"));
+
+	UpdateAHRTargetsMemoryStats();
+}
+
+void FSceneRenderTargets::ReleaseAHRTransientTargets(bool bKeepReflectionTarget, bool bKeepDiffuseTargets)
+{
+	// back to the pool, the memory can be handed out to the passes after the lighting
+	if(!bKeepDiffuseTargets)
+		for(int32 i = 0; i < 5; i++) AHRRaytracingTarget[i].SafeRelease();
+	if(!bKeepReflectionTarget)
+		AHRRaytracingTarget[5].SafeRelease();
+	AHRUpsampledTarget.SafeRelease();
+}
+
 void FSceneRenderTargets::AllocSceneColor()
 {
 	if (GetSceneColorForCurrentShadingPath())
@@ -1566,8 +1651,13 @@ void FSceneRenderTargets::ReleaseAllTargets()
 	EditorPrimitivesDepth.SafeRelease();
 
 	for(auto& t : AHRRaytracingTarget) t.SafeRelease();
-	AHRUpsampledTarget0.SafeRelease();
-	AHRUpsampledTarget1.SafeRelease();
+	AHRUpsampledTarget.SafeRelease();
+	for(auto& t : AHRHistory) t.SafeRelease();
+	AHRHistoryScratch.SafeRelease();
+	for(auto& t : AHRPerPixelTracingKernel) t.SafeRelease();
+	for(auto& t : AHRPerPixelInterpolationKernel) t.SafeRelease();
+	AHRPerPixelInterpolationKernel_tmp.SafeRelease();
+	UpdateAHRTargetsMemoryStats();
 }
 
 void FSceneRenderTargets::ReleaseDynamicRHI()
@@ -130,7 +130,8 @@ protected:
 		CurrentMobile32bpp(0),
 		bCurrentLightPropagationVolume(false),
 		CurrentFeatureLevel(ERHIFeatureLevel::Num),
-		CurrentShadingPath(EShadingPath::Num)
+		CurrentShadingPath(EShadingPath::Num),
+		AHRTargetsMemorySize(0)
 		{
 		}
 public:
@@ -426,6 +427,14 @@ public:
 
 	// @RyanTorant
 	void AllocAHRTargets();
+	/** Allocates the trace and upsample targets, which are only used from the AHR trace to the composite. */
+	void AllocAHRTransientTargets();
+	/** Returns the trace and upsample targets to the pool after the composite. The traces can be kept for the reflection environment to composite them. */
+	void ReleaseAHRTransientTargets(bool bKeepReflectionTarget = false, bool bKeepDiffuseTargets = false);
+	/** Sets the stat AHR memory counters of the AHR targets. */
+	void UpdateAHRTargetsMemoryStats();
+	/** Size in bytes of the AHR targets the last time the stats were updated. Includes the transient targets once they were allocated. */
+	uint32 GetAHRTargetsMemorySize() const { return AHRTargetsMemorySize; }
 
 	TRefCountPtr<IPooledRenderTarget>& GetReflectionBrightnessTarget();
 
@@ -450,12 +459,18 @@ public:
 	// @RyanTorant
 	// Targets for the AHR pass
 	// Format is R16G16B16A16_FLOAT, or PF_FloatRGBA in Epic's dictionary...
+	// Only valid between AllocAHRTransientTargets() and ReleaseAHRTransientTargets()
+	// The reflection trace, [5], is kept until the tiled deferred reflections when they blend it, see r.AHRTiledReflections
 	TRefCountPtr<IPooledRenderTarget> AHRRaytracingTarget[6];
-	TRefCountPtr<IPooledRenderTarget> AHRUpsampledTarget0;
-	TRefCountPtr<IPooledRenderTarget> AHRUpsampledTarget1;
+	// Output of the bilateral blur, swapped with the raytracing target it was blurred from
+	TRefCountPtr<IPooledRenderTarget> AHRUpsampledTarget;
 	TRefCountPtr<IPooledRenderTarget> AHRPerPixelTracingKernel[5];
 	TRefCountPtr<IPooledRenderTarget> AHRPerPixelInterpolationKernel[5];
 	TRefCountPtr<IPooledRenderTarget> AHRPerPixelInterpolationKernel_tmp;
+	// Temporal accumulation. The history holds the accumulated diffuse traces, the scratch target is swapped with it after every accumulation
+	// The reprojection and its rejection come from the FTemporalReprojection of the view
+	TRefCountPtr<IPooledRenderTarget> AHRHistory[5];
+	TRefCountPtr<IPooledRenderTarget> AHRHistoryScratch;
 
 	// GBuffer: Geometry Buffer rendered in base pass for deferred shading, only available between AllocGBufferTargets() and FreeGBufferTargets()
 	TRefCountPtr<IPooledRenderTarget> GBufferA;
@@ -625,6 +640,8 @@ private:
 	ERHIFeatureLevel::Type CurrentFeatureLevel;
 	/** Shading path that we are currently drawing through. Set when calling Allocate at the start of a scene render. */
 	EShadingPath CurrentShadingPath;
+	/** Total of the stat AHR target memory counters, see GetAHRTargetsMemorySize() */
+	uint32 AHRTargetsMemorySize;
 };
 
 /** The global render targets used for scene rendering. */
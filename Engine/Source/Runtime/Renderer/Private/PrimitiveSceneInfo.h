@@ -205,6 +205,10 @@ public:
 	/** This primitive has the Motion Blur explicitly disabled */
 	uint32 bVelocityIsSupressed : 1;
 
+	// @RyanTorant
+	/** Whether the primitive was added or moved and needs to be written to the AHR static volume on the next render. */
+	uint32 bAHRStaticVoxelizationDirty : 1;
+
 	/** The hit proxies used by the primitive. */
 	TArray<TRefCountPtr<HHitProxy> > HitProxies;
 
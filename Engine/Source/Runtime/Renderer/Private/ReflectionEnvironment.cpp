@@ -18,6 +18,7 @@
 #include "ShaderParameterUtils.h"
 #include "LightRendering.h"
 #include "SceneUtils.h"
+#include "ApproximateHybridRaytracing.h"
 
 /** Tile size for the reflection environment compute shader, tweaked for 680 GTX. */
 const int32 GReflectionEnvironmentTileSizeX = 16;
@@ -234,6 +235,8 @@ public:
 		PreIntegratedGFSampler.Bind(Initializer.ParameterMap, TEXT("PreIntegratedGFSampler"));
 		SkyLightParameters.Bind(Initializer.ParameterMap);
 		SpecularOcclusionParameters.Bind(Initializer.ParameterMap);
+		AHRCompositeParameters.Bind(Initializer.ParameterMap);
+		ApplyAHRComposite.Bind(Initializer.ParameterMap, TEXT("ApplyAHRComposite"));
 	}
 
 	FReflectionEnvironmentTiledDeferredCS()
@@ -334,6 +337,15 @@ public:
 	
 		SkyLightParameters.SetParameters(RHICmdList, ShaderRHI, Scene, View.Family->EngineShowFlags.SkyLighting);
 		SpecularOcclusionParameters.SetParameters(RHICmdList, ShaderRHI, DynamicBentNormalAO, CVarSkySpecularOcclusionStrength.GetValueOnRenderThread());
+
+		// The AHR lighting left its reflection trace to this pass, and its diffuse traces too when they were kept, see r.AHRTiledReflections
+		const bool bApplyAHRComposite = GSceneRenderTargets.AHRRaytracingTarget[5].IsValid();
+		if (bApplyAHRComposite)
+		{
+			const bool bApplyAHRGI = GSceneRenderTargets.AHRRaytracingTarget[0].IsValid();
+			AHRCompositeParameters.Set(RHICmdList, ShaderRHI, View, bApplyAHRGI ? AHRComposite_All : AHRComposite_Reflection);
+		}
+		SetShaderValue(RHICmdList, ShaderRHI, ApplyAHRComposite, bApplyAHRComposite ? 1 : 0);
 	}
 
 	void UnsetParameters(FRHICommandList& RHICmdList)
@@ -357,6 +369,8 @@ public:
 		Ar << PreIntegratedGFSampler;
 		Ar << SkyLightParameters;
 		Ar << SpecularOcclusionParameters;
+		Ar << AHRCompositeParameters;
+		Ar << ApplyAHRComposite;
 		return bShaderHasOutdatedParameters;
 	}
 
@@ -374,6 +388,8 @@ private:
 	FShaderResourceParameter PreIntegratedGFSampler;
 	FSkyLightReflectionParameters SkyLightParameters;
 	FDistanceFieldAOSpecularOcclusionParameters SpecularOcclusionParameters;
+	FAHRCompositeParameters AHRCompositeParameters;
+	FShaderParameter ApplyAHRComposite;
 };
 
 template< uint32 bUseLightmaps, uint32 bHalfRes >
@@ -693,6 +709,24 @@ bool FDeferredShadingSceneRenderer::ShouldDoReflectionEnvironment() const
 		&& (FeatureLevel == ERHIFeatureLevel::SM4 || Scene->ReflectionSceneData.CubemapArray.IsValid());
 }
 
+bool FDeferredShadingSceneRenderer::ShouldDoTiledDeferredReflections() const
+{
+	if (IsSimpleDynamicLightingEnabled() || ViewFamily.EngineShowFlags.VisualizeLightCulling)
+	{
+		return false;
+	}
+
+	for (int32 ViewIndex = 0, Num = Views.Num(); ViewIndex < Num; ViewIndex++)
+	{
+		if (Views[ViewIndex].bIsReflectionCapture)
+		{
+			return false;
+		}
+	}
+
+	return (FeatureLevel >= ERHIFeatureLevel::SM5) && ShouldDoReflectionEnvironment() && Scene->ReflectionSceneData.CubemapArray.IsValid();
+}
+
 void FDeferredShadingSceneRenderer::RenderTiledDeferredImageBasedReflections(FRHICommandListImmediate& RHICmdList, const TRefCountPtr<IPooledRenderTarget>& DynamicBentNormalAO)
 {
 	const uint32 bUseLightmaps = CVarDiffuseFromCaptures.GetValueOnRenderThread() == 0;
@@ -767,6 +801,9 @@ void FDeferredShadingSceneRenderer::RenderTiledDeferredImageBasedReflections(FRH
 		}
 	}
 
+	// Kept by the AHR lighting for this pass only
+	GSceneRenderTargets.ReleaseAHRTransientTargets();
+
 	GSceneRenderTargets.SetSceneColor(NewSceneColor);
 	check(GSceneRenderTargets.GetSceneColor());
 }
@@ -999,16 +1036,13 @@ void FDeferredShadingSceneRenderer::RenderDeferredReflections(FRHICommandListImm
 	}
 	else
 	{
-		const bool bReflectionEnvironment = ShouldDoReflectionEnvironment();
-		const bool bReflectionsWithCompute = (FeatureLevel >= ERHIFeatureLevel::SM5) && bReflectionEnvironment && Scene->ReflectionSceneData.CubemapArray.IsValid();
-
-		if (bReflectionsWithCompute)
+		if (ShouldDoTiledDeferredReflections())
 		{
 			RenderTiledDeferredImageBasedReflections(RHICmdList, DynamicBentNormalAO);
 		}
 		else
 		{
-			RenderStandardDeferredImageBasedReflections(RHICmdList, bReflectionEnvironment, DynamicBentNormalAO);
+			RenderStandardDeferredImageBasedReflections(RHICmdList, ShouldDoReflectionEnvironment(), DynamicBentNormalAO);
 		}
 	}
 }
\ No newline at end of file
@@ -14,6 +14,7 @@
 #include "PrecomputedLightVolume.h"
 #include "FXSystem.h"
 #include "DistanceFieldLightingShared.h"
+#include "ApproximateHybridRaytracing.h"
 
 // Enable this define to do slow checks for components being added to the wrong
 // world's scene, when using PIE. This can happen if a PIE component is reattached
@@ -28,6 +29,13 @@ TGlobalResource< FGlobalDistanceCullFadeUniformBuffer > GDistanceCullFadedInUnif
 
 SIZE_T FStaticMeshDrawListBase::TotalBytesUsed = 0;
 
+TAutoConsoleVariable<int32> CVarStaticDrawListMinDrawsPerCmdList(
+	TEXT("r.StaticDrawListMinDrawsPerCmdList"),
+	32,
+	TEXT("Minimum number of visible static meshes drawn by each parallel command list of a static draw list.\n")
+	TEXT("0 splits the drawing policies evenly across the command lists, without gathering the visible meshes first."),
+	ECVF_RenderThreadSafe);
+
 /** Default constructor. */
 FSceneViewState::FSceneViewState()
 	: OcclusionQueryPool(RQT_Occlusion)
@@ -59,6 +67,7 @@ FSceneViewState::FSceneViewState()
 	TemporalAASampleIndex = 0;
 	TemporalAASampleCount = 1;
 	AOTileIntersectionResources = NULL;
+	GlobalDistanceFieldModifiedBoundsSequence = 0;
 	bBokehDOFHistory = true;
 	bBokehDOFHistory2 = true;
 
@@ -80,6 +89,7 @@ FDistanceFieldSceneData::FDistanceFieldSceneData()
 	: NumObjectsInBuffer(0)
 	, ObjectBuffers(NULL)
 	, AtlasGeneration(0)
+	, PrimitiveModifiedBoundsBase(0)
 {
 
 }
@@ -106,11 +116,12 @@ void FDistanceFieldSceneData::AddPrimitive(FPrimitiveSceneInfo* InPrimitive)
 			checkSlow(!PendingAddOperations.Contains(InPrimitive));
 			checkSlow(!PendingUpdateOperations.Contains(InPrimitive));
 			PendingAddOperations.Add(InPrimitive);
+			AddModifiedBounds(Proxy->GetBounds().GetBox());
 		}
 	}
 }
 
-void FDistanceFieldSceneData::UpdatePrimitive(FPrimitiveSceneInfo* InPrimitive)
+void FDistanceFieldSceneData::UpdatePrimitive(FPrimitiveSceneInfo* InPrimitive, const FBox& PreviousBounds)
 {
 	const FPrimitiveSceneProxy* Proxy = InPrimitive->Proxy;
 
@@ -122,6 +133,8 @@ void FDistanceFieldSceneData::UpdatePrimitive(FPrimitiveSceneInfo* InPrimitive)
 		&& InPrimitive->DistanceFieldInstanceIndices.Num() > 0)
 	{
 		PendingUpdateOperations.Add(InPrimitive);
+		AddModifiedBounds(PreviousBounds);
+		AddModifiedBounds(Proxy->GetBounds().GetBox());
 	}
 }
 
@@ -148,6 +161,7 @@ void FDistanceFieldSceneData::RemovePrimitive(FPrimitiveSceneInfo* InPrimitive)
 		}
 
 		InPrimitive->DistanceFieldInstanceIndices.Empty();
+		AddModifiedBounds(Proxy->GetBounds().GetBox());
 	}
 
 	if (Proxy->SupportsHeightfieldRepresentation() && Proxy->AffectsDistanceFieldLighting())
@@ -156,6 +170,21 @@ void FDistanceFieldSceneData::RemovePrimitive(FPrimitiveSceneInfo* InPrimitive)
 	}
 }
 
+void FDistanceFieldSceneData::AddModifiedBounds(const FBox& Bounds)
+{
+	// Bound the log when no view state consumes it, view states that fall behind the trimmed entries do a full update
+	const int32 MaxModifiedBounds = 4096;
+
+	if (PrimitiveModifiedBounds.Num() >= MaxModifiedBounds)
+	{
+		const int32 NumTrimmed = MaxModifiedBounds / 2;
+		PrimitiveModifiedBounds.RemoveAt(0, NumTrimmed, false);
+		PrimitiveModifiedBoundsBase += NumTrimmed;
+	}
+
+	PrimitiveModifiedBounds.Add(Bounds);
+}
+
 void FDistanceFieldSceneData::Release()
 {
 	if (ObjectBuffers)
@@ -248,6 +277,7 @@ SIZE_T FScene::GetSizeBytes() const
 void FScene::CheckPrimitiveArrays()
 {
 	check(Primitives.Num() == PrimitiveBounds.Num());
+	check(Primitives.Num() == PrimitiveCullingBlocks.Num());
 	check(Primitives.Num() == PrimitiveVisibilityIds.Num());
 	check(Primitives.Num() == PrimitiveOcclusionFlags.Num());
 	check(Primitives.Num() == PrimitiveComponentIds.Num());
@@ -264,6 +294,7 @@ void FScene::AddPrimitiveSceneInfo_RenderThread(FRHICommandListImmediate& RHICmd
 	PrimitiveSceneInfo->PackedIndex = PrimitiveIndex;
 
 	PrimitiveBounds.AddUninitialized();
+	PrimitiveCullingBlocks.AddUninitialized();
 	PrimitiveVisibilityIds.AddUninitialized();
 	PrimitiveOcclusionFlags.AddUninitialized();
 	PrimitiveComponentIds.AddUninitialized();
@@ -494,11 +525,21 @@ void FScene::UpdatePrimitiveTransform_RenderThread(FRHICommandListImmediate& RHI
 	FScene* Scene = (FScene*)&PrimitiveSceneProxy->GetScene();
 
 	Scene->MotionBlurInfoData.UpdatePrimitiveMotionBlur(PrimitiveSceneProxy->GetPrimitiveSceneInfo());
+
+	// @RyanTorant
+	// The AHR static volume needs to be revoxelized both at the old and at the new location
+	if(PrimitiveSceneProxy->AffectsDynamicIndirectLighting() && !PrimitiveSceneProxy->NeedsEveryFrameVoxelization())
+	{
+		AHREngine.MarkStaticRegionDirty(PrimitiveSceneProxy->GetBounds());
+		PrimitiveSceneProxy->GetPrimitiveSceneInfo()->bAHRStaticVoxelizationDirty = true;
+	}
 	
+	const FBox PreviousBounds = PrimitiveSceneProxy->GetBounds().GetBox();
+
 	// Update the primitive transform.
 	PrimitiveSceneProxy->SetTransform(LocalToWorld, WorldBounds, LocalBounds, OwnerPosition);
 
-	DistanceFieldSceneData.UpdatePrimitive(PrimitiveSceneProxy->GetPrimitiveSceneInfo());
+	DistanceFieldSceneData.UpdatePrimitive(PrimitiveSceneProxy->GetPrimitiveSceneInfo(), PreviousBounds);
 
 	// If the primitive has static mesh elements, it should have returned true from ShouldRecreateProxyOnUpdateTransform!
 	check(!(bUpdateStaticDrawLists && PrimitiveSceneProxy->GetPrimitiveSceneInfo()->StaticMeshes.Num()));
@@ -668,6 +709,7 @@ void FScene::RemovePrimitiveSceneInfo_RenderThread(FPrimitiveSceneInfo* Primitiv
 	int32 PrimitiveIndex = PrimitiveSceneInfo->PackedIndex;
 	Primitives.RemoveAtSwap(PrimitiveIndex);
 	PrimitiveBounds.RemoveAtSwap(PrimitiveIndex);
+	PrimitiveCullingBlocks.RemoveAtSwap(PrimitiveIndex, PrimitiveBounds);
 	PrimitiveVisibilityIds.RemoveAtSwap(PrimitiveIndex);
 	PrimitiveOcclusionFlags.RemoveAtSwap(PrimitiveIndex);
 	PrimitiveComponentIds.RemoveAtSwap(PrimitiveIndex);
@@ -691,6 +733,13 @@ void FScene::RemovePrimitiveSceneInfo_RenderThread(FPrimitiveSceneInfo* Primitiv
 
 	DistanceFieldSceneData.RemovePrimitive(PrimitiveSceneInfo);
 
+	// @RyanTorant
+	// Remove the primitive voxels from the AHR static volume
+	if(PrimitiveSceneInfo->Proxy->AffectsDynamicIndirectLighting() && !PrimitiveSceneInfo->Proxy->NeedsEveryFrameVoxelization())
+	{
+		AHREngine.MarkStaticRegionDirty(PrimitiveSceneInfo->Proxy->GetBounds());
+	}
+
 	// free the primitive scene proxy.
 	delete PrimitiveSceneInfo->Proxy;
 }
@@ -1204,6 +1253,15 @@ void FScene::RemoveLightSceneInfo_RenderThread(FLightSceneInfo* LightSceneInfo)
 
 	if (LightSceneInfo->bVisible)
 	{
+		CachedWholeSceneShadows.Remove(LightSceneInfo);
+		for (TMap<FCachedShadowCascadeKey, FCachedShadowCascade>::TIterator It(CachedShadowCascades); It; ++It)
+		{
+			if (It.Key().LightSceneInfo == LightSceneInfo)
+			{
+				It.RemoveCurrent();
+			}
+		}
+
 		if (LightSceneInfo == SimpleDirectionalLight)
 		{
 			// if we are forward rendered and this light is a dynamic shadowcast then we need to update the static draw lists to pick a new lightingpolicy
@@ -2086,6 +2144,7 @@ void FScene::ApplyWorldOffset_RenderThread(FVector InOffset)
 	{
 		(*It).Origin+= InOffset;
 	}
+	PrimitiveCullingBlocks.ApplyWorldOffset(InOffset);
 
 	// Primitive occlusion bounds
 	for (auto It = PrimitiveOcclusionBounds.CreateIterator(); It; ++It)
@@ -2111,6 +2170,13 @@ void FScene::ApplyWorldOffset_RenderThread(FVector InOffset)
 		(*It)->ShadowBounds.Center+= InOffset;
 	}
 
+	// Cached cascades
+	for (auto It = CachedShadowCascades.CreateIterator(); It; ++It)
+	{
+		It.Value().Transforms.PreShadowTranslation-= InOffset;
+		It.Value().Transforms.ShadowBounds.Center+= InOffset;
+	}
+
 	// Decals
 	for (auto It = Decals.CreateIterator(); It; ++It)
 	{
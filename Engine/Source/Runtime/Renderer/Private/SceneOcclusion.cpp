@@ -40,6 +40,15 @@ static FAutoConsoleVariableRef CVarShowRelevantPrecomputedVisibilityCells(
 	ECVF_RenderThreadSafe
 	);
 
+static TAutoConsoleVariable<int32> CVarHZBOcclusionCompute(
+	TEXT("r.HZBOcclusion.Compute"),
+	1,
+	TEXT("Whether the HZB occlusion tests run in a compute shader when the feature level supports it.\n")
+	TEXT(" 0: Test the bounds in a pixel shader\n")
+	TEXT(" 1: Test the bounds in a compute shader (default)"),
+	ECVF_RenderThreadSafe
+	);
+
 #define NUM_CUBE_VERTICES 36
 
 /** Random table for occlusion **/
@@ -522,11 +531,8 @@ void FHZBOcclusionTester::InitDynamicRHI()
 {
 	if (GetFeatureLevel() >= ERHIFeatureLevel::SM4)
 	{
-#if PLATFORM_MAC // Workaround radr://16096028 Texture Readback via glReadPixels + PBOs stalls on Nvidia GPUs
+		// R8G8B8A8 as B8G8R8A8 can't be written by a compute shader, and readback via glReadPixels + PBOs of B8G8R8A8 stalls on Nvidia GPUs on Mac (radr://16096028)
 		FPooledRenderTargetDesc Desc( FPooledRenderTargetDesc::Create2DDesc( FIntPoint( SizeX, SizeY ), PF_R8G8B8A8, TexCreate_CPUReadback | TexCreate_HideInVisualizeTexture, TexCreate_None, false ) );
-#else
-		FPooledRenderTargetDesc Desc( FPooledRenderTargetDesc::Create2DDesc( FIntPoint( SizeX, SizeY ), PF_B8G8R8A8, TexCreate_CPUReadback | TexCreate_HideInVisualizeTexture, TexCreate_None, false ) );
-#endif
 		GRenderTargetPool.FindFreeElement( Desc, ResultsTextureCPU, TEXT("HZBResultsCPU") );
 	}
 }
@@ -673,6 +679,87 @@ public:
 
 IMPLEMENT_SHADER_TYPE(,FHZBTestPS,TEXT("HZBOcclusion"),TEXT("HZBTestPS"),SF_Pixel);
 
+class FHZBTestCS : public FGlobalShader
+{
+	DECLARE_SHADER_TYPE(FHZBTestCS, Global);
+
+public:
+	enum { ThreadGroupSize = 8 };
+
+	static bool ShouldCache(EShaderPlatform Platform)
+	{
+		return IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Platform, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), (uint32)ThreadGroupSize);
+	}
+
+	FHZBTestCS() {}
+
+	FShaderParameter				ResultsInvSizeParameter;
+	FShaderResourceParameter		HZBTexture;
+	FShaderResourceParameter		HZBSampler;
+	FShaderResourceParameter		BoundsCenterTexture;
+	FShaderResourceParameter		BoundsCenterSampler;
+	FShaderResourceParameter		BoundsExtentTexture;
+	FShaderResourceParameter		BoundsExtentSampler;
+	FRWShaderParameter				HZBResults;
+
+	FHZBTestCS(const ShaderMetaType::CompiledShaderInitializerType& Initializer)
+		: FGlobalShader(Initializer)
+	{
+		ResultsInvSizeParameter.Bind( Initializer.ParameterMap, TEXT("ResultsInvSize") );
+		HZBTexture.Bind( Initializer.ParameterMap, TEXT("HZBTexture") );
+		HZBSampler.Bind( Initializer.ParameterMap, TEXT("HZBSampler") );
+		BoundsCenterTexture.Bind( Initializer.ParameterMap, TEXT("BoundsCenterTexture") );
+		BoundsCenterSampler.Bind( Initializer.ParameterMap, TEXT("BoundsCenterSampler") );
+		BoundsExtentTexture.Bind( Initializer.ParameterMap, TEXT("BoundsExtentTexture") );
+		BoundsExtentSampler.Bind( Initializer.ParameterMap, TEXT("BoundsExtentSampler") );
+		HZBResults.Bind( Initializer.ParameterMap, TEXT("HZBResults") );
+	}
+
+	void SetParameters(FRHICommandList& RHICmdList, const FSceneView& View, const FHZB& HZB, FTextureRHIParamRef BoundsCenter, FTextureRHIParamRef BoundsExtent, FIntPoint ResultsSize, FUnorderedAccessViewRHIParamRef ResultsUAV )
+	{
+		const FComputeShaderRHIParamRef ShaderRHI = GetComputeShader();
+
+		FGlobalShader::SetParameters(RHICmdList, ShaderRHI, View );
+
+		const FVector2D ResultsInvSize( 1.0f / ResultsSize.X, 1.0f / ResultsSize.Y );
+		SetShaderValue(RHICmdList, ShaderRHI, ResultsInvSizeParameter, ResultsInvSize );
+
+		SetTextureParameter(RHICmdList, ShaderRHI, HZBTexture, HZBSampler, TStaticSamplerState<SF_Point,AM_Clamp,AM_Clamp,AM_Clamp>::GetRHI(), HZB.Texture->GetRenderTargetItem().ShaderResourceTexture );
+
+		SetTextureParameter(RHICmdList, ShaderRHI, BoundsCenterTexture, BoundsCenterSampler, TStaticSamplerState<SF_Point,AM_Clamp,AM_Clamp,AM_Clamp>::GetRHI(), BoundsCenter );
+		SetTextureParameter(RHICmdList, ShaderRHI, BoundsExtentTexture, BoundsExtentSampler, TStaticSamplerState<SF_Point,AM_Clamp,AM_Clamp,AM_Clamp>::GetRHI(), BoundsExtent );
+
+		HZBResults.SetTexture(RHICmdList, ShaderRHI, NULL, ResultsUAV);
+	}
+
+	void UnsetParameters(FRHICommandList& RHICmdList)
+	{
+		HZBResults.UnsetUAV(RHICmdList, GetComputeShader());
+	}
+
+	virtual bool Serialize(FArchive& Ar)
+	{
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize(Ar);
+		Ar << ResultsInvSizeParameter;
+		Ar << HZBTexture;
+		Ar << HZBSampler;
+		Ar << BoundsCenterTexture;
+		Ar << BoundsCenterSampler;
+		Ar << BoundsExtentTexture;
+		Ar << BoundsExtentSampler;
+		Ar << HZBResults;
+		return bShaderHasOutdatedParameters;
+	}
+};
+
+IMPLEMENT_SHADER_TYPE(,FHZBTestCS,TEXT("HZBOcclusion"),TEXT("HZBTestCS"),SF_Compute);
+
 void FHZBOcclusionTester::Submit(FRHICommandListImmediate& RHICmdList, const FViewInfo& View)
 {
 	SCOPED_DRAW_EVENT(RHICmdList, SubmitHZB);
@@ -693,17 +780,23 @@ void FHZBOcclusionTester::Submit(FRHICommandListImmediate& RHICmdList, const FVi
 		GRenderTargetPool.FindFreeElement( Desc, BoundsExtentTexture, TEXT("HZBBoundsExtent") );
 	}
 
+	const bool bUseCompute = View.GetFeatureLevel() >= ERHIFeatureLevel::SM5 && CVarHZBOcclusionCompute.GetValueOnRenderThread() != 0;
+
 	TRefCountPtr< IPooledRenderTarget >	ResultsTextureGPU;
 	{
-#if PLATFORM_MAC // Workaround radr://16096028 Texture Readback via glReadPixels + PBOs stalls on Nvidia GPUs
-		FPooledRenderTargetDesc Desc( FPooledRenderTargetDesc::Create2DDesc( FIntPoint( SizeX, SizeY ), PF_R8G8B8A8, TexCreate_None, TexCreate_RenderTargetable, false ) );
-
-#else
-		FPooledRenderTargetDesc Desc( FPooledRenderTargetDesc::Create2DDesc( FIntPoint( SizeX, SizeY ), PF_B8G8R8A8, TexCreate_None, TexCreate_RenderTargetable, false ) );
-#endif
+		FPooledRenderTargetDesc Desc( FPooledRenderTargetDesc::Create2DDesc( FIntPoint( SizeX, SizeY ), PF_R8G8B8A8, TexCreate_None, bUseCompute ? ( TexCreate_RenderTargetable | TexCreate_UAV ) : TexCreate_RenderTargetable, false ) );
 		GRenderTargetPool.FindFreeElement( Desc, ResultsTextureGPU, TEXT("HZBResultsGPU") );
 	}
 
+	// The bounds are stored in Morton order, so the first 4^n of them fill the 2^n x 2^n top left block. Only that block is uploaded and tested
+	const uint32 NumPrimitives = Primitives.Num();
+	uint32 BlockSize = bUseCompute ? FHZBTestCS::ThreadGroupSize : 1;
+	while( BlockSize * BlockSize < NumPrimitives )
+	{
+		BlockSize *= 2;
+	}
+	check( BlockSize <= SizeX && BlockSize <= SizeY );
+
 	{
 		static float CenterBuffer[ SizeX * SizeY ][4];
 		static float ExtentBuffer[ SizeX * SizeY ][4];
@@ -711,10 +804,10 @@ void FHZBOcclusionTester::Submit(FRHICommandListImmediate& RHICmdList, const FVi
 		{
 			QUICK_SCOPE_CYCLE_COUNTER(STAT_HZBPackPrimitiveData);
 			
-			FMemory::Memset( CenterBuffer, 0, sizeof( CenterBuffer ) );
-			FMemory::Memset( ExtentBuffer, 0, sizeof( ExtentBuffer ) );
+			// Rows of the block, the columns on their right are not uploaded
+			FMemory::Memset( CenterBuffer, 0, BlockSize * SizeX * sizeof( CenterBuffer[0] ) );
+			FMemory::Memset( ExtentBuffer, 0, BlockSize * SizeX * sizeof( ExtentBuffer[0] ) );
 
-			const uint32 NumPrimitives = Primitives.Num();
 			for( uint32 i = 0; i < NumPrimitives; i++ )
 			{
 				const FOcclusionPrimitive& Primitive = Primitives[i];
@@ -736,14 +829,31 @@ void FHZBOcclusionTester::Submit(FRHICommandListImmediate& RHICmdList, const FVi
 		}
 		
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_HZBUpdateTextures);
-		FUpdateTextureRegion2D Region( 0, 0, 0, 0, SizeX, SizeY );
+		FUpdateTextureRegion2D Region( 0, 0, 0, 0, BlockSize, BlockSize );
 		RHIUpdateTexture2D( (FTexture2DRHIRef&)BoundsCenterTexture->GetRenderTargetItem().ShaderResourceTexture, 0, Region, SizeX * 4 * sizeof( float ), (uint8*)CenterBuffer );
 		RHIUpdateTexture2D( (FTexture2DRHIRef&)BoundsExtentTexture->GetRenderTargetItem().ShaderResourceTexture, 0, Region, SizeX * 4 * sizeof( float ), (uint8*)ExtentBuffer );
 		Primitives.Empty();
 	}
 
-	// Draw test
+	if( bUseCompute )
+	{
+		SCOPED_DRAW_EVENT(RHICmdList, TestHZBCompute);
+
+		SetRenderTarget(RHICmdList, NULL, NULL);
+
+		TShaderMapRef< FHZBTestCS > ComputeShader(View.ShaderMap);
+		RHICmdList.SetComputeShader(ComputeShader->GetComputeShader());
+
+		ComputeShader->SetParameters(RHICmdList, View, ViewState->HZB, BoundsCenterTexture->GetRenderTargetItem().ShaderResourceTexture, BoundsExtentTexture->GetRenderTargetItem().ShaderResourceTexture, FIntPoint( SizeX, SizeY ), ResultsTextureGPU->GetRenderTargetItem().UAV );
+
+		const uint32 NumGroups = BlockSize / FHZBTestCS::ThreadGroupSize;
+		DispatchComputeShader(RHICmdList, *ComputeShader, NumGroups, NumGroups, 1);
+
+		ComputeShader->UnsetParameters(RHICmdList);
+	}
+	else
 	{
+		// Draw test
 		SCOPED_DRAW_EVENT(RHICmdList, TestHZB);
 
 		SetRenderTarget(RHICmdList, ResultsTextureGPU->GetRenderTargetItem().TargetableTexture, NULL);
@@ -758,13 +868,12 @@ void FHZBOcclusionTester::Submit(FRHICommandListImmediate& RHICmdList, const FVi
 
 		RHICmdList.SetViewport(0, 0, 0.0f, SizeX, SizeY, 1.0f);
 
-		// TODO draw quads covering blocks added above
 		DrawRectangle(
 			RHICmdList,
 			0, 0,
-			SizeX, SizeY,
+			BlockSize, BlockSize,
 			0, 0,
-			SizeX, SizeY,
+			BlockSize, BlockSize,
 			FIntPoint( SizeX, SizeY ),
 			FIntPoint( SizeX, SizeY ),
 			*VertexShader,
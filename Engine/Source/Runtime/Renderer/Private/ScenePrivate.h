@@ -70,6 +70,7 @@ bool IsMobileHDR32bpp();
 #include "ClearQuad.h"
 #include "SpeedTreeWind.h"
 #include "AtmosphereRendering.h"
+#include "TemporalReprojection.h"
 
 #if WITH_SLI || PLATFORM_SHOULD_BUFFER_QUERIES
 #define BUFFERED_OCCLUSION_QUERIES 1
@@ -548,6 +549,14 @@ public:
 	/** Distance field AO tile intersection GPU resources.  Last frame's state is not used, but they must be sized exactly to the view so stored here. */
 	class FTileIntersectionResources* AOTileIntersectionResources;
 
+	/** Global distance field clipmaps, updated incrementally as the view moves and the scene changes. */
+	FGlobalDistanceFieldClipmapState GlobalDistanceFieldClipmapState[GMaxGlobalDistanceFieldClipmaps];
+	/** Sequence number in FDistanceFieldSceneData::PrimitiveModifiedBounds up to which the clipmaps are up to date. */
+	uint32 GlobalDistanceFieldModifiedBoundsSequence;
+
+	/** Reprojection to the previous frame for the temporal passes that run before the velocities, see FTemporalReprojection. */
+	FTemporalReprojection TemporalReprojection;
+
 	// Is DOFHistoryRT set from Bokeh DOF?
 	bool bBokehDOFHistory;
 	bool bBokehDOFHistory2;
@@ -708,6 +717,14 @@ public:
 		LightShaftBloomHistoryRTs.Empty();
 		DistanceFieldAOHistoryRT.SafeRelease();
 		DistanceFieldIrradianceHistoryRT.SafeRelease();
+		TemporalReprojection.SafeRelease();
+
+		for (int32 ClipmapIndex = 0; ClipmapIndex < GMaxGlobalDistanceFieldClipmaps; ClipmapIndex++)
+		{
+			GlobalDistanceFieldClipmapState[ClipmapIndex].VolumeTexture.SafeRelease();
+			GlobalDistanceFieldClipmapState[ClipmapIndex].bValid = false;
+		}
+
 		MobileAaBloomSunVignette0.SafeRelease();
 		MobileAaBloomSunVignette1.SafeRelease();
 		MobileAaColor0.SafeRelease();
@@ -929,11 +946,14 @@ public:
 	~FDistanceFieldSceneData();
 
 	void AddPrimitive(FPrimitiveSceneInfo* InPrimitive);
-	void UpdatePrimitive(FPrimitiveSceneInfo* InPrimitive);
+	void UpdatePrimitive(FPrimitiveSceneInfo* InPrimitive, const FBox& PreviousBounds);
 	void RemovePrimitive(FPrimitiveSceneInfo* InPrimitive);
 	void Release();
 	void VerifyIntegrity();
 
+	/** Records a region where the distance fields changed, for the incremental updates of the global distance field. */
+	void AddModifiedBounds(const FBox& Bounds);
+
 	bool HasPendingOperations() const
 	{
 		return PendingAddOperations.Num() > 0 || PendingUpdateOperations.Num() > 0 || PendingRemoveOperations.Num() > 0;
@@ -953,6 +973,14 @@ public:
 
 	/** Used to detect atlas reallocations, since objects store UVs into the atlas and need to be updated when it changes. */
 	int32 AtlasGeneration;
+
+	/**
+	 * Bounds of the primitives added, removed or moved, oldest first. The global distance field of each view state
+	 * composites again the regions recorded since the sequence number it last updated with.
+	 */
+	TArray<FBox> PrimitiveModifiedBounds;
+	/** Sequence number of the first entry of PrimitiveModifiedBounds, advanced as old entries are trimmed. */
+	uint32 PrimitiveModifiedBoundsBase;
 };
 
 /** Stores data for an allocation in the FIndirectLightingCache. */
@@ -1145,6 +1173,87 @@ struct FPrimitiveBounds
 	float MaxDrawDistance;
 };
 
+/**
+ * The bounding spheres and draw distances of FScene::PrimitiveBounds, stored four primitives to a block with each field
+ * in its own vector, so frustum and distance culling can test four primitives at a time.
+ */
+class FPrimitiveCullingBlocks
+{
+public:
+	struct FBlock
+	{
+		float OriginX[4];
+		float OriginY[4];
+		float OriginZ[4];
+		float SphereRadius[4];
+		float MinDrawDistanceSq[4];
+		float MaxDrawDistance[4];
+	};
+
+	FPrimitiveCullingBlocks()
+		: NumPrimitives(0)
+	{
+	}
+
+	int32 Num() const { return NumPrimitives; }
+
+	/** Block holding the primitives from BlockIndex * 4, the lanes past the last primitive are left uninitialized */
+	const FBlock& GetBlock(int32 BlockIndex) const { return Blocks[BlockIndex]; }
+
+	void AddUninitialized()
+	{
+		if (NumPrimitives % 4 == 0)
+		{
+			Blocks.AddUninitialized();
+		}
+		NumPrimitives++;
+	}
+
+	void Set(int32 Index, const FPrimitiveBounds& Bounds)
+	{
+		FBlock& Block = Blocks[Index / 4];
+		const int32 Lane = Index % 4;
+		Block.OriginX[Lane] = Bounds.Origin.X;
+		Block.OriginY[Lane] = Bounds.Origin.Y;
+		Block.OriginZ[Lane] = Bounds.Origin.Z;
+		Block.SphereRadius[Lane] = Bounds.SphereRadius;
+		Block.MinDrawDistanceSq[Lane] = Bounds.MinDrawDistanceSq;
+		Block.MaxDrawDistance[Lane] = Bounds.MaxDrawDistance;
+	}
+
+	/** Same as TArray::RemoveAtSwap, the last primitive is moved to Index */
+	void RemoveAtSwap(int32 Index, const TArray<FPrimitiveBounds>& SwappedBounds)
+	{
+		NumPrimitives--;
+		if (Index < NumPrimitives)
+		{
+			Set(Index, SwappedBounds[Index]);
+		}
+		if (NumPrimitives % 4 == 0)
+		{
+			Blocks.Pop(false);
+		}
+	}
+
+	void ApplyWorldOffset(FVector InOffset)
+	{
+		for (int32 BlockIndex = 0; BlockIndex < Blocks.Num(); BlockIndex++)
+		{
+			FBlock& Block = Blocks[BlockIndex];
+			for (int32 Lane = 0; Lane < 4; Lane++)
+			{
+				Block.OriginX[Lane] += InOffset.X;
+				Block.OriginY[Lane] += InOffset.Y;
+				Block.OriginZ[Lane] += InOffset.Z;
+			}
+		}
+	}
+
+private:
+	TArray<FBlock> Blocks;
+	int32 NumPrimitives;
+};
+
 /**
  * Precomputed primitive visibility ID.
  */
@@ -1209,6 +1318,84 @@ public:
 	{}
 };
 
+/** Depths of a whole scene shadow kept across frames, re-rendered only when the light or its casters change. */
+class FCachedWholeSceneShadow
+{
+public:
+
+	/** Depth target the shadow was rendered to, with the shadow border around it. */
+	TRefCountPtr<IPooledRenderTarget> DepthTarget;
+
+	/** Key of the light and casters the depths were rendered with, see FProjectedShadowInfo::GetStaticSubjectKey. */
+	uint32 Key;
+
+	/** Frame the cache was last used, caches unused for a while are released. */
+	uint32 LastUsedFrame;
+
+	/** Whether DepthTarget has the depths that match Key. */
+	bool bDepthsValid;
+
+	FCachedWholeSceneShadow() :
+		Key(0),
+		LastUsedFrame(0),
+		bDepthsValid(false)
+	{}
+};
+
+/** Identifies a directional light cascade across frames. */
+struct FCachedShadowCascadeKey
+{
+	const FLightSceneInfo* LightSceneInfo;
+	const FSceneViewStateInterface* ViewState;
+	int32 SplitIndex;
+
+	FCachedShadowCascadeKey(const FLightSceneInfo* InLightSceneInfo, const FSceneViewStateInterface* InViewState, int32 InSplitIndex) :
+		LightSceneInfo(InLightSceneInfo),
+		ViewState(InViewState),
+		SplitIndex(InSplitIndex)
+	{}
+
+	friend bool operator==(const FCachedShadowCascadeKey& A, const FCachedShadowCascadeKey& B)
+	{
+		return A.LightSceneInfo == B.LightSceneInfo && A.ViewState == B.ViewState && A.SplitIndex == B.SplitIndex;
+	}
+
+	friend uint32 GetTypeHash(const FCachedShadowCascadeKey& Key)
+	{
+		return PointerHash(Key.LightSceneInfo, PointerHash(Key.ViewState, Key.SplitIndex));
+	}
+};
+
+/** Depths of a distant directional light cascade, reused for a few frames with the transforms they were rendered with. */
+class FCachedShadowCascade
+{
+public:
+
+	/** Depth target the cascade was rendered to, with the shadow border around it. */
+	TRefCountPtr<IPooledRenderTarget> DepthTarget;
+
+	/** Transforms the depths were rendered with. */
+	FShadowDepthTransforms Transforms;
+
+	/** Direction of the light when the depths were rendered. */
+	FVector LightDirection;
+
+	/** Frame the depths were rendered. */
+	uint32 RenderedFrame;
+
+	/** Frame the cache was last used, caches unused for a while are released. */
+	uint32 LastUsedFrame;
+
+	/** Whether DepthTarget has depths rendered with Transforms. */
+	bool bDepthsValid;
+
+	FCachedShadowCascade() :
+		RenderedFrame(0),
+		LastUsedFrame(0),
+		bDepthsValid(false)
+	{}
+};
+
 typedef TMap<FMaterial*, FMaterialShaderMap*> FMaterialsToUpdateMap;
 
 class FScene : public FSceneInterface
@@ -1297,6 +1484,8 @@ public:
 	TArray<FPrimitiveSceneInfo*> Primitives;
 	/** Packed array of primitive bounds. */
 	TArray<FPrimitiveBounds> PrimitiveBounds;
+	/** Copy of the spheres and draw distances of PrimitiveBounds laid out for culling four primitives at a time. */
+	FPrimitiveCullingBlocks PrimitiveCullingBlocks;
 	/** Packed array of precomputed primitive visibility IDs. */
 	TArray<FPrimitiveVisibilityId> PrimitiveVisibilityIds;
 	/** Packed array of primitive occlusion flags. See EOcclusionFlags. */
@@ -1361,6 +1550,12 @@ public:
 	/** Texture layout that tracks current allocations in the PreshadowCache render target. */
 	FTextureLayout PreshadowCacheLayout;
 
+	/** Whole scene shadow depths of lights whose casters are all static, see r.Shadow.CacheWholeSceneShadows. */
+	TMap<const FLightSceneInfo*, FCachedWholeSceneShadow> CachedWholeSceneShadows;
+
+	/** Distant directional light cascades whose depths are reused across frames, see r.Shadow.CSM.CacheUpdateInterval. */
+	TMap<FCachedShadowCascadeKey, FCachedShadowCascade> CachedShadowCascades;
+
 	/** The static meshes in the scene. */
 	TSparseArray<FStaticMesh*> StaticMeshes;
 
@@ -9,6 +9,7 @@
 #include "TextureLayout.h"
 #include "DistortionRendering.h"
 #include "CustomDepthRendering.h"
+#include "GlobalDistanceField.h"
 
 // Forward declarations.
 class FPostprocessContext;
@@ -378,6 +379,8 @@ public:
 	// @RyanTorant
 	/** The primitives sent to the voxelization stage */
 	TArray<const FPrimitiveSceneInfo*,SceneRenderingAllocator> PrimitivesToVoxelize;
+	/** The primitives smaller than a voxel, marked as a single voxel instead of voxelizing their elements */
+	TArray<const FPrimitiveSceneProxy*,SceneRenderingAllocator> PrimitivesToSplat;
 	struct AHRElementToVoxelize
 	{
 		AHRElementToVoxelize()
@@ -418,8 +421,8 @@ public:
 	/** The view's mesh elements for the foreground (editor gizmos and primitives )*/
 	TIndirectArray<FMeshBatch> TopViewMeshElements;
 
-	/** The dynamic resources used by the view elements. */
-	TArray<FDynamicPrimitiveResource*> DynamicResources;
+	/** The dynamic resources used by the view elements. Filled on the game thread. */
+	TArray<FDynamicPrimitiveResource*,SceneRenderingFrameAllocator> DynamicResources;
 
 	/** Gathered in initviews from all the primitives with dynamic view relevance, used in each mesh pass. */
 	TArray<FMeshBatchAndRelevance,SceneRenderingAllocator> DynamicMeshElements;
@@ -447,6 +450,9 @@ public:
 	float TranslucencyVolumeVoxelSize[TVC_MAX];
 	FVector TranslucencyLightingVolumeSize[TVC_MAX];
 
+	/** Global distance field clipmaps of the view, only initialized when a feature uses them. */
+	FGlobalDistanceFieldInfo GlobalDistanceFieldInfo;
+
 	/** true if the view has at least one mesh with a translucent material. */
 	uint32 bHasTranslucentViewMeshElements : 1;
 	/** Indicates whether previous frame transforms were reset this frame for any reason. */
@@ -662,6 +668,16 @@ protected:
 		const TArray<FProjectedShadowInfo*, SceneRenderingAllocator>& ViewDependentWholeSceneShadows,
 		bool bReflectionCaptureScene);
 
+	/** Returns whether a primitive that casts dynamic shadows is a subject of a view dependent whole scene shadow, can be called from any thread. */
+	bool IsViewDependentWholeSceneShadowSubject(const FPrimitiveSceneInfoCompact& PrimitiveSceneInfoCompact,
+		const FProjectedShadowInfo* ProjectedShadowInfo,
+		bool bReflectionCaptureScene) const;
+
+	/** Culls the subjects of view dependent whole scene shadows against the primitive octree on task threads, one task per shadow. */
+	void GatherViewDependentWholeSceneShadowPrimitivesParallel(
+		const TArray<FProjectedShadowInfo*, SceneRenderingAllocator>& ViewDependentWholeSceneShadows,
+		bool bReflectionCaptureScene);
+
 	/** Gets a readable light name for use with a draw event. */
 	static void GetLightNameForDrawEvent(const FLightSceneProxy* LightProxy, FString& LightNameWithLevel);
 
@@ -11,6 +11,7 @@
 #include "../../Engine/Private/SkeletalRenderGPUSkin.h"		// GPrevPerBoneMotionBlur
 #include "SceneUtils.h"
 #include "PostProcessing.h"
+#include "ParallelFor.h"
 // @RyanTorant
 #include "ApproximateHybridRaytracing.h"
 
@@ -103,6 +104,20 @@ static FAutoConsoleVariableRef CVarLODFadeTime( TEXT("r.LODFadeTime"), GFadeTime
 static float GDistanceFadeMaxTravel = 1000.0f;
 static FAutoConsoleVariableRef CVarDistanceFadeMaxTravel( TEXT("r.DistanceFadeMaxTravel"), GDistanceFadeMaxTravel, TEXT("Max distance that the player can travel during the fade time."), ECVF_RenderThreadSafe );
 
+static TAutoConsoleVariable<int32> CVarParallelInitViews(
+	TEXT("r.ParallelInitViews"),
+#if WITH_EDITOR
+	0,  
+#else
+	1,  
+#endif
+	TEXT("Toggles parallel init views."),
+	ECVF_RenderThreadSafe
+	);
+
+static int32 GFrustumCullNumWordsPerTask = 32;
+static FAutoConsoleVariableRef CVarFrustumCullNumWordsPerTask( TEXT("r.FrustumCullNumWordsPerTask"), GFrustumCullNumWordsPerTask, TEXT("Number of 32 primitive words of the visibility map frustum culled by each task when r.ParallelInitViews is on."), ECVF_RenderThreadSafe );
+
 /*------------------------------------------------------------------------------
 	Visibility determination.
 ------------------------------------------------------------------------------*/
@@ -222,6 +237,93 @@ bool FViewInfo::IsDistanceCulled( float DistanceSquared, float MinDrawDistance,
 	return ( bDistanceCulled && !bStillFading );
 }
 
+/**
+ * View constants for culling FScene::PrimitiveCullingBlocks four primitives at a time.
+ */
+struct FCullingBlockView
+{
+	/** X, Y, Z and W of each frustum plane, each replicated to a vector */
+	TArray<VectorRegister, TInlineAllocator<32> > Planes;
+	VectorRegister ViewOriginX;
+	VectorRegister ViewOriginY;
+	VectorRegister ViewOriginZ;
+	VectorRegister MaxDrawDistanceScale;
+	VectorRegister FadeRadius;
+	bool bCullMaxDrawDistance;
+
+	FCullingBlockView(const FViewInfo& View, const FVector& ViewOrigin, float InMaxDrawDistanceScale, float InFadeRadius)
+	{
+		const FConvexVolume::FPlaneArray& FrustumPlanes = View.ViewFrustum.Planes;
+		for (int32 PlaneIndex = 0; PlaneIndex < FrustumPlanes.Num(); PlaneIndex++)
+		{
+			const FPlane& Plane = FrustumPlanes[PlaneIndex];
+			Planes.Add(VectorSetFloat1(Plane.X));
+			Planes.Add(VectorSetFloat1(Plane.Y));
+			Planes.Add(VectorSetFloat1(Plane.Z));
+			Planes.Add(VectorSetFloat1(Plane.W));
+		}
+		ViewOriginX = VectorSetFloat1(ViewOrigin.X);
+		ViewOriginY = VectorSetFloat1(ViewOrigin.Y);
+		ViewOriginZ = VectorSetFloat1(ViewOrigin.Z);
+		MaxDrawDistanceScale = VectorSetFloat1(InMaxDrawDistanceScale);
+		FadeRadius = VectorSetFloat1(InFadeRadius);
+		// When cull distances are disabled, FrustumCull decides per primitive
+		bCullMaxDrawDistance = !View.Family->EngineShowFlags.DistanceCulledPrimitives;
+	}
+
+	/**
+	 * Returns the bits of a word of the visibility map whose primitives are outside the view frustum or their draw distance range.
+	 * The tests are the sphere and distance tests of FrustumCull, done without reading the rest of the primitive data.
+	 */
+	uint32 GetCulledBits(const FPrimitiveCullingBlocks& CullingBlocks, int32 WordIndex) const
+	{
+		const int32 BlocksPerWord = NumBitsPerDWORD / 4;
+		const int32 FirstBlock = WordIndex * BlocksPerWord;
+		const int32 LastBlock = FMath::Min(FirstBlock + BlocksPerWord, FMath::DivideAndRoundUp(CullingBlocks.Num(), 4));
+
+		uint32 CulledBits = 0;
+		for (int32 BlockIndex = FirstBlock; BlockIndex < LastBlock; BlockIndex++)
+		{
+			const FPrimitiveCullingBlocks::FBlock& Block = CullingBlocks.GetBlock(BlockIndex);
+			const VectorRegister OriginX = VectorLoad(Block.OriginX);
+			const VectorRegister OriginY = VectorLoad(Block.OriginY);
+			const VectorRegister OriginZ = VectorLoad(Block.OriginZ);
+			const VectorRegister SphereRadius = VectorLoad(Block.SphereRadius);
+
+			// Outside if the distance to any plane is more than the radius, as in FConvexVolume::IntersectSphere
+			VectorRegister Culled = VectorZero();
+			for (int32 PlaneIndex = 0; PlaneIndex < Planes.Num(); PlaneIndex += 4)
+			{
+				VectorRegister Distance = VectorMultiply(OriginX, Planes[PlaneIndex + 0]);
+				Distance = VectorMultiplyAdd(OriginY, Planes[PlaneIndex + 1], Distance);
+				Distance = VectorMultiplyAdd(OriginZ, Planes[PlaneIndex + 2], Distance);
+				Distance = VectorSubtract(Distance, Planes[PlaneIndex + 3]);
+				Culled = VectorBitwiseOr(Culled, VectorCompareGT(Distance, SphereRadius));
+			}
+
+			const VectorRegister ToViewX = VectorSubtract(OriginX, ViewOriginX);
+			const VectorRegister ToViewY = VectorSubtract(OriginY, ViewOriginY);
+			const VectorRegister ToViewZ = VectorSubtract(OriginZ, ViewOriginZ);
+			VectorRegister DistanceSquared = VectorMultiply(ToViewX, ToViewX);
+			DistanceSquared = VectorMultiplyAdd(ToViewY, ToViewY, DistanceSquared);
+			DistanceSquared = VectorMultiplyAdd(ToViewZ, ToViewZ, DistanceSquared);
+
+			Culled = VectorBitwiseOr(Culled, VectorCompareGT(VectorLoad(Block.MinDrawDistanceSq), DistanceSquared));
+			if (bCullMaxDrawDistance)
+			{
+				const VectorRegister FadeOutDistance = VectorMultiplyAdd(VectorLoad(Block.MaxDrawDistance), MaxDrawDistanceScale, FadeRadius);
+				Culled = VectorBitwiseOr(Culled, VectorCompareGT(DistanceSquared, VectorMultiply(FadeOutDistance, FadeOutDistance)));
+			}
+
+			MS_ALIGN(16) uint32 CulledLanes[4] GCC_ALIGN(16);
+			VectorStoreAligned(Culled, CulledLanes);
+			const uint32 LaneBits = (CulledLanes[0] & 1) | (CulledLanes[1] & 2) | (CulledLanes[2] & 4) | (CulledLanes[3] & 8);
+			CulledBits |= LaneBits << ((BlockIndex - FirstBlock) * 4);
+		}
+		return CulledBits;
+	}
+};
+
 /**
  * Frustum cull primitives in the scene against the view.
  */
@@ -230,59 +332,101 @@ static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FrustumCull);
 
-	int32 NumCulledPrimitives = 0;
-	FVector ViewOriginForDistanceCulling = View.ViewMatrices.ViewOrigin;
-	float MaxDrawDistanceScale = GetCachedScalabilityCVars().ViewDistanceScale;
-	float FadeRadius = GDisableLODFade ? 0.0f : GDistanceFadeMaxTravel;
-	uint8 CustomVisibilityFlags = EOcclusionFlags::CanBeOccluded | EOcclusionFlags::HasPrecomputedVisibility;
+	FThreadSafeCounter NumCulledPrimitives;
+	const FVector ViewOriginForDistanceCulling = View.ViewMatrices.ViewOrigin;
+	const float MaxDrawDistanceScale = GetCachedScalabilityCVars().ViewDistanceScale;
+	const float FadeRadius = GDisableLODFade ? 0.0f : GDistanceFadeMaxTravel;
+	const uint8 CustomVisibilityFlags = EOcclusionFlags::CanBeOccluded | EOcclusionFlags::HasPrecomputedVisibility;
+
+	// Each task culls whole words of the bit arrays, so no two tasks write to the same word
+	const int32 NumBits = View.PrimitiveVisibilityMap.Num();
+	const int32 NumWords = FMath::DivideAndRoundUp(NumBits, (int32)NumBitsPerDWORD);
+	const int32 NumWordsPerTask = FMath::Max(GFrustumCullNumWordsPerTask, 1);
+	const bool bParallel = CVarParallelInitViews.GetValueOnRenderThread() > 0 && FApp::ShouldUseThreadingForPerformance();
 
-	for (FSceneBitArray::FIterator BitIt(View.PrimitiveVisibilityMap); BitIt; ++BitIt)
+	uint32* VisibilityWords = View.PrimitiveVisibilityMap.GetData();
+	uint32* FadingWords = View.PotentiallyFadingPrimitiveMap.GetData();
+
+	const FCullingBlockView CullingBlockView(View, ViewOriginForDistanceCulling, MaxDrawDistanceScale, FadeRadius);
+
+	ParallelFor(FMath::DivideAndRoundUp(NumWords, NumWordsPerTask), [&](int32 TaskIndex)
 	{
-		const FPrimitiveBounds& Bounds = Scene->PrimitiveBounds[BitIt.GetIndex()];
-		float DistanceSquared = (Bounds.Origin - ViewOriginForDistanceCulling).SizeSquared();
-		float MaxDrawDistance = Bounds.MaxDrawDistance * MaxDrawDistanceScale;
-		int32 VisibilityId = INDEX_NONE;
+		int32 NumCulledInTask = 0;
+		const int32 LastWord = FMath::Min((TaskIndex + 1) * NumWordsPerTask, NumWords);
 
-		if (UseCustomCulling &&
-			((Scene->PrimitiveOcclusionFlags[BitIt.GetIndex()] & CustomVisibilityFlags) == CustomVisibilityFlags))
+		for (int32 WordIndex = TaskIndex * NumWordsPerTask; WordIndex < LastWord; WordIndex++)
 		{
-			VisibilityId = Scene->PrimitiveVisibilityIds[BitIt.GetIndex()].ByteIndex;
-		}
+			const int32 LastIndex = FMath::Min((WordIndex + 1) * (int32)NumBitsPerDWORD, NumBits);
+			uint32 VisibleBits = 0;
+			uint32 FadingBits = 0;
+			uint32 Mask = 1;
 
-		// If cull distance is disabled, always show (except foliage)
-		if (View.Family->EngineShowFlags.DistanceCulledPrimitives
-			&& !Scene->Primitives[BitIt.GetIndex()]->Proxy->IsDetailMesh())
-		{
-			MaxDrawDistance = FLT_MAX;
-		}
+			// Most primitives are culled by the block tests, only the others need their bounds and flags
+			const uint32 CulledBits = CullingBlockView.GetCulledBits(Scene->PrimitiveCullingBlocks, WordIndex);
 
-		// The primitive is always culled if it exceeds the max fade distance or lay outside the view frustum.
-		if (DistanceSquared > FMath::Square(MaxDrawDistance + FadeRadius) ||
-			DistanceSquared < Bounds.MinDrawDistanceSq ||
-			(UseCustomCulling && !View.CustomVisibilityQuery->IsVisible(VisibilityId, FBoxSphereBounds(Bounds.Origin, Bounds.BoxExtent, Bounds.SphereRadius))) ||
-			View.ViewFrustum.IntersectSphere(Bounds.Origin, Bounds.SphereRadius) == false ||
-			View.ViewFrustum.IntersectBox(Bounds.Origin, Bounds.BoxExtent) == false)
-		{
-			STAT(NumCulledPrimitives++);
-			continue;
-		}
+			for (int32 Index = WordIndex * NumBitsPerDWORD; Index < LastIndex; Index++, Mask <<= 1)
+			{
+				if (CulledBits & Mask)
+				{
+					STAT(NumCulledInTask++);
+					continue;
+				}
 
-		if (DistanceSquared > FMath::Square(MaxDrawDistance))
-		{
-			View.PotentiallyFadingPrimitiveMap.AccessCorrespondingBit(BitIt) = true;
+				const FPrimitiveBounds& Bounds = Scene->PrimitiveBounds[Index];
+				float DistanceSquared = (Bounds.Origin - ViewOriginForDistanceCulling).SizeSquared();
+				float MaxDrawDistance = Bounds.MaxDrawDistance * MaxDrawDistanceScale;
+				int32 VisibilityId = INDEX_NONE;
+
+				if (UseCustomCulling &&
+					((Scene->PrimitiveOcclusionFlags[Index] & CustomVisibilityFlags) == CustomVisibilityFlags))
+				{
+					VisibilityId = Scene->PrimitiveVisibilityIds[Index].ByteIndex;
+				}
+
+				// If cull distance is disabled, always show (except foliage)
+				if (View.Family->EngineShowFlags.DistanceCulledPrimitives
+					&& !Scene->Primitives[Index]->Proxy->IsDetailMesh())
+				{
+					MaxDrawDistance = FLT_MAX;
+				}
+
+				// The primitive is always culled if it exceeds the max fade distance or lay outside the view frustum.
+				if (DistanceSquared > FMath::Square(MaxDrawDistance + FadeRadius) ||
+					DistanceSquared < Bounds.MinDrawDistanceSq ||
+					(UseCustomCulling && !View.CustomVisibilityQuery->IsVisible(VisibilityId, FBoxSphereBounds(Bounds.Origin, Bounds.BoxExtent, Bounds.SphereRadius))) ||
+					View.ViewFrustum.IntersectSphere(Bounds.Origin, Bounds.SphereRadius) == false ||
+					View.ViewFrustum.IntersectBox(Bounds.Origin, Bounds.BoxExtent) == false)
+				{
+					STAT(NumCulledInTask++);
+					continue;
+				}
+
+				if (DistanceSquared > FMath::Square(MaxDrawDistance))
+				{
+					FadingBits |= Mask;
+				}
+				else
+				{
+					// The primitive is visible!
+					VisibleBits |= Mask;
+					if (DistanceSquared > FMath::Square(MaxDrawDistance - FadeRadius))
+					{
+						FadingBits |= Mask;
+					}
+				}
+			}
+
+			VisibilityWords[WordIndex] |= VisibleBits;
+			FadingWords[WordIndex] |= FadingBits;
 		}
-		else
+
+		if (NumCulledInTask)
 		{
-			// The primitive is visible!
-			BitIt.GetValue() = true;
-			if (DistanceSquared > FMath::Square(MaxDrawDistance - FadeRadius))
-			{
-				View.PotentiallyFadingPrimitiveMap.AccessCorrespondingBit(BitIt) = true;
-			}
+			NumCulledPrimitives.Add(NumCulledInTask);
 		}
-	}
+	}, !bParallel);
 
-	return NumCulledPrimitives;
+	return NumCulledPrimitives.GetValue();
 }
 
 /**
@@ -1155,17 +1299,6 @@ public:
 	}
 };
 
-static TAutoConsoleVariable<int32> CVarParallelInitViews(
-	TEXT("r.ParallelInitViews"),
-#if WITH_EDITOR
-	0,  
-#else
-	1,  
-#endif
-	TEXT("Toggles parallel init views."),
-	ECVF_RenderThreadSafe
-	);
-
 
 /**
  * Computes view relevance for visible primitives in the view and adds them to
@@ -1819,18 +1952,6 @@ void FSceneRenderer::ComputeViewVisibility(FRHICommandListImmediate& RHICmdList)
 		HasDynamicEditorMeshElementsMasks.AddZeroed(NumPrimitives);
 	}
 
-	// @RyanTorant
-	// Store all the primitives that need to be voxelized
-	if(UseApproximateHybridRaytracingRT(FeatureLevel))
-	{
-		for(auto primitive : Scene->Primitives)
-		{
-			FPrimitiveViewRelevance ViewRelevance = primitive->Proxy->GetViewRelevance(&Views[0]);
-			if(ViewRelevance.bNeedsVoxelization && ViewRelevance.bRenderInMainPass && !ViewRelevance.bEditorPrimitiveRelevance)
-				Views[0].PrimitivesToVoxelize.Add(primitive);
-		}
-	}
-
 	uint8 ViewBit = 0x1;
 	for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex, ViewBit <<= 1)
 	{
@@ -2158,6 +2279,196 @@ uint32 GetShadowQuality();
 	bRenderInMainPass = PrimitiveSceneProxy->ShouldRenderInMainPass();
 }*/
 
+// @RyanTorant
+/** A range of the scene primitives, tested for voxelization on a task thread. Uses the heap, as the mem stack is per thread */
+struct FAHRGatherPacket
+{
+	FAHRGatherPacket(const FScene* InScene, const FViewInfo& InView, const FBox& InGridBox, float InVoxelSize, int32 InFirstPrimitive, int32 InNumPrimitives)
+		: Scene(InScene)
+		, View(InView)
+		, GridBox(InGridBox)
+		, VoxelSize(InVoxelSize)
+		, FirstPrimitive(InFirstPrimitive)
+		, NumPrimitives(InNumPrimitives)
+	{
+	}
+
+	const FScene* Scene;
+	const FViewInfo& View;
+	FBox GridBox;
+	// Smallest side of a voxel in world space, 0 to voxelize every primitive at LOD 0
+	float VoxelSize;
+	int32 FirstPrimitive;
+	int32 NumPrimitives;
+
+	TArray<FPrimitiveSceneInfo*> Primitives;
+	TArray<FPrimitiveSceneInfo*> SplatPrimitives;
+	TArray<FViewInfo::AHRElementToVoxelize> StaticElements;
+
+	// The coarsest LOD whose triangles are still smaller than a voxel. The triangle size is estimated as if the triangles of the LOD covered the bounding sphere
+	int8 GetVoxelizationLOD(const FPrimitiveSceneInfo* PrimitiveSceneInfo, float SphereRadius) const
+	{
+		uint32 NumTriangles[MAX_STATIC_MESH_LODS] = {};
+		int8 MinLOD = MAX_STATIC_MESH_LODS;
+		int8 MaxLOD = 0;
+		for(auto& StaticMesh : PrimitiveSceneInfo->StaticMeshes)
+		{
+			if(StaticMesh.LODIndex >= 0 && StaticMesh.LODIndex < MAX_STATIC_MESH_LODS)
+			{
+				NumTriangles[StaticMesh.LODIndex] += StaticMesh.GetNumPrimitives();
+				MinLOD = FMath::Min(MinLOD,StaticMesh.LODIndex);
+				MaxLOD = FMath::Max(MaxLOD,StaticMesh.LODIndex);
+			}
+		}
+
+		// The first LODs have no static meshes while they are streamed out
+		int8 LODToVoxelize = FMath::Min(MinLOD,MaxLOD);
+		for(int8 LODIndex = LODToVoxelize + 1;LODIndex <= MaxLOD;LODIndex++)
+		{
+			if(NumTriangles[LODIndex] == 0)
+				continue;
+
+			const float TriangleSize = SphereRadius*FMath::Sqrt(4.0f*PI / NumTriangles[LODIndex]);
+			if(TriangleSize > VoxelSize)
+				break;
+			LODToVoxelize = LODIndex;
+		}
+		return LODToVoxelize;
+	}
+
+	void AnyThreadTask()
+	{
+		for(int32 PrimitiveIndex = FirstPrimitive;PrimitiveIndex < FirstPrimitive + NumPrimitives;PrimitiveIndex++)
+		{
+			// Check that the object is inside the grid first, it's cheaper than the relevance
+			const FPrimitiveBounds& Bounds = Scene->PrimitiveBounds[PrimitiveIndex];
+			if(!GridBox.Intersect(FBox::BuildAABB(Bounds.Origin,Bounds.BoxExtent)))
+				continue;
+
+			FPrimitiveSceneInfo* PrimitiveSceneInfo = Scene->Primitives[PrimitiveIndex];
+			FPrimitiveViewRelevance ViewRelevance = PrimitiveSceneInfo->Proxy->GetViewRelevance(&View);
+			if(ViewRelevance.bNeedsVoxelization && ViewRelevance.bRenderInMainPass && !ViewRelevance.bEditorPrimitiveRelevance)
+			{
+				// Rasterizing a primitive that fits in a voxel only costs triangles, it marks a single voxel anyway
+				if(Bounds.SphereRadius*2.0f < VoxelSize)
+				{
+					SplatPrimitives.Add(PrimitiveSceneInfo);
+					continue;
+				}
+
+				Primitives.Add(PrimitiveSceneInfo);
+
+				// The static meshes are stable pointers, only the dynamic elements need to be collected on the render thread
+				const int8 LODToVoxelize = GetVoxelizationLOD(PrimitiveSceneInfo,Bounds.SphereRadius);
+				for(auto& StaticMesh : PrimitiveSceneInfo->StaticMeshes)
+				{
+					if(StaticMesh.LODIndex == LODToVoxelize)
+						StaticElements.Add(FViewInfo::AHRElementToVoxelize(&StaticMesh,PrimitiveSceneInfo->Proxy));
+				}
+			}
+		}
+	}
+};
+
+class FAHRGatherPacketAnyThreadTask
+{
+	FAHRGatherPacket& Packet;
+public:
+
+	FAHRGatherPacketAnyThreadTask(FAHRGatherPacket& InPacket)
+		: Packet(InPacket)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FAHRGatherPacketAnyThreadTask, STATGROUP_TaskGraphTasks);
+	}
+
+	ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::TrackSubsequents; }
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		Packet.AnyThreadTask();
+	}
+};
+
+void FDeferredShadingSceneRenderer::GatherPrimitivesToVoxelize()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_GatherPrimitivesToVoxelize);
+
+	// The engine grid may not match the post process one if it follows the camera
+	const AHRGridSettings GridSettings = AHREngine.GetGridSettings();
+	const FBox GridBox = FBox::BuildAABB(GridSettings.Center,GridSettings.Bounds);
+	const FVector VoxelWorldSize = (GridSettings.Bounds*2.0f) / FVector(GridSettings.SliceSize.X,GridSettings.SliceSize.Y,GridSettings.SliceSize.Z);
+	const float VoxelSize = CVarAHRVoxelizationDetail.GetValueOnRenderThread() != 0 ? VoxelWorldSize.GetMin() : 0.0f;
+
+	FViewInfo& View = Views[0];
+	View.PrimitivesToVoxelize.Empty();
+	View.PrimitivesToSplat.Empty();
+	View.PrimitivesElementsToVoxelize.Empty();
+
+	// Split the scene in packets, the render thread takes the last one
+	const int32 NumPrimitives = Scene->Primitives.Num();
+	const int32 PrimitivesPerPacket = 1024;
+	const bool bParallel = FApp::ShouldUseThreadingForPerformance() && CVarParallelInitViews.GetValueOnRenderThread() > 0 && NumPrimitives > PrimitivesPerPacket;
+	const int32 NumPackets = bParallel ? FMath::DivideAndRoundUp(NumPrimitives,PrimitivesPerPacket) : 1;
+
+	TIndirectArray<FAHRGatherPacket> Packets;
+	Packets.Reserve(NumPackets);
+	FGraphEventArray PacketEvents;
+	for(int32 PacketIndex = 0;PacketIndex < NumPackets;PacketIndex++)
+	{
+		const int32 FirstPrimitive = PacketIndex*PrimitivesPerPacket;
+		const int32 PacketSize = bParallel ? FMath::Min(PrimitivesPerPacket,NumPrimitives - FirstPrimitive) : NumPrimitives;
+		FAHRGatherPacket* Packet = new FAHRGatherPacket(Scene,View,GridBox,VoxelSize,FirstPrimitive,PacketSize);
+		Packets.Add(Packet);
+
+		if(PacketIndex < NumPackets - 1)
+			PacketEvents.Add(TGraphTask<FAHRGatherPacketAnyThreadTask>::CreateTask(nullptr, ENamedThreads::RenderThread).ConstructAndDispatchWhenReady(*Packet));
+	}
+	Packets.Last().AnyThreadTask();
+
+	if(PacketEvents.Num() > 0)
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_GatherPrimitivesToVoxelize_Wait);
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(PacketEvents, ENamedThreads::RenderThread_Local);
+	}
+
+	// New or moved static primitives only need their bricks of the static volume revoxelized
+	auto MarkStaticRegionDirty = [](FPrimitiveSceneInfo* PrimitiveSceneInfo)
+	{
+		if(PrimitiveSceneInfo->bAHRStaticVoxelizationDirty && !PrimitiveSceneInfo->Proxy->NeedsEveryFrameVoxelization())
+		{
+			AHREngine.MarkStaticRegionDirty(PrimitiveSceneInfo->Proxy->GetBounds());
+			PrimitiveSceneInfo->bAHRStaticVoxelizationDirty = false;
+		}
+	};
+
+	// Merge in scene order
+	for(auto& Packet : Packets)
+	{
+		for(auto PrimitiveSceneInfo : Packet.Primitives)
+		{
+			View.PrimitivesToVoxelize.Add(PrimitiveSceneInfo);
+			MarkStaticRegionDirty(PrimitiveSceneInfo);
+		}
+		for(auto PrimitiveSceneInfo : Packet.SplatPrimitives)
+		{
+			View.PrimitivesToSplat.Add(PrimitiveSceneInfo->Proxy);
+			MarkStaticRegionDirty(PrimitiveSceneInfo);
+		}
+		View.PrimitivesElementsToVoxelize.Append(Packet.StaticElements);
+	}
+	SET_DWORD_STAT(STAT_AHRPrimitivesToVoxelize, View.PrimitivesToVoxelize.Num());
+	SET_DWORD_STAT(STAT_AHRSplattedPrimitives, View.PrimitivesToSplat.Num());
+}
+
 void FDeferredShadingSceneRenderer::GetElementsToVoxelize(FRHICommandListImmediate& RHICmdList)
 {
 	SCOPED_DRAW_EVENT(RHICmdList,GetElementsToVoxelize);
@@ -2172,19 +2483,13 @@ void FDeferredShadingSceneRenderer::GetElementsToVoxelize(FRHICommandListImmedia
 
 	MeshCollector.ClearViewMeshArrays();
 	MeshCollector.AddViewMeshArrays(&Views[0], &Views[0].__tmp_PrimitivesElementsToVoxelize, &DynamicSubjectSimpleElements, featureLevel);
-	Views[0].PrimitivesElementsToVoxelize.Empty();
 
-	// Loop trough all the primitives to voxelize and gather the elements for each
+	// The static elements were added by GatherPrimitivesToVoxelize. GetDynamicMeshElements allocates from the
+	// dynamic buffers and the mem stack, so the dynamic elements are gathered here, on the render thread
 	for(auto p : Views[0].PrimitivesToVoxelize)
 	{
-		// Get both static and dynamic elements
 		MeshCollector.SetPrimitive(p->Proxy, p->DefaultDynamicHitProxyId);
 		p->Proxy->GetDynamicMeshElements(ReusedViewsArray, ViewFamily, 0x1, MeshCollector);
-
-		for(auto& st : p->StaticMeshes)
-		{
-			Views[0].PrimitivesElementsToVoxelize.Add(FViewInfo::AHRElementToVoxelize(&st,p->Proxy));
-		}
 	}
 
 	// Now copy the meshes from the collector
@@ -1579,6 +1579,21 @@ void FProjectedShadowInfo::RenderDepthInner(FRHICommandList& RHICmdList, FSceneR
 	}
 }
 
+FViewInfo* FProjectedShadowInfo::FindViewForDepths(FSceneRenderer* SceneRenderer) const
+{
+	for (int32 ViewIndex = 0; ViewIndex < SceneRenderer->Views.Num(); ViewIndex++)
+	{
+		FViewInfo* CheckView = &SceneRenderer->Views[ViewIndex];
+		const FVisibleLightViewInfo& VisibleLightViewInfo = CheckView->VisibleLightInfos[LightSceneInfo->Id];
+		FPrimitiveViewRelevance ViewRel = VisibleLightViewInfo.ProjectedShadowViewRelevanceMap[ShadowId];
+		if (ViewRel.bShadowRelevance)
+		{
+			return CheckView;
+		}
+	}
+	return NULL;
+}
+
 void FProjectedShadowInfo::RenderDepth(FRHICommandList& RHICmdList, FSceneRenderer* SceneRenderer, TFunctionRef<void(FRHICommandList& RHICmdList)> SetShadowRenderTargets)
 {
 #if WANTS_DRAW_MESH_EVENTS
@@ -1591,18 +1606,7 @@ void FProjectedShadowInfo::RenderDepth(FRHICommandList& RHICmdList, FSceneRender
 	CONDITIONAL_SCOPE_CYCLE_COUNTER(STAT_RenderPerObjectShadowDepthsTime, !bWholeSceneShadow);
 
 	// Choose an arbitrary view where this shadow's subject is relevant.
-	FViewInfo* FoundView = NULL;
-	for (int32 ViewIndex = 0; ViewIndex < SceneRenderer->Views.Num(); ViewIndex++)
-	{
-		FViewInfo* CheckView = &SceneRenderer->Views[ViewIndex];
-		const FVisibleLightViewInfo& VisibleLightViewInfo = CheckView->VisibleLightInfos[LightSceneInfo->Id];
-		FPrimitiveViewRelevance ViewRel = VisibleLightViewInfo.ProjectedShadowViewRelevanceMap[ShadowId];
-		if (ViewRel.bShadowRelevance)
-		{
-			FoundView = CheckView;
-			break;
-		}
-	}
+	FViewInfo* FoundView = FindViewForDepths(SceneRenderer);
 	check(FoundView
 		&& IsInRenderingThread()); // we should not hack the view in parallel
 
@@ -2393,7 +2397,7 @@ FIntPoint FProjectedShadowInfo::GetShadowBufferResolution() const
 		return GSceneRenderTargets.GetTranslucentShadowDepthTextureResolution();
 	}
 
-	const FTexture2DRHIRef& ShadowTexture = GSceneRenderTargets.GetShadowDepthZTexture(bAllocatedInPreshadowCache);
+	const FTexture2DRHIRef& ShadowTexture = GetShadowDepthZTexture();
 
 	//prefer to return the actual size of the allocated texture if possible.  It may be larger than the size of a single shadowmap due to atlasing (see forward renderer CSM handling in InitDynamicShadows).
 	if (ShadowTexture)
@@ -2406,6 +2410,46 @@ FIntPoint FProjectedShadowInfo::GetShadowBufferResolution() const
 	}
 }
 
+const FTexture2DRHIRef& FProjectedShadowInfo::GetShadowDepthZTexture() const
+{
+	if (WholeSceneShadowCacheDepth)
+	{
+		return (const FTexture2DRHIRef&)WholeSceneShadowCacheDepth->GetRenderTargetItem().ShaderResourceTexture;
+	}
+	return GSceneRenderTargets.GetShadowDepthZTexture(bAllocatedInPreshadowCache);
+}
+
+FShadowDepthTransforms FProjectedShadowInfo::GetDepthTransforms() const
+{
+	FShadowDepthTransforms Transforms;
+	Transforms.PreShadowTranslation = PreShadowTranslation;
+	Transforms.ShadowViewMatrix = ShadowViewMatrix;
+	Transforms.SubjectAndReceiverMatrix = SubjectAndReceiverMatrix;
+	Transforms.ReceiverMatrix = ReceiverMatrix;
+	Transforms.InvReceiverMatrix = InvReceiverMatrix;
+	Transforms.ShadowBounds = ShadowBounds;
+	Transforms.MaxSubjectZ = MaxSubjectZ;
+	Transforms.MinSubjectZ = MinSubjectZ;
+	Transforms.InvMaxSubjectDepth = InvMaxSubjectDepth;
+	return Transforms;
+}
+
+void FProjectedShadowInfo::SetDepthTransforms(const FShadowDepthTransforms& Transforms)
+{
+	PreShadowTranslation = Transforms.PreShadowTranslation;
+	ShadowViewMatrix = Transforms.ShadowViewMatrix;
+	SubjectAndReceiverMatrix = Transforms.SubjectAndReceiverMatrix;
+	ReceiverMatrix = Transforms.ReceiverMatrix;
+	InvReceiverMatrix = Transforms.InvReceiverMatrix;
+	ShadowBounds = Transforms.ShadowBounds;
+	MaxSubjectZ = Transforms.MaxSubjectZ;
+	MinSubjectZ = Transforms.MinSubjectZ;
+	InvMaxSubjectDepth = Transforms.InvMaxSubjectDepth;
+
+	// The bias depends on the size of the bounds
+	UpdateShaderDepthBias();
+}
+
 void FProjectedShadowInfo::UpdateShaderDepthBias()
 {
 	float DepthBias = 0;
@@ -3197,6 +3241,7 @@ bool FDeferredShadingSceneRenderer::RenderProjectedShadows(FRHICommandListImmedi
 	// Find the projected shadows cast by this light.
 	FVisibleLightInfo& VisibleLightInfo = VisibleLightInfos[LightSceneInfo->Id];
 	TArray<FProjectedShadowInfo*, SceneRenderingAllocator> Shadows;
+	TArray<FProjectedShadowInfo*, SceneRenderingAllocator> CachedWholeSceneShadows;
 	for (int32 ShadowIndex = 0; ShadowIndex < VisibleLightInfo.AllProjectedShadows.Num(); ShadowIndex++)
 	{
 		FProjectedShadowInfo* ProjectedShadowInfo = VisibleLightInfo.AllProjectedShadows[ShadowIndex];
@@ -3227,6 +3272,13 @@ bool FDeferredShadingSceneRenderer::RenderProjectedShadows(FRHICommandListImmedi
 			bShadowIsVisible = false;
 		}
 
+		// Shadows whose depths are kept across frames are handled in RenderCachedWholeSceneShadows, cascades are allocated in InitDynamicShadows
+		if (bShadowIsVisible && (ProjectedShadowInfo->WholeSceneShadowCacheDepth || AllocateCachedWholeSceneShadow(ProjectedShadowInfo)))
+		{
+			CachedWholeSceneShadows.Add(ProjectedShadowInfo);
+			bShadowIsVisible = false;
+		}
+
 		if (bShadowIsVisible
 			&& (!ProjectedShadowInfo->bPreShadow || ProjectedShadowInfo->HasSubjectPrims())
 			&& !ProjectedShadowInfo->bAllocatedInPreshadowCache)
@@ -3318,21 +3370,11 @@ bool FDeferredShadingSceneRenderer::RenderProjectedShadows(FRHICommandListImmedi
 			GSceneRenderTargets.FinishRenderingShadowDepth(RHICmdList);
 
 			// @RyanTorant
-			bool injectIntoAHR = UseApproximateHybridRaytracingRT(FeatureLevel) && 
-								 ViewFamily.EngineShowFlags.GlobalIllumination && 
-								 LightSceneInfo->Proxy->NeedsLPVInjection();
-			if(injectIntoAHR)
+			if(ShouldInjectLightIntoAHR(LightSceneInfo) && Shadows[0]->bAllocated)
 			{
-				// Copy the texture to the AHR engine
+				// Copy the depths to the AHR shadow atlas
 				// Shadows are one frame behind
-				AHRLightData ldata;
-				// DEBUG!
-				ldata.ViewProj = FTranslationMatrix(Shadows[0]->PreShadowTranslation) *Shadows[0]->SubjectAndReceiverMatrix;
-				ldata.IsValid = true;
-				ldata.ViewportScaling = FVector2D(float(Shadows[0]->ResolutionX)/float(GSceneRenderTargets.GetShadowDepthTextureResolution().X),float(Shadows[0]->ResolutionY)/float(GSceneRenderTargets.GetShadowDepthTextureResolution().Y));
-
-				RHICmdList.CopyToResolveTarget(GSceneRenderTargets.GetShadowDepthZTexture(), AHREngine.GetCurrentShadowTexture(), true, FResolveRect());
-				AHREngine.AppendLight(ldata);
+				AHREngine.AppendLight(RHICmdList, *Shadows[0], GSceneRenderTargets.GetShadowDepthZTexture());
 			}
 		}
 
@@ -3380,6 +3422,11 @@ bool FDeferredShadingSceneRenderer::RenderProjectedShadows(FRHICommandListImmedi
 		}
 	}
 
+	if (CachedWholeSceneShadows.Num() > 0)
+	{
+		bAttenuationBufferDirty |= RenderCachedWholeSceneShadows(RHICmdList, LightSceneInfo, CachedWholeSceneShadows, bInjectedTranslucentVolume);
+	}
+
 	bAttenuationBufferDirty |= RenderCachedPreshadows(RHICmdList, LightSceneInfo);
 
 	if (Scene->GetFeatureLevel() >= ERHIFeatureLevel::SM4)
@@ -3390,6 +3437,100 @@ bool FDeferredShadingSceneRenderer::RenderProjectedShadows(FRHICommandListImmedi
 	return bAttenuationBufferDirty;
 }
 
+bool FDeferredShadingSceneRenderer::ShouldInjectLightIntoAHR(const FLightSceneInfo* LightSceneInfo) const
+{
+	bool injectIntoAHR = UseApproximateHybridRaytracingRT(FeatureLevel) && 
+						 ViewFamily.EngineShowFlags.GlobalIllumination && 
+						 LightSceneInfo->Proxy->NeedsLPVInjection();
+	if(injectIntoAHR)
+	{
+		// Lights that don't reach the grid would only waste space on the atlas
+		auto gridSettings = AHREngine.GetGridSettings();
+		injectIntoAHR = LightSceneInfo->Proxy->AffectsBounds(FBoxSphereBounds(FBox::BuildAABB(gridSettings.Center,gridSettings.Bounds)));
+	}
+	return injectIntoAHR;
+}
+
+/** Renders the depths of cached whole scene shadows whose light or casters changed, and renders the projections of all of them. */
+bool FDeferredShadingSceneRenderer::RenderCachedWholeSceneShadows(FRHICommandListImmediate& RHICmdList, const FLightSceneInfo* LightSceneInfo, const TArray<FProjectedShadowInfo*, SceneRenderingAllocator>& Shadows, bool& bInjectedTranslucentVolume)
+{
+	const bool bInjectIntoAHR = ShouldInjectLightIntoAHR(LightSceneInfo);
+
+	for (int32 ShadowIndex = 0; ShadowIndex < Shadows.Num(); ShadowIndex++)
+	{
+		FProjectedShadowInfo* ProjectedShadowInfo = Shadows[ShadowIndex];
+		const FSceneRenderTargetItem& DepthTarget = ProjectedShadowInfo->WholeSceneShadowCacheDepth->GetRenderTargetItem();
+		ProjectedShadowInfo->bAllocated = true;
+
+		if (ProjectedShadowInfo->bDepthsCached)
+		{
+			INC_DWORD_STAT(STAT_CachedWholeSceneShadows);
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_WholeSceneShadows);
+			SCOPED_DRAW_EVENTF(RHICmdList, EventShadowDepths, TEXT("Cached Whole Scene Shadow Depths"));
+
+			auto SetShadowRenderTargets = [&DepthTarget](FRHICommandList& RHICmdList)
+			{
+				SetRenderTarget(RHICmdList, FTextureRHIRef(), DepthTarget.TargetableTexture);
+			};
+
+			SetShadowRenderTargets(RHICmdList);  // run it now, maybe run it later for parallel command lists
+
+			ProjectedShadowInfo->ClearDepth(RHICmdList, this);
+			ProjectedShadowInfo->RenderDepth(RHICmdList, this, SetShadowRenderTargets);
+			ProjectedShadowInfo->bDepthsCached = true;
+
+			RHICmdList.CopyToResolveTarget(DepthTarget.TargetableTexture, DepthTarget.ShaderResourceTexture, false, FResolveParams());
+
+			if (ProjectedShadowInfo->IsWholeSceneDirectionalShadow())
+			{
+				const FCachedShadowCascadeKey CascadeKey(LightSceneInfo, ProjectedShadowInfo->DependentView->State, ProjectedShadowInfo->SplitIndex);
+				Scene->CachedShadowCascades.FindChecked(CascadeKey).bDepthsValid = true;
+			}
+			else
+			{
+				Scene->CachedWholeSceneShadows.FindChecked(LightSceneInfo).bDepthsValid = true;
+			}
+		}
+
+		// @RyanTorant
+		// The AHR shadow atlas is filled every frame, so the cached depths are copied to it like the ones in the shadow depth atlas
+		// Only the nearest cascade of directional lights goes to the atlas, and it is never cached
+		if (bInjectIntoAHR && !ProjectedShadowInfo->IsWholeSceneDirectionalShadow())
+		{
+			AHREngine.AppendLight(RHICmdList, *ProjectedShadowInfo, ProjectedShadowInfo->GetShadowDepthZTexture());
+		}
+	}
+
+	{
+		SCOPED_DRAW_EVENTF(RHICmdList, EventShadowProj, TEXT("Cached Whole Scene Shadow Projections"));
+		RenderProjections(RHICmdList, LightSceneInfo, Shadows);
+	}
+
+	for (int32 ShadowIndex = 0; ShadowIndex < Shadows.Num(); ShadowIndex++)
+	{
+		FProjectedShadowInfo* ProjectedShadowInfo = Shadows[ShadowIndex];
+
+		// Don't inject shadowed lighting with whole scene shadows used for previewing a light with static shadows,
+		// Since that would cause a mismatch with the built lighting
+		// However, stationary directional lights allow whole scene shadows that blend with precomputed shadowing
+		if (!LightSceneInfo->Proxy->HasStaticShadowing() || ProjectedShadowInfo->IsWholeSceneDirectionalShadow())
+		{
+			bInjectedTranslucentVolume = true;
+			SCOPED_DRAW_EVENT(RHICmdList, InjectTranslucentVolume);
+			// Inject the shadowed light into the translucency lighting volumes
+			InjectTranslucentVolumeLighting(RHICmdList, *LightSceneInfo, ProjectedShadowInfo);
+		}
+
+		ProjectedShadowInfo->bAllocated = false;
+		ProjectedShadowInfo->bRendered = true;
+	}
+
+	return true;
+}
+
 /** Renders preshadow depths for any preshadows whose depths aren't cached yet, and renders the projections of preshadows with opaque relevance. */
 bool FDeferredShadingSceneRenderer::RenderCachedPreshadows(FRHICommandListImmediate& RHICmdList, const FLightSceneInfo* LightSceneInfo)
 {
@@ -485,6 +485,20 @@ public:
 	bool bIsTwoSided;
 };
 
+/** The shadow space transforms of a whole scene shadow, kept with its cached depths so they can be projected in later frames. */
+struct FShadowDepthTransforms
+{
+	FVector PreShadowTranslation;
+	FMatrix ShadowViewMatrix;
+	FMatrix SubjectAndReceiverMatrix;
+	FMatrix ReceiverMatrix;
+	FMatrix InvReceiverMatrix;
+	FSphere ShadowBounds;
+	float MaxSubjectZ;
+	float MinSubjectZ;
+	float InvMaxSubjectDepth;
+};
+
 /**
  * Information about a projected shadow.
  */
@@ -620,6 +634,9 @@ public:
 	/** Frustums for each cubemap face, used for object culling one pass point light shadows. */
 	TArray<FConvexVolume> OnePassShadowFrustums;
 
+	/** Depth target of the light's cached whole scene shadow, if the shadow is in the cache its X and Y are 0 and its depths are rendered there. */
+	TRefCountPtr<IPooledRenderTarget> WholeSceneShadowCacheDepth;
+
 private:
 
 	/** dynamic shadow casting elements */
@@ -714,6 +731,13 @@ public:
 	*/
 	bool HasSubjectPrims() const;
 
+	/**
+	 * Computes a key of everything the shadow depths depend on, so they can be reused while it doesn't change.
+	 * @param View - the view the depths are rendered with, which selects the LODs of the subjects
+	 * @return false if some of the subjects can change from frame to frame without changing the key, like movable or dynamic primitives
+	 */
+	bool GetStaticSubjectKey(const FViewInfo& View, uint32& OutKey) const;
+
 	/**
 	 * Adds a primitive to the shadow's receiver list.
 	 */
@@ -731,6 +755,9 @@ public:
 	/** Clears arrays allocated with the scene rendering allocator. */
 	void ClearTransientArrays();
 	
+	/** Returns an arbitrary view where the shadow's subject is relevant, used to render the depths. */
+	FViewInfo* FindViewForDepths(class FSceneRenderer* SceneRenderer) const;
+
 	/** Hash function. */
 	friend uint32 GetTypeHash(const FProjectedShadowInfo* ProjectedShadowInfo)
 	{
@@ -746,6 +773,15 @@ public:
 	/** Returns the resolution of the shadow buffer used for this shadow, based on the shadow's type. */
 	FIntPoint GetShadowBufferResolution() const;
 
+	/** Returns the depth texture the shadow's depths were rendered to. */
+	const FTexture2DRHIRef& GetShadowDepthZTexture() const;
+
+	/** Returns the transforms the shadow's depths are rendered with. */
+	FShadowDepthTransforms GetDepthTransforms() const;
+
+	/** Overrides the shadow's transforms with the ones of depths rendered in a previous frame. */
+	void SetDepthTransforms(const FShadowDepthTransforms& Transforms);
+
 	/** Computes and updates ShaderDepthBias */
 	void UpdateShaderDepthBias();
 	/** How large the soft PCF comparison should be, similar to DepthBias, before this was called TransitionScale and 1/Size */
@@ -1064,7 +1100,7 @@ public:
 				FVector4(ShadowBufferSizeValue.X, ShadowBufferSizeValue.Y, 1.0f / ShadowBufferSizeValue.X, 1.0f / ShadowBufferSizeValue.Y));
 		}
 
-		FTexture2DRHIRef ShadowDepthTextureValue = GSceneRenderTargets.GetShadowDepthZTexture(ShadowInfo->bAllocatedInPreshadowCache);
+		FTexture2DRHIRef ShadowDepthTextureValue = ShadowInfo->GetShadowDepthZTexture();
 		FSamplerStateRHIParamRef DepthSamplerState = TStaticSamplerState<SF_Point,AM_Clamp,AM_Clamp,AM_Clamp>::GetRHI();
 
 		SetTextureParameter(RHICmdList, ShaderRHI, ShadowDepthTexture, ShadowDepthTextureSampler, DepthSamplerState, ShadowDepthTextureValue);		
@@ -8,6 +8,7 @@
 #include "ScenePrivate.h"
 #include "LightPropagationVolume.h"
 #include "ApproximateHybridRaytracing.h"
+#include "ParallelFor.h"
 
 static float GMinScreenRadiusForShadowCaster = 0.03f;
 static FAutoConsoleVariableRef CVarMinScreenRadiusForShadowCaster(
@@ -73,6 +74,47 @@ bool ShouldUseCachePreshadows()
 	return CVarCachePreshadows.GetValueOnRenderThread() != 0;
 }
 
+static TAutoConsoleVariable<int32> CVarCacheWholeSceneShadows(
+	TEXT("r.Shadow.CacheWholeSceneShadows"),
+	1,
+	TEXT("Whether the depths of spot light shadows whose casters are all static are kept across frames,\n")
+	TEXT("and only rendered again when the light or one of its casters changes"),
+	ECVF_RenderThreadSafe
+	);
+
+static TAutoConsoleVariable<int32> CVarCSMCacheUpdateInterval(
+	TEXT("r.Shadow.CSM.CacheUpdateInterval"),
+	4,
+	TEXT("Number of frames the depths of distant directional light cascades are reused for before they are rendered again.\n")
+	TEXT("Movable casters lag behind by up to that many frames in those cascades. 0 or 1 renders every cascade every frame."),
+	ECVF_RenderThreadSafe
+	);
+
+static TAutoConsoleVariable<int32> CVarCSMCacheFirstCascade(
+	TEXT("r.Shadow.CSM.CacheFirstCascade"),
+	2,
+	TEXT("Index of the first cascade whose depths can be reused across frames, see r.Shadow.CSM.CacheUpdateInterval"),
+	ECVF_RenderThreadSafe
+	);
+
+static TAutoConsoleVariable<float> CVarCSMCacheMaxMovement(
+	TEXT("r.Shadow.CSM.CacheMaxMovement"),
+	0.02f,
+	TEXT("How far a cascade can move, as a fraction of its radius, before its reused depths are rendered again.\n")
+	TEXT("The edge of the cascade that wasn't covered by the reused depths stays unshadowed until then."),
+	ECVF_RenderThreadSafe
+	);
+
+static TAutoConsoleVariable<int32> CVarParallelGatherShadowPrimitives(
+	TEXT("r.ParallelGatherShadowPrimitives"),
+	1,
+	TEXT("Toggles culling the casters of the view dependent whole scene shadows on task threads, one task per cascade"),
+	ECVF_RenderThreadSafe
+	);
+
+/** Number of frames a cached shadow is kept after it was last used. */
+static const uint32 CachedShadowMaxUnusedFrames = 60;
+
 /**
  * This value specifies how much bounds will be expanded when rendering a cached preshadow (0.15 = 15% larger).
  * Larger values result in more cache hits, but lower resolution and pull more objects into the depth pass.
@@ -856,6 +898,49 @@ bool FProjectedShadowInfo::HasSubjectPrims() const
 	return SubjectPrimitives.Num() > 0 || SubjectMeshElements.Num() > 0;
 }
 
+bool FProjectedShadowInfo::GetStaticSubjectKey(const FViewInfo& View, uint32& OutKey) const
+{
+	// Subjects without static meshes are drawn with dynamic mesh elements, which can change every frame
+	if (SubjectPrimitives.Num() > 0)
+	{
+		return false;
+	}
+
+	uint32 Key = FCrc::MemCrc32(&SubjectAndReceiverMatrix, sizeof(SubjectAndReceiverMatrix));
+	Key = FCrc::MemCrc32(&PreShadowTranslation, sizeof(PreShadowTranslation), Key);
+	Key = FCrc::MemCrc32(&ResolutionX, sizeof(ResolutionX), Key);
+	Key = FCrc::MemCrc32(&ResolutionY, sizeof(ResolutionY), Key);
+	Key = FCrc::MemCrc32(&ShaderDepthBias, sizeof(ShaderDepthBias), Key);
+
+	for (int32 ElementIndex = 0; ElementIndex < SubjectMeshElements.Num(); ElementIndex++)
+	{
+		const FShadowStaticMeshElement& Element = SubjectMeshElements[ElementIndex];
+		const FStaticMesh* StaticMesh = Element.Mesh;
+
+		// Only the LOD selected for the view is drawn
+		if (!View.StaticMeshShadowDepthMap[StaticMesh->Id])
+		{
+			continue;
+		}
+
+		const FPrimitiveSceneProxy* Proxy = StaticMesh->PrimitiveSceneInfo->Proxy;
+		if (Proxy->IsMovable() || Element.MaterialResource->MaterialModifiesMeshPosition_RenderThread())
+		{
+			return false;
+		}
+
+		// The proxy and its transform change when a static primitive is moved or re-registered
+		Key = PointerHash(Proxy, Key);
+		Key = PointerHash(Element.RenderProxy, Key);
+		Key = FCrc::MemCrc32(&Proxy->GetLocalToWorld(), sizeof(FMatrix), Key);
+		Key = FCrc::MemCrc32(&StaticMesh->Id, sizeof(StaticMesh->Id), Key);
+		Key = FCrc::MemCrc32(&View.StaticMeshBatchVisibility[StaticMesh->Id], sizeof(uint64), Key);
+	}
+
+	OutKey = Key;
+	return true;
+}
+
 void FProjectedShadowInfo::AddReceiverPrimitive(FPrimitiveSceneInfo* PrimitiveSceneInfo)
 {
 	// Add the primitive to the receiver primitive list.
@@ -1673,6 +1758,134 @@ void FDeferredShadingSceneRenderer::CreateWholeSceneProjectedShadow(FLightSceneI
 }
 }
 
+bool FDeferredShadingSceneRenderer::AllocateCachedWholeSceneShadow(FProjectedShadowInfo* ProjectedShadowInfo)
+{
+	const FLightSceneInfo* LightSceneInfo = ProjectedShadowInfo->LightSceneInfo;
+
+	// Only spot light shadows are cached, one pass point light shadows use the shared cube targets
+	if (!CVarCacheWholeSceneShadows.GetValueOnRenderThread()
+		|| !ProjectedShadowInfo->bWholeSceneShadow
+		|| ProjectedShadowInfo->bDirectionalLight
+		|| ProjectedShadowInfo->bOnePassPointLightShadow
+		|| ProjectedShadowInfo->bReflectiveShadowmap
+		|| ProjectedShadowInfo->bTranslucentShadow
+		|| ProjectedShadowInfo->bRayTracedDistanceFieldShadow
+		|| Views[0].bIsSceneCapture
+		|| FeatureLevel < ERHIFeatureLevel::SM4
+		|| !GSupportsDepthRenderTargetWithoutColorRenderTarget)
+	{
+		return false;
+	}
+
+	const FViewInfo* View = ProjectedShadowInfo->FindViewForDepths(this);
+	uint32 Key = 0;
+	if (!View || !ProjectedShadowInfo->GetStaticSubjectKey(*View, Key))
+	{
+		Scene->CachedWholeSceneShadows.Remove(LightSceneInfo);
+		return false;
+	}
+
+	FCachedWholeSceneShadow& CachedShadow = Scene->CachedWholeSceneShadows.FindOrAdd(LightSceneInfo);
+	const FIntPoint DepthTargetSize(ProjectedShadowInfo->ResolutionX + SHADOW_BORDER * 2, ProjectedShadowInfo->ResolutionY + SHADOW_BORDER * 2);
+
+	if (!CachedShadow.DepthTarget || CachedShadow.DepthTarget->GetDesc().Extent != DepthTargetSize)
+	{
+		FPooledRenderTargetDesc Desc(FPooledRenderTargetDesc::Create2DDesc(DepthTargetSize, PF_ShadowDepth, TexCreate_None, TexCreate_DepthStencilTargetable, false));
+		GRenderTargetPool.FindFreeElement(Desc, CachedShadow.DepthTarget, TEXT("CachedWholeSceneShadowDepthZ"));
+		CachedShadow.bDepthsValid = false;
+	}
+
+	ProjectedShadowInfo->X = 0;
+	ProjectedShadowInfo->Y = 0;
+	ProjectedShadowInfo->WholeSceneShadowCacheDepth = CachedShadow.DepthTarget;
+	ProjectedShadowInfo->bDepthsCached = CachedShadow.bDepthsValid && CachedShadow.Key == Key;
+
+	// Out of date depths are rendered this frame by RenderCachedWholeSceneShadows, which then marks them valid
+	CachedShadow.Key = Key;
+	CachedShadow.bDepthsValid = ProjectedShadowInfo->bDepthsCached;
+	CachedShadow.LastUsedFrame = ViewFamily.FrameNumber;
+	return true;
+}
+
+bool FDeferredShadingSceneRenderer::AllocateCachedShadowCascade(FProjectedShadowInfo* ProjectedShadowInfo)
+{
+	const uint32 UpdateInterval = FMath::Max(CVarCSMCacheUpdateInterval.GetValueOnRenderThread(), 0);
+	const FSceneViewStateInterface* ViewState = ProjectedShadowInfo->DependentView ? ProjectedShadowInfo->DependentView->State : NULL;
+
+	if (UpdateInterval <= 1
+		|| !ProjectedShadowInfo->IsWholeSceneDirectionalShadow()
+		|| ProjectedShadowInfo->bReflectiveShadowmap
+		|| ProjectedShadowInfo->bRayTracedDistanceFieldShadow
+		|| ProjectedShadowInfo->SplitIndex < CVarCSMCacheFirstCascade.GetValueOnRenderThread()
+		|| !ViewState
+		|| Views[0].bIsSceneCapture
+		|| FeatureLevel < ERHIFeatureLevel::SM4
+		|| !GSupportsDepthRenderTargetWithoutColorRenderTarget)
+	{
+		return false;
+	}
+
+	FCachedShadowCascade& CachedCascade = Scene->CachedShadowCascades.FindOrAdd(FCachedShadowCascadeKey(ProjectedShadowInfo->LightSceneInfo, ViewState, ProjectedShadowInfo->SplitIndex));
+	const FIntPoint DepthTargetSize(ProjectedShadowInfo->ResolutionX + SHADOW_BORDER * 2, ProjectedShadowInfo->ResolutionY + SHADOW_BORDER * 2);
+
+	if (!CachedCascade.DepthTarget || CachedCascade.DepthTarget->GetDesc().Extent != DepthTargetSize)
+	{
+		FPooledRenderTargetDesc Desc(FPooledRenderTargetDesc::Create2DDesc(DepthTargetSize, PF_ShadowDepth, TexCreate_None, TexCreate_DepthStencilTargetable, false));
+		GRenderTargetPool.FindFreeElement(Desc, CachedCascade.DepthTarget, TEXT("CachedShadowCascadeDepthZ"));
+		CachedCascade.bDepthsValid = false;
+	}
+
+	const FVector LightDirection = ProjectedShadowInfo->LightSceneInfo->Proxy->GetDirection();
+	const FSphere& Bounds = ProjectedShadowInfo->ShadowBounds;
+	const FSphere& CachedBounds = CachedCascade.Transforms.ShadowBounds;
+
+	// Reuse the depths until they are too old, or until the light or the cascade moved enough to show the difference
+	const bool bReuseDepths = CachedCascade.bDepthsValid
+		&& ViewFamily.FrameNumber - CachedCascade.RenderedFrame < UpdateInterval
+		&& LightDirection.Equals(CachedCascade.LightDirection)
+		&& FMath::IsNearlyEqual(Bounds.W, CachedBounds.W, Bounds.W * 0.01f)
+		&& FVector::DistSquared(Bounds.Center, CachedBounds.Center) <= FMath::Square(Bounds.W * CVarCSMCacheMaxMovement.GetValueOnRenderThread());
+
+	if (bReuseDepths)
+	{
+		ProjectedShadowInfo->SetDepthTransforms(CachedCascade.Transforms);
+	}
+	else
+	{
+		// The depths are rendered this frame by RenderCachedWholeSceneShadows if the cascade is visible, which then marks them valid
+		CachedCascade.Transforms = ProjectedShadowInfo->GetDepthTransforms();
+		CachedCascade.LightDirection = LightDirection;
+		CachedCascade.RenderedFrame = ViewFamily.FrameNumber;
+		CachedCascade.bDepthsValid = false;
+	}
+
+	ProjectedShadowInfo->X = 0;
+	ProjectedShadowInfo->Y = 0;
+	ProjectedShadowInfo->WholeSceneShadowCacheDepth = CachedCascade.DepthTarget;
+	ProjectedShadowInfo->bDepthsCached = bReuseDepths;
+	CachedCascade.LastUsedFrame = ViewFamily.FrameNumber;
+	return true;
+}
+
+void FDeferredShadingSceneRenderer::ReleaseUnusedCachedShadows()
+{
+	for (TMap<const FLightSceneInfo*, FCachedWholeSceneShadow>::TIterator It(Scene->CachedWholeSceneShadows); It; ++It)
+	{
+		if (ViewFamily.FrameNumber - It.Value().LastUsedFrame > CachedShadowMaxUnusedFrames)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (TMap<FCachedShadowCascadeKey, FCachedShadowCascade>::TIterator It(Scene->CachedShadowCascades); It; ++It)
+	{
+		if (ViewFamily.FrameNumber - It.Value().LastUsedFrame > CachedShadowMaxUnusedFrames)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
 void FSceneRenderer::InitProjectedShadowVisibility(FRHICommandListImmediate& RHICmdList)
 {
 	SCOPE_CYCLE_COUNTER(STAT_InitProjectedShadowVisibility);
@@ -1868,71 +2081,143 @@ inline void FSceneRenderer::GatherShadowsForPrimitiveInner(
 			{
 				FProjectedShadowInfo* RESTRICT ProjectedShadowInfo = ViewDependentWholeSceneShadows[ShadowIndex];
 
-				if ( ProjectedShadowInfo->bReflectiveShadowmap && !PrimitiveSceneInfoCompact.bAffectDynamicIndirectLighting )
+				if (IsViewDependentWholeSceneShadowSubject(PrimitiveSceneInfoCompact, ProjectedShadowInfo, bStaticSceneOnly))
 				{
-					continue;
-				}
-				if ( !ProjectedShadowInfo->bReflectiveShadowmap && !PrimitiveSceneInfoCompact.bCastDynamicShadow )
-				{
-					continue;
+					// Add this primitive to the shadow.
+					ProjectedShadowInfo->AddSubjectPrimitive(PrimitiveSceneInfo, NULL);
 				}
+			}
+		}
+	}
+}
 
-				FPrimitiveSceneProxy* PrimitiveProxy = PrimitiveSceneInfoCompact.Proxy;
-				FLightSceneProxy* RESTRICT LightProxy = ProjectedShadowInfo->LightSceneInfo->Proxy;
-
-				const FVector LightDirection = LightProxy->GetDirection();
-				const FVector PrimitiveToShadowCenter = ProjectedShadowInfo->ShadowBounds.Center - PrimitiveBounds.Origin;
-				// Project the primitive's bounds origin onto the light vector
-				const float ProjectedDistanceFromShadowOriginAlongLightDir = PrimitiveToShadowCenter | LightDirection;
-				// Calculate the primitive's squared distance to the cylinder's axis
-				const float PrimitiveDistanceFromCylinderAxisSq = (-LightDirection * ProjectedDistanceFromShadowOriginAlongLightDir + PrimitiveToShadowCenter).SizeSquared();
-
-				// Include all primitives for movable lights, but only statically shadowed primitives from a light with static shadowing,
-				// Since lights with static shadowing still create per-object shadows for primitives without static shadowing.
-				if( (!LightProxy->HasStaticLighting() || !ProjectedShadowInfo->LightSceneInfo->bPrecomputedLightingIsValid)
-					// Check if this primitive is in the shadow's cylinder
-					&& PrimitiveDistanceFromCylinderAxisSq < FMath::Square(ProjectedShadowInfo->ShadowBounds.W + PrimitiveBounds.SphereRadius)
-					// Check if the primitive is closer than the cylinder cap toward the light
-					&& ProjectedDistanceFromShadowOriginAlongLightDir - PrimitiveBounds.SphereRadius < -ProjectedShadowInfo->MinPreSubjectZ
-					// If the primitive is further along the cone axis than the shadow bounds origin, 
-					// Check if the primitive is inside the spherical cap of the cascade's bounds
-					&& !(ProjectedDistanceFromShadowOriginAlongLightDir < 0 
-						&& PrimitiveToShadowCenter.SizeSquared() > FMath::Square(ProjectedShadowInfo->ShadowBounds.W + PrimitiveBounds.SphereRadius)))
-				{
-					const bool bInFrustum = ProjectedShadowInfo->CascadeSettings.ShadowBoundsAccurate.IntersectBox( PrimitiveBounds.Origin, PrimitiveBounds.BoxExtent );
+bool FSceneRenderer::IsViewDependentWholeSceneShadowSubject(
+	const FPrimitiveSceneInfoCompact& PrimitiveSceneInfoCompact,
+	const FProjectedShadowInfo* ProjectedShadowInfo,
+	bool bStaticSceneOnly) const
+{
+	if ( ProjectedShadowInfo->bReflectiveShadowmap && !PrimitiveSceneInfoCompact.bAffectDynamicIndirectLighting )
+	{
+		return false;
+	}
+	if ( !ProjectedShadowInfo->bReflectiveShadowmap && !PrimitiveSceneInfoCompact.bCastDynamicShadow )
+	{
+		return false;
+	}
 
-					if( bInFrustum )
-					{
-						// Distance culling for RSMs
-						float MinScreenRadiusForShadowCaster = GMinScreenRadiusForShadowCaster;
-						if (ProjectedShadowInfo->bReflectiveShadowmap)
-						{
-							MinScreenRadiusForShadowCaster = GMinScreenRadiusForShadowCasterRSM;
-						}
+	const FBoxSphereBounds& PrimitiveBounds = PrimitiveSceneInfoCompact.Bounds;
+	const FPrimitiveSceneProxy* PrimitiveProxy = PrimitiveSceneInfoCompact.Proxy;
+	const FLightSceneProxy* RESTRICT LightProxy = ProjectedShadowInfo->LightSceneInfo->Proxy;
+
+	const FVector LightDirection = LightProxy->GetDirection();
+	const FVector PrimitiveToShadowCenter = ProjectedShadowInfo->ShadowBounds.Center - PrimitiveBounds.Origin;
+	// Project the primitive's bounds origin onto the light vector
+	const float ProjectedDistanceFromShadowOriginAlongLightDir = PrimitiveToShadowCenter | LightDirection;
+	// Calculate the primitive's squared distance to the cylinder's axis
+	const float PrimitiveDistanceFromCylinderAxisSq = (-LightDirection * ProjectedDistanceFromShadowOriginAlongLightDir + PrimitiveToShadowCenter).SizeSquared();
+
+	// Include all primitives for movable lights, but only statically shadowed primitives from a light with static shadowing,
+	// Since lights with static shadowing still create per-object shadows for primitives without static shadowing.
+	if( (!LightProxy->HasStaticLighting() || !ProjectedShadowInfo->LightSceneInfo->bPrecomputedLightingIsValid)
+		// Check if this primitive is in the shadow's cylinder
+		&& PrimitiveDistanceFromCylinderAxisSq < FMath::Square(ProjectedShadowInfo->ShadowBounds.W + PrimitiveBounds.SphereRadius)
+		// Check if the primitive is closer than the cylinder cap toward the light
+		&& ProjectedDistanceFromShadowOriginAlongLightDir - PrimitiveBounds.SphereRadius < -ProjectedShadowInfo->MinPreSubjectZ
+		// If the primitive is further along the cone axis than the shadow bounds origin, 
+		// Check if the primitive is inside the spherical cap of the cascade's bounds
+		&& !(ProjectedDistanceFromShadowOriginAlongLightDir < 0 
+			&& PrimitiveToShadowCenter.SizeSquared() > FMath::Square(ProjectedShadowInfo->ShadowBounds.W + PrimitiveBounds.SphereRadius)))
+	{
+		const bool bInFrustum = ProjectedShadowInfo->CascadeSettings.ShadowBoundsAccurate.IntersectBox( PrimitiveBounds.Origin, PrimitiveBounds.BoxExtent );
 
-						bool bScreenSpaceSizeCulled = false;
-						check( ProjectedShadowInfo->DependentView );
-						if ( ProjectedShadowInfo->DependentView ) 
-						{
-							const float DistanceSquared = ( PrimitiveBounds.Origin - ProjectedShadowInfo->DependentView->ShadowViewMatrices.ViewOrigin ).SizeSquared();
-							bScreenSpaceSizeCulled = FMath::Square( PrimitiveBounds.SphereRadius ) < FMath::Square( MinScreenRadiusForShadowCaster ) * DistanceSquared;
-						}
+		if( bInFrustum )
+		{
+			// Distance culling for RSMs
+			float MinScreenRadiusForShadowCaster = GMinScreenRadiusForShadowCaster;
+			if (ProjectedShadowInfo->bReflectiveShadowmap)
+			{
+				MinScreenRadiusForShadowCaster = GMinScreenRadiusForShadowCasterRSM;
+			}
 
-						if (ProjectedShadowInfo->LightSceneInfoCompact.AffectsPrimitive(PrimitiveSceneInfoCompact)
-							// Exclude primitives that will create their own per-object shadow, except when rendering RSMs
-							&& ( !PrimitiveProxy->CastsInsetShadow() || ProjectedShadowInfo->bReflectiveShadowmap )
-							// Exclude primitives that will create a per-object shadow from a stationary light
-							&& !ShouldCreateObjectShadowForStationaryLight(ProjectedShadowInfo->LightSceneInfo, PrimitiveSceneInfo->Proxy, true)
-							// Only render shadows from objects that use static lighting during a reflection capture, since the reflection capture doesn't update at runtime
-							&& (!bStaticSceneOnly || PrimitiveProxy->HasStaticLighting()) 
-							&& !bScreenSpaceSizeCulled )
-						{
-							// Add this primitive to the shadow.
-							ProjectedShadowInfo->AddSubjectPrimitive(PrimitiveSceneInfo, NULL);
-						}
+			bool bScreenSpaceSizeCulled = false;
+			check( ProjectedShadowInfo->DependentView );
+			if ( ProjectedShadowInfo->DependentView ) 
+			{
+				const float DistanceSquared = ( PrimitiveBounds.Origin - ProjectedShadowInfo->DependentView->ShadowViewMatrices.ViewOrigin ).SizeSquared();
+				bScreenSpaceSizeCulled = FMath::Square( PrimitiveBounds.SphereRadius ) < FMath::Square( MinScreenRadiusForShadowCaster ) * DistanceSquared;
+			}
+
+			return ProjectedShadowInfo->LightSceneInfoCompact.AffectsPrimitive(PrimitiveSceneInfoCompact)
+				// Exclude primitives that will create their own per-object shadow, except when rendering RSMs
+				&& ( !PrimitiveProxy->CastsInsetShadow() || ProjectedShadowInfo->bReflectiveShadowmap )
+				// Exclude primitives that will create a per-object shadow from a stationary light
+				&& !ShouldCreateObjectShadowForStationaryLight(ProjectedShadowInfo->LightSceneInfo, PrimitiveSceneInfoCompact.Proxy, true)
+				// Only render shadows from objects that use static lighting during a reflection capture, since the reflection capture doesn't update at runtime
+				&& (!bStaticSceneOnly || PrimitiveProxy->HasStaticLighting()) 
+				&& !bScreenSpaceSizeCulled;
+		}
+	}
+
+	return false;
+}
+
+void FSceneRenderer::GatherViewDependentWholeSceneShadowPrimitivesParallel(
+	const TArray<FProjectedShadowInfo*,SceneRenderingAllocator>& ViewDependentWholeSceneShadows,
+	bool bStaticSceneOnly
+	)
+{
+	// The tasks can't allocate from the rendering thread's mem stack, so the subjects are gathered in heap arrays
+	TArray<TArray<FPrimitiveSceneInfo*> > ShadowSubjects;
+	ShadowSubjects.SetNum(ViewDependentWholeSceneShadows.Num());
+
+	ParallelFor(ViewDependentWholeSceneShadows.Num(), [&](int32 ShadowIndex)
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_ShadowOctreeTraversal);
+		const FProjectedShadowInfo* ProjectedShadowInfo = ViewDependentWholeSceneShadows[ShadowIndex];
+		TArray<FPrimitiveSceneInfo*>& Subjects = ShadowSubjects[ShadowIndex];
+
+		for(FScenePrimitiveOctree::TConstIterator<> PrimitiveOctreeIt(Scene->PrimitiveOctree);
+			PrimitiveOctreeIt.HasPendingNodes();
+			PrimitiveOctreeIt.Advance())
+		{
+			const FScenePrimitiveOctree::FNode& PrimitiveOctreeNode = PrimitiveOctreeIt.GetCurrentNode();
+			const FOctreeNodeContext& PrimitiveOctreeNodeContext = PrimitiveOctreeIt.GetCurrentContext();
+
+			FOREACH_OCTREE_CHILD_NODE(ChildRef)
+			{
+				if(PrimitiveOctreeNode.HasChild(ChildRef))
+				{
+					const FOctreeNodeContext ChildContext = PrimitiveOctreeNodeContext.GetChildContext(ChildRef);
+					if(ProjectedShadowInfo->CasterFrustum.IntersectBox(
+						ChildContext.Bounds.Center + ProjectedShadowInfo->PreShadowTranslation,
+						ChildContext.Bounds.Extent
+						))
+					{
+						PrimitiveOctreeIt.PushChild(ChildRef);
 					}
 				}
 			}
+
+			for(FScenePrimitiveOctree::ElementConstIt NodePrimitiveIt(PrimitiveOctreeNode.GetElementIt());NodePrimitiveIt;++NodePrimitiveIt)
+			{
+				const FPrimitiveSceneInfoCompact& PrimitiveSceneInfoCompact = *NodePrimitiveIt;
+				if (PrimitiveSceneInfoCompact.bCastDynamicShadow && IsViewDependentWholeSceneShadowSubject(PrimitiveSceneInfoCompact, ProjectedShadowInfo, bStaticSceneOnly))
+				{
+					Subjects.Add(PrimitiveSceneInfoCompact.PrimitiveSceneInfo);
+				}
+			}
+		}
+	});
+
+	// Adding the subjects writes to the relevance map of the view, which is shared by all its cascades
+	for (int32 ShadowIndex = 0; ShadowIndex < ViewDependentWholeSceneShadows.Num(); ShadowIndex++)
+	{
+		FProjectedShadowInfo* ProjectedShadowInfo = ViewDependentWholeSceneShadows[ShadowIndex];
+		const TArray<FPrimitiveSceneInfo*>& Subjects = ShadowSubjects[ShadowIndex];
+
+		for (int32 SubjectIndex = 0; SubjectIndex < Subjects.Num(); SubjectIndex++)
+		{
+			ProjectedShadowInfo->AddSubjectPrimitive(Subjects[SubjectIndex], NULL);
 		}
 	}
 }
@@ -1956,6 +2241,19 @@ void FSceneRenderer::GatherShadowPrimitives(
 			ProjectedShadowInfo->StaticMeshWholeSceneShadowBatchVisibility.AddZeroed(Scene->StaticMeshes.GetMaxIndex());
 		}
 
+		// The cascades each traverse the octree on their own task, the preshadows are left to the traversal below
+		const TArray<FProjectedShadowInfo*,SceneRenderingAllocator> NoViewDependentWholeSceneShadows;
+		const bool bParallelGather = ViewDependentWholeSceneShadows.Num() > 1
+			&& CVarParallelGatherShadowPrimitives.GetValueOnRenderThread() > 0
+			&& FApp::ShouldUseThreadingForPerformance();
+
+		if (bParallelGather)
+		{
+			GatherViewDependentWholeSceneShadowPrimitivesParallel(ViewDependentWholeSceneShadows, bStaticSceneOnly);
+		}
+
+		const TArray<FProjectedShadowInfo*,SceneRenderingAllocator>& SerialViewDependentWholeSceneShadows = bParallelGather ? NoViewDependentWholeSceneShadows : ViewDependentWholeSceneShadows;
+
 		// Find primitives that are in a shadow frustum in the octree.
 		for(FScenePrimitiveOctree::TConstIterator<SceneRenderingAllocator> PrimitiveOctreeIt(Scene->PrimitiveOctree);
 			PrimitiveOctreeIt.HasPendingNodes();
@@ -1996,9 +2294,9 @@ void FSceneRenderer::GatherShadowPrimitives(
 
 						if (!bIsInFrustum)
 						{
-							for(int32 ShadowIndex = 0, Num = ViewDependentWholeSceneShadows.Num(); ShadowIndex < Num; ShadowIndex++)
+							for(int32 ShadowIndex = 0, Num = SerialViewDependentWholeSceneShadows.Num(); ShadowIndex < Num; ShadowIndex++)
 							{
-								FProjectedShadowInfo* ProjectedShadowInfo = ViewDependentWholeSceneShadows[ShadowIndex];
+								FProjectedShadowInfo* ProjectedShadowInfo = SerialViewDependentWholeSceneShadows[ShadowIndex];
 
 								// Check if this primitive is in the shadow's frustum.
 								if(ProjectedShadowInfo->CasterFrustum.IntersectBox(
@@ -2026,7 +2324,7 @@ void FSceneRenderer::GatherShadowPrimitives(
 			for(FScenePrimitiveOctree::ElementConstIt NodePrimitiveIt(PrimitiveOctreeNode.GetElementIt());NodePrimitiveIt;++NodePrimitiveIt)
 			{
 				// gather the shadows for this one primitive
-				GatherShadowsForPrimitiveInner(*NodePrimitiveIt, PreShadows, ViewDependentWholeSceneShadows, bStaticSceneOnly);
+				GatherShadowsForPrimitiveInner(*NodePrimitiveIt, PreShadows, SerialViewDependentWholeSceneShadows, bStaticSceneOnly);
 			}
 		}
 
@@ -2282,6 +2580,8 @@ void FDeferredShadingSceneRenderer::InitDynamicShadows(FRHICommandListImmediate&
 	{
 		SCOPE_CYCLE_COUNTER(STAT_InitDynamicShadowsTime);
 
+		ReleaseUnusedCachedShadows();
+
 		for (TSparseArray<FLightSceneInfoCompact>::TConstIterator LightIt(Scene->Lights); LightIt; ++LightIt)
 		{
 			const FLightSceneInfoCompact& LightSceneInfoCompact = *LightIt;
@@ -2364,6 +2664,16 @@ void FDeferredShadingSceneRenderer::InitDynamicShadows(FRHICommandListImmediate&
 	// Clear old preshadows and attempt to add new ones to the cache
 	UpdatePreshadowCache();
 
+	// Cascades that reuse depths from a previous frame don't need their casters
+	for (int32 ShadowIndex = ViewDependentWholeSceneShadowsThatNeedCulling.Num() - 1; ShadowIndex >= 0; ShadowIndex--)
+	{
+		FProjectedShadowInfo* ProjectedShadowInfo = ViewDependentWholeSceneShadowsThatNeedCulling[ShadowIndex];
+		if (AllocateCachedShadowCascade(ProjectedShadowInfo) && ProjectedShadowInfo->bDepthsCached)
+		{
+			ViewDependentWholeSceneShadowsThatNeedCulling.RemoveAt(ShadowIndex);
+		}
+	}
+
 	// Gathers the list of primitives used to draw various shadow types
 	GatherShadowPrimitives(PreShadows, ViewDependentWholeSceneShadowsThatNeedCulling, bStaticSceneOnly);
 
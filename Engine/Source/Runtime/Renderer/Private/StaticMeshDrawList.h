@@ -7,6 +7,8 @@
 #ifndef __STATICMESHDRAWLIST_H__
 #define __STATICMESHDRAWLIST_H__
 
+extern TAutoConsoleVariable<int32> CVarStaticDrawListMinDrawsPerCmdList;
+
 /** Base class of the static draw list, used when comparing draw lists and the drawing policy type is not necessary. */
 class FStaticMeshDrawListBase
 {
@@ -74,14 +76,29 @@ inline FDrawListSortKey GetSortKey(bool bBackground, float BoundsRadius, float D
 template<typename DrawingPolicyType>
 class FDrawVisibleAnyThreadTask;
 
+template<typename DrawingPolicyType>
+class FDrawVisibleElementsAnyThreadTask;
+
 template<typename DrawingPolicyType>
 class TStaticMeshDrawList : public FStaticMeshDrawListBase, public FRenderResource
 {
 public:
 	friend class FDrawVisibleAnyThreadTask<DrawingPolicyType>;
+	friend class FDrawVisibleElementsAnyThreadTask<DrawingPolicyType>;
 
 	typedef typename DrawingPolicyType::ElementDataType ElementPolicyDataType;
 
+	/** A visible element of the draw list, in drawing order */
+	struct FVisibleElement
+	{
+		/** Index of the element's drawing policy in OrderedDrawingPolicies */
+		int32 PolicyIndex;
+		int32 ElementIndex;
+		uint64 BatchElementMask;
+	};
+
+	typedef TArray<FVisibleElement, SceneRenderingAllocator> FVisibleElementArray;
+
 private:
 
 	/** A handle to an element in the draw list.  Used by FStaticMesh to keep track of draw lists containing the mesh. */
@@ -243,6 +260,21 @@ private:
 	*/
 	void DrawElement(FRHICommandList& RHICmdList, const FViewInfo& View, const typename DrawingPolicyType::ContextDataType PolicyContext, const FElement& Element, uint64 BatchElementMask, FDrawingPolicyLink* DrawingPolicyLink, bool &bDrawnShared);
 
+	/**
+	* Builds the list of the visible elements, so the draws can be split evenly across command lists and empty policies are skipped.
+	* @param StaticMeshVisibilityMap - An map from FStaticMesh::Id to visibility state.
+	* @param BatchVisibilityArray - An array of batch element visibility bitmasks.
+	* @param OutVisibleElements - Receives the visible elements in drawing order
+	*/
+	void GatherVisibleElements(const TBitArray<SceneRenderingBitArrayAllocator>& StaticMeshVisibilityMap, const TArray<uint64, SceneRenderingAllocator>& BatchVisibilityArray, FVisibleElementArray& OutVisibleElements) const;
+
+	/**
+	* Draws a range of the elements gathered by GatherVisibleElements
+	* @param FirstElement - First visible element to draw
+	* @param LastElement - Last visible element to draw
+	*/
+	void DrawVisibleElements(FRHICommandList& RHICmdList, const FViewInfo& View, const typename DrawingPolicyType::ContextDataType PolicyContext, const FVisibleElementArray& VisibleElements, int32 FirstElement, int32 LastElement);
+
 public:
 
 	/**
@@ -353,6 +353,113 @@ public:
 	}
 };
 
+template<typename DrawingPolicyType>
+void TStaticMeshDrawList<DrawingPolicyType>::GatherVisibleElements(
+	const TBitArray<SceneRenderingBitArrayAllocator>& StaticMeshVisibilityMap,
+	const TArray<uint64, SceneRenderingAllocator>& BatchVisibilityArray,
+	FVisibleElementArray& OutVisibleElements
+	) const
+{
+	for (int32 Index = 0; Index < OrderedDrawingPolicies.Num(); Index++)
+	{
+		const FDrawingPolicyLink* DrawingPolicyLink = &DrawingPolicySet[OrderedDrawingPolicies[Index]];
+		const int32 NumElements = DrawingPolicyLink->CompactElements.Num();
+		const FElementCompact* CompactElementPtr = DrawingPolicyLink->CompactElements.GetData();
+		for (int32 ElementIndex = 0; ElementIndex < NumElements; ElementIndex++, CompactElementPtr++)
+		{
+			if (StaticMeshVisibilityMap.AccessCorrespondingBit(FRelativeBitReference(CompactElementPtr->MeshId)))
+			{
+				const FElement& Element = DrawingPolicyLink->Elements[ElementIndex];
+				FVisibleElement& VisibleElement = OutVisibleElements[OutVisibleElements.AddUninitialized()];
+				VisibleElement.PolicyIndex = Index;
+				VisibleElement.ElementIndex = ElementIndex;
+				// Avoid the cache miss looking up batch visibility if there is only one element.
+				VisibleElement.BatchElementMask = Element.Mesh->Elements.Num() == 1 ? 1 : BatchVisibilityArray[Element.Mesh->Id];
+			}
+		}
+	}
+}
+
+template<typename DrawingPolicyType>
+void TStaticMeshDrawList<DrawingPolicyType>::DrawVisibleElements(
+	FRHICommandList& RHICmdList,
+	const FViewInfo& View,
+	const typename DrawingPolicyType::ContextDataType PolicyContext,
+	const FVisibleElementArray& VisibleElements,
+	int32 FirstElement, int32 LastElement
+	)
+{
+	int32 LastPolicyIndex = INDEX_NONE;
+	FDrawingPolicyLink* DrawingPolicyLink = NULL;
+	bool bDrawnShared = false;
+	for (int32 Index = FirstElement; Index <= LastElement; Index++)
+	{
+		const FVisibleElement& VisibleElement = VisibleElements[Index];
+		if (VisibleElement.PolicyIndex != LastPolicyIndex)
+		{
+			DrawingPolicyLink = &DrawingPolicySet[OrderedDrawingPolicies[VisibleElement.PolicyIndex]];
+			LastPolicyIndex = VisibleElement.PolicyIndex;
+			bDrawnShared = false;
+		}
+
+		const FElement& Element = DrawingPolicyLink->Elements[VisibleElement.ElementIndex];
+		INC_DWORD_STAT_BY(STAT_StaticMeshTriangles, Element.Mesh->GetNumPrimitives());
+		DrawElement(RHICmdList, View, PolicyContext, Element, VisibleElement.BatchElementMask, DrawingPolicyLink, bDrawnShared);
+	}
+}
+
+template<typename DrawingPolicyType>
+class FDrawVisibleElementsAnyThreadTask
+{
+	TStaticMeshDrawList<DrawingPolicyType>& Caller;
+	FRHICommandList& RHICmdList;
+	const FViewInfo& View;
+	const typename DrawingPolicyType::ContextDataType PolicyContext;
+	const typename TStaticMeshDrawList<DrawingPolicyType>::FVisibleElementArray& VisibleElements;
+
+	const int32 FirstElement;
+	const int32 LastElement;
+
+public:
+
+	FDrawVisibleElementsAnyThreadTask(
+		TStaticMeshDrawList<DrawingPolicyType>& InCaller,
+		FRHICommandList& InRHICmdList,
+		const FViewInfo& InView,
+		const typename DrawingPolicyType::ContextDataType& InPolicyContext,
+		const typename TStaticMeshDrawList<DrawingPolicyType>::FVisibleElementArray& InVisibleElements,
+		int32 InFirstElement,
+		int32 InLastElement
+		)
+		: Caller(InCaller)
+		, RHICmdList(InRHICmdList)
+		, View(InView)
+		, PolicyContext(InPolicyContext)
+		, VisibleElements(InVisibleElements)
+		, FirstElement(InFirstElement)
+		, LastElement(InLastElement)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FDrawVisibleElementsAnyThreadTask, STATGROUP_TaskGraphTasks);
+	}
+
+	ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::TrackSubsequents; }
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		this->Caller.DrawVisibleElements(this->RHICmdList, this->View, this->PolicyContext, this->VisibleElements, this->FirstElement, this->LastElement);
+		this->RHICmdList.HandleRTThreadTaskCompletion(MyCompletionGraphEvent);
+	}
+};
+
 template<typename DrawingPolicyType>
 void TStaticMeshDrawList<DrawingPolicyType>::DrawVisibleParallel(
 	const typename DrawingPolicyType::ContextDataType PolicyContext,
@@ -361,6 +468,42 @@ void TStaticMeshDrawList<DrawingPolicyType>::DrawVisibleParallel(
 	FParallelCommandListSet& ParallelCommandListSet
 	)
 {
+	const int32 MinDrawsPerCmdList = CVarStaticDrawListMinDrawsPerCmdList.GetValueOnRenderThread();
+	if (MinDrawsPerCmdList > 0)
+	{
+		// Allocated on the mem stack as the tasks outlive this call, it is freed with the rest of the frame's allocations
+		FVisibleElementArray& VisibleElements = *new(FMemStack::Get()) FVisibleElementArray();
+		GatherVisibleElements(StaticMeshVisibilityMap, BatchVisibilityArray, VisibleElements);
+
+		const int32 NumVisible = VisibleElements.Num();
+		const int32 NumCmdLists = FMath::Min<int32>(ParallelCommandListSet.Width, FMath::DivideAndRoundUp(NumVisible, MinDrawsPerCmdList));
+
+		int32 Start = 0;
+		if (NumCmdLists)
+		{
+			int32 NumPer = NumVisible / NumCmdLists;
+			int32 Extra = NumVisible - NumPer * NumCmdLists;
+
+			for (int32 ThreadIndex = 0; ThreadIndex < NumCmdLists; ThreadIndex++)
+			{
+				int32 Last = Start + (NumPer - 1) + (ThreadIndex < Extra);
+				check(Last >= Start);
+
+				FRHICommandList* CmdList = ParallelCommandListSet.NewParallelCommandList();
+
+				FGraphEventRef AnyThreadCompletionEvent = TGraphTask<FDrawVisibleElementsAnyThreadTask<DrawingPolicyType> >::CreateTask(nullptr, ENamedThreads::RenderThread)
+					.ConstructAndDispatchWhenReady(*this, *CmdList, ParallelCommandListSet.View, PolicyContext, VisibleElements, Start, Last);
+
+				ParallelCommandListSet.AddParallelCommandList(CmdList, AnyThreadCompletionEvent);
+
+				Start = Last + 1;
+			}
+
+			ParallelCommandListSet.OutDirty = true;
+		}
+		check(Start == NumVisible);
+		return;
+	}
 
 	int32 EffectiveThreads = FMath::Min<int32>(OrderedDrawingPolicies.Num(), ParallelCommandListSet.Width);
 
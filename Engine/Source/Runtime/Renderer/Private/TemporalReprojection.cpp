@@ -0,0 +1,142 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	TemporalReprojection.cpp
+=============================================================================*/
+
+#include "RendererPrivate.h"
+#include "ScenePrivate.h"
+#include "ShaderParameters.h"
+#include "ShaderParameterUtils.h"
+#include "SceneUtils.h"
+#include "TemporalReprojection.h"
+
+/** Thread group size of FTemporalReprojectionCS, per side. */
+const int32 GTemporalReprojectionGroupSize = 8;
+
+class FTemporalReprojectionCS : public FGlobalShader
+{
+	DECLARE_SHADER_TYPE(FTemporalReprojectionCS,Global)
+public:
+
+	static bool ShouldCache(EShaderPlatform Platform)
+	{
+		return IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(EShaderPlatform Platform, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Platform, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), GTemporalReprojectionGroupSize);
+	}
+
+	FTemporalReprojectionCS(const ShaderMetaType::CompiledShaderInitializerType& Initializer)
+		: FGlobalShader(Initializer)
+	{
+		DeferredParameters.Bind(Initializer.ParameterMap);
+		PrevGeometryTexture.Bind(Initializer.ParameterMap, TEXT("PrevGeometryTexture"));
+		PrevGeometrySampler.Bind(Initializer.ParameterMap, TEXT("PrevGeometrySampler"));
+		RWReprojection.Bind(Initializer.ParameterMap, TEXT("RWReprojection"));
+		RWGeometry.Bind(Initializer.ParameterMap, TEXT("RWGeometry"));
+		ViewRect.Bind(Initializer.ParameterMap, TEXT("ViewRect"));
+		HistoryValid.Bind(Initializer.ParameterMap, TEXT("HistoryValid"));
+	}
+
+	FTemporalReprojectionCS()
+	{
+	}
+
+	void SetParameters(FRHICommandList& RHICmdList, const FSceneView& View, FTextureRHIParamRef PrevGeometry, FUnorderedAccessViewRHIParamRef ReprojectionUAV, FUnorderedAccessViewRHIParamRef GeometryUAV)
+	{
+		const FComputeShaderRHIParamRef ShaderRHI = GetComputeShader();
+		FGlobalShader::SetParameters(RHICmdList, ShaderRHI, View);
+		DeferredParameters.Set(RHICmdList, ShaderRHI, View);
+
+		// a null history is only bound to keep the RHI happy, HistoryValid makes the shader ignore it
+		SetTextureParameter(RHICmdList, ShaderRHI, PrevGeometryTexture, PrevGeometrySampler, TStaticSamplerState<SF_Point,AM_Clamp,AM_Clamp,AM_Clamp>::GetRHI(), PrevGeometry ? PrevGeometry : GBlackTexture->TextureRHI.GetReference());
+		SetShaderValue(RHICmdList, ShaderRHI, HistoryValid, PrevGeometry ? 1 : 0);
+		SetShaderValue(RHICmdList, ShaderRHI, ViewRect, View.ViewRect);
+
+		RHICmdList.SetUAVParameter(ShaderRHI, RWReprojection.GetBaseIndex(), ReprojectionUAV);
+		RHICmdList.SetUAVParameter(ShaderRHI, RWGeometry.GetBaseIndex(), GeometryUAV);
+	}
+
+	void UnsetParameters(FRHICommandList& RHICmdList)
+	{
+		const FComputeShaderRHIParamRef ShaderRHI = GetComputeShader();
+		RHICmdList.SetUAVParameter(ShaderRHI, RWReprojection.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
+		RHICmdList.SetUAVParameter(ShaderRHI, RWGeometry.GetBaseIndex(), FUnorderedAccessViewRHIParamRef());
+	}
+
+	virtual bool Serialize(FArchive& Ar) override
+	{
+		bool bShaderHasOutdatedParameters = FGlobalShader::Serialize(Ar);
+		Ar << DeferredParameters;
+		Ar << PrevGeometryTexture;
+		Ar << PrevGeometrySampler;
+		Ar << RWReprojection;
+		Ar << RWGeometry;
+		Ar << ViewRect;
+		Ar << HistoryValid;
+		return bShaderHasOutdatedParameters;
+	}
+
+private:
+
+	FDeferredPixelShaderParameters DeferredParameters;
+	FShaderResourceParameter PrevGeometryTexture;
+	FShaderResourceParameter PrevGeometrySampler;
+	FShaderResourceParameter RWReprojection;
+	FShaderResourceParameter RWGeometry;
+	FShaderParameter ViewRect;
+	FShaderParameter HistoryValid;
+};
+
+IMPLEMENT_SHADER_TYPE(,FTemporalReprojectionCS,TEXT("TemporalReprojection"),TEXT("ReprojectCS"),SF_Compute);
+
+const TRefCountPtr<IPooledRenderTarget>& FTemporalReprojection::Update(FRHICommandListImmediate& RHICmdList, const FViewInfo& View)
+{
+	const uint32 FrameNumber = View.Family->FrameNumber;
+
+	if (UpdateFrameNumber == FrameNumber && ReprojectionRT)
+	{
+		return ReprojectionRT;
+	}
+
+	SCOPED_DRAW_EVENT(RHICmdList, TemporalReprojection);
+
+	const FIntPoint BufferSize = GSceneRenderTargets.GetBufferSizeXY();
+
+	// The history is only comparable if it was written on the previous frame, for the same rect of the same buffer
+	const bool bUseHistory = bHistoryValid
+		&& GeometryRT[1]
+		&& UpdateFrameNumber + 1 == FrameNumber
+		&& HistoryViewRect == View.ViewRect
+		&& HistoryBufferSize == BufferSize
+		&& !View.bCameraCut;
+
+	FPooledRenderTargetDesc Desc(FPooledRenderTargetDesc::Create2DDesc(View.ViewRect.Size(), PF_FloatRGBA, TexCreate_None, TexCreate_RenderTargetable | TexCreate_ShaderResource | TexCreate_UAV, false));
+	GRenderTargetPool.FindFreeElement(Desc, ReprojectionRT, TEXT("TemporalReprojection"));
+	GRenderTargetPool.FindFreeElement(Desc, GeometryRT[0], TEXT("TemporalReprojectionGeometry"));
+
+	TShaderMapRef<FTemporalReprojectionCS> ComputeShader(View.ShaderMap);
+	RHICmdList.SetComputeShader(ComputeShader->GetComputeShader());
+
+	FTextureRHIParamRef PrevGeometry = bUseHistory ? GeometryRT[1]->GetRenderTargetItem().ShaderResourceTexture.GetReference() : nullptr;
+	ComputeShader->SetParameters(RHICmdList, View, PrevGeometry, ReprojectionRT->GetRenderTargetItem().UAV, GeometryRT[0]->GetRenderTargetItem().UAV);
+
+	const uint32 GroupSizeX = FMath::DivideAndRoundUp(View.ViewRect.Width(), GTemporalReprojectionGroupSize);
+	const uint32 GroupSizeY = FMath::DivideAndRoundUp(View.ViewRect.Height(), GTemporalReprojectionGroupSize);
+	DispatchComputeShader(RHICmdList, *ComputeShader, GroupSizeX, GroupSizeY, 1);
+
+	ComputeShader->UnsetParameters(RHICmdList);
+
+	// This frame's geometry is the history of the next one, the old history is reused to write it
+	Swap(GeometryRT[0], GeometryRT[1]);
+	HistoryViewRect = View.ViewRect;
+	HistoryBufferSize = BufferSize;
+	UpdateFrameNumber = FrameNumber;
+	bHistoryValid = true;
+
+	return ReprojectionRT;
+}
@@ -0,0 +1,55 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	TemporalReprojection.h
+=============================================================================*/
+
+#pragma once
+
+class FViewInfo;
+
+/**
+ * Reprojection of a view to its previous frame, computed at most once per frame and shared by the temporal passes that run before the velocities are rendered.
+ * Each texel of the reprojection target holds the offset from the buffer UV of the pixel to its buffer UV on the previous frame (xy),
+ * and 1 if the previous frame saw the same surface there, 0 if it was disoccluded, off screen or there is no history (z).
+ * The target covers the view rect only, its texel 0 is the first pixel of the view rect.
+ * Kept by the view state, as the history it compares against follows the view.
+ */
+class FTemporalReprojection
+{
+public:
+
+	FTemporalReprojection() :
+		UpdateFrameNumber(UINT_MAX),
+		HistoryViewRect(0, 0, 0, 0),
+		HistoryBufferSize(0, 0),
+		bHistoryValid(false)
+	{}
+
+	/**
+	 * Returns the reprojection of the view for the current frame, computing it if no pass did yet.
+	 * Can only be called once the GBuffer and the scene depth of the frame are complete.
+	 */
+	const TRefCountPtr<IPooledRenderTarget>& Update(FRHICommandListImmediate& RHICmdList, const FViewInfo& View);
+
+	void SafeRelease()
+	{
+		ReprojectionRT.SafeRelease();
+		GeometryRT[0].SafeRelease();
+		GeometryRT[1].SafeRelease();
+		bHistoryValid = false;
+	}
+
+private:
+
+	TRefCountPtr<IPooledRenderTarget> ReprojectionRT;
+	/** World normal (xyz) and scene depth (w) of the view, for the current frame in 0 and the previous one in 1. */
+	TRefCountPtr<IPooledRenderTarget> GeometryRT[2];
+
+	/** FrameNumber of the family the reprojection was last computed for. */
+	uint32 UpdateFrameNumber;
+	/** View rect and buffer size GeometryRT[1] was written with, the history is only kept while they don't change. */
+	FIntRect HistoryViewRect;
+	FIntPoint HistoryBufferSize;
+	bool bHistoryValid;
+};
@@ -15,6 +15,8 @@
 
 class FMaterial;
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num skipped in outer translucency cascade"), STAT_NumLightsSkippedInOuterTranslucencyCascade, STATGROUP_LightRendering);
+
 /** Whether to allow rendering translucency shadow depths. */
 bool GUseTranslucencyShadowDepths = true;
  
@@ -899,7 +901,7 @@ public:
 				ShadowDepthTexture,
 				ShadowDepthTextureSampler,
 				TStaticSamplerState<SF_Point,AM_Clamp,AM_Clamp,AM_Clamp>::GetRHI(),
-				GSceneRenderTargets.GetShadowDepthZTexture()
+				ShadowMap->GetShadowDepthZTexture()
 				);
 		}
 
@@ -1252,6 +1254,24 @@ FVolumeBounds CalculateLightVolumeBounds(const FSphere& LightBounds, const FView
 	return VolumeBounds;
 }
 
+/** 
+ * Returns true if a local light only affects the part of the inner cascade where the outer cascade has no weight, so injecting it into the outer cascade is wasted.
+ * Must match the cascade transition of GetTranslucencyLighting in BasePassPixelShader.usf.
+ */
+static bool IsLightInsideInnerCascade(const FSphere& LightBounds, const FViewInfo& View)
+{
+	// With a TransitionScale of 6 the outer cascade isn't sampled in the center 2/3 of the inner one.
+	// The margin covers the particle lighting offsets (half an inner voxel), the trilinear filtering and the blur of the outer cascade (a voxel each)
+	const float Margin = View.TranslucencyVolumeVoxelSize[TVC_Inner] + 2.0f * View.TranslucencyVolumeVoxelSize[TVC_Outer];
+	const FVector InnerMin = View.TranslucencyLightingVolumeMin[TVC_Inner] + View.TranslucencyLightingVolumeSize[TVC_Inner] / 6.0f;
+	const FVector InnerMax = View.TranslucencyLightingVolumeMin[TVC_Inner] + View.TranslucencyLightingVolumeSize[TVC_Inner] * (5.0f / 6.0f);
+	const FVector LightMin = LightBounds.Center - (LightBounds.W + Margin);
+	const FVector LightMax = LightBounds.Center + (LightBounds.W + Margin);
+
+	return LightMin.X >= InnerMin.X && LightMin.Y >= InnerMin.Y && LightMin.Z >= InnerMin.Z
+		&& LightMax.X <= InnerMax.X && LightMax.Y <= InnerMax.Y && LightMax.Z <= InnerMax.Z;
+}
+
 FGlobalBoundShaderState ObjectShadowingBoundShaderState;
 
 void FDeferredShadingSceneRenderer::AccumulateTranslucentVolumeObjectShadowing(FRHICommandList& RHICmdList, const FProjectedShadowInfo* InProjectedShadowInfo, bool bClearVolume)
@@ -1510,9 +1530,14 @@ static void InjectTranslucentLightArray(FRHICommandListImmediate& RHICmdList, co
 			const FLightSceneInfo* const LightSceneInfo = InjectionData.LightSceneInfo;
 			const bool bInverseSquared = LightSceneInfo->Proxy->IsInverseSquared();
 			const bool bDirectionalLight = LightSceneInfo->Proxy->GetLightType() == LightType_Directional;
-			const FVolumeBounds VolumeBounds = CalculateLightVolumeBounds(LightSceneInfo->Proxy->GetBoundingSphere(), View, VolumeCascadeIndex, bDirectionalLight);
+			const FSphere LightBounds = LightSceneInfo->Proxy->GetBoundingSphere();
+			const FVolumeBounds VolumeBounds = CalculateLightVolumeBounds(LightBounds, View, VolumeCascadeIndex, bDirectionalLight);
 
-			if (VolumeBounds.IsValid())
+			if (VolumeCascadeIndex == TVC_Outer && !bDirectionalLight && IsLightInsideInnerCascade(LightBounds, View))
+			{
+				INC_DWORD_STAT(STAT_NumLightsSkippedInOuterTranslucencyCascade);
+			}
+			else if (VolumeBounds.IsValid())
 			{
 				TShaderMapRef<FWriteToSliceVS> VertexShader(View.ShaderMap);
 				TShaderMapRef<FWriteToSliceGS> GeometryShader(View.ShaderMap);
@@ -1717,7 +1742,11 @@ void FDeferredShadingSceneRenderer::InjectSimpleTranslucentVolumeLightingArray(F
 					const FSphere LightBounds(SimpleLightPerViewData.Position, SimpleLight.Radius);
 					const FVolumeBounds VolumeBounds = CalculateLightVolumeBounds(LightBounds, View, VolumeCascadeIndex, false);
 
-					if (VolumeBounds.IsValid())
+					if (VolumeCascadeIndex == TVC_Outer && IsLightInsideInnerCascade(LightBounds, View))
+					{
+						INC_DWORD_STAT(STAT_NumLightsSkippedInOuterTranslucencyCascade);
+					}
+					else if (VolumeBounds.IsValid())
 					{
 						TShaderMapRef<FWriteToSliceVS> VertexShader(View.ShaderMap);
 						TShaderMapRef<FWriteToSliceGS> GeometryShader(View.ShaderMap);
@@ -27,6 +27,13 @@ class SceneRenderingAllocator
 {
 };
 
+// Shortcut for the allocator used by scene rendering data that is filled outside of the rendering thread marks,
+// like the view elements gathered on the game thread. Lasts until the end of the next frame.
+class SceneRenderingFrameAllocator
+	: public TFrameMemStackAllocator<>
+{
+};
+
 /** All necessary data to create a render target from the pooled render targets. */
 struct FPooledRenderTargetDesc
 {
@@ -170,6 +177,27 @@ public:
 			&& bForceSeparateTargetAndShaderResource == rhs.bForceSeparateTargetAndShaderResource;
 	}
 
+	/**
+	 * Whether a render target created with this desc can be handed out for a request of rhs, so render targets whose
+	 * lifetimes don't overlap can share memory. Like Compare() without TexCreate_FastVRAM, but it allows more
+	 * targetable flags than requested (e.g. a TexCreate_UAV target for a request without it). Requests for textures
+	 * that aren't targetable only take exact matches, they can be locked.
+	 */
+	bool IsCompatible(const FPooledRenderTargetDesc& rhs) const
+	{
+		return Extent == rhs.Extent
+			&& Depth == rhs.Depth
+			&& bIsArray == rhs.bIsArray
+			&& ArraySize == rhs.ArraySize
+			&& NumMips == rhs.NumMips
+			&& NumSamples == rhs.NumSamples
+			&& Format == rhs.Format
+			&& (Flags & ~TexCreate_FastVRAM) == (rhs.Flags & ~TexCreate_FastVRAM)
+			&& rhs.TargetableFlags != 0
+			&& (TargetableFlags & rhs.TargetableFlags) == rhs.TargetableFlags
+			&& bForceSeparateTargetAndShaderResource == rhs.bForceSeparateTargetAndShaderResource;
+	}
+
 	bool IsCubemap() const
 	{
 		return Extent.X != 0 && Extent.Y == 0 && Depth == 0;
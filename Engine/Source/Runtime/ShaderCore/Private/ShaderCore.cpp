@@ -105,6 +105,9 @@ FCriticalSection FileCacheCriticalSection;
 /** The shader file cache, used to minimize shader file reads */
 TMap<FString, FString> GShaderFileCache;
 
+/** Incremented every time the shader file cache is flushed, see GetShaderFileCacheGeneration. */
+static FThreadSafeCounter GShaderFileCacheGeneration;
+
 /** The shader file hash cache, used to minimize loading and hashing shader files */
 TMap<FString, FSHAHash> GShaderHashCache;
 
@@ -551,6 +554,7 @@ void FlushShaderFileCache()
 {
 	GShaderHashCache.Empty();
 	GShaderFileCache.Empty();
+	GShaderFileCacheGeneration.Increment();
 
 	if (!FPlatformProperties::RequiresCookedData())
 	{
@@ -569,6 +573,11 @@ void FlushShaderFileCache()
 	}
 }
 
+uint32 GetShaderFileCacheGeneration()
+{
+	return GShaderFileCacheGeneration.GetValue();
+}
+
 void GenerateReferencedUniformBuffers(
 	const TCHAR* SourceFilename, 
 	const TCHAR* ShaderTypeName, 
@@ -554,6 +554,12 @@ extern void BuildShaderFileToUniformBufferMap(TMap<FString, TArray<const TCHAR*>
  */
 extern SHADERCORE_API void FlushShaderFileCache();
 
+/**
+ * @return Number of times FlushShaderFileCache has been called in this process.
+ * Sent to the shader compile workers, so they only re-read the shader files they cached when they may have changed.
+ */
+extern SHADERCORE_API uint32 GetShaderFileCacheGeneration();
+
 extern SHADERCORE_API void VerifyShaderSourceFiles();
 
 struct FCachedUniformBufferDeclaration
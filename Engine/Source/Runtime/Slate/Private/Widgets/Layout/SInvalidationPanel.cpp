@@ -0,0 +1,159 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "SlatePrivatePCH.h"
+#include "SInvalidationPanel.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num Invalidation Panels Replayed"), STAT_SlateNumReplayedInvalidationPanels, STATGROUP_Slate);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num Elements Replayed"), STAT_SlateNumReplayedElements, STATGROUP_Slate);
+
+static int32 GSlateEnableInvalidationPanels = 1;
+static FAutoConsoleVariableRef CVarSlateEnableInvalidationPanels(
+	TEXT("Slate.EnableInvalidationPanels"),
+	GSlateEnableInvalidationPanels,
+	TEXT("When 0, invalidation panels paint their content every frame instead of replaying what they cached.")
+	);
+
+extern SLATECORE_API int32 bFoldTick;
+
+SInvalidationPanel::SInvalidationPanel()
+	: bCacheEnabled(true)
+	, bNeedsRepaint(true)
+	, CachedLayerId(0)
+	, CachedMaxLayerId(0)
+	, CachedColorAndOpacityTint(FLinearColor::White)
+	, CachedForegroundColor(FLinearColor::White)
+	, bCachedParentEnabled(true)
+	, CachedContentDesiredSize(FVector2D::ZeroVector)
+{
+}
+
+void SInvalidationPanel::Construct( const FArguments& InArgs )
+{
+	ChildSlot
+	[
+		InArgs._Content.Widget
+	];
+
+	bCacheEnabled = InArgs._CacheEnabled;
+}
+
+void SInvalidationPanel::SetContent( const TSharedRef< SWidget >& InContent )
+{
+	ChildSlot
+	[
+		InContent
+	];
+
+	InvalidateCache();
+}
+
+void SInvalidationPanel::InvalidateCache()
+{
+	bNeedsRepaint = true;
+}
+
+void SInvalidationPanel::SetCacheEnabled( bool bInCacheEnabled )
+{
+	bCacheEnabled = bInCacheEnabled;
+	InvalidateCache();
+}
+
+bool SInvalidationPanel::CanReplayCache( const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const
+{
+	return !bNeedsRepaint &&
+		LayerId == CachedLayerId &&
+		AllottedGeometry == CachedGeometry &&
+		AllottedGeometry.GetAccumulatedRenderTransform() == CachedGeometry.GetAccumulatedRenderTransform() &&
+		MyClippingRect == CachedClippingRect &&
+		InWidgetStyle.GetColorAndOpacityTint() == CachedColorAndOpacityTint &&
+		InWidgetStyle.GetForegroundColor() == CachedForegroundColor &&
+		bParentEnabled == bCachedParentEnabled &&
+		ChildSlot.GetWidget()->GetDesiredSize() == CachedContentDesiredSize;
+}
+
+void SInvalidationPanel::TickAndRecordHittest( const FPaintArgs& Args, const TSharedRef<SWidget>& Widget, const FGeometry& WidgetGeometry, const FSlateRect& ClippingRect )
+{
+	// Same as SWidget::Paint
+	if ( bFoldTick )
+	{
+		FGeometry TickGeometry = WidgetGeometry;
+		TickGeometry.AppendTransform( FSlateLayoutTransform(Args.GetWindowToDesktopTransform()) );
+
+		Widget->Tick( TickGeometry, Args.GetCurrentTime(), Args.GetDeltaTime() );
+	}
+
+	const FPaintArgs UpdatedArgs = Args.RecordHittestGeometry( &Widget.Get(), WidgetGeometry, ClippingRect );
+
+	FArrangedChildren ArrangedChildren(EVisibility::Visible);
+	Widget->ArrangeChildren(WidgetGeometry, ArrangedChildren);
+
+	for ( int32 ChildIndex = 0; ChildIndex < ArrangedChildren.Num(); ++ChildIndex )
+	{
+		const FArrangedWidget& Child = ArrangedChildren[ChildIndex];
+		TickAndRecordHittest( UpdatedArgs.WithNewParent(&Widget.Get()), Child.Widget, Child.Geometry, Child.Geometry.GetClippingRect().IntersectionWith(ClippingRect) );
+	}
+}
+
+int32 SInvalidationPanel::OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const
+{
+	// Whatever is under the cursor or has focus reacts to it (hover brushes, carets...) so it isn't cached while it does
+	const bool bCanCache = bCacheEnabled && GSlateEnableInvalidationPanels && !IsHovered() && !HasFocusedDescendants();
+
+	if ( bCanCache && CanReplayCache(AllottedGeometry, MyClippingRect, LayerId, InWidgetStyle, bParentEnabled) )
+	{
+		FArrangedChildren ArrangedChildren(EVisibility::Visible);
+		this->ArrangeChildren(AllottedGeometry, ArrangedChildren);
+
+		if ( ArrangedChildren.Num() > 0 )
+		{
+			check( ArrangedChildren.Num() == 1 );
+			const FArrangedWidget& TheChild = ArrangedChildren[0];
+
+			// The clipping rect SCompoundWidget::OnPaint gives the content
+			const FSlateRect ChildClippingRect = AllottedGeometry.GetClippingRect().InsetBy( ChildSlot.SlotPadding.Get() * AllottedGeometry.Scale ).IntersectionWith(MyClippingRect);
+			TickAndRecordHittest( Args.WithNewParent(this), TheChild.Widget, TheChild.Geometry, ChildClippingRect );
+		}
+
+		for ( int32 ElementIndex = 0; ElementIndex < CachedElements.Num(); ++ElementIndex )
+		{
+			OutDrawElements.AddItem( CachedElements[ElementIndex] );
+		}
+
+		INC_DWORD_STAT(STAT_SlateNumReplayedInvalidationPanels);
+		INC_DWORD_STAT_BY(STAT_SlateNumReplayedElements, CachedElements.Num());
+
+		return CachedMaxLayerId;
+	}
+
+	const int32 FirstElementIndex = OutDrawElements.GetDrawElements().Num();
+	const int32 NumDeferredPaints = OutDrawElements.GetNumDeferredPaints();
+
+	const int32 MaxLayerId = SCompoundWidget::OnPaint(Args, AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+
+	// Deferred paints are drawn after everything else, replaying the elements wouldn't queue them again
+	if ( bCanCache && OutDrawElements.GetNumDeferredPaints() == NumDeferredPaints )
+	{
+		const TArray<FSlateDrawElement>& DrawElements = OutDrawElements.GetDrawElements();
+
+		CachedElements.Reset();
+		CachedElements.Append( DrawElements.GetData() + FirstElementIndex, DrawElements.Num() - FirstElementIndex );
+
+		CachedLayerId = LayerId;
+		CachedMaxLayerId = MaxLayerId;
+		CachedGeometry = AllottedGeometry;
+		CachedClippingRect = MyClippingRect;
+		CachedColorAndOpacityTint = InWidgetStyle.GetColorAndOpacityTint();
+		CachedForegroundColor = InWidgetStyle.GetForegroundColor();
+		bCachedParentEnabled = bParentEnabled;
+		CachedContentDesiredSize = ChildSlot.GetWidget()->GetDesiredSize();
+
+		bNeedsRepaint = false;
+	}
+	else
+	{
+		CachedElements.Empty();
+		bNeedsRepaint = true;
+	}
+
+	return MaxLayerId;
+}
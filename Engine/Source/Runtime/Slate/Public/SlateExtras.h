@@ -44,6 +44,7 @@
 #include "SEditableComboBox.h"
 #include "NotificationManager.h"
 #include "SDPIScaler.h"
+#include "SInvalidationPanel.h"
 #include "SInlineEditableTextBlock.h"
 #include "SVirtualKeyboardEntry.h"
 #include "ScrollyZoomy.h"
@@ -30,6 +30,7 @@ template<typename NumericType> class SNumericEntryBox;
 template<typename OptionType> class SEditableComboBox;
 class FSlateNotificationManager;
 class SDPIScaler;
+class SInvalidationPanel;
 class SInlineEditableTextBlock;
 class SVirtualKeyboardEntry;
 class SSafeZone;
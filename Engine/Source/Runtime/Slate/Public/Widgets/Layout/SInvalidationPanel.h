@@ -0,0 +1,68 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+ * Caches the draw elements painted by its content, and replays them instead of painting the content again
+ * as long as nothing it can see has changed: its geometry, clipping, layer, style, the desired size of the content,
+ * and the cursor or the focus being inside it. Meant to wrap large parts of the UI that rarely change, like HUDs
+ * and details panels.
+ *
+ * The content is still arranged and ticked every frame so hit testing and animations keep working,
+ * only the paint is skipped. Content bound to attributes that change without resizing it (e.g. a counter)
+ * has to call InvalidateCache itself, or be kept out of the panel.
+ */
+class SLATE_API SInvalidationPanel : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SInvalidationPanel)
+		: _CacheEnabled(true)
+	{
+		_Visibility = EVisibility::SelfHitTestInvisible;
+	}
+		SLATE_DEFAULT_SLOT(FArguments, Content)
+
+		/** When false the content is painted every frame, as if it wasn't in a panel */
+		SLATE_ARGUMENT(bool, CacheEnabled)
+	SLATE_END_ARGS()
+
+	SInvalidationPanel();
+
+	void Construct( const FArguments& InArgs );
+
+	/** See the Content slot */
+	void SetContent( const TSharedRef< SWidget >& InContent );
+
+	/** Makes the content paint again on the next frame */
+	void InvalidateCache();
+
+	/** Enables or disables caching the paint of the content */
+	void SetCacheEnabled( bool bInCacheEnabled );
+
+	// SWidget interface
+	virtual int32 OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const override;
+	// End of SWidget interface
+
+private:
+	/** @return whether what was painted last time can be replayed for these paint parameters */
+	bool CanReplayCache( const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const;
+
+	/** Does the part of SWidget::Paint the cached elements can't replace for Widget and its visible descendants: ticking and recording hit test geometry */
+	static void TickAndRecordHittest( const FPaintArgs& Args, const TSharedRef<SWidget>& Widget, const FGeometry& WidgetGeometry, const FSlateRect& ClippingRect );
+
+	bool bCacheEnabled;
+
+	/** Set when the cached elements can't be used anymore */
+	mutable bool bNeedsRepaint;
+
+	/** What the content painted last time, and what it was painted with */
+	mutable TArray<FSlateDrawElement> CachedElements;
+	mutable int32 CachedLayerId;
+	mutable int32 CachedMaxLayerId;
+	mutable FGeometry CachedGeometry;
+	mutable FSlateRect CachedClippingRect;
+	mutable FLinearColor CachedColorAndOpacityTint;
+	mutable FLinearColor CachedForegroundColor;
+	mutable bool bCachedParentEnabled;
+	mutable FVector2D CachedContentDesiredSize;
+};
@@ -1183,6 +1183,17 @@ FCharacterList& FSlateFontCache::GetCharacterList( const FSlateFontInfo &InFontI
 	return FontToCharacterListCache.Add( FontKey, MakeShareable( new FCharacterList( FontKey, *this ) ) ).Get();
 }
 
+void FSlateFontCache::PrecacheCharacters( const FString& Text, const FSlateFontInfo& InFontInfo, float FontScale ) const
+{
+	FCharacterList& CharacterList = GetCharacterList( InFontInfo, FontScale );
+
+	for( int32 CharIndex = 0; CharIndex < Text.Len(); ++CharIndex )
+	{
+		// Characters that are already cached are only looked up
+		CharacterList[ Text[CharIndex] ];
+	}
+}
+
 const FFontData& FSlateFontCache::GetDefaultFontData( const FSlateFontInfo& InFontInfo ) const
 {
 	return FTInterface->GetDefaultFontData(InFontInfo);
@@ -32,5 +32,6 @@ void FSlateFontAtlas::Flush()
 	InitAtlasData();
 
 	bNeedsUpdate = true;
+	DirtyRegion = FIntRect(0, 0, AtlasWidth, AtlasHeight);
 	ConditionalUpdateTexture();
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "ElementBatcher.h"
 #include "SlateRenderTransform.h"
 #include "Internationalization/Text.h"
+#include "ParallelFor.h"
 
 // Super-hacky way of storing the scissor rect so we don't have to change all the FSlateDrawElement APIs for this hacky support.
 SLATECORE_API TOptional<FShortRect> GSlateScissorRect;
@@ -48,6 +49,8 @@ FSlateElementBatcher::FSlateElementBatcher( TSharedRef<FSlateRenderingPolicy> In
 	: ResourceManager( *InRenderingPolicy->GetResourceManager() )
 	, FontCache( *InRenderingPolicy->GetFontCache() )
 	, PixelCenterOffset( InRenderingPolicy->GetPixelCenterOffset() )
+	, CachedLayer( 0 )
+	, CachedLayerBatches( nullptr )
 {
 
 }
@@ -1432,8 +1435,9 @@ FSlateElementBatch& FSlateElementBatcher::FindBatchForElement(
 {
 	SCOPE_CYCLE_COUNTER(STAT_SlateFindBatchTime);
 
-	// See if the layer already exists.
-	TSet<FSlateElementBatch>* ElementBatches = LayerToElementBatches.Find( Layer );
+	// Consecutive elements are mostly on the same layer, skip the map lookup for them.
+	// Adding a layer can move the others so only the last one found or added is cached.
+	TSet<FSlateElementBatch>* ElementBatches = ( CachedLayerBatches && CachedLayer == Layer ) ? CachedLayerBatches : LayerToElementBatches.Find( Layer );
 	if( !ElementBatches )
 	{
 		// The layer doesn't exist so make it now
@@ -1441,6 +1445,9 @@ FSlateElementBatch& FSlateElementBatcher::FindBatchForElement(
 	}
 	check( ElementBatches );
 
+	CachedLayer = Layer;
+	CachedLayerBatches = ElementBatches;
+
 	// Create a temp batch so we can use it as our key to find if the same batch already exists
 	FSlateElementBatch TempBatch( InTexture, ShaderParams, ShaderType, PrimitiveType, DrawEffects, DrawFlags, ScissorRect );
 
@@ -1492,40 +1499,8 @@ FSlateElementBatch& FSlateElementBatcher::FindBatchForElement(
 }
 
 
-void FSlateElementBatcher::AddVertices( TArray<FSlateVertex>& OutVertices, FSlateElementBatch& ElementBatch, const TArray<FSlateVertex>& VertexBatch )
-{
-	uint32 FirstIndex = OutVertices.Num();
-	OutVertices.AddUninitialized( VertexBatch.Num() );
-
-	uint32 RequiredSize =  VertexBatch.Num() * VertexBatch.GetTypeSize();
-
-	FMemory::Memcpy( &OutVertices[FirstIndex], VertexBatch.GetData(), RequiredSize );
-
-	RequiredVertexMemory += RequiredSize;
-	TotalVertexMemory += VertexBatch.GetAllocatedSize();
-	NumVertices += VertexBatch.Num();
-
-	ElementBatch.VertexOffset = FirstIndex;
-	ElementBatch.NumVertices = VertexBatch.Num();
-}
-
-
-void FSlateElementBatcher::AddIndices( TArray<SlateIndex>& OutIndices, FSlateElementBatch& ElementBatch, const TArray<SlateIndex>& IndexBatch )
-{
-	uint32 FirstIndex = OutIndices.Num();
-	OutIndices.AddUninitialized( IndexBatch.Num() );
-
-	uint32 RequiredSize =  IndexBatch.Num() * IndexBatch.GetTypeSize();
-
-	FMemory::Memcpy( &OutIndices[FirstIndex], IndexBatch.GetData(), RequiredSize );
-
-	RequiredIndexMemory += RequiredSize;
-	TotalIndexMemory += IndexBatch.GetAllocatedSize();
-
-	ElementBatch.IndexOffset = FirstIndex;
-	ElementBatch.NumIndices = IndexBatch.Num();
-}
-
+/** Below this many vertices the batches are copied to the window buffers on the calling thread, it's not worth waking workers for */
+static const int32 MinVerticesForParallelCopy = 16384;
 
 void FSlateElementBatcher::FillBatchBuffers( FSlateWindowElementList& WindowElementList, bool& bRequiresStencilTest )
 {
@@ -1540,13 +1515,20 @@ void FSlateElementBatcher::FillBatchBuffers( FSlateWindowElementList& WindowElem
 	// Sort by layer
 	LayerToElementBatches.KeySort( TLess<uint32>() );
 
+	// Sorting moves the layers around
+	CachedLayerBatches = nullptr;
 
 #if STATS
 	NumLayers = FMath::Max<uint32>(NumLayers, LayerToElementBatches.Num() );
 #endif
 
+	// Batches whose vertices and indices go to the bulk lists, the copy is done once all their offsets are known
+	TArray<const FSlateElementBatch*, TInlineAllocator<256>> BatchesToCopy;
+	int32 NumBatchedVertices = 0;
+	int32 NumBatchedIndices = 0;
+
 	bRequiresStencilTest = false;
-	// For each element batch add its vertices and indices to the bulk lists.
+	// For each element batch work out where its vertices and indices go in the bulk lists.
 	for( TMap< uint32, TSet<FSlateElementBatch> >::TIterator It( LayerToElementBatches ); It; ++It )
 	{
 		TSet<FSlateElementBatch>& ElementBatches = It.Value();
@@ -1558,8 +1540,6 @@ void FSlateElementBatcher::FillBatchBuffers( FSlateWindowElementList& WindowElem
 		{
 			FSlateElementBatch& ElementBatch = *BatchIt;
 
-			bool bIsMaterial = ElementBatch.GetShaderResource() && ElementBatch.GetShaderResource()->GetType() == ESlateShaderResource::Material;
-
 			if( !ElementBatch.GetCustomDrawer().IsValid() )
 			{
 				if( ElementBatch.GetShaderType() == ESlateShader::LineSegment )
@@ -1567,10 +1547,10 @@ void FSlateElementBatcher::FillBatchBuffers( FSlateWindowElementList& WindowElem
 					bRequiresStencilTest = true;
 				}
 
-				TArray<FSlateVertex>& BatchVertices = BatchVertexArrays[ ElementBatch.VertexArrayIndex ];
+				const TArray<FSlateVertex>& BatchVertices = BatchVertexArrays[ ElementBatch.VertexArrayIndex ];
 				VertexArrayFreeList.Add( ElementBatch.VertexArrayIndex );
 
-				TArray<SlateIndex>& BatchIndices = BatchIndexArrays[ ElementBatch.IndexArrayIndex ];
+				const TArray<SlateIndex>& BatchIndices = BatchIndexArrays[ ElementBatch.IndexArrayIndex ];
 				IndexArrayFreeList.Add( ElementBatch.IndexArrayIndex );
 
 				// We should have at least some vertices and indices in the batch or none at all
@@ -1578,14 +1558,22 @@ void FSlateElementBatcher::FillBatchBuffers( FSlateWindowElementList& WindowElem
 
 				if( BatchVertices.Num() > 0 && BatchIndices.Num() > 0  )
 				{
-					AddVertices( OutBatchedVertices, ElementBatch, BatchVertices );
-					AddIndices( OutBatchedIndices, ElementBatch, BatchIndices );
+					ElementBatch.VertexOffset = NumBatchedVertices;
+					ElementBatch.NumVertices = BatchVertices.Num();
+					ElementBatch.IndexOffset = NumBatchedIndices;
+					ElementBatch.NumIndices = BatchIndices.Num();
 
-					OutRenderBatches.Add( FSlateRenderBatch( ElementBatch ) );
+					NumBatchedVertices += BatchVertices.Num();
+					NumBatchedIndices += BatchIndices.Num();
+
+					RequiredVertexMemory += BatchVertices.Num() * BatchVertices.GetTypeSize();
+					TotalVertexMemory += BatchVertices.GetAllocatedSize();
+					RequiredIndexMemory += BatchIndices.Num() * BatchIndices.GetTypeSize();
+					TotalIndexMemory += BatchIndices.GetAllocatedSize();
+					NumVertices += BatchVertices.Num();
 
-					// Done with the batch
-					BatchVertices.Empty();
-					BatchIndices.Empty();
+					OutRenderBatches.Add( FSlateRenderBatch( ElementBatch ) );
+					BatchesToCopy.Add( &ElementBatch );
 				}
 
 			}
@@ -1596,12 +1584,33 @@ void FSlateElementBatcher::FillBatchBuffers( FSlateWindowElementList& WindowElem
 		}
 	}
 
+	OutBatchedVertices.AddUninitialized( NumBatchedVertices );
+	OutBatchedIndices.AddUninitialized( NumBatchedIndices );
+
+	// Every batch goes to its own range of the bulk lists so they can be copied in any order
+	auto CopyBatch = [&]( int32 BatchIndex )
+	{
+		const FSlateElementBatch& ElementBatch = *BatchesToCopy[BatchIndex];
+
+		TArray<FSlateVertex>& BatchVertices = BatchVertexArrays[ ElementBatch.VertexArrayIndex ];
+		TArray<SlateIndex>& BatchIndices = BatchIndexArrays[ ElementBatch.IndexArrayIndex ];
+
+		FMemory::Memcpy( OutBatchedVertices.GetData() + ElementBatch.VertexOffset, BatchVertices.GetData(), BatchVertices.Num() * BatchVertices.GetTypeSize() );
+		FMemory::Memcpy( OutBatchedIndices.GetData() + ElementBatch.IndexOffset, BatchIndices.GetData(), BatchIndices.Num() * BatchIndices.GetTypeSize() );
+
+		// Done with the batch, the memory is kept for the batches of the next frame
+		BatchVertices.Reset();
+		BatchIndices.Reset();
+	};
+
+	ParallelFor( BatchesToCopy.Num(), CopyBatch, NumBatchedVertices < MinVerticesForParallelCopy );
 }
 
 
 void FSlateElementBatcher::ResetBatches()
 {
 	LayerToElementBatches.Reset();
+	CachedLayerBatches = nullptr;
 	bRequiresVsync = false;
 }
 
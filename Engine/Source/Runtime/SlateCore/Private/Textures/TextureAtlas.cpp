@@ -42,7 +42,7 @@ const FAtlasedTextureSlot* FSlateTextureAtlas::AddTexture( uint32 TextureWidth,
 	if (NewSlot && TextureWidth > 0 && TextureHeight > 0)
 	{
 		CopyDataIntoSlot(NewSlot, Data);
-		MarkTextureDirty();
+		MarkSlotDirty(NewSlot);
 	}
 
 	return NewSlot;
@@ -58,6 +58,25 @@ void FSlateTextureAtlas::MarkTextureDirty()
 		);
 
 	bNeedsUpdate = true;
+	DirtyRegion = FIntRect(0, 0, AtlasWidth, AtlasHeight);
+}
+
+
+void FSlateTextureAtlas::MarkSlotDirty( const FAtlasedTextureSlot* Slot )
+{
+	const FIntRect SlotRegion(Slot->X, Slot->Y, Slot->X + Slot->Width, Slot->Y + Slot->Height);
+
+	if( bNeedsUpdate )
+	{
+		// Add to what is already waiting for the update
+		DirtyRegion.Include(SlotRegion.Min);
+		DirtyRegion.Include(SlotRegion.Max);
+	}
+	else
+	{
+		MarkTextureDirty();
+		DirtyRegion = SlotRegion;
+	}
 }
 
 
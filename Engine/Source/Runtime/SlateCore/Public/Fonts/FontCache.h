@@ -247,6 +247,16 @@ public:
 	 */
 	class FCharacterList& GetCharacterList( const FSlateFontInfo &InFontInfo, float FontScale ) const;
 
+	/**
+	 * Caches the characters of a string ahead of time, e.g. while loading, so the first frame that draws them doesn't have to
+	 * rasterize every new glyph. Useful for the localized strings of a screen in languages with large character sets.
+	 *
+	 * @param Text			The characters to cache, duplicates are ignored
+	 * @param InFontInfo	Information about the font that the characters will be drawn with
+	 * @param FontScale		The scale they will be drawn at
+	 */
+	void PrecacheCharacters( const FString& Text, const FSlateFontInfo& InFontInfo, float FontScale ) const;
+
 	/** 
 	 * Add a new entries into a cache atlas
 	 *
@@ -619,6 +619,9 @@ public:
 	SLATECORE_API void QueueDeferredPainting( const FDeferredPaint& InDeferredPaint );
 
 	int32 PaintDeferred( int32 LayerId );
+
+	/** @return the number of paints queued with QueueDeferredPainting */
+	int32 GetNumDeferredPaints() const { return DeferredPaintList.Num(); }
 	
 	/**
 	 * Remove all the elements from this draw list.
@@ -117,10 +117,6 @@ private:
 											 ESlateBatchDrawFlag::Type DrawFlags,
 											 const TOptional<FShortRect>& ScissorRect);
 
-	void AddVertices( TArray<FSlateVertex>& OutVertices, FSlateElementBatch& ElementBatch, const TArray<FSlateVertex>& VertexBatch );
-
-	void AddIndices( TArray<SlateIndex>& OutIndices, FSlateElementBatch& ElementBatch, const TArray<SlateIndex>& IndexBatch );
-
 private:
 
 	const FSlateBrush *SplineBrush;
@@ -128,6 +124,10 @@ private:
 	// Element batch maps sorted by layer.
 	TMap<uint32, TSet<FSlateElementBatch>> LayerToElementBatches;
 
+	// Layer FindBatchForElement found or added last, and its batches. Invalid as soon as another layer is added.
+	uint32 CachedLayer;
+	TSet<FSlateElementBatch>* CachedLayerBatches;
+
 	// Array of vertex lists that are currently free (have no elements in them).
 	TArray<uint32> VertexArrayFreeList;
 
@@ -105,6 +105,9 @@ public:
 
 	/** Marks the texture as dirty and needing its rendering resources updated */
 	void MarkTextureDirty();
+
+	/** Marks the part of the texture where a slot is as dirty, the other parts don't have to be updated for it */
+	void MarkSlotDirty( const FAtlasedTextureSlot* Slot );
 	
 	/**
 	 * Updates the texture used for rendering if needed
@@ -208,6 +211,9 @@ protected:
 	/** True if this texture needs to have its rendering resources updated */
 	bool bNeedsUpdate;
 
+	/** Part of the atlas data that changed since the rendering resources were last updated, only valid while bNeedsUpdate is set */
+	FIntRect DirtyRegion;
+
 	/** 
 	 * The type of thread that owns this atlas - this is the only thread that can safely update it 
 	 * NOTE: We don't use the thread ID here, as the render thread can be recreated if it gets suspended and resumed, giving it a new ID
@@ -113,15 +113,16 @@ void FSlateFontAtlasRHI::ConditionalUpdateTexture()
 {
 	if( bNeedsUpdate )
 	{
+		// Only the glyphs added since the last update are uploaded, as a single region. The first update and flushes cover the whole atlas.
+		const FUpdateTextureRegion2D Region( DirtyRegion.Min.X, DirtyRegion.Min.Y, 0, 0, DirtyRegion.Width(), DirtyRegion.Height() );
+		const uint32 AtlasPitch = BytesPerPixel*AtlasWidth;
+		const uint8* RegionStart = AtlasData.GetData() + DirtyRegion.Min.Y*AtlasPitch + DirtyRegion.Min.X*BytesPerPixel;
+
 		if (IsInRenderingThread())
 		{
 			FontTexture->InitResource();
 
-			uint32 DestStride;
-			uint8* TempData = (uint8*)RHILockTexture2D( FontTexture->GetTypedResource(), 0, RLM_WriteOnly, /*out*/ DestStride, false );
-			// check( DestStride == Atlas.BytesPerPixel * Atlas.AtlasWidth ); // Temporarily disabling check
-			FMemory::Memcpy( TempData, AtlasData.GetData(), BytesPerPixel*AtlasWidth*AtlasHeight );
-			RHIUnlockTexture2D( FontTexture->GetTypedResource(),0,false );
+			RHIUpdateTexture2D( FontTexture->GetTypedResource(), 0, Region, AtlasPitch, RegionStart );
 		}
 		else
 		{
@@ -129,14 +130,24 @@ void FSlateFontAtlasRHI::ConditionalUpdateTexture()
 
 			BeginInitResource( FontTexture.Get() );
 
-			ENQUEUE_UNIQUE_RENDER_COMMAND_ONEPARAMETER( SlateUpdateFontTextureCommand,
+			// Glyphs keep being added to the atlas while the render thread uploads, so it gets its own copy of the region
+			const uint32 RegionPitch = BytesPerPixel*Region.Width;
+			TArray<uint8>* RegionData = new TArray<uint8>();
+			RegionData->AddUninitialized( RegionPitch*Region.Height );
+
+			for( int32 Row = 0; Row < Region.Height; ++Row )
+			{
+				FMemory::Memcpy( RegionData->GetData() + Row*RegionPitch, RegionStart + Row*AtlasPitch, RegionPitch );
+			}
+
+			ENQUEUE_UNIQUE_RENDER_COMMAND_FOURPARAMETER( SlateUpdateFontTextureCommand,
 				FSlateFontAtlasRHI&, Atlas, *this,
+				FUpdateTextureRegion2D, Region, Region,
+				uint32, RegionPitch, RegionPitch,
+				TArray<uint8>*, RegionData, RegionData,
 			{
-				uint32 DestStride;
-				uint8* TempData = (uint8*)RHILockTexture2D( Atlas.FontTexture->GetTypedResource(), 0, RLM_WriteOnly, /*out*/ DestStride, false );
-				// check( DestStride == Atlas.BytesPerPixel * Atlas.AtlasWidth ); // Temporarily disabling check
-				FMemory::Memcpy( TempData, Atlas.AtlasData.GetData(), Atlas.BytesPerPixel*Atlas.AtlasWidth*Atlas.AtlasHeight );
-				RHIUnlockTexture2D( Atlas.FontTexture->GetTypedResource(),0,false );
+				RHIUpdateTexture2D( Atlas.FontTexture->GetTypedResource(), 0, Region, RegionPitch, RegionData->GetData() );
+				delete RegionData;
 			});
 		}
 
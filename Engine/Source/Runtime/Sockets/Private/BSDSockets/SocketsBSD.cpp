@@ -193,6 +193,103 @@ bool FSocketBSD::Recv(uint8* Data, int32 BufferSize, int32& BytesRead, ESocketRe
 }
 
 
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_MMSG
+
+/** Max number of datagrams given to a single sendmmsg or recvmmsg */
+static const int32 MaxDatagramsPerCall = 64;
+
+
+int32 FSocketBSD::SendToBatch(FSocketDatagram* Datagrams, int32 NumDatagrams)
+{
+	mmsghdr Messages[MaxDatagramsPerCall];
+	iovec Buffers[MaxDatagramsPerCall];
+
+	int32 NumSent = 0;
+	while (NumSent < NumDatagrams)
+	{
+		const int32 NumToSend = FMath::Min(NumDatagrams - NumSent, MaxDatagramsPerCall);
+		FMemory::Memzero(Messages, NumToSend * sizeof(mmsghdr));
+
+		for (int32 Index = 0; Index < NumToSend; Index++)
+		{
+			FSocketDatagram& Datagram = Datagrams[NumSent + Index];
+			Buffers[Index].iov_base = Datagram.Data;
+			Buffers[Index].iov_len = Datagram.Count;
+
+			msghdr& Header = Messages[Index].msg_hdr;
+			Header.msg_name = (sockaddr*)(FInternetAddrBSD&)*Datagram.Address;
+			Header.msg_namelen = sizeof(sockaddr_in);
+			Header.msg_iov = &Buffers[Index];
+			Header.msg_iovlen = 1;
+		}
+
+		const int32 Result = sendmmsg(Socket, Messages, NumToSend, 0);
+		if (Result <= 0)
+		{
+			break;
+		}
+
+		for (int32 Index = 0; Index < Result; Index++)
+		{
+			Datagrams[NumSent + Index].BytesTransferred = Messages[Index].msg_len;
+		}
+		NumSent += Result;
+
+		// The next datagram failed, the error is reported by the next call
+		if (Result < NumToSend)
+		{
+			break;
+		}
+	}
+
+	if (NumSent > 0)
+	{
+		LastActivityTime = FDateTime::UtcNow();
+	}
+	return NumSent;
+}
+
+
+int32 FSocketBSD::RecvFromBatch(FSocketDatagram* Datagrams, int32 NumDatagrams, ESocketReceiveFlags::Type Flags)
+{
+	mmsghdr Messages[MaxDatagramsPerCall];
+	iovec Buffers[MaxDatagramsPerCall];
+
+	// A single call, so an error is never hidden behind the datagrams that were read before it
+	const int32 NumToRead = FMath::Min(NumDatagrams, MaxDatagramsPerCall);
+	FMemory::Memzero(Messages, NumToRead * sizeof(mmsghdr));
+
+	for (int32 Index = 0; Index < NumToRead; Index++)
+	{
+		FSocketDatagram& Datagram = Datagrams[Index];
+		Buffers[Index].iov_base = Datagram.Data;
+		Buffers[Index].iov_len = Datagram.Count;
+
+		msghdr& Header = Messages[Index].msg_hdr;
+		Header.msg_name = (sockaddr*)(FInternetAddrBSD&)*Datagram.Address;
+		Header.msg_namelen = sizeof(sockaddr_in);
+		Header.msg_iov = &Buffers[Index];
+		Header.msg_iovlen = 1;
+	}
+
+	const int32 Result = recvmmsg(Socket, Messages, NumToRead, TranslateFlags(Flags), NULL);
+	if (Result <= 0)
+	{
+		return 0;
+	}
+
+	for (int32 Index = 0; Index < Result; Index++)
+	{
+		Datagrams[Index].BytesTransferred = Messages[Index].msg_len;
+	}
+
+	LastActivityTime = FDateTime::UtcNow();
+	return Result;
+}
+
+#endif
+
+
 bool FSocketBSD::Wait(ESocketWaitConditions::Type Condition, FTimespan WaitTime)
 {
 	if ((Condition == ESocketWaitConditions::WaitForRead) || (Condition == ESocketWaitConditions::WaitForReadOrWrite))
@@ -41,4 +41,29 @@ bool FSocket::Recv(uint8* Data, int32 BufferSize, int32& BytesRead, ESocketRecei
 		UE_LOG(LogSockets, Verbose, TEXT("Socket '%s' Recv %i Bytes"), *SocketDescription, BytesRead );
 	}
 	return true;
-}
\ No newline at end of file
+}
+
+
+int32 FSocket::SendToBatch(FSocketDatagram* Datagrams, int32 NumDatagrams)
+{
+	for (int32 Index = 0; Index < NumDatagrams; Index++)
+	{
+		FSocketDatagram& Datagram = Datagrams[Index];
+		if (!SendTo(Datagram.Data, Datagram.Count, Datagram.BytesTransferred, *Datagram.Address))
+		{
+			return Index;
+		}
+	}
+	return NumDatagrams;
+}
+
+
+int32 FSocket::RecvFromBatch(FSocketDatagram* Datagrams, int32 NumDatagrams, ESocketReceiveFlags::Type Flags)
+{
+	// Reading more would lose the error code of the read that fails, the callers need it
+	if (NumDatagrams > 0 && RecvFrom(Datagrams[0].Data, Datagrams[0].Count, Datagrams[0].BytesTransferred, *Datagrams[0].Address, Flags))
+	{
+		return 1;
+	}
+	return 0;
+}
@@ -6,6 +6,32 @@
 #include "IPAddress.h"
 #include "SocketTypes.h"
 
+/**
+ * A datagram of a batched send or receive
+ */
+struct FSocketDatagram
+{
+	/** Buffer to send, or to receive into */
+	uint8* Data;
+
+	/** Number of bytes to send, or size of the receive buffer */
+	int32 Count;
+
+	/** Number of bytes that were sent or received */
+	int32 BytesTransferred;
+
+	/** Network byte ordered address to send to, or receiving the address of the sender */
+	FInternetAddr* Address;
+
+	FSocketDatagram()
+		: Data(NULL)
+		, Count(0)
+		, BytesTransferred(0)
+		, Address(NULL)
+	{
+	}
+};
+
 /**
  * This is our abstract base class that hides the platform specific socket implementation
  */
@@ -155,6 +181,30 @@ public:
 	 */
 	virtual bool Recv(uint8* Data, int32 BufferSize, int32& BytesRead, ESocketReceiveFlags::Type Flags = ESocketReceiveFlags::None);
 
+	/**
+	 * Sends several buffers, each to its own network byte ordered address, with as few system calls as the platform allows.
+	 * The default implementation calls SendTo for each datagram.
+	 *
+	 * @param Datagrams the datagrams to send, BytesTransferred is set on the ones that were sent
+	 * @param NumDatagrams the number of datagrams
+	 *
+	 * @return the number of datagrams sent, the first one that fails stops the batch
+	 */
+	virtual int32 SendToBatch(FSocketDatagram* Datagrams, int32 NumDatagrams);
+
+	/**
+	 * Reads the pending datagrams, up to NumDatagrams, with as few system calls as the platform allows.
+	 * The default implementation reads a single datagram with RecvFrom.
+	 *
+	 * @param Datagrams the buffers to read into, BytesTransferred and Address are set on the ones that were read
+	 * @param NumDatagrams the number of buffers
+	 * @param Flags the receive flags
+	 *
+	 * @return the number of datagrams read. When it is 0 the last error code tells why, and the platforms that report
+	 *			the source of a failed read set it on the first datagram
+	 */
+	virtual int32 RecvFromBatch(FSocketDatagram* Datagrams, int32 NumDatagrams, ESocketReceiveFlags::Type Flags = ESocketReceiveFlags::None);
+
 	/**
 	 * Blocks until the specified condition is met.
 	 *
@@ -0,0 +1,65 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "UMGPrivatePCH.h"
+#include "UserWidgetPool.h"
+
+/////////////////////////////////////////////////////
+// FUserWidgetPool
+
+void FUserWidgetPool::Release(UUserWidget* Widget)
+{
+	if ( Widget == nullptr )
+	{
+		return;
+	}
+
+	// Widgets that weren't given out by the pool are not taken
+	if ( ActiveWidgets.RemoveSingleSwap(Widget) > 0 )
+	{
+		Widget->RemoveFromParent();
+		InactiveWidgets.Add(Widget);
+	}
+}
+
+void FUserWidgetPool::ReleaseAll()
+{
+	for ( UUserWidget* Widget : ActiveWidgets )
+	{
+		if ( Widget != nullptr )
+		{
+			Widget->RemoveFromParent();
+			InactiveWidgets.Add(Widget);
+		}
+	}
+
+	ActiveWidgets.Reset();
+}
+
+void FUserWidgetPool::Reset()
+{
+	ReleaseAll();
+	InactiveWidgets.Empty();
+}
+
+UUserWidget* FUserWidgetPool::FindInactiveWidget(UClass* WidgetClass)
+{
+	for ( int32 WidgetIndex = InactiveWidgets.Num() - 1; WidgetIndex >= 0; --WidgetIndex )
+	{
+		UUserWidget* Widget = InactiveWidgets[WidgetIndex];
+
+		// The widget can be gone if it was explicitly destroyed while in the pool
+		if ( Widget == nullptr || Widget->IsPendingKill() )
+		{
+			InactiveWidgets.RemoveAtSwap(WidgetIndex);
+			continue;
+		}
+
+		if ( Widget->GetClass() == WidgetClass )
+		{
+			InactiveWidgets.RemoveAtSwap(WidgetIndex);
+			return Widget;
+		}
+	}
+
+	return nullptr;
+}
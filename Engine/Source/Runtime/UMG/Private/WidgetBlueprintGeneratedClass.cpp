@@ -46,6 +46,8 @@ void UWidgetBlueprintGeneratedClass::InitializeWidget(UUserWidget* UserWidget) c
 			}
 		}
 
+		FWidgetInitializeInfo ScratchInfo;
+
 		ClonedTree->ForEachWidget([&] (UWidget* Widget) {
 			// Not fatal if NULL, but shouldn't happen
 			if ( !ensure(Widget != nullptr) )
@@ -57,52 +59,40 @@ void UWidgetBlueprintGeneratedClass::InitializeWidget(UUserWidget* UserWidget) c
 			Widget->WidgetGeneratedBy = ClassGeneratedBy;
 #endif
 
-			// TODO UMG Make this an FName
-			FString VariableName = Widget->GetName();
-
 			Widget->bCreatedByConstructionScript = true; // Indicate it comes from a blueprint so it gets cleared when we rerun construction scripts
 
-			// Find property with the same name as the template and assign the new widget to it.
-			UObjectPropertyBase* Prop = FindField<UObjectPropertyBase>(WidgetBlueprintClass, *VariableName);
-			if ( Prop )
+			const FWidgetInitializeInfo& Info = GetWidgetInitializeInfo(Widget, ScratchInfo);
+
+			// Assign the new widget to the property with the same name as the template.
+			if ( Info.VariableProperty )
 			{
-				Prop->SetObjectPropertyValue_InContainer(UserWidget, Widget);
-				UObject* Value = Prop->GetObjectPropertyValue_InContainer(UserWidget);
+				Info.VariableProperty->SetObjectPropertyValue_InContainer(UserWidget, Widget);
+				UObject* Value = Info.VariableProperty->GetObjectPropertyValue_InContainer(UserWidget);
 				check(Value == Widget);
 			}
 
 			// Perform binding
-			for ( const FDelegateRuntimeBinding& Binding : Bindings )
+			for ( const FResolvedBinding& Resolved : Info.Bindings )
 			{
-				//TODO UMG Make this faster.
-				if ( Binding.ObjectName == VariableName )
+				const FDelegateRuntimeBinding& Binding = *Resolved.Binding;
+				UDelegateProperty* DelegateProperty = Resolved.DelegateProperty;
+
+				bool bSourcePathBound = false;
+
+				if ( Binding.SourcePath.IsValid() )
 				{
-					UDelegateProperty* DelegateProperty = FindField<UDelegateProperty>(Widget->GetClass(), FName(*( Binding.PropertyName.ToString() + TEXT("Delegate") )));
-					if ( !DelegateProperty )
-					{
-						DelegateProperty = FindField<UDelegateProperty>(Widget->GetClass(), Binding.PropertyName);
-					}
+					bSourcePathBound = Widget->AddBinding(DelegateProperty, UserWidget, Binding.SourcePath);
+				}
 
-					if ( DelegateProperty )
+				// If no native binder is found then the only possibility is that the binding is for
+				// a delegate that doesn't match the known native binders available and so we
+				// fallback to just attempting to bind to the function directly.
+				if ( bSourcePathBound == false )
+				{
+					FScriptDelegate* ScriptDelegate = DelegateProperty->GetPropertyValuePtr_InContainer(Widget);
+					if ( ScriptDelegate )
 					{
-						bool bSourcePathBound = false;
-
-						if ( Binding.SourcePath.IsValid() )
-						{
-							bSourcePathBound = Widget->AddBinding(DelegateProperty, UserWidget, Binding.SourcePath);
-						}
-
-						// If no native binder is found then the only possibility is that the binding is for
-						// a delegate that doesn't match the known native binders available and so we
-						// fallback to just attempting to bind to the function directly.
-						if ( bSourcePathBound == false )
-						{
-							FScriptDelegate* ScriptDelegate = DelegateProperty->GetPropertyValuePtr_InContainer(Widget);
-							if ( ScriptDelegate )
-							{
-								ScriptDelegate->BindUFunction(UserWidget, Binding.FunctionName);
-							}
-						}
+						ScriptDelegate->BindUFunction(UserWidget, Binding.FunctionName);
 					}
 				}
 			}
@@ -119,6 +109,53 @@ void UWidgetBlueprintGeneratedClass::InitializeWidget(UUserWidget* UserWidget) c
 	}
 }
 
+void UWidgetBlueprintGeneratedClass::BuildWidgetInitializeInfo(const UWidget* Widget, FWidgetInitializeInfo& OutInfo) const
+{
+	// TODO UMG Make this an FName
+	const FString VariableName = Widget->GetName();
+
+	// Find property with the same name as the template.
+	OutInfo.VariableProperty = FindField<UObjectPropertyBase>(this, *VariableName);
+
+	OutInfo.Bindings.Reset();
+	for ( const FDelegateRuntimeBinding& Binding : Bindings )
+	{
+		if ( Binding.ObjectName == VariableName )
+		{
+			UDelegateProperty* DelegateProperty = FindField<UDelegateProperty>(Widget->GetClass(), FName(*( Binding.PropertyName.ToString() + TEXT("Delegate") )));
+			if ( !DelegateProperty )
+			{
+				DelegateProperty = FindField<UDelegateProperty>(Widget->GetClass(), Binding.PropertyName);
+			}
+
+			if ( DelegateProperty )
+			{
+				FResolvedBinding& Resolved = OutInfo.Bindings[OutInfo.Bindings.AddUninitialized()];
+				Resolved.Binding = &Binding;
+				Resolved.DelegateProperty = DelegateProperty;
+			}
+		}
+	}
+}
+
+const UWidgetBlueprintGeneratedClass::FWidgetInitializeInfo& UWidgetBlueprintGeneratedClass::GetWidgetInitializeInfo(const UWidget* Widget, FWidgetInitializeInfo& Scratch) const
+{
+	if ( GIsEditor )
+	{
+		BuildWidgetInitializeInfo(Widget, Scratch);
+		return Scratch;
+	}
+
+	FWidgetInitializeInfo* Info = WidgetInitializeInfoCache.Find(Widget->GetFName());
+	if ( !Info )
+	{
+		Info = &WidgetInitializeInfoCache.Add(Widget->GetFName());
+		BuildWidgetInitializeInfo(Widget, *Info);
+	}
+
+	return *Info;
+}
+
 void UWidgetBlueprintGeneratedClass::PostLoad()
 {
 	Super::PostLoad();
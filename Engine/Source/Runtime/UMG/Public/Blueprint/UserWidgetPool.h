@@ -0,0 +1,72 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "UserWidget.h"
+
+#include "UserWidgetPool.generated.h"
+
+/**
+ * Keeps user widgets that aren't displayed anymore so they can be shown again instead of creating new ones.
+ * Creating a user widget duplicates its whole widget tree and builds its Slate widgets, which is too slow to
+ * do for every list row or damage number that appears.
+ *
+ * The pool must be a UPROPERTY of its owner so the garbage collector sees the widgets it holds. A released
+ * widget keeps the state it had, whoever gets it back from the pool sets it up again like a new one.
+ */
+USTRUCT()
+struct UMG_API FUserWidgetPool
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+
+	/**
+	 * Gets a released widget of WidgetClass, or creates one if there is none.
+	 *
+	 * @param Owner			World, player controller or game instance to create the widgets with, see CreateWidget
+	 * @param WidgetClass	Class of the widget, released widgets of other classes are not used
+	 */
+	template< typename UserWidgetT = UUserWidget, typename OwnerT >
+	UserWidgetT* GetOrCreateInstance(OwnerT* Owner, UClass* WidgetClass)
+	{
+		UUserWidget* Widget = FindInactiveWidget(WidgetClass);
+
+		if ( Widget == nullptr )
+		{
+			Widget = CreateWidget<UUserWidget>(Owner, WidgetClass);
+		}
+
+		if ( Widget != nullptr )
+		{
+			ActiveWidgets.Add(Widget);
+		}
+
+		return Cast<UserWidgetT>(Widget);
+	}
+
+	/** Removes a widget from its parent and keeps it for the next GetOrCreateInstance */
+	void Release(UUserWidget* Widget);
+
+	/** Releases every widget given out by the pool */
+	void ReleaseAll();
+
+	/** Releases every widget, and forgets about all of them so they can be garbage collected */
+	void Reset();
+
+	/** @return the widgets given out by the pool that haven't been released */
+	const TArray<UUserWidget*>& GetActiveWidgets() const { return ActiveWidgets; }
+
+private:
+
+	/** Removes a released widget of WidgetClass from the pool and returns it */
+	UUserWidget* FindInactiveWidget(UClass* WidgetClass);
+
+	/** Widgets given out by the pool */
+	UPROPERTY(Transient)
+	TArray<UUserWidget*> ActiveWidgets;
+
+	/** Widgets released to the pool */
+	UPROPERTY(Transient)
+	TArray<UUserWidget*> InactiveWidgets;
+};
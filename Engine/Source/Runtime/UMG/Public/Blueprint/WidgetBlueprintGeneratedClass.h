@@ -10,6 +10,7 @@
 class UMovieScene;
 class UStructProperty;
 class UUserWidget;
+class UWidget;
 class UWidgetAnimation;
 
 UENUM()
@@ -82,4 +83,34 @@ public:
 	 * binding and wiring necessary to have the user's widget perform as desired.
 	 */
 	void InitializeWidget(UUserWidget* UserWidget) const;
+
+private:
+
+	/** A binding of a widget template, with the delegate it binds */
+	struct FResolvedBinding
+	{
+		const FDelegateRuntimeBinding* Binding;
+		UDelegateProperty* DelegateProperty;
+	};
+
+	/** What InitializeWidget looks up for every widget of the tree, resolved once per widget template */
+	struct FWidgetInitializeInfo
+	{
+		/** The variable the widget is assigned to, if any */
+		UObjectPropertyBase* VariableProperty;
+
+		TArray<FResolvedBinding> Bindings;
+	};
+
+	/** Resolves the property and bindings of a widget of the tree */
+	void BuildWidgetInitializeInfo(const UWidget* Widget, FWidgetInitializeInfo& OutInfo) const;
+
+	/**
+	 * Gets the initialize info of a widget of the tree. Outside of the editor it is cached, the class can't be
+	 * recompiled so the properties stay valid. In the editor it is built into Scratch every time.
+	 */
+	const FWidgetInitializeInfo& GetWidgetInitializeInfo(const UWidget* Widget, FWidgetInitializeInfo& Scratch) const;
+
+	/** Initialize info of the widgets of the tree, by name */
+	mutable TMap<FName, FWidgetInitializeInfo> WidgetInitializeInfoCache;
 };
\ No newline at end of file
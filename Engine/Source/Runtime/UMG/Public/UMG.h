@@ -123,6 +123,7 @@
 // Blueprint
 #include "WidgetTree.h"
 #include "UserWidget.h"
+#include "UserWidgetPool.h"
 
 #include "WidgetBlueprintGeneratedClass.h"
 
@@ -93,27 +93,43 @@ struct FConstantHandler
 	FConstantHandler(FVectorVMContext& Context)
 		: Constant(DecodeConstant(Context))
 	{}
-	VM_FORCEINLINE const VectorRegister& Get(){ return Constant; }
+	VM_FORCEINLINE const VectorRegister& Get(int32 Offset){ return Constant; }
+	VM_FORCEINLINE void Advance(int32 Count){}
 };
 
-/** Handles reading of a register, advancing the pointer with each read. */
+/** Handles reading of a register, the loops advance the pointer once per batch. */
 struct FRegisterHandler
 {
 	VectorRegister* Register;
-	VectorRegister RegisterValue;
 	FRegisterHandler(FVectorVMContext& Context)
 		: Register(DecodeRegister(Context))
 	{}
-	VM_FORCEINLINE const VectorRegister& Get(){ RegisterValue = *Register++;  return RegisterValue; }
+	VM_FORCEINLINE const VectorRegister& Get(int32 Offset){ return Register[Offset]; }
+	VM_FORCEINLINE void Advance(int32 Count){ Register += Count; }
 };
 
+/**
+ * The loops run the kernel on VectorsPerBatch vectors per iteration, the independent kernels hide the latency of each other.
+ * Every kernel only reads the elements at the index it writes, so Dst can be one of the source registers.
+ */
 template<typename Kernel, typename Arg0Handler>
 VM_FORCEINLINE void VectorUnaryLoop(FVectorVMContext& Context, VectorRegister* RESTRICT Dst, int32 NumVectors)
 {
 	Arg0Handler Arg0(Context);
-	for (int32 i = 0; i < NumVectors; ++i)
+	int32 i = 0;
+	for (; i + VectorVM::VectorsPerBatch <= NumVectors; i += VectorVM::VectorsPerBatch)
 	{
-		Kernel::DoKernel(Dst++, Arg0.Get());
+		Kernel::DoKernel(Dst + 0, Arg0.Get(0));
+		Kernel::DoKernel(Dst + 1, Arg0.Get(1));
+		Kernel::DoKernel(Dst + 2, Arg0.Get(2));
+		Kernel::DoKernel(Dst + 3, Arg0.Get(3));
+		Arg0.Advance(VectorVM::VectorsPerBatch);
+		Dst += VectorVM::VectorsPerBatch;
+	}
+	for (; i < NumVectors; ++i)
+	{
+		Kernel::DoKernel(Dst++, Arg0.Get(0));
+		Arg0.Advance(1);
 	}
 }
 
@@ -122,9 +138,22 @@ VM_FORCEINLINE void VectorBinaryLoop(FVectorVMContext& Context, VectorRegister*
 {
 	Arg0Handler Arg0(Context);
 	Arg1Handler Arg1(Context);
-	for (int32 i = 0; i < NumVectors; ++i)
+	int32 i = 0;
+	for (; i + VectorVM::VectorsPerBatch <= NumVectors; i += VectorVM::VectorsPerBatch)
 	{
-		Kernel::DoKernel(Dst++, Arg0.Get(), Arg1.Get());
+		Kernel::DoKernel(Dst + 0, Arg0.Get(0), Arg1.Get(0));
+		Kernel::DoKernel(Dst + 1, Arg0.Get(1), Arg1.Get(1));
+		Kernel::DoKernel(Dst + 2, Arg0.Get(2), Arg1.Get(2));
+		Kernel::DoKernel(Dst + 3, Arg0.Get(3), Arg1.Get(3));
+		Arg0.Advance(VectorVM::VectorsPerBatch);
+		Arg1.Advance(VectorVM::VectorsPerBatch);
+		Dst += VectorVM::VectorsPerBatch;
+	}
+	for (; i < NumVectors; ++i)
+	{
+		Kernel::DoKernel(Dst++, Arg0.Get(0), Arg1.Get(0));
+		Arg0.Advance(1);
+		Arg1.Advance(1);
 	}
 }
 
@@ -134,9 +163,24 @@ VM_FORCEINLINE void VectorTrinaryLoop(FVectorVMContext& Context, VectorRegister*
 	Arg0Handler Arg0(Context);
 	Arg1Handler Arg1(Context);
 	Arg2Handler Arg2(Context);
-	for (int32 i = 0; i < NumVectors; ++i)
+	int32 i = 0;
+	for (; i + VectorVM::VectorsPerBatch <= NumVectors; i += VectorVM::VectorsPerBatch)
+	{
+		Kernel::DoKernel(Dst + 0, Arg0.Get(0), Arg1.Get(0), Arg2.Get(0));
+		Kernel::DoKernel(Dst + 1, Arg0.Get(1), Arg1.Get(1), Arg2.Get(1));
+		Kernel::DoKernel(Dst + 2, Arg0.Get(2), Arg1.Get(2), Arg2.Get(2));
+		Kernel::DoKernel(Dst + 3, Arg0.Get(3), Arg1.Get(3), Arg2.Get(3));
+		Arg0.Advance(VectorVM::VectorsPerBatch);
+		Arg1.Advance(VectorVM::VectorsPerBatch);
+		Arg2.Advance(VectorVM::VectorsPerBatch);
+		Dst += VectorVM::VectorsPerBatch;
+	}
+	for (; i < NumVectors; ++i)
 	{
-		Kernel::DoKernel(Dst++, Arg0.Get(), Arg1.Get(), Arg2.Get());
+		Kernel::DoKernel(Dst++, Arg0.Get(0), Arg1.Get(0), Arg2.Get(0));
+		Arg0.Advance(1);
+		Arg1.Advance(1);
+		Arg2.Advance(1);
 	}
 }
 
@@ -147,9 +191,26 @@ VM_FORCEINLINE void VectorQuatenaryLoop(FVectorVMContext& Context, VectorRegiste
 	Arg1Handler Arg1(Context);
 	Arg2Handler Arg2(Context);
 	Arg3Handler Arg3(Context);
-	for (int32 i = 0; i < NumVectors; ++i)
+	int32 i = 0;
+	for (; i + VectorVM::VectorsPerBatch <= NumVectors; i += VectorVM::VectorsPerBatch)
+	{
+		Kernel::DoKernel(Dst + 0, Arg0.Get(0), Arg1.Get(0), Arg2.Get(0), Arg3.Get(0));
+		Kernel::DoKernel(Dst + 1, Arg0.Get(1), Arg1.Get(1), Arg2.Get(1), Arg3.Get(1));
+		Kernel::DoKernel(Dst + 2, Arg0.Get(2), Arg1.Get(2), Arg2.Get(2), Arg3.Get(2));
+		Kernel::DoKernel(Dst + 3, Arg0.Get(3), Arg1.Get(3), Arg2.Get(3), Arg3.Get(3));
+		Arg0.Advance(VectorVM::VectorsPerBatch);
+		Arg1.Advance(VectorVM::VectorsPerBatch);
+		Arg2.Advance(VectorVM::VectorsPerBatch);
+		Arg3.Advance(VectorVM::VectorsPerBatch);
+		Dst += VectorVM::VectorsPerBatch;
+	}
+	for (; i < NumVectors; ++i)
 	{
-		Kernel::DoKernel(Dst++, Arg0.Get(), Arg1.Get(), Arg2.Get(), Arg3.Get());
+		Kernel::DoKernel(Dst++, Arg0.Get(0), Arg1.Get(0), Arg2.Get(0), Arg3.Get(0));
+		Arg0.Advance(1);
+		Arg1.Advance(1);
+		Arg2.Advance(1);
+		Arg3.Advance(1);
 	}
 }
 
@@ -824,6 +885,254 @@ uint8 VectorVM::CreateSrcOperandMask(bool bIsOp0Constant, bool bIsOp1Constant, b
 			(bIsOp3Constant ? (1 << 3) : 0) ;
 }
 
+/*------------------------------------------------------------------------------
+	Bytecode optimization.
+------------------------------------------------------------------------------*/
+
+/** Returns the number of source operands of an op. */
+static int32 GetNumSrcOperands(VectorVM::EOp Op)
+{
+	switch (Op)
+	{
+	case VectorVM::EOp::add:
+	case VectorVM::EOp::sub:
+	case VectorVM::EOp::mul:
+	case VectorVM::EOp::atan2:
+	case VectorVM::EOp::fmod:
+	case VectorVM::EOp::min:
+	case VectorVM::EOp::max:
+	case VectorVM::EOp::pow:
+	case VectorVM::EOp::dot:
+	case VectorVM::EOp::cross:
+	case VectorVM::EOp::lessthan:
+		return 2;
+	case VectorVM::EOp::mad:
+	case VectorVM::EOp::lerp:
+	case VectorVM::EOp::clamp:
+		return 3;
+	case VectorVM::EOp::compose:
+	case VectorVM::EOp::composex:
+	case VectorVM::EOp::composey:
+	case VectorVM::EOp::composez:
+	case VectorVM::EOp::composew:
+		return 4;
+	default:
+		return 1;
+	}
+}
+
+/** A decoded instruction: op, destination register, source operand mask and source operands. */
+struct FVectorVMInstruction
+{
+	VectorVM::EOp Op;
+	uint8 Dst;
+	uint8 SrcOpTypes;
+	uint8 Src[4];
+	int32 NumSrc;
+
+	bool IsSrcConstant(int32 SrcIndex) const
+	{
+		return (SrcOpTypes & (1 << SrcIndex)) != 0;
+	}
+
+	/** Returns how many source operands read the register */
+	int32 CountReads(uint8 Register) const
+	{
+		int32 Count = 0;
+		for (int32 SrcIndex = 0; SrcIndex < NumSrc; ++SrcIndex)
+		{
+			if (!IsSrcConstant(SrcIndex) && Src[SrcIndex] == Register)
+			{
+				Count++;
+			}
+		}
+		return Count;
+	}
+
+	void SetSrc(int32 SrcIndex, uint8 Operand, bool bConstant)
+	{
+		Src[SrcIndex] = Operand;
+		SrcOpTypes = (SrcOpTypes & ~(1 << SrcIndex)) | (bConstant ? (1 << SrcIndex) : 0);
+	}
+
+	/** Copies a source operand of another instruction, with its constant flag */
+	void CopySrc(int32 SrcIndex, const FVectorVMInstruction& Other, int32 OtherSrcIndex)
+	{
+		SetSrc(SrcIndex, Other.Src[OtherSrcIndex], Other.IsSrcConstant(OtherSrcIndex));
+	}
+
+	bool SrcEquals(int32 SrcIndex, const FVectorVMInstruction& Other, int32 OtherSrcIndex) const
+	{
+		return Src[SrcIndex] == Other.Src[OtherSrcIndex] && IsSrcConstant(SrcIndex) == Other.IsSrcConstant(OtherSrcIndex);
+	}
+};
+
+/**
+ * Finds the instruction reading the temporary written by Instructions[Index], when it is the only one to read it.
+ * None of the instructions in between may write the registers the instruction reads, so it can be folded into the reader.
+ *
+ * @return index of the reader, or INDEX_NONE
+ */
+static int32 FindSingleReader(const TArray<FVectorVMInstruction>& Instructions, int32 Index)
+{
+	const FVectorVMInstruction& Writer = Instructions[Index];
+	const uint8 Temp = Writer.Dst;
+	if (Temp >= VectorVM::NumTempRegisters)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 ReaderIndex = INDEX_NONE;
+	for (int32 i = Index + 1; i < Instructions.Num(); ++i)
+	{
+		const FVectorVMInstruction& Instruction = Instructions[i];
+		const int32 Reads = Instruction.CountReads(Temp);
+		if (ReaderIndex == INDEX_NONE)
+		{
+			if (Reads > 0)
+			{
+				if (Reads > 1)
+				{
+					return INDEX_NONE;
+				}
+				ReaderIndex = i;
+				if (Instruction.Dst == Temp)
+				{
+					// Overwritten by its reader, nobody else sees it
+					return ReaderIndex;
+				}
+				continue;
+			}
+			if (Instruction.Dst == Temp)
+			{
+				// Never read
+				return INDEX_NONE;
+			}
+			if (Writer.CountReads(Instruction.Dst) > 0)
+			{
+				// A source of the writer changes before the reader
+				return INDEX_NONE;
+			}
+		}
+		else
+		{
+			if (Reads > 0)
+			{
+				return INDEX_NONE;
+			}
+			if (Instruction.Dst == Temp)
+			{
+				break;
+			}
+		}
+	}
+	return ReaderIndex;
+}
+
+/** Folds Instructions[Index] into its reader if they make one of the fused ops, returns true if it did. */
+static bool FuseInstruction(TArray<FVectorVMInstruction>& Instructions, int32 Index)
+{
+	const FVectorVMInstruction& Writer = Instructions[Index];
+	if (Writer.Op != VectorVM::EOp::mul && Writer.Op != VectorVM::EOp::sub && Writer.Op != VectorVM::EOp::max)
+	{
+		return false;
+	}
+
+	const int32 ReaderIndex = FindSingleReader(Instructions, Index);
+	if (ReaderIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const FVectorVMInstruction& Reader = Instructions[ReaderIndex];
+	const uint8 Temp = Writer.Dst;
+	const int32 TempSrc = Reader.Src[0] == Temp && !Reader.IsSrcConstant(0) ? 0 : (Reader.Src[1] == Temp && !Reader.IsSrcConstant(1) ? 1 : 2);
+
+	FVectorVMInstruction Fused;
+	Fused.Dst = Reader.Dst;
+	Fused.SrcOpTypes = 0;
+	Fused.NumSrc = 3;
+
+	if (Writer.Op == VectorVM::EOp::mul && Reader.Op == VectorVM::EOp::add)
+	{
+		// t = a * b, d = t + c -> d = mad(a, b, c)
+		Fused.Op = VectorVM::EOp::mad;
+		Fused.CopySrc(0, Writer, 0);
+		Fused.CopySrc(1, Writer, 1);
+		Fused.CopySrc(2, Reader, 1 - TempSrc);
+	}
+	else if (Writer.Op == VectorVM::EOp::max && Reader.Op == VectorVM::EOp::min)
+	{
+		// t = max(x, lo), d = min(t, hi) -> d = clamp(x, lo, hi)
+		Fused.Op = VectorVM::EOp::clamp;
+		Fused.CopySrc(0, Writer, 0);
+		Fused.CopySrc(1, Writer, 1);
+		Fused.CopySrc(2, Reader, 1 - TempSrc);
+	}
+	else if (Writer.Op == VectorVM::EOp::sub && Reader.Op == VectorVM::EOp::mad && TempSrc < 2 && Reader.SrcEquals(2, Writer, 1))
+	{
+		// t = b - a, d = t * alpha + a -> d = lerp(a, b, alpha)
+		Fused.Op = VectorVM::EOp::lerp;
+		Fused.CopySrc(0, Writer, 1);
+		Fused.CopySrc(1, Writer, 0);
+		Fused.CopySrc(2, Reader, 1 - TempSrc);
+	}
+	else
+	{
+		return false;
+	}
+
+	Instructions[ReaderIndex] = Fused;
+	Instructions.RemoveAt(Index);
+	return true;
+}
+
+void VectorVM::OptimizeByteCode(TArray<uint8>& ByteCode)
+{
+	// Decode
+	TArray<FVectorVMInstruction> Instructions;
+	int32 Offset = 0;
+	while (Offset < ByteCode.Num() && static_cast<EOp>(ByteCode[Offset]) != EOp::done)
+	{
+		FVectorVMInstruction Instruction;
+		Instruction.Op = static_cast<EOp>(ByteCode[Offset]);
+		Instruction.NumSrc = GetNumSrcOperands(Instruction.Op);
+		if (Offset + 3 + Instruction.NumSrc > ByteCode.Num())
+		{
+			UE_LOG(LogVectorVM, Warning, TEXT("OptimizeByteCode: truncated bytecode, left as it is."));
+			return;
+		}
+		Instruction.Dst = ByteCode[Offset + 1];
+		Instruction.SrcOpTypes = ByteCode[Offset + 2];
+		for (int32 SrcIndex = 0; SrcIndex < Instruction.NumSrc; ++SrcIndex)
+		{
+			Instruction.Src[SrcIndex] = ByteCode[Offset + 3 + SrcIndex];
+		}
+		Instructions.Add(Instruction);
+		Offset += 3 + Instruction.NumSrc;
+	}
+
+	// Fuse, from the end so a fused op can fuse again with the op writing one of its sources
+	for (int32 Index = Instructions.Num() - 1; Index >= 0; --Index)
+	{
+		FuseInstruction(Instructions, Index);
+	}
+
+	// Encode
+	ByteCode.Reset();
+	for (const FVectorVMInstruction& Instruction : Instructions)
+	{
+		ByteCode.Add((uint8)Instruction.Op);
+		ByteCode.Add(Instruction.Dst);
+		ByteCode.Add(Instruction.SrcOpTypes);
+		for (int32 SrcIndex = 0; SrcIndex < Instruction.NumSrc; ++SrcIndex)
+		{
+			ByteCode.Add(Instruction.Src[SrcIndex]);
+		}
+	}
+	ByteCode.Add((uint8)EOp::done);
+}
+
 /*------------------------------------------------------------------------------
 	Automation test for the VM.
 ------------------------------------------------------------------------------*/
@@ -913,4 +1222,70 @@ bool FVectorVMTest::RunTest(const FString& Parameters)
 	return true;
 }
 
-#undef VM_FORCEINLINE
\ No newline at end of file
+#undef VM_FORCEINLINE
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVectorVMOptimizeTest, "Core.Math.Vector VM Optimize", EAutomationTestFlags::ATF_SmokeTest)
+
+bool FVectorVMOptimizeTest::RunTest(const FString& Parameters)
+{
+	uint8 TestCode[] =
+	{
+		(uint8)VectorVM::EOp::mul, 0x00, SRCOP_RRRR, 0x0 + VectorVM::NumTempRegisters, 0x0 + VectorVM::NumTempRegisters,	// mul r0, r100, r100
+		(uint8)VectorVM::EOp::add, 0x01, SRCOP_RRRC, 0x01, 0x00,															// add r1, c1, r0
+		(uint8)VectorVM::EOp::sub, 0x02, SRCOP_RRRR, 0x01, 0x0 + VectorVM::NumTempRegisters,								// sub r2, r1, r100
+		(uint8)VectorVM::EOp::mad, 0x03, SRCOP_RRCR, 0x02, 0x04, 0x0 + VectorVM::NumTempRegisters,							// mad r3, r2, c4, r100
+		(uint8)VectorVM::EOp::max, 0x00, SRCOP_RRCR, 0x03, 0x02,															// max r0, r3, c2
+		(uint8)VectorVM::EOp::min, VectorVM::FirstOutputRegister, SRCOP_RRCR, 0x00, 0x03,									// min r200, r0, c3
+		0x00 // terminator
+	};
+
+	TArray<uint8> OptimizedCode;
+	OptimizedCode.Append(TestCode, ARRAY_COUNT(TestCode));
+	VectorVM::OptimizeByteCode(OptimizedCode);
+
+	// mad, lerp, clamp, done
+	if (OptimizedCode.Num() != 3 * 6 + 1)
+	{
+		UE_LOG(LogVectorVM, Error, TEXT("Optimized code is %d bytes, expected %d"), OptimizedCode.Num(), 3 * 6 + 1);
+		return false;
+	}
+
+	FVector4 ConstantTable[VectorVM::MaxConstants];
+	ConstantTable[1] = FVector4(5.0f, 5.0f, 5.0f, 5.0f);
+	ConstantTable[2] = FVector4(-20.0f, -20.0f, -20.0f, -20.0f);
+	ConstantTable[3] = FVector4(20.0f, 20.0f, 20.0f, 20.0f);
+	ConstantTable[4] = FVector4(0.5f, 0.5f, 0.5f, 0.5f);
+
+	// Not a multiple of VectorsPerBatch, to run the end of the loops too
+	const int32 NumVectors = VectorVM::VectorsPerChunk - 1;
+
+	VectorRegister Input[VectorVM::VectorsPerChunk];
+	VectorRegister Outputs[2][VectorVM::VectorsPerChunk];
+	for (int32 i = 0; i < VectorVM::ChunkSize; i++)
+	{
+		reinterpret_cast<float*>(Input)[i] = static_cast<float>(i % 8) - 4.0f;
+	}
+
+	VectorRegister* InputRegisters[1] = { Input };
+	VectorRegister* OutputRegisters[1] = { Outputs[0] };
+	VectorVM::Exec(TestCode, InputRegisters, 1, OutputRegisters, 1, ConstantTable, NumVectors);
+	OutputRegisters[0] = Outputs[1];
+	VectorVM::Exec(OptimizedCode.GetData(), InputRegisters, 1, OutputRegisters, 1, ConstantTable, NumVectors);
+
+	for (int32 i = 0; i < NumVectors * VectorVM::ElementsPerVector; i++)
+	{
+		const float Out = reinterpret_cast<float*>(Outputs[1])[i];
+		const float Expected = reinterpret_cast<float*>(Outputs[0])[i];
+		if (!FMath::IsNearlyEqual(Out, Expected))
+		{
+			UE_LOG(LogVectorVM, Error, TEXT("Optimized code output vector %d element %d is wrong. Has %f expected %f"),
+				i / VectorVM::ElementsPerVector,
+				i % VectorVM::ElementsPerVector,
+				Out,
+				Expected
+				);
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -13,5 +13,7 @@ namespace VectorVM
 		ChunkSize = 128,
 		ElementsPerVector = 4,
 		VectorsPerChunk = ChunkSize / ElementsPerVector,
+		/** Vectors each kernel loop iteration works on, the loops are unrolled by hand for it */
+		VectorsPerBatch = 4,
 	};
 }
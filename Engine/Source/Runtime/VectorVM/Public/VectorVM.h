@@ -81,6 +81,15 @@ namespace VectorVM
 
 	VECTORVM_API uint8 CreateSrcOperandMask(bool bIsOp0Constant, bool bIsOp1Constant = false, bool bIsOp2Constant = false, bool bIsOp3Constant = false);
 
+	/**
+	 * Rewrites bytecode so common sequences of ops run as a single op, each op costs a dispatch per chunk of vectors.
+	 * A temporary that is only read by the next op using it is folded into that op:
+	 *	mul + add		-> mad
+	 *	sub + mad		-> lerp (results can differ in the last bit)
+	 *	max + min		-> clamp
+	 */
+	VECTORVM_API void OptimizeByteCode(TArray<uint8>& ByteCode);
+
 	/**
 	 * Execute VectorVM bytecode.
 	 */
@@ -536,6 +536,15 @@ void FD3D11DynamicRHI::InitD3DDevice()
 			DeviceFlags &= ~D3D11_CREATE_DEVICE_SINGLETHREADED;
 		}
 
+#if PLATFORM_SUPPORTS_RHI_THREAD
+		// The render thread creates resources while the RHI thread uses the immediate context.
+		// -norhithread keeps the single threaded device, ToggleRHIThread then can't turn the RHI thread on.
+		if (!FParse::Param(FCommandLine::Get(), TEXT("norhithread")))
+		{
+			DeviceFlags &= ~D3D11_CREATE_DEVICE_SINGLETHREADED;
+		}
+#endif
+
 		// Creating the Direct3D device.
 		VERIFYD3D11RESULT(D3D11CreateDevice(
 			Adapter,
@@ -565,6 +574,7 @@ void FD3D11DynamicRHI::InitD3DDevice()
 		VERIFYD3D11RESULT(Direct3DDevice->CheckFeatureSupport(D3D11_FEATURE_THREADING,&ThreadingSupport,sizeof(ThreadingSupport)));
 		GRHISupportsAsyncTextureCreation = !!ThreadingSupport.DriverConcurrentCreates
 			&& (DeviceFlags & D3D11_CREATE_DEVICE_SINGLETHREADED) == 0;
+		GRHISupportsRHIThread = PLATFORM_SUPPORTS_RHI_THREAD && (DeviceFlags & D3D11_CREATE_DEVICE_SINGLETHREADED) == 0;
 
 		GShaderPlatformForFeatureLevel[ERHIFeatureLevel::ES2] = SP_PCD3D_ES2;
 		GShaderPlatformForFeatureLevel[ERHIFeatureLevel::ES3_1] = SP_NumPlatforms;
@@ -38,7 +38,8 @@ FXAudio2SoundSource::FXAudio2SoundSource(FAudioDevice* InAudioDevice)
 	CurrentBuffer( 0 ),
 	bBuffersToFlush( false ),
 	bLoopCallback( false ),
-	bResourcesNeedFreeing( false )
+	bResourcesNeedFreeing( false ),
+	RealtimeDecode( NULL )
 {
 	AudioDevice = ( FXAudio2Device* )InAudioDevice;
 	check( AudioDevice );
@@ -76,6 +77,9 @@ void FXAudio2SoundSource::FreeResources( void )
 		Source = NULL;
 	}
 
+	// The decode in flight writes to the buffers and owns the decompression state
+	FinishRealtimeDecode();
+
 	// If we're a streaming buffer...
 	if( bResourcesNeedFreeing )
 	{
@@ -151,6 +155,37 @@ bool FXAudio2SoundSource::ReadMorePCMData( const int32 BufferIndex )
 	}
 }
 
+bool FXAudio2SoundSource::CanDecodeInBackground( void ) const
+{
+	// Procedural waves generate their data on the audio thread, and streaming waves read chunks owned by the streaming manager
+	const USoundWave* WaveData = WaveInstance->WaveData;
+	return XAudio2Buffer->SoundFormat == SoundFormat_PCMRT && WaveData && !WaveData->bProcedural;
+}
+
+void FXAudio2SoundSource::StartRealtimeDecode( const int32 BufferIndex )
+{
+	check( RealtimeDecode == NULL );
+
+	RealtimeDecode = new FXAudio2RealtimeDecode( XAudio2Buffer, ( uint8* )XAudio2Buffers[BufferIndex].pAudioData, WaveInstance->LoopingMode != LOOP_Never );
+	RealtimeDecode->StartBackgroundTask();
+}
+
+bool FXAudio2SoundSource::FinishRealtimeDecode( void )
+{
+	bool bLooped = false;
+
+	if( RealtimeDecode )
+	{
+		RealtimeDecode->EnsureCompletion();
+		bLooped = RealtimeDecode->GetTask().GetLooped();
+
+		delete RealtimeDecode;
+		RealtimeDecode = NULL;
+	}
+
+	return bLooped;
+}
+
 /** 
  * Submit the relevant audio buffers to the system
  */
@@ -175,14 +210,24 @@ void FXAudio2SoundSource::SubmitPCMRTBuffers( void )
 	XAudio2Buffers[1].pAudioData = ( uint8* )FMemory::Malloc( MONO_PCM_BUFFER_SIZE * Buffer->NumChannels );
 	XAudio2Buffers[1].AudioBytes = MONO_PCM_BUFFER_SIZE * Buffer->NumChannels;
 
-	ReadMorePCMData(1);
-
-	if (XAudio2Buffers[1].AudioBytes > 0)
+	// The first buffer plays for a good while, so only it is decoded here. Starting a lot of realtime sounds in
+	// the same frame used to decode two buffers each on the audio thread.
+	if( CanDecodeInBackground() )
 	{
 		CurrentBuffer = 1;
+		StartRealtimeDecode(1);
+	}
+	else
+	{
+		ReadMorePCMData(1);
 
-		AudioDevice->ValidateAPICall( TEXT( "SubmitSourceBuffer - PCMRT" ), 
-			Source->SubmitSourceBuffer( XAudio2Buffers + 1 ) );
+		if (XAudio2Buffers[1].AudioBytes > 0)
+		{
+			CurrentBuffer = 1;
+
+			AudioDevice->ValidateAPICall( TEXT( "SubmitSourceBuffer - PCMRT" ), 
+				Source->SubmitSourceBuffer( XAudio2Buffers + 1 ) );
+		}
 	}
 
 	bResourcesNeedFreeing = true;
@@ -1037,8 +1082,14 @@ void FXAudio2SoundSource::HandleRealTimeSource( void )
 	++CurrentBuffer;
 
 	// Get the next bit of streaming data
-	const bool bLooped = ReadMorePCMData(CurrentBuffer & 1);
+	HandleRealTimeLoop( ReadMorePCMData(CurrentBuffer & 1) );
+}
 
+/**
+ * Handles the end of the data being reached while reading more realtime data
+ */
+void FXAudio2SoundSource::HandleRealTimeLoop( const bool bLooped )
+{
 	// Have we reached the end of the compressed sound?
 	if( bLooped )
 	{
@@ -1099,11 +1150,30 @@ bool FXAudio2SoundSource::IsFinished( void )
 		// Service any real time sounds
 		if( bIsRealTimeSource )
 		{
-			if( SourceState.BuffersQueued <= 1 )
+			if( RealtimeDecode )
+			{
+				// Submit the buffer decoded in the background once it is ready, or right away if the source is starving
+				if( RealtimeDecode->IsDone() || SourceState.BuffersQueued == 0 )
+				{
+					HandleRealTimeLoop( FinishRealtimeDecode() );
+
+					AudioDevice->ValidateAPICall( TEXT( "SubmitSourceBuffer - IsFinished" ), 
+						Source->SubmitSourceBuffer( &XAudio2Buffers[CurrentBuffer & 1] ) );
+				}
+			}
+			else if( SourceState.BuffersQueued <= 1 )
 			{
 				// Continue feeding new sound data (unless we are waiting for the sound to finish)
 				if( !bBuffersToFlush )
 				{
+					if( CanDecodeInBackground() )
+					{
+						// Decode the buffer after the one queued in the background, it gets submitted on a later update
+						++CurrentBuffer;
+						StartRealtimeDecode(CurrentBuffer & 1);
+						return( false );
+					}
+
 					HandleRealTimeSource();
 
 					if (XAudio2Buffers[CurrentBuffer & 1].AudioBytes > 0)
@@ -263,6 +263,9 @@ public:
 	friend class FXAudio2SoundSource;
 };
 
+/** Decodes the next buffer of a realtime XAudio2 source on a pool thread */
+typedef FAsyncTask< FAsyncRealtimeAudioDecodeWorker<FXAudio2SoundBuffer> > FXAudio2RealtimeDecode;
+
 /**
  * XAudio2 implementation of FSoundSource, the interface used to play, stop and update sources
  */
@@ -393,6 +396,18 @@ protected:
 	/** Handle obtaining more data for procedural USoundWaves. Always returns false for convenience. */
 	bool ReadProceduralData(const int32 BufferIndex);
 
+	/** Whether the realtime data of the sound can be decoded on a pool thread */
+	bool CanDecodeInBackground() const;
+
+	/** Starts decoding the next buffer of a realtime decompressed sound on a pool thread */
+	void StartRealtimeDecode(const int32 BufferIndex);
+
+	/** Waits for the pending realtime decode if any, and returns whether it looped. Buffer data can be touched again afterwards */
+	bool FinishRealtimeDecode();
+
+	/** Handles the end of the data being reached while reading more realtime data */
+	void HandleRealTimeLoop(const bool bLooped);
+
 	/**
 	 * Utility function for determining the proper index of an effect. Certain effects (such as: reverb and radio distortion) 
 	 * are optional. Thus, they may be NULL, yet XAudio2 cannot have a NULL output voice in the send list for this source voice.
@@ -427,6 +442,8 @@ protected:
 	uint32						bLoopCallback:1;
 	/** Set to true when we've allocated resources that need to be freed */
 	uint32						bResourcesNeedFreeing:1;
+	/** Decode of XAudio2Buffers[CurrentBuffer & 1] in flight, submitted once it completes */
+	FXAudio2RealtimeDecode*		RealtimeDecode;
 
 	friend class FXAudio2Device;
 	friend class FXAudio2SoundSourceCallback;